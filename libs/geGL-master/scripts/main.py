@@ -98,6 +98,46 @@ os.system(
 "./"+subscriptsDir+"generateTrapImplementation.py >"+
 outputDir+"TrapImplementation.h")
 
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateValidationCalls.py >"+
+outputDir+"ValidationCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateValidationImplementation.py >"+
+outputDir+"ValidationImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateValidationCallSites.py >"+
+outputDir+"ValidationCallSites.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateTraceFunctionIds.py >"+
+outputDir+"TraceFunctionIds.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateTraceFunctionNames.py >"+
+outputDir+"TraceFunctionNames.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateTraceCalls.py >"+
+outputDir+"TraceCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateTraceImplementation.py >"+
+outputDir+"TraceImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateTraceReplayCalls.py >"+
+outputDir+"TraceReplayCalls.h")
+
 os.system(
 "./"+subscriptsDir+"printHEADER.py "+glHeader+" "+glextHeader+" |"+
 "./"+subscriptsDir+"extractConstants.py |"+
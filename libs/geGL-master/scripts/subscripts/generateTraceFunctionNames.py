@@ -0,0 +1,22 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printTraceFunctionName(data):
+    params = data.split(",")
+    print "\""+params[1]+"\","
+
+for x in data0:
+    printTraceFunctionName(x)
+
@@ -0,0 +1,48 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def isVoid(type):
+    return type == "void" or type == "GLvoid"
+
+def printTraceImplementation(data):
+    params = data.split(",")
+    i = 2;
+    while i<len(params):
+      if re.search("\[.*\]",params[i+1]):
+        params[i] = params[i]+"*"
+      i+=2;
+    names = map(lambda x:re.sub(r"\[.*\]","",x),params[3::2])
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],names)))
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    id = "TRACE_"+params[1]
+    call = "(this->*(this->m_orig_"+params[1]+"))("+",".join(names)+")"
+    body = "this->m_callCounts["+id+"]++;"
+    body += "if(!this->m_recording)return "+call+";"
+    body += "auto const args = std::make_tuple("+",".join(names)+");"
+    body += "this->template m_beginRecord<"+id+">(args);"
+    if isVoid(params[0]):
+      body += call+";"
+      body += "this->template m_endRecord<"+id+">(args);"
+    else:
+      body += params[0]+" const result = "+call+";"
+      body += "this->template m_endRecord<"+id+">(args);"
+      body += "this->m_writeResult(result);"
+      body += "return result;"
+    print "FunctionTable::"+pfn+" m_orig_"+params[1]+" = nullptr;"
+    print params[0]+" m_"+params[1]+"_trace("+args+")const{"+body+"}"
+
+for x in data0:
+    printTraceImplementation(x)
+
@@ -0,0 +1,39 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def isVoid(type):
+    return type == "void" or type == "GLvoid"
+
+def printTraceReplayCall(data):
+    params = data.split(",")
+    i = 2;
+    while i<len(params):
+      if re.search("\[.*\]",params[i+1]):
+        params[i] = params[i]+"*"
+      i+=2;
+    types = params[2::2]
+    body = ""
+    for j in range(len(types)):
+      body += "auto const a"+str(j)+" = r.template arg<"+types[j]+">();"
+    call = "table."+params[1]+"("+",".join(map(lambda j:"a"+str(j),range(len(types))))+")"
+    if isVoid(params[0]):
+      body += call+";r.finishCall();"
+    else:
+      body += "auto const result = "+call+";r.finishCall();r.template result<"+params[0]+">(result);"
+    print "case TRACE_"+params[1]+":{"+body+"break;}"
+
+for x in data0:
+    printTraceReplayCall(x)
+
@@ -0,0 +1,27 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+#functions that are used by the validation itself
+notValidated = ["glGetError"]
+
+def printCallSite(data):
+    params = data.split(",")
+    if params[1] in notValidated:
+      return
+    print "#define "+params[1]+"(...) (ge::gl::setCallSite(__FILE__,__LINE__),"+params[1]+"(__VA_ARGS__))"
+
+for x in data0:
+    printCallSite(x)
+
@@ -0,0 +1,28 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+#functions that are used by the validation itself
+notValidated = ["glGetError"]
+
+def printValidationCall(data):
+    params = data.split(",")
+    if params[1] in notValidated:
+      return
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    print "if(this->m_ptr_"+params[1]+"){this->m_orig_"+params[1]+" = this->m_ptr_"+params[1]+";this->m_ptr_"+params[1]+" = (FunctionTable::"+pfn+")&ValidationTableDecorator::m_"+params[1]+"_validation;}"
+
+for x in data0:
+    printValidationCall(x)
+
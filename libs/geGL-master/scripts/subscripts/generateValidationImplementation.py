@@ -0,0 +1,40 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+#functions that are used by the validation itself
+notValidated = ["glGetError"]
+
+def printValidationImplementation(data):
+    params = data.split(",")
+    if params[1] in notValidated:
+      return
+    i = 2;
+    while i<len(params):
+      if re.search("\[.*\]",params[i+1]):
+        params[i] = params[i]+"*"
+      i+=2;
+    names = map(lambda x:re.sub(r"\[.*\]","",x),params[3::2])
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],names)))
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    call = "(this->*(this->m_orig_"+params[1]+"))("+",".join(names)+")"
+    print "FunctionTable::"+pfn+" m_orig_"+params[1]+" = nullptr;"
+    if params[0] == "void" or params[0] == "GLvoid":
+      print params[0]+" m_"+params[1]+"_validation("+args+")const{"+call+";this->m_checkErrors(\""+params[1]+"\");}"
+    else:
+      print params[0]+" m_"+params[1]+"_validation("+args+")const{"+params[0]+" const result = "+call+";this->m_checkErrors(\""+params[1]+"\");return result;}"
+
+for x in data0:
+    printValidationImplementation(x)
+
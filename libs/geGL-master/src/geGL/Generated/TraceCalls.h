@@ -0,0 +1,2926 @@
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV){this->m_orig_glMultiDrawArraysIndirectBindlessCountNV = this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV;this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&TraceTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_trace;}
+if(this->m_ptr_glTextureParameterfv){this->m_orig_glTextureParameterfv = this->m_ptr_glTextureParameterfv;this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&TraceTableDecorator::m_glTextureParameterfv_trace;}
+if(this->m_ptr_glGetListParameterivSGIX){this->m_orig_glGetListParameterivSGIX = this->m_ptr_glGetListParameterivSGIX;this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&TraceTableDecorator::m_glGetListParameterivSGIX_trace;}
+if(this->m_ptr_glProgramUniform1i64ARB){this->m_orig_glProgramUniform1i64ARB = this->m_ptr_glProgramUniform1i64ARB;this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&TraceTableDecorator::m_glProgramUniform1i64ARB_trace;}
+if(this->m_ptr_glVertexArrayElementBuffer){this->m_orig_glVertexArrayElementBuffer = this->m_ptr_glVertexArrayElementBuffer;this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&TraceTableDecorator::m_glVertexArrayElementBuffer_trace;}
+if(this->m_ptr_glHintPGI){this->m_orig_glHintPGI = this->m_ptr_glHintPGI;this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&TraceTableDecorator::m_glHintPGI_trace;}
+if(this->m_ptr_glStencilMaskSeparate){this->m_orig_glStencilMaskSeparate = this->m_ptr_glStencilMaskSeparate;this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&TraceTableDecorator::m_glStencilMaskSeparate_trace;}
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT){this->m_orig_glGetFramebufferAttachmentParameterivEXT = this->m_ptr_glGetFramebufferAttachmentParameterivEXT;this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_trace;}
+if(this->m_ptr_glTextureStorage3DMultisample){this->m_orig_glTextureStorage3DMultisample = this->m_ptr_glTextureStorage3DMultisample;this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&TraceTableDecorator::m_glTextureStorage3DMultisample_trace;}
+if(this->m_ptr_glGetIntegerIndexedvEXT){this->m_orig_glGetIntegerIndexedvEXT = this->m_ptr_glGetIntegerIndexedvEXT;this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&TraceTableDecorator::m_glGetIntegerIndexedvEXT_trace;}
+if(this->m_ptr_glCopyTexImage1D){this->m_orig_glCopyTexImage1D = this->m_ptr_glCopyTexImage1D;this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&TraceTableDecorator::m_glCopyTexImage1D_trace;}
+if(this->m_ptr_glVertexAttrib4usv){this->m_orig_glVertexAttrib4usv = this->m_ptr_glVertexAttrib4usv;this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&TraceTableDecorator::m_glVertexAttrib4usv_trace;}
+if(this->m_ptr_glTexRenderbufferNV){this->m_orig_glTexRenderbufferNV = this->m_ptr_glTexRenderbufferNV;this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&TraceTableDecorator::m_glTexRenderbufferNV_trace;}
+if(this->m_ptr_glVertexAttrib3hvNV){this->m_orig_glVertexAttrib3hvNV = this->m_ptr_glVertexAttrib3hvNV;this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&TraceTableDecorator::m_glVertexAttrib3hvNV_trace;}
+if(this->m_ptr_glProgramUniform4ui64ARB){this->m_orig_glProgramUniform4ui64ARB = this->m_ptr_glProgramUniform4ui64ARB;this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&TraceTableDecorator::m_glProgramUniform4ui64ARB_trace;}
+if(this->m_ptr_glInstrumentsBufferSGIX){this->m_orig_glInstrumentsBufferSGIX = this->m_ptr_glInstrumentsBufferSGIX;this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&TraceTableDecorator::m_glInstrumentsBufferSGIX_trace;}
+if(this->m_ptr_glIndexi){this->m_orig_glIndexi = this->m_ptr_glIndexi;this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&TraceTableDecorator::m_glIndexi_trace;}
+if(this->m_ptr_glMultiTexCoord2sARB){this->m_orig_glMultiTexCoord2sARB = this->m_ptr_glMultiTexCoord2sARB;this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&TraceTableDecorator::m_glMultiTexCoord2sARB_trace;}
+if(this->m_ptr_glProgramEnvParameter4fARB){this->m_orig_glProgramEnvParameter4fARB = this->m_ptr_glProgramEnvParameter4fARB;this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&TraceTableDecorator::m_glProgramEnvParameter4fARB_trace;}
+if(this->m_ptr_glCompressedTexSubImage3D){this->m_orig_glCompressedTexSubImage3D = this->m_ptr_glCompressedTexSubImage3D;this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&TraceTableDecorator::m_glCompressedTexSubImage3D_trace;}
+if(this->m_ptr_glEvalCoord2d){this->m_orig_glEvalCoord2d = this->m_ptr_glEvalCoord2d;this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&TraceTableDecorator::m_glEvalCoord2d_trace;}
+if(this->m_ptr_glEvalCoord2f){this->m_orig_glEvalCoord2f = this->m_ptr_glEvalCoord2f;this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&TraceTableDecorator::m_glEvalCoord2f_trace;}
+if(this->m_ptr_glIndexd){this->m_orig_glIndexd = this->m_ptr_glIndexd;this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&TraceTableDecorator::m_glIndexd_trace;}
+if(this->m_ptr_glSecondaryColor3hvNV){this->m_orig_glSecondaryColor3hvNV = this->m_ptr_glSecondaryColor3hvNV;this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&TraceTableDecorator::m_glSecondaryColor3hvNV_trace;}
+if(this->m_ptr_glIndexf){this->m_orig_glIndexf = this->m_ptr_glIndexf;this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&TraceTableDecorator::m_glIndexf_trace;}
+if(this->m_ptr_glFrustumxOES){this->m_orig_glFrustumxOES = this->m_ptr_glFrustumxOES;this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&TraceTableDecorator::m_glFrustumxOES_trace;}
+if(this->m_ptr_glTextureStorage3DEXT){this->m_orig_glTextureStorage3DEXT = this->m_ptr_glTextureStorage3DEXT;this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&TraceTableDecorator::m_glTextureStorage3DEXT_trace;}
+if(this->m_ptr_glDrawCommandsStatesNV){this->m_orig_glDrawCommandsStatesNV = this->m_ptr_glDrawCommandsStatesNV;this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&TraceTableDecorator::m_glDrawCommandsStatesNV_trace;}
+if(this->m_ptr_glUniform4uiEXT){this->m_orig_glUniform4uiEXT = this->m_ptr_glUniform4uiEXT;this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&TraceTableDecorator::m_glUniform4uiEXT_trace;}
+if(this->m_ptr_glProgramUniform3ui64ARB){this->m_orig_glProgramUniform3ui64ARB = this->m_ptr_glProgramUniform3ui64ARB;this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&TraceTableDecorator::m_glProgramUniform3ui64ARB_trace;}
+if(this->m_ptr_glIndexs){this->m_orig_glIndexs = this->m_ptr_glIndexs;this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&TraceTableDecorator::m_glIndexs_trace;}
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT){this->m_orig_glVertexArrayBindVertexBufferEXT = this->m_ptr_glVertexArrayBindVertexBufferEXT;this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&TraceTableDecorator::m_glVertexArrayBindVertexBufferEXT_trace;}
+if(this->m_ptr_glConvolutionParameteriEXT){this->m_orig_glConvolutionParameteriEXT = this->m_ptr_glConvolutionParameteriEXT;this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&TraceTableDecorator::m_glConvolutionParameteriEXT_trace;}
+if(this->m_ptr_glColor4ubVertex2fSUN){this->m_orig_glColor4ubVertex2fSUN = this->m_ptr_glColor4ubVertex2fSUN;this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&TraceTableDecorator::m_glColor4ubVertex2fSUN_trace;}
+if(this->m_ptr_glProgramUniform1ivEXT){this->m_orig_glProgramUniform1ivEXT = this->m_ptr_glProgramUniform1ivEXT;this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&TraceTableDecorator::m_glProgramUniform1ivEXT_trace;}
+if(this->m_ptr_glGetnMapfv){this->m_orig_glGetnMapfv = this->m_ptr_glGetnMapfv;this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&TraceTableDecorator::m_glGetnMapfv_trace;}
+if(this->m_ptr_glTransformFeedbackBufferRange){this->m_orig_glTransformFeedbackBufferRange = this->m_ptr_glTransformFeedbackBufferRange;this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&TraceTableDecorator::m_glTransformFeedbackBufferRange_trace;}
+if(this->m_ptr_glPathGlyphsNV){this->m_orig_glPathGlyphsNV = this->m_ptr_glPathGlyphsNV;this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&TraceTableDecorator::m_glPathGlyphsNV_trace;}
+if(this->m_ptr_glSecondaryColor3fv){this->m_orig_glSecondaryColor3fv = this->m_ptr_glSecondaryColor3fv;this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&TraceTableDecorator::m_glSecondaryColor3fv_trace;}
+if(this->m_ptr_glGetCombinerInputParameterivNV){this->m_orig_glGetCombinerInputParameterivNV = this->m_ptr_glGetCombinerInputParameterivNV;this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&TraceTableDecorator::m_glGetCombinerInputParameterivNV_trace;}
+if(this->m_ptr_glEndPerfMonitorAMD){this->m_orig_glEndPerfMonitorAMD = this->m_ptr_glEndPerfMonitorAMD;this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&TraceTableDecorator::m_glEndPerfMonitorAMD_trace;}
+if(this->m_ptr_glPointParameterfvARB){this->m_orig_glPointParameterfvARB = this->m_ptr_glPointParameterfvARB;this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&TraceTableDecorator::m_glPointParameterfvARB_trace;}
+if(this->m_ptr_glVertex2xOES){this->m_orig_glVertex2xOES = this->m_ptr_glVertex2xOES;this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&TraceTableDecorator::m_glVertex2xOES_trace;}
+if(this->m_ptr_glDrawElementsInstancedBaseInstance){this->m_orig_glDrawElementsInstancedBaseInstance = this->m_ptr_glDrawElementsInstancedBaseInstance;this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&TraceTableDecorator::m_glDrawElementsInstancedBaseInstance_trace;}
+if(this->m_ptr_glMultTransposeMatrixdARB){this->m_orig_glMultTransposeMatrixdARB = this->m_ptr_glMultTransposeMatrixdARB;this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&TraceTableDecorator::m_glMultTransposeMatrixdARB_trace;}
+if(this->m_ptr_glVertexAttribL4dEXT){this->m_orig_glVertexAttribL4dEXT = this->m_ptr_glVertexAttribL4dEXT;this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&TraceTableDecorator::m_glVertexAttribL4dEXT_trace;}
+if(this->m_ptr_glVertex4iv){this->m_orig_glVertex4iv = this->m_ptr_glVertex4iv;this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&TraceTableDecorator::m_glVertex4iv_trace;}
+if(this->m_ptr_glCoverStrokePathInstancedNV){this->m_orig_glCoverStrokePathInstancedNV = this->m_ptr_glCoverStrokePathInstancedNV;this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&TraceTableDecorator::m_glCoverStrokePathInstancedNV_trace;}
+if(this->m_ptr_glDeformSGIX){this->m_orig_glDeformSGIX = this->m_ptr_glDeformSGIX;this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&TraceTableDecorator::m_glDeformSGIX_trace;}
+if(this->m_ptr_glUniform2ui64NV){this->m_orig_glUniform2ui64NV = this->m_ptr_glUniform2ui64NV;this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&TraceTableDecorator::m_glUniform2ui64NV_trace;}
+if(this->m_ptr_glCopyPathNV){this->m_orig_glCopyPathNV = this->m_ptr_glCopyPathNV;this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&TraceTableDecorator::m_glCopyPathNV_trace;}
+if(this->m_ptr_glVertexAttribP4ui){this->m_orig_glVertexAttribP4ui = this->m_ptr_glVertexAttribP4ui;this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&TraceTableDecorator::m_glVertexAttribP4ui_trace;}
+if(this->m_ptr_glVertexAttribL2d){this->m_orig_glVertexAttribL2d = this->m_ptr_glVertexAttribL2d;this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&TraceTableDecorator::m_glVertexAttribL2d_trace;}
+if(this->m_ptr_glGetMultisamplefv){this->m_orig_glGetMultisamplefv = this->m_ptr_glGetMultisamplefv;this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&TraceTableDecorator::m_glGetMultisamplefv_trace;}
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT){this->m_orig_glCompressedMultiTexSubImage3DEXT = this->m_ptr_glCompressedMultiTexSubImage3DEXT;this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glCompressedMultiTexSubImage3DEXT_trace;}
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV){this->m_orig_glVDPAURegisterOutputSurfaceNV = this->m_ptr_glVDPAURegisterOutputSurfaceNV;this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&TraceTableDecorator::m_glVDPAURegisterOutputSurfaceNV_trace;}
+if(this->m_ptr_glMinSampleShading){this->m_orig_glMinSampleShading = this->m_ptr_glMinSampleShading;this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&TraceTableDecorator::m_glMinSampleShading_trace;}
+if(this->m_ptr_glProgramUniform4fEXT){this->m_orig_glProgramUniform4fEXT = this->m_ptr_glProgramUniform4fEXT;this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&TraceTableDecorator::m_glProgramUniform4fEXT_trace;}
+if(this->m_ptr_glCoverStrokePathNV){this->m_orig_glCoverStrokePathNV = this->m_ptr_glCoverStrokePathNV;this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&TraceTableDecorator::m_glCoverStrokePathNV_trace;}
+if(this->m_ptr_glTextureImage2DMultisampleNV){this->m_orig_glTextureImage2DMultisampleNV = this->m_ptr_glTextureImage2DMultisampleNV;this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&TraceTableDecorator::m_glTextureImage2DMultisampleNV_trace;}
+if(this->m_ptr_glVertex3bOES){this->m_orig_glVertex3bOES = this->m_ptr_glVertex3bOES;this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&TraceTableDecorator::m_glVertex3bOES_trace;}
+if(this->m_ptr_glImportMemoryWin32HandleEXT){this->m_orig_glImportMemoryWin32HandleEXT = this->m_ptr_glImportMemoryWin32HandleEXT;this->m_ptr_glImportMemoryWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)&TraceTableDecorator::m_glImportMemoryWin32HandleEXT_trace;}
+if(this->m_ptr_glTessellationFactorAMD){this->m_orig_glTessellationFactorAMD = this->m_ptr_glTessellationFactorAMD;this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&TraceTableDecorator::m_glTessellationFactorAMD_trace;}
+if(this->m_ptr_glDebugMessageControl){this->m_orig_glDebugMessageControl = this->m_ptr_glDebugMessageControl;this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&TraceTableDecorator::m_glDebugMessageControl_trace;}
+if(this->m_ptr_glIsObjectBufferATI){this->m_orig_glIsObjectBufferATI = this->m_ptr_glIsObjectBufferATI;this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&TraceTableDecorator::m_glIsObjectBufferATI_trace;}
+if(this->m_ptr_glPopAttrib){this->m_orig_glPopAttrib = this->m_ptr_glPopAttrib;this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&TraceTableDecorator::m_glPopAttrib_trace;}
+if(this->m_ptr_glProgramUniform4iEXT){this->m_orig_glProgramUniform4iEXT = this->m_ptr_glProgramUniform4iEXT;this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&TraceTableDecorator::m_glProgramUniform4iEXT_trace;}
+if(this->m_ptr_glVertexAttrib4ubNV){this->m_orig_glVertexAttrib4ubNV = this->m_ptr_glVertexAttrib4ubNV;this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&TraceTableDecorator::m_glVertexAttrib4ubNV_trace;}
+if(this->m_ptr_glColorMaterial){this->m_orig_glColorMaterial = this->m_ptr_glColorMaterial;this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&TraceTableDecorator::m_glColorMaterial_trace;}
+if(this->m_ptr_glVertexAttrib2svARB){this->m_orig_glVertexAttrib2svARB = this->m_ptr_glVertexAttrib2svARB;this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&TraceTableDecorator::m_glVertexAttrib2svARB_trace;}
+if(this->m_ptr_glMinSampleShadingARB){this->m_orig_glMinSampleShadingARB = this->m_ptr_glMinSampleShadingARB;this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&TraceTableDecorator::m_glMinSampleShadingARB_trace;}
+if(this->m_ptr_glColor3b){this->m_orig_glColor3b = this->m_ptr_glColor3b;this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&TraceTableDecorator::m_glColor3b_trace;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glColor3f){this->m_orig_glColor3f = this->m_ptr_glColor3f;this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&TraceTableDecorator::m_glColor3f_trace;}
+if(this->m_ptr_glVDPAUGetSurfaceivNV){this->m_orig_glVDPAUGetSurfaceivNV = this->m_ptr_glVDPAUGetSurfaceivNV;this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&TraceTableDecorator::m_glVDPAUGetSurfaceivNV_trace;}
+if(this->m_ptr_glColor3d){this->m_orig_glColor3d = this->m_ptr_glColor3d;this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&TraceTableDecorator::m_glColor3d_trace;}
+if(this->m_ptr_glGetnMapiv){this->m_orig_glGetnMapiv = this->m_ptr_glGetnMapiv;this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&TraceTableDecorator::m_glGetnMapiv_trace;}
+if(this->m_ptr_glColor3i){this->m_orig_glColor3i = this->m_ptr_glColor3i;this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&TraceTableDecorator::m_glColor3i_trace;}
+if(this->m_ptr_glGetInternalformatSampleivNV){this->m_orig_glGetInternalformatSampleivNV = this->m_ptr_glGetInternalformatSampleivNV;this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&TraceTableDecorator::m_glGetInternalformatSampleivNV_trace;}
+if(this->m_ptr_glVertexAttrib4ubv){this->m_orig_glVertexAttrib4ubv = this->m_ptr_glVertexAttrib4ubv;this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&TraceTableDecorator::m_glVertexAttrib4ubv_trace;}
+if(this->m_ptr_glColor3s){this->m_orig_glColor3s = this->m_ptr_glColor3s;this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&TraceTableDecorator::m_glColor3s_trace;}
+if(this->m_ptr_glVertexAttribs4hvNV){this->m_orig_glVertexAttribs4hvNV = this->m_ptr_glVertexAttribs4hvNV;this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&TraceTableDecorator::m_glVertexAttribs4hvNV_trace;}
+if(this->m_ptr_glVertexAttrib4NubvARB){this->m_orig_glVertexAttrib4NubvARB = this->m_ptr_glVertexAttrib4NubvARB;this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&TraceTableDecorator::m_glVertexAttrib4NubvARB_trace;}
+if(this->m_ptr_glMultiTexCoord3hvNV){this->m_orig_glMultiTexCoord3hvNV = this->m_ptr_glMultiTexCoord3hvNV;this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&TraceTableDecorator::m_glMultiTexCoord3hvNV_trace;}
+if(this->m_ptr_glMatrixPushEXT){this->m_orig_glMatrixPushEXT = this->m_ptr_glMatrixPushEXT;this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&TraceTableDecorator::m_glMatrixPushEXT_trace;}
+if(this->m_ptr_glProgramUniform2fEXT){this->m_orig_glProgramUniform2fEXT = this->m_ptr_glProgramUniform2fEXT;this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&TraceTableDecorator::m_glProgramUniform2fEXT_trace;}
+if(this->m_ptr_glGetVertexArrayIndexediv){this->m_orig_glGetVertexArrayIndexediv = this->m_ptr_glGetVertexArrayIndexediv;this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&TraceTableDecorator::m_glGetVertexArrayIndexediv_trace;}
+if(this->m_ptr_glBlitFramebuffer){this->m_orig_glBlitFramebuffer = this->m_ptr_glBlitFramebuffer;this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&TraceTableDecorator::m_glBlitFramebuffer_trace;}
+if(this->m_ptr_glMultiTexCoordP2ui){this->m_orig_glMultiTexCoordP2ui = this->m_ptr_glMultiTexCoordP2ui;this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&TraceTableDecorator::m_glMultiTexCoordP2ui_trace;}
+if(this->m_ptr_glColorPointerListIBM){this->m_orig_glColorPointerListIBM = this->m_ptr_glColorPointerListIBM;this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&TraceTableDecorator::m_glColorPointerListIBM_trace;}
+if(this->m_ptr_glVertexAttribL4d){this->m_orig_glVertexAttribL4d = this->m_ptr_glVertexAttribL4d;this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&TraceTableDecorator::m_glVertexAttribL4d_trace;}
+if(this->m_ptr_glGetFragmentMaterialfvSGIX){this->m_orig_glGetFragmentMaterialfvSGIX = this->m_ptr_glGetFragmentMaterialfvSGIX;this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&TraceTableDecorator::m_glGetFragmentMaterialfvSGIX_trace;}
+if(this->m_ptr_glVertex2iv){this->m_orig_glVertex2iv = this->m_ptr_glVertex2iv;this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&TraceTableDecorator::m_glVertex2iv_trace;}
+if(this->m_ptr_glGetTexEnvxvOES){this->m_orig_glGetTexEnvxvOES = this->m_ptr_glGetTexEnvxvOES;this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&TraceTableDecorator::m_glGetTexEnvxvOES_trace;}
+if(this->m_ptr_glUniformMatrix3dv){this->m_orig_glUniformMatrix3dv = this->m_ptr_glUniformMatrix3dv;this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&TraceTableDecorator::m_glUniformMatrix3dv_trace;}
+if(this->m_ptr_glGetVertexAttribLdvEXT){this->m_orig_glGetVertexAttribLdvEXT = this->m_ptr_glGetVertexAttribLdvEXT;this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&TraceTableDecorator::m_glGetVertexAttribLdvEXT_trace;}
+if(this->m_ptr_glTexCoordP3uiv){this->m_orig_glTexCoordP3uiv = this->m_ptr_glTexCoordP3uiv;this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&TraceTableDecorator::m_glTexCoordP3uiv_trace;}
+if(this->m_ptr_glDeformationMap3dSGIX){this->m_orig_glDeformationMap3dSGIX = this->m_ptr_glDeformationMap3dSGIX;this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&TraceTableDecorator::m_glDeformationMap3dSGIX_trace;}
+if(this->m_ptr_glResumeTransformFeedback){this->m_orig_glResumeTransformFeedback = this->m_ptr_glResumeTransformFeedback;this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glResumeTransformFeedback_trace;}
+if(this->m_ptr_glInsertEventMarkerEXT){this->m_orig_glInsertEventMarkerEXT = this->m_ptr_glInsertEventMarkerEXT;this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&TraceTableDecorator::m_glInsertEventMarkerEXT_trace;}
+if(this->m_ptr_glTessellationModeAMD){this->m_orig_glTessellationModeAMD = this->m_ptr_glTessellationModeAMD;this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&TraceTableDecorator::m_glTessellationModeAMD_trace;}
+if(this->m_ptr_glDrawCommandsAddressNV){this->m_orig_glDrawCommandsAddressNV = this->m_ptr_glDrawCommandsAddressNV;this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&TraceTableDecorator::m_glDrawCommandsAddressNV_trace;}
+if(this->m_ptr_glFogi){this->m_orig_glFogi = this->m_ptr_glFogi;this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&TraceTableDecorator::m_glFogi_trace;}
+if(this->m_ptr_glGetTexParameterxvOES){this->m_orig_glGetTexParameterxvOES = this->m_ptr_glGetTexParameterxvOES;this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&TraceTableDecorator::m_glGetTexParameterxvOES_trace;}
+if(this->m_ptr_glVertexPointer){this->m_orig_glVertexPointer = this->m_ptr_glVertexPointer;this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&TraceTableDecorator::m_glVertexPointer_trace;}
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD){this->m_orig_glGetPerfMonitorCounterDataAMD = this->m_ptr_glGetPerfMonitorCounterDataAMD;this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&TraceTableDecorator::m_glGetPerfMonitorCounterDataAMD_trace;}
+if(this->m_ptr_glFogf){this->m_orig_glFogf = this->m_ptr_glFogf;this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&TraceTableDecorator::m_glFogf_trace;}
+if(this->m_ptr_glMultiTexCoord1d){this->m_orig_glMultiTexCoord1d = this->m_ptr_glMultiTexCoord1d;this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&TraceTableDecorator::m_glMultiTexCoord1d_trace;}
+if(this->m_ptr_glMultiTexCoord1f){this->m_orig_glMultiTexCoord1f = this->m_ptr_glMultiTexCoord1f;this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&TraceTableDecorator::m_glMultiTexCoord1f_trace;}
+if(this->m_ptr_glGetMultiTexParameterivEXT){this->m_orig_glGetMultiTexParameterivEXT = this->m_ptr_glGetMultiTexParameterivEXT;this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetMultiTexParameterivEXT_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT){this->m_orig_glProgramUniformMatrix3x4fvEXT = this->m_ptr_glProgramUniformMatrix3x4fvEXT;this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x4fvEXT_trace;}
+if(this->m_ptr_glVertexAttribI2i){this->m_orig_glVertexAttribI2i = this->m_ptr_glVertexAttribI2i;this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&TraceTableDecorator::m_glVertexAttribI2i_trace;}
+if(this->m_ptr_glMultiTexCoord1i){this->m_orig_glMultiTexCoord1i = this->m_ptr_glMultiTexCoord1i;this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&TraceTableDecorator::m_glMultiTexCoord1i_trace;}
+if(this->m_ptr_glDeleteSemaphoresEXT){this->m_orig_glDeleteSemaphoresEXT = this->m_ptr_glDeleteSemaphoresEXT;this->m_ptr_glDeleteSemaphoresEXT = (FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC)&TraceTableDecorator::m_glDeleteSemaphoresEXT_trace;}
+if(this->m_ptr_glLoadProgramNV){this->m_orig_glLoadProgramNV = this->m_ptr_glLoadProgramNV;this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&TraceTableDecorator::m_glLoadProgramNV_trace;}
+if(this->m_ptr_glWriteMaskEXT){this->m_orig_glWriteMaskEXT = this->m_ptr_glWriteMaskEXT;this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&TraceTableDecorator::m_glWriteMaskEXT_trace;}
+if(this->m_ptr_glGetGraphicsResetStatus){this->m_orig_glGetGraphicsResetStatus = this->m_ptr_glGetGraphicsResetStatus;this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&TraceTableDecorator::m_glGetGraphicsResetStatus_trace;}
+if(this->m_ptr_glVertexAttrib1fv){this->m_orig_glVertexAttrib1fv = this->m_ptr_glVertexAttrib1fv;this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&TraceTableDecorator::m_glVertexAttrib1fv_trace;}
+if(this->m_ptr_glMultiTexCoord1s){this->m_orig_glMultiTexCoord1s = this->m_ptr_glMultiTexCoord1s;this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&TraceTableDecorator::m_glMultiTexCoord1s_trace;}
+if(this->m_ptr_glImageTransformParameterfvHP){this->m_orig_glImageTransformParameterfvHP = this->m_ptr_glImageTransformParameterfvHP;this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&TraceTableDecorator::m_glImageTransformParameterfvHP_trace;}
+if(this->m_ptr_glFramebufferTexture2D){this->m_orig_glFramebufferTexture2D = this->m_ptr_glFramebufferTexture2D;this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&TraceTableDecorator::m_glFramebufferTexture2D_trace;}
+if(this->m_ptr_glGetFragmentLightfvSGIX){this->m_orig_glGetFragmentLightfvSGIX = this->m_ptr_glGetFragmentLightfvSGIX;this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&TraceTableDecorator::m_glGetFragmentLightfvSGIX_trace;}
+if(this->m_ptr_glListParameterfSGIX){this->m_orig_glListParameterfSGIX = this->m_ptr_glListParameterfSGIX;this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&TraceTableDecorator::m_glListParameterfSGIX_trace;}
+if(this->m_ptr_glTexCoord3sv){this->m_orig_glTexCoord3sv = this->m_ptr_glTexCoord3sv;this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&TraceTableDecorator::m_glTexCoord3sv_trace;}
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT){this->m_orig_glNamedFramebufferRenderbufferEXT = this->m_ptr_glNamedFramebufferRenderbufferEXT;this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&TraceTableDecorator::m_glNamedFramebufferRenderbufferEXT_trace;}
+if(this->m_ptr_glFragmentLightModelfSGIX){this->m_orig_glFragmentLightModelfSGIX = this->m_ptr_glFragmentLightModelfSGIX;this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&TraceTableDecorator::m_glFragmentLightModelfSGIX_trace;}
+if(this->m_ptr_glIndexPointerEXT){this->m_orig_glIndexPointerEXT = this->m_ptr_glIndexPointerEXT;this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&TraceTableDecorator::m_glIndexPointerEXT_trace;}
+if(this->m_ptr_glBlendEquationSeparateATI){this->m_orig_glBlendEquationSeparateATI = this->m_ptr_glBlendEquationSeparateATI;this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&TraceTableDecorator::m_glBlendEquationSeparateATI_trace;}
+if(this->m_ptr_glVertexArrayAttribIFormat){this->m_orig_glVertexArrayAttribIFormat = this->m_ptr_glVertexArrayAttribIFormat;this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&TraceTableDecorator::m_glVertexArrayAttribIFormat_trace;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glReplacementCodeubvSUN){this->m_orig_glReplacementCodeubvSUN = this->m_ptr_glReplacementCodeubvSUN;this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&TraceTableDecorator::m_glReplacementCodeubvSUN_trace;}
+if(this->m_ptr_glGenFramebuffers){this->m_orig_glGenFramebuffers = this->m_ptr_glGenFramebuffers;this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&TraceTableDecorator::m_glGenFramebuffers_trace;}
+if(this->m_ptr_glPixelMapx){this->m_orig_glPixelMapx = this->m_ptr_glPixelMapx;this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&TraceTableDecorator::m_glPixelMapx_trace;}
+if(this->m_ptr_glTexSubImage3DEXT){this->m_orig_glTexSubImage3DEXT = this->m_ptr_glTexSubImage3DEXT;this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glTexSubImage3DEXT_trace;}
+if(this->m_ptr_glGetAttachedShaders){this->m_orig_glGetAttachedShaders = this->m_ptr_glGetAttachedShaders;this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&TraceTableDecorator::m_glGetAttachedShaders_trace;}
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS){this->m_orig_glGetPixelTexGenParameterfvSGIS = this->m_ptr_glGetPixelTexGenParameterfvSGIS;this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&TraceTableDecorator::m_glGetPixelTexGenParameterfvSGIS_trace;}
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glGetDebugMessageLogAMD){this->m_orig_glGetDebugMessageLogAMD = this->m_ptr_glGetDebugMessageLogAMD;this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&TraceTableDecorator::m_glGetDebugMessageLogAMD_trace;}
+if(this->m_ptr_glVertexStream4sATI){this->m_orig_glVertexStream4sATI = this->m_ptr_glVertexStream4sATI;this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&TraceTableDecorator::m_glVertexStream4sATI_trace;}
+if(this->m_ptr_glVertexAttribs4dvNV){this->m_orig_glVertexAttribs4dvNV = this->m_ptr_glVertexAttribs4dvNV;this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&TraceTableDecorator::m_glVertexAttribs4dvNV_trace;}
+if(this->m_ptr_glGetnMapdvARB){this->m_orig_glGetnMapdvARB = this->m_ptr_glGetnMapdvARB;this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&TraceTableDecorator::m_glGetnMapdvARB_trace;}
+if(this->m_ptr_glOrthofOES){this->m_orig_glOrthofOES = this->m_ptr_glOrthofOES;this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&TraceTableDecorator::m_glOrthofOES_trace;}
+if(this->m_ptr_glViewportArrayv){this->m_orig_glViewportArrayv = this->m_ptr_glViewportArrayv;this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&TraceTableDecorator::m_glViewportArrayv_trace;}
+if(this->m_ptr_glDrawElementArrayATI){this->m_orig_glDrawElementArrayATI = this->m_ptr_glDrawElementArrayATI;this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&TraceTableDecorator::m_glDrawElementArrayATI_trace;}
+if(this->m_ptr_glBufferStorageMemEXT){this->m_orig_glBufferStorageMemEXT = this->m_ptr_glBufferStorageMemEXT;this->m_ptr_glBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC)&TraceTableDecorator::m_glBufferStorageMemEXT_trace;}
+if(this->m_ptr_glGetPathColorGenfvNV){this->m_orig_glGetPathColorGenfvNV = this->m_ptr_glGetPathColorGenfvNV;this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&TraceTableDecorator::m_glGetPathColorGenfvNV_trace;}
+if(this->m_ptr_glWindowPos3iMESA){this->m_orig_glWindowPos3iMESA = this->m_ptr_glWindowPos3iMESA;this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&TraceTableDecorator::m_glWindowPos3iMESA_trace;}
+if(this->m_ptr_glMultiTexCoord2s){this->m_orig_glMultiTexCoord2s = this->m_ptr_glMultiTexCoord2s;this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&TraceTableDecorator::m_glMultiTexCoord2s_trace;}
+if(this->m_ptr_glVertex3dv){this->m_orig_glVertex3dv = this->m_ptr_glVertex3dv;this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&TraceTableDecorator::m_glVertex3dv_trace;}
+if(this->m_ptr_glVertexAttribI3uivEXT){this->m_orig_glVertexAttribI3uivEXT = this->m_ptr_glVertexAttribI3uivEXT;this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&TraceTableDecorator::m_glVertexAttribI3uivEXT_trace;}
+if(this->m_ptr_glUniform3ui64ARB){this->m_orig_glUniform3ui64ARB = this->m_ptr_glUniform3ui64ARB;this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&TraceTableDecorator::m_glUniform3ui64ARB_trace;}
+if(this->m_ptr_glVertexAttrib2fvNV){this->m_orig_glVertexAttrib2fvNV = this->m_ptr_glVertexAttrib2fvNV;this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&TraceTableDecorator::m_glVertexAttrib2fvNV_trace;}
+if(this->m_ptr_glGetNamedBufferSubDataEXT){this->m_orig_glGetNamedBufferSubDataEXT = this->m_ptr_glGetNamedBufferSubDataEXT;this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&TraceTableDecorator::m_glGetNamedBufferSubDataEXT_trace;}
+if(this->m_ptr_glConvolutionFilter2D){this->m_orig_glConvolutionFilter2D = this->m_ptr_glConvolutionFilter2D;this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&TraceTableDecorator::m_glConvolutionFilter2D_trace;}
+if(this->m_ptr_glMemoryBarrierByRegion){this->m_orig_glMemoryBarrierByRegion = this->m_ptr_glMemoryBarrierByRegion;this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&TraceTableDecorator::m_glMemoryBarrierByRegion_trace;}
+if(this->m_ptr_glVertexArrayBindingDivisor){this->m_orig_glVertexArrayBindingDivisor = this->m_ptr_glVertexArrayBindingDivisor;this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&TraceTableDecorator::m_glVertexArrayBindingDivisor_trace;}
+if(this->m_ptr_glMatrixRotatedEXT){this->m_orig_glMatrixRotatedEXT = this->m_ptr_glMatrixRotatedEXT;this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&TraceTableDecorator::m_glMatrixRotatedEXT_trace;}
+if(this->m_ptr_glTexCoord2sv){this->m_orig_glTexCoord2sv = this->m_ptr_glTexCoord2sv;this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&TraceTableDecorator::m_glTexCoord2sv_trace;}
+if(this->m_ptr_glIsProgramNV){this->m_orig_glIsProgramNV = this->m_ptr_glIsProgramNV;this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&TraceTableDecorator::m_glIsProgramNV_trace;}
+if(this->m_ptr_glUniform2dv){this->m_orig_glUniform2dv = this->m_ptr_glUniform2dv;this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&TraceTableDecorator::m_glUniform2dv_trace;}
+if(this->m_ptr_glGetPixelMapuiv){this->m_orig_glGetPixelMapuiv = this->m_ptr_glGetPixelMapuiv;this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&TraceTableDecorator::m_glGetPixelMapuiv_trace;}
+if(this->m_ptr_glDepthBoundsEXT){this->m_orig_glDepthBoundsEXT = this->m_ptr_glDepthBoundsEXT;this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&TraceTableDecorator::m_glDepthBoundsEXT_trace;}
+if(this->m_ptr_glVertexAttrib4hvNV){this->m_orig_glVertexAttrib4hvNV = this->m_ptr_glVertexAttrib4hvNV;this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&TraceTableDecorator::m_glVertexAttrib4hvNV_trace;}
+if(this->m_ptr_glMultiTexParameteriEXT){this->m_orig_glMultiTexParameteriEXT = this->m_ptr_glMultiTexParameteriEXT;this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&TraceTableDecorator::m_glMultiTexParameteriEXT_trace;}
+if(this->m_ptr_glGetPointerv){this->m_orig_glGetPointerv = this->m_ptr_glGetPointerv;this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&TraceTableDecorator::m_glGetPointerv_trace;}
+if(this->m_ptr_glPathCommandsNV){this->m_orig_glPathCommandsNV = this->m_ptr_glPathCommandsNV;this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&TraceTableDecorator::m_glPathCommandsNV_trace;}
+if(this->m_ptr_glGetListParameterfvSGIX){this->m_orig_glGetListParameterfvSGIX = this->m_ptr_glGetListParameterfvSGIX;this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&TraceTableDecorator::m_glGetListParameterfvSGIX_trace;}
+if(this->m_ptr_glGetUniformuiv){this->m_orig_glGetUniformuiv = this->m_ptr_glGetUniformuiv;this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&TraceTableDecorator::m_glGetUniformuiv_trace;}
+if(this->m_ptr_glDebugMessageInsertAMD){this->m_orig_glDebugMessageInsertAMD = this->m_ptr_glDebugMessageInsertAMD;this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&TraceTableDecorator::m_glDebugMessageInsertAMD_trace;}
+if(this->m_ptr_glFrustum){this->m_orig_glFrustum = this->m_ptr_glFrustum;this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&TraceTableDecorator::m_glFrustum_trace;}
+if(this->m_ptr_glVertexAttribL1ui64vNV){this->m_orig_glVertexAttribL1ui64vNV = this->m_ptr_glVertexAttribL1ui64vNV;this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&TraceTableDecorator::m_glVertexAttribL1ui64vNV_trace;}
+if(this->m_ptr_glClearColorxOES){this->m_orig_glClearColorxOES = this->m_ptr_glClearColorxOES;this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&TraceTableDecorator::m_glClearColorxOES_trace;}
+if(this->m_ptr_glProgramUniformMatrix3fv){this->m_orig_glProgramUniformMatrix3fv = this->m_ptr_glProgramUniformMatrix3fv;this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix3fv_trace;}
+if(this->m_ptr_glSampleMaskIndexedNV){this->m_orig_glSampleMaskIndexedNV = this->m_ptr_glSampleMaskIndexedNV;this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&TraceTableDecorator::m_glSampleMaskIndexedNV_trace;}
+if(this->m_ptr_glCompileShaderIncludeARB){this->m_orig_glCompileShaderIncludeARB = this->m_ptr_glCompileShaderIncludeARB;this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&TraceTableDecorator::m_glCompileShaderIncludeARB_trace;}
+if(this->m_ptr_glGetArrayObjectfvATI){this->m_orig_glGetArrayObjectfvATI = this->m_ptr_glGetArrayObjectfvATI;this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&TraceTableDecorator::m_glGetArrayObjectfvATI_trace;}
+if(this->m_ptr_glVertexStream4svATI){this->m_orig_glVertexStream4svATI = this->m_ptr_glVertexStream4svATI;this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&TraceTableDecorator::m_glVertexStream4svATI_trace;}
+if(this->m_ptr_glMultiTexCoord4iARB){this->m_orig_glMultiTexCoord4iARB = this->m_ptr_glMultiTexCoord4iARB;this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&TraceTableDecorator::m_glMultiTexCoord4iARB_trace;}
+if(this->m_ptr_glVariantfvEXT){this->m_orig_glVariantfvEXT = this->m_ptr_glVariantfvEXT;this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&TraceTableDecorator::m_glVariantfvEXT_trace;}
+if(this->m_ptr_glMatrixLoadfEXT){this->m_orig_glMatrixLoadfEXT = this->m_ptr_glMatrixLoadfEXT;this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&TraceTableDecorator::m_glMatrixLoadfEXT_trace;}
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX){this->m_orig_glLoadIdentityDeformationMapSGIX = this->m_ptr_glLoadIdentityDeformationMapSGIX;this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&TraceTableDecorator::m_glLoadIdentityDeformationMapSGIX_trace;}
+if(this->m_ptr_glGetRenderbufferParameteriv){this->m_orig_glGetRenderbufferParameteriv = this->m_ptr_glGetRenderbufferParameteriv;this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&TraceTableDecorator::m_glGetRenderbufferParameteriv_trace;}
+if(this->m_ptr_glProgramUniform3fEXT){this->m_orig_glProgramUniform3fEXT = this->m_ptr_glProgramUniform3fEXT;this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&TraceTableDecorator::m_glProgramUniform3fEXT_trace;}
+if(this->m_ptr_glNamedRenderbufferStorage){this->m_orig_glNamedRenderbufferStorage = this->m_ptr_glNamedRenderbufferStorage;this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&TraceTableDecorator::m_glNamedRenderbufferStorage_trace;}
+if(this->m_ptr_glBindFragDataLocation){this->m_orig_glBindFragDataLocation = this->m_ptr_glBindFragDataLocation;this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&TraceTableDecorator::m_glBindFragDataLocation_trace;}
+if(this->m_ptr_glPolygonOffsetClamp){this->m_orig_glPolygonOffsetClamp = this->m_ptr_glPolygonOffsetClamp;this->m_ptr_glPolygonOffsetClamp = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC)&TraceTableDecorator::m_glPolygonOffsetClamp_trace;}
+if(this->m_ptr_glFogCoordPointerListIBM){this->m_orig_glFogCoordPointerListIBM = this->m_ptr_glFogCoordPointerListIBM;this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&TraceTableDecorator::m_glFogCoordPointerListIBM_trace;}
+if(this->m_ptr_glFenceSync){this->m_orig_glFenceSync = this->m_ptr_glFenceSync;this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&TraceTableDecorator::m_glFenceSync_trace;}
+if(this->m_ptr_glGetVertexAttribIivEXT){this->m_orig_glGetVertexAttribIivEXT = this->m_ptr_glGetVertexAttribIivEXT;this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&TraceTableDecorator::m_glGetVertexAttribIivEXT_trace;}
+if(this->m_ptr_glFramebufferDrawBuffersEXT){this->m_orig_glFramebufferDrawBuffersEXT = this->m_ptr_glFramebufferDrawBuffersEXT;this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&TraceTableDecorator::m_glFramebufferDrawBuffersEXT_trace;}
+if(this->m_ptr_glVertexAttribs4fvNV){this->m_orig_glVertexAttribs4fvNV = this->m_ptr_glVertexAttribs4fvNV;this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&TraceTableDecorator::m_glVertexAttribs4fvNV_trace;}
+if(this->m_ptr_glPauseTransformFeedbackNV){this->m_orig_glPauseTransformFeedbackNV = this->m_ptr_glPauseTransformFeedbackNV;this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glPauseTransformFeedbackNV_trace;}
+if(this->m_ptr_glGetQueryObjecti64vEXT){this->m_orig_glGetQueryObjecti64vEXT = this->m_ptr_glGetQueryObjecti64vEXT;this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&TraceTableDecorator::m_glGetQueryObjecti64vEXT_trace;}
+if(this->m_ptr_glVDPAUSurfaceAccessNV){this->m_orig_glVDPAUSurfaceAccessNV = this->m_ptr_glVDPAUSurfaceAccessNV;this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&TraceTableDecorator::m_glVDPAUSurfaceAccessNV_trace;}
+if(this->m_ptr_glValidateProgramPipeline){this->m_orig_glValidateProgramPipeline = this->m_ptr_glValidateProgramPipeline;this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&TraceTableDecorator::m_glValidateProgramPipeline_trace;}
+if(this->m_ptr_glTexPageCommitmentARB){this->m_orig_glTexPageCommitmentARB = this->m_ptr_glTexPageCommitmentARB;this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&TraceTableDecorator::m_glTexPageCommitmentARB_trace;}
+if(this->m_ptr_glWindowPos3dvARB){this->m_orig_glWindowPos3dvARB = this->m_ptr_glWindowPos3dvARB;this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&TraceTableDecorator::m_glWindowPos3dvARB_trace;}
+if(this->m_ptr_glStencilStrokePathInstancedNV){this->m_orig_glStencilStrokePathInstancedNV = this->m_ptr_glStencilStrokePathInstancedNV;this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&TraceTableDecorator::m_glStencilStrokePathInstancedNV_trace;}
+if(this->m_ptr_glFogfv){this->m_orig_glFogfv = this->m_ptr_glFogfv;this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&TraceTableDecorator::m_glFogfv_trace;}
+if(this->m_ptr_glGenQueriesARB){this->m_orig_glGenQueriesARB = this->m_ptr_glGenQueriesARB;this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&TraceTableDecorator::m_glGenQueriesARB_trace;}
+if(this->m_ptr_glProgramUniform2i64NV){this->m_orig_glProgramUniform2i64NV = this->m_ptr_glProgramUniform2i64NV;this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&TraceTableDecorator::m_glProgramUniform2i64NV_trace;}
+if(this->m_ptr_glVertexP4ui){this->m_orig_glVertexP4ui = this->m_ptr_glVertexP4ui;this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&TraceTableDecorator::m_glVertexP4ui_trace;}
+if(this->m_ptr_glVertexStream1ivATI){this->m_orig_glVertexStream1ivATI = this->m_ptr_glVertexStream1ivATI;this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&TraceTableDecorator::m_glVertexStream1ivATI_trace;}
+if(this->m_ptr_glProgramEnvParameterI4iNV){this->m_orig_glProgramEnvParameterI4iNV = this->m_ptr_glProgramEnvParameterI4iNV;this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&TraceTableDecorator::m_glProgramEnvParameterI4iNV_trace;}
+if(this->m_ptr_glGenVertexArraysAPPLE){this->m_orig_glGenVertexArraysAPPLE = this->m_ptr_glGenVertexArraysAPPLE;this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&TraceTableDecorator::m_glGenVertexArraysAPPLE_trace;}
+if(this->m_ptr_glDrawTransformFeedbackInstanced){this->m_orig_glDrawTransformFeedbackInstanced = this->m_ptr_glDrawTransformFeedbackInstanced;this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&TraceTableDecorator::m_glDrawTransformFeedbackInstanced_trace;}
+if(this->m_ptr_glStencilThenCoverStrokePathNV){this->m_orig_glStencilThenCoverStrokePathNV = this->m_ptr_glStencilThenCoverStrokePathNV;this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&TraceTableDecorator::m_glStencilThenCoverStrokePathNV_trace;}
+if(this->m_ptr_glDeleteVertexArraysAPPLE){this->m_orig_glDeleteVertexArraysAPPLE = this->m_ptr_glDeleteVertexArraysAPPLE;this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&TraceTableDecorator::m_glDeleteVertexArraysAPPLE_trace;}
+if(this->m_ptr_glGetNamedBufferParameterui64vNV){this->m_orig_glGetNamedBufferParameterui64vNV = this->m_ptr_glGetNamedBufferParameterui64vNV;this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&TraceTableDecorator::m_glGetNamedBufferParameterui64vNV_trace;}
+if(this->m_ptr_glQueryMatrixxOES){this->m_orig_glQueryMatrixxOES = this->m_ptr_glQueryMatrixxOES;this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&TraceTableDecorator::m_glQueryMatrixxOES_trace;}
+if(this->m_ptr_glSecondaryColor3usv){this->m_orig_glSecondaryColor3usv = this->m_ptr_glSecondaryColor3usv;this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&TraceTableDecorator::m_glSecondaryColor3usv_trace;}
+if(this->m_ptr_glTranslatexOES){this->m_orig_glTranslatexOES = this->m_ptr_glTranslatexOES;this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&TraceTableDecorator::m_glTranslatexOES_trace;}
+if(this->m_ptr_glDrawTransformFeedback){this->m_orig_glDrawTransformFeedback = this->m_ptr_glDrawTransformFeedback;this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glDrawTransformFeedback_trace;}
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN){this->m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN;this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV){this->m_orig_glVDPAURegisterVideoSurfaceNV = this->m_ptr_glVDPAURegisterVideoSurfaceNV;this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&TraceTableDecorator::m_glVDPAURegisterVideoSurfaceNV_trace;}
+if(this->m_ptr_glGetTexParameterIuiv){this->m_orig_glGetTexParameterIuiv = this->m_ptr_glGetTexParameterIuiv;this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&TraceTableDecorator::m_glGetTexParameterIuiv_trace;}
+if(this->m_ptr_glBindBufferBaseNV){this->m_orig_glBindBufferBaseNV = this->m_ptr_glBindBufferBaseNV;this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&TraceTableDecorator::m_glBindBufferBaseNV_trace;}
+if(this->m_ptr_glIndexPointer){this->m_orig_glIndexPointer = this->m_ptr_glIndexPointer;this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&TraceTableDecorator::m_glIndexPointer_trace;}
+if(this->m_ptr_glGenQueryResourceTagNV){this->m_orig_glGenQueryResourceTagNV = this->m_ptr_glGenQueryResourceTagNV;this->m_ptr_glGenQueryResourceTagNV = (FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC)&TraceTableDecorator::m_glGenQueryResourceTagNV_trace;}
+if(this->m_ptr_glVertexAttrib4Nbv){this->m_orig_glVertexAttrib4Nbv = this->m_ptr_glVertexAttrib4Nbv;this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&TraceTableDecorator::m_glVertexAttrib4Nbv_trace;}
+if(this->m_ptr_glListParameteriSGIX){this->m_orig_glListParameteriSGIX = this->m_ptr_glListParameteriSGIX;this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&TraceTableDecorator::m_glListParameteriSGIX_trace;}
+if(this->m_ptr_glBlendColorxOES){this->m_orig_glBlendColorxOES = this->m_ptr_glBlendColorxOES;this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&TraceTableDecorator::m_glBlendColorxOES_trace;}
+if(this->m_ptr_glUniformui64vNV){this->m_orig_glUniformui64vNV = this->m_ptr_glUniformui64vNV;this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&TraceTableDecorator::m_glUniformui64vNV_trace;}
+if(this->m_ptr_glIsSync){this->m_orig_glIsSync = this->m_ptr_glIsSync;this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&TraceTableDecorator::m_glIsSync_trace;}
+if(this->m_ptr_glGetTextureParameterivEXT){this->m_orig_glGetTextureParameterivEXT = this->m_ptr_glGetTextureParameterivEXT;this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetTextureParameterivEXT_trace;}
+if(this->m_ptr_glFogCoordhvNV){this->m_orig_glFogCoordhvNV = this->m_ptr_glFogCoordhvNV;this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&TraceTableDecorator::m_glFogCoordhvNV_trace;}
+if(this->m_ptr_glFramebufferTextureLayerEXT){this->m_orig_glFramebufferTextureLayerEXT = this->m_ptr_glFramebufferTextureLayerEXT;this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&TraceTableDecorator::m_glFramebufferTextureLayerEXT_trace;}
+if(this->m_ptr_glGetObjectPtrLabel){this->m_orig_glGetObjectPtrLabel = this->m_ptr_glGetObjectPtrLabel;this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&TraceTableDecorator::m_glGetObjectPtrLabel_trace;}
+if(this->m_ptr_glTextureParameteri){this->m_orig_glTextureParameteri = this->m_ptr_glTextureParameteri;this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&TraceTableDecorator::m_glTextureParameteri_trace;}
+if(this->m_ptr_glMultiTexCoord1fARB){this->m_orig_glMultiTexCoord1fARB = this->m_ptr_glMultiTexCoord1fARB;this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&TraceTableDecorator::m_glMultiTexCoord1fARB_trace;}
+if(this->m_ptr_glUniformMatrix2x3dv){this->m_orig_glUniformMatrix2x3dv = this->m_ptr_glUniformMatrix2x3dv;this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&TraceTableDecorator::m_glUniformMatrix2x3dv_trace;}
+if(this->m_ptr_glFramebufferDrawBufferEXT){this->m_orig_glFramebufferDrawBufferEXT = this->m_ptr_glFramebufferDrawBufferEXT;this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&TraceTableDecorator::m_glFramebufferDrawBufferEXT_trace;}
+if(this->m_ptr_glCopyColorSubTable){this->m_orig_glCopyColorSubTable = this->m_ptr_glCopyColorSubTable;this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&TraceTableDecorator::m_glCopyColorSubTable_trace;}
+if(this->m_ptr_glGetNamedFramebufferParameterfvAMD){this->m_orig_glGetNamedFramebufferParameterfvAMD = this->m_ptr_glGetNamedFramebufferParameterfvAMD;this->m_ptr_glGetNamedFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)&TraceTableDecorator::m_glGetNamedFramebufferParameterfvAMD_trace;}
+if(this->m_ptr_glVertexAttribL3d){this->m_orig_glVertexAttribL3d = this->m_ptr_glVertexAttribL3d;this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&TraceTableDecorator::m_glVertexAttribL3d_trace;}
+if(this->m_ptr_glFragmentMaterialfvSGIX){this->m_orig_glFragmentMaterialfvSGIX = this->m_ptr_glFragmentMaterialfvSGIX;this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&TraceTableDecorator::m_glFragmentMaterialfvSGIX_trace;}
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV){this->m_orig_glMatrixLoadTranspose3x3fNV = this->m_ptr_glMatrixLoadTranspose3x3fNV;this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&TraceTableDecorator::m_glMatrixLoadTranspose3x3fNV_trace;}
+if(this->m_ptr_glDeleteNamesAMD){this->m_orig_glDeleteNamesAMD = this->m_ptr_glDeleteNamesAMD;this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&TraceTableDecorator::m_glDeleteNamesAMD_trace;}
+if(this->m_ptr_glDrawRangeElementsEXT){this->m_orig_glDrawRangeElementsEXT = this->m_ptr_glDrawRangeElementsEXT;this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&TraceTableDecorator::m_glDrawRangeElementsEXT_trace;}
+if(this->m_ptr_glOrtho){this->m_orig_glOrtho = this->m_ptr_glOrtho;this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&TraceTableDecorator::m_glOrtho_trace;}
+if(this->m_ptr_glProgramUniform1dvEXT){this->m_orig_glProgramUniform1dvEXT = this->m_ptr_glProgramUniform1dvEXT;this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&TraceTableDecorator::m_glProgramUniform1dvEXT_trace;}
+if(this->m_ptr_glColor4xOES){this->m_orig_glColor4xOES = this->m_ptr_glColor4xOES;this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&TraceTableDecorator::m_glColor4xOES_trace;}
+if(this->m_ptr_glTexImage4DSGIS){this->m_orig_glTexImage4DSGIS = this->m_ptr_glTexImage4DSGIS;this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&TraceTableDecorator::m_glTexImage4DSGIS_trace;}
+if(this->m_ptr_glProgramUniform1ui){this->m_orig_glProgramUniform1ui = this->m_ptr_glProgramUniform1ui;this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&TraceTableDecorator::m_glProgramUniform1ui_trace;}
+if(this->m_ptr_glDeleteBuffersARB){this->m_orig_glDeleteBuffersARB = this->m_ptr_glDeleteBuffersARB;this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&TraceTableDecorator::m_glDeleteBuffersARB_trace;}
+if(this->m_ptr_glUnmapBufferARB){this->m_orig_glUnmapBufferARB = this->m_ptr_glUnmapBufferARB;this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&TraceTableDecorator::m_glUnmapBufferARB_trace;}
+if(this->m_ptr_glCopyTexImage2D){this->m_orig_glCopyTexImage2D = this->m_ptr_glCopyTexImage2D;this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&TraceTableDecorator::m_glCopyTexImage2D_trace;}
+if(this->m_ptr_glMaterialxOES){this->m_orig_glMaterialxOES = this->m_ptr_glMaterialxOES;this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&TraceTableDecorator::m_glMaterialxOES_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT){this->m_orig_glProgramUniformMatrix2x4fvEXT = this->m_ptr_glProgramUniformMatrix2x4fvEXT;this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x4fvEXT_trace;}
+if(this->m_ptr_glTestObjectAPPLE){this->m_orig_glTestObjectAPPLE = this->m_ptr_glTestObjectAPPLE;this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&TraceTableDecorator::m_glTestObjectAPPLE_trace;}
+if(this->m_ptr_glRenderbufferStorageEXT){this->m_orig_glRenderbufferStorageEXT = this->m_ptr_glRenderbufferStorageEXT;this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&TraceTableDecorator::m_glRenderbufferStorageEXT_trace;}
+if(this->m_ptr_glVertexAttribL1ui64ARB){this->m_orig_glVertexAttribL1ui64ARB = this->m_ptr_glVertexAttribL1ui64ARB;this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&TraceTableDecorator::m_glVertexAttribL1ui64ARB_trace;}
+if(this->m_ptr_glEndFragmentShaderATI){this->m_orig_glEndFragmentShaderATI = this->m_ptr_glEndFragmentShaderATI;this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&TraceTableDecorator::m_glEndFragmentShaderATI_trace;}
+if(this->m_ptr_glPathParameterivNV){this->m_orig_glPathParameterivNV = this->m_ptr_glPathParameterivNV;this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&TraceTableDecorator::m_glPathParameterivNV_trace;}
+if(this->m_ptr_glUniform4uiv){this->m_orig_glUniform4uiv = this->m_ptr_glUniform4uiv;this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&TraceTableDecorator::m_glUniform4uiv_trace;}
+if(this->m_ptr_glFrameZoomSGIX){this->m_orig_glFrameZoomSGIX = this->m_ptr_glFrameZoomSGIX;this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&TraceTableDecorator::m_glFrameZoomSGIX_trace;}
+if(this->m_ptr_glSecondaryColor3fEXT){this->m_orig_glSecondaryColor3fEXT = this->m_ptr_glSecondaryColor3fEXT;this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&TraceTableDecorator::m_glSecondaryColor3fEXT_trace;}
+if(this->m_ptr_glLGPUInterlockNVX){this->m_orig_glLGPUInterlockNVX = this->m_ptr_glLGPUInterlockNVX;this->m_ptr_glLGPUInterlockNVX = (FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC)&TraceTableDecorator::m_glLGPUInterlockNVX_trace;}
+if(this->m_ptr_glVertexAttribL1dv){this->m_orig_glVertexAttribL1dv = this->m_ptr_glVertexAttribL1dv;this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&TraceTableDecorator::m_glVertexAttribL1dv_trace;}
+if(this->m_ptr_glNormalStream3svATI){this->m_orig_glNormalStream3svATI = this->m_ptr_glNormalStream3svATI;this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&TraceTableDecorator::m_glNormalStream3svATI_trace;}
+if(this->m_ptr_glPathStencilFuncNV){this->m_orig_glPathStencilFuncNV = this->m_ptr_glPathStencilFuncNV;this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&TraceTableDecorator::m_glPathStencilFuncNV_trace;}
+if(this->m_ptr_glSetInvariantEXT){this->m_orig_glSetInvariantEXT = this->m_ptr_glSetInvariantEXT;this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&TraceTableDecorator::m_glSetInvariantEXT_trace;}
+if(this->m_ptr_glGetTexBumpParameterivATI){this->m_orig_glGetTexBumpParameterivATI = this->m_ptr_glGetTexBumpParameterivATI;this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&TraceTableDecorator::m_glGetTexBumpParameterivATI_trace;}
+if(this->m_ptr_glBlendEquationSeparateEXT){this->m_orig_glBlendEquationSeparateEXT = this->m_ptr_glBlendEquationSeparateEXT;this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&TraceTableDecorator::m_glBlendEquationSeparateEXT_trace;}
+if(this->m_ptr_glEndOcclusionQueryNV){this->m_orig_glEndOcclusionQueryNV = this->m_ptr_glEndOcclusionQueryNV;this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&TraceTableDecorator::m_glEndOcclusionQueryNV_trace;}
+if(this->m_ptr_glScissorArrayv){this->m_orig_glScissorArrayv = this->m_ptr_glScissorArrayv;this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&TraceTableDecorator::m_glScissorArrayv_trace;}
+if(this->m_ptr_glCallList){this->m_orig_glCallList = this->m_ptr_glCallList;this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&TraceTableDecorator::m_glCallList_trace;}
+if(this->m_ptr_glMapTexture2DINTEL){this->m_orig_glMapTexture2DINTEL = this->m_ptr_glMapTexture2DINTEL;this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&TraceTableDecorator::m_glMapTexture2DINTEL_trace;}
+if(this->m_ptr_glGetVkProcAddrNV){this->m_orig_glGetVkProcAddrNV = this->m_ptr_glGetVkProcAddrNV;this->m_ptr_glGetVkProcAddrNV = (FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC)&TraceTableDecorator::m_glGetVkProcAddrNV_trace;}
+if(this->m_ptr_glPixelTransferxOES){this->m_orig_glPixelTransferxOES = this->m_ptr_glPixelTransferxOES;this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&TraceTableDecorator::m_glPixelTransferxOES_trace;}
+if(this->m_ptr_glDeleteRenderbuffersEXT){this->m_orig_glDeleteRenderbuffersEXT = this->m_ptr_glDeleteRenderbuffersEXT;this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&TraceTableDecorator::m_glDeleteRenderbuffersEXT_trace;}
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN){this->m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN;this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&TraceTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_trace;}
+if(this->m_ptr_glProgramUniformMatrix4dvEXT){this->m_orig_glProgramUniformMatrix4dvEXT = this->m_ptr_glProgramUniformMatrix4dvEXT;this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix4dvEXT_trace;}
+if(this->m_ptr_glGetnColorTable){this->m_orig_glGetnColorTable = this->m_ptr_glGetnColorTable;this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&TraceTableDecorator::m_glGetnColorTable_trace;}
+if(this->m_ptr_glFramebufferTextureLayerARB){this->m_orig_glFramebufferTextureLayerARB = this->m_ptr_glFramebufferTextureLayerARB;this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&TraceTableDecorator::m_glFramebufferTextureLayerARB_trace;}
+if(this->m_ptr_glVertexAttribL2dvEXT){this->m_orig_glVertexAttribL2dvEXT = this->m_ptr_glVertexAttribL2dvEXT;this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&TraceTableDecorator::m_glVertexAttribL2dvEXT_trace;}
+if(this->m_ptr_glGetCombinerStageParameterfvNV){this->m_orig_glGetCombinerStageParameterfvNV = this->m_ptr_glGetCombinerStageParameterfvNV;this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetCombinerStageParameterfvNV_trace;}
+if(this->m_ptr_glMultiTexCoord1xvOES){this->m_orig_glMultiTexCoord1xvOES = this->m_ptr_glMultiTexCoord1xvOES;this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&TraceTableDecorator::m_glMultiTexCoord1xvOES_trace;}
+if(this->m_ptr_glMapBuffer){this->m_orig_glMapBuffer = this->m_ptr_glMapBuffer;this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&TraceTableDecorator::m_glMapBuffer_trace;}
+if(this->m_ptr_glSecondaryColor3d){this->m_orig_glSecondaryColor3d = this->m_ptr_glSecondaryColor3d;this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&TraceTableDecorator::m_glSecondaryColor3d_trace;}
+if(this->m_ptr_glSecondaryColor3f){this->m_orig_glSecondaryColor3f = this->m_ptr_glSecondaryColor3f;this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&TraceTableDecorator::m_glSecondaryColor3f_trace;}
+if(this->m_ptr_glVertexAttribLFormat){this->m_orig_glVertexAttribLFormat = this->m_ptr_glVertexAttribLFormat;this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&TraceTableDecorator::m_glVertexAttribLFormat_trace;}
+if(this->m_ptr_glElementPointerAPPLE){this->m_orig_glElementPointerAPPLE = this->m_ptr_glElementPointerAPPLE;this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&TraceTableDecorator::m_glElementPointerAPPLE_trace;}
+if(this->m_ptr_glVertexStream1fATI){this->m_orig_glVertexStream1fATI = this->m_ptr_glVertexStream1fATI;this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&TraceTableDecorator::m_glVertexStream1fATI_trace;}
+if(this->m_ptr_glCoverageModulationNV){this->m_orig_glCoverageModulationNV = this->m_ptr_glCoverageModulationNV;this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&TraceTableDecorator::m_glCoverageModulationNV_trace;}
+if(this->m_ptr_glSecondaryColor3i){this->m_orig_glSecondaryColor3i = this->m_ptr_glSecondaryColor3i;this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&TraceTableDecorator::m_glSecondaryColor3i_trace;}
+if(this->m_ptr_glDeleteSync){this->m_orig_glDeleteSync = this->m_ptr_glDeleteSync;this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&TraceTableDecorator::m_glDeleteSync_trace;}
+if(this->m_ptr_glGetProgramParameterfvNV){this->m_orig_glGetProgramParameterfvNV = this->m_ptr_glGetProgramParameterfvNV;this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetProgramParameterfvNV_trace;}
+if(this->m_ptr_glMaxShaderCompilerThreadsARB){this->m_orig_glMaxShaderCompilerThreadsARB = this->m_ptr_glMaxShaderCompilerThreadsARB;this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&TraceTableDecorator::m_glMaxShaderCompilerThreadsARB_trace;}
+if(this->m_ptr_glUniformMatrix4x2dv){this->m_orig_glUniformMatrix4x2dv = this->m_ptr_glUniformMatrix4x2dv;this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&TraceTableDecorator::m_glUniformMatrix4x2dv_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT){this->m_orig_glVertexArrayVertexAttribLOffsetEXT = this->m_ptr_glVertexArrayVertexAttribLOffsetEXT;this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_trace;}
+if(this->m_ptr_glSecondaryColor3s){this->m_orig_glSecondaryColor3s = this->m_ptr_glSecondaryColor3s;this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&TraceTableDecorator::m_glSecondaryColor3s_trace;}
+if(this->m_ptr_glIsImageHandleResidentNV){this->m_orig_glIsImageHandleResidentNV = this->m_ptr_glIsImageHandleResidentNV;this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&TraceTableDecorator::m_glIsImageHandleResidentNV_trace;}
+if(this->m_ptr_glUniform3iv){this->m_orig_glUniform3iv = this->m_ptr_glUniform3iv;this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&TraceTableDecorator::m_glUniform3iv_trace;}
+if(this->m_ptr_glVertexAttribL3i64vNV){this->m_orig_glVertexAttribL3i64vNV = this->m_ptr_glVertexAttribL3i64vNV;this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&TraceTableDecorator::m_glVertexAttribL3i64vNV_trace;}
+if(this->m_ptr_glPolygonMode){this->m_orig_glPolygonMode = this->m_ptr_glPolygonMode;this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&TraceTableDecorator::m_glPolygonMode_trace;}
+if(this->m_ptr_glFramebufferSamplePositionsfvAMD){this->m_orig_glFramebufferSamplePositionsfvAMD = this->m_ptr_glFramebufferSamplePositionsfvAMD;this->m_ptr_glFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&TraceTableDecorator::m_glFramebufferSamplePositionsfvAMD_trace;}
+if(this->m_ptr_glConvolutionFilter1DEXT){this->m_orig_glConvolutionFilter1DEXT = this->m_ptr_glConvolutionFilter1DEXT;this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&TraceTableDecorator::m_glConvolutionFilter1DEXT_trace;}
+if(this->m_ptr_glVertexAttrib1dvARB){this->m_orig_glVertexAttrib1dvARB = this->m_ptr_glVertexAttrib1dvARB;this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&TraceTableDecorator::m_glVertexAttrib1dvARB_trace;}
+if(this->m_ptr_glTextureSubImage2DEXT){this->m_orig_glTextureSubImage2DEXT = this->m_ptr_glTextureSubImage2DEXT;this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glTextureSubImage2DEXT_trace;}
+if(this->m_ptr_glIsVertexArrayAPPLE){this->m_orig_glIsVertexArrayAPPLE = this->m_ptr_glIsVertexArrayAPPLE;this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&TraceTableDecorator::m_glIsVertexArrayAPPLE_trace;}
+if(this->m_ptr_glUseProgram){this->m_orig_glUseProgram = this->m_ptr_glUseProgram;this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&TraceTableDecorator::m_glUseProgram_trace;}
+if(this->m_ptr_glLineStipple){this->m_orig_glLineStipple = this->m_ptr_glLineStipple;this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&TraceTableDecorator::m_glLineStipple_trace;}
+if(this->m_ptr_glMultiTexCoord4fvARB){this->m_orig_glMultiTexCoord4fvARB = this->m_ptr_glMultiTexCoord4fvARB;this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&TraceTableDecorator::m_glMultiTexCoord4fvARB_trace;}
+if(this->m_ptr_glVideoCaptureNV){this->m_orig_glVideoCaptureNV = this->m_ptr_glVideoCaptureNV;this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&TraceTableDecorator::m_glVideoCaptureNV_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT){this->m_orig_glVertexArrayVertexAttribLFormatEXT = this->m_ptr_glVertexArrayVertexAttribLFormatEXT;this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_trace;}
+if(this->m_ptr_glUniform3fvARB){this->m_orig_glUniform3fvARB = this->m_ptr_glUniform3fvARB;this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&TraceTableDecorator::m_glUniform3fvARB_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT){this->m_orig_glProgramUniformMatrix3x2fvEXT = this->m_ptr_glProgramUniformMatrix3x2fvEXT;this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x2fvEXT_trace;}
+if(this->m_ptr_glCopyTextureSubImage3DEXT){this->m_orig_glCopyTextureSubImage3DEXT = this->m_ptr_glCopyTextureSubImage3DEXT;this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glCopyTextureSubImage3DEXT_trace;}
+if(this->m_ptr_glMultiTexCoord2bvOES){this->m_orig_glMultiTexCoord2bvOES = this->m_ptr_glMultiTexCoord2bvOES;this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&TraceTableDecorator::m_glMultiTexCoord2bvOES_trace;}
+if(this->m_ptr_glDeleteObjectARB){this->m_orig_glDeleteObjectARB = this->m_ptr_glDeleteObjectARB;this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&TraceTableDecorator::m_glDeleteObjectARB_trace;}
+if(this->m_ptr_glTextureLightEXT){this->m_orig_glTextureLightEXT = this->m_ptr_glTextureLightEXT;this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&TraceTableDecorator::m_glTextureLightEXT_trace;}
+if(this->m_ptr_glRasterPos3i){this->m_orig_glRasterPos3i = this->m_ptr_glRasterPos3i;this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&TraceTableDecorator::m_glRasterPos3i_trace;}
+if(this->m_ptr_glMultiTexCoord3dARB){this->m_orig_glMultiTexCoord3dARB = this->m_ptr_glMultiTexCoord3dARB;this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&TraceTableDecorator::m_glMultiTexCoord3dARB_trace;}
+if(this->m_ptr_glNamedFramebufferTextureEXT){this->m_orig_glNamedFramebufferTextureEXT = this->m_ptr_glNamedFramebufferTextureEXT;this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&TraceTableDecorator::m_glNamedFramebufferTextureEXT_trace;}
+if(this->m_ptr_glTextureParameteriEXT){this->m_orig_glTextureParameteriEXT = this->m_ptr_glTextureParameteriEXT;this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&TraceTableDecorator::m_glTextureParameteriEXT_trace;}
+if(this->m_ptr_glEvalCoord2xvOES){this->m_orig_glEvalCoord2xvOES = this->m_ptr_glEvalCoord2xvOES;this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&TraceTableDecorator::m_glEvalCoord2xvOES_trace;}
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV){this->m_orig_glBindVideoCaptureStreamBufferNV = this->m_ptr_glBindVideoCaptureStreamBufferNV;this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&TraceTableDecorator::m_glBindVideoCaptureStreamBufferNV_trace;}
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV){this->m_orig_glTexImage2DMultisampleCoverageNV = this->m_ptr_glTexImage2DMultisampleCoverageNV;this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&TraceTableDecorator::m_glTexImage2DMultisampleCoverageNV_trace;}
+if(this->m_ptr_glGetAttribLocationARB){this->m_orig_glGetAttribLocationARB = this->m_ptr_glGetAttribLocationARB;this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&TraceTableDecorator::m_glGetAttribLocationARB_trace;}
+if(this->m_ptr_glDeleteShader){this->m_orig_glDeleteShader = this->m_ptr_glDeleteShader;this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&TraceTableDecorator::m_glDeleteShader_trace;}
+if(this->m_ptr_glVertexAttrib1fARB){this->m_orig_glVertexAttrib1fARB = this->m_ptr_glVertexAttrib1fARB;this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&TraceTableDecorator::m_glVertexAttrib1fARB_trace;}
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN){this->m_orig_glTexCoord2fColor4ubVertex3fSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fSUN;this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&TraceTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_trace;}
+if(this->m_ptr_glTexCoord4fVertex4fSUN){this->m_orig_glTexCoord4fVertex4fSUN = this->m_ptr_glTexCoord4fVertex4fSUN;this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&TraceTableDecorator::m_glTexCoord4fVertex4fSUN_trace;}
+if(this->m_ptr_glGetMapdv){this->m_orig_glGetMapdv = this->m_ptr_glGetMapdv;this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&TraceTableDecorator::m_glGetMapdv_trace;}
+if(this->m_ptr_glMapParameterfvNV){this->m_orig_glMapParameterfvNV = this->m_ptr_glMapParameterfvNV;this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&TraceTableDecorator::m_glMapParameterfvNV_trace;}
+if(this->m_ptr_glTextureParameterIuiv){this->m_orig_glTextureParameterIuiv = this->m_ptr_glTextureParameterIuiv;this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&TraceTableDecorator::m_glTextureParameterIuiv_trace;}
+if(this->m_ptr_glTransformFeedbackAttribsNV){this->m_orig_glTransformFeedbackAttribsNV = this->m_ptr_glTransformFeedbackAttribsNV;this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&TraceTableDecorator::m_glTransformFeedbackAttribsNV_trace;}
+if(this->m_ptr_glFragmentLightfvSGIX){this->m_orig_glFragmentLightfvSGIX = this->m_ptr_glFragmentLightfvSGIX;this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&TraceTableDecorator::m_glFragmentLightfvSGIX_trace;}
+if(this->m_ptr_glWindowPos3sARB){this->m_orig_glWindowPos3sARB = this->m_ptr_glWindowPos3sARB;this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&TraceTableDecorator::m_glWindowPos3sARB_trace;}
+if(this->m_ptr_glGetConvolutionParameterfv){this->m_orig_glGetConvolutionParameterfv = this->m_ptr_glGetConvolutionParameterfv;this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&TraceTableDecorator::m_glGetConvolutionParameterfv_trace;}
+if(this->m_ptr_glCopyTexSubImage3D){this->m_orig_glCopyTexSubImage3D = this->m_ptr_glCopyTexSubImage3D;this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&TraceTableDecorator::m_glCopyTexSubImage3D_trace;}
+if(this->m_ptr_glVertexAttribI3i){this->m_orig_glVertexAttribI3i = this->m_ptr_glVertexAttribI3i;this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&TraceTableDecorator::m_glVertexAttribI3i_trace;}
+if(this->m_ptr_glCreateShaderObjectARB){this->m_orig_glCreateShaderObjectARB = this->m_ptr_glCreateShaderObjectARB;this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&TraceTableDecorator::m_glCreateShaderObjectARB_trace;}
+if(this->m_ptr_glVertexAttribFormat){this->m_orig_glVertexAttribFormat = this->m_ptr_glVertexAttribFormat;this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&TraceTableDecorator::m_glVertexAttribFormat_trace;}
+if(this->m_ptr_glGetProgramivARB){this->m_orig_glGetProgramivARB = this->m_ptr_glGetProgramivARB;this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&TraceTableDecorator::m_glGetProgramivARB_trace;}
+if(this->m_ptr_glVertexAttribI4usv){this->m_orig_glVertexAttribI4usv = this->m_ptr_glVertexAttribI4usv;this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&TraceTableDecorator::m_glVertexAttribI4usv_trace;}
+if(this->m_ptr_glTexParameterf){this->m_orig_glTexParameterf = this->m_ptr_glTexParameterf;this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&TraceTableDecorator::m_glTexParameterf_trace;}
+if(this->m_ptr_glVertexAttribBinding){this->m_orig_glVertexAttribBinding = this->m_ptr_glVertexAttribBinding;this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&TraceTableDecorator::m_glVertexAttribBinding_trace;}
+if(this->m_ptr_glGetHistogramParameteriv){this->m_orig_glGetHistogramParameteriv = this->m_ptr_glGetHistogramParameteriv;this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&TraceTableDecorator::m_glGetHistogramParameteriv_trace;}
+if(this->m_ptr_glTexParameteri){this->m_orig_glTexParameteri = this->m_ptr_glTexParameteri;this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&TraceTableDecorator::m_glTexParameteri_trace;}
+if(this->m_ptr_glGetShaderSource){this->m_orig_glGetShaderSource = this->m_ptr_glGetShaderSource;this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&TraceTableDecorator::m_glGetShaderSource_trace;}
+if(this->m_ptr_glVertexAttrib4s){this->m_orig_glVertexAttrib4s = this->m_ptr_glVertexAttrib4s;this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&TraceTableDecorator::m_glVertexAttrib4s_trace;}
+if(this->m_ptr_glVertexAttrib4dvNV){this->m_orig_glVertexAttrib4dvNV = this->m_ptr_glVertexAttrib4dvNV;this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&TraceTableDecorator::m_glVertexAttrib4dvNV_trace;}
+if(this->m_ptr_glVertexAttrib1dvNV){this->m_orig_glVertexAttrib1dvNV = this->m_ptr_glVertexAttrib1dvNV;this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&TraceTableDecorator::m_glVertexAttrib1dvNV_trace;}
+if(this->m_ptr_glPopName){this->m_orig_glPopName = this->m_ptr_glPopName;this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&TraceTableDecorator::m_glPopName_trace;}
+if(this->m_ptr_glTextureBufferEXT){this->m_orig_glTextureBufferEXT = this->m_ptr_glTextureBufferEXT;this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&TraceTableDecorator::m_glTextureBufferEXT_trace;}
+if(this->m_ptr_glGetMultiTexImageEXT){this->m_orig_glGetMultiTexImageEXT = this->m_ptr_glGetMultiTexImageEXT;this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&TraceTableDecorator::m_glGetMultiTexImageEXT_trace;}
+if(this->m_ptr_glGetPointerIndexedvEXT){this->m_orig_glGetPointerIndexedvEXT = this->m_ptr_glGetPointerIndexedvEXT;this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&TraceTableDecorator::m_glGetPointerIndexedvEXT_trace;}
+if(this->m_ptr_glIsNameAMD){this->m_orig_glIsNameAMD = this->m_ptr_glIsNameAMD;this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&TraceTableDecorator::m_glIsNameAMD_trace;}
+if(this->m_ptr_glColor4ub){this->m_orig_glColor4ub = this->m_ptr_glColor4ub;this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&TraceTableDecorator::m_glColor4ub_trace;}
+if(this->m_ptr_glBufferParameteriAPPLE){this->m_orig_glBufferParameteriAPPLE = this->m_ptr_glBufferParameteriAPPLE;this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&TraceTableDecorator::m_glBufferParameteriAPPLE_trace;}
+if(this->m_ptr_glColor4ui){this->m_orig_glColor4ui = this->m_ptr_glColor4ui;this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&TraceTableDecorator::m_glColor4ui_trace;}
+if(this->m_ptr_glGetInternalformativ){this->m_orig_glGetInternalformativ = this->m_ptr_glGetInternalformativ;this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&TraceTableDecorator::m_glGetInternalformativ_trace;}
+if(this->m_ptr_glColor4us){this->m_orig_glColor4us = this->m_ptr_glColor4us;this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&TraceTableDecorator::m_glColor4us_trace;}
+if(this->m_ptr_glVertexAttribP1uiv){this->m_orig_glVertexAttribP1uiv = this->m_ptr_glVertexAttribP1uiv;this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&TraceTableDecorator::m_glVertexAttribP1uiv_trace;}
+if(this->m_ptr_glLinkProgram){this->m_orig_glLinkProgram = this->m_ptr_glLinkProgram;this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&TraceTableDecorator::m_glLinkProgram_trace;}
+if(this->m_ptr_glTexCoord3s){this->m_orig_glTexCoord3s = this->m_ptr_glTexCoord3s;this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&TraceTableDecorator::m_glTexCoord3s_trace;}
+if(this->m_ptr_glTexCoord2dv){this->m_orig_glTexCoord2dv = this->m_ptr_glTexCoord2dv;this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&TraceTableDecorator::m_glTexCoord2dv_trace;}
+if(this->m_ptr_glGetObjectLabel){this->m_orig_glGetObjectLabel = this->m_ptr_glGetObjectLabel;this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&TraceTableDecorator::m_glGetObjectLabel_trace;}
+if(this->m_ptr_glVertexPointerEXT){this->m_orig_glVertexPointerEXT = this->m_ptr_glVertexPointerEXT;this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&TraceTableDecorator::m_glVertexPointerEXT_trace;}
+if(this->m_ptr_glDebugMessageCallbackARB){this->m_orig_glDebugMessageCallbackARB = this->m_ptr_glDebugMessageCallbackARB;this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&TraceTableDecorator::m_glDebugMessageCallbackARB_trace;}
+if(this->m_ptr_glGetString){this->m_orig_glGetString = this->m_ptr_glGetString;this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&TraceTableDecorator::m_glGetString_trace;}
+if(this->m_ptr_glGetPathParameterfvNV){this->m_orig_glGetPathParameterfvNV = this->m_ptr_glGetPathParameterfvNV;this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetPathParameterfvNV_trace;}
+if(this->m_ptr_glLightxvOES){this->m_orig_glLightxvOES = this->m_ptr_glLightxvOES;this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&TraceTableDecorator::m_glLightxvOES_trace;}
+if(this->m_ptr_glEndQuery){this->m_orig_glEndQuery = this->m_ptr_glEndQuery;this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&TraceTableDecorator::m_glEndQuery_trace;}
+if(this->m_ptr_glSecondaryColor3uiv){this->m_orig_glSecondaryColor3uiv = this->m_ptr_glSecondaryColor3uiv;this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&TraceTableDecorator::m_glSecondaryColor3uiv_trace;}
+if(this->m_ptr_glPrioritizeTexturesxOES){this->m_orig_glPrioritizeTexturesxOES = this->m_ptr_glPrioritizeTexturesxOES;this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&TraceTableDecorator::m_glPrioritizeTexturesxOES_trace;}
+if(this->m_ptr_glEdgeFlagPointer){this->m_orig_glEdgeFlagPointer = this->m_ptr_glEdgeFlagPointer;this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&TraceTableDecorator::m_glEdgeFlagPointer_trace;}
+if(this->m_ptr_glFramebufferParameteri){this->m_orig_glFramebufferParameteri = this->m_ptr_glFramebufferParameteri;this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&TraceTableDecorator::m_glFramebufferParameteri_trace;}
+if(this->m_ptr_glTexCoord3hNV){this->m_orig_glTexCoord3hNV = this->m_ptr_glTexCoord3hNV;this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&TraceTableDecorator::m_glTexCoord3hNV_trace;}
+if(this->m_ptr_glMultiModeDrawElementsIBM){this->m_orig_glMultiModeDrawElementsIBM = this->m_ptr_glMultiModeDrawElementsIBM;this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&TraceTableDecorator::m_glMultiModeDrawElementsIBM_trace;}
+if(this->m_ptr_glCopyPixels){this->m_orig_glCopyPixels = this->m_ptr_glCopyPixels;this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&TraceTableDecorator::m_glCopyPixels_trace;}
+if(this->m_ptr_glVertexAttribI2ui){this->m_orig_glVertexAttribI2ui = this->m_ptr_glVertexAttribI2ui;this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&TraceTableDecorator::m_glVertexAttribI2ui_trace;}
+if(this->m_ptr_glClampColorARB){this->m_orig_glClampColorARB = this->m_ptr_glClampColorARB;this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&TraceTableDecorator::m_glClampColorARB_trace;}
+if(this->m_ptr_glColorPointervINTEL){this->m_orig_glColorPointervINTEL = this->m_ptr_glColorPointervINTEL;this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&TraceTableDecorator::m_glColorPointervINTEL_trace;}
+if(this->m_ptr_glDeleteTextures){this->m_orig_glDeleteTextures = this->m_ptr_glDeleteTextures;this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&TraceTableDecorator::m_glDeleteTextures_trace;}
+if(this->m_ptr_glGetMinmaxParameterfvEXT){this->m_orig_glGetMinmaxParameterfvEXT = this->m_ptr_glGetMinmaxParameterfvEXT;this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetMinmaxParameterfvEXT_trace;}
+if(this->m_ptr_glWindowPos3sMESA){this->m_orig_glWindowPos3sMESA = this->m_ptr_glWindowPos3sMESA;this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&TraceTableDecorator::m_glWindowPos3sMESA_trace;}
+if(this->m_ptr_glVertexAttrib4f){this->m_orig_glVertexAttrib4f = this->m_ptr_glVertexAttrib4f;this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&TraceTableDecorator::m_glVertexAttrib4f_trace;}
+if(this->m_ptr_glNamedFramebufferParameteri){this->m_orig_glNamedFramebufferParameteri = this->m_ptr_glNamedFramebufferParameteri;this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&TraceTableDecorator::m_glNamedFramebufferParameteri_trace;}
+if(this->m_ptr_glTexCoord2fVertex3fvSUN){this->m_orig_glTexCoord2fVertex3fvSUN = this->m_ptr_glTexCoord2fVertex3fvSUN;this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glTexCoord2fVertex3fvSUN_trace;}
+if(this->m_ptr_glReplacementCodeusSUN){this->m_orig_glReplacementCodeusSUN = this->m_ptr_glReplacementCodeusSUN;this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&TraceTableDecorator::m_glReplacementCodeusSUN_trace;}
+if(this->m_ptr_glGetNamedFramebufferParameteriv){this->m_orig_glGetNamedFramebufferParameteriv = this->m_ptr_glGetNamedFramebufferParameteriv;this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&TraceTableDecorator::m_glGetNamedFramebufferParameteriv_trace;}
+if(this->m_ptr_glVertexStream1fvATI){this->m_orig_glVertexStream1fvATI = this->m_ptr_glVertexStream1fvATI;this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&TraceTableDecorator::m_glVertexStream1fvATI_trace;}
+if(this->m_ptr_glCreateVertexArrays){this->m_orig_glCreateVertexArrays = this->m_ptr_glCreateVertexArrays;this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&TraceTableDecorator::m_glCreateVertexArrays_trace;}
+if(this->m_ptr_glBeginConditionalRender){this->m_orig_glBeginConditionalRender = this->m_ptr_glBeginConditionalRender;this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&TraceTableDecorator::m_glBeginConditionalRender_trace;}
+if(this->m_ptr_glGetUnsignedBytevEXT){this->m_orig_glGetUnsignedBytevEXT = this->m_ptr_glGetUnsignedBytevEXT;this->m_ptr_glGetUnsignedBytevEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC)&TraceTableDecorator::m_glGetUnsignedBytevEXT_trace;}
+if(this->m_ptr_glConvolutionFilter1D){this->m_orig_glConvolutionFilter1D = this->m_ptr_glConvolutionFilter1D;this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&TraceTableDecorator::m_glConvolutionFilter1D_trace;}
+if(this->m_ptr_glMultiTexCoord3fARB){this->m_orig_glMultiTexCoord3fARB = this->m_ptr_glMultiTexCoord3fARB;this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&TraceTableDecorator::m_glMultiTexCoord3fARB_trace;}
+if(this->m_ptr_glGetQueryObjectuivARB){this->m_orig_glGetQueryObjectuivARB = this->m_ptr_glGetQueryObjectuivARB;this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&TraceTableDecorator::m_glGetQueryObjectuivARB_trace;}
+if(this->m_ptr_glScalexOES){this->m_orig_glScalexOES = this->m_ptr_glScalexOES;this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&TraceTableDecorator::m_glScalexOES_trace;}
+if(this->m_ptr_glSamplerParameteri){this->m_orig_glSamplerParameteri = this->m_ptr_glSamplerParameteri;this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&TraceTableDecorator::m_glSamplerParameteri_trace;}
+if(this->m_ptr_glSamplerParameterf){this->m_orig_glSamplerParameterf = this->m_ptr_glSamplerParameterf;this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&TraceTableDecorator::m_glSamplerParameterf_trace;}
+if(this->m_ptr_glShaderOp1EXT){this->m_orig_glShaderOp1EXT = this->m_ptr_glShaderOp1EXT;this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&TraceTableDecorator::m_glShaderOp1EXT_trace;}
+if(this->m_ptr_glBeginVideoCaptureNV){this->m_orig_glBeginVideoCaptureNV = this->m_ptr_glBeginVideoCaptureNV;this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&TraceTableDecorator::m_glBeginVideoCaptureNV_trace;}
+if(this->m_ptr_glGetnHistogram){this->m_orig_glGetnHistogram = this->m_ptr_glGetnHistogram;this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&TraceTableDecorator::m_glGetnHistogram_trace;}
+if(this->m_ptr_glUniform1d){this->m_orig_glUniform1d = this->m_ptr_glUniform1d;this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&TraceTableDecorator::m_glUniform1d_trace;}
+if(this->m_ptr_glRenderMode){this->m_orig_glRenderMode = this->m_ptr_glRenderMode;this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&TraceTableDecorator::m_glRenderMode_trace;}
+if(this->m_ptr_glClearColorIiEXT){this->m_orig_glClearColorIiEXT = this->m_ptr_glClearColorIiEXT;this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&TraceTableDecorator::m_glClearColorIiEXT_trace;}
+if(this->m_ptr_glSignalSemaphoreEXT){this->m_orig_glSignalSemaphoreEXT = this->m_ptr_glSignalSemaphoreEXT;this->m_ptr_glSignalSemaphoreEXT = (FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC)&TraceTableDecorator::m_glSignalSemaphoreEXT_trace;}
+if(this->m_ptr_glGetCompressedTexImage){this->m_orig_glGetCompressedTexImage = this->m_ptr_glGetCompressedTexImage;this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&TraceTableDecorator::m_glGetCompressedTexImage_trace;}
+if(this->m_ptr_glCompressedTextureImage1DEXT){this->m_orig_glCompressedTextureImage1DEXT = this->m_ptr_glCompressedTextureImage1DEXT;this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&TraceTableDecorator::m_glCompressedTextureImage1DEXT_trace;}
+if(this->m_ptr_glGetActiveUniformBlockiv){this->m_orig_glGetActiveUniformBlockiv = this->m_ptr_glGetActiveUniformBlockiv;this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&TraceTableDecorator::m_glGetActiveUniformBlockiv_trace;}
+if(this->m_ptr_glUniform1i){this->m_orig_glUniform1i = this->m_ptr_glUniform1i;this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&TraceTableDecorator::m_glUniform1i_trace;}
+if(this->m_ptr_glMultiDrawArraysIndirectCount){this->m_orig_glMultiDrawArraysIndirectCount = this->m_ptr_glMultiDrawArraysIndirectCount;this->m_ptr_glMultiDrawArraysIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)&TraceTableDecorator::m_glMultiDrawArraysIndirectCount_trace;}
+if(this->m_ptr_glGetTexEnvfv){this->m_orig_glGetTexEnvfv = this->m_ptr_glGetTexEnvfv;this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&TraceTableDecorator::m_glGetTexEnvfv_trace;}
+if(this->m_ptr_glColorTableParameterivSGI){this->m_orig_glColorTableParameterivSGI = this->m_ptr_glColorTableParameterivSGI;this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&TraceTableDecorator::m_glColorTableParameterivSGI_trace;}
+if(this->m_ptr_glCullFace){this->m_orig_glCullFace = this->m_ptr_glCullFace;this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&TraceTableDecorator::m_glCullFace_trace;}
+if(this->m_ptr_glDeleteFencesAPPLE){this->m_orig_glDeleteFencesAPPLE = this->m_ptr_glDeleteFencesAPPLE;this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&TraceTableDecorator::m_glDeleteFencesAPPLE_trace;}
+if(this->m_ptr_glProgramUniform4i){this->m_orig_glProgramUniform4i = this->m_ptr_glProgramUniform4i;this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&TraceTableDecorator::m_glProgramUniform4i_trace;}
+if(this->m_ptr_glUniformHandleui64ARB){this->m_orig_glUniformHandleui64ARB = this->m_ptr_glUniformHandleui64ARB;this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&TraceTableDecorator::m_glUniformHandleui64ARB_trace;}
+if(this->m_ptr_glProgramUniform4f){this->m_orig_glProgramUniform4f = this->m_ptr_glProgramUniform4f;this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&TraceTableDecorator::m_glProgramUniform4f_trace;}
+if(this->m_ptr_glViewportIndexedf){this->m_orig_glViewportIndexedf = this->m_ptr_glViewportIndexedf;this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&TraceTableDecorator::m_glViewportIndexedf_trace;}
+if(this->m_ptr_glProgramUniform4d){this->m_orig_glProgramUniform4d = this->m_ptr_glProgramUniform4d;this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&TraceTableDecorator::m_glProgramUniform4d_trace;}
+if(this->m_ptr_glTexCoord1xOES){this->m_orig_glTexCoord1xOES = this->m_ptr_glTexCoord1xOES;this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&TraceTableDecorator::m_glTexCoord1xOES_trace;}
+if(this->m_ptr_glVertexStream3ivATI){this->m_orig_glVertexStream3ivATI = this->m_ptr_glVertexStream3ivATI;this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&TraceTableDecorator::m_glVertexStream3ivATI_trace;}
+if(this->m_ptr_glPointAlongPathNV){this->m_orig_glPointAlongPathNV = this->m_ptr_glPointAlongPathNV;this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&TraceTableDecorator::m_glPointAlongPathNV_trace;}
+if(this->m_ptr_glEndQueryARB){this->m_orig_glEndQueryARB = this->m_ptr_glEndQueryARB;this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&TraceTableDecorator::m_glEndQueryARB_trace;}
+if(this->m_ptr_glVDPAUMapSurfacesNV){this->m_orig_glVDPAUMapSurfacesNV = this->m_ptr_glVDPAUMapSurfacesNV;this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&TraceTableDecorator::m_glVDPAUMapSurfacesNV_trace;}
+if(this->m_ptr_glVertex3i){this->m_orig_glVertex3i = this->m_ptr_glVertex3i;this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&TraceTableDecorator::m_glVertex3i_trace;}
+if(this->m_ptr_glVertexAttrib4uivARB){this->m_orig_glVertexAttrib4uivARB = this->m_ptr_glVertexAttrib4uivARB;this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&TraceTableDecorator::m_glVertexAttrib4uivARB_trace;}
+if(this->m_ptr_glTextureStorageMem3DEXT){this->m_orig_glTextureStorageMem3DEXT = this->m_ptr_glTextureStorageMem3DEXT;this->m_ptr_glTextureStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC)&TraceTableDecorator::m_glTextureStorageMem3DEXT_trace;}
+if(this->m_ptr_glAttachShader){this->m_orig_glAttachShader = this->m_ptr_glAttachShader;this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&TraceTableDecorator::m_glAttachShader_trace;}
+if(this->m_ptr_glColor4hNV){this->m_orig_glColor4hNV = this->m_ptr_glColor4hNV;this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&TraceTableDecorator::m_glColor4hNV_trace;}
+if(this->m_ptr_glGetFenceivNV){this->m_orig_glGetFenceivNV = this->m_ptr_glGetFenceivNV;this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&TraceTableDecorator::m_glGetFenceivNV_trace;}
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN){this->m_orig_glTexCoord2fColor4ubVertex3fvSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN;this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&TraceTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_trace;}
+if(this->m_ptr_glGetColorTable){this->m_orig_glGetColorTable = this->m_ptr_glGetColorTable;this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&TraceTableDecorator::m_glGetColorTable_trace;}
+if(this->m_ptr_glFogCoordPointer){this->m_orig_glFogCoordPointer = this->m_ptr_glFogCoordPointer;this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&TraceTableDecorator::m_glFogCoordPointer_trace;}
+if(this->m_ptr_glTexStorageSparseAMD){this->m_orig_glTexStorageSparseAMD = this->m_ptr_glTexStorageSparseAMD;this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&TraceTableDecorator::m_glTexStorageSparseAMD_trace;}
+if(this->m_ptr_glUnmapNamedBuffer){this->m_orig_glUnmapNamedBuffer = this->m_ptr_glUnmapNamedBuffer;this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&TraceTableDecorator::m_glUnmapNamedBuffer_trace;}
+if(this->m_ptr_glTexCoord4bvOES){this->m_orig_glTexCoord4bvOES = this->m_ptr_glTexCoord4bvOES;this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&TraceTableDecorator::m_glTexCoord4bvOES_trace;}
+if(this->m_ptr_glVertexAttrib3fARB){this->m_orig_glVertexAttrib3fARB = this->m_ptr_glVertexAttrib3fARB;this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&TraceTableDecorator::m_glVertexAttrib3fARB_trace;}
+if(this->m_ptr_glRasterPos2xOES){this->m_orig_glRasterPos2xOES = this->m_ptr_glRasterPos2xOES;this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&TraceTableDecorator::m_glRasterPos2xOES_trace;}
+if(this->m_ptr_glCreateMemoryObjectsEXT){this->m_orig_glCreateMemoryObjectsEXT = this->m_ptr_glCreateMemoryObjectsEXT;this->m_ptr_glCreateMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC)&TraceTableDecorator::m_glCreateMemoryObjectsEXT_trace;}
+if(this->m_ptr_glColor4ubVertex2fvSUN){this->m_orig_glColor4ubVertex2fvSUN = this->m_ptr_glColor4ubVertex2fvSUN;this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&TraceTableDecorator::m_glColor4ubVertex2fvSUN_trace;}
+if(this->m_ptr_glSecondaryColor3dv){this->m_orig_glSecondaryColor3dv = this->m_ptr_glSecondaryColor3dv;this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&TraceTableDecorator::m_glSecondaryColor3dv_trace;}
+if(this->m_ptr_glVertexAttribI4sv){this->m_orig_glVertexAttribI4sv = this->m_ptr_glVertexAttribI4sv;this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&TraceTableDecorator::m_glVertexAttribI4sv_trace;}
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced){this->m_orig_glDrawTransformFeedbackStreamInstanced = this->m_ptr_glDrawTransformFeedbackStreamInstanced;this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&TraceTableDecorator::m_glDrawTransformFeedbackStreamInstanced_trace;}
+if(this->m_ptr_glMultiTexCoord4ivARB){this->m_orig_glMultiTexCoord4ivARB = this->m_ptr_glMultiTexCoord4ivARB;this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&TraceTableDecorator::m_glMultiTexCoord4ivARB_trace;}
+if(this->m_ptr_glSpriteParameterfSGIX){this->m_orig_glSpriteParameterfSGIX = this->m_ptr_glSpriteParameterfSGIX;this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&TraceTableDecorator::m_glSpriteParameterfSGIX_trace;}
+if(this->m_ptr_glSecondaryColor3sv){this->m_orig_glSecondaryColor3sv = this->m_ptr_glSecondaryColor3sv;this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&TraceTableDecorator::m_glSecondaryColor3sv_trace;}
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV){this->m_orig_glBindVideoCaptureStreamTextureNV = this->m_ptr_glBindVideoCaptureStreamTextureNV;this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&TraceTableDecorator::m_glBindVideoCaptureStreamTextureNV_trace;}
+if(this->m_ptr_glTexParameterIuiv){this->m_orig_glTexParameterIuiv = this->m_ptr_glTexParameterIuiv;this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&TraceTableDecorator::m_glTexParameterIuiv_trace;}
+if(this->m_ptr_glFlushPixelDataRangeNV){this->m_orig_glFlushPixelDataRangeNV = this->m_ptr_glFlushPixelDataRangeNV;this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&TraceTableDecorator::m_glFlushPixelDataRangeNV_trace;}
+if(this->m_ptr_glWindowPos3fv){this->m_orig_glWindowPos3fv = this->m_ptr_glWindowPos3fv;this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&TraceTableDecorator::m_glWindowPos3fv_trace;}
+if(this->m_ptr_glVertexAttribLFormatNV){this->m_orig_glVertexAttribLFormatNV = this->m_ptr_glVertexAttribLFormatNV;this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&TraceTableDecorator::m_glVertexAttribLFormatNV_trace;}
+if(this->m_ptr_glLightModelfv){this->m_orig_glLightModelfv = this->m_ptr_glLightModelfv;this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&TraceTableDecorator::m_glLightModelfv_trace;}
+if(this->m_ptr_glGetColorTableSGI){this->m_orig_glGetColorTableSGI = this->m_ptr_glGetColorTableSGI;this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&TraceTableDecorator::m_glGetColorTableSGI_trace;}
+if(this->m_ptr_glGetCompressedTexImageARB){this->m_orig_glGetCompressedTexImageARB = this->m_ptr_glGetCompressedTexImageARB;this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&TraceTableDecorator::m_glGetCompressedTexImageARB_trace;}
+if(this->m_ptr_glConvolutionParameteri){this->m_orig_glConvolutionParameteri = this->m_ptr_glConvolutionParameteri;this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&TraceTableDecorator::m_glConvolutionParameteri_trace;}
+if(this->m_ptr_glVertexWeighthNV){this->m_orig_glVertexWeighthNV = this->m_ptr_glVertexWeighthNV;this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&TraceTableDecorator::m_glVertexWeighthNV_trace;}
+if(this->m_ptr_glColorMaskIndexedEXT){this->m_orig_glColorMaskIndexedEXT = this->m_ptr_glColorMaskIndexedEXT;this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&TraceTableDecorator::m_glColorMaskIndexedEXT_trace;}
+if(this->m_ptr_glColorMaski){this->m_orig_glColorMaski = this->m_ptr_glColorMaski;this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&TraceTableDecorator::m_glColorMaski_trace;}
+if(this->m_ptr_glColorFragmentOp1ATI){this->m_orig_glColorFragmentOp1ATI = this->m_ptr_glColorFragmentOp1ATI;this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&TraceTableDecorator::m_glColorFragmentOp1ATI_trace;}
+if(this->m_ptr_glVertexAttribI4ubvEXT){this->m_orig_glVertexAttribI4ubvEXT = this->m_ptr_glVertexAttribI4ubvEXT;this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&TraceTableDecorator::m_glVertexAttribI4ubvEXT_trace;}
+if(this->m_ptr_glVertexAttrib1dNV){this->m_orig_glVertexAttrib1dNV = this->m_ptr_glVertexAttrib1dNV;this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&TraceTableDecorator::m_glVertexAttrib1dNV_trace;}
+if(this->m_ptr_glUnmapObjectBufferATI){this->m_orig_glUnmapObjectBufferATI = this->m_ptr_glUnmapObjectBufferATI;this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&TraceTableDecorator::m_glUnmapObjectBufferATI_trace;}
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT){this->m_orig_glNamedProgramLocalParameterI4uiEXT = this->m_ptr_glNamedProgramLocalParameterI4uiEXT;this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_trace;}
+if(this->m_ptr_glProgramUniform1iEXT){this->m_orig_glProgramUniform1iEXT = this->m_ptr_glProgramUniform1iEXT;this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&TraceTableDecorator::m_glProgramUniform1iEXT_trace;}
+if(this->m_ptr_glDeleteQueriesARB){this->m_orig_glDeleteQueriesARB = this->m_ptr_glDeleteQueriesARB;this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&TraceTableDecorator::m_glDeleteQueriesARB_trace;}
+if(this->m_ptr_glWindowPos3svARB){this->m_orig_glWindowPos3svARB = this->m_ptr_glWindowPos3svARB;this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&TraceTableDecorator::m_glWindowPos3svARB_trace;}
+if(this->m_ptr_glVertex4s){this->m_orig_glVertex4s = this->m_ptr_glVertex4s;this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&TraceTableDecorator::m_glVertex4s_trace;}
+if(this->m_ptr_glImportMemoryWin32NameEXT){this->m_orig_glImportMemoryWin32NameEXT = this->m_ptr_glImportMemoryWin32NameEXT;this->m_ptr_glImportMemoryWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC)&TraceTableDecorator::m_glImportMemoryWin32NameEXT_trace;}
+if(this->m_ptr_glStringMarkerGREMEDY){this->m_orig_glStringMarkerGREMEDY = this->m_ptr_glStringMarkerGREMEDY;this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&TraceTableDecorator::m_glStringMarkerGREMEDY_trace;}
+if(this->m_ptr_glIsTransformFeedback){this->m_orig_glIsTransformFeedback = this->m_ptr_glIsTransformFeedback;this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glIsTransformFeedback_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT){this->m_orig_glProgramUniformMatrix2x3dvEXT = this->m_ptr_glProgramUniformMatrix2x3dvEXT;this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x3dvEXT_trace;}
+if(this->m_ptr_glGetObjectLabelEXT){this->m_orig_glGetObjectLabelEXT = this->m_ptr_glGetObjectLabelEXT;this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&TraceTableDecorator::m_glGetObjectLabelEXT_trace;}
+if(this->m_ptr_glUniformHandleui64vNV){this->m_orig_glUniformHandleui64vNV = this->m_ptr_glUniformHandleui64vNV;this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&TraceTableDecorator::m_glUniformHandleui64vNV_trace;}
+if(this->m_ptr_glRotated){this->m_orig_glRotated = this->m_ptr_glRotated;this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&TraceTableDecorator::m_glRotated_trace;}
+if(this->m_ptr_glIsProgramPipeline){this->m_orig_glIsProgramPipeline = this->m_ptr_glIsProgramPipeline;this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&TraceTableDecorator::m_glIsProgramPipeline_trace;}
+if(this->m_ptr_glRotatef){this->m_orig_glRotatef = this->m_ptr_glRotatef;this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&TraceTableDecorator::m_glRotatef_trace;}
+if(this->m_ptr_glVertex4i){this->m_orig_glVertex4i = this->m_ptr_glVertex4i;this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&TraceTableDecorator::m_glVertex4i_trace;}
+if(this->m_ptr_glGetActiveSubroutineUniformName){this->m_orig_glGetActiveSubroutineUniformName = this->m_ptr_glGetActiveSubroutineUniformName;this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&TraceTableDecorator::m_glGetActiveSubroutineUniformName_trace;}
+if(this->m_ptr_glVertexAttrib4sNV){this->m_orig_glVertexAttrib4sNV = this->m_ptr_glVertexAttrib4sNV;this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&TraceTableDecorator::m_glVertexAttrib4sNV_trace;}
+if(this->m_ptr_glProgramLocalParameter4dvARB){this->m_orig_glProgramLocalParameter4dvARB = this->m_ptr_glProgramLocalParameter4dvARB;this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&TraceTableDecorator::m_glProgramLocalParameter4dvARB_trace;}
+if(this->m_ptr_glReplacementCodeubSUN){this->m_orig_glReplacementCodeubSUN = this->m_ptr_glReplacementCodeubSUN;this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&TraceTableDecorator::m_glReplacementCodeubSUN_trace;}
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV){this->m_orig_glMultiDrawElementsIndirectBindlessNV = this->m_ptr_glMultiDrawElementsIndirectBindlessNV;this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&TraceTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_trace;}
+if(this->m_ptr_glImportSemaphoreWin32HandleEXT){this->m_orig_glImportSemaphoreWin32HandleEXT = this->m_ptr_glImportSemaphoreWin32HandleEXT;this->m_ptr_glImportSemaphoreWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)&TraceTableDecorator::m_glImportSemaphoreWin32HandleEXT_trace;}
+if(this->m_ptr_glUniformMatrix3fv){this->m_orig_glUniformMatrix3fv = this->m_ptr_glUniformMatrix3fv;this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&TraceTableDecorator::m_glUniformMatrix3fv_trace;}
+if(this->m_ptr_glGetnMapfvARB){this->m_orig_glGetnMapfvARB = this->m_ptr_glGetnMapfvARB;this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&TraceTableDecorator::m_glGetnMapfvARB_trace;}
+if(this->m_ptr_glGetnUniformfv){this->m_orig_glGetnUniformfv = this->m_ptr_glGetnUniformfv;this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&TraceTableDecorator::m_glGetnUniformfv_trace;}
+if(this->m_ptr_glVertexAttribL2dv){this->m_orig_glVertexAttribL2dv = this->m_ptr_glVertexAttribL2dv;this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&TraceTableDecorator::m_glVertexAttribL2dv_trace;}
+if(this->m_ptr_glVertexWeightPointerEXT){this->m_orig_glVertexWeightPointerEXT = this->m_ptr_glVertexWeightPointerEXT;this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&TraceTableDecorator::m_glVertexWeightPointerEXT_trace;}
+if(this->m_ptr_glTangent3sEXT){this->m_orig_glTangent3sEXT = this->m_ptr_glTangent3sEXT;this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&TraceTableDecorator::m_glTangent3sEXT_trace;}
+if(this->m_ptr_glSecondaryColorPointer){this->m_orig_glSecondaryColorPointer = this->m_ptr_glSecondaryColorPointer;this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&TraceTableDecorator::m_glSecondaryColorPointer_trace;}
+if(this->m_ptr_glAlphaFunc){this->m_orig_glAlphaFunc = this->m_ptr_glAlphaFunc;this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&TraceTableDecorator::m_glAlphaFunc_trace;}
+if(this->m_ptr_glGetNamedStringARB){this->m_orig_glGetNamedStringARB = this->m_ptr_glGetNamedStringARB;this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&TraceTableDecorator::m_glGetNamedStringARB_trace;}
+if(this->m_ptr_glTexCoord4d){this->m_orig_glTexCoord4d = this->m_ptr_glTexCoord4d;this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&TraceTableDecorator::m_glTexCoord4d_trace;}
+if(this->m_ptr_glBufferPageCommitmentARB){this->m_orig_glBufferPageCommitmentARB = this->m_ptr_glBufferPageCommitmentARB;this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&TraceTableDecorator::m_glBufferPageCommitmentARB_trace;}
+if(this->m_ptr_glProgramLocalParameters4fvEXT){this->m_orig_glProgramLocalParameters4fvEXT = this->m_ptr_glProgramLocalParameters4fvEXT;this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&TraceTableDecorator::m_glProgramLocalParameters4fvEXT_trace;}
+if(this->m_ptr_glStencilFunc){this->m_orig_glStencilFunc = this->m_ptr_glStencilFunc;this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&TraceTableDecorator::m_glStencilFunc_trace;}
+if(this->m_ptr_glSemaphoreParameterui64vEXT){this->m_orig_glSemaphoreParameterui64vEXT = this->m_ptr_glSemaphoreParameterui64vEXT;this->m_ptr_glSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC)&TraceTableDecorator::m_glSemaphoreParameterui64vEXT_trace;}
+if(this->m_ptr_glGetVertexAttribdvNV){this->m_orig_glGetVertexAttribdvNV = this->m_ptr_glGetVertexAttribdvNV;this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&TraceTableDecorator::m_glGetVertexAttribdvNV_trace;}
+if(this->m_ptr_glTexCoord3dv){this->m_orig_glTexCoord3dv = this->m_ptr_glTexCoord3dv;this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&TraceTableDecorator::m_glTexCoord3dv_trace;}
+if(this->m_ptr_glGetQueryBufferObjectiv){this->m_orig_glGetQueryBufferObjectiv = this->m_ptr_glGetQueryBufferObjectiv;this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&TraceTableDecorator::m_glGetQueryBufferObjectiv_trace;}
+if(this->m_ptr_glTexGenxOES){this->m_orig_glTexGenxOES = this->m_ptr_glTexGenxOES;this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&TraceTableDecorator::m_glTexGenxOES_trace;}
+if(this->m_ptr_glMultiTexCoord1fvARB){this->m_orig_glMultiTexCoord1fvARB = this->m_ptr_glMultiTexCoord1fvARB;this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&TraceTableDecorator::m_glMultiTexCoord1fvARB_trace;}
+if(this->m_ptr_glLightEnviSGIX){this->m_orig_glLightEnviSGIX = this->m_ptr_glLightEnviSGIX;this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&TraceTableDecorator::m_glLightEnviSGIX_trace;}
+if(this->m_ptr_glGetProgramPipelineiv){this->m_orig_glGetProgramPipelineiv = this->m_ptr_glGetProgramPipelineiv;this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&TraceTableDecorator::m_glGetProgramPipelineiv_trace;}
+if(this->m_ptr_glVertexStream2ivATI){this->m_orig_glVertexStream2ivATI = this->m_ptr_glVertexStream2ivATI;this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&TraceTableDecorator::m_glVertexStream2ivATI_trace;}
+if(this->m_ptr_glGetColorTableEXT){this->m_orig_glGetColorTableEXT = this->m_ptr_glGetColorTableEXT;this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&TraceTableDecorator::m_glGetColorTableEXT_trace;}
+if(this->m_ptr_glGetShaderInfoLog){this->m_orig_glGetShaderInfoLog = this->m_ptr_glGetShaderInfoLog;this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&TraceTableDecorator::m_glGetShaderInfoLog_trace;}
+if(this->m_ptr_glGetOcclusionQueryuivNV){this->m_orig_glGetOcclusionQueryuivNV = this->m_ptr_glGetOcclusionQueryuivNV;this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&TraceTableDecorator::m_glGetOcclusionQueryuivNV_trace;}
+if(this->m_ptr_glInvalidateNamedFramebufferSubData){this->m_orig_glInvalidateNamedFramebufferSubData = this->m_ptr_glInvalidateNamedFramebufferSubData;this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&TraceTableDecorator::m_glInvalidateNamedFramebufferSubData_trace;}
+if(this->m_ptr_glVertexAttribL1i64NV){this->m_orig_glVertexAttribL1i64NV = this->m_ptr_glVertexAttribL1i64NV;this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&TraceTableDecorator::m_glVertexAttribL1i64NV_trace;}
+if(this->m_ptr_glVDPAUInitNV){this->m_orig_glVDPAUInitNV = this->m_ptr_glVDPAUInitNV;this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&TraceTableDecorator::m_glVDPAUInitNV_trace;}
+if(this->m_ptr_glVertexAttrib1hvNV){this->m_orig_glVertexAttrib1hvNV = this->m_ptr_glVertexAttrib1hvNV;this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&TraceTableDecorator::m_glVertexAttrib1hvNV_trace;}
+if(this->m_ptr_glVertexAttribI4i){this->m_orig_glVertexAttribI4i = this->m_ptr_glVertexAttribI4i;this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&TraceTableDecorator::m_glVertexAttribI4i_trace;}
+if(this->m_ptr_glRasterPos2iv){this->m_orig_glRasterPos2iv = this->m_ptr_glRasterPos2iv;this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&TraceTableDecorator::m_glRasterPos2iv_trace;}
+if(this->m_ptr_glGetIntegerui64i_vNV){this->m_orig_glGetIntegerui64i_vNV = this->m_ptr_glGetIntegerui64i_vNV;this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&TraceTableDecorator::m_glGetIntegerui64i_vNV_trace;}
+if(this->m_ptr_glUniformHandleui64NV){this->m_orig_glUniformHandleui64NV = this->m_ptr_glUniformHandleui64NV;this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&TraceTableDecorator::m_glUniformHandleui64NV_trace;}
+if(this->m_ptr_glWindowPos3ivMESA){this->m_orig_glWindowPos3ivMESA = this->m_ptr_glWindowPos3ivMESA;this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&TraceTableDecorator::m_glWindowPos3ivMESA_trace;}
+if(this->m_ptr_glBlendEquationSeparate){this->m_orig_glBlendEquationSeparate = this->m_ptr_glBlendEquationSeparate;this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&TraceTableDecorator::m_glBlendEquationSeparate_trace;}
+if(this->m_ptr_glDrawElementsInstancedARB){this->m_orig_glDrawElementsInstancedARB = this->m_ptr_glDrawElementsInstancedARB;this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&TraceTableDecorator::m_glDrawElementsInstancedARB_trace;}
+if(this->m_ptr_glGetSubroutineIndex){this->m_orig_glGetSubroutineIndex = this->m_ptr_glGetSubroutineIndex;this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&TraceTableDecorator::m_glGetSubroutineIndex_trace;}
+if(this->m_ptr_glVertexAttrib2sv){this->m_orig_glVertexAttrib2sv = this->m_ptr_glVertexAttrib2sv;this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&TraceTableDecorator::m_glVertexAttrib2sv_trace;}
+if(this->m_ptr_glSamplePatternSGIS){this->m_orig_glSamplePatternSGIS = this->m_ptr_glSamplePatternSGIS;this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&TraceTableDecorator::m_glSamplePatternSGIS_trace;}
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES){this->m_orig_glEGLImageTargetRenderbufferStorageOES = this->m_ptr_glEGLImageTargetRenderbufferStorageOES;this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&TraceTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_trace;}
+if(this->m_ptr_glPushAttrib){this->m_orig_glPushAttrib = this->m_ptr_glPushAttrib;this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&TraceTableDecorator::m_glPushAttrib_trace;}
+if(this->m_ptr_glVertex3hNV){this->m_orig_glVertex3hNV = this->m_ptr_glVertex3hNV;this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&TraceTableDecorator::m_glVertex3hNV_trace;}
+if(this->m_ptr_glRasterPos3xvOES){this->m_orig_glRasterPos3xvOES = this->m_ptr_glRasterPos3xvOES;this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&TraceTableDecorator::m_glRasterPos3xvOES_trace;}
+if(this->m_ptr_glPathParameterfNV){this->m_orig_glPathParameterfNV = this->m_ptr_glPathParameterfNV;this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&TraceTableDecorator::m_glPathParameterfNV_trace;}
+if(this->m_ptr_glGetUniformi64vNV){this->m_orig_glGetUniformi64vNV = this->m_ptr_glGetUniformi64vNV;this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&TraceTableDecorator::m_glGetUniformi64vNV_trace;}
+if(this->m_ptr_glLightiv){this->m_orig_glLightiv = this->m_ptr_glLightiv;this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&TraceTableDecorator::m_glLightiv_trace;}
+if(this->m_ptr_glMaterialxvOES){this->m_orig_glMaterialxvOES = this->m_ptr_glMaterialxvOES;this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&TraceTableDecorator::m_glMaterialxvOES_trace;}
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT){this->m_orig_glNamedProgramLocalParameter4fEXT = this->m_ptr_glNamedProgramLocalParameter4fEXT;this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameter4fEXT_trace;}
+if(this->m_ptr_glVertexAttribL1dEXT){this->m_orig_glVertexAttribL1dEXT = this->m_ptr_glVertexAttribL1dEXT;this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&TraceTableDecorator::m_glVertexAttribL1dEXT_trace;}
+if(this->m_ptr_glGetnUniformdvARB){this->m_orig_glGetnUniformdvARB = this->m_ptr_glGetnUniformdvARB;this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&TraceTableDecorator::m_glGetnUniformdvARB_trace;}
+if(this->m_ptr_glSecondaryColor3bEXT){this->m_orig_glSecondaryColor3bEXT = this->m_ptr_glSecondaryColor3bEXT;this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&TraceTableDecorator::m_glSecondaryColor3bEXT_trace;}
+if(this->m_ptr_glBeginPerfQueryINTEL){this->m_orig_glBeginPerfQueryINTEL = this->m_ptr_glBeginPerfQueryINTEL;this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&TraceTableDecorator::m_glBeginPerfQueryINTEL_trace;}
+if(this->m_ptr_glProgramUniform1uivEXT){this->m_orig_glProgramUniform1uivEXT = this->m_ptr_glProgramUniform1uivEXT;this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&TraceTableDecorator::m_glProgramUniform1uivEXT_trace;}
+if(this->m_ptr_glImageTransformParameterivHP){this->m_orig_glImageTransformParameterivHP = this->m_ptr_glImageTransformParameterivHP;this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&TraceTableDecorator::m_glImageTransformParameterivHP_trace;}
+if(this->m_ptr_glDeleteBuffers){this->m_orig_glDeleteBuffers = this->m_ptr_glDeleteBuffers;this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&TraceTableDecorator::m_glDeleteBuffers_trace;}
+if(this->m_ptr_glBindProgramPipeline){this->m_orig_glBindProgramPipeline = this->m_ptr_glBindProgramPipeline;this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&TraceTableDecorator::m_glBindProgramPipeline_trace;}
+if(this->m_ptr_glScissor){this->m_orig_glScissor = this->m_ptr_glScissor;this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&TraceTableDecorator::m_glScissor_trace;}
+if(this->m_ptr_glProgramUniform4fv){this->m_orig_glProgramUniform4fv = this->m_ptr_glProgramUniform4fv;this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&TraceTableDecorator::m_glProgramUniform4fv_trace;}
+if(this->m_ptr_glGetBooleanv){this->m_orig_glGetBooleanv = this->m_ptr_glGetBooleanv;this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&TraceTableDecorator::m_glGetBooleanv_trace;}
+if(this->m_ptr_glMaterialfv){this->m_orig_glMaterialfv = this->m_ptr_glMaterialfv;this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&TraceTableDecorator::m_glMaterialfv_trace;}
+if(this->m_ptr_glWindowPos4fvMESA){this->m_orig_glWindowPos4fvMESA = this->m_ptr_glWindowPos4fvMESA;this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&TraceTableDecorator::m_glWindowPos4fvMESA_trace;}
+if(this->m_ptr_glVertexAttribIPointerEXT){this->m_orig_glVertexAttribIPointerEXT = this->m_ptr_glVertexAttribIPointerEXT;this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&TraceTableDecorator::m_glVertexAttribIPointerEXT_trace;}
+if(this->m_ptr_glProgramBufferParametersfvNV){this->m_orig_glProgramBufferParametersfvNV = this->m_ptr_glProgramBufferParametersfvNV;this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&TraceTableDecorator::m_glProgramBufferParametersfvNV_trace;}
+if(this->m_ptr_glAlphaFuncxOES){this->m_orig_glAlphaFuncxOES = this->m_ptr_glAlphaFuncxOES;this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&TraceTableDecorator::m_glAlphaFuncxOES_trace;}
+if(this->m_ptr_glMultiDrawArraysIndirectAMD){this->m_orig_glMultiDrawArraysIndirectAMD = this->m_ptr_glMultiDrawArraysIndirectAMD;this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&TraceTableDecorator::m_glMultiDrawArraysIndirectAMD_trace;}
+if(this->m_ptr_glNormalStream3ivATI){this->m_orig_glNormalStream3ivATI = this->m_ptr_glNormalStream3ivATI;this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&TraceTableDecorator::m_glNormalStream3ivATI_trace;}
+if(this->m_ptr_glTextureImage3DMultisampleNV){this->m_orig_glTextureImage3DMultisampleNV = this->m_ptr_glTextureImage3DMultisampleNV;this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&TraceTableDecorator::m_glTextureImage3DMultisampleNV_trace;}
+if(this->m_ptr_glProgramUniform4uivEXT){this->m_orig_glProgramUniform4uivEXT = this->m_ptr_glProgramUniform4uivEXT;this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&TraceTableDecorator::m_glProgramUniform4uivEXT_trace;}
+if(this->m_ptr_glReplacementCodeusvSUN){this->m_orig_glReplacementCodeusvSUN = this->m_ptr_glReplacementCodeusvSUN;this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&TraceTableDecorator::m_glReplacementCodeusvSUN_trace;}
+if(this->m_ptr_glPollInstrumentsSGIX){this->m_orig_glPollInstrumentsSGIX = this->m_ptr_glPollInstrumentsSGIX;this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&TraceTableDecorator::m_glPollInstrumentsSGIX_trace;}
+if(this->m_ptr_glGetTextureLevelParameteriv){this->m_orig_glGetTextureLevelParameteriv = this->m_ptr_glGetTextureLevelParameteriv;this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&TraceTableDecorator::m_glGetTextureLevelParameteriv_trace;}
+if(this->m_ptr_glVertexAttribI2uiv){this->m_orig_glVertexAttribI2uiv = this->m_ptr_glVertexAttribI2uiv;this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&TraceTableDecorator::m_glVertexAttribI2uiv_trace;}
+if(this->m_ptr_glMapControlPointsNV){this->m_orig_glMapControlPointsNV = this->m_ptr_glMapControlPointsNV;this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&TraceTableDecorator::m_glMapControlPointsNV_trace;}
+if(this->m_ptr_glColor4dv){this->m_orig_glColor4dv = this->m_ptr_glColor4dv;this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&TraceTableDecorator::m_glColor4dv_trace;}
+if(this->m_ptr_glInvalidateBufferSubData){this->m_orig_glInvalidateBufferSubData = this->m_ptr_glInvalidateBufferSubData;this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&TraceTableDecorator::m_glInvalidateBufferSubData_trace;}
+if(this->m_ptr_glMultiTexCoord1hNV){this->m_orig_glMultiTexCoord1hNV = this->m_ptr_glMultiTexCoord1hNV;this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&TraceTableDecorator::m_glMultiTexCoord1hNV_trace;}
+if(this->m_ptr_glPointParameterfv){this->m_orig_glPointParameterfv = this->m_ptr_glPointParameterfv;this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&TraceTableDecorator::m_glPointParameterfv_trace;}
+if(this->m_ptr_glUniformMatrix2fvARB){this->m_orig_glUniformMatrix2fvARB = this->m_ptr_glUniformMatrix2fvARB;this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&TraceTableDecorator::m_glUniformMatrix2fvARB_trace;}
+if(this->m_ptr_glUniform2fv){this->m_orig_glUniform2fv = this->m_ptr_glUniform2fv;this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&TraceTableDecorator::m_glUniform2fv_trace;}
+if(this->m_ptr_glVertexPointerListIBM){this->m_orig_glVertexPointerListIBM = this->m_ptr_glVertexPointerListIBM;this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&TraceTableDecorator::m_glVertexPointerListIBM_trace;}
+if(this->m_ptr_glGetMultiTexGenfvEXT){this->m_orig_glGetMultiTexGenfvEXT = this->m_ptr_glGetMultiTexGenfvEXT;this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&TraceTableDecorator::m_glGetMultiTexGenfvEXT_trace;}
+if(this->m_ptr_glGetMinmaxEXT){this->m_orig_glGetMinmaxEXT = this->m_ptr_glGetMinmaxEXT;this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&TraceTableDecorator::m_glGetMinmaxEXT_trace;}
+if(this->m_ptr_glIsFenceNV){this->m_orig_glIsFenceNV = this->m_ptr_glIsFenceNV;this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&TraceTableDecorator::m_glIsFenceNV_trace;}
+if(this->m_ptr_glMatrixFrustumEXT){this->m_orig_glMatrixFrustumEXT = this->m_ptr_glMatrixFrustumEXT;this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&TraceTableDecorator::m_glMatrixFrustumEXT_trace;}
+if(this->m_ptr_glDispatchComputeIndirect){this->m_orig_glDispatchComputeIndirect = this->m_ptr_glDispatchComputeIndirect;this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&TraceTableDecorator::m_glDispatchComputeIndirect_trace;}
+if(this->m_ptr_glQueryResourceNV){this->m_orig_glQueryResourceNV = this->m_ptr_glQueryResourceNV;this->m_ptr_glQueryResourceNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC)&TraceTableDecorator::m_glQueryResourceNV_trace;}
+if(this->m_ptr_glMultiTexCoord4bOES){this->m_orig_glMultiTexCoord4bOES = this->m_ptr_glMultiTexCoord4bOES;this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&TraceTableDecorator::m_glMultiTexCoord4bOES_trace;}
+if(this->m_ptr_glProgramEnvParameter4dARB){this->m_orig_glProgramEnvParameter4dARB = this->m_ptr_glProgramEnvParameter4dARB;this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&TraceTableDecorator::m_glProgramEnvParameter4dARB_trace;}
+if(this->m_ptr_glProgramUniform1uiEXT){this->m_orig_glProgramUniform1uiEXT = this->m_ptr_glProgramUniform1uiEXT;this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&TraceTableDecorator::m_glProgramUniform1uiEXT_trace;}
+if(this->m_ptr_glBindBufferRange){this->m_orig_glBindBufferRange = this->m_ptr_glBindBufferRange;this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&TraceTableDecorator::m_glBindBufferRange_trace;}
+if(this->m_ptr_glNormal3iv){this->m_orig_glNormal3iv = this->m_ptr_glNormal3iv;this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&TraceTableDecorator::m_glNormal3iv_trace;}
+if(this->m_ptr_glVertexAttribL3dv){this->m_orig_glVertexAttribL3dv = this->m_ptr_glVertexAttribL3dv;this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&TraceTableDecorator::m_glVertexAttribL3dv_trace;}
+if(this->m_ptr_glGetUniformdv){this->m_orig_glGetUniformdv = this->m_ptr_glGetUniformdv;this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&TraceTableDecorator::m_glGetUniformdv_trace;}
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT){this->m_orig_glGetMultiTexLevelParameterfvEXT = this->m_ptr_glGetMultiTexLevelParameterfvEXT;this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetMultiTexLevelParameterfvEXT_trace;}
+if(this->m_ptr_glFinalCombinerInputNV){this->m_orig_glFinalCombinerInputNV = this->m_ptr_glFinalCombinerInputNV;this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&TraceTableDecorator::m_glFinalCombinerInputNV_trace;}
+if(this->m_ptr_glCullParameterdvEXT){this->m_orig_glCullParameterdvEXT = this->m_ptr_glCullParameterdvEXT;this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&TraceTableDecorator::m_glCullParameterdvEXT_trace;}
+if(this->m_ptr_glMultiTexCoord4s){this->m_orig_glMultiTexCoord4s = this->m_ptr_glMultiTexCoord4s;this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&TraceTableDecorator::m_glMultiTexCoord4s_trace;}
+if(this->m_ptr_glMapVertexAttrib1fAPPLE){this->m_orig_glMapVertexAttrib1fAPPLE = this->m_ptr_glMapVertexAttrib1fAPPLE;this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&TraceTableDecorator::m_glMapVertexAttrib1fAPPLE_trace;}
+if(this->m_ptr_glConvolutionParameterfEXT){this->m_orig_glConvolutionParameterfEXT = this->m_ptr_glConvolutionParameterfEXT;this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&TraceTableDecorator::m_glConvolutionParameterfEXT_trace;}
+if(this->m_ptr_glTexCoord1iv){this->m_orig_glTexCoord1iv = this->m_ptr_glTexCoord1iv;this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&TraceTableDecorator::m_glTexCoord1iv_trace;}
+if(this->m_ptr_glProgramUniform3fvEXT){this->m_orig_glProgramUniform3fvEXT = this->m_ptr_glProgramUniform3fvEXT;this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&TraceTableDecorator::m_glProgramUniform3fvEXT_trace;}
+if(this->m_ptr_glColor3uiv){this->m_orig_glColor3uiv = this->m_ptr_glColor3uiv;this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&TraceTableDecorator::m_glColor3uiv_trace;}
+if(this->m_ptr_glRenderGpuMaskNV){this->m_orig_glRenderGpuMaskNV = this->m_ptr_glRenderGpuMaskNV;this->m_ptr_glRenderGpuMaskNV = (FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC)&TraceTableDecorator::m_glRenderGpuMaskNV_trace;}
+if(this->m_ptr_glListBase){this->m_orig_glListBase = this->m_ptr_glListBase;this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&TraceTableDecorator::m_glListBase_trace;}
+if(this->m_ptr_glTexCoord2bOES){this->m_orig_glTexCoord2bOES = this->m_ptr_glTexCoord2bOES;this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&TraceTableDecorator::m_glTexCoord2bOES_trace;}
+if(this->m_ptr_glBindMaterialParameterEXT){this->m_orig_glBindMaterialParameterEXT = this->m_ptr_glBindMaterialParameterEXT;this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&TraceTableDecorator::m_glBindMaterialParameterEXT_trace;}
+if(this->m_ptr_glGlobalAlphaFactorubSUN){this->m_orig_glGlobalAlphaFactorubSUN = this->m_ptr_glGlobalAlphaFactorubSUN;this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactorubSUN_trace;}
+if(this->m_ptr_glVertexAttribL1ui64NV){this->m_orig_glVertexAttribL1ui64NV = this->m_ptr_glVertexAttribL1ui64NV;this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&TraceTableDecorator::m_glVertexAttribL1ui64NV_trace;}
+if(this->m_ptr_glPointParameterfSGIS){this->m_orig_glPointParameterfSGIS = this->m_ptr_glPointParameterfSGIS;this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&TraceTableDecorator::m_glPointParameterfSGIS_trace;}
+if(this->m_ptr_glGetImageTransformParameterivHP){this->m_orig_glGetImageTransformParameterivHP = this->m_ptr_glGetImageTransformParameterivHP;this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&TraceTableDecorator::m_glGetImageTransformParameterivHP_trace;}
+if(this->m_ptr_glColorSubTableEXT){this->m_orig_glColorSubTableEXT = this->m_ptr_glColorSubTableEXT;this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&TraceTableDecorator::m_glColorSubTableEXT_trace;}
+if(this->m_ptr_glPixelTexGenParameterfvSGIS){this->m_orig_glPixelTexGenParameterfvSGIS = this->m_ptr_glPixelTexGenParameterfvSGIS;this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&TraceTableDecorator::m_glPixelTexGenParameterfvSGIS_trace;}
+if(this->m_ptr_glClientWaitSync){this->m_orig_glClientWaitSync = this->m_ptr_glClientWaitSync;this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&TraceTableDecorator::m_glClientWaitSync_trace;}
+if(this->m_ptr_glQueryObjectParameteruiAMD){this->m_orig_glQueryObjectParameteruiAMD = this->m_ptr_glQueryObjectParameteruiAMD;this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&TraceTableDecorator::m_glQueryObjectParameteruiAMD_trace;}
+if(this->m_ptr_glVertexAttribs1fvNV){this->m_orig_glVertexAttribs1fvNV = this->m_ptr_glVertexAttribs1fvNV;this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&TraceTableDecorator::m_glVertexAttribs1fvNV_trace;}
+if(this->m_ptr_glVertexAttrib4NusvARB){this->m_orig_glVertexAttrib4NusvARB = this->m_ptr_glVertexAttrib4NusvARB;this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&TraceTableDecorator::m_glVertexAttrib4NusvARB_trace;}
+if(this->m_ptr_glVariantPointerEXT){this->m_orig_glVariantPointerEXT = this->m_ptr_glVariantPointerEXT;this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&TraceTableDecorator::m_glVariantPointerEXT_trace;}
+if(this->m_ptr_glTextureBuffer){this->m_orig_glTextureBuffer = this->m_ptr_glTextureBuffer;this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&TraceTableDecorator::m_glTextureBuffer_trace;}
+if(this->m_ptr_glVertexAttribI1uiEXT){this->m_orig_glVertexAttribI1uiEXT = this->m_ptr_glVertexAttribI1uiEXT;this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&TraceTableDecorator::m_glVertexAttribI1uiEXT_trace;}
+if(this->m_ptr_glInvalidateTexImage){this->m_orig_glInvalidateTexImage = this->m_ptr_glInvalidateTexImage;this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&TraceTableDecorator::m_glInvalidateTexImage_trace;}
+if(this->m_ptr_glProgramEnvParametersI4ivNV){this->m_orig_glProgramEnvParametersI4ivNV = this->m_ptr_glProgramEnvParametersI4ivNV;this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&TraceTableDecorator::m_glProgramEnvParametersI4ivNV_trace;}
+if(this->m_ptr_glPathGlyphIndexArrayNV){this->m_orig_glPathGlyphIndexArrayNV = this->m_ptr_glPathGlyphIndexArrayNV;this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&TraceTableDecorator::m_glPathGlyphIndexArrayNV_trace;}
+if(this->m_ptr_glCopyImageSubData){this->m_orig_glCopyImageSubData = this->m_ptr_glCopyImageSubData;this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&TraceTableDecorator::m_glCopyImageSubData_trace;}
+if(this->m_ptr_glGetUniformSubroutineuiv){this->m_orig_glGetUniformSubroutineuiv = this->m_ptr_glGetUniformSubroutineuiv;this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&TraceTableDecorator::m_glGetUniformSubroutineuiv_trace;}
+if(this->m_ptr_glBindVertexBuffer){this->m_orig_glBindVertexBuffer = this->m_ptr_glBindVertexBuffer;this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&TraceTableDecorator::m_glBindVertexBuffer_trace;}
+if(this->m_ptr_glMultiTexCoord1iARB){this->m_orig_glMultiTexCoord1iARB = this->m_ptr_glMultiTexCoord1iARB;this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&TraceTableDecorator::m_glMultiTexCoord1iARB_trace;}
+if(this->m_ptr_glDebugMessageInsert){this->m_orig_glDebugMessageInsert = this->m_ptr_glDebugMessageInsert;this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&TraceTableDecorator::m_glDebugMessageInsert_trace;}
+if(this->m_ptr_glBeginVertexShaderEXT){this->m_orig_glBeginVertexShaderEXT = this->m_ptr_glBeginVertexShaderEXT;this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&TraceTableDecorator::m_glBeginVertexShaderEXT_trace;}
+if(this->m_ptr_glIsVariantEnabledEXT){this->m_orig_glIsVariantEnabledEXT = this->m_ptr_glIsVariantEnabledEXT;this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&TraceTableDecorator::m_glIsVariantEnabledEXT_trace;}
+if(this->m_ptr_glPassThroughxOES){this->m_orig_glPassThroughxOES = this->m_ptr_glPassThroughxOES;this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&TraceTableDecorator::m_glPassThroughxOES_trace;}
+if(this->m_ptr_glIsSampler){this->m_orig_glIsSampler = this->m_ptr_glIsSampler;this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&TraceTableDecorator::m_glIsSampler_trace;}
+if(this->m_ptr_glConservativeRasterParameterfNV){this->m_orig_glConservativeRasterParameterfNV = this->m_ptr_glConservativeRasterParameterfNV;this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&TraceTableDecorator::m_glConservativeRasterParameterfNV_trace;}
+if(this->m_ptr_glMultiTexGenivEXT){this->m_orig_glMultiTexGenivEXT = this->m_ptr_glMultiTexGenivEXT;this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&TraceTableDecorator::m_glMultiTexGenivEXT_trace;}
+if(this->m_ptr_glNamedFramebufferTexture2DEXT){this->m_orig_glNamedFramebufferTexture2DEXT = this->m_ptr_glNamedFramebufferTexture2DEXT;this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&TraceTableDecorator::m_glNamedFramebufferTexture2DEXT_trace;}
+if(this->m_ptr_glCopyTexSubImage1D){this->m_orig_glCopyTexSubImage1D = this->m_ptr_glCopyTexSubImage1D;this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&TraceTableDecorator::m_glCopyTexSubImage1D_trace;}
+if(this->m_ptr_glTexCoord1i){this->m_orig_glTexCoord1i = this->m_ptr_glTexCoord1i;this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&TraceTableDecorator::m_glTexCoord1i_trace;}
+if(this->m_ptr_glCheckFramebufferStatus){this->m_orig_glCheckFramebufferStatus = this->m_ptr_glCheckFramebufferStatus;this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&TraceTableDecorator::m_glCheckFramebufferStatus_trace;}
+if(this->m_ptr_glDrawElementArrayAPPLE){this->m_orig_glDrawElementArrayAPPLE = this->m_ptr_glDrawElementArrayAPPLE;this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&TraceTableDecorator::m_glDrawElementArrayAPPLE_trace;}
+if(this->m_ptr_glTexCoord1d){this->m_orig_glTexCoord1d = this->m_ptr_glTexCoord1d;this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&TraceTableDecorator::m_glTexCoord1d_trace;}
+if(this->m_ptr_glTexCoord1f){this->m_orig_glTexCoord1f = this->m_ptr_glTexCoord1f;this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&TraceTableDecorator::m_glTexCoord1f_trace;}
+if(this->m_ptr_glFragmentLightivSGIX){this->m_orig_glFragmentLightivSGIX = this->m_ptr_glFragmentLightivSGIX;this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&TraceTableDecorator::m_glFragmentLightivSGIX_trace;}
+if(this->m_ptr_glBindImageTexture){this->m_orig_glBindImageTexture = this->m_ptr_glBindImageTexture;this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&TraceTableDecorator::m_glBindImageTexture_trace;}
+if(this->m_ptr_glTransformFeedbackVaryings){this->m_orig_glTransformFeedbackVaryings = this->m_ptr_glTransformFeedbackVaryings;this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&TraceTableDecorator::m_glTransformFeedbackVaryings_trace;}
+if(this->m_ptr_glMulticastBufferSubDataNV){this->m_orig_glMulticastBufferSubDataNV = this->m_ptr_glMulticastBufferSubDataNV;this->m_ptr_glMulticastBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC)&TraceTableDecorator::m_glMulticastBufferSubDataNV_trace;}
+if(this->m_ptr_glDrawRangeElements){this->m_orig_glDrawRangeElements = this->m_ptr_glDrawRangeElements;this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&TraceTableDecorator::m_glDrawRangeElements_trace;}
+if(this->m_ptr_glTexCoord1s){this->m_orig_glTexCoord1s = this->m_ptr_glTexCoord1s;this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&TraceTableDecorator::m_glTexCoord1s_trace;}
+if(this->m_ptr_glBindBufferBase){this->m_orig_glBindBufferBase = this->m_ptr_glBindBufferBase;this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&TraceTableDecorator::m_glBindBufferBase_trace;}
+if(this->m_ptr_glColor3bv){this->m_orig_glColor3bv = this->m_ptr_glColor3bv;this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&TraceTableDecorator::m_glColor3bv_trace;}
+if(this->m_ptr_glSyncTextureINTEL){this->m_orig_glSyncTextureINTEL = this->m_ptr_glSyncTextureINTEL;this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&TraceTableDecorator::m_glSyncTextureINTEL_trace;}
+if(this->m_ptr_glCreateSamplers){this->m_orig_glCreateSamplers = this->m_ptr_glCreateSamplers;this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&TraceTableDecorator::m_glCreateSamplers_trace;}
+if(this->m_ptr_glCombinerParameterfNV){this->m_orig_glCombinerParameterfNV = this->m_ptr_glCombinerParameterfNV;this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&TraceTableDecorator::m_glCombinerParameterfNV_trace;}
+if(this->m_ptr_glGetArrayObjectivATI){this->m_orig_glGetArrayObjectivATI = this->m_ptr_glGetArrayObjectivATI;this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&TraceTableDecorator::m_glGetArrayObjectivATI_trace;}
+if(this->m_ptr_glMultiDrawArrays){this->m_orig_glMultiDrawArrays = this->m_ptr_glMultiDrawArrays;this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&TraceTableDecorator::m_glMultiDrawArrays_trace;}
+if(this->m_ptr_glSampleMapATI){this->m_orig_glSampleMapATI = this->m_ptr_glSampleMapATI;this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&TraceTableDecorator::m_glSampleMapATI_trace;}
+if(this->m_ptr_glProgramUniform2i64ARB){this->m_orig_glProgramUniform2i64ARB = this->m_ptr_glProgramUniform2i64ARB;this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&TraceTableDecorator::m_glProgramUniform2i64ARB_trace;}
+if(this->m_ptr_glBinormal3ivEXT){this->m_orig_glBinormal3ivEXT = this->m_ptr_glBinormal3ivEXT;this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&TraceTableDecorator::m_glBinormal3ivEXT_trace;}
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB){this->m_orig_glMultiDrawArraysIndirectCountARB = this->m_ptr_glMultiDrawArraysIndirectCountARB;this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&TraceTableDecorator::m_glMultiDrawArraysIndirectCountARB_trace;}
+if(this->m_ptr_glTextureStorageMem1DEXT){this->m_orig_glTextureStorageMem1DEXT = this->m_ptr_glTextureStorageMem1DEXT;this->m_ptr_glTextureStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC)&TraceTableDecorator::m_glTextureStorageMem1DEXT_trace;}
+if(this->m_ptr_glWindowPos2ivMESA){this->m_orig_glWindowPos2ivMESA = this->m_ptr_glWindowPos2ivMESA;this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&TraceTableDecorator::m_glWindowPos2ivMESA_trace;}
+if(this->m_ptr_glTexCoordP4ui){this->m_orig_glTexCoordP4ui = this->m_ptr_glTexCoordP4ui;this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&TraceTableDecorator::m_glTexCoordP4ui_trace;}
+if(this->m_ptr_glMultiTexSubImage1DEXT){this->m_orig_glMultiTexSubImage1DEXT = this->m_ptr_glMultiTexSubImage1DEXT;this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glMultiTexSubImage1DEXT_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT){this->m_orig_glProgramUniformMatrix2x3fvEXT = this->m_ptr_glProgramUniformMatrix2x3fvEXT;this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x3fvEXT_trace;}
+if(this->m_ptr_glBufferDataARB){this->m_orig_glBufferDataARB = this->m_ptr_glBufferDataARB;this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&TraceTableDecorator::m_glBufferDataARB_trace;}
+if(this->m_ptr_glVertexAttribIFormat){this->m_orig_glVertexAttribIFormat = this->m_ptr_glVertexAttribIFormat;this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&TraceTableDecorator::m_glVertexAttribIFormat_trace;}
+if(this->m_ptr_glCreateFramebuffers){this->m_orig_glCreateFramebuffers = this->m_ptr_glCreateFramebuffers;this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&TraceTableDecorator::m_glCreateFramebuffers_trace;}
+if(this->m_ptr_glNormalStream3dvATI){this->m_orig_glNormalStream3dvATI = this->m_ptr_glNormalStream3dvATI;this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&TraceTableDecorator::m_glNormalStream3dvATI_trace;}
+if(this->m_ptr_glClearAccum){this->m_orig_glClearAccum = this->m_ptr_glClearAccum;this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&TraceTableDecorator::m_glClearAccum_trace;}
+if(this->m_ptr_glUniform3i64vNV){this->m_orig_glUniform3i64vNV = this->m_ptr_glUniform3i64vNV;this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&TraceTableDecorator::m_glUniform3i64vNV_trace;}
+if(this->m_ptr_glNormal3fVertex3fSUN){this->m_orig_glNormal3fVertex3fSUN = this->m_ptr_glNormal3fVertex3fSUN;this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glUniform2uivEXT){this->m_orig_glUniform2uivEXT = this->m_ptr_glUniform2uivEXT;this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&TraceTableDecorator::m_glUniform2uivEXT_trace;}
+if(this->m_ptr_glBeginQuery){this->m_orig_glBeginQuery = this->m_ptr_glBeginQuery;this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&TraceTableDecorator::m_glBeginQuery_trace;}
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV){this->m_orig_glStencilThenCoverStrokePathInstancedNV = this->m_ptr_glStencilThenCoverStrokePathInstancedNV;this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&TraceTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_trace;}
+if(this->m_ptr_glBindBuffer){this->m_orig_glBindBuffer = this->m_ptr_glBindBuffer;this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&TraceTableDecorator::m_glBindBuffer_trace;}
+if(this->m_ptr_glMap2d){this->m_orig_glMap2d = this->m_ptr_glMap2d;this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&TraceTableDecorator::m_glMap2d_trace;}
+if(this->m_ptr_glMap2f){this->m_orig_glMap2f = this->m_ptr_glMap2f;this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&TraceTableDecorator::m_glMap2f_trace;}
+if(this->m_ptr_glMakeImageHandleResidentNV){this->m_orig_glMakeImageHandleResidentNV = this->m_ptr_glMakeImageHandleResidentNV;this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&TraceTableDecorator::m_glMakeImageHandleResidentNV_trace;}
+if(this->m_ptr_glUniformMatrix2x4fv){this->m_orig_glUniformMatrix2x4fv = this->m_ptr_glUniformMatrix2x4fv;this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&TraceTableDecorator::m_glUniformMatrix2x4fv_trace;}
+if(this->m_ptr_glGetMultiTexParameterfvEXT){this->m_orig_glGetMultiTexParameterfvEXT = this->m_ptr_glGetMultiTexParameterfvEXT;this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetMultiTexParameterfvEXT_trace;}
+if(this->m_ptr_glDepthRangeIndexed){this->m_orig_glDepthRangeIndexed = this->m_ptr_glDepthRangeIndexed;this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&TraceTableDecorator::m_glDepthRangeIndexed_trace;}
+if(this->m_ptr_glIsEnabled){this->m_orig_glIsEnabled = this->m_ptr_glIsEnabled;this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&TraceTableDecorator::m_glIsEnabled_trace;}
+if(this->m_ptr_glMatrixScalefEXT){this->m_orig_glMatrixScalefEXT = this->m_ptr_glMatrixScalefEXT;this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&TraceTableDecorator::m_glMatrixScalefEXT_trace;}
+if(this->m_ptr_glGetError){this->m_orig_glGetError = this->m_ptr_glGetError;this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&TraceTableDecorator::m_glGetError_trace;}
+if(this->m_ptr_glGetTexEnviv){this->m_orig_glGetTexEnviv = this->m_ptr_glGetTexEnviv;this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&TraceTableDecorator::m_glGetTexEnviv_trace;}
+if(this->m_ptr_glBindTextureUnitParameterEXT){this->m_orig_glBindTextureUnitParameterEXT = this->m_ptr_glBindTextureUnitParameterEXT;this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&TraceTableDecorator::m_glBindTextureUnitParameterEXT_trace;}
+if(this->m_ptr_glGetnUniformfvARB){this->m_orig_glGetnUniformfvARB = this->m_ptr_glGetnUniformfvARB;this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&TraceTableDecorator::m_glGetnUniformfvARB_trace;}
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glDeletePerfQueryINTEL){this->m_orig_glDeletePerfQueryINTEL = this->m_ptr_glDeletePerfQueryINTEL;this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&TraceTableDecorator::m_glDeletePerfQueryINTEL_trace;}
+if(this->m_ptr_glActiveVaryingNV){this->m_orig_glActiveVaryingNV = this->m_ptr_glActiveVaryingNV;this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&TraceTableDecorator::m_glActiveVaryingNV_trace;}
+if(this->m_ptr_glGetActiveUniformARB){this->m_orig_glGetActiveUniformARB = this->m_ptr_glGetActiveUniformARB;this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&TraceTableDecorator::m_glGetActiveUniformARB_trace;}
+if(this->m_ptr_glVertexAttribI3ivEXT){this->m_orig_glVertexAttribI3ivEXT = this->m_ptr_glVertexAttribI3ivEXT;this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&TraceTableDecorator::m_glVertexAttribI3ivEXT_trace;}
+if(this->m_ptr_glEvalCoord1d){this->m_orig_glEvalCoord1d = this->m_ptr_glEvalCoord1d;this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&TraceTableDecorator::m_glEvalCoord1d_trace;}
+if(this->m_ptr_glNamedCopyBufferSubDataEXT){this->m_orig_glNamedCopyBufferSubDataEXT = this->m_ptr_glNamedCopyBufferSubDataEXT;this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&TraceTableDecorator::m_glNamedCopyBufferSubDataEXT_trace;}
+if(this->m_ptr_glEvalCoord1f){this->m_orig_glEvalCoord1f = this->m_ptr_glEvalCoord1f;this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&TraceTableDecorator::m_glEvalCoord1f_trace;}
+if(this->m_ptr_glPixelMapfv){this->m_orig_glPixelMapfv = this->m_ptr_glPixelMapfv;this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&TraceTableDecorator::m_glPixelMapfv_trace;}
+if(this->m_ptr_glVertexAttribI1ivEXT){this->m_orig_glVertexAttribI1ivEXT = this->m_ptr_glVertexAttribI1ivEXT;this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&TraceTableDecorator::m_glVertexAttribI1ivEXT_trace;}
+if(this->m_ptr_glCreateSyncFromCLeventARB){this->m_orig_glCreateSyncFromCLeventARB = this->m_ptr_glCreateSyncFromCLeventARB;this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&TraceTableDecorator::m_glCreateSyncFromCLeventARB_trace;}
+if(this->m_ptr_glGetPixelMapusv){this->m_orig_glGetPixelMapusv = this->m_ptr_glGetPixelMapusv;this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&TraceTableDecorator::m_glGetPixelMapusv_trace;}
+if(this->m_ptr_glGetnColorTableARB){this->m_orig_glGetnColorTableARB = this->m_ptr_glGetnColorTableARB;this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&TraceTableDecorator::m_glGetnColorTableARB_trace;}
+if(this->m_ptr_glAccum){this->m_orig_glAccum = this->m_ptr_glAccum;this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&TraceTableDecorator::m_glAccum_trace;}
+if(this->m_ptr_glRasterPos3sv){this->m_orig_glRasterPos3sv = this->m_ptr_glRasterPos3sv;this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&TraceTableDecorator::m_glRasterPos3sv_trace;}
+if(this->m_ptr_glTexCoord2iv){this->m_orig_glTexCoord2iv = this->m_ptr_glTexCoord2iv;this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&TraceTableDecorator::m_glTexCoord2iv_trace;}
+if(this->m_ptr_glBlendFunciARB){this->m_orig_glBlendFunciARB = this->m_ptr_glBlendFunciARB;this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&TraceTableDecorator::m_glBlendFunciARB_trace;}
+if(this->m_ptr_glProgramUniform3i64vARB){this->m_orig_glProgramUniform3i64vARB = this->m_ptr_glProgramUniform3i64vARB;this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&TraceTableDecorator::m_glProgramUniform3i64vARB_trace;}
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv){this->m_orig_glGetFramebufferAttachmentParameteriv = this->m_ptr_glGetFramebufferAttachmentParameteriv;this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&TraceTableDecorator::m_glGetFramebufferAttachmentParameteriv_trace;}
+if(this->m_ptr_glProgramUniform4ui){this->m_orig_glProgramUniform4ui = this->m_ptr_glProgramUniform4ui;this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&TraceTableDecorator::m_glProgramUniform4ui_trace;}
+if(this->m_ptr_glStencilMask){this->m_orig_glStencilMask = this->m_ptr_glStencilMask;this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&TraceTableDecorator::m_glStencilMask_trace;}
+if(this->m_ptr_glResetHistogramEXT){this->m_orig_glResetHistogramEXT = this->m_ptr_glResetHistogramEXT;this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&TraceTableDecorator::m_glResetHistogramEXT_trace;}
+if(this->m_ptr_glLightxOES){this->m_orig_glLightxOES = this->m_ptr_glLightxOES;this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&TraceTableDecorator::m_glLightxOES_trace;}
+if(this->m_ptr_glNamedBufferData){this->m_orig_glNamedBufferData = this->m_ptr_glNamedBufferData;this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&TraceTableDecorator::m_glNamedBufferData_trace;}
+if(this->m_ptr_glVertexStream3sATI){this->m_orig_glVertexStream3sATI = this->m_ptr_glVertexStream3sATI;this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&TraceTableDecorator::m_glVertexStream3sATI_trace;}
+if(this->m_ptr_glVertexAttrib3fvARB){this->m_orig_glVertexAttrib3fvARB = this->m_ptr_glVertexAttrib3fvARB;this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&TraceTableDecorator::m_glVertexAttrib3fvARB_trace;}
+if(this->m_ptr_glClearNamedBufferSubData){this->m_orig_glClearNamedBufferSubData = this->m_ptr_glClearNamedBufferSubData;this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&TraceTableDecorator::m_glClearNamedBufferSubData_trace;}
+if(this->m_ptr_glProgramUniformHandleui64ARB){this->m_orig_glProgramUniformHandleui64ARB = this->m_ptr_glProgramUniformHandleui64ARB;this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&TraceTableDecorator::m_glProgramUniformHandleui64ARB_trace;}
+if(this->m_ptr_glUniform3iARB){this->m_orig_glUniform3iARB = this->m_ptr_glUniform3iARB;this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&TraceTableDecorator::m_glUniform3iARB_trace;}
+if(this->m_ptr_glCreateProgramObjectARB){this->m_orig_glCreateProgramObjectARB = this->m_ptr_glCreateProgramObjectARB;this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&TraceTableDecorator::m_glCreateProgramObjectARB_trace;}
+if(this->m_ptr_glMultiTexCoord1dvARB){this->m_orig_glMultiTexCoord1dvARB = this->m_ptr_glMultiTexCoord1dvARB;this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&TraceTableDecorator::m_glMultiTexCoord1dvARB_trace;}
+if(this->m_ptr_glGetObjectParameterfvARB){this->m_orig_glGetObjectParameterfvARB = this->m_ptr_glGetObjectParameterfvARB;this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&TraceTableDecorator::m_glGetObjectParameterfvARB_trace;}
+if(this->m_ptr_glRectsv){this->m_orig_glRectsv = this->m_ptr_glRectsv;this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&TraceTableDecorator::m_glRectsv_trace;}
+if(this->m_ptr_glMultiTexImage2DEXT){this->m_orig_glMultiTexImage2DEXT = this->m_ptr_glMultiTexImage2DEXT;this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&TraceTableDecorator::m_glMultiTexImage2DEXT_trace;}
+if(this->m_ptr_glProgramUniform1i64NV){this->m_orig_glProgramUniform1i64NV = this->m_ptr_glProgramUniform1i64NV;this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&TraceTableDecorator::m_glProgramUniform1i64NV_trace;}
+if(this->m_ptr_glGetObjectBufferivATI){this->m_orig_glGetObjectBufferivATI = this->m_ptr_glGetObjectBufferivATI;this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&TraceTableDecorator::m_glGetObjectBufferivATI_trace;}
+if(this->m_ptr_glUniform4i64ARB){this->m_orig_glUniform4i64ARB = this->m_ptr_glUniform4i64ARB;this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&TraceTableDecorator::m_glUniform4i64ARB_trace;}
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN){this->m_orig_glReplacementCodeuiColor4ubVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_trace;}
+if(this->m_ptr_glBlendFuncSeparateINGR){this->m_orig_glBlendFuncSeparateINGR = this->m_ptr_glBlendFuncSeparateINGR;this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&TraceTableDecorator::m_glBlendFuncSeparateINGR_trace;}
+if(this->m_ptr_glGetVideoCaptureStreamfvNV){this->m_orig_glGetVideoCaptureStreamfvNV = this->m_ptr_glGetVideoCaptureStreamfvNV;this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&TraceTableDecorator::m_glGetVideoCaptureStreamfvNV_trace;}
+if(this->m_ptr_glVertexAttrib2fARB){this->m_orig_glVertexAttrib2fARB = this->m_ptr_glVertexAttrib2fARB;this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&TraceTableDecorator::m_glVertexAttrib2fARB_trace;}
+if(this->m_ptr_glGetTexGeniv){this->m_orig_glGetTexGeniv = this->m_ptr_glGetTexGeniv;this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&TraceTableDecorator::m_glGetTexGeniv_trace;}
+if(this->m_ptr_glPixelStorei){this->m_orig_glPixelStorei = this->m_ptr_glPixelStorei;this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&TraceTableDecorator::m_glPixelStorei_trace;}
+if(this->m_ptr_glGetCompressedTextureSubImage){this->m_orig_glGetCompressedTextureSubImage = this->m_ptr_glGetCompressedTextureSubImage;this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&TraceTableDecorator::m_glGetCompressedTextureSubImage_trace;}
+if(this->m_ptr_glCopyImageSubDataNV){this->m_orig_glCopyImageSubDataNV = this->m_ptr_glCopyImageSubDataNV;this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&TraceTableDecorator::m_glCopyImageSubDataNV_trace;}
+if(this->m_ptr_glActiveShaderProgram){this->m_orig_glActiveShaderProgram = this->m_ptr_glActiveShaderProgram;this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&TraceTableDecorator::m_glActiveShaderProgram_trace;}
+if(this->m_ptr_glVertexStream1iATI){this->m_orig_glVertexStream1iATI = this->m_ptr_glVertexStream1iATI;this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&TraceTableDecorator::m_glVertexStream1iATI_trace;}
+if(this->m_ptr_glPatchParameterfv){this->m_orig_glPatchParameterfv = this->m_ptr_glPatchParameterfv;this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&TraceTableDecorator::m_glPatchParameterfv_trace;}
+if(this->m_ptr_glIsFramebufferEXT){this->m_orig_glIsFramebufferEXT = this->m_ptr_glIsFramebufferEXT;this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&TraceTableDecorator::m_glIsFramebufferEXT_trace;}
+if(this->m_ptr_glTextureStorage2D){this->m_orig_glTextureStorage2D = this->m_ptr_glTextureStorage2D;this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&TraceTableDecorator::m_glTextureStorage2D_trace;}
+if(this->m_ptr_glProgramUniform1ui64ARB){this->m_orig_glProgramUniform1ui64ARB = this->m_ptr_glProgramUniform1ui64ARB;this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&TraceTableDecorator::m_glProgramUniform1ui64ARB_trace;}
+if(this->m_ptr_glTexBufferRange){this->m_orig_glTexBufferRange = this->m_ptr_glTexBufferRange;this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&TraceTableDecorator::m_glTexBufferRange_trace;}
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS){this->m_orig_glGetPixelTexGenParameterivSGIS = this->m_ptr_glGetPixelTexGenParameterivSGIS;this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&TraceTableDecorator::m_glGetPixelTexGenParameterivSGIS_trace;}
+if(this->m_ptr_glTextureSubImage3DEXT){this->m_orig_glTextureSubImage3DEXT = this->m_ptr_glTextureSubImage3DEXT;this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glTextureSubImage3DEXT_trace;}
+if(this->m_ptr_glClipControl){this->m_orig_glClipControl = this->m_ptr_glClipControl;this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&TraceTableDecorator::m_glClipControl_trace;}
+if(this->m_ptr_glGetProgramResourceiv){this->m_orig_glGetProgramResourceiv = this->m_ptr_glGetProgramResourceiv;this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&TraceTableDecorator::m_glGetProgramResourceiv_trace;}
+if(this->m_ptr_glMultiTexCoordP2uiv){this->m_orig_glMultiTexCoordP2uiv = this->m_ptr_glMultiTexCoordP2uiv;this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&TraceTableDecorator::m_glMultiTexCoordP2uiv_trace;}
+if(this->m_ptr_glVertexAttribI3ui){this->m_orig_glVertexAttribI3ui = this->m_ptr_glVertexAttribI3ui;this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&TraceTableDecorator::m_glVertexAttribI3ui_trace;}
+if(this->m_ptr_glSampleMaskSGIS){this->m_orig_glSampleMaskSGIS = this->m_ptr_glSampleMaskSGIS;this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&TraceTableDecorator::m_glSampleMaskSGIS_trace;}
+if(this->m_ptr_glVertexAttrib4NivARB){this->m_orig_glVertexAttrib4NivARB = this->m_ptr_glVertexAttrib4NivARB;this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&TraceTableDecorator::m_glVertexAttrib4NivARB_trace;}
+if(this->m_ptr_glGlobalAlphaFactorfSUN){this->m_orig_glGlobalAlphaFactorfSUN = this->m_ptr_glGlobalAlphaFactorfSUN;this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactorfSUN_trace;}
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD){this->m_orig_glBlendEquationSeparateIndexedAMD = this->m_ptr_glBlendEquationSeparateIndexedAMD;this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&TraceTableDecorator::m_glBlendEquationSeparateIndexedAMD_trace;}
+if(this->m_ptr_glGetPerfCounterInfoINTEL){this->m_orig_glGetPerfCounterInfoINTEL = this->m_ptr_glGetPerfCounterInfoINTEL;this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&TraceTableDecorator::m_glGetPerfCounterInfoINTEL_trace;}
+if(this->m_ptr_glDeleteProgramsNV){this->m_orig_glDeleteProgramsNV = this->m_ptr_glDeleteProgramsNV;this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&TraceTableDecorator::m_glDeleteProgramsNV_trace;}
+if(this->m_ptr_glPixelZoomxOES){this->m_orig_glPixelZoomxOES = this->m_ptr_glPixelZoomxOES;this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&TraceTableDecorator::m_glPixelZoomxOES_trace;}
+if(this->m_ptr_glGetCombinerOutputParameterivNV){this->m_orig_glGetCombinerOutputParameterivNV = this->m_ptr_glGetCombinerOutputParameterivNV;this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&TraceTableDecorator::m_glGetCombinerOutputParameterivNV_trace;}
+if(this->m_ptr_glRasterPos2xvOES){this->m_orig_glRasterPos2xvOES = this->m_ptr_glRasterPos2xvOES;this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&TraceTableDecorator::m_glRasterPos2xvOES_trace;}
+if(this->m_ptr_glGetTexImage){this->m_orig_glGetTexImage = this->m_ptr_glGetTexImage;this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&TraceTableDecorator::m_glGetTexImage_trace;}
+if(this->m_ptr_glVertexArrayVertexBuffers){this->m_orig_glVertexArrayVertexBuffers = this->m_ptr_glVertexArrayVertexBuffers;this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&TraceTableDecorator::m_glVertexArrayVertexBuffers_trace;}
+if(this->m_ptr_glUniform1ui64NV){this->m_orig_glUniform1ui64NV = this->m_ptr_glUniform1ui64NV;this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&TraceTableDecorator::m_glUniform1ui64NV_trace;}
+if(this->m_ptr_glProgramParameteri){this->m_orig_glProgramParameteri = this->m_ptr_glProgramParameteri;this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&TraceTableDecorator::m_glProgramParameteri_trace;}
+if(this->m_ptr_glNormal3xOES){this->m_orig_glNormal3xOES = this->m_ptr_glNormal3xOES;this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&TraceTableDecorator::m_glNormal3xOES_trace;}
+if(this->m_ptr_glGetMapfv){this->m_orig_glGetMapfv = this->m_ptr_glGetMapfv;this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&TraceTableDecorator::m_glGetMapfv_trace;}
+if(this->m_ptr_glVertexStream2dvATI){this->m_orig_glVertexStream2dvATI = this->m_ptr_glVertexStream2dvATI;this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&TraceTableDecorator::m_glVertexStream2dvATI_trace;}
+if(this->m_ptr_glPathStencilDepthOffsetNV){this->m_orig_glPathStencilDepthOffsetNV = this->m_ptr_glPathStencilDepthOffsetNV;this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&TraceTableDecorator::m_glPathStencilDepthOffsetNV_trace;}
+if(this->m_ptr_glIsStateNV){this->m_orig_glIsStateNV = this->m_ptr_glIsStateNV;this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&TraceTableDecorator::m_glIsStateNV_trace;}
+if(this->m_ptr_glGetIntegerui64vNV){this->m_orig_glGetIntegerui64vNV = this->m_ptr_glGetIntegerui64vNV;this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&TraceTableDecorator::m_glGetIntegerui64vNV_trace;}
+if(this->m_ptr_glGetImageTransformParameterfvHP){this->m_orig_glGetImageTransformParameterfvHP = this->m_ptr_glGetImageTransformParameterfvHP;this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&TraceTableDecorator::m_glGetImageTransformParameterfvHP_trace;}
+if(this->m_ptr_glRasterPos2fv){this->m_orig_glRasterPos2fv = this->m_ptr_glRasterPos2fv;this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&TraceTableDecorator::m_glRasterPos2fv_trace;}
+if(this->m_ptr_glVertex3xOES){this->m_orig_glVertex3xOES = this->m_ptr_glVertex3xOES;this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&TraceTableDecorator::m_glVertex3xOES_trace;}
+if(this->m_ptr_glIsMemoryObjectEXT){this->m_orig_glIsMemoryObjectEXT = this->m_ptr_glIsMemoryObjectEXT;this->m_ptr_glIsMemoryObjectEXT = (FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC)&TraceTableDecorator::m_glIsMemoryObjectEXT_trace;}
+if(this->m_ptr_glWeightPointerARB){this->m_orig_glWeightPointerARB = this->m_ptr_glWeightPointerARB;this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&TraceTableDecorator::m_glWeightPointerARB_trace;}
+if(this->m_ptr_glFinishFenceNV){this->m_orig_glFinishFenceNV = this->m_ptr_glFinishFenceNV;this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&TraceTableDecorator::m_glFinishFenceNV_trace;}
+if(this->m_ptr_glDepthRangexOES){this->m_orig_glDepthRangexOES = this->m_ptr_glDepthRangexOES;this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&TraceTableDecorator::m_glDepthRangexOES_trace;}
+if(this->m_ptr_glEnableVertexArrayAttribEXT){this->m_orig_glEnableVertexArrayAttribEXT = this->m_ptr_glEnableVertexArrayAttribEXT;this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&TraceTableDecorator::m_glEnableVertexArrayAttribEXT_trace;}
+if(this->m_ptr_glProgramUniform2uivEXT){this->m_orig_glProgramUniform2uivEXT = this->m_ptr_glProgramUniform2uivEXT;this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&TraceTableDecorator::m_glProgramUniform2uivEXT_trace;}
+if(this->m_ptr_glGetDoubleIndexedvEXT){this->m_orig_glGetDoubleIndexedvEXT = this->m_ptr_glGetDoubleIndexedvEXT;this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&TraceTableDecorator::m_glGetDoubleIndexedvEXT_trace;}
+if(this->m_ptr_glWindowPos2fMESA){this->m_orig_glWindowPos2fMESA = this->m_ptr_glWindowPos2fMESA;this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&TraceTableDecorator::m_glWindowPos2fMESA_trace;}
+if(this->m_ptr_glSecondaryColor3b){this->m_orig_glSecondaryColor3b = this->m_ptr_glSecondaryColor3b;this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&TraceTableDecorator::m_glSecondaryColor3b_trace;}
+if(this->m_ptr_glCopyConvolutionFilter1DEXT){this->m_orig_glCopyConvolutionFilter1DEXT = this->m_ptr_glCopyConvolutionFilter1DEXT;this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&TraceTableDecorator::m_glCopyConvolutionFilter1DEXT_trace;}
+if(this->m_ptr_glWindowPos2sv){this->m_orig_glWindowPos2sv = this->m_ptr_glWindowPos2sv;this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&TraceTableDecorator::m_glWindowPos2sv_trace;}
+if(this->m_ptr_glBindFramebufferEXT){this->m_orig_glBindFramebufferEXT = this->m_ptr_glBindFramebufferEXT;this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&TraceTableDecorator::m_glBindFramebufferEXT_trace;}
+if(this->m_ptr_glCreateShader){this->m_orig_glCreateShader = this->m_ptr_glCreateShader;this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&TraceTableDecorator::m_glCreateShader_trace;}
+if(this->m_ptr_glGenPathsNV){this->m_orig_glGenPathsNV = this->m_ptr_glGenPathsNV;this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&TraceTableDecorator::m_glGenPathsNV_trace;}
+if(this->m_ptr_glGenRenderbuffers){this->m_orig_glGenRenderbuffers = this->m_ptr_glGenRenderbuffers;this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&TraceTableDecorator::m_glGenRenderbuffers_trace;}
+if(this->m_ptr_glCopyTexSubImage2D){this->m_orig_glCopyTexSubImage2D = this->m_ptr_glCopyTexSubImage2D;this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&TraceTableDecorator::m_glCopyTexSubImage2D_trace;}
+if(this->m_ptr_glVertexAttrib4ubvARB){this->m_orig_glVertexAttrib4ubvARB = this->m_ptr_glVertexAttrib4ubvARB;this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&TraceTableDecorator::m_glVertexAttrib4ubvARB_trace;}
+if(this->m_ptr_glDrawTextureNV){this->m_orig_glDrawTextureNV = this->m_ptr_glDrawTextureNV;this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&TraceTableDecorator::m_glDrawTextureNV_trace;}
+if(this->m_ptr_glVertexAttribs1svNV){this->m_orig_glVertexAttribs1svNV = this->m_ptr_glVertexAttribs1svNV;this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&TraceTableDecorator::m_glVertexAttribs1svNV_trace;}
+if(this->m_ptr_glClearNamedBufferSubDataEXT){this->m_orig_glClearNamedBufferSubDataEXT = this->m_ptr_glClearNamedBufferSubDataEXT;this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&TraceTableDecorator::m_glClearNamedBufferSubDataEXT_trace;}
+if(this->m_ptr_glBlendFuncSeparate){this->m_orig_glBlendFuncSeparate = this->m_ptr_glBlendFuncSeparate;this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&TraceTableDecorator::m_glBlendFuncSeparate_trace;}
+if(this->m_ptr_glPointParameterfARB){this->m_orig_glPointParameterfARB = this->m_ptr_glPointParameterfARB;this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&TraceTableDecorator::m_glPointParameterfARB_trace;}
+if(this->m_ptr_glTexCoord2fv){this->m_orig_glTexCoord2fv = this->m_ptr_glTexCoord2fv;this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&TraceTableDecorator::m_glTexCoord2fv_trace;}
+if(this->m_ptr_glGetVariantFloatvEXT){this->m_orig_glGetVariantFloatvEXT = this->m_ptr_glGetVariantFloatvEXT;this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&TraceTableDecorator::m_glGetVariantFloatvEXT_trace;}
+if(this->m_ptr_glVertexP2ui){this->m_orig_glVertexP2ui = this->m_ptr_glVertexP2ui;this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&TraceTableDecorator::m_glVertexP2ui_trace;}
+if(this->m_ptr_glWindowPos2dMESA){this->m_orig_glWindowPos2dMESA = this->m_ptr_glWindowPos2dMESA;this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&TraceTableDecorator::m_glWindowPos2dMESA_trace;}
+if(this->m_ptr_glTexCoord4fv){this->m_orig_glTexCoord4fv = this->m_ptr_glTexCoord4fv;this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&TraceTableDecorator::m_glTexCoord4fv_trace;}
+if(this->m_ptr_glBindFragDataLocationEXT){this->m_orig_glBindFragDataLocationEXT = this->m_ptr_glBindFragDataLocationEXT;this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&TraceTableDecorator::m_glBindFragDataLocationEXT_trace;}
+if(this->m_ptr_glCompressedTexSubImage1DARB){this->m_orig_glCompressedTexSubImage1DARB = this->m_ptr_glCompressedTexSubImage1DARB;this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&TraceTableDecorator::m_glCompressedTexSubImage1DARB_trace;}
+if(this->m_ptr_glGetTextureImageEXT){this->m_orig_glGetTextureImageEXT = this->m_ptr_glGetTextureImageEXT;this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&TraceTableDecorator::m_glGetTextureImageEXT_trace;}
+if(this->m_ptr_glFogCoordd){this->m_orig_glFogCoordd = this->m_ptr_glFogCoordd;this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&TraceTableDecorator::m_glFogCoordd_trace;}
+if(this->m_ptr_glPointSize){this->m_orig_glPointSize = this->m_ptr_glPointSize;this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&TraceTableDecorator::m_glPointSize_trace;}
+if(this->m_ptr_glBindTextureUnit){this->m_orig_glBindTextureUnit = this->m_ptr_glBindTextureUnit;this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&TraceTableDecorator::m_glBindTextureUnit_trace;}
+if(this->m_ptr_glProgramEnvParameterI4uiNV){this->m_orig_glProgramEnvParameterI4uiNV = this->m_ptr_glProgramEnvParameterI4uiNV;this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&TraceTableDecorator::m_glProgramEnvParameterI4uiNV_trace;}
+if(this->m_ptr_glGetProgramPipelineInfoLog){this->m_orig_glGetProgramPipelineInfoLog = this->m_ptr_glGetProgramPipelineInfoLog;this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&TraceTableDecorator::m_glGetProgramPipelineInfoLog_trace;}
+if(this->m_ptr_glProgramUniform4i64vARB){this->m_orig_glProgramUniform4i64vARB = this->m_ptr_glProgramUniform4i64vARB;this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&TraceTableDecorator::m_glProgramUniform4i64vARB_trace;}
+if(this->m_ptr_glVertexAttrib4Nuiv){this->m_orig_glVertexAttrib4Nuiv = this->m_ptr_glVertexAttrib4Nuiv;this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&TraceTableDecorator::m_glVertexAttrib4Nuiv_trace;}
+if(this->m_ptr_glGetUniformfvARB){this->m_orig_glGetUniformfvARB = this->m_ptr_glGetUniformfvARB;this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&TraceTableDecorator::m_glGetUniformfvARB_trace;}
+if(this->m_ptr_glWaitSync){this->m_orig_glWaitSync = this->m_ptr_glWaitSync;this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&TraceTableDecorator::m_glWaitSync_trace;}
+if(this->m_ptr_glUniform3i){this->m_orig_glUniform3i = this->m_ptr_glUniform3i;this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&TraceTableDecorator::m_glUniform3i_trace;}
+if(this->m_ptr_glBlendEquationSeparatei){this->m_orig_glBlendEquationSeparatei = this->m_ptr_glBlendEquationSeparatei;this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&TraceTableDecorator::m_glBlendEquationSeparatei_trace;}
+if(this->m_ptr_glVertexAttrib2hvNV){this->m_orig_glVertexAttrib2hvNV = this->m_ptr_glVertexAttrib2hvNV;this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&TraceTableDecorator::m_glVertexAttrib2hvNV_trace;}
+if(this->m_ptr_glTextureParameterivEXT){this->m_orig_glTextureParameterivEXT = this->m_ptr_glTextureParameterivEXT;this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&TraceTableDecorator::m_glTextureParameterivEXT_trace;}
+if(this->m_ptr_glUniform3d){this->m_orig_glUniform3d = this->m_ptr_glUniform3d;this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&TraceTableDecorator::m_glUniform3d_trace;}
+if(this->m_ptr_glUniform3f){this->m_orig_glUniform3f = this->m_ptr_glUniform3f;this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&TraceTableDecorator::m_glUniform3f_trace;}
+if(this->m_ptr_glActiveProgramEXT){this->m_orig_glActiveProgramEXT = this->m_ptr_glActiveProgramEXT;this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&TraceTableDecorator::m_glActiveProgramEXT_trace;}
+if(this->m_ptr_glProgramUniform3uiv){this->m_orig_glProgramUniform3uiv = this->m_ptr_glProgramUniform3uiv;this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&TraceTableDecorator::m_glProgramUniform3uiv_trace;}
+if(this->m_ptr_glUniform3ui64vARB){this->m_orig_glUniform3ui64vARB = this->m_ptr_glUniform3ui64vARB;this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&TraceTableDecorator::m_glUniform3ui64vARB_trace;}
+if(this->m_ptr_glProgramUniform1ui64vARB){this->m_orig_glProgramUniform1ui64vARB = this->m_ptr_glProgramUniform1ui64vARB;this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&TraceTableDecorator::m_glProgramUniform1ui64vARB_trace;}
+if(this->m_ptr_glTextureParameterfEXT){this->m_orig_glTextureParameterfEXT = this->m_ptr_glTextureParameterfEXT;this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&TraceTableDecorator::m_glTextureParameterfEXT_trace;}
+if(this->m_ptr_glSetFragmentShaderConstantATI){this->m_orig_glSetFragmentShaderConstantATI = this->m_ptr_glSetFragmentShaderConstantATI;this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&TraceTableDecorator::m_glSetFragmentShaderConstantATI_trace;}
+if(this->m_ptr_glColorSubTable){this->m_orig_glColorSubTable = this->m_ptr_glColorSubTable;this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&TraceTableDecorator::m_glColorSubTable_trace;}
+if(this->m_ptr_glReplacementCodeuiSUN){this->m_orig_glReplacementCodeuiSUN = this->m_ptr_glReplacementCodeuiSUN;this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&TraceTableDecorator::m_glReplacementCodeuiSUN_trace;}
+if(this->m_ptr_glStateCaptureNV){this->m_orig_glStateCaptureNV = this->m_ptr_glStateCaptureNV;this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&TraceTableDecorator::m_glStateCaptureNV_trace;}
+if(this->m_ptr_glBindAttribLocation){this->m_orig_glBindAttribLocation = this->m_ptr_glBindAttribLocation;this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&TraceTableDecorator::m_glBindAttribLocation_trace;}
+if(this->m_ptr_glWeightusvARB){this->m_orig_glWeightusvARB = this->m_ptr_glWeightusvARB;this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&TraceTableDecorator::m_glWeightusvARB_trace;}
+if(this->m_ptr_glGetFragDataIndex){this->m_orig_glGetFragDataIndex = this->m_ptr_glGetFragDataIndex;this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&TraceTableDecorator::m_glGetFragDataIndex_trace;}
+if(this->m_ptr_glMultiTexCoord2xOES){this->m_orig_glMultiTexCoord2xOES = this->m_ptr_glMultiTexCoord2xOES;this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&TraceTableDecorator::m_glMultiTexCoord2xOES_trace;}
+if(this->m_ptr_glColor3sv){this->m_orig_glColor3sv = this->m_ptr_glColor3sv;this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&TraceTableDecorator::m_glColor3sv_trace;}
+if(this->m_ptr_glTexCoord2fVertex3fSUN){this->m_orig_glTexCoord2fVertex3fSUN = this->m_ptr_glTexCoord2fVertex3fSUN;this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&TraceTableDecorator::m_glTexCoord2fVertex3fSUN_trace;}
+if(this->m_ptr_glGetMemoryObjectParameterivEXT){this->m_orig_glGetMemoryObjectParameterivEXT = this->m_ptr_glGetMemoryObjectParameterivEXT;this->m_ptr_glGetMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetMemoryObjectParameterivEXT_trace;}
+if(this->m_ptr_glPolygonOffsetEXT){this->m_orig_glPolygonOffsetEXT = this->m_ptr_glPolygonOffsetEXT;this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&TraceTableDecorator::m_glPolygonOffsetEXT_trace;}
+if(this->m_ptr_glWeightPathsNV){this->m_orig_glWeightPathsNV = this->m_ptr_glWeightPathsNV;this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&TraceTableDecorator::m_glWeightPathsNV_trace;}
+if(this->m_ptr_glCombinerStageParameterfvNV){this->m_orig_glCombinerStageParameterfvNV = this->m_ptr_glCombinerStageParameterfvNV;this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&TraceTableDecorator::m_glCombinerStageParameterfvNV_trace;}
+if(this->m_ptr_glPointParameterfEXT){this->m_orig_glPointParameterfEXT = this->m_ptr_glPointParameterfEXT;this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&TraceTableDecorator::m_glPointParameterfEXT_trace;}
+if(this->m_ptr_glCopyTexImage1DEXT){this->m_orig_glCopyTexImage1DEXT = this->m_ptr_glCopyTexImage1DEXT;this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&TraceTableDecorator::m_glCopyTexImage1DEXT_trace;}
+if(this->m_ptr_glVertex4sv){this->m_orig_glVertex4sv = this->m_ptr_glVertex4sv;this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&TraceTableDecorator::m_glVertex4sv_trace;}
+if(this->m_ptr_glMatrixMultfEXT){this->m_orig_glMatrixMultfEXT = this->m_ptr_glMatrixMultfEXT;this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&TraceTableDecorator::m_glMatrixMultfEXT_trace;}
+if(this->m_ptr_glCompressedTextureSubImage3DEXT){this->m_orig_glCompressedTextureSubImage3DEXT = this->m_ptr_glCompressedTextureSubImage3DEXT;this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glCompressedTextureSubImage3DEXT_trace;}
+if(this->m_ptr_glGetTexLevelParameterxvOES){this->m_orig_glGetTexLevelParameterxvOES = this->m_ptr_glGetTexLevelParameterxvOES;this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&TraceTableDecorator::m_glGetTexLevelParameterxvOES_trace;}
+if(this->m_ptr_glVertexAttribL3dvEXT){this->m_orig_glVertexAttribL3dvEXT = this->m_ptr_glVertexAttribL3dvEXT;this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&TraceTableDecorator::m_glVertexAttribL3dvEXT_trace;}
+if(this->m_ptr_glMultiTexCoordP4ui){this->m_orig_glMultiTexCoordP4ui = this->m_ptr_glMultiTexCoordP4ui;this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&TraceTableDecorator::m_glMultiTexCoordP4ui_trace;}
+if(this->m_ptr_glGetTextureLevelParameterivEXT){this->m_orig_glGetTextureLevelParameterivEXT = this->m_ptr_glGetTextureLevelParameterivEXT;this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetTextureLevelParameterivEXT_trace;}
+if(this->m_ptr_glAlphaFragmentOp2ATI){this->m_orig_glAlphaFragmentOp2ATI = this->m_ptr_glAlphaFragmentOp2ATI;this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&TraceTableDecorator::m_glAlphaFragmentOp2ATI_trace;}
+if(this->m_ptr_glDeleteFramebuffers){this->m_orig_glDeleteFramebuffers = this->m_ptr_glDeleteFramebuffers;this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&TraceTableDecorator::m_glDeleteFramebuffers_trace;}
+if(this->m_ptr_glDrawArrays){this->m_orig_glDrawArrays = this->m_ptr_glDrawArrays;this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&TraceTableDecorator::m_glDrawArrays_trace;}
+if(this->m_ptr_glGetTransformFeedbackiv){this->m_orig_glGetTransformFeedbackiv = this->m_ptr_glGetTransformFeedbackiv;this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&TraceTableDecorator::m_glGetTransformFeedbackiv_trace;}
+if(this->m_ptr_glGetnTexImageARB){this->m_orig_glGetnTexImageARB = this->m_ptr_glGetnTexImageARB;this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&TraceTableDecorator::m_glGetnTexImageARB_trace;}
+if(this->m_ptr_glClear){this->m_orig_glClear = this->m_ptr_glClear;this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&TraceTableDecorator::m_glClear_trace;}
+if(this->m_ptr_glVertexArrayParameteriAPPLE){this->m_orig_glVertexArrayParameteriAPPLE = this->m_ptr_glVertexArrayParameteriAPPLE;this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&TraceTableDecorator::m_glVertexArrayParameteriAPPLE_trace;}
+if(this->m_ptr_glMultiTexCoord2dvARB){this->m_orig_glMultiTexCoord2dvARB = this->m_ptr_glMultiTexCoord2dvARB;this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&TraceTableDecorator::m_glMultiTexCoord2dvARB_trace;}
+if(this->m_ptr_glGetVideoCaptureStreamdvNV){this->m_orig_glGetVideoCaptureStreamdvNV = this->m_ptr_glGetVideoCaptureStreamdvNV;this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&TraceTableDecorator::m_glGetVideoCaptureStreamdvNV_trace;}
+if(this->m_ptr_glFragmentLightModelivSGIX){this->m_orig_glFragmentLightModelivSGIX = this->m_ptr_glFragmentLightModelivSGIX;this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&TraceTableDecorator::m_glFragmentLightModelivSGIX_trace;}
+if(this->m_ptr_glVertexAttribP2ui){this->m_orig_glVertexAttribP2ui = this->m_ptr_glVertexAttribP2ui;this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&TraceTableDecorator::m_glVertexAttribP2ui_trace;}
+if(this->m_ptr_glMultiTexCoordPointerEXT){this->m_orig_glMultiTexCoordPointerEXT = this->m_ptr_glMultiTexCoordPointerEXT;this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&TraceTableDecorator::m_glMultiTexCoordPointerEXT_trace;}
+if(this->m_ptr_glProgramUniform3iEXT){this->m_orig_glProgramUniform3iEXT = this->m_ptr_glProgramUniform3iEXT;this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&TraceTableDecorator::m_glProgramUniform3iEXT_trace;}
+if(this->m_ptr_glTranslatef){this->m_orig_glTranslatef = this->m_ptr_glTranslatef;this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&TraceTableDecorator::m_glTranslatef_trace;}
+if(this->m_ptr_glVertexAttrib4Nub){this->m_orig_glVertexAttrib4Nub = this->m_ptr_glVertexAttrib4Nub;this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&TraceTableDecorator::m_glVertexAttrib4Nub_trace;}
+if(this->m_ptr_glTranslated){this->m_orig_glTranslated = this->m_ptr_glTranslated;this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&TraceTableDecorator::m_glTranslated_trace;}
+if(this->m_ptr_glSamplerParameterIiv){this->m_orig_glSamplerParameterIiv = this->m_ptr_glSamplerParameterIiv;this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&TraceTableDecorator::m_glSamplerParameterIiv_trace;}
+if(this->m_ptr_glTexCoord4hNV){this->m_orig_glTexCoord4hNV = this->m_ptr_glTexCoord4hNV;this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&TraceTableDecorator::m_glTexCoord4hNV_trace;}
+if(this->m_ptr_glDrawElementsIndirect){this->m_orig_glDrawElementsIndirect = this->m_ptr_glDrawElementsIndirect;this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&TraceTableDecorator::m_glDrawElementsIndirect_trace;}
+if(this->m_ptr_glDeletePerfMonitorsAMD){this->m_orig_glDeletePerfMonitorsAMD = this->m_ptr_glDeletePerfMonitorsAMD;this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&TraceTableDecorator::m_glDeletePerfMonitorsAMD_trace;}
+if(this->m_ptr_glIsRenderbufferEXT){this->m_orig_glIsRenderbufferEXT = this->m_ptr_glIsRenderbufferEXT;this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&TraceTableDecorator::m_glIsRenderbufferEXT_trace;}
+if(this->m_ptr_glDrawCommandsNV){this->m_orig_glDrawCommandsNV = this->m_ptr_glDrawCommandsNV;this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&TraceTableDecorator::m_glDrawCommandsNV_trace;}
+if(this->m_ptr_glUniform3ivARB){this->m_orig_glUniform3ivARB = this->m_ptr_glUniform3ivARB;this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&TraceTableDecorator::m_glUniform3ivARB_trace;}
+if(this->m_ptr_glBufferSubData){this->m_orig_glBufferSubData = this->m_ptr_glBufferSubData;this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&TraceTableDecorator::m_glBufferSubData_trace;}
+if(this->m_ptr_glSecondaryColor3bv){this->m_orig_glSecondaryColor3bv = this->m_ptr_glSecondaryColor3bv;this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&TraceTableDecorator::m_glSecondaryColor3bv_trace;}
+if(this->m_ptr_glMatrixMultTransposedEXT){this->m_orig_glMatrixMultTransposedEXT = this->m_ptr_glMatrixMultTransposedEXT;this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&TraceTableDecorator::m_glMatrixMultTransposedEXT_trace;}
+if(this->m_ptr_glRequestResidentProgramsNV){this->m_orig_glRequestResidentProgramsNV = this->m_ptr_glRequestResidentProgramsNV;this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&TraceTableDecorator::m_glRequestResidentProgramsNV_trace;}
+if(this->m_ptr_glAlphaFragmentOp1ATI){this->m_orig_glAlphaFragmentOp1ATI = this->m_ptr_glAlphaFragmentOp1ATI;this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&TraceTableDecorator::m_glAlphaFragmentOp1ATI_trace;}
+if(this->m_ptr_glGetQueryObjecti64v){this->m_orig_glGetQueryObjecti64v = this->m_ptr_glGetQueryObjecti64v;this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&TraceTableDecorator::m_glGetQueryObjecti64v_trace;}
+if(this->m_ptr_glMatrixMult3x3fNV){this->m_orig_glMatrixMult3x3fNV = this->m_ptr_glMatrixMult3x3fNV;this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&TraceTableDecorator::m_glMatrixMult3x3fNV_trace;}
+if(this->m_ptr_glColorTableParameteriv){this->m_orig_glColorTableParameteriv = this->m_ptr_glColorTableParameteriv;this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&TraceTableDecorator::m_glColorTableParameteriv_trace;}
+if(this->m_ptr_glPathSubCommandsNV){this->m_orig_glPathSubCommandsNV = this->m_ptr_glPathSubCommandsNV;this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&TraceTableDecorator::m_glPathSubCommandsNV_trace;}
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV){this->m_orig_glGetFinalCombinerInputParameterivNV = this->m_ptr_glGetFinalCombinerInputParameterivNV;this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&TraceTableDecorator::m_glGetFinalCombinerInputParameterivNV_trace;}
+if(this->m_ptr_glIsRenderbuffer){this->m_orig_glIsRenderbuffer = this->m_ptr_glIsRenderbuffer;this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&TraceTableDecorator::m_glIsRenderbuffer_trace;}
+if(this->m_ptr_glVertex3iv){this->m_orig_glVertex3iv = this->m_ptr_glVertex3iv;this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&TraceTableDecorator::m_glVertex3iv_trace;}
+if(this->m_ptr_glTexGenfv){this->m_orig_glTexGenfv = this->m_ptr_glTexGenfv;this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&TraceTableDecorator::m_glTexGenfv_trace;}
+if(this->m_ptr_glFrustumfOES){this->m_orig_glFrustumfOES = this->m_ptr_glFrustumfOES;this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&TraceTableDecorator::m_glFrustumfOES_trace;}
+if(this->m_ptr_glBindVertexBuffers){this->m_orig_glBindVertexBuffers = this->m_ptr_glBindVertexBuffers;this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&TraceTableDecorator::m_glBindVertexBuffers_trace;}
+if(this->m_ptr_glMateriali){this->m_orig_glMateriali = this->m_ptr_glMateriali;this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&TraceTableDecorator::m_glMateriali_trace;}
+if(this->m_ptr_glMultiTexCoord2svARB){this->m_orig_glMultiTexCoord2svARB = this->m_ptr_glMultiTexCoord2svARB;this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&TraceTableDecorator::m_glMultiTexCoord2svARB_trace;}
+if(this->m_ptr_glDisableVertexAttribArray){this->m_orig_glDisableVertexAttribArray = this->m_ptr_glDisableVertexAttribArray;this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&TraceTableDecorator::m_glDisableVertexAttribArray_trace;}
+if(this->m_ptr_glWindowPos3ivARB){this->m_orig_glWindowPos3ivARB = this->m_ptr_glWindowPos3ivARB;this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&TraceTableDecorator::m_glWindowPos3ivARB_trace;}
+if(this->m_ptr_glTexCoordFormatNV){this->m_orig_glTexCoordFormatNV = this->m_ptr_glTexCoordFormatNV;this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&TraceTableDecorator::m_glTexCoordFormatNV_trace;}
+if(this->m_ptr_glBlitNamedFramebuffer){this->m_orig_glBlitNamedFramebuffer = this->m_ptr_glBlitNamedFramebuffer;this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&TraceTableDecorator::m_glBlitNamedFramebuffer_trace;}
+if(this->m_ptr_glMatrixLoadTransposefEXT){this->m_orig_glMatrixLoadTransposefEXT = this->m_ptr_glMatrixLoadTransposefEXT;this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&TraceTableDecorator::m_glMatrixLoadTransposefEXT_trace;}
+if(this->m_ptr_glMultiTexGenfEXT){this->m_orig_glMultiTexGenfEXT = this->m_ptr_glMultiTexGenfEXT;this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&TraceTableDecorator::m_glMultiTexGenfEXT_trace;}
+if(this->m_ptr_glShaderStorageBlockBinding){this->m_orig_glShaderStorageBlockBinding = this->m_ptr_glShaderStorageBlockBinding;this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&TraceTableDecorator::m_glShaderStorageBlockBinding_trace;}
+if(this->m_ptr_glMaterialf){this->m_orig_glMaterialf = this->m_ptr_glMaterialf;this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&TraceTableDecorator::m_glMaterialf_trace;}
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT){this->m_orig_glCheckNamedFramebufferStatusEXT = this->m_ptr_glCheckNamedFramebufferStatusEXT;this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&TraceTableDecorator::m_glCheckNamedFramebufferStatusEXT_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT){this->m_orig_glVertexArrayVertexAttribFormatEXT = this->m_ptr_glVertexArrayVertexAttribFormatEXT;this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribFormatEXT_trace;}
+if(this->m_ptr_glVertex2hNV){this->m_orig_glVertex2hNV = this->m_ptr_glVertex2hNV;this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&TraceTableDecorator::m_glVertex2hNV_trace;}
+if(this->m_ptr_glDeleteVertexShaderEXT){this->m_orig_glDeleteVertexShaderEXT = this->m_ptr_glDeleteVertexShaderEXT;this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&TraceTableDecorator::m_glDeleteVertexShaderEXT_trace;}
+if(this->m_ptr_glTexImage3DEXT){this->m_orig_glTexImage3DEXT = this->m_ptr_glTexImage3DEXT;this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&TraceTableDecorator::m_glTexImage3DEXT_trace;}
+if(this->m_ptr_glSignalVkFenceNV){this->m_orig_glSignalVkFenceNV = this->m_ptr_glSignalVkFenceNV;this->m_ptr_glSignalVkFenceNV = (FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC)&TraceTableDecorator::m_glSignalVkFenceNV_trace;}
+if(this->m_ptr_glProgramLocalParameterI4ivNV){this->m_orig_glProgramLocalParameterI4ivNV = this->m_ptr_glProgramLocalParameterI4ivNV;this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&TraceTableDecorator::m_glProgramLocalParameterI4ivNV_trace;}
+if(this->m_ptr_glGlobalAlphaFactoriSUN){this->m_orig_glGlobalAlphaFactoriSUN = this->m_ptr_glGlobalAlphaFactoriSUN;this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactoriSUN_trace;}
+if(this->m_ptr_glTextureStorage1D){this->m_orig_glTextureStorage1D = this->m_ptr_glTextureStorage1D;this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&TraceTableDecorator::m_glTextureStorage1D_trace;}
+if(this->m_ptr_glBinormal3sEXT){this->m_orig_glBinormal3sEXT = this->m_ptr_glBinormal3sEXT;this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&TraceTableDecorator::m_glBinormal3sEXT_trace;}
+if(this->m_ptr_glGetProgramInterfaceiv){this->m_orig_glGetProgramInterfaceiv = this->m_ptr_glGetProgramInterfaceiv;this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&TraceTableDecorator::m_glGetProgramInterfaceiv_trace;}
+if(this->m_ptr_glMatrixIndexPointerARB){this->m_orig_glMatrixIndexPointerARB = this->m_ptr_glMatrixIndexPointerARB;this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&TraceTableDecorator::m_glMatrixIndexPointerARB_trace;}
+if(this->m_ptr_glTexCoordPointerEXT){this->m_orig_glTexCoordPointerEXT = this->m_ptr_glTexCoordPointerEXT;this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&TraceTableDecorator::m_glTexCoordPointerEXT_trace;}
+if(this->m_ptr_glMultiTexGeniEXT){this->m_orig_glMultiTexGeniEXT = this->m_ptr_glMultiTexGeniEXT;this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&TraceTableDecorator::m_glMultiTexGeniEXT_trace;}
+if(this->m_ptr_glVertexAttrib2fNV){this->m_orig_glVertexAttrib2fNV = this->m_ptr_glVertexAttrib2fNV;this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&TraceTableDecorator::m_glVertexAttrib2fNV_trace;}
+if(this->m_ptr_glNamedProgramStringEXT){this->m_orig_glNamedProgramStringEXT = this->m_ptr_glNamedProgramStringEXT;this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&TraceTableDecorator::m_glNamedProgramStringEXT_trace;}
+if(this->m_ptr_glMapNamedBuffer){this->m_orig_glMapNamedBuffer = this->m_ptr_glMapNamedBuffer;this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&TraceTableDecorator::m_glMapNamedBuffer_trace;}
+if(this->m_ptr_glGetMinmaxParameteriv){this->m_orig_glGetMinmaxParameteriv = this->m_ptr_glGetMinmaxParameteriv;this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&TraceTableDecorator::m_glGetMinmaxParameteriv_trace;}
+if(this->m_ptr_glGetnUniformdv){this->m_orig_glGetnUniformdv = this->m_ptr_glGetnUniformdv;this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&TraceTableDecorator::m_glGetnUniformdv_trace;}
+if(this->m_ptr_glEndConditionalRenderNVX){this->m_orig_glEndConditionalRenderNVX = this->m_ptr_glEndConditionalRenderNVX;this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&TraceTableDecorator::m_glEndConditionalRenderNVX_trace;}
+if(this->m_ptr_glBinormal3fEXT){this->m_orig_glBinormal3fEXT = this->m_ptr_glBinormal3fEXT;this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&TraceTableDecorator::m_glBinormal3fEXT_trace;}
+if(this->m_ptr_glNormalStream3iATI){this->m_orig_glNormalStream3iATI = this->m_ptr_glNormalStream3iATI;this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&TraceTableDecorator::m_glNormalStream3iATI_trace;}
+if(this->m_ptr_glProgramBufferParametersIivNV){this->m_orig_glProgramBufferParametersIivNV = this->m_ptr_glProgramBufferParametersIivNV;this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&TraceTableDecorator::m_glProgramBufferParametersIivNV_trace;}
+if(this->m_ptr_glMapGrid1xOES){this->m_orig_glMapGrid1xOES = this->m_ptr_glMapGrid1xOES;this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&TraceTableDecorator::m_glMapGrid1xOES_trace;}
+if(this->m_ptr_glGetVertexAttribPointervARB){this->m_orig_glGetVertexAttribPointervARB = this->m_ptr_glGetVertexAttribPointervARB;this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&TraceTableDecorator::m_glGetVertexAttribPointervARB_trace;}
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT){this->m_orig_glFlushMappedNamedBufferRangeEXT = this->m_ptr_glFlushMappedNamedBufferRangeEXT;this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&TraceTableDecorator::m_glFlushMappedNamedBufferRangeEXT_trace;}
+if(this->m_ptr_glGetVertexAttribIiv){this->m_orig_glGetVertexAttribIiv = this->m_ptr_glGetVertexAttribIiv;this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&TraceTableDecorator::m_glGetVertexAttribIiv_trace;}
+if(this->m_ptr_glVertexP4uiv){this->m_orig_glVertexP4uiv = this->m_ptr_glVertexP4uiv;this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&TraceTableDecorator::m_glVertexP4uiv_trace;}
+if(this->m_ptr_glUniformui64NV){this->m_orig_glUniformui64NV = this->m_ptr_glUniformui64NV;this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&TraceTableDecorator::m_glUniformui64NV_trace;}
+if(this->m_ptr_glColor4fv){this->m_orig_glColor4fv = this->m_ptr_glColor4fv;this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&TraceTableDecorator::m_glColor4fv_trace;}
+if(this->m_ptr_glTexParameterxvOES){this->m_orig_glTexParameterxvOES = this->m_ptr_glTexParameterxvOES;this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&TraceTableDecorator::m_glTexParameterxvOES_trace;}
+if(this->m_ptr_glPatchParameteri){this->m_orig_glPatchParameteri = this->m_ptr_glPatchParameteri;this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&TraceTableDecorator::m_glPatchParameteri_trace;}
+if(this->m_ptr_glMap1d){this->m_orig_glMap1d = this->m_ptr_glMap1d;this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&TraceTableDecorator::m_glMap1d_trace;}
+if(this->m_ptr_glGetTexFilterFuncSGIS){this->m_orig_glGetTexFilterFuncSGIS = this->m_ptr_glGetTexFilterFuncSGIS;this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&TraceTableDecorator::m_glGetTexFilterFuncSGIS_trace;}
+if(this->m_ptr_glVertexStream3dATI){this->m_orig_glVertexStream3dATI = this->m_ptr_glVertexStream3dATI;this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&TraceTableDecorator::m_glVertexStream3dATI_trace;}
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT){this->m_orig_glVertexArrayVertexBindingDivisorEXT = this->m_ptr_glVertexArrayVertexBindingDivisorEXT;this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&TraceTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3svARB){this->m_orig_glMultiTexCoord3svARB = this->m_ptr_glMultiTexCoord3svARB;this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&TraceTableDecorator::m_glMultiTexCoord3svARB_trace;}
+if(this->m_ptr_glBindProgramNV){this->m_orig_glBindProgramNV = this->m_ptr_glBindProgramNV;this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&TraceTableDecorator::m_glBindProgramNV_trace;}
+if(this->m_ptr_glGetConvolutionParameteriv){this->m_orig_glGetConvolutionParameteriv = this->m_ptr_glGetConvolutionParameteriv;this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&TraceTableDecorator::m_glGetConvolutionParameteriv_trace;}
+if(this->m_ptr_glGetProgramLocalParameterfvARB){this->m_orig_glGetProgramLocalParameterfvARB = this->m_ptr_glGetProgramLocalParameterfvARB;this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&TraceTableDecorator::m_glGetProgramLocalParameterfvARB_trace;}
+if(this->m_ptr_glGenFragmentShadersATI){this->m_orig_glGenFragmentShadersATI = this->m_ptr_glGenFragmentShadersATI;this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&TraceTableDecorator::m_glGenFragmentShadersATI_trace;}
+if(this->m_ptr_glTexBumpParameterivATI){this->m_orig_glTexBumpParameterivATI = this->m_ptr_glTexBumpParameterivATI;this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&TraceTableDecorator::m_glTexBumpParameterivATI_trace;}
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv){this->m_orig_glGetNamedFramebufferAttachmentParameteriv = this->m_ptr_glGetNamedFramebufferAttachmentParameteriv;this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&TraceTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_trace;}
+if(this->m_ptr_glGetnSeparableFilter){this->m_orig_glGetnSeparableFilter = this->m_ptr_glGetnSeparableFilter;this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&TraceTableDecorator::m_glGetnSeparableFilter_trace;}
+if(this->m_ptr_glNormal3xvOES){this->m_orig_glNormal3xvOES = this->m_ptr_glNormal3xvOES;this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&TraceTableDecorator::m_glNormal3xvOES_trace;}
+if(this->m_ptr_glPassTexCoordATI){this->m_orig_glPassTexCoordATI = this->m_ptr_glPassTexCoordATI;this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&TraceTableDecorator::m_glPassTexCoordATI_trace;}
+if(this->m_ptr_glFramebufferTextureFaceARB){this->m_orig_glFramebufferTextureFaceARB = this->m_ptr_glFramebufferTextureFaceARB;this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&TraceTableDecorator::m_glFramebufferTextureFaceARB_trace;}
+if(this->m_ptr_glProgramUniform1dv){this->m_orig_glProgramUniform1dv = this->m_ptr_glProgramUniform1dv;this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&TraceTableDecorator::m_glProgramUniform1dv_trace;}
+if(this->m_ptr_glTextureStorage2DEXT){this->m_orig_glTextureStorage2DEXT = this->m_ptr_glTextureStorage2DEXT;this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&TraceTableDecorator::m_glTextureStorage2DEXT_trace;}
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT){this->m_orig_glVertexArrayFogCoordOffsetEXT = this->m_ptr_glVertexArrayFogCoordOffsetEXT;this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayFogCoordOffsetEXT_trace;}
+if(this->m_ptr_glDeleteNamedStringARB){this->m_orig_glDeleteNamedStringARB = this->m_ptr_glDeleteNamedStringARB;this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&TraceTableDecorator::m_glDeleteNamedStringARB_trace;}
+if(this->m_ptr_glMulticastGetQueryObjecti64vNV){this->m_orig_glMulticastGetQueryObjecti64vNV = this->m_ptr_glMulticastGetQueryObjecti64vNV;this->m_ptr_glMulticastGetQueryObjecti64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)&TraceTableDecorator::m_glMulticastGetQueryObjecti64vNV_trace;}
+if(this->m_ptr_glGenOcclusionQueriesNV){this->m_orig_glGenOcclusionQueriesNV = this->m_ptr_glGenOcclusionQueriesNV;this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&TraceTableDecorator::m_glGenOcclusionQueriesNV_trace;}
+if(this->m_ptr_glLighti){this->m_orig_glLighti = this->m_ptr_glLighti;this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&TraceTableDecorator::m_glLighti_trace;}
+if(this->m_ptr_glTexImage1D){this->m_orig_glTexImage1D = this->m_ptr_glTexImage1D;this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&TraceTableDecorator::m_glTexImage1D_trace;}
+if(this->m_ptr_glLightf){this->m_orig_glLightf = this->m_ptr_glLightf;this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&TraceTableDecorator::m_glLightf_trace;}
+if(this->m_ptr_glClientAttribDefaultEXT){this->m_orig_glClientAttribDefaultEXT = this->m_ptr_glClientAttribDefaultEXT;this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&TraceTableDecorator::m_glClientAttribDefaultEXT_trace;}
+if(this->m_ptr_glVertexAttrib4bvARB){this->m_orig_glVertexAttrib4bvARB = this->m_ptr_glVertexAttrib4bvARB;this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&TraceTableDecorator::m_glVertexAttrib4bvARB_trace;}
+if(this->m_ptr_glVertexAttribIFormatNV){this->m_orig_glVertexAttribIFormatNV = this->m_ptr_glVertexAttribIFormatNV;this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&TraceTableDecorator::m_glVertexAttribIFormatNV_trace;}
+if(this->m_ptr_glStencilFuncSeparate){this->m_orig_glStencilFuncSeparate = this->m_ptr_glStencilFuncSeparate;this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&TraceTableDecorator::m_glStencilFuncSeparate_trace;}
+if(this->m_ptr_glGetVertexAttribfvARB){this->m_orig_glGetVertexAttribfvARB = this->m_ptr_glGetVertexAttribfvARB;this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&TraceTableDecorator::m_glGetVertexAttribfvARB_trace;}
+if(this->m_ptr_glVertexAttrib2dNV){this->m_orig_glVertexAttrib2dNV = this->m_ptr_glVertexAttrib2dNV;this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&TraceTableDecorator::m_glVertexAttrib2dNV_trace;}
+if(this->m_ptr_glProgramUniform2iEXT){this->m_orig_glProgramUniform2iEXT = this->m_ptr_glProgramUniform2iEXT;this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&TraceTableDecorator::m_glProgramUniform2iEXT_trace;}
+if(this->m_ptr_glClientActiveVertexStreamATI){this->m_orig_glClientActiveVertexStreamATI = this->m_ptr_glClientActiveVertexStreamATI;this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&TraceTableDecorator::m_glClientActiveVertexStreamATI_trace;}
+if(this->m_ptr_glRasterPos3xOES){this->m_orig_glRasterPos3xOES = this->m_ptr_glRasterPos3xOES;this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&TraceTableDecorator::m_glRasterPos3xOES_trace;}
+if(this->m_ptr_glGetMapParameterivNV){this->m_orig_glGetMapParameterivNV = this->m_ptr_glGetMapParameterivNV;this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&TraceTableDecorator::m_glGetMapParameterivNV_trace;}
+if(this->m_ptr_glSampleCoverage){this->m_orig_glSampleCoverage = this->m_ptr_glSampleCoverage;this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&TraceTableDecorator::m_glSampleCoverage_trace;}
+if(this->m_ptr_glClearDepthxOES){this->m_orig_glClearDepthxOES = this->m_ptr_glClearDepthxOES;this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&TraceTableDecorator::m_glClearDepthxOES_trace;}
+if(this->m_ptr_glUniformBufferEXT){this->m_orig_glUniformBufferEXT = this->m_ptr_glUniformBufferEXT;this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&TraceTableDecorator::m_glUniformBufferEXT_trace;}
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN){this->m_orig_glTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN;this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glMulticastGetQueryObjectuivNV){this->m_orig_glMulticastGetQueryObjectuivNV = this->m_ptr_glMulticastGetQueryObjectuivNV;this->m_ptr_glMulticastGetQueryObjectuivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)&TraceTableDecorator::m_glMulticastGetQueryObjectuivNV_trace;}
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL){this->m_orig_glGetFirstPerfQueryIdINTEL = this->m_ptr_glGetFirstPerfQueryIdINTEL;this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&TraceTableDecorator::m_glGetFirstPerfQueryIdINTEL_trace;}
+if(this->m_ptr_glUnmapNamedBufferEXT){this->m_orig_glUnmapNamedBufferEXT = this->m_ptr_glUnmapNamedBufferEXT;this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&TraceTableDecorator::m_glUnmapNamedBufferEXT_trace;}
+if(this->m_ptr_glGetTransformFeedbacki_v){this->m_orig_glGetTransformFeedbacki_v = this->m_ptr_glGetTransformFeedbacki_v;this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&TraceTableDecorator::m_glGetTransformFeedbacki_v_trace;}
+if(this->m_ptr_glUniform4fvARB){this->m_orig_glUniform4fvARB = this->m_ptr_glUniform4fvARB;this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&TraceTableDecorator::m_glUniform4fvARB_trace;}
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV){this->m_orig_glRenderbufferStorageMultisampleCoverageNV = this->m_ptr_glRenderbufferStorageMultisampleCoverageNV;this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&TraceTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_trace;}
+if(this->m_ptr_glGetFloati_vEXT){this->m_orig_glGetFloati_vEXT = this->m_ptr_glGetFloati_vEXT;this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&TraceTableDecorator::m_glGetFloati_vEXT_trace;}
+if(this->m_ptr_glBindAttribLocationARB){this->m_orig_glBindAttribLocationARB = this->m_ptr_glBindAttribLocationARB;this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&TraceTableDecorator::m_glBindAttribLocationARB_trace;}
+if(this->m_ptr_glBufferAddressRangeNV){this->m_orig_glBufferAddressRangeNV = this->m_ptr_glBufferAddressRangeNV;this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&TraceTableDecorator::m_glBufferAddressRangeNV_trace;}
+if(this->m_ptr_glGenProgramsARB){this->m_orig_glGenProgramsARB = this->m_ptr_glGenProgramsARB;this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&TraceTableDecorator::m_glGenProgramsARB_trace;}
+if(this->m_ptr_glMultiTexEnvivEXT){this->m_orig_glMultiTexEnvivEXT = this->m_ptr_glMultiTexEnvivEXT;this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&TraceTableDecorator::m_glMultiTexEnvivEXT_trace;}
+if(this->m_ptr_glSecondaryColor3uiEXT){this->m_orig_glSecondaryColor3uiEXT = this->m_ptr_glSecondaryColor3uiEXT;this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&TraceTableDecorator::m_glSecondaryColor3uiEXT_trace;}
+if(this->m_ptr_glCompressedTextureImage2DEXT){this->m_orig_glCompressedTextureImage2DEXT = this->m_ptr_glCompressedTextureImage2DEXT;this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&TraceTableDecorator::m_glCompressedTextureImage2DEXT_trace;}
+if(this->m_ptr_glUniform2i){this->m_orig_glUniform2i = this->m_ptr_glUniform2i;this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&TraceTableDecorator::m_glUniform2i_trace;}
+if(this->m_ptr_glCopyTexImage2DEXT){this->m_orig_glCopyTexImage2DEXT = this->m_ptr_glCopyTexImage2DEXT;this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&TraceTableDecorator::m_glCopyTexImage2DEXT_trace;}
+if(this->m_ptr_glUniform2d){this->m_orig_glUniform2d = this->m_ptr_glUniform2d;this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&TraceTableDecorator::m_glUniform2d_trace;}
+if(this->m_ptr_glVertexAttribL1d){this->m_orig_glVertexAttribL1d = this->m_ptr_glVertexAttribL1d;this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&TraceTableDecorator::m_glVertexAttribL1d_trace;}
+if(this->m_ptr_glFramebufferTextureFaceEXT){this->m_orig_glFramebufferTextureFaceEXT = this->m_ptr_glFramebufferTextureFaceEXT;this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&TraceTableDecorator::m_glFramebufferTextureFaceEXT_trace;}
+if(this->m_ptr_glFramebufferTextureLayer){this->m_orig_glFramebufferTextureLayer = this->m_ptr_glFramebufferTextureLayer;this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&TraceTableDecorator::m_glFramebufferTextureLayer_trace;}
+if(this->m_ptr_glMultiTexCoord4bvOES){this->m_orig_glMultiTexCoord4bvOES = this->m_ptr_glMultiTexCoord4bvOES;this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&TraceTableDecorator::m_glMultiTexCoord4bvOES_trace;}
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT){this->m_orig_glGetVertexArrayPointeri_vEXT = this->m_ptr_glGetVertexArrayPointeri_vEXT;this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&TraceTableDecorator::m_glGetVertexArrayPointeri_vEXT_trace;}
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT){this->m_orig_glNamedProgramLocalParameter4dEXT = this->m_ptr_glNamedProgramLocalParameter4dEXT;this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameter4dEXT_trace;}
+if(this->m_ptr_glBinormal3bEXT){this->m_orig_glBinormal3bEXT = this->m_ptr_glBinormal3bEXT;this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&TraceTableDecorator::m_glBinormal3bEXT_trace;}
+if(this->m_ptr_glConvolutionFilter2DEXT){this->m_orig_glConvolutionFilter2DEXT = this->m_ptr_glConvolutionFilter2DEXT;this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&TraceTableDecorator::m_glConvolutionFilter2DEXT_trace;}
+if(this->m_ptr_glProgramUniform2fv){this->m_orig_glProgramUniform2fv = this->m_ptr_glProgramUniform2fv;this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&TraceTableDecorator::m_glProgramUniform2fv_trace;}
+if(this->m_ptr_glColor3fVertex3fSUN){this->m_orig_glColor3fVertex3fSUN = this->m_ptr_glColor3fVertex3fSUN;this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glColor3fVertex3fSUN_trace;}
+if(this->m_ptr_glNormal3fVertex3fvSUN){this->m_orig_glNormal3fVertex3fvSUN = this->m_ptr_glNormal3fVertex3fvSUN;this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT){this->m_orig_glCopyMultiTexSubImage3DEXT = this->m_ptr_glCopyMultiTexSubImage3DEXT;this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glCopyMultiTexSubImage3DEXT_trace;}
+if(this->m_ptr_glProgramLocalParameterI4iNV){this->m_orig_glProgramLocalParameterI4iNV = this->m_ptr_glProgramLocalParameterI4iNV;this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&TraceTableDecorator::m_glProgramLocalParameterI4iNV_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x4dv){this->m_orig_glProgramUniformMatrix2x4dv = this->m_ptr_glProgramUniformMatrix2x4dv;this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x4dv_trace;}
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV){this->m_orig_glPathMemoryGlyphIndexArrayNV = this->m_ptr_glPathMemoryGlyphIndexArrayNV;this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&TraceTableDecorator::m_glPathMemoryGlyphIndexArrayNV_trace;}
+if(this->m_ptr_glDrawArraysEXT){this->m_orig_glDrawArraysEXT = this->m_ptr_glDrawArraysEXT;this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&TraceTableDecorator::m_glDrawArraysEXT_trace;}
+if(this->m_ptr_glBlendEquationEXT){this->m_orig_glBlendEquationEXT = this->m_ptr_glBlendEquationEXT;this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&TraceTableDecorator::m_glBlendEquationEXT_trace;}
+if(this->m_ptr_glStencilOp){this->m_orig_glStencilOp = this->m_ptr_glStencilOp;this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&TraceTableDecorator::m_glStencilOp_trace;}
+if(this->m_ptr_glCopyTextureSubImage2DEXT){this->m_orig_glCopyTextureSubImage2DEXT = this->m_ptr_glCopyTextureSubImage2DEXT;this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glCopyTextureSubImage2DEXT_trace;}
+if(this->m_ptr_glTexEnvf){this->m_orig_glTexEnvf = this->m_ptr_glTexEnvf;this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&TraceTableDecorator::m_glTexEnvf_trace;}
+if(this->m_ptr_glVertexAttrib2dvNV){this->m_orig_glVertexAttrib2dvNV = this->m_ptr_glVertexAttrib2dvNV;this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&TraceTableDecorator::m_glVertexAttrib2dvNV_trace;}
+if(this->m_ptr_glGenPerfMonitorsAMD){this->m_orig_glGenPerfMonitorsAMD = this->m_ptr_glGenPerfMonitorsAMD;this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&TraceTableDecorator::m_glGenPerfMonitorsAMD_trace;}
+if(this->m_ptr_glGetInteger64i_v){this->m_orig_glGetInteger64i_v = this->m_ptr_glGetInteger64i_v;this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&TraceTableDecorator::m_glGetInteger64i_v_trace;}
+if(this->m_ptr_glGetHistogramParameterfv){this->m_orig_glGetHistogramParameterfv = this->m_ptr_glGetHistogramParameterfv;this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&TraceTableDecorator::m_glGetHistogramParameterfv_trace;}
+if(this->m_ptr_glVertexFormatNV){this->m_orig_glVertexFormatNV = this->m_ptr_glVertexFormatNV;this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&TraceTableDecorator::m_glVertexFormatNV_trace;}
+if(this->m_ptr_glBlendFuncIndexedAMD){this->m_orig_glBlendFuncIndexedAMD = this->m_ptr_glBlendFuncIndexedAMD;this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&TraceTableDecorator::m_glBlendFuncIndexedAMD_trace;}
+if(this->m_ptr_glTexEnvi){this->m_orig_glTexEnvi = this->m_ptr_glTexEnvi;this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&TraceTableDecorator::m_glTexEnvi_trace;}
+if(this->m_ptr_glMultiTexCoord1iv){this->m_orig_glMultiTexCoord1iv = this->m_ptr_glMultiTexCoord1iv;this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&TraceTableDecorator::m_glMultiTexCoord1iv_trace;}
+if(this->m_ptr_glIsEnabledi){this->m_orig_glIsEnabledi = this->m_ptr_glIsEnabledi;this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&TraceTableDecorator::m_glIsEnabledi_trace;}
+if(this->m_ptr_glVertexAttribL2ui64vNV){this->m_orig_glVertexAttribL2ui64vNV = this->m_ptr_glVertexAttribL2ui64vNV;this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&TraceTableDecorator::m_glVertexAttribL2ui64vNV_trace;}
+if(this->m_ptr_glVertexAttribL4i64NV){this->m_orig_glVertexAttribL4i64NV = this->m_ptr_glVertexAttribL4i64NV;this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&TraceTableDecorator::m_glVertexAttribL4i64NV_trace;}
+if(this->m_ptr_glMatrixTranslatedEXT){this->m_orig_glMatrixTranslatedEXT = this->m_ptr_glMatrixTranslatedEXT;this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&TraceTableDecorator::m_glMatrixTranslatedEXT_trace;}
+if(this->m_ptr_glMakeTextureHandleResidentARB){this->m_orig_glMakeTextureHandleResidentARB = this->m_ptr_glMakeTextureHandleResidentARB;this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&TraceTableDecorator::m_glMakeTextureHandleResidentARB_trace;}
+if(this->m_ptr_glMatrixMultdEXT){this->m_orig_glMatrixMultdEXT = this->m_ptr_glMatrixMultdEXT;this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&TraceTableDecorator::m_glMatrixMultdEXT_trace;}
+if(this->m_ptr_glBinormal3dvEXT){this->m_orig_glBinormal3dvEXT = this->m_ptr_glBinormal3dvEXT;this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&TraceTableDecorator::m_glBinormal3dvEXT_trace;}
+if(this->m_ptr_glImportSyncEXT){this->m_orig_glImportSyncEXT = this->m_ptr_glImportSyncEXT;this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&TraceTableDecorator::m_glImportSyncEXT_trace;}
+if(this->m_ptr_glGetMapiv){this->m_orig_glGetMapiv = this->m_ptr_glGetMapiv;this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&TraceTableDecorator::m_glGetMapiv_trace;}
+if(this->m_ptr_glImportSemaphoreFdEXT){this->m_orig_glImportSemaphoreFdEXT = this->m_ptr_glImportSemaphoreFdEXT;this->m_ptr_glImportSemaphoreFdEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC)&TraceTableDecorator::m_glImportSemaphoreFdEXT_trace;}
+if(this->m_ptr_glMultiTexCoord4sv){this->m_orig_glMultiTexCoord4sv = this->m_ptr_glMultiTexCoord4sv;this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&TraceTableDecorator::m_glMultiTexCoord4sv_trace;}
+if(this->m_ptr_glPNTrianglesiATI){this->m_orig_glPNTrianglesiATI = this->m_ptr_glPNTrianglesiATI;this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&TraceTableDecorator::m_glPNTrianglesiATI_trace;}
+if(this->m_ptr_glBindVertexArrayAPPLE){this->m_orig_glBindVertexArrayAPPLE = this->m_ptr_glBindVertexArrayAPPLE;this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&TraceTableDecorator::m_glBindVertexArrayAPPLE_trace;}
+if(this->m_ptr_glObjectPtrLabel){this->m_orig_glObjectPtrLabel = this->m_ptr_glObjectPtrLabel;this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&TraceTableDecorator::m_glObjectPtrLabel_trace;}
+if(this->m_ptr_glGetDebugMessageLog){this->m_orig_glGetDebugMessageLog = this->m_ptr_glGetDebugMessageLog;this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&TraceTableDecorator::m_glGetDebugMessageLog_trace;}
+if(this->m_ptr_glTrackMatrixNV){this->m_orig_glTrackMatrixNV = this->m_ptr_glTrackMatrixNV;this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&TraceTableDecorator::m_glTrackMatrixNV_trace;}
+if(this->m_ptr_glProgramPathFragmentInputGenNV){this->m_orig_glProgramPathFragmentInputGenNV = this->m_ptr_glProgramPathFragmentInputGenNV;this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&TraceTableDecorator::m_glProgramPathFragmentInputGenNV_trace;}
+if(this->m_ptr_glTangent3ivEXT){this->m_orig_glTangent3ivEXT = this->m_ptr_glTangent3ivEXT;this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&TraceTableDecorator::m_glTangent3ivEXT_trace;}
+if(this->m_ptr_glGetUniformfv){this->m_orig_glGetUniformfv = this->m_ptr_glGetUniformfv;this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&TraceTableDecorator::m_glGetUniformfv_trace;}
+if(this->m_ptr_glSecondaryColor3ubv){this->m_orig_glSecondaryColor3ubv = this->m_ptr_glSecondaryColor3ubv;this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&TraceTableDecorator::m_glSecondaryColor3ubv_trace;}
+if(this->m_ptr_glMakeTextureHandleNonResidentNV){this->m_orig_glMakeTextureHandleNonResidentNV = this->m_ptr_glMakeTextureHandleNonResidentNV;this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&TraceTableDecorator::m_glMakeTextureHandleNonResidentNV_trace;}
+if(this->m_ptr_glVertexAttribs4ubvNV){this->m_orig_glVertexAttribs4ubvNV = this->m_ptr_glVertexAttribs4ubvNV;this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&TraceTableDecorator::m_glVertexAttribs4ubvNV_trace;}
+if(this->m_ptr_glClipPlanexOES){this->m_orig_glClipPlanexOES = this->m_ptr_glClipPlanexOES;this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&TraceTableDecorator::m_glClipPlanexOES_trace;}
+if(this->m_ptr_glMultiTexCoord3iv){this->m_orig_glMultiTexCoord3iv = this->m_ptr_glMultiTexCoord3iv;this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&TraceTableDecorator::m_glMultiTexCoord3iv_trace;}
+if(this->m_ptr_glGetnPolygonStippleARB){this->m_orig_glGetnPolygonStippleARB = this->m_ptr_glGetnPolygonStippleARB;this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&TraceTableDecorator::m_glGetnPolygonStippleARB_trace;}
+if(this->m_ptr_glUniform2i64vNV){this->m_orig_glUniform2i64vNV = this->m_ptr_glUniform2i64vNV;this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&TraceTableDecorator::m_glUniform2i64vNV_trace;}
+if(this->m_ptr_glLightModelf){this->m_orig_glLightModelf = this->m_ptr_glLightModelf;this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&TraceTableDecorator::m_glLightModelf_trace;}
+if(this->m_ptr_glDeleteMemoryObjectsEXT){this->m_orig_glDeleteMemoryObjectsEXT = this->m_ptr_glDeleteMemoryObjectsEXT;this->m_ptr_glDeleteMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC)&TraceTableDecorator::m_glDeleteMemoryObjectsEXT_trace;}
+if(this->m_ptr_glMultiTexSubImage2DEXT){this->m_orig_glMultiTexSubImage2DEXT = this->m_ptr_glMultiTexSubImage2DEXT;this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glMultiTexSubImage2DEXT_trace;}
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN){this->m_orig_glReplacementCodeuiColor3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN;this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_trace;}
+if(this->m_ptr_glTangent3dvEXT){this->m_orig_glTangent3dvEXT = this->m_ptr_glTangent3dvEXT;this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&TraceTableDecorator::m_glTangent3dvEXT_trace;}
+if(this->m_ptr_glLightModeli){this->m_orig_glLightModeli = this->m_ptr_glLightModeli;this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&TraceTableDecorator::m_glLightModeli_trace;}
+if(this->m_ptr_glVertexWeighthvNV){this->m_orig_glVertexWeighthvNV = this->m_ptr_glVertexWeighthvNV;this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&TraceTableDecorator::m_glVertexWeighthvNV_trace;}
+if(this->m_ptr_glWindowPos3iv){this->m_orig_glWindowPos3iv = this->m_ptr_glWindowPos3iv;this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&TraceTableDecorator::m_glWindowPos3iv_trace;}
+if(this->m_ptr_glMultiTexCoordP1uiv){this->m_orig_glMultiTexCoordP1uiv = this->m_ptr_glMultiTexCoordP1uiv;this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&TraceTableDecorator::m_glMultiTexCoordP1uiv_trace;}
+if(this->m_ptr_glTransformPathNV){this->m_orig_glTransformPathNV = this->m_ptr_glTransformPathNV;this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&TraceTableDecorator::m_glTransformPathNV_trace;}
+if(this->m_ptr_glProgramNamedParameter4dNV){this->m_orig_glProgramNamedParameter4dNV = this->m_ptr_glProgramNamedParameter4dNV;this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&TraceTableDecorator::m_glProgramNamedParameter4dNV_trace;}
+if(this->m_ptr_glMultiDrawElementsIndirect){this->m_orig_glMultiDrawElementsIndirect = this->m_ptr_glMultiDrawElementsIndirect;this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&TraceTableDecorator::m_glMultiDrawElementsIndirect_trace;}
+if(this->m_ptr_glProgramUniform1dEXT){this->m_orig_glProgramUniform1dEXT = this->m_ptr_glProgramUniform1dEXT;this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&TraceTableDecorator::m_glProgramUniform1dEXT_trace;}
+if(this->m_ptr_glCallLists){this->m_orig_glCallLists = this->m_ptr_glCallLists;this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&TraceTableDecorator::m_glCallLists_trace;}
+if(this->m_ptr_glNormal3hvNV){this->m_orig_glNormal3hvNV = this->m_ptr_glNormal3hvNV;this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&TraceTableDecorator::m_glNormal3hvNV_trace;}
+if(this->m_ptr_glGetCombinerOutputParameterfvNV){this->m_orig_glGetCombinerOutputParameterfvNV = this->m_ptr_glGetCombinerOutputParameterfvNV;this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetCombinerOutputParameterfvNV_trace;}
+if(this->m_ptr_glVertexAttrib4sARB){this->m_orig_glVertexAttrib4sARB = this->m_ptr_glVertexAttrib4sARB;this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&TraceTableDecorator::m_glVertexAttrib4sARB_trace;}
+if(this->m_ptr_glTexCoord3i){this->m_orig_glTexCoord3i = this->m_ptr_glTexCoord3i;this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&TraceTableDecorator::m_glTexCoord3i_trace;}
+if(this->m_ptr_glVertexAttribI3uiv){this->m_orig_glVertexAttribI3uiv = this->m_ptr_glVertexAttribI3uiv;this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&TraceTableDecorator::m_glVertexAttribI3uiv_trace;}
+if(this->m_ptr_glPushDebugGroup){this->m_orig_glPushDebugGroup = this->m_ptr_glPushDebugGroup;this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&TraceTableDecorator::m_glPushDebugGroup_trace;}
+if(this->m_ptr_glTexCoord3f){this->m_orig_glTexCoord3f = this->m_ptr_glTexCoord3f;this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&TraceTableDecorator::m_glTexCoord3f_trace;}
+if(this->m_ptr_glTexCoord3d){this->m_orig_glTexCoord3d = this->m_ptr_glTexCoord3d;this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&TraceTableDecorator::m_glTexCoord3d_trace;}
+if(this->m_ptr_glTexCoord2xOES){this->m_orig_glTexCoord2xOES = this->m_ptr_glTexCoord2xOES;this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&TraceTableDecorator::m_glTexCoord2xOES_trace;}
+if(this->m_ptr_glGetStageIndexNV){this->m_orig_glGetStageIndexNV = this->m_ptr_glGetStageIndexNV;this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&TraceTableDecorator::m_glGetStageIndexNV_trace;}
+if(this->m_ptr_glProgramUniform4i64vNV){this->m_orig_glProgramUniform4i64vNV = this->m_ptr_glProgramUniform4i64vNV;this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&TraceTableDecorator::m_glProgramUniform4i64vNV_trace;}
+if(this->m_ptr_glGetNamedBufferPointervEXT){this->m_orig_glGetNamedBufferPointervEXT = this->m_ptr_glGetNamedBufferPointervEXT;this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&TraceTableDecorator::m_glGetNamedBufferPointervEXT_trace;}
+if(this->m_ptr_glTextureBarrierNV){this->m_orig_glTextureBarrierNV = this->m_ptr_glTextureBarrierNV;this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&TraceTableDecorator::m_glTextureBarrierNV_trace;}
+if(this->m_ptr_glColor4ubVertex3fvSUN){this->m_orig_glColor4ubVertex3fvSUN = this->m_ptr_glColor4ubVertex3fvSUN;this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&TraceTableDecorator::m_glColor4ubVertex3fvSUN_trace;}
+if(this->m_ptr_glGetCommandHeaderNV){this->m_orig_glGetCommandHeaderNV = this->m_ptr_glGetCommandHeaderNV;this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&TraceTableDecorator::m_glGetCommandHeaderNV_trace;}
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD){this->m_orig_glGetPerfMonitorCounterInfoAMD = this->m_ptr_glGetPerfMonitorCounterInfoAMD;this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&TraceTableDecorator::m_glGetPerfMonitorCounterInfoAMD_trace;}
+if(this->m_ptr_glVertexAttrib1svARB){this->m_orig_glVertexAttrib1svARB = this->m_ptr_glVertexAttrib1svARB;this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&TraceTableDecorator::m_glVertexAttrib1svARB_trace;}
+if(this->m_ptr_glCombinerParameteriNV){this->m_orig_glCombinerParameteriNV = this->m_ptr_glCombinerParameteriNV;this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&TraceTableDecorator::m_glCombinerParameteriNV_trace;}
+if(this->m_ptr_glMatrixMultTransposefEXT){this->m_orig_glMatrixMultTransposefEXT = this->m_ptr_glMatrixMultTransposefEXT;this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&TraceTableDecorator::m_glMatrixMultTransposefEXT_trace;}
+if(this->m_ptr_glDetailTexFuncSGIS){this->m_orig_glDetailTexFuncSGIS = this->m_ptr_glDetailTexFuncSGIS;this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&TraceTableDecorator::m_glDetailTexFuncSGIS_trace;}
+if(this->m_ptr_glAreTexturesResident){this->m_orig_glAreTexturesResident = this->m_ptr_glAreTexturesResident;this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&TraceTableDecorator::m_glAreTexturesResident_trace;}
+if(this->m_ptr_glProgramUniform2d){this->m_orig_glProgramUniform2d = this->m_ptr_glProgramUniform2d;this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&TraceTableDecorator::m_glProgramUniform2d_trace;}
+if(this->m_ptr_glGetConvolutionParameterfvEXT){this->m_orig_glGetConvolutionParameterfvEXT = this->m_ptr_glGetConvolutionParameterfvEXT;this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetConvolutionParameterfvEXT_trace;}
+if(this->m_ptr_glIndexPointerListIBM){this->m_orig_glIndexPointerListIBM = this->m_ptr_glIndexPointerListIBM;this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&TraceTableDecorator::m_glIndexPointerListIBM_trace;}
+if(this->m_ptr_glVertexAttribI4iEXT){this->m_orig_glVertexAttribI4iEXT = this->m_ptr_glVertexAttribI4iEXT;this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&TraceTableDecorator::m_glVertexAttribI4iEXT_trace;}
+if(this->m_ptr_glProgramUniform2f){this->m_orig_glProgramUniform2f = this->m_ptr_glProgramUniform2f;this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&TraceTableDecorator::m_glProgramUniform2f_trace;}
+if(this->m_ptr_glRasterPos4sv){this->m_orig_glRasterPos4sv = this->m_ptr_glRasterPos4sv;this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&TraceTableDecorator::m_glRasterPos4sv_trace;}
+if(this->m_ptr_glColor4s){this->m_orig_glColor4s = this->m_ptr_glColor4s;this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&TraceTableDecorator::m_glColor4s_trace;}
+if(this->m_ptr_glMulticastGetQueryObjectivNV){this->m_orig_glMulticastGetQueryObjectivNV = this->m_ptr_glMulticastGetQueryObjectivNV;this->m_ptr_glMulticastGetQueryObjectivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC)&TraceTableDecorator::m_glMulticastGetQueryObjectivNV_trace;}
+if(this->m_ptr_glColorFragmentOp3ATI){this->m_orig_glColorFragmentOp3ATI = this->m_ptr_glColorFragmentOp3ATI;this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&TraceTableDecorator::m_glColorFragmentOp3ATI_trace;}
+if(this->m_ptr_glResizeBuffersMESA){this->m_orig_glResizeBuffersMESA = this->m_ptr_glResizeBuffersMESA;this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&TraceTableDecorator::m_glResizeBuffersMESA_trace;}
+if(this->m_ptr_glGetMinmaxParameterfv){this->m_orig_glGetMinmaxParameterfv = this->m_ptr_glGetMinmaxParameterfv;this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&TraceTableDecorator::m_glGetMinmaxParameterfv_trace;}
+if(this->m_ptr_glClientActiveTextureARB){this->m_orig_glClientActiveTextureARB = this->m_ptr_glClientActiveTextureARB;this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&TraceTableDecorator::m_glClientActiveTextureARB_trace;}
+if(this->m_ptr_glBindVertexArray){this->m_orig_glBindVertexArray = this->m_ptr_glBindVertexArray;this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&TraceTableDecorator::m_glBindVertexArray_trace;}
+if(this->m_ptr_glColor4b){this->m_orig_glColor4b = this->m_ptr_glColor4b;this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&TraceTableDecorator::m_glColor4b_trace;}
+if(this->m_ptr_glColor4f){this->m_orig_glColor4f = this->m_ptr_glColor4f;this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&TraceTableDecorator::m_glColor4f_trace;}
+if(this->m_ptr_glColor4d){this->m_orig_glColor4d = this->m_ptr_glColor4d;this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&TraceTableDecorator::m_glColor4d_trace;}
+if(this->m_ptr_glColor4i){this->m_orig_glColor4i = this->m_ptr_glColor4i;this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&TraceTableDecorator::m_glColor4i_trace;}
+if(this->m_ptr_glEdgeFlagFormatNV){this->m_orig_glEdgeFlagFormatNV = this->m_ptr_glEdgeFlagFormatNV;this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&TraceTableDecorator::m_glEdgeFlagFormatNV_trace;}
+if(this->m_ptr_glNamedBufferSubData){this->m_orig_glNamedBufferSubData = this->m_ptr_glNamedBufferSubData;this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&TraceTableDecorator::m_glNamedBufferSubData_trace;}
+if(this->m_ptr_glDrawElementsInstanced){this->m_orig_glDrawElementsInstanced = this->m_ptr_glDrawElementsInstanced;this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&TraceTableDecorator::m_glDrawElementsInstanced_trace;}
+if(this->m_ptr_glGetMultiTexParameterIivEXT){this->m_orig_glGetMultiTexParameterIivEXT = this->m_ptr_glGetMultiTexParameterIivEXT;this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glGetMultiTexParameterIivEXT_trace;}
+if(this->m_ptr_glVertex2dv){this->m_orig_glVertex2dv = this->m_ptr_glVertex2dv;this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&TraceTableDecorator::m_glVertex2dv_trace;}
+if(this->m_ptr_glDisableVertexArrayAttribEXT){this->m_orig_glDisableVertexArrayAttribEXT = this->m_ptr_glDisableVertexArrayAttribEXT;this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&TraceTableDecorator::m_glDisableVertexArrayAttribEXT_trace;}
+if(this->m_ptr_glObjectUnpurgeableAPPLE){this->m_orig_glObjectUnpurgeableAPPLE = this->m_ptr_glObjectUnpurgeableAPPLE;this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&TraceTableDecorator::m_glObjectUnpurgeableAPPLE_trace;}
+if(this->m_ptr_glVertexAttribs2dvNV){this->m_orig_glVertexAttribs2dvNV = this->m_ptr_glVertexAttribs2dvNV;this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&TraceTableDecorator::m_glVertexAttribs2dvNV_trace;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN){this->m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_trace;}
+if(this->m_ptr_glGetMapParameterfvNV){this->m_orig_glGetMapParameterfvNV = this->m_ptr_glGetMapParameterfvNV;this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetMapParameterfvNV_trace;}
+if(this->m_ptr_glProgramUniform4ivEXT){this->m_orig_glProgramUniform4ivEXT = this->m_ptr_glProgramUniform4ivEXT;this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&TraceTableDecorator::m_glProgramUniform4ivEXT_trace;}
+if(this->m_ptr_glProgramUniform3ui64vNV){this->m_orig_glProgramUniform3ui64vNV = this->m_ptr_glProgramUniform3ui64vNV;this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&TraceTableDecorator::m_glProgramUniform3ui64vNV_trace;}
+if(this->m_ptr_glRectfv){this->m_orig_glRectfv = this->m_ptr_glRectfv;this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&TraceTableDecorator::m_glRectfv_trace;}
+if(this->m_ptr_glTexFilterFuncSGIS){this->m_orig_glTexFilterFuncSGIS = this->m_ptr_glTexFilterFuncSGIS;this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&TraceTableDecorator::m_glTexFilterFuncSGIS_trace;}
+if(this->m_ptr_glSpriteParameterfvSGIX){this->m_orig_glSpriteParameterfvSGIX = this->m_ptr_glSpriteParameterfvSGIX;this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&TraceTableDecorator::m_glSpriteParameterfvSGIX_trace;}
+if(this->m_ptr_glCopyMultiTexImage1DEXT){this->m_orig_glCopyMultiTexImage1DEXT = this->m_ptr_glCopyMultiTexImage1DEXT;this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&TraceTableDecorator::m_glCopyMultiTexImage1DEXT_trace;}
+if(this->m_ptr_glGetVertexAttribIuivEXT){this->m_orig_glGetVertexAttribIuivEXT = this->m_ptr_glGetVertexAttribIuivEXT;this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&TraceTableDecorator::m_glGetVertexAttribIuivEXT_trace;}
+if(this->m_ptr_glUniformMatrix2x4dv){this->m_orig_glUniformMatrix2x4dv = this->m_ptr_glUniformMatrix2x4dv;this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&TraceTableDecorator::m_glUniformMatrix2x4dv_trace;}
+if(this->m_ptr_glGetProgramResourceLocationIndex){this->m_orig_glGetProgramResourceLocationIndex = this->m_ptr_glGetProgramResourceLocationIndex;this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&TraceTableDecorator::m_glGetProgramResourceLocationIndex_trace;}
+if(this->m_ptr_glColor3hNV){this->m_orig_glColor3hNV = this->m_ptr_glColor3hNV;this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&TraceTableDecorator::m_glColor3hNV_trace;}
+if(this->m_ptr_glViewport){this->m_orig_glViewport = this->m_ptr_glViewport;this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&TraceTableDecorator::m_glViewport_trace;}
+if(this->m_ptr_glProgramNamedParameter4fNV){this->m_orig_glProgramNamedParameter4fNV = this->m_ptr_glProgramNamedParameter4fNV;this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&TraceTableDecorator::m_glProgramNamedParameter4fNV_trace;}
+if(this->m_ptr_glGetInvariantBooleanvEXT){this->m_orig_glGetInvariantBooleanvEXT = this->m_ptr_glGetInvariantBooleanvEXT;this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&TraceTableDecorator::m_glGetInvariantBooleanvEXT_trace;}
+if(this->m_ptr_glTexStorage2DMultisample){this->m_orig_glTexStorage2DMultisample = this->m_ptr_glTexStorage2DMultisample;this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&TraceTableDecorator::m_glTexStorage2DMultisample_trace;}
+if(this->m_ptr_glPixelStorex){this->m_orig_glPixelStorex = this->m_ptr_glPixelStorex;this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&TraceTableDecorator::m_glPixelStorex_trace;}
+if(this->m_ptr_glVertexAttribL1dvEXT){this->m_orig_glVertexAttribL1dvEXT = this->m_ptr_glVertexAttribL1dvEXT;this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&TraceTableDecorator::m_glVertexAttribL1dvEXT_trace;}
+if(this->m_ptr_glGetActiveSubroutineUniformiv){this->m_orig_glGetActiveSubroutineUniformiv = this->m_ptr_glGetActiveSubroutineUniformiv;this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&TraceTableDecorator::m_glGetActiveSubroutineUniformiv_trace;}
+if(this->m_ptr_glVertexAttribPointerARB){this->m_orig_glVertexAttribPointerARB = this->m_ptr_glVertexAttribPointerARB;this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&TraceTableDecorator::m_glVertexAttribPointerARB_trace;}
+if(this->m_ptr_glCompressedTexSubImage2DARB){this->m_orig_glCompressedTexSubImage2DARB = this->m_ptr_glCompressedTexSubImage2DARB;this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&TraceTableDecorator::m_glCompressedTexSubImage2DARB_trace;}
+if(this->m_ptr_glTexStorageMem1DEXT){this->m_orig_glTexStorageMem1DEXT = this->m_ptr_glTexStorageMem1DEXT;this->m_ptr_glTexStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC)&TraceTableDecorator::m_glTexStorageMem1DEXT_trace;}
+if(this->m_ptr_glVertex2hvNV){this->m_orig_glVertex2hvNV = this->m_ptr_glVertex2hvNV;this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&TraceTableDecorator::m_glVertex2hvNV_trace;}
+if(this->m_ptr_glTexBuffer){this->m_orig_glTexBuffer = this->m_ptr_glTexBuffer;this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&TraceTableDecorator::m_glTexBuffer_trace;}
+if(this->m_ptr_glArrayElement){this->m_orig_glArrayElement = this->m_ptr_glArrayElement;this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&TraceTableDecorator::m_glArrayElement_trace;}
+if(this->m_ptr_glValidateProgram){this->m_orig_glValidateProgram = this->m_ptr_glValidateProgram;this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&TraceTableDecorator::m_glValidateProgram_trace;}
+if(this->m_ptr_glPixelStoref){this->m_orig_glPixelStoref = this->m_ptr_glPixelStoref;this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&TraceTableDecorator::m_glPixelStoref_trace;}
+if(this->m_ptr_glWindowPos3dARB){this->m_orig_glWindowPos3dARB = this->m_ptr_glWindowPos3dARB;this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&TraceTableDecorator::m_glWindowPos3dARB_trace;}
+if(this->m_ptr_glEvalCoord1dv){this->m_orig_glEvalCoord1dv = this->m_ptr_glEvalCoord1dv;this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&TraceTableDecorator::m_glEvalCoord1dv_trace;}
+if(this->m_ptr_glVertexAttribs2fvNV){this->m_orig_glVertexAttribs2fvNV = this->m_ptr_glVertexAttribs2fvNV;this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&TraceTableDecorator::m_glVertexAttribs2fvNV_trace;}
+if(this->m_ptr_glRecti){this->m_orig_glRecti = this->m_ptr_glRecti;this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&TraceTableDecorator::m_glRecti_trace;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glTexCoord1bOES){this->m_orig_glTexCoord1bOES = this->m_ptr_glTexCoord1bOES;this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&TraceTableDecorator::m_glTexCoord1bOES_trace;}
+if(this->m_ptr_glProgramUniform2i64vARB){this->m_orig_glProgramUniform2i64vARB = this->m_ptr_glProgramUniform2i64vARB;this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&TraceTableDecorator::m_glProgramUniform2i64vARB_trace;}
+if(this->m_ptr_glWindowPos2dARB){this->m_orig_glWindowPos2dARB = this->m_ptr_glWindowPos2dARB;this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&TraceTableDecorator::m_glWindowPos2dARB_trace;}
+if(this->m_ptr_glGetProgramParameterdvNV){this->m_orig_glGetProgramParameterdvNV = this->m_ptr_glGetProgramParameterdvNV;this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&TraceTableDecorator::m_glGetProgramParameterdvNV_trace;}
+if(this->m_ptr_glRectf){this->m_orig_glRectf = this->m_ptr_glRectf;this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&TraceTableDecorator::m_glRectf_trace;}
+if(this->m_ptr_glRectd){this->m_orig_glRectd = this->m_ptr_glRectd;this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&TraceTableDecorator::m_glRectd_trace;}
+if(this->m_ptr_glMap1xOES){this->m_orig_glMap1xOES = this->m_ptr_glMap1xOES;this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&TraceTableDecorator::m_glMap1xOES_trace;}
+if(this->m_ptr_glVertexAttrib3fvNV){this->m_orig_glVertexAttrib3fvNV = this->m_ptr_glVertexAttrib3fvNV;this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&TraceTableDecorator::m_glVertexAttrib3fvNV_trace;}
+if(this->m_ptr_glReferencePlaneSGIX){this->m_orig_glReferencePlaneSGIX = this->m_ptr_glReferencePlaneSGIX;this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&TraceTableDecorator::m_glReferencePlaneSGIX_trace;}
+if(this->m_ptr_glMulticastBlitFramebufferNV){this->m_orig_glMulticastBlitFramebufferNV = this->m_ptr_glMulticastBlitFramebufferNV;this->m_ptr_glMulticastBlitFramebufferNV = (FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC)&TraceTableDecorator::m_glMulticastBlitFramebufferNV_trace;}
+if(this->m_ptr_glGetCombinerInputParameterfvNV){this->m_orig_glGetCombinerInputParameterfvNV = this->m_ptr_glGetCombinerInputParameterfvNV;this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetCombinerInputParameterfvNV_trace;}
+if(this->m_ptr_glGetTextureSamplerHandleARB){this->m_orig_glGetTextureSamplerHandleARB = this->m_ptr_glGetTextureSamplerHandleARB;this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&TraceTableDecorator::m_glGetTextureSamplerHandleARB_trace;}
+if(this->m_ptr_glBindTexture){this->m_orig_glBindTexture = this->m_ptr_glBindTexture;this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&TraceTableDecorator::m_glBindTexture_trace;}
+if(this->m_ptr_glRects){this->m_orig_glRects = this->m_ptr_glRects;this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&TraceTableDecorator::m_glRects_trace;}
+if(this->m_ptr_glGetActiveAttribARB){this->m_orig_glGetActiveAttribARB = this->m_ptr_glGetActiveAttribARB;this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&TraceTableDecorator::m_glGetActiveAttribARB_trace;}
+if(this->m_ptr_glHistogramEXT){this->m_orig_glHistogramEXT = this->m_ptr_glHistogramEXT;this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&TraceTableDecorator::m_glHistogramEXT_trace;}
+if(this->m_ptr_glGetTextureSamplerHandleNV){this->m_orig_glGetTextureSamplerHandleNV = this->m_ptr_glGetTextureSamplerHandleNV;this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&TraceTableDecorator::m_glGetTextureSamplerHandleNV_trace;}
+if(this->m_ptr_glDetachShader){this->m_orig_glDetachShader = this->m_ptr_glDetachShader;this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&TraceTableDecorator::m_glDetachShader_trace;}
+if(this->m_ptr_glFinishTextureSUNX){this->m_orig_glFinishTextureSUNX = this->m_ptr_glFinishTextureSUNX;this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&TraceTableDecorator::m_glFinishTextureSUNX_trace;}
+if(this->m_ptr_glUniformMatrix3x4dv){this->m_orig_glUniformMatrix3x4dv = this->m_ptr_glUniformMatrix3x4dv;this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&TraceTableDecorator::m_glUniformMatrix3x4dv_trace;}
+if(this->m_ptr_glVertexAttrib4fARB){this->m_orig_glVertexAttrib4fARB = this->m_ptr_glVertexAttrib4fARB;this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&TraceTableDecorator::m_glVertexAttrib4fARB_trace;}
+if(this->m_ptr_glGetPathColorGenivNV){this->m_orig_glGetPathColorGenivNV = this->m_ptr_glGetPathColorGenivNV;this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&TraceTableDecorator::m_glGetPathColorGenivNV_trace;}
+if(this->m_ptr_glGetProgramResourceLocation){this->m_orig_glGetProgramResourceLocation = this->m_ptr_glGetProgramResourceLocation;this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&TraceTableDecorator::m_glGetProgramResourceLocation_trace;}
+if(this->m_ptr_glVertexArrayAttribLFormat){this->m_orig_glVertexArrayAttribLFormat = this->m_ptr_glVertexArrayAttribLFormat;this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&TraceTableDecorator::m_glVertexArrayAttribLFormat_trace;}
+if(this->m_ptr_glGetTexLevelParameterfv){this->m_orig_glGetTexLevelParameterfv = this->m_ptr_glGetTexLevelParameterfv;this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&TraceTableDecorator::m_glGetTexLevelParameterfv_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT){this->m_orig_glVertexArrayVertexAttribOffsetEXT = this->m_ptr_glVertexArrayVertexAttribOffsetEXT;this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_trace;}
+if(this->m_ptr_glIndexFormatNV){this->m_orig_glIndexFormatNV = this->m_ptr_glIndexFormatNV;this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&TraceTableDecorator::m_glIndexFormatNV_trace;}
+if(this->m_ptr_glMultiTexCoord3i){this->m_orig_glMultiTexCoord3i = this->m_ptr_glMultiTexCoord3i;this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&TraceTableDecorator::m_glMultiTexCoord3i_trace;}
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN){this->m_orig_glReplacementCodeuiVertex3fvSUN = this->m_ptr_glReplacementCodeuiVertex3fvSUN;this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiVertex3fvSUN_trace;}
+if(this->m_ptr_glViewportIndexedfv){this->m_orig_glViewportIndexedfv = this->m_ptr_glViewportIndexedfv;this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&TraceTableDecorator::m_glViewportIndexedfv_trace;}
+if(this->m_ptr_glBindBuffersBase){this->m_orig_glBindBuffersBase = this->m_ptr_glBindBuffersBase;this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&TraceTableDecorator::m_glBindBuffersBase_trace;}
+if(this->m_ptr_glTexBumpParameterfvATI){this->m_orig_glTexBumpParameterfvATI = this->m_ptr_glTexBumpParameterfvATI;this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&TraceTableDecorator::m_glTexBumpParameterfvATI_trace;}
+if(this->m_ptr_glMatrixIndexuivARB){this->m_orig_glMatrixIndexuivARB = this->m_ptr_glMatrixIndexuivARB;this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&TraceTableDecorator::m_glMatrixIndexuivARB_trace;}
+if(this->m_ptr_glVertexAttrib1hNV){this->m_orig_glVertexAttrib1hNV = this->m_ptr_glVertexAttrib1hNV;this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&TraceTableDecorator::m_glVertexAttrib1hNV_trace;}
+if(this->m_ptr_glWindowPos3svMESA){this->m_orig_glWindowPos3svMESA = this->m_ptr_glWindowPos3svMESA;this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&TraceTableDecorator::m_glWindowPos3svMESA_trace;}
+if(this->m_ptr_glStencilOpSeparateATI){this->m_orig_glStencilOpSeparateATI = this->m_ptr_glStencilOpSeparateATI;this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&TraceTableDecorator::m_glStencilOpSeparateATI_trace;}
+if(this->m_ptr_glDrawElementsBaseVertex){this->m_orig_glDrawElementsBaseVertex = this->m_ptr_glDrawElementsBaseVertex;this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&TraceTableDecorator::m_glDrawElementsBaseVertex_trace;}
+if(this->m_ptr_glBlendEquationSeparateiARB){this->m_orig_glBlendEquationSeparateiARB = this->m_ptr_glBlendEquationSeparateiARB;this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&TraceTableDecorator::m_glBlendEquationSeparateiARB_trace;}
+if(this->m_ptr_glVertexAttrib1fNV){this->m_orig_glVertexAttrib1fNV = this->m_ptr_glVertexAttrib1fNV;this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&TraceTableDecorator::m_glVertexAttrib1fNV_trace;}
+if(this->m_ptr_glMapVertexAttrib2fAPPLE){this->m_orig_glMapVertexAttrib2fAPPLE = this->m_ptr_glMapVertexAttrib2fAPPLE;this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&TraceTableDecorator::m_glMapVertexAttrib2fAPPLE_trace;}
+if(this->m_ptr_glCompressedTextureSubImage1DEXT){this->m_orig_glCompressedTextureSubImage1DEXT = this->m_ptr_glCompressedTextureSubImage1DEXT;this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glCompressedTextureSubImage1DEXT_trace;}
+if(this->m_ptr_glClearBufferSubData){this->m_orig_glClearBufferSubData = this->m_ptr_glClearBufferSubData;this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&TraceTableDecorator::m_glClearBufferSubData_trace;}
+if(this->m_ptr_glTexStorage1D){this->m_orig_glTexStorage1D = this->m_ptr_glTexStorage1D;this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&TraceTableDecorator::m_glTexStorage1D_trace;}
+if(this->m_ptr_glVertexAttribI3iEXT){this->m_orig_glVertexAttribI3iEXT = this->m_ptr_glVertexAttribI3iEXT;this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&TraceTableDecorator::m_glVertexAttribI3iEXT_trace;}
+if(this->m_ptr_glMakeTextureHandleNonResidentARB){this->m_orig_glMakeTextureHandleNonResidentARB = this->m_ptr_glMakeTextureHandleNonResidentARB;this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&TraceTableDecorator::m_glMakeTextureHandleNonResidentARB_trace;}
+if(this->m_ptr_glMultiDrawElementArrayAPPLE){this->m_orig_glMultiDrawElementArrayAPPLE = this->m_ptr_glMultiDrawElementArrayAPPLE;this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&TraceTableDecorator::m_glMultiDrawElementArrayAPPLE_trace;}
+if(this->m_ptr_glVertexStream4dATI){this->m_orig_glVertexStream4dATI = this->m_ptr_glVertexStream4dATI;this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&TraceTableDecorator::m_glVertexStream4dATI_trace;}
+if(this->m_ptr_glProgramUniformMatrix2dvEXT){this->m_orig_glProgramUniformMatrix2dvEXT = this->m_ptr_glProgramUniformMatrix2dvEXT;this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix2dvEXT_trace;}
+if(this->m_ptr_glVertexAttribs2hvNV){this->m_orig_glVertexAttribs2hvNV = this->m_ptr_glVertexAttribs2hvNV;this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&TraceTableDecorator::m_glVertexAttribs2hvNV_trace;}
+if(this->m_ptr_glGetUniformiv){this->m_orig_glGetUniformiv = this->m_ptr_glGetUniformiv;this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&TraceTableDecorator::m_glGetUniformiv_trace;}
+if(this->m_ptr_glClipPlanefOES){this->m_orig_glClipPlanefOES = this->m_ptr_glClipPlanefOES;this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&TraceTableDecorator::m_glClipPlanefOES_trace;}
+if(this->m_ptr_glRenderbufferStorage){this->m_orig_glRenderbufferStorage = this->m_ptr_glRenderbufferStorage;this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&TraceTableDecorator::m_glRenderbufferStorage_trace;}
+if(this->m_ptr_glUniform4ui){this->m_orig_glUniform4ui = this->m_ptr_glUniform4ui;this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&TraceTableDecorator::m_glUniform4ui_trace;}
+if(this->m_ptr_glBindFramebuffer){this->m_orig_glBindFramebuffer = this->m_ptr_glBindFramebuffer;this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&TraceTableDecorator::m_glBindFramebuffer_trace;}
+if(this->m_ptr_glValidateProgramARB){this->m_orig_glValidateProgramARB = this->m_ptr_glValidateProgramARB;this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&TraceTableDecorator::m_glValidateProgramARB_trace;}
+if(this->m_ptr_glTexGenf){this->m_orig_glTexGenf = this->m_ptr_glTexGenf;this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&TraceTableDecorator::m_glTexGenf_trace;}
+if(this->m_ptr_glTexGend){this->m_orig_glTexGend = this->m_ptr_glTexGend;this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&TraceTableDecorator::m_glTexGend_trace;}
+if(this->m_ptr_glTexGeni){this->m_orig_glTexGeni = this->m_ptr_glTexGeni;this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&TraceTableDecorator::m_glTexGeni_trace;}
+if(this->m_ptr_glDeleteFramebuffersEXT){this->m_orig_glDeleteFramebuffersEXT = this->m_ptr_glDeleteFramebuffersEXT;this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&TraceTableDecorator::m_glDeleteFramebuffersEXT_trace;}
+if(this->m_ptr_glResetMinmaxEXT){this->m_orig_glResetMinmaxEXT = this->m_ptr_glResetMinmaxEXT;this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&TraceTableDecorator::m_glResetMinmaxEXT_trace;}
+if(this->m_ptr_glVertexAttrib1fvNV){this->m_orig_glVertexAttrib1fvNV = this->m_ptr_glVertexAttrib1fvNV;this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&TraceTableDecorator::m_glVertexAttrib1fvNV_trace;}
+if(this->m_ptr_glIsQueryARB){this->m_orig_glIsQueryARB = this->m_ptr_glIsQueryARB;this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&TraceTableDecorator::m_glIsQueryARB_trace;}
+if(this->m_ptr_glEnableVariantClientStateEXT){this->m_orig_glEnableVariantClientStateEXT = this->m_ptr_glEnableVariantClientStateEXT;this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&TraceTableDecorator::m_glEnableVariantClientStateEXT_trace;}
+if(this->m_ptr_glScissorIndexed){this->m_orig_glScissorIndexed = this->m_ptr_glScissorIndexed;this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&TraceTableDecorator::m_glScissorIndexed_trace;}
+if(this->m_ptr_glGetInvariantIntegervEXT){this->m_orig_glGetInvariantIntegervEXT = this->m_ptr_glGetInvariantIntegervEXT;this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&TraceTableDecorator::m_glGetInvariantIntegervEXT_trace;}
+if(this->m_ptr_glProgramLocalParameterI4uiNV){this->m_orig_glProgramLocalParameterI4uiNV = this->m_ptr_glProgramLocalParameterI4uiNV;this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&TraceTableDecorator::m_glProgramLocalParameterI4uiNV_trace;}
+if(this->m_ptr_glConvolutionParameterxvOES){this->m_orig_glConvolutionParameterxvOES = this->m_ptr_glConvolutionParameterxvOES;this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&TraceTableDecorator::m_glConvolutionParameterxvOES_trace;}
+if(this->m_ptr_glGenFramebuffersEXT){this->m_orig_glGenFramebuffersEXT = this->m_ptr_glGenFramebuffersEXT;this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&TraceTableDecorator::m_glGenFramebuffersEXT_trace;}
+if(this->m_ptr_glVertexArrayColorOffsetEXT){this->m_orig_glVertexArrayColorOffsetEXT = this->m_ptr_glVertexArrayColorOffsetEXT;this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayColorOffsetEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3ivARB){this->m_orig_glMultiTexCoord3ivARB = this->m_ptr_glMultiTexCoord3ivARB;this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&TraceTableDecorator::m_glMultiTexCoord3ivARB_trace;}
+if(this->m_ptr_glVertexWeightfEXT){this->m_orig_glVertexWeightfEXT = this->m_ptr_glVertexWeightfEXT;this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&TraceTableDecorator::m_glVertexWeightfEXT_trace;}
+if(this->m_ptr_glRasterPos4dv){this->m_orig_glRasterPos4dv = this->m_ptr_glRasterPos4dv;this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&TraceTableDecorator::m_glRasterPos4dv_trace;}
+if(this->m_ptr_glIsTextureHandleResidentARB){this->m_orig_glIsTextureHandleResidentARB = this->m_ptr_glIsTextureHandleResidentARB;this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&TraceTableDecorator::m_glIsTextureHandleResidentARB_trace;}
+if(this->m_ptr_glRasterPos2dv){this->m_orig_glRasterPos2dv = this->m_ptr_glRasterPos2dv;this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&TraceTableDecorator::m_glRasterPos2dv_trace;}
+if(this->m_ptr_glWindowPos4ivMESA){this->m_orig_glWindowPos4ivMESA = this->m_ptr_glWindowPos4ivMESA;this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&TraceTableDecorator::m_glWindowPos4ivMESA_trace;}
+if(this->m_ptr_glGetVariantPointervEXT){this->m_orig_glGetVariantPointervEXT = this->m_ptr_glGetVariantPointervEXT;this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&TraceTableDecorator::m_glGetVariantPointervEXT_trace;}
+if(this->m_ptr_glMapNamedBufferRangeEXT){this->m_orig_glMapNamedBufferRangeEXT = this->m_ptr_glMapNamedBufferRangeEXT;this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&TraceTableDecorator::m_glMapNamedBufferRangeEXT_trace;}
+if(this->m_ptr_glGetnUniformui64vARB){this->m_orig_glGetnUniformui64vARB = this->m_ptr_glGetnUniformui64vARB;this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&TraceTableDecorator::m_glGetnUniformui64vARB_trace;}
+if(this->m_ptr_glCreateShaderProgramv){this->m_orig_glCreateShaderProgramv = this->m_ptr_glCreateShaderProgramv;this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&TraceTableDecorator::m_glCreateShaderProgramv_trace;}
+if(this->m_ptr_glGetQueryObjectiv){this->m_orig_glGetQueryObjectiv = this->m_ptr_glGetQueryObjectiv;this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&TraceTableDecorator::m_glGetQueryObjectiv_trace;}
+if(this->m_ptr_glMaxShaderCompilerThreadsKHR){this->m_orig_glMaxShaderCompilerThreadsKHR = this->m_ptr_glMaxShaderCompilerThreadsKHR;this->m_ptr_glMaxShaderCompilerThreadsKHR = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC)&TraceTableDecorator::m_glMaxShaderCompilerThreadsKHR_trace;}
+if(this->m_ptr_glPNTrianglesfATI){this->m_orig_glPNTrianglesfATI = this->m_ptr_glPNTrianglesfATI;this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&TraceTableDecorator::m_glPNTrianglesfATI_trace;}
+if(this->m_ptr_glGlobalAlphaFactorusSUN){this->m_orig_glGlobalAlphaFactorusSUN = this->m_ptr_glGlobalAlphaFactorusSUN;this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactorusSUN_trace;}
+if(this->m_ptr_glVertexAttrib3dvNV){this->m_orig_glVertexAttrib3dvNV = this->m_ptr_glVertexAttrib3dvNV;this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&TraceTableDecorator::m_glVertexAttrib3dvNV_trace;}
+if(this->m_ptr_glMultiTexCoord3sARB){this->m_orig_glMultiTexCoord3sARB = this->m_ptr_glMultiTexCoord3sARB;this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&TraceTableDecorator::m_glMultiTexCoord3sARB_trace;}
+if(this->m_ptr_glGenerateMipmap){this->m_orig_glGenerateMipmap = this->m_ptr_glGenerateMipmap;this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&TraceTableDecorator::m_glGenerateMipmap_trace;}
+if(this->m_ptr_glCompressedTextureSubImage2D){this->m_orig_glCompressedTextureSubImage2D = this->m_ptr_glCompressedTextureSubImage2D;this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&TraceTableDecorator::m_glCompressedTextureSubImage2D_trace;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT){this->m_orig_glNamedRenderbufferStorageMultisampleEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleEXT;this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_trace;}
+if(this->m_ptr_glPolygonOffsetClampEXT){this->m_orig_glPolygonOffsetClampEXT = this->m_ptr_glPolygonOffsetClampEXT;this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&TraceTableDecorator::m_glPolygonOffsetClampEXT_trace;}
+if(this->m_ptr_glTextureRangeAPPLE){this->m_orig_glTextureRangeAPPLE = this->m_ptr_glTextureRangeAPPLE;this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&TraceTableDecorator::m_glTextureRangeAPPLE_trace;}
+if(this->m_ptr_glBlendEquationIndexedAMD){this->m_orig_glBlendEquationIndexedAMD = this->m_ptr_glBlendEquationIndexedAMD;this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&TraceTableDecorator::m_glBlendEquationIndexedAMD_trace;}
+if(this->m_ptr_glTexCoord2d){this->m_orig_glTexCoord2d = this->m_ptr_glTexCoord2d;this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&TraceTableDecorator::m_glTexCoord2d_trace;}
+if(this->m_ptr_glPointParameteri){this->m_orig_glPointParameteri = this->m_ptr_glPointParameteri;this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&TraceTableDecorator::m_glPointParameteri_trace;}
+if(this->m_ptr_glTexCoord2f){this->m_orig_glTexCoord2f = this->m_ptr_glTexCoord2f;this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&TraceTableDecorator::m_glTexCoord2f_trace;}
+if(this->m_ptr_glGetUnsignedBytei_vEXT){this->m_orig_glGetUnsignedBytei_vEXT = this->m_ptr_glGetUnsignedBytei_vEXT;this->m_ptr_glGetUnsignedBytei_vEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC)&TraceTableDecorator::m_glGetUnsignedBytei_vEXT_trace;}
+if(this->m_ptr_glColor4iv){this->m_orig_glColor4iv = this->m_ptr_glColor4iv;this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&TraceTableDecorator::m_glColor4iv_trace;}
+if(this->m_ptr_glMapNamedBufferRange){this->m_orig_glMapNamedBufferRange = this->m_ptr_glMapNamedBufferRange;this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&TraceTableDecorator::m_glMapNamedBufferRange_trace;}
+if(this->m_ptr_glUnmapBuffer){this->m_orig_glUnmapBuffer = this->m_ptr_glUnmapBuffer;this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&TraceTableDecorator::m_glUnmapBuffer_trace;}
+if(this->m_ptr_glSampleMaskEXT){this->m_orig_glSampleMaskEXT = this->m_ptr_glSampleMaskEXT;this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&TraceTableDecorator::m_glSampleMaskEXT_trace;}
+if(this->m_ptr_glTexCoord2i){this->m_orig_glTexCoord2i = this->m_ptr_glTexCoord2i;this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&TraceTableDecorator::m_glTexCoord2i_trace;}
+if(this->m_ptr_glTexCoord1xvOES){this->m_orig_glTexCoord1xvOES = this->m_ptr_glTexCoord1xvOES;this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&TraceTableDecorator::m_glTexCoord1xvOES_trace;}
+if(this->m_ptr_glVertexAttrib1sARB){this->m_orig_glVertexAttrib1sARB = this->m_ptr_glVertexAttrib1sARB;this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&TraceTableDecorator::m_glVertexAttrib1sARB_trace;}
+if(this->m_ptr_glGetVertexArrayiv){this->m_orig_glGetVertexArrayiv = this->m_ptr_glGetVertexArrayiv;this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&TraceTableDecorator::m_glGetVertexArrayiv_trace;}
+if(this->m_ptr_glProgramParameter4dvNV){this->m_orig_glProgramParameter4dvNV = this->m_ptr_glProgramParameter4dvNV;this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&TraceTableDecorator::m_glProgramParameter4dvNV_trace;}
+if(this->m_ptr_glTexCoord2s){this->m_orig_glTexCoord2s = this->m_ptr_glTexCoord2s;this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&TraceTableDecorator::m_glTexCoord2s_trace;}
+if(this->m_ptr_glTextureParameterIuivEXT){this->m_orig_glTextureParameterIuivEXT = this->m_ptr_glTextureParameterIuivEXT;this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glTextureParameterIuivEXT_trace;}
+if(this->m_ptr_glGetColorTableParameterfvSGI){this->m_orig_glGetColorTableParameterfvSGI = this->m_ptr_glGetColorTableParameterfvSGI;this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&TraceTableDecorator::m_glGetColorTableParameterfvSGI_trace;}
+if(this->m_ptr_glTexCoord4dv){this->m_orig_glTexCoord4dv = this->m_ptr_glTexCoord4dv;this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&TraceTableDecorator::m_glTexCoord4dv_trace;}
+if(this->m_ptr_glVertexAttrib1svNV){this->m_orig_glVertexAttrib1svNV = this->m_ptr_glVertexAttrib1svNV;this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&TraceTableDecorator::m_glVertexAttrib1svNV_trace;}
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT){this->m_orig_glNamedFramebufferTextureFaceEXT = this->m_ptr_glNamedFramebufferTextureFaceEXT;this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&TraceTableDecorator::m_glNamedFramebufferTextureFaceEXT_trace;}
+if(this->m_ptr_glProgramUniform2ui64vNV){this->m_orig_glProgramUniform2ui64vNV = this->m_ptr_glProgramUniform2ui64vNV;this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&TraceTableDecorator::m_glProgramUniform2ui64vNV_trace;}
+if(this->m_ptr_glStencilFillPathNV){this->m_orig_glStencilFillPathNV = this->m_ptr_glStencilFillPathNV;this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&TraceTableDecorator::m_glStencilFillPathNV_trace;}
+if(this->m_ptr_glNormal3dv){this->m_orig_glNormal3dv = this->m_ptr_glNormal3dv;this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&TraceTableDecorator::m_glNormal3dv_trace;}
+if(this->m_ptr_glReleaseShaderCompiler){this->m_orig_glReleaseShaderCompiler = this->m_ptr_glReleaseShaderCompiler;this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&TraceTableDecorator::m_glReleaseShaderCompiler_trace;}
+if(this->m_ptr_glTexStorageMem3DEXT){this->m_orig_glTexStorageMem3DEXT = this->m_ptr_glTexStorageMem3DEXT;this->m_ptr_glTexStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC)&TraceTableDecorator::m_glTexStorageMem3DEXT_trace;}
+if(this->m_ptr_glTexCoord3bvOES){this->m_orig_glTexCoord3bvOES = this->m_ptr_glTexCoord3bvOES;this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&TraceTableDecorator::m_glTexCoord3bvOES_trace;}
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE){this->m_orig_glIsVertexAttribEnabledAPPLE = this->m_ptr_glIsVertexAttribEnabledAPPLE;this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&TraceTableDecorator::m_glIsVertexAttribEnabledAPPLE_trace;}
+if(this->m_ptr_glTexCoord1dv){this->m_orig_glTexCoord1dv = this->m_ptr_glTexCoord1dv;this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&TraceTableDecorator::m_glTexCoord1dv_trace;}
+if(this->m_ptr_glReadPixels){this->m_orig_glReadPixels = this->m_ptr_glReadPixels;this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&TraceTableDecorator::m_glReadPixels_trace;}
+if(this->m_ptr_glVertexAttribI3iv){this->m_orig_glVertexAttribI3iv = this->m_ptr_glVertexAttribI3iv;this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&TraceTableDecorator::m_glVertexAttribI3iv_trace;}
+if(this->m_ptr_glSetFenceAPPLE){this->m_orig_glSetFenceAPPLE = this->m_ptr_glSetFenceAPPLE;this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&TraceTableDecorator::m_glSetFenceAPPLE_trace;}
+if(this->m_ptr_glWeightsvARB){this->m_orig_glWeightsvARB = this->m_ptr_glWeightsvARB;this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&TraceTableDecorator::m_glWeightsvARB_trace;}
+if(this->m_ptr_glShadeModel){this->m_orig_glShadeModel = this->m_ptr_glShadeModel;this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&TraceTableDecorator::m_glShadeModel_trace;}
+if(this->m_ptr_glTextureStorageMem3DMultisampleEXT){this->m_orig_glTextureStorageMem3DMultisampleEXT = this->m_ptr_glTextureStorageMem3DMultisampleEXT;this->m_ptr_glTextureStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glTextureStorageMem3DMultisampleEXT_trace;}
+if(this->m_ptr_glMapGrid1d){this->m_orig_glMapGrid1d = this->m_ptr_glMapGrid1d;this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&TraceTableDecorator::m_glMapGrid1d_trace;}
+if(this->m_ptr_glGetHistogramParameterivEXT){this->m_orig_glGetHistogramParameterivEXT = this->m_ptr_glGetHistogramParameterivEXT;this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetHistogramParameterivEXT_trace;}
+if(this->m_ptr_glConservativeRasterParameteriNV){this->m_orig_glConservativeRasterParameteriNV = this->m_ptr_glConservativeRasterParameteriNV;this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&TraceTableDecorator::m_glConservativeRasterParameteriNV_trace;}
+if(this->m_ptr_glClearNamedBufferData){this->m_orig_glClearNamedBufferData = this->m_ptr_glClearNamedBufferData;this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&TraceTableDecorator::m_glClearNamedBufferData_trace;}
+if(this->m_ptr_glClearDepthf){this->m_orig_glClearDepthf = this->m_ptr_glClearDepthf;this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&TraceTableDecorator::m_glClearDepthf_trace;}
+if(this->m_ptr_glCreatePerfQueryINTEL){this->m_orig_glCreatePerfQueryINTEL = this->m_ptr_glCreatePerfQueryINTEL;this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&TraceTableDecorator::m_glCreatePerfQueryINTEL_trace;}
+if(this->m_ptr_glFogCoordfEXT){this->m_orig_glFogCoordfEXT = this->m_ptr_glFogCoordfEXT;this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&TraceTableDecorator::m_glFogCoordfEXT_trace;}
+if(this->m_ptr_glVertexAttrib2dARB){this->m_orig_glVertexAttrib2dARB = this->m_ptr_glVertexAttrib2dARB;this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&TraceTableDecorator::m_glVertexAttrib2dARB_trace;}
+if(this->m_ptr_glMultiTexCoord4dARB){this->m_orig_glMultiTexCoord4dARB = this->m_ptr_glMultiTexCoord4dARB;this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&TraceTableDecorator::m_glMultiTexCoord4dARB_trace;}
+if(this->m_ptr_glReadnPixelsARB){this->m_orig_glReadnPixelsARB = this->m_ptr_glReadnPixelsARB;this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&TraceTableDecorator::m_glReadnPixelsARB_trace;}
+if(this->m_ptr_glMultiTexBufferEXT){this->m_orig_glMultiTexBufferEXT = this->m_ptr_glMultiTexBufferEXT;this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&TraceTableDecorator::m_glMultiTexBufferEXT_trace;}
+if(this->m_ptr_glWindowPos4dvMESA){this->m_orig_glWindowPos4dvMESA = this->m_ptr_glWindowPos4dvMESA;this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&TraceTableDecorator::m_glWindowPos4dvMESA_trace;}
+if(this->m_ptr_glInvalidateNamedFramebufferData){this->m_orig_glInvalidateNamedFramebufferData = this->m_ptr_glInvalidateNamedFramebufferData;this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&TraceTableDecorator::m_glInvalidateNamedFramebufferData_trace;}
+if(this->m_ptr_glSecondaryColorPointerListIBM){this->m_orig_glSecondaryColorPointerListIBM = this->m_ptr_glSecondaryColorPointerListIBM;this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&TraceTableDecorator::m_glSecondaryColorPointerListIBM_trace;}
+if(this->m_ptr_glRectiv){this->m_orig_glRectiv = this->m_ptr_glRectiv;this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&TraceTableDecorator::m_glRectiv_trace;}
+if(this->m_ptr_glColorP4ui){this->m_orig_glColorP4ui = this->m_ptr_glColorP4ui;this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&TraceTableDecorator::m_glColorP4ui_trace;}
+if(this->m_ptr_glUseProgramStages){this->m_orig_glUseProgramStages = this->m_ptr_glUseProgramStages;this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&TraceTableDecorator::m_glUseProgramStages_trace;}
+if(this->m_ptr_glRasterPos3dv){this->m_orig_glRasterPos3dv = this->m_ptr_glRasterPos3dv;this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&TraceTableDecorator::m_glRasterPos3dv_trace;}
+if(this->m_ptr_glPathTexGenNV){this->m_orig_glPathTexGenNV = this->m_ptr_glPathTexGenNV;this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&TraceTableDecorator::m_glPathTexGenNV_trace;}
+if(this->m_ptr_glVertexBlendEnviATI){this->m_orig_glVertexBlendEnviATI = this->m_ptr_glVertexBlendEnviATI;this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&TraceTableDecorator::m_glVertexBlendEnviATI_trace;}
+if(this->m_ptr_glUniform3i64ARB){this->m_orig_glUniform3i64ARB = this->m_ptr_glUniform3i64ARB;this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&TraceTableDecorator::m_glUniform3i64ARB_trace;}
+if(this->m_ptr_glLoadMatrixf){this->m_orig_glLoadMatrixf = this->m_ptr_glLoadMatrixf;this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&TraceTableDecorator::m_glLoadMatrixf_trace;}
+if(this->m_ptr_glProgramUniform2dEXT){this->m_orig_glProgramUniform2dEXT = this->m_ptr_glProgramUniform2dEXT;this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&TraceTableDecorator::m_glProgramUniform2dEXT_trace;}
+if(this->m_ptr_glVertexAttribI4iv){this->m_orig_glVertexAttribI4iv = this->m_ptr_glVertexAttribI4iv;this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&TraceTableDecorator::m_glVertexAttribI4iv_trace;}
+if(this->m_ptr_glNamedFramebufferDrawBuffer){this->m_orig_glNamedFramebufferDrawBuffer = this->m_ptr_glNamedFramebufferDrawBuffer;this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&TraceTableDecorator::m_glNamedFramebufferDrawBuffer_trace;}
+if(this->m_ptr_glColor4ubv){this->m_orig_glColor4ubv = this->m_ptr_glColor4ubv;this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&TraceTableDecorator::m_glColor4ubv_trace;}
+if(this->m_ptr_glColor3hvNV){this->m_orig_glColor3hvNV = this->m_ptr_glColor3hvNV;this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&TraceTableDecorator::m_glColor3hvNV_trace;}
+if(this->m_ptr_glGetMapAttribParameterfvNV){this->m_orig_glGetMapAttribParameterfvNV = this->m_ptr_glGetMapAttribParameterfvNV;this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetMapAttribParameterfvNV_trace;}
+if(this->m_ptr_glGetBufferSubData){this->m_orig_glGetBufferSubData = this->m_ptr_glGetBufferSubData;this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&TraceTableDecorator::m_glGetBufferSubData_trace;}
+if(this->m_ptr_glGetVertexAttribLdv){this->m_orig_glGetVertexAttribLdv = this->m_ptr_glGetVertexAttribLdv;this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&TraceTableDecorator::m_glGetVertexAttribLdv_trace;}
+if(this->m_ptr_glGetnUniformuiv){this->m_orig_glGetnUniformuiv = this->m_ptr_glGetnUniformuiv;this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&TraceTableDecorator::m_glGetnUniformuiv_trace;}
+if(this->m_ptr_glGetUniformui64vNV){this->m_orig_glGetUniformui64vNV = this->m_ptr_glGetUniformui64vNV;this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&TraceTableDecorator::m_glGetUniformui64vNV_trace;}
+if(this->m_ptr_glNamedRenderbufferStorageEXT){this->m_orig_glNamedRenderbufferStorageEXT = this->m_ptr_glNamedRenderbufferStorageEXT;this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&TraceTableDecorator::m_glNamedRenderbufferStorageEXT_trace;}
+if(this->m_ptr_glVertexAttrib3dNV){this->m_orig_glVertexAttrib3dNV = this->m_ptr_glVertexAttrib3dNV;this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&TraceTableDecorator::m_glVertexAttrib3dNV_trace;}
+if(this->m_ptr_glTextureStorage1DEXT){this->m_orig_glTextureStorage1DEXT = this->m_ptr_glTextureStorage1DEXT;this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&TraceTableDecorator::m_glTextureStorage1DEXT_trace;}
+if(this->m_ptr_glPixelTexGenParameteriSGIS){this->m_orig_glPixelTexGenParameteriSGIS = this->m_ptr_glPixelTexGenParameteriSGIS;this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&TraceTableDecorator::m_glPixelTexGenParameteriSGIS_trace;}
+if(this->m_ptr_glColorTableEXT){this->m_orig_glColorTableEXT = this->m_ptr_glColorTableEXT;this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&TraceTableDecorator::m_glColorTableEXT_trace;}
+if(this->m_ptr_glGenBuffers){this->m_orig_glGenBuffers = this->m_ptr_glGenBuffers;this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&TraceTableDecorator::m_glGenBuffers_trace;}
+if(this->m_ptr_glMultiTexCoord3xvOES){this->m_orig_glMultiTexCoord3xvOES = this->m_ptr_glMultiTexCoord3xvOES;this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&TraceTableDecorator::m_glMultiTexCoord3xvOES_trace;}
+if(this->m_ptr_glExecuteProgramNV){this->m_orig_glExecuteProgramNV = this->m_ptr_glExecuteProgramNV;this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&TraceTableDecorator::m_glExecuteProgramNV_trace;}
+if(this->m_ptr_glVariantArrayObjectATI){this->m_orig_glVariantArrayObjectATI = this->m_ptr_glVariantArrayObjectATI;this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&TraceTableDecorator::m_glVariantArrayObjectATI_trace;}
+if(this->m_ptr_glColor3xvOES){this->m_orig_glColor3xvOES = this->m_ptr_glColor3xvOES;this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&TraceTableDecorator::m_glColor3xvOES_trace;}
+if(this->m_ptr_glGetnConvolutionFilterARB){this->m_orig_glGetnConvolutionFilterARB = this->m_ptr_glGetnConvolutionFilterARB;this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&TraceTableDecorator::m_glGetnConvolutionFilterARB_trace;}
+if(this->m_ptr_glNormalFormatNV){this->m_orig_glNormalFormatNV = this->m_ptr_glNormalFormatNV;this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&TraceTableDecorator::m_glNormalFormatNV_trace;}
+if(this->m_ptr_glGetInvariantFloatvEXT){this->m_orig_glGetInvariantFloatvEXT = this->m_ptr_glGetInvariantFloatvEXT;this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&TraceTableDecorator::m_glGetInvariantFloatvEXT_trace;}
+if(this->m_ptr_glClearNamedFramebufferiv){this->m_orig_glClearNamedFramebufferiv = this->m_ptr_glClearNamedFramebufferiv;this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&TraceTableDecorator::m_glClearNamedFramebufferiv_trace;}
+if(this->m_ptr_glTexImage3D){this->m_orig_glTexImage3D = this->m_ptr_glTexImage3D;this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&TraceTableDecorator::m_glTexImage3D_trace;}
+if(this->m_ptr_glGenSamplers){this->m_orig_glGenSamplers = this->m_ptr_glGenSamplers;this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&TraceTableDecorator::m_glGenSamplers_trace;}
+if(this->m_ptr_glIsFramebuffer){this->m_orig_glIsFramebuffer = this->m_ptr_glIsFramebuffer;this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&TraceTableDecorator::m_glIsFramebuffer_trace;}
+if(this->m_ptr_glProgramUniform3dvEXT){this->m_orig_glProgramUniform3dvEXT = this->m_ptr_glProgramUniform3dvEXT;this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&TraceTableDecorator::m_glProgramUniform3dvEXT_trace;}
+if(this->m_ptr_glGetVertexAttribfvNV){this->m_orig_glGetVertexAttribfvNV = this->m_ptr_glGetVertexAttribfvNV;this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&TraceTableDecorator::m_glGetVertexAttribfvNV_trace;}
+if(this->m_ptr_glDrawRangeElementArrayAPPLE){this->m_orig_glDrawRangeElementArrayAPPLE = this->m_ptr_glDrawRangeElementArrayAPPLE;this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&TraceTableDecorator::m_glDrawRangeElementArrayAPPLE_trace;}
+if(this->m_ptr_glUniform3i64NV){this->m_orig_glUniform3i64NV = this->m_ptr_glUniform3i64NV;this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&TraceTableDecorator::m_glUniform3i64NV_trace;}
+if(this->m_ptr_glMatrixPopEXT){this->m_orig_glMatrixPopEXT = this->m_ptr_glMatrixPopEXT;this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&TraceTableDecorator::m_glMatrixPopEXT_trace;}
+if(this->m_ptr_glVertexStream1sATI){this->m_orig_glVertexStream1sATI = this->m_ptr_glVertexStream1sATI;this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&TraceTableDecorator::m_glVertexStream1sATI_trace;}
+if(this->m_ptr_glGetnPixelMapuivARB){this->m_orig_glGetnPixelMapuivARB = this->m_ptr_glGetnPixelMapuivARB;this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&TraceTableDecorator::m_glGetnPixelMapuivARB_trace;}
+if(this->m_ptr_glMultiTexEnviEXT){this->m_orig_glMultiTexEnviEXT = this->m_ptr_glMultiTexEnviEXT;this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&TraceTableDecorator::m_glMultiTexEnviEXT_trace;}
+if(this->m_ptr_glVertexAttribI2iEXT){this->m_orig_glVertexAttribI2iEXT = this->m_ptr_glVertexAttribI2iEXT;this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&TraceTableDecorator::m_glVertexAttribI2iEXT_trace;}
+if(this->m_ptr_glProgramParameter4fvNV){this->m_orig_glProgramParameter4fvNV = this->m_ptr_glProgramParameter4fvNV;this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&TraceTableDecorator::m_glProgramParameter4fvNV_trace;}
+if(this->m_ptr_glWaitSemaphoreEXT){this->m_orig_glWaitSemaphoreEXT = this->m_ptr_glWaitSemaphoreEXT;this->m_ptr_glWaitSemaphoreEXT = (FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC)&TraceTableDecorator::m_glWaitSemaphoreEXT_trace;}
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV){this->m_orig_glNamedFramebufferSampleLocationsfvNV = this->m_ptr_glNamedFramebufferSampleLocationsfvNV;this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&TraceTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_trace;}
+if(this->m_ptr_glTexCoordP4uiv){this->m_orig_glTexCoordP4uiv = this->m_ptr_glTexCoordP4uiv;this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&TraceTableDecorator::m_glTexCoordP4uiv_trace;}
+if(this->m_ptr_glRectxvOES){this->m_orig_glRectxvOES = this->m_ptr_glRectxvOES;this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&TraceTableDecorator::m_glRectxvOES_trace;}
+if(this->m_ptr_glGetVariantIntegervEXT){this->m_orig_glGetVariantIntegervEXT = this->m_ptr_glGetVariantIntegervEXT;this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&TraceTableDecorator::m_glGetVariantIntegervEXT_trace;}
+if(this->m_ptr_glDeleteLists){this->m_orig_glDeleteLists = this->m_ptr_glDeleteLists;this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&TraceTableDecorator::m_glDeleteLists_trace;}
+if(this->m_ptr_glTexGendv){this->m_orig_glTexGendv = this->m_ptr_glTexGendv;this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&TraceTableDecorator::m_glTexGendv_trace;}
+if(this->m_ptr_glVertexP2uiv){this->m_orig_glVertexP2uiv = this->m_ptr_glVertexP2uiv;this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&TraceTableDecorator::m_glVertexP2uiv_trace;}
+if(this->m_ptr_glGetPerfMonitorGroupsAMD){this->m_orig_glGetPerfMonitorGroupsAMD = this->m_ptr_glGetPerfMonitorGroupsAMD;this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&TraceTableDecorator::m_glGetPerfMonitorGroupsAMD_trace;}
+if(this->m_ptr_glMultTransposeMatrixfARB){this->m_orig_glMultTransposeMatrixfARB = this->m_ptr_glMultTransposeMatrixfARB;this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&TraceTableDecorator::m_glMultTransposeMatrixfARB_trace;}
+if(this->m_ptr_glVertexAttribI2ivEXT){this->m_orig_glVertexAttribI2ivEXT = this->m_ptr_glVertexAttribI2ivEXT;this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&TraceTableDecorator::m_glVertexAttribI2ivEXT_trace;}
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glDeleteStatesNV){this->m_orig_glDeleteStatesNV = this->m_ptr_glDeleteStatesNV;this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&TraceTableDecorator::m_glDeleteStatesNV_trace;}
+if(this->m_ptr_glGetBufferParameteri64v){this->m_orig_glGetBufferParameteri64v = this->m_ptr_glGetBufferParameteri64v;this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&TraceTableDecorator::m_glGetBufferParameteri64v_trace;}
+if(this->m_ptr_glProgramUniform4dv){this->m_orig_glProgramUniform4dv = this->m_ptr_glProgramUniform4dv;this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&TraceTableDecorator::m_glProgramUniform4dv_trace;}
+if(this->m_ptr_glEdgeFlagPointerEXT){this->m_orig_glEdgeFlagPointerEXT = this->m_ptr_glEdgeFlagPointerEXT;this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&TraceTableDecorator::m_glEdgeFlagPointerEXT_trace;}
+if(this->m_ptr_glVideoCaptureStreamParameterivNV){this->m_orig_glVideoCaptureStreamParameterivNV = this->m_ptr_glVideoCaptureStreamParameterivNV;this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&TraceTableDecorator::m_glVideoCaptureStreamParameterivNV_trace;}
+if(this->m_ptr_glVertexStream4iATI){this->m_orig_glVertexStream4iATI = this->m_ptr_glVertexStream4iATI;this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&TraceTableDecorator::m_glVertexStream4iATI_trace;}
+if(this->m_ptr_glVDPAUFiniNV){this->m_orig_glVDPAUFiniNV = this->m_ptr_glVDPAUFiniNV;this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&TraceTableDecorator::m_glVDPAUFiniNV_trace;}
+if(this->m_ptr_glMakeBufferNonResidentNV){this->m_orig_glMakeBufferNonResidentNV = this->m_ptr_glMakeBufferNonResidentNV;this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&TraceTableDecorator::m_glMakeBufferNonResidentNV_trace;}
+if(this->m_ptr_glUniform1ui64ARB){this->m_orig_glUniform1ui64ARB = this->m_ptr_glUniform1ui64ARB;this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&TraceTableDecorator::m_glUniform1ui64ARB_trace;}
+if(this->m_ptr_glStencilStrokePathNV){this->m_orig_glStencilStrokePathNV = this->m_ptr_glStencilStrokePathNV;this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&TraceTableDecorator::m_glStencilStrokePathNV_trace;}
+if(this->m_ptr_glVariantuivEXT){this->m_orig_glVariantuivEXT = this->m_ptr_glVariantuivEXT;this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&TraceTableDecorator::m_glVariantuivEXT_trace;}
+if(this->m_ptr_glCopyTexSubImage3DEXT){this->m_orig_glCopyTexSubImage3DEXT = this->m_ptr_glCopyTexSubImage3DEXT;this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glCopyTexSubImage3DEXT_trace;}
+if(this->m_ptr_glSpriteParameteriSGIX){this->m_orig_glSpriteParameteriSGIX = this->m_ptr_glSpriteParameteriSGIX;this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&TraceTableDecorator::m_glSpriteParameteriSGIX_trace;}
+if(this->m_ptr_glMultiTexCoord1sARB){this->m_orig_glMultiTexCoord1sARB = this->m_ptr_glMultiTexCoord1sARB;this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&TraceTableDecorator::m_glMultiTexCoord1sARB_trace;}
+if(this->m_ptr_glConvolutionParameterfv){this->m_orig_glConvolutionParameterfv = this->m_ptr_glConvolutionParameterfv;this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&TraceTableDecorator::m_glConvolutionParameterfv_trace;}
+if(this->m_ptr_glMakeTextureHandleResidentNV){this->m_orig_glMakeTextureHandleResidentNV = this->m_ptr_glMakeTextureHandleResidentNV;this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&TraceTableDecorator::m_glMakeTextureHandleResidentNV_trace;}
+if(this->m_ptr_glMultMatrixxOES){this->m_orig_glMultMatrixxOES = this->m_ptr_glMultMatrixxOES;this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&TraceTableDecorator::m_glMultMatrixxOES_trace;}
+if(this->m_ptr_glTextureNormalEXT){this->m_orig_glTextureNormalEXT = this->m_ptr_glTextureNormalEXT;this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&TraceTableDecorator::m_glTextureNormalEXT_trace;}
+if(this->m_ptr_glGetQueryivARB){this->m_orig_glGetQueryivARB = this->m_ptr_glGetQueryivARB;this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&TraceTableDecorator::m_glGetQueryivARB_trace;}
+if(this->m_ptr_glCompressedMultiTexImage3DEXT){this->m_orig_glCompressedMultiTexImage3DEXT = this->m_ptr_glCompressedMultiTexImage3DEXT;this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&TraceTableDecorator::m_glCompressedMultiTexImage3DEXT_trace;}
+if(this->m_ptr_glGetInstrumentsSGIX){this->m_orig_glGetInstrumentsSGIX = this->m_ptr_glGetInstrumentsSGIX;this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&TraceTableDecorator::m_glGetInstrumentsSGIX_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT){this->m_orig_glProgramUniformMatrix4x3fvEXT = this->m_ptr_glProgramUniformMatrix4x3fvEXT;this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x3fvEXT_trace;}
+if(this->m_ptr_glPointParameterf){this->m_orig_glPointParameterf = this->m_ptr_glPointParameterf;this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&TraceTableDecorator::m_glPointParameterf_trace;}
+if(this->m_ptr_glProgramUniform3dEXT){this->m_orig_glProgramUniform3dEXT = this->m_ptr_glProgramUniform3dEXT;this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&TraceTableDecorator::m_glProgramUniform3dEXT_trace;}
+if(this->m_ptr_glMultiTexCoord2hNV){this->m_orig_glMultiTexCoord2hNV = this->m_ptr_glMultiTexCoord2hNV;this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&TraceTableDecorator::m_glMultiTexCoord2hNV_trace;}
+if(this->m_ptr_glGetConvolutionFilterEXT){this->m_orig_glGetConvolutionFilterEXT = this->m_ptr_glGetConvolutionFilterEXT;this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&TraceTableDecorator::m_glGetConvolutionFilterEXT_trace;}
+if(this->m_ptr_glVertexAttrib2hNV){this->m_orig_glVertexAttrib2hNV = this->m_ptr_glVertexAttrib2hNV;this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&TraceTableDecorator::m_glVertexAttrib2hNV_trace;}
+if(this->m_ptr_glCurrentPaletteMatrixARB){this->m_orig_glCurrentPaletteMatrixARB = this->m_ptr_glCurrentPaletteMatrixARB;this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&TraceTableDecorator::m_glCurrentPaletteMatrixARB_trace;}
+if(this->m_ptr_glFogxvOES){this->m_orig_glFogxvOES = this->m_ptr_glFogxvOES;this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&TraceTableDecorator::m_glFogxvOES_trace;}
+if(this->m_ptr_glCreateRenderbuffers){this->m_orig_glCreateRenderbuffers = this->m_ptr_glCreateRenderbuffers;this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&TraceTableDecorator::m_glCreateRenderbuffers_trace;}
+if(this->m_ptr_glVertexAttrib4Nusv){this->m_orig_glVertexAttrib4Nusv = this->m_ptr_glVertexAttrib4Nusv;this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&TraceTableDecorator::m_glVertexAttrib4Nusv_trace;}
+if(this->m_ptr_glCombinerInputNV){this->m_orig_glCombinerInputNV = this->m_ptr_glCombinerInputNV;this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&TraceTableDecorator::m_glCombinerInputNV_trace;}
+if(this->m_ptr_glDepthFunc){this->m_orig_glDepthFunc = this->m_ptr_glDepthFunc;this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&TraceTableDecorator::m_glDepthFunc_trace;}
+if(this->m_ptr_glWindowPos4fMESA){this->m_orig_glWindowPos4fMESA = this->m_ptr_glWindowPos4fMESA;this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&TraceTableDecorator::m_glWindowPos4fMESA_trace;}
+if(this->m_ptr_glEnableClientStateIndexedEXT){this->m_orig_glEnableClientStateIndexedEXT = this->m_ptr_glEnableClientStateIndexedEXT;this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&TraceTableDecorator::m_glEnableClientStateIndexedEXT_trace;}
+if(this->m_ptr_glTexCoord4iv){this->m_orig_glTexCoord4iv = this->m_ptr_glTexCoord4iv;this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&TraceTableDecorator::m_glTexCoord4iv_trace;}
+if(this->m_ptr_glProgramUniform4i64ARB){this->m_orig_glProgramUniform4i64ARB = this->m_ptr_glProgramUniform4i64ARB;this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&TraceTableDecorator::m_glProgramUniform4i64ARB_trace;}
+if(this->m_ptr_glBlendFunci){this->m_orig_glBlendFunci = this->m_ptr_glBlendFunci;this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&TraceTableDecorator::m_glBlendFunci_trace;}
+if(this->m_ptr_glResolveDepthValuesNV){this->m_orig_glResolveDepthValuesNV = this->m_ptr_glResolveDepthValuesNV;this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&TraceTableDecorator::m_glResolveDepthValuesNV_trace;}
+if(this->m_ptr_glTextureColorMaskSGIS){this->m_orig_glTextureColorMaskSGIS = this->m_ptr_glTextureColorMaskSGIS;this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&TraceTableDecorator::m_glTextureColorMaskSGIS_trace;}
+if(this->m_ptr_glCreateShaderProgramEXT){this->m_orig_glCreateShaderProgramEXT = this->m_ptr_glCreateShaderProgramEXT;this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&TraceTableDecorator::m_glCreateShaderProgramEXT_trace;}
+if(this->m_ptr_glBufferStorage){this->m_orig_glBufferStorage = this->m_ptr_glBufferStorage;this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&TraceTableDecorator::m_glBufferStorage_trace;}
+if(this->m_ptr_glMakeNamedBufferNonResidentNV){this->m_orig_glMakeNamedBufferNonResidentNV = this->m_ptr_glMakeNamedBufferNonResidentNV;this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&TraceTableDecorator::m_glMakeNamedBufferNonResidentNV_trace;}
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT){this->m_orig_glRenderbufferStorageMultisampleEXT = this->m_ptr_glRenderbufferStorageMultisampleEXT;this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glRenderbufferStorageMultisampleEXT_trace;}
+if(this->m_ptr_glGetFloati_v){this->m_orig_glGetFloati_v = this->m_ptr_glGetFloati_v;this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&TraceTableDecorator::m_glGetFloati_v_trace;}
+if(this->m_ptr_glUniform2ui64ARB){this->m_orig_glUniform2ui64ARB = this->m_ptr_glUniform2ui64ARB;this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&TraceTableDecorator::m_glUniform2ui64ARB_trace;}
+if(this->m_ptr_glVertex3fv){this->m_orig_glVertex3fv = this->m_ptr_glVertex3fv;this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&TraceTableDecorator::m_glVertex3fv_trace;}
+if(this->m_ptr_glGetUniformLocation){this->m_orig_glGetUniformLocation = this->m_ptr_glGetUniformLocation;this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&TraceTableDecorator::m_glGetUniformLocation_trace;}
+if(this->m_ptr_glVertexStream1svATI){this->m_orig_glVertexStream1svATI = this->m_ptr_glVertexStream1svATI;this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&TraceTableDecorator::m_glVertexStream1svATI_trace;}
+if(this->m_ptr_glVertexStream3fATI){this->m_orig_glVertexStream3fATI = this->m_ptr_glVertexStream3fATI;this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&TraceTableDecorator::m_glVertexStream3fATI_trace;}
+if(this->m_ptr_glNamedFramebufferDrawBuffers){this->m_orig_glNamedFramebufferDrawBuffers = this->m_ptr_glNamedFramebufferDrawBuffers;this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&TraceTableDecorator::m_glNamedFramebufferDrawBuffers_trace;}
+if(this->m_ptr_glUniform2ui64vNV){this->m_orig_glUniform2ui64vNV = this->m_ptr_glUniform2ui64vNV;this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&TraceTableDecorator::m_glUniform2ui64vNV_trace;}
+if(this->m_ptr_glTexCoordPointervINTEL){this->m_orig_glTexCoordPointervINTEL = this->m_ptr_glTexCoordPointervINTEL;this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&TraceTableDecorator::m_glTexCoordPointervINTEL_trace;}
+if(this->m_ptr_glUniform4fv){this->m_orig_glUniform4fv = this->m_ptr_glUniform4fv;this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&TraceTableDecorator::m_glUniform4fv_trace;}
+if(this->m_ptr_glNormalPointerEXT){this->m_orig_glNormalPointerEXT = this->m_ptr_glNormalPointerEXT;this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&TraceTableDecorator::m_glNormalPointerEXT_trace;}
+if(this->m_ptr_glVertexAttrib4hNV){this->m_orig_glVertexAttrib4hNV = this->m_ptr_glVertexAttrib4hNV;this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&TraceTableDecorator::m_glVertexAttrib4hNV_trace;}
+if(this->m_ptr_glNormal3f){this->m_orig_glNormal3f = this->m_ptr_glNormal3f;this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&TraceTableDecorator::m_glNormal3f_trace;}
+if(this->m_ptr_glVertexStream2iATI){this->m_orig_glVertexStream2iATI = this->m_ptr_glVertexStream2iATI;this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&TraceTableDecorator::m_glVertexStream2iATI_trace;}
+if(this->m_ptr_glVertexAttribP4uiv){this->m_orig_glVertexAttribP4uiv = this->m_ptr_glVertexAttribP4uiv;this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&TraceTableDecorator::m_glVertexAttribP4uiv_trace;}
+if(this->m_ptr_glCompressedTextureSubImage3D){this->m_orig_glCompressedTextureSubImage3D = this->m_ptr_glCompressedTextureSubImage3D;this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&TraceTableDecorator::m_glCompressedTextureSubImage3D_trace;}
+if(this->m_ptr_glAsyncMarkerSGIX){this->m_orig_glAsyncMarkerSGIX = this->m_ptr_glAsyncMarkerSGIX;this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&TraceTableDecorator::m_glAsyncMarkerSGIX_trace;}
+if(this->m_ptr_glTextureStorageSparseAMD){this->m_orig_glTextureStorageSparseAMD = this->m_ptr_glTextureStorageSparseAMD;this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&TraceTableDecorator::m_glTextureStorageSparseAMD_trace;}
+if(this->m_ptr_glGetConvolutionParameterivEXT){this->m_orig_glGetConvolutionParameterivEXT = this->m_ptr_glGetConvolutionParameterivEXT;this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetConvolutionParameterivEXT_trace;}
+if(this->m_ptr_glEndPerfQueryINTEL){this->m_orig_glEndPerfQueryINTEL = this->m_ptr_glEndPerfQueryINTEL;this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&TraceTableDecorator::m_glEndPerfQueryINTEL_trace;}
+if(this->m_ptr_glFragmentLightModeliSGIX){this->m_orig_glFragmentLightModeliSGIX = this->m_ptr_glFragmentLightModeliSGIX;this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&TraceTableDecorator::m_glFragmentLightModeliSGIX_trace;}
+if(this->m_ptr_glPrioritizeTexturesEXT){this->m_orig_glPrioritizeTexturesEXT = this->m_ptr_glPrioritizeTexturesEXT;this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&TraceTableDecorator::m_glPrioritizeTexturesEXT_trace;}
+if(this->m_ptr_glEndConditionalRender){this->m_orig_glEndConditionalRender = this->m_ptr_glEndConditionalRender;this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&TraceTableDecorator::m_glEndConditionalRender_trace;}
+if(this->m_ptr_glEnableClientState){this->m_orig_glEnableClientState = this->m_ptr_glEnableClientState;this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&TraceTableDecorator::m_glEnableClientState_trace;}
+if(this->m_ptr_glResetHistogram){this->m_orig_glResetHistogram = this->m_ptr_glResetHistogram;this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&TraceTableDecorator::m_glResetHistogram_trace;}
+if(this->m_ptr_glGetOcclusionQueryivNV){this->m_orig_glGetOcclusionQueryivNV = this->m_ptr_glGetOcclusionQueryivNV;this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&TraceTableDecorator::m_glGetOcclusionQueryivNV_trace;}
+if(this->m_ptr_glUniform1uiEXT){this->m_orig_glUniform1uiEXT = this->m_ptr_glUniform1uiEXT;this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&TraceTableDecorator::m_glUniform1uiEXT_trace;}
+if(this->m_ptr_glMultiTexCoord2sv){this->m_orig_glMultiTexCoord2sv = this->m_ptr_glMultiTexCoord2sv;this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&TraceTableDecorator::m_glMultiTexCoord2sv_trace;}
+if(this->m_ptr_glTexSubImage2DEXT){this->m_orig_glTexSubImage2DEXT = this->m_ptr_glTexSubImage2DEXT;this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glTexSubImage2DEXT_trace;}
+if(this->m_ptr_glProgramUniform2uiv){this->m_orig_glProgramUniform2uiv = this->m_ptr_glProgramUniform2uiv;this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&TraceTableDecorator::m_glProgramUniform2uiv_trace;}
+if(this->m_ptr_glMultiTexCoord2iARB){this->m_orig_glMultiTexCoord2iARB = this->m_ptr_glMultiTexCoord2iARB;this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&TraceTableDecorator::m_glMultiTexCoord2iARB_trace;}
+if(this->m_ptr_glGetQueryObjectuiv){this->m_orig_glGetQueryObjectuiv = this->m_ptr_glGetQueryObjectuiv;this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&TraceTableDecorator::m_glGetQueryObjectuiv_trace;}
+if(this->m_ptr_glGenerateMultiTexMipmapEXT){this->m_orig_glGenerateMultiTexMipmapEXT = this->m_ptr_glGenerateMultiTexMipmapEXT;this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&TraceTableDecorator::m_glGenerateMultiTexMipmapEXT_trace;}
+if(this->m_ptr_glVertexAttrib4iv){this->m_orig_glVertexAttrib4iv = this->m_ptr_glVertexAttrib4iv;this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&TraceTableDecorator::m_glVertexAttrib4iv_trace;}
+if(this->m_ptr_glWindowPos3dvMESA){this->m_orig_glWindowPos3dvMESA = this->m_ptr_glWindowPos3dvMESA;this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&TraceTableDecorator::m_glWindowPos3dvMESA_trace;}
+if(this->m_ptr_glLabelObjectEXT){this->m_orig_glLabelObjectEXT = this->m_ptr_glLabelObjectEXT;this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&TraceTableDecorator::m_glLabelObjectEXT_trace;}
+if(this->m_ptr_glProgramUniform1uiv){this->m_orig_glProgramUniform1uiv = this->m_ptr_glProgramUniform1uiv;this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&TraceTableDecorator::m_glProgramUniform1uiv_trace;}
+if(this->m_ptr_glFramebufferTexture){this->m_orig_glFramebufferTexture = this->m_ptr_glFramebufferTexture;this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&TraceTableDecorator::m_glFramebufferTexture_trace;}
+if(this->m_ptr_glMultiTexEnvfEXT){this->m_orig_glMultiTexEnvfEXT = this->m_ptr_glMultiTexEnvfEXT;this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&TraceTableDecorator::m_glMultiTexEnvfEXT_trace;}
+if(this->m_ptr_glGetTexGendv){this->m_orig_glGetTexGendv = this->m_ptr_glGetTexGendv;this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&TraceTableDecorator::m_glGetTexGendv_trace;}
+if(this->m_ptr_glVertex4xOES){this->m_orig_glVertex4xOES = this->m_ptr_glVertex4xOES;this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&TraceTableDecorator::m_glVertex4xOES_trace;}
+if(this->m_ptr_glVertexAttribI2uivEXT){this->m_orig_glVertexAttribI2uivEXT = this->m_ptr_glVertexAttribI2uivEXT;this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&TraceTableDecorator::m_glVertexAttribI2uivEXT_trace;}
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT){this->m_orig_glNamedProgramLocalParameter4fvEXT = this->m_ptr_glNamedProgramLocalParameter4fvEXT;this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameter4fvEXT_trace;}
+if(this->m_ptr_glColor3usv){this->m_orig_glColor3usv = this->m_ptr_glColor3usv;this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&TraceTableDecorator::m_glColor3usv_trace;}
+if(this->m_ptr_glGetPixelTransformParameterfvEXT){this->m_orig_glGetPixelTransformParameterfvEXT = this->m_ptr_glGetPixelTransformParameterfvEXT;this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetPixelTransformParameterfvEXT_trace;}
+if(this->m_ptr_glIndexxvOES){this->m_orig_glIndexxvOES = this->m_ptr_glIndexxvOES;this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&TraceTableDecorator::m_glIndexxvOES_trace;}
+if(this->m_ptr_glDepthMask){this->m_orig_glDepthMask = this->m_ptr_glDepthMask;this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&TraceTableDecorator::m_glDepthMask_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x4fv){this->m_orig_glProgramUniformMatrix2x4fv = this->m_ptr_glProgramUniformMatrix2x4fv;this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x4fv_trace;}
+if(this->m_ptr_glAreProgramsResidentNV){this->m_orig_glAreProgramsResidentNV = this->m_ptr_glAreProgramsResidentNV;this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&TraceTableDecorator::m_glAreProgramsResidentNV_trace;}
+if(this->m_ptr_glColorTable){this->m_orig_glColorTable = this->m_ptr_glColorTable;this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&TraceTableDecorator::m_glColorTable_trace;}
+if(this->m_ptr_glBeginQueryIndexed){this->m_orig_glBeginQueryIndexed = this->m_ptr_glBeginQueryIndexed;this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&TraceTableDecorator::m_glBeginQueryIndexed_trace;}
+if(this->m_ptr_glVertexStream1dvATI){this->m_orig_glVertexStream1dvATI = this->m_ptr_glVertexStream1dvATI;this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&TraceTableDecorator::m_glVertexStream1dvATI_trace;}
+if(this->m_ptr_glGetMultiTexEnvfvEXT){this->m_orig_glGetMultiTexEnvfvEXT = this->m_ptr_glGetMultiTexEnvfvEXT;this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&TraceTableDecorator::m_glGetMultiTexEnvfvEXT_trace;}
+if(this->m_ptr_glDeleteFencesNV){this->m_orig_glDeleteFencesNV = this->m_ptr_glDeleteFencesNV;this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&TraceTableDecorator::m_glDeleteFencesNV_trace;}
+if(this->m_ptr_glVertexAttribs1dvNV){this->m_orig_glVertexAttribs1dvNV = this->m_ptr_glVertexAttribs1dvNV;this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&TraceTableDecorator::m_glVertexAttribs1dvNV_trace;}
+if(this->m_ptr_glBufferStorageExternalEXT){this->m_orig_glBufferStorageExternalEXT = this->m_ptr_glBufferStorageExternalEXT;this->m_ptr_glBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC)&TraceTableDecorator::m_glBufferStorageExternalEXT_trace;}
+if(this->m_ptr_glVertexStream2sATI){this->m_orig_glVertexStream2sATI = this->m_ptr_glVertexStream2sATI;this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&TraceTableDecorator::m_glVertexStream2sATI_trace;}
+if(this->m_ptr_glGetnSeparableFilterARB){this->m_orig_glGetnSeparableFilterARB = this->m_ptr_glGetnSeparableFilterARB;this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&TraceTableDecorator::m_glGetnSeparableFilterARB_trace;}
+if(this->m_ptr_glProgramUniform2dv){this->m_orig_glProgramUniform2dv = this->m_ptr_glProgramUniform2dv;this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&TraceTableDecorator::m_glProgramUniform2dv_trace;}
+if(this->m_ptr_glActiveStencilFaceEXT){this->m_orig_glActiveStencilFaceEXT = this->m_ptr_glActiveStencilFaceEXT;this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&TraceTableDecorator::m_glActiveStencilFaceEXT_trace;}
+if(this->m_ptr_glProgramUniform4dEXT){this->m_orig_glProgramUniform4dEXT = this->m_ptr_glProgramUniform4dEXT;this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&TraceTableDecorator::m_glProgramUniform4dEXT_trace;}
+if(this->m_ptr_glPointSizexOES){this->m_orig_glPointSizexOES = this->m_ptr_glPointSizexOES;this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&TraceTableDecorator::m_glPointSizexOES_trace;}
+if(this->m_ptr_glRasterPos2sv){this->m_orig_glRasterPos2sv = this->m_ptr_glRasterPos2sv;this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&TraceTableDecorator::m_glRasterPos2sv_trace;}
+if(this->m_ptr_glBindParameterEXT){this->m_orig_glBindParameterEXT = this->m_ptr_glBindParameterEXT;this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&TraceTableDecorator::m_glBindParameterEXT_trace;}
+if(this->m_ptr_glTexCoord1sv){this->m_orig_glTexCoord1sv = this->m_ptr_glTexCoord1sv;this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&TraceTableDecorator::m_glTexCoord1sv_trace;}
+if(this->m_ptr_glBlendParameteriNV){this->m_orig_glBlendParameteriNV = this->m_ptr_glBlendParameteriNV;this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&TraceTableDecorator::m_glBlendParameteriNV_trace;}
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT){this->m_orig_glNamedProgramLocalParameter4dvEXT = this->m_ptr_glNamedProgramLocalParameter4dvEXT;this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameter4dvEXT_trace;}
+if(this->m_ptr_glProgramUniformHandleui64NV){this->m_orig_glProgramUniformHandleui64NV = this->m_ptr_glProgramUniformHandleui64NV;this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&TraceTableDecorator::m_glProgramUniformHandleui64NV_trace;}
+if(this->m_ptr_glGetTextureParameterfvEXT){this->m_orig_glGetTextureParameterfvEXT = this->m_ptr_glGetTextureParameterfvEXT;this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetTextureParameterfvEXT_trace;}
+if(this->m_ptr_glGetPathMetricsNV){this->m_orig_glGetPathMetricsNV = this->m_ptr_glGetPathMetricsNV;this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&TraceTableDecorator::m_glGetPathMetricsNV_trace;}
+if(this->m_ptr_glVertex2i){this->m_orig_glVertex2i = this->m_ptr_glVertex2i;this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&TraceTableDecorator::m_glVertex2i_trace;}
+if(this->m_ptr_glNewList){this->m_orig_glNewList = this->m_ptr_glNewList;this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&TraceTableDecorator::m_glNewList_trace;}
+if(this->m_ptr_glMatrixLoad3x3fNV){this->m_orig_glMatrixLoad3x3fNV = this->m_ptr_glMatrixLoad3x3fNV;this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&TraceTableDecorator::m_glMatrixLoad3x3fNV_trace;}
+if(this->m_ptr_glMultiTexCoord2fARB){this->m_orig_glMultiTexCoord2fARB = this->m_ptr_glMultiTexCoord2fARB;this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&TraceTableDecorator::m_glMultiTexCoord2fARB_trace;}
+if(this->m_ptr_glWeightdvARB){this->m_orig_glWeightdvARB = this->m_ptr_glWeightdvARB;this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&TraceTableDecorator::m_glWeightdvARB_trace;}
+if(this->m_ptr_glIsTransformFeedbackNV){this->m_orig_glIsTransformFeedbackNV = this->m_ptr_glIsTransformFeedbackNV;this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glIsTransformFeedbackNV_trace;}
+if(this->m_ptr_glVertexAttribDivisorARB){this->m_orig_glVertexAttribDivisorARB = this->m_ptr_glVertexAttribDivisorARB;this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&TraceTableDecorator::m_glVertexAttribDivisorARB_trace;}
+if(this->m_ptr_glSecondaryColorP3uiv){this->m_orig_glSecondaryColorP3uiv = this->m_ptr_glSecondaryColorP3uiv;this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&TraceTableDecorator::m_glSecondaryColorP3uiv_trace;}
+if(this->m_ptr_glGetnCompressedTexImageARB){this->m_orig_glGetnCompressedTexImageARB = this->m_ptr_glGetnCompressedTexImageARB;this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&TraceTableDecorator::m_glGetnCompressedTexImageARB_trace;}
+if(this->m_ptr_glGetIntegerv){this->m_orig_glGetIntegerv = this->m_ptr_glGetIntegerv;this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&TraceTableDecorator::m_glGetIntegerv_trace;}
+if(this->m_ptr_glMatrixLoaddEXT){this->m_orig_glMatrixLoaddEXT = this->m_ptr_glMatrixLoaddEXT;this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&TraceTableDecorator::m_glMatrixLoaddEXT_trace;}
+if(this->m_ptr_glGetPathLengthNV){this->m_orig_glGetPathLengthNV = this->m_ptr_glGetPathLengthNV;this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&TraceTableDecorator::m_glGetPathLengthNV_trace;}
+if(this->m_ptr_glProgramUniformMatrix3dv){this->m_orig_glProgramUniformMatrix3dv = this->m_ptr_glProgramUniformMatrix3dv;this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix3dv_trace;}
+if(this->m_ptr_glUniform4i64NV){this->m_orig_glUniform4i64NV = this->m_ptr_glUniform4i64NV;this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&TraceTableDecorator::m_glUniform4i64NV_trace;}
+if(this->m_ptr_glGetHistogramEXT){this->m_orig_glGetHistogramEXT = this->m_ptr_glGetHistogramEXT;this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&TraceTableDecorator::m_glGetHistogramEXT_trace;}
+if(this->m_ptr_glVertexAttrib4NuivARB){this->m_orig_glVertexAttrib4NuivARB = this->m_ptr_glVertexAttrib4NuivARB;this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&TraceTableDecorator::m_glVertexAttrib4NuivARB_trace;}
+if(this->m_ptr_glMapGrid2xOES){this->m_orig_glMapGrid2xOES = this->m_ptr_glMapGrid2xOES;this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&TraceTableDecorator::m_glMapGrid2xOES_trace;}
+if(this->m_ptr_glTexImage2D){this->m_orig_glTexImage2D = this->m_ptr_glTexImage2D;this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&TraceTableDecorator::m_glTexImage2D_trace;}
+if(this->m_ptr_glWindowPos2fvARB){this->m_orig_glWindowPos2fvARB = this->m_ptr_glWindowPos2fvARB;this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&TraceTableDecorator::m_glWindowPos2fvARB_trace;}
+if(this->m_ptr_glEnableIndexedEXT){this->m_orig_glEnableIndexedEXT = this->m_ptr_glEnableIndexedEXT;this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&TraceTableDecorator::m_glEnableIndexedEXT_trace;}
+if(this->m_ptr_glTexCoord1bvOES){this->m_orig_glTexCoord1bvOES = this->m_ptr_glTexCoord1bvOES;this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&TraceTableDecorator::m_glTexCoord1bvOES_trace;}
+if(this->m_ptr_glDrawPixels){this->m_orig_glDrawPixels = this->m_ptr_glDrawPixels;this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&TraceTableDecorator::m_glDrawPixels_trace;}
+if(this->m_ptr_glMultMatrixd){this->m_orig_glMultMatrixd = this->m_ptr_glMultMatrixd;this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&TraceTableDecorator::m_glMultMatrixd_trace;}
+if(this->m_ptr_glMultMatrixf){this->m_orig_glMultMatrixf = this->m_ptr_glMultMatrixf;this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&TraceTableDecorator::m_glMultMatrixf_trace;}
+if(this->m_ptr_glReplacementCodePointerSUN){this->m_orig_glReplacementCodePointerSUN = this->m_ptr_glReplacementCodePointerSUN;this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&TraceTableDecorator::m_glReplacementCodePointerSUN_trace;}
+if(this->m_ptr_glLoadTransposeMatrixdARB){this->m_orig_glLoadTransposeMatrixdARB = this->m_ptr_glLoadTransposeMatrixdARB;this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&TraceTableDecorator::m_glLoadTransposeMatrixdARB_trace;}
+if(this->m_ptr_glVertexAttrib4Nubv){this->m_orig_glVertexAttrib4Nubv = this->m_ptr_glVertexAttrib4Nubv;this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&TraceTableDecorator::m_glVertexAttrib4Nubv_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT){this->m_orig_glVertexArrayVertexAttribIOffsetEXT = this->m_ptr_glVertexArrayVertexAttribIOffsetEXT;this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_trace;}
+if(this->m_ptr_glCompileShaderARB){this->m_orig_glCompileShaderARB = this->m_ptr_glCompileShaderARB;this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&TraceTableDecorator::m_glCompileShaderARB_trace;}
+if(this->m_ptr_glWindowPos3dMESA){this->m_orig_glWindowPos3dMESA = this->m_ptr_glWindowPos3dMESA;this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&TraceTableDecorator::m_glWindowPos3dMESA_trace;}
+if(this->m_ptr_glNormalStream3fvATI){this->m_orig_glNormalStream3fvATI = this->m_ptr_glNormalStream3fvATI;this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&TraceTableDecorator::m_glNormalStream3fvATI_trace;}
+if(this->m_ptr_glColor4usv){this->m_orig_glColor4usv = this->m_ptr_glColor4usv;this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&TraceTableDecorator::m_glColor4usv_trace;}
+if(this->m_ptr_glMapGrid1f){this->m_orig_glMapGrid1f = this->m_ptr_glMapGrid1f;this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&TraceTableDecorator::m_glMapGrid1f_trace;}
+if(this->m_ptr_glPolygonStipple){this->m_orig_glPolygonStipple = this->m_ptr_glPolygonStipple;this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&TraceTableDecorator::m_glPolygonStipple_trace;}
+if(this->m_ptr_glUniform4ui64ARB){this->m_orig_glUniform4ui64ARB = this->m_ptr_glUniform4ui64ARB;this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&TraceTableDecorator::m_glUniform4ui64ARB_trace;}
+if(this->m_ptr_glTextureRenderbufferEXT){this->m_orig_glTextureRenderbufferEXT = this->m_ptr_glTextureRenderbufferEXT;this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&TraceTableDecorator::m_glTextureRenderbufferEXT_trace;}
+if(this->m_ptr_glGetSubroutineUniformLocation){this->m_orig_glGetSubroutineUniformLocation = this->m_ptr_glGetSubroutineUniformLocation;this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&TraceTableDecorator::m_glGetSubroutineUniformLocation_trace;}
+if(this->m_ptr_glGetFramebufferParameteriv){this->m_orig_glGetFramebufferParameteriv = this->m_ptr_glGetFramebufferParameteriv;this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&TraceTableDecorator::m_glGetFramebufferParameteriv_trace;}
+if(this->m_ptr_glPixelMapusv){this->m_orig_glPixelMapusv = this->m_ptr_glPixelMapusv;this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&TraceTableDecorator::m_glPixelMapusv_trace;}
+if(this->m_ptr_glGetSamplerParameteriv){this->m_orig_glGetSamplerParameteriv = this->m_ptr_glGetSamplerParameteriv;this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&TraceTableDecorator::m_glGetSamplerParameteriv_trace;}
+if(this->m_ptr_glVertexStream2fvATI){this->m_orig_glVertexStream2fvATI = this->m_ptr_glVertexStream2fvATI;this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&TraceTableDecorator::m_glVertexStream2fvATI_trace;}
+if(this->m_ptr_glProgramStringARB){this->m_orig_glProgramStringARB = this->m_ptr_glProgramStringARB;this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&TraceTableDecorator::m_glProgramStringARB_trace;}
+if(this->m_ptr_glProgramUniformMatrix3dvEXT){this->m_orig_glProgramUniformMatrix3dvEXT = this->m_ptr_glProgramUniformMatrix3dvEXT;this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix3dvEXT_trace;}
+if(this->m_ptr_glSeparableFilter2D){this->m_orig_glSeparableFilter2D = this->m_ptr_glSeparableFilter2D;this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&TraceTableDecorator::m_glSeparableFilter2D_trace;}
+if(this->m_ptr_glVertexAttribI1uiv){this->m_orig_glVertexAttribI1uiv = this->m_ptr_glVertexAttribI1uiv;this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&TraceTableDecorator::m_glVertexAttribI1uiv_trace;}
+if(this->m_ptr_glLGPUCopyImageSubDataNVX){this->m_orig_glLGPUCopyImageSubDataNVX = this->m_ptr_glLGPUCopyImageSubDataNVX;this->m_ptr_glLGPUCopyImageSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC)&TraceTableDecorator::m_glLGPUCopyImageSubDataNVX_trace;}
+if(this->m_ptr_glTexStorage2D){this->m_orig_glTexStorage2D = this->m_ptr_glTexStorage2D;this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&TraceTableDecorator::m_glTexStorage2D_trace;}
+if(this->m_ptr_glColor3fv){this->m_orig_glColor3fv = this->m_ptr_glColor3fv;this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&TraceTableDecorator::m_glColor3fv_trace;}
+if(this->m_ptr_glGetMultiTexGendvEXT){this->m_orig_glGetMultiTexGendvEXT = this->m_ptr_glGetMultiTexGendvEXT;this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&TraceTableDecorator::m_glGetMultiTexGendvEXT_trace;}
+if(this->m_ptr_glVertexAttribL4dvEXT){this->m_orig_glVertexAttribL4dvEXT = this->m_ptr_glVertexAttribL4dvEXT;this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&TraceTableDecorator::m_glVertexAttribL4dvEXT_trace;}
+if(this->m_ptr_glGetActiveUniform){this->m_orig_glGetActiveUniform = this->m_ptr_glGetActiveUniform;this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&TraceTableDecorator::m_glGetActiveUniform_trace;}
+if(this->m_ptr_glUniform2ui64vARB){this->m_orig_glUniform2ui64vARB = this->m_ptr_glUniform2ui64vARB;this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&TraceTableDecorator::m_glUniform2ui64vARB_trace;}
+if(this->m_ptr_glMakeNamedBufferResidentNV){this->m_orig_glMakeNamedBufferResidentNV = this->m_ptr_glMakeNamedBufferResidentNV;this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&TraceTableDecorator::m_glMakeNamedBufferResidentNV_trace;}
+if(this->m_ptr_glPathGlyphIndexRangeNV){this->m_orig_glPathGlyphIndexRangeNV = this->m_ptr_glPathGlyphIndexRangeNV;this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&TraceTableDecorator::m_glPathGlyphIndexRangeNV_trace;}
+if(this->m_ptr_glColorPointer){this->m_orig_glColorPointer = this->m_ptr_glColorPointer;this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&TraceTableDecorator::m_glColorPointer_trace;}
+if(this->m_ptr_glProgramEnvParameterI4ivNV){this->m_orig_glProgramEnvParameterI4ivNV = this->m_ptr_glProgramEnvParameterI4ivNV;this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&TraceTableDecorator::m_glProgramEnvParameterI4ivNV_trace;}
+if(this->m_ptr_glMulticastGetQueryObjectui64vNV){this->m_orig_glMulticastGetQueryObjectui64vNV = this->m_ptr_glMulticastGetQueryObjectui64vNV;this->m_ptr_glMulticastGetQueryObjectui64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)&TraceTableDecorator::m_glMulticastGetQueryObjectui64vNV_trace;}
+if(this->m_ptr_glMultiTexParameterfEXT){this->m_orig_glMultiTexParameterfEXT = this->m_ptr_glMultiTexParameterfEXT;this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&TraceTableDecorator::m_glMultiTexParameterfEXT_trace;}
+if(this->m_ptr_glNamedFramebufferTextureLayer){this->m_orig_glNamedFramebufferTextureLayer = this->m_ptr_glNamedFramebufferTextureLayer;this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&TraceTableDecorator::m_glNamedFramebufferTextureLayer_trace;}
+if(this->m_ptr_glGetVertexArrayIntegervEXT){this->m_orig_glGetVertexArrayIntegervEXT = this->m_ptr_glGetVertexArrayIntegervEXT;this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&TraceTableDecorator::m_glGetVertexArrayIntegervEXT_trace;}
+if(this->m_ptr_glVertexAttrib3dARB){this->m_orig_glVertexAttrib3dARB = this->m_ptr_glVertexAttrib3dARB;this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&TraceTableDecorator::m_glVertexAttrib3dARB_trace;}
+if(this->m_ptr_glVDPAUIsSurfaceNV){this->m_orig_glVDPAUIsSurfaceNV = this->m_ptr_glVDPAUIsSurfaceNV;this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&TraceTableDecorator::m_glVDPAUIsSurfaceNV_trace;}
+if(this->m_ptr_glMultiTexImage1DEXT){this->m_orig_glMultiTexImage1DEXT = this->m_ptr_glMultiTexImage1DEXT;this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&TraceTableDecorator::m_glMultiTexImage1DEXT_trace;}
+if(this->m_ptr_glIsAsyncMarkerSGIX){this->m_orig_glIsAsyncMarkerSGIX = this->m_ptr_glIsAsyncMarkerSGIX;this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&TraceTableDecorator::m_glIsAsyncMarkerSGIX_trace;}
+if(this->m_ptr_glGetDoublei_vEXT){this->m_orig_glGetDoublei_vEXT = this->m_ptr_glGetDoublei_vEXT;this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&TraceTableDecorator::m_glGetDoublei_vEXT_trace;}
+if(this->m_ptr_glUniform2i64NV){this->m_orig_glUniform2i64NV = this->m_ptr_glUniform2i64NV;this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&TraceTableDecorator::m_glUniform2i64NV_trace;}
+if(this->m_ptr_glIsCommandListNV){this->m_orig_glIsCommandListNV = this->m_ptr_glIsCommandListNV;this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&TraceTableDecorator::m_glIsCommandListNV_trace;}
+if(this->m_ptr_glUniform3uiEXT){this->m_orig_glUniform3uiEXT = this->m_ptr_glUniform3uiEXT;this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&TraceTableDecorator::m_glUniform3uiEXT_trace;}
+if(this->m_ptr_glTexParameterIuivEXT){this->m_orig_glTexParameterIuivEXT = this->m_ptr_glTexParameterIuivEXT;this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glTexParameterIuivEXT_trace;}
+if(this->m_ptr_glProgramUniformMatrix4fv){this->m_orig_glProgramUniformMatrix4fv = this->m_ptr_glProgramUniformMatrix4fv;this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix4fv_trace;}
+if(this->m_ptr_glVertex2fv){this->m_orig_glVertex2fv = this->m_ptr_glVertex2fv;this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&TraceTableDecorator::m_glVertex2fv_trace;}
+if(this->m_ptr_glVertexAttribL3dEXT){this->m_orig_glVertexAttribL3dEXT = this->m_ptr_glVertexAttribL3dEXT;this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&TraceTableDecorator::m_glVertexAttribL3dEXT_trace;}
+if(this->m_ptr_glFramebufferRenderbuffer){this->m_orig_glFramebufferRenderbuffer = this->m_ptr_glFramebufferRenderbuffer;this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&TraceTableDecorator::m_glFramebufferRenderbuffer_trace;}
+if(this->m_ptr_glGetUniformLocationARB){this->m_orig_glGetUniformLocationARB = this->m_ptr_glGetUniformLocationARB;this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&TraceTableDecorator::m_glGetUniformLocationARB_trace;}
+if(this->m_ptr_glPathParameterfvNV){this->m_orig_glPathParameterfvNV = this->m_ptr_glPathParameterfvNV;this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&TraceTableDecorator::m_glPathParameterfvNV_trace;}
+if(this->m_ptr_glVertexAttrib3sNV){this->m_orig_glVertexAttrib3sNV = this->m_ptr_glVertexAttrib3sNV;this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&TraceTableDecorator::m_glVertexAttrib3sNV_trace;}
+if(this->m_ptr_glGetDoublei_v){this->m_orig_glGetDoublei_v = this->m_ptr_glGetDoublei_v;this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&TraceTableDecorator::m_glGetDoublei_v_trace;}
+if(this->m_ptr_glVertexAttrib1sv){this->m_orig_glVertexAttrib1sv = this->m_ptr_glVertexAttrib1sv;this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&TraceTableDecorator::m_glVertexAttrib1sv_trace;}
+if(this->m_ptr_glBindSampler){this->m_orig_glBindSampler = this->m_ptr_glBindSampler;this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&TraceTableDecorator::m_glBindSampler_trace;}
+if(this->m_ptr_glLineWidth){this->m_orig_glLineWidth = this->m_ptr_glLineWidth;this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&TraceTableDecorator::m_glLineWidth_trace;}
+if(this->m_ptr_glVertexArrayRangeAPPLE){this->m_orig_glVertexArrayRangeAPPLE = this->m_ptr_glVertexArrayRangeAPPLE;this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&TraceTableDecorator::m_glVertexArrayRangeAPPLE_trace;}
+if(this->m_ptr_glBindBufferOffsetEXT){this->m_orig_glBindBufferOffsetEXT = this->m_ptr_glBindBufferOffsetEXT;this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&TraceTableDecorator::m_glBindBufferOffsetEXT_trace;}
+if(this->m_ptr_glWeightfvARB){this->m_orig_glWeightfvARB = this->m_ptr_glWeightfvARB;this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&TraceTableDecorator::m_glWeightfvARB_trace;}
+if(this->m_ptr_glGetIntegeri_v){this->m_orig_glGetIntegeri_v = this->m_ptr_glGetIntegeri_v;this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&TraceTableDecorator::m_glGetIntegeri_v_trace;}
+if(this->m_ptr_glGetTransformFeedbackVarying){this->m_orig_glGetTransformFeedbackVarying = this->m_ptr_glGetTransformFeedbackVarying;this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&TraceTableDecorator::m_glGetTransformFeedbackVarying_trace;}
+if(this->m_ptr_glProgramLocalParameter4fvARB){this->m_orig_glProgramLocalParameter4fvARB = this->m_ptr_glProgramLocalParameter4fvARB;this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&TraceTableDecorator::m_glProgramLocalParameter4fvARB_trace;}
+if(this->m_ptr_glGetTransformFeedbackVaryingNV){this->m_orig_glGetTransformFeedbackVaryingNV = this->m_ptr_glGetTransformFeedbackVaryingNV;this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&TraceTableDecorator::m_glGetTransformFeedbackVaryingNV_trace;}
+if(this->m_ptr_glWindowPos2iv){this->m_orig_glWindowPos2iv = this->m_ptr_glWindowPos2iv;this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&TraceTableDecorator::m_glWindowPos2iv_trace;}
+if(this->m_ptr_glVertexStream1dATI){this->m_orig_glVertexStream1dATI = this->m_ptr_glVertexStream1dATI;this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&TraceTableDecorator::m_glVertexStream1dATI_trace;}
+if(this->m_ptr_glColorFragmentOp2ATI){this->m_orig_glColorFragmentOp2ATI = this->m_ptr_glColorFragmentOp2ATI;this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&TraceTableDecorator::m_glColorFragmentOp2ATI_trace;}
+if(this->m_ptr_glFogiv){this->m_orig_glFogiv = this->m_ptr_glFogiv;this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&TraceTableDecorator::m_glFogiv_trace;}
+if(this->m_ptr_glGetTextureHandleNV){this->m_orig_glGetTextureHandleNV = this->m_ptr_glGetTextureHandleNV;this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&TraceTableDecorator::m_glGetTextureHandleNV_trace;}
+if(this->m_ptr_glLightModeliv){this->m_orig_glLightModeliv = this->m_ptr_glLightModeliv;this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&TraceTableDecorator::m_glLightModeliv_trace;}
+if(this->m_ptr_glDepthRangef){this->m_orig_glDepthRangef = this->m_ptr_glDepthRangef;this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&TraceTableDecorator::m_glDepthRangef_trace;}
+if(this->m_ptr_glGetFragmentMaterialivSGIX){this->m_orig_glGetFragmentMaterialivSGIX = this->m_ptr_glGetFragmentMaterialivSGIX;this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&TraceTableDecorator::m_glGetFragmentMaterialivSGIX_trace;}
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV){this->m_orig_glVideoCaptureStreamParameterfvNV = this->m_ptr_glVideoCaptureStreamParameterfvNV;this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&TraceTableDecorator::m_glVideoCaptureStreamParameterfvNV_trace;}
+if(this->m_ptr_glDeleteProgramsARB){this->m_orig_glDeleteProgramsARB = this->m_ptr_glDeleteProgramsARB;this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&TraceTableDecorator::m_glDeleteProgramsARB_trace;}
+if(this->m_ptr_glWindowPos3fvARB){this->m_orig_glWindowPos3fvARB = this->m_ptr_glWindowPos3fvARB;this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&TraceTableDecorator::m_glWindowPos3fvARB_trace;}
+if(this->m_ptr_glFeedbackBufferxOES){this->m_orig_glFeedbackBufferxOES = this->m_ptr_glFeedbackBufferxOES;this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&TraceTableDecorator::m_glFeedbackBufferxOES_trace;}
+if(this->m_ptr_glGetTexBumpParameterfvATI){this->m_orig_glGetTexBumpParameterfvATI = this->m_ptr_glGetTexBumpParameterfvATI;this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&TraceTableDecorator::m_glGetTexBumpParameterfvATI_trace;}
+if(this->m_ptr_glEnablei){this->m_orig_glEnablei = this->m_ptr_glEnablei;this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&TraceTableDecorator::m_glEnablei_trace;}
+if(this->m_ptr_glGetActiveSubroutineName){this->m_orig_glGetActiveSubroutineName = this->m_ptr_glGetActiveSubroutineName;this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&TraceTableDecorator::m_glGetActiveSubroutineName_trace;}
+if(this->m_ptr_glDrawBuffersARB){this->m_orig_glDrawBuffersARB = this->m_ptr_glDrawBuffersARB;this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&TraceTableDecorator::m_glDrawBuffersARB_trace;}
+if(this->m_ptr_glBindProgramARB){this->m_orig_glBindProgramARB = this->m_ptr_glBindProgramARB;this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&TraceTableDecorator::m_glBindProgramARB_trace;}
+if(this->m_ptr_glEvalCoord1fv){this->m_orig_glEvalCoord1fv = this->m_ptr_glEvalCoord1fv;this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&TraceTableDecorator::m_glEvalCoord1fv_trace;}
+if(this->m_ptr_glProgramUniform3ui64vARB){this->m_orig_glProgramUniform3ui64vARB = this->m_ptr_glProgramUniform3ui64vARB;this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&TraceTableDecorator::m_glProgramUniform3ui64vARB_trace;}
+if(this->m_ptr_glProgramUniformMatrix2dv){this->m_orig_glProgramUniformMatrix2dv = this->m_ptr_glProgramUniformMatrix2dv;this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix2dv_trace;}
+if(this->m_ptr_glMultiTexCoord2hvNV){this->m_orig_glMultiTexCoord2hvNV = this->m_ptr_glMultiTexCoord2hvNV;this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&TraceTableDecorator::m_glMultiTexCoord2hvNV_trace;}
+if(this->m_ptr_glGetFloatIndexedvEXT){this->m_orig_glGetFloatIndexedvEXT = this->m_ptr_glGetFloatIndexedvEXT;this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&TraceTableDecorator::m_glGetFloatIndexedvEXT_trace;}
+if(this->m_ptr_glSampleCoverageARB){this->m_orig_glSampleCoverageARB = this->m_ptr_glSampleCoverageARB;this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&TraceTableDecorator::m_glSampleCoverageARB_trace;}
+if(this->m_ptr_glProgramUniform2ui64vARB){this->m_orig_glProgramUniform2ui64vARB = this->m_ptr_glProgramUniform2ui64vARB;this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&TraceTableDecorator::m_glProgramUniform2ui64vARB_trace;}
+if(this->m_ptr_glPixelDataRangeNV){this->m_orig_glPixelDataRangeNV = this->m_ptr_glPixelDataRangeNV;this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&TraceTableDecorator::m_glPixelDataRangeNV_trace;}
+if(this->m_ptr_glVertexStream3svATI){this->m_orig_glVertexStream3svATI = this->m_ptr_glVertexStream3svATI;this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&TraceTableDecorator::m_glVertexStream3svATI_trace;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glTexCoord3hvNV){this->m_orig_glTexCoord3hvNV = this->m_ptr_glTexCoord3hvNV;this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&TraceTableDecorator::m_glTexCoord3hvNV_trace;}
+if(this->m_ptr_glSampleMaski){this->m_orig_glSampleMaski = this->m_ptr_glSampleMaski;this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&TraceTableDecorator::m_glSampleMaski_trace;}
+if(this->m_ptr_glIndexFuncEXT){this->m_orig_glIndexFuncEXT = this->m_ptr_glIndexFuncEXT;this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&TraceTableDecorator::m_glIndexFuncEXT_trace;}
+if(this->m_ptr_glPointParameteriNV){this->m_orig_glPointParameteriNV = this->m_ptr_glPointParameteriNV;this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&TraceTableDecorator::m_glPointParameteriNV_trace;}
+if(this->m_ptr_glUniformMatrix3x2fv){this->m_orig_glUniformMatrix3x2fv = this->m_ptr_glUniformMatrix3x2fv;this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&TraceTableDecorator::m_glUniformMatrix3x2fv_trace;}
+if(this->m_ptr_glGetFramebufferParameterivEXT){this->m_orig_glGetFramebufferParameterivEXT = this->m_ptr_glGetFramebufferParameterivEXT;this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetFramebufferParameterivEXT_trace;}
+if(this->m_ptr_glUniform2i64ARB){this->m_orig_glUniform2i64ARB = this->m_ptr_glUniform2i64ARB;this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&TraceTableDecorator::m_glUniform2i64ARB_trace;}
+if(this->m_ptr_glNamedBufferStorageEXT){this->m_orig_glNamedBufferStorageEXT = this->m_ptr_glNamedBufferStorageEXT;this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&TraceTableDecorator::m_glNamedBufferStorageEXT_trace;}
+if(this->m_ptr_glNamedFramebufferTexture3DEXT){this->m_orig_glNamedFramebufferTexture3DEXT = this->m_ptr_glNamedFramebufferTexture3DEXT;this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&TraceTableDecorator::m_glNamedFramebufferTexture3DEXT_trace;}
+if(this->m_ptr_glVertexAttrib2dv){this->m_orig_glVertexAttrib2dv = this->m_ptr_glVertexAttrib2dv;this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&TraceTableDecorator::m_glVertexAttrib2dv_trace;}
+if(this->m_ptr_glGetVertexArrayPointervEXT){this->m_orig_glGetVertexArrayPointervEXT = this->m_ptr_glGetVertexArrayPointervEXT;this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&TraceTableDecorator::m_glGetVertexArrayPointervEXT_trace;}
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI){this->m_orig_glGetVertexAttribArrayObjectivATI = this->m_ptr_glGetVertexAttribArrayObjectivATI;this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&TraceTableDecorator::m_glGetVertexAttribArrayObjectivATI_trace;}
+if(this->m_ptr_glProgramUniformMatrix3fvEXT){this->m_orig_glProgramUniformMatrix3fvEXT = this->m_ptr_glProgramUniformMatrix3fvEXT;this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix3fvEXT_trace;}
+if(this->m_ptr_glEnableVertexArrayEXT){this->m_orig_glEnableVertexArrayEXT = this->m_ptr_glEnableVertexArrayEXT;this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&TraceTableDecorator::m_glEnableVertexArrayEXT_trace;}
+if(this->m_ptr_glColorTableParameterfvSGI){this->m_orig_glColorTableParameterfvSGI = this->m_ptr_glColorTableParameterfvSGI;this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&TraceTableDecorator::m_glColorTableParameterfvSGI_trace;}
+if(this->m_ptr_glEdgeFlag){this->m_orig_glEdgeFlag = this->m_ptr_glEdgeFlag;this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&TraceTableDecorator::m_glEdgeFlag_trace;}
+if(this->m_ptr_glFogCoordf){this->m_orig_glFogCoordf = this->m_ptr_glFogCoordf;this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&TraceTableDecorator::m_glFogCoordf_trace;}
+if(this->m_ptr_glVertex3d){this->m_orig_glVertex3d = this->m_ptr_glVertex3d;this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&TraceTableDecorator::m_glVertex3d_trace;}
+if(this->m_ptr_glVertex3f){this->m_orig_glVertex3f = this->m_ptr_glVertex3f;this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&TraceTableDecorator::m_glVertex3f_trace;}
+if(this->m_ptr_glSpriteParameterivSGIX){this->m_orig_glSpriteParameterivSGIX = this->m_ptr_glSpriteParameterivSGIX;this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&TraceTableDecorator::m_glSpriteParameterivSGIX_trace;}
+if(this->m_ptr_glPathGlyphRangeNV){this->m_orig_glPathGlyphRangeNV = this->m_ptr_glPathGlyphRangeNV;this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&TraceTableDecorator::m_glPathGlyphRangeNV_trace;}
+if(this->m_ptr_glPrimitiveBoundingBoxARB){this->m_orig_glPrimitiveBoundingBoxARB = this->m_ptr_glPrimitiveBoundingBoxARB;this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&TraceTableDecorator::m_glPrimitiveBoundingBoxARB_trace;}
+if(this->m_ptr_glVertexAttribL3ui64vNV){this->m_orig_glVertexAttribL3ui64vNV = this->m_ptr_glVertexAttribL3ui64vNV;this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&TraceTableDecorator::m_glVertexAttribL3ui64vNV_trace;}
+if(this->m_ptr_glVertex3s){this->m_orig_glVertex3s = this->m_ptr_glVertex3s;this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&TraceTableDecorator::m_glVertex3s_trace;}
+if(this->m_ptr_glTexCoordP2ui){this->m_orig_glTexCoordP2ui = this->m_ptr_glTexCoordP2ui;this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&TraceTableDecorator::m_glTexCoordP2ui_trace;}
+if(this->m_ptr_glProgramUniform2fvEXT){this->m_orig_glProgramUniform2fvEXT = this->m_ptr_glProgramUniform2fvEXT;this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&TraceTableDecorator::m_glProgramUniform2fvEXT_trace;}
+if(this->m_ptr_glDeletePathsNV){this->m_orig_glDeletePathsNV = this->m_ptr_glDeletePathsNV;this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&TraceTableDecorator::m_glDeletePathsNV_trace;}
+if(this->m_ptr_glPrimitiveRestartIndexNV){this->m_orig_glPrimitiveRestartIndexNV = this->m_ptr_glPrimitiveRestartIndexNV;this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&TraceTableDecorator::m_glPrimitiveRestartIndexNV_trace;}
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN){this->m_orig_glTexCoord2fColor3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor3fVertex3fvSUN;this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_trace;}
+if(this->m_ptr_glTexCoordPointerListIBM){this->m_orig_glTexCoordPointerListIBM = this->m_ptr_glTexCoordPointerListIBM;this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&TraceTableDecorator::m_glTexCoordPointerListIBM_trace;}
+if(this->m_ptr_glRectxOES){this->m_orig_glRectxOES = this->m_ptr_glRectxOES;this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&TraceTableDecorator::m_glRectxOES_trace;}
+if(this->m_ptr_glCopyNamedBufferSubData){this->m_orig_glCopyNamedBufferSubData = this->m_ptr_glCopyNamedBufferSubData;this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&TraceTableDecorator::m_glCopyNamedBufferSubData_trace;}
+if(this->m_ptr_glGenProgramsNV){this->m_orig_glGenProgramsNV = this->m_ptr_glGenProgramsNV;this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&TraceTableDecorator::m_glGenProgramsNV_trace;}
+if(this->m_ptr_glFragmentLightfSGIX){this->m_orig_glFragmentLightfSGIX = this->m_ptr_glFragmentLightfSGIX;this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&TraceTableDecorator::m_glFragmentLightfSGIX_trace;}
+if(this->m_ptr_glTexStorage3D){this->m_orig_glTexStorage3D = this->m_ptr_glTexStorage3D;this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&TraceTableDecorator::m_glTexStorage3D_trace;}
+if(this->m_ptr_glTextureParameteriv){this->m_orig_glTextureParameteriv = this->m_ptr_glTextureParameteriv;this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&TraceTableDecorator::m_glTextureParameteriv_trace;}
+if(this->m_ptr_glNamedBufferDataEXT){this->m_orig_glNamedBufferDataEXT = this->m_ptr_glNamedBufferDataEXT;this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&TraceTableDecorator::m_glNamedBufferDataEXT_trace;}
+if(this->m_ptr_glImportSemaphoreWin32NameEXT){this->m_orig_glImportSemaphoreWin32NameEXT = this->m_ptr_glImportSemaphoreWin32NameEXT;this->m_ptr_glImportSemaphoreWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)&TraceTableDecorator::m_glImportSemaphoreWin32NameEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3fvARB){this->m_orig_glMultiTexCoord3fvARB = this->m_ptr_glMultiTexCoord3fvARB;this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&TraceTableDecorator::m_glMultiTexCoord3fvARB_trace;}
+if(this->m_ptr_glUniformMatrix3x4fv){this->m_orig_glUniformMatrix3x4fv = this->m_ptr_glUniformMatrix3x4fv;this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&TraceTableDecorator::m_glUniformMatrix3x4fv_trace;}
+if(this->m_ptr_glSubpixelPrecisionBiasNV){this->m_orig_glSubpixelPrecisionBiasNV = this->m_ptr_glSubpixelPrecisionBiasNV;this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&TraceTableDecorator::m_glSubpixelPrecisionBiasNV_trace;}
+if(this->m_ptr_glNormalPointer){this->m_orig_glNormalPointer = this->m_ptr_glNormalPointer;this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&TraceTableDecorator::m_glNormalPointer_trace;}
+if(this->m_ptr_glNamedFramebufferTexture){this->m_orig_glNamedFramebufferTexture = this->m_ptr_glNamedFramebufferTexture;this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&TraceTableDecorator::m_glNamedFramebufferTexture_trace;}
+if(this->m_ptr_glVertexAttrib4NsvARB){this->m_orig_glVertexAttrib4NsvARB = this->m_ptr_glVertexAttrib4NsvARB;this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&TraceTableDecorator::m_glVertexAttrib4NsvARB_trace;}
+if(this->m_ptr_glPassThrough){this->m_orig_glPassThrough = this->m_ptr_glPassThrough;this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&TraceTableDecorator::m_glPassThrough_trace;}
+if(this->m_ptr_glSecondaryColorP3ui){this->m_orig_glSecondaryColorP3ui = this->m_ptr_glSecondaryColorP3ui;this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&TraceTableDecorator::m_glSecondaryColorP3ui_trace;}
+if(this->m_ptr_glInvalidateTexSubImage){this->m_orig_glInvalidateTexSubImage = this->m_ptr_glInvalidateTexSubImage;this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&TraceTableDecorator::m_glInvalidateTexSubImage_trace;}
+if(this->m_ptr_glIsImageHandleResidentARB){this->m_orig_glIsImageHandleResidentARB = this->m_ptr_glIsImageHandleResidentARB;this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&TraceTableDecorator::m_glIsImageHandleResidentARB_trace;}
+if(this->m_ptr_glTangent3fvEXT){this->m_orig_glTangent3fvEXT = this->m_ptr_glTangent3fvEXT;this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&TraceTableDecorator::m_glTangent3fvEXT_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x3fv){this->m_orig_glProgramUniformMatrix4x3fv = this->m_ptr_glProgramUniformMatrix4x3fv;this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x3fv_trace;}
+if(this->m_ptr_glBegin){this->m_orig_glBegin = this->m_ptr_glBegin;this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&TraceTableDecorator::m_glBegin_trace;}
+if(this->m_ptr_glEvalCoord2dv){this->m_orig_glEvalCoord2dv = this->m_ptr_glEvalCoord2dv;this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&TraceTableDecorator::m_glEvalCoord2dv_trace;}
+if(this->m_ptr_glColor3ubv){this->m_orig_glColor3ubv = this->m_ptr_glColor3ubv;this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&TraceTableDecorator::m_glColor3ubv_trace;}
+if(this->m_ptr_glFogCoordfvEXT){this->m_orig_glFogCoordfvEXT = this->m_ptr_glFogCoordfvEXT;this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&TraceTableDecorator::m_glFogCoordfvEXT_trace;}
+if(this->m_ptr_glVertexP3ui){this->m_orig_glVertexP3ui = this->m_ptr_glVertexP3ui;this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&TraceTableDecorator::m_glVertexP3ui_trace;}
+if(this->m_ptr_glLightfv){this->m_orig_glLightfv = this->m_ptr_glLightfv;this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&TraceTableDecorator::m_glLightfv_trace;}
+if(this->m_ptr_glVertexAttribL3i64NV){this->m_orig_glVertexAttribL3i64NV = this->m_ptr_glVertexAttribL3i64NV;this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&TraceTableDecorator::m_glVertexAttribL3i64NV_trace;}
+if(this->m_ptr_glStencilClearTagEXT){this->m_orig_glStencilClearTagEXT = this->m_ptr_glStencilClearTagEXT;this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&TraceTableDecorator::m_glStencilClearTagEXT_trace;}
+if(this->m_ptr_glGetActiveUniformName){this->m_orig_glGetActiveUniformName = this->m_ptr_glGetActiveUniformName;this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&TraceTableDecorator::m_glGetActiveUniformName_trace;}
+if(this->m_ptr_glTangentPointerEXT){this->m_orig_glTangentPointerEXT = this->m_ptr_glTangentPointerEXT;this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&TraceTableDecorator::m_glTangentPointerEXT_trace;}
+if(this->m_ptr_glUniform4ui64vNV){this->m_orig_glUniform4ui64vNV = this->m_ptr_glUniform4ui64vNV;this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&TraceTableDecorator::m_glUniform4ui64vNV_trace;}
+if(this->m_ptr_glDebugMessageEnableAMD){this->m_orig_glDebugMessageEnableAMD = this->m_ptr_glDebugMessageEnableAMD;this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&TraceTableDecorator::m_glDebugMessageEnableAMD_trace;}
+if(this->m_ptr_glProgramUniform2ui){this->m_orig_glProgramUniform2ui = this->m_ptr_glProgramUniform2ui;this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&TraceTableDecorator::m_glProgramUniform2ui_trace;}
+if(this->m_ptr_glCopyTexSubImage2DEXT){this->m_orig_glCopyTexSubImage2DEXT = this->m_ptr_glCopyTexSubImage2DEXT;this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glCopyTexSubImage2DEXT_trace;}
+if(this->m_ptr_glGenRenderbuffersEXT){this->m_orig_glGenRenderbuffersEXT = this->m_ptr_glGenRenderbuffersEXT;this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&TraceTableDecorator::m_glGenRenderbuffersEXT_trace;}
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT){this->m_orig_glNamedProgramLocalParameterI4ivEXT = this->m_ptr_glNamedProgramLocalParameterI4ivEXT;this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_trace;}
+if(this->m_ptr_glMultiTexCoord2f){this->m_orig_glMultiTexCoord2f = this->m_ptr_glMultiTexCoord2f;this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&TraceTableDecorator::m_glMultiTexCoord2f_trace;}
+if(this->m_ptr_glMapGrid2d){this->m_orig_glMapGrid2d = this->m_ptr_glMapGrid2d;this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&TraceTableDecorator::m_glMapGrid2d_trace;}
+if(this->m_ptr_glGetMultiTexParameterIuivEXT){this->m_orig_glGetMultiTexParameterIuivEXT = this->m_ptr_glGetMultiTexParameterIuivEXT;this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glGetMultiTexParameterIuivEXT_trace;}
+if(this->m_ptr_glBlendEquationiARB){this->m_orig_glBlendEquationiARB = this->m_ptr_glBlendEquationiARB;this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&TraceTableDecorator::m_glBlendEquationiARB_trace;}
+if(this->m_ptr_glTexParameteriv){this->m_orig_glTexParameteriv = this->m_ptr_glTexParameteriv;this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&TraceTableDecorator::m_glTexParameteriv_trace;}
+if(this->m_ptr_glUniform4ivARB){this->m_orig_glUniform4ivARB = this->m_ptr_glUniform4ivARB;this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&TraceTableDecorator::m_glUniform4ivARB_trace;}
+if(this->m_ptr_glMatrixOrthoEXT){this->m_orig_glMatrixOrthoEXT = this->m_ptr_glMatrixOrthoEXT;this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&TraceTableDecorator::m_glMatrixOrthoEXT_trace;}
+if(this->m_ptr_glVertexArrayVertexBuffer){this->m_orig_glVertexArrayVertexBuffer = this->m_ptr_glVertexArrayVertexBuffer;this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&TraceTableDecorator::m_glVertexArrayVertexBuffer_trace;}
+if(this->m_ptr_glProgramLocalParametersI4ivNV){this->m_orig_glProgramLocalParametersI4ivNV = this->m_ptr_glProgramLocalParametersI4ivNV;this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&TraceTableDecorator::m_glProgramLocalParametersI4ivNV_trace;}
+if(this->m_ptr_glProgramUniform4ui64vNV){this->m_orig_glProgramUniform4ui64vNV = this->m_ptr_glProgramUniform4ui64vNV;this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&TraceTableDecorator::m_glProgramUniform4ui64vNV_trace;}
+if(this->m_ptr_glGetNamedStringivARB){this->m_orig_glGetNamedStringivARB = this->m_ptr_glGetNamedStringivARB;this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&TraceTableDecorator::m_glGetNamedStringivARB_trace;}
+if(this->m_ptr_glVertexAttribL1i64vNV){this->m_orig_glVertexAttribL1i64vNV = this->m_ptr_glVertexAttribL1i64vNV;this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&TraceTableDecorator::m_glVertexAttribL1i64vNV_trace;}
+if(this->m_ptr_glTransformFeedbackBufferBase){this->m_orig_glTransformFeedbackBufferBase = this->m_ptr_glTransformFeedbackBufferBase;this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&TraceTableDecorator::m_glTransformFeedbackBufferBase_trace;}
+if(this->m_ptr_glIndexsv){this->m_orig_glIndexsv = this->m_ptr_glIndexsv;this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&TraceTableDecorator::m_glIndexsv_trace;}
+if(this->m_ptr_glPointParameterivNV){this->m_orig_glPointParameterivNV = this->m_ptr_glPointParameterivNV;this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&TraceTableDecorator::m_glPointParameterivNV_trace;}
+if(this->m_ptr_glGetDetailTexFuncSGIS){this->m_orig_glGetDetailTexFuncSGIS = this->m_ptr_glGetDetailTexFuncSGIS;this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&TraceTableDecorator::m_glGetDetailTexFuncSGIS_trace;}
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN){this->m_orig_glReplacementCodeuiColor3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_trace;}
+if(this->m_ptr_glProgramLocalParameter4fARB){this->m_orig_glProgramLocalParameter4fARB = this->m_ptr_glProgramLocalParameter4fARB;this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&TraceTableDecorator::m_glProgramLocalParameter4fARB_trace;}
+if(this->m_ptr_glBitmap){this->m_orig_glBitmap = this->m_ptr_glBitmap;this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&TraceTableDecorator::m_glBitmap_trace;}
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT){this->m_orig_glNamedFramebufferTextureLayerEXT = this->m_ptr_glNamedFramebufferTextureLayerEXT;this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&TraceTableDecorator::m_glNamedFramebufferTextureLayerEXT_trace;}
+if(this->m_ptr_glMultiTexGenfvEXT){this->m_orig_glMultiTexGenfvEXT = this->m_ptr_glMultiTexGenfvEXT;this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&TraceTableDecorator::m_glMultiTexGenfvEXT_trace;}
+if(this->m_ptr_glGetNamedBufferSubData){this->m_orig_glGetNamedBufferSubData = this->m_ptr_glGetNamedBufferSubData;this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&TraceTableDecorator::m_glGetNamedBufferSubData_trace;}
+if(this->m_ptr_glStencilFuncSeparateATI){this->m_orig_glStencilFuncSeparateATI = this->m_ptr_glStencilFuncSeparateATI;this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&TraceTableDecorator::m_glStencilFuncSeparateATI_trace;}
+if(this->m_ptr_glProgramUniform2iv){this->m_orig_glProgramUniform2iv = this->m_ptr_glProgramUniform2iv;this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&TraceTableDecorator::m_glProgramUniform2iv_trace;}
+if(this->m_ptr_glGetQueryiv){this->m_orig_glGetQueryiv = this->m_ptr_glGetQueryiv;this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&TraceTableDecorator::m_glGetQueryiv_trace;}
+if(this->m_ptr_glTexCoord4f){this->m_orig_glTexCoord4f = this->m_ptr_glTexCoord4f;this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&TraceTableDecorator::m_glTexCoord4f_trace;}
+if(this->m_ptr_glMapGrid2f){this->m_orig_glMapGrid2f = this->m_ptr_glMapGrid2f;this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&TraceTableDecorator::m_glMapGrid2f_trace;}
+if(this->m_ptr_glListParameterivSGIX){this->m_orig_glListParameterivSGIX = this->m_ptr_glListParameterivSGIX;this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&TraceTableDecorator::m_glListParameterivSGIX_trace;}
+if(this->m_ptr_glCreateQueries){this->m_orig_glCreateQueries = this->m_ptr_glCreateQueries;this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&TraceTableDecorator::m_glCreateQueries_trace;}
+if(this->m_ptr_glGetSamplerParameterfv){this->m_orig_glGetSamplerParameterfv = this->m_ptr_glGetSamplerParameterfv;this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&TraceTableDecorator::m_glGetSamplerParameterfv_trace;}
+if(this->m_ptr_glTexCoord4i){this->m_orig_glTexCoord4i = this->m_ptr_glTexCoord4i;this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&TraceTableDecorator::m_glTexCoord4i_trace;}
+if(this->m_ptr_glObjectLabel){this->m_orig_glObjectLabel = this->m_ptr_glObjectLabel;this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&TraceTableDecorator::m_glObjectLabel_trace;}
+if(this->m_ptr_glProgramUniform3i64NV){this->m_orig_glProgramUniform3i64NV = this->m_ptr_glProgramUniform3i64NV;this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&TraceTableDecorator::m_glProgramUniform3i64NV_trace;}
+if(this->m_ptr_glGetTextureHandleARB){this->m_orig_glGetTextureHandleARB = this->m_ptr_glGetTextureHandleARB;this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&TraceTableDecorator::m_glGetTextureHandleARB_trace;}
+if(this->m_ptr_glTexCoord4s){this->m_orig_glTexCoord4s = this->m_ptr_glTexCoord4s;this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&TraceTableDecorator::m_glTexCoord4s_trace;}
+if(this->m_ptr_glUniform4iARB){this->m_orig_glUniform4iARB = this->m_ptr_glUniform4iARB;this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&TraceTableDecorator::m_glUniform4iARB_trace;}
+if(this->m_ptr_glGetUniformIndices){this->m_orig_glGetUniformIndices = this->m_ptr_glGetUniformIndices;this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&TraceTableDecorator::m_glGetUniformIndices_trace;}
+if(this->m_ptr_glMultiTexImage3DEXT){this->m_orig_glMultiTexImage3DEXT = this->m_ptr_glMultiTexImage3DEXT;this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&TraceTableDecorator::m_glMultiTexImage3DEXT_trace;}
+if(this->m_ptr_glCoverageModulationTableNV){this->m_orig_glCoverageModulationTableNV = this->m_ptr_glCoverageModulationTableNV;this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&TraceTableDecorator::m_glCoverageModulationTableNV_trace;}
+if(this->m_ptr_glPointParameteriv){this->m_orig_glPointParameteriv = this->m_ptr_glPointParameteriv;this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&TraceTableDecorator::m_glPointParameteriv_trace;}
+if(this->m_ptr_glMultiTexCoord4svARB){this->m_orig_glMultiTexCoord4svARB = this->m_ptr_glMultiTexCoord4svARB;this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&TraceTableDecorator::m_glMultiTexCoord4svARB_trace;}
+if(this->m_ptr_glNormal3fv){this->m_orig_glNormal3fv = this->m_ptr_glNormal3fv;this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&TraceTableDecorator::m_glNormal3fv_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT){this->m_orig_glProgramUniformMatrix3x4dvEXT = this->m_ptr_glProgramUniformMatrix3x4dvEXT;this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x4dvEXT_trace;}
+if(this->m_ptr_glTexCoord1fv){this->m_orig_glTexCoord1fv = this->m_ptr_glTexCoord1fv;this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&TraceTableDecorator::m_glTexCoord1fv_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT){this->m_orig_glProgramUniformMatrix4x3dvEXT = this->m_ptr_glProgramUniformMatrix4x3dvEXT;this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x3dvEXT_trace;}
+if(this->m_ptr_glGetActiveVaryingNV){this->m_orig_glGetActiveVaryingNV = this->m_ptr_glGetActiveVaryingNV;this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&TraceTableDecorator::m_glGetActiveVaryingNV_trace;}
+if(this->m_ptr_glUniform1i64vARB){this->m_orig_glUniform1i64vARB = this->m_ptr_glUniform1i64vARB;this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&TraceTableDecorator::m_glUniform1i64vARB_trace;}
+if(this->m_ptr_glMultiTexCoord1dv){this->m_orig_glMultiTexCoord1dv = this->m_ptr_glMultiTexCoord1dv;this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&TraceTableDecorator::m_glMultiTexCoord1dv_trace;}
+if(this->m_ptr_glTexCoord3fv){this->m_orig_glTexCoord3fv = this->m_ptr_glTexCoord3fv;this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&TraceTableDecorator::m_glTexCoord3fv_trace;}
+if(this->m_ptr_glMatrixTranslatefEXT){this->m_orig_glMatrixTranslatefEXT = this->m_ptr_glMatrixTranslatefEXT;this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&TraceTableDecorator::m_glMatrixTranslatefEXT_trace;}
+if(this->m_ptr_glProgramUniform1ui64vNV){this->m_orig_glProgramUniform1ui64vNV = this->m_ptr_glProgramUniform1ui64vNV;this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&TraceTableDecorator::m_glProgramUniform1ui64vNV_trace;}
+if(this->m_ptr_glTextureMaterialEXT){this->m_orig_glTextureMaterialEXT = this->m_ptr_glTextureMaterialEXT;this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&TraceTableDecorator::m_glTextureMaterialEXT_trace;}
+if(this->m_ptr_glMultiTexCoordP3uiv){this->m_orig_glMultiTexCoordP3uiv = this->m_ptr_glMultiTexCoordP3uiv;this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&TraceTableDecorator::m_glMultiTexCoordP3uiv_trace;}
+if(this->m_ptr_glVertexAttribP3ui){this->m_orig_glVertexAttribP3ui = this->m_ptr_glVertexAttribP3ui;this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&TraceTableDecorator::m_glVertexAttribP3ui_trace;}
+if(this->m_ptr_glInterpolatePathsNV){this->m_orig_glInterpolatePathsNV = this->m_ptr_glInterpolatePathsNV;this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&TraceTableDecorator::m_glInterpolatePathsNV_trace;}
+if(this->m_ptr_glTextureBufferRange){this->m_orig_glTextureBufferRange = this->m_ptr_glTextureBufferRange;this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&TraceTableDecorator::m_glTextureBufferRange_trace;}
+if(this->m_ptr_glVertexAttribL2dEXT){this->m_orig_glVertexAttribL2dEXT = this->m_ptr_glVertexAttribL2dEXT;this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&TraceTableDecorator::m_glVertexAttribL2dEXT_trace;}
+if(this->m_ptr_glGetPixelTransformParameterivEXT){this->m_orig_glGetPixelTransformParameterivEXT = this->m_ptr_glGetPixelTransformParameterivEXT;this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetPixelTransformParameterivEXT_trace;}
+if(this->m_ptr_glTexCoord4xvOES){this->m_orig_glTexCoord4xvOES = this->m_ptr_glTexCoord4xvOES;this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&TraceTableDecorator::m_glTexCoord4xvOES_trace;}
+if(this->m_ptr_glGetVariantBooleanvEXT){this->m_orig_glGetVariantBooleanvEXT = this->m_ptr_glGetVariantBooleanvEXT;this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&TraceTableDecorator::m_glGetVariantBooleanvEXT_trace;}
+if(this->m_ptr_glDepthRange){this->m_orig_glDepthRange = this->m_ptr_glDepthRange;this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&TraceTableDecorator::m_glDepthRange_trace;}
+if(this->m_ptr_glGetVertexAttribdvARB){this->m_orig_glGetVertexAttribdvARB = this->m_ptr_glGetVertexAttribdvARB;this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&TraceTableDecorator::m_glGetVertexAttribdvARB_trace;}
+if(this->m_ptr_glGetColorTableParameterfv){this->m_orig_glGetColorTableParameterfv = this->m_ptr_glGetColorTableParameterfv;this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&TraceTableDecorator::m_glGetColorTableParameterfv_trace;}
+if(this->m_ptr_glDrawArraysInstancedEXT){this->m_orig_glDrawArraysInstancedEXT = this->m_ptr_glDrawArraysInstancedEXT;this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&TraceTableDecorator::m_glDrawArraysInstancedEXT_trace;}
+if(this->m_ptr_glDisableClientStateIndexedEXT){this->m_orig_glDisableClientStateIndexedEXT = this->m_ptr_glDisableClientStateIndexedEXT;this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&TraceTableDecorator::m_glDisableClientStateIndexedEXT_trace;}
+if(this->m_ptr_glDrawBuffer){this->m_orig_glDrawBuffer = this->m_ptr_glDrawBuffer;this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&TraceTableDecorator::m_glDrawBuffer_trace;}
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV){this->m_orig_glMultiDrawArraysIndirectBindlessNV = this->m_ptr_glMultiDrawArraysIndirectBindlessNV;this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&TraceTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_trace;}
+if(this->m_ptr_glGetnPixelMapusv){this->m_orig_glGetnPixelMapusv = this->m_ptr_glGetnPixelMapusv;this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&TraceTableDecorator::m_glGetnPixelMapusv_trace;}
+if(this->m_ptr_glRasterPos3fv){this->m_orig_glRasterPos3fv = this->m_ptr_glRasterPos3fv;this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&TraceTableDecorator::m_glRasterPos3fv_trace;}
+if(this->m_ptr_glClearBufferuiv){this->m_orig_glClearBufferuiv = this->m_ptr_glClearBufferuiv;this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&TraceTableDecorator::m_glClearBufferuiv_trace;}
+if(this->m_ptr_glGetInternalformati64v){this->m_orig_glGetInternalformati64v = this->m_ptr_glGetInternalformati64v;this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&TraceTableDecorator::m_glGetInternalformati64v_trace;}
+if(this->m_ptr_glShaderSourceARB){this->m_orig_glShaderSourceARB = this->m_ptr_glShaderSourceARB;this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&TraceTableDecorator::m_glShaderSourceARB_trace;}
+if(this->m_ptr_glShaderOp3EXT){this->m_orig_glShaderOp3EXT = this->m_ptr_glShaderOp3EXT;this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&TraceTableDecorator::m_glShaderOp3EXT_trace;}
+if(this->m_ptr_glWindowPos2dvMESA){this->m_orig_glWindowPos2dvMESA = this->m_ptr_glWindowPos2dvMESA;this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&TraceTableDecorator::m_glWindowPos2dvMESA_trace;}
+if(this->m_ptr_glClearIndex){this->m_orig_glClearIndex = this->m_ptr_glClearIndex;this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&TraceTableDecorator::m_glClearIndex_trace;}
+if(this->m_ptr_glProvokingVertexEXT){this->m_orig_glProvokingVertexEXT = this->m_ptr_glProvokingVertexEXT;this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&TraceTableDecorator::m_glProvokingVertexEXT_trace;}
+if(this->m_ptr_glVariantubvEXT){this->m_orig_glVariantubvEXT = this->m_ptr_glVariantubvEXT;this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&TraceTableDecorator::m_glVariantubvEXT_trace;}
+if(this->m_ptr_glFlush){this->m_orig_glFlush = this->m_ptr_glFlush;this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&TraceTableDecorator::m_glFlush_trace;}
+if(this->m_ptr_glFramebufferTexture2DEXT){this->m_orig_glFramebufferTexture2DEXT = this->m_ptr_glFramebufferTexture2DEXT;this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&TraceTableDecorator::m_glFramebufferTexture2DEXT_trace;}
+if(this->m_ptr_glGetColorTableParameterivEXT){this->m_orig_glGetColorTableParameterivEXT = this->m_ptr_glGetColorTableParameterivEXT;this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetColorTableParameterivEXT_trace;}
+if(this->m_ptr_glPresentFrameDualFillNV){this->m_orig_glPresentFrameDualFillNV = this->m_ptr_glPresentFrameDualFillNV;this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&TraceTableDecorator::m_glPresentFrameDualFillNV_trace;}
+if(this->m_ptr_glGenVertexShadersEXT){this->m_orig_glGenVertexShadersEXT = this->m_ptr_glGenVertexShadersEXT;this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&TraceTableDecorator::m_glGenVertexShadersEXT_trace;}
+if(this->m_ptr_glSpecializeShaderARB){this->m_orig_glSpecializeShaderARB = this->m_ptr_glSpecializeShaderARB;this->m_ptr_glSpecializeShaderARB = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC)&TraceTableDecorator::m_glSpecializeShaderARB_trace;}
+if(this->m_ptr_glProgramUniformHandleui64vARB){this->m_orig_glProgramUniformHandleui64vARB = this->m_ptr_glProgramUniformHandleui64vARB;this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&TraceTableDecorator::m_glProgramUniformHandleui64vARB_trace;}
+if(this->m_ptr_glDepthRangefOES){this->m_orig_glDepthRangefOES = this->m_ptr_glDepthRangefOES;this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&TraceTableDecorator::m_glDepthRangefOES_trace;}
+if(this->m_ptr_glDeleteVertexArrays){this->m_orig_glDeleteVertexArrays = this->m_ptr_glDeleteVertexArrays;this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&TraceTableDecorator::m_glDeleteVertexArrays_trace;}
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance){this->m_orig_glDrawElementsInstancedBaseVertexBaseInstance = this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance;this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&TraceTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_trace;}
+if(this->m_ptr_glGetTexLevelParameteriv){this->m_orig_glGetTexLevelParameteriv = this->m_ptr_glGetTexLevelParameteriv;this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&TraceTableDecorator::m_glGetTexLevelParameteriv_trace;}
+if(this->m_ptr_glDrawVkImageNV){this->m_orig_glDrawVkImageNV = this->m_ptr_glDrawVkImageNV;this->m_ptr_glDrawVkImageNV = (FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC)&TraceTableDecorator::m_glDrawVkImageNV_trace;}
+if(this->m_ptr_glWindowPos3iARB){this->m_orig_glWindowPos3iARB = this->m_ptr_glWindowPos3iARB;this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&TraceTableDecorator::m_glWindowPos3iARB_trace;}
+if(this->m_ptr_glPrioritizeTextures){this->m_orig_glPrioritizeTextures = this->m_ptr_glPrioritizeTextures;this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&TraceTableDecorator::m_glPrioritizeTextures_trace;}
+if(this->m_ptr_glWindowPos3fvMESA){this->m_orig_glWindowPos3fvMESA = this->m_ptr_glWindowPos3fvMESA;this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&TraceTableDecorator::m_glWindowPos3fvMESA_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT){this->m_orig_glProgramUniformMatrix3x2dvEXT = this->m_ptr_glProgramUniformMatrix3x2dvEXT;this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x2dvEXT_trace;}
+if(this->m_ptr_glVertex4xvOES){this->m_orig_glVertex4xvOES = this->m_ptr_glVertex4xvOES;this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&TraceTableDecorator::m_glVertex4xvOES_trace;}
+if(this->m_ptr_glTexStorage3DMultisample){this->m_orig_glTexStorage3DMultisample = this->m_ptr_glTexStorage3DMultisample;this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&TraceTableDecorator::m_glTexStorage3DMultisample_trace;}
+if(this->m_ptr_glWindowPos2sARB){this->m_orig_glWindowPos2sARB = this->m_ptr_glWindowPos2sARB;this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&TraceTableDecorator::m_glWindowPos2sARB_trace;}
+if(this->m_ptr_glStencilOpValueAMD){this->m_orig_glStencilOpValueAMD = this->m_ptr_glStencilOpValueAMD;this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&TraceTableDecorator::m_glStencilOpValueAMD_trace;}
+if(this->m_ptr_glProgramVertexLimitNV){this->m_orig_glProgramVertexLimitNV = this->m_ptr_glProgramVertexLimitNV;this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&TraceTableDecorator::m_glProgramVertexLimitNV_trace;}
+if(this->m_ptr_glGetTexParameterPointervAPPLE){this->m_orig_glGetTexParameterPointervAPPLE = this->m_ptr_glGetTexParameterPointervAPPLE;this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&TraceTableDecorator::m_glGetTexParameterPointervAPPLE_trace;}
+if(this->m_ptr_glProgramUniform3uivEXT){this->m_orig_glProgramUniform3uivEXT = this->m_ptr_glProgramUniform3uivEXT;this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&TraceTableDecorator::m_glProgramUniform3uivEXT_trace;}
+if(this->m_ptr_glClampColor){this->m_orig_glClampColor = this->m_ptr_glClampColor;this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&TraceTableDecorator::m_glClampColor_trace;}
+if(this->m_ptr_glClearStencil){this->m_orig_glClearStencil = this->m_ptr_glClearStencil;this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&TraceTableDecorator::m_glClearStencil_trace;}
+if(this->m_ptr_glTexCoordP1uiv){this->m_orig_glTexCoordP1uiv = this->m_ptr_glTexCoordP1uiv;this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&TraceTableDecorator::m_glTexCoordP1uiv_trace;}
+if(this->m_ptr_glVertexAttribs3svNV){this->m_orig_glVertexAttribs3svNV = this->m_ptr_glVertexAttribs3svNV;this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&TraceTableDecorator::m_glVertexAttribs3svNV_trace;}
+if(this->m_ptr_glMultiTexCoord3fv){this->m_orig_glMultiTexCoord3fv = this->m_ptr_glMultiTexCoord3fv;this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&TraceTableDecorator::m_glMultiTexCoord3fv_trace;}
+if(this->m_ptr_glVertexBlendEnvfATI){this->m_orig_glVertexBlendEnvfATI = this->m_ptr_glVertexBlendEnvfATI;this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&TraceTableDecorator::m_glVertexBlendEnvfATI_trace;}
+if(this->m_ptr_glIsFenceAPPLE){this->m_orig_glIsFenceAPPLE = this->m_ptr_glIsFenceAPPLE;this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&TraceTableDecorator::m_glIsFenceAPPLE_trace;}
+if(this->m_ptr_glGetBufferParameterui64vNV){this->m_orig_glGetBufferParameterui64vNV = this->m_ptr_glGetBufferParameterui64vNV;this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&TraceTableDecorator::m_glGetBufferParameterui64vNV_trace;}
+if(this->m_ptr_glVertexAttribI4bvEXT){this->m_orig_glVertexAttribI4bvEXT = this->m_ptr_glVertexAttribI4bvEXT;this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&TraceTableDecorator::m_glVertexAttribI4bvEXT_trace;}
+if(this->m_ptr_glUniform2fARB){this->m_orig_glUniform2fARB = this->m_ptr_glUniform2fARB;this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&TraceTableDecorator::m_glUniform2fARB_trace;}
+if(this->m_ptr_glStopInstrumentsSGIX){this->m_orig_glStopInstrumentsSGIX = this->m_ptr_glStopInstrumentsSGIX;this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&TraceTableDecorator::m_glStopInstrumentsSGIX_trace;}
+if(this->m_ptr_glVertexAttrib3fNV){this->m_orig_glVertexAttrib3fNV = this->m_ptr_glVertexAttrib3fNV;this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&TraceTableDecorator::m_glVertexAttrib3fNV_trace;}
+if(this->m_ptr_glMapVertexAttrib2dAPPLE){this->m_orig_glMapVertexAttrib2dAPPLE = this->m_ptr_glMapVertexAttrib2dAPPLE;this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&TraceTableDecorator::m_glMapVertexAttrib2dAPPLE_trace;}
+if(this->m_ptr_glVertex2f){this->m_orig_glVertex2f = this->m_ptr_glVertex2f;this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&TraceTableDecorator::m_glVertex2f_trace;}
+if(this->m_ptr_glCopyTextureImage2DEXT){this->m_orig_glCopyTextureImage2DEXT = this->m_ptr_glCopyTextureImage2DEXT;this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&TraceTableDecorator::m_glCopyTextureImage2DEXT_trace;}
+if(this->m_ptr_glVertex2d){this->m_orig_glVertex2d = this->m_ptr_glVertex2d;this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&TraceTableDecorator::m_glVertex2d_trace;}
+if(this->m_ptr_glSecondaryColor3bvEXT){this->m_orig_glSecondaryColor3bvEXT = this->m_ptr_glSecondaryColor3bvEXT;this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3bvEXT_trace;}
+if(this->m_ptr_glMultiTexCoord4fARB){this->m_orig_glMultiTexCoord4fARB = this->m_ptr_glMultiTexCoord4fARB;this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&TraceTableDecorator::m_glMultiTexCoord4fARB_trace;}
+if(this->m_ptr_glPolygonOffset){this->m_orig_glPolygonOffset = this->m_ptr_glPolygonOffset;this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&TraceTableDecorator::m_glPolygonOffset_trace;}
+if(this->m_ptr_glTangent3bvEXT){this->m_orig_glTangent3bvEXT = this->m_ptr_glTangent3bvEXT;this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&TraceTableDecorator::m_glTangent3bvEXT_trace;}
+if(this->m_ptr_glHistogram){this->m_orig_glHistogram = this->m_ptr_glHistogram;this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&TraceTableDecorator::m_glHistogram_trace;}
+if(this->m_ptr_glGetProgramiv){this->m_orig_glGetProgramiv = this->m_ptr_glGetProgramiv;this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&TraceTableDecorator::m_glGetProgramiv_trace;}
+if(this->m_ptr_glMatrixIndexubvARB){this->m_orig_glMatrixIndexubvARB = this->m_ptr_glMatrixIndexubvARB;this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&TraceTableDecorator::m_glMatrixIndexubvARB_trace;}
+if(this->m_ptr_glVertex2s){this->m_orig_glVertex2s = this->m_ptr_glVertex2s;this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&TraceTableDecorator::m_glVertex2s_trace;}
+if(this->m_ptr_glGetVertexAttribLui64vNV){this->m_orig_glGetVertexAttribLui64vNV = this->m_ptr_glGetVertexAttribLui64vNV;this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&TraceTableDecorator::m_glGetVertexAttribLui64vNV_trace;}
+if(this->m_ptr_glGetProgramStringARB){this->m_orig_glGetProgramStringARB = this->m_ptr_glGetProgramStringARB;this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&TraceTableDecorator::m_glGetProgramStringARB_trace;}
+if(this->m_ptr_glFlushMappedBufferRange){this->m_orig_glFlushMappedBufferRange = this->m_ptr_glFlushMappedBufferRange;this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&TraceTableDecorator::m_glFlushMappedBufferRange_trace;}
+if(this->m_ptr_glVertexAttribI3uiEXT){this->m_orig_glVertexAttribI3uiEXT = this->m_ptr_glVertexAttribI3uiEXT;this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&TraceTableDecorator::m_glVertexAttribI3uiEXT_trace;}
+if(this->m_ptr_glLineWidthxOES){this->m_orig_glLineWidthxOES = this->m_ptr_glLineWidthxOES;this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&TraceTableDecorator::m_glLineWidthxOES_trace;}
+if(this->m_ptr_glProgramUniformMatrix2fvEXT){this->m_orig_glProgramUniformMatrix2fvEXT = this->m_ptr_glProgramUniformMatrix2fvEXT;this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix2fvEXT_trace;}
+if(this->m_ptr_glGetTextureParameterIuivEXT){this->m_orig_glGetTextureParameterIuivEXT = this->m_ptr_glGetTextureParameterIuivEXT;this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glGetTextureParameterIuivEXT_trace;}
+if(this->m_ptr_glGetMultiTexEnvivEXT){this->m_orig_glGetMultiTexEnvivEXT = this->m_ptr_glGetMultiTexEnvivEXT;this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&TraceTableDecorator::m_glGetMultiTexEnvivEXT_trace;}
+if(this->m_ptr_glPixelTexGenParameterivSGIS){this->m_orig_glPixelTexGenParameterivSGIS = this->m_ptr_glPixelTexGenParameterivSGIS;this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&TraceTableDecorator::m_glPixelTexGenParameterivSGIS_trace;}
+if(this->m_ptr_glGenQueries){this->m_orig_glGenQueries = this->m_ptr_glGenQueries;this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&TraceTableDecorator::m_glGenQueries_trace;}
+if(this->m_ptr_glGetPixelMapfv){this->m_orig_glGetPixelMapfv = this->m_ptr_glGetPixelMapfv;this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&TraceTableDecorator::m_glGetPixelMapfv_trace;}
+if(this->m_ptr_glBlendColorEXT){this->m_orig_glBlendColorEXT = this->m_ptr_glBlendColorEXT;this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&TraceTableDecorator::m_glBlendColorEXT_trace;}
+if(this->m_ptr_glResetMinmax){this->m_orig_glResetMinmax = this->m_ptr_glResetMinmax;this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&TraceTableDecorator::m_glResetMinmax_trace;}
+if(this->m_ptr_glGetnUniformivARB){this->m_orig_glGetnUniformivARB = this->m_ptr_glGetnUniformivARB;this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&TraceTableDecorator::m_glGetnUniformivARB_trace;}
+if(this->m_ptr_glVertexBlendARB){this->m_orig_glVertexBlendARB = this->m_ptr_glVertexBlendARB;this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&TraceTableDecorator::m_glVertexBlendARB_trace;}
+if(this->m_ptr_glVertexAttrib4d){this->m_orig_glVertexAttrib4d = this->m_ptr_glVertexAttrib4d;this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&TraceTableDecorator::m_glVertexAttrib4d_trace;}
+if(this->m_ptr_glGetVaryingLocationNV){this->m_orig_glGetVaryingLocationNV = this->m_ptr_glGetVaryingLocationNV;this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&TraceTableDecorator::m_glGetVaryingLocationNV_trace;}
+if(this->m_ptr_glGetMapAttribParameterivNV){this->m_orig_glGetMapAttribParameterivNV = this->m_ptr_glGetMapAttribParameterivNV;this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&TraceTableDecorator::m_glGetMapAttribParameterivNV_trace;}
+if(this->m_ptr_glTexSubImage3D){this->m_orig_glTexSubImage3D = this->m_ptr_glTexSubImage3D;this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&TraceTableDecorator::m_glTexSubImage3D_trace;}
+if(this->m_ptr_glDeleteSamplers){this->m_orig_glDeleteSamplers = this->m_ptr_glDeleteSamplers;this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&TraceTableDecorator::m_glDeleteSamplers_trace;}
+if(this->m_ptr_glGetLightxOES){this->m_orig_glGetLightxOES = this->m_ptr_glGetLightxOES;this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&TraceTableDecorator::m_glGetLightxOES_trace;}
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI){this->m_orig_glGetVertexAttribArrayObjectfvATI = this->m_ptr_glGetVertexAttribArrayObjectfvATI;this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&TraceTableDecorator::m_glGetVertexAttribArrayObjectfvATI_trace;}
+if(this->m_ptr_glVertexArrayNormalOffsetEXT){this->m_orig_glVertexArrayNormalOffsetEXT = this->m_ptr_glVertexArrayNormalOffsetEXT;this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayNormalOffsetEXT_trace;}
+if(this->m_ptr_glGetBufferParameterivARB){this->m_orig_glGetBufferParameterivARB = this->m_ptr_glGetBufferParameterivARB;this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&TraceTableDecorator::m_glGetBufferParameterivARB_trace;}
+if(this->m_ptr_glGetTextureParameterfv){this->m_orig_glGetTextureParameterfv = this->m_ptr_glGetTextureParameterfv;this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&TraceTableDecorator::m_glGetTextureParameterfv_trace;}
+if(this->m_ptr_glDrawMeshArraysSUN){this->m_orig_glDrawMeshArraysSUN = this->m_ptr_glDrawMeshArraysSUN;this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&TraceTableDecorator::m_glDrawMeshArraysSUN_trace;}
+if(this->m_ptr_glVertexAttrib4dNV){this->m_orig_glVertexAttrib4dNV = this->m_ptr_glVertexAttrib4dNV;this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&TraceTableDecorator::m_glVertexAttrib4dNV_trace;}
+if(this->m_ptr_glGetMultisamplefvNV){this->m_orig_glGetMultisamplefvNV = this->m_ptr_glGetMultisamplefvNV;this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&TraceTableDecorator::m_glGetMultisamplefvNV_trace;}
+if(this->m_ptr_glMapObjectBufferATI){this->m_orig_glMapObjectBufferATI = this->m_ptr_glMapObjectBufferATI;this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&TraceTableDecorator::m_glMapObjectBufferATI_trace;}
+if(this->m_ptr_glGetPathCommandsNV){this->m_orig_glGetPathCommandsNV = this->m_ptr_glGetPathCommandsNV;this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&TraceTableDecorator::m_glGetPathCommandsNV_trace;}
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT){this->m_orig_glVertexArrayTexCoordOffsetEXT = this->m_ptr_glVertexArrayTexCoordOffsetEXT;this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayTexCoordOffsetEXT_trace;}
+if(this->m_ptr_glGetHistogram){this->m_orig_glGetHistogram = this->m_ptr_glGetHistogram;this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&TraceTableDecorator::m_glGetHistogram_trace;}
+if(this->m_ptr_glMatrixMode){this->m_orig_glMatrixMode = this->m_ptr_glMatrixMode;this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&TraceTableDecorator::m_glMatrixMode_trace;}
+if(this->m_ptr_glColorFormatNV){this->m_orig_glColorFormatNV = this->m_ptr_glColorFormatNV;this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&TraceTableDecorator::m_glColorFormatNV_trace;}
+if(this->m_ptr_glProgramUniformui64NV){this->m_orig_glProgramUniformui64NV = this->m_ptr_glProgramUniformui64NV;this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&TraceTableDecorator::m_glProgramUniformui64NV_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT){this->m_orig_glProgramUniformMatrix4x2fvEXT = this->m_ptr_glProgramUniformMatrix4x2fvEXT;this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x2fvEXT_trace;}
+if(this->m_ptr_glLoadMatrixxOES){this->m_orig_glLoadMatrixxOES = this->m_ptr_glLoadMatrixxOES;this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&TraceTableDecorator::m_glLoadMatrixxOES_trace;}
+if(this->m_ptr_glGetColorTableParameterfvEXT){this->m_orig_glGetColorTableParameterfvEXT = this->m_ptr_glGetColorTableParameterfvEXT;this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetColorTableParameterfvEXT_trace;}
+if(this->m_ptr_glRasterPos4i){this->m_orig_glRasterPos4i = this->m_ptr_glRasterPos4i;this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&TraceTableDecorator::m_glRasterPos4i_trace;}
+if(this->m_ptr_glVertexAttribL2i64NV){this->m_orig_glVertexAttribL2i64NV = this->m_ptr_glVertexAttribL2i64NV;this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&TraceTableDecorator::m_glVertexAttribL2i64NV_trace;}
+if(this->m_ptr_glBindTextures){this->m_orig_glBindTextures = this->m_ptr_glBindTextures;this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&TraceTableDecorator::m_glBindTextures_trace;}
+if(this->m_ptr_glMatrixRotatefEXT){this->m_orig_glMatrixRotatefEXT = this->m_ptr_glMatrixRotatefEXT;this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&TraceTableDecorator::m_glMatrixRotatefEXT_trace;}
+if(this->m_ptr_glGetClipPlanexOES){this->m_orig_glGetClipPlanexOES = this->m_ptr_glGetClipPlanexOES;this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&TraceTableDecorator::m_glGetClipPlanexOES_trace;}
+if(this->m_ptr_glSecondaryColor3uivEXT){this->m_orig_glSecondaryColor3uivEXT = this->m_ptr_glSecondaryColor3uivEXT;this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3uivEXT_trace;}
+if(this->m_ptr_glGetPerfQueryInfoINTEL){this->m_orig_glGetPerfQueryInfoINTEL = this->m_ptr_glGetPerfQueryInfoINTEL;this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&TraceTableDecorator::m_glGetPerfQueryInfoINTEL_trace;}
+if(this->m_ptr_glGetDoublev){this->m_orig_glGetDoublev = this->m_ptr_glGetDoublev;this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&TraceTableDecorator::m_glGetDoublev_trace;}
+if(this->m_ptr_glBindBufferRangeEXT){this->m_orig_glBindBufferRangeEXT = this->m_ptr_glBindBufferRangeEXT;this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&TraceTableDecorator::m_glBindBufferRangeEXT_trace;}
+if(this->m_ptr_glCompressedTexImage2D){this->m_orig_glCompressedTexImage2D = this->m_ptr_glCompressedTexImage2D;this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&TraceTableDecorator::m_glCompressedTexImage2D_trace;}
+if(this->m_ptr_glMapBufferARB){this->m_orig_glMapBufferARB = this->m_ptr_glMapBufferARB;this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&TraceTableDecorator::m_glMapBufferARB_trace;}
+if(this->m_ptr_glGetPathSpacingNV){this->m_orig_glGetPathSpacingNV = this->m_ptr_glGetPathSpacingNV;this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&TraceTableDecorator::m_glGetPathSpacingNV_trace;}
+if(this->m_ptr_glUniform4dv){this->m_orig_glUniform4dv = this->m_ptr_glUniform4dv;this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&TraceTableDecorator::m_glUniform4dv_trace;}
+if(this->m_ptr_glGlobalAlphaFactordSUN){this->m_orig_glGlobalAlphaFactordSUN = this->m_ptr_glGlobalAlphaFactordSUN;this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactordSUN_trace;}
+if(this->m_ptr_glProgramUniform3dv){this->m_orig_glProgramUniform3dv = this->m_ptr_glProgramUniform3dv;this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&TraceTableDecorator::m_glProgramUniform3dv_trace;}
+if(this->m_ptr_glGetShaderSourceARB){this->m_orig_glGetShaderSourceARB = this->m_ptr_glGetShaderSourceARB;this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&TraceTableDecorator::m_glGetShaderSourceARB_trace;}
+if(this->m_ptr_glVertexAttrib3dvARB){this->m_orig_glVertexAttrib3dvARB = this->m_ptr_glVertexAttrib3dvARB;this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&TraceTableDecorator::m_glVertexAttrib3dvARB_trace;}
+if(this->m_ptr_glInvalidateBufferData){this->m_orig_glInvalidateBufferData = this->m_ptr_glInvalidateBufferData;this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&TraceTableDecorator::m_glInvalidateBufferData_trace;}
+if(this->m_ptr_glMatrixLoad3x2fNV){this->m_orig_glMatrixLoad3x2fNV = this->m_ptr_glMatrixLoad3x2fNV;this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&TraceTableDecorator::m_glMatrixLoad3x2fNV_trace;}
+if(this->m_ptr_glCompressedTextureSubImage1D){this->m_orig_glCompressedTextureSubImage1D = this->m_ptr_glCompressedTextureSubImage1D;this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&TraceTableDecorator::m_glCompressedTextureSubImage1D_trace;}
+if(this->m_ptr_glTexCoord3xvOES){this->m_orig_glTexCoord3xvOES = this->m_ptr_glTexCoord3xvOES;this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&TraceTableDecorator::m_glTexCoord3xvOES_trace;}
+if(this->m_ptr_glGenTexturesEXT){this->m_orig_glGenTexturesEXT = this->m_ptr_glGenTexturesEXT;this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&TraceTableDecorator::m_glGenTexturesEXT_trace;}
+if(this->m_ptr_glTangent3iEXT){this->m_orig_glTangent3iEXT = this->m_ptr_glTangent3iEXT;this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&TraceTableDecorator::m_glTangent3iEXT_trace;}
+if(this->m_ptr_glClearTexImage){this->m_orig_glClearTexImage = this->m_ptr_glClearTexImage;this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&TraceTableDecorator::m_glClearTexImage_trace;}
+if(this->m_ptr_glBinormal3bvEXT){this->m_orig_glBinormal3bvEXT = this->m_ptr_glBinormal3bvEXT;this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&TraceTableDecorator::m_glBinormal3bvEXT_trace;}
+if(this->m_ptr_glUniform3fv){this->m_orig_glUniform3fv = this->m_ptr_glUniform3fv;this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&TraceTableDecorator::m_glUniform3fv_trace;}
+if(this->m_ptr_glGetnPixelMapusvARB){this->m_orig_glGetnPixelMapusvARB = this->m_ptr_glGetnPixelMapusvARB;this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&TraceTableDecorator::m_glGetnPixelMapusvARB_trace;}
+if(this->m_ptr_glMemoryObjectParameterivEXT){this->m_orig_glMemoryObjectParameterivEXT = this->m_ptr_glMemoryObjectParameterivEXT;this->m_ptr_glMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC)&TraceTableDecorator::m_glMemoryObjectParameterivEXT_trace;}
+if(this->m_ptr_glGenSemaphoresEXT){this->m_orig_glGenSemaphoresEXT = this->m_ptr_glGenSemaphoresEXT;this->m_ptr_glGenSemaphoresEXT = (FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC)&TraceTableDecorator::m_glGenSemaphoresEXT_trace;}
+if(this->m_ptr_glMultiTexCoordP1ui){this->m_orig_glMultiTexCoordP1ui = this->m_ptr_glMultiTexCoordP1ui;this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&TraceTableDecorator::m_glMultiTexCoordP1ui_trace;}
+if(this->m_ptr_glClearNamedBufferDataEXT){this->m_orig_glClearNamedBufferDataEXT = this->m_ptr_glClearNamedBufferDataEXT;this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&TraceTableDecorator::m_glClearNamedBufferDataEXT_trace;}
+if(this->m_ptr_glUniformMatrix4dv){this->m_orig_glUniformMatrix4dv = this->m_ptr_glUniformMatrix4dv;this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&TraceTableDecorator::m_glUniformMatrix4dv_trace;}
+if(this->m_ptr_glWindowPos3fMESA){this->m_orig_glWindowPos3fMESA = this->m_ptr_glWindowPos3fMESA;this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&TraceTableDecorator::m_glWindowPos3fMESA_trace;}
+if(this->m_ptr_glDeleteRenderbuffers){this->m_orig_glDeleteRenderbuffers = this->m_ptr_glDeleteRenderbuffers;this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&TraceTableDecorator::m_glDeleteRenderbuffers_trace;}
+if(this->m_ptr_glGetTextureLevelParameterfvEXT){this->m_orig_glGetTextureLevelParameterfvEXT = this->m_ptr_glGetTextureLevelParameterfvEXT;this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetTextureLevelParameterfvEXT_trace;}
+if(this->m_ptr_glGetHistogramParameterxvOES){this->m_orig_glGetHistogramParameterxvOES = this->m_ptr_glGetHistogramParameterxvOES;this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&TraceTableDecorator::m_glGetHistogramParameterxvOES_trace;}
+if(this->m_ptr_glMultiDrawElements){this->m_orig_glMultiDrawElements = this->m_ptr_glMultiDrawElements;this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&TraceTableDecorator::m_glMultiDrawElements_trace;}
+if(this->m_ptr_glMakeImageHandleNonResidentNV){this->m_orig_glMakeImageHandleNonResidentNV = this->m_ptr_glMakeImageHandleNonResidentNV;this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&TraceTableDecorator::m_glMakeImageHandleNonResidentNV_trace;}
+if(this->m_ptr_glTexSubImage1DEXT){this->m_orig_glTexSubImage1DEXT = this->m_ptr_glTexSubImage1DEXT;this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glTexSubImage1DEXT_trace;}
+if(this->m_ptr_glNormalStream3dATI){this->m_orig_glNormalStream3dATI = this->m_ptr_glNormalStream3dATI;this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&TraceTableDecorator::m_glNormalStream3dATI_trace;}
+if(this->m_ptr_glVertexAttribL4i64vNV){this->m_orig_glVertexAttribL4i64vNV = this->m_ptr_glVertexAttribL4i64vNV;this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&TraceTableDecorator::m_glVertexAttribL4i64vNV_trace;}
+if(this->m_ptr_glDrawBuffers){this->m_orig_glDrawBuffers = this->m_ptr_glDrawBuffers;this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&TraceTableDecorator::m_glDrawBuffers_trace;}
+if(this->m_ptr_glCopyTextureSubImage1DEXT){this->m_orig_glCopyTextureSubImage1DEXT = this->m_ptr_glCopyTextureSubImage1DEXT;this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glCopyTextureSubImage1DEXT_trace;}
+if(this->m_ptr_glWindowRectanglesEXT){this->m_orig_glWindowRectanglesEXT = this->m_ptr_glWindowRectanglesEXT;this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&TraceTableDecorator::m_glWindowRectanglesEXT_trace;}
+if(this->m_ptr_glNamedFramebufferReadBuffer){this->m_orig_glNamedFramebufferReadBuffer = this->m_ptr_glNamedFramebufferReadBuffer;this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&TraceTableDecorator::m_glNamedFramebufferReadBuffer_trace;}
+if(this->m_ptr_glUniform2i64vARB){this->m_orig_glUniform2i64vARB = this->m_ptr_glUniform2i64vARB;this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&TraceTableDecorator::m_glUniform2i64vARB_trace;}
+if(this->m_ptr_glVertexAttribI1uivEXT){this->m_orig_glVertexAttribI1uivEXT = this->m_ptr_glVertexAttribI1uivEXT;this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&TraceTableDecorator::m_glVertexAttribI1uivEXT_trace;}
+if(this->m_ptr_glGetTexGenfv){this->m_orig_glGetTexGenfv = this->m_ptr_glGetTexGenfv;this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&TraceTableDecorator::m_glGetTexGenfv_trace;}
+if(this->m_ptr_glBeginQueryARB){this->m_orig_glBeginQueryARB = this->m_ptr_glBeginQueryARB;this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&TraceTableDecorator::m_glBeginQueryARB_trace;}
+if(this->m_ptr_glUniform1iARB){this->m_orig_glUniform1iARB = this->m_ptr_glUniform1iARB;this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&TraceTableDecorator::m_glUniform1iARB_trace;}
+if(this->m_ptr_glVertex4bvOES){this->m_orig_glVertex4bvOES = this->m_ptr_glVertex4bvOES;this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&TraceTableDecorator::m_glVertex4bvOES_trace;}
+if(this->m_ptr_glInvalidateSubFramebuffer){this->m_orig_glInvalidateSubFramebuffer = this->m_ptr_glInvalidateSubFramebuffer;this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&TraceTableDecorator::m_glInvalidateSubFramebuffer_trace;}
+if(this->m_ptr_glUniform1fvARB){this->m_orig_glUniform1fvARB = this->m_ptr_glUniform1fvARB;this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&TraceTableDecorator::m_glUniform1fvARB_trace;}
+if(this->m_ptr_glTestFenceNV){this->m_orig_glTestFenceNV = this->m_ptr_glTestFenceNV;this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&TraceTableDecorator::m_glTestFenceNV_trace;}
+if(this->m_ptr_glBindTransformFeedback){this->m_orig_glBindTransformFeedback = this->m_ptr_glBindTransformFeedback;this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glBindTransformFeedback_trace;}
+if(this->m_ptr_glMultiTexCoord2iv){this->m_orig_glMultiTexCoord2iv = this->m_ptr_glMultiTexCoord2iv;this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&TraceTableDecorator::m_glMultiTexCoord2iv_trace;}
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT){this->m_orig_glCopyMultiTexSubImage1DEXT = this->m_ptr_glCopyMultiTexSubImage1DEXT;this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glCopyMultiTexSubImage1DEXT_trace;}
+if(this->m_ptr_glVariantbvEXT){this->m_orig_glVariantbvEXT = this->m_ptr_glVariantbvEXT;this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&TraceTableDecorator::m_glVariantbvEXT_trace;}
+if(this->m_ptr_glTexCoord1hNV){this->m_orig_glTexCoord1hNV = this->m_ptr_glTexCoord1hNV;this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&TraceTableDecorator::m_glTexCoord1hNV_trace;}
+if(this->m_ptr_glGenFencesNV){this->m_orig_glGenFencesNV = this->m_ptr_glGenFencesNV;this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&TraceTableDecorator::m_glGenFencesNV_trace;}
+if(this->m_ptr_glRasterPos3iv){this->m_orig_glRasterPos3iv = this->m_ptr_glRasterPos3iv;this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&TraceTableDecorator::m_glRasterPos3iv_trace;}
+if(this->m_ptr_glVertexAttribL2ui64NV){this->m_orig_glVertexAttribL2ui64NV = this->m_ptr_glVertexAttribL2ui64NV;this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&TraceTableDecorator::m_glVertexAttribL2ui64NV_trace;}
+if(this->m_ptr_glMultiTexCoord1hvNV){this->m_orig_glMultiTexCoord1hvNV = this->m_ptr_glMultiTexCoord1hvNV;this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&TraceTableDecorator::m_glMultiTexCoord1hvNV_trace;}
+if(this->m_ptr_glGetnConvolutionFilter){this->m_orig_glGetnConvolutionFilter = this->m_ptr_glGetnConvolutionFilter;this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&TraceTableDecorator::m_glGetnConvolutionFilter_trace;}
+if(this->m_ptr_glNormal3bv){this->m_orig_glNormal3bv = this->m_ptr_glNormal3bv;this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&TraceTableDecorator::m_glNormal3bv_trace;}
+if(this->m_ptr_glWeightbvARB){this->m_orig_glWeightbvARB = this->m_ptr_glWeightbvARB;this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&TraceTableDecorator::m_glWeightbvARB_trace;}
+if(this->m_ptr_glTexCoord4sv){this->m_orig_glTexCoord4sv = this->m_ptr_glTexCoord4sv;this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&TraceTableDecorator::m_glTexCoord4sv_trace;}
+if(this->m_ptr_glUniform2uiv){this->m_orig_glUniform2uiv = this->m_ptr_glUniform2uiv;this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&TraceTableDecorator::m_glUniform2uiv_trace;}
+if(this->m_ptr_glBeginConditionalRenderNVX){this->m_orig_glBeginConditionalRenderNVX = this->m_ptr_glBeginConditionalRenderNVX;this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&TraceTableDecorator::m_glBeginConditionalRenderNVX_trace;}
+if(this->m_ptr_glFinish){this->m_orig_glFinish = this->m_ptr_glFinish;this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&TraceTableDecorator::m_glFinish_trace;}
+if(this->m_ptr_glColorTableParameterfv){this->m_orig_glColorTableParameterfv = this->m_ptr_glColorTableParameterfv;this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&TraceTableDecorator::m_glColorTableParameterfv_trace;}
+if(this->m_ptr_glFragmentCoverageColorNV){this->m_orig_glFragmentCoverageColorNV = this->m_ptr_glFragmentCoverageColorNV;this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&TraceTableDecorator::m_glFragmentCoverageColorNV_trace;}
+if(this->m_ptr_glProgramUniform3ivEXT){this->m_orig_glProgramUniform3ivEXT = this->m_ptr_glProgramUniform3ivEXT;this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&TraceTableDecorator::m_glProgramUniform3ivEXT_trace;}
+if(this->m_ptr_glVertexArrayVertexOffsetEXT){this->m_orig_glVertexArrayVertexOffsetEXT = this->m_ptr_glVertexArrayVertexOffsetEXT;this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexOffsetEXT_trace;}
+if(this->m_ptr_glViewportPositionWScaleNV){this->m_orig_glViewportPositionWScaleNV = this->m_ptr_glViewportPositionWScaleNV;this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&TraceTableDecorator::m_glViewportPositionWScaleNV_trace;}
+if(this->m_ptr_glGetProgramLocalParameterIuivNV){this->m_orig_glGetProgramLocalParameterIuivNV = this->m_ptr_glGetProgramLocalParameterIuivNV;this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&TraceTableDecorator::m_glGetProgramLocalParameterIuivNV_trace;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN){this->m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_trace;}
+if(this->m_ptr_glUniform1uiv){this->m_orig_glUniform1uiv = this->m_ptr_glUniform1uiv;this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&TraceTableDecorator::m_glUniform1uiv_trace;}
+if(this->m_ptr_glUniformMatrix2dv){this->m_orig_glUniformMatrix2dv = this->m_ptr_glUniformMatrix2dv;this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&TraceTableDecorator::m_glUniformMatrix2dv_trace;}
+if(this->m_ptr_glIndexdv){this->m_orig_glIndexdv = this->m_ptr_glIndexdv;this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&TraceTableDecorator::m_glIndexdv_trace;}
+if(this->m_ptr_glSecondaryColor3ivEXT){this->m_orig_glSecondaryColor3ivEXT = this->m_ptr_glSecondaryColor3ivEXT;this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3ivEXT_trace;}
+if(this->m_ptr_glTexCoord3iv){this->m_orig_glTexCoord3iv = this->m_ptr_glTexCoord3iv;this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&TraceTableDecorator::m_glTexCoord3iv_trace;}
+if(this->m_ptr_glVertexStream4fvATI){this->m_orig_glVertexStream4fvATI = this->m_ptr_glVertexStream4fvATI;this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&TraceTableDecorator::m_glVertexStream4fvATI_trace;}
+if(this->m_ptr_glDeformationMap3fSGIX){this->m_orig_glDeformationMap3fSGIX = this->m_ptr_glDeformationMap3fSGIX;this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&TraceTableDecorator::m_glDeformationMap3fSGIX_trace;}
+if(this->m_ptr_glClearDepth){this->m_orig_glClearDepth = this->m_ptr_glClearDepth;this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&TraceTableDecorator::m_glClearDepth_trace;}
+if(this->m_ptr_glGenAsyncMarkersSGIX){this->m_orig_glGenAsyncMarkersSGIX = this->m_ptr_glGenAsyncMarkersSGIX;this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&TraceTableDecorator::m_glGenAsyncMarkersSGIX_trace;}
+if(this->m_ptr_glDisableIndexedEXT){this->m_orig_glDisableIndexedEXT = this->m_ptr_glDisableIndexedEXT;this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&TraceTableDecorator::m_glDisableIndexedEXT_trace;}
+if(this->m_ptr_glVertexWeightfvEXT){this->m_orig_glVertexWeightfvEXT = this->m_ptr_glVertexWeightfvEXT;this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&TraceTableDecorator::m_glVertexWeightfvEXT_trace;}
+if(this->m_ptr_glGetProgramLocalParameterIivNV){this->m_orig_glGetProgramLocalParameterIivNV = this->m_ptr_glGetProgramLocalParameterIivNV;this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&TraceTableDecorator::m_glGetProgramLocalParameterIivNV_trace;}
+if(this->m_ptr_glCompressedTexImage3DARB){this->m_orig_glCompressedTexImage3DARB = this->m_ptr_glCompressedTexImage3DARB;this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&TraceTableDecorator::m_glCompressedTexImage3DARB_trace;}
+if(this->m_ptr_glProgramParameter4fNV){this->m_orig_glProgramParameter4fNV = this->m_ptr_glProgramParameter4fNV;this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&TraceTableDecorator::m_glProgramParameter4fNV_trace;}
+if(this->m_ptr_glConvolutionParameterxOES){this->m_orig_glConvolutionParameterxOES = this->m_ptr_glConvolutionParameterxOES;this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&TraceTableDecorator::m_glConvolutionParameterxOES_trace;}
+if(this->m_ptr_glInsertComponentEXT){this->m_orig_glInsertComponentEXT = this->m_ptr_glInsertComponentEXT;this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&TraceTableDecorator::m_glInsertComponentEXT_trace;}
+if(this->m_ptr_glCreateTextures){this->m_orig_glCreateTextures = this->m_ptr_glCreateTextures;this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&TraceTableDecorator::m_glCreateTextures_trace;}
+if(this->m_ptr_glSecondaryColor3iv){this->m_orig_glSecondaryColor3iv = this->m_ptr_glSecondaryColor3iv;this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&TraceTableDecorator::m_glSecondaryColor3iv_trace;}
+if(this->m_ptr_glCreateBuffers){this->m_orig_glCreateBuffers = this->m_ptr_glCreateBuffers;this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&TraceTableDecorator::m_glCreateBuffers_trace;}
+if(this->m_ptr_glMultiTexCoord2xvOES){this->m_orig_glMultiTexCoord2xvOES = this->m_ptr_glMultiTexCoord2xvOES;this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&TraceTableDecorator::m_glMultiTexCoord2xvOES_trace;}
+if(this->m_ptr_glTexGenxvOES){this->m_orig_glTexGenxvOES = this->m_ptr_glTexGenxvOES;this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&TraceTableDecorator::m_glTexGenxvOES_trace;}
+if(this->m_ptr_glMultTransposeMatrixf){this->m_orig_glMultTransposeMatrixf = this->m_ptr_glMultTransposeMatrixf;this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&TraceTableDecorator::m_glMultTransposeMatrixf_trace;}
+if(this->m_ptr_glBeginTransformFeedbackEXT){this->m_orig_glBeginTransformFeedbackEXT = this->m_ptr_glBeginTransformFeedbackEXT;this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&TraceTableDecorator::m_glBeginTransformFeedbackEXT_trace;}
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN){this->m_orig_glTexCoord2fColor3fVertex3fSUN = this->m_ptr_glTexCoord2fColor3fVertex3fSUN;this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_trace;}
+if(this->m_ptr_glNormal3sv){this->m_orig_glNormal3sv = this->m_ptr_glNormal3sv;this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&TraceTableDecorator::m_glNormal3sv_trace;}
+if(this->m_ptr_glFreeObjectBufferATI){this->m_orig_glFreeObjectBufferATI = this->m_ptr_glFreeObjectBufferATI;this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&TraceTableDecorator::m_glFreeObjectBufferATI_trace;}
+if(this->m_ptr_glBlendBarrierNV){this->m_orig_glBlendBarrierNV = this->m_ptr_glBlendBarrierNV;this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&TraceTableDecorator::m_glBlendBarrierNV_trace;}
+if(this->m_ptr_glUniform4i64vNV){this->m_orig_glUniform4i64vNV = this->m_ptr_glUniform4i64vNV;this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&TraceTableDecorator::m_glUniform4i64vNV_trace;}
+if(this->m_ptr_glGetnUniformuivARB){this->m_orig_glGetnUniformuivARB = this->m_ptr_glGetnUniformuivARB;this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&TraceTableDecorator::m_glGetnUniformuivARB_trace;}
+if(this->m_ptr_glAlphaFragmentOp3ATI){this->m_orig_glAlphaFragmentOp3ATI = this->m_ptr_glAlphaFragmentOp3ATI;this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&TraceTableDecorator::m_glAlphaFragmentOp3ATI_trace;}
+if(this->m_ptr_glProgramEnvParameters4fvEXT){this->m_orig_glProgramEnvParameters4fvEXT = this->m_ptr_glProgramEnvParameters4fvEXT;this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&TraceTableDecorator::m_glProgramEnvParameters4fvEXT_trace;}
+if(this->m_ptr_glBlendFuncSeparateEXT){this->m_orig_glBlendFuncSeparateEXT = this->m_ptr_glBlendFuncSeparateEXT;this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&TraceTableDecorator::m_glBlendFuncSeparateEXT_trace;}
+if(this->m_ptr_glConvolutionParameterivEXT){this->m_orig_glConvolutionParameterivEXT = this->m_ptr_glConvolutionParameterivEXT;this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&TraceTableDecorator::m_glConvolutionParameterivEXT_trace;}
+if(this->m_ptr_glPixelTexGenSGIX){this->m_orig_glPixelTexGenSGIX = this->m_ptr_glPixelTexGenSGIX;this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&TraceTableDecorator::m_glPixelTexGenSGIX_trace;}
+if(this->m_ptr_glDeleteProgram){this->m_orig_glDeleteProgram = this->m_ptr_glDeleteProgram;this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&TraceTableDecorator::m_glDeleteProgram_trace;}
+if(this->m_ptr_glUniformMatrix4x3dv){this->m_orig_glUniformMatrix4x3dv = this->m_ptr_glUniformMatrix4x3dv;this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&TraceTableDecorator::m_glUniformMatrix4x3dv_trace;}
+if(this->m_ptr_glGetVideoCaptureStreamivNV){this->m_orig_glGetVideoCaptureStreamivNV = this->m_ptr_glGetVideoCaptureStreamivNV;this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&TraceTableDecorator::m_glGetVideoCaptureStreamivNV_trace;}
+if(this->m_ptr_glProgramUniform4uiEXT){this->m_orig_glProgramUniform4uiEXT = this->m_ptr_glProgramUniform4uiEXT;this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&TraceTableDecorator::m_glProgramUniform4uiEXT_trace;}
+if(this->m_ptr_glMakeImageHandleNonResidentARB){this->m_orig_glMakeImageHandleNonResidentARB = this->m_ptr_glMakeImageHandleNonResidentARB;this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&TraceTableDecorator::m_glMakeImageHandleNonResidentARB_trace;}
+if(this->m_ptr_glSecondaryColor3dEXT){this->m_orig_glSecondaryColor3dEXT = this->m_ptr_glSecondaryColor3dEXT;this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&TraceTableDecorator::m_glSecondaryColor3dEXT_trace;}
+if(this->m_ptr_glDeleteQueries){this->m_orig_glDeleteQueries = this->m_ptr_glDeleteQueries;this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&TraceTableDecorator::m_glDeleteQueries_trace;}
+if(this->m_ptr_glNormalP3uiv){this->m_orig_glNormalP3uiv = this->m_ptr_glNormalP3uiv;this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&TraceTableDecorator::m_glNormalP3uiv_trace;}
+if(this->m_ptr_glRasterPos2d){this->m_orig_glRasterPos2d = this->m_ptr_glRasterPos2d;this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&TraceTableDecorator::m_glRasterPos2d_trace;}
+if(this->m_ptr_glInitNames){this->m_orig_glInitNames = this->m_ptr_glInitNames;this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&TraceTableDecorator::m_glInitNames_trace;}
+if(this->m_ptr_glBinormal3fvEXT){this->m_orig_glBinormal3fvEXT = this->m_ptr_glBinormal3fvEXT;this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&TraceTableDecorator::m_glBinormal3fvEXT_trace;}
+if(this->m_ptr_glColor3dv){this->m_orig_glColor3dv = this->m_ptr_glColor3dv;this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&TraceTableDecorator::m_glColor3dv_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT){this->m_orig_glVertexArrayVertexAttribDivisorEXT = this->m_ptr_glVertexArrayVertexAttribDivisorEXT;this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_trace;}
+if(this->m_ptr_glArrayElementEXT){this->m_orig_glArrayElementEXT = this->m_ptr_glArrayElementEXT;this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&TraceTableDecorator::m_glArrayElementEXT_trace;}
+if(this->m_ptr_glProgramParameter4dNV){this->m_orig_glProgramParameter4dNV = this->m_ptr_glProgramParameter4dNV;this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&TraceTableDecorator::m_glProgramParameter4dNV_trace;}
+if(this->m_ptr_glIndexxOES){this->m_orig_glIndexxOES = this->m_ptr_glIndexxOES;this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&TraceTableDecorator::m_glIndexxOES_trace;}
+if(this->m_ptr_glUniform3uivEXT){this->m_orig_glUniform3uivEXT = this->m_ptr_glUniform3uivEXT;this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&TraceTableDecorator::m_glUniform3uivEXT_trace;}
+if(this->m_ptr_glPopGroupMarkerEXT){this->m_orig_glPopGroupMarkerEXT = this->m_ptr_glPopGroupMarkerEXT;this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&TraceTableDecorator::m_glPopGroupMarkerEXT_trace;}
+if(this->m_ptr_glClearNamedFramebufferuiv){this->m_orig_glClearNamedFramebufferuiv = this->m_ptr_glClearNamedFramebufferuiv;this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&TraceTableDecorator::m_glClearNamedFramebufferuiv_trace;}
+if(this->m_ptr_glSetLocalConstantEXT){this->m_orig_glSetLocalConstantEXT = this->m_ptr_glSetLocalConstantEXT;this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&TraceTableDecorator::m_glSetLocalConstantEXT_trace;}
+if(this->m_ptr_glProgramUniform1ui64NV){this->m_orig_glProgramUniform1ui64NV = this->m_ptr_glProgramUniform1ui64NV;this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&TraceTableDecorator::m_glProgramUniform1ui64NV_trace;}
+if(this->m_ptr_glColor4hvNV){this->m_orig_glColor4hvNV = this->m_ptr_glColor4hvNV;this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&TraceTableDecorator::m_glColor4hvNV_trace;}
+if(this->m_ptr_glGetVertexAttribfv){this->m_orig_glGetVertexAttribfv = this->m_ptr_glGetVertexAttribfv;this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&TraceTableDecorator::m_glGetVertexAttribfv_trace;}
+if(this->m_ptr_glDispatchCompute){this->m_orig_glDispatchCompute = this->m_ptr_glDispatchCompute;this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&TraceTableDecorator::m_glDispatchCompute_trace;}
+if(this->m_ptr_glGetActiveAttrib){this->m_orig_glGetActiveAttrib = this->m_ptr_glGetActiveAttrib;this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&TraceTableDecorator::m_glGetActiveAttrib_trace;}
+if(this->m_ptr_glFragmentColorMaterialSGIX){this->m_orig_glFragmentColorMaterialSGIX = this->m_ptr_glFragmentColorMaterialSGIX;this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&TraceTableDecorator::m_glFragmentColorMaterialSGIX_trace;}
+if(this->m_ptr_glTexSubImage2D){this->m_orig_glTexSubImage2D = this->m_ptr_glTexSubImage2D;this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&TraceTableDecorator::m_glTexSubImage2D_trace;}
+if(this->m_ptr_glGetnMinmaxARB){this->m_orig_glGetnMinmaxARB = this->m_ptr_glGetnMinmaxARB;this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&TraceTableDecorator::m_glGetnMinmaxARB_trace;}
+if(this->m_ptr_glLogicOp){this->m_orig_glLogicOp = this->m_ptr_glLogicOp;this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&TraceTableDecorator::m_glLogicOp_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x4fv){this->m_orig_glProgramUniformMatrix3x4fv = this->m_ptr_glProgramUniformMatrix3x4fv;this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x4fv_trace;}
+if(this->m_ptr_glWindowPos4iMESA){this->m_orig_glWindowPos4iMESA = this->m_ptr_glWindowPos4iMESA;this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&TraceTableDecorator::m_glWindowPos4iMESA_trace;}
+if(this->m_ptr_glPixelTransferf){this->m_orig_glPixelTransferf = this->m_ptr_glPixelTransferf;this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&TraceTableDecorator::m_glPixelTransferf_trace;}
+if(this->m_ptr_glGetTextureParameterIuiv){this->m_orig_glGetTextureParameterIuiv = this->m_ptr_glGetTextureParameterIuiv;this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&TraceTableDecorator::m_glGetTextureParameterIuiv_trace;}
+if(this->m_ptr_glMultiTexCoord1xOES){this->m_orig_glMultiTexCoord1xOES = this->m_ptr_glMultiTexCoord1xOES;this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&TraceTableDecorator::m_glMultiTexCoord1xOES_trace;}
+if(this->m_ptr_glProgramUniformMatrix4dv){this->m_orig_glProgramUniformMatrix4dv = this->m_ptr_glProgramUniformMatrix4dv;this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix4dv_trace;}
+if(this->m_ptr_glGetnUniformiv){this->m_orig_glGetnUniformiv = this->m_ptr_glGetnUniformiv;this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&TraceTableDecorator::m_glGetnUniformiv_trace;}
+if(this->m_ptr_glFramebufferTexture1DEXT){this->m_orig_glFramebufferTexture1DEXT = this->m_ptr_glFramebufferTexture1DEXT;this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&TraceTableDecorator::m_glFramebufferTexture1DEXT_trace;}
+if(this->m_ptr_glVertexPointervINTEL){this->m_orig_glVertexPointervINTEL = this->m_ptr_glVertexPointervINTEL;this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&TraceTableDecorator::m_glVertexPointervINTEL_trace;}
+if(this->m_ptr_glTextureParameterIiv){this->m_orig_glTextureParameterIiv = this->m_ptr_glTextureParameterIiv;this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&TraceTableDecorator::m_glTextureParameterIiv_trace;}
+if(this->m_ptr_glGetSeparableFilterEXT){this->m_orig_glGetSeparableFilterEXT = this->m_ptr_glGetSeparableFilterEXT;this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&TraceTableDecorator::m_glGetSeparableFilterEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3iARB){this->m_orig_glMultiTexCoord3iARB = this->m_ptr_glMultiTexCoord3iARB;this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&TraceTableDecorator::m_glMultiTexCoord3iARB_trace;}
+if(this->m_ptr_glRasterPos4xvOES){this->m_orig_glRasterPos4xvOES = this->m_ptr_glRasterPos4xvOES;this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&TraceTableDecorator::m_glRasterPos4xvOES_trace;}
+if(this->m_ptr_glDrawTransformFeedbackStream){this->m_orig_glDrawTransformFeedbackStream = this->m_ptr_glDrawTransformFeedbackStream;this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&TraceTableDecorator::m_glDrawTransformFeedbackStream_trace;}
+if(this->m_ptr_glVertex3hvNV){this->m_orig_glVertex3hvNV = this->m_ptr_glVertex3hvNV;this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&TraceTableDecorator::m_glVertex3hvNV_trace;}
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT){this->m_orig_glVertexArrayMultiTexCoordOffsetEXT = this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT;this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_trace;}
+if(this->m_ptr_glProvokingVertex){this->m_orig_glProvokingVertex = this->m_ptr_glProvokingVertex;this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&TraceTableDecorator::m_glProvokingVertex_trace;}
+if(this->m_ptr_glAccumxOES){this->m_orig_glAccumxOES = this->m_ptr_glAccumxOES;this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&TraceTableDecorator::m_glAccumxOES_trace;}
+if(this->m_ptr_glShaderBinary){this->m_orig_glShaderBinary = this->m_ptr_glShaderBinary;this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&TraceTableDecorator::m_glShaderBinary_trace;}
+if(this->m_ptr_glGetMultiTexGenivEXT){this->m_orig_glGetMultiTexGenivEXT = this->m_ptr_glGetMultiTexGenivEXT;this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&TraceTableDecorator::m_glGetMultiTexGenivEXT_trace;}
+if(this->m_ptr_glPointParameterxvOES){this->m_orig_glPointParameterxvOES = this->m_ptr_glPointParameterxvOES;this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&TraceTableDecorator::m_glPointParameterxvOES_trace;}
+if(this->m_ptr_glCreateStatesNV){this->m_orig_glCreateStatesNV = this->m_ptr_glCreateStatesNV;this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&TraceTableDecorator::m_glCreateStatesNV_trace;}
+if(this->m_ptr_glClearDepthdNV){this->m_orig_glClearDepthdNV = this->m_ptr_glClearDepthdNV;this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&TraceTableDecorator::m_glClearDepthdNV_trace;}
+if(this->m_ptr_glClearColorIuiEXT){this->m_orig_glClearColorIuiEXT = this->m_ptr_glClearColorIuiEXT;this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&TraceTableDecorator::m_glClearColorIuiEXT_trace;}
+if(this->m_ptr_glBindMultiTextureEXT){this->m_orig_glBindMultiTextureEXT = this->m_ptr_glBindMultiTextureEXT;this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&TraceTableDecorator::m_glBindMultiTextureEXT_trace;}
+if(this->m_ptr_glTexGeniv){this->m_orig_glTexGeniv = this->m_ptr_glTexGeniv;this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&TraceTableDecorator::m_glTexGeniv_trace;}
+if(this->m_ptr_glDrawElements){this->m_orig_glDrawElements = this->m_ptr_glDrawElements;this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&TraceTableDecorator::m_glDrawElements_trace;}
+if(this->m_ptr_glProgramUniform4iv){this->m_orig_glProgramUniform4iv = this->m_ptr_glProgramUniform4iv;this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&TraceTableDecorator::m_glProgramUniform4iv_trace;}
+if(this->m_ptr_glDisableVertexArrayEXT){this->m_orig_glDisableVertexArrayEXT = this->m_ptr_glDisableVertexArrayEXT;this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&TraceTableDecorator::m_glDisableVertexArrayEXT_trace;}
+if(this->m_ptr_glProgramUniform3ui64NV){this->m_orig_glProgramUniform3ui64NV = this->m_ptr_glProgramUniform3ui64NV;this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&TraceTableDecorator::m_glProgramUniform3ui64NV_trace;}
+if(this->m_ptr_glClientActiveTexture){this->m_orig_glClientActiveTexture = this->m_ptr_glClientActiveTexture;this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&TraceTableDecorator::m_glClientActiveTexture_trace;}
+if(this->m_ptr_glMultiTexParameterIivEXT){this->m_orig_glMultiTexParameterIivEXT = this->m_ptr_glMultiTexParameterIivEXT;this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glMultiTexParameterIivEXT_trace;}
+if(this->m_ptr_glUniform1i64ARB){this->m_orig_glUniform1i64ARB = this->m_ptr_glUniform1i64ARB;this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&TraceTableDecorator::m_glUniform1i64ARB_trace;}
+if(this->m_ptr_glUniform1iv){this->m_orig_glUniform1iv = this->m_ptr_glUniform1iv;this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&TraceTableDecorator::m_glUniform1iv_trace;}
+if(this->m_ptr_glMulticastBarrierNV){this->m_orig_glMulticastBarrierNV = this->m_ptr_glMulticastBarrierNV;this->m_ptr_glMulticastBarrierNV = (FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC)&TraceTableDecorator::m_glMulticastBarrierNV_trace;}
+if(this->m_ptr_glVertexAttribArrayObjectATI){this->m_orig_glVertexAttribArrayObjectATI = this->m_ptr_glVertexAttribArrayObjectATI;this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&TraceTableDecorator::m_glVertexAttribArrayObjectATI_trace;}
+if(this->m_ptr_glUniform2iARB){this->m_orig_glUniform2iARB = this->m_ptr_glUniform2iARB;this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&TraceTableDecorator::m_glUniform2iARB_trace;}
+if(this->m_ptr_glDrawArraysInstanced){this->m_orig_glDrawArraysInstanced = this->m_ptr_glDrawArraysInstanced;this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&TraceTableDecorator::m_glDrawArraysInstanced_trace;}
+if(this->m_ptr_glVertexAttrib2sNV){this->m_orig_glVertexAttrib2sNV = this->m_ptr_glVertexAttrib2sNV;this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&TraceTableDecorator::m_glVertexAttrib2sNV_trace;}
+if(this->m_ptr_glTexBufferEXT){this->m_orig_glTexBufferEXT = this->m_ptr_glTexBufferEXT;this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&TraceTableDecorator::m_glTexBufferEXT_trace;}
+if(this->m_ptr_glVertexStream2fATI){this->m_orig_glVertexStream2fATI = this->m_ptr_glVertexStream2fATI;this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&TraceTableDecorator::m_glVertexStream2fATI_trace;}
+if(this->m_ptr_glDebugMessageCallbackAMD){this->m_orig_glDebugMessageCallbackAMD = this->m_ptr_glDebugMessageCallbackAMD;this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&TraceTableDecorator::m_glDebugMessageCallbackAMD_trace;}
+if(this->m_ptr_glSamplerParameteriv){this->m_orig_glSamplerParameteriv = this->m_ptr_glSamplerParameteriv;this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&TraceTableDecorator::m_glSamplerParameteriv_trace;}
+if(this->m_ptr_glVertexAttrib4uiv){this->m_orig_glVertexAttrib4uiv = this->m_ptr_glVertexAttrib4uiv;this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&TraceTableDecorator::m_glVertexAttrib4uiv_trace;}
+if(this->m_ptr_glEndQueryIndexed){this->m_orig_glEndQueryIndexed = this->m_ptr_glEndQueryIndexed;this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&TraceTableDecorator::m_glEndQueryIndexed_trace;}
+if(this->m_ptr_glNormalStream3sATI){this->m_orig_glNormalStream3sATI = this->m_ptr_glNormalStream3sATI;this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&TraceTableDecorator::m_glNormalStream3sATI_trace;}
+if(this->m_ptr_glProgramParameteriARB){this->m_orig_glProgramParameteriARB = this->m_ptr_glProgramParameteriARB;this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&TraceTableDecorator::m_glProgramParameteriARB_trace;}
+if(this->m_ptr_glTexEnvxOES){this->m_orig_glTexEnvxOES = this->m_ptr_glTexEnvxOES;this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&TraceTableDecorator::m_glTexEnvxOES_trace;}
+if(this->m_ptr_glProgramUniform1iv){this->m_orig_glProgramUniform1iv = this->m_ptr_glProgramUniform1iv;this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&TraceTableDecorator::m_glProgramUniform1iv_trace;}
+if(this->m_ptr_glDisableVertexAttribAPPLE){this->m_orig_glDisableVertexAttribAPPLE = this->m_ptr_glDisableVertexAttribAPPLE;this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&TraceTableDecorator::m_glDisableVertexAttribAPPLE_trace;}
+if(this->m_ptr_glBindRenderbuffer){this->m_orig_glBindRenderbuffer = this->m_ptr_glBindRenderbuffer;this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&TraceTableDecorator::m_glBindRenderbuffer_trace;}
+if(this->m_ptr_glMultiTexSubImage3DEXT){this->m_orig_glMultiTexSubImage3DEXT = this->m_ptr_glMultiTexSubImage3DEXT;this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&TraceTableDecorator::m_glMultiTexSubImage3DEXT_trace;}
+if(this->m_ptr_glIsProgram){this->m_orig_glIsProgram = this->m_ptr_glIsProgram;this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&TraceTableDecorator::m_glIsProgram_trace;}
+if(this->m_ptr_glMultiDrawElementsIndirectAMD){this->m_orig_glMultiDrawElementsIndirectAMD = this->m_ptr_glMultiDrawElementsIndirectAMD;this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&TraceTableDecorator::m_glMultiDrawElementsIndirectAMD_trace;}
+if(this->m_ptr_glGetProgramInfoLog){this->m_orig_glGetProgramInfoLog = this->m_ptr_glGetProgramInfoLog;this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&TraceTableDecorator::m_glGetProgramInfoLog_trace;}
+if(this->m_ptr_glGetLocalConstantBooleanvEXT){this->m_orig_glGetLocalConstantBooleanvEXT = this->m_ptr_glGetLocalConstantBooleanvEXT;this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&TraceTableDecorator::m_glGetLocalConstantBooleanvEXT_trace;}
+if(this->m_ptr_glPixelTransformParameteriEXT){this->m_orig_glPixelTransformParameteriEXT = this->m_ptr_glPixelTransformParameteriEXT;this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&TraceTableDecorator::m_glPixelTransformParameteriEXT_trace;}
+if(this->m_ptr_glTexCoord4bOES){this->m_orig_glTexCoord4bOES = this->m_ptr_glTexCoord4bOES;this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&TraceTableDecorator::m_glTexCoord4bOES_trace;}
+if(this->m_ptr_glVertexAttrib4fv){this->m_orig_glVertexAttrib4fv = this->m_ptr_glVertexAttrib4fv;this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&TraceTableDecorator::m_glVertexAttrib4fv_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x3dv){this->m_orig_glProgramUniformMatrix2x3dv = this->m_ptr_glProgramUniformMatrix2x3dv;this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x3dv_trace;}
+if(this->m_ptr_glProgramEnvParametersI4uivNV){this->m_orig_glProgramEnvParametersI4uivNV = this->m_ptr_glProgramEnvParametersI4uivNV;this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&TraceTableDecorator::m_glProgramEnvParametersI4uivNV_trace;}
+if(this->m_ptr_glTexCoord3xOES){this->m_orig_glTexCoord3xOES = this->m_ptr_glTexCoord3xOES;this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&TraceTableDecorator::m_glTexCoord3xOES_trace;}
+if(this->m_ptr_glLoadTransposeMatrixfARB){this->m_orig_glLoadTransposeMatrixfARB = this->m_ptr_glLoadTransposeMatrixfARB;this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&TraceTableDecorator::m_glLoadTransposeMatrixfARB_trace;}
+if(this->m_ptr_glImageTransformParameteriHP){this->m_orig_glImageTransformParameteriHP = this->m_ptr_glImageTransformParameteriHP;this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&TraceTableDecorator::m_glImageTransformParameteriHP_trace;}
+if(this->m_ptr_glMultiTexCoord4xOES){this->m_orig_glMultiTexCoord4xOES = this->m_ptr_glMultiTexCoord4xOES;this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&TraceTableDecorator::m_glMultiTexCoord4xOES_trace;}
+if(this->m_ptr_glVertexAttribs3fvNV){this->m_orig_glVertexAttribs3fvNV = this->m_ptr_glVertexAttribs3fvNV;this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&TraceTableDecorator::m_glVertexAttribs3fvNV_trace;}
+if(this->m_ptr_glVertexAttrib2fv){this->m_orig_glVertexAttrib2fv = this->m_ptr_glVertexAttrib2fv;this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&TraceTableDecorator::m_glVertexAttrib2fv_trace;}
+if(this->m_ptr_glUniform3ui64NV){this->m_orig_glUniform3ui64NV = this->m_ptr_glUniform3ui64NV;this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&TraceTableDecorator::m_glUniform3ui64NV_trace;}
+if(this->m_ptr_glCombinerParameterfvNV){this->m_orig_glCombinerParameterfvNV = this->m_ptr_glCombinerParameterfvNV;this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&TraceTableDecorator::m_glCombinerParameterfvNV_trace;}
+if(this->m_ptr_glFragmentMaterialiSGIX){this->m_orig_glFragmentMaterialiSGIX = this->m_ptr_glFragmentMaterialiSGIX;this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&TraceTableDecorator::m_glFragmentMaterialiSGIX_trace;}
+if(this->m_ptr_glGetBooleani_v){this->m_orig_glGetBooleani_v = this->m_ptr_glGetBooleani_v;this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&TraceTableDecorator::m_glGetBooleani_v_trace;}
+if(this->m_ptr_glGetProgramResourceIndex){this->m_orig_glGetProgramResourceIndex = this->m_ptr_glGetProgramResourceIndex;this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&TraceTableDecorator::m_glGetProgramResourceIndex_trace;}
+if(this->m_ptr_glBeginConditionalRenderNV){this->m_orig_glBeginConditionalRenderNV = this->m_ptr_glBeginConditionalRenderNV;this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&TraceTableDecorator::m_glBeginConditionalRenderNV_trace;}
+if(this->m_ptr_glDisableClientState){this->m_orig_glDisableClientState = this->m_ptr_glDisableClientState;this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&TraceTableDecorator::m_glDisableClientState_trace;}
+if(this->m_ptr_glPathFogGenNV){this->m_orig_glPathFogGenNV = this->m_ptr_glPathFogGenNV;this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&TraceTableDecorator::m_glPathFogGenNV_trace;}
+if(this->m_ptr_glStencilThenCoverFillPathNV){this->m_orig_glStencilThenCoverFillPathNV = this->m_ptr_glStencilThenCoverFillPathNV;this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&TraceTableDecorator::m_glStencilThenCoverFillPathNV_trace;}
+if(this->m_ptr_glVertexArrayIndexOffsetEXT){this->m_orig_glVertexArrayIndexOffsetEXT = this->m_ptr_glVertexArrayIndexOffsetEXT;this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayIndexOffsetEXT_trace;}
+if(this->m_ptr_glProgramBufferParametersIuivNV){this->m_orig_glProgramBufferParametersIuivNV = this->m_ptr_glProgramBufferParametersIuivNV;this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&TraceTableDecorator::m_glProgramBufferParametersIuivNV_trace;}
+if(this->m_ptr_glPixelTransformParameterivEXT){this->m_orig_glPixelTransformParameterivEXT = this->m_ptr_glPixelTransformParameterivEXT;this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&TraceTableDecorator::m_glPixelTransformParameterivEXT_trace;}
+if(this->m_ptr_glDisableClientStateiEXT){this->m_orig_glDisableClientStateiEXT = this->m_ptr_glDisableClientStateiEXT;this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&TraceTableDecorator::m_glDisableClientStateiEXT_trace;}
+if(this->m_ptr_glTexBufferARB){this->m_orig_glTexBufferARB = this->m_ptr_glTexBufferARB;this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&TraceTableDecorator::m_glTexBufferARB_trace;}
+if(this->m_ptr_glGetLocalConstantIntegervEXT){this->m_orig_glGetLocalConstantIntegervEXT = this->m_ptr_glGetLocalConstantIntegervEXT;this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&TraceTableDecorator::m_glGetLocalConstantIntegervEXT_trace;}
+if(this->m_ptr_glColor4uiv){this->m_orig_glColor4uiv = this->m_ptr_glColor4uiv;this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&TraceTableDecorator::m_glColor4uiv_trace;}
+if(this->m_ptr_glProgramUniform3i){this->m_orig_glProgramUniform3i = this->m_ptr_glProgramUniform3i;this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&TraceTableDecorator::m_glProgramUniform3i_trace;}
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV){this->m_orig_glMultiDrawElementsIndirectBindlessCountNV = this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV;this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&TraceTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_trace;}
+if(this->m_ptr_glGetBufferPointervARB){this->m_orig_glGetBufferPointervARB = this->m_ptr_glGetBufferPointervARB;this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&TraceTableDecorator::m_glGetBufferPointervARB_trace;}
+if(this->m_ptr_glMultiTexParameterIuivEXT){this->m_orig_glMultiTexParameterIuivEXT = this->m_ptr_glMultiTexParameterIuivEXT;this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glMultiTexParameterIuivEXT_trace;}
+if(this->m_ptr_glEvalMesh2){this->m_orig_glEvalMesh2 = this->m_ptr_glEvalMesh2;this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&TraceTableDecorator::m_glEvalMesh2_trace;}
+if(this->m_ptr_glEvalMesh1){this->m_orig_glEvalMesh1 = this->m_ptr_glEvalMesh1;this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&TraceTableDecorator::m_glEvalMesh1_trace;}
+if(this->m_ptr_glProgramUniform3f){this->m_orig_glProgramUniform3f = this->m_ptr_glProgramUniform3f;this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&TraceTableDecorator::m_glProgramUniform3f_trace;}
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV){this->m_orig_glStencilThenCoverFillPathInstancedNV = this->m_ptr_glStencilThenCoverFillPathInstancedNV;this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&TraceTableDecorator::m_glStencilThenCoverFillPathInstancedNV_trace;}
+if(this->m_ptr_glProgramUniform3d){this->m_orig_glProgramUniform3d = this->m_ptr_glProgramUniform3d;this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&TraceTableDecorator::m_glProgramUniform3d_trace;}
+if(this->m_ptr_glMapVertexAttrib1dAPPLE){this->m_orig_glMapVertexAttrib1dAPPLE = this->m_ptr_glMapVertexAttrib1dAPPLE;this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&TraceTableDecorator::m_glMapVertexAttrib1dAPPLE_trace;}
+if(this->m_ptr_glEvalCoord2fv){this->m_orig_glEvalCoord2fv = this->m_ptr_glEvalCoord2fv;this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&TraceTableDecorator::m_glEvalCoord2fv_trace;}
+if(this->m_ptr_glGetUniformivARB){this->m_orig_glGetUniformivARB = this->m_ptr_glGetUniformivARB;this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&TraceTableDecorator::m_glGetUniformivARB_trace;}
+if(this->m_ptr_glLoadTransposeMatrixd){this->m_orig_glLoadTransposeMatrixd = this->m_ptr_glLoadTransposeMatrixd;this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&TraceTableDecorator::m_glLoadTransposeMatrixd_trace;}
+if(this->m_ptr_glLoadTransposeMatrixf){this->m_orig_glLoadTransposeMatrixf = this->m_ptr_glLoadTransposeMatrixf;this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&TraceTableDecorator::m_glLoadTransposeMatrixf_trace;}
+if(this->m_ptr_glGetPointervEXT){this->m_orig_glGetPointervEXT = this->m_ptr_glGetPointervEXT;this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&TraceTableDecorator::m_glGetPointervEXT_trace;}
+if(this->m_ptr_glSignalVkSemaphoreNV){this->m_orig_glSignalVkSemaphoreNV = this->m_ptr_glSignalVkSemaphoreNV;this->m_ptr_glSignalVkSemaphoreNV = (FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC)&TraceTableDecorator::m_glSignalVkSemaphoreNV_trace;}
+if(this->m_ptr_glEndConditionalRenderNV){this->m_orig_glEndConditionalRenderNV = this->m_ptr_glEndConditionalRenderNV;this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&TraceTableDecorator::m_glEndConditionalRenderNV_trace;}
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN){this->m_orig_glTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fSUN;this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glUniform3i64vARB){this->m_orig_glUniform3i64vARB = this->m_ptr_glUniform3i64vARB;this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&TraceTableDecorator::m_glUniform3i64vARB_trace;}
+if(this->m_ptr_glProgramUniform2uiEXT){this->m_orig_glProgramUniform2uiEXT = this->m_ptr_glProgramUniform2uiEXT;this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&TraceTableDecorator::m_glProgramUniform2uiEXT_trace;}
+if(this->m_ptr_glVertexAttribI1ui){this->m_orig_glVertexAttribI1ui = this->m_ptr_glVertexAttribI1ui;this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&TraceTableDecorator::m_glVertexAttribI1ui_trace;}
+if(this->m_ptr_glProgramNamedParameter4dvNV){this->m_orig_glProgramNamedParameter4dvNV = this->m_ptr_glProgramNamedParameter4dvNV;this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&TraceTableDecorator::m_glProgramNamedParameter4dvNV_trace;}
+if(this->m_ptr_glCompileCommandListNV){this->m_orig_glCompileCommandListNV = this->m_ptr_glCompileCommandListNV;this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&TraceTableDecorator::m_glCompileCommandListNV_trace;}
+if(this->m_ptr_glGetRenderbufferParameterivEXT){this->m_orig_glGetRenderbufferParameterivEXT = this->m_ptr_glGetRenderbufferParameterivEXT;this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetRenderbufferParameterivEXT_trace;}
+if(this->m_ptr_glGetnPolygonStipple){this->m_orig_glGetnPolygonStipple = this->m_ptr_glGetnPolygonStipple;this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&TraceTableDecorator::m_glGetnPolygonStipple_trace;}
+if(this->m_ptr_glIsBufferResidentNV){this->m_orig_glIsBufferResidentNV = this->m_ptr_glIsBufferResidentNV;this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&TraceTableDecorator::m_glIsBufferResidentNV_trace;}
+if(this->m_ptr_glSecondaryColor3ubvEXT){this->m_orig_glSecondaryColor3ubvEXT = this->m_ptr_glSecondaryColor3ubvEXT;this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3ubvEXT_trace;}
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT){this->m_orig_glGetNamedRenderbufferParameterivEXT = this->m_ptr_glGetNamedRenderbufferParameterivEXT;this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetNamedRenderbufferParameterivEXT_trace;}
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB){this->m_orig_glNamedFramebufferSampleLocationsfvARB = this->m_ptr_glNamedFramebufferSampleLocationsfvARB;this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&TraceTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_trace;}
+if(this->m_ptr_glMultiTexGendvEXT){this->m_orig_glMultiTexGendvEXT = this->m_ptr_glMultiTexGendvEXT;this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&TraceTableDecorator::m_glMultiTexGendvEXT_trace;}
+if(this->m_ptr_glVertexArrayRangeNV){this->m_orig_glVertexArrayRangeNV = this->m_ptr_glVertexArrayRangeNV;this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&TraceTableDecorator::m_glVertexArrayRangeNV_trace;}
+if(this->m_ptr_glIsTextureHandleResidentNV){this->m_orig_glIsTextureHandleResidentNV = this->m_ptr_glIsTextureHandleResidentNV;this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&TraceTableDecorator::m_glIsTextureHandleResidentNV_trace;}
+if(this->m_ptr_glGetProgramEnvParameterdvARB){this->m_orig_glGetProgramEnvParameterdvARB = this->m_ptr_glGetProgramEnvParameterdvARB;this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&TraceTableDecorator::m_glGetProgramEnvParameterdvARB_trace;}
+if(this->m_ptr_glIsNamedStringARB){this->m_orig_glIsNamedStringARB = this->m_ptr_glIsNamedStringARB;this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&TraceTableDecorator::m_glIsNamedStringARB_trace;}
+if(this->m_ptr_glSecondaryColorFormatNV){this->m_orig_glSecondaryColorFormatNV = this->m_ptr_glSecondaryColorFormatNV;this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&TraceTableDecorator::m_glSecondaryColorFormatNV_trace;}
+if(this->m_ptr_glVertexAttrib4ubvNV){this->m_orig_glVertexAttrib4ubvNV = this->m_ptr_glVertexAttrib4ubvNV;this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&TraceTableDecorator::m_glVertexAttrib4ubvNV_trace;}
+if(this->m_ptr_glTagSampleBufferSGIX){this->m_orig_glTagSampleBufferSGIX = this->m_ptr_glTagSampleBufferSGIX;this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&TraceTableDecorator::m_glTagSampleBufferSGIX_trace;}
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV){this->m_orig_glVDPAUUnregisterSurfaceNV = this->m_ptr_glVDPAUUnregisterSurfaceNV;this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&TraceTableDecorator::m_glVDPAUUnregisterSurfaceNV_trace;}
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL){this->m_orig_glGetPerfQueryIdByNameINTEL = this->m_ptr_glGetPerfQueryIdByNameINTEL;this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&TraceTableDecorator::m_glGetPerfQueryIdByNameINTEL_trace;}
+if(this->m_ptr_glGetInteger64v){this->m_orig_glGetInteger64v = this->m_ptr_glGetInteger64v;this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&TraceTableDecorator::m_glGetInteger64v_trace;}
+if(this->m_ptr_glClipPlane){this->m_orig_glClipPlane = this->m_ptr_glClipPlane;this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&TraceTableDecorator::m_glClipPlane_trace;}
+if(this->m_ptr_glColor4ubVertex3fSUN){this->m_orig_glColor4ubVertex3fSUN = this->m_ptr_glColor4ubVertex3fSUN;this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&TraceTableDecorator::m_glColor4ubVertex3fSUN_trace;}
+if(this->m_ptr_glIndexub){this->m_orig_glIndexub = this->m_ptr_glIndexub;this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&TraceTableDecorator::m_glIndexub_trace;}
+if(this->m_ptr_glGetProgramEnvParameterfvARB){this->m_orig_glGetProgramEnvParameterfvARB = this->m_ptr_glGetProgramEnvParameterfvARB;this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&TraceTableDecorator::m_glGetProgramEnvParameterfvARB_trace;}
+if(this->m_ptr_glVertexAttrib4usvARB){this->m_orig_glVertexAttrib4usvARB = this->m_ptr_glVertexAttrib4usvARB;this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&TraceTableDecorator::m_glVertexAttrib4usvARB_trace;}
+if(this->m_ptr_glNamedFramebufferRenderbuffer){this->m_orig_glNamedFramebufferRenderbuffer = this->m_ptr_glNamedFramebufferRenderbuffer;this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&TraceTableDecorator::m_glNamedFramebufferRenderbuffer_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x4dv){this->m_orig_glProgramUniformMatrix3x4dv = this->m_ptr_glProgramUniformMatrix3x4dv;this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x4dv_trace;}
+if(this->m_ptr_glTestFenceAPPLE){this->m_orig_glTestFenceAPPLE = this->m_ptr_glTestFenceAPPLE;this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&TraceTableDecorator::m_glTestFenceAPPLE_trace;}
+if(this->m_ptr_glVertexAttrib4Niv){this->m_orig_glVertexAttrib4Niv = this->m_ptr_glVertexAttrib4Niv;this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&TraceTableDecorator::m_glVertexAttrib4Niv_trace;}
+if(this->m_ptr_glVertexAttribL2i64vNV){this->m_orig_glVertexAttribL2i64vNV = this->m_ptr_glVertexAttribL2i64vNV;this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&TraceTableDecorator::m_glVertexAttribL2i64vNV_trace;}
+if(this->m_ptr_glColorP4uiv){this->m_orig_glColorP4uiv = this->m_ptr_glColorP4uiv;this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&TraceTableDecorator::m_glColorP4uiv_trace;}
+if(this->m_ptr_glUniformMatrix2x3fv){this->m_orig_glUniformMatrix2x3fv = this->m_ptr_glUniformMatrix2x3fv;this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&TraceTableDecorator::m_glUniformMatrix2x3fv_trace;}
+if(this->m_ptr_glCallCommandListNV){this->m_orig_glCallCommandListNV = this->m_ptr_glCallCommandListNV;this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&TraceTableDecorator::m_glCallCommandListNV_trace;}
+if(this->m_ptr_glClearBufferiv){this->m_orig_glClearBufferiv = this->m_ptr_glClearBufferiv;this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&TraceTableDecorator::m_glClearBufferiv_trace;}
+if(this->m_ptr_glNamedStringARB){this->m_orig_glNamedStringARB = this->m_ptr_glNamedStringARB;this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&TraceTableDecorator::m_glNamedStringARB_trace;}
+if(this->m_ptr_glMatrixMult3x2fNV){this->m_orig_glMatrixMult3x2fNV = this->m_ptr_glMatrixMult3x2fNV;this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&TraceTableDecorator::m_glMatrixMult3x2fNV_trace;}
+if(this->m_ptr_glGetNamedProgramStringEXT){this->m_orig_glGetNamedProgramStringEXT = this->m_ptr_glGetNamedProgramStringEXT;this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&TraceTableDecorator::m_glGetNamedProgramStringEXT_trace;}
+if(this->m_ptr_glGetnHistogramARB){this->m_orig_glGetnHistogramARB = this->m_ptr_glGetnHistogramARB;this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&TraceTableDecorator::m_glGetnHistogramARB_trace;}
+if(this->m_ptr_glGetTextureLevelParameterfv){this->m_orig_glGetTextureLevelParameterfv = this->m_ptr_glGetTextureLevelParameterfv;this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&TraceTableDecorator::m_glGetTextureLevelParameterfv_trace;}
+if(this->m_ptr_glMultiTexCoord1fv){this->m_orig_glMultiTexCoord1fv = this->m_ptr_glMultiTexCoord1fv;this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&TraceTableDecorator::m_glMultiTexCoord1fv_trace;}
+if(this->m_ptr_glBitmapxOES){this->m_orig_glBitmapxOES = this->m_ptr_glBitmapxOES;this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&TraceTableDecorator::m_glBitmapxOES_trace;}
+if(this->m_ptr_glGetSamplerParameterIuiv){this->m_orig_glGetSamplerParameterIuiv = this->m_ptr_glGetSamplerParameterIuiv;this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&TraceTableDecorator::m_glGetSamplerParameterIuiv_trace;}
+if(this->m_ptr_glTexCoordP3ui){this->m_orig_glTexCoordP3ui = this->m_ptr_glTexCoordP3ui;this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&TraceTableDecorator::m_glTexCoordP3ui_trace;}
+if(this->m_ptr_glTextureSubImage1D){this->m_orig_glTextureSubImage1D = this->m_ptr_glTextureSubImage1D;this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&TraceTableDecorator::m_glTextureSubImage1D_trace;}
+if(this->m_ptr_glVertexAttribLPointerEXT){this->m_orig_glVertexAttribLPointerEXT = this->m_ptr_glVertexAttribLPointerEXT;this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&TraceTableDecorator::m_glVertexAttribLPointerEXT_trace;}
+if(this->m_ptr_glFogCoordPointerEXT){this->m_orig_glFogCoordPointerEXT = this->m_ptr_glFogCoordPointerEXT;this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&TraceTableDecorator::m_glFogCoordPointerEXT_trace;}
+if(this->m_ptr_glWindowPos3s){this->m_orig_glWindowPos3s = this->m_ptr_glWindowPos3s;this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&TraceTableDecorator::m_glWindowPos3s_trace;}
+if(this->m_ptr_glVertexAttribs2svNV){this->m_orig_glVertexAttribs2svNV = this->m_ptr_glVertexAttribs2svNV;this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&TraceTableDecorator::m_glVertexAttribs2svNV_trace;}
+if(this->m_ptr_glTextureImage3DEXT){this->m_orig_glTextureImage3DEXT = this->m_ptr_glTextureImage3DEXT;this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&TraceTableDecorator::m_glTextureImage3DEXT_trace;}
+if(this->m_ptr_glWindowPos3i){this->m_orig_glWindowPos3i = this->m_ptr_glWindowPos3i;this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&TraceTableDecorator::m_glWindowPos3i_trace;}
+if(this->m_ptr_glWindowPos3d){this->m_orig_glWindowPos3d = this->m_ptr_glWindowPos3d;this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&TraceTableDecorator::m_glWindowPos3d_trace;}
+if(this->m_ptr_glWindowPos3f){this->m_orig_glWindowPos3f = this->m_ptr_glWindowPos3f;this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&TraceTableDecorator::m_glWindowPos3f_trace;}
+if(this->m_ptr_glIsEnabledIndexedEXT){this->m_orig_glIsEnabledIndexedEXT = this->m_ptr_glIsEnabledIndexedEXT;this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&TraceTableDecorator::m_glIsEnabledIndexedEXT_trace;}
+if(this->m_ptr_glGetNamedProgramivEXT){this->m_orig_glGetNamedProgramivEXT = this->m_ptr_glGetNamedProgramivEXT;this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&TraceTableDecorator::m_glGetNamedProgramivEXT_trace;}
+if(this->m_ptr_glVertex3xvOES){this->m_orig_glVertex3xvOES = this->m_ptr_glVertex3xvOES;this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&TraceTableDecorator::m_glVertex3xvOES_trace;}
+if(this->m_ptr_glColor3us){this->m_orig_glColor3us = this->m_ptr_glColor3us;this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&TraceTableDecorator::m_glColor3us_trace;}
+if(this->m_ptr_glBeginPerfMonitorAMD){this->m_orig_glBeginPerfMonitorAMD = this->m_ptr_glBeginPerfMonitorAMD;this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&TraceTableDecorator::m_glBeginPerfMonitorAMD_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x3dv){this->m_orig_glProgramUniformMatrix4x3dv = this->m_ptr_glProgramUniformMatrix4x3dv;this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x3dv_trace;}
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT){this->m_orig_glGetNamedProgramLocalParameterIuivEXT = this->m_ptr_glGetNamedProgramLocalParameterIuivEXT;this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_trace;}
+if(this->m_ptr_glReadnPixels){this->m_orig_glReadnPixels = this->m_ptr_glReadnPixels;this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&TraceTableDecorator::m_glReadnPixels_trace;}
+if(this->m_ptr_glMultiTexCoord4f){this->m_orig_glMultiTexCoord4f = this->m_ptr_glMultiTexCoord4f;this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&TraceTableDecorator::m_glMultiTexCoord4f_trace;}
+if(this->m_ptr_glColor3ub){this->m_orig_glColor3ub = this->m_ptr_glColor3ub;this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&TraceTableDecorator::m_glColor3ub_trace;}
+if(this->m_ptr_glMultiTexCoord4d){this->m_orig_glMultiTexCoord4d = this->m_ptr_glMultiTexCoord4d;this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&TraceTableDecorator::m_glMultiTexCoord4d_trace;}
+if(this->m_ptr_glVertexAttribL3ui64NV){this->m_orig_glVertexAttribL3ui64NV = this->m_ptr_glVertexAttribL3ui64NV;this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&TraceTableDecorator::m_glVertexAttribL3ui64NV_trace;}
+if(this->m_ptr_glColor3ui){this->m_orig_glColor3ui = this->m_ptr_glColor3ui;this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&TraceTableDecorator::m_glColor3ui_trace;}
+if(this->m_ptr_glProgramUniform4fvEXT){this->m_orig_glProgramUniform4fvEXT = this->m_ptr_glProgramUniform4fvEXT;this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&TraceTableDecorator::m_glProgramUniform4fvEXT_trace;}
+if(this->m_ptr_glVertexAttrib2sARB){this->m_orig_glVertexAttrib2sARB = this->m_ptr_glVertexAttrib2sARB;this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&TraceTableDecorator::m_glVertexAttrib2sARB_trace;}
+if(this->m_ptr_glMultiTexCoord4i){this->m_orig_glMultiTexCoord4i = this->m_ptr_glMultiTexCoord4i;this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&TraceTableDecorator::m_glMultiTexCoord4i_trace;}
+if(this->m_ptr_glCheckFramebufferStatusEXT){this->m_orig_glCheckFramebufferStatusEXT = this->m_ptr_glCheckFramebufferStatusEXT;this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&TraceTableDecorator::m_glCheckFramebufferStatusEXT_trace;}
+if(this->m_ptr_glGetnMapivARB){this->m_orig_glGetnMapivARB = this->m_ptr_glGetnMapivARB;this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&TraceTableDecorator::m_glGetnMapivARB_trace;}
+if(this->m_ptr_glMultiTexCoord1ivARB){this->m_orig_glMultiTexCoord1ivARB = this->m_ptr_glMultiTexCoord1ivARB;this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&TraceTableDecorator::m_glMultiTexCoord1ivARB_trace;}
+if(this->m_ptr_glDisableVertexAttribArrayARB){this->m_orig_glDisableVertexAttribArrayARB = this->m_ptr_glDisableVertexAttribArrayARB;this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&TraceTableDecorator::m_glDisableVertexAttribArrayARB_trace;}
+if(this->m_ptr_glGetPolygonStipple){this->m_orig_glGetPolygonStipple = this->m_ptr_glGetPolygonStipple;this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&TraceTableDecorator::m_glGetPolygonStipple_trace;}
+if(this->m_ptr_glVertexAttribI4ui){this->m_orig_glVertexAttribI4ui = this->m_ptr_glVertexAttribI4ui;this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&TraceTableDecorator::m_glVertexAttribI4ui_trace;}
+if(this->m_ptr_glGetPathDashArrayNV){this->m_orig_glGetPathDashArrayNV = this->m_ptr_glGetPathDashArrayNV;this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&TraceTableDecorator::m_glGetPathDashArrayNV_trace;}
+if(this->m_ptr_glMultiTexRenderbufferEXT){this->m_orig_glMultiTexRenderbufferEXT = this->m_ptr_glMultiTexRenderbufferEXT;this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&TraceTableDecorator::m_glMultiTexRenderbufferEXT_trace;}
+if(this->m_ptr_glCopyTextureSubImage1D){this->m_orig_glCopyTextureSubImage1D = this->m_ptr_glCopyTextureSubImage1D;this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&TraceTableDecorator::m_glCopyTextureSubImage1D_trace;}
+if(this->m_ptr_glDeleteOcclusionQueriesNV){this->m_orig_glDeleteOcclusionQueriesNV = this->m_ptr_glDeleteOcclusionQueriesNV;this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&TraceTableDecorator::m_glDeleteOcclusionQueriesNV_trace;}
+if(this->m_ptr_glVertex4hvNV){this->m_orig_glVertex4hvNV = this->m_ptr_glVertex4hvNV;this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&TraceTableDecorator::m_glVertex4hvNV_trace;}
+if(this->m_ptr_glGetnTexImage){this->m_orig_glGetnTexImage = this->m_ptr_glGetnTexImage;this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&TraceTableDecorator::m_glGetnTexImage_trace;}
+if(this->m_ptr_glProgramLocalParameter4dARB){this->m_orig_glProgramLocalParameter4dARB = this->m_ptr_glProgramLocalParameter4dARB;this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&TraceTableDecorator::m_glProgramLocalParameter4dARB_trace;}
+if(this->m_ptr_glBlendEquation){this->m_orig_glBlendEquation = this->m_ptr_glBlendEquation;this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&TraceTableDecorator::m_glBlendEquation_trace;}
+if(this->m_ptr_glUnlockArraysEXT){this->m_orig_glUnlockArraysEXT = this->m_ptr_glUnlockArraysEXT;this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&TraceTableDecorator::m_glUnlockArraysEXT_trace;}
+if(this->m_ptr_glGetQueryObjectui64vEXT){this->m_orig_glGetQueryObjectui64vEXT = this->m_ptr_glGetQueryObjectui64vEXT;this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&TraceTableDecorator::m_glGetQueryObjectui64vEXT_trace;}
+if(this->m_ptr_glVertexAttribI4uivEXT){this->m_orig_glVertexAttribI4uivEXT = this->m_ptr_glVertexAttribI4uivEXT;this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&TraceTableDecorator::m_glVertexAttribI4uivEXT_trace;}
+if(this->m_ptr_glUniform1i64vNV){this->m_orig_glUniform1i64vNV = this->m_ptr_glUniform1i64vNV;this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&TraceTableDecorator::m_glUniform1i64vNV_trace;}
+if(this->m_ptr_glMultiTexCoord3dv){this->m_orig_glMultiTexCoord3dv = this->m_ptr_glMultiTexCoord3dv;this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&TraceTableDecorator::m_glMultiTexCoord3dv_trace;}
+if(this->m_ptr_glColor4sv){this->m_orig_glColor4sv = this->m_ptr_glColor4sv;this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&TraceTableDecorator::m_glColor4sv_trace;}
+if(this->m_ptr_glVertexStream4ivATI){this->m_orig_glVertexStream4ivATI = this->m_ptr_glVertexStream4ivATI;this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&TraceTableDecorator::m_glVertexStream4ivATI_trace;}
+if(this->m_ptr_glPopClientAttrib){this->m_orig_glPopClientAttrib = this->m_ptr_glPopClientAttrib;this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&TraceTableDecorator::m_glPopClientAttrib_trace;}
+if(this->m_ptr_glClearBufferData){this->m_orig_glClearBufferData = this->m_ptr_glClearBufferData;this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&TraceTableDecorator::m_glClearBufferData_trace;}
+if(this->m_ptr_glGetProgramivNV){this->m_orig_glGetProgramivNV = this->m_ptr_glGetProgramivNV;this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&TraceTableDecorator::m_glGetProgramivNV_trace;}
+if(this->m_ptr_glBeginTransformFeedback){this->m_orig_glBeginTransformFeedback = this->m_ptr_glBeginTransformFeedback;this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glBeginTransformFeedback_trace;}
+if(this->m_ptr_glFinishObjectAPPLE){this->m_orig_glFinishObjectAPPLE = this->m_ptr_glFinishObjectAPPLE;this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&TraceTableDecorator::m_glFinishObjectAPPLE_trace;}
+if(this->m_ptr_glGetMinmaxParameterivEXT){this->m_orig_glGetMinmaxParameterivEXT = this->m_ptr_glGetMinmaxParameterivEXT;this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetMinmaxParameterivEXT_trace;}
+if(this->m_ptr_glColor3iv){this->m_orig_glColor3iv = this->m_ptr_glColor3iv;this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&TraceTableDecorator::m_glColor3iv_trace;}
+if(this->m_ptr_glVertexAttrib3sv){this->m_orig_glVertexAttrib3sv = this->m_ptr_glVertexAttrib3sv;this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&TraceTableDecorator::m_glVertexAttrib3sv_trace;}
+if(this->m_ptr_glCompressedTexImage1D){this->m_orig_glCompressedTexImage1D = this->m_ptr_glCompressedTexImage1D;this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&TraceTableDecorator::m_glCompressedTexImage1D_trace;}
+if(this->m_ptr_glDeleteTransformFeedbacks){this->m_orig_glDeleteTransformFeedbacks = this->m_ptr_glDeleteTransformFeedbacks;this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&TraceTableDecorator::m_glDeleteTransformFeedbacks_trace;}
+if(this->m_ptr_glGetVideoi64vNV){this->m_orig_glGetVideoi64vNV = this->m_ptr_glGetVideoi64vNV;this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&TraceTableDecorator::m_glGetVideoi64vNV_trace;}
+if(this->m_ptr_glDrawRangeElementsBaseVertex){this->m_orig_glDrawRangeElementsBaseVertex = this->m_ptr_glDrawRangeElementsBaseVertex;this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&TraceTableDecorator::m_glDrawRangeElementsBaseVertex_trace;}
+if(this->m_ptr_glUniform4i64vARB){this->m_orig_glUniform4i64vARB = this->m_ptr_glUniform4i64vARB;this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&TraceTableDecorator::m_glUniform4i64vARB_trace;}
+if(this->m_ptr_glTextureStorage3DMultisampleEXT){this->m_orig_glTextureStorage3DMultisampleEXT = this->m_ptr_glTextureStorage3DMultisampleEXT;this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glTextureStorage3DMultisampleEXT_trace;}
+if(this->m_ptr_glGetTexParameterfv){this->m_orig_glGetTexParameterfv = this->m_ptr_glGetTexParameterfv;this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&TraceTableDecorator::m_glGetTexParameterfv_trace;}
+if(this->m_ptr_glProgramUniformui64vNV){this->m_orig_glProgramUniformui64vNV = this->m_ptr_glProgramUniformui64vNV;this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&TraceTableDecorator::m_glProgramUniformui64vNV_trace;}
+if(this->m_ptr_glCompressedMultiTexImage1DEXT){this->m_orig_glCompressedMultiTexImage1DEXT = this->m_ptr_glCompressedMultiTexImage1DEXT;this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&TraceTableDecorator::m_glCompressedMultiTexImage1DEXT_trace;}
+if(this->m_ptr_glProgramUniform2ivEXT){this->m_orig_glProgramUniform2ivEXT = this->m_ptr_glProgramUniform2ivEXT;this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&TraceTableDecorator::m_glProgramUniform2ivEXT_trace;}
+if(this->m_ptr_glPushGroupMarkerEXT){this->m_orig_glPushGroupMarkerEXT = this->m_ptr_glPushGroupMarkerEXT;this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&TraceTableDecorator::m_glPushGroupMarkerEXT_trace;}
+if(this->m_ptr_glVertexAttrib1dv){this->m_orig_glVertexAttrib1dv = this->m_ptr_glVertexAttrib1dv;this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&TraceTableDecorator::m_glVertexAttrib1dv_trace;}
+if(this->m_ptr_glMatrixLoadIdentityEXT){this->m_orig_glMatrixLoadIdentityEXT = this->m_ptr_glMatrixLoadIdentityEXT;this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&TraceTableDecorator::m_glMatrixLoadIdentityEXT_trace;}
+if(this->m_ptr_glMultTransposeMatrixxOES){this->m_orig_glMultTransposeMatrixxOES = this->m_ptr_glMultTransposeMatrixxOES;this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&TraceTableDecorator::m_glMultTransposeMatrixxOES_trace;}
+if(this->m_ptr_glGetPixelMapxv){this->m_orig_glGetPixelMapxv = this->m_ptr_glGetPixelMapxv;this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&TraceTableDecorator::m_glGetPixelMapxv_trace;}
+if(this->m_ptr_glFramebufferSampleLocationsfvARB){this->m_orig_glFramebufferSampleLocationsfvARB = this->m_ptr_glFramebufferSampleLocationsfvARB;this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&TraceTableDecorator::m_glFramebufferSampleLocationsfvARB_trace;}
+if(this->m_ptr_glGetLightiv){this->m_orig_glGetLightiv = this->m_ptr_glGetLightiv;this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&TraceTableDecorator::m_glGetLightiv_trace;}
+if(this->m_ptr_glBlendFuncSeparatei){this->m_orig_glBlendFuncSeparatei = this->m_ptr_glBlendFuncSeparatei;this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&TraceTableDecorator::m_glBlendFuncSeparatei_trace;}
+if(this->m_ptr_glAcquireKeyedMutexWin32EXT){this->m_orig_glAcquireKeyedMutexWin32EXT = this->m_ptr_glAcquireKeyedMutexWin32EXT;this->m_ptr_glAcquireKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)&TraceTableDecorator::m_glAcquireKeyedMutexWin32EXT_trace;}
+if(this->m_ptr_glGetBooleanIndexedvEXT){this->m_orig_glGetBooleanIndexedvEXT = this->m_ptr_glGetBooleanIndexedvEXT;this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&TraceTableDecorator::m_glGetBooleanIndexedvEXT_trace;}
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV){this->m_orig_glGetProgramSubroutineParameteruivNV = this->m_ptr_glGetProgramSubroutineParameteruivNV;this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&TraceTableDecorator::m_glGetProgramSubroutineParameteruivNV_trace;}
+if(this->m_ptr_glUniform2ui){this->m_orig_glUniform2ui = this->m_ptr_glUniform2ui;this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&TraceTableDecorator::m_glUniform2ui_trace;}
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL){this->m_orig_glApplyFramebufferAttachmentCMAAINTEL = this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL;this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&TraceTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_trace;}
+if(this->m_ptr_glWindowPos2fv){this->m_orig_glWindowPos2fv = this->m_ptr_glWindowPos2fv;this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&TraceTableDecorator::m_glWindowPos2fv_trace;}
+if(this->m_ptr_glWaitVkSemaphoreNV){this->m_orig_glWaitVkSemaphoreNV = this->m_ptr_glWaitVkSemaphoreNV;this->m_ptr_glWaitVkSemaphoreNV = (FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC)&TraceTableDecorator::m_glWaitVkSemaphoreNV_trace;}
+if(this->m_ptr_glDisablei){this->m_orig_glDisablei = this->m_ptr_glDisablei;this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&TraceTableDecorator::m_glDisablei_trace;}
+if(this->m_ptr_glSelectPerfMonitorCountersAMD){this->m_orig_glSelectPerfMonitorCountersAMD = this->m_ptr_glSelectPerfMonitorCountersAMD;this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&TraceTableDecorator::m_glSelectPerfMonitorCountersAMD_trace;}
+if(this->m_ptr_glGetVertexAttribLi64vNV){this->m_orig_glGetVertexAttribLi64vNV = this->m_ptr_glGetVertexAttribLi64vNV;this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&TraceTableDecorator::m_glGetVertexAttribLi64vNV_trace;}
+if(this->m_ptr_glBlendFuncSeparateiARB){this->m_orig_glBlendFuncSeparateiARB = this->m_ptr_glBlendFuncSeparateiARB;this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&TraceTableDecorator::m_glBlendFuncSeparateiARB_trace;}
+if(this->m_ptr_glWeightuivARB){this->m_orig_glWeightuivARB = this->m_ptr_glWeightuivARB;this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&TraceTableDecorator::m_glWeightuivARB_trace;}
+if(this->m_ptr_glWindowPos2iARB){this->m_orig_glWindowPos2iARB = this->m_ptr_glWindowPos2iARB;this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&TraceTableDecorator::m_glWindowPos2iARB_trace;}
+if(this->m_ptr_glGetProgramLocalParameterdvARB){this->m_orig_glGetProgramLocalParameterdvARB = this->m_ptr_glGetProgramLocalParameterdvARB;this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&TraceTableDecorator::m_glGetProgramLocalParameterdvARB_trace;}
+if(this->m_ptr_glGetUniformui64vARB){this->m_orig_glGetUniformui64vARB = this->m_ptr_glGetUniformui64vARB;this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&TraceTableDecorator::m_glGetUniformui64vARB_trace;}
+if(this->m_ptr_glSecondaryColor3us){this->m_orig_glSecondaryColor3us = this->m_ptr_glSecondaryColor3us;this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&TraceTableDecorator::m_glSecondaryColor3us_trace;}
+if(this->m_ptr_glGetSynciv){this->m_orig_glGetSynciv = this->m_ptr_glGetSynciv;this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&TraceTableDecorator::m_glGetSynciv_trace;}
+if(this->m_ptr_glMakeImageHandleResidentARB){this->m_orig_glMakeImageHandleResidentARB = this->m_ptr_glMakeImageHandleResidentARB;this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&TraceTableDecorator::m_glMakeImageHandleResidentARB_trace;}
+if(this->m_ptr_glGetProgramNamedParameterfvNV){this->m_orig_glGetProgramNamedParameterfvNV = this->m_ptr_glGetProgramNamedParameterfvNV;this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetProgramNamedParameterfvNV_trace;}
+if(this->m_ptr_glTextureStorage3D){this->m_orig_glTextureStorage3D = this->m_ptr_glTextureStorage3D;this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&TraceTableDecorator::m_glTextureStorage3D_trace;}
+if(this->m_ptr_glVertexAttrib4svNV){this->m_orig_glVertexAttrib4svNV = this->m_ptr_glVertexAttrib4svNV;this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&TraceTableDecorator::m_glVertexAttrib4svNV_trace;}
+if(this->m_ptr_glProgramUniform2i){this->m_orig_glProgramUniform2i = this->m_ptr_glProgramUniform2i;this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&TraceTableDecorator::m_glProgramUniform2i_trace;}
+if(this->m_ptr_glListDrawCommandsStatesClientNV){this->m_orig_glListDrawCommandsStatesClientNV = this->m_ptr_glListDrawCommandsStatesClientNV;this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&TraceTableDecorator::m_glListDrawCommandsStatesClientNV_trace;}
+if(this->m_ptr_glProgramLocalParametersI4uivNV){this->m_orig_glProgramLocalParametersI4uivNV = this->m_ptr_glProgramLocalParametersI4uivNV;this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&TraceTableDecorator::m_glProgramLocalParametersI4uivNV_trace;}
+if(this->m_ptr_glBeginTransformFeedbackNV){this->m_orig_glBeginTransformFeedbackNV = this->m_ptr_glBeginTransformFeedbackNV;this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glBeginTransformFeedbackNV_trace;}
+if(this->m_ptr_glGetProgramBinary){this->m_orig_glGetProgramBinary = this->m_ptr_glGetProgramBinary;this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&TraceTableDecorator::m_glGetProgramBinary_trace;}
+if(this->m_ptr_glBinormal3iEXT){this->m_orig_glBinormal3iEXT = this->m_ptr_glBinormal3iEXT;this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&TraceTableDecorator::m_glBinormal3iEXT_trace;}
+if(this->m_ptr_glEvalPoint1){this->m_orig_glEvalPoint1 = this->m_ptr_glEvalPoint1;this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&TraceTableDecorator::m_glEvalPoint1_trace;}
+if(this->m_ptr_glEvalPoint2){this->m_orig_glEvalPoint2 = this->m_ptr_glEvalPoint2;this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&TraceTableDecorator::m_glEvalPoint2_trace;}
+if(this->m_ptr_glPauseTransformFeedback){this->m_orig_glPauseTransformFeedback = this->m_ptr_glPauseTransformFeedback;this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glPauseTransformFeedback_trace;}
+if(this->m_ptr_glWindowPos2sMESA){this->m_orig_glWindowPos2sMESA = this->m_ptr_glWindowPos2sMESA;this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&TraceTableDecorator::m_glWindowPos2sMESA_trace;}
+if(this->m_ptr_glGlobalAlphaFactorbSUN){this->m_orig_glGlobalAlphaFactorbSUN = this->m_ptr_glGlobalAlphaFactorbSUN;this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactorbSUN_trace;}
+if(this->m_ptr_glCreateTransformFeedbacks){this->m_orig_glCreateTransformFeedbacks = this->m_ptr_glCreateTransformFeedbacks;this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&TraceTableDecorator::m_glCreateTransformFeedbacks_trace;}
+if(this->m_ptr_glTexturePageCommitmentEXT){this->m_orig_glTexturePageCommitmentEXT = this->m_ptr_glTexturePageCommitmentEXT;this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&TraceTableDecorator::m_glTexturePageCommitmentEXT_trace;}
+if(this->m_ptr_glTransformFeedbackVaryingsNV){this->m_orig_glTransformFeedbackVaryingsNV = this->m_ptr_glTransformFeedbackVaryingsNV;this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&TraceTableDecorator::m_glTransformFeedbackVaryingsNV_trace;}
+if(this->m_ptr_glTexSubImage1D){this->m_orig_glTexSubImage1D = this->m_ptr_glTexSubImage1D;this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&TraceTableDecorator::m_glTexSubImage1D_trace;}
+if(this->m_ptr_glConvolutionParameterfvEXT){this->m_orig_glConvolutionParameterfvEXT = this->m_ptr_glConvolutionParameterfvEXT;this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&TraceTableDecorator::m_glConvolutionParameterfvEXT_trace;}
+if(this->m_ptr_glBlitFramebufferEXT){this->m_orig_glBlitFramebufferEXT = this->m_ptr_glBlitFramebufferEXT;this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&TraceTableDecorator::m_glBlitFramebufferEXT_trace;}
+if(this->m_ptr_glUniformMatrix4fvARB){this->m_orig_glUniformMatrix4fvARB = this->m_ptr_glUniformMatrix4fvARB;this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&TraceTableDecorator::m_glUniformMatrix4fvARB_trace;}
+if(this->m_ptr_glProgramEnvParameter4dvARB){this->m_orig_glProgramEnvParameter4dvARB = this->m_ptr_glProgramEnvParameter4dvARB;this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&TraceTableDecorator::m_glProgramEnvParameter4dvARB_trace;}
+if(this->m_ptr_glTextureStorageMem2DEXT){this->m_orig_glTextureStorageMem2DEXT = this->m_ptr_glTextureStorageMem2DEXT;this->m_ptr_glTextureStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC)&TraceTableDecorator::m_glTextureStorageMem2DEXT_trace;}
+if(this->m_ptr_glVertexAttribP3uiv){this->m_orig_glVertexAttribP3uiv = this->m_ptr_glVertexAttribP3uiv;this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&TraceTableDecorator::m_glVertexAttribP3uiv_trace;}
+if(this->m_ptr_glFogCoordFormatNV){this->m_orig_glFogCoordFormatNV = this->m_ptr_glFogCoordFormatNV;this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&TraceTableDecorator::m_glFogCoordFormatNV_trace;}
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT){this->m_orig_glGetMultiTexLevelParameterivEXT = this->m_ptr_glGetMultiTexLevelParameterivEXT;this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetMultiTexLevelParameterivEXT_trace;}
+if(this->m_ptr_glIsOcclusionQueryNV){this->m_orig_glIsOcclusionQueryNV = this->m_ptr_glIsOcclusionQueryNV;this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&TraceTableDecorator::m_glIsOcclusionQueryNV_trace;}
+if(this->m_ptr_glCompressedTexImage2DARB){this->m_orig_glCompressedTexImage2DARB = this->m_ptr_glCompressedTexImage2DARB;this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&TraceTableDecorator::m_glCompressedTexImage2DARB_trace;}
+if(this->m_ptr_glGetProgramEnvParameterIuivNV){this->m_orig_glGetProgramEnvParameterIuivNV = this->m_ptr_glGetProgramEnvParameterIuivNV;this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&TraceTableDecorator::m_glGetProgramEnvParameterIuivNV_trace;}
+if(this->m_ptr_glVertexAttrib4sv){this->m_orig_glVertexAttrib4sv = this->m_ptr_glVertexAttrib4sv;this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&TraceTableDecorator::m_glVertexAttrib4sv_trace;}
+if(this->m_ptr_glVertexAttrib4fvARB){this->m_orig_glVertexAttrib4fvARB = this->m_ptr_glVertexAttrib4fvARB;this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&TraceTableDecorator::m_glVertexAttrib4fvARB_trace;}
+if(this->m_ptr_glLoadName){this->m_orig_glLoadName = this->m_ptr_glLoadName;this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&TraceTableDecorator::m_glLoadName_trace;}
+if(this->m_ptr_glBindVertexShaderEXT){this->m_orig_glBindVertexShaderEXT = this->m_ptr_glBindVertexShaderEXT;this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&TraceTableDecorator::m_glBindVertexShaderEXT_trace;}
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT){this->m_orig_glGetNamedProgramLocalParameterIivEXT = this->m_ptr_glGetNamedProgramLocalParameterIivEXT;this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_trace;}
+if(this->m_ptr_glProgramUniform3uiEXT){this->m_orig_glProgramUniform3uiEXT = this->m_ptr_glProgramUniform3uiEXT;this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&TraceTableDecorator::m_glProgramUniform3uiEXT_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT){this->m_orig_glProgramUniformMatrix4x2dvEXT = this->m_ptr_glProgramUniformMatrix4x2dvEXT;this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x2dvEXT_trace;}
+if(this->m_ptr_glTexCoord1hvNV){this->m_orig_glTexCoord1hvNV = this->m_ptr_glTexCoord1hvNV;this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&TraceTableDecorator::m_glTexCoord1hvNV_trace;}
+if(this->m_ptr_glLoadMatrixd){this->m_orig_glLoadMatrixd = this->m_ptr_glLoadMatrixd;this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&TraceTableDecorator::m_glLoadMatrixd_trace;}
+if(this->m_ptr_glTexParameterfv){this->m_orig_glTexParameterfv = this->m_ptr_glTexParameterfv;this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&TraceTableDecorator::m_glTexParameterfv_trace;}
+if(this->m_ptr_glVariantdvEXT){this->m_orig_glVariantdvEXT = this->m_ptr_glVariantdvEXT;this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&TraceTableDecorator::m_glVariantdvEXT_trace;}
+if(this->m_ptr_glCullParameterfvEXT){this->m_orig_glCullParameterfvEXT = this->m_ptr_glCullParameterfvEXT;this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&TraceTableDecorator::m_glCullParameterfvEXT_trace;}
+if(this->m_ptr_glUniform3dv){this->m_orig_glUniform3dv = this->m_ptr_glUniform3dv;this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&TraceTableDecorator::m_glUniform3dv_trace;}
+if(this->m_ptr_glProgramUniform3fv){this->m_orig_glProgramUniform3fv = this->m_ptr_glProgramUniform3fv;this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&TraceTableDecorator::m_glProgramUniform3fv_trace;}
+if(this->m_ptr_glIsBufferARB){this->m_orig_glIsBufferARB = this->m_ptr_glIsBufferARB;this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&TraceTableDecorator::m_glIsBufferARB_trace;}
+if(this->m_ptr_glMultiTexCoord1bOES){this->m_orig_glMultiTexCoord1bOES = this->m_ptr_glMultiTexCoord1bOES;this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&TraceTableDecorator::m_glMultiTexCoord1bOES_trace;}
+if(this->m_ptr_glFogCoordhNV){this->m_orig_glFogCoordhNV = this->m_ptr_glFogCoordhNV;this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&TraceTableDecorator::m_glFogCoordhNV_trace;}
+if(this->m_ptr_glFramebufferSampleLocationsfvNV){this->m_orig_glFramebufferSampleLocationsfvNV = this->m_ptr_glFramebufferSampleLocationsfvNV;this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&TraceTableDecorator::m_glFramebufferSampleLocationsfvNV_trace;}
+if(this->m_ptr_glGenSymbolsEXT){this->m_orig_glGenSymbolsEXT = this->m_ptr_glGenSymbolsEXT;this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&TraceTableDecorator::m_glGenSymbolsEXT_trace;}
+if(this->m_ptr_glGetConvolutionFilter){this->m_orig_glGetConvolutionFilter = this->m_ptr_glGetConvolutionFilter;this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&TraceTableDecorator::m_glGetConvolutionFilter_trace;}
+if(this->m_ptr_glProgramUniform1fvEXT){this->m_orig_glProgramUniform1fvEXT = this->m_ptr_glProgramUniform1fvEXT;this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&TraceTableDecorator::m_glProgramUniform1fvEXT_trace;}
+if(this->m_ptr_glGetNextPerfQueryIdINTEL){this->m_orig_glGetNextPerfQueryIdINTEL = this->m_ptr_glGetNextPerfQueryIdINTEL;this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&TraceTableDecorator::m_glGetNextPerfQueryIdINTEL_trace;}
+if(this->m_ptr_glCompressedTexImage1DARB){this->m_orig_glCompressedTexImage1DARB = this->m_ptr_glCompressedTexImage1DARB;this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&TraceTableDecorator::m_glCompressedTexImage1DARB_trace;}
+if(this->m_ptr_glBindSamplers){this->m_orig_glBindSamplers = this->m_ptr_glBindSamplers;this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&TraceTableDecorator::m_glBindSamplers_trace;}
+if(this->m_ptr_glGetProgramEnvParameterIivNV){this->m_orig_glGetProgramEnvParameterIivNV = this->m_ptr_glGetProgramEnvParameterIivNV;this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&TraceTableDecorator::m_glGetProgramEnvParameterIivNV_trace;}
+if(this->m_ptr_glGetQueryObjectui64v){this->m_orig_glGetQueryObjectui64v = this->m_ptr_glGetQueryObjectui64v;this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&TraceTableDecorator::m_glGetQueryObjectui64v_trace;}
+if(this->m_ptr_glVertexAttribL4ui64vNV){this->m_orig_glVertexAttribL4ui64vNV = this->m_ptr_glVertexAttribL4ui64vNV;this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&TraceTableDecorator::m_glVertexAttribL4ui64vNV_trace;}
+if(this->m_ptr_glGetVideoivNV){this->m_orig_glGetVideoivNV = this->m_ptr_glGetVideoivNV;this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&TraceTableDecorator::m_glGetVideoivNV_trace;}
+if(this->m_ptr_glGetTextureImage){this->m_orig_glGetTextureImage = this->m_ptr_glGetTextureImage;this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&TraceTableDecorator::m_glGetTextureImage_trace;}
+if(this->m_ptr_glProgramUniform1fv){this->m_orig_glProgramUniform1fv = this->m_ptr_glProgramUniform1fv;this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&TraceTableDecorator::m_glProgramUniform1fv_trace;}
+if(this->m_ptr_glUniformMatrix4fv){this->m_orig_glUniformMatrix4fv = this->m_ptr_glUniformMatrix4fv;this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&TraceTableDecorator::m_glUniformMatrix4fv_trace;}
+if(this->m_ptr_glColorMask){this->m_orig_glColorMask = this->m_ptr_glColorMask;this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&TraceTableDecorator::m_glColorMask_trace;}
+if(this->m_ptr_glBeginFragmentShaderATI){this->m_orig_glBeginFragmentShaderATI = this->m_ptr_glBeginFragmentShaderATI;this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&TraceTableDecorator::m_glBeginFragmentShaderATI_trace;}
+if(this->m_ptr_glMultiDrawArraysEXT){this->m_orig_glMultiDrawArraysEXT = this->m_ptr_glMultiDrawArraysEXT;this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&TraceTableDecorator::m_glMultiDrawArraysEXT_trace;}
+if(this->m_ptr_glGenNamesAMD){this->m_orig_glGenNamesAMD = this->m_ptr_glGenNamesAMD;this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&TraceTableDecorator::m_glGenNamesAMD_trace;}
+if(this->m_ptr_glPathParameteriNV){this->m_orig_glPathParameteriNV = this->m_ptr_glPathParameteriNV;this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&TraceTableDecorator::m_glPathParameteriNV_trace;}
+if(this->m_ptr_glCreateCommandListsNV){this->m_orig_glCreateCommandListsNV = this->m_ptr_glCreateCommandListsNV;this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&TraceTableDecorator::m_glCreateCommandListsNV_trace;}
+if(this->m_ptr_glDeleteProgramPipelines){this->m_orig_glDeleteProgramPipelines = this->m_ptr_glDeleteProgramPipelines;this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&TraceTableDecorator::m_glDeleteProgramPipelines_trace;}
+if(this->m_ptr_glCopyColorSubTableEXT){this->m_orig_glCopyColorSubTableEXT = this->m_ptr_glCopyColorSubTableEXT;this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&TraceTableDecorator::m_glCopyColorSubTableEXT_trace;}
+if(this->m_ptr_glVariantsvEXT){this->m_orig_glVariantsvEXT = this->m_ptr_glVariantsvEXT;this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&TraceTableDecorator::m_glVariantsvEXT_trace;}
+if(this->m_ptr_glGenProgramPipelines){this->m_orig_glGenProgramPipelines = this->m_ptr_glGenProgramPipelines;this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&TraceTableDecorator::m_glGenProgramPipelines_trace;}
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT){this->m_orig_glVertexArrayEdgeFlagOffsetEXT = this->m_ptr_glVertexArrayEdgeFlagOffsetEXT;this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&TraceTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_trace;}
+if(this->m_ptr_glWindowPos2s){this->m_orig_glWindowPos2s = this->m_ptr_glWindowPos2s;this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&TraceTableDecorator::m_glWindowPos2s_trace;}
+if(this->m_ptr_glSecondaryColor3iEXT){this->m_orig_glSecondaryColor3iEXT = this->m_ptr_glSecondaryColor3iEXT;this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&TraceTableDecorator::m_glSecondaryColor3iEXT_trace;}
+if(this->m_ptr_glWindowPos2i){this->m_orig_glWindowPos2i = this->m_ptr_glWindowPos2i;this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&TraceTableDecorator::m_glWindowPos2i_trace;}
+if(this->m_ptr_glWindowPos2f){this->m_orig_glWindowPos2f = this->m_ptr_glWindowPos2f;this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&TraceTableDecorator::m_glWindowPos2f_trace;}
+if(this->m_ptr_glWindowPos2d){this->m_orig_glWindowPos2d = this->m_ptr_glWindowPos2d;this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&TraceTableDecorator::m_glWindowPos2d_trace;}
+if(this->m_ptr_glUniform4uivEXT){this->m_orig_glUniform4uivEXT = this->m_ptr_glUniform4uivEXT;this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&TraceTableDecorator::m_glUniform4uivEXT_trace;}
+if(this->m_ptr_glOrthoxOES){this->m_orig_glOrthoxOES = this->m_ptr_glOrthoxOES;this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&TraceTableDecorator::m_glOrthoxOES_trace;}
+if(this->m_ptr_glUniformSubroutinesuiv){this->m_orig_glUniformSubroutinesuiv = this->m_ptr_glUniformSubroutinesuiv;this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&TraceTableDecorator::m_glUniformSubroutinesuiv_trace;}
+if(this->m_ptr_glRectdv){this->m_orig_glRectdv = this->m_ptr_glRectdv;this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&TraceTableDecorator::m_glRectdv_trace;}
+if(this->m_ptr_glProgramUniform1i64vNV){this->m_orig_glProgramUniform1i64vNV = this->m_ptr_glProgramUniform1i64vNV;this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&TraceTableDecorator::m_glProgramUniform1i64vNV_trace;}
+if(this->m_ptr_glVertexAttribI4uiEXT){this->m_orig_glVertexAttribI4uiEXT = this->m_ptr_glVertexAttribI4uiEXT;this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&TraceTableDecorator::m_glVertexAttribI4uiEXT_trace;}
+if(this->m_ptr_glSecondaryColor3ubEXT){this->m_orig_glSecondaryColor3ubEXT = this->m_ptr_glSecondaryColor3ubEXT;this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&TraceTableDecorator::m_glSecondaryColor3ubEXT_trace;}
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT){this->m_orig_glCompressedMultiTexSubImage1DEXT = this->m_ptr_glCompressedMultiTexSubImage1DEXT;this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glCompressedMultiTexSubImage1DEXT_trace;}
+if(this->m_ptr_glMultiTexGendEXT){this->m_orig_glMultiTexGendEXT = this->m_ptr_glMultiTexGendEXT;this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&TraceTableDecorator::m_glMultiTexGendEXT_trace;}
+if(this->m_ptr_glColorP3uiv){this->m_orig_glColorP3uiv = this->m_ptr_glColorP3uiv;this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&TraceTableDecorator::m_glColorP3uiv_trace;}
+if(this->m_ptr_glFogCoordfv){this->m_orig_glFogCoordfv = this->m_ptr_glFogCoordfv;this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&TraceTableDecorator::m_glFogCoordfv_trace;}
+if(this->m_ptr_glCompileShader){this->m_orig_glCompileShader = this->m_ptr_glCompileShader;this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&TraceTableDecorator::m_glCompileShader_trace;}
+if(this->m_ptr_glTexCoord2hNV){this->m_orig_glTexCoord2hNV = this->m_ptr_glTexCoord2hNV;this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&TraceTableDecorator::m_glTexCoord2hNV_trace;}
+if(this->m_ptr_glUniform1uivEXT){this->m_orig_glUniform1uivEXT = this->m_ptr_glUniform1uivEXT;this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&TraceTableDecorator::m_glUniform1uivEXT_trace;}
+if(this->m_ptr_glMatrixLoadTransposedEXT){this->m_orig_glMatrixLoadTransposedEXT = this->m_ptr_glMatrixLoadTransposedEXT;this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&TraceTableDecorator::m_glMatrixLoadTransposedEXT_trace;}
+if(this->m_ptr_glIndexfv){this->m_orig_glIndexfv = this->m_ptr_glIndexfv;this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&TraceTableDecorator::m_glIndexfv_trace;}
+if(this->m_ptr_glGetCompressedTextureImage){this->m_orig_glGetCompressedTextureImage = this->m_ptr_glGetCompressedTextureImage;this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&TraceTableDecorator::m_glGetCompressedTextureImage_trace;}
+if(this->m_ptr_glGetUniformuivEXT){this->m_orig_glGetUniformuivEXT = this->m_ptr_glGetUniformuivEXT;this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&TraceTableDecorator::m_glGetUniformuivEXT_trace;}
+if(this->m_ptr_glGetnPixelMapfvARB){this->m_orig_glGetnPixelMapfvARB = this->m_ptr_glGetnPixelMapfvARB;this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&TraceTableDecorator::m_glGetnPixelMapfvARB_trace;}
+if(this->m_ptr_glFramebufferTextureEXT){this->m_orig_glFramebufferTextureEXT = this->m_ptr_glFramebufferTextureEXT;this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&TraceTableDecorator::m_glFramebufferTextureEXT_trace;}
+if(this->m_ptr_glMultiDrawElementsIndirectCount){this->m_orig_glMultiDrawElementsIndirectCount = this->m_ptr_glMultiDrawElementsIndirectCount;this->m_ptr_glMultiDrawElementsIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)&TraceTableDecorator::m_glMultiDrawElementsIndirectCount_trace;}
+if(this->m_ptr_glVertexAttribIPointer){this->m_orig_glVertexAttribIPointer = this->m_ptr_glVertexAttribIPointer;this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&TraceTableDecorator::m_glVertexAttribIPointer_trace;}
+if(this->m_ptr_glMultiTexCoordP3ui){this->m_orig_glMultiTexCoordP3ui = this->m_ptr_glMultiTexCoordP3ui;this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&TraceTableDecorator::m_glMultiTexCoordP3ui_trace;}
+if(this->m_ptr_glEvaluateDepthValuesARB){this->m_orig_glEvaluateDepthValuesARB = this->m_ptr_glEvaluateDepthValuesARB;this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&TraceTableDecorator::m_glEvaluateDepthValuesARB_trace;}
+if(this->m_ptr_glGetNamedBufferParameteriv){this->m_orig_glGetNamedBufferParameteriv = this->m_ptr_glGetNamedBufferParameteriv;this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&TraceTableDecorator::m_glGetNamedBufferParameteriv_trace;}
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT){this->m_orig_glGetNamedProgramLocalParameterfvEXT = this->m_ptr_glGetNamedProgramLocalParameterfvEXT;this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_trace;}
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN){this->m_orig_glColor4fNormal3fVertex3fvSUN = this->m_ptr_glColor4fNormal3fVertex3fvSUN;this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glColor4fNormal3fVertex3fvSUN_trace;}
+if(this->m_ptr_glSeparableFilter2DEXT){this->m_orig_glSeparableFilter2DEXT = this->m_ptr_glSeparableFilter2DEXT;this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&TraceTableDecorator::m_glSeparableFilter2DEXT_trace;}
+if(this->m_ptr_glTexParameterxOES){this->m_orig_glTexParameterxOES = this->m_ptr_glTexParameterxOES;this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&TraceTableDecorator::m_glTexParameterxOES_trace;}
+if(this->m_ptr_glClearAccumxOES){this->m_orig_glClearAccumxOES = this->m_ptr_glClearAccumxOES;this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&TraceTableDecorator::m_glClearAccumxOES_trace;}
+if(this->m_ptr_glInvalidateFramebuffer){this->m_orig_glInvalidateFramebuffer = this->m_ptr_glInvalidateFramebuffer;this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&TraceTableDecorator::m_glInvalidateFramebuffer_trace;}
+if(this->m_ptr_glWeightubvARB){this->m_orig_glWeightubvARB = this->m_ptr_glWeightubvARB;this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&TraceTableDecorator::m_glWeightubvARB_trace;}
+if(this->m_ptr_glVertexAttrib1d){this->m_orig_glVertexAttrib1d = this->m_ptr_glVertexAttrib1d;this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&TraceTableDecorator::m_glVertexAttrib1d_trace;}
+if(this->m_ptr_glVertexAttrib1f){this->m_orig_glVertexAttrib1f = this->m_ptr_glVertexAttrib1f;this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&TraceTableDecorator::m_glVertexAttrib1f_trace;}
+if(this->m_ptr_glVertex4fv){this->m_orig_glVertex4fv = this->m_ptr_glVertex4fv;this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&TraceTableDecorator::m_glVertex4fv_trace;}
+if(this->m_ptr_glClearNamedFramebufferfi){this->m_orig_glClearNamedFramebufferfi = this->m_ptr_glClearNamedFramebufferfi;this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&TraceTableDecorator::m_glClearNamedFramebufferfi_trace;}
+if(this->m_ptr_glGetQueryBufferObjectuiv){this->m_orig_glGetQueryBufferObjectuiv = this->m_ptr_glGetQueryBufferObjectuiv;this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&TraceTableDecorator::m_glGetQueryBufferObjectuiv_trace;}
+if(this->m_ptr_glClearNamedFramebufferfv){this->m_orig_glClearNamedFramebufferfv = this->m_ptr_glClearNamedFramebufferfv;this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&TraceTableDecorator::m_glClearNamedFramebufferfv_trace;}
+if(this->m_ptr_glEndVertexShaderEXT){this->m_orig_glEndVertexShaderEXT = this->m_ptr_glEndVertexShaderEXT;this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&TraceTableDecorator::m_glEndVertexShaderEXT_trace;}
+if(this->m_ptr_glVertexAttrib1s){this->m_orig_glVertexAttrib1s = this->m_ptr_glVertexAttrib1s;this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&TraceTableDecorator::m_glVertexAttrib1s_trace;}
+if(this->m_ptr_glMultiTexCoord4dvARB){this->m_orig_glMultiTexCoord4dvARB = this->m_ptr_glMultiTexCoord4dvARB;this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&TraceTableDecorator::m_glMultiTexCoord4dvARB_trace;}
+if(this->m_ptr_glMultiTexCoord1sv){this->m_orig_glMultiTexCoord1sv = this->m_ptr_glMultiTexCoord1sv;this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&TraceTableDecorator::m_glMultiTexCoord1sv_trace;}
+if(this->m_ptr_glUniform1ui64vNV){this->m_orig_glUniform1ui64vNV = this->m_ptr_glUniform1ui64vNV;this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&TraceTableDecorator::m_glUniform1ui64vNV_trace;}
+if(this->m_ptr_glGetClipPlanefOES){this->m_orig_glGetClipPlanefOES = this->m_ptr_glGetClipPlanefOES;this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&TraceTableDecorator::m_glGetClipPlanefOES_trace;}
+if(this->m_ptr_glRasterPos2s){this->m_orig_glRasterPos2s = this->m_ptr_glRasterPos2s;this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&TraceTableDecorator::m_glRasterPos2s_trace;}
+if(this->m_ptr_glWeightivARB){this->m_orig_glWeightivARB = this->m_ptr_glWeightivARB;this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&TraceTableDecorator::m_glWeightivARB_trace;}
+if(this->m_ptr_glMultiTexCoord4hvNV){this->m_orig_glMultiTexCoord4hvNV = this->m_ptr_glMultiTexCoord4hvNV;this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&TraceTableDecorator::m_glMultiTexCoord4hvNV_trace;}
+if(this->m_ptr_glNormal3hNV){this->m_orig_glNormal3hNV = this->m_ptr_glNormal3hNV;this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&TraceTableDecorator::m_glNormal3hNV_trace;}
+if(this->m_ptr_glGetSeparableFilter){this->m_orig_glGetSeparableFilter = this->m_ptr_glGetSeparableFilter;this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&TraceTableDecorator::m_glGetSeparableFilter_trace;}
+if(this->m_ptr_glGetPathTexGenivNV){this->m_orig_glGetPathTexGenivNV = this->m_ptr_glGetPathTexGenivNV;this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&TraceTableDecorator::m_glGetPathTexGenivNV_trace;}
+if(this->m_ptr_glColor4bv){this->m_orig_glColor4bv = this->m_ptr_glColor4bv;this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&TraceTableDecorator::m_glColor4bv_trace;}
+if(this->m_ptr_glRasterPos2f){this->m_orig_glRasterPos2f = this->m_ptr_glRasterPos2f;this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&TraceTableDecorator::m_glRasterPos2f_trace;}
+if(this->m_ptr_glNamedBufferPageCommitmentARB){this->m_orig_glNamedBufferPageCommitmentARB = this->m_ptr_glNamedBufferPageCommitmentARB;this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&TraceTableDecorator::m_glNamedBufferPageCommitmentARB_trace;}
+if(this->m_ptr_glLoadIdentity){this->m_orig_glLoadIdentity = this->m_ptr_glLoadIdentity;this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&TraceTableDecorator::m_glLoadIdentity_trace;}
+if(this->m_ptr_glRasterPos2i){this->m_orig_glRasterPos2i = this->m_ptr_glRasterPos2i;this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&TraceTableDecorator::m_glRasterPos2i_trace;}
+if(this->m_ptr_glRasterPos4iv){this->m_orig_glRasterPos4iv = this->m_ptr_glRasterPos4iv;this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&TraceTableDecorator::m_glRasterPos4iv_trace;}
+if(this->m_ptr_glMultiTexCoord2fvARB){this->m_orig_glMultiTexCoord2fvARB = this->m_ptr_glMultiTexCoord2fvARB;this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&TraceTableDecorator::m_glMultiTexCoord2fvARB_trace;}
+if(this->m_ptr_glUniformMatrix4x3fv){this->m_orig_glUniformMatrix4x3fv = this->m_ptr_glUniformMatrix4x3fv;this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&TraceTableDecorator::m_glUniformMatrix4x3fv_trace;}
+if(this->m_ptr_glClearBufferfv){this->m_orig_glClearBufferfv = this->m_ptr_glClearBufferfv;this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&TraceTableDecorator::m_glClearBufferfv_trace;}
+if(this->m_ptr_glMultiTexCoord4hNV){this->m_orig_glMultiTexCoord4hNV = this->m_ptr_glMultiTexCoord4hNV;this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&TraceTableDecorator::m_glMultiTexCoord4hNV_trace;}
+if(this->m_ptr_glTextureBarrier){this->m_orig_glTextureBarrier = this->m_ptr_glTextureBarrier;this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&TraceTableDecorator::m_glTextureBarrier_trace;}
+if(this->m_ptr_glReplacementCodeuivSUN){this->m_orig_glReplacementCodeuivSUN = this->m_ptr_glReplacementCodeuivSUN;this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&TraceTableDecorator::m_glReplacementCodeuivSUN_trace;}
+if(this->m_ptr_glDeleteAsyncMarkersSGIX){this->m_orig_glDeleteAsyncMarkersSGIX = this->m_ptr_glDeleteAsyncMarkersSGIX;this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&TraceTableDecorator::m_glDeleteAsyncMarkersSGIX_trace;}
+if(this->m_ptr_glTexCoord2bvOES){this->m_orig_glTexCoord2bvOES = this->m_ptr_glTexCoord2bvOES;this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&TraceTableDecorator::m_glTexCoord2bvOES_trace;}
+if(this->m_ptr_glEvalCoord2xOES){this->m_orig_glEvalCoord2xOES = this->m_ptr_glEvalCoord2xOES;this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&TraceTableDecorator::m_glEvalCoord2xOES_trace;}
+if(this->m_ptr_glGetSharpenTexFuncSGIS){this->m_orig_glGetSharpenTexFuncSGIS = this->m_ptr_glGetSharpenTexFuncSGIS;this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&TraceTableDecorator::m_glGetSharpenTexFuncSGIS_trace;}
+if(this->m_ptr_glProgramUniformHandleui64vNV){this->m_orig_glProgramUniformHandleui64vNV = this->m_ptr_glProgramUniformHandleui64vNV;this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&TraceTableDecorator::m_glProgramUniformHandleui64vNV_trace;}
+if(this->m_ptr_glIglooInterfaceSGIX){this->m_orig_glIglooInterfaceSGIX = this->m_ptr_glIglooInterfaceSGIX;this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&TraceTableDecorator::m_glIglooInterfaceSGIX_trace;}
+if(this->m_ptr_glWindowPos2dvARB){this->m_orig_glWindowPos2dvARB = this->m_ptr_glWindowPos2dvARB;this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&TraceTableDecorator::m_glWindowPos2dvARB_trace;}
+if(this->m_ptr_glClearBufferfi){this->m_orig_glClearBufferfi = this->m_ptr_glClearBufferfi;this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&TraceTableDecorator::m_glClearBufferfi_trace;}
+if(this->m_ptr_glDrawArraysIndirect){this->m_orig_glDrawArraysIndirect = this->m_ptr_glDrawArraysIndirect;this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&TraceTableDecorator::m_glDrawArraysIndirect_trace;}
+if(this->m_ptr_glGenVertexArrays){this->m_orig_glGenVertexArrays = this->m_ptr_glGenVertexArrays;this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&TraceTableDecorator::m_glGenVertexArrays_trace;}
+if(this->m_ptr_glGetTransformFeedbacki64_v){this->m_orig_glGetTransformFeedbacki64_v = this->m_ptr_glGetTransformFeedbacki64_v;this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&TraceTableDecorator::m_glGetTransformFeedbacki64_v_trace;}
+if(this->m_ptr_glEnableVertexArrayAttrib){this->m_orig_glEnableVertexArrayAttrib = this->m_ptr_glEnableVertexArrayAttrib;this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&TraceTableDecorator::m_glEnableVertexArrayAttrib_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x2dv){this->m_orig_glProgramUniformMatrix3x2dv = this->m_ptr_glProgramUniformMatrix3x2dv;this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x2dv_trace;}
+if(this->m_ptr_glVertexStream4fATI){this->m_orig_glVertexStream4fATI = this->m_ptr_glVertexStream4fATI;this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&TraceTableDecorator::m_glVertexStream4fATI_trace;}
+if(this->m_ptr_glVertexBindingDivisor){this->m_orig_glVertexBindingDivisor = this->m_ptr_glVertexBindingDivisor;this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&TraceTableDecorator::m_glVertexBindingDivisor_trace;}
+if(this->m_ptr_glGetSamplerParameterIiv){this->m_orig_glGetSamplerParameterIiv = this->m_ptr_glGetSamplerParameterIiv;this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&TraceTableDecorator::m_glGetSamplerParameterIiv_trace;}
+if(this->m_ptr_glGetCoverageModulationTableNV){this->m_orig_glGetCoverageModulationTableNV = this->m_ptr_glGetCoverageModulationTableNV;this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&TraceTableDecorator::m_glGetCoverageModulationTableNV_trace;}
+if(this->m_ptr_glDepthRangedNV){this->m_orig_glDepthRangedNV = this->m_ptr_glDepthRangedNV;this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&TraceTableDecorator::m_glDepthRangedNV_trace;}
+if(this->m_ptr_glVertexAttrib3f){this->m_orig_glVertexAttrib3f = this->m_ptr_glVertexAttrib3f;this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&TraceTableDecorator::m_glVertexAttrib3f_trace;}
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE){this->m_orig_glMultiDrawRangeElementArrayAPPLE = this->m_ptr_glMultiDrawRangeElementArrayAPPLE;this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&TraceTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_trace;}
+if(this->m_ptr_glVertexAttribFormatNV){this->m_orig_glVertexAttribFormatNV = this->m_ptr_glVertexAttribFormatNV;this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&TraceTableDecorator::m_glVertexAttribFormatNV_trace;}
+if(this->m_ptr_glGetQueryBufferObjecti64v){this->m_orig_glGetQueryBufferObjecti64v = this->m_ptr_glGetQueryBufferObjecti64v;this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&TraceTableDecorator::m_glGetQueryBufferObjecti64v_trace;}
+if(this->m_ptr_glGetVertexAttribdv){this->m_orig_glGetVertexAttribdv = this->m_ptr_glGetVertexAttribdv;this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&TraceTableDecorator::m_glGetVertexAttribdv_trace;}
+if(this->m_ptr_glGetUniformi64vARB){this->m_orig_glGetUniformi64vARB = this->m_ptr_glGetUniformi64vARB;this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&TraceTableDecorator::m_glGetUniformi64vARB_trace;}
+if(this->m_ptr_glAreTexturesResidentEXT){this->m_orig_glAreTexturesResidentEXT = this->m_ptr_glAreTexturesResidentEXT;this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&TraceTableDecorator::m_glAreTexturesResidentEXT_trace;}
+if(this->m_ptr_glGetHandleARB){this->m_orig_glGetHandleARB = this->m_ptr_glGetHandleARB;this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&TraceTableDecorator::m_glGetHandleARB_trace;}
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV){this->m_orig_glVideoCaptureStreamParameterdvNV = this->m_ptr_glVideoCaptureStreamParameterdvNV;this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&TraceTableDecorator::m_glVideoCaptureStreamParameterdvNV_trace;}
+if(this->m_ptr_glMapParameterivNV){this->m_orig_glMapParameterivNV = this->m_ptr_glMapParameterivNV;this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&TraceTableDecorator::m_glMapParameterivNV_trace;}
+if(this->m_ptr_glIsVertexArray){this->m_orig_glIsVertexArray = this->m_ptr_glIsVertexArray;this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&TraceTableDecorator::m_glIsVertexArray_trace;}
+if(this->m_ptr_glSecondaryColor3sEXT){this->m_orig_glSecondaryColor3sEXT = this->m_ptr_glSecondaryColor3sEXT;this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&TraceTableDecorator::m_glSecondaryColor3sEXT_trace;}
+if(this->m_ptr_glGetTexParameterIivEXT){this->m_orig_glGetTexParameterIivEXT = this->m_ptr_glGetTexParameterIivEXT;this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glGetTexParameterIivEXT_trace;}
+if(this->m_ptr_glFrameTerminatorGREMEDY){this->m_orig_glFrameTerminatorGREMEDY = this->m_ptr_glFrameTerminatorGREMEDY;this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&TraceTableDecorator::m_glFrameTerminatorGREMEDY_trace;}
+if(this->m_ptr_glBlendBarrierKHR){this->m_orig_glBlendBarrierKHR = this->m_ptr_glBlendBarrierKHR;this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&TraceTableDecorator::m_glBlendBarrierKHR_trace;}
+if(this->m_ptr_glVertexAttrib4NubARB){this->m_orig_glVertexAttrib4NubARB = this->m_ptr_glVertexAttrib4NubARB;this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&TraceTableDecorator::m_glVertexAttrib4NubARB_trace;}
+if(this->m_ptr_glPrimitiveRestartNV){this->m_orig_glPrimitiveRestartNV = this->m_ptr_glPrimitiveRestartNV;this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&TraceTableDecorator::m_glPrimitiveRestartNV_trace;}
+if(this->m_ptr_glVertexAttribL1ui64vARB){this->m_orig_glVertexAttribL1ui64vARB = this->m_ptr_glVertexAttribL1ui64vARB;this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&TraceTableDecorator::m_glVertexAttribL1ui64vARB_trace;}
+if(this->m_ptr_glVertexAttribI4ivEXT){this->m_orig_glVertexAttribI4ivEXT = this->m_ptr_glVertexAttribI4ivEXT;this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&TraceTableDecorator::m_glVertexAttribI4ivEXT_trace;}
+if(this->m_ptr_glVertexAttribs4svNV){this->m_orig_glVertexAttribs4svNV = this->m_ptr_glVertexAttribs4svNV;this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&TraceTableDecorator::m_glVertexAttribs4svNV_trace;}
+if(this->m_ptr_glUniform1ui){this->m_orig_glUniform1ui = this->m_ptr_glUniform1ui;this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&TraceTableDecorator::m_glUniform1ui_trace;}
+if(this->m_ptr_glVertexAttrib2fvARB){this->m_orig_glVertexAttrib2fvARB = this->m_ptr_glVertexAttrib2fvARB;this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&TraceTableDecorator::m_glVertexAttrib2fvARB_trace;}
+if(this->m_ptr_glVertexAttribI4svEXT){this->m_orig_glVertexAttribI4svEXT = this->m_ptr_glVertexAttribI4svEXT;this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&TraceTableDecorator::m_glVertexAttribI4svEXT_trace;}
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV){this->m_orig_glTextureImage3DMultisampleCoverageNV = this->m_ptr_glTextureImage3DMultisampleCoverageNV;this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&TraceTableDecorator::m_glTextureImage3DMultisampleCoverageNV_trace;}
+if(this->m_ptr_glMemoryBarrier){this->m_orig_glMemoryBarrier = this->m_ptr_glMemoryBarrier;this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&TraceTableDecorator::m_glMemoryBarrier_trace;}
+if(this->m_ptr_glGetVariantArrayObjectfvATI){this->m_orig_glGetVariantArrayObjectfvATI = this->m_ptr_glGetVariantArrayObjectfvATI;this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&TraceTableDecorator::m_glGetVariantArrayObjectfvATI_trace;}
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN){this->m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN;this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&TraceTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_trace;}
+if(this->m_ptr_glIsProgramARB){this->m_orig_glIsProgramARB = this->m_ptr_glIsProgramARB;this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&TraceTableDecorator::m_glIsProgramARB_trace;}
+if(this->m_ptr_glBindImageTextureEXT){this->m_orig_glBindImageTextureEXT = this->m_ptr_glBindImageTextureEXT;this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&TraceTableDecorator::m_glBindImageTextureEXT_trace;}
+if(this->m_ptr_glGetFragDataLocation){this->m_orig_glGetFragDataLocation = this->m_ptr_glGetFragDataLocation;this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&TraceTableDecorator::m_glGetFragDataLocation_trace;}
+if(this->m_ptr_glMultiTexCoord1svARB){this->m_orig_glMultiTexCoord1svARB = this->m_ptr_glMultiTexCoord1svARB;this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&TraceTableDecorator::m_glMultiTexCoord1svARB_trace;}
+if(this->m_ptr_glGetMapxvOES){this->m_orig_glGetMapxvOES = this->m_ptr_glGetMapxvOES;this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&TraceTableDecorator::m_glGetMapxvOES_trace;}
+if(this->m_ptr_glTextureStorage2DMultisampleEXT){this->m_orig_glTextureStorage2DMultisampleEXT = this->m_ptr_glTextureStorage2DMultisampleEXT;this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glTextureStorage2DMultisampleEXT_trace;}
+if(this->m_ptr_glGetMaterialfv){this->m_orig_glGetMaterialfv = this->m_ptr_glGetMaterialfv;this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&TraceTableDecorator::m_glGetMaterialfv_trace;}
+if(this->m_ptr_glVertexAttrib4NbvARB){this->m_orig_glVertexAttrib4NbvARB = this->m_ptr_glVertexAttrib4NbvARB;this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&TraceTableDecorator::m_glVertexAttrib4NbvARB_trace;}
+if(this->m_ptr_glPixelMapuiv){this->m_orig_glPixelMapuiv = this->m_ptr_glPixelMapuiv;this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&TraceTableDecorator::m_glPixelMapuiv_trace;}
+if(this->m_ptr_glColorPointerEXT){this->m_orig_glColorPointerEXT = this->m_ptr_glColorPointerEXT;this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&TraceTableDecorator::m_glColorPointerEXT_trace;}
+if(this->m_ptr_glEnableClientStateiEXT){this->m_orig_glEnableClientStateiEXT = this->m_ptr_glEnableClientStateiEXT;this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&TraceTableDecorator::m_glEnableClientStateiEXT_trace;}
+if(this->m_ptr_glClearTexSubImage){this->m_orig_glClearTexSubImage = this->m_ptr_glClearTexSubImage;this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&TraceTableDecorator::m_glClearTexSubImage_trace;}
+if(this->m_ptr_glEvalCoord1xvOES){this->m_orig_glEvalCoord1xvOES = this->m_ptr_glEvalCoord1xvOES;this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&TraceTableDecorator::m_glEvalCoord1xvOES_trace;}
+if(this->m_ptr_glDetachObjectARB){this->m_orig_glDetachObjectARB = this->m_ptr_glDetachObjectARB;this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&TraceTableDecorator::m_glDetachObjectARB_trace;}
+if(this->m_ptr_glGetTextureParameterIiv){this->m_orig_glGetTextureParameterIiv = this->m_ptr_glGetTextureParameterIiv;this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&TraceTableDecorator::m_glGetTextureParameterIiv_trace;}
+if(this->m_ptr_glVariantusvEXT){this->m_orig_glVariantusvEXT = this->m_ptr_glVariantusvEXT;this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&TraceTableDecorator::m_glVariantusvEXT_trace;}
+if(this->m_ptr_glCompressedTextureImage3DEXT){this->m_orig_glCompressedTextureImage3DEXT = this->m_ptr_glCompressedTextureImage3DEXT;this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&TraceTableDecorator::m_glCompressedTextureImage3DEXT_trace;}
+if(this->m_ptr_glMultiTexCoord1dARB){this->m_orig_glMultiTexCoord1dARB = this->m_ptr_glMultiTexCoord1dARB;this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&TraceTableDecorator::m_glMultiTexCoord1dARB_trace;}
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT){this->m_orig_glGetVertexArrayIntegeri_vEXT = this->m_ptr_glGetVertexArrayIntegeri_vEXT;this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&TraceTableDecorator::m_glGetVertexArrayIntegeri_vEXT_trace;}
+if(this->m_ptr_glVertexAttribI4ubv){this->m_orig_glVertexAttribI4ubv = this->m_ptr_glVertexAttribI4ubv;this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&TraceTableDecorator::m_glVertexAttribI4ubv_trace;}
+if(this->m_ptr_glPixelTexGenParameterfSGIS){this->m_orig_glPixelTexGenParameterfSGIS = this->m_ptr_glPixelTexGenParameterfSGIS;this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&TraceTableDecorator::m_glPixelTexGenParameterfSGIS_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x2dv){this->m_orig_glProgramUniformMatrix4x2dv = this->m_ptr_glProgramUniformMatrix4x2dv;this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x2dv_trace;}
+if(this->m_ptr_glUniform3fARB){this->m_orig_glUniform3fARB = this->m_ptr_glUniform3fARB;this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&TraceTableDecorator::m_glUniform3fARB_trace;}
+if(this->m_ptr_glIsShader){this->m_orig_glIsShader = this->m_ptr_glIsShader;this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&TraceTableDecorator::m_glIsShader_trace;}
+if(this->m_ptr_glConvolutionParameteriv){this->m_orig_glConvolutionParameteriv = this->m_ptr_glConvolutionParameteriv;this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&TraceTableDecorator::m_glConvolutionParameteriv_trace;}
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT){this->m_orig_glCopyMultiTexSubImage2DEXT = this->m_ptr_glCopyMultiTexSubImage2DEXT;this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glCopyMultiTexSubImage2DEXT_trace;}
+if(this->m_ptr_glEnableVertexAttribArrayARB){this->m_orig_glEnableVertexAttribArrayARB = this->m_ptr_glEnableVertexAttribArrayARB;this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&TraceTableDecorator::m_glEnableVertexAttribArrayARB_trace;}
+if(this->m_ptr_glMulticastCopyBufferSubDataNV){this->m_orig_glMulticastCopyBufferSubDataNV = this->m_ptr_glMulticastCopyBufferSubDataNV;this->m_ptr_glMulticastCopyBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)&TraceTableDecorator::m_glMulticastCopyBufferSubDataNV_trace;}
+if(this->m_ptr_glEnable){this->m_orig_glEnable = this->m_ptr_glEnable;this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&TraceTableDecorator::m_glEnable_trace;}
+if(this->m_ptr_glGetActiveUniformsiv){this->m_orig_glGetActiveUniformsiv = this->m_ptr_glGetActiveUniformsiv;this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&TraceTableDecorator::m_glGetActiveUniformsiv_trace;}
+if(this->m_ptr_glGetVertexAttribivARB){this->m_orig_glGetVertexAttribivARB = this->m_ptr_glGetVertexAttribivARB;this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&TraceTableDecorator::m_glGetVertexAttribivARB_trace;}
+if(this->m_ptr_glTexCoord4hvNV){this->m_orig_glTexCoord4hvNV = this->m_ptr_glTexCoord4hvNV;this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&TraceTableDecorator::m_glTexCoord4hvNV_trace;}
+if(this->m_ptr_glUseProgramObjectARB){this->m_orig_glUseProgramObjectARB = this->m_ptr_glUseProgramObjectARB;this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&TraceTableDecorator::m_glUseProgramObjectARB_trace;}
+if(this->m_ptr_glGetAttribLocation){this->m_orig_glGetAttribLocation = this->m_ptr_glGetAttribLocation;this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&TraceTableDecorator::m_glGetAttribLocation_trace;}
+if(this->m_ptr_glVertexAttrib4dv){this->m_orig_glVertexAttrib4dv = this->m_ptr_glVertexAttrib4dv;this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&TraceTableDecorator::m_glVertexAttrib4dv_trace;}
+if(this->m_ptr_glGetTextureParameteriv){this->m_orig_glGetTextureParameteriv = this->m_ptr_glGetTextureParameteriv;this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&TraceTableDecorator::m_glGetTextureParameteriv_trace;}
+if(this->m_ptr_glNamedBufferStorageMemEXT){this->m_orig_glNamedBufferStorageMemEXT = this->m_ptr_glNamedBufferStorageMemEXT;this->m_ptr_glNamedBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)&TraceTableDecorator::m_glNamedBufferStorageMemEXT_trace;}
+if(this->m_ptr_glPathSubCoordsNV){this->m_orig_glPathSubCoordsNV = this->m_ptr_glPathSubCoordsNV;this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&TraceTableDecorator::m_glPathSubCoordsNV_trace;}
+if(this->m_ptr_glMatrixIndexusvARB){this->m_orig_glMatrixIndexusvARB = this->m_ptr_glMatrixIndexusvARB;this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&TraceTableDecorator::m_glMatrixIndexusvARB_trace;}
+if(this->m_ptr_glGetVideouivNV){this->m_orig_glGetVideouivNV = this->m_ptr_glGetVideouivNV;this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&TraceTableDecorator::m_glGetVideouivNV_trace;}
+if(this->m_ptr_glGetVideoCaptureivNV){this->m_orig_glGetVideoCaptureivNV = this->m_ptr_glGetVideoCaptureivNV;this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&TraceTableDecorator::m_glGetVideoCaptureivNV_trace;}
+if(this->m_ptr_glProgramUniform3ui){this->m_orig_glProgramUniform3ui = this->m_ptr_glProgramUniform3ui;this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&TraceTableDecorator::m_glProgramUniform3ui_trace;}
+if(this->m_ptr_glVertexAttrib3svARB){this->m_orig_glVertexAttrib3svARB = this->m_ptr_glVertexAttrib3svARB;this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&TraceTableDecorator::m_glVertexAttrib3svARB_trace;}
+if(this->m_ptr_glGetNamedBufferParameterivEXT){this->m_orig_glGetNamedBufferParameterivEXT = this->m_ptr_glGetNamedBufferParameterivEXT;this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetNamedBufferParameterivEXT_trace;}
+if(this->m_ptr_glMatrixScaledEXT){this->m_orig_glMatrixScaledEXT = this->m_ptr_glMatrixScaledEXT;this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&TraceTableDecorator::m_glMatrixScaledEXT_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x3fv){this->m_orig_glProgramUniformMatrix2x3fv = this->m_ptr_glProgramUniformMatrix2x3fv;this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x3fv_trace;}
+if(this->m_ptr_glGetFragmentLightivSGIX){this->m_orig_glGetFragmentLightivSGIX = this->m_ptr_glGetFragmentLightivSGIX;this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&TraceTableDecorator::m_glGetFragmentLightivSGIX_trace;}
+if(this->m_ptr_glGetStringi){this->m_orig_glGetStringi = this->m_ptr_glGetStringi;this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&TraceTableDecorator::m_glGetStringi_trace;}
+if(this->m_ptr_glWindowPos2svARB){this->m_orig_glWindowPos2svARB = this->m_ptr_glWindowPos2svARB;this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&TraceTableDecorator::m_glWindowPos2svARB_trace;}
+if(this->m_ptr_glVertexAttrib2svNV){this->m_orig_glVertexAttrib2svNV = this->m_ptr_glVertexAttrib2svNV;this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&TraceTableDecorator::m_glVertexAttrib2svNV_trace;}
+if(this->m_ptr_glWindowPos2ivARB){this->m_orig_glWindowPos2ivARB = this->m_ptr_glWindowPos2ivARB;this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&TraceTableDecorator::m_glWindowPos2ivARB_trace;}
+if(this->m_ptr_glGetVertexAttribPointervNV){this->m_orig_glGetVertexAttribPointervNV = this->m_ptr_glGetVertexAttribPointervNV;this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&TraceTableDecorator::m_glGetVertexAttribPointervNV_trace;}
+if(this->m_ptr_glPushMatrix){this->m_orig_glPushMatrix = this->m_ptr_glPushMatrix;this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&TraceTableDecorator::m_glPushMatrix_trace;}
+if(this->m_ptr_glEdgeFlagPointerListIBM){this->m_orig_glEdgeFlagPointerListIBM = this->m_ptr_glEdgeFlagPointerListIBM;this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&TraceTableDecorator::m_glEdgeFlagPointerListIBM_trace;}
+if(this->m_ptr_glGenerateMipmapEXT){this->m_orig_glGenerateMipmapEXT = this->m_ptr_glGenerateMipmapEXT;this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&TraceTableDecorator::m_glGenerateMipmapEXT_trace;}
+if(this->m_ptr_glWindowPos3sv){this->m_orig_glWindowPos3sv = this->m_ptr_glWindowPos3sv;this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&TraceTableDecorator::m_glWindowPos3sv_trace;}
+if(this->m_ptr_glPathCoordsNV){this->m_orig_glPathCoordsNV = this->m_ptr_glPathCoordsNV;this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&TraceTableDecorator::m_glPathCoordsNV_trace;}
+if(this->m_ptr_glProgramUniform1i){this->m_orig_glProgramUniform1i = this->m_ptr_glProgramUniform1i;this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&TraceTableDecorator::m_glProgramUniform1i_trace;}
+if(this->m_ptr_glProgramUniform1d){this->m_orig_glProgramUniform1d = this->m_ptr_glProgramUniform1d;this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&TraceTableDecorator::m_glProgramUniform1d_trace;}
+if(this->m_ptr_glProgramUniform1f){this->m_orig_glProgramUniform1f = this->m_ptr_glProgramUniform1f;this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&TraceTableDecorator::m_glProgramUniform1f_trace;}
+if(this->m_ptr_glProgramParameteriEXT){this->m_orig_glProgramParameteriEXT = this->m_ptr_glProgramParameteriEXT;this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&TraceTableDecorator::m_glProgramParameteriEXT_trace;}
+if(this->m_ptr_glCompressedMultiTexImage2DEXT){this->m_orig_glCompressedMultiTexImage2DEXT = this->m_ptr_glCompressedMultiTexImage2DEXT;this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&TraceTableDecorator::m_glCompressedMultiTexImage2DEXT_trace;}
+if(this->m_ptr_glProgramUniform3iv){this->m_orig_glProgramUniform3iv = this->m_ptr_glProgramUniform3iv;this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&TraceTableDecorator::m_glProgramUniform3iv_trace;}
+if(this->m_ptr_glIndexiv){this->m_orig_glIndexiv = this->m_ptr_glIndexiv;this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&TraceTableDecorator::m_glIndexiv_trace;}
+if(this->m_ptr_glMultiTexCoord4xvOES){this->m_orig_glMultiTexCoord4xvOES = this->m_ptr_glMultiTexCoord4xvOES;this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&TraceTableDecorator::m_glMultiTexCoord4xvOES_trace;}
+if(this->m_ptr_glEGLImageTargetTexture2DOES){this->m_orig_glEGLImageTargetTexture2DOES = this->m_ptr_glEGLImageTargetTexture2DOES;this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&TraceTableDecorator::m_glEGLImageTargetTexture2DOES_trace;}
+if(this->m_ptr_glPixelZoom){this->m_orig_glPixelZoom = this->m_ptr_glPixelZoom;this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&TraceTableDecorator::m_glPixelZoom_trace;}
+if(this->m_ptr_glVertex3bvOES){this->m_orig_glVertex3bvOES = this->m_ptr_glVertex3bvOES;this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&TraceTableDecorator::m_glVertex3bvOES_trace;}
+if(this->m_ptr_glFramebufferReadBufferEXT){this->m_orig_glFramebufferReadBufferEXT = this->m_ptr_glFramebufferReadBufferEXT;this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&TraceTableDecorator::m_glFramebufferReadBufferEXT_trace;}
+if(this->m_ptr_glExtractComponentEXT){this->m_orig_glExtractComponentEXT = this->m_ptr_glExtractComponentEXT;this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&TraceTableDecorator::m_glExtractComponentEXT_trace;}
+if(this->m_ptr_glCombinerParameterivNV){this->m_orig_glCombinerParameterivNV = this->m_ptr_glCombinerParameterivNV;this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&TraceTableDecorator::m_glCombinerParameterivNV_trace;}
+if(this->m_ptr_glMinmax){this->m_orig_glMinmax = this->m_ptr_glMinmax;this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&TraceTableDecorator::m_glMinmax_trace;}
+if(this->m_ptr_glColorP3ui){this->m_orig_glColorP3ui = this->m_ptr_glColorP3ui;this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&TraceTableDecorator::m_glColorP3ui_trace;}
+if(this->m_ptr_glPointParameterfvSGIS){this->m_orig_glPointParameterfvSGIS = this->m_ptr_glPointParameterfvSGIS;this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&TraceTableDecorator::m_glPointParameterfvSGIS_trace;}
+if(this->m_ptr_glBlendEquationi){this->m_orig_glBlendEquationi = this->m_ptr_glBlendEquationi;this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&TraceTableDecorator::m_glBlendEquationi_trace;}
+if(this->m_ptr_glGetFogFuncSGIS){this->m_orig_glGetFogFuncSGIS = this->m_ptr_glGetFogFuncSGIS;this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&TraceTableDecorator::m_glGetFogFuncSGIS_trace;}
+if(this->m_ptr_glVertexAttrib4fvNV){this->m_orig_glVertexAttrib4fvNV = this->m_ptr_glVertexAttrib4fvNV;this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&TraceTableDecorator::m_glVertexAttrib4fvNV_trace;}
+if(this->m_ptr_glGetnMinmax){this->m_orig_glGetnMinmax = this->m_ptr_glGetnMinmax;this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&TraceTableDecorator::m_glGetnMinmax_trace;}
+if(this->m_ptr_glFragmentLightiSGIX){this->m_orig_glFragmentLightiSGIX = this->m_ptr_glFragmentLightiSGIX;this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&TraceTableDecorator::m_glFragmentLightiSGIX_trace;}
+if(this->m_ptr_glMultiTexCoord1bvOES){this->m_orig_glMultiTexCoord1bvOES = this->m_ptr_glMultiTexCoord1bvOES;this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&TraceTableDecorator::m_glMultiTexCoord1bvOES_trace;}
+if(this->m_ptr_glSecondaryColorPointerEXT){this->m_orig_glSecondaryColorPointerEXT = this->m_ptr_glSecondaryColorPointerEXT;this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&TraceTableDecorator::m_glSecondaryColorPointerEXT_trace;}
+if(this->m_ptr_glMultiTexCoordP4uiv){this->m_orig_glMultiTexCoordP4uiv = this->m_ptr_glMultiTexCoordP4uiv;this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&TraceTableDecorator::m_glMultiTexCoordP4uiv_trace;}
+if(this->m_ptr_glGetBufferSubDataARB){this->m_orig_glGetBufferSubDataARB = this->m_ptr_glGetBufferSubDataARB;this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&TraceTableDecorator::m_glGetBufferSubDataARB_trace;}
+if(this->m_ptr_glSecondaryColor3hNV){this->m_orig_glSecondaryColor3hNV = this->m_ptr_glSecondaryColor3hNV;this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&TraceTableDecorator::m_glSecondaryColor3hNV_trace;}
+if(this->m_ptr_glGetPathParameterivNV){this->m_orig_glGetPathParameterivNV = this->m_ptr_glGetPathParameterivNV;this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&TraceTableDecorator::m_glGetPathParameterivNV_trace;}
+if(this->m_ptr_glFlushRasterSGIX){this->m_orig_glFlushRasterSGIX = this->m_ptr_glFlushRasterSGIX;this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&TraceTableDecorator::m_glFlushRasterSGIX_trace;}
+if(this->m_ptr_glElementPointerATI){this->m_orig_glElementPointerATI = this->m_ptr_glElementPointerATI;this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&TraceTableDecorator::m_glElementPointerATI_trace;}
+if(this->m_ptr_glGetAttachedObjectsARB){this->m_orig_glGetAttachedObjectsARB = this->m_ptr_glGetAttachedObjectsARB;this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&TraceTableDecorator::m_glGetAttachedObjectsARB_trace;}
+if(this->m_ptr_glUniform4iv){this->m_orig_glUniform4iv = this->m_ptr_glUniform4iv;this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&TraceTableDecorator::m_glUniform4iv_trace;}
+if(this->m_ptr_glFogxOES){this->m_orig_glFogxOES = this->m_ptr_glFogxOES;this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&TraceTableDecorator::m_glFogxOES_trace;}
+if(this->m_ptr_glSharpenTexFuncSGIS){this->m_orig_glSharpenTexFuncSGIS = this->m_ptr_glSharpenTexFuncSGIS;this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&TraceTableDecorator::m_glSharpenTexFuncSGIS_trace;}
+if(this->m_ptr_glClearDepthfOES){this->m_orig_glClearDepthfOES = this->m_ptr_glClearDepthfOES;this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&TraceTableDecorator::m_glClearDepthfOES_trace;}
+if(this->m_ptr_glDeleteCommandListsNV){this->m_orig_glDeleteCommandListsNV = this->m_ptr_glDeleteCommandListsNV;this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&TraceTableDecorator::m_glDeleteCommandListsNV_trace;}
+if(this->m_ptr_glSpecializeShader){this->m_orig_glSpecializeShader = this->m_ptr_glSpecializeShader;this->m_ptr_glSpecializeShader = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC)&TraceTableDecorator::m_glSpecializeShader_trace;}
+if(this->m_ptr_glVertex4hNV){this->m_orig_glVertex4hNV = this->m_ptr_glVertex4hNV;this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&TraceTableDecorator::m_glVertex4hNV_trace;}
+if(this->m_ptr_glSecondaryColor3dvEXT){this->m_orig_glSecondaryColor3dvEXT = this->m_ptr_glSecondaryColor3dvEXT;this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3dvEXT_trace;}
+if(this->m_ptr_glGenTextures){this->m_orig_glGenTextures = this->m_ptr_glGenTextures;this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&TraceTableDecorator::m_glGenTextures_trace;}
+if(this->m_ptr_glTextureStorage2DMultisample){this->m_orig_glTextureStorage2DMultisample = this->m_ptr_glTextureStorage2DMultisample;this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&TraceTableDecorator::m_glTextureStorage2DMultisample_trace;}
+if(this->m_ptr_glUniform3ui64vNV){this->m_orig_glUniform3ui64vNV = this->m_ptr_glUniform3ui64vNV;this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&TraceTableDecorator::m_glUniform3ui64vNV_trace;}
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD){this->m_orig_glBlendFuncSeparateIndexedAMD = this->m_ptr_glBlendFuncSeparateIndexedAMD;this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&TraceTableDecorator::m_glBlendFuncSeparateIndexedAMD_trace;}
+if(this->m_ptr_glMakeBufferResidentNV){this->m_orig_glMakeBufferResidentNV = this->m_ptr_glMakeBufferResidentNV;this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&TraceTableDecorator::m_glMakeBufferResidentNV_trace;}
+if(this->m_ptr_glShaderOp2EXT){this->m_orig_glShaderOp2EXT = this->m_ptr_glShaderOp2EXT;this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&TraceTableDecorator::m_glShaderOp2EXT_trace;}
+if(this->m_ptr_glGetVertexAttribivNV){this->m_orig_glGetVertexAttribivNV = this->m_ptr_glGetVertexAttribivNV;this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&TraceTableDecorator::m_glGetVertexAttribivNV_trace;}
+if(this->m_ptr_glTexParameterIivEXT){this->m_orig_glTexParameterIivEXT = this->m_ptr_glTexParameterIivEXT;this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glTexParameterIivEXT_trace;}
+if(this->m_ptr_glGetPerfQueryDataINTEL){this->m_orig_glGetPerfQueryDataINTEL = this->m_ptr_glGetPerfQueryDataINTEL;this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&TraceTableDecorator::m_glGetPerfQueryDataINTEL_trace;}
+if(this->m_ptr_glVertexAttrib4dvARB){this->m_orig_glVertexAttrib4dvARB = this->m_ptr_glVertexAttrib4dvARB;this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&TraceTableDecorator::m_glVertexAttrib4dvARB_trace;}
+if(this->m_ptr_glTextureSubImage1DEXT){this->m_orig_glTextureSubImage1DEXT = this->m_ptr_glTextureSubImage1DEXT;this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glTextureSubImage1DEXT_trace;}
+if(this->m_ptr_glGetActiveUniformBlockName){this->m_orig_glGetActiveUniformBlockName = this->m_ptr_glGetActiveUniformBlockName;this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&TraceTableDecorator::m_glGetActiveUniformBlockName_trace;}
+if(this->m_ptr_glVertexAttrib2dvARB){this->m_orig_glVertexAttrib2dvARB = this->m_ptr_glVertexAttrib2dvARB;this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&TraceTableDecorator::m_glVertexAttrib2dvARB_trace;}
+if(this->m_ptr_glVertexAttribPointer){this->m_orig_glVertexAttribPointer = this->m_ptr_glVertexAttribPointer;this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&TraceTableDecorator::m_glVertexAttribPointer_trace;}
+if(this->m_ptr_glDepthBoundsdNV){this->m_orig_glDepthBoundsdNV = this->m_ptr_glDepthBoundsdNV;this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&TraceTableDecorator::m_glDepthBoundsdNV_trace;}
+if(this->m_ptr_glDeleteTexturesEXT){this->m_orig_glDeleteTexturesEXT = this->m_ptr_glDeleteTexturesEXT;this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&TraceTableDecorator::m_glDeleteTexturesEXT_trace;}
+if(this->m_ptr_glDrawBuffersATI){this->m_orig_glDrawBuffersATI = this->m_ptr_glDrawBuffersATI;this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&TraceTableDecorator::m_glDrawBuffersATI_trace;}
+if(this->m_ptr_glLightModelxvOES){this->m_orig_glLightModelxvOES = this->m_ptr_glLightModelxvOES;this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&TraceTableDecorator::m_glLightModelxvOES_trace;}
+if(this->m_ptr_glApplyTextureEXT){this->m_orig_glApplyTextureEXT = this->m_ptr_glApplyTextureEXT;this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&TraceTableDecorator::m_glApplyTextureEXT_trace;}
+if(this->m_ptr_glGetImageHandleNV){this->m_orig_glGetImageHandleNV = this->m_ptr_glGetImageHandleNV;this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&TraceTableDecorator::m_glGetImageHandleNV_trace;}
+if(this->m_ptr_glGetMinmax){this->m_orig_glGetMinmax = this->m_ptr_glGetMinmax;this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&TraceTableDecorator::m_glGetMinmax_trace;}
+if(this->m_ptr_glGetFixedvOES){this->m_orig_glGetFixedvOES = this->m_ptr_glGetFixedvOES;this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&TraceTableDecorator::m_glGetFixedvOES_trace;}
+if(this->m_ptr_glSamplePatternEXT){this->m_orig_glSamplePatternEXT = this->m_ptr_glSamplePatternEXT;this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&TraceTableDecorator::m_glSamplePatternEXT_trace;}
+if(this->m_ptr_glUniform1f){this->m_orig_glUniform1f = this->m_ptr_glUniform1f;this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&TraceTableDecorator::m_glUniform1f_trace;}
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN){this->m_orig_glColor4fNormal3fVertex3fSUN = this->m_ptr_glColor4fNormal3fVertex3fSUN;this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glColor4fNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glFogCoorddvEXT){this->m_orig_glFogCoorddvEXT = this->m_ptr_glFogCoorddvEXT;this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&TraceTableDecorator::m_glFogCoorddvEXT_trace;}
+if(this->m_ptr_glCopyTextureImage1DEXT){this->m_orig_glCopyTextureImage1DEXT = this->m_ptr_glCopyTextureImage1DEXT;this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&TraceTableDecorator::m_glCopyTextureImage1DEXT_trace;}
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE){this->m_orig_glFlushMappedBufferRangeAPPLE = this->m_ptr_glFlushMappedBufferRangeAPPLE;this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&TraceTableDecorator::m_glFlushMappedBufferRangeAPPLE_trace;}
+if(this->m_ptr_glVertex3sv){this->m_orig_glVertex3sv = this->m_ptr_glVertex3sv;this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&TraceTableDecorator::m_glVertex3sv_trace;}
+if(this->m_ptr_glFlushStaticDataIBM){this->m_orig_glFlushStaticDataIBM = this->m_ptr_glFlushStaticDataIBM;this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&TraceTableDecorator::m_glFlushStaticDataIBM_trace;}
+if(this->m_ptr_glProgramUniform4ui64NV){this->m_orig_glProgramUniform4ui64NV = this->m_ptr_glProgramUniform4ui64NV;this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&TraceTableDecorator::m_glProgramUniform4ui64NV_trace;}
+if(this->m_ptr_glRasterPos4xOES){this->m_orig_glRasterPos4xOES = this->m_ptr_glRasterPos4xOES;this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&TraceTableDecorator::m_glRasterPos4xOES_trace;}
+if(this->m_ptr_glVertexAttribP1ui){this->m_orig_glVertexAttribP1ui = this->m_ptr_glVertexAttribP1ui;this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&TraceTableDecorator::m_glVertexAttribP1ui_trace;}
+if(this->m_ptr_glProgramUniform4dvEXT){this->m_orig_glProgramUniform4dvEXT = this->m_ptr_glProgramUniform4dvEXT;this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&TraceTableDecorator::m_glProgramUniform4dvEXT_trace;}
+if(this->m_ptr_glEndTransformFeedbackEXT){this->m_orig_glEndTransformFeedbackEXT = this->m_ptr_glEndTransformFeedbackEXT;this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&TraceTableDecorator::m_glEndTransformFeedbackEXT_trace;}
+if(this->m_ptr_glBinormal3dEXT){this->m_orig_glBinormal3dEXT = this->m_ptr_glBinormal3dEXT;this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&TraceTableDecorator::m_glBinormal3dEXT_trace;}
+if(this->m_ptr_glGetTextureSubImage){this->m_orig_glGetTextureSubImage = this->m_ptr_glGetTextureSubImage;this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&TraceTableDecorator::m_glGetTextureSubImage_trace;}
+if(this->m_ptr_glGetNamedRenderbufferParameteriv){this->m_orig_glGetNamedRenderbufferParameteriv = this->m_ptr_glGetNamedRenderbufferParameteriv;this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&TraceTableDecorator::m_glGetNamedRenderbufferParameteriv_trace;}
+if(this->m_ptr_glBindBuffersRange){this->m_orig_glBindBuffersRange = this->m_ptr_glBindBuffersRange;this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&TraceTableDecorator::m_glBindBuffersRange_trace;}
+if(this->m_ptr_glFinishAsyncSGIX){this->m_orig_glFinishAsyncSGIX = this->m_ptr_glFinishAsyncSGIX;this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&TraceTableDecorator::m_glFinishAsyncSGIX_trace;}
+if(this->m_ptr_glBindFragDataLocationIndexed){this->m_orig_glBindFragDataLocationIndexed = this->m_ptr_glBindFragDataLocationIndexed;this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&TraceTableDecorator::m_glBindFragDataLocationIndexed_trace;}
+if(this->m_ptr_glMultiTexCoord2dv){this->m_orig_glMultiTexCoord2dv = this->m_ptr_glMultiTexCoord2dv;this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&TraceTableDecorator::m_glMultiTexCoord2dv_trace;}
+if(this->m_ptr_glUniform2iv){this->m_orig_glUniform2iv = this->m_ptr_glUniform2iv;this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&TraceTableDecorator::m_glUniform2iv_trace;}
+if(this->m_ptr_glProgramUniform2i64vNV){this->m_orig_glProgramUniform2i64vNV = this->m_ptr_glProgramUniform2i64vNV;this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&TraceTableDecorator::m_glProgramUniform2i64vNV_trace;}
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE){this->m_orig_glFlushVertexArrayRangeAPPLE = this->m_ptr_glFlushVertexArrayRangeAPPLE;this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&TraceTableDecorator::m_glFlushVertexArrayRangeAPPLE_trace;}
+if(this->m_ptr_glTextureParameterf){this->m_orig_glTextureParameterf = this->m_ptr_glTextureParameterf;this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&TraceTableDecorator::m_glTextureParameterf_trace;}
+if(this->m_ptr_glMultiTexCoord3dvARB){this->m_orig_glMultiTexCoord3dvARB = this->m_ptr_glMultiTexCoord3dvARB;this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&TraceTableDecorator::m_glMultiTexCoord3dvARB_trace;}
+if(this->m_ptr_glFeedbackBuffer){this->m_orig_glFeedbackBuffer = this->m_ptr_glFeedbackBuffer;this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&TraceTableDecorator::m_glFeedbackBuffer_trace;}
+if(this->m_ptr_glDebugMessageInsertARB){this->m_orig_glDebugMessageInsertARB = this->m_ptr_glDebugMessageInsertARB;this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&TraceTableDecorator::m_glDebugMessageInsertARB_trace;}
+if(this->m_ptr_glMultiTexCoord2i){this->m_orig_glMultiTexCoord2i = this->m_ptr_glMultiTexCoord2i;this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&TraceTableDecorator::m_glMultiTexCoord2i_trace;}
+if(this->m_ptr_glTextureSubImage3D){this->m_orig_glTextureSubImage3D = this->m_ptr_glTextureSubImage3D;this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&TraceTableDecorator::m_glTextureSubImage3D_trace;}
+if(this->m_ptr_glFramebufferTexture1D){this->m_orig_glFramebufferTexture1D = this->m_ptr_glFramebufferTexture1D;this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&TraceTableDecorator::m_glFramebufferTexture1D_trace;}
+if(this->m_ptr_glGetShaderiv){this->m_orig_glGetShaderiv = this->m_ptr_glGetShaderiv;this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&TraceTableDecorator::m_glGetShaderiv_trace;}
+if(this->m_ptr_glMultiTexCoord2d){this->m_orig_glMultiTexCoord2d = this->m_ptr_glMultiTexCoord2d;this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&TraceTableDecorator::m_glMultiTexCoord2d_trace;}
+if(this->m_ptr_glArrayObjectATI){this->m_orig_glArrayObjectATI = this->m_ptr_glArrayObjectATI;this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&TraceTableDecorator::m_glArrayObjectATI_trace;}
+if(this->m_ptr_glGetPointeri_vEXT){this->m_orig_glGetPointeri_vEXT = this->m_ptr_glGetPointeri_vEXT;this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&TraceTableDecorator::m_glGetPointeri_vEXT_trace;}
+if(this->m_ptr_glGetPerfMonitorCountersAMD){this->m_orig_glGetPerfMonitorCountersAMD = this->m_ptr_glGetPerfMonitorCountersAMD;this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&TraceTableDecorator::m_glGetPerfMonitorCountersAMD_trace;}
+if(this->m_ptr_glNamedBufferStorage){this->m_orig_glNamedBufferStorage = this->m_ptr_glNamedBufferStorage;this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&TraceTableDecorator::m_glNamedBufferStorage_trace;}
+if(this->m_ptr_glTexEnvxvOES){this->m_orig_glTexEnvxvOES = this->m_ptr_glTexEnvxvOES;this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&TraceTableDecorator::m_glTexEnvxvOES_trace;}
+if(this->m_ptr_glProgramUniform2ui64NV){this->m_orig_glProgramUniform2ui64NV = this->m_ptr_glProgramUniform2ui64NV;this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&TraceTableDecorator::m_glProgramUniform2ui64NV_trace;}
+if(this->m_ptr_glMultiTexCoord3bOES){this->m_orig_glMultiTexCoord3bOES = this->m_ptr_glMultiTexCoord3bOES;this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&TraceTableDecorator::m_glMultiTexCoord3bOES_trace;}
+if(this->m_ptr_glUniform1dv){this->m_orig_glUniform1dv = this->m_ptr_glUniform1dv;this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&TraceTableDecorator::m_glUniform1dv_trace;}
+if(this->m_ptr_glPixelTransferi){this->m_orig_glPixelTransferi = this->m_ptr_glPixelTransferi;this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&TraceTableDecorator::m_glPixelTransferi_trace;}
+if(this->m_ptr_glSecondaryColor3usvEXT){this->m_orig_glSecondaryColor3usvEXT = this->m_ptr_glSecondaryColor3usvEXT;this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3usvEXT_trace;}
+if(this->m_ptr_glProgramEnvParameterI4uivNV){this->m_orig_glProgramEnvParameterI4uivNV = this->m_ptr_glProgramEnvParameterI4uivNV;this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&TraceTableDecorator::m_glProgramEnvParameterI4uivNV_trace;}
+if(this->m_ptr_glVertex2sv){this->m_orig_glVertex2sv = this->m_ptr_glVertex2sv;this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&TraceTableDecorator::m_glVertex2sv_trace;}
+if(this->m_ptr_glWindowPos4dMESA){this->m_orig_glWindowPos4dMESA = this->m_ptr_glWindowPos4dMESA;this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&TraceTableDecorator::m_glWindowPos4dMESA_trace;}
+if(this->m_ptr_glDebugMessageControlARB){this->m_orig_glDebugMessageControlARB = this->m_ptr_glDebugMessageControlARB;this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&TraceTableDecorator::m_glDebugMessageControlARB_trace;}
+if(this->m_ptr_glIsTextureEXT){this->m_orig_glIsTextureEXT = this->m_ptr_glIsTextureEXT;this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&TraceTableDecorator::m_glIsTextureEXT_trace;}
+if(this->m_ptr_glFragmentMaterialivSGIX){this->m_orig_glFragmentMaterialivSGIX = this->m_ptr_glFragmentMaterialivSGIX;this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&TraceTableDecorator::m_glFragmentMaterialivSGIX_trace;}
+if(this->m_ptr_glLinkProgramARB){this->m_orig_glLinkProgramARB = this->m_ptr_glLinkProgramARB;this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&TraceTableDecorator::m_glLinkProgramARB_trace;}
+if(this->m_ptr_glFinishFenceAPPLE){this->m_orig_glFinishFenceAPPLE = this->m_ptr_glFinishFenceAPPLE;this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&TraceTableDecorator::m_glFinishFenceAPPLE_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT){this->m_orig_glVertexArrayVertexAttribBindingEXT = this->m_ptr_glVertexArrayVertexAttribBindingEXT;this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribBindingEXT_trace;}
+if(this->m_ptr_glTexStorageMem3DMultisampleEXT){this->m_orig_glTexStorageMem3DMultisampleEXT = this->m_ptr_glTexStorageMem3DMultisampleEXT;this->m_ptr_glTexStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glTexStorageMem3DMultisampleEXT_trace;}
+if(this->m_ptr_glUniform1ui64vARB){this->m_orig_glUniform1ui64vARB = this->m_ptr_glUniform1ui64vARB;this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&TraceTableDecorator::m_glUniform1ui64vARB_trace;}
+if(this->m_ptr_glMultiTexCoord4fv){this->m_orig_glMultiTexCoord4fv = this->m_ptr_glMultiTexCoord4fv;this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&TraceTableDecorator::m_glMultiTexCoord4fv_trace;}
+if(this->m_ptr_glMulticastFramebufferSampleLocationsfvNV){this->m_orig_glMulticastFramebufferSampleLocationsfvNV = this->m_ptr_glMulticastFramebufferSampleLocationsfvNV;this->m_ptr_glMulticastFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&TraceTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_trace;}
+if(this->m_ptr_glRasterPos3d){this->m_orig_glRasterPos3d = this->m_ptr_glRasterPos3d;this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&TraceTableDecorator::m_glRasterPos3d_trace;}
+if(this->m_ptr_glPollAsyncSGIX){this->m_orig_glPollAsyncSGIX = this->m_ptr_glPollAsyncSGIX;this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&TraceTableDecorator::m_glPollAsyncSGIX_trace;}
+if(this->m_ptr_glRasterPos3f){this->m_orig_glRasterPos3f = this->m_ptr_glRasterPos3f;this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&TraceTableDecorator::m_glRasterPos3f_trace;}
+if(this->m_ptr_glCompressedTexImage3D){this->m_orig_glCompressedTexImage3D = this->m_ptr_glCompressedTexImage3D;this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&TraceTableDecorator::m_glCompressedTexImage3D_trace;}
+if(this->m_ptr_glVariantivEXT){this->m_orig_glVariantivEXT = this->m_ptr_glVariantivEXT;this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&TraceTableDecorator::m_glVariantivEXT_trace;}
+if(this->m_ptr_glUnmapTexture2DINTEL){this->m_orig_glUnmapTexture2DINTEL = this->m_ptr_glUnmapTexture2DINTEL;this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&TraceTableDecorator::m_glUnmapTexture2DINTEL_trace;}
+if(this->m_ptr_glMulticastWaitSyncNV){this->m_orig_glMulticastWaitSyncNV = this->m_ptr_glMulticastWaitSyncNV;this->m_ptr_glMulticastWaitSyncNV = (FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC)&TraceTableDecorator::m_glMulticastWaitSyncNV_trace;}
+if(this->m_ptr_glGetVertexAttribiv){this->m_orig_glGetVertexAttribiv = this->m_ptr_glGetVertexAttribiv;this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&TraceTableDecorator::m_glGetVertexAttribiv_trace;}
+if(this->m_ptr_glGetPathCoordsNV){this->m_orig_glGetPathCoordsNV = this->m_ptr_glGetPathCoordsNV;this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&TraceTableDecorator::m_glGetPathCoordsNV_trace;}
+if(this->m_ptr_glColor4xvOES){this->m_orig_glColor4xvOES = this->m_ptr_glColor4xvOES;this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&TraceTableDecorator::m_glColor4xvOES_trace;}
+if(this->m_ptr_glVertexAttrib3fv){this->m_orig_glVertexAttrib3fv = this->m_ptr_glVertexAttrib3fv;this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&TraceTableDecorator::m_glVertexAttrib3fv_trace;}
+if(this->m_ptr_glRasterPos3s){this->m_orig_glRasterPos3s = this->m_ptr_glRasterPos3s;this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&TraceTableDecorator::m_glRasterPos3s_trace;}
+if(this->m_ptr_glVertex4bOES){this->m_orig_glVertex4bOES = this->m_ptr_glVertex4bOES;this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&TraceTableDecorator::m_glVertex4bOES_trace;}
+if(this->m_ptr_glTransformFeedbackVaryingsEXT){this->m_orig_glTransformFeedbackVaryingsEXT = this->m_ptr_glTransformFeedbackVaryingsEXT;this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&TraceTableDecorator::m_glTransformFeedbackVaryingsEXT_trace;}
+if(this->m_ptr_glCombinerOutputNV){this->m_orig_glCombinerOutputNV = this->m_ptr_glCombinerOutputNV;this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&TraceTableDecorator::m_glCombinerOutputNV_trace;}
+if(this->m_ptr_glWindowPos4sMESA){this->m_orig_glWindowPos4sMESA = this->m_ptr_glWindowPos4sMESA;this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&TraceTableDecorator::m_glWindowPos4sMESA_trace;}
+if(this->m_ptr_glVertexAttrib4svARB){this->m_orig_glVertexAttrib4svARB = this->m_ptr_glVertexAttrib4svARB;this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&TraceTableDecorator::m_glVertexAttrib4svARB_trace;}
+if(this->m_ptr_glIsList){this->m_orig_glIsList = this->m_ptr_glIsList;this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&TraceTableDecorator::m_glIsList_trace;}
+if(this->m_ptr_glGetInfoLogARB){this->m_orig_glGetInfoLogARB = this->m_ptr_glGetInfoLogARB;this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&TraceTableDecorator::m_glGetInfoLogARB_trace;}
+if(this->m_ptr_glUniformMatrix2fv){this->m_orig_glUniformMatrix2fv = this->m_ptr_glUniformMatrix2fv;this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&TraceTableDecorator::m_glUniformMatrix2fv_trace;}
+if(this->m_ptr_glVertexAttribs3dvNV){this->m_orig_glVertexAttribs3dvNV = this->m_ptr_glVertexAttribs3dvNV;this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&TraceTableDecorator::m_glVertexAttribs3dvNV_trace;}
+if(this->m_ptr_glGlobalAlphaFactorsSUN){this->m_orig_glGlobalAlphaFactorsSUN = this->m_ptr_glGlobalAlphaFactorsSUN;this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactorsSUN_trace;}
+if(this->m_ptr_glGetTrackMatrixivNV){this->m_orig_glGetTrackMatrixivNV = this->m_ptr_glGetTrackMatrixivNV;this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&TraceTableDecorator::m_glGetTrackMatrixivNV_trace;}
+if(this->m_ptr_glTextureParameterfvEXT){this->m_orig_glTextureParameterfvEXT = this->m_ptr_glTextureParameterfvEXT;this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&TraceTableDecorator::m_glTextureParameterfvEXT_trace;}
+if(this->m_ptr_glIsNamedBufferResidentNV){this->m_orig_glIsNamedBufferResidentNV = this->m_ptr_glIsNamedBufferResidentNV;this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&TraceTableDecorator::m_glIsNamedBufferResidentNV_trace;}
+if(this->m_ptr_glProgramUniform4ui64vARB){this->m_orig_glProgramUniform4ui64vARB = this->m_ptr_glProgramUniform4ui64vARB;this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&TraceTableDecorator::m_glProgramUniform4ui64vARB_trace;}
+if(this->m_ptr_glTbufferMask3DFX){this->m_orig_glTbufferMask3DFX = this->m_ptr_glTbufferMask3DFX;this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&TraceTableDecorator::m_glTbufferMask3DFX_trace;}
+if(this->m_ptr_glCoverFillPathNV){this->m_orig_glCoverFillPathNV = this->m_ptr_glCoverFillPathNV;this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&TraceTableDecorator::m_glCoverFillPathNV_trace;}
+if(this->m_ptr_glVertexAttrib1fvARB){this->m_orig_glVertexAttrib1fvARB = this->m_ptr_glVertexAttrib1fvARB;this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&TraceTableDecorator::m_glVertexAttrib1fvARB_trace;}
+if(this->m_ptr_glGenerateTextureMipmap){this->m_orig_glGenerateTextureMipmap = this->m_ptr_glGenerateTextureMipmap;this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&TraceTableDecorator::m_glGenerateTextureMipmap_trace;}
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT){this->m_orig_glNamedProgramLocalParameterI4uivEXT = this->m_ptr_glNamedProgramLocalParameterI4uivEXT;this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_trace;}
+if(this->m_ptr_glMultiDrawElementsBaseVertex){this->m_orig_glMultiDrawElementsBaseVertex = this->m_ptr_glMultiDrawElementsBaseVertex;this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&TraceTableDecorator::m_glMultiDrawElementsBaseVertex_trace;}
+if(this->m_ptr_glProgramSubroutineParametersuivNV){this->m_orig_glProgramSubroutineParametersuivNV = this->m_ptr_glProgramSubroutineParametersuivNV;this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&TraceTableDecorator::m_glProgramSubroutineParametersuivNV_trace;}
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT){this->m_orig_glProgramUniformMatrix2x4dvEXT = this->m_ptr_glProgramUniformMatrix2x4dvEXT;this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix2x4dvEXT_trace;}
+if(this->m_ptr_glRotatexOES){this->m_orig_glRotatexOES = this->m_ptr_glRotatexOES;this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&TraceTableDecorator::m_glRotatexOES_trace;}
+if(this->m_ptr_glMemoryBarrierEXT){this->m_orig_glMemoryBarrierEXT = this->m_ptr_glMemoryBarrierEXT;this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&TraceTableDecorator::m_glMemoryBarrierEXT_trace;}
+if(this->m_ptr_glVertexAttrib3svNV){this->m_orig_glVertexAttrib3svNV = this->m_ptr_glVertexAttrib3svNV;this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&TraceTableDecorator::m_glVertexAttrib3svNV_trace;}
+if(this->m_ptr_glVertexStream3iATI){this->m_orig_glVertexStream3iATI = this->m_ptr_glVertexStream3iATI;this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&TraceTableDecorator::m_glVertexStream3iATI_trace;}
+if(this->m_ptr_glCompressedTexSubImage1D){this->m_orig_glCompressedTexSubImage1D = this->m_ptr_glCompressedTexSubImage1D;this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&TraceTableDecorator::m_glCompressedTexSubImage1D_trace;}
+if(this->m_ptr_glSetFenceNV){this->m_orig_glSetFenceNV = this->m_ptr_glSetFenceNV;this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&TraceTableDecorator::m_glSetFenceNV_trace;}
+if(this->m_ptr_glAttachObjectARB){this->m_orig_glAttachObjectARB = this->m_ptr_glAttachObjectARB;this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&TraceTableDecorator::m_glAttachObjectARB_trace;}
+if(this->m_ptr_glCopyConvolutionFilter1D){this->m_orig_glCopyConvolutionFilter1D = this->m_ptr_glCopyConvolutionFilter1D;this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&TraceTableDecorator::m_glCopyConvolutionFilter1D_trace;}
+if(this->m_ptr_glTexStorageMem2DMultisampleEXT){this->m_orig_glTexStorageMem2DMultisampleEXT = this->m_ptr_glTexStorageMem2DMultisampleEXT;this->m_ptr_glTexStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glTexStorageMem2DMultisampleEXT_trace;}
+if(this->m_ptr_glProgramParameters4fvNV){this->m_orig_glProgramParameters4fvNV = this->m_ptr_glProgramParameters4fvNV;this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&TraceTableDecorator::m_glProgramParameters4fvNV_trace;}
+if(this->m_ptr_glNamedFramebufferParameteriEXT){this->m_orig_glNamedFramebufferParameteriEXT = this->m_ptr_glNamedFramebufferParameteriEXT;this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&TraceTableDecorator::m_glNamedFramebufferParameteriEXT_trace;}
+if(this->m_ptr_glVertexAttrib4Nsv){this->m_orig_glVertexAttrib4Nsv = this->m_ptr_glVertexAttrib4Nsv;this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&TraceTableDecorator::m_glVertexAttrib4Nsv_trace;}
+if(this->m_ptr_glVertexAttribI4usvEXT){this->m_orig_glVertexAttribI4usvEXT = this->m_ptr_glVertexAttribI4usvEXT;this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&TraceTableDecorator::m_glVertexAttribI4usvEXT_trace;}
+if(this->m_ptr_glTextureBufferRangeEXT){this->m_orig_glTextureBufferRangeEXT = this->m_ptr_glTextureBufferRangeEXT;this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&TraceTableDecorator::m_glTextureBufferRangeEXT_trace;}
+if(this->m_ptr_glVertexP3uiv){this->m_orig_glVertexP3uiv = this->m_ptr_glVertexP3uiv;this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&TraceTableDecorator::m_glVertexP3uiv_trace;}
+if(this->m_ptr_glIsPathNV){this->m_orig_glIsPathNV = this->m_ptr_glIsPathNV;this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&TraceTableDecorator::m_glIsPathNV_trace;}
+if(this->m_ptr_glGetnUniformi64vARB){this->m_orig_glGetnUniformi64vARB = this->m_ptr_glGetnUniformi64vARB;this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&TraceTableDecorator::m_glGetnUniformi64vARB_trace;}
+if(this->m_ptr_glFramebufferTextureMultiviewOVR){this->m_orig_glFramebufferTextureMultiviewOVR = this->m_ptr_glFramebufferTextureMultiviewOVR;this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&TraceTableDecorator::m_glFramebufferTextureMultiviewOVR_trace;}
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT){this->m_orig_glCompressedMultiTexSubImage2DEXT = this->m_ptr_glCompressedMultiTexSubImage2DEXT;this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glCompressedMultiTexSubImage2DEXT_trace;}
+if(this->m_ptr_glGetnMapdv){this->m_orig_glGetnMapdv = this->m_ptr_glGetnMapdv;this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&TraceTableDecorator::m_glGetnMapdv_trace;}
+if(this->m_ptr_glDebugMessageCallback){this->m_orig_glDebugMessageCallback = this->m_ptr_glDebugMessageCallback;this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&TraceTableDecorator::m_glDebugMessageCallback_trace;}
+if(this->m_ptr_glTangent3svEXT){this->m_orig_glTangent3svEXT = this->m_ptr_glTangent3svEXT;this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&TraceTableDecorator::m_glTangent3svEXT_trace;}
+if(this->m_ptr_glVertexAttribParameteriAMD){this->m_orig_glVertexAttribParameteriAMD = this->m_ptr_glVertexAttribParameteriAMD;this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&TraceTableDecorator::m_glVertexAttribParameteriAMD_trace;}
+if(this->m_ptr_glBufferSubDataARB){this->m_orig_glBufferSubDataARB = this->m_ptr_glBufferSubDataARB;this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&TraceTableDecorator::m_glBufferSubDataARB_trace;}
+if(this->m_ptr_glGetVertexAttribLui64vARB){this->m_orig_glGetVertexAttribLui64vARB = this->m_ptr_glGetVertexAttribLui64vARB;this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&TraceTableDecorator::m_glGetVertexAttribLui64vARB_trace;}
+if(this->m_ptr_glVertexAttribL4ui64NV){this->m_orig_glVertexAttribL4ui64NV = this->m_ptr_glVertexAttribL4ui64NV;this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&TraceTableDecorator::m_glVertexAttribL4ui64NV_trace;}
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN){this->m_orig_glReplacementCodeuiColor4ubVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN;this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_trace;}
+if(this->m_ptr_glImageTransformParameterfHP){this->m_orig_glImageTransformParameterfHP = this->m_ptr_glImageTransformParameterfHP;this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&TraceTableDecorator::m_glImageTransformParameterfHP_trace;}
+if(this->m_ptr_glMap1f){this->m_orig_glMap1f = this->m_ptr_glMap1f;this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&TraceTableDecorator::m_glMap1f_trace;}
+if(this->m_ptr_glRasterPos4fv){this->m_orig_glRasterPos4fv = this->m_ptr_glRasterPos4fv;this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&TraceTableDecorator::m_glRasterPos4fv_trace;}
+if(this->m_ptr_glVertex2bvOES){this->m_orig_glVertex2bvOES = this->m_ptr_glVertex2bvOES;this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&TraceTableDecorator::m_glVertex2bvOES_trace;}
+if(this->m_ptr_glGetMapControlPointsNV){this->m_orig_glGetMapControlPointsNV = this->m_ptr_glGetMapControlPointsNV;this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&TraceTableDecorator::m_glGetMapControlPointsNV_trace;}
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT){this->m_orig_glNamedProgramLocalParametersI4ivEXT = this->m_ptr_glNamedProgramLocalParametersI4ivEXT;this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_trace;}
+if(this->m_ptr_glBindBufferRangeNV){this->m_orig_glBindBufferRangeNV = this->m_ptr_glBindBufferRangeNV;this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&TraceTableDecorator::m_glBindBufferRangeNV_trace;}
+if(this->m_ptr_glVertexStream3dvATI){this->m_orig_glVertexStream3dvATI = this->m_ptr_glVertexStream3dvATI;this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&TraceTableDecorator::m_glVertexStream3dvATI_trace;}
+if(this->m_ptr_glNormalPointerListIBM){this->m_orig_glNormalPointerListIBM = this->m_ptr_glNormalPointerListIBM;this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&TraceTableDecorator::m_glNormalPointerListIBM_trace;}
+if(this->m_ptr_glFogFuncSGIS){this->m_orig_glFogFuncSGIS = this->m_ptr_glFogFuncSGIS;this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&TraceTableDecorator::m_glFogFuncSGIS_trace;}
+if(this->m_ptr_glMultiModeDrawArraysIBM){this->m_orig_glMultiModeDrawArraysIBM = this->m_ptr_glMultiModeDrawArraysIBM;this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&TraceTableDecorator::m_glMultiModeDrawArraysIBM_trace;}
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT){this->m_orig_glGetNamedFramebufferAttachmentParameterivEXT = this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT;this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_trace;}
+if(this->m_ptr_glGetFloatv){this->m_orig_glGetFloatv = this->m_ptr_glGetFloatv;this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&TraceTableDecorator::m_glGetFloatv_trace;}
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT){this->m_orig_glVertexArrayVertexAttribIFormatEXT = this->m_ptr_glVertexArrayVertexAttribIFormatEXT;this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&TraceTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_trace;}
+if(this->m_ptr_glHint){this->m_orig_glHint = this->m_ptr_glHint;this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&TraceTableDecorator::m_glHint_trace;}
+if(this->m_ptr_glVertexStream2svATI){this->m_orig_glVertexStream2svATI = this->m_ptr_glVertexStream2svATI;this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&TraceTableDecorator::m_glVertexStream2svATI_trace;}
+if(this->m_ptr_glMultiDrawArraysIndirect){this->m_orig_glMultiDrawArraysIndirect = this->m_ptr_glMultiDrawArraysIndirect;this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&TraceTableDecorator::m_glMultiDrawArraysIndirect_trace;}
+if(this->m_ptr_glMultiTexEnvfvEXT){this->m_orig_glMultiTexEnvfvEXT = this->m_ptr_glMultiTexEnvfvEXT;this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&TraceTableDecorator::m_glMultiTexEnvfvEXT_trace;}
+if(this->m_ptr_glVertexAttribP2uiv){this->m_orig_glVertexAttribP2uiv = this->m_ptr_glVertexAttribP2uiv;this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&TraceTableDecorator::m_glVertexAttribP2uiv_trace;}
+if(this->m_ptr_glProgramUniform1i64vARB){this->m_orig_glProgramUniform1i64vARB = this->m_ptr_glProgramUniform1i64vARB;this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&TraceTableDecorator::m_glProgramUniform1i64vARB_trace;}
+if(this->m_ptr_glFramebufferTextureARB){this->m_orig_glFramebufferTextureARB = this->m_ptr_glFramebufferTextureARB;this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&TraceTableDecorator::m_glFramebufferTextureARB_trace;}
+if(this->m_ptr_glPushClientAttribDefaultEXT){this->m_orig_glPushClientAttribDefaultEXT = this->m_ptr_glPushClientAttribDefaultEXT;this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&TraceTableDecorator::m_glPushClientAttribDefaultEXT_trace;}
+if(this->m_ptr_glScalef){this->m_orig_glScalef = this->m_ptr_glScalef;this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&TraceTableDecorator::m_glScalef_trace;}
+if(this->m_ptr_glScaled){this->m_orig_glScaled = this->m_ptr_glScaled;this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&TraceTableDecorator::m_glScaled_trace;}
+if(this->m_ptr_glGetConvolutionParameterxvOES){this->m_orig_glGetConvolutionParameterxvOES = this->m_ptr_glGetConvolutionParameterxvOES;this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&TraceTableDecorator::m_glGetConvolutionParameterxvOES_trace;}
+if(this->m_ptr_glGetProgramResourceName){this->m_orig_glGetProgramResourceName = this->m_ptr_glGetProgramResourceName;this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&TraceTableDecorator::m_glGetProgramResourceName_trace;}
+if(this->m_ptr_glCopyColorTable){this->m_orig_glCopyColorTable = this->m_ptr_glCopyColorTable;this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&TraceTableDecorator::m_glCopyColorTable_trace;}
+if(this->m_ptr_glDepthRangeArrayv){this->m_orig_glDepthRangeArrayv = this->m_ptr_glDepthRangeArrayv;this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&TraceTableDecorator::m_glDepthRangeArrayv_trace;}
+if(this->m_ptr_glCoverFillPathInstancedNV){this->m_orig_glCoverFillPathInstancedNV = this->m_ptr_glCoverFillPathInstancedNV;this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&TraceTableDecorator::m_glCoverFillPathInstancedNV_trace;}
+if(this->m_ptr_glMultiTexParameterivEXT){this->m_orig_glMultiTexParameterivEXT = this->m_ptr_glMultiTexParameterivEXT;this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&TraceTableDecorator::m_glMultiTexParameterivEXT_trace;}
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv){this->m_orig_glGetActiveAtomicCounterBufferiv = this->m_ptr_glGetActiveAtomicCounterBufferiv;this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&TraceTableDecorator::m_glGetActiveAtomicCounterBufferiv_trace;}
+if(this->m_ptr_glStencilOpSeparate){this->m_orig_glStencilOpSeparate = this->m_ptr_glStencilOpSeparate;this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&TraceTableDecorator::m_glStencilOpSeparate_trace;}
+if(this->m_ptr_glVertexAttrib4fNV){this->m_orig_glVertexAttrib4fNV = this->m_ptr_glVertexAttrib4fNV;this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&TraceTableDecorator::m_glVertexAttrib4fNV_trace;}
+if(this->m_ptr_glGetColorTableParameterivSGI){this->m_orig_glGetColorTableParameterivSGI = this->m_ptr_glGetColorTableParameterivSGI;this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&TraceTableDecorator::m_glGetColorTableParameterivSGI_trace;}
+if(this->m_ptr_glVertexArrayAttribBinding){this->m_orig_glVertexArrayAttribBinding = this->m_ptr_glVertexArrayAttribBinding;this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&TraceTableDecorator::m_glVertexArrayAttribBinding_trace;}
+if(this->m_ptr_glIsSemaphoreEXT){this->m_orig_glIsSemaphoreEXT = this->m_ptr_glIsSemaphoreEXT;this->m_ptr_glIsSemaphoreEXT = (FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC)&TraceTableDecorator::m_glIsSemaphoreEXT_trace;}
+if(this->m_ptr_glProgramParameters4dvNV){this->m_orig_glProgramParameters4dvNV = this->m_ptr_glProgramParameters4dvNV;this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&TraceTableDecorator::m_glProgramParameters4dvNV_trace;}
+if(this->m_ptr_glVertexAttribL4dv){this->m_orig_glVertexAttribL4dv = this->m_ptr_glVertexAttribL4dv;this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&TraceTableDecorator::m_glVertexAttribL4dv_trace;}
+if(this->m_ptr_glGetTexParameteriv){this->m_orig_glGetTexParameteriv = this->m_ptr_glGetTexParameteriv;this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&TraceTableDecorator::m_glGetTexParameteriv_trace;}
+if(this->m_ptr_glGetUniformOffsetEXT){this->m_orig_glGetUniformOffsetEXT = this->m_ptr_glGetUniformOffsetEXT;this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&TraceTableDecorator::m_glGetUniformOffsetEXT_trace;}
+if(this->m_ptr_glGetVertexAttribPointerv){this->m_orig_glGetVertexAttribPointerv = this->m_ptr_glGetVertexAttribPointerv;this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&TraceTableDecorator::m_glGetVertexAttribPointerv_trace;}
+if(this->m_ptr_glResumeTransformFeedbackNV){this->m_orig_glResumeTransformFeedbackNV = this->m_ptr_glResumeTransformFeedbackNV;this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glResumeTransformFeedbackNV_trace;}
+if(this->m_ptr_glProgramUniform3i64vNV){this->m_orig_glProgramUniform3i64vNV = this->m_ptr_glProgramUniform3i64vNV;this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&TraceTableDecorator::m_glProgramUniform3i64vNV_trace;}
+if(this->m_ptr_glTangent3fEXT){this->m_orig_glTangent3fEXT = this->m_ptr_glTangent3fEXT;this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&TraceTableDecorator::m_glTangent3fEXT_trace;}
+if(this->m_ptr_glGetPathMetricRangeNV){this->m_orig_glGetPathMetricRangeNV = this->m_ptr_glGetPathMetricRangeNV;this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&TraceTableDecorator::m_glGetPathMetricRangeNV_trace;}
+if(this->m_ptr_glWindowPos2iMESA){this->m_orig_glWindowPos2iMESA = this->m_ptr_glWindowPos2iMESA;this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&TraceTableDecorator::m_glWindowPos2iMESA_trace;}
+if(this->m_ptr_glVertex2xvOES){this->m_orig_glVertex2xvOES = this->m_ptr_glVertex2xvOES;this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&TraceTableDecorator::m_glVertex2xvOES_trace;}
+if(this->m_ptr_glGetnCompressedTexImage){this->m_orig_glGetnCompressedTexImage = this->m_ptr_glGetnCompressedTexImage;this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&TraceTableDecorator::m_glGetnCompressedTexImage_trace;}
+if(this->m_ptr_glWindowPos2dv){this->m_orig_glWindowPos2dv = this->m_ptr_glWindowPos2dv;this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&TraceTableDecorator::m_glWindowPos2dv_trace;}
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN){this->m_orig_glReplacementCodeuiVertex3fSUN = this->m_ptr_glReplacementCodeuiVertex3fSUN;this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&TraceTableDecorator::m_glReplacementCodeuiVertex3fSUN_trace;}
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT){this->m_orig_glGetTransformFeedbackVaryingEXT = this->m_ptr_glGetTransformFeedbackVaryingEXT;this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&TraceTableDecorator::m_glGetTransformFeedbackVaryingEXT_trace;}
+if(this->m_ptr_glWindowPos3fARB){this->m_orig_glWindowPos3fARB = this->m_ptr_glWindowPos3fARB;this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&TraceTableDecorator::m_glWindowPos3fARB_trace;}
+if(this->m_ptr_glMapNamedBufferEXT){this->m_orig_glMapNamedBufferEXT = this->m_ptr_glMapNamedBufferEXT;this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&TraceTableDecorator::m_glMapNamedBufferEXT_trace;}
+if(this->m_ptr_glDisable){this->m_orig_glDisable = this->m_ptr_glDisable;this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&TraceTableDecorator::m_glDisable_trace;}
+if(this->m_ptr_glIsPointInFillPathNV){this->m_orig_glIsPointInFillPathNV = this->m_ptr_glIsPointInFillPathNV;this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&TraceTableDecorator::m_glIsPointInFillPathNV_trace;}
+if(this->m_ptr_glVertexAttribI2uiEXT){this->m_orig_glVertexAttribI2uiEXT = this->m_ptr_glVertexAttribI2uiEXT;this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&TraceTableDecorator::m_glVertexAttribI2uiEXT_trace;}
+if(this->m_ptr_glProgramUniform4uiv){this->m_orig_glProgramUniform4uiv = this->m_ptr_glProgramUniform4uiv;this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&TraceTableDecorator::m_glProgramUniform4uiv_trace;}
+if(this->m_ptr_glQueryCounter){this->m_orig_glQueryCounter = this->m_ptr_glQueryCounter;this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&TraceTableDecorator::m_glQueryCounter_trace;}
+if(this->m_ptr_glFramebufferRenderbufferEXT){this->m_orig_glFramebufferRenderbufferEXT = this->m_ptr_glFramebufferRenderbufferEXT;this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&TraceTableDecorator::m_glFramebufferRenderbufferEXT_trace;}
+if(this->m_ptr_glBinormal3svEXT){this->m_orig_glBinormal3svEXT = this->m_ptr_glBinormal3svEXT;this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&TraceTableDecorator::m_glBinormal3svEXT_trace;}
+if(this->m_ptr_glBindBufferOffsetNV){this->m_orig_glBindBufferOffsetNV = this->m_ptr_glBindBufferOffsetNV;this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&TraceTableDecorator::m_glBindBufferOffsetNV_trace;}
+if(this->m_ptr_glCopyTextureSubImage2D){this->m_orig_glCopyTextureSubImage2D = this->m_ptr_glCopyTextureSubImage2D;this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&TraceTableDecorator::m_glCopyTextureSubImage2D_trace;}
+if(this->m_ptr_glGetProgramResourcefvNV){this->m_orig_glGetProgramResourcefvNV = this->m_ptr_glGetProgramResourcefvNV;this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&TraceTableDecorator::m_glGetProgramResourcefvNV_trace;}
+if(this->m_ptr_glBinormalPointerEXT){this->m_orig_glBinormalPointerEXT = this->m_ptr_glBinormalPointerEXT;this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&TraceTableDecorator::m_glBinormalPointerEXT_trace;}
+if(this->m_ptr_glGetLightfv){this->m_orig_glGetLightfv = this->m_ptr_glGetLightfv;this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&TraceTableDecorator::m_glGetLightfv_trace;}
+if(this->m_ptr_glMulticastCopyImageSubDataNV){this->m_orig_glMulticastCopyImageSubDataNV = this->m_ptr_glMulticastCopyImageSubDataNV;this->m_ptr_glMulticastCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC)&TraceTableDecorator::m_glMulticastCopyImageSubDataNV_trace;}
+if(this->m_ptr_glVertex2bOES){this->m_orig_glVertex2bOES = this->m_ptr_glVertex2bOES;this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&TraceTableDecorator::m_glVertex2bOES_trace;}
+if(this->m_ptr_glUniform2ivARB){this->m_orig_glUniform2ivARB = this->m_ptr_glUniform2ivARB;this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&TraceTableDecorator::m_glUniform2ivARB_trace;}
+if(this->m_ptr_glMultiTexCoord3s){this->m_orig_glMultiTexCoord3s = this->m_ptr_glMultiTexCoord3s;this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&TraceTableDecorator::m_glMultiTexCoord3s_trace;}
+if(this->m_ptr_glGetHistogramParameterfvEXT){this->m_orig_glGetHistogramParameterfvEXT = this->m_ptr_glGetHistogramParameterfvEXT;this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&TraceTableDecorator::m_glGetHistogramParameterfvEXT_trace;}
+if(this->m_ptr_glGetProgramStringNV){this->m_orig_glGetProgramStringNV = this->m_ptr_glGetProgramStringNV;this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&TraceTableDecorator::m_glGetProgramStringNV_trace;}
+if(this->m_ptr_glGetTexGenxvOES){this->m_orig_glGetTexGenxvOES = this->m_ptr_glGetTexGenxvOES;this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&TraceTableDecorator::m_glGetTexGenxvOES_trace;}
+if(this->m_ptr_glTextureSubImage2D){this->m_orig_glTextureSubImage2D = this->m_ptr_glTextureSubImage2D;this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&TraceTableDecorator::m_glTextureSubImage2D_trace;}
+if(this->m_ptr_glObjectPurgeableAPPLE){this->m_orig_glObjectPurgeableAPPLE = this->m_ptr_glObjectPurgeableAPPLE;this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&TraceTableDecorator::m_glObjectPurgeableAPPLE_trace;}
+if(this->m_ptr_glColorTableSGI){this->m_orig_glColorTableSGI = this->m_ptr_glColorTableSGI;this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&TraceTableDecorator::m_glColorTableSGI_trace;}
+if(this->m_ptr_glCopyConvolutionFilter2DEXT){this->m_orig_glCopyConvolutionFilter2DEXT = this->m_ptr_glCopyConvolutionFilter2DEXT;this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&TraceTableDecorator::m_glCopyConvolutionFilter2DEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3f){this->m_orig_glMultiTexCoord3f = this->m_ptr_glMultiTexCoord3f;this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&TraceTableDecorator::m_glMultiTexCoord3f_trace;}
+if(this->m_ptr_glMultiTexCoord3d){this->m_orig_glMultiTexCoord3d = this->m_ptr_glMultiTexCoord3d;this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&TraceTableDecorator::m_glMultiTexCoord3d_trace;}
+if(this->m_ptr_glFogCoorddv){this->m_orig_glFogCoorddv = this->m_ptr_glFogCoorddv;this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&TraceTableDecorator::m_glFogCoorddv_trace;}
+if(this->m_ptr_glGetBufferPointerv){this->m_orig_glGetBufferPointerv = this->m_ptr_glGetBufferPointerv;this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&TraceTableDecorator::m_glGetBufferPointerv_trace;}
+if(this->m_ptr_glProgramUniform1fEXT){this->m_orig_glProgramUniform1fEXT = this->m_ptr_glProgramUniform1fEXT;this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&TraceTableDecorator::m_glProgramUniform1fEXT_trace;}
+if(this->m_ptr_glWindowPos2fvMESA){this->m_orig_glWindowPos2fvMESA = this->m_ptr_glWindowPos2fvMESA;this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&TraceTableDecorator::m_glWindowPos2fvMESA_trace;}
+if(this->m_ptr_glAlphaToCoverageDitherControlNV){this->m_orig_glAlphaToCoverageDitherControlNV = this->m_ptr_glAlphaToCoverageDitherControlNV;this->m_ptr_glAlphaToCoverageDitherControlNV = (FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)&TraceTableDecorator::m_glAlphaToCoverageDitherControlNV_trace;}
+if(this->m_ptr_glPolygonOffsetxOES){this->m_orig_glPolygonOffsetxOES = this->m_ptr_glPolygonOffsetxOES;this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&TraceTableDecorator::m_glPolygonOffsetxOES_trace;}
+if(this->m_ptr_glVertexAttrib4dARB){this->m_orig_glVertexAttrib4dARB = this->m_ptr_glVertexAttrib4dARB;this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&TraceTableDecorator::m_glVertexAttrib4dARB_trace;}
+if(this->m_ptr_glUniformHandleui64vARB){this->m_orig_glUniformHandleui64vARB = this->m_ptr_glUniformHandleui64vARB;this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&TraceTableDecorator::m_glUniformHandleui64vARB_trace;}
+if(this->m_ptr_glFragmentLightModelfvSGIX){this->m_orig_glFragmentLightModelfvSGIX = this->m_ptr_glFragmentLightModelfvSGIX;this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&TraceTableDecorator::m_glFragmentLightModelfvSGIX_trace;}
+if(this->m_ptr_glSwizzleEXT){this->m_orig_glSwizzleEXT = this->m_ptr_glSwizzleEXT;this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&TraceTableDecorator::m_glSwizzleEXT_trace;}
+if(this->m_ptr_glBindFragmentShaderATI){this->m_orig_glBindFragmentShaderATI = this->m_ptr_glBindFragmentShaderATI;this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&TraceTableDecorator::m_glBindFragmentShaderATI_trace;}
+if(this->m_ptr_glVertexAttribs3hvNV){this->m_orig_glVertexAttribs3hvNV = this->m_ptr_glVertexAttribs3hvNV;this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&TraceTableDecorator::m_glVertexAttribs3hvNV_trace;}
+if(this->m_ptr_glGenBuffersARB){this->m_orig_glGenBuffersARB = this->m_ptr_glGenBuffersARB;this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&TraceTableDecorator::m_glGenBuffersARB_trace;}
+if(this->m_ptr_glTextureStorageMem2DMultisampleEXT){this->m_orig_glTextureStorageMem2DMultisampleEXT = this->m_ptr_glTextureStorageMem2DMultisampleEXT;this->m_ptr_glTextureStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)&TraceTableDecorator::m_glTextureStorageMem2DMultisampleEXT_trace;}
+if(this->m_ptr_glListParameterfvSGIX){this->m_orig_glListParameterfvSGIX = this->m_ptr_glListParameterfvSGIX;this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&TraceTableDecorator::m_glListParameterfvSGIX_trace;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisample){this->m_orig_glNamedRenderbufferStorageMultisample = this->m_ptr_glNamedRenderbufferStorageMultisample;this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&TraceTableDecorator::m_glNamedRenderbufferStorageMultisample_trace;}
+if(this->m_ptr_glVertexAttribI1iEXT){this->m_orig_glVertexAttribI1iEXT = this->m_ptr_glVertexAttribI1iEXT;this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&TraceTableDecorator::m_glVertexAttribI1iEXT_trace;}
+if(this->m_ptr_glMultiTexCoord2ivARB){this->m_orig_glMultiTexCoord2ivARB = this->m_ptr_glMultiTexCoord2ivARB;this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&TraceTableDecorator::m_glMultiTexCoord2ivARB_trace;}
+if(this->m_ptr_glLightModelxOES){this->m_orig_glLightModelxOES = this->m_ptr_glLightModelxOES;this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&TraceTableDecorator::m_glLightModelxOES_trace;}
+if(this->m_ptr_glColor3xOES){this->m_orig_glColor3xOES = this->m_ptr_glColor3xOES;this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&TraceTableDecorator::m_glColor3xOES_trace;}
+if(this->m_ptr_glReadBuffer){this->m_orig_glReadBuffer = this->m_ptr_glReadBuffer;this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&TraceTableDecorator::m_glReadBuffer_trace;}
+if(this->m_ptr_glStencilFillPathInstancedNV){this->m_orig_glStencilFillPathInstancedNV = this->m_ptr_glStencilFillPathInstancedNV;this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&TraceTableDecorator::m_glStencilFillPathInstancedNV_trace;}
+if(this->m_ptr_glVDPAUUnmapSurfacesNV){this->m_orig_glVDPAUUnmapSurfacesNV = this->m_ptr_glVDPAUUnmapSurfacesNV;this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&TraceTableDecorator::m_glVDPAUUnmapSurfacesNV_trace;}
+if(this->m_ptr_glProgramUniform4i64NV){this->m_orig_glProgramUniform4i64NV = this->m_ptr_glProgramUniform4i64NV;this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&TraceTableDecorator::m_glProgramUniform4i64NV_trace;}
+if(this->m_ptr_glVertexStream4dvATI){this->m_orig_glVertexStream4dvATI = this->m_ptr_glVertexStream4dvATI;this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&TraceTableDecorator::m_glVertexStream4dvATI_trace;}
+if(this->m_ptr_glIsQuery){this->m_orig_glIsQuery = this->m_ptr_glIsQuery;this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&TraceTableDecorator::m_glIsQuery_trace;}
+if(this->m_ptr_glProgramUniformMatrix4fvEXT){this->m_orig_glProgramUniformMatrix4fvEXT = this->m_ptr_glProgramUniformMatrix4fvEXT;this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&TraceTableDecorator::m_glProgramUniformMatrix4fvEXT_trace;}
+if(this->m_ptr_glVertexAttrib3hNV){this->m_orig_glVertexAttrib3hNV = this->m_ptr_glVertexAttrib3hNV;this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&TraceTableDecorator::m_glVertexAttrib3hNV_trace;}
+if(this->m_ptr_glFlushMappedNamedBufferRange){this->m_orig_glFlushMappedNamedBufferRange = this->m_ptr_glFlushMappedNamedBufferRange;this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&TraceTableDecorator::m_glFlushMappedNamedBufferRange_trace;}
+if(this->m_ptr_glPushName){this->m_orig_glPushName = this->m_ptr_glPushName;this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&TraceTableDecorator::m_glPushName_trace;}
+if(this->m_ptr_glGetClipPlane){this->m_orig_glGetClipPlane = this->m_ptr_glGetClipPlane;this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&TraceTableDecorator::m_glGetClipPlane_trace;}
+if(this->m_ptr_glVertex4dv){this->m_orig_glVertex4dv = this->m_ptr_glVertex4dv;this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&TraceTableDecorator::m_glVertex4dv_trace;}
+if(this->m_ptr_glVertexAttrib3d){this->m_orig_glVertexAttrib3d = this->m_ptr_glVertexAttrib3d;this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&TraceTableDecorator::m_glVertexAttrib3d_trace;}
+if(this->m_ptr_glBlendColor){this->m_orig_glBlendColor = this->m_ptr_glBlendColor;this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&TraceTableDecorator::m_glBlendColor_trace;}
+if(this->m_ptr_glBindTransformFeedbackNV){this->m_orig_glBindTransformFeedbackNV = this->m_ptr_glBindTransformFeedbackNV;this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glBindTransformFeedbackNV_trace;}
+if(this->m_ptr_glSamplerParameterIuiv){this->m_orig_glSamplerParameterIuiv = this->m_ptr_glSamplerParameterIuiv;this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&TraceTableDecorator::m_glSamplerParameterIuiv_trace;}
+if(this->m_ptr_glIndexubv){this->m_orig_glIndexubv = this->m_ptr_glIndexubv;this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&TraceTableDecorator::m_glIndexubv_trace;}
+if(this->m_ptr_glNamedBufferPageCommitmentEXT){this->m_orig_glNamedBufferPageCommitmentEXT = this->m_ptr_glNamedBufferPageCommitmentEXT;this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&TraceTableDecorator::m_glNamedBufferPageCommitmentEXT_trace;}
+if(this->m_ptr_glCheckNamedFramebufferStatus){this->m_orig_glCheckNamedFramebufferStatus = this->m_ptr_glCheckNamedFramebufferStatus;this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&TraceTableDecorator::m_glCheckNamedFramebufferStatus_trace;}
+if(this->m_ptr_glGetObjectBufferfvATI){this->m_orig_glGetObjectBufferfvATI = this->m_ptr_glGetObjectBufferfvATI;this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&TraceTableDecorator::m_glGetObjectBufferfvATI_trace;}
+if(this->m_ptr_glRasterPos4d){this->m_orig_glRasterPos4d = this->m_ptr_glRasterPos4d;this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&TraceTableDecorator::m_glRasterPos4d_trace;}
+if(this->m_ptr_glRasterPos4f){this->m_orig_glRasterPos4f = this->m_ptr_glRasterPos4f;this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&TraceTableDecorator::m_glRasterPos4f_trace;}
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD){this->m_orig_glGetPerfMonitorCounterStringAMD = this->m_ptr_glGetPerfMonitorCounterStringAMD;this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&TraceTableDecorator::m_glGetPerfMonitorCounterStringAMD_trace;}
+if(this->m_ptr_glVertexAttrib3s){this->m_orig_glVertexAttrib3s = this->m_ptr_glVertexAttrib3s;this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&TraceTableDecorator::m_glVertexAttrib3s_trace;}
+if(this->m_ptr_glDrawElementsInstancedEXT){this->m_orig_glDrawElementsInstancedEXT = this->m_ptr_glDrawElementsInstancedEXT;this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&TraceTableDecorator::m_glDrawElementsInstancedEXT_trace;}
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT){this->m_orig_glNamedProgramLocalParameterI4iEXT = this->m_ptr_glNamedProgramLocalParameterI4iEXT;this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameterI4iEXT_trace;}
+if(this->m_ptr_glRasterPos4s){this->m_orig_glRasterPos4s = this->m_ptr_glRasterPos4s;this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&TraceTableDecorator::m_glRasterPos4s_trace;}
+if(this->m_ptr_glGetProgramStageiv){this->m_orig_glGetProgramStageiv = this->m_ptr_glGetProgramStageiv;this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&TraceTableDecorator::m_glGetProgramStageiv_trace;}
+if(this->m_ptr_glGetMaterialxOES){this->m_orig_glGetMaterialxOES = this->m_ptr_glGetMaterialxOES;this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&TraceTableDecorator::m_glGetMaterialxOES_trace;}
+if(this->m_ptr_glPopMatrix){this->m_orig_glPopMatrix = this->m_ptr_glPopMatrix;this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&TraceTableDecorator::m_glPopMatrix_trace;}
+if(this->m_ptr_glGetVideoui64vNV){this->m_orig_glGetVideoui64vNV = this->m_ptr_glGetVideoui64vNV;this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&TraceTableDecorator::m_glGetVideoui64vNV_trace;}
+if(this->m_ptr_glTangent3bEXT){this->m_orig_glTangent3bEXT = this->m_ptr_glTangent3bEXT;this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&TraceTableDecorator::m_glTangent3bEXT_trace;}
+if(this->m_ptr_glGetGraphicsResetStatusARB){this->m_orig_glGetGraphicsResetStatusARB = this->m_ptr_glGetGraphicsResetStatusARB;this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&TraceTableDecorator::m_glGetGraphicsResetStatusARB_trace;}
+if(this->m_ptr_glUniform4i){this->m_orig_glUniform4i = this->m_ptr_glUniform4i;this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&TraceTableDecorator::m_glUniform4i_trace;}
+if(this->m_ptr_glActiveTexture){this->m_orig_glActiveTexture = this->m_ptr_glActiveTexture;this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&TraceTableDecorator::m_glActiveTexture_trace;}
+if(this->m_ptr_glEnableVertexAttribArray){this->m_orig_glEnableVertexAttribArray = this->m_ptr_glEnableVertexAttribArray;this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&TraceTableDecorator::m_glEnableVertexAttribArray_trace;}
+if(this->m_ptr_glTexCoord4fVertex4fvSUN){this->m_orig_glTexCoord4fVertex4fvSUN = this->m_ptr_glTexCoord4fVertex4fvSUN;this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&TraceTableDecorator::m_glTexCoord4fVertex4fvSUN_trace;}
+if(this->m_ptr_glUniform4d){this->m_orig_glUniform4d = this->m_ptr_glUniform4d;this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&TraceTableDecorator::m_glUniform4d_trace;}
+if(this->m_ptr_glUniform4f){this->m_orig_glUniform4f = this->m_ptr_glUniform4f;this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&TraceTableDecorator::m_glUniform4f_trace;}
+if(this->m_ptr_glRenderbufferStorageMultisample){this->m_orig_glRenderbufferStorageMultisample = this->m_ptr_glRenderbufferStorageMultisample;this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&TraceTableDecorator::m_glRenderbufferStorageMultisample_trace;}
+if(this->m_ptr_glCreateProgramPipelines){this->m_orig_glCreateProgramPipelines = this->m_ptr_glCreateProgramPipelines;this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&TraceTableDecorator::m_glCreateProgramPipelines_trace;}
+if(this->m_ptr_glVertexAttribLPointer){this->m_orig_glVertexAttribLPointer = this->m_ptr_glVertexAttribLPointer;this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&TraceTableDecorator::m_glVertexAttribLPointer_trace;}
+if(this->m_ptr_glUniform2uiEXT){this->m_orig_glUniform2uiEXT = this->m_ptr_glUniform2uiEXT;this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&TraceTableDecorator::m_glUniform2uiEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3sv){this->m_orig_glMultiTexCoord3sv = this->m_ptr_glMultiTexCoord3sv;this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&TraceTableDecorator::m_glMultiTexCoord3sv_trace;}
+if(this->m_ptr_glDrawElementsInstancedBaseVertex){this->m_orig_glDrawElementsInstancedBaseVertex = this->m_ptr_glDrawElementsInstancedBaseVertex;this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&TraceTableDecorator::m_glDrawElementsInstancedBaseVertex_trace;}
+if(this->m_ptr_glPixelTransformParameterfvEXT){this->m_orig_glPixelTransformParameterfvEXT = this->m_ptr_glPixelTransformParameterfvEXT;this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&TraceTableDecorator::m_glPixelTransformParameterfvEXT_trace;}
+if(this->m_ptr_glDrawTransformFeedbackNV){this->m_orig_glDrawTransformFeedbackNV = this->m_ptr_glDrawTransformFeedbackNV;this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glDrawTransformFeedbackNV_trace;}
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV){this->m_orig_glTextureImage2DMultisampleCoverageNV = this->m_ptr_glTextureImage2DMultisampleCoverageNV;this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&TraceTableDecorator::m_glTextureImage2DMultisampleCoverageNV_trace;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT){this->m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT;this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&TraceTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_trace;}
+if(this->m_ptr_glIsTexture){this->m_orig_glIsTexture = this->m_ptr_glIsTexture;this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&TraceTableDecorator::m_glIsTexture_trace;}
+if(this->m_ptr_glMultiTexCoord4iv){this->m_orig_glMultiTexCoord4iv = this->m_ptr_glMultiTexCoord4iv;this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&TraceTableDecorator::m_glMultiTexCoord4iv_trace;}
+if(this->m_ptr_glTexEnvfv){this->m_orig_glTexEnvfv = this->m_ptr_glTexEnvfv;this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&TraceTableDecorator::m_glTexEnvfv_trace;}
+if(this->m_ptr_glPopDebugGroup){this->m_orig_glPopDebugGroup = this->m_ptr_glPopDebugGroup;this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&TraceTableDecorator::m_glPopDebugGroup_trace;}
+if(this->m_ptr_glUniformBlockBinding){this->m_orig_glUniformBlockBinding = this->m_ptr_glUniformBlockBinding;this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&TraceTableDecorator::m_glUniformBlockBinding_trace;}
+if(this->m_ptr_glWindowPos2svMESA){this->m_orig_glWindowPos2svMESA = this->m_ptr_glWindowPos2svMESA;this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&TraceTableDecorator::m_glWindowPos2svMESA_trace;}
+if(this->m_ptr_glGenerateTextureMipmapEXT){this->m_orig_glGenerateTextureMipmapEXT = this->m_ptr_glGenerateTextureMipmapEXT;this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&TraceTableDecorator::m_glGenerateTextureMipmapEXT_trace;}
+if(this->m_ptr_glBindLightParameterEXT){this->m_orig_glBindLightParameterEXT = this->m_ptr_glBindLightParameterEXT;this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&TraceTableDecorator::m_glBindLightParameterEXT_trace;}
+if(this->m_ptr_glTexCoord3bOES){this->m_orig_glTexCoord3bOES = this->m_ptr_glTexCoord3bOES;this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&TraceTableDecorator::m_glTexCoord3bOES_trace;}
+if(this->m_ptr_glTexCoordPointer){this->m_orig_glTexCoordPointer = this->m_ptr_glTexCoordPointer;this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&TraceTableDecorator::m_glTexCoordPointer_trace;}
+if(this->m_ptr_glProgramUniformMatrix3x2fv){this->m_orig_glProgramUniformMatrix3x2fv = this->m_ptr_glProgramUniformMatrix3x2fv;this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix3x2fv_trace;}
+if(this->m_ptr_glUniform2fvARB){this->m_orig_glUniform2fvARB = this->m_ptr_glUniform2fvARB;this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&TraceTableDecorator::m_glUniform2fvARB_trace;}
+if(this->m_ptr_glProgramLocalParameterI4uivNV){this->m_orig_glProgramLocalParameterI4uivNV = this->m_ptr_glProgramLocalParameterI4uivNV;this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&TraceTableDecorator::m_glProgramLocalParameterI4uivNV_trace;}
+if(this->m_ptr_glFlushVertexArrayRangeNV){this->m_orig_glFlushVertexArrayRangeNV = this->m_ptr_glFlushVertexArrayRangeNV;this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&TraceTableDecorator::m_glFlushVertexArrayRangeNV_trace;}
+if(this->m_ptr_glSecondaryColor3svEXT){this->m_orig_glSecondaryColor3svEXT = this->m_ptr_glSecondaryColor3svEXT;this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3svEXT_trace;}
+if(this->m_ptr_glGetBufferParameteriv){this->m_orig_glGetBufferParameteriv = this->m_ptr_glGetBufferParameteriv;this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&TraceTableDecorator::m_glGetBufferParameteriv_trace;}
+if(this->m_ptr_glGetQueryIndexediv){this->m_orig_glGetQueryIndexediv = this->m_ptr_glGetQueryIndexediv;this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&TraceTableDecorator::m_glGetQueryIndexediv_trace;}
+if(this->m_ptr_glFramebufferTexture3DEXT){this->m_orig_glFramebufferTexture3DEXT = this->m_ptr_glFramebufferTexture3DEXT;this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&TraceTableDecorator::m_glFramebufferTexture3DEXT_trace;}
+if(this->m_ptr_glLoadTransposeMatrixxOES){this->m_orig_glLoadTransposeMatrixxOES = this->m_ptr_glLoadTransposeMatrixxOES;this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&TraceTableDecorator::m_glLoadTransposeMatrixxOES_trace;}
+if(this->m_ptr_glDeleteTransformFeedbacksNV){this->m_orig_glDeleteTransformFeedbacksNV = this->m_ptr_glDeleteTransformFeedbacksNV;this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&TraceTableDecorator::m_glDeleteTransformFeedbacksNV_trace;}
+if(this->m_ptr_glGetCompressedTextureImageEXT){this->m_orig_glGetCompressedTextureImageEXT = this->m_ptr_glGetCompressedTextureImageEXT;this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&TraceTableDecorator::m_glGetCompressedTextureImageEXT_trace;}
+if(this->m_ptr_glIndexMaterialEXT){this->m_orig_glIndexMaterialEXT = this->m_ptr_glIndexMaterialEXT;this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&TraceTableDecorator::m_glIndexMaterialEXT_trace;}
+if(this->m_ptr_glFogCoorddEXT){this->m_orig_glFogCoorddEXT = this->m_ptr_glFogCoorddEXT;this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&TraceTableDecorator::m_glFogCoorddEXT_trace;}
+if(this->m_ptr_glTexCoord2hvNV){this->m_orig_glTexCoord2hvNV = this->m_ptr_glTexCoord2hvNV;this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&TraceTableDecorator::m_glTexCoord2hvNV_trace;}
+if(this->m_ptr_glGetFramebufferParameterfvAMD){this->m_orig_glGetFramebufferParameterfvAMD = this->m_ptr_glGetFramebufferParameterfvAMD;this->m_ptr_glGetFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)&TraceTableDecorator::m_glGetFramebufferParameterfvAMD_trace;}
+if(this->m_ptr_glTexEnviv){this->m_orig_glTexEnviv = this->m_ptr_glTexEnviv;this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&TraceTableDecorator::m_glTexEnviv_trace;}
+if(this->m_ptr_glEndTransformFeedbackNV){this->m_orig_glEndTransformFeedbackNV = this->m_ptr_glEndTransformFeedbackNV;this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&TraceTableDecorator::m_glEndTransformFeedbackNV_trace;}
+if(this->m_ptr_glGlobalAlphaFactoruiSUN){this->m_orig_glGlobalAlphaFactoruiSUN = this->m_ptr_glGlobalAlphaFactoruiSUN;this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&TraceTableDecorator::m_glGlobalAlphaFactoruiSUN_trace;}
+if(this->m_ptr_glSelectBuffer){this->m_orig_glSelectBuffer = this->m_ptr_glSelectBuffer;this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&TraceTableDecorator::m_glSelectBuffer_trace;}
+if(this->m_ptr_glNamedBufferSubDataEXT){this->m_orig_glNamedBufferSubDataEXT = this->m_ptr_glNamedBufferSubDataEXT;this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&TraceTableDecorator::m_glNamedBufferSubDataEXT_trace;}
+if(this->m_ptr_glDisableVertexArrayAttrib){this->m_orig_glDisableVertexArrayAttrib = this->m_ptr_glDisableVertexArrayAttrib;this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&TraceTableDecorator::m_glDisableVertexArrayAttrib_trace;}
+if(this->m_ptr_glBlendFunc){this->m_orig_glBlendFunc = this->m_ptr_glBlendFunc;this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&TraceTableDecorator::m_glBlendFunc_trace;}
+if(this->m_ptr_glCreateProgram){this->m_orig_glCreateProgram = this->m_ptr_glCreateProgram;this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&TraceTableDecorator::m_glCreateProgram_trace;}
+if(this->m_ptr_glVertexStream2dATI){this->m_orig_glVertexStream2dATI = this->m_ptr_glVertexStream2dATI;this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&TraceTableDecorator::m_glVertexStream2dATI_trace;}
+if(this->m_ptr_glUniform4ui64vARB){this->m_orig_glUniform4ui64vARB = this->m_ptr_glUniform4ui64vARB;this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&TraceTableDecorator::m_glUniform4ui64vARB_trace;}
+if(this->m_ptr_glGetSemaphoreParameterui64vEXT){this->m_orig_glGetSemaphoreParameterui64vEXT = this->m_ptr_glGetSemaphoreParameterui64vEXT;this->m_ptr_glGetSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)&TraceTableDecorator::m_glGetSemaphoreParameterui64vEXT_trace;}
+if(this->m_ptr_glPrimitiveRestartIndex){this->m_orig_glPrimitiveRestartIndex = this->m_ptr_glPrimitiveRestartIndex;this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&TraceTableDecorator::m_glPrimitiveRestartIndex_trace;}
+if(this->m_ptr_glNormalStream3fATI){this->m_orig_glNormalStream3fATI = this->m_ptr_glNormalStream3fATI;this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&TraceTableDecorator::m_glNormalStream3fATI_trace;}
+if(this->m_ptr_glProgramUniformMatrix2fv){this->m_orig_glProgramUniformMatrix2fv = this->m_ptr_glProgramUniformMatrix2fv;this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix2fv_trace;}
+if(this->m_ptr_glVertexAttribs1hvNV){this->m_orig_glVertexAttribs1hvNV = this->m_ptr_glVertexAttribs1hvNV;this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&TraceTableDecorator::m_glVertexAttribs1hvNV_trace;}
+if(this->m_ptr_glWindowPos4svMESA){this->m_orig_glWindowPos4svMESA = this->m_ptr_glWindowPos4svMESA;this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&TraceTableDecorator::m_glWindowPos4svMESA_trace;}
+if(this->m_ptr_glDeleteFragmentShaderATI){this->m_orig_glDeleteFragmentShaderATI = this->m_ptr_glDeleteFragmentShaderATI;this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&TraceTableDecorator::m_glDeleteFragmentShaderATI_trace;}
+if(this->m_ptr_glBindImageTextures){this->m_orig_glBindImageTextures = this->m_ptr_glBindImageTextures;this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&TraceTableDecorator::m_glBindImageTextures_trace;}
+if(this->m_ptr_glMap2xOES){this->m_orig_glMap2xOES = this->m_ptr_glMap2xOES;this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&TraceTableDecorator::m_glMap2xOES_trace;}
+if(this->m_ptr_glEnd){this->m_orig_glEnd = this->m_ptr_glEnd;this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&TraceTableDecorator::m_glEnd_trace;}
+if(this->m_ptr_glMultiTexCoord2dARB){this->m_orig_glMultiTexCoord2dARB = this->m_ptr_glMultiTexCoord2dARB;this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&TraceTableDecorator::m_glMultiTexCoord2dARB_trace;}
+if(this->m_ptr_glUniform1i64NV){this->m_orig_glUniform1i64NV = this->m_ptr_glUniform1i64NV;this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&TraceTableDecorator::m_glUniform1i64NV_trace;}
+if(this->m_ptr_glPathStringNV){this->m_orig_glPathStringNV = this->m_ptr_glPathStringNV;this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&TraceTableDecorator::m_glPathStringNV_trace;}
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT){this->m_orig_glGetNamedFramebufferParameterivEXT = this->m_ptr_glGetNamedFramebufferParameterivEXT;this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&TraceTableDecorator::m_glGetNamedFramebufferParameterivEXT_trace;}
+if(this->m_ptr_glGetProgramNamedParameterdvNV){this->m_orig_glGetProgramNamedParameterdvNV = this->m_ptr_glGetProgramNamedParameterdvNV;this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&TraceTableDecorator::m_glGetProgramNamedParameterdvNV_trace;}
+if(this->m_ptr_glPathDashArrayNV){this->m_orig_glPathDashArrayNV = this->m_ptr_glPathDashArrayNV;this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&TraceTableDecorator::m_glPathDashArrayNV_trace;}
+if(this->m_ptr_glUniform3uiv){this->m_orig_glUniform3uiv = this->m_ptr_glUniform3uiv;this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&TraceTableDecorator::m_glUniform3uiv_trace;}
+if(this->m_ptr_glColor3fVertex3fvSUN){this->m_orig_glColor3fVertex3fvSUN = this->m_ptr_glColor3fVertex3fvSUN;this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&TraceTableDecorator::m_glColor3fVertex3fvSUN_trace;}
+if(this->m_ptr_glMultTransposeMatrixd){this->m_orig_glMultTransposeMatrixd = this->m_ptr_glMultTransposeMatrixd;this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&TraceTableDecorator::m_glMultTransposeMatrixd_trace;}
+if(this->m_ptr_glClearColor){this->m_orig_glClearColor = this->m_ptr_glClearColor;this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&TraceTableDecorator::m_glClearColor_trace;}
+if(this->m_ptr_glGetImageHandleARB){this->m_orig_glGetImageHandleARB = this->m_ptr_glGetImageHandleARB;this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&TraceTableDecorator::m_glGetImageHandleARB_trace;}
+if(this->m_ptr_glTangent3dEXT){this->m_orig_glTangent3dEXT = this->m_ptr_glTangent3dEXT;this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&TraceTableDecorator::m_glTangent3dEXT_trace;}
+if(this->m_ptr_glGetQueryObjectivARB){this->m_orig_glGetQueryObjectivARB = this->m_ptr_glGetQueryObjectivARB;this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&TraceTableDecorator::m_glGetQueryObjectivARB_trace;}
+if(this->m_ptr_glGetLocalConstantFloatvEXT){this->m_orig_glGetLocalConstantFloatvEXT = this->m_ptr_glGetLocalConstantFloatvEXT;this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&TraceTableDecorator::m_glGetLocalConstantFloatvEXT_trace;}
+if(this->m_ptr_glUseShaderProgramEXT){this->m_orig_glUseShaderProgramEXT = this->m_ptr_glUseShaderProgramEXT;this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&TraceTableDecorator::m_glUseShaderProgramEXT_trace;}
+if(this->m_ptr_glBindRenderbufferEXT){this->m_orig_glBindRenderbufferEXT = this->m_ptr_glBindRenderbufferEXT;this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&TraceTableDecorator::m_glBindRenderbufferEXT_trace;}
+if(this->m_ptr_glInterleavedArrays){this->m_orig_glInterleavedArrays = this->m_ptr_glInterleavedArrays;this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&TraceTableDecorator::m_glInterleavedArrays_trace;}
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD){this->m_orig_glGetPerfMonitorGroupStringAMD = this->m_ptr_glGetPerfMonitorGroupStringAMD;this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&TraceTableDecorator::m_glGetPerfMonitorGroupStringAMD_trace;}
+if(this->m_ptr_glUniform3ui){this->m_orig_glUniform3ui = this->m_ptr_glUniform3ui;this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&TraceTableDecorator::m_glUniform3ui_trace;}
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT){this->m_orig_glGetNamedProgramLocalParameterdvEXT = this->m_ptr_glGetNamedProgramLocalParameterdvEXT;this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&TraceTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_trace;}
+if(this->m_ptr_glDeleteQueryResourceTagNV){this->m_orig_glDeleteQueryResourceTagNV = this->m_ptr_glDeleteQueryResourceTagNV;this->m_ptr_glDeleteQueryResourceTagNV = (FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC)&TraceTableDecorator::m_glDeleteQueryResourceTagNV_trace;}
+if(this->m_ptr_glVertexAttribI4uiv){this->m_orig_glVertexAttribI4uiv = this->m_ptr_glVertexAttribI4uiv;this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&TraceTableDecorator::m_glVertexAttribI4uiv_trace;}
+if(this->m_ptr_glVertexAttrib4bv){this->m_orig_glVertexAttrib4bv = this->m_ptr_glVertexAttrib4bv;this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&TraceTableDecorator::m_glVertexAttrib4bv_trace;}
+if(this->m_ptr_glMultiTexCoord3xOES){this->m_orig_glMultiTexCoord3xOES = this->m_ptr_glMultiTexCoord3xOES;this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&TraceTableDecorator::m_glMultiTexCoord3xOES_trace;}
+if(this->m_ptr_glSecondaryColor3ub){this->m_orig_glSecondaryColor3ub = this->m_ptr_glSecondaryColor3ub;this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&TraceTableDecorator::m_glSecondaryColor3ub_trace;}
+if(this->m_ptr_glFragmentMaterialfSGIX){this->m_orig_glFragmentMaterialfSGIX = this->m_ptr_glFragmentMaterialfSGIX;this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&TraceTableDecorator::m_glFragmentMaterialfSGIX_trace;}
+if(this->m_ptr_glGetVariantArrayObjectivATI){this->m_orig_glGetVariantArrayObjectivATI = this->m_ptr_glGetVariantArrayObjectivATI;this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&TraceTableDecorator::m_glGetVariantArrayObjectivATI_trace;}
+if(this->m_ptr_glSecondaryColor3ui){this->m_orig_glSecondaryColor3ui = this->m_ptr_glSecondaryColor3ui;this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&TraceTableDecorator::m_glSecondaryColor3ui_trace;}
+if(this->m_ptr_glVertexAttrib1dARB){this->m_orig_glVertexAttrib1dARB = this->m_ptr_glVertexAttrib1dARB;this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&TraceTableDecorator::m_glVertexAttrib1dARB_trace;}
+if(this->m_ptr_glGetNamedBufferPointerv){this->m_orig_glGetNamedBufferPointerv = this->m_ptr_glGetNamedBufferPointerv;this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&TraceTableDecorator::m_glGetNamedBufferPointerv_trace;}
+if(this->m_ptr_glLockArraysEXT){this->m_orig_glLockArraysEXT = this->m_ptr_glLockArraysEXT;this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&TraceTableDecorator::m_glLockArraysEXT_trace;}
+if(this->m_ptr_glVertexAttribPointerNV){this->m_orig_glVertexAttribPointerNV = this->m_ptr_glVertexAttribPointerNV;this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&TraceTableDecorator::m_glVertexAttribPointerNV_trace;}
+if(this->m_ptr_glConvolutionParameterf){this->m_orig_glConvolutionParameterf = this->m_ptr_glConvolutionParameterf;this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&TraceTableDecorator::m_glConvolutionParameterf_trace;}
+if(this->m_ptr_glBindBufferBaseEXT){this->m_orig_glBindBufferBaseEXT = this->m_ptr_glBindBufferBaseEXT;this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&TraceTableDecorator::m_glBindBufferBaseEXT_trace;}
+if(this->m_ptr_glTexCoord2xvOES){this->m_orig_glTexCoord2xvOES = this->m_ptr_glTexCoord2xvOES;this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&TraceTableDecorator::m_glTexCoord2xvOES_trace;}
+if(this->m_ptr_glGetQueryBufferObjectui64v){this->m_orig_glGetQueryBufferObjectui64v = this->m_ptr_glGetQueryBufferObjectui64v;this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&TraceTableDecorator::m_glGetQueryBufferObjectui64v_trace;}
+if(this->m_ptr_glSetMultisamplefvAMD){this->m_orig_glSetMultisamplefvAMD = this->m_ptr_glSetMultisamplefvAMD;this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&TraceTableDecorator::m_glSetMultisamplefvAMD_trace;}
+if(this->m_ptr_glPathColorGenNV){this->m_orig_glPathColorGenNV = this->m_ptr_glPathColorGenNV;this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&TraceTableDecorator::m_glPathColorGenNV_trace;}
+if(this->m_ptr_glVertexAttrib3sARB){this->m_orig_glVertexAttrib3sARB = this->m_ptr_glVertexAttrib3sARB;this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&TraceTableDecorator::m_glVertexAttrib3sARB_trace;}
+if(this->m_ptr_glVertexAttrib4ivARB){this->m_orig_glVertexAttrib4ivARB = this->m_ptr_glVertexAttrib4ivARB;this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&TraceTableDecorator::m_glVertexAttrib4ivARB_trace;}
+if(this->m_ptr_glGenTransformFeedbacks){this->m_orig_glGenTransformFeedbacks = this->m_ptr_glGenTransformFeedbacks;this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&TraceTableDecorator::m_glGenTransformFeedbacks_trace;}
+if(this->m_ptr_glGetVertexAttribIuiv){this->m_orig_glGetVertexAttribIuiv = this->m_ptr_glGetVertexAttribIuiv;this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&TraceTableDecorator::m_glGetVertexAttribIuiv_trace;}
+if(this->m_ptr_glPixelTransformParameterfEXT){this->m_orig_glPixelTransformParameterfEXT = this->m_ptr_glPixelTransformParameterfEXT;this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&TraceTableDecorator::m_glPixelTransformParameterfEXT_trace;}
+if(this->m_ptr_glGetTexParameterIuivEXT){this->m_orig_glGetTexParameterIuivEXT = this->m_ptr_glGetTexParameterIuivEXT;this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&TraceTableDecorator::m_glGetTexParameterIuivEXT_trace;}
+if(this->m_ptr_glGetObjectParameterivARB){this->m_orig_glGetObjectParameterivARB = this->m_ptr_glGetObjectParameterivARB;this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&TraceTableDecorator::m_glGetObjectParameterivARB_trace;}
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT){this->m_orig_glVertexArraySecondaryColorOffsetEXT = this->m_ptr_glVertexArraySecondaryColorOffsetEXT;this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&TraceTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_trace;}
+if(this->m_ptr_glWindowPos2fARB){this->m_orig_glWindowPos2fARB = this->m_ptr_glWindowPos2fARB;this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&TraceTableDecorator::m_glWindowPos2fARB_trace;}
+if(this->m_ptr_glCompressedTexSubImage2D){this->m_orig_glCompressedTexSubImage2D = this->m_ptr_glCompressedTexSubImage2D;this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&TraceTableDecorator::m_glCompressedTexSubImage2D_trace;}
+if(this->m_ptr_glCompressedTexSubImage3DARB){this->m_orig_glCompressedTexSubImage3DARB = this->m_ptr_glCompressedTexSubImage3DARB;this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&TraceTableDecorator::m_glCompressedTexSubImage3DARB_trace;}
+if(this->m_ptr_glProgramBinary){this->m_orig_glProgramBinary = this->m_ptr_glProgramBinary;this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&TraceTableDecorator::m_glProgramBinary_trace;}
+if(this->m_ptr_glPresentFrameKeyedNV){this->m_orig_glPresentFrameKeyedNV = this->m_ptr_glPresentFrameKeyedNV;this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&TraceTableDecorator::m_glPresentFrameKeyedNV_trace;}
+if(this->m_ptr_glVertexAttribI4bv){this->m_orig_glVertexAttribI4bv = this->m_ptr_glVertexAttribI4bv;this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&TraceTableDecorator::m_glVertexAttribI4bv_trace;}
+if(this->m_ptr_glPathCoverDepthFuncNV){this->m_orig_glPathCoverDepthFuncNV = this->m_ptr_glPathCoverDepthFuncNV;this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&TraceTableDecorator::m_glPathCoverDepthFuncNV_trace;}
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV){this->m_orig_glTransformFeedbackStreamAttribsNV = this->m_ptr_glTransformFeedbackStreamAttribsNV;this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&TraceTableDecorator::m_glTransformFeedbackStreamAttribsNV_trace;}
+if(this->m_ptr_glSecondaryColor3usEXT){this->m_orig_glSecondaryColor3usEXT = this->m_ptr_glSecondaryColor3usEXT;this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&TraceTableDecorator::m_glSecondaryColor3usEXT_trace;}
+if(this->m_ptr_glCopyColorTableSGI){this->m_orig_glCopyColorTableSGI = this->m_ptr_glCopyColorTableSGI;this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&TraceTableDecorator::m_glCopyColorTableSGI_trace;}
+if(this->m_ptr_glProgramEnvParameter4fvARB){this->m_orig_glProgramEnvParameter4fvARB = this->m_ptr_glProgramEnvParameter4fvARB;this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&TraceTableDecorator::m_glProgramEnvParameter4fvARB_trace;}
+if(this->m_ptr_glMultiTexCoord4sARB){this->m_orig_glMultiTexCoord4sARB = this->m_ptr_glMultiTexCoord4sARB;this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&TraceTableDecorator::m_glMultiTexCoord4sARB_trace;}
+if(this->m_ptr_glGetVertexArrayIndexed64iv){this->m_orig_glGetVertexArrayIndexed64iv = this->m_ptr_glGetVertexArrayIndexed64iv;this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&TraceTableDecorator::m_glGetVertexArrayIndexed64iv_trace;}
+if(this->m_ptr_glMatrixMultTranspose3x3fNV){this->m_orig_glMatrixMultTranspose3x3fNV = this->m_ptr_glMatrixMultTranspose3x3fNV;this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&TraceTableDecorator::m_glMatrixMultTranspose3x3fNV_trace;}
+if(this->m_ptr_glTexParameterIiv){this->m_orig_glTexParameterIiv = this->m_ptr_glTexParameterIiv;this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&TraceTableDecorator::m_glTexParameterIiv_trace;}
+if(this->m_ptr_glVertexArrayAttribFormat){this->m_orig_glVertexArrayAttribFormat = this->m_ptr_glVertexArrayAttribFormat;this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&TraceTableDecorator::m_glVertexArrayAttribFormat_trace;}
+if(this->m_ptr_glEndTransformFeedback){this->m_orig_glEndTransformFeedback = this->m_ptr_glEndTransformFeedback;this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&TraceTableDecorator::m_glEndTransformFeedback_trace;}
+if(this->m_ptr_glDrawCommandsStatesAddressNV){this->m_orig_glDrawCommandsStatesAddressNV = this->m_ptr_glDrawCommandsStatesAddressNV;this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&TraceTableDecorator::m_glDrawCommandsStatesAddressNV_trace;}
+if(this->m_ptr_glUniform4ui64NV){this->m_orig_glUniform4ui64NV = this->m_ptr_glUniform4ui64NV;this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&TraceTableDecorator::m_glUniform4ui64NV_trace;}
+if(this->m_ptr_glMaterialiv){this->m_orig_glMaterialiv = this->m_ptr_glMaterialiv;this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&TraceTableDecorator::m_glMaterialiv_trace;}
+if(this->m_ptr_glTexImage2DMultisample){this->m_orig_glTexImage2DMultisample = this->m_ptr_glTexImage2DMultisample;this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&TraceTableDecorator::m_glTexImage2DMultisample_trace;}
+if(this->m_ptr_glBindTextureEXT){this->m_orig_glBindTextureEXT = this->m_ptr_glBindTextureEXT;this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&TraceTableDecorator::m_glBindTextureEXT_trace;}
+if(this->m_ptr_glIsBuffer){this->m_orig_glIsBuffer = this->m_ptr_glIsBuffer;this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&TraceTableDecorator::m_glIsBuffer_trace;}
+if(this->m_ptr_glVertexAttribI1iv){this->m_orig_glVertexAttribI1iv = this->m_ptr_glVertexAttribI1iv;this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&TraceTableDecorator::m_glVertexAttribI1iv_trace;}
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV){this->m_orig_glGetFinalCombinerInputParameterfvNV = this->m_ptr_glGetFinalCombinerInputParameterfvNV;this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&TraceTableDecorator::m_glGetFinalCombinerInputParameterfvNV_trace;}
+if(this->m_ptr_glMultiTexCoord3bvOES){this->m_orig_glMultiTexCoord3bvOES = this->m_ptr_glMultiTexCoord3bvOES;this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&TraceTableDecorator::m_glMultiTexCoord3bvOES_trace;}
+if(this->m_ptr_glVertexAttribDivisor){this->m_orig_glVertexAttribDivisor = this->m_ptr_glVertexAttribDivisor;this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&TraceTableDecorator::m_glVertexAttribDivisor_trace;}
+if(this->m_ptr_glCopyBufferSubData){this->m_orig_glCopyBufferSubData = this->m_ptr_glCopyBufferSubData;this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&TraceTableDecorator::m_glCopyBufferSubData_trace;}
+if(this->m_ptr_glBindTexGenParameterEXT){this->m_orig_glBindTexGenParameterEXT = this->m_ptr_glBindTexGenParameterEXT;this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&TraceTableDecorator::m_glBindTexGenParameterEXT_trace;}
+if(this->m_ptr_glNormalStream3bATI){this->m_orig_glNormalStream3bATI = this->m_ptr_glNormalStream3bATI;this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&TraceTableDecorator::m_glNormalStream3bATI_trace;}
+if(this->m_ptr_glTexStorageMem2DEXT){this->m_orig_glTexStorageMem2DEXT = this->m_ptr_glTexStorageMem2DEXT;this->m_ptr_glTexStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC)&TraceTableDecorator::m_glTexStorageMem2DEXT_trace;}
+if(this->m_ptr_glTextureImage2DEXT){this->m_orig_glTextureImage2DEXT = this->m_ptr_glTextureImage2DEXT;this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&TraceTableDecorator::m_glTextureImage2DEXT_trace;}
+if(this->m_ptr_glGetColorTableParameteriv){this->m_orig_glGetColorTableParameteriv = this->m_ptr_glGetColorTableParameteriv;this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&TraceTableDecorator::m_glGetColorTableParameteriv_trace;}
+if(this->m_ptr_glActiveTextureARB){this->m_orig_glActiveTextureARB = this->m_ptr_glActiveTextureARB;this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&TraceTableDecorator::m_glActiveTextureARB_trace;}
+if(this->m_ptr_glTexCoord4xOES){this->m_orig_glTexCoord4xOES = this->m_ptr_glTexCoord4xOES;this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&TraceTableDecorator::m_glTexCoord4xOES_trace;}
+if(this->m_ptr_glNamedBufferStorageExternalEXT){this->m_orig_glNamedBufferStorageExternalEXT = this->m_ptr_glNamedBufferStorageExternalEXT;this->m_ptr_glNamedBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)&TraceTableDecorator::m_glNamedBufferStorageExternalEXT_trace;}
+if(this->m_ptr_glSecondaryColor3fvEXT){this->m_orig_glSecondaryColor3fvEXT = this->m_ptr_glSecondaryColor3fvEXT;this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&TraceTableDecorator::m_glSecondaryColor3fvEXT_trace;}
+if(this->m_ptr_glUniformMatrix4x2fv){this->m_orig_glUniformMatrix4x2fv = this->m_ptr_glUniformMatrix4x2fv;this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&TraceTableDecorator::m_glUniformMatrix4x2fv_trace;}
+if(this->m_ptr_glStartInstrumentsSGIX){this->m_orig_glStartInstrumentsSGIX = this->m_ptr_glStartInstrumentsSGIX;this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&TraceTableDecorator::m_glStartInstrumentsSGIX_trace;}
+if(this->m_ptr_glProgramNamedParameter4fvNV){this->m_orig_glProgramNamedParameter4fvNV = this->m_ptr_glProgramNamedParameter4fvNV;this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&TraceTableDecorator::m_glProgramNamedParameter4fvNV_trace;}
+if(this->m_ptr_glEndVideoCaptureNV){this->m_orig_glEndVideoCaptureNV = this->m_ptr_glEndVideoCaptureNV;this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&TraceTableDecorator::m_glEndVideoCaptureNV_trace;}
+if(this->m_ptr_glGenLists){this->m_orig_glGenLists = this->m_ptr_glGenLists;this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&TraceTableDecorator::m_glGenLists_trace;}
+if(this->m_ptr_glUniform1fARB){this->m_orig_glUniform1fARB = this->m_ptr_glUniform1fARB;this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&TraceTableDecorator::m_glUniform1fARB_trace;}
+if(this->m_ptr_glNamedFramebufferTexture1DEXT){this->m_orig_glNamedFramebufferTexture1DEXT = this->m_ptr_glNamedFramebufferTexture1DEXT;this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&TraceTableDecorator::m_glNamedFramebufferTexture1DEXT_trace;}
+if(this->m_ptr_glMapBufferRange){this->m_orig_glMapBufferRange = this->m_ptr_glMapBufferRange;this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&TraceTableDecorator::m_glMapBufferRange_trace;}
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB){this->m_orig_glMultiDrawElementsIndirectCountARB = this->m_ptr_glMultiDrawElementsIndirectCountARB;this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&TraceTableDecorator::m_glMultiDrawElementsIndirectCountARB_trace;}
+if(this->m_ptr_glProgramUniformMatrix4x2fv){this->m_orig_glProgramUniformMatrix4x2fv = this->m_ptr_glProgramUniformMatrix4x2fv;this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&TraceTableDecorator::m_glProgramUniformMatrix4x2fv_trace;}
+if(this->m_ptr_glGetTextureParameterIivEXT){this->m_orig_glGetTextureParameterIivEXT = this->m_ptr_glGetTextureParameterIivEXT;this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glGetTextureParameterIivEXT_trace;}
+if(this->m_ptr_glMultiTexCoord3hNV){this->m_orig_glMultiTexCoord3hNV = this->m_ptr_glMultiTexCoord3hNV;this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&TraceTableDecorator::m_glMultiTexCoord3hNV_trace;}
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT){this->m_orig_glNamedProgramLocalParametersI4uivEXT = this->m_ptr_glNamedProgramLocalParametersI4uivEXT;this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_trace;}
+if(this->m_ptr_glEndList){this->m_orig_glEndList = this->m_ptr_glEndList;this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&TraceTableDecorator::m_glEndList_trace;}
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN){this->m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN;this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&TraceTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_trace;}
+if(this->m_ptr_glGenTransformFeedbacksNV){this->m_orig_glGenTransformFeedbacksNV = this->m_ptr_glGenTransformFeedbacksNV;this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&TraceTableDecorator::m_glGenTransformFeedbacksNV_trace;}
+if(this->m_ptr_glEdgeFlagv){this->m_orig_glEdgeFlagv = this->m_ptr_glEdgeFlagv;this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&TraceTableDecorator::m_glEdgeFlagv_trace;}
+if(this->m_ptr_glVertexAttribI2iv){this->m_orig_glVertexAttribI2iv = this->m_ptr_glVertexAttribI2iv;this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&TraceTableDecorator::m_glVertexAttribI2iv_trace;}
+if(this->m_ptr_glCopyMultiTexImage2DEXT){this->m_orig_glCopyMultiTexImage2DEXT = this->m_ptr_glCopyMultiTexImage2DEXT;this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&TraceTableDecorator::m_glCopyMultiTexImage2DEXT_trace;}
+if(this->m_ptr_glUniformMatrix3x2dv){this->m_orig_glUniformMatrix3x2dv = this->m_ptr_glUniformMatrix3x2dv;this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&TraceTableDecorator::m_glUniformMatrix3x2dv_trace;}
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV){this->m_orig_glTexImage3DMultisampleCoverageNV = this->m_ptr_glTexImage3DMultisampleCoverageNV;this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&TraceTableDecorator::m_glTexImage3DMultisampleCoverageNV_trace;}
+if(this->m_ptr_glGetShaderPrecisionFormat){this->m_orig_glGetShaderPrecisionFormat = this->m_ptr_glGetShaderPrecisionFormat;this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&TraceTableDecorator::m_glGetShaderPrecisionFormat_trace;}
+if(this->m_ptr_glTexSubImage4DSGIS){this->m_orig_glTexSubImage4DSGIS = this->m_ptr_glTexSubImage4DSGIS;this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&TraceTableDecorator::m_glTexSubImage4DSGIS_trace;}
+if(this->m_ptr_glRasterSamplesEXT){this->m_orig_glRasterSamplesEXT = this->m_ptr_glRasterSamplesEXT;this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&TraceTableDecorator::m_glRasterSamplesEXT_trace;}
+if(this->m_ptr_glTextureView){this->m_orig_glTextureView = this->m_ptr_glTextureView;this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&TraceTableDecorator::m_glTextureView_trace;}
+if(this->m_ptr_glEvalMapsNV){this->m_orig_glEvalMapsNV = this->m_ptr_glEvalMapsNV;this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&TraceTableDecorator::m_glEvalMapsNV_trace;}
+if(this->m_ptr_glGetFragDataLocationEXT){this->m_orig_glGetFragDataLocationEXT = this->m_ptr_glGetFragDataLocationEXT;this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&TraceTableDecorator::m_glGetFragDataLocationEXT_trace;}
+if(this->m_ptr_glGetCompressedMultiTexImageEXT){this->m_orig_glGetCompressedMultiTexImageEXT = this->m_ptr_glGetCompressedMultiTexImageEXT;this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&TraceTableDecorator::m_glGetCompressedMultiTexImageEXT_trace;}
+if(this->m_ptr_glIndexMask){this->m_orig_glIndexMask = this->m_ptr_glIndexMask;this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&TraceTableDecorator::m_glIndexMask_trace;}
+if(this->m_ptr_glPushClientAttrib){this->m_orig_glPushClientAttrib = this->m_ptr_glPushClientAttrib;this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&TraceTableDecorator::m_glPushClientAttrib_trace;}
+if(this->m_ptr_glShaderSource){this->m_orig_glShaderSource = this->m_ptr_glShaderSource;this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&TraceTableDecorator::m_glShaderSource_trace;}
+if(this->m_ptr_glDispatchComputeGroupSizeARB){this->m_orig_glDispatchComputeGroupSizeARB = this->m_ptr_glDispatchComputeGroupSizeARB;this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&TraceTableDecorator::m_glDispatchComputeGroupSizeARB_trace;}
+if(this->m_ptr_glLGPUNamedBufferSubDataNVX){this->m_orig_glLGPUNamedBufferSubDataNVX = this->m_ptr_glLGPUNamedBufferSubDataNVX;this->m_ptr_glLGPUNamedBufferSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)&TraceTableDecorator::m_glLGPUNamedBufferSubDataNVX_trace;}
+if(this->m_ptr_glGetnPixelMapfv){this->m_orig_glGetnPixelMapfv = this->m_ptr_glGetnPixelMapfv;this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&TraceTableDecorator::m_glGetnPixelMapfv_trace;}
+if(this->m_ptr_glTexCoordP2uiv){this->m_orig_glTexCoordP2uiv = this->m_ptr_glTexCoordP2uiv;this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&TraceTableDecorator::m_glTexCoordP2uiv_trace;}
+if(this->m_ptr_glUniform2f){this->m_orig_glUniform2f = this->m_ptr_glUniform2f;this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&TraceTableDecorator::m_glUniform2f_trace;}
+if(this->m_ptr_glGetNamedBufferParameteri64v){this->m_orig_glGetNamedBufferParameteri64v = this->m_ptr_glGetNamedBufferParameteri64v;this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&TraceTableDecorator::m_glGetNamedBufferParameteri64v_trace;}
+if(this->m_ptr_glCommandListSegmentsNV){this->m_orig_glCommandListSegmentsNV = this->m_ptr_glCommandListSegmentsNV;this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&TraceTableDecorator::m_glCommandListSegmentsNV_trace;}
+if(this->m_ptr_glTextureParameterIivEXT){this->m_orig_glTextureParameterIivEXT = this->m_ptr_glTextureParameterIivEXT;this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&TraceTableDecorator::m_glTextureParameterIivEXT_trace;}
+if(this->m_ptr_glMultiTexParameterfvEXT){this->m_orig_glMultiTexParameterfvEXT = this->m_ptr_glMultiTexParameterfvEXT;this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&TraceTableDecorator::m_glMultiTexParameterfvEXT_trace;}
+if(this->m_ptr_glProgramUniform2ui64ARB){this->m_orig_glProgramUniform2ui64ARB = this->m_ptr_glProgramUniform2ui64ARB;this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&TraceTableDecorator::m_glProgramUniform2ui64ARB_trace;}
+if(this->m_ptr_glVertex4d){this->m_orig_glVertex4d = this->m_ptr_glVertex4d;this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&TraceTableDecorator::m_glVertex4d_trace;}
+if(this->m_ptr_glNewObjectBufferATI){this->m_orig_glNewObjectBufferATI = this->m_ptr_glNewObjectBufferATI;this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&TraceTableDecorator::m_glNewObjectBufferATI_trace;}
+if(this->m_ptr_glViewportSwizzleNV){this->m_orig_glViewportSwizzleNV = this->m_ptr_glViewportSwizzleNV;this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&TraceTableDecorator::m_glViewportSwizzleNV_trace;}
+if(this->m_ptr_glBufferData){this->m_orig_glBufferData = this->m_ptr_glBufferData;this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&TraceTableDecorator::m_glBufferData_trace;}
+if(this->m_ptr_glTextureImage1DEXT){this->m_orig_glTextureImage1DEXT = this->m_ptr_glTextureImage1DEXT;this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&TraceTableDecorator::m_glTextureImage1DEXT_trace;}
+if(this->m_ptr_glGetTexParameterIiv){this->m_orig_glGetTexParameterIiv = this->m_ptr_glGetTexParameterIiv;this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&TraceTableDecorator::m_glGetTexParameterIiv_trace;}
+if(this->m_ptr_glCopyTexSubImage1DEXT){this->m_orig_glCopyTexSubImage1DEXT = this->m_ptr_glCopyTexSubImage1DEXT;this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&TraceTableDecorator::m_glCopyTexSubImage1DEXT_trace;}
+if(this->m_ptr_glVertex4f){this->m_orig_glVertex4f = this->m_ptr_glVertex4f;this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&TraceTableDecorator::m_glVertex4f_trace;}
+if(this->m_ptr_glUniformMatrix3fvARB){this->m_orig_glUniformMatrix3fvARB = this->m_ptr_glUniformMatrix3fvARB;this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&TraceTableDecorator::m_glUniformMatrix3fvARB_trace;}
+if(this->m_ptr_glTexCoordP1ui){this->m_orig_glTexCoordP1ui = this->m_ptr_glTexCoordP1ui;this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&TraceTableDecorator::m_glTexCoordP1ui_trace;}
+if(this->m_ptr_glPointParameterfvEXT){this->m_orig_glPointParameterfvEXT = this->m_ptr_glPointParameterfvEXT;this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&TraceTableDecorator::m_glPointParameterfvEXT_trace;}
+if(this->m_ptr_glUniform4fARB){this->m_orig_glUniform4fARB = this->m_ptr_glUniform4fARB;this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&TraceTableDecorator::m_glUniform4fARB_trace;}
+if(this->m_ptr_glImportMemoryFdEXT){this->m_orig_glImportMemoryFdEXT = this->m_ptr_glImportMemoryFdEXT;this->m_ptr_glImportMemoryFdEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC)&TraceTableDecorator::m_glImportMemoryFdEXT_trace;}
+if(this->m_ptr_glCopyTextureSubImage3D){this->m_orig_glCopyTextureSubImage3D = this->m_ptr_glCopyTextureSubImage3D;this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&TraceTableDecorator::m_glCopyTextureSubImage3D_trace;}
+if(this->m_ptr_glMultiTexCoord2fv){this->m_orig_glMultiTexCoord2fv = this->m_ptr_glMultiTexCoord2fv;this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&TraceTableDecorator::m_glMultiTexCoord2fv_trace;}
+if(this->m_ptr_glNamedFramebufferSamplePositionsfvAMD){this->m_orig_glNamedFramebufferSamplePositionsfvAMD = this->m_ptr_glNamedFramebufferSamplePositionsfvAMD;this->m_ptr_glNamedFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&TraceTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_trace;}
+if(this->m_ptr_glNormalP3ui){this->m_orig_glNormalP3ui = this->m_ptr_glNormalP3ui;this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&TraceTableDecorator::m_glNormalP3ui_trace;}
+if(this->m_ptr_glDrawRangeElementArrayATI){this->m_orig_glDrawRangeElementArrayATI = this->m_ptr_glDrawRangeElementArrayATI;this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&TraceTableDecorator::m_glDrawRangeElementArrayATI_trace;}
+if(this->m_ptr_glVertexAttribI1i){this->m_orig_glVertexAttribI1i = this->m_ptr_glVertexAttribI1i;this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&TraceTableDecorator::m_glVertexAttribI1i_trace;}
+if(this->m_ptr_glDrawArraysInstancedARB){this->m_orig_glDrawArraysInstancedARB = this->m_ptr_glDrawArraysInstancedARB;this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&TraceTableDecorator::m_glDrawArraysInstancedARB_trace;}
+if(this->m_ptr_glEnableVertexAttribAPPLE){this->m_orig_glEnableVertexAttribAPPLE = this->m_ptr_glEnableVertexAttribAPPLE;this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&TraceTableDecorator::m_glEnableVertexAttribAPPLE_trace;}
+if(this->m_ptr_glGetDebugMessageLogARB){this->m_orig_glGetDebugMessageLogARB = this->m_ptr_glGetDebugMessageLogARB;this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&TraceTableDecorator::m_glGetDebugMessageLogARB_trace;}
+if(this->m_ptr_glGetPathTexGenfvNV){this->m_orig_glGetPathTexGenfvNV = this->m_ptr_glGetPathTexGenfvNV;this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&TraceTableDecorator::m_glGetPathTexGenfvNV_trace;}
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT){this->m_orig_glNamedProgramLocalParameters4fvEXT = this->m_ptr_glNamedProgramLocalParameters4fvEXT;this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&TraceTableDecorator::m_glNamedProgramLocalParameters4fvEXT_trace;}
+if(this->m_ptr_glQueryResourceTagNV){this->m_orig_glQueryResourceTagNV = this->m_ptr_glQueryResourceTagNV;this->m_ptr_glQueryResourceTagNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC)&TraceTableDecorator::m_glQueryResourceTagNV_trace;}
+if(this->m_ptr_glVertexStream3fvATI){this->m_orig_glVertexStream3fvATI = this->m_ptr_glVertexStream3fvATI;this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&TraceTableDecorator::m_glVertexStream3fvATI_trace;}
+if(this->m_ptr_glFramebufferTexture3D){this->m_orig_glFramebufferTexture3D = this->m_ptr_glFramebufferTexture3D;this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&TraceTableDecorator::m_glFramebufferTexture3D_trace;}
+if(this->m_ptr_glCompressedTextureSubImage2DEXT){this->m_orig_glCompressedTextureSubImage2DEXT = this->m_ptr_glCompressedTextureSubImage2DEXT;this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&TraceTableDecorator::m_glCompressedTextureSubImage2DEXT_trace;}
+if(this->m_ptr_glWindowPos3dv){this->m_orig_glWindowPos3dv = this->m_ptr_glWindowPos3dv;this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&TraceTableDecorator::m_glWindowPos3dv_trace;}
+if(this->m_ptr_glCopyConvolutionFilter2D){this->m_orig_glCopyConvolutionFilter2D = this->m_ptr_glCopyConvolutionFilter2D;this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&TraceTableDecorator::m_glCopyConvolutionFilter2D_trace;}
+if(this->m_ptr_glReadInstrumentsSGIX){this->m_orig_glReadInstrumentsSGIX = this->m_ptr_glReadInstrumentsSGIX;this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&TraceTableDecorator::m_glReadInstrumentsSGIX_trace;}
+if(this->m_ptr_glProgramUniform2dvEXT){this->m_orig_glProgramUniform2dvEXT = this->m_ptr_glProgramUniform2dvEXT;this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&TraceTableDecorator::m_glProgramUniform2dvEXT_trace;}
+if(this->m_ptr_glSamplerParameterfv){this->m_orig_glSamplerParameterfv = this->m_ptr_glSamplerParameterfv;this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&TraceTableDecorator::m_glSamplerParameterfv_trace;}
+if(this->m_ptr_glBindBufferARB){this->m_orig_glBindBufferARB = this->m_ptr_glBindBufferARB;this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&TraceTableDecorator::m_glBindBufferARB_trace;}
+if(this->m_ptr_glVertexAttrib1sNV){this->m_orig_glVertexAttrib1sNV = this->m_ptr_glVertexAttrib1sNV;this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&TraceTableDecorator::m_glVertexAttrib1sNV_trace;}
+if(this->m_ptr_glGetMaterialiv){this->m_orig_glGetMaterialiv = this->m_ptr_glGetMaterialiv;this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&TraceTableDecorator::m_glGetMaterialiv_trace;}
+if(this->m_ptr_glUniform1fv){this->m_orig_glUniform1fv = this->m_ptr_glUniform1fv;this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&TraceTableDecorator::m_glUniform1fv_trace;}
+if(this->m_ptr_glBeginOcclusionQueryNV){this->m_orig_glBeginOcclusionQueryNV = this->m_ptr_glBeginOcclusionQueryNV;this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&TraceTableDecorator::m_glBeginOcclusionQueryNV_trace;}
+if(this->m_ptr_glGenFencesAPPLE){this->m_orig_glGenFencesAPPLE = this->m_ptr_glGenFencesAPPLE;this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&TraceTableDecorator::m_glGenFencesAPPLE_trace;}
+if(this->m_ptr_glScissorIndexedv){this->m_orig_glScissorIndexedv = this->m_ptr_glScissorIndexedv;this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&TraceTableDecorator::m_glScissorIndexedv_trace;}
+if(this->m_ptr_glDisableVariantClientStateEXT){this->m_orig_glDisableVariantClientStateEXT = this->m_ptr_glDisableVariantClientStateEXT;this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&TraceTableDecorator::m_glDisableVariantClientStateEXT_trace;}
+if(this->m_ptr_glMinmaxEXT){this->m_orig_glMinmaxEXT = this->m_ptr_glMinmaxEXT;this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&TraceTableDecorator::m_glMinmaxEXT_trace;}
+if(this->m_ptr_glNormalPointervINTEL){this->m_orig_glNormalPointervINTEL = this->m_ptr_glNormalPointervINTEL;this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&TraceTableDecorator::m_glNormalPointervINTEL_trace;}
+if(this->m_ptr_glNormal3s){this->m_orig_glNormal3s = this->m_ptr_glNormal3s;this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&TraceTableDecorator::m_glNormal3s_trace;}
+if(this->m_ptr_glGetnPixelMapuiv){this->m_orig_glGetnPixelMapuiv = this->m_ptr_glGetnPixelMapuiv;this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&TraceTableDecorator::m_glGetnPixelMapuiv_trace;}
+if(this->m_ptr_glNormalStream3bvATI){this->m_orig_glNormalStream3bvATI = this->m_ptr_glNormalStream3bvATI;this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&TraceTableDecorator::m_glNormalStream3bvATI_trace;}
+if(this->m_ptr_glGetObjectParameterivAPPLE){this->m_orig_glGetObjectParameterivAPPLE = this->m_ptr_glGetObjectParameterivAPPLE;this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&TraceTableDecorator::m_glGetObjectParameterivAPPLE_trace;}
+if(this->m_ptr_glNormal3i){this->m_orig_glNormal3i = this->m_ptr_glNormal3i;this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&TraceTableDecorator::m_glNormal3i_trace;}
+if(this->m_ptr_glUniform1ivARB){this->m_orig_glUniform1ivARB = this->m_ptr_glUniform1ivARB;this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&TraceTableDecorator::m_glUniform1ivARB_trace;}
+if(this->m_ptr_glNormal3d){this->m_orig_glNormal3d = this->m_ptr_glNormal3d;this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&TraceTableDecorator::m_glNormal3d_trace;}
+if(this->m_ptr_glUpdateObjectBufferATI){this->m_orig_glUpdateObjectBufferATI = this->m_ptr_glUpdateObjectBufferATI;this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&TraceTableDecorator::m_glUpdateObjectBufferATI_trace;}
+if(this->m_ptr_glNormal3b){this->m_orig_glNormal3b = this->m_ptr_glNormal3b;this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&TraceTableDecorator::m_glNormal3b_trace;}
+if(this->m_ptr_glGetUniformBufferSizeEXT){this->m_orig_glGetUniformBufferSizeEXT = this->m_ptr_glGetUniformBufferSizeEXT;this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&TraceTableDecorator::m_glGetUniformBufferSizeEXT_trace;}
+if(this->m_ptr_glMultiTexCoord4dv){this->m_orig_glMultiTexCoord4dv = this->m_ptr_glMultiTexCoord4dv;this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&TraceTableDecorator::m_glMultiTexCoord4dv_trace;}
+if(this->m_ptr_glProgramUniform3i64ARB){this->m_orig_glProgramUniform3i64ARB = this->m_ptr_glProgramUniform3i64ARB;this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&TraceTableDecorator::m_glProgramUniform3i64ARB_trace;}
+if(this->m_ptr_glVertexAttrib2d){this->m_orig_glVertexAttrib2d = this->m_ptr_glVertexAttrib2d;this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&TraceTableDecorator::m_glVertexAttrib2d_trace;}
+if(this->m_ptr_glVertexAttrib2f){this->m_orig_glVertexAttrib2f = this->m_ptr_glVertexAttrib2f;this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&TraceTableDecorator::m_glVertexAttrib2f_trace;}
+if(this->m_ptr_glMultiDrawElementsEXT){this->m_orig_glMultiDrawElementsEXT = this->m_ptr_glMultiDrawElementsEXT;this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&TraceTableDecorator::m_glMultiDrawElementsEXT_trace;}
+if(this->m_ptr_glVertexAttrib3dv){this->m_orig_glVertexAttrib3dv = this->m_ptr_glVertexAttrib3dv;this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&TraceTableDecorator::m_glVertexAttrib3dv_trace;}
+if(this->m_ptr_glMultiTexCoord2bOES){this->m_orig_glMultiTexCoord2bOES = this->m_ptr_glMultiTexCoord2bOES;this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&TraceTableDecorator::m_glMultiTexCoord2bOES_trace;}
+if(this->m_ptr_glVertexAttrib2s){this->m_orig_glVertexAttrib2s = this->m_ptr_glVertexAttrib2s;this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&TraceTableDecorator::m_glVertexAttrib2s_trace;}
+if(this->m_ptr_glTexImage3DMultisample){this->m_orig_glTexImage3DMultisample = this->m_ptr_glTexImage3DMultisample;this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&TraceTableDecorator::m_glTexImage3DMultisample_trace;}
+if(this->m_ptr_glGetUniformBlockIndex){this->m_orig_glGetUniformBlockIndex = this->m_ptr_glGetUniformBlockIndex;this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&TraceTableDecorator::m_glGetUniformBlockIndex_trace;}
+if(this->m_ptr_glReleaseKeyedMutexWin32EXT){this->m_orig_glReleaseKeyedMutexWin32EXT = this->m_ptr_glReleaseKeyedMutexWin32EXT;this->m_ptr_glReleaseKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)&TraceTableDecorator::m_glReleaseKeyedMutexWin32EXT_trace;}
+if(this->m_ptr_glFrontFace){this->m_orig_glFrontFace = this->m_ptr_glFrontFace;this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&TraceTableDecorator::m_glFrontFace_trace;}
+if(this->m_ptr_glEvalCoord1xOES){this->m_orig_glEvalCoord1xOES = this->m_ptr_glEvalCoord1xOES;this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&TraceTableDecorator::m_glEvalCoord1xOES_trace;}
+if(this->m_ptr_glDrawArraysInstancedBaseInstance){this->m_orig_glDrawArraysInstancedBaseInstance = this->m_ptr_glDrawArraysInstancedBaseInstance;this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&TraceTableDecorator::m_glDrawArraysInstancedBaseInstance_trace;}
+if(this->m_ptr_glIsPointInStrokePathNV){this->m_orig_glIsPointInStrokePathNV = this->m_ptr_glIsPointInStrokePathNV;this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&TraceTableDecorator::m_glIsPointInStrokePathNV_trace;}
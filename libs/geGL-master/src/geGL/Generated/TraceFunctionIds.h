@@ -0,0 +1,2926 @@
+TRACE_glMultiDrawArraysIndirectBindlessCountNV,
+TRACE_glTextureParameterfv,
+TRACE_glGetListParameterivSGIX,
+TRACE_glProgramUniform1i64ARB,
+TRACE_glVertexArrayElementBuffer,
+TRACE_glHintPGI,
+TRACE_glStencilMaskSeparate,
+TRACE_glGetFramebufferAttachmentParameterivEXT,
+TRACE_glTextureStorage3DMultisample,
+TRACE_glGetIntegerIndexedvEXT,
+TRACE_glCopyTexImage1D,
+TRACE_glVertexAttrib4usv,
+TRACE_glTexRenderbufferNV,
+TRACE_glVertexAttrib3hvNV,
+TRACE_glProgramUniform4ui64ARB,
+TRACE_glInstrumentsBufferSGIX,
+TRACE_glIndexi,
+TRACE_glMultiTexCoord2sARB,
+TRACE_glProgramEnvParameter4fARB,
+TRACE_glCompressedTexSubImage3D,
+TRACE_glEvalCoord2d,
+TRACE_glEvalCoord2f,
+TRACE_glIndexd,
+TRACE_glSecondaryColor3hvNV,
+TRACE_glIndexf,
+TRACE_glFrustumxOES,
+TRACE_glTextureStorage3DEXT,
+TRACE_glDrawCommandsStatesNV,
+TRACE_glUniform4uiEXT,
+TRACE_glProgramUniform3ui64ARB,
+TRACE_glIndexs,
+TRACE_glVertexArrayBindVertexBufferEXT,
+TRACE_glConvolutionParameteriEXT,
+TRACE_glColor4ubVertex2fSUN,
+TRACE_glProgramUniform1ivEXT,
+TRACE_glGetnMapfv,
+TRACE_glTransformFeedbackBufferRange,
+TRACE_glPathGlyphsNV,
+TRACE_glSecondaryColor3fv,
+TRACE_glGetCombinerInputParameterivNV,
+TRACE_glEndPerfMonitorAMD,
+TRACE_glPointParameterfvARB,
+TRACE_glVertex2xOES,
+TRACE_glDrawElementsInstancedBaseInstance,
+TRACE_glMultTransposeMatrixdARB,
+TRACE_glVertexAttribL4dEXT,
+TRACE_glVertex4iv,
+TRACE_glCoverStrokePathInstancedNV,
+TRACE_glDeformSGIX,
+TRACE_glUniform2ui64NV,
+TRACE_glCopyPathNV,
+TRACE_glVertexAttribP4ui,
+TRACE_glVertexAttribL2d,
+TRACE_glGetMultisamplefv,
+TRACE_glCompressedMultiTexSubImage3DEXT,
+TRACE_glVDPAURegisterOutputSurfaceNV,
+TRACE_glMinSampleShading,
+TRACE_glProgramUniform4fEXT,
+TRACE_glCoverStrokePathNV,
+TRACE_glTextureImage2DMultisampleNV,
+TRACE_glVertex3bOES,
+TRACE_glImportMemoryWin32HandleEXT,
+TRACE_glTessellationFactorAMD,
+TRACE_glDebugMessageControl,
+TRACE_glIsObjectBufferATI,
+TRACE_glPopAttrib,
+TRACE_glProgramUniform4iEXT,
+TRACE_glVertexAttrib4ubNV,
+TRACE_glColorMaterial,
+TRACE_glVertexAttrib2svARB,
+TRACE_glMinSampleShadingARB,
+TRACE_glColor3b,
+TRACE_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,
+TRACE_glColor3f,
+TRACE_glVDPAUGetSurfaceivNV,
+TRACE_glColor3d,
+TRACE_glGetnMapiv,
+TRACE_glColor3i,
+TRACE_glGetInternalformatSampleivNV,
+TRACE_glVertexAttrib4ubv,
+TRACE_glColor3s,
+TRACE_glVertexAttribs4hvNV,
+TRACE_glVertexAttrib4NubvARB,
+TRACE_glMultiTexCoord3hvNV,
+TRACE_glMatrixPushEXT,
+TRACE_glProgramUniform2fEXT,
+TRACE_glGetVertexArrayIndexediv,
+TRACE_glBlitFramebuffer,
+TRACE_glMultiTexCoordP2ui,
+TRACE_glColorPointerListIBM,
+TRACE_glVertexAttribL4d,
+TRACE_glGetFragmentMaterialfvSGIX,
+TRACE_glVertex2iv,
+TRACE_glGetTexEnvxvOES,
+TRACE_glUniformMatrix3dv,
+TRACE_glGetVertexAttribLdvEXT,
+TRACE_glTexCoordP3uiv,
+TRACE_glDeformationMap3dSGIX,
+TRACE_glResumeTransformFeedback,
+TRACE_glInsertEventMarkerEXT,
+TRACE_glTessellationModeAMD,
+TRACE_glDrawCommandsAddressNV,
+TRACE_glFogi,
+TRACE_glGetTexParameterxvOES,
+TRACE_glVertexPointer,
+TRACE_glGetPerfMonitorCounterDataAMD,
+TRACE_glFogf,
+TRACE_glMultiTexCoord1d,
+TRACE_glMultiTexCoord1f,
+TRACE_glGetMultiTexParameterivEXT,
+TRACE_glProgramUniformMatrix3x4fvEXT,
+TRACE_glVertexAttribI2i,
+TRACE_glMultiTexCoord1i,
+TRACE_glDeleteSemaphoresEXT,
+TRACE_glLoadProgramNV,
+TRACE_glWriteMaskEXT,
+TRACE_glGetGraphicsResetStatus,
+TRACE_glVertexAttrib1fv,
+TRACE_glMultiTexCoord1s,
+TRACE_glImageTransformParameterfvHP,
+TRACE_glFramebufferTexture2D,
+TRACE_glGetFragmentLightfvSGIX,
+TRACE_glListParameterfSGIX,
+TRACE_glTexCoord3sv,
+TRACE_glNamedFramebufferRenderbufferEXT,
+TRACE_glFragmentLightModelfSGIX,
+TRACE_glIndexPointerEXT,
+TRACE_glBlendEquationSeparateATI,
+TRACE_glVertexArrayAttribIFormat,
+TRACE_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,
+TRACE_glReplacementCodeubvSUN,
+TRACE_glGenFramebuffers,
+TRACE_glPixelMapx,
+TRACE_glTexSubImage3DEXT,
+TRACE_glGetAttachedShaders,
+TRACE_glGetPixelTexGenParameterfvSGIS,
+TRACE_glReplacementCodeuiNormal3fVertex3fSUN,
+TRACE_glGetDebugMessageLogAMD,
+TRACE_glVertexStream4sATI,
+TRACE_glVertexAttribs4dvNV,
+TRACE_glGetnMapdvARB,
+TRACE_glOrthofOES,
+TRACE_glViewportArrayv,
+TRACE_glDrawElementArrayATI,
+TRACE_glBufferStorageMemEXT,
+TRACE_glGetPathColorGenfvNV,
+TRACE_glWindowPos3iMESA,
+TRACE_glMultiTexCoord2s,
+TRACE_glVertex3dv,
+TRACE_glVertexAttribI3uivEXT,
+TRACE_glUniform3ui64ARB,
+TRACE_glVertexAttrib2fvNV,
+TRACE_glGetNamedBufferSubDataEXT,
+TRACE_glConvolutionFilter2D,
+TRACE_glMemoryBarrierByRegion,
+TRACE_glVertexArrayBindingDivisor,
+TRACE_glMatrixRotatedEXT,
+TRACE_glTexCoord2sv,
+TRACE_glIsProgramNV,
+TRACE_glUniform2dv,
+TRACE_glGetPixelMapuiv,
+TRACE_glDepthBoundsEXT,
+TRACE_glVertexAttrib4hvNV,
+TRACE_glMultiTexParameteriEXT,
+TRACE_glGetPointerv,
+TRACE_glPathCommandsNV,
+TRACE_glGetListParameterfvSGIX,
+TRACE_glGetUniformuiv,
+TRACE_glDebugMessageInsertAMD,
+TRACE_glFrustum,
+TRACE_glVertexAttribL1ui64vNV,
+TRACE_glClearColorxOES,
+TRACE_glProgramUniformMatrix3fv,
+TRACE_glSampleMaskIndexedNV,
+TRACE_glCompileShaderIncludeARB,
+TRACE_glGetArrayObjectfvATI,
+TRACE_glVertexStream4svATI,
+TRACE_glMultiTexCoord4iARB,
+TRACE_glVariantfvEXT,
+TRACE_glMatrixLoadfEXT,
+TRACE_glLoadIdentityDeformationMapSGIX,
+TRACE_glGetRenderbufferParameteriv,
+TRACE_glProgramUniform3fEXT,
+TRACE_glNamedRenderbufferStorage,
+TRACE_glBindFragDataLocation,
+TRACE_glPolygonOffsetClamp,
+TRACE_glFogCoordPointerListIBM,
+TRACE_glFenceSync,
+TRACE_glGetVertexAttribIivEXT,
+TRACE_glFramebufferDrawBuffersEXT,
+TRACE_glVertexAttribs4fvNV,
+TRACE_glPauseTransformFeedbackNV,
+TRACE_glGetQueryObjecti64vEXT,
+TRACE_glVDPAUSurfaceAccessNV,
+TRACE_glValidateProgramPipeline,
+TRACE_glTexPageCommitmentARB,
+TRACE_glWindowPos3dvARB,
+TRACE_glStencilStrokePathInstancedNV,
+TRACE_glFogfv,
+TRACE_glGenQueriesARB,
+TRACE_glProgramUniform2i64NV,
+TRACE_glVertexP4ui,
+TRACE_glVertexStream1ivATI,
+TRACE_glProgramEnvParameterI4iNV,
+TRACE_glGenVertexArraysAPPLE,
+TRACE_glDrawTransformFeedbackInstanced,
+TRACE_glStencilThenCoverStrokePathNV,
+TRACE_glDeleteVertexArraysAPPLE,
+TRACE_glGetNamedBufferParameterui64vNV,
+TRACE_glQueryMatrixxOES,
+TRACE_glSecondaryColor3usv,
+TRACE_glTranslatexOES,
+TRACE_glDrawTransformFeedback,
+TRACE_glTexCoord2fColor4fNormal3fVertex3fvSUN,
+TRACE_glVDPAURegisterVideoSurfaceNV,
+TRACE_glGetTexParameterIuiv,
+TRACE_glBindBufferBaseNV,
+TRACE_glIndexPointer,
+TRACE_glGenQueryResourceTagNV,
+TRACE_glVertexAttrib4Nbv,
+TRACE_glListParameteriSGIX,
+TRACE_glBlendColorxOES,
+TRACE_glUniformui64vNV,
+TRACE_glIsSync,
+TRACE_glGetTextureParameterivEXT,
+TRACE_glFogCoordhvNV,
+TRACE_glFramebufferTextureLayerEXT,
+TRACE_glGetObjectPtrLabel,
+TRACE_glTextureParameteri,
+TRACE_glMultiTexCoord1fARB,
+TRACE_glUniformMatrix2x3dv,
+TRACE_glFramebufferDrawBufferEXT,
+TRACE_glCopyColorSubTable,
+TRACE_glGetNamedFramebufferParameterfvAMD,
+TRACE_glVertexAttribL3d,
+TRACE_glFragmentMaterialfvSGIX,
+TRACE_glMatrixLoadTranspose3x3fNV,
+TRACE_glDeleteNamesAMD,
+TRACE_glDrawRangeElementsEXT,
+TRACE_glOrtho,
+TRACE_glProgramUniform1dvEXT,
+TRACE_glColor4xOES,
+TRACE_glTexImage4DSGIS,
+TRACE_glProgramUniform1ui,
+TRACE_glDeleteBuffersARB,
+TRACE_glUnmapBufferARB,
+TRACE_glCopyTexImage2D,
+TRACE_glMaterialxOES,
+TRACE_glProgramUniformMatrix2x4fvEXT,
+TRACE_glTestObjectAPPLE,
+TRACE_glRenderbufferStorageEXT,
+TRACE_glVertexAttribL1ui64ARB,
+TRACE_glEndFragmentShaderATI,
+TRACE_glPathParameterivNV,
+TRACE_glUniform4uiv,
+TRACE_glFrameZoomSGIX,
+TRACE_glSecondaryColor3fEXT,
+TRACE_glLGPUInterlockNVX,
+TRACE_glVertexAttribL1dv,
+TRACE_glNormalStream3svATI,
+TRACE_glPathStencilFuncNV,
+TRACE_glSetInvariantEXT,
+TRACE_glGetTexBumpParameterivATI,
+TRACE_glBlendEquationSeparateEXT,
+TRACE_glEndOcclusionQueryNV,
+TRACE_glScissorArrayv,
+TRACE_glCallList,
+TRACE_glMapTexture2DINTEL,
+TRACE_glGetVkProcAddrNV,
+TRACE_glPixelTransferxOES,
+TRACE_glDeleteRenderbuffersEXT,
+TRACE_glTexCoord4fColor4fNormal3fVertex4fSUN,
+TRACE_glProgramUniformMatrix4dvEXT,
+TRACE_glGetnColorTable,
+TRACE_glFramebufferTextureLayerARB,
+TRACE_glVertexAttribL2dvEXT,
+TRACE_glGetCombinerStageParameterfvNV,
+TRACE_glMultiTexCoord1xvOES,
+TRACE_glMapBuffer,
+TRACE_glSecondaryColor3d,
+TRACE_glSecondaryColor3f,
+TRACE_glVertexAttribLFormat,
+TRACE_glElementPointerAPPLE,
+TRACE_glVertexStream1fATI,
+TRACE_glCoverageModulationNV,
+TRACE_glSecondaryColor3i,
+TRACE_glDeleteSync,
+TRACE_glGetProgramParameterfvNV,
+TRACE_glMaxShaderCompilerThreadsARB,
+TRACE_glUniformMatrix4x2dv,
+TRACE_glVertexArrayVertexAttribLOffsetEXT,
+TRACE_glSecondaryColor3s,
+TRACE_glIsImageHandleResidentNV,
+TRACE_glUniform3iv,
+TRACE_glVertexAttribL3i64vNV,
+TRACE_glPolygonMode,
+TRACE_glFramebufferSamplePositionsfvAMD,
+TRACE_glConvolutionFilter1DEXT,
+TRACE_glVertexAttrib1dvARB,
+TRACE_glTextureSubImage2DEXT,
+TRACE_glIsVertexArrayAPPLE,
+TRACE_glUseProgram,
+TRACE_glLineStipple,
+TRACE_glMultiTexCoord4fvARB,
+TRACE_glVideoCaptureNV,
+TRACE_glVertexArrayVertexAttribLFormatEXT,
+TRACE_glUniform3fvARB,
+TRACE_glProgramUniformMatrix3x2fvEXT,
+TRACE_glCopyTextureSubImage3DEXT,
+TRACE_glMultiTexCoord2bvOES,
+TRACE_glDeleteObjectARB,
+TRACE_glTextureLightEXT,
+TRACE_glRasterPos3i,
+TRACE_glMultiTexCoord3dARB,
+TRACE_glNamedFramebufferTextureEXT,
+TRACE_glTextureParameteriEXT,
+TRACE_glEvalCoord2xvOES,
+TRACE_glBindVideoCaptureStreamBufferNV,
+TRACE_glTexImage2DMultisampleCoverageNV,
+TRACE_glGetAttribLocationARB,
+TRACE_glDeleteShader,
+TRACE_glVertexAttrib1fARB,
+TRACE_glTexCoord2fColor4ubVertex3fSUN,
+TRACE_glTexCoord4fVertex4fSUN,
+TRACE_glGetMapdv,
+TRACE_glMapParameterfvNV,
+TRACE_glTextureParameterIuiv,
+TRACE_glTransformFeedbackAttribsNV,
+TRACE_glFragmentLightfvSGIX,
+TRACE_glWindowPos3sARB,
+TRACE_glGetConvolutionParameterfv,
+TRACE_glCopyTexSubImage3D,
+TRACE_glVertexAttribI3i,
+TRACE_glCreateShaderObjectARB,
+TRACE_glVertexAttribFormat,
+TRACE_glGetProgramivARB,
+TRACE_glVertexAttribI4usv,
+TRACE_glTexParameterf,
+TRACE_glVertexAttribBinding,
+TRACE_glGetHistogramParameteriv,
+TRACE_glTexParameteri,
+TRACE_glGetShaderSource,
+TRACE_glVertexAttrib4s,
+TRACE_glVertexAttrib4dvNV,
+TRACE_glVertexAttrib1dvNV,
+TRACE_glPopName,
+TRACE_glTextureBufferEXT,
+TRACE_glGetMultiTexImageEXT,
+TRACE_glGetPointerIndexedvEXT,
+TRACE_glIsNameAMD,
+TRACE_glColor4ub,
+TRACE_glBufferParameteriAPPLE,
+TRACE_glColor4ui,
+TRACE_glGetInternalformativ,
+TRACE_glColor4us,
+TRACE_glVertexAttribP1uiv,
+TRACE_glLinkProgram,
+TRACE_glTexCoord3s,
+TRACE_glTexCoord2dv,
+TRACE_glGetObjectLabel,
+TRACE_glVertexPointerEXT,
+TRACE_glDebugMessageCallbackARB,
+TRACE_glGetString,
+TRACE_glGetPathParameterfvNV,
+TRACE_glLightxvOES,
+TRACE_glEndQuery,
+TRACE_glSecondaryColor3uiv,
+TRACE_glPrioritizeTexturesxOES,
+TRACE_glEdgeFlagPointer,
+TRACE_glFramebufferParameteri,
+TRACE_glTexCoord3hNV,
+TRACE_glMultiModeDrawElementsIBM,
+TRACE_glCopyPixels,
+TRACE_glVertexAttribI2ui,
+TRACE_glClampColorARB,
+TRACE_glColorPointervINTEL,
+TRACE_glDeleteTextures,
+TRACE_glGetMinmaxParameterfvEXT,
+TRACE_glWindowPos3sMESA,
+TRACE_glVertexAttrib4f,
+TRACE_glNamedFramebufferParameteri,
+TRACE_glTexCoord2fVertex3fvSUN,
+TRACE_glReplacementCodeusSUN,
+TRACE_glGetNamedFramebufferParameteriv,
+TRACE_glVertexStream1fvATI,
+TRACE_glCreateVertexArrays,
+TRACE_glBeginConditionalRender,
+TRACE_glGetUnsignedBytevEXT,
+TRACE_glConvolutionFilter1D,
+TRACE_glMultiTexCoord3fARB,
+TRACE_glGetQueryObjectuivARB,
+TRACE_glScalexOES,
+TRACE_glSamplerParameteri,
+TRACE_glSamplerParameterf,
+TRACE_glShaderOp1EXT,
+TRACE_glBeginVideoCaptureNV,
+TRACE_glGetnHistogram,
+TRACE_glUniform1d,
+TRACE_glRenderMode,
+TRACE_glClearColorIiEXT,
+TRACE_glSignalSemaphoreEXT,
+TRACE_glGetCompressedTexImage,
+TRACE_glCompressedTextureImage1DEXT,
+TRACE_glGetActiveUniformBlockiv,
+TRACE_glUniform1i,
+TRACE_glMultiDrawArraysIndirectCount,
+TRACE_glGetTexEnvfv,
+TRACE_glColorTableParameterivSGI,
+TRACE_glCullFace,
+TRACE_glDeleteFencesAPPLE,
+TRACE_glProgramUniform4i,
+TRACE_glUniformHandleui64ARB,
+TRACE_glProgramUniform4f,
+TRACE_glViewportIndexedf,
+TRACE_glProgramUniform4d,
+TRACE_glTexCoord1xOES,
+TRACE_glVertexStream3ivATI,
+TRACE_glPointAlongPathNV,
+TRACE_glEndQueryARB,
+TRACE_glVDPAUMapSurfacesNV,
+TRACE_glVertex3i,
+TRACE_glVertexAttrib4uivARB,
+TRACE_glTextureStorageMem3DEXT,
+TRACE_glAttachShader,
+TRACE_glColor4hNV,
+TRACE_glGetFenceivNV,
+TRACE_glTexCoord2fColor4ubVertex3fvSUN,
+TRACE_glGetColorTable,
+TRACE_glFogCoordPointer,
+TRACE_glTexStorageSparseAMD,
+TRACE_glUnmapNamedBuffer,
+TRACE_glTexCoord4bvOES,
+TRACE_glVertexAttrib3fARB,
+TRACE_glRasterPos2xOES,
+TRACE_glCreateMemoryObjectsEXT,
+TRACE_glColor4ubVertex2fvSUN,
+TRACE_glSecondaryColor3dv,
+TRACE_glVertexAttribI4sv,
+TRACE_glDrawTransformFeedbackStreamInstanced,
+TRACE_glMultiTexCoord4ivARB,
+TRACE_glSpriteParameterfSGIX,
+TRACE_glSecondaryColor3sv,
+TRACE_glBindVideoCaptureStreamTextureNV,
+TRACE_glTexParameterIuiv,
+TRACE_glFlushPixelDataRangeNV,
+TRACE_glWindowPos3fv,
+TRACE_glVertexAttribLFormatNV,
+TRACE_glLightModelfv,
+TRACE_glGetColorTableSGI,
+TRACE_glGetCompressedTexImageARB,
+TRACE_glConvolutionParameteri,
+TRACE_glVertexWeighthNV,
+TRACE_glColorMaskIndexedEXT,
+TRACE_glColorMaski,
+TRACE_glColorFragmentOp1ATI,
+TRACE_glVertexAttribI4ubvEXT,
+TRACE_glVertexAttrib1dNV,
+TRACE_glUnmapObjectBufferATI,
+TRACE_glNamedProgramLocalParameterI4uiEXT,
+TRACE_glProgramUniform1iEXT,
+TRACE_glDeleteQueriesARB,
+TRACE_glWindowPos3svARB,
+TRACE_glVertex4s,
+TRACE_glImportMemoryWin32NameEXT,
+TRACE_glStringMarkerGREMEDY,
+TRACE_glIsTransformFeedback,
+TRACE_glProgramUniformMatrix2x3dvEXT,
+TRACE_glGetObjectLabelEXT,
+TRACE_glUniformHandleui64vNV,
+TRACE_glRotated,
+TRACE_glIsProgramPipeline,
+TRACE_glRotatef,
+TRACE_glVertex4i,
+TRACE_glGetActiveSubroutineUniformName,
+TRACE_glVertexAttrib4sNV,
+TRACE_glProgramLocalParameter4dvARB,
+TRACE_glReplacementCodeubSUN,
+TRACE_glMultiDrawElementsIndirectBindlessNV,
+TRACE_glImportSemaphoreWin32HandleEXT,
+TRACE_glUniformMatrix3fv,
+TRACE_glGetnMapfvARB,
+TRACE_glGetnUniformfv,
+TRACE_glVertexAttribL2dv,
+TRACE_glVertexWeightPointerEXT,
+TRACE_glTangent3sEXT,
+TRACE_glSecondaryColorPointer,
+TRACE_glAlphaFunc,
+TRACE_glGetNamedStringARB,
+TRACE_glTexCoord4d,
+TRACE_glBufferPageCommitmentARB,
+TRACE_glProgramLocalParameters4fvEXT,
+TRACE_glStencilFunc,
+TRACE_glSemaphoreParameterui64vEXT,
+TRACE_glGetVertexAttribdvNV,
+TRACE_glTexCoord3dv,
+TRACE_glGetQueryBufferObjectiv,
+TRACE_glTexGenxOES,
+TRACE_glMultiTexCoord1fvARB,
+TRACE_glLightEnviSGIX,
+TRACE_glGetProgramPipelineiv,
+TRACE_glVertexStream2ivATI,
+TRACE_glGetColorTableEXT,
+TRACE_glGetShaderInfoLog,
+TRACE_glGetOcclusionQueryuivNV,
+TRACE_glInvalidateNamedFramebufferSubData,
+TRACE_glVertexAttribL1i64NV,
+TRACE_glVDPAUInitNV,
+TRACE_glVertexAttrib1hvNV,
+TRACE_glVertexAttribI4i,
+TRACE_glRasterPos2iv,
+TRACE_glGetIntegerui64i_vNV,
+TRACE_glUniformHandleui64NV,
+TRACE_glWindowPos3ivMESA,
+TRACE_glBlendEquationSeparate,
+TRACE_glDrawElementsInstancedARB,
+TRACE_glGetSubroutineIndex,
+TRACE_glVertexAttrib2sv,
+TRACE_glSamplePatternSGIS,
+TRACE_glEGLImageTargetRenderbufferStorageOES,
+TRACE_glPushAttrib,
+TRACE_glVertex3hNV,
+TRACE_glRasterPos3xvOES,
+TRACE_glPathParameterfNV,
+TRACE_glGetUniformi64vNV,
+TRACE_glLightiv,
+TRACE_glMaterialxvOES,
+TRACE_glNamedProgramLocalParameter4fEXT,
+TRACE_glVertexAttribL1dEXT,
+TRACE_glGetnUniformdvARB,
+TRACE_glSecondaryColor3bEXT,
+TRACE_glBeginPerfQueryINTEL,
+TRACE_glProgramUniform1uivEXT,
+TRACE_glImageTransformParameterivHP,
+TRACE_glDeleteBuffers,
+TRACE_glBindProgramPipeline,
+TRACE_glScissor,
+TRACE_glProgramUniform4fv,
+TRACE_glGetBooleanv,
+TRACE_glMaterialfv,
+TRACE_glWindowPos4fvMESA,
+TRACE_glVertexAttribIPointerEXT,
+TRACE_glProgramBufferParametersfvNV,
+TRACE_glAlphaFuncxOES,
+TRACE_glMultiDrawArraysIndirectAMD,
+TRACE_glNormalStream3ivATI,
+TRACE_glTextureImage3DMultisampleNV,
+TRACE_glProgramUniform4uivEXT,
+TRACE_glReplacementCodeusvSUN,
+TRACE_glPollInstrumentsSGIX,
+TRACE_glGetTextureLevelParameteriv,
+TRACE_glVertexAttribI2uiv,
+TRACE_glMapControlPointsNV,
+TRACE_glColor4dv,
+TRACE_glInvalidateBufferSubData,
+TRACE_glMultiTexCoord1hNV,
+TRACE_glPointParameterfv,
+TRACE_glUniformMatrix2fvARB,
+TRACE_glUniform2fv,
+TRACE_glVertexPointerListIBM,
+TRACE_glGetMultiTexGenfvEXT,
+TRACE_glGetMinmaxEXT,
+TRACE_glIsFenceNV,
+TRACE_glMatrixFrustumEXT,
+TRACE_glDispatchComputeIndirect,
+TRACE_glQueryResourceNV,
+TRACE_glMultiTexCoord4bOES,
+TRACE_glProgramEnvParameter4dARB,
+TRACE_glProgramUniform1uiEXT,
+TRACE_glBindBufferRange,
+TRACE_glNormal3iv,
+TRACE_glVertexAttribL3dv,
+TRACE_glGetUniformdv,
+TRACE_glGetMultiTexLevelParameterfvEXT,
+TRACE_glFinalCombinerInputNV,
+TRACE_glCullParameterdvEXT,
+TRACE_glMultiTexCoord4s,
+TRACE_glMapVertexAttrib1fAPPLE,
+TRACE_glConvolutionParameterfEXT,
+TRACE_glTexCoord1iv,
+TRACE_glProgramUniform3fvEXT,
+TRACE_glColor3uiv,
+TRACE_glRenderGpuMaskNV,
+TRACE_glListBase,
+TRACE_glTexCoord2bOES,
+TRACE_glBindMaterialParameterEXT,
+TRACE_glGlobalAlphaFactorubSUN,
+TRACE_glVertexAttribL1ui64NV,
+TRACE_glPointParameterfSGIS,
+TRACE_glGetImageTransformParameterivHP,
+TRACE_glColorSubTableEXT,
+TRACE_glPixelTexGenParameterfvSGIS,
+TRACE_glClientWaitSync,
+TRACE_glQueryObjectParameteruiAMD,
+TRACE_glVertexAttribs1fvNV,
+TRACE_glVertexAttrib4NusvARB,
+TRACE_glVariantPointerEXT,
+TRACE_glTextureBuffer,
+TRACE_glVertexAttribI1uiEXT,
+TRACE_glInvalidateTexImage,
+TRACE_glProgramEnvParametersI4ivNV,
+TRACE_glPathGlyphIndexArrayNV,
+TRACE_glCopyImageSubData,
+TRACE_glGetUniformSubroutineuiv,
+TRACE_glBindVertexBuffer,
+TRACE_glMultiTexCoord1iARB,
+TRACE_glDebugMessageInsert,
+TRACE_glBeginVertexShaderEXT,
+TRACE_glIsVariantEnabledEXT,
+TRACE_glPassThroughxOES,
+TRACE_glIsSampler,
+TRACE_glConservativeRasterParameterfNV,
+TRACE_glMultiTexGenivEXT,
+TRACE_glNamedFramebufferTexture2DEXT,
+TRACE_glCopyTexSubImage1D,
+TRACE_glTexCoord1i,
+TRACE_glCheckFramebufferStatus,
+TRACE_glDrawElementArrayAPPLE,
+TRACE_glTexCoord1d,
+TRACE_glTexCoord1f,
+TRACE_glFragmentLightivSGIX,
+TRACE_glBindImageTexture,
+TRACE_glTransformFeedbackVaryings,
+TRACE_glMulticastBufferSubDataNV,
+TRACE_glDrawRangeElements,
+TRACE_glTexCoord1s,
+TRACE_glBindBufferBase,
+TRACE_glColor3bv,
+TRACE_glSyncTextureINTEL,
+TRACE_glCreateSamplers,
+TRACE_glCombinerParameterfNV,
+TRACE_glGetArrayObjectivATI,
+TRACE_glMultiDrawArrays,
+TRACE_glSampleMapATI,
+TRACE_glProgramUniform2i64ARB,
+TRACE_glBinormal3ivEXT,
+TRACE_glMultiDrawArraysIndirectCountARB,
+TRACE_glTextureStorageMem1DEXT,
+TRACE_glWindowPos2ivMESA,
+TRACE_glTexCoordP4ui,
+TRACE_glMultiTexSubImage1DEXT,
+TRACE_glProgramUniformMatrix2x3fvEXT,
+TRACE_glBufferDataARB,
+TRACE_glVertexAttribIFormat,
+TRACE_glCreateFramebuffers,
+TRACE_glNormalStream3dvATI,
+TRACE_glClearAccum,
+TRACE_glUniform3i64vNV,
+TRACE_glNormal3fVertex3fSUN,
+TRACE_glUniform2uivEXT,
+TRACE_glBeginQuery,
+TRACE_glStencilThenCoverStrokePathInstancedNV,
+TRACE_glBindBuffer,
+TRACE_glMap2d,
+TRACE_glMap2f,
+TRACE_glMakeImageHandleResidentNV,
+TRACE_glUniformMatrix2x4fv,
+TRACE_glGetMultiTexParameterfvEXT,
+TRACE_glDepthRangeIndexed,
+TRACE_glIsEnabled,
+TRACE_glMatrixScalefEXT,
+TRACE_glGetError,
+TRACE_glGetTexEnviv,
+TRACE_glBindTextureUnitParameterEXT,
+TRACE_glGetnUniformfvARB,
+TRACE_glReplacementCodeuiNormal3fVertex3fvSUN,
+TRACE_glDeletePerfQueryINTEL,
+TRACE_glActiveVaryingNV,
+TRACE_glGetActiveUniformARB,
+TRACE_glVertexAttribI3ivEXT,
+TRACE_glEvalCoord1d,
+TRACE_glNamedCopyBufferSubDataEXT,
+TRACE_glEvalCoord1f,
+TRACE_glPixelMapfv,
+TRACE_glVertexAttribI1ivEXT,
+TRACE_glCreateSyncFromCLeventARB,
+TRACE_glGetPixelMapusv,
+TRACE_glGetnColorTableARB,
+TRACE_glAccum,
+TRACE_glRasterPos3sv,
+TRACE_glTexCoord2iv,
+TRACE_glBlendFunciARB,
+TRACE_glProgramUniform3i64vARB,
+TRACE_glGetFramebufferAttachmentParameteriv,
+TRACE_glProgramUniform4ui,
+TRACE_glStencilMask,
+TRACE_glResetHistogramEXT,
+TRACE_glLightxOES,
+TRACE_glNamedBufferData,
+TRACE_glVertexStream3sATI,
+TRACE_glVertexAttrib3fvARB,
+TRACE_glClearNamedBufferSubData,
+TRACE_glProgramUniformHandleui64ARB,
+TRACE_glUniform3iARB,
+TRACE_glCreateProgramObjectARB,
+TRACE_glMultiTexCoord1dvARB,
+TRACE_glGetObjectParameterfvARB,
+TRACE_glRectsv,
+TRACE_glMultiTexImage2DEXT,
+TRACE_glProgramUniform1i64NV,
+TRACE_glGetObjectBufferivATI,
+TRACE_glUniform4i64ARB,
+TRACE_glReplacementCodeuiColor4ubVertex3fvSUN,
+TRACE_glBlendFuncSeparateINGR,
+TRACE_glGetVideoCaptureStreamfvNV,
+TRACE_glVertexAttrib2fARB,
+TRACE_glGetTexGeniv,
+TRACE_glPixelStorei,
+TRACE_glGetCompressedTextureSubImage,
+TRACE_glCopyImageSubDataNV,
+TRACE_glActiveShaderProgram,
+TRACE_glVertexStream1iATI,
+TRACE_glPatchParameterfv,
+TRACE_glIsFramebufferEXT,
+TRACE_glTextureStorage2D,
+TRACE_glProgramUniform1ui64ARB,
+TRACE_glTexBufferRange,
+TRACE_glGetPixelTexGenParameterivSGIS,
+TRACE_glTextureSubImage3DEXT,
+TRACE_glClipControl,
+TRACE_glGetProgramResourceiv,
+TRACE_glMultiTexCoordP2uiv,
+TRACE_glVertexAttribI3ui,
+TRACE_glSampleMaskSGIS,
+TRACE_glVertexAttrib4NivARB,
+TRACE_glGlobalAlphaFactorfSUN,
+TRACE_glBlendEquationSeparateIndexedAMD,
+TRACE_glGetPerfCounterInfoINTEL,
+TRACE_glDeleteProgramsNV,
+TRACE_glPixelZoomxOES,
+TRACE_glGetCombinerOutputParameterivNV,
+TRACE_glRasterPos2xvOES,
+TRACE_glGetTexImage,
+TRACE_glVertexArrayVertexBuffers,
+TRACE_glUniform1ui64NV,
+TRACE_glProgramParameteri,
+TRACE_glNormal3xOES,
+TRACE_glGetMapfv,
+TRACE_glVertexStream2dvATI,
+TRACE_glPathStencilDepthOffsetNV,
+TRACE_glIsStateNV,
+TRACE_glGetIntegerui64vNV,
+TRACE_glGetImageTransformParameterfvHP,
+TRACE_glRasterPos2fv,
+TRACE_glVertex3xOES,
+TRACE_glIsMemoryObjectEXT,
+TRACE_glWeightPointerARB,
+TRACE_glFinishFenceNV,
+TRACE_glDepthRangexOES,
+TRACE_glEnableVertexArrayAttribEXT,
+TRACE_glProgramUniform2uivEXT,
+TRACE_glGetDoubleIndexedvEXT,
+TRACE_glWindowPos2fMESA,
+TRACE_glSecondaryColor3b,
+TRACE_glCopyConvolutionFilter1DEXT,
+TRACE_glWindowPos2sv,
+TRACE_glBindFramebufferEXT,
+TRACE_glCreateShader,
+TRACE_glGenPathsNV,
+TRACE_glGenRenderbuffers,
+TRACE_glCopyTexSubImage2D,
+TRACE_glVertexAttrib4ubvARB,
+TRACE_glDrawTextureNV,
+TRACE_glVertexAttribs1svNV,
+TRACE_glClearNamedBufferSubDataEXT,
+TRACE_glBlendFuncSeparate,
+TRACE_glPointParameterfARB,
+TRACE_glTexCoord2fv,
+TRACE_glGetVariantFloatvEXT,
+TRACE_glVertexP2ui,
+TRACE_glWindowPos2dMESA,
+TRACE_glTexCoord4fv,
+TRACE_glBindFragDataLocationEXT,
+TRACE_glCompressedTexSubImage1DARB,
+TRACE_glGetTextureImageEXT,
+TRACE_glFogCoordd,
+TRACE_glPointSize,
+TRACE_glBindTextureUnit,
+TRACE_glProgramEnvParameterI4uiNV,
+TRACE_glGetProgramPipelineInfoLog,
+TRACE_glProgramUniform4i64vARB,
+TRACE_glVertexAttrib4Nuiv,
+TRACE_glGetUniformfvARB,
+TRACE_glWaitSync,
+TRACE_glUniform3i,
+TRACE_glBlendEquationSeparatei,
+TRACE_glVertexAttrib2hvNV,
+TRACE_glTextureParameterivEXT,
+TRACE_glUniform3d,
+TRACE_glUniform3f,
+TRACE_glActiveProgramEXT,
+TRACE_glProgramUniform3uiv,
+TRACE_glUniform3ui64vARB,
+TRACE_glProgramUniform1ui64vARB,
+TRACE_glTextureParameterfEXT,
+TRACE_glSetFragmentShaderConstantATI,
+TRACE_glColorSubTable,
+TRACE_glReplacementCodeuiSUN,
+TRACE_glStateCaptureNV,
+TRACE_glBindAttribLocation,
+TRACE_glWeightusvARB,
+TRACE_glGetFragDataIndex,
+TRACE_glMultiTexCoord2xOES,
+TRACE_glColor3sv,
+TRACE_glTexCoord2fVertex3fSUN,
+TRACE_glGetMemoryObjectParameterivEXT,
+TRACE_glPolygonOffsetEXT,
+TRACE_glWeightPathsNV,
+TRACE_glCombinerStageParameterfvNV,
+TRACE_glPointParameterfEXT,
+TRACE_glCopyTexImage1DEXT,
+TRACE_glVertex4sv,
+TRACE_glMatrixMultfEXT,
+TRACE_glCompressedTextureSubImage3DEXT,
+TRACE_glGetTexLevelParameterxvOES,
+TRACE_glVertexAttribL3dvEXT,
+TRACE_glMultiTexCoordP4ui,
+TRACE_glGetTextureLevelParameterivEXT,
+TRACE_glAlphaFragmentOp2ATI,
+TRACE_glDeleteFramebuffers,
+TRACE_glDrawArrays,
+TRACE_glGetTransformFeedbackiv,
+TRACE_glGetnTexImageARB,
+TRACE_glClear,
+TRACE_glVertexArrayParameteriAPPLE,
+TRACE_glMultiTexCoord2dvARB,
+TRACE_glGetVideoCaptureStreamdvNV,
+TRACE_glFragmentLightModelivSGIX,
+TRACE_glVertexAttribP2ui,
+TRACE_glMultiTexCoordPointerEXT,
+TRACE_glProgramUniform3iEXT,
+TRACE_glTranslatef,
+TRACE_glVertexAttrib4Nub,
+TRACE_glTranslated,
+TRACE_glSamplerParameterIiv,
+TRACE_glTexCoord4hNV,
+TRACE_glDrawElementsIndirect,
+TRACE_glDeletePerfMonitorsAMD,
+TRACE_glIsRenderbufferEXT,
+TRACE_glDrawCommandsNV,
+TRACE_glUniform3ivARB,
+TRACE_glBufferSubData,
+TRACE_glSecondaryColor3bv,
+TRACE_glMatrixMultTransposedEXT,
+TRACE_glRequestResidentProgramsNV,
+TRACE_glAlphaFragmentOp1ATI,
+TRACE_glGetQueryObjecti64v,
+TRACE_glMatrixMult3x3fNV,
+TRACE_glColorTableParameteriv,
+TRACE_glPathSubCommandsNV,
+TRACE_glGetFinalCombinerInputParameterivNV,
+TRACE_glIsRenderbuffer,
+TRACE_glVertex3iv,
+TRACE_glTexGenfv,
+TRACE_glFrustumfOES,
+TRACE_glBindVertexBuffers,
+TRACE_glMateriali,
+TRACE_glMultiTexCoord2svARB,
+TRACE_glDisableVertexAttribArray,
+TRACE_glWindowPos3ivARB,
+TRACE_glTexCoordFormatNV,
+TRACE_glBlitNamedFramebuffer,
+TRACE_glMatrixLoadTransposefEXT,
+TRACE_glMultiTexGenfEXT,
+TRACE_glShaderStorageBlockBinding,
+TRACE_glMaterialf,
+TRACE_glReplacementCodeuiColor4fNormal3fVertex3fSUN,
+TRACE_glCheckNamedFramebufferStatusEXT,
+TRACE_glVertexArrayVertexAttribFormatEXT,
+TRACE_glVertex2hNV,
+TRACE_glDeleteVertexShaderEXT,
+TRACE_glTexImage3DEXT,
+TRACE_glSignalVkFenceNV,
+TRACE_glProgramLocalParameterI4ivNV,
+TRACE_glGlobalAlphaFactoriSUN,
+TRACE_glTextureStorage1D,
+TRACE_glBinormal3sEXT,
+TRACE_glGetProgramInterfaceiv,
+TRACE_glMatrixIndexPointerARB,
+TRACE_glTexCoordPointerEXT,
+TRACE_glMultiTexGeniEXT,
+TRACE_glVertexAttrib2fNV,
+TRACE_glNamedProgramStringEXT,
+TRACE_glMapNamedBuffer,
+TRACE_glGetMinmaxParameteriv,
+TRACE_glGetnUniformdv,
+TRACE_glEndConditionalRenderNVX,
+TRACE_glBinormal3fEXT,
+TRACE_glNormalStream3iATI,
+TRACE_glProgramBufferParametersIivNV,
+TRACE_glMapGrid1xOES,
+TRACE_glGetVertexAttribPointervARB,
+TRACE_glFlushMappedNamedBufferRangeEXT,
+TRACE_glGetVertexAttribIiv,
+TRACE_glVertexP4uiv,
+TRACE_glUniformui64NV,
+TRACE_glColor4fv,
+TRACE_glTexParameterxvOES,
+TRACE_glPatchParameteri,
+TRACE_glMap1d,
+TRACE_glGetTexFilterFuncSGIS,
+TRACE_glVertexStream3dATI,
+TRACE_glVertexArrayVertexBindingDivisorEXT,
+TRACE_glMultiTexCoord3svARB,
+TRACE_glBindProgramNV,
+TRACE_glGetConvolutionParameteriv,
+TRACE_glGetProgramLocalParameterfvARB,
+TRACE_glGenFragmentShadersATI,
+TRACE_glTexBumpParameterivATI,
+TRACE_glGetNamedFramebufferAttachmentParameteriv,
+TRACE_glGetnSeparableFilter,
+TRACE_glNormal3xvOES,
+TRACE_glPassTexCoordATI,
+TRACE_glFramebufferTextureFaceARB,
+TRACE_glProgramUniform1dv,
+TRACE_glTextureStorage2DEXT,
+TRACE_glVertexArrayFogCoordOffsetEXT,
+TRACE_glDeleteNamedStringARB,
+TRACE_glMulticastGetQueryObjecti64vNV,
+TRACE_glGenOcclusionQueriesNV,
+TRACE_glLighti,
+TRACE_glTexImage1D,
+TRACE_glLightf,
+TRACE_glClientAttribDefaultEXT,
+TRACE_glVertexAttrib4bvARB,
+TRACE_glVertexAttribIFormatNV,
+TRACE_glStencilFuncSeparate,
+TRACE_glGetVertexAttribfvARB,
+TRACE_glVertexAttrib2dNV,
+TRACE_glProgramUniform2iEXT,
+TRACE_glClientActiveVertexStreamATI,
+TRACE_glRasterPos3xOES,
+TRACE_glGetMapParameterivNV,
+TRACE_glSampleCoverage,
+TRACE_glClearDepthxOES,
+TRACE_glUniformBufferEXT,
+TRACE_glTexCoord2fNormal3fVertex3fvSUN,
+TRACE_glMulticastGetQueryObjectuivNV,
+TRACE_glGetFirstPerfQueryIdINTEL,
+TRACE_glUnmapNamedBufferEXT,
+TRACE_glGetTransformFeedbacki_v,
+TRACE_glUniform4fvARB,
+TRACE_glRenderbufferStorageMultisampleCoverageNV,
+TRACE_glGetFloati_vEXT,
+TRACE_glBindAttribLocationARB,
+TRACE_glBufferAddressRangeNV,
+TRACE_glGenProgramsARB,
+TRACE_glMultiTexEnvivEXT,
+TRACE_glSecondaryColor3uiEXT,
+TRACE_glCompressedTextureImage2DEXT,
+TRACE_glUniform2i,
+TRACE_glCopyTexImage2DEXT,
+TRACE_glUniform2d,
+TRACE_glVertexAttribL1d,
+TRACE_glFramebufferTextureFaceEXT,
+TRACE_glFramebufferTextureLayer,
+TRACE_glMultiTexCoord4bvOES,
+TRACE_glGetVertexArrayPointeri_vEXT,
+TRACE_glNamedProgramLocalParameter4dEXT,
+TRACE_glBinormal3bEXT,
+TRACE_glConvolutionFilter2DEXT,
+TRACE_glProgramUniform2fv,
+TRACE_glColor3fVertex3fSUN,
+TRACE_glNormal3fVertex3fvSUN,
+TRACE_glCopyMultiTexSubImage3DEXT,
+TRACE_glProgramLocalParameterI4iNV,
+TRACE_glProgramUniformMatrix2x4dv,
+TRACE_glPathMemoryGlyphIndexArrayNV,
+TRACE_glDrawArraysEXT,
+TRACE_glBlendEquationEXT,
+TRACE_glStencilOp,
+TRACE_glCopyTextureSubImage2DEXT,
+TRACE_glTexEnvf,
+TRACE_glVertexAttrib2dvNV,
+TRACE_glGenPerfMonitorsAMD,
+TRACE_glGetInteger64i_v,
+TRACE_glGetHistogramParameterfv,
+TRACE_glVertexFormatNV,
+TRACE_glBlendFuncIndexedAMD,
+TRACE_glTexEnvi,
+TRACE_glMultiTexCoord1iv,
+TRACE_glIsEnabledi,
+TRACE_glVertexAttribL2ui64vNV,
+TRACE_glVertexAttribL4i64NV,
+TRACE_glMatrixTranslatedEXT,
+TRACE_glMakeTextureHandleResidentARB,
+TRACE_glMatrixMultdEXT,
+TRACE_glBinormal3dvEXT,
+TRACE_glImportSyncEXT,
+TRACE_glGetMapiv,
+TRACE_glImportSemaphoreFdEXT,
+TRACE_glMultiTexCoord4sv,
+TRACE_glPNTrianglesiATI,
+TRACE_glBindVertexArrayAPPLE,
+TRACE_glObjectPtrLabel,
+TRACE_glGetDebugMessageLog,
+TRACE_glTrackMatrixNV,
+TRACE_glProgramPathFragmentInputGenNV,
+TRACE_glTangent3ivEXT,
+TRACE_glGetUniformfv,
+TRACE_glSecondaryColor3ubv,
+TRACE_glMakeTextureHandleNonResidentNV,
+TRACE_glVertexAttribs4ubvNV,
+TRACE_glClipPlanexOES,
+TRACE_glMultiTexCoord3iv,
+TRACE_glGetnPolygonStippleARB,
+TRACE_glUniform2i64vNV,
+TRACE_glLightModelf,
+TRACE_glDeleteMemoryObjectsEXT,
+TRACE_glMultiTexSubImage2DEXT,
+TRACE_glReplacementCodeuiColor3fVertex3fSUN,
+TRACE_glTangent3dvEXT,
+TRACE_glLightModeli,
+TRACE_glVertexWeighthvNV,
+TRACE_glWindowPos3iv,
+TRACE_glMultiTexCoordP1uiv,
+TRACE_glTransformPathNV,
+TRACE_glProgramNamedParameter4dNV,
+TRACE_glMultiDrawElementsIndirect,
+TRACE_glProgramUniform1dEXT,
+TRACE_glCallLists,
+TRACE_glNormal3hvNV,
+TRACE_glGetCombinerOutputParameterfvNV,
+TRACE_glVertexAttrib4sARB,
+TRACE_glTexCoord3i,
+TRACE_glVertexAttribI3uiv,
+TRACE_glPushDebugGroup,
+TRACE_glTexCoord3f,
+TRACE_glTexCoord3d,
+TRACE_glTexCoord2xOES,
+TRACE_glGetStageIndexNV,
+TRACE_glProgramUniform4i64vNV,
+TRACE_glGetNamedBufferPointervEXT,
+TRACE_glTextureBarrierNV,
+TRACE_glColor4ubVertex3fvSUN,
+TRACE_glGetCommandHeaderNV,
+TRACE_glGetPerfMonitorCounterInfoAMD,
+TRACE_glVertexAttrib1svARB,
+TRACE_glCombinerParameteriNV,
+TRACE_glMatrixMultTransposefEXT,
+TRACE_glDetailTexFuncSGIS,
+TRACE_glAreTexturesResident,
+TRACE_glProgramUniform2d,
+TRACE_glGetConvolutionParameterfvEXT,
+TRACE_glIndexPointerListIBM,
+TRACE_glVertexAttribI4iEXT,
+TRACE_glProgramUniform2f,
+TRACE_glRasterPos4sv,
+TRACE_glColor4s,
+TRACE_glMulticastGetQueryObjectivNV,
+TRACE_glColorFragmentOp3ATI,
+TRACE_glResizeBuffersMESA,
+TRACE_glGetMinmaxParameterfv,
+TRACE_glClientActiveTextureARB,
+TRACE_glBindVertexArray,
+TRACE_glColor4b,
+TRACE_glColor4f,
+TRACE_glColor4d,
+TRACE_glColor4i,
+TRACE_glEdgeFlagFormatNV,
+TRACE_glNamedBufferSubData,
+TRACE_glDrawElementsInstanced,
+TRACE_glGetMultiTexParameterIivEXT,
+TRACE_glVertex2dv,
+TRACE_glDisableVertexArrayAttribEXT,
+TRACE_glObjectUnpurgeableAPPLE,
+TRACE_glVertexAttribs2dvNV,
+TRACE_glReplacementCodeuiTexCoord2fVertex3fSUN,
+TRACE_glGetMapParameterfvNV,
+TRACE_glProgramUniform4ivEXT,
+TRACE_glProgramUniform3ui64vNV,
+TRACE_glRectfv,
+TRACE_glTexFilterFuncSGIS,
+TRACE_glSpriteParameterfvSGIX,
+TRACE_glCopyMultiTexImage1DEXT,
+TRACE_glGetVertexAttribIuivEXT,
+TRACE_glUniformMatrix2x4dv,
+TRACE_glGetProgramResourceLocationIndex,
+TRACE_glColor3hNV,
+TRACE_glViewport,
+TRACE_glProgramNamedParameter4fNV,
+TRACE_glGetInvariantBooleanvEXT,
+TRACE_glTexStorage2DMultisample,
+TRACE_glPixelStorex,
+TRACE_glVertexAttribL1dvEXT,
+TRACE_glGetActiveSubroutineUniformiv,
+TRACE_glVertexAttribPointerARB,
+TRACE_glCompressedTexSubImage2DARB,
+TRACE_glTexStorageMem1DEXT,
+TRACE_glVertex2hvNV,
+TRACE_glTexBuffer,
+TRACE_glArrayElement,
+TRACE_glValidateProgram,
+TRACE_glPixelStoref,
+TRACE_glWindowPos3dARB,
+TRACE_glEvalCoord1dv,
+TRACE_glVertexAttribs2fvNV,
+TRACE_glRecti,
+TRACE_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,
+TRACE_glTexCoord1bOES,
+TRACE_glProgramUniform2i64vARB,
+TRACE_glWindowPos2dARB,
+TRACE_glGetProgramParameterdvNV,
+TRACE_glRectf,
+TRACE_glRectd,
+TRACE_glMap1xOES,
+TRACE_glVertexAttrib3fvNV,
+TRACE_glReferencePlaneSGIX,
+TRACE_glMulticastBlitFramebufferNV,
+TRACE_glGetCombinerInputParameterfvNV,
+TRACE_glGetTextureSamplerHandleARB,
+TRACE_glBindTexture,
+TRACE_glRects,
+TRACE_glGetActiveAttribARB,
+TRACE_glHistogramEXT,
+TRACE_glGetTextureSamplerHandleNV,
+TRACE_glDetachShader,
+TRACE_glFinishTextureSUNX,
+TRACE_glUniformMatrix3x4dv,
+TRACE_glVertexAttrib4fARB,
+TRACE_glGetPathColorGenivNV,
+TRACE_glGetProgramResourceLocation,
+TRACE_glVertexArrayAttribLFormat,
+TRACE_glGetTexLevelParameterfv,
+TRACE_glVertexArrayVertexAttribOffsetEXT,
+TRACE_glIndexFormatNV,
+TRACE_glMultiTexCoord3i,
+TRACE_glReplacementCodeuiVertex3fvSUN,
+TRACE_glViewportIndexedfv,
+TRACE_glBindBuffersBase,
+TRACE_glTexBumpParameterfvATI,
+TRACE_glMatrixIndexuivARB,
+TRACE_glVertexAttrib1hNV,
+TRACE_glWindowPos3svMESA,
+TRACE_glStencilOpSeparateATI,
+TRACE_glDrawElementsBaseVertex,
+TRACE_glBlendEquationSeparateiARB,
+TRACE_glVertexAttrib1fNV,
+TRACE_glMapVertexAttrib2fAPPLE,
+TRACE_glCompressedTextureSubImage1DEXT,
+TRACE_glClearBufferSubData,
+TRACE_glTexStorage1D,
+TRACE_glVertexAttribI3iEXT,
+TRACE_glMakeTextureHandleNonResidentARB,
+TRACE_glMultiDrawElementArrayAPPLE,
+TRACE_glVertexStream4dATI,
+TRACE_glProgramUniformMatrix2dvEXT,
+TRACE_glVertexAttribs2hvNV,
+TRACE_glGetUniformiv,
+TRACE_glClipPlanefOES,
+TRACE_glRenderbufferStorage,
+TRACE_glUniform4ui,
+TRACE_glBindFramebuffer,
+TRACE_glValidateProgramARB,
+TRACE_glTexGenf,
+TRACE_glTexGend,
+TRACE_glTexGeni,
+TRACE_glDeleteFramebuffersEXT,
+TRACE_glResetMinmaxEXT,
+TRACE_glVertexAttrib1fvNV,
+TRACE_glIsQueryARB,
+TRACE_glEnableVariantClientStateEXT,
+TRACE_glScissorIndexed,
+TRACE_glGetInvariantIntegervEXT,
+TRACE_glProgramLocalParameterI4uiNV,
+TRACE_glConvolutionParameterxvOES,
+TRACE_glGenFramebuffersEXT,
+TRACE_glVertexArrayColorOffsetEXT,
+TRACE_glMultiTexCoord3ivARB,
+TRACE_glVertexWeightfEXT,
+TRACE_glRasterPos4dv,
+TRACE_glIsTextureHandleResidentARB,
+TRACE_glRasterPos2dv,
+TRACE_glWindowPos4ivMESA,
+TRACE_glGetVariantPointervEXT,
+TRACE_glMapNamedBufferRangeEXT,
+TRACE_glGetnUniformui64vARB,
+TRACE_glCreateShaderProgramv,
+TRACE_glGetQueryObjectiv,
+TRACE_glMaxShaderCompilerThreadsKHR,
+TRACE_glPNTrianglesfATI,
+TRACE_glGlobalAlphaFactorusSUN,
+TRACE_glVertexAttrib3dvNV,
+TRACE_glMultiTexCoord3sARB,
+TRACE_glGenerateMipmap,
+TRACE_glCompressedTextureSubImage2D,
+TRACE_glNamedRenderbufferStorageMultisampleEXT,
+TRACE_glPolygonOffsetClampEXT,
+TRACE_glTextureRangeAPPLE,
+TRACE_glBlendEquationIndexedAMD,
+TRACE_glTexCoord2d,
+TRACE_glPointParameteri,
+TRACE_glTexCoord2f,
+TRACE_glGetUnsignedBytei_vEXT,
+TRACE_glColor4iv,
+TRACE_glMapNamedBufferRange,
+TRACE_glUnmapBuffer,
+TRACE_glSampleMaskEXT,
+TRACE_glTexCoord2i,
+TRACE_glTexCoord1xvOES,
+TRACE_glVertexAttrib1sARB,
+TRACE_glGetVertexArrayiv,
+TRACE_glProgramParameter4dvNV,
+TRACE_glTexCoord2s,
+TRACE_glTextureParameterIuivEXT,
+TRACE_glGetColorTableParameterfvSGI,
+TRACE_glTexCoord4dv,
+TRACE_glVertexAttrib1svNV,
+TRACE_glNamedFramebufferTextureFaceEXT,
+TRACE_glProgramUniform2ui64vNV,
+TRACE_glStencilFillPathNV,
+TRACE_glNormal3dv,
+TRACE_glReleaseShaderCompiler,
+TRACE_glTexStorageMem3DEXT,
+TRACE_glTexCoord3bvOES,
+TRACE_glIsVertexAttribEnabledAPPLE,
+TRACE_glTexCoord1dv,
+TRACE_glReadPixels,
+TRACE_glVertexAttribI3iv,
+TRACE_glSetFenceAPPLE,
+TRACE_glWeightsvARB,
+TRACE_glShadeModel,
+TRACE_glTextureStorageMem3DMultisampleEXT,
+TRACE_glMapGrid1d,
+TRACE_glGetHistogramParameterivEXT,
+TRACE_glConservativeRasterParameteriNV,
+TRACE_glClearNamedBufferData,
+TRACE_glClearDepthf,
+TRACE_glCreatePerfQueryINTEL,
+TRACE_glFogCoordfEXT,
+TRACE_glVertexAttrib2dARB,
+TRACE_glMultiTexCoord4dARB,
+TRACE_glReadnPixelsARB,
+TRACE_glMultiTexBufferEXT,
+TRACE_glWindowPos4dvMESA,
+TRACE_glInvalidateNamedFramebufferData,
+TRACE_glSecondaryColorPointerListIBM,
+TRACE_glRectiv,
+TRACE_glColorP4ui,
+TRACE_glUseProgramStages,
+TRACE_glRasterPos3dv,
+TRACE_glPathTexGenNV,
+TRACE_glVertexBlendEnviATI,
+TRACE_glUniform3i64ARB,
+TRACE_glLoadMatrixf,
+TRACE_glProgramUniform2dEXT,
+TRACE_glVertexAttribI4iv,
+TRACE_glNamedFramebufferDrawBuffer,
+TRACE_glColor4ubv,
+TRACE_glColor3hvNV,
+TRACE_glGetMapAttribParameterfvNV,
+TRACE_glGetBufferSubData,
+TRACE_glGetVertexAttribLdv,
+TRACE_glGetnUniformuiv,
+TRACE_glGetUniformui64vNV,
+TRACE_glNamedRenderbufferStorageEXT,
+TRACE_glVertexAttrib3dNV,
+TRACE_glTextureStorage1DEXT,
+TRACE_glPixelTexGenParameteriSGIS,
+TRACE_glColorTableEXT,
+TRACE_glGenBuffers,
+TRACE_glMultiTexCoord3xvOES,
+TRACE_glExecuteProgramNV,
+TRACE_glVariantArrayObjectATI,
+TRACE_glColor3xvOES,
+TRACE_glGetnConvolutionFilterARB,
+TRACE_glNormalFormatNV,
+TRACE_glGetInvariantFloatvEXT,
+TRACE_glClearNamedFramebufferiv,
+TRACE_glTexImage3D,
+TRACE_glGenSamplers,
+TRACE_glIsFramebuffer,
+TRACE_glProgramUniform3dvEXT,
+TRACE_glGetVertexAttribfvNV,
+TRACE_glDrawRangeElementArrayAPPLE,
+TRACE_glUniform3i64NV,
+TRACE_glMatrixPopEXT,
+TRACE_glVertexStream1sATI,
+TRACE_glGetnPixelMapuivARB,
+TRACE_glMultiTexEnviEXT,
+TRACE_glVertexAttribI2iEXT,
+TRACE_glProgramParameter4fvNV,
+TRACE_glWaitSemaphoreEXT,
+TRACE_glNamedFramebufferSampleLocationsfvNV,
+TRACE_glTexCoordP4uiv,
+TRACE_glRectxvOES,
+TRACE_glGetVariantIntegervEXT,
+TRACE_glDeleteLists,
+TRACE_glTexGendv,
+TRACE_glVertexP2uiv,
+TRACE_glGetPerfMonitorGroupsAMD,
+TRACE_glMultTransposeMatrixfARB,
+TRACE_glVertexAttribI2ivEXT,
+TRACE_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,
+TRACE_glDeleteStatesNV,
+TRACE_glGetBufferParameteri64v,
+TRACE_glProgramUniform4dv,
+TRACE_glEdgeFlagPointerEXT,
+TRACE_glVideoCaptureStreamParameterivNV,
+TRACE_glVertexStream4iATI,
+TRACE_glVDPAUFiniNV,
+TRACE_glMakeBufferNonResidentNV,
+TRACE_glUniform1ui64ARB,
+TRACE_glStencilStrokePathNV,
+TRACE_glVariantuivEXT,
+TRACE_glCopyTexSubImage3DEXT,
+TRACE_glSpriteParameteriSGIX,
+TRACE_glMultiTexCoord1sARB,
+TRACE_glConvolutionParameterfv,
+TRACE_glMakeTextureHandleResidentNV,
+TRACE_glMultMatrixxOES,
+TRACE_glTextureNormalEXT,
+TRACE_glGetQueryivARB,
+TRACE_glCompressedMultiTexImage3DEXT,
+TRACE_glGetInstrumentsSGIX,
+TRACE_glProgramUniformMatrix4x3fvEXT,
+TRACE_glPointParameterf,
+TRACE_glProgramUniform3dEXT,
+TRACE_glMultiTexCoord2hNV,
+TRACE_glGetConvolutionFilterEXT,
+TRACE_glVertexAttrib2hNV,
+TRACE_glCurrentPaletteMatrixARB,
+TRACE_glFogxvOES,
+TRACE_glCreateRenderbuffers,
+TRACE_glVertexAttrib4Nusv,
+TRACE_glCombinerInputNV,
+TRACE_glDepthFunc,
+TRACE_glWindowPos4fMESA,
+TRACE_glEnableClientStateIndexedEXT,
+TRACE_glTexCoord4iv,
+TRACE_glProgramUniform4i64ARB,
+TRACE_glBlendFunci,
+TRACE_glResolveDepthValuesNV,
+TRACE_glTextureColorMaskSGIS,
+TRACE_glCreateShaderProgramEXT,
+TRACE_glBufferStorage,
+TRACE_glMakeNamedBufferNonResidentNV,
+TRACE_glRenderbufferStorageMultisampleEXT,
+TRACE_glGetFloati_v,
+TRACE_glUniform2ui64ARB,
+TRACE_glVertex3fv,
+TRACE_glGetUniformLocation,
+TRACE_glVertexStream1svATI,
+TRACE_glVertexStream3fATI,
+TRACE_glNamedFramebufferDrawBuffers,
+TRACE_glUniform2ui64vNV,
+TRACE_glTexCoordPointervINTEL,
+TRACE_glUniform4fv,
+TRACE_glNormalPointerEXT,
+TRACE_glVertexAttrib4hNV,
+TRACE_glNormal3f,
+TRACE_glVertexStream2iATI,
+TRACE_glVertexAttribP4uiv,
+TRACE_glCompressedTextureSubImage3D,
+TRACE_glAsyncMarkerSGIX,
+TRACE_glTextureStorageSparseAMD,
+TRACE_glGetConvolutionParameterivEXT,
+TRACE_glEndPerfQueryINTEL,
+TRACE_glFragmentLightModeliSGIX,
+TRACE_glPrioritizeTexturesEXT,
+TRACE_glEndConditionalRender,
+TRACE_glEnableClientState,
+TRACE_glResetHistogram,
+TRACE_glGetOcclusionQueryivNV,
+TRACE_glUniform1uiEXT,
+TRACE_glMultiTexCoord2sv,
+TRACE_glTexSubImage2DEXT,
+TRACE_glProgramUniform2uiv,
+TRACE_glMultiTexCoord2iARB,
+TRACE_glGetQueryObjectuiv,
+TRACE_glGenerateMultiTexMipmapEXT,
+TRACE_glVertexAttrib4iv,
+TRACE_glWindowPos3dvMESA,
+TRACE_glLabelObjectEXT,
+TRACE_glProgramUniform1uiv,
+TRACE_glFramebufferTexture,
+TRACE_glMultiTexEnvfEXT,
+TRACE_glGetTexGendv,
+TRACE_glVertex4xOES,
+TRACE_glVertexAttribI2uivEXT,
+TRACE_glNamedProgramLocalParameter4fvEXT,
+TRACE_glColor3usv,
+TRACE_glGetPixelTransformParameterfvEXT,
+TRACE_glIndexxvOES,
+TRACE_glDepthMask,
+TRACE_glProgramUniformMatrix2x4fv,
+TRACE_glAreProgramsResidentNV,
+TRACE_glColorTable,
+TRACE_glBeginQueryIndexed,
+TRACE_glVertexStream1dvATI,
+TRACE_glGetMultiTexEnvfvEXT,
+TRACE_glDeleteFencesNV,
+TRACE_glVertexAttribs1dvNV,
+TRACE_glBufferStorageExternalEXT,
+TRACE_glVertexStream2sATI,
+TRACE_glGetnSeparableFilterARB,
+TRACE_glProgramUniform2dv,
+TRACE_glActiveStencilFaceEXT,
+TRACE_glProgramUniform4dEXT,
+TRACE_glPointSizexOES,
+TRACE_glRasterPos2sv,
+TRACE_glBindParameterEXT,
+TRACE_glTexCoord1sv,
+TRACE_glBlendParameteriNV,
+TRACE_glNamedProgramLocalParameter4dvEXT,
+TRACE_glProgramUniformHandleui64NV,
+TRACE_glGetTextureParameterfvEXT,
+TRACE_glGetPathMetricsNV,
+TRACE_glVertex2i,
+TRACE_glNewList,
+TRACE_glMatrixLoad3x3fNV,
+TRACE_glMultiTexCoord2fARB,
+TRACE_glWeightdvARB,
+TRACE_glIsTransformFeedbackNV,
+TRACE_glVertexAttribDivisorARB,
+TRACE_glSecondaryColorP3uiv,
+TRACE_glGetnCompressedTexImageARB,
+TRACE_glGetIntegerv,
+TRACE_glMatrixLoaddEXT,
+TRACE_glGetPathLengthNV,
+TRACE_glProgramUniformMatrix3dv,
+TRACE_glUniform4i64NV,
+TRACE_glGetHistogramEXT,
+TRACE_glVertexAttrib4NuivARB,
+TRACE_glMapGrid2xOES,
+TRACE_glTexImage2D,
+TRACE_glWindowPos2fvARB,
+TRACE_glEnableIndexedEXT,
+TRACE_glTexCoord1bvOES,
+TRACE_glDrawPixels,
+TRACE_glMultMatrixd,
+TRACE_glMultMatrixf,
+TRACE_glReplacementCodePointerSUN,
+TRACE_glLoadTransposeMatrixdARB,
+TRACE_glVertexAttrib4Nubv,
+TRACE_glVertexArrayVertexAttribIOffsetEXT,
+TRACE_glCompileShaderARB,
+TRACE_glWindowPos3dMESA,
+TRACE_glNormalStream3fvATI,
+TRACE_glColor4usv,
+TRACE_glMapGrid1f,
+TRACE_glPolygonStipple,
+TRACE_glUniform4ui64ARB,
+TRACE_glTextureRenderbufferEXT,
+TRACE_glGetSubroutineUniformLocation,
+TRACE_glGetFramebufferParameteriv,
+TRACE_glPixelMapusv,
+TRACE_glGetSamplerParameteriv,
+TRACE_glVertexStream2fvATI,
+TRACE_glProgramStringARB,
+TRACE_glProgramUniformMatrix3dvEXT,
+TRACE_glSeparableFilter2D,
+TRACE_glVertexAttribI1uiv,
+TRACE_glLGPUCopyImageSubDataNVX,
+TRACE_glTexStorage2D,
+TRACE_glColor3fv,
+TRACE_glGetMultiTexGendvEXT,
+TRACE_glVertexAttribL4dvEXT,
+TRACE_glGetActiveUniform,
+TRACE_glUniform2ui64vARB,
+TRACE_glMakeNamedBufferResidentNV,
+TRACE_glPathGlyphIndexRangeNV,
+TRACE_glColorPointer,
+TRACE_glProgramEnvParameterI4ivNV,
+TRACE_glMulticastGetQueryObjectui64vNV,
+TRACE_glMultiTexParameterfEXT,
+TRACE_glNamedFramebufferTextureLayer,
+TRACE_glGetVertexArrayIntegervEXT,
+TRACE_glVertexAttrib3dARB,
+TRACE_glVDPAUIsSurfaceNV,
+TRACE_glMultiTexImage1DEXT,
+TRACE_glIsAsyncMarkerSGIX,
+TRACE_glGetDoublei_vEXT,
+TRACE_glUniform2i64NV,
+TRACE_glIsCommandListNV,
+TRACE_glUniform3uiEXT,
+TRACE_glTexParameterIuivEXT,
+TRACE_glProgramUniformMatrix4fv,
+TRACE_glVertex2fv,
+TRACE_glVertexAttribL3dEXT,
+TRACE_glFramebufferRenderbuffer,
+TRACE_glGetUniformLocationARB,
+TRACE_glPathParameterfvNV,
+TRACE_glVertexAttrib3sNV,
+TRACE_glGetDoublei_v,
+TRACE_glVertexAttrib1sv,
+TRACE_glBindSampler,
+TRACE_glLineWidth,
+TRACE_glVertexArrayRangeAPPLE,
+TRACE_glBindBufferOffsetEXT,
+TRACE_glWeightfvARB,
+TRACE_glGetIntegeri_v,
+TRACE_glGetTransformFeedbackVarying,
+TRACE_glProgramLocalParameter4fvARB,
+TRACE_glGetTransformFeedbackVaryingNV,
+TRACE_glWindowPos2iv,
+TRACE_glVertexStream1dATI,
+TRACE_glColorFragmentOp2ATI,
+TRACE_glFogiv,
+TRACE_glGetTextureHandleNV,
+TRACE_glLightModeliv,
+TRACE_glDepthRangef,
+TRACE_glGetFragmentMaterialivSGIX,
+TRACE_glVideoCaptureStreamParameterfvNV,
+TRACE_glDeleteProgramsARB,
+TRACE_glWindowPos3fvARB,
+TRACE_glFeedbackBufferxOES,
+TRACE_glGetTexBumpParameterfvATI,
+TRACE_glEnablei,
+TRACE_glGetActiveSubroutineName,
+TRACE_glDrawBuffersARB,
+TRACE_glBindProgramARB,
+TRACE_glEvalCoord1fv,
+TRACE_glProgramUniform3ui64vARB,
+TRACE_glProgramUniformMatrix2dv,
+TRACE_glMultiTexCoord2hvNV,
+TRACE_glGetFloatIndexedvEXT,
+TRACE_glSampleCoverageARB,
+TRACE_glProgramUniform2ui64vARB,
+TRACE_glPixelDataRangeNV,
+TRACE_glVertexStream3svATI,
+TRACE_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,
+TRACE_glTexCoord3hvNV,
+TRACE_glSampleMaski,
+TRACE_glIndexFuncEXT,
+TRACE_glPointParameteriNV,
+TRACE_glUniformMatrix3x2fv,
+TRACE_glGetFramebufferParameterivEXT,
+TRACE_glUniform2i64ARB,
+TRACE_glNamedBufferStorageEXT,
+TRACE_glNamedFramebufferTexture3DEXT,
+TRACE_glVertexAttrib2dv,
+TRACE_glGetVertexArrayPointervEXT,
+TRACE_glGetVertexAttribArrayObjectivATI,
+TRACE_glProgramUniformMatrix3fvEXT,
+TRACE_glEnableVertexArrayEXT,
+TRACE_glColorTableParameterfvSGI,
+TRACE_glEdgeFlag,
+TRACE_glFogCoordf,
+TRACE_glVertex3d,
+TRACE_glVertex3f,
+TRACE_glSpriteParameterivSGIX,
+TRACE_glPathGlyphRangeNV,
+TRACE_glPrimitiveBoundingBoxARB,
+TRACE_glVertexAttribL3ui64vNV,
+TRACE_glVertex3s,
+TRACE_glTexCoordP2ui,
+TRACE_glProgramUniform2fvEXT,
+TRACE_glDeletePathsNV,
+TRACE_glPrimitiveRestartIndexNV,
+TRACE_glTexCoord2fColor3fVertex3fvSUN,
+TRACE_glTexCoordPointerListIBM,
+TRACE_glRectxOES,
+TRACE_glCopyNamedBufferSubData,
+TRACE_glGenProgramsNV,
+TRACE_glFragmentLightfSGIX,
+TRACE_glTexStorage3D,
+TRACE_glTextureParameteriv,
+TRACE_glNamedBufferDataEXT,
+TRACE_glImportSemaphoreWin32NameEXT,
+TRACE_glMultiTexCoord3fvARB,
+TRACE_glUniformMatrix3x4fv,
+TRACE_glSubpixelPrecisionBiasNV,
+TRACE_glNormalPointer,
+TRACE_glNamedFramebufferTexture,
+TRACE_glVertexAttrib4NsvARB,
+TRACE_glPassThrough,
+TRACE_glSecondaryColorP3ui,
+TRACE_glInvalidateTexSubImage,
+TRACE_glIsImageHandleResidentARB,
+TRACE_glTangent3fvEXT,
+TRACE_glProgramUniformMatrix4x3fv,
+TRACE_glBegin,
+TRACE_glEvalCoord2dv,
+TRACE_glColor3ubv,
+TRACE_glFogCoordfvEXT,
+TRACE_glVertexP3ui,
+TRACE_glLightfv,
+TRACE_glVertexAttribL3i64NV,
+TRACE_glStencilClearTagEXT,
+TRACE_glGetActiveUniformName,
+TRACE_glTangentPointerEXT,
+TRACE_glUniform4ui64vNV,
+TRACE_glDebugMessageEnableAMD,
+TRACE_glProgramUniform2ui,
+TRACE_glCopyTexSubImage2DEXT,
+TRACE_glGenRenderbuffersEXT,
+TRACE_glNamedProgramLocalParameterI4ivEXT,
+TRACE_glMultiTexCoord2f,
+TRACE_glMapGrid2d,
+TRACE_glGetMultiTexParameterIuivEXT,
+TRACE_glBlendEquationiARB,
+TRACE_glTexParameteriv,
+TRACE_glUniform4ivARB,
+TRACE_glMatrixOrthoEXT,
+TRACE_glVertexArrayVertexBuffer,
+TRACE_glProgramLocalParametersI4ivNV,
+TRACE_glProgramUniform4ui64vNV,
+TRACE_glGetNamedStringivARB,
+TRACE_glVertexAttribL1i64vNV,
+TRACE_glTransformFeedbackBufferBase,
+TRACE_glIndexsv,
+TRACE_glPointParameterivNV,
+TRACE_glGetDetailTexFuncSGIS,
+TRACE_glReplacementCodeuiColor3fVertex3fvSUN,
+TRACE_glProgramLocalParameter4fARB,
+TRACE_glBitmap,
+TRACE_glNamedFramebufferTextureLayerEXT,
+TRACE_glMultiTexGenfvEXT,
+TRACE_glGetNamedBufferSubData,
+TRACE_glStencilFuncSeparateATI,
+TRACE_glProgramUniform2iv,
+TRACE_glGetQueryiv,
+TRACE_glTexCoord4f,
+TRACE_glMapGrid2f,
+TRACE_glListParameterivSGIX,
+TRACE_glCreateQueries,
+TRACE_glGetSamplerParameterfv,
+TRACE_glTexCoord4i,
+TRACE_glObjectLabel,
+TRACE_glProgramUniform3i64NV,
+TRACE_glGetTextureHandleARB,
+TRACE_glTexCoord4s,
+TRACE_glUniform4iARB,
+TRACE_glGetUniformIndices,
+TRACE_glMultiTexImage3DEXT,
+TRACE_glCoverageModulationTableNV,
+TRACE_glPointParameteriv,
+TRACE_glMultiTexCoord4svARB,
+TRACE_glNormal3fv,
+TRACE_glProgramUniformMatrix3x4dvEXT,
+TRACE_glTexCoord1fv,
+TRACE_glProgramUniformMatrix4x3dvEXT,
+TRACE_glGetActiveVaryingNV,
+TRACE_glUniform1i64vARB,
+TRACE_glMultiTexCoord1dv,
+TRACE_glTexCoord3fv,
+TRACE_glMatrixTranslatefEXT,
+TRACE_glProgramUniform1ui64vNV,
+TRACE_glTextureMaterialEXT,
+TRACE_glMultiTexCoordP3uiv,
+TRACE_glVertexAttribP3ui,
+TRACE_glInterpolatePathsNV,
+TRACE_glTextureBufferRange,
+TRACE_glVertexAttribL2dEXT,
+TRACE_glGetPixelTransformParameterivEXT,
+TRACE_glTexCoord4xvOES,
+TRACE_glGetVariantBooleanvEXT,
+TRACE_glDepthRange,
+TRACE_glGetVertexAttribdvARB,
+TRACE_glGetColorTableParameterfv,
+TRACE_glDrawArraysInstancedEXT,
+TRACE_glDisableClientStateIndexedEXT,
+TRACE_glDrawBuffer,
+TRACE_glMultiDrawArraysIndirectBindlessNV,
+TRACE_glGetnPixelMapusv,
+TRACE_glRasterPos3fv,
+TRACE_glClearBufferuiv,
+TRACE_glGetInternalformati64v,
+TRACE_glShaderSourceARB,
+TRACE_glShaderOp3EXT,
+TRACE_glWindowPos2dvMESA,
+TRACE_glClearIndex,
+TRACE_glProvokingVertexEXT,
+TRACE_glVariantubvEXT,
+TRACE_glFlush,
+TRACE_glFramebufferTexture2DEXT,
+TRACE_glGetColorTableParameterivEXT,
+TRACE_glPresentFrameDualFillNV,
+TRACE_glGenVertexShadersEXT,
+TRACE_glSpecializeShaderARB,
+TRACE_glProgramUniformHandleui64vARB,
+TRACE_glDepthRangefOES,
+TRACE_glDeleteVertexArrays,
+TRACE_glDrawElementsInstancedBaseVertexBaseInstance,
+TRACE_glGetTexLevelParameteriv,
+TRACE_glDrawVkImageNV,
+TRACE_glWindowPos3iARB,
+TRACE_glPrioritizeTextures,
+TRACE_glWindowPos3fvMESA,
+TRACE_glProgramUniformMatrix3x2dvEXT,
+TRACE_glVertex4xvOES,
+TRACE_glTexStorage3DMultisample,
+TRACE_glWindowPos2sARB,
+TRACE_glStencilOpValueAMD,
+TRACE_glProgramVertexLimitNV,
+TRACE_glGetTexParameterPointervAPPLE,
+TRACE_glProgramUniform3uivEXT,
+TRACE_glClampColor,
+TRACE_glClearStencil,
+TRACE_glTexCoordP1uiv,
+TRACE_glVertexAttribs3svNV,
+TRACE_glMultiTexCoord3fv,
+TRACE_glVertexBlendEnvfATI,
+TRACE_glIsFenceAPPLE,
+TRACE_glGetBufferParameterui64vNV,
+TRACE_glVertexAttribI4bvEXT,
+TRACE_glUniform2fARB,
+TRACE_glStopInstrumentsSGIX,
+TRACE_glVertexAttrib3fNV,
+TRACE_glMapVertexAttrib2dAPPLE,
+TRACE_glVertex2f,
+TRACE_glCopyTextureImage2DEXT,
+TRACE_glVertex2d,
+TRACE_glSecondaryColor3bvEXT,
+TRACE_glMultiTexCoord4fARB,
+TRACE_glPolygonOffset,
+TRACE_glTangent3bvEXT,
+TRACE_glHistogram,
+TRACE_glGetProgramiv,
+TRACE_glMatrixIndexubvARB,
+TRACE_glVertex2s,
+TRACE_glGetVertexAttribLui64vNV,
+TRACE_glGetProgramStringARB,
+TRACE_glFlushMappedBufferRange,
+TRACE_glVertexAttribI3uiEXT,
+TRACE_glLineWidthxOES,
+TRACE_glProgramUniformMatrix2fvEXT,
+TRACE_glGetTextureParameterIuivEXT,
+TRACE_glGetMultiTexEnvivEXT,
+TRACE_glPixelTexGenParameterivSGIS,
+TRACE_glGenQueries,
+TRACE_glGetPixelMapfv,
+TRACE_glBlendColorEXT,
+TRACE_glResetMinmax,
+TRACE_glGetnUniformivARB,
+TRACE_glVertexBlendARB,
+TRACE_glVertexAttrib4d,
+TRACE_glGetVaryingLocationNV,
+TRACE_glGetMapAttribParameterivNV,
+TRACE_glTexSubImage3D,
+TRACE_glDeleteSamplers,
+TRACE_glGetLightxOES,
+TRACE_glGetVertexAttribArrayObjectfvATI,
+TRACE_glVertexArrayNormalOffsetEXT,
+TRACE_glGetBufferParameterivARB,
+TRACE_glGetTextureParameterfv,
+TRACE_glDrawMeshArraysSUN,
+TRACE_glVertexAttrib4dNV,
+TRACE_glGetMultisamplefvNV,
+TRACE_glMapObjectBufferATI,
+TRACE_glGetPathCommandsNV,
+TRACE_glVertexArrayTexCoordOffsetEXT,
+TRACE_glGetHistogram,
+TRACE_glMatrixMode,
+TRACE_glColorFormatNV,
+TRACE_glProgramUniformui64NV,
+TRACE_glProgramUniformMatrix4x2fvEXT,
+TRACE_glLoadMatrixxOES,
+TRACE_glGetColorTableParameterfvEXT,
+TRACE_glRasterPos4i,
+TRACE_glVertexAttribL2i64NV,
+TRACE_glBindTextures,
+TRACE_glMatrixRotatefEXT,
+TRACE_glGetClipPlanexOES,
+TRACE_glSecondaryColor3uivEXT,
+TRACE_glGetPerfQueryInfoINTEL,
+TRACE_glGetDoublev,
+TRACE_glBindBufferRangeEXT,
+TRACE_glCompressedTexImage2D,
+TRACE_glMapBufferARB,
+TRACE_glGetPathSpacingNV,
+TRACE_glUniform4dv,
+TRACE_glGlobalAlphaFactordSUN,
+TRACE_glProgramUniform3dv,
+TRACE_glGetShaderSourceARB,
+TRACE_glVertexAttrib3dvARB,
+TRACE_glInvalidateBufferData,
+TRACE_glMatrixLoad3x2fNV,
+TRACE_glCompressedTextureSubImage1D,
+TRACE_glTexCoord3xvOES,
+TRACE_glGenTexturesEXT,
+TRACE_glTangent3iEXT,
+TRACE_glClearTexImage,
+TRACE_glBinormal3bvEXT,
+TRACE_glUniform3fv,
+TRACE_glGetnPixelMapusvARB,
+TRACE_glMemoryObjectParameterivEXT,
+TRACE_glGenSemaphoresEXT,
+TRACE_glMultiTexCoordP1ui,
+TRACE_glClearNamedBufferDataEXT,
+TRACE_glUniformMatrix4dv,
+TRACE_glWindowPos3fMESA,
+TRACE_glDeleteRenderbuffers,
+TRACE_glGetTextureLevelParameterfvEXT,
+TRACE_glGetHistogramParameterxvOES,
+TRACE_glMultiDrawElements,
+TRACE_glMakeImageHandleNonResidentNV,
+TRACE_glTexSubImage1DEXT,
+TRACE_glNormalStream3dATI,
+TRACE_glVertexAttribL4i64vNV,
+TRACE_glDrawBuffers,
+TRACE_glCopyTextureSubImage1DEXT,
+TRACE_glWindowRectanglesEXT,
+TRACE_glNamedFramebufferReadBuffer,
+TRACE_glUniform2i64vARB,
+TRACE_glVertexAttribI1uivEXT,
+TRACE_glGetTexGenfv,
+TRACE_glBeginQueryARB,
+TRACE_glUniform1iARB,
+TRACE_glVertex4bvOES,
+TRACE_glInvalidateSubFramebuffer,
+TRACE_glUniform1fvARB,
+TRACE_glTestFenceNV,
+TRACE_glBindTransformFeedback,
+TRACE_glMultiTexCoord2iv,
+TRACE_glCopyMultiTexSubImage1DEXT,
+TRACE_glVariantbvEXT,
+TRACE_glTexCoord1hNV,
+TRACE_glGenFencesNV,
+TRACE_glRasterPos3iv,
+TRACE_glVertexAttribL2ui64NV,
+TRACE_glMultiTexCoord1hvNV,
+TRACE_glGetnConvolutionFilter,
+TRACE_glNormal3bv,
+TRACE_glWeightbvARB,
+TRACE_glTexCoord4sv,
+TRACE_glUniform2uiv,
+TRACE_glBeginConditionalRenderNVX,
+TRACE_glFinish,
+TRACE_glColorTableParameterfv,
+TRACE_glFragmentCoverageColorNV,
+TRACE_glProgramUniform3ivEXT,
+TRACE_glVertexArrayVertexOffsetEXT,
+TRACE_glViewportPositionWScaleNV,
+TRACE_glGetProgramLocalParameterIuivNV,
+TRACE_glReplacementCodeuiTexCoord2fVertex3fvSUN,
+TRACE_glUniform1uiv,
+TRACE_glUniformMatrix2dv,
+TRACE_glIndexdv,
+TRACE_glSecondaryColor3ivEXT,
+TRACE_glTexCoord3iv,
+TRACE_glVertexStream4fvATI,
+TRACE_glDeformationMap3fSGIX,
+TRACE_glClearDepth,
+TRACE_glGenAsyncMarkersSGIX,
+TRACE_glDisableIndexedEXT,
+TRACE_glVertexWeightfvEXT,
+TRACE_glGetProgramLocalParameterIivNV,
+TRACE_glCompressedTexImage3DARB,
+TRACE_glProgramParameter4fNV,
+TRACE_glConvolutionParameterxOES,
+TRACE_glInsertComponentEXT,
+TRACE_glCreateTextures,
+TRACE_glSecondaryColor3iv,
+TRACE_glCreateBuffers,
+TRACE_glMultiTexCoord2xvOES,
+TRACE_glTexGenxvOES,
+TRACE_glMultTransposeMatrixf,
+TRACE_glBeginTransformFeedbackEXT,
+TRACE_glTexCoord2fColor3fVertex3fSUN,
+TRACE_glNormal3sv,
+TRACE_glFreeObjectBufferATI,
+TRACE_glBlendBarrierNV,
+TRACE_glUniform4i64vNV,
+TRACE_glGetnUniformuivARB,
+TRACE_glAlphaFragmentOp3ATI,
+TRACE_glProgramEnvParameters4fvEXT,
+TRACE_glBlendFuncSeparateEXT,
+TRACE_glConvolutionParameterivEXT,
+TRACE_glPixelTexGenSGIX,
+TRACE_glDeleteProgram,
+TRACE_glUniformMatrix4x3dv,
+TRACE_glGetVideoCaptureStreamivNV,
+TRACE_glProgramUniform4uiEXT,
+TRACE_glMakeImageHandleNonResidentARB,
+TRACE_glSecondaryColor3dEXT,
+TRACE_glDeleteQueries,
+TRACE_glNormalP3uiv,
+TRACE_glRasterPos2d,
+TRACE_glInitNames,
+TRACE_glBinormal3fvEXT,
+TRACE_glColor3dv,
+TRACE_glVertexArrayVertexAttribDivisorEXT,
+TRACE_glArrayElementEXT,
+TRACE_glProgramParameter4dNV,
+TRACE_glIndexxOES,
+TRACE_glUniform3uivEXT,
+TRACE_glPopGroupMarkerEXT,
+TRACE_glClearNamedFramebufferuiv,
+TRACE_glSetLocalConstantEXT,
+TRACE_glProgramUniform1ui64NV,
+TRACE_glColor4hvNV,
+TRACE_glGetVertexAttribfv,
+TRACE_glDispatchCompute,
+TRACE_glGetActiveAttrib,
+TRACE_glFragmentColorMaterialSGIX,
+TRACE_glTexSubImage2D,
+TRACE_glGetnMinmaxARB,
+TRACE_glLogicOp,
+TRACE_glProgramUniformMatrix3x4fv,
+TRACE_glWindowPos4iMESA,
+TRACE_glPixelTransferf,
+TRACE_glGetTextureParameterIuiv,
+TRACE_glMultiTexCoord1xOES,
+TRACE_glProgramUniformMatrix4dv,
+TRACE_glGetnUniformiv,
+TRACE_glFramebufferTexture1DEXT,
+TRACE_glVertexPointervINTEL,
+TRACE_glTextureParameterIiv,
+TRACE_glGetSeparableFilterEXT,
+TRACE_glMultiTexCoord3iARB,
+TRACE_glRasterPos4xvOES,
+TRACE_glDrawTransformFeedbackStream,
+TRACE_glVertex3hvNV,
+TRACE_glVertexArrayMultiTexCoordOffsetEXT,
+TRACE_glProvokingVertex,
+TRACE_glAccumxOES,
+TRACE_glShaderBinary,
+TRACE_glGetMultiTexGenivEXT,
+TRACE_glPointParameterxvOES,
+TRACE_glCreateStatesNV,
+TRACE_glClearDepthdNV,
+TRACE_glClearColorIuiEXT,
+TRACE_glBindMultiTextureEXT,
+TRACE_glTexGeniv,
+TRACE_glDrawElements,
+TRACE_glProgramUniform4iv,
+TRACE_glDisableVertexArrayEXT,
+TRACE_glProgramUniform3ui64NV,
+TRACE_glClientActiveTexture,
+TRACE_glMultiTexParameterIivEXT,
+TRACE_glUniform1i64ARB,
+TRACE_glUniform1iv,
+TRACE_glMulticastBarrierNV,
+TRACE_glVertexAttribArrayObjectATI,
+TRACE_glUniform2iARB,
+TRACE_glDrawArraysInstanced,
+TRACE_glVertexAttrib2sNV,
+TRACE_glTexBufferEXT,
+TRACE_glVertexStream2fATI,
+TRACE_glDebugMessageCallbackAMD,
+TRACE_glSamplerParameteriv,
+TRACE_glVertexAttrib4uiv,
+TRACE_glEndQueryIndexed,
+TRACE_glNormalStream3sATI,
+TRACE_glProgramParameteriARB,
+TRACE_glTexEnvxOES,
+TRACE_glProgramUniform1iv,
+TRACE_glDisableVertexAttribAPPLE,
+TRACE_glBindRenderbuffer,
+TRACE_glMultiTexSubImage3DEXT,
+TRACE_glIsProgram,
+TRACE_glMultiDrawElementsIndirectAMD,
+TRACE_glGetProgramInfoLog,
+TRACE_glGetLocalConstantBooleanvEXT,
+TRACE_glPixelTransformParameteriEXT,
+TRACE_glTexCoord4bOES,
+TRACE_glVertexAttrib4fv,
+TRACE_glProgramUniformMatrix2x3dv,
+TRACE_glProgramEnvParametersI4uivNV,
+TRACE_glTexCoord3xOES,
+TRACE_glLoadTransposeMatrixfARB,
+TRACE_glImageTransformParameteriHP,
+TRACE_glMultiTexCoord4xOES,
+TRACE_glVertexAttribs3fvNV,
+TRACE_glVertexAttrib2fv,
+TRACE_glUniform3ui64NV,
+TRACE_glCombinerParameterfvNV,
+TRACE_glFragmentMaterialiSGIX,
+TRACE_glGetBooleani_v,
+TRACE_glGetProgramResourceIndex,
+TRACE_glBeginConditionalRenderNV,
+TRACE_glDisableClientState,
+TRACE_glPathFogGenNV,
+TRACE_glStencilThenCoverFillPathNV,
+TRACE_glVertexArrayIndexOffsetEXT,
+TRACE_glProgramBufferParametersIuivNV,
+TRACE_glPixelTransformParameterivEXT,
+TRACE_glDisableClientStateiEXT,
+TRACE_glTexBufferARB,
+TRACE_glGetLocalConstantIntegervEXT,
+TRACE_glColor4uiv,
+TRACE_glProgramUniform3i,
+TRACE_glMultiDrawElementsIndirectBindlessCountNV,
+TRACE_glGetBufferPointervARB,
+TRACE_glMultiTexParameterIuivEXT,
+TRACE_glEvalMesh2,
+TRACE_glEvalMesh1,
+TRACE_glProgramUniform3f,
+TRACE_glStencilThenCoverFillPathInstancedNV,
+TRACE_glProgramUniform3d,
+TRACE_glMapVertexAttrib1dAPPLE,
+TRACE_glEvalCoord2fv,
+TRACE_glGetUniformivARB,
+TRACE_glLoadTransposeMatrixd,
+TRACE_glLoadTransposeMatrixf,
+TRACE_glGetPointervEXT,
+TRACE_glSignalVkSemaphoreNV,
+TRACE_glEndConditionalRenderNV,
+TRACE_glTexCoord2fNormal3fVertex3fSUN,
+TRACE_glUniform3i64vARB,
+TRACE_glProgramUniform2uiEXT,
+TRACE_glVertexAttribI1ui,
+TRACE_glProgramNamedParameter4dvNV,
+TRACE_glCompileCommandListNV,
+TRACE_glGetRenderbufferParameterivEXT,
+TRACE_glGetnPolygonStipple,
+TRACE_glIsBufferResidentNV,
+TRACE_glSecondaryColor3ubvEXT,
+TRACE_glGetNamedRenderbufferParameterivEXT,
+TRACE_glNamedFramebufferSampleLocationsfvARB,
+TRACE_glMultiTexGendvEXT,
+TRACE_glVertexArrayRangeNV,
+TRACE_glIsTextureHandleResidentNV,
+TRACE_glGetProgramEnvParameterdvARB,
+TRACE_glIsNamedStringARB,
+TRACE_glSecondaryColorFormatNV,
+TRACE_glVertexAttrib4ubvNV,
+TRACE_glTagSampleBufferSGIX,
+TRACE_glVDPAUUnregisterSurfaceNV,
+TRACE_glGetPerfQueryIdByNameINTEL,
+TRACE_glGetInteger64v,
+TRACE_glClipPlane,
+TRACE_glColor4ubVertex3fSUN,
+TRACE_glIndexub,
+TRACE_glGetProgramEnvParameterfvARB,
+TRACE_glVertexAttrib4usvARB,
+TRACE_glNamedFramebufferRenderbuffer,
+TRACE_glProgramUniformMatrix3x4dv,
+TRACE_glTestFenceAPPLE,
+TRACE_glVertexAttrib4Niv,
+TRACE_glVertexAttribL2i64vNV,
+TRACE_glColorP4uiv,
+TRACE_glUniformMatrix2x3fv,
+TRACE_glCallCommandListNV,
+TRACE_glClearBufferiv,
+TRACE_glNamedStringARB,
+TRACE_glMatrixMult3x2fNV,
+TRACE_glGetNamedProgramStringEXT,
+TRACE_glGetnHistogramARB,
+TRACE_glGetTextureLevelParameterfv,
+TRACE_glMultiTexCoord1fv,
+TRACE_glBitmapxOES,
+TRACE_glGetSamplerParameterIuiv,
+TRACE_glTexCoordP3ui,
+TRACE_glTextureSubImage1D,
+TRACE_glVertexAttribLPointerEXT,
+TRACE_glFogCoordPointerEXT,
+TRACE_glWindowPos3s,
+TRACE_glVertexAttribs2svNV,
+TRACE_glTextureImage3DEXT,
+TRACE_glWindowPos3i,
+TRACE_glWindowPos3d,
+TRACE_glWindowPos3f,
+TRACE_glIsEnabledIndexedEXT,
+TRACE_glGetNamedProgramivEXT,
+TRACE_glVertex3xvOES,
+TRACE_glColor3us,
+TRACE_glBeginPerfMonitorAMD,
+TRACE_glProgramUniformMatrix4x3dv,
+TRACE_glGetNamedProgramLocalParameterIuivEXT,
+TRACE_glReadnPixels,
+TRACE_glMultiTexCoord4f,
+TRACE_glColor3ub,
+TRACE_glMultiTexCoord4d,
+TRACE_glVertexAttribL3ui64NV,
+TRACE_glColor3ui,
+TRACE_glProgramUniform4fvEXT,
+TRACE_glVertexAttrib2sARB,
+TRACE_glMultiTexCoord4i,
+TRACE_glCheckFramebufferStatusEXT,
+TRACE_glGetnMapivARB,
+TRACE_glMultiTexCoord1ivARB,
+TRACE_glDisableVertexAttribArrayARB,
+TRACE_glGetPolygonStipple,
+TRACE_glVertexAttribI4ui,
+TRACE_glGetPathDashArrayNV,
+TRACE_glMultiTexRenderbufferEXT,
+TRACE_glCopyTextureSubImage1D,
+TRACE_glDeleteOcclusionQueriesNV,
+TRACE_glVertex4hvNV,
+TRACE_glGetnTexImage,
+TRACE_glProgramLocalParameter4dARB,
+TRACE_glBlendEquation,
+TRACE_glUnlockArraysEXT,
+TRACE_glGetQueryObjectui64vEXT,
+TRACE_glVertexAttribI4uivEXT,
+TRACE_glUniform1i64vNV,
+TRACE_glMultiTexCoord3dv,
+TRACE_glColor4sv,
+TRACE_glVertexStream4ivATI,
+TRACE_glPopClientAttrib,
+TRACE_glClearBufferData,
+TRACE_glGetProgramivNV,
+TRACE_glBeginTransformFeedback,
+TRACE_glFinishObjectAPPLE,
+TRACE_glGetMinmaxParameterivEXT,
+TRACE_glColor3iv,
+TRACE_glVertexAttrib3sv,
+TRACE_glCompressedTexImage1D,
+TRACE_glDeleteTransformFeedbacks,
+TRACE_glGetVideoi64vNV,
+TRACE_glDrawRangeElementsBaseVertex,
+TRACE_glUniform4i64vARB,
+TRACE_glTextureStorage3DMultisampleEXT,
+TRACE_glGetTexParameterfv,
+TRACE_glProgramUniformui64vNV,
+TRACE_glCompressedMultiTexImage1DEXT,
+TRACE_glProgramUniform2ivEXT,
+TRACE_glPushGroupMarkerEXT,
+TRACE_glVertexAttrib1dv,
+TRACE_glMatrixLoadIdentityEXT,
+TRACE_glMultTransposeMatrixxOES,
+TRACE_glGetPixelMapxv,
+TRACE_glFramebufferSampleLocationsfvARB,
+TRACE_glGetLightiv,
+TRACE_glBlendFuncSeparatei,
+TRACE_glAcquireKeyedMutexWin32EXT,
+TRACE_glGetBooleanIndexedvEXT,
+TRACE_glGetProgramSubroutineParameteruivNV,
+TRACE_glUniform2ui,
+TRACE_glApplyFramebufferAttachmentCMAAINTEL,
+TRACE_glWindowPos2fv,
+TRACE_glWaitVkSemaphoreNV,
+TRACE_glDisablei,
+TRACE_glSelectPerfMonitorCountersAMD,
+TRACE_glGetVertexAttribLi64vNV,
+TRACE_glBlendFuncSeparateiARB,
+TRACE_glWeightuivARB,
+TRACE_glWindowPos2iARB,
+TRACE_glGetProgramLocalParameterdvARB,
+TRACE_glGetUniformui64vARB,
+TRACE_glSecondaryColor3us,
+TRACE_glGetSynciv,
+TRACE_glMakeImageHandleResidentARB,
+TRACE_glGetProgramNamedParameterfvNV,
+TRACE_glTextureStorage3D,
+TRACE_glVertexAttrib4svNV,
+TRACE_glProgramUniform2i,
+TRACE_glListDrawCommandsStatesClientNV,
+TRACE_glProgramLocalParametersI4uivNV,
+TRACE_glBeginTransformFeedbackNV,
+TRACE_glGetProgramBinary,
+TRACE_glBinormal3iEXT,
+TRACE_glEvalPoint1,
+TRACE_glEvalPoint2,
+TRACE_glPauseTransformFeedback,
+TRACE_glWindowPos2sMESA,
+TRACE_glGlobalAlphaFactorbSUN,
+TRACE_glCreateTransformFeedbacks,
+TRACE_glTexturePageCommitmentEXT,
+TRACE_glTransformFeedbackVaryingsNV,
+TRACE_glTexSubImage1D,
+TRACE_glConvolutionParameterfvEXT,
+TRACE_glBlitFramebufferEXT,
+TRACE_glUniformMatrix4fvARB,
+TRACE_glProgramEnvParameter4dvARB,
+TRACE_glTextureStorageMem2DEXT,
+TRACE_glVertexAttribP3uiv,
+TRACE_glFogCoordFormatNV,
+TRACE_glGetMultiTexLevelParameterivEXT,
+TRACE_glIsOcclusionQueryNV,
+TRACE_glCompressedTexImage2DARB,
+TRACE_glGetProgramEnvParameterIuivNV,
+TRACE_glVertexAttrib4sv,
+TRACE_glVertexAttrib4fvARB,
+TRACE_glLoadName,
+TRACE_glBindVertexShaderEXT,
+TRACE_glGetNamedProgramLocalParameterIivEXT,
+TRACE_glProgramUniform3uiEXT,
+TRACE_glProgramUniformMatrix4x2dvEXT,
+TRACE_glTexCoord1hvNV,
+TRACE_glLoadMatrixd,
+TRACE_glTexParameterfv,
+TRACE_glVariantdvEXT,
+TRACE_glCullParameterfvEXT,
+TRACE_glUniform3dv,
+TRACE_glProgramUniform3fv,
+TRACE_glIsBufferARB,
+TRACE_glMultiTexCoord1bOES,
+TRACE_glFogCoordhNV,
+TRACE_glFramebufferSampleLocationsfvNV,
+TRACE_glGenSymbolsEXT,
+TRACE_glGetConvolutionFilter,
+TRACE_glProgramUniform1fvEXT,
+TRACE_glGetNextPerfQueryIdINTEL,
+TRACE_glCompressedTexImage1DARB,
+TRACE_glBindSamplers,
+TRACE_glGetProgramEnvParameterIivNV,
+TRACE_glGetQueryObjectui64v,
+TRACE_glVertexAttribL4ui64vNV,
+TRACE_glGetVideoivNV,
+TRACE_glGetTextureImage,
+TRACE_glProgramUniform1fv,
+TRACE_glUniformMatrix4fv,
+TRACE_glColorMask,
+TRACE_glBeginFragmentShaderATI,
+TRACE_glMultiDrawArraysEXT,
+TRACE_glGenNamesAMD,
+TRACE_glPathParameteriNV,
+TRACE_glCreateCommandListsNV,
+TRACE_glDeleteProgramPipelines,
+TRACE_glCopyColorSubTableEXT,
+TRACE_glVariantsvEXT,
+TRACE_glGenProgramPipelines,
+TRACE_glVertexArrayEdgeFlagOffsetEXT,
+TRACE_glWindowPos2s,
+TRACE_glSecondaryColor3iEXT,
+TRACE_glWindowPos2i,
+TRACE_glWindowPos2f,
+TRACE_glWindowPos2d,
+TRACE_glUniform4uivEXT,
+TRACE_glOrthoxOES,
+TRACE_glUniformSubroutinesuiv,
+TRACE_glRectdv,
+TRACE_glProgramUniform1i64vNV,
+TRACE_glVertexAttribI4uiEXT,
+TRACE_glSecondaryColor3ubEXT,
+TRACE_glCompressedMultiTexSubImage1DEXT,
+TRACE_glMultiTexGendEXT,
+TRACE_glColorP3uiv,
+TRACE_glFogCoordfv,
+TRACE_glCompileShader,
+TRACE_glTexCoord2hNV,
+TRACE_glUniform1uivEXT,
+TRACE_glMatrixLoadTransposedEXT,
+TRACE_glIndexfv,
+TRACE_glGetCompressedTextureImage,
+TRACE_glGetUniformuivEXT,
+TRACE_glGetnPixelMapfvARB,
+TRACE_glFramebufferTextureEXT,
+TRACE_glMultiDrawElementsIndirectCount,
+TRACE_glVertexAttribIPointer,
+TRACE_glMultiTexCoordP3ui,
+TRACE_glEvaluateDepthValuesARB,
+TRACE_glGetNamedBufferParameteriv,
+TRACE_glGetNamedProgramLocalParameterfvEXT,
+TRACE_glColor4fNormal3fVertex3fvSUN,
+TRACE_glSeparableFilter2DEXT,
+TRACE_glTexParameterxOES,
+TRACE_glClearAccumxOES,
+TRACE_glInvalidateFramebuffer,
+TRACE_glWeightubvARB,
+TRACE_glVertexAttrib1d,
+TRACE_glVertexAttrib1f,
+TRACE_glVertex4fv,
+TRACE_glClearNamedFramebufferfi,
+TRACE_glGetQueryBufferObjectuiv,
+TRACE_glClearNamedFramebufferfv,
+TRACE_glEndVertexShaderEXT,
+TRACE_glVertexAttrib1s,
+TRACE_glMultiTexCoord4dvARB,
+TRACE_glMultiTexCoord1sv,
+TRACE_glUniform1ui64vNV,
+TRACE_glGetClipPlanefOES,
+TRACE_glRasterPos2s,
+TRACE_glWeightivARB,
+TRACE_glMultiTexCoord4hvNV,
+TRACE_glNormal3hNV,
+TRACE_glGetSeparableFilter,
+TRACE_glGetPathTexGenivNV,
+TRACE_glColor4bv,
+TRACE_glRasterPos2f,
+TRACE_glNamedBufferPageCommitmentARB,
+TRACE_glLoadIdentity,
+TRACE_glRasterPos2i,
+TRACE_glRasterPos4iv,
+TRACE_glMultiTexCoord2fvARB,
+TRACE_glUniformMatrix4x3fv,
+TRACE_glClearBufferfv,
+TRACE_glMultiTexCoord4hNV,
+TRACE_glTextureBarrier,
+TRACE_glReplacementCodeuivSUN,
+TRACE_glDeleteAsyncMarkersSGIX,
+TRACE_glTexCoord2bvOES,
+TRACE_glEvalCoord2xOES,
+TRACE_glGetSharpenTexFuncSGIS,
+TRACE_glProgramUniformHandleui64vNV,
+TRACE_glIglooInterfaceSGIX,
+TRACE_glWindowPos2dvARB,
+TRACE_glClearBufferfi,
+TRACE_glDrawArraysIndirect,
+TRACE_glGenVertexArrays,
+TRACE_glGetTransformFeedbacki64_v,
+TRACE_glEnableVertexArrayAttrib,
+TRACE_glProgramUniformMatrix3x2dv,
+TRACE_glVertexStream4fATI,
+TRACE_glVertexBindingDivisor,
+TRACE_glGetSamplerParameterIiv,
+TRACE_glGetCoverageModulationTableNV,
+TRACE_glDepthRangedNV,
+TRACE_glVertexAttrib3f,
+TRACE_glMultiDrawRangeElementArrayAPPLE,
+TRACE_glVertexAttribFormatNV,
+TRACE_glGetQueryBufferObjecti64v,
+TRACE_glGetVertexAttribdv,
+TRACE_glGetUniformi64vARB,
+TRACE_glAreTexturesResidentEXT,
+TRACE_glGetHandleARB,
+TRACE_glVideoCaptureStreamParameterdvNV,
+TRACE_glMapParameterivNV,
+TRACE_glIsVertexArray,
+TRACE_glSecondaryColor3sEXT,
+TRACE_glGetTexParameterIivEXT,
+TRACE_glFrameTerminatorGREMEDY,
+TRACE_glBlendBarrierKHR,
+TRACE_glVertexAttrib4NubARB,
+TRACE_glPrimitiveRestartNV,
+TRACE_glVertexAttribL1ui64vARB,
+TRACE_glVertexAttribI4ivEXT,
+TRACE_glVertexAttribs4svNV,
+TRACE_glUniform1ui,
+TRACE_glVertexAttrib2fvARB,
+TRACE_glVertexAttribI4svEXT,
+TRACE_glTextureImage3DMultisampleCoverageNV,
+TRACE_glMemoryBarrier,
+TRACE_glGetVariantArrayObjectfvATI,
+TRACE_glTexCoord4fColor4fNormal3fVertex4fvSUN,
+TRACE_glIsProgramARB,
+TRACE_glBindImageTextureEXT,
+TRACE_glGetFragDataLocation,
+TRACE_glMultiTexCoord1svARB,
+TRACE_glGetMapxvOES,
+TRACE_glTextureStorage2DMultisampleEXT,
+TRACE_glGetMaterialfv,
+TRACE_glVertexAttrib4NbvARB,
+TRACE_glPixelMapuiv,
+TRACE_glColorPointerEXT,
+TRACE_glEnableClientStateiEXT,
+TRACE_glClearTexSubImage,
+TRACE_glEvalCoord1xvOES,
+TRACE_glDetachObjectARB,
+TRACE_glGetTextureParameterIiv,
+TRACE_glVariantusvEXT,
+TRACE_glCompressedTextureImage3DEXT,
+TRACE_glMultiTexCoord1dARB,
+TRACE_glGetVertexArrayIntegeri_vEXT,
+TRACE_glVertexAttribI4ubv,
+TRACE_glPixelTexGenParameterfSGIS,
+TRACE_glProgramUniformMatrix4x2dv,
+TRACE_glUniform3fARB,
+TRACE_glIsShader,
+TRACE_glConvolutionParameteriv,
+TRACE_glCopyMultiTexSubImage2DEXT,
+TRACE_glEnableVertexAttribArrayARB,
+TRACE_glMulticastCopyBufferSubDataNV,
+TRACE_glEnable,
+TRACE_glGetActiveUniformsiv,
+TRACE_glGetVertexAttribivARB,
+TRACE_glTexCoord4hvNV,
+TRACE_glUseProgramObjectARB,
+TRACE_glGetAttribLocation,
+TRACE_glVertexAttrib4dv,
+TRACE_glGetTextureParameteriv,
+TRACE_glNamedBufferStorageMemEXT,
+TRACE_glPathSubCoordsNV,
+TRACE_glMatrixIndexusvARB,
+TRACE_glGetVideouivNV,
+TRACE_glGetVideoCaptureivNV,
+TRACE_glProgramUniform3ui,
+TRACE_glVertexAttrib3svARB,
+TRACE_glGetNamedBufferParameterivEXT,
+TRACE_glMatrixScaledEXT,
+TRACE_glProgramUniformMatrix2x3fv,
+TRACE_glGetFragmentLightivSGIX,
+TRACE_glGetStringi,
+TRACE_glWindowPos2svARB,
+TRACE_glVertexAttrib2svNV,
+TRACE_glWindowPos2ivARB,
+TRACE_glGetVertexAttribPointervNV,
+TRACE_glPushMatrix,
+TRACE_glEdgeFlagPointerListIBM,
+TRACE_glGenerateMipmapEXT,
+TRACE_glWindowPos3sv,
+TRACE_glPathCoordsNV,
+TRACE_glProgramUniform1i,
+TRACE_glProgramUniform1d,
+TRACE_glProgramUniform1f,
+TRACE_glProgramParameteriEXT,
+TRACE_glCompressedMultiTexImage2DEXT,
+TRACE_glProgramUniform3iv,
+TRACE_glIndexiv,
+TRACE_glMultiTexCoord4xvOES,
+TRACE_glEGLImageTargetTexture2DOES,
+TRACE_glPixelZoom,
+TRACE_glVertex3bvOES,
+TRACE_glFramebufferReadBufferEXT,
+TRACE_glExtractComponentEXT,
+TRACE_glCombinerParameterivNV,
+TRACE_glMinmax,
+TRACE_glColorP3ui,
+TRACE_glPointParameterfvSGIS,
+TRACE_glBlendEquationi,
+TRACE_glGetFogFuncSGIS,
+TRACE_glVertexAttrib4fvNV,
+TRACE_glGetnMinmax,
+TRACE_glFragmentLightiSGIX,
+TRACE_glMultiTexCoord1bvOES,
+TRACE_glSecondaryColorPointerEXT,
+TRACE_glMultiTexCoordP4uiv,
+TRACE_glGetBufferSubDataARB,
+TRACE_glSecondaryColor3hNV,
+TRACE_glGetPathParameterivNV,
+TRACE_glFlushRasterSGIX,
+TRACE_glElementPointerATI,
+TRACE_glGetAttachedObjectsARB,
+TRACE_glUniform4iv,
+TRACE_glFogxOES,
+TRACE_glSharpenTexFuncSGIS,
+TRACE_glClearDepthfOES,
+TRACE_glDeleteCommandListsNV,
+TRACE_glSpecializeShader,
+TRACE_glVertex4hNV,
+TRACE_glSecondaryColor3dvEXT,
+TRACE_glGenTextures,
+TRACE_glTextureStorage2DMultisample,
+TRACE_glUniform3ui64vNV,
+TRACE_glBlendFuncSeparateIndexedAMD,
+TRACE_glMakeBufferResidentNV,
+TRACE_glShaderOp2EXT,
+TRACE_glGetVertexAttribivNV,
+TRACE_glTexParameterIivEXT,
+TRACE_glGetPerfQueryDataINTEL,
+TRACE_glVertexAttrib4dvARB,
+TRACE_glTextureSubImage1DEXT,
+TRACE_glGetActiveUniformBlockName,
+TRACE_glVertexAttrib2dvARB,
+TRACE_glVertexAttribPointer,
+TRACE_glDepthBoundsdNV,
+TRACE_glDeleteTexturesEXT,
+TRACE_glDrawBuffersATI,
+TRACE_glLightModelxvOES,
+TRACE_glApplyTextureEXT,
+TRACE_glGetImageHandleNV,
+TRACE_glGetMinmax,
+TRACE_glGetFixedvOES,
+TRACE_glSamplePatternEXT,
+TRACE_glUniform1f,
+TRACE_glColor4fNormal3fVertex3fSUN,
+TRACE_glFogCoorddvEXT,
+TRACE_glCopyTextureImage1DEXT,
+TRACE_glFlushMappedBufferRangeAPPLE,
+TRACE_glVertex3sv,
+TRACE_glFlushStaticDataIBM,
+TRACE_glProgramUniform4ui64NV,
+TRACE_glRasterPos4xOES,
+TRACE_glVertexAttribP1ui,
+TRACE_glProgramUniform4dvEXT,
+TRACE_glEndTransformFeedbackEXT,
+TRACE_glBinormal3dEXT,
+TRACE_glGetTextureSubImage,
+TRACE_glGetNamedRenderbufferParameteriv,
+TRACE_glBindBuffersRange,
+TRACE_glFinishAsyncSGIX,
+TRACE_glBindFragDataLocationIndexed,
+TRACE_glMultiTexCoord2dv,
+TRACE_glUniform2iv,
+TRACE_glProgramUniform2i64vNV,
+TRACE_glFlushVertexArrayRangeAPPLE,
+TRACE_glTextureParameterf,
+TRACE_glMultiTexCoord3dvARB,
+TRACE_glFeedbackBuffer,
+TRACE_glDebugMessageInsertARB,
+TRACE_glMultiTexCoord2i,
+TRACE_glTextureSubImage3D,
+TRACE_glFramebufferTexture1D,
+TRACE_glGetShaderiv,
+TRACE_glMultiTexCoord2d,
+TRACE_glArrayObjectATI,
+TRACE_glGetPointeri_vEXT,
+TRACE_glGetPerfMonitorCountersAMD,
+TRACE_glNamedBufferStorage,
+TRACE_glTexEnvxvOES,
+TRACE_glProgramUniform2ui64NV,
+TRACE_glMultiTexCoord3bOES,
+TRACE_glUniform1dv,
+TRACE_glPixelTransferi,
+TRACE_glSecondaryColor3usvEXT,
+TRACE_glProgramEnvParameterI4uivNV,
+TRACE_glVertex2sv,
+TRACE_glWindowPos4dMESA,
+TRACE_glDebugMessageControlARB,
+TRACE_glIsTextureEXT,
+TRACE_glFragmentMaterialivSGIX,
+TRACE_glLinkProgramARB,
+TRACE_glFinishFenceAPPLE,
+TRACE_glVertexArrayVertexAttribBindingEXT,
+TRACE_glTexStorageMem3DMultisampleEXT,
+TRACE_glUniform1ui64vARB,
+TRACE_glMultiTexCoord4fv,
+TRACE_glMulticastFramebufferSampleLocationsfvNV,
+TRACE_glRasterPos3d,
+TRACE_glPollAsyncSGIX,
+TRACE_glRasterPos3f,
+TRACE_glCompressedTexImage3D,
+TRACE_glVariantivEXT,
+TRACE_glUnmapTexture2DINTEL,
+TRACE_glMulticastWaitSyncNV,
+TRACE_glGetVertexAttribiv,
+TRACE_glGetPathCoordsNV,
+TRACE_glColor4xvOES,
+TRACE_glVertexAttrib3fv,
+TRACE_glRasterPos3s,
+TRACE_glVertex4bOES,
+TRACE_glTransformFeedbackVaryingsEXT,
+TRACE_glCombinerOutputNV,
+TRACE_glWindowPos4sMESA,
+TRACE_glVertexAttrib4svARB,
+TRACE_glIsList,
+TRACE_glGetInfoLogARB,
+TRACE_glUniformMatrix2fv,
+TRACE_glVertexAttribs3dvNV,
+TRACE_glGlobalAlphaFactorsSUN,
+TRACE_glGetTrackMatrixivNV,
+TRACE_glTextureParameterfvEXT,
+TRACE_glIsNamedBufferResidentNV,
+TRACE_glProgramUniform4ui64vARB,
+TRACE_glTbufferMask3DFX,
+TRACE_glCoverFillPathNV,
+TRACE_glVertexAttrib1fvARB,
+TRACE_glGenerateTextureMipmap,
+TRACE_glNamedProgramLocalParameterI4uivEXT,
+TRACE_glMultiDrawElementsBaseVertex,
+TRACE_glProgramSubroutineParametersuivNV,
+TRACE_glProgramUniformMatrix2x4dvEXT,
+TRACE_glRotatexOES,
+TRACE_glMemoryBarrierEXT,
+TRACE_glVertexAttrib3svNV,
+TRACE_glVertexStream3iATI,
+TRACE_glCompressedTexSubImage1D,
+TRACE_glSetFenceNV,
+TRACE_glAttachObjectARB,
+TRACE_glCopyConvolutionFilter1D,
+TRACE_glTexStorageMem2DMultisampleEXT,
+TRACE_glProgramParameters4fvNV,
+TRACE_glNamedFramebufferParameteriEXT,
+TRACE_glVertexAttrib4Nsv,
+TRACE_glVertexAttribI4usvEXT,
+TRACE_glTextureBufferRangeEXT,
+TRACE_glVertexP3uiv,
+TRACE_glIsPathNV,
+TRACE_glGetnUniformi64vARB,
+TRACE_glFramebufferTextureMultiviewOVR,
+TRACE_glCompressedMultiTexSubImage2DEXT,
+TRACE_glGetnMapdv,
+TRACE_glDebugMessageCallback,
+TRACE_glTangent3svEXT,
+TRACE_glVertexAttribParameteriAMD,
+TRACE_glBufferSubDataARB,
+TRACE_glGetVertexAttribLui64vARB,
+TRACE_glVertexAttribL4ui64NV,
+TRACE_glReplacementCodeuiColor4ubVertex3fSUN,
+TRACE_glImageTransformParameterfHP,
+TRACE_glMap1f,
+TRACE_glRasterPos4fv,
+TRACE_glVertex2bvOES,
+TRACE_glGetMapControlPointsNV,
+TRACE_glNamedProgramLocalParametersI4ivEXT,
+TRACE_glBindBufferRangeNV,
+TRACE_glVertexStream3dvATI,
+TRACE_glNormalPointerListIBM,
+TRACE_glFogFuncSGIS,
+TRACE_glMultiModeDrawArraysIBM,
+TRACE_glGetNamedFramebufferAttachmentParameterivEXT,
+TRACE_glGetFloatv,
+TRACE_glVertexArrayVertexAttribIFormatEXT,
+TRACE_glHint,
+TRACE_glVertexStream2svATI,
+TRACE_glMultiDrawArraysIndirect,
+TRACE_glMultiTexEnvfvEXT,
+TRACE_glVertexAttribP2uiv,
+TRACE_glProgramUniform1i64vARB,
+TRACE_glFramebufferTextureARB,
+TRACE_glPushClientAttribDefaultEXT,
+TRACE_glScalef,
+TRACE_glScaled,
+TRACE_glGetConvolutionParameterxvOES,
+TRACE_glGetProgramResourceName,
+TRACE_glCopyColorTable,
+TRACE_glDepthRangeArrayv,
+TRACE_glCoverFillPathInstancedNV,
+TRACE_glMultiTexParameterivEXT,
+TRACE_glGetActiveAtomicCounterBufferiv,
+TRACE_glStencilOpSeparate,
+TRACE_glVertexAttrib4fNV,
+TRACE_glGetColorTableParameterivSGI,
+TRACE_glVertexArrayAttribBinding,
+TRACE_glIsSemaphoreEXT,
+TRACE_glProgramParameters4dvNV,
+TRACE_glVertexAttribL4dv,
+TRACE_glGetTexParameteriv,
+TRACE_glGetUniformOffsetEXT,
+TRACE_glGetVertexAttribPointerv,
+TRACE_glResumeTransformFeedbackNV,
+TRACE_glProgramUniform3i64vNV,
+TRACE_glTangent3fEXT,
+TRACE_glGetPathMetricRangeNV,
+TRACE_glWindowPos2iMESA,
+TRACE_glVertex2xvOES,
+TRACE_glGetnCompressedTexImage,
+TRACE_glWindowPos2dv,
+TRACE_glReplacementCodeuiVertex3fSUN,
+TRACE_glGetTransformFeedbackVaryingEXT,
+TRACE_glWindowPos3fARB,
+TRACE_glMapNamedBufferEXT,
+TRACE_glDisable,
+TRACE_glIsPointInFillPathNV,
+TRACE_glVertexAttribI2uiEXT,
+TRACE_glProgramUniform4uiv,
+TRACE_glQueryCounter,
+TRACE_glFramebufferRenderbufferEXT,
+TRACE_glBinormal3svEXT,
+TRACE_glBindBufferOffsetNV,
+TRACE_glCopyTextureSubImage2D,
+TRACE_glGetProgramResourcefvNV,
+TRACE_glBinormalPointerEXT,
+TRACE_glGetLightfv,
+TRACE_glMulticastCopyImageSubDataNV,
+TRACE_glVertex2bOES,
+TRACE_glUniform2ivARB,
+TRACE_glMultiTexCoord3s,
+TRACE_glGetHistogramParameterfvEXT,
+TRACE_glGetProgramStringNV,
+TRACE_glGetTexGenxvOES,
+TRACE_glTextureSubImage2D,
+TRACE_glObjectPurgeableAPPLE,
+TRACE_glColorTableSGI,
+TRACE_glCopyConvolutionFilter2DEXT,
+TRACE_glMultiTexCoord3f,
+TRACE_glMultiTexCoord3d,
+TRACE_glFogCoorddv,
+TRACE_glGetBufferPointerv,
+TRACE_glProgramUniform1fEXT,
+TRACE_glWindowPos2fvMESA,
+TRACE_glAlphaToCoverageDitherControlNV,
+TRACE_glPolygonOffsetxOES,
+TRACE_glVertexAttrib4dARB,
+TRACE_glUniformHandleui64vARB,
+TRACE_glFragmentLightModelfvSGIX,
+TRACE_glSwizzleEXT,
+TRACE_glBindFragmentShaderATI,
+TRACE_glVertexAttribs3hvNV,
+TRACE_glGenBuffersARB,
+TRACE_glTextureStorageMem2DMultisampleEXT,
+TRACE_glListParameterfvSGIX,
+TRACE_glNamedRenderbufferStorageMultisample,
+TRACE_glVertexAttribI1iEXT,
+TRACE_glMultiTexCoord2ivARB,
+TRACE_glLightModelxOES,
+TRACE_glColor3xOES,
+TRACE_glReadBuffer,
+TRACE_glStencilFillPathInstancedNV,
+TRACE_glVDPAUUnmapSurfacesNV,
+TRACE_glProgramUniform4i64NV,
+TRACE_glVertexStream4dvATI,
+TRACE_glIsQuery,
+TRACE_glProgramUniformMatrix4fvEXT,
+TRACE_glVertexAttrib3hNV,
+TRACE_glFlushMappedNamedBufferRange,
+TRACE_glPushName,
+TRACE_glGetClipPlane,
+TRACE_glVertex4dv,
+TRACE_glVertexAttrib3d,
+TRACE_glBlendColor,
+TRACE_glBindTransformFeedbackNV,
+TRACE_glSamplerParameterIuiv,
+TRACE_glIndexubv,
+TRACE_glNamedBufferPageCommitmentEXT,
+TRACE_glCheckNamedFramebufferStatus,
+TRACE_glGetObjectBufferfvATI,
+TRACE_glRasterPos4d,
+TRACE_glRasterPos4f,
+TRACE_glGetPerfMonitorCounterStringAMD,
+TRACE_glVertexAttrib3s,
+TRACE_glDrawElementsInstancedEXT,
+TRACE_glNamedProgramLocalParameterI4iEXT,
+TRACE_glRasterPos4s,
+TRACE_glGetProgramStageiv,
+TRACE_glGetMaterialxOES,
+TRACE_glPopMatrix,
+TRACE_glGetVideoui64vNV,
+TRACE_glTangent3bEXT,
+TRACE_glGetGraphicsResetStatusARB,
+TRACE_glUniform4i,
+TRACE_glActiveTexture,
+TRACE_glEnableVertexAttribArray,
+TRACE_glTexCoord4fVertex4fvSUN,
+TRACE_glUniform4d,
+TRACE_glUniform4f,
+TRACE_glRenderbufferStorageMultisample,
+TRACE_glCreateProgramPipelines,
+TRACE_glVertexAttribLPointer,
+TRACE_glUniform2uiEXT,
+TRACE_glMultiTexCoord3sv,
+TRACE_glDrawElementsInstancedBaseVertex,
+TRACE_glPixelTransformParameterfvEXT,
+TRACE_glDrawTransformFeedbackNV,
+TRACE_glTextureImage2DMultisampleCoverageNV,
+TRACE_glNamedRenderbufferStorageMultisampleCoverageEXT,
+TRACE_glIsTexture,
+TRACE_glMultiTexCoord4iv,
+TRACE_glTexEnvfv,
+TRACE_glPopDebugGroup,
+TRACE_glUniformBlockBinding,
+TRACE_glWindowPos2svMESA,
+TRACE_glGenerateTextureMipmapEXT,
+TRACE_glBindLightParameterEXT,
+TRACE_glTexCoord3bOES,
+TRACE_glTexCoordPointer,
+TRACE_glProgramUniformMatrix3x2fv,
+TRACE_glUniform2fvARB,
+TRACE_glProgramLocalParameterI4uivNV,
+TRACE_glFlushVertexArrayRangeNV,
+TRACE_glSecondaryColor3svEXT,
+TRACE_glGetBufferParameteriv,
+TRACE_glGetQueryIndexediv,
+TRACE_glFramebufferTexture3DEXT,
+TRACE_glLoadTransposeMatrixxOES,
+TRACE_glDeleteTransformFeedbacksNV,
+TRACE_glGetCompressedTextureImageEXT,
+TRACE_glIndexMaterialEXT,
+TRACE_glFogCoorddEXT,
+TRACE_glTexCoord2hvNV,
+TRACE_glGetFramebufferParameterfvAMD,
+TRACE_glTexEnviv,
+TRACE_glEndTransformFeedbackNV,
+TRACE_glGlobalAlphaFactoruiSUN,
+TRACE_glSelectBuffer,
+TRACE_glNamedBufferSubDataEXT,
+TRACE_glDisableVertexArrayAttrib,
+TRACE_glBlendFunc,
+TRACE_glCreateProgram,
+TRACE_glVertexStream2dATI,
+TRACE_glUniform4ui64vARB,
+TRACE_glGetSemaphoreParameterui64vEXT,
+TRACE_glPrimitiveRestartIndex,
+TRACE_glNormalStream3fATI,
+TRACE_glProgramUniformMatrix2fv,
+TRACE_glVertexAttribs1hvNV,
+TRACE_glWindowPos4svMESA,
+TRACE_glDeleteFragmentShaderATI,
+TRACE_glBindImageTextures,
+TRACE_glMap2xOES,
+TRACE_glEnd,
+TRACE_glMultiTexCoord2dARB,
+TRACE_glUniform1i64NV,
+TRACE_glPathStringNV,
+TRACE_glGetNamedFramebufferParameterivEXT,
+TRACE_glGetProgramNamedParameterdvNV,
+TRACE_glPathDashArrayNV,
+TRACE_glUniform3uiv,
+TRACE_glColor3fVertex3fvSUN,
+TRACE_glMultTransposeMatrixd,
+TRACE_glClearColor,
+TRACE_glGetImageHandleARB,
+TRACE_glTangent3dEXT,
+TRACE_glGetQueryObjectivARB,
+TRACE_glGetLocalConstantFloatvEXT,
+TRACE_glUseShaderProgramEXT,
+TRACE_glBindRenderbufferEXT,
+TRACE_glInterleavedArrays,
+TRACE_glGetPerfMonitorGroupStringAMD,
+TRACE_glUniform3ui,
+TRACE_glGetNamedProgramLocalParameterdvEXT,
+TRACE_glDeleteQueryResourceTagNV,
+TRACE_glVertexAttribI4uiv,
+TRACE_glVertexAttrib4bv,
+TRACE_glMultiTexCoord3xOES,
+TRACE_glSecondaryColor3ub,
+TRACE_glFragmentMaterialfSGIX,
+TRACE_glGetVariantArrayObjectivATI,
+TRACE_glSecondaryColor3ui,
+TRACE_glVertexAttrib1dARB,
+TRACE_glGetNamedBufferPointerv,
+TRACE_glLockArraysEXT,
+TRACE_glVertexAttribPointerNV,
+TRACE_glConvolutionParameterf,
+TRACE_glBindBufferBaseEXT,
+TRACE_glTexCoord2xvOES,
+TRACE_glGetQueryBufferObjectui64v,
+TRACE_glSetMultisamplefvAMD,
+TRACE_glPathColorGenNV,
+TRACE_glVertexAttrib3sARB,
+TRACE_glVertexAttrib4ivARB,
+TRACE_glGenTransformFeedbacks,
+TRACE_glGetVertexAttribIuiv,
+TRACE_glPixelTransformParameterfEXT,
+TRACE_glGetTexParameterIuivEXT,
+TRACE_glGetObjectParameterivARB,
+TRACE_glVertexArraySecondaryColorOffsetEXT,
+TRACE_glWindowPos2fARB,
+TRACE_glCompressedTexSubImage2D,
+TRACE_glCompressedTexSubImage3DARB,
+TRACE_glProgramBinary,
+TRACE_glPresentFrameKeyedNV,
+TRACE_glVertexAttribI4bv,
+TRACE_glPathCoverDepthFuncNV,
+TRACE_glTransformFeedbackStreamAttribsNV,
+TRACE_glSecondaryColor3usEXT,
+TRACE_glCopyColorTableSGI,
+TRACE_glProgramEnvParameter4fvARB,
+TRACE_glMultiTexCoord4sARB,
+TRACE_glGetVertexArrayIndexed64iv,
+TRACE_glMatrixMultTranspose3x3fNV,
+TRACE_glTexParameterIiv,
+TRACE_glVertexArrayAttribFormat,
+TRACE_glEndTransformFeedback,
+TRACE_glDrawCommandsStatesAddressNV,
+TRACE_glUniform4ui64NV,
+TRACE_glMaterialiv,
+TRACE_glTexImage2DMultisample,
+TRACE_glBindTextureEXT,
+TRACE_glIsBuffer,
+TRACE_glVertexAttribI1iv,
+TRACE_glGetFinalCombinerInputParameterfvNV,
+TRACE_glMultiTexCoord3bvOES,
+TRACE_glVertexAttribDivisor,
+TRACE_glCopyBufferSubData,
+TRACE_glBindTexGenParameterEXT,
+TRACE_glNormalStream3bATI,
+TRACE_glTexStorageMem2DEXT,
+TRACE_glTextureImage2DEXT,
+TRACE_glGetColorTableParameteriv,
+TRACE_glActiveTextureARB,
+TRACE_glTexCoord4xOES,
+TRACE_glNamedBufferStorageExternalEXT,
+TRACE_glSecondaryColor3fvEXT,
+TRACE_glUniformMatrix4x2fv,
+TRACE_glStartInstrumentsSGIX,
+TRACE_glProgramNamedParameter4fvNV,
+TRACE_glEndVideoCaptureNV,
+TRACE_glGenLists,
+TRACE_glUniform1fARB,
+TRACE_glNamedFramebufferTexture1DEXT,
+TRACE_glMapBufferRange,
+TRACE_glMultiDrawElementsIndirectCountARB,
+TRACE_glProgramUniformMatrix4x2fv,
+TRACE_glGetTextureParameterIivEXT,
+TRACE_glMultiTexCoord3hNV,
+TRACE_glNamedProgramLocalParametersI4uivEXT,
+TRACE_glEndList,
+TRACE_glTexCoord2fColor4fNormal3fVertex3fSUN,
+TRACE_glGenTransformFeedbacksNV,
+TRACE_glEdgeFlagv,
+TRACE_glVertexAttribI2iv,
+TRACE_glCopyMultiTexImage2DEXT,
+TRACE_glUniformMatrix3x2dv,
+TRACE_glTexImage3DMultisampleCoverageNV,
+TRACE_glGetShaderPrecisionFormat,
+TRACE_glTexSubImage4DSGIS,
+TRACE_glRasterSamplesEXT,
+TRACE_glTextureView,
+TRACE_glEvalMapsNV,
+TRACE_glGetFragDataLocationEXT,
+TRACE_glGetCompressedMultiTexImageEXT,
+TRACE_glIndexMask,
+TRACE_glPushClientAttrib,
+TRACE_glShaderSource,
+TRACE_glDispatchComputeGroupSizeARB,
+TRACE_glLGPUNamedBufferSubDataNVX,
+TRACE_glGetnPixelMapfv,
+TRACE_glTexCoordP2uiv,
+TRACE_glUniform2f,
+TRACE_glGetNamedBufferParameteri64v,
+TRACE_glCommandListSegmentsNV,
+TRACE_glTextureParameterIivEXT,
+TRACE_glMultiTexParameterfvEXT,
+TRACE_glProgramUniform2ui64ARB,
+TRACE_glVertex4d,
+TRACE_glNewObjectBufferATI,
+TRACE_glViewportSwizzleNV,
+TRACE_glBufferData,
+TRACE_glTextureImage1DEXT,
+TRACE_glGetTexParameterIiv,
+TRACE_glCopyTexSubImage1DEXT,
+TRACE_glVertex4f,
+TRACE_glUniformMatrix3fvARB,
+TRACE_glTexCoordP1ui,
+TRACE_glPointParameterfvEXT,
+TRACE_glUniform4fARB,
+TRACE_glImportMemoryFdEXT,
+TRACE_glCopyTextureSubImage3D,
+TRACE_glMultiTexCoord2fv,
+TRACE_glNamedFramebufferSamplePositionsfvAMD,
+TRACE_glNormalP3ui,
+TRACE_glDrawRangeElementArrayATI,
+TRACE_glVertexAttribI1i,
+TRACE_glDrawArraysInstancedARB,
+TRACE_glEnableVertexAttribAPPLE,
+TRACE_glGetDebugMessageLogARB,
+TRACE_glGetPathTexGenfvNV,
+TRACE_glNamedProgramLocalParameters4fvEXT,
+TRACE_glQueryResourceTagNV,
+TRACE_glVertexStream3fvATI,
+TRACE_glFramebufferTexture3D,
+TRACE_glCompressedTextureSubImage2DEXT,
+TRACE_glWindowPos3dv,
+TRACE_glCopyConvolutionFilter2D,
+TRACE_glReadInstrumentsSGIX,
+TRACE_glProgramUniform2dvEXT,
+TRACE_glSamplerParameterfv,
+TRACE_glBindBufferARB,
+TRACE_glVertexAttrib1sNV,
+TRACE_glGetMaterialiv,
+TRACE_glUniform1fv,
+TRACE_glBeginOcclusionQueryNV,
+TRACE_glGenFencesAPPLE,
+TRACE_glScissorIndexedv,
+TRACE_glDisableVariantClientStateEXT,
+TRACE_glMinmaxEXT,
+TRACE_glNormalPointervINTEL,
+TRACE_glNormal3s,
+TRACE_glGetnPixelMapuiv,
+TRACE_glNormalStream3bvATI,
+TRACE_glGetObjectParameterivAPPLE,
+TRACE_glNormal3i,
+TRACE_glUniform1ivARB,
+TRACE_glNormal3d,
+TRACE_glUpdateObjectBufferATI,
+TRACE_glNormal3b,
+TRACE_glGetUniformBufferSizeEXT,
+TRACE_glMultiTexCoord4dv,
+TRACE_glProgramUniform3i64ARB,
+TRACE_glVertexAttrib2d,
+TRACE_glVertexAttrib2f,
+TRACE_glMultiDrawElementsEXT,
+TRACE_glVertexAttrib3dv,
+TRACE_glMultiTexCoord2bOES,
+TRACE_glVertexAttrib2s,
+TRACE_glTexImage3DMultisample,
+TRACE_glGetUniformBlockIndex,
+TRACE_glReleaseKeyedMutexWin32EXT,
+TRACE_glFrontFace,
+TRACE_glEvalCoord1xOES,
+TRACE_glDrawArraysInstancedBaseInstance,
+TRACE_glIsPointInStrokePathNV,
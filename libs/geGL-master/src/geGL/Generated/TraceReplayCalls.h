@@ -0,0 +1,2926 @@
+case TRACE_glMultiDrawArraysIndirectBindlessCountNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();table.glMultiDrawArraysIndirectBindlessCountNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTextureParameterfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glTextureParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetListParameterivSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetListParameterivSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1i64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64>();table.glProgramUniform1i64ARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexArrayElementBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexArrayElementBuffer(a0,a1);r.finishCall();break;}
+case TRACE_glHintPGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glHintPGI(a0,a1);r.finishCall();break;}
+case TRACE_glStencilMaskSeparate:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glStencilMaskSeparate(a0,a1);r.finishCall();break;}
+case TRACE_glGetFramebufferAttachmentParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetFramebufferAttachmentParameterivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureStorage3DMultisample:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();table.glTextureStorage3DMultisample(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetIntegerIndexedvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint*>();table.glGetIntegerIndexedvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyTexImage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();table.glCopyTexImage1D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttrib4usv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVertexAttrib4usv(a0,a1);r.finishCall();break;}
+case TRACE_glTexRenderbufferNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glTexRenderbufferNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib3hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLhalfNV*>();table.glVertexAttrib3hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform4ui64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64>();auto const a3 = r.template arg<GLuint64>();auto const a4 = r.template arg<GLuint64>();auto const a5 = r.template arg<GLuint64>();table.glProgramUniform4ui64ARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glInstrumentsBufferSGIX:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLint*>();table.glInstrumentsBufferSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glIndexi:{auto const a0 = r.template arg<GLint>();table.glIndexi(a0);r.finishCall();break;}
+case TRACE_glMultiTexCoord2sARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glMultiTexCoord2sARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramEnvParameter4fARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glProgramEnvParameter4fARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCompressedTexSubImage3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLsizei>();auto const a10 = r.template arg<const GLvoid*>();table.glCompressedTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glEvalCoord2d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glEvalCoord2d(a0,a1);r.finishCall();break;}
+case TRACE_glEvalCoord2f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glEvalCoord2f(a0,a1);r.finishCall();break;}
+case TRACE_glIndexd:{auto const a0 = r.template arg<GLdouble>();table.glIndexd(a0);r.finishCall();break;}
+case TRACE_glSecondaryColor3hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glSecondaryColor3hvNV(a0);r.finishCall();break;}
+case TRACE_glIndexf:{auto const a0 = r.template arg<GLfloat>();table.glIndexf(a0);r.finishCall();break;}
+case TRACE_glFrustumxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();auto const a4 = r.template arg<GLfixed>();auto const a5 = r.template arg<GLfixed>();table.glFrustumxOES(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTextureStorage3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();table.glTextureStorage3DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glDrawCommandsStatesNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLintptr*>();auto const a2 = r.template arg<const GLsizei*>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<const GLuint*>();auto const a5 = r.template arg<GLuint>();table.glDrawCommandsStatesNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniform4uiEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glUniform4uiEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform3ui64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64>();auto const a3 = r.template arg<GLuint64>();auto const a4 = r.template arg<GLuint64>();table.glProgramUniform3ui64ARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glIndexs:{auto const a0 = r.template arg<GLshort>();table.glIndexs(a0);r.finishCall();break;}
+case TRACE_glVertexArrayBindVertexBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizei>();table.glVertexArrayBindVertexBufferEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glConvolutionParameteriEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glConvolutionParameteriEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor4ubVertex2fSUN:{auto const a0 = r.template arg<GLubyte>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glColor4ubVertex2fSUN(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramUniform1ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform1ivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetnMapfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLfloat*>();table.glGetnMapfv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTransformFeedbackBufferRange:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glTransformFeedbackBufferRange(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPathGlyphsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLbitfield>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLfloat>();table.glPathGlyphsNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glSecondaryColor3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glSecondaryColor3fv(a0);r.finishCall();break;}
+case TRACE_glGetCombinerInputParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint*>();table.glGetCombinerInputParameterivNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glEndPerfMonitorAMD:{auto const a0 = r.template arg<GLuint>();table.glEndPerfMonitorAMD(a0);r.finishCall();break;}
+case TRACE_glPointParameterfvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glPointParameterfvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertex2xOES:{auto const a0 = r.template arg<GLfixed>();table.glVertex2xOES(a0);r.finishCall();break;}
+case TRACE_glDrawElementsInstancedBaseInstance:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLuint>();table.glDrawElementsInstancedBaseInstance(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMultTransposeMatrixdARB:{auto const a0 = r.template arg<const GLdouble*>();table.glMultTransposeMatrixdARB(a0);r.finishCall();break;}
+case TRACE_glVertexAttribL4dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glVertexAttribL4dEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertex4iv:{auto const a0 = r.template arg<const GLint*>();table.glVertex4iv(a0);r.finishCall();break;}
+case TRACE_glCoverStrokePathInstancedNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const GLfloat*>();table.glCoverStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glDeformSGIX:{auto const a0 = r.template arg<GLbitfield>();table.glDeformSGIX(a0);r.finishCall();break;}
+case TRACE_glUniform2ui64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint64EXT>();table.glUniform2ui64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glCopyPathNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribP4ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribP4ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL2d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertexAttribL2d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetMultisamplefv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetMultisamplefv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedMultiTexSubImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLsizei>();auto const a11 = r.template arg<const void*>();table.glCompressedMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glVDPAURegisterOutputSurfaceNV:{auto const a0 = r.template arg<const void*>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();auto const result = table.glVDPAURegisterOutputSurfaceNV(a0,a1,a2,a3);r.finishCall();r.template result<GLvdpauSurfaceNV>(result);break;}
+case TRACE_glMinSampleShading:{auto const a0 = r.template arg<GLfloat>();table.glMinSampleShading(a0);r.finishCall();break;}
+case TRACE_glProgramUniform4fEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glProgramUniform4fEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCoverStrokePathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glCoverStrokePathNV(a0,a1);r.finishCall();break;}
+case TRACE_glTextureImage2DMultisampleNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();table.glTextureImage2DMultisampleNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertex3bOES:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glVertex3bOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glImportMemoryWin32HandleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();table.glImportMemoryWin32HandleEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTessellationFactorAMD:{auto const a0 = r.template arg<GLfloat>();table.glTessellationFactorAMD(a0);r.finishCall();break;}
+case TRACE_glDebugMessageControl:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLuint*>();auto const a5 = r.template arg<GLboolean>();table.glDebugMessageControl(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glIsObjectBufferATI:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsObjectBufferATI(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glPopAttrib:{table.glPopAttrib();r.finishCall();break;}
+case TRACE_glProgramUniform4iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glProgramUniform4iEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib4ubNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLubyte>();table.glVertexAttrib4ubNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColorMaterial:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glColorMaterial(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib2svARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib2svARB(a0,a1);r.finishCall();break;}
+case TRACE_glMinSampleShadingARB:{auto const a0 = r.template arg<GLfloat>();table.glMinSampleShadingARB(a0);r.finishCall();break;}
+case TRACE_glColor3b:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glColor3b(a0,a1,a2);r.finishCall();break;}
+case TRACE_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();table.glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glColor3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glColor3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVDPAUGetSurfaceivNV:{auto const a0 = r.template arg<GLvdpauSurfaceNV>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLint*>();table.glVDPAUGetSurfaceivNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColor3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glColor3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnMapiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint*>();table.glGetnMapiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glColor3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetInternalformatSampleivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint*>();table.glGetInternalformatSampleivNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib4ubv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttrib4ubv(a0,a1);r.finishCall();break;}
+case TRACE_glColor3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glColor3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribs4hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLhalfNV*>();table.glVertexAttribs4hvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4NubvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttrib4NubvARB(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord3hvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLhalfNV*>();table.glMultiTexCoord3hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixPushEXT:{auto const a0 = r.template arg<GLenum>();table.glMatrixPushEXT(a0);r.finishCall();break;}
+case TRACE_glProgramUniform2fEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glProgramUniform2fEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexArrayIndexediv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetVertexArrayIndexediv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBlitFramebuffer:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLbitfield>();auto const a9 = r.template arg<GLenum>();table.glBlitFramebuffer(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glMultiTexCoordP2ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glMultiTexCoordP2ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColorPointerListIBM:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const void**>();auto const a4 = r.template arg<GLint>();table.glColorPointerListIBM(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribL4d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glVertexAttribL4d(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetFragmentMaterialfvSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetFragmentMaterialfvSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex2iv:{auto const a0 = r.template arg<const GLint*>();table.glVertex2iv(a0);r.finishCall();break;}
+case TRACE_glGetTexEnvxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetTexEnvxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniformMatrix3dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix3dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribLdvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetVertexAttribLdvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordP3uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glTexCoordP3uiv(a0,a1);r.finishCall();break;}
+case TRACE_glDeformationMap3dSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLdouble>();auto const a6 = r.template arg<GLdouble>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLdouble>();auto const a10 = r.template arg<GLdouble>();auto const a11 = r.template arg<GLint>();auto const a12 = r.template arg<GLint>();auto const a13 = r.template arg<const GLdouble*>();table.glDeformationMap3dSGIX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);r.finishCall();break;}
+case TRACE_glResumeTransformFeedback:{table.glResumeTransformFeedback();r.finishCall();break;}
+case TRACE_glInsertEventMarkerEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLchar*>();table.glInsertEventMarkerEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTessellationModeAMD:{auto const a0 = r.template arg<GLenum>();table.glTessellationModeAMD(a0);r.finishCall();break;}
+case TRACE_glDrawCommandsAddressNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint64*>();auto const a2 = r.template arg<const GLsizei*>();auto const a3 = r.template arg<GLuint>();table.glDrawCommandsAddressNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFogi:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glFogi(a0,a1);r.finishCall();break;}
+case TRACE_glGetTexParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetTexParameterxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexPointer:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLvoid*>();table.glVertexPointer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetPerfMonitorCounterDataAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLuint*>();auto const a4 = r.template arg<GLint*>();table.glGetPerfMonitorCounterDataAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glFogf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glFogf(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord1d:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();table.glMultiTexCoord1d(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord1f:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glMultiTexCoord1f(a0,a1);r.finishCall();break;}
+case TRACE_glGetMultiTexParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetMultiTexParameterivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x4fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix3x4fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribI2i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glVertexAttribI2i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1i:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glMultiTexCoord1i(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteSemaphoresEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteSemaphoresEXT(a0,a1);r.finishCall();break;}
+case TRACE_glLoadProgramNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLubyte*>();table.glLoadProgramNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWriteMaskEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();table.glWriteMaskEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetGraphicsResetStatus:{auto const result = table.glGetGraphicsResetStatus();r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glVertexAttrib1fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib1fv(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord1s:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();table.glMultiTexCoord1s(a0,a1);r.finishCall();break;}
+case TRACE_glImageTransformParameterfvHP:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glImageTransformParameterfvHP(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFramebufferTexture2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTexture2D(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetFragmentLightfvSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetFragmentLightfvSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glListParameterfSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glListParameterfSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord3sv:{auto const a0 = r.template arg<const GLshort*>();table.glTexCoord3sv(a0);r.finishCall();break;}
+case TRACE_glNamedFramebufferRenderbufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glNamedFramebufferRenderbufferEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFragmentLightModelfSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glFragmentLightModelfSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glIndexPointerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glIndexPointerEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBlendEquationSeparateATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glBlendEquationSeparateATI(a0,a1);r.finishCall();break;}
+case TRACE_glVertexArrayAttribIFormat:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLuint>();table.glVertexArrayAttribIFormat(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();auto const a11 = r.template arg<GLfloat>();auto const a12 = r.template arg<GLfloat>();table.glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);r.finishCall();break;}
+case TRACE_glReplacementCodeubvSUN:{auto const a0 = r.template arg<const GLubyte*>();table.glReplacementCodeubvSUN(a0);r.finishCall();break;}
+case TRACE_glGenFramebuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenFramebuffers(a0,a1);r.finishCall();break;}
+case TRACE_glPixelMapx:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const GLfixed*>();table.glPixelMapx(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexSubImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const void*>();table.glTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glGetAttachedShaders:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLuint*>();table.glGetAttachedShaders(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetPixelTexGenParameterfvSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetPixelTexGenParameterfvSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glReplacementCodeuiNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();table.glReplacementCodeuiNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetDebugMessageLogAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum*>();auto const a3 = r.template arg<GLuint*>();auto const a4 = r.template arg<GLuint*>();auto const a5 = r.template arg<GLsizei*>();auto const a6 = r.template arg<GLchar*>();auto const result = table.glGetDebugMessageLogAMD(a0,a1,a2,a3,a4,a5,a6);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glVertexStream4sATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();auto const a4 = r.template arg<GLshort>();table.glVertexStream4sATI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribs4dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glVertexAttribs4dvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnMapdvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLdouble*>();table.glGetnMapdvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glOrthofOES:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glOrthofOES(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glViewportArrayv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glViewportArrayv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawElementArrayATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();table.glDrawElementArrayATI(a0,a1);r.finishCall();break;}
+case TRACE_glBufferStorageMemEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint64>();table.glBufferStorageMemEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetPathColorGenfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetPathColorGenfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3iMESA:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glWindowPos3iMESA(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord2s:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glMultiTexCoord2s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glVertex3dv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribI3uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI3uivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glUniform3ui64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLuint64>();auto const a3 = r.template arg<GLuint64>();table.glUniform3ui64ARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib2fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib2fvNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedBufferSubDataEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<void*>();table.glGetNamedBufferSubDataEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glConvolutionFilter2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const GLvoid*>();table.glConvolutionFilter2D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glMemoryBarrierByRegion:{auto const a0 = r.template arg<GLbitfield>();table.glMemoryBarrierByRegion(a0);r.finishCall();break;}
+case TRACE_glVertexArrayBindingDivisor:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexArrayBindingDivisor(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixRotatedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glMatrixRotatedEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexCoord2sv:{auto const a0 = r.template arg<const GLshort*>();table.glTexCoord2sv(a0);r.finishCall();break;}
+case TRACE_glIsProgramNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsProgramNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glUniform2dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glUniform2dv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPixelMapuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint*>();table.glGetPixelMapuiv(a0,a1);r.finishCall();break;}
+case TRACE_glDepthBoundsEXT:{auto const a0 = r.template arg<GLclampd>();auto const a1 = r.template arg<GLclampd>();table.glDepthBoundsEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLhalfNV*>();table.glVertexAttrib4hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexParameteriEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();table.glMultiTexParameteriEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetPointerv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLvoid**>();table.glGetPointerv(a0,a1);r.finishCall();break;}
+case TRACE_glPathCommandsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();table.glPathCommandsNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetListParameterfvSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetListParameterfvSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint*>();table.glGetUniformuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDebugMessageInsertAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLchar*>();table.glDebugMessageInsertAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glFrustum:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glFrustum(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttribL1ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint64EXT*>();table.glVertexAttribL1ui64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glClearColorxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glClearColorxOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix3fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glSampleMaskIndexedNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();table.glSampleMaskIndexedNV(a0,a1);r.finishCall();break;}
+case TRACE_glCompileShaderIncludeARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*const*>();auto const a3 = r.template arg<const GLint*>();table.glCompileShaderIncludeARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetArrayObjectfvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetArrayObjectfvATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream4svATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glVertexStream4svATI(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord4iARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glMultiTexCoord4iARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVariantfvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVariantfvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixLoadfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixLoadfEXT(a0,a1);r.finishCall();break;}
+case TRACE_glLoadIdentityDeformationMapSGIX:{auto const a0 = r.template arg<GLbitfield>();table.glLoadIdentityDeformationMapSGIX(a0);r.finishCall();break;}
+case TRACE_glGetRenderbufferParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetRenderbufferParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform3fEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glProgramUniform3fEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNamedRenderbufferStorage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glNamedRenderbufferStorage(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBindFragDataLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLchar*>();table.glBindFragDataLocation(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPolygonOffsetClamp:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glPolygonOffsetClamp(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFogCoordPointerListIBM:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const void**>();auto const a3 = r.template arg<GLint>();table.glFogCoordPointerListIBM(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFenceSync:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLbitfield>();auto const result = table.glFenceSync(a0,a1);r.finishCall();r.template result<GLsync>(result);break;}
+case TRACE_glGetVertexAttribIivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexAttribIivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFramebufferDrawBuffersEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLenum*>();table.glFramebufferDrawBuffersEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribs4fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glVertexAttribs4fvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPauseTransformFeedbackNV:{table.glPauseTransformFeedbackNV();r.finishCall();break;}
+case TRACE_glGetQueryObjecti64vEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint64*>();table.glGetQueryObjecti64vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVDPAUSurfaceAccessNV:{auto const a0 = r.template arg<GLvdpauSurfaceNV>();auto const a1 = r.template arg<GLenum>();table.glVDPAUSurfaceAccessNV(a0,a1);r.finishCall();break;}
+case TRACE_glValidateProgramPipeline:{auto const a0 = r.template arg<GLuint>();table.glValidateProgramPipeline(a0);r.finishCall();break;}
+case TRACE_glTexPageCommitmentARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLboolean>();table.glTexPageCommitmentARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glWindowPos3dvARB:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos3dvARB(a0);r.finishCall();break;}
+case TRACE_glStencilStrokePathInstancedNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<const GLfloat*>();table.glStencilStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glFogfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glFogfv(a0,a1);r.finishCall();break;}
+case TRACE_glGenQueriesARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenQueriesARB(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform2i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();table.glProgramUniform2i64NV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexP4ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glVertexP4ui(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream1ivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glVertexStream1ivATI(a0,a1);r.finishCall();break;}
+case TRACE_glProgramEnvParameterI4iNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glProgramEnvParameterI4iNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGenVertexArraysAPPLE:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenVertexArraysAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glDrawTransformFeedbackInstanced:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();table.glDrawTransformFeedbackInstanced(a0,a1,a2);r.finishCall();break;}
+case TRACE_glStencilThenCoverStrokePathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();table.glStencilThenCoverStrokePathNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDeleteVertexArraysAPPLE:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteVertexArraysAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedBufferParameterui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetNamedBufferParameterui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glQueryMatrixxOES:{auto const a0 = r.template arg<GLfixed*>();auto const a1 = r.template arg<GLint*>();auto const result = table.glQueryMatrixxOES(a0,a1);r.finishCall();r.template result<GLbitfield>(result);break;}
+case TRACE_glSecondaryColor3usv:{auto const a0 = r.template arg<const GLushort*>();table.glSecondaryColor3usv(a0);r.finishCall();break;}
+case TRACE_glTranslatexOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glTranslatexOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawTransformFeedback:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glDrawTransformFeedback(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2fColor4fNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();auto const a3 = r.template arg<const GLfloat*>();table.glTexCoord2fColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVDPAURegisterVideoSurfaceNV:{auto const a0 = r.template arg<const void*>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();auto const result = table.glVDPAURegisterVideoSurfaceNV(a0,a1,a2,a3);r.finishCall();r.template result<GLvdpauSurfaceNV>(result);break;}
+case TRACE_glGetTexParameterIuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetTexParameterIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindBufferBaseNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glBindBufferBaseNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIndexPointer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLvoid*>();table.glIndexPointer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenQueryResourceTagNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLint*>();table.glGenQueryResourceTagNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4Nbv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVertexAttrib4Nbv(a0,a1);r.finishCall();break;}
+case TRACE_glListParameteriSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glListParameteriSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendColorxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glBlendColorxOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniformui64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64EXT*>();table.glUniformui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsSync:{auto const a0 = r.template arg<GLsync>();auto const result = table.glIsSync(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetTextureParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetTextureParameterivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFogCoordhvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glFogCoordhvNV(a0);r.finishCall();break;}
+case TRACE_glFramebufferTextureLayerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTextureLayerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetObjectPtrLabel:{auto const a0 = r.template arg<const void*>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLchar*>();table.glGetObjectPtrLabel(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureParameteri:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glTextureParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1fARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glMultiTexCoord1fARB(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix2x3dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix2x3dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferDrawBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glFramebufferDrawBufferEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCopyColorSubTable:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glCopyColorSubTable(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetNamedFramebufferParameterfvAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLfloat*>();table.glGetNamedFramebufferParameterfvAMD(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttribL3d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertexAttribL3d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFragmentMaterialfvSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glFragmentMaterialfvSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixLoadTranspose3x3fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixLoadTranspose3x3fNV(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteNamesAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLuint*>();table.glDeleteNamesAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawRangeElementsEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();table.glDrawRangeElementsEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glOrtho:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glOrtho(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramUniform1dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform1dvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor4xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glColor4xOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexImage4DSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const void*>();table.glTexImage4DSGIS(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glProgramUniform1ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();table.glProgramUniform1ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteBuffersARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteBuffersARB(a0,a1);r.finishCall();break;}
+case TRACE_glUnmapBufferARB:{auto const a0 = r.template arg<GLenum>();auto const result = table.glUnmapBufferARB(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glCopyTexImage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();table.glCopyTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glMaterialxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glMaterialxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x4fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix2x4fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTestObjectAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const result = table.glTestObjectAPPLE(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glRenderbufferStorageEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glRenderbufferStorageEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL1ui64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();table.glVertexAttribL1ui64ARB(a0,a1);r.finishCall();break;}
+case TRACE_glEndFragmentShaderATI:{table.glEndFragmentShaderATI();r.finishCall();break;}
+case TRACE_glPathParameterivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glPathParameterivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform4uiv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform4uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFrameZoomSGIX:{auto const a0 = r.template arg<GLint>();table.glFrameZoomSGIX(a0);r.finishCall();break;}
+case TRACE_glSecondaryColor3fEXT:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glSecondaryColor3fEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLGPUInterlockNVX:{table.glLGPUInterlockNVX();r.finishCall();break;}
+case TRACE_glVertexAttribL1dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL1dv(a0,a1);r.finishCall();break;}
+case TRACE_glNormalStream3svATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glNormalStream3svATI(a0,a1);r.finishCall();break;}
+case TRACE_glPathStencilFuncNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();table.glPathStencilFuncNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSetInvariantEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();table.glSetInvariantEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTexBumpParameterivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint*>();table.glGetTexBumpParameterivATI(a0,a1);r.finishCall();break;}
+case TRACE_glBlendEquationSeparateEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glBlendEquationSeparateEXT(a0,a1);r.finishCall();break;}
+case TRACE_glEndOcclusionQueryNV:{table.glEndOcclusionQueryNV();r.finishCall();break;}
+case TRACE_glScissorArrayv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glScissorArrayv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCallList:{auto const a0 = r.template arg<GLuint>();table.glCallList(a0);r.finishCall();break;}
+case TRACE_glMapTexture2DINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLbitfield>();auto const a3 = r.template arg<GLint*>();auto const a4 = r.template arg<GLenum*>();auto const result = table.glMapTexture2DINTEL(a0,a1,a2,a3,a4);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glGetVkProcAddrNV:{auto const a0 = r.template arg<const GLchar*>();auto const result = table.glGetVkProcAddrNV(a0);r.finishCall();r.template result<GLVULKANPROCNV>(result);break;}
+case TRACE_glPixelTransferxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glPixelTransferxOES(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteRenderbuffersEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteRenderbuffersEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord4fColor4fNormal3fVertex4fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();auto const a11 = r.template arg<GLfloat>();auto const a12 = r.template arg<GLfloat>();auto const a13 = r.template arg<GLfloat>();auto const a14 = r.template arg<GLfloat>();table.glTexCoord4fColor4fNormal3fVertex4fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix4dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetnColorTable:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<void*>();table.glGetnColorTable(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glFramebufferTextureLayerARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTextureLayerARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribL2dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL2dvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetCombinerStageParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetCombinerStageParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1xvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glMultiTexCoord1xvOES(a0,a1);r.finishCall();break;}
+case TRACE_glMapBuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const result = table.glMapBuffer(a0,a1);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glSecondaryColor3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glSecondaryColor3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColor3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glSecondaryColor3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribLFormat:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribLFormat(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glElementPointerAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();table.glElementPointerAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream1fATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glVertexStream1fATI(a0,a1);r.finishCall();break;}
+case TRACE_glCoverageModulationNV:{auto const a0 = r.template arg<GLenum>();table.glCoverageModulationNV(a0);r.finishCall();break;}
+case TRACE_glSecondaryColor3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glSecondaryColor3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteSync:{auto const a0 = r.template arg<GLsync>();table.glDeleteSync(a0);r.finishCall();break;}
+case TRACE_glGetProgramParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetProgramParameterfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMaxShaderCompilerThreadsARB:{auto const a0 = r.template arg<GLuint>();table.glMaxShaderCompilerThreadsARB(a0);r.finishCall();break;}
+case TRACE_glUniformMatrix4x2dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix4x2dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexArrayVertexAttribLOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLintptr>();table.glVertexArrayVertexAttribLOffsetEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glSecondaryColor3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glSecondaryColor3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsImageHandleResidentNV:{auto const a0 = r.template arg<GLuint64>();auto const result = table.glIsImageHandleResidentNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glUniform3iv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform3iv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribL3i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint64EXT*>();table.glVertexAttribL3i64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glPolygonMode:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glPolygonMode(a0,a1);r.finishCall();break;}
+case TRACE_glFramebufferSamplePositionsfvAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLfloat*>();table.glFramebufferSamplePositionsfvAMD(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glConvolutionFilter1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();table.glConvolutionFilter1DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib1dvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib1dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glTextureSubImage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<const void*>();table.glTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glIsVertexArrayAPPLE:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsVertexArrayAPPLE(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glUseProgram:{auto const a0 = r.template arg<GLuint>();table.glUseProgram(a0);r.finishCall();break;}
+case TRACE_glLineStipple:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLushort>();table.glLineStipple(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord4fvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord4fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVideoCaptureNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint*>();auto const a2 = r.template arg<GLuint64EXT*>();auto const result = table.glVideoCaptureNV(a0,a1,a2);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glVertexArrayVertexAttribLFormatEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLuint>();table.glVertexArrayVertexAttribLFormatEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform3fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform3fvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x2fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix3x2fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glCopyTextureSubImage3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLsizei>();table.glCopyTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glMultiTexCoord2bvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLbyte*>();table.glMultiTexCoord2bvOES(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteObjectARB:{auto const a0 = r.template arg<GLhandleARB>();table.glDeleteObjectARB(a0);r.finishCall();break;}
+case TRACE_glTextureLightEXT:{auto const a0 = r.template arg<GLenum>();table.glTextureLightEXT(a0);r.finishCall();break;}
+case TRACE_glRasterPos3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glRasterPos3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3dARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glMultiTexCoord3dARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedFramebufferTextureEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();table.glNamedFramebufferTextureEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureParameteriEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();table.glTextureParameteriEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEvalCoord2xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glEvalCoord2xvOES(a0);r.finishCall();break;}
+case TRACE_glBindVideoCaptureStreamBufferNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLintptrARB>();table.glBindVideoCaptureStreamBufferNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexImage2DMultisampleCoverageNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();table.glTexImage2DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetAttribLocationARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<const GLcharARB*>();auto const result = table.glGetAttribLocationARB(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glDeleteShader:{auto const a0 = r.template arg<GLuint>();table.glDeleteShader(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib1fARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();table.glVertexAttrib1fARB(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2fColor4ubVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLubyte>();auto const a5 = r.template arg<GLubyte>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();table.glTexCoord2fColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glTexCoord4fVertex4fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();table.glTexCoord4fVertex4fSUN(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetMapdv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetMapdv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMapParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glMapParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureParameterIuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glTextureParameterIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTransformFeedbackAttribsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLint*>();auto const a2 = r.template arg<GLenum>();table.glTransformFeedbackAttribsNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFragmentLightfvSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glFragmentLightfvSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3sARB:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glWindowPos3sARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetConvolutionParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetConvolutionParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyTexSubImage3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();table.glCopyTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glVertexAttribI3i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glVertexAttribI3i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCreateShaderObjectARB:{auto const a0 = r.template arg<GLenum>();auto const result = table.glCreateShaderObjectARB(a0);r.finishCall();r.template result<GLhandleARB>(result);break;}
+case TRACE_glVertexAttribFormat:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLuint>();table.glVertexAttribFormat(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetProgramivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetProgramivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI4usv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVertexAttribI4usv(a0,a1);r.finishCall();break;}
+case TRACE_glTexParameterf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glTexParameterf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribBinding:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexAttribBinding(a0,a1);r.finishCall();break;}
+case TRACE_glGetHistogramParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetHistogramParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexParameteri:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glTexParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetShaderSource:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLchar*>();table.glGetShaderSource(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4s:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();auto const a4 = r.template arg<GLshort>();table.glVertexAttrib4s(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib4dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib4dvNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib1dvNV(a0,a1);r.finishCall();break;}
+case TRACE_glPopName:{table.glPopName();r.finishCall();break;}
+case TRACE_glTextureBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glTextureBufferEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetMultiTexImageEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<void*>();table.glGetMultiTexImageEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetPointerIndexedvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<void**>();table.glGetPointerIndexedvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsNameAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const result = table.glIsNameAMD(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glColor4ub:{auto const a0 = r.template arg<GLubyte>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();table.glColor4ub(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBufferParameteriAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glBufferParameteriAPPLE(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor4ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glColor4ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetInternalformativ:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint*>();table.glGetInternalformativ(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColor4us:{auto const a0 = r.template arg<GLushort>();auto const a1 = r.template arg<GLushort>();auto const a2 = r.template arg<GLushort>();auto const a3 = r.template arg<GLushort>();table.glColor4us(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribP1uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLuint*>();table.glVertexAttribP1uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glLinkProgram:{auto const a0 = r.template arg<GLuint>();table.glLinkProgram(a0);r.finishCall();break;}
+case TRACE_glTexCoord3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glTexCoord3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2dv:{auto const a0 = r.template arg<const GLdouble*>();table.glTexCoord2dv(a0);r.finishCall();break;}
+case TRACE_glGetObjectLabel:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLchar*>();table.glGetObjectLabel(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexPointerEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glVertexPointerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glDebugMessageCallbackARB:{auto const a0 = r.template arg<GLDEBUGPROCARB>();auto const a1 = r.template arg<const void*>();table.glDebugMessageCallbackARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetString:{auto const a0 = r.template arg<GLenum>();auto const result = table.glGetString(a0);r.finishCall();r.template result<const GLubyte*>(result);break;}
+case TRACE_glGetPathParameterfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetPathParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLightxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glLightxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEndQuery:{auto const a0 = r.template arg<GLenum>();table.glEndQuery(a0);r.finishCall();break;}
+case TRACE_glSecondaryColor3uiv:{auto const a0 = r.template arg<const GLuint*>();table.glSecondaryColor3uiv(a0);r.finishCall();break;}
+case TRACE_glPrioritizeTexturesxOES:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<const GLfixed*>();table.glPrioritizeTexturesxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEdgeFlagPointer:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLvoid*>();table.glEdgeFlagPointer(a0,a1);r.finishCall();break;}
+case TRACE_glFramebufferParameteri:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glFramebufferParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord3hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glTexCoord3hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiModeDrawElementsIBM:{auto const a0 = r.template arg<const GLenum*>();auto const a1 = r.template arg<const GLsizei*>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*const*>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();table.glMultiModeDrawElementsIBM(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCopyPixels:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();table.glCopyPixels(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribI2ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexAttribI2ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClampColorARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glClampColorARB(a0,a1);r.finishCall();break;}
+case TRACE_glColorPointervINTEL:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void**>();table.glColorPointervINTEL(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteTextures:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteTextures(a0,a1);r.finishCall();break;}
+case TRACE_glGetMinmaxParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetMinmaxParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3sMESA:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glWindowPos3sMESA(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glVertexAttrib4f(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNamedFramebufferParameteri:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glNamedFramebufferParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();table.glTexCoord2fVertex3fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glReplacementCodeusSUN:{auto const a0 = r.template arg<GLushort>();table.glReplacementCodeusSUN(a0);r.finishCall();break;}
+case TRACE_glGetNamedFramebufferParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetNamedFramebufferParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream1fvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexStream1fvATI(a0,a1);r.finishCall();break;}
+case TRACE_glCreateVertexArrays:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateVertexArrays(a0,a1);r.finishCall();break;}
+case TRACE_glBeginConditionalRender:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glBeginConditionalRender(a0,a1);r.finishCall();break;}
+case TRACE_glGetUnsignedBytevEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLubyte*>();table.glGetUnsignedBytevEXT(a0,a1);r.finishCall();break;}
+case TRACE_glConvolutionFilter1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const GLvoid*>();table.glConvolutionFilter1D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMultiTexCoord3fARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glMultiTexCoord3fARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetQueryObjectuivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetQueryObjectuivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glScalexOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glScalexOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSamplerParameteri:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glSamplerParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSamplerParameterf:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glSamplerParameterf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glShaderOp1EXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glShaderOp1EXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginVideoCaptureNV:{auto const a0 = r.template arg<GLuint>();table.glBeginVideoCaptureNV(a0);r.finishCall();break;}
+case TRACE_glGetnHistogram:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetnHistogram(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniform1d:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLdouble>();table.glUniform1d(a0,a1);r.finishCall();break;}
+case TRACE_glRenderMode:{auto const a0 = r.template arg<GLenum>();auto const result = table.glRenderMode(a0);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glClearColorIiEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glClearColorIiEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSignalSemaphoreEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLuint*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<const GLuint*>();auto const a5 = r.template arg<const GLenum*>();table.glSignalSemaphoreEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetCompressedTexImage:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLvoid*>();table.glGetCompressedTexImage(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedTextureImage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<const void*>();table.glCompressedTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetActiveUniformBlockiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetActiveUniformBlockiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform1i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glUniform1i(a0,a1);r.finishCall();break;}
+case TRACE_glMultiDrawArraysIndirectCount:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glMultiDrawArraysIndirectCount(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetTexEnvfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetTexEnvfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColorTableParameterivSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glColorTableParameterivSGI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCullFace:{auto const a0 = r.template arg<GLenum>();table.glCullFace(a0);r.finishCall();break;}
+case TRACE_glDeleteFencesAPPLE:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteFencesAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform4i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glProgramUniform4i(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniformHandleui64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64>();table.glUniformHandleui64ARB(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform4f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glProgramUniform4f(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glViewportIndexedf:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glViewportIndexedf(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform4d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glProgramUniform4d(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTexCoord1xOES:{auto const a0 = r.template arg<GLfixed>();table.glTexCoord1xOES(a0);r.finishCall();break;}
+case TRACE_glVertexStream3ivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glVertexStream3ivATI(a0,a1);r.finishCall();break;}
+case TRACE_glPointAlongPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat*>();auto const a5 = r.template arg<GLfloat*>();auto const a6 = r.template arg<GLfloat*>();auto const a7 = r.template arg<GLfloat*>();auto const result = table.glPointAlongPathNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glEndQueryARB:{auto const a0 = r.template arg<GLenum>();table.glEndQueryARB(a0);r.finishCall();break;}
+case TRACE_glVDPAUMapSurfacesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLvdpauSurfaceNV*>();table.glVDPAUMapSurfacesNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertex3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glVertex3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4uivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttrib4uivARB(a0,a1);r.finishCall();break;}
+case TRACE_glTextureStorageMem3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint64>();table.glTextureStorageMem3DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glAttachShader:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glAttachShader(a0,a1);r.finishCall();break;}
+case TRACE_glColor4hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();table.glColor4hNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetFenceivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetFenceivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2fColor4ubVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLubyte*>();auto const a2 = r.template arg<const GLfloat*>();table.glTexCoord2fColor4ubVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetColorTable:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLvoid*>();table.glGetColorTable(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFogCoordPointer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void*>();table.glFogCoordPointer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexStorageSparseAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLbitfield>();table.glTexStorageSparseAMD(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glUnmapNamedBuffer:{auto const a0 = r.template arg<GLuint>();auto const result = table.glUnmapNamedBuffer(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glTexCoord4bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glTexCoord4bvOES(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3fARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glVertexAttrib3fARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRasterPos2xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glRasterPos2xOES(a0,a1);r.finishCall();break;}
+case TRACE_glCreateMemoryObjectsEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateMemoryObjectsEXT(a0,a1);r.finishCall();break;}
+case TRACE_glColor4ubVertex2fvSUN:{auto const a0 = r.template arg<const GLubyte*>();auto const a1 = r.template arg<const GLfloat*>();table.glColor4ubVertex2fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glSecondaryColor3dv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribI4sv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttribI4sv(a0,a1);r.finishCall();break;}
+case TRACE_glDrawTransformFeedbackStreamInstanced:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();table.glDrawTransformFeedbackStreamInstanced(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord4ivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord4ivARB(a0,a1);r.finishCall();break;}
+case TRACE_glSpriteParameterfSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glSpriteParameterfSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3sv:{auto const a0 = r.template arg<const GLshort*>();table.glSecondaryColor3sv(a0);r.finishCall();break;}
+case TRACE_glBindVideoCaptureStreamTextureNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLuint>();table.glBindVideoCaptureStreamTextureNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexParameterIuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glTexParameterIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFlushPixelDataRangeNV:{auto const a0 = r.template arg<GLenum>();table.glFlushPixelDataRangeNV(a0);r.finishCall();break;}
+case TRACE_glWindowPos3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos3fv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribLFormatNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();table.glVertexAttribLFormatNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glLightModelfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glLightModelfv(a0,a1);r.finishCall();break;}
+case TRACE_glGetColorTableSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();table.glGetColorTableSGI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetCompressedTexImageARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<void*>();table.glGetCompressedTexImageARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glConvolutionParameteri:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glConvolutionParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexWeighthNV:{auto const a0 = r.template arg<GLhalfNV>();table.glVertexWeighthNV(a0);r.finishCall();break;}
+case TRACE_glColorMaskIndexedEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLboolean>();table.glColorMaskIndexedEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColorMaski:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLboolean>();table.glColorMaski(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColorFragmentOp1ATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();table.glColorFragmentOp1ATI(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribI4ubvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttribI4ubvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1dNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();table.glVertexAttrib1dNV(a0,a1);r.finishCall();break;}
+case TRACE_glUnmapObjectBufferATI:{auto const a0 = r.template arg<GLuint>();table.glUnmapObjectBufferATI(a0);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameterI4uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();table.glNamedProgramLocalParameterI4uiEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glProgramUniform1iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glProgramUniform1iEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteQueriesARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteQueriesARB(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos3svARB:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos3svARB(a0);r.finishCall();break;}
+case TRACE_glVertex4s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glVertex4s(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glImportMemoryWin32NameEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();table.glImportMemoryWin32NameEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStringMarkerGREMEDY:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const void*>();table.glStringMarkerGREMEDY(a0,a1);r.finishCall();break;}
+case TRACE_glIsTransformFeedback:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsTransformFeedback(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glProgramUniformMatrix2x3dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix2x3dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetObjectLabelEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLchar*>();table.glGetObjectLabelEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniformHandleui64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64*>();table.glUniformHandleui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRotated:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glRotated(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIsProgramPipeline:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsProgramPipeline(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glRotatef:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glRotatef(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertex4i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glVertex4i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetActiveSubroutineUniformName:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei*>();auto const a5 = r.template arg<GLchar*>();table.glGetActiveSubroutineUniformName(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib4sNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();auto const a4 = r.template arg<GLshort>();table.glVertexAttrib4sNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramLocalParameter4dvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLdouble*>();table.glProgramLocalParameter4dvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glReplacementCodeubSUN:{auto const a0 = r.template arg<GLubyte>();table.glReplacementCodeubSUN(a0);r.finishCall();break;}
+case TRACE_glMultiDrawElementsIndirectBindlessNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();table.glMultiDrawElementsIndirectBindlessNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glImportSemaphoreWin32HandleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void*>();table.glImportSemaphoreWin32HandleEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniformMatrix3fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix3fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetnMapfvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLfloat*>();table.glGetnMapfvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetnUniformfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLfloat*>();table.glGetnUniformfv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL2dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL2dv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexWeightPointerEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glVertexWeightPointerEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTangent3sEXT:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glTangent3sEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColorPointer:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glSecondaryColorPointer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glAlphaFunc:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLclampf>();table.glAlphaFunc(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedStringARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLchar*>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint*>();auto const a4 = r.template arg<GLchar*>();table.glGetNamedStringARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexCoord4d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glTexCoord4d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBufferPageCommitmentARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLboolean>();table.glBufferPageCommitmentARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramLocalParameters4fvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramLocalParameters4fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStencilFunc:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();table.glStencilFunc(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSemaphoreParameterui64vEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint64*>();table.glSemaphoreParameterui64vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVertexAttribdvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetVertexAttribdvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glTexCoord3dv(a0);r.finishCall();break;}
+case TRACE_glGetQueryBufferObjectiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLintptr>();table.glGetQueryBufferObjectiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexGenxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glTexGenxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1fvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord1fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glLightEnviSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glLightEnviSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glGetProgramPipelineiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetProgramPipelineiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream2ivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glVertexStream2ivATI(a0,a1);r.finishCall();break;}
+case TRACE_glGetColorTableEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();table.glGetColorTableEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetShaderInfoLog:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLchar*>();table.glGetShaderInfoLog(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetOcclusionQueryuivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetOcclusionQueryuivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glInvalidateNamedFramebufferSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLenum*>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();table.glInvalidateNamedFramebufferSubData(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribL1i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint64EXT>();table.glVertexAttribL1i64NV(a0,a1);r.finishCall();break;}
+case TRACE_glVDPAUInitNV:{auto const a0 = r.template arg<const void*>();auto const a1 = r.template arg<const void*>();table.glVDPAUInitNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLhalfNV*>();table.glVertexAttrib1hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribI4i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glVertexAttribI4i(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glRasterPos2iv:{auto const a0 = r.template arg<const GLint*>();table.glRasterPos2iv(a0);r.finishCall();break;}
+case TRACE_glGetIntegerui64i_vNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetIntegerui64i_vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniformHandleui64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64>();table.glUniformHandleui64NV(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos3ivMESA:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos3ivMESA(a0);r.finishCall();break;}
+case TRACE_glBlendEquationSeparate:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glBlendEquationSeparate(a0,a1);r.finishCall();break;}
+case TRACE_glDrawElementsInstancedARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();table.glDrawElementsInstancedARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetSubroutineIndex:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLchar*>();auto const result = table.glGetSubroutineIndex(a0,a1,a2);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glVertexAttrib2sv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib2sv(a0,a1);r.finishCall();break;}
+case TRACE_glSamplePatternSGIS:{auto const a0 = r.template arg<GLenum>();table.glSamplePatternSGIS(a0);r.finishCall();break;}
+case TRACE_glEGLImageTargetRenderbufferStorageOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLeglImageOES>();table.glEGLImageTargetRenderbufferStorageOES(a0,a1);r.finishCall();break;}
+case TRACE_glPushAttrib:{auto const a0 = r.template arg<GLbitfield>();table.glPushAttrib(a0);r.finishCall();break;}
+case TRACE_glVertex3hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glVertex3hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRasterPos3xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glRasterPos3xvOES(a0);r.finishCall();break;}
+case TRACE_glPathParameterfNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glPathParameterfNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformi64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64EXT*>();table.glGetUniformi64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLightiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glLightiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMaterialxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glMaterialxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameter4fEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();table.glNamedProgramLocalParameter4fEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribL1dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();table.glVertexAttribL1dEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetnUniformdvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLdouble*>();table.glGetnUniformdvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSecondaryColor3bEXT:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glSecondaryColor3bEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginPerfQueryINTEL:{auto const a0 = r.template arg<GLuint>();table.glBeginPerfQueryINTEL(a0);r.finishCall();break;}
+case TRACE_glProgramUniform1uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform1uivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glImageTransformParameterivHP:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glImageTransformParameterivHP(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteBuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteBuffers(a0,a1);r.finishCall();break;}
+case TRACE_glBindProgramPipeline:{auto const a0 = r.template arg<GLuint>();table.glBindProgramPipeline(a0);r.finishCall();break;}
+case TRACE_glScissor:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glScissor(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform4fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetBooleanv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean*>();table.glGetBooleanv(a0,a1);r.finishCall();break;}
+case TRACE_glMaterialfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glMaterialfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos4fvMESA:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos4fvMESA(a0);r.finishCall();break;}
+case TRACE_glVertexAttribIPointerEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glVertexAttribIPointerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramBufferParametersfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramBufferParametersfvNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glAlphaFuncxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glAlphaFuncxOES(a0,a1);r.finishCall();break;}
+case TRACE_glMultiDrawArraysIndirectAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glMultiDrawArraysIndirectAMD(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNormalStream3ivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glNormalStream3ivATI(a0,a1);r.finishCall();break;}
+case TRACE_glTextureImage3DMultisampleNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLboolean>();table.glTextureImage3DMultisampleNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glProgramUniform4uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform4uivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glReplacementCodeusvSUN:{auto const a0 = r.template arg<const GLushort*>();table.glReplacementCodeusvSUN(a0);r.finishCall();break;}
+case TRACE_glPollInstrumentsSGIX:{auto const a0 = r.template arg<GLint*>();auto const result = table.glPollInstrumentsSGIX(a0);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glGetTextureLevelParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetTextureLevelParameteriv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI2uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI2uiv(a0,a1);r.finishCall();break;}
+case TRACE_glMapControlPointsNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLboolean>();auto const a8 = r.template arg<const void*>();table.glMapControlPointsNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glColor4dv:{auto const a0 = r.template arg<const GLdouble*>();table.glColor4dv(a0);r.finishCall();break;}
+case TRACE_glInvalidateBufferSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();table.glInvalidateBufferSubData(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1hNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLhalfNV>();table.glMultiTexCoord1hNV(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glPointParameterfv(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix2fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix2fvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform2fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform2fv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexPointerListIBM:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const void**>();auto const a4 = r.template arg<GLint>();table.glVertexPointerListIBM(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetMultiTexGenfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetMultiTexGenfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetMinmaxEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<void*>();table.glGetMinmaxEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glIsFenceNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsFenceNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glMatrixFrustumEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();auto const a6 = r.template arg<GLdouble>();table.glMatrixFrustumEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glDispatchComputeIndirect:{auto const a0 = r.template arg<GLintptr>();table.glDispatchComputeIndirect(a0);r.finishCall();break;}
+case TRACE_glQueryResourceNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint*>();auto const result = table.glQueryResourceNV(a0,a1,a2,a3);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glMultiTexCoord4bOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();auto const a3 = r.template arg<GLbyte>();auto const a4 = r.template arg<GLbyte>();table.glMultiTexCoord4bOES(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramEnvParameter4dARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glProgramEnvParameter4dARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramUniform1uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();table.glProgramUniform1uiEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindBufferRange:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glBindBufferRange(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNormal3iv:{auto const a0 = r.template arg<const GLint*>();table.glNormal3iv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribL3dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL3dv(a0,a1);r.finishCall();break;}
+case TRACE_glGetUniformdv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble*>();table.glGetUniformdv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetMultiTexLevelParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLfloat*>();table.glGetMultiTexLevelParameterfvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glFinalCombinerInputNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glFinalCombinerInputNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCullParameterdvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble*>();table.glCullParameterdvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord4s:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();auto const a4 = r.template arg<GLshort>();table.glMultiTexCoord4s(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMapVertexAttrib1fAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<const GLfloat*>();table.glMapVertexAttrib1fAPPLE(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glConvolutionParameterfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glConvolutionParameterfEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord1iv:{auto const a0 = r.template arg<const GLint*>();table.glTexCoord1iv(a0);r.finishCall();break;}
+case TRACE_glProgramUniform3fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform3fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor3uiv:{auto const a0 = r.template arg<const GLuint*>();table.glColor3uiv(a0);r.finishCall();break;}
+case TRACE_glRenderGpuMaskNV:{auto const a0 = r.template arg<GLbitfield>();table.glRenderGpuMaskNV(a0);r.finishCall();break;}
+case TRACE_glListBase:{auto const a0 = r.template arg<GLuint>();table.glListBase(a0);r.finishCall();break;}
+case TRACE_glTexCoord2bOES:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();table.glTexCoord2bOES(a0,a1);r.finishCall();break;}
+case TRACE_glBindMaterialParameterEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const result = table.glBindMaterialParameterEXT(a0,a1);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGlobalAlphaFactorubSUN:{auto const a0 = r.template arg<GLubyte>();table.glGlobalAlphaFactorubSUN(a0);r.finishCall();break;}
+case TRACE_glVertexAttribL1ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();table.glVertexAttribL1ui64NV(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameterfSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPointParameterfSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glGetImageTransformParameterivHP:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetImageTransformParameterivHP(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColorSubTableEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();table.glColorSubTableEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glPixelTexGenParameterfvSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glPixelTexGenParameterfvSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glClientWaitSync:{auto const a0 = r.template arg<GLsync>();auto const a1 = r.template arg<GLbitfield>();auto const a2 = r.template arg<GLuint64>();auto const result = table.glClientWaitSync(a0,a1,a2);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glQueryObjectParameteruiAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glQueryObjectParameteruiAMD(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribs1fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glVertexAttribs1fvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4NusvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVertexAttrib4NusvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVariantPointerEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const void*>();table.glVariantPointerEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glTextureBuffer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI1uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexAttribI1uiEXT(a0,a1);r.finishCall();break;}
+case TRACE_glInvalidateTexImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();table.glInvalidateTexImage(a0,a1);r.finishCall();break;}
+case TRACE_glProgramEnvParametersI4ivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramEnvParametersI4ivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPathGlyphIndexArrayNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLbitfield>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLfloat>();auto const result = table.glPathGlyphIndexArrayNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glCopyImageSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLint>();auto const a10 = r.template arg<GLint>();auto const a11 = r.template arg<GLint>();auto const a12 = r.template arg<GLsizei>();auto const a13 = r.template arg<GLsizei>();auto const a14 = r.template arg<GLsizei>();table.glCopyImageSubData(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);r.finishCall();break;}
+case TRACE_glGetUniformSubroutineuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint*>();table.glGetUniformSubroutineuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindVertexBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizei>();table.glBindVertexBuffer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord1iARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glMultiTexCoord1iARB(a0,a1);r.finishCall();break;}
+case TRACE_glDebugMessageInsert:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<const GLchar*>();table.glDebugMessageInsert(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBeginVertexShaderEXT:{table.glBeginVertexShaderEXT();r.finishCall();break;}
+case TRACE_glIsVariantEnabledEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const result = table.glIsVariantEnabledEXT(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glPassThroughxOES:{auto const a0 = r.template arg<GLfixed>();table.glPassThroughxOES(a0);r.finishCall();break;}
+case TRACE_glIsSampler:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsSampler(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glConservativeRasterParameterfNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glConservativeRasterParameterfNV(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexGenivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glMultiTexGenivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedFramebufferTexture2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();table.glNamedFramebufferTexture2DEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glCopyTexSubImage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();table.glCopyTexSubImage1D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTexCoord1i:{auto const a0 = r.template arg<GLint>();table.glTexCoord1i(a0);r.finishCall();break;}
+case TRACE_glCheckFramebufferStatus:{auto const a0 = r.template arg<GLenum>();auto const result = table.glCheckFramebufferStatus(a0);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glDrawElementArrayAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();table.glDrawElementArrayAPPLE(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord1d:{auto const a0 = r.template arg<GLdouble>();table.glTexCoord1d(a0);r.finishCall();break;}
+case TRACE_glTexCoord1f:{auto const a0 = r.template arg<GLfloat>();table.glTexCoord1f(a0);r.finishCall();break;}
+case TRACE_glFragmentLightivSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glFragmentLightivSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindImageTexture:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLenum>();table.glBindImageTexture(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glTransformFeedbackVaryings:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*const*>();auto const a3 = r.template arg<GLenum>();table.glTransformFeedbackVaryings(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMulticastBufferSubDataNV:{auto const a0 = r.template arg<GLbitfield>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizeiptr>();auto const a4 = r.template arg<const GLvoid*>();table.glMulticastBufferSubDataNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glDrawRangeElements:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const GLvoid*>();table.glDrawRangeElements(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTexCoord1s:{auto const a0 = r.template arg<GLshort>();table.glTexCoord1s(a0);r.finishCall();break;}
+case TRACE_glBindBufferBase:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glBindBufferBase(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor3bv:{auto const a0 = r.template arg<const GLbyte*>();table.glColor3bv(a0);r.finishCall();break;}
+case TRACE_glSyncTextureINTEL:{auto const a0 = r.template arg<GLuint>();table.glSyncTextureINTEL(a0);r.finishCall();break;}
+case TRACE_glCreateSamplers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateSamplers(a0,a1);r.finishCall();break;}
+case TRACE_glCombinerParameterfNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glCombinerParameterfNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetArrayObjectivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetArrayObjectivATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiDrawArrays:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();auto const a2 = r.template arg<const GLsizei*>();auto const a3 = r.template arg<GLsizei>();table.glMultiDrawArrays(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSampleMapATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();table.glSampleMapATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform2i64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64>();auto const a3 = r.template arg<GLint64>();table.glProgramUniform2i64ARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBinormal3ivEXT:{auto const a0 = r.template arg<const GLint*>();table.glBinormal3ivEXT(a0);r.finishCall();break;}
+case TRACE_glMultiDrawArraysIndirectCountARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glMultiDrawArraysIndirectCountARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTextureStorageMem1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint64>();table.glTextureStorageMem1DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glWindowPos2ivMESA:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos2ivMESA(a0);r.finishCall();break;}
+case TRACE_glTexCoordP4ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glTexCoordP4ui(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexSubImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<const void*>();table.glMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x3fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix2x3fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBufferDataARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizeiptrARB>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLenum>();table.glBufferDataARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribIFormat:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribIFormat(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCreateFramebuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateFramebuffers(a0,a1);r.finishCall();break;}
+case TRACE_glNormalStream3dvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glNormalStream3dvATI(a0,a1);r.finishCall();break;}
+case TRACE_glClearAccum:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glClearAccum(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform3i64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64EXT*>();table.glUniform3i64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniform2uivEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform2uivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginQuery:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBeginQuery(a0,a1);r.finishCall();break;}
+case TRACE_glStencilThenCoverStrokePathInstancedNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const GLfloat*>();table.glStencilThenCoverStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glBindBuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindBuffer(a0,a1);r.finishCall();break;}
+case TRACE_glMap2d:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLdouble>();auto const a6 = r.template arg<GLdouble>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<const GLdouble*>();table.glMap2d(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glMap2f:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<const GLfloat*>();table.glMap2f(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glMakeImageHandleResidentNV:{auto const a0 = r.template arg<GLuint64>();auto const a1 = r.template arg<GLenum>();table.glMakeImageHandleResidentNV(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix2x4fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix2x4fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetMultiTexParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetMultiTexParameterfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDepthRangeIndexed:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glDepthRangeIndexed(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsEnabled:{auto const a0 = r.template arg<GLenum>();auto const result = table.glIsEnabled(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glMatrixScalefEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glMatrixScalefEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetError:{auto const result = table.glGetError();r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glGetTexEnviv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTexEnviv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindTextureUnitParameterEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const result = table.glBindTextureUnitParameterEXT(a0,a1);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGetnUniformfvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLfloat*>();table.glGetnUniformfvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glReplacementCodeuiNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();table.glReplacementCodeuiNormal3fVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeletePerfQueryINTEL:{auto const a0 = r.template arg<GLuint>();table.glDeletePerfQueryINTEL(a0);r.finishCall();break;}
+case TRACE_glActiveVaryingNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();table.glActiveVaryingNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetActiveUniformARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLint*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLcharARB*>();table.glGetActiveUniformARB(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribI3ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI3ivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glEvalCoord1d:{auto const a0 = r.template arg<GLdouble>();table.glEvalCoord1d(a0);r.finishCall();break;}
+case TRACE_glNamedCopyBufferSubDataEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glNamedCopyBufferSubDataEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glEvalCoord1f:{auto const a0 = r.template arg<GLfloat>();table.glEvalCoord1f(a0);r.finishCall();break;}
+case TRACE_glPixelMapfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glPixelMapfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI1ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI1ivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCreateSyncFromCLeventARB:{auto const a0 = r.template arg<struct _cl_context*>();auto const a1 = r.template arg<struct _cl_event*>();auto const a2 = r.template arg<GLbitfield>();auto const result = table.glCreateSyncFromCLeventARB(a0,a1,a2);r.finishCall();r.template result<GLsync>(result);break;}
+case TRACE_glGetPixelMapusv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLushort*>();table.glGetPixelMapusv(a0,a1);r.finishCall();break;}
+case TRACE_glGetnColorTableARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<void*>();table.glGetnColorTableARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glAccum:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glAccum(a0,a1);r.finishCall();break;}
+case TRACE_glRasterPos3sv:{auto const a0 = r.template arg<const GLshort*>();table.glRasterPos3sv(a0);r.finishCall();break;}
+case TRACE_glTexCoord2iv:{auto const a0 = r.template arg<const GLint*>();table.glTexCoord2iv(a0);r.finishCall();break;}
+case TRACE_glBlendFunciARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glBlendFunciARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform3i64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64*>();table.glProgramUniform3i64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetFramebufferAttachmentParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetFramebufferAttachmentParameteriv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glProgramUniform4ui(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glStencilMask:{auto const a0 = r.template arg<GLuint>();table.glStencilMask(a0);r.finishCall();break;}
+case TRACE_glResetHistogramEXT:{auto const a0 = r.template arg<GLenum>();table.glResetHistogramEXT(a0);r.finishCall();break;}
+case TRACE_glLightxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glLightxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedBufferData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLenum>();table.glNamedBufferData(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexStream3sATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glVertexStream3sATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib3fvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib3fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glClearNamedBufferSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizeiptr>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();table.glClearNamedBufferSubData(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glProgramUniformHandleui64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64>();table.glProgramUniformHandleui64ARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform3iARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glUniform3iARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCreateProgramObjectARB:{auto const result = table.glCreateProgramObjectARB();r.finishCall();r.template result<GLhandleARB>(result);break;}
+case TRACE_glMultiTexCoord1dvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord1dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetObjectParameterfvARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetObjectParameterfvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRectsv:{auto const a0 = r.template arg<const GLshort*>();auto const a1 = r.template arg<const GLshort*>();table.glRectsv(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<const void*>();table.glMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glProgramUniform1i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64EXT>();table.glProgramUniform1i64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetObjectBufferivATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetObjectBufferivATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform4i64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64>();auto const a2 = r.template arg<GLint64>();auto const a3 = r.template arg<GLint64>();auto const a4 = r.template arg<GLint64>();table.glUniform4i64ARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glReplacementCodeuiColor4ubVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLubyte*>();auto const a2 = r.template arg<const GLfloat*>();table.glReplacementCodeuiColor4ubVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendFuncSeparateINGR:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glBlendFuncSeparateINGR(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVideoCaptureStreamfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetVideoCaptureStreamfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib2fARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glVertexAttrib2fARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTexGeniv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTexGeniv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPixelStorei:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPixelStorei(a0,a1);r.finishCall();break;}
+case TRACE_glGetCompressedTextureSubImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<void*>();table.glGetCompressedTextureSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glCopyImageSubDataNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLint>();auto const a10 = r.template arg<GLint>();auto const a11 = r.template arg<GLint>();auto const a12 = r.template arg<GLsizei>();auto const a13 = r.template arg<GLsizei>();auto const a14 = r.template arg<GLsizei>();table.glCopyImageSubDataNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);r.finishCall();break;}
+case TRACE_glActiveShaderProgram:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glActiveShaderProgram(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream1iATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glVertexStream1iATI(a0,a1);r.finishCall();break;}
+case TRACE_glPatchParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glPatchParameterfv(a0,a1);r.finishCall();break;}
+case TRACE_glIsFramebufferEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsFramebufferEXT(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glTextureStorage2D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glTextureStorage2D(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform1ui64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64>();table.glProgramUniform1ui64ARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexBufferRange:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glTexBufferRange(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetPixelTexGenParameterivSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint*>();table.glGetPixelTexGenParameterivSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glTextureSubImage3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLenum>();auto const a11 = r.template arg<const void*>();table.glTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glClipControl:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glClipControl(a0,a1);r.finishCall();break;}
+case TRACE_glGetProgramResourceiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLenum*>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei*>();auto const a7 = r.template arg<GLint*>();table.glGetProgramResourceiv(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glMultiTexCoordP2uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glMultiTexCoordP2uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI3ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribI3ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSampleMaskSGIS:{auto const a0 = r.template arg<GLclampf>();auto const a1 = r.template arg<GLboolean>();table.glSampleMaskSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4NivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttrib4NivARB(a0,a1);r.finishCall();break;}
+case TRACE_glGlobalAlphaFactorfSUN:{auto const a0 = r.template arg<GLfloat>();table.glGlobalAlphaFactorfSUN(a0);r.finishCall();break;}
+case TRACE_glBlendEquationSeparateIndexedAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glBlendEquationSeparateIndexedAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPerfCounterInfoINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLchar*>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLchar*>();auto const a6 = r.template arg<GLuint*>();auto const a7 = r.template arg<GLuint*>();auto const a8 = r.template arg<GLuint*>();auto const a9 = r.template arg<GLuint*>();auto const a10 = r.template arg<GLuint64*>();table.glGetPerfCounterInfoINTEL(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glDeleteProgramsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteProgramsNV(a0,a1);r.finishCall();break;}
+case TRACE_glPixelZoomxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glPixelZoomxOES(a0,a1);r.finishCall();break;}
+case TRACE_glGetCombinerOutputParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetCombinerOutputParameterivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRasterPos2xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glRasterPos2xvOES(a0);r.finishCall();break;}
+case TRACE_glGetTexImage:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLvoid*>();table.glGetTexImage(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexArrayVertexBuffers:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<const GLintptr*>();auto const a5 = r.template arg<const GLsizei*>();table.glVertexArrayVertexBuffers(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniform1ui64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64EXT>();table.glUniform1ui64NV(a0,a1);r.finishCall();break;}
+case TRACE_glProgramParameteri:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glProgramParameteri(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormal3xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glNormal3xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetMapfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetMapfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream2dvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexStream2dvATI(a0,a1);r.finishCall();break;}
+case TRACE_glPathStencilDepthOffsetNV:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glPathStencilDepthOffsetNV(a0,a1);r.finishCall();break;}
+case TRACE_glIsStateNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsStateNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetIntegerui64vNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint64EXT*>();table.glGetIntegerui64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetImageTransformParameterfvHP:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetImageTransformParameterfvHP(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRasterPos2fv:{auto const a0 = r.template arg<const GLfloat*>();table.glRasterPos2fv(a0);r.finishCall();break;}
+case TRACE_glVertex3xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glVertex3xOES(a0,a1);r.finishCall();break;}
+case TRACE_glIsMemoryObjectEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsMemoryObjectEXT(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glWeightPointerARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glWeightPointerARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFinishFenceNV:{auto const a0 = r.template arg<GLuint>();table.glFinishFenceNV(a0);r.finishCall();break;}
+case TRACE_glDepthRangexOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glDepthRangexOES(a0,a1);r.finishCall();break;}
+case TRACE_glEnableVertexArrayAttribEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glEnableVertexArrayAttribEXT(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform2uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform2uivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetDoubleIndexedvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble*>();table.glGetDoubleIndexedvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos2fMESA:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glWindowPos2fMESA(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3b:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glSecondaryColor3b(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyConvolutionFilter1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glCopyConvolutionFilter1DEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glWindowPos2sv:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos2sv(a0);r.finishCall();break;}
+case TRACE_glBindFramebufferEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindFramebufferEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCreateShader:{auto const a0 = r.template arg<GLenum>();auto const result = table.glCreateShader(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGenPathsNV:{auto const a0 = r.template arg<GLsizei>();auto const result = table.glGenPathsNV(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGenRenderbuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenRenderbuffers(a0,a1);r.finishCall();break;}
+case TRACE_glCopyTexSubImage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();table.glCopyTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glVertexAttrib4ubvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttrib4ubvARB(a0,a1);r.finishCall();break;}
+case TRACE_glDrawTextureNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();table.glDrawTextureNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glVertexAttribs1svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLshort*>();table.glVertexAttribs1svNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClearNamedBufferSubDataEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLsizeiptr>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();table.glClearNamedBufferSubDataEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glBlendFuncSeparate:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glBlendFuncSeparate(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPointParameterfARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPointParameterfARB(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2fv:{auto const a0 = r.template arg<const GLfloat*>();table.glTexCoord2fv(a0);r.finishCall();break;}
+case TRACE_glGetVariantFloatvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetVariantFloatvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexP2ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glVertexP2ui(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos2dMESA:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glWindowPos2dMESA(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord4fv:{auto const a0 = r.template arg<const GLfloat*>();table.glTexCoord4fv(a0);r.finishCall();break;}
+case TRACE_glBindFragDataLocationEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLchar*>();table.glBindFragDataLocationEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedTexSubImage1DARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<const void*>();table.glCompressedTexSubImage1DARB(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetTextureImageEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<void*>();table.glGetTextureImageEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glFogCoordd:{auto const a0 = r.template arg<GLdouble>();table.glFogCoordd(a0);r.finishCall();break;}
+case TRACE_glPointSize:{auto const a0 = r.template arg<GLfloat>();table.glPointSize(a0);r.finishCall();break;}
+case TRACE_glBindTextureUnit:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glBindTextureUnit(a0,a1);r.finishCall();break;}
+case TRACE_glProgramEnvParameterI4uiNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glProgramEnvParameterI4uiNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetProgramPipelineInfoLog:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLchar*>();table.glGetProgramPipelineInfoLog(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4i64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64*>();table.glProgramUniform4i64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4Nuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttrib4Nuiv(a0,a1);r.finishCall();break;}
+case TRACE_glGetUniformfvARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat*>();table.glGetUniformfvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWaitSync:{auto const a0 = r.template arg<GLsync>();auto const a1 = r.template arg<GLbitfield>();auto const a2 = r.template arg<GLuint64>();table.glWaitSync(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glUniform3i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBlendEquationSeparatei:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glBlendEquationSeparatei(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib2hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLhalfNV*>();table.glVertexAttrib2hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glTextureParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glTextureParameterivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform3d:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glUniform3d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform3f:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glUniform3f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glActiveProgramEXT:{auto const a0 = r.template arg<GLuint>();table.glActiveProgramEXT(a0);r.finishCall();break;}
+case TRACE_glProgramUniform3uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform3uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform3ui64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64*>();table.glUniform3ui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1ui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64*>();table.glProgramUniform1ui64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureParameterfEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat>();table.glTextureParameterfEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSetFragmentShaderConstantATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glSetFragmentShaderConstantATI(a0,a1);r.finishCall();break;}
+case TRACE_glColorSubTable:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const GLvoid*>();table.glColorSubTable(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glReplacementCodeuiSUN:{auto const a0 = r.template arg<GLuint>();table.glReplacementCodeuiSUN(a0);r.finishCall();break;}
+case TRACE_glStateCaptureNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glStateCaptureNV(a0,a1);r.finishCall();break;}
+case TRACE_glBindAttribLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLchar*>();table.glBindAttribLocation(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWeightusvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLushort*>();table.glWeightusvARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetFragDataIndex:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetFragDataIndex(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glMultiTexCoord2xOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glMultiTexCoord2xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor3sv:{auto const a0 = r.template arg<const GLshort*>();table.glColor3sv(a0);r.finishCall();break;}
+case TRACE_glTexCoord2fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glTexCoord2fVertex3fSUN(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetMemoryObjectParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetMemoryObjectParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPolygonOffsetEXT:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glPolygonOffsetEXT(a0,a1);r.finishCall();break;}
+case TRACE_glWeightPathsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();auto const a3 = r.template arg<const GLfloat*>();table.glWeightPathsNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCombinerStageParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glCombinerStageParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPointParameterfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPointParameterfEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCopyTexImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();table.glCopyTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertex4sv:{auto const a0 = r.template arg<const GLshort*>();table.glVertex4sv(a0);r.finishCall();break;}
+case TRACE_glMatrixMultfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixMultfEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCompressedTextureSubImage3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLsizei>();auto const a11 = r.template arg<const void*>();table.glCompressedTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glGetTexLevelParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfixed*>();table.glGetTexLevelParameterxvOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL3dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL3dvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoordP4ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glMultiTexCoordP4ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTextureLevelParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint*>();table.glGetTextureLevelParameterivEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glAlphaFragmentOp2ATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLuint>();table.glAlphaFragmentOp2ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glDeleteFramebuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteFramebuffers(a0,a1);r.finishCall();break;}
+case TRACE_glDrawArrays:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();table.glDrawArrays(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTransformFeedbackiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTransformFeedbackiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnTexImageARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetnTexImageARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glClear:{auto const a0 = r.template arg<GLbitfield>();table.glClear(a0);r.finishCall();break;}
+case TRACE_glVertexArrayParameteriAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glVertexArrayParameteriAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2dvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord2dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetVideoCaptureStreamdvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLdouble*>();table.glGetVideoCaptureStreamdvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFragmentLightModelivSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glFragmentLightModelivSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribP2ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribP2ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoordPointerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glMultiTexCoordPointerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform3iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glProgramUniform3iEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTranslatef:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glTranslatef(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4Nub:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLubyte>();table.glVertexAttrib4Nub(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTranslated:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glTranslated(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSamplerParameterIiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glSamplerParameterIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();table.glTexCoord4hNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDrawElementsIndirect:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();table.glDrawElementsIndirect(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeletePerfMonitorsAMD:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glDeletePerfMonitorsAMD(a0,a1);r.finishCall();break;}
+case TRACE_glIsRenderbufferEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsRenderbufferEXT(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glDrawCommandsNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLintptr*>();auto const a3 = r.template arg<const GLsizei*>();auto const a4 = r.template arg<GLuint>();table.glDrawCommandsNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform3ivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform3ivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBufferSubData:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<const void*>();table.glBufferSubData(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSecondaryColor3bv:{auto const a0 = r.template arg<const GLbyte*>();table.glSecondaryColor3bv(a0);r.finishCall();break;}
+case TRACE_glMatrixMultTransposedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMatrixMultTransposedEXT(a0,a1);r.finishCall();break;}
+case TRACE_glRequestResidentProgramsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glRequestResidentProgramsNV(a0,a1);r.finishCall();break;}
+case TRACE_glAlphaFragmentOp1ATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glAlphaFragmentOp1ATI(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetQueryObjecti64v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint64*>();table.glGetQueryObjecti64v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixMult3x3fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixMult3x3fNV(a0,a1);r.finishCall();break;}
+case TRACE_glColorTableParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glColorTableParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPathSubCommandsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLubyte*>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<const void*>();table.glPathSubCommandsNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetFinalCombinerInputParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetFinalCombinerInputParameterivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsRenderbuffer:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsRenderbuffer(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glVertex3iv:{auto const a0 = r.template arg<const GLint*>();table.glVertex3iv(a0);r.finishCall();break;}
+case TRACE_glTexGenfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glTexGenfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFrustumfOES:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glFrustumfOES(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBindVertexBuffers:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();auto const a3 = r.template arg<const GLintptr*>();auto const a4 = r.template arg<const GLsizei*>();table.glBindVertexBuffers(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMateriali:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glMateriali(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord2svARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord2svARB(a0,a1);r.finishCall();break;}
+case TRACE_glDisableVertexAttribArray:{auto const a0 = r.template arg<GLuint>();table.glDisableVertexAttribArray(a0);r.finishCall();break;}
+case TRACE_glWindowPos3ivARB:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos3ivARB(a0);r.finishCall();break;}
+case TRACE_glTexCoordFormatNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();table.glTexCoordFormatNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlitNamedFramebuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLint>();auto const a10 = r.template arg<GLbitfield>();auto const a11 = r.template arg<GLenum>();table.glBlitNamedFramebuffer(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glMatrixLoadTransposefEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixLoadTransposefEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexGenfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat>();table.glMultiTexGenfEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glShaderStorageBlockBinding:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glShaderStorageBlockBinding(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMaterialf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glMaterialf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glReplacementCodeuiColor4fNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();table.glReplacementCodeuiColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glCheckNamedFramebufferStatusEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const result = table.glCheckNamedFramebufferStatusEXT(a0,a1);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glVertexArrayVertexAttribFormatEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLboolean>();auto const a5 = r.template arg<GLuint>();table.glVertexArrayVertexAttribFormatEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertex2hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();table.glVertex2hNV(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteVertexShaderEXT:{auto const a0 = r.template arg<GLuint>();table.glDeleteVertexShaderEXT(a0);r.finishCall();break;}
+case TRACE_glTexImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<const void*>();table.glTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glSignalVkFenceNV:{auto const a0 = r.template arg<GLuint64>();table.glSignalVkFenceNV(a0);r.finishCall();break;}
+case TRACE_glProgramLocalParameterI4ivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLint*>();table.glProgramLocalParameterI4ivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGlobalAlphaFactoriSUN:{auto const a0 = r.template arg<GLint>();table.glGlobalAlphaFactoriSUN(a0);r.finishCall();break;}
+case TRACE_glTextureStorage1D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();table.glTextureStorage1D(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBinormal3sEXT:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glBinormal3sEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramInterfaceiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetProgramInterfaceiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMatrixIndexPointerARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glMatrixIndexPointerARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexCoordPointerEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glTexCoordPointerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiTexGeniEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();table.glMultiTexGeniEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib2fNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glVertexAttrib2fNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedProgramStringEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glNamedProgramStringEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMapNamedBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const result = table.glMapNamedBuffer(a0,a1);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glGetMinmaxParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetMinmaxParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnUniformdv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLdouble*>();table.glGetnUniformdv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEndConditionalRenderNVX:{table.glEndConditionalRenderNVX();r.finishCall();break;}
+case TRACE_glBinormal3fEXT:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glBinormal3fEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormalStream3iATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glNormalStream3iATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramBufferParametersIivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLint*>();table.glProgramBufferParametersIivNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMapGrid1xOES:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glMapGrid1xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVertexAttribPointervARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetVertexAttribPointervARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFlushMappedNamedBufferRangeEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();table.glFlushMappedNamedBufferRangeEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVertexAttribIiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexAttribIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexP4uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glVertexP4uiv(a0,a1);r.finishCall();break;}
+case TRACE_glUniformui64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64EXT>();table.glUniformui64NV(a0,a1);r.finishCall();break;}
+case TRACE_glColor4fv:{auto const a0 = r.template arg<const GLfloat*>();table.glColor4fv(a0);r.finishCall();break;}
+case TRACE_glTexParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glTexParameterxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPatchParameteri:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPatchParameteri(a0,a1);r.finishCall();break;}
+case TRACE_glMap1d:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<const GLdouble*>();table.glMap1d(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetTexFilterFuncSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetTexFilterFuncSGIS(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream3dATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertexStream3dATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexArrayVertexBindingDivisorEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexArrayVertexBindingDivisorEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3svARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord3svARB(a0,a1);r.finishCall();break;}
+case TRACE_glBindProgramNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindProgramNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetConvolutionParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetConvolutionParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramLocalParameterfvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetProgramLocalParameterfvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenFragmentShadersATI:{auto const a0 = r.template arg<GLuint>();auto const result = table.glGenFragmentShadersATI(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glTexBumpParameterivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glTexBumpParameterivATI(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedFramebufferAttachmentParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetNamedFramebufferAttachmentParameteriv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetnSeparableFilter:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<void*>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<void*>();auto const a7 = r.template arg<void*>();table.glGetnSeparableFilter(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glNormal3xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glNormal3xvOES(a0);r.finishCall();break;}
+case TRACE_glPassTexCoordATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();table.glPassTexCoordATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFramebufferTextureFaceARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();table.glFramebufferTextureFaceARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform1dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform1dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureStorage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glTextureStorage2DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexArrayFogCoordOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLintptr>();table.glVertexArrayFogCoordOffsetEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glDeleteNamedStringARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLchar*>();table.glDeleteNamedStringARB(a0,a1);r.finishCall();break;}
+case TRACE_glMulticastGetQueryObjecti64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint64*>();table.glMulticastGetQueryObjecti64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGenOcclusionQueriesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenOcclusionQueriesNV(a0,a1);r.finishCall();break;}
+case TRACE_glLighti:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glLighti(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexImage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<const GLvoid*>();table.glTexImage1D(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glLightf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glLightf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClientAttribDefaultEXT:{auto const a0 = r.template arg<GLbitfield>();table.glClientAttribDefaultEXT(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib4bvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVertexAttrib4bvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribIFormatNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();table.glVertexAttribIFormatNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStencilFuncSeparate:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLuint>();table.glStencilFuncSeparate(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribfvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetVertexAttribfvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib2dNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertexAttrib2dNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform2iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glProgramUniform2iEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glClientActiveVertexStreamATI:{auto const a0 = r.template arg<GLenum>();table.glClientActiveVertexStreamATI(a0);r.finishCall();break;}
+case TRACE_glRasterPos3xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glRasterPos3xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetMapParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetMapParameterivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSampleCoverage:{auto const a0 = r.template arg<GLclampf>();auto const a1 = r.template arg<GLboolean>();table.glSampleCoverage(a0,a1);r.finishCall();break;}
+case TRACE_glClearDepthxOES:{auto const a0 = r.template arg<GLfixed>();table.glClearDepthxOES(a0);r.finishCall();break;}
+case TRACE_glUniformBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();table.glUniformBufferEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2fNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();table.glTexCoord2fNormal3fVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMulticastGetQueryObjectuivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint*>();table.glMulticastGetQueryObjectuivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetFirstPerfQueryIdINTEL:{auto const a0 = r.template arg<GLuint*>();table.glGetFirstPerfQueryIdINTEL(a0);r.finishCall();break;}
+case TRACE_glUnmapNamedBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glUnmapNamedBufferEXT(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetTransformFeedbacki_v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint*>();table.glGetTransformFeedbacki_v(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform4fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform4fvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRenderbufferStorageMultisampleCoverageNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glRenderbufferStorageMultisampleCoverageNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetFloati_vEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetFloati_vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindAttribLocationARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLcharARB*>();table.glBindAttribLocationARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBufferAddressRangeNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLsizeiptr>();table.glBufferAddressRangeNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGenProgramsARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenProgramsARB(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexEnvivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glMultiTexEnvivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSecondaryColor3uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glSecondaryColor3uiEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedTextureImage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const void*>();table.glCompressedTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glUniform2i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glUniform2i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyTexImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();table.glCopyTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glUniform2d:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glUniform2d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribL1d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();table.glVertexAttribL1d(a0,a1);r.finishCall();break;}
+case TRACE_glFramebufferTextureFaceEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();table.glFramebufferTextureFaceEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glFramebufferTextureLayer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTextureLayer(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiTexCoord4bvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLbyte*>();table.glMultiTexCoord4bvOES(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexArrayPointeri_vEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void**>();table.glGetVertexArrayPointeri_vEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameter4dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();auto const a6 = r.template arg<GLdouble>();table.glNamedProgramLocalParameter4dEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glBinormal3bEXT:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glBinormal3bEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glConvolutionFilter2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();table.glConvolutionFilter2DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glProgramUniform2fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform2fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor3fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();table.glNormal3fVertex3fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glCopyMultiTexSubImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLsizei>();table.glCopyMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glProgramLocalParameterI4iNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glProgramLocalParameterI4iNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x4dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix2x4dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPathMemoryGlyphIndexArrayNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLfloat>();auto const result = table.glPathMemoryGlyphIndexArrayNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glDrawArraysEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();table.glDrawArraysEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendEquationEXT:{auto const a0 = r.template arg<GLenum>();table.glBlendEquationEXT(a0);r.finishCall();break;}
+case TRACE_glStencilOp:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glStencilOp(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyTextureSubImage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();table.glCopyTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glTexEnvf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glTexEnvf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib2dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib2dvNV(a0,a1);r.finishCall();break;}
+case TRACE_glGenPerfMonitorsAMD:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenPerfMonitorsAMD(a0,a1);r.finishCall();break;}
+case TRACE_glGetInteger64i_v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint64*>();table.glGetInteger64i_v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetHistogramParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetHistogramParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexFormatNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();table.glVertexFormatNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendFuncIndexedAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glBlendFuncIndexedAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexEnvi:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glTexEnvi(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1iv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord1iv(a0,a1);r.finishCall();break;}
+case TRACE_glIsEnabledi:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const result = table.glIsEnabledi(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glVertexAttribL2ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint64EXT*>();table.glVertexAttribL2ui64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribL4i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint64EXT>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();auto const a4 = r.template arg<GLint64EXT>();table.glVertexAttribL4i64NV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMatrixTranslatedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glMatrixTranslatedEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMakeTextureHandleResidentARB:{auto const a0 = r.template arg<GLuint64>();table.glMakeTextureHandleResidentARB(a0);r.finishCall();break;}
+case TRACE_glMatrixMultdEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMatrixMultdEXT(a0,a1);r.finishCall();break;}
+case TRACE_glBinormal3dvEXT:{auto const a0 = r.template arg<const GLdouble*>();table.glBinormal3dvEXT(a0);r.finishCall();break;}
+case TRACE_glImportSyncEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLbitfield>();auto const result = table.glImportSyncEXT(a0,a1,a2);r.finishCall();r.template result<GLsync>(result);break;}
+case TRACE_glGetMapiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetMapiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glImportSemaphoreFdEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glImportSemaphoreFdEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4sv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord4sv(a0,a1);r.finishCall();break;}
+case TRACE_glPNTrianglesiATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPNTrianglesiATI(a0,a1);r.finishCall();break;}
+case TRACE_glBindVertexArrayAPPLE:{auto const a0 = r.template arg<GLuint>();table.glBindVertexArrayAPPLE(a0);r.finishCall();break;}
+case TRACE_glObjectPtrLabel:{auto const a0 = r.template arg<const void*>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*>();table.glObjectPtrLabel(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetDebugMessageLog:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum*>();auto const a3 = r.template arg<GLenum*>();auto const a4 = r.template arg<GLuint*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLsizei*>();auto const a7 = r.template arg<GLchar*>();auto const result = table.glGetDebugMessageLog(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glTrackMatrixNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glTrackMatrixNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramPathFragmentInputGenNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramPathFragmentInputGenNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTangent3ivEXT:{auto const a0 = r.template arg<const GLint*>();table.glTangent3ivEXT(a0);r.finishCall();break;}
+case TRACE_glGetUniformfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat*>();table.glGetUniformfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColor3ubv:{auto const a0 = r.template arg<const GLubyte*>();table.glSecondaryColor3ubv(a0);r.finishCall();break;}
+case TRACE_glMakeTextureHandleNonResidentNV:{auto const a0 = r.template arg<GLuint64>();table.glMakeTextureHandleNonResidentNV(a0);r.finishCall();break;}
+case TRACE_glVertexAttribs4ubvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();table.glVertexAttribs4ubvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClipPlanexOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glClipPlanexOES(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord3iv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord3iv(a0,a1);r.finishCall();break;}
+case TRACE_glGetnPolygonStippleARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLubyte*>();table.glGetnPolygonStippleARB(a0,a1);r.finishCall();break;}
+case TRACE_glUniform2i64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64EXT*>();table.glUniform2i64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLightModelf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glLightModelf(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteMemoryObjectsEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteMemoryObjectsEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexSubImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<const void*>();table.glMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glReplacementCodeuiColor3fVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();table.glReplacementCodeuiColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glTangent3dvEXT:{auto const a0 = r.template arg<const GLdouble*>();table.glTangent3dvEXT(a0);r.finishCall();break;}
+case TRACE_glLightModeli:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glLightModeli(a0,a1);r.finishCall();break;}
+case TRACE_glVertexWeighthvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glVertexWeighthvNV(a0);r.finishCall();break;}
+case TRACE_glWindowPos3iv:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos3iv(a0);r.finishCall();break;}
+case TRACE_glMultiTexCoordP1uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glMultiTexCoordP1uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTransformPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glTransformPathNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramNamedParameter4dNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();auto const a6 = r.template arg<GLdouble>();table.glProgramNamedParameter4dNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glMultiDrawElementsIndirect:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glMultiDrawElementsIndirect(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform1dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();table.glProgramUniform1dEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCallLists:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLvoid*>();table.glCallLists(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormal3hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glNormal3hvNV(a0);r.finishCall();break;}
+case TRACE_glGetCombinerOutputParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetCombinerOutputParameterfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4sARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();auto const a4 = r.template arg<GLshort>();table.glVertexAttrib4sARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexCoord3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glTexCoord3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI3uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI3uiv(a0,a1);r.finishCall();break;}
+case TRACE_glPushDebugGroup:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLchar*>();table.glPushDebugGroup(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexCoord3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glTexCoord3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glTexCoord3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glTexCoord2xOES(a0,a1);r.finishCall();break;}
+case TRACE_glGetStageIndexNV:{auto const a0 = r.template arg<GLenum>();auto const result = table.glGetStageIndexNV(a0);r.finishCall();r.template result<GLushort>(result);break;}
+case TRACE_glProgramUniform4i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64EXT*>();table.glProgramUniform4i64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetNamedBufferPointervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetNamedBufferPointervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureBarrierNV:{table.glTextureBarrierNV();r.finishCall();break;}
+case TRACE_glColor4ubVertex3fvSUN:{auto const a0 = r.template arg<const GLubyte*>();auto const a1 = r.template arg<const GLfloat*>();table.glColor4ubVertex3fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glGetCommandHeaderNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const result = table.glGetCommandHeaderNV(a0,a1);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGetPerfMonitorCounterInfoAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();table.glGetPerfMonitorCounterInfoAMD(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib1svARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib1svARB(a0,a1);r.finishCall();break;}
+case TRACE_glCombinerParameteriNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glCombinerParameteriNV(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixMultTransposefEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixMultTransposefEXT(a0,a1);r.finishCall();break;}
+case TRACE_glDetailTexFuncSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glDetailTexFuncSGIS(a0,a1,a2);r.finishCall();break;}
+case TRACE_glAreTexturesResident:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<GLboolean*>();auto const result = table.glAreTexturesResident(a0,a1,a2);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glProgramUniform2d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glProgramUniform2d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetConvolutionParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetConvolutionParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIndexPointerListIBM:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const void**>();auto const a3 = r.template arg<GLint>();table.glIndexPointerListIBM(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI4iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glVertexAttribI4iEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform2f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glProgramUniform2f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRasterPos4sv:{auto const a0 = r.template arg<const GLshort*>();table.glRasterPos4sv(a0);r.finishCall();break;}
+case TRACE_glColor4s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glColor4s(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMulticastGetQueryObjectivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glMulticastGetQueryObjectivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColorFragmentOp3ATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLuint>();auto const a10 = r.template arg<GLuint>();auto const a11 = r.template arg<GLuint>();auto const a12 = r.template arg<GLuint>();table.glColorFragmentOp3ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);r.finishCall();break;}
+case TRACE_glResizeBuffersMESA:{table.glResizeBuffersMESA();r.finishCall();break;}
+case TRACE_glGetMinmaxParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetMinmaxParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClientActiveTextureARB:{auto const a0 = r.template arg<GLenum>();table.glClientActiveTextureARB(a0);r.finishCall();break;}
+case TRACE_glBindVertexArray:{auto const a0 = r.template arg<GLuint>();table.glBindVertexArray(a0);r.finishCall();break;}
+case TRACE_glColor4b:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();auto const a3 = r.template arg<GLbyte>();table.glColor4b(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor4f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glColor4f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor4d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glColor4d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor4i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glColor4i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEdgeFlagFormatNV:{auto const a0 = r.template arg<GLsizei>();table.glEdgeFlagFormatNV(a0);r.finishCall();break;}
+case TRACE_glNamedBufferSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<const void*>();table.glNamedBufferSubData(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDrawElementsInstanced:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();table.glDrawElementsInstanced(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetMultiTexParameterIivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetMultiTexParameterIivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertex2dv:{auto const a0 = r.template arg<const GLdouble*>();table.glVertex2dv(a0);r.finishCall();break;}
+case TRACE_glDisableVertexArrayAttribEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glDisableVertexArrayAttribEXT(a0,a1);r.finishCall();break;}
+case TRACE_glObjectUnpurgeableAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const result = table.glObjectUnpurgeableAPPLE(a0,a1,a2);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glVertexAttribs2dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glVertexAttribs2dvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glReplacementCodeuiTexCoord2fVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glReplacementCodeuiTexCoord2fVertex3fSUN(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetMapParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetMapParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform4ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform4ivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform3ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64EXT*>();table.glProgramUniform3ui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRectfv:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();table.glRectfv(a0,a1);r.finishCall();break;}
+case TRACE_glTexFilterFuncSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glTexFilterFuncSGIS(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSpriteParameterfvSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glSpriteParameterfvSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glCopyMultiTexImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();table.glCopyMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetVertexAttribIuivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetVertexAttribIuivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniformMatrix2x4dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix2x4dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetProgramResourceLocationIndex:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLchar*>();auto const result = table.glGetProgramResourceLocationIndex(a0,a1,a2);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glColor3hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glColor3hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glViewport:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glViewport(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramNamedParameter4fNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();table.glProgramNamedParameter4fNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetInvariantBooleanvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean*>();table.glGetInvariantBooleanvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexStorage2DMultisample:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLboolean>();table.glTexStorage2DMultisample(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glPixelStorex:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glPixelStorex(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribL1dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL1dvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetActiveSubroutineUniformiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint*>();table.glGetActiveSubroutineUniformiv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribPointerARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<const void*>();table.glVertexAttribPointerARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCompressedTexSubImage2DARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const void*>();table.glCompressedTexSubImage2DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glTexStorageMem1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint64>();table.glTexStorageMem1DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertex2hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glVertex2hvNV(a0);r.finishCall();break;}
+case TRACE_glTexBuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glTexBuffer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glArrayElement:{auto const a0 = r.template arg<GLint>();table.glArrayElement(a0);r.finishCall();break;}
+case TRACE_glValidateProgram:{auto const a0 = r.template arg<GLuint>();table.glValidateProgram(a0);r.finishCall();break;}
+case TRACE_glPixelStoref:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPixelStoref(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos3dARB:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glWindowPos3dARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEvalCoord1dv:{auto const a0 = r.template arg<const GLdouble*>();table.glEvalCoord1dv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribs2fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glVertexAttribs2fvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRecti:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glRecti(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();auto const a3 = r.template arg<const GLfloat*>();auto const a4 = r.template arg<const GLfloat*>();table.glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexCoord1bOES:{auto const a0 = r.template arg<GLbyte>();table.glTexCoord1bOES(a0);r.finishCall();break;}
+case TRACE_glProgramUniform2i64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64*>();table.glProgramUniform2i64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWindowPos2dARB:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glWindowPos2dARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetProgramParameterdvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLdouble*>();table.glGetProgramParameterdvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRectf:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glRectf(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRectd:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glRectd(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMap1xOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLfixed>();table.glMap1xOES(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib3fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib3fvNV(a0,a1);r.finishCall();break;}
+case TRACE_glReferencePlaneSGIX:{auto const a0 = r.template arg<const GLdouble*>();table.glReferencePlaneSGIX(a0);r.finishCall();break;}
+case TRACE_glMulticastBlitFramebufferNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLint>();auto const a10 = r.template arg<GLbitfield>();auto const a11 = r.template arg<GLenum>();table.glMulticastBlitFramebufferNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glGetCombinerInputParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLfloat*>();table.glGetCombinerInputParameterfvNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetTextureSamplerHandleARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const result = table.glGetTextureSamplerHandleARB(a0,a1);r.finishCall();r.template result<GLuint64>(result);break;}
+case TRACE_glBindTexture:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindTexture(a0,a1);r.finishCall();break;}
+case TRACE_glRects:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glRects(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetActiveAttribARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLint*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLcharARB*>();table.glGetActiveAttribARB(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glHistogramEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();table.glHistogramEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetTextureSamplerHandleNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const result = table.glGetTextureSamplerHandleNV(a0,a1);r.finishCall();r.template result<GLuint64>(result);break;}
+case TRACE_glDetachShader:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glDetachShader(a0,a1);r.finishCall();break;}
+case TRACE_glFinishTextureSUNX:{table.glFinishTextureSUNX();r.finishCall();break;}
+case TRACE_glUniformMatrix3x4dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix3x4dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4fARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glVertexAttrib4fARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetPathColorGenivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetPathColorGenivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramResourceLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLchar*>();auto const result = table.glGetProgramResourceLocation(a0,a1,a2);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glVertexArrayAttribLFormat:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLuint>();table.glVertexArrayAttribLFormat(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetTexLevelParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetTexLevelParameterfv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexArrayVertexAttribOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLboolean>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLintptr>();table.glVertexArrayVertexAttribOffsetEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glIndexFormatNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();table.glIndexFormatNV(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord3i:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glMultiTexCoord3i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glReplacementCodeuiVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();table.glReplacementCodeuiVertex3fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glViewportIndexedfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glViewportIndexedfv(a0,a1);r.finishCall();break;}
+case TRACE_glBindBuffersBase:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glBindBuffersBase(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexBumpParameterfvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glTexBumpParameterfvATI(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixIndexuivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLuint*>();table.glMatrixIndexuivARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1hNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLhalfNV>();table.glVertexAttrib1hNV(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos3svMESA:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos3svMESA(a0);r.finishCall();break;}
+case TRACE_glStencilOpSeparateATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glStencilOpSeparateATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDrawElementsBaseVertex:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLint>();table.glDrawElementsBaseVertex(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBlendEquationSeparateiARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glBlendEquationSeparateiARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib1fNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();table.glVertexAttrib1fNV(a0,a1);r.finishCall();break;}
+case TRACE_glMapVertexAttrib2fAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLint>();auto const a10 = r.template arg<const GLfloat*>();table.glMapVertexAttrib2fAPPLE(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glCompressedTextureSubImage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<const void*>();table.glCompressedTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glClearBufferSubData:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizeiptr>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();table.glClearBufferSubData(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glTexStorage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();table.glTexStorage1D(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI3iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glVertexAttribI3iEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMakeTextureHandleNonResidentARB:{auto const a0 = r.template arg<GLuint64>();table.glMakeTextureHandleNonResidentARB(a0);r.finishCall();break;}
+case TRACE_glMultiDrawElementArrayAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();auto const a2 = r.template arg<const GLsizei*>();auto const a3 = r.template arg<GLsizei>();table.glMultiDrawElementArrayAPPLE(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexStream4dATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glVertexStream4dATI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix2dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribs2hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLhalfNV*>();table.glVertexAttribs2hvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint*>();table.glGetUniformiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClipPlanefOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glClipPlanefOES(a0,a1);r.finishCall();break;}
+case TRACE_glRenderbufferStorage:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glRenderbufferStorage(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform4ui:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glUniform4ui(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBindFramebuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindFramebuffer(a0,a1);r.finishCall();break;}
+case TRACE_glValidateProgramARB:{auto const a0 = r.template arg<GLhandleARB>();table.glValidateProgramARB(a0);r.finishCall();break;}
+case TRACE_glTexGenf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glTexGenf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexGend:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble>();table.glTexGend(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexGeni:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glTexGeni(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteFramebuffersEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteFramebuffersEXT(a0,a1);r.finishCall();break;}
+case TRACE_glResetMinmaxEXT:{auto const a0 = r.template arg<GLenum>();table.glResetMinmaxEXT(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib1fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib1fvNV(a0,a1);r.finishCall();break;}
+case TRACE_glIsQueryARB:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsQueryARB(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glEnableVariantClientStateEXT:{auto const a0 = r.template arg<GLuint>();table.glEnableVariantClientStateEXT(a0);r.finishCall();break;}
+case TRACE_glScissorIndexed:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glScissorIndexed(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetInvariantIntegervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetInvariantIntegervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramLocalParameterI4uiNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glProgramLocalParameterI4uiNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glConvolutionParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glConvolutionParameterxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenFramebuffersEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenFramebuffersEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexArrayColorOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLintptr>();table.glVertexArrayColorOffsetEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMultiTexCoord3ivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord3ivARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexWeightfEXT:{auto const a0 = r.template arg<GLfloat>();table.glVertexWeightfEXT(a0);r.finishCall();break;}
+case TRACE_glRasterPos4dv:{auto const a0 = r.template arg<const GLdouble*>();table.glRasterPos4dv(a0);r.finishCall();break;}
+case TRACE_glIsTextureHandleResidentARB:{auto const a0 = r.template arg<GLuint64>();auto const result = table.glIsTextureHandleResidentARB(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glRasterPos2dv:{auto const a0 = r.template arg<const GLdouble*>();table.glRasterPos2dv(a0);r.finishCall();break;}
+case TRACE_glWindowPos4ivMESA:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos4ivMESA(a0);r.finishCall();break;}
+case TRACE_glGetVariantPointervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetVariantPointervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMapNamedBufferRangeEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLbitfield>();auto const result = table.glMapNamedBufferRangeEXT(a0,a1,a2,a3);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glGetnUniformui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLuint64*>();table.glGetnUniformui64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCreateShaderProgramv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*const*>();auto const result = table.glCreateShaderProgramv(a0,a1,a2);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGetQueryObjectiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetQueryObjectiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMaxShaderCompilerThreadsKHR:{auto const a0 = r.template arg<GLuint>();table.glMaxShaderCompilerThreadsKHR(a0);r.finishCall();break;}
+case TRACE_glPNTrianglesfATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPNTrianglesfATI(a0,a1);r.finishCall();break;}
+case TRACE_glGlobalAlphaFactorusSUN:{auto const a0 = r.template arg<GLushort>();table.glGlobalAlphaFactorusSUN(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib3dvNV(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord3sARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glMultiTexCoord3sARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGenerateMipmap:{auto const a0 = r.template arg<GLenum>();table.glGenerateMipmap(a0);r.finishCall();break;}
+case TRACE_glCompressedTextureSubImage2D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const void*>();table.glCompressedTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glNamedRenderbufferStorageMultisampleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glNamedRenderbufferStorageMultisampleEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPolygonOffsetClampEXT:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glPolygonOffsetClampEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureRangeAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void*>();table.glTextureRangeAPPLE(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendEquationIndexedAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glBlendEquationIndexedAMD(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glTexCoord2d(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameteri:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPointParameteri(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glTexCoord2f(a0,a1);r.finishCall();break;}
+case TRACE_glGetUnsignedBytei_vEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLubyte*>();table.glGetUnsignedBytei_vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor4iv:{auto const a0 = r.template arg<const GLint*>();table.glColor4iv(a0);r.finishCall();break;}
+case TRACE_glMapNamedBufferRange:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLbitfield>();auto const result = table.glMapNamedBufferRange(a0,a1,a2,a3);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glUnmapBuffer:{auto const a0 = r.template arg<GLenum>();auto const result = table.glUnmapBuffer(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glSampleMaskEXT:{auto const a0 = r.template arg<GLclampf>();auto const a1 = r.template arg<GLboolean>();table.glSampleMaskEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glTexCoord2i(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord1xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glTexCoord1xvOES(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib1sARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();table.glVertexAttrib1sARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexArrayiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexArrayiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramParameter4dvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLdouble*>();table.glProgramParameter4dvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();table.glTexCoord2s(a0,a1);r.finishCall();break;}
+case TRACE_glTextureParameterIuivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLuint*>();table.glTextureParameterIuivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetColorTableParameterfvSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetColorTableParameterfvSGI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4dv:{auto const a0 = r.template arg<const GLdouble*>();table.glTexCoord4dv(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib1svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib1svNV(a0,a1);r.finishCall();break;}
+case TRACE_glNamedFramebufferTextureFaceEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();table.glNamedFramebufferTextureFaceEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform2ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64EXT*>();table.glProgramUniform2ui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStencilFillPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glStencilFillPathNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormal3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glNormal3dv(a0);r.finishCall();break;}
+case TRACE_glReleaseShaderCompiler:{table.glReleaseShaderCompiler();r.finishCall();break;}
+case TRACE_glTexStorageMem3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint64>();table.glTexStorageMem3DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glTexCoord3bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glTexCoord3bvOES(a0);r.finishCall();break;}
+case TRACE_glIsVertexAttribEnabledAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const result = table.glIsVertexAttribEnabledAPPLE(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glTexCoord1dv:{auto const a0 = r.template arg<const GLdouble*>();table.glTexCoord1dv(a0);r.finishCall();break;}
+case TRACE_glReadPixels:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLvoid*>();table.glReadPixels(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribI3iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI3iv(a0,a1);r.finishCall();break;}
+case TRACE_glSetFenceAPPLE:{auto const a0 = r.template arg<GLuint>();table.glSetFenceAPPLE(a0);r.finishCall();break;}
+case TRACE_glWeightsvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLshort*>();table.glWeightsvARB(a0,a1);r.finishCall();break;}
+case TRACE_glShadeModel:{auto const a0 = r.template arg<GLenum>();table.glShadeModel(a0);r.finishCall();break;}
+case TRACE_glTextureStorageMem3DMultisampleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLuint64>();table.glTextureStorageMem3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glMapGrid1d:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glMapGrid1d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetHistogramParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetHistogramParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glConservativeRasterParameteriNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glConservativeRasterParameteriNV(a0,a1);r.finishCall();break;}
+case TRACE_glClearNamedBufferData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<const void*>();table.glClearNamedBufferData(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glClearDepthf:{auto const a0 = r.template arg<GLfloat>();table.glClearDepthf(a0);r.finishCall();break;}
+case TRACE_glCreatePerfQueryINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint*>();table.glCreatePerfQueryINTEL(a0,a1);r.finishCall();break;}
+case TRACE_glFogCoordfEXT:{auto const a0 = r.template arg<GLfloat>();table.glFogCoordfEXT(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib2dARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertexAttrib2dARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4dARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glMultiTexCoord4dARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glReadnPixelsARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<void*>();table.glReadnPixelsARB(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glMultiTexBufferEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glMultiTexBufferEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWindowPos4dvMESA:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos4dvMESA(a0);r.finishCall();break;}
+case TRACE_glInvalidateNamedFramebufferData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLenum*>();table.glInvalidateNamedFramebufferData(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColorPointerListIBM:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const void**>();auto const a4 = r.template arg<GLint>();table.glSecondaryColorPointerListIBM(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glRectiv:{auto const a0 = r.template arg<const GLint*>();auto const a1 = r.template arg<const GLint*>();table.glRectiv(a0,a1);r.finishCall();break;}
+case TRACE_glColorP4ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glColorP4ui(a0,a1);r.finishCall();break;}
+case TRACE_glUseProgramStages:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();auto const a2 = r.template arg<GLuint>();table.glUseProgramStages(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRasterPos3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glRasterPos3dv(a0);r.finishCall();break;}
+case TRACE_glPathTexGenNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const GLfloat*>();table.glPathTexGenNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexBlendEnviATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glVertexBlendEnviATI(a0,a1);r.finishCall();break;}
+case TRACE_glUniform3i64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64>();auto const a2 = r.template arg<GLint64>();auto const a3 = r.template arg<GLint64>();table.glUniform3i64ARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glLoadMatrixf:{auto const a0 = r.template arg<const GLfloat*>();table.glLoadMatrixf(a0);r.finishCall();break;}
+case TRACE_glProgramUniform2dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glProgramUniform2dEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI4iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI4iv(a0,a1);r.finishCall();break;}
+case TRACE_glNamedFramebufferDrawBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glNamedFramebufferDrawBuffer(a0,a1);r.finishCall();break;}
+case TRACE_glColor4ubv:{auto const a0 = r.template arg<const GLubyte*>();table.glColor4ubv(a0);r.finishCall();break;}
+case TRACE_glColor3hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glColor3hvNV(a0);r.finishCall();break;}
+case TRACE_glGetMapAttribParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetMapAttribParameterfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetBufferSubData:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<void*>();table.glGetBufferSubData(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribLdv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetVertexAttribLdv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnUniformuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLuint*>();table.glGetnUniformuiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetUniformui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetUniformui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedRenderbufferStorageEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glNamedRenderbufferStorageEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib3dNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertexAttrib3dNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureStorage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();table.glTextureStorage1DEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPixelTexGenParameteriSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPixelTexGenParameteriSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glColorTableEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();table.glColorTableEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGenBuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenBuffers(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord3xvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glMultiTexCoord3xvOES(a0,a1);r.finishCall();break;}
+case TRACE_glExecuteProgramNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLfloat*>();table.glExecuteProgramNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVariantArrayObjectATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glVariantArrayObjectATI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColor3xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glColor3xvOES(a0);r.finishCall();break;}
+case TRACE_glGetnConvolutionFilterARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<void*>();table.glGetnConvolutionFilterARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNormalFormatNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();table.glNormalFormatNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetInvariantFloatvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetInvariantFloatvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClearNamedFramebufferiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const GLint*>();table.glClearNamedFramebufferiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexImage3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<const GLvoid*>();table.glTexImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glGenSamplers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenSamplers(a0,a1);r.finishCall();break;}
+case TRACE_glIsFramebuffer:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsFramebuffer(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glProgramUniform3dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform3dvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetVertexAttribfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawRangeElementArrayAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glDrawRangeElementArrayAPPLE(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform3i64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64EXT>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();table.glUniform3i64NV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMatrixPopEXT:{auto const a0 = r.template arg<GLenum>();table.glMatrixPopEXT(a0);r.finishCall();break;}
+case TRACE_glVertexStream1sATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();table.glVertexStream1sATI(a0,a1);r.finishCall();break;}
+case TRACE_glGetnPixelMapuivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLuint*>();table.glGetnPixelMapuivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexEnviEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();table.glMultiTexEnviEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI2iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glVertexAttribI2iEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramParameter4fvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLfloat*>();table.glProgramParameter4fvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWaitSemaphoreEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLuint*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<const GLuint*>();auto const a5 = r.template arg<const GLenum*>();table.glWaitSemaphoreEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glNamedFramebufferSampleLocationsfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glNamedFramebufferSampleLocationsfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexCoordP4uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glTexCoordP4uiv(a0,a1);r.finishCall();break;}
+case TRACE_glRectxvOES:{auto const a0 = r.template arg<const GLfixed*>();auto const a1 = r.template arg<const GLfixed*>();table.glRectxvOES(a0,a1);r.finishCall();break;}
+case TRACE_glGetVariantIntegervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVariantIntegervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteLists:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();table.glDeleteLists(a0,a1);r.finishCall();break;}
+case TRACE_glTexGendv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLdouble*>();table.glTexGendv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexP2uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glVertexP2uiv(a0,a1);r.finishCall();break;}
+case TRACE_glGetPerfMonitorGroupsAMD:{auto const a0 = r.template arg<GLint*>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLuint*>();table.glGetPerfMonitorGroupsAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultTransposeMatrixfARB:{auto const a0 = r.template arg<const GLfloat*>();table.glMultTransposeMatrixfARB(a0);r.finishCall();break;}
+case TRACE_glVertexAttribI2ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI2ivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glReplacementCodeuiColor4fNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();auto const a3 = r.template arg<const GLfloat*>();table.glReplacementCodeuiColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDeleteStatesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteStatesNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetBufferParameteri64v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint64*>();table.glGetBufferParameteri64v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform4dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform4dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEdgeFlagPointerEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLboolean*>();table.glEdgeFlagPointerEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVideoCaptureStreamParameterivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glVideoCaptureStreamParameterivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexStream4iATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glVertexStream4iATI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVDPAUFiniNV:{table.glVDPAUFiniNV();r.finishCall();break;}
+case TRACE_glMakeBufferNonResidentNV:{auto const a0 = r.template arg<GLenum>();table.glMakeBufferNonResidentNV(a0);r.finishCall();break;}
+case TRACE_glUniform1ui64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64>();table.glUniform1ui64ARB(a0,a1);r.finishCall();break;}
+case TRACE_glStencilStrokePathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();table.glStencilStrokePathNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVariantuivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVariantuivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCopyTexSubImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();table.glCopyTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glSpriteParameteriSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glSpriteParameteriSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord1sARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();table.glMultiTexCoord1sARB(a0,a1);r.finishCall();break;}
+case TRACE_glConvolutionParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glConvolutionParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMakeTextureHandleResidentNV:{auto const a0 = r.template arg<GLuint64>();table.glMakeTextureHandleResidentNV(a0);r.finishCall();break;}
+case TRACE_glMultMatrixxOES:{auto const a0 = r.template arg<const GLfixed*>();table.glMultMatrixxOES(a0);r.finishCall();break;}
+case TRACE_glTextureNormalEXT:{auto const a0 = r.template arg<GLenum>();table.glTextureNormalEXT(a0);r.finishCall();break;}
+case TRACE_glGetQueryivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetQueryivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedMultiTexImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<const void*>();table.glCompressedMultiTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glGetInstrumentsSGIX:{auto const result = table.glGetInstrumentsSGIX();r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glProgramUniformMatrix4x3fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix4x3fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPointParameterf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPointParameterf(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform3dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glProgramUniform3dEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiTexCoord2hNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glMultiTexCoord2hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetConvolutionFilterEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();table.glGetConvolutionFilterEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib2hNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glVertexAttrib2hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCurrentPaletteMatrixARB:{auto const a0 = r.template arg<GLint>();table.glCurrentPaletteMatrixARB(a0);r.finishCall();break;}
+case TRACE_glFogxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glFogxvOES(a0,a1);r.finishCall();break;}
+case TRACE_glCreateRenderbuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateRenderbuffers(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4Nusv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVertexAttrib4Nusv(a0,a1);r.finishCall();break;}
+case TRACE_glCombinerInputNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();table.glCombinerInputNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glDepthFunc:{auto const a0 = r.template arg<GLenum>();table.glDepthFunc(a0);r.finishCall();break;}
+case TRACE_glWindowPos4fMESA:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glWindowPos4fMESA(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEnableClientStateIndexedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glEnableClientStateIndexedEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord4iv:{auto const a0 = r.template arg<const GLint*>();table.glTexCoord4iv(a0);r.finishCall();break;}
+case TRACE_glProgramUniform4i64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64>();auto const a3 = r.template arg<GLint64>();auto const a4 = r.template arg<GLint64>();auto const a5 = r.template arg<GLint64>();table.glProgramUniform4i64ARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBlendFunci:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();table.glBlendFunci(a0,a1,a2);r.finishCall();break;}
+case TRACE_glResolveDepthValuesNV:{table.glResolveDepthValuesNV();r.finishCall();break;}
+case TRACE_glTextureColorMaskSGIS:{auto const a0 = r.template arg<GLboolean>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLboolean>();table.glTextureColorMaskSGIS(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCreateShaderProgramEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glCreateShaderProgramEXT(a0,a1);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glBufferStorage:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLbitfield>();table.glBufferStorage(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMakeNamedBufferNonResidentNV:{auto const a0 = r.template arg<GLuint>();table.glMakeNamedBufferNonResidentNV(a0);r.finishCall();break;}
+case TRACE_glRenderbufferStorageMultisampleEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glRenderbufferStorageMultisampleEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetFloati_v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetFloati_v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform2ui64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLuint64>();table.glUniform2ui64ARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glVertex3fv(a0);r.finishCall();break;}
+case TRACE_glGetUniformLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetUniformLocation(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glVertexStream1svATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glVertexStream1svATI(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream3fATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glVertexStream3fATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedFramebufferDrawBuffers:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLenum*>();table.glNamedFramebufferDrawBuffers(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform2ui64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64EXT*>();table.glUniform2ui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordPointervINTEL:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void**>();table.glTexCoordPointervINTEL(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform4fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform4fv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormalPointerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glNormalPointerEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4hNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();auto const a4 = r.template arg<GLhalfNV>();table.glVertexAttrib4hNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNormal3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glNormal3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream2iATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glVertexStream2iATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribP4uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLuint*>();table.glVertexAttribP4uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCompressedTextureSubImage3D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLsizei>();auto const a10 = r.template arg<const void*>();table.glCompressedTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glAsyncMarkerSGIX:{auto const a0 = r.template arg<GLuint>();table.glAsyncMarkerSGIX(a0);r.finishCall();break;}
+case TRACE_glTextureStorageSparseAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLbitfield>();table.glTextureStorageSparseAMD(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetConvolutionParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetConvolutionParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEndPerfQueryINTEL:{auto const a0 = r.template arg<GLuint>();table.glEndPerfQueryINTEL(a0);r.finishCall();break;}
+case TRACE_glFragmentLightModeliSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glFragmentLightModeliSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glPrioritizeTexturesEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<const GLclampf*>();table.glPrioritizeTexturesEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEndConditionalRender:{table.glEndConditionalRender();r.finishCall();break;}
+case TRACE_glEnableClientState:{auto const a0 = r.template arg<GLenum>();table.glEnableClientState(a0);r.finishCall();break;}
+case TRACE_glResetHistogram:{auto const a0 = r.template arg<GLenum>();table.glResetHistogram(a0);r.finishCall();break;}
+case TRACE_glGetOcclusionQueryivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetOcclusionQueryivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform1uiEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();table.glUniform1uiEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2sv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord2sv(a0,a1);r.finishCall();break;}
+case TRACE_glTexSubImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const void*>();table.glTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glProgramUniform2uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform2uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord2iARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glMultiTexCoord2iARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetQueryObjectuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetQueryObjectuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenerateMultiTexMipmapEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glGenerateMultiTexMipmapEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttrib4iv(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos3dvMESA:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos3dvMESA(a0);r.finishCall();break;}
+case TRACE_glLabelObjectEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLchar*>();table.glLabelObjectEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform1uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform1uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferTexture:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();table.glFramebufferTexture(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexEnvfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat>();table.glMultiTexEnvfEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetTexGendv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetTexGendv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex4xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glVertex4xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI2uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI2uivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameter4fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLfloat*>();table.glNamedProgramLocalParameter4fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor3usv:{auto const a0 = r.template arg<const GLushort*>();table.glColor3usv(a0);r.finishCall();break;}
+case TRACE_glGetPixelTransformParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetPixelTransformParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIndexxvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glIndexxvOES(a0);r.finishCall();break;}
+case TRACE_glDepthMask:{auto const a0 = r.template arg<GLboolean>();table.glDepthMask(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x4fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix2x4fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glAreProgramsResidentNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<GLboolean*>();auto const result = table.glAreProgramsResidentNV(a0,a1,a2);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glColorTable:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const GLvoid*>();table.glColorTable(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBeginQueryIndexed:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glBeginQueryIndexed(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream1dvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexStream1dvATI(a0,a1);r.finishCall();break;}
+case TRACE_glGetMultiTexEnvfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetMultiTexEnvfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDeleteFencesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteFencesNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribs1dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glVertexAttribs1dvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBufferStorageExternalEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLeglClientBufferEXT>();auto const a4 = r.template arg<GLbitfield>();table.glBufferStorageExternalEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexStream2sATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glVertexStream2sATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnSeparableFilterARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<void*>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<void*>();auto const a7 = r.template arg<void*>();table.glGetnSeparableFilterARB(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glProgramUniform2dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform2dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glActiveStencilFaceEXT:{auto const a0 = r.template arg<GLenum>();table.glActiveStencilFaceEXT(a0);r.finishCall();break;}
+case TRACE_glProgramUniform4dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glProgramUniform4dEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glPointSizexOES:{auto const a0 = r.template arg<GLfixed>();table.glPointSizexOES(a0);r.finishCall();break;}
+case TRACE_glRasterPos2sv:{auto const a0 = r.template arg<const GLshort*>();table.glRasterPos2sv(a0);r.finishCall();break;}
+case TRACE_glBindParameterEXT:{auto const a0 = r.template arg<GLenum>();auto const result = table.glBindParameterEXT(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glTexCoord1sv:{auto const a0 = r.template arg<const GLshort*>();table.glTexCoord1sv(a0);r.finishCall();break;}
+case TRACE_glBlendParameteriNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glBlendParameteriNV(a0,a1);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameter4dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLdouble*>();table.glNamedProgramLocalParameter4dvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformHandleui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64>();table.glProgramUniformHandleui64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTextureParameterfvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetTextureParameterfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetPathMetricsNV:{auto const a0 = r.template arg<GLbitfield>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLfloat*>();table.glGetPathMetricsNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertex2i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glVertex2i(a0,a1);r.finishCall();break;}
+case TRACE_glNewList:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glNewList(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixLoad3x3fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixLoad3x3fNV(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2fARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glMultiTexCoord2fARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWeightdvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLdouble*>();table.glWeightdvARB(a0,a1);r.finishCall();break;}
+case TRACE_glIsTransformFeedbackNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsTransformFeedbackNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glVertexAttribDivisorARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexAttribDivisorARB(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColorP3uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glSecondaryColorP3uiv(a0,a1);r.finishCall();break;}
+case TRACE_glGetnCompressedTexImageARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<void*>();table.glGetnCompressedTexImageARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetIntegerv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint*>();table.glGetIntegerv(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixLoaddEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMatrixLoaddEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetPathLengthNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const result = table.glGetPathLengthNV(a0,a1,a2);r.finishCall();r.template result<GLfloat>(result);break;}
+case TRACE_glProgramUniformMatrix3dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix3dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform4i64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64EXT>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();auto const a4 = r.template arg<GLint64EXT>();table.glUniform4i64NV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetHistogramEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<void*>();table.glGetHistogramEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib4NuivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttrib4NuivARB(a0,a1);r.finishCall();break;}
+case TRACE_glMapGrid2xOES:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();auto const a4 = r.template arg<GLfixed>();table.glMapGrid2xOES(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexImage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const GLvoid*>();table.glTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glWindowPos2fvARB:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos2fvARB(a0);r.finishCall();break;}
+case TRACE_glEnableIndexedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glEnableIndexedEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord1bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glTexCoord1bvOES(a0);r.finishCall();break;}
+case TRACE_glDrawPixels:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<const GLvoid*>();table.glDrawPixels(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultMatrixd:{auto const a0 = r.template arg<const GLdouble*>();table.glMultMatrixd(a0);r.finishCall();break;}
+case TRACE_glMultMatrixf:{auto const a0 = r.template arg<const GLfloat*>();table.glMultMatrixf(a0);r.finishCall();break;}
+case TRACE_glReplacementCodePointerSUN:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void**>();table.glReplacementCodePointerSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLoadTransposeMatrixdARB:{auto const a0 = r.template arg<const GLdouble*>();table.glLoadTransposeMatrixdARB(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib4Nubv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttrib4Nubv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexArrayVertexAttribIOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLintptr>();table.glVertexArrayVertexAttribIOffsetEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glCompileShaderARB:{auto const a0 = r.template arg<GLhandleARB>();table.glCompileShaderARB(a0);r.finishCall();break;}
+case TRACE_glWindowPos3dMESA:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glWindowPos3dMESA(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormalStream3fvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glNormalStream3fvATI(a0,a1);r.finishCall();break;}
+case TRACE_glColor4usv:{auto const a0 = r.template arg<const GLushort*>();table.glColor4usv(a0);r.finishCall();break;}
+case TRACE_glMapGrid1f:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glMapGrid1f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPolygonStipple:{auto const a0 = r.template arg<const GLubyte*>();table.glPolygonStipple(a0);r.finishCall();break;}
+case TRACE_glUniform4ui64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLuint64>();auto const a3 = r.template arg<GLuint64>();auto const a4 = r.template arg<GLuint64>();table.glUniform4ui64ARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTextureRenderbufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glTextureRenderbufferEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSubroutineUniformLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLchar*>();auto const result = table.glGetSubroutineUniformLocation(a0,a1,a2);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glGetFramebufferParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetFramebufferParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPixelMapusv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLushort*>();table.glPixelMapusv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSamplerParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetSamplerParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream2fvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexStream2fvATI(a0,a1);r.finishCall();break;}
+case TRACE_glProgramStringARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glProgramStringARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix3dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glSeparableFilter2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const GLvoid*>();auto const a7 = r.template arg<const GLvoid*>();table.glSeparableFilter2D(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glVertexAttribI1uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI1uiv(a0,a1);r.finishCall();break;}
+case TRACE_glLGPUCopyImageSubDataNVX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLint>();auto const a11 = r.template arg<GLint>();auto const a12 = r.template arg<GLint>();auto const a13 = r.template arg<GLint>();auto const a14 = r.template arg<GLsizei>();auto const a15 = r.template arg<GLsizei>();auto const a16 = r.template arg<GLsizei>();table.glLGPUCopyImageSubDataNVX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);r.finishCall();break;}
+case TRACE_glTexStorage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glTexStorage2D(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColor3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glColor3fv(a0);r.finishCall();break;}
+case TRACE_glGetMultiTexGendvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLdouble*>();table.glGetMultiTexGendvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL4dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL4dvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetActiveUniform:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLint*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLchar*>();table.glGetActiveUniform(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glUniform2ui64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64*>();table.glUniform2ui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMakeNamedBufferResidentNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glMakeNamedBufferResidentNV(a0,a1);r.finishCall();break;}
+case TRACE_glPathGlyphIndexRangeNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLbitfield>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLuint*>();auto const result = table.glPathGlyphIndexRangeNV(a0,a1,a2,a3,a4,a5);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glColorPointer:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLvoid*>();table.glColorPointer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramEnvParameterI4ivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLint*>();table.glProgramEnvParameterI4ivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMulticastGetQueryObjectui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint64*>();table.glMulticastGetQueryObjectui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexParameterfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat>();table.glMultiTexParameterfEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedFramebufferTextureLayer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glNamedFramebufferTextureLayer(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetVertexArrayIntegervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexArrayIntegervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib3dARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertexAttrib3dARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVDPAUIsSurfaceNV:{auto const a0 = r.template arg<GLvdpauSurfaceNV>();auto const result = table.glVDPAUIsSurfaceNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glMultiTexImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const void*>();table.glMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glIsAsyncMarkerSGIX:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsAsyncMarkerSGIX(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetDoublei_vEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble*>();table.glGetDoublei_vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform2i64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64EXT>();auto const a2 = r.template arg<GLint64EXT>();table.glUniform2i64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsCommandListNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsCommandListNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glUniform3uiEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glUniform3uiEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexParameterIuivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glTexParameterIuivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix4fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertex2fv:{auto const a0 = r.template arg<const GLfloat*>();table.glVertex2fv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribL3dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertexAttribL3dEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferRenderbuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glFramebufferRenderbuffer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetUniformLocationARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<const GLcharARB*>();auto const result = table.glGetUniformLocationARB(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glPathParameterfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glPathParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib3sNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glVertexAttrib3sNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetDoublei_v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble*>();table.glGetDoublei_v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib1sv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib1sv(a0,a1);r.finishCall();break;}
+case TRACE_glBindSampler:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glBindSampler(a0,a1);r.finishCall();break;}
+case TRACE_glLineWidth:{auto const a0 = r.template arg<GLfloat>();table.glLineWidth(a0);r.finishCall();break;}
+case TRACE_glVertexArrayRangeAPPLE:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<void*>();table.glVertexArrayRangeAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glBindBufferOffsetEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();table.glBindBufferOffsetEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWeightfvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLfloat*>();table.glWeightfvARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetIntegeri_v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint*>();table.glGetIntegeri_v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTransformFeedbackVarying:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLsizei*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLchar*>();table.glGetTransformFeedbackVarying(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glProgramLocalParameter4fvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLfloat*>();table.glProgramLocalParameter4fvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTransformFeedbackVaryingNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint*>();table.glGetTransformFeedbackVaryingNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos2iv:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos2iv(a0);r.finishCall();break;}
+case TRACE_glVertexStream1dATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();table.glVertexStream1dATI(a0,a1);r.finishCall();break;}
+case TRACE_glColorFragmentOp2ATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLuint>();table.glColorFragmentOp2ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glFogiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glFogiv(a0,a1);r.finishCall();break;}
+case TRACE_glGetTextureHandleNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glGetTextureHandleNV(a0);r.finishCall();r.template result<GLuint64>(result);break;}
+case TRACE_glLightModeliv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glLightModeliv(a0,a1);r.finishCall();break;}
+case TRACE_glDepthRangef:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glDepthRangef(a0,a1);r.finishCall();break;}
+case TRACE_glGetFragmentMaterialivSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetFragmentMaterialivSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVideoCaptureStreamParameterfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glVideoCaptureStreamParameterfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDeleteProgramsARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteProgramsARB(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos3fvARB:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos3fvARB(a0);r.finishCall();break;}
+case TRACE_glFeedbackBufferxOES:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glFeedbackBufferxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTexBumpParameterfvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetTexBumpParameterfvATI(a0,a1);r.finishCall();break;}
+case TRACE_glEnablei:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glEnablei(a0,a1);r.finishCall();break;}
+case TRACE_glGetActiveSubroutineName:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei*>();auto const a5 = r.template arg<GLchar*>();table.glGetActiveSubroutineName(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glDrawBuffersARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLenum*>();table.glDrawBuffersARB(a0,a1);r.finishCall();break;}
+case TRACE_glBindProgramARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindProgramARB(a0,a1);r.finishCall();break;}
+case TRACE_glEvalCoord1fv:{auto const a0 = r.template arg<const GLfloat*>();table.glEvalCoord1fv(a0);r.finishCall();break;}
+case TRACE_glProgramUniform3ui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64*>();table.glProgramUniform3ui64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix2dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiTexCoord2hvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLhalfNV*>();table.glMultiTexCoord2hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetFloatIndexedvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetFloatIndexedvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSampleCoverageARB:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLboolean>();table.glSampleCoverageARB(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform2ui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64*>();table.glProgramUniform2ui64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPixelDataRangeNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void*>();table.glPixelDataRangeNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream3svATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glVertexStream3svATI(a0,a1);r.finishCall();break;}
+case TRACE_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();auto const a3 = r.template arg<const GLfloat*>();table.glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexCoord3hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glTexCoord3hvNV(a0);r.finishCall();break;}
+case TRACE_glSampleMaski:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();table.glSampleMaski(a0,a1);r.finishCall();break;}
+case TRACE_glIndexFuncEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLclampf>();table.glIndexFuncEXT(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameteriNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPointParameteriNV(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix3x2fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix3x2fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetFramebufferParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetFramebufferParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform2i64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64>();auto const a2 = r.template arg<GLint64>();table.glUniform2i64ARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedBufferStorageEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLbitfield>();table.glNamedBufferStorageEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedFramebufferTexture3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glNamedFramebufferTexture3DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib2dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib2dv(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexArrayPointervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetVertexArrayPointervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVertexAttribArrayObjectivATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexAttribArrayObjectivATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix3fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glEnableVertexArrayEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glEnableVertexArrayEXT(a0,a1);r.finishCall();break;}
+case TRACE_glColorTableParameterfvSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glColorTableParameterfvSGI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEdgeFlag:{auto const a0 = r.template arg<GLboolean>();table.glEdgeFlag(a0);r.finishCall();break;}
+case TRACE_glFogCoordf:{auto const a0 = r.template arg<GLfloat>();table.glFogCoordf(a0);r.finishCall();break;}
+case TRACE_glVertex3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertex3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glVertex3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSpriteParameterivSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glSpriteParameterivSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glPathGlyphRangeNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLbitfield>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLfloat>();table.glPathGlyphRangeNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glPrimitiveBoundingBoxARB:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();table.glPrimitiveBoundingBoxARB(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glVertexAttribL3ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint64EXT*>();table.glVertexAttribL3ui64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertex3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glVertex3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordP2ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glTexCoordP2ui(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform2fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform2fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDeletePathsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();table.glDeletePathsNV(a0,a1);r.finishCall();break;}
+case TRACE_glPrimitiveRestartIndexNV:{auto const a0 = r.template arg<GLuint>();table.glPrimitiveRestartIndexNV(a0);r.finishCall();break;}
+case TRACE_glTexCoord2fColor3fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();table.glTexCoord2fColor3fVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordPointerListIBM:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const void**>();auto const a4 = r.template arg<GLint>();table.glTexCoordPointerListIBM(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glRectxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glRectxOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCopyNamedBufferSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glCopyNamedBufferSubData(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGenProgramsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenProgramsNV(a0,a1);r.finishCall();break;}
+case TRACE_glFragmentLightfSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glFragmentLightfSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexStorage3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glTexStorage3D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTextureParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTextureParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedBufferDataEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLenum>();table.glNamedBufferDataEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glImportSemaphoreWin32NameEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();table.glImportSemaphoreWin32NameEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3fvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord3fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix3x4fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix3x4fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSubpixelPrecisionBiasNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glSubpixelPrecisionBiasNV(a0,a1);r.finishCall();break;}
+case TRACE_glNormalPointer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLvoid*>();table.glNormalPointer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedFramebufferTexture:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();table.glNamedFramebufferTexture(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4NsvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib4NsvARB(a0,a1);r.finishCall();break;}
+case TRACE_glPassThrough:{auto const a0 = r.template arg<GLfloat>();table.glPassThrough(a0);r.finishCall();break;}
+case TRACE_glSecondaryColorP3ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glSecondaryColorP3ui(a0,a1);r.finishCall();break;}
+case TRACE_glInvalidateTexSubImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();table.glInvalidateTexSubImage(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glIsImageHandleResidentARB:{auto const a0 = r.template arg<GLuint64>();auto const result = table.glIsImageHandleResidentARB(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glTangent3fvEXT:{auto const a0 = r.template arg<const GLfloat*>();table.glTangent3fvEXT(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x3fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix4x3fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBegin:{auto const a0 = r.template arg<GLenum>();table.glBegin(a0);r.finishCall();break;}
+case TRACE_glEvalCoord2dv:{auto const a0 = r.template arg<const GLdouble*>();table.glEvalCoord2dv(a0);r.finishCall();break;}
+case TRACE_glColor3ubv:{auto const a0 = r.template arg<const GLubyte*>();table.glColor3ubv(a0);r.finishCall();break;}
+case TRACE_glFogCoordfvEXT:{auto const a0 = r.template arg<const GLfloat*>();table.glFogCoordfvEXT(a0);r.finishCall();break;}
+case TRACE_glVertexP3ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glVertexP3ui(a0,a1);r.finishCall();break;}
+case TRACE_glLightfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glLightfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribL3i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint64EXT>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();table.glVertexAttribL3i64NV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStencilClearTagEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint>();table.glStencilClearTagEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetActiveUniformName:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLchar*>();table.glGetActiveUniformName(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTangentPointerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void*>();table.glTangentPointerEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform4ui64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64EXT*>();table.glUniform4ui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDebugMessageEnableAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<GLboolean>();table.glDebugMessageEnableAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniform2ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glProgramUniform2ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCopyTexSubImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();table.glCopyTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGenRenderbuffersEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenRenderbuffersEXT(a0,a1);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameterI4ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLint*>();table.glNamedProgramLocalParameterI4ivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord2f:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glMultiTexCoord2f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMapGrid2d:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glMapGrid2d(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetMultiTexParameterIuivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint*>();table.glGetMultiTexParameterIuivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBlendEquationiARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glBlendEquationiARB(a0,a1);r.finishCall();break;}
+case TRACE_glTexParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTexParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform4ivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform4ivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixOrthoEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();auto const a6 = r.template arg<GLdouble>();table.glMatrixOrthoEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexArrayVertexBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizei>();table.glVertexArrayVertexBuffer(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramLocalParametersI4ivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramLocalParametersI4ivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64EXT*>();table.glProgramUniform4ui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetNamedStringivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLchar*>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetNamedStringivARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL1i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint64EXT*>();table.glVertexAttribL1i64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glTransformFeedbackBufferBase:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glTransformFeedbackBufferBase(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIndexsv:{auto const a0 = r.template arg<const GLshort*>();table.glIndexsv(a0);r.finishCall();break;}
+case TRACE_glPointParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glPointParameterivNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetDetailTexFuncSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetDetailTexFuncSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glReplacementCodeuiColor3fVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();table.glReplacementCodeuiColor3fVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramLocalParameter4fARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glProgramLocalParameter4fARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBitmap:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<const GLubyte*>();table.glBitmap(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glNamedFramebufferTextureLayerEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glNamedFramebufferTextureLayerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiTexGenfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glMultiTexGenfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetNamedBufferSubData:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<void*>();table.glGetNamedBufferSubData(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStencilFuncSeparateATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLuint>();table.glStencilFuncSeparateATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform2iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform2iv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetQueryiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetQueryiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glTexCoord4f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMapGrid2f:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glMapGrid2f(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glListParameterivSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glListParameterivSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCreateQueries:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLuint*>();table.glCreateQueries(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSamplerParameterfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetSamplerParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glTexCoord4i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glObjectLabel:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLchar*>();table.glObjectLabel(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform3i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();auto const a4 = r.template arg<GLint64EXT>();table.glProgramUniform3i64NV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetTextureHandleARB:{auto const a0 = r.template arg<GLuint>();auto const result = table.glGetTextureHandleARB(a0);r.finishCall();r.template result<GLuint64>(result);break;}
+case TRACE_glTexCoord4s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glTexCoord4s(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform4iARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glUniform4iARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetUniformIndices:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*const*>();auto const a3 = r.template arg<GLuint*>();table.glGetUniformIndices(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const void*>();table.glMultiTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glCoverageModulationTableNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLfloat*>();table.glCoverageModulationTableNV(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glPointParameteriv(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord4svARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord4svARB(a0,a1);r.finishCall();break;}
+case TRACE_glNormal3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glNormal3fv(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x4dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix3x4dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexCoord1fv:{auto const a0 = r.template arg<const GLfloat*>();table.glTexCoord1fv(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x3dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix4x3dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetActiveVaryingNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLsizei*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLchar*>();table.glGetActiveVaryingNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glUniform1i64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64*>();table.glUniform1i64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1dv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord1dv(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glTexCoord3fv(a0);r.finishCall();break;}
+case TRACE_glMatrixTranslatefEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glMatrixTranslatefEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform1ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64EXT*>();table.glProgramUniform1ui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureMaterialEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glTextureMaterialEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoordP3uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glMultiTexCoordP3uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribP3ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribP3ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glInterpolatePathsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLfloat>();table.glInterpolatePathsNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureBufferRange:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glTextureBufferRange(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribL2dEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertexAttribL2dEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPixelTransformParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetPixelTransformParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glTexCoord4xvOES(a0);r.finishCall();break;}
+case TRACE_glGetVariantBooleanvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean*>();table.glGetVariantBooleanvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDepthRange:{auto const a0 = r.template arg<GLclampd>();auto const a1 = r.template arg<GLclampd>();table.glDepthRange(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexAttribdvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetVertexAttribdvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetColorTableParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetColorTableParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawArraysInstancedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glDrawArraysInstancedEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDisableClientStateIndexedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glDisableClientStateIndexedEXT(a0,a1);r.finishCall();break;}
+case TRACE_glDrawBuffer:{auto const a0 = r.template arg<GLenum>();table.glDrawBuffer(a0);r.finishCall();break;}
+case TRACE_glMultiDrawArraysIndirectBindlessNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();table.glMultiDrawArraysIndirectBindlessNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetnPixelMapusv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLushort*>();table.glGetnPixelMapusv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRasterPos3fv:{auto const a0 = r.template arg<const GLfloat*>();table.glRasterPos3fv(a0);r.finishCall();break;}
+case TRACE_glClearBufferuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const GLuint*>();table.glClearBufferuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetInternalformati64v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint64*>();table.glGetInternalformati64v(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glShaderSourceARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLcharARB**>();auto const a3 = r.template arg<const GLint*>();table.glShaderSourceARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glShaderOp3EXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glShaderOp3EXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glWindowPos2dvMESA:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos2dvMESA(a0);r.finishCall();break;}
+case TRACE_glClearIndex:{auto const a0 = r.template arg<GLfloat>();table.glClearIndex(a0);r.finishCall();break;}
+case TRACE_glProvokingVertexEXT:{auto const a0 = r.template arg<GLenum>();table.glProvokingVertexEXT(a0);r.finishCall();break;}
+case TRACE_glVariantubvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVariantubvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glFlush:{table.glFlush();r.finishCall();break;}
+case TRACE_glFramebufferTexture2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTexture2DEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetColorTableParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetColorTableParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPresentFrameDualFillNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLuint>();auto const a11 = r.template arg<GLenum>();auto const a12 = r.template arg<GLuint>();table.glPresentFrameDualFillNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);r.finishCall();break;}
+case TRACE_glGenVertexShadersEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glGenVertexShadersEXT(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glSpecializeShaderARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<const GLuint*>();table.glSpecializeShaderARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniformHandleui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64*>();table.glProgramUniformHandleui64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDepthRangefOES:{auto const a0 = r.template arg<GLclampf>();auto const a1 = r.template arg<GLclampf>();table.glDepthRangefOES(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteVertexArrays:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteVertexArrays(a0,a1);r.finishCall();break;}
+case TRACE_glDrawElementsInstancedBaseVertexBaseInstance:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLuint>();table.glDrawElementsInstancedBaseVertexBaseInstance(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetTexLevelParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetTexLevelParameteriv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDrawVkImageNV:{auto const a0 = r.template arg<GLuint64>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();table.glDrawVkImageNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glWindowPos3iARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glWindowPos3iARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPrioritizeTextures:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<const GLclampf*>();table.glPrioritizeTextures(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3fvMESA:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos3fvMESA(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x2dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix3x2dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertex4xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glVertex4xvOES(a0);r.finishCall();break;}
+case TRACE_glTexStorage3DMultisample:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();table.glTexStorage3DMultisample(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glWindowPos2sARB:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();table.glWindowPos2sARB(a0,a1);r.finishCall();break;}
+case TRACE_glStencilOpValueAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glStencilOpValueAMD(a0,a1);r.finishCall();break;}
+case TRACE_glProgramVertexLimitNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glProgramVertexLimitNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetTexParameterPointervAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetTexParameterPointervAPPLE(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform3uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform3uivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glClampColor:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glClampColor(a0,a1);r.finishCall();break;}
+case TRACE_glClearStencil:{auto const a0 = r.template arg<GLint>();table.glClearStencil(a0);r.finishCall();break;}
+case TRACE_glTexCoordP1uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glTexCoordP1uiv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribs3svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLshort*>();table.glVertexAttribs3svNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3fv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord3fv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexBlendEnvfATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glVertexBlendEnvfATI(a0,a1);r.finishCall();break;}
+case TRACE_glIsFenceAPPLE:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsFenceAPPLE(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetBufferParameterui64vNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetBufferParameterui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI4bvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVertexAttribI4bvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glUniform2fARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glUniform2fARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glStopInstrumentsSGIX:{auto const a0 = r.template arg<GLint>();table.glStopInstrumentsSGIX(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3fNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glVertexAttrib3fNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMapVertexAttrib2dAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLdouble>();auto const a7 = r.template arg<GLdouble>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLint>();auto const a10 = r.template arg<const GLdouble*>();table.glMapVertexAttrib2dAPPLE(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glVertex2f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glVertex2f(a0,a1);r.finishCall();break;}
+case TRACE_glCopyTextureImage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLint>();table.glCopyTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glVertex2d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glVertex2d(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3bvEXT:{auto const a0 = r.template arg<const GLbyte*>();table.glSecondaryColor3bvEXT(a0);r.finishCall();break;}
+case TRACE_glMultiTexCoord4fARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glMultiTexCoord4fARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPolygonOffset:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glPolygonOffset(a0,a1);r.finishCall();break;}
+case TRACE_glTangent3bvEXT:{auto const a0 = r.template arg<const GLbyte*>();table.glTangent3bvEXT(a0);r.finishCall();break;}
+case TRACE_glHistogram:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();table.glHistogram(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetProgramiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetProgramiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixIndexubvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLubyte*>();table.glMatrixIndexubvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertex2s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();table.glVertex2s(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexAttribLui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetVertexAttribLui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramStringARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void*>();table.glGetProgramStringARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFlushMappedBufferRange:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();table.glFlushMappedBufferRange(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI3uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribI3uiEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glLineWidthxOES:{auto const a0 = r.template arg<GLfixed>();table.glLineWidthxOES(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix2fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetTextureParameterIuivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint*>();table.glGetTextureParameterIuivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetMultiTexEnvivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetMultiTexEnvivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPixelTexGenParameterivSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glPixelTexGenParameterivSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glGenQueries:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenQueries(a0,a1);r.finishCall();break;}
+case TRACE_glGetPixelMapfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetPixelMapfv(a0,a1);r.finishCall();break;}
+case TRACE_glBlendColorEXT:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glBlendColorEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glResetMinmax:{auto const a0 = r.template arg<GLenum>();table.glResetMinmax(a0);r.finishCall();break;}
+case TRACE_glGetnUniformivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint*>();table.glGetnUniformivARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexBlendARB:{auto const a0 = r.template arg<GLint>();table.glVertexBlendARB(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib4d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glVertexAttrib4d(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetVaryingLocationNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetVaryingLocationNV(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glGetMapAttribParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetMapAttribParameterivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexSubImage3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const GLvoid*>();table.glTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glDeleteSamplers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteSamplers(a0,a1);r.finishCall();break;}
+case TRACE_glGetLightxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetLightxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVertexAttribArrayObjectfvATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetVertexAttribArrayObjectfvATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexArrayNormalOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLintptr>();table.glVertexArrayNormalOffsetEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetBufferParameterivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetBufferParameterivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTextureParameterfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetTextureParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawMeshArraysSUN:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glDrawMeshArraysSUN(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4dNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glVertexAttrib4dNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetMultisamplefvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetMultisamplefvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMapObjectBufferATI:{auto const a0 = r.template arg<GLuint>();auto const result = table.glMapObjectBufferATI(a0);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glGetPathCommandsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLubyte*>();table.glGetPathCommandsNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexArrayTexCoordOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLintptr>();table.glVertexArrayTexCoordOffsetEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetHistogram:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLvoid*>();table.glGetHistogram(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMatrixMode:{auto const a0 = r.template arg<GLenum>();table.glMatrixMode(a0);r.finishCall();break;}
+case TRACE_glColorFormatNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();table.glColorFormatNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64EXT>();table.glProgramUniformui64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x2fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix4x2fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glLoadMatrixxOES:{auto const a0 = r.template arg<const GLfixed*>();table.glLoadMatrixxOES(a0);r.finishCall();break;}
+case TRACE_glGetColorTableParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetColorTableParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRasterPos4i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glRasterPos4i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL2i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint64EXT>();auto const a2 = r.template arg<GLint64EXT>();table.glVertexAttribL2i64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindTextures:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glBindTextures(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixRotatefEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glMatrixRotatefEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetClipPlanexOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed*>();table.glGetClipPlanexOES(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3uivEXT:{auto const a0 = r.template arg<const GLuint*>();table.glSecondaryColor3uivEXT(a0);r.finishCall();break;}
+case TRACE_glGetPerfQueryInfoINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLchar*>();auto const a3 = r.template arg<GLuint*>();auto const a4 = r.template arg<GLuint*>();auto const a5 = r.template arg<GLuint*>();auto const a6 = r.template arg<GLuint*>();table.glGetPerfQueryInfoINTEL(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetDoublev:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble*>();table.glGetDoublev(a0,a1);r.finishCall();break;}
+case TRACE_glBindBufferRangeEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glBindBufferRangeEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glCompressedTexImage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<const GLvoid*>();table.glCompressedTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glMapBufferARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const result = table.glMapBufferARB(a0,a1);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glGetPathSpacingNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLfloat*>();table.glGetPathSpacingNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glUniform4dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glUniform4dv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGlobalAlphaFactordSUN:{auto const a0 = r.template arg<GLdouble>();table.glGlobalAlphaFactordSUN(a0);r.finishCall();break;}
+case TRACE_glProgramUniform3dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform3dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetShaderSourceARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLcharARB*>();table.glGetShaderSourceARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib3dvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib3dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glInvalidateBufferData:{auto const a0 = r.template arg<GLuint>();table.glInvalidateBufferData(a0);r.finishCall();break;}
+case TRACE_glMatrixLoad3x2fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixLoad3x2fNV(a0,a1);r.finishCall();break;}
+case TRACE_glCompressedTextureSubImage1D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<const void*>();table.glCompressedTextureSubImage1D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glTexCoord3xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glTexCoord3xvOES(a0);r.finishCall();break;}
+case TRACE_glGenTexturesEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenTexturesEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTangent3iEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glTangent3iEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClearTexImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<const void*>();table.glClearTexImage(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBinormal3bvEXT:{auto const a0 = r.template arg<const GLbyte*>();table.glBinormal3bvEXT(a0);r.finishCall();break;}
+case TRACE_glUniform3fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform3fv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnPixelMapusvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLushort*>();table.glGetnPixelMapusvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMemoryObjectParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glMemoryObjectParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenSemaphoresEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenSemaphoresEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoordP1ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glMultiTexCoordP1ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClearNamedBufferDataEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<const void*>();table.glClearNamedBufferDataEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniformMatrix4dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix4dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWindowPos3fMESA:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glWindowPos3fMESA(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteRenderbuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteRenderbuffers(a0,a1);r.finishCall();break;}
+case TRACE_glGetTextureLevelParameterfvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLfloat*>();table.glGetTextureLevelParameterfvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetHistogramParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetHistogramParameterxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiDrawElements:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLsizei*>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*const*>();auto const a4 = r.template arg<GLsizei>();table.glMultiDrawElements(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMakeImageHandleNonResidentNV:{auto const a0 = r.template arg<GLuint64>();table.glMakeImageHandleNonResidentNV(a0);r.finishCall();break;}
+case TRACE_glTexSubImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();table.glTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glNormalStream3dATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glNormalStream3dATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL4i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint64EXT*>();table.glVertexAttribL4i64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glDrawBuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLenum*>();table.glDrawBuffers(a0,a1);r.finishCall();break;}
+case TRACE_glCopyTextureSubImage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();table.glCopyTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glWindowRectanglesEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glWindowRectanglesEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedFramebufferReadBuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glNamedFramebufferReadBuffer(a0,a1);r.finishCall();break;}
+case TRACE_glUniform2i64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64*>();table.glUniform2i64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI1uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI1uivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGetTexGenfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetTexGenfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginQueryARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBeginQueryARB(a0,a1);r.finishCall();break;}
+case TRACE_glUniform1iARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glUniform1iARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertex4bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glVertex4bvOES(a0);r.finishCall();break;}
+case TRACE_glInvalidateSubFramebuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLenum*>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();table.glInvalidateSubFramebuffer(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glUniform1fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform1fvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTestFenceNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glTestFenceNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glBindTransformFeedback:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindTransformFeedback(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2iv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord2iv(a0,a1);r.finishCall();break;}
+case TRACE_glCopyMultiTexSubImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();table.glCopyMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVariantbvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVariantbvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord1hNV:{auto const a0 = r.template arg<GLhalfNV>();table.glTexCoord1hNV(a0);r.finishCall();break;}
+case TRACE_glGenFencesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenFencesNV(a0,a1);r.finishCall();break;}
+case TRACE_glRasterPos3iv:{auto const a0 = r.template arg<const GLint*>();table.glRasterPos3iv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribL2ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint64EXT>();table.glVertexAttribL2ui64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1hvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLhalfNV*>();table.glMultiTexCoord1hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetnConvolutionFilter:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<void*>();table.glGetnConvolutionFilter(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNormal3bv:{auto const a0 = r.template arg<const GLbyte*>();table.glNormal3bv(a0);r.finishCall();break;}
+case TRACE_glWeightbvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLbyte*>();table.glWeightbvARB(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord4sv:{auto const a0 = r.template arg<const GLshort*>();table.glTexCoord4sv(a0);r.finishCall();break;}
+case TRACE_glUniform2uiv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform2uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginConditionalRenderNVX:{auto const a0 = r.template arg<GLuint>();table.glBeginConditionalRenderNVX(a0);r.finishCall();break;}
+case TRACE_glFinish:{table.glFinish();r.finishCall();break;}
+case TRACE_glColorTableParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glColorTableParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFragmentCoverageColorNV:{auto const a0 = r.template arg<GLuint>();table.glFragmentCoverageColorNV(a0);r.finishCall();break;}
+case TRACE_glProgramUniform3ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform3ivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexArrayVertexOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLintptr>();table.glVertexArrayVertexOffsetEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glViewportPositionWScaleNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glViewportPositionWScaleNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramLocalParameterIuivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint*>();table.glGetProgramLocalParameterIuivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glReplacementCodeuiTexCoord2fVertex3fvSUN:{auto const a0 = r.template arg<const GLuint*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();table.glReplacementCodeuiTexCoord2fVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform1uiv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform1uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniformMatrix2dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix2dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIndexdv:{auto const a0 = r.template arg<const GLdouble*>();table.glIndexdv(a0);r.finishCall();break;}
+case TRACE_glSecondaryColor3ivEXT:{auto const a0 = r.template arg<const GLint*>();table.glSecondaryColor3ivEXT(a0);r.finishCall();break;}
+case TRACE_glTexCoord3iv:{auto const a0 = r.template arg<const GLint*>();table.glTexCoord3iv(a0);r.finishCall();break;}
+case TRACE_glVertexStream4fvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexStream4fvATI(a0,a1);r.finishCall();break;}
+case TRACE_glDeformationMap3fSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();auto const a11 = r.template arg<GLint>();auto const a12 = r.template arg<GLint>();auto const a13 = r.template arg<const GLfloat*>();table.glDeformationMap3fSGIX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);r.finishCall();break;}
+case TRACE_glClearDepth:{auto const a0 = r.template arg<GLclampd>();table.glClearDepth(a0);r.finishCall();break;}
+case TRACE_glGenAsyncMarkersSGIX:{auto const a0 = r.template arg<GLsizei>();auto const result = table.glGenAsyncMarkersSGIX(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glDisableIndexedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glDisableIndexedEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexWeightfvEXT:{auto const a0 = r.template arg<const GLfloat*>();table.glVertexWeightfvEXT(a0);r.finishCall();break;}
+case TRACE_glGetProgramLocalParameterIivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint*>();table.glGetProgramLocalParameterIivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedTexImage3DARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const void*>();table.glCompressedTexImage3DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glProgramParameter4fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();table.glProgramParameter4fNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glConvolutionParameterxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glConvolutionParameterxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glInsertComponentEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glInsertComponentEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCreateTextures:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLuint*>();table.glCreateTextures(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColor3iv:{auto const a0 = r.template arg<const GLint*>();table.glSecondaryColor3iv(a0);r.finishCall();break;}
+case TRACE_glCreateBuffers:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateBuffers(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2xvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glMultiTexCoord2xvOES(a0,a1);r.finishCall();break;}
+case TRACE_glTexGenxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glTexGenxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultTransposeMatrixf:{auto const a0 = r.template arg<const GLfloat*>();table.glMultTransposeMatrixf(a0);r.finishCall();break;}
+case TRACE_glBeginTransformFeedbackEXT:{auto const a0 = r.template arg<GLenum>();table.glBeginTransformFeedbackEXT(a0);r.finishCall();break;}
+case TRACE_glTexCoord2fColor3fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();table.glTexCoord2fColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glNormal3sv:{auto const a0 = r.template arg<const GLshort*>();table.glNormal3sv(a0);r.finishCall();break;}
+case TRACE_glFreeObjectBufferATI:{auto const a0 = r.template arg<GLuint>();table.glFreeObjectBufferATI(a0);r.finishCall();break;}
+case TRACE_glBlendBarrierNV:{table.glBlendBarrierNV();r.finishCall();break;}
+case TRACE_glUniform4i64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64EXT*>();table.glUniform4i64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnUniformuivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLuint*>();table.glGetnUniformuivARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glAlphaFragmentOp3ATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLuint>();auto const a10 = r.template arg<GLuint>();auto const a11 = r.template arg<GLuint>();table.glAlphaFragmentOp3ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glProgramEnvParameters4fvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramEnvParameters4fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBlendFuncSeparateEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glBlendFuncSeparateEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glConvolutionParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glConvolutionParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPixelTexGenSGIX:{auto const a0 = r.template arg<GLenum>();table.glPixelTexGenSGIX(a0);r.finishCall();break;}
+case TRACE_glDeleteProgram:{auto const a0 = r.template arg<GLuint>();table.glDeleteProgram(a0);r.finishCall();break;}
+case TRACE_glUniformMatrix4x3dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix4x3dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVideoCaptureStreamivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetVideoCaptureStreamivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glProgramUniform4uiEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMakeImageHandleNonResidentARB:{auto const a0 = r.template arg<GLuint64>();table.glMakeImageHandleNonResidentARB(a0);r.finishCall();break;}
+case TRACE_glSecondaryColor3dEXT:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glSecondaryColor3dEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDeleteQueries:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteQueries(a0,a1);r.finishCall();break;}
+case TRACE_glNormalP3uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glNormalP3uiv(a0,a1);r.finishCall();break;}
+case TRACE_glRasterPos2d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glRasterPos2d(a0,a1);r.finishCall();break;}
+case TRACE_glInitNames:{table.glInitNames();r.finishCall();break;}
+case TRACE_glBinormal3fvEXT:{auto const a0 = r.template arg<const GLfloat*>();table.glBinormal3fvEXT(a0);r.finishCall();break;}
+case TRACE_glColor3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glColor3dv(a0);r.finishCall();break;}
+case TRACE_glVertexArrayVertexAttribDivisorEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexArrayVertexAttribDivisorEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glArrayElementEXT:{auto const a0 = r.template arg<GLint>();table.glArrayElementEXT(a0);r.finishCall();break;}
+case TRACE_glProgramParameter4dNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glProgramParameter4dNV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glIndexxOES:{auto const a0 = r.template arg<GLfixed>();table.glIndexxOES(a0);r.finishCall();break;}
+case TRACE_glUniform3uivEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform3uivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPopGroupMarkerEXT:{table.glPopGroupMarkerEXT();r.finishCall();break;}
+case TRACE_glClearNamedFramebufferuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const GLuint*>();table.glClearNamedFramebufferuiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSetLocalConstantEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();table.glSetLocalConstantEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64EXT>();table.glProgramUniform1ui64NV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor4hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glColor4hvNV(a0);r.finishCall();break;}
+case TRACE_glGetVertexAttribfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetVertexAttribfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDispatchCompute:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glDispatchCompute(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetActiveAttrib:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLint*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLchar*>();table.glGetActiveAttrib(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glFragmentColorMaterialSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glFragmentColorMaterialSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glTexSubImage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const GLvoid*>();table.glTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glGetnMinmaxARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetnMinmaxARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glLogicOp:{auto const a0 = r.template arg<GLenum>();table.glLogicOp(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x4fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix3x4fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glWindowPos4iMESA:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glWindowPos4iMESA(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPixelTransferf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPixelTransferf(a0,a1);r.finishCall();break;}
+case TRACE_glGetTextureParameterIuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetTextureParameterIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1xOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glMultiTexCoord1xOES(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix4dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetnUniformiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint*>();table.glGetnUniformiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferTexture1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTexture1DEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexPointervINTEL:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void**>();table.glVertexPointervINTEL(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureParameterIiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTextureParameterIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSeparableFilterEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();auto const a4 = r.template arg<void*>();auto const a5 = r.template arg<void*>();table.glGetSeparableFilterEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMultiTexCoord3iARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glMultiTexCoord3iARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRasterPos4xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glRasterPos4xvOES(a0);r.finishCall();break;}
+case TRACE_glDrawTransformFeedbackStream:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glDrawTransformFeedbackStream(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex3hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glVertex3hvNV(a0);r.finishCall();break;}
+case TRACE_glVertexArrayMultiTexCoordOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLintptr>();table.glVertexArrayMultiTexCoordOffsetEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glProvokingVertex:{auto const a0 = r.template arg<GLenum>();table.glProvokingVertex(a0);r.finishCall();break;}
+case TRACE_glAccumxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glAccumxOES(a0,a1);r.finishCall();break;}
+case TRACE_glShaderBinary:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();table.glShaderBinary(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetMultiTexGenivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetMultiTexGenivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPointParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glPointParameterxvOES(a0,a1);r.finishCall();break;}
+case TRACE_glCreateStatesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateStatesNV(a0,a1);r.finishCall();break;}
+case TRACE_glClearDepthdNV:{auto const a0 = r.template arg<GLdouble>();table.glClearDepthdNV(a0);r.finishCall();break;}
+case TRACE_glClearColorIuiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glClearColorIuiEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBindMultiTextureEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glBindMultiTextureEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexGeniv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTexGeniv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawElements:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLvoid*>();table.glDrawElements(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform4iv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDisableVertexArrayEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glDisableVertexArrayEXT(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform3ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();auto const a4 = r.template arg<GLuint64EXT>();table.glProgramUniform3ui64NV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glClientActiveTexture:{auto const a0 = r.template arg<GLenum>();table.glClientActiveTexture(a0);r.finishCall();break;}
+case TRACE_glMultiTexParameterIivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glMultiTexParameterIivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform1i64ARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64>();table.glUniform1i64ARB(a0,a1);r.finishCall();break;}
+case TRACE_glUniform1iv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform1iv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMulticastBarrierNV:{table.glMulticastBarrierNV();r.finishCall();break;}
+case TRACE_glVertexAttribArrayObjectATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();table.glVertexAttribArrayObjectATI(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glUniform2iARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glUniform2iARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawArraysInstanced:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glDrawArraysInstanced(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib2sNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glVertexAttrib2sNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexBufferEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glTexBufferEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexStream2fATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glVertexStream2fATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDebugMessageCallbackAMD:{auto const a0 = r.template arg<GLDEBUGPROCAMD>();auto const a1 = r.template arg<void*>();table.glDebugMessageCallbackAMD(a0,a1);r.finishCall();break;}
+case TRACE_glSamplerParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glSamplerParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttrib4uiv(a0,a1);r.finishCall();break;}
+case TRACE_glEndQueryIndexed:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glEndQueryIndexed(a0,a1);r.finishCall();break;}
+case TRACE_glNormalStream3sATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glNormalStream3sATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramParameteriARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glProgramParameteriARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexEnvxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glTexEnvxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform1iv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDisableVertexAttribAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glDisableVertexAttribAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glBindRenderbuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindRenderbuffer(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexSubImage3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLenum>();auto const a11 = r.template arg<const void*>();table.glMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glIsProgram:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsProgram(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glMultiDrawElementsIndirectAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glMultiDrawElementsIndirectAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetProgramInfoLog:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLchar*>();table.glGetProgramInfoLog(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetLocalConstantBooleanvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean*>();table.glGetLocalConstantBooleanvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPixelTransformParameteriEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glPixelTransformParameteriEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4bOES:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();auto const a3 = r.template arg<GLbyte>();table.glTexCoord4bOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib4fv(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x3dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix2x3dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramEnvParametersI4uivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramEnvParametersI4uivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexCoord3xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glTexCoord3xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLoadTransposeMatrixfARB:{auto const a0 = r.template arg<const GLfloat*>();table.glLoadTransposeMatrixfARB(a0);r.finishCall();break;}
+case TRACE_glImageTransformParameteriHP:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glImageTransformParameteriHP(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4xOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();auto const a4 = r.template arg<GLfixed>();table.glMultiTexCoord4xOES(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribs3fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glVertexAttribs3fvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib2fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib2fv(a0,a1);r.finishCall();break;}
+case TRACE_glUniform3ui64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();table.glUniform3ui64NV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCombinerParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glCombinerParameterfvNV(a0,a1);r.finishCall();break;}
+case TRACE_glFragmentMaterialiSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glFragmentMaterialiSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetBooleani_v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLboolean*>();table.glGetBooleani_v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramResourceIndex:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLchar*>();auto const result = table.glGetProgramResourceIndex(a0,a1,a2);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glBeginConditionalRenderNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glBeginConditionalRenderNV(a0,a1);r.finishCall();break;}
+case TRACE_glDisableClientState:{auto const a0 = r.template arg<GLenum>();table.glDisableClientState(a0);r.finishCall();break;}
+case TRACE_glPathFogGenNV:{auto const a0 = r.template arg<GLenum>();table.glPathFogGenNV(a0);r.finishCall();break;}
+case TRACE_glStencilThenCoverFillPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();table.glStencilThenCoverFillPathNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexArrayIndexOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLintptr>();table.glVertexArrayIndexOffsetEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramBufferParametersIuivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLuint*>();table.glProgramBufferParametersIuivNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPixelTransformParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glPixelTransformParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDisableClientStateiEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glDisableClientStateiEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTexBufferARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glTexBufferARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetLocalConstantIntegervEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetLocalConstantIntegervEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor4uiv:{auto const a0 = r.template arg<const GLuint*>();table.glColor4uiv(a0);r.finishCall();break;}
+case TRACE_glProgramUniform3i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glProgramUniform3i(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiDrawElementsIndirectBindlessCountNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();table.glMultiDrawElementsIndirectBindlessCountNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetBufferPointervARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetBufferPointervARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexParameterIuivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLuint*>();table.glMultiTexParameterIuivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEvalMesh2:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glEvalMesh2(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glEvalMesh1:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glEvalMesh1(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform3f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glProgramUniform3f(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glStencilThenCoverFillPathInstancedNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const GLfloat*>();table.glStencilThenCoverFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glProgramUniform3d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glProgramUniform3d(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMapVertexAttrib1dAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<const GLdouble*>();table.glMapVertexAttrib1dAPPLE(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glEvalCoord2fv:{auto const a0 = r.template arg<const GLfloat*>();table.glEvalCoord2fv(a0);r.finishCall();break;}
+case TRACE_glGetUniformivARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint*>();table.glGetUniformivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLoadTransposeMatrixd:{auto const a0 = r.template arg<const GLdouble*>();table.glLoadTransposeMatrixd(a0);r.finishCall();break;}
+case TRACE_glLoadTransposeMatrixf:{auto const a0 = r.template arg<const GLfloat*>();table.glLoadTransposeMatrixf(a0);r.finishCall();break;}
+case TRACE_glGetPointervEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<void**>();table.glGetPointervEXT(a0,a1);r.finishCall();break;}
+case TRACE_glSignalVkSemaphoreNV:{auto const a0 = r.template arg<GLuint64>();table.glSignalVkSemaphoreNV(a0);r.finishCall();break;}
+case TRACE_glEndConditionalRenderNV:{table.glEndConditionalRenderNV();r.finishCall();break;}
+case TRACE_glTexCoord2fNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();table.glTexCoord2fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glUniform3i64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64*>();table.glUniform3i64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform2uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glProgramUniform2uiEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI1ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexAttribI1ui(a0,a1);r.finishCall();break;}
+case TRACE_glProgramNamedParameter4dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramNamedParameter4dvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCompileCommandListNV:{auto const a0 = r.template arg<GLuint>();table.glCompileCommandListNV(a0);r.finishCall();break;}
+case TRACE_glGetRenderbufferParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetRenderbufferParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnPolygonStipple:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLubyte*>();table.glGetnPolygonStipple(a0,a1);r.finishCall();break;}
+case TRACE_glIsBufferResidentNV:{auto const a0 = r.template arg<GLenum>();auto const result = table.glIsBufferResidentNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glSecondaryColor3ubvEXT:{auto const a0 = r.template arg<const GLubyte*>();table.glSecondaryColor3ubvEXT(a0);r.finishCall();break;}
+case TRACE_glGetNamedRenderbufferParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetNamedRenderbufferParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedFramebufferSampleLocationsfvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glNamedFramebufferSampleLocationsfvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexGendvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLdouble*>();table.glMultiTexGendvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexArrayRangeNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const void*>();table.glVertexArrayRangeNV(a0,a1);r.finishCall();break;}
+case TRACE_glIsTextureHandleResidentNV:{auto const a0 = r.template arg<GLuint64>();auto const result = table.glIsTextureHandleResidentNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetProgramEnvParameterdvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble*>();table.glGetProgramEnvParameterdvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsNamedStringARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glIsNamedStringARB(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glSecondaryColorFormatNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();table.glSecondaryColorFormatNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4ubvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttrib4ubvNV(a0,a1);r.finishCall();break;}
+case TRACE_glTagSampleBufferSGIX:{table.glTagSampleBufferSGIX();r.finishCall();break;}
+case TRACE_glVDPAUUnregisterSurfaceNV:{auto const a0 = r.template arg<GLvdpauSurfaceNV>();table.glVDPAUUnregisterSurfaceNV(a0);r.finishCall();break;}
+case TRACE_glGetPerfQueryIdByNameINTEL:{auto const a0 = r.template arg<GLchar*>();auto const a1 = r.template arg<GLuint*>();table.glGetPerfQueryIdByNameINTEL(a0,a1);r.finishCall();break;}
+case TRACE_glGetInteger64v:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint64*>();table.glGetInteger64v(a0,a1);r.finishCall();break;}
+case TRACE_glClipPlane:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glClipPlane(a0,a1);r.finishCall();break;}
+case TRACE_glColor4ubVertex3fSUN:{auto const a0 = r.template arg<GLubyte>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();table.glColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glIndexub:{auto const a0 = r.template arg<GLubyte>();table.glIndexub(a0);r.finishCall();break;}
+case TRACE_glGetProgramEnvParameterfvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat*>();table.glGetProgramEnvParameterfvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4usvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVertexAttrib4usvARB(a0,a1);r.finishCall();break;}
+case TRACE_glNamedFramebufferRenderbuffer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glNamedFramebufferRenderbuffer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x4dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix3x4dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTestFenceAPPLE:{auto const a0 = r.template arg<GLuint>();auto const result = table.glTestFenceAPPLE(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glVertexAttrib4Niv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttrib4Niv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribL2i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint64EXT*>();table.glVertexAttribL2i64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glColorP4uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glColorP4uiv(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix2x3fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix2x3fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCallCommandListNV:{auto const a0 = r.template arg<GLuint>();table.glCallCommandListNV(a0);r.finishCall();break;}
+case TRACE_glClearBufferiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const GLint*>();table.glClearBufferiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedStringARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const GLchar*>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<const GLchar*>();table.glNamedStringARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMatrixMult3x2fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixMult3x2fNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedProgramStringEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<void*>();table.glGetNamedProgramStringEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetnHistogramARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetnHistogramARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetTextureLevelParameterfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLfloat*>();table.glGetTextureLevelParameterfv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord1fv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord1fv(a0,a1);r.finishCall();break;}
+case TRACE_glBitmapxOES:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();auto const a4 = r.template arg<GLfixed>();auto const a5 = r.template arg<GLfixed>();auto const a6 = r.template arg<const GLubyte*>();table.glBitmapxOES(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetSamplerParameterIuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetSamplerParameterIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordP3ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glTexCoordP3ui(a0,a1);r.finishCall();break;}
+case TRACE_glTextureSubImage1D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();table.glTextureSubImage1D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribLPointerEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glVertexAttribLPointerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glFogCoordPointerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void*>();table.glFogCoordPointerEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glWindowPos3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribs2svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLshort*>();table.glVertexAttribs2svNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureImage3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const void*>();table.glTextureImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glWindowPos3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glWindowPos3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glWindowPos3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glWindowPos3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsEnabledIndexedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const result = table.glIsEnabledIndexedEXT(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetNamedProgramivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetNamedProgramivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertex3xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glVertex3xvOES(a0);r.finishCall();break;}
+case TRACE_glColor3us:{auto const a0 = r.template arg<GLushort>();auto const a1 = r.template arg<GLushort>();auto const a2 = r.template arg<GLushort>();table.glColor3us(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginPerfMonitorAMD:{auto const a0 = r.template arg<GLuint>();table.glBeginPerfMonitorAMD(a0);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x3dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix4x3dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetNamedProgramLocalParameterIuivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint*>();table.glGetNamedProgramLocalParameterIuivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glReadnPixels:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<void*>();table.glReadnPixels(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glMultiTexCoord4f:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glMultiTexCoord4f(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glColor3ub:{auto const a0 = r.template arg<GLubyte>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();table.glColor3ub(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4d:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glMultiTexCoord4d(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribL3ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();table.glVertexAttribL3ui64NV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor3ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glColor3ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform4fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform4fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib2sARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glVertexAttrib2sARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4i:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glMultiTexCoord4i(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glCheckFramebufferStatusEXT:{auto const a0 = r.template arg<GLenum>();auto const result = table.glCheckFramebufferStatusEXT(a0);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glGetnMapivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint*>();table.glGetnMapivARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord1ivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord1ivARB(a0,a1);r.finishCall();break;}
+case TRACE_glDisableVertexAttribArrayARB:{auto const a0 = r.template arg<GLuint>();table.glDisableVertexAttribArrayARB(a0);r.finishCall();break;}
+case TRACE_glGetPolygonStipple:{auto const a0 = r.template arg<GLubyte*>();table.glGetPolygonStipple(a0);r.finishCall();break;}
+case TRACE_glVertexAttribI4ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glVertexAttribI4ui(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetPathDashArrayNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat*>();table.glGetPathDashArrayNV(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexRenderbufferEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glMultiTexRenderbufferEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyTextureSubImage1D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();table.glCopyTextureSubImage1D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glDeleteOcclusionQueriesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteOcclusionQueriesNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertex4hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glVertex4hvNV(a0);r.finishCall();break;}
+case TRACE_glGetnTexImage:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetnTexImage(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramLocalParameter4dARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();auto const a5 = r.template arg<GLdouble>();table.glProgramLocalParameter4dARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBlendEquation:{auto const a0 = r.template arg<GLenum>();table.glBlendEquation(a0);r.finishCall();break;}
+case TRACE_glUnlockArraysEXT:{table.glUnlockArraysEXT();r.finishCall();break;}
+case TRACE_glGetQueryObjectui64vEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64*>();table.glGetQueryObjectui64vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribI4uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI4uivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glUniform1i64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64EXT*>();table.glUniform1i64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3dv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord3dv(a0,a1);r.finishCall();break;}
+case TRACE_glColor4sv:{auto const a0 = r.template arg<const GLshort*>();table.glColor4sv(a0);r.finishCall();break;}
+case TRACE_glVertexStream4ivATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glVertexStream4ivATI(a0,a1);r.finishCall();break;}
+case TRACE_glPopClientAttrib:{table.glPopClientAttrib();r.finishCall();break;}
+case TRACE_glClearBufferData:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<const void*>();table.glClearBufferData(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetProgramivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetProgramivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginTransformFeedback:{auto const a0 = r.template arg<GLenum>();table.glBeginTransformFeedback(a0);r.finishCall();break;}
+case TRACE_glFinishObjectAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glFinishObjectAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glGetMinmaxParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetMinmaxParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor3iv:{auto const a0 = r.template arg<const GLint*>();table.glColor3iv(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3sv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib3sv(a0,a1);r.finishCall();break;}
+case TRACE_glCompressedTexImage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<const GLvoid*>();table.glCompressedTexImage1D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glDeleteTransformFeedbacks:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteTransformFeedbacks(a0,a1);r.finishCall();break;}
+case TRACE_glGetVideoi64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint64EXT*>();table.glGetVideoi64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawRangeElementsBaseVertex:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();auto const a6 = r.template arg<GLint>();table.glDrawRangeElementsBaseVertex(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glUniform4i64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint64*>();table.glUniform4i64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureStorage3DMultisampleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLboolean>();table.glTextureStorage3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetTexParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetTexParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64EXT*>();table.glProgramUniformui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCompressedMultiTexImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<const void*>();table.glCompressedMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glProgramUniform2ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform2ivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPushGroupMarkerEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLchar*>();table.glPushGroupMarkerEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib1dv(a0,a1);r.finishCall();break;}
+case TRACE_glMatrixLoadIdentityEXT:{auto const a0 = r.template arg<GLenum>();table.glMatrixLoadIdentityEXT(a0);r.finishCall();break;}
+case TRACE_glMultTransposeMatrixxOES:{auto const a0 = r.template arg<const GLfixed*>();table.glMultTransposeMatrixxOES(a0);r.finishCall();break;}
+case TRACE_glGetPixelMapxv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfixed*>();table.glGetPixelMapxv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFramebufferSampleLocationsfvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glFramebufferSampleLocationsfvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetLightiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetLightiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendFuncSeparatei:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();table.glBlendFuncSeparatei(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glAcquireKeyedMutexWin32EXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLuint>();auto const result = table.glAcquireKeyedMutexWin32EXT(a0,a1,a2);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetBooleanIndexedvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLboolean*>();table.glGetBooleanIndexedvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramSubroutineParameteruivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint*>();table.glGetProgramSubroutineParameteruivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform2ui:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glUniform2ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glApplyFramebufferAttachmentCMAAINTEL:{table.glApplyFramebufferAttachmentCMAAINTEL();r.finishCall();break;}
+case TRACE_glWindowPos2fv:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos2fv(a0);r.finishCall();break;}
+case TRACE_glWaitVkSemaphoreNV:{auto const a0 = r.template arg<GLuint64>();table.glWaitVkSemaphoreNV(a0);r.finishCall();break;}
+case TRACE_glDisablei:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glDisablei(a0,a1);r.finishCall();break;}
+case TRACE_glSelectPerfMonitorCountersAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLuint*>();table.glSelectPerfMonitorCountersAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetVertexAttribLi64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint64EXT*>();table.glGetVertexAttribLi64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendFuncSeparateiARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();table.glBlendFuncSeparateiARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glWeightuivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLuint*>();table.glWeightuivARB(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos2iARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glWindowPos2iARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetProgramLocalParameterdvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLdouble*>();table.glGetProgramLocalParameterdvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64*>();table.glGetUniformui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColor3us:{auto const a0 = r.template arg<GLushort>();auto const a1 = r.template arg<GLushort>();auto const a2 = r.template arg<GLushort>();table.glSecondaryColor3us(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSynciv:{auto const a0 = r.template arg<GLsync>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLint*>();table.glGetSynciv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMakeImageHandleResidentARB:{auto const a0 = r.template arg<GLuint64>();auto const a1 = r.template arg<GLenum>();table.glMakeImageHandleResidentARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetProgramNamedParameterfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<GLfloat*>();table.glGetProgramNamedParameterfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureStorage3D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glTextureStorage3D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttrib4svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib4svNV(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform2i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glProgramUniform2i(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glListDrawCommandsStatesClientNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const void**>();auto const a3 = r.template arg<const GLsizei*>();auto const a4 = r.template arg<const GLuint*>();auto const a5 = r.template arg<const GLuint*>();auto const a6 = r.template arg<GLuint>();table.glListDrawCommandsStatesClientNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glProgramLocalParametersI4uivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramLocalParametersI4uivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBeginTransformFeedbackNV:{auto const a0 = r.template arg<GLenum>();table.glBeginTransformFeedbackNV(a0);r.finishCall();break;}
+case TRACE_glGetProgramBinary:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLenum*>();auto const a4 = r.template arg<void*>();table.glGetProgramBinary(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBinormal3iEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glBinormal3iEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEvalPoint1:{auto const a0 = r.template arg<GLint>();table.glEvalPoint1(a0);r.finishCall();break;}
+case TRACE_glEvalPoint2:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glEvalPoint2(a0,a1);r.finishCall();break;}
+case TRACE_glPauseTransformFeedback:{table.glPauseTransformFeedback();r.finishCall();break;}
+case TRACE_glWindowPos2sMESA:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();table.glWindowPos2sMESA(a0,a1);r.finishCall();break;}
+case TRACE_glGlobalAlphaFactorbSUN:{auto const a0 = r.template arg<GLbyte>();table.glGlobalAlphaFactorbSUN(a0);r.finishCall();break;}
+case TRACE_glCreateTransformFeedbacks:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateTransformFeedbacks(a0,a1);r.finishCall();break;}
+case TRACE_glTexturePageCommitmentEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLboolean>();table.glTexturePageCommitmentEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glTransformFeedbackVaryingsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();auto const a3 = r.template arg<GLenum>();table.glTransformFeedbackVaryingsNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexSubImage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const GLvoid*>();table.glTexSubImage1D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glConvolutionParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glConvolutionParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlitFramebufferEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLbitfield>();auto const a9 = r.template arg<GLenum>();table.glBlitFramebufferEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glUniformMatrix4fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix4fvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramEnvParameter4dvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLdouble*>();table.glProgramEnvParameter4dvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureStorageMem2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint64>();table.glTextureStorageMem2DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glVertexAttribP3uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLuint*>();table.glVertexAttribP3uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFogCoordFormatNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();table.glFogCoordFormatNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetMultiTexLevelParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint*>();table.glGetMultiTexLevelParameterivEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glIsOcclusionQueryNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsOcclusionQueryNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glCompressedTexImage2DARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<const void*>();table.glCompressedTexImage2DARB(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetProgramEnvParameterIuivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint*>();table.glGetProgramEnvParameterIuivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4sv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib4sv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4fvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib4fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glLoadName:{auto const a0 = r.template arg<GLuint>();table.glLoadName(a0);r.finishCall();break;}
+case TRACE_glBindVertexShaderEXT:{auto const a0 = r.template arg<GLuint>();table.glBindVertexShaderEXT(a0);r.finishCall();break;}
+case TRACE_glGetNamedProgramLocalParameterIivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint*>();table.glGetNamedProgramLocalParameterIivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform3uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glProgramUniform3uiEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x2dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix4x2dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexCoord1hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glTexCoord1hvNV(a0);r.finishCall();break;}
+case TRACE_glLoadMatrixd:{auto const a0 = r.template arg<const GLdouble*>();table.glLoadMatrixd(a0);r.finishCall();break;}
+case TRACE_glTexParameterfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glTexParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVariantdvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVariantdvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCullParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glCullParameterfvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glUniform3dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glUniform3dv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform3fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform3fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIsBufferARB:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsBufferARB(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glMultiTexCoord1bOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLbyte>();table.glMultiTexCoord1bOES(a0,a1);r.finishCall();break;}
+case TRACE_glFogCoordhNV:{auto const a0 = r.template arg<GLhalfNV>();table.glFogCoordhNV(a0);r.finishCall();break;}
+case TRACE_glFramebufferSampleLocationsfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glFramebufferSampleLocationsfvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGenSymbolsEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const result = table.glGenSymbolsEXT(a0,a1,a2,a3);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGetConvolutionFilter:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLvoid*>();table.glGetConvolutionFilter(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform1fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform1fvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetNextPerfQueryIdINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint*>();table.glGetNextPerfQueryIdINTEL(a0,a1);r.finishCall();break;}
+case TRACE_glCompressedTexImage1DARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<const void*>();table.glCompressedTexImage1DARB(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glBindSamplers:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glBindSamplers(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramEnvParameterIivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint*>();table.glGetProgramEnvParameterIivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetQueryObjectui64v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64*>();table.glGetQueryObjectui64v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribL4ui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint64EXT*>();table.glVertexAttribL4ui64vNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetVideoivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVideoivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTextureImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetTextureImage(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramUniform1fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramUniform1fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniformMatrix4fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix4fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColorMask:{auto const a0 = r.template arg<GLboolean>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLboolean>();table.glColorMask(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBeginFragmentShaderATI:{table.glBeginFragmentShaderATI();r.finishCall();break;}
+case TRACE_glMultiDrawArraysEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();auto const a2 = r.template arg<const GLsizei*>();auto const a3 = r.template arg<GLsizei>();table.glMultiDrawArraysEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGenNamesAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint*>();table.glGenNamesAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPathParameteriNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glPathParameteriNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCreateCommandListsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateCommandListsNV(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteProgramPipelines:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteProgramPipelines(a0,a1);r.finishCall();break;}
+case TRACE_glCopyColorSubTableEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glCopyColorSubTableEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVariantsvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVariantsvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glGenProgramPipelines:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenProgramPipelines(a0,a1);r.finishCall();break;}
+case TRACE_glVertexArrayEdgeFlagOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLintptr>();table.glVertexArrayEdgeFlagOffsetEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWindowPos2s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();table.glWindowPos2s(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3iEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glSecondaryColor3iEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos2i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glWindowPos2i(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos2f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glWindowPos2f(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos2d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glWindowPos2d(a0,a1);r.finishCall();break;}
+case TRACE_glUniform4uivEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform4uivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glOrthoxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();auto const a4 = r.template arg<GLfixed>();auto const a5 = r.template arg<GLfixed>();table.glOrthoxOES(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniformSubroutinesuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniformSubroutinesuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRectdv:{auto const a0 = r.template arg<const GLdouble*>();auto const a1 = r.template arg<const GLdouble*>();table.glRectdv(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform1i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64EXT*>();table.glProgramUniform1i64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI4uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glVertexAttribI4uiEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glSecondaryColor3ubEXT:{auto const a0 = r.template arg<GLubyte>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();table.glSecondaryColor3ubEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedMultiTexSubImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<const void*>();table.glCompressedMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glMultiTexGendEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLdouble>();table.glMultiTexGendEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColorP3uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glColorP3uiv(a0,a1);r.finishCall();break;}
+case TRACE_glFogCoordfv:{auto const a0 = r.template arg<const GLfloat*>();table.glFogCoordfv(a0);r.finishCall();break;}
+case TRACE_glCompileShader:{auto const a0 = r.template arg<GLuint>();table.glCompileShader(a0);r.finishCall();break;}
+case TRACE_glTexCoord2hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();table.glTexCoord2hNV(a0,a1);r.finishCall();break;}
+case TRACE_glUniform1uivEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform1uivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixLoadTransposedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMatrixLoadTransposedEXT(a0,a1);r.finishCall();break;}
+case TRACE_glIndexfv:{auto const a0 = r.template arg<const GLfloat*>();table.glIndexfv(a0);r.finishCall();break;}
+case TRACE_glGetCompressedTextureImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<void*>();table.glGetCompressedTextureImage(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetUniformuivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint*>();table.glGetUniformuivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnPixelMapfvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLfloat*>();table.glGetnPixelMapfvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFramebufferTextureEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();table.glFramebufferTextureEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiDrawElementsIndirectCount:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glMultiDrawElementsIndirectCount(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttribIPointer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glVertexAttribIPointer(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMultiTexCoordP3ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();table.glMultiTexCoordP3ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEvaluateDepthValuesARB:{table.glEvaluateDepthValuesARB();r.finishCall();break;}
+case TRACE_glGetNamedBufferParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetNamedBufferParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetNamedProgramLocalParameterfvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLfloat*>();table.glGetNamedProgramLocalParameterfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glColor4fNormal3fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();table.glColor4fNormal3fVertex3fvSUN(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSeparableFilter2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const void*>();auto const a7 = r.template arg<const void*>();table.glSeparableFilter2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glTexParameterxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glTexParameterxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClearAccumxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glClearAccumxOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glInvalidateFramebuffer:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLenum*>();table.glInvalidateFramebuffer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWeightubvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLubyte*>();table.glWeightubvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();table.glVertexAttrib1d(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();table.glVertexAttrib1f(a0,a1);r.finishCall();break;}
+case TRACE_glVertex4fv:{auto const a0 = r.template arg<const GLfloat*>();table.glVertex4fv(a0);r.finishCall();break;}
+case TRACE_glClearNamedFramebufferfi:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLint>();table.glClearNamedFramebufferfi(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetQueryBufferObjectuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLintptr>();table.glGetQueryBufferObjectuiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glClearNamedFramebufferfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<const GLfloat*>();table.glClearNamedFramebufferfv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEndVertexShaderEXT:{table.glEndVertexShaderEXT();r.finishCall();break;}
+case TRACE_glVertexAttrib1s:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();table.glVertexAttrib1s(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord4dvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord4dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord1sv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord1sv(a0,a1);r.finishCall();break;}
+case TRACE_glUniform1ui64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64EXT*>();table.glUniform1ui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetClipPlanefOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetClipPlanefOES(a0,a1);r.finishCall();break;}
+case TRACE_glRasterPos2s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();table.glRasterPos2s(a0,a1);r.finishCall();break;}
+case TRACE_glWeightivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLint*>();table.glWeightivARB(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord4hvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLhalfNV*>();table.glMultiTexCoord4hvNV(a0,a1);r.finishCall();break;}
+case TRACE_glNormal3hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glNormal3hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSeparableFilter:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLvoid*>();auto const a4 = r.template arg<GLvoid*>();auto const a5 = r.template arg<GLvoid*>();table.glGetSeparableFilter(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetPathTexGenivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetPathTexGenivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor4bv:{auto const a0 = r.template arg<const GLbyte*>();table.glColor4bv(a0);r.finishCall();break;}
+case TRACE_glRasterPos2f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glRasterPos2f(a0,a1);r.finishCall();break;}
+case TRACE_glNamedBufferPageCommitmentARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLboolean>();table.glNamedBufferPageCommitmentARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glLoadIdentity:{table.glLoadIdentity();r.finishCall();break;}
+case TRACE_glRasterPos2i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glRasterPos2i(a0,a1);r.finishCall();break;}
+case TRACE_glRasterPos4iv:{auto const a0 = r.template arg<const GLint*>();table.glRasterPos4iv(a0);r.finishCall();break;}
+case TRACE_glMultiTexCoord2fvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord2fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glUniformMatrix4x3fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix4x3fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glClearBufferfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const GLfloat*>();table.glClearBufferfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4hNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();auto const a4 = r.template arg<GLhalfNV>();table.glMultiTexCoord4hNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTextureBarrier:{table.glTextureBarrier();r.finishCall();break;}
+case TRACE_glReplacementCodeuivSUN:{auto const a0 = r.template arg<const GLuint*>();table.glReplacementCodeuivSUN(a0);r.finishCall();break;}
+case TRACE_glDeleteAsyncMarkersSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();table.glDeleteAsyncMarkersSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glTexCoord2bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glTexCoord2bvOES(a0);r.finishCall();break;}
+case TRACE_glEvalCoord2xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glEvalCoord2xOES(a0,a1);r.finishCall();break;}
+case TRACE_glGetSharpenTexFuncSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetSharpenTexFuncSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniformHandleui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64*>();table.glProgramUniformHandleui64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIglooInterfaceSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();table.glIglooInterfaceSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos2dvARB:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos2dvARB(a0);r.finishCall();break;}
+case TRACE_glClearBufferfi:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLint>();table.glClearBufferfi(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDrawArraysIndirect:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();table.glDrawArraysIndirect(a0,a1);r.finishCall();break;}
+case TRACE_glGenVertexArrays:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenVertexArrays(a0,a1);r.finishCall();break;}
+case TRACE_glGetTransformFeedbacki64_v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint64*>();table.glGetTransformFeedbacki64_v(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEnableVertexArrayAttrib:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glEnableVertexArrayAttrib(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x2dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix3x2dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexStream4fATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glVertexStream4fATI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexBindingDivisor:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexBindingDivisor(a0,a1);r.finishCall();break;}
+case TRACE_glGetSamplerParameterIiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetSamplerParameterIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetCoverageModulationTableNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLfloat*>();table.glGetCoverageModulationTableNV(a0,a1);r.finishCall();break;}
+case TRACE_glDepthRangedNV:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glDepthRangedNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib3f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glVertexAttrib3f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiDrawRangeElementArrayAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLint*>();auto const a4 = r.template arg<const GLsizei*>();auto const a5 = r.template arg<GLsizei>();table.glMultiDrawRangeElementArrayAPPLE(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexAttribFormatNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLsizei>();table.glVertexAttribFormatNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetQueryBufferObjecti64v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLintptr>();table.glGetQueryBufferObjecti64v(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribdv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLdouble*>();table.glGetVertexAttribdv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformi64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64*>();table.glGetUniformi64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glAreTexturesResidentEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();auto const a2 = r.template arg<GLboolean*>();auto const result = table.glAreTexturesResidentEXT(a0,a1,a2);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetHandleARB:{auto const a0 = r.template arg<GLenum>();auto const result = table.glGetHandleARB(a0);r.finishCall();r.template result<GLhandleARB>(result);break;}
+case TRACE_glVideoCaptureStreamParameterdvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLdouble*>();table.glVideoCaptureStreamParameterdvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMapParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glMapParameterivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsVertexArray:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsVertexArray(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glSecondaryColor3sEXT:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glSecondaryColor3sEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTexParameterIivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTexParameterIivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFrameTerminatorGREMEDY:{table.glFrameTerminatorGREMEDY();r.finishCall();break;}
+case TRACE_glBlendBarrierKHR:{table.glBlendBarrierKHR();r.finishCall();break;}
+case TRACE_glVertexAttrib4NubARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLubyte>();table.glVertexAttrib4NubARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glPrimitiveRestartNV:{table.glPrimitiveRestartNV();r.finishCall();break;}
+case TRACE_glVertexAttribL1ui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint64EXT*>();table.glVertexAttribL1ui64vARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribI4ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI4ivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribs4svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLshort*>();table.glVertexAttribs4svNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform1ui:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();table.glUniform1ui(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib2fvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib2fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribI4svEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttribI4svEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTextureImage3DMultisampleCoverageNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLboolean>();table.glTextureImage3DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glMemoryBarrier:{auto const a0 = r.template arg<GLbitfield>();table.glMemoryBarrier(a0);r.finishCall();break;}
+case TRACE_glGetVariantArrayObjectfvATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetVariantArrayObjectfvATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4fColor4fNormal3fVertex4fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();auto const a2 = r.template arg<const GLfloat*>();auto const a3 = r.template arg<const GLfloat*>();table.glTexCoord4fColor4fNormal3fVertex4fvSUN(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIsProgramARB:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsProgramARB(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glBindImageTextureEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLint>();table.glBindImageTextureEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetFragDataLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetFragDataLocation(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glMultiTexCoord1svARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord1svARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetMapxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetMapxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureStorage2DMultisampleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();table.glTextureStorage2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetMaterialfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetMaterialfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4NbvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVertexAttrib4NbvARB(a0,a1);r.finishCall();break;}
+case TRACE_glPixelMapuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glPixelMapuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColorPointerEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glColorPointerEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glEnableClientStateiEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glEnableClientStateiEXT(a0,a1);r.finishCall();break;}
+case TRACE_glClearTexSubImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const void*>();table.glClearTexSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glEvalCoord1xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glEvalCoord1xvOES(a0);r.finishCall();break;}
+case TRACE_glDetachObjectARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLhandleARB>();table.glDetachObjectARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetTextureParameterIiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTextureParameterIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVariantusvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVariantusvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glCompressedTextureImage3DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<const void*>();table.glCompressedTextureImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glMultiTexCoord1dARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();table.glMultiTexCoord1dARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexArrayIntegeri_vEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetVertexArrayIntegeri_vEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI4ubv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLubyte*>();table.glVertexAttribI4ubv(a0,a1);r.finishCall();break;}
+case TRACE_glPixelTexGenParameterfSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();table.glPixelTexGenParameterfSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x2dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix4x2dv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform3fARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glUniform3fARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIsShader:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsShader(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glConvolutionParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glConvolutionParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyMultiTexSubImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();table.glCopyMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glEnableVertexAttribArrayARB:{auto const a0 = r.template arg<GLuint>();table.glEnableVertexAttribArrayARB(a0);r.finishCall();break;}
+case TRACE_glMulticastCopyBufferSubDataNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLintptr>();auto const a5 = r.template arg<GLintptr>();auto const a6 = r.template arg<GLsizeiptr>();table.glMulticastCopyBufferSubDataNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glEnable:{auto const a0 = r.template arg<GLenum>();table.glEnable(a0);r.finishCall();break;}
+case TRACE_glGetActiveUniformsiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint*>();table.glGetActiveUniformsiv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetVertexAttribivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexAttribivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord4hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glTexCoord4hvNV(a0);r.finishCall();break;}
+case TRACE_glUseProgramObjectARB:{auto const a0 = r.template arg<GLhandleARB>();table.glUseProgramObjectARB(a0);r.finishCall();break;}
+case TRACE_glGetAttribLocation:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetAttribLocation(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glVertexAttrib4dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib4dv(a0,a1);r.finishCall();break;}
+case TRACE_glGetTextureParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTextureParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedBufferStorageMemEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint64>();table.glNamedBufferStorageMemEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPathSubCoordsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<const void*>();table.glPathSubCoordsNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMatrixIndexusvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLushort*>();table.glMatrixIndexusvARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetVideouivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetVideouivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVideoCaptureivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVideoCaptureivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform3ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();table.glProgramUniform3ui(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib3svARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib3svARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedBufferParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetNamedBufferParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMatrixScaledEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glMatrixScaledEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x3fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix2x3fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetFragmentLightivSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetFragmentLightivSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetStringi:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const result = table.glGetStringi(a0,a1);r.finishCall();r.template result<const GLubyte*>(result);break;}
+case TRACE_glWindowPos2svARB:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos2svARB(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib2svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib2svNV(a0,a1);r.finishCall();break;}
+case TRACE_glWindowPos2ivARB:{auto const a0 = r.template arg<const GLint*>();table.glWindowPos2ivARB(a0);r.finishCall();break;}
+case TRACE_glGetVertexAttribPointervNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetVertexAttribPointervNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPushMatrix:{table.glPushMatrix();r.finishCall();break;}
+case TRACE_glEdgeFlagPointerListIBM:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLboolean**>();auto const a2 = r.template arg<GLint>();table.glEdgeFlagPointerListIBM(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenerateMipmapEXT:{auto const a0 = r.template arg<GLenum>();table.glGenerateMipmapEXT(a0);r.finishCall();break;}
+case TRACE_glWindowPos3sv:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos3sv(a0);r.finishCall();break;}
+case TRACE_glPathCoordsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();table.glPathCoordsNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform1i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glProgramUniform1i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLdouble>();table.glProgramUniform1d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();table.glProgramUniform1f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramParameteriEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glProgramParameteriEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedMultiTexImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const void*>();table.glCompressedMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glProgramUniform3iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();table.glProgramUniform3iv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIndexiv:{auto const a0 = r.template arg<const GLint*>();table.glIndexiv(a0);r.finishCall();break;}
+case TRACE_glMultiTexCoord4xvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glMultiTexCoord4xvOES(a0,a1);r.finishCall();break;}
+case TRACE_glEGLImageTargetTexture2DOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLeglImageOES>();table.glEGLImageTargetTexture2DOES(a0,a1);r.finishCall();break;}
+case TRACE_glPixelZoom:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glPixelZoom(a0,a1);r.finishCall();break;}
+case TRACE_glVertex3bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glVertex3bvOES(a0);r.finishCall();break;}
+case TRACE_glFramebufferReadBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glFramebufferReadBufferEXT(a0,a1);r.finishCall();break;}
+case TRACE_glExtractComponentEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glExtractComponentEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCombinerParameterivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glCombinerParameterivNV(a0,a1);r.finishCall();break;}
+case TRACE_glMinmax:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();table.glMinmax(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColorP3ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glColorP3ui(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameterfvSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glPointParameterfvSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glBlendEquationi:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glBlendEquationi(a0,a1);r.finishCall();break;}
+case TRACE_glGetFogFuncSGIS:{auto const a0 = r.template arg<GLfloat*>();table.glGetFogFuncSGIS(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib4fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib4fvNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetnMinmax:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<void*>();table.glGetnMinmax(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glFragmentLightiSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glFragmentLightiSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord1bvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLbyte*>();table.glMultiTexCoord1bvOES(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColorPointerEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glSecondaryColorPointerEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoordP4uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glMultiTexCoordP4uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetBufferSubDataARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptrARB>();auto const a2 = r.template arg<GLsizeiptrARB>();auto const a3 = r.template arg<void*>();table.glGetBufferSubDataARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSecondaryColor3hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();table.glSecondaryColor3hNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPathParameterivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetPathParameterivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFlushRasterSGIX:{table.glFlushRasterSGIX();r.finishCall();break;}
+case TRACE_glElementPointerATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();table.glElementPointerATI(a0,a1);r.finishCall();break;}
+case TRACE_glGetAttachedObjectsARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLhandleARB*>();table.glGetAttachedObjectsARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform4iv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform4iv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFogxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glFogxOES(a0,a1);r.finishCall();break;}
+case TRACE_glSharpenTexFuncSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glSharpenTexFuncSGIS(a0,a1,a2);r.finishCall();break;}
+case TRACE_glClearDepthfOES:{auto const a0 = r.template arg<GLclampf>();table.glClearDepthfOES(a0);r.finishCall();break;}
+case TRACE_glDeleteCommandListsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteCommandListsNV(a0,a1);r.finishCall();break;}
+case TRACE_glSpecializeShader:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<const GLuint*>();table.glSpecializeShader(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertex4hNV:{auto const a0 = r.template arg<GLhalfNV>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();table.glVertex4hNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSecondaryColor3dvEXT:{auto const a0 = r.template arg<const GLdouble*>();table.glSecondaryColor3dvEXT(a0);r.finishCall();break;}
+case TRACE_glGenTextures:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenTextures(a0,a1);r.finishCall();break;}
+case TRACE_glTextureStorage2DMultisample:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLboolean>();table.glTextureStorage2DMultisample(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glUniform3ui64vNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64EXT*>();table.glUniform3ui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBlendFuncSeparateIndexedAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();table.glBlendFuncSeparateIndexedAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMakeBufferResidentNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glMakeBufferResidentNV(a0,a1);r.finishCall();break;}
+case TRACE_glShaderOp2EXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glShaderOp2EXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribivNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexAttribivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexParameterIivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTexParameterIivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPerfQueryDataINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLvoid*>();auto const a4 = r.template arg<GLuint*>();table.glGetPerfQueryDataINTEL(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib4dvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib4dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glTextureSubImage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<const void*>();table.glTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetActiveUniformBlockName:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLchar*>();table.glGetActiveUniformBlockName(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib2dvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib2dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribPointer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<const void*>();table.glVertexAttribPointer(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glDepthBoundsdNV:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();table.glDepthBoundsdNV(a0,a1);r.finishCall();break;}
+case TRACE_glDeleteTexturesEXT:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteTexturesEXT(a0,a1);r.finishCall();break;}
+case TRACE_glDrawBuffersATI:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLenum*>();table.glDrawBuffersATI(a0,a1);r.finishCall();break;}
+case TRACE_glLightModelxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfixed*>();table.glLightModelxvOES(a0,a1);r.finishCall();break;}
+case TRACE_glApplyTextureEXT:{auto const a0 = r.template arg<GLenum>();table.glApplyTextureEXT(a0);r.finishCall();break;}
+case TRACE_glGetImageHandleNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();auto const result = table.glGetImageHandleNV(a0,a1,a2,a3,a4);r.finishCall();r.template result<GLuint64>(result);break;}
+case TRACE_glGetMinmax:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLboolean>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLvoid*>();table.glGetMinmax(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetFixedvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed*>();table.glGetFixedvOES(a0,a1);r.finishCall();break;}
+case TRACE_glSamplePatternEXT:{auto const a0 = r.template arg<GLenum>();table.glSamplePatternEXT(a0);r.finishCall();break;}
+case TRACE_glUniform1f:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();table.glUniform1f(a0,a1);r.finishCall();break;}
+case TRACE_glColor4fNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();table.glColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glFogCoorddvEXT:{auto const a0 = r.template arg<const GLdouble*>();table.glFogCoorddvEXT(a0);r.finishCall();break;}
+case TRACE_glCopyTextureImage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLint>();table.glCopyTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glFlushMappedBufferRangeAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();table.glFlushMappedBufferRangeAPPLE(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex3sv:{auto const a0 = r.template arg<const GLshort*>();table.glVertex3sv(a0);r.finishCall();break;}
+case TRACE_glFlushStaticDataIBM:{auto const a0 = r.template arg<GLenum>();table.glFlushStaticDataIBM(a0);r.finishCall();break;}
+case TRACE_glProgramUniform4ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();auto const a4 = r.template arg<GLuint64EXT>();auto const a5 = r.template arg<GLuint64EXT>();table.glProgramUniform4ui64NV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glRasterPos4xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glRasterPos4xOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribP1ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLuint>();table.glVertexAttribP1ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform4dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform4dvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEndTransformFeedbackEXT:{table.glEndTransformFeedbackEXT();r.finishCall();break;}
+case TRACE_glBinormal3dEXT:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glBinormal3dEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTextureSubImage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLsizei>();auto const a11 = r.template arg<void*>();table.glGetTextureSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glGetNamedRenderbufferParameteriv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetNamedRenderbufferParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindBuffersRange:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<const GLintptr*>();auto const a5 = r.template arg<const GLsizeiptr*>();table.glBindBuffersRange(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glFinishAsyncSGIX:{auto const a0 = r.template arg<GLuint*>();auto const result = table.glFinishAsyncSGIX(a0);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glBindFragDataLocationIndexed:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLchar*>();table.glBindFragDataLocationIndexed(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord2dv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord2dv(a0,a1);r.finishCall();break;}
+case TRACE_glUniform2iv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform2iv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform2i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64EXT*>();table.glProgramUniform2i64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFlushVertexArrayRangeAPPLE:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<void*>();table.glFlushVertexArrayRangeAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glTextureParameterf:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glTextureParameterf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3dvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord3dvARB(a0,a1);r.finishCall();break;}
+case TRACE_glFeedbackBuffer:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glFeedbackBuffer(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDebugMessageInsertARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<const GLchar*>();table.glDebugMessageInsertARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMultiTexCoord2i:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glMultiTexCoord2i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureSubImage3D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<const void*>();table.glTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glFramebufferTexture1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();table.glFramebufferTexture1D(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetShaderiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetShaderiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord2d:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glMultiTexCoord2d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glArrayObjectATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glArrayObjectATI(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glGetPointeri_vEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<void**>();table.glGetPointeri_vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPerfMonitorCountersAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint*>();auto const a2 = r.template arg<GLint*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLuint*>();table.glGetPerfMonitorCountersAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNamedBufferStorage:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLbitfield>();table.glNamedBufferStorage(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexEnvxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfixed*>();table.glTexEnvxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform2ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();table.glProgramUniform2ui64NV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord3bOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();auto const a3 = r.template arg<GLbyte>();table.glMultiTexCoord3bOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform1dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glUniform1dv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPixelTransferi:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();table.glPixelTransferi(a0,a1);r.finishCall();break;}
+case TRACE_glSecondaryColor3usvEXT:{auto const a0 = r.template arg<const GLushort*>();table.glSecondaryColor3usvEXT(a0);r.finishCall();break;}
+case TRACE_glProgramEnvParameterI4uivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLuint*>();table.glProgramEnvParameterI4uivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex2sv:{auto const a0 = r.template arg<const GLshort*>();table.glVertex2sv(a0);r.finishCall();break;}
+case TRACE_glWindowPos4dMESA:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glWindowPos4dMESA(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDebugMessageControlARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLuint*>();auto const a5 = r.template arg<GLboolean>();table.glDebugMessageControlARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glIsTextureEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsTextureEXT(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glFragmentMaterialivSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glFragmentMaterialivSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLinkProgramARB:{auto const a0 = r.template arg<GLhandleARB>();table.glLinkProgramARB(a0);r.finishCall();break;}
+case TRACE_glFinishFenceAPPLE:{auto const a0 = r.template arg<GLuint>();table.glFinishFenceAPPLE(a0);r.finishCall();break;}
+case TRACE_glVertexArrayVertexAttribBindingEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexArrayVertexAttribBindingEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexStorageMem3DMultisampleEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLuint64>();table.glTexStorageMem3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glUniform1ui64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64*>();table.glUniform1ui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4fv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord4fv(a0,a1);r.finishCall();break;}
+case TRACE_glMulticastFramebufferSampleLocationsfvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLfloat*>();table.glMulticastFramebufferSampleLocationsfvNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glRasterPos3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glRasterPos3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPollAsyncSGIX:{auto const a0 = r.template arg<GLuint*>();auto const result = table.glPollAsyncSGIX(a0);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glRasterPos3f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glRasterPos3f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCompressedTexImage3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const GLvoid*>();table.glCompressedTexImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glVariantivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVariantivEXT(a0,a1);r.finishCall();break;}
+case TRACE_glUnmapTexture2DINTEL:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();table.glUnmapTexture2DINTEL(a0,a1);r.finishCall();break;}
+case TRACE_glMulticastWaitSyncNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();table.glMulticastWaitSyncNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexAttribiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVertexAttribiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPathCoordsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat*>();table.glGetPathCoordsNV(a0,a1);r.finishCall();break;}
+case TRACE_glColor4xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glColor4xvOES(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib3fv(a0,a1);r.finishCall();break;}
+case TRACE_glRasterPos3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glRasterPos3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertex4bOES:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();auto const a3 = r.template arg<GLbyte>();table.glVertex4bOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTransformFeedbackVaryingsEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*const*>();auto const a3 = r.template arg<GLenum>();table.glTransformFeedbackVaryingsEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCombinerOutputNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLboolean>();auto const a8 = r.template arg<GLboolean>();auto const a9 = r.template arg<GLboolean>();table.glCombinerOutputNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glWindowPos4sMESA:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glWindowPos4sMESA(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4svARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib4svARB(a0,a1);r.finishCall();break;}
+case TRACE_glIsList:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsList(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetInfoLogARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLcharARB*>();table.glGetInfoLogARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniformMatrix2fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix2fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribs3dvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glVertexAttribs3dvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGlobalAlphaFactorsSUN:{auto const a0 = r.template arg<GLshort>();table.glGlobalAlphaFactorsSUN(a0);r.finishCall();break;}
+case TRACE_glGetTrackMatrixivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetTrackMatrixivNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureParameterfvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glTextureParameterfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIsNamedBufferResidentNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsNamedBufferResidentNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glProgramUniform4ui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint64*>();table.glProgramUniform4ui64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTbufferMask3DFX:{auto const a0 = r.template arg<GLuint>();table.glTbufferMask3DFX(a0);r.finishCall();break;}
+case TRACE_glCoverFillPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glCoverFillPathNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1fvARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexAttrib1fvARB(a0,a1);r.finishCall();break;}
+case TRACE_glGenerateTextureMipmap:{auto const a0 = r.template arg<GLuint>();table.glGenerateTextureMipmap(a0);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameterI4uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLuint*>();table.glNamedProgramLocalParameterI4uivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiDrawElementsBaseVertex:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLsizei*>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*const*>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<const GLint*>();table.glMultiDrawElementsBaseVertex(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramSubroutineParametersuivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glProgramSubroutineParametersuivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2x4dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLdouble*>();table.glProgramUniformMatrix2x4dvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glRotatexOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glRotatexOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMemoryBarrierEXT:{auto const a0 = r.template arg<GLbitfield>();table.glMemoryBarrierEXT(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3svNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib3svNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream3iATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();table.glVertexStream3iATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCompressedTexSubImage1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<const GLvoid*>();table.glCompressedTexSubImage1D(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glSetFenceNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glSetFenceNV(a0,a1);r.finishCall();break;}
+case TRACE_glAttachObjectARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLhandleARB>();table.glAttachObjectARB(a0,a1);r.finishCall();break;}
+case TRACE_glCopyConvolutionFilter1D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glCopyConvolutionFilter1D(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glTexStorageMem2DMultisampleEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLboolean>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint64>();table.glTexStorageMem2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glProgramParameters4fvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramParameters4fvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedFramebufferParameteriEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glNamedFramebufferParameteriEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib4Nsv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLshort*>();table.glVertexAttrib4Nsv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribI4usvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLushort*>();table.glVertexAttribI4usvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTextureBufferRangeEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLintptr>();auto const a5 = r.template arg<GLsizeiptr>();table.glTextureBufferRangeEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexP3uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glVertexP3uiv(a0,a1);r.finishCall();break;}
+case TRACE_glIsPathNV:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsPathNV(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glGetnUniformi64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint64*>();table.glGetnUniformi64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferTextureMultiviewOVR:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();table.glFramebufferTextureMultiviewOVR(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCompressedMultiTexSubImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<const void*>();table.glCompressedMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glGetnMapdv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLdouble*>();table.glGetnMapdv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDebugMessageCallback:{auto const a0 = r.template arg<GLDEBUGPROC>();auto const a1 = r.template arg<const void*>();table.glDebugMessageCallback(a0,a1);r.finishCall();break;}
+case TRACE_glTangent3svEXT:{auto const a0 = r.template arg<const GLshort*>();table.glTangent3svEXT(a0);r.finishCall();break;}
+case TRACE_glVertexAttribParameteriAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();table.glVertexAttribParameteriAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBufferSubDataARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptrARB>();auto const a2 = r.template arg<GLsizeiptrARB>();auto const a3 = r.template arg<const void*>();table.glBufferSubDataARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetVertexAttribLui64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetVertexAttribLui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttribL4ui64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();auto const a4 = r.template arg<GLuint64EXT>();table.glVertexAttribL4ui64NV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glReplacementCodeuiColor4ubVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();auto const a3 = r.template arg<GLubyte>();auto const a4 = r.template arg<GLubyte>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();table.glReplacementCodeuiColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glImageTransformParameterfHP:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glImageTransformParameterfHP(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMap1f:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<const GLfloat*>();table.glMap1f(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glRasterPos4fv:{auto const a0 = r.template arg<const GLfloat*>();table.glRasterPos4fv(a0);r.finishCall();break;}
+case TRACE_glVertex2bvOES:{auto const a0 = r.template arg<const GLbyte*>();table.glVertex2bvOES(a0);r.finishCall();break;}
+case TRACE_glGetMapControlPointsNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLboolean>();auto const a6 = r.template arg<void*>();table.glGetMapControlPointsNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParametersI4ivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLint*>();table.glNamedProgramLocalParametersI4ivEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBindBufferRangeNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glBindBufferRangeNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexStream3dvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexStream3dvATI(a0,a1);r.finishCall();break;}
+case TRACE_glNormalPointerListIBM:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<const void**>();auto const a3 = r.template arg<GLint>();table.glNormalPointerListIBM(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFogFuncSGIS:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLfloat*>();table.glFogFuncSGIS(a0,a1);r.finishCall();break;}
+case TRACE_glMultiModeDrawArraysIBM:{auto const a0 = r.template arg<const GLenum*>();auto const a1 = r.template arg<const GLint*>();auto const a2 = r.template arg<const GLsizei*>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();table.glMultiModeDrawArraysIBM(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetNamedFramebufferAttachmentParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetNamedFramebufferAttachmentParameterivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetFloatv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat*>();table.glGetFloatv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexArrayVertexAttribIFormatEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLuint>();table.glVertexArrayVertexAttribIFormatEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glHint:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glHint(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream2svATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glVertexStream2svATI(a0,a1);r.finishCall();break;}
+case TRACE_glMultiDrawArraysIndirect:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glMultiDrawArraysIndirect(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexEnvfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glMultiTexEnvfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribP2uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLuint*>();table.glVertexAttribP2uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform1i64vARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64*>();table.glProgramUniform1i64vARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferTextureARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();table.glFramebufferTextureARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPushClientAttribDefaultEXT:{auto const a0 = r.template arg<GLbitfield>();table.glPushClientAttribDefaultEXT(a0);r.finishCall();break;}
+case TRACE_glScalef:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glScalef(a0,a1,a2);r.finishCall();break;}
+case TRACE_glScaled:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glScaled(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetConvolutionParameterxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetConvolutionParameterxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramResourceName:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei*>();auto const a5 = r.template arg<GLchar*>();table.glGetProgramResourceName(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCopyColorTable:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glCopyColorTable(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glDepthRangeArrayv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLdouble*>();table.glDepthRangeArrayv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCoverFillPathInstancedNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<const GLfloat*>();table.glCoverFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glMultiTexParameterivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glMultiTexParameterivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetActiveAtomicCounterBufferiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetActiveAtomicCounterBufferiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStencilOpSeparate:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();table.glStencilOpSeparate(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4fNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glVertexAttrib4fNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetColorTableParameterivSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetColorTableParameterivSGI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexArrayAttribBinding:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexArrayAttribBinding(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIsSemaphoreEXT:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsSemaphoreEXT(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glProgramParameters4dvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramParameters4dvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribL4dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttribL4dv(a0,a1);r.finishCall();break;}
+case TRACE_glGetTexParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTexParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const result = table.glGetUniformOffsetEXT(a0,a1);r.finishCall();r.template result<GLintptr>(result);break;}
+case TRACE_glGetVertexAttribPointerv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetVertexAttribPointerv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glResumeTransformFeedbackNV:{table.glResumeTransformFeedbackNV();r.finishCall();break;}
+case TRACE_glProgramUniform3i64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint64EXT*>();table.glProgramUniform3i64vNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTangent3fEXT:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glTangent3fEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPathMetricRangeNV:{auto const a0 = r.template arg<GLbitfield>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLfloat*>();table.glGetPathMetricRangeNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glWindowPos2iMESA:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();table.glWindowPos2iMESA(a0,a1);r.finishCall();break;}
+case TRACE_glVertex2xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glVertex2xvOES(a0);r.finishCall();break;}
+case TRACE_glGetnCompressedTexImage:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<void*>();table.glGetnCompressedTexImage(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glWindowPos2dv:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos2dv(a0);r.finishCall();break;}
+case TRACE_glReplacementCodeuiVertex3fSUN:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glReplacementCodeuiVertex3fSUN(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetTransformFeedbackVaryingEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLsizei*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLchar*>();table.glGetTransformFeedbackVaryingEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glWindowPos3fARB:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glWindowPos3fARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMapNamedBufferEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const result = table.glMapNamedBufferEXT(a0,a1);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glDisable:{auto const a0 = r.template arg<GLenum>();table.glDisable(a0);r.finishCall();break;}
+case TRACE_glIsPointInFillPathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const result = table.glIsPointInFillPathNV(a0,a1,a2,a3);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glVertexAttribI2uiEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glVertexAttribI2uiEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform4uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLuint*>();table.glProgramUniform4uiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glQueryCounter:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glQueryCounter(a0,a1);r.finishCall();break;}
+case TRACE_glFramebufferRenderbufferEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();table.glFramebufferRenderbufferEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBinormal3svEXT:{auto const a0 = r.template arg<const GLshort*>();table.glBinormal3svEXT(a0);r.finishCall();break;}
+case TRACE_glBindBufferOffsetNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLintptr>();table.glBindBufferOffsetNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCopyTextureSubImage2D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();table.glCopyTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetProgramResourcefvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLenum*>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei*>();auto const a7 = r.template arg<GLfloat*>();table.glGetProgramResourcefvNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glBinormalPointerEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const void*>();table.glBinormalPointerEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetLightfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetLightfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMulticastCopyImageSubDataNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLbitfield>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLuint>();auto const a9 = r.template arg<GLenum>();auto const a10 = r.template arg<GLint>();auto const a11 = r.template arg<GLint>();auto const a12 = r.template arg<GLint>();auto const a13 = r.template arg<GLint>();auto const a14 = r.template arg<GLsizei>();auto const a15 = r.template arg<GLsizei>();auto const a16 = r.template arg<GLsizei>();table.glMulticastCopyImageSubDataNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);r.finishCall();break;}
+case TRACE_glVertex2bOES:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();table.glVertex2bOES(a0,a1);r.finishCall();break;}
+case TRACE_glUniform2ivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform2ivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3s:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glMultiTexCoord3s(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetHistogramParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetHistogramParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramStringNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLubyte*>();table.glGetProgramStringNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTexGenxvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed*>();table.glGetTexGenxvOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTextureSubImage2D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const void*>();table.glTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glObjectPurgeableAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const result = table.glObjectPurgeableAPPLE(a0,a1,a2);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glColorTableSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<const void*>();table.glColorTableSGI(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCopyConvolutionFilter2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glCopyConvolutionFilter2DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glMultiTexCoord3f:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glMultiTexCoord3f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord3d:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glMultiTexCoord3d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFogCoorddv:{auto const a0 = r.template arg<const GLdouble*>();table.glFogCoorddv(a0);r.finishCall();break;}
+case TRACE_glGetBufferPointerv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetBufferPointerv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramUniform1fEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLfloat>();table.glProgramUniform1fEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos2fvMESA:{auto const a0 = r.template arg<const GLfloat*>();table.glWindowPos2fvMESA(a0);r.finishCall();break;}
+case TRACE_glAlphaToCoverageDitherControlNV:{auto const a0 = r.template arg<GLenum>();table.glAlphaToCoverageDitherControlNV(a0);r.finishCall();break;}
+case TRACE_glPolygonOffsetxOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();table.glPolygonOffsetxOES(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4dARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glVertexAttrib4dARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniformHandleui64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64*>();table.glUniformHandleui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFragmentLightModelfvSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glFragmentLightModelfvSGIX(a0,a1);r.finishCall();break;}
+case TRACE_glSwizzleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();table.glSwizzleEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBindFragmentShaderATI:{auto const a0 = r.template arg<GLuint>();table.glBindFragmentShaderATI(a0);r.finishCall();break;}
+case TRACE_glVertexAttribs3hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLhalfNV*>();table.glVertexAttribs3hvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGenBuffersARB:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenBuffersARB(a0,a1);r.finishCall();break;}
+case TRACE_glTextureStorageMem2DMultisampleEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLboolean>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint64>();table.glTextureStorageMem2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glListParameterfvSGIX:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glListParameterfvSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedRenderbufferStorageMultisample:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glNamedRenderbufferStorageMultisample(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribI1iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();table.glVertexAttribI1iEXT(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2ivARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord2ivARB(a0,a1);r.finishCall();break;}
+case TRACE_glLightModelxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();table.glLightModelxOES(a0,a1);r.finishCall();break;}
+case TRACE_glColor3xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();table.glColor3xOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glReadBuffer:{auto const a0 = r.template arg<GLenum>();table.glReadBuffer(a0);r.finishCall();break;}
+case TRACE_glStencilFillPathInstancedNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<const GLfloat*>();table.glStencilFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glVDPAUUnmapSurfacesNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLvdpauSurfaceNV*>();table.glVDPAUUnmapSurfacesNV(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform4i64NV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64EXT>();auto const a3 = r.template arg<GLint64EXT>();auto const a4 = r.template arg<GLint64EXT>();auto const a5 = r.template arg<GLint64EXT>();table.glProgramUniform4i64NV(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertexStream4dvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexStream4dvATI(a0,a1);r.finishCall();break;}
+case TRACE_glIsQuery:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsQuery(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glProgramUniformMatrix4fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix4fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib3hNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();table.glVertexAttrib3hNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFlushMappedNamedBufferRange:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();table.glFlushMappedNamedBufferRange(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPushName:{auto const a0 = r.template arg<GLuint>();table.glPushName(a0);r.finishCall();break;}
+case TRACE_glGetClipPlane:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble*>();table.glGetClipPlane(a0,a1);r.finishCall();break;}
+case TRACE_glVertex4dv:{auto const a0 = r.template arg<const GLdouble*>();table.glVertex4dv(a0);r.finishCall();break;}
+case TRACE_glVertexAttrib3d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertexAttrib3d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBlendColor:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glBlendColor(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glBindTransformFeedbackNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindTransformFeedbackNV(a0,a1);r.finishCall();break;}
+case TRACE_glSamplerParameterIuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLuint*>();table.glSamplerParameterIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glIndexubv:{auto const a0 = r.template arg<const GLubyte*>();table.glIndexubv(a0);r.finishCall();break;}
+case TRACE_glNamedBufferPageCommitmentEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLboolean>();table.glNamedBufferPageCommitmentEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCheckNamedFramebufferStatus:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const result = table.glCheckNamedFramebufferStatus(a0,a1);r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glGetObjectBufferfvATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetObjectBufferfvATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glRasterPos4d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glRasterPos4d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glRasterPos4f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glRasterPos4f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetPerfMonitorCounterStringAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei*>();auto const a4 = r.template arg<GLchar*>();table.glGetPerfMonitorCounterStringAMD(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib3s:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glVertexAttrib3s(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDrawElementsInstancedEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();table.glDrawElementsInstancedEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameterI4iEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();table.glNamedProgramLocalParameterI4iEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glRasterPos4s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glRasterPos4s(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetProgramStageiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetProgramStageiv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetMaterialxOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfixed>();table.glGetMaterialxOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPopMatrix:{table.glPopMatrix();r.finishCall();break;}
+case TRACE_glGetVideoui64vNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64EXT*>();table.glGetVideoui64vNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTangent3bEXT:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glTangent3bEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetGraphicsResetStatusARB:{auto const result = table.glGetGraphicsResetStatusARB();r.finishCall();r.template result<GLenum>(result);break;}
+case TRACE_glUniform4i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();table.glUniform4i(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glActiveTexture:{auto const a0 = r.template arg<GLenum>();table.glActiveTexture(a0);r.finishCall();break;}
+case TRACE_glEnableVertexAttribArray:{auto const a0 = r.template arg<GLuint>();table.glEnableVertexAttribArray(a0);r.finishCall();break;}
+case TRACE_glTexCoord4fVertex4fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();table.glTexCoord4fVertex4fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glUniform4d:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();auto const a4 = r.template arg<GLdouble>();table.glUniform4d(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform4f:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glUniform4f(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glRenderbufferStorageMultisample:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();table.glRenderbufferStorageMultisample(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glCreateProgramPipelines:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glCreateProgramPipelines(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribLPointer:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glVertexAttribLPointer(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform2uiEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glUniform2uiEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3sv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLshort*>();table.glMultiTexCoord3sv(a0,a1);r.finishCall();break;}
+case TRACE_glDrawElementsInstancedBaseVertex:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();table.glDrawElementsInstancedBaseVertex(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glPixelTransformParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glPixelTransformParameterfvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glDrawTransformFeedbackNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glDrawTransformFeedbackNV(a0,a1);r.finishCall();break;}
+case TRACE_glTextureImage2DMultisampleCoverageNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLboolean>();table.glTextureImage2DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glNamedRenderbufferStorageMultisampleCoverageEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glNamedRenderbufferStorageMultisampleCoverageEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glIsTexture:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsTexture(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glMultiTexCoord4iv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLint*>();table.glMultiTexCoord4iv(a0,a1);r.finishCall();break;}
+case TRACE_glTexEnvfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glTexEnvfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPopDebugGroup:{table.glPopDebugGroup();r.finishCall();break;}
+case TRACE_glUniformBlockBinding:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glUniformBlockBinding(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos2svMESA:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos2svMESA(a0);r.finishCall();break;}
+case TRACE_glGenerateTextureMipmapEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glGenerateTextureMipmapEXT(a0,a1);r.finishCall();break;}
+case TRACE_glBindLightParameterEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const result = table.glBindLightParameterEXT(a0,a1);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glTexCoord3bOES:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glTexCoord3bOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordPointer:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLvoid*>();table.glTexCoordPointer(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix3x2fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix3x2fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform2fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform2fvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glProgramLocalParameterI4uivNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLuint*>();table.glProgramLocalParameterI4uivNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFlushVertexArrayRangeNV:{table.glFlushVertexArrayRangeNV();r.finishCall();break;}
+case TRACE_glSecondaryColor3svEXT:{auto const a0 = r.template arg<const GLshort*>();table.glSecondaryColor3svEXT(a0);r.finishCall();break;}
+case TRACE_glGetBufferParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetBufferParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetQueryIndexediv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetQueryIndexediv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glFramebufferTexture3DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glFramebufferTexture3DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glLoadTransposeMatrixxOES:{auto const a0 = r.template arg<const GLfixed*>();table.glLoadTransposeMatrixxOES(a0);r.finishCall();break;}
+case TRACE_glDeleteTransformFeedbacksNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLuint*>();table.glDeleteTransformFeedbacksNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetCompressedTextureImageEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<void*>();table.glGetCompressedTextureImageEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIndexMaterialEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glIndexMaterialEXT(a0,a1);r.finishCall();break;}
+case TRACE_glFogCoorddEXT:{auto const a0 = r.template arg<GLdouble>();table.glFogCoorddEXT(a0);r.finishCall();break;}
+case TRACE_glTexCoord2hvNV:{auto const a0 = r.template arg<const GLhalfNV*>();table.glTexCoord2hvNV(a0);r.finishCall();break;}
+case TRACE_glGetFramebufferParameterfvAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLfloat*>();table.glGetFramebufferParameterfvAMD(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glTexEnviv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTexEnviv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glEndTransformFeedbackNV:{table.glEndTransformFeedbackNV();r.finishCall();break;}
+case TRACE_glGlobalAlphaFactoruiSUN:{auto const a0 = r.template arg<GLuint>();table.glGlobalAlphaFactoruiSUN(a0);r.finishCall();break;}
+case TRACE_glSelectBuffer:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glSelectBuffer(a0,a1);r.finishCall();break;}
+case TRACE_glNamedBufferSubDataEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<const void*>();table.glNamedBufferSubDataEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDisableVertexArrayAttrib:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glDisableVertexArrayAttrib(a0,a1);r.finishCall();break;}
+case TRACE_glBlendFunc:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glBlendFunc(a0,a1);r.finishCall();break;}
+case TRACE_glCreateProgram:{auto const result = table.glCreateProgram();r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glVertexStream2dATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertexStream2dATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform4ui64vARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint64*>();table.glUniform4ui64vARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetSemaphoreParameterui64vEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint64*>();table.glGetSemaphoreParameterui64vEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPrimitiveRestartIndex:{auto const a0 = r.template arg<GLuint>();table.glPrimitiveRestartIndex(a0);r.finishCall();break;}
+case TRACE_glNormalStream3fATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glNormalStream3fATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix2fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix2fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttribs1hvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLhalfNV*>();table.glVertexAttribs1hvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glWindowPos4svMESA:{auto const a0 = r.template arg<const GLshort*>();table.glWindowPos4svMESA(a0);r.finishCall();break;}
+case TRACE_glDeleteFragmentShaderATI:{auto const a0 = r.template arg<GLuint>();table.glDeleteFragmentShaderATI(a0);r.finishCall();break;}
+case TRACE_glBindImageTextures:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glBindImageTextures(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMap2xOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLfixed>();auto const a6 = r.template arg<GLfixed>();auto const a7 = r.template arg<GLint>();auto const a8 = r.template arg<GLint>();auto const a9 = r.template arg<GLfixed>();table.glMap2xOES(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glEnd:{table.glEnd();r.finishCall();break;}
+case TRACE_glMultiTexCoord2dARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glMultiTexCoord2dARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform1i64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint64EXT>();table.glUniform1i64NV(a0,a1);r.finishCall();break;}
+case TRACE_glPathStringNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();table.glPathStringNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetNamedFramebufferParameterivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetNamedFramebufferParameterivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetProgramNamedParameterdvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<GLdouble*>();table.glGetProgramNamedParameterdvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPathDashArrayNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glPathDashArrayNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform3uiv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLuint*>();table.glUniform3uiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glColor3fVertex3fvSUN:{auto const a0 = r.template arg<const GLfloat*>();auto const a1 = r.template arg<const GLfloat*>();table.glColor3fVertex3fvSUN(a0,a1);r.finishCall();break;}
+case TRACE_glMultTransposeMatrixd:{auto const a0 = r.template arg<const GLdouble*>();table.glMultTransposeMatrixd(a0);r.finishCall();break;}
+case TRACE_glClearColor:{auto const a0 = r.template arg<GLclampf>();auto const a1 = r.template arg<GLclampf>();auto const a2 = r.template arg<GLclampf>();auto const a3 = r.template arg<GLclampf>();table.glClearColor(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetImageHandleARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLenum>();auto const result = table.glGetImageHandleARB(a0,a1,a2,a3,a4);r.finishCall();r.template result<GLuint64>(result);break;}
+case TRACE_glTangent3dEXT:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glTangent3dEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetQueryObjectivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetQueryObjectivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetLocalConstantFloatvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetLocalConstantFloatvEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUseShaderProgramEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glUseShaderProgramEXT(a0,a1);r.finishCall();break;}
+case TRACE_glBindRenderbufferEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindRenderbufferEXT(a0,a1);r.finishCall();break;}
+case TRACE_glInterleavedArrays:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLvoid*>();table.glInterleavedArrays(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetPerfMonitorGroupStringAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei*>();auto const a3 = r.template arg<GLchar*>();table.glGetPerfMonitorGroupStringAMD(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniform3ui:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();table.glUniform3ui(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glGetNamedProgramLocalParameterdvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLdouble*>();table.glGetNamedProgramLocalParameterdvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDeleteQueryResourceTagNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLint*>();table.glDeleteQueryResourceTagNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribI4uiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLuint*>();table.glVertexAttribI4uiv(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib4bv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVertexAttrib4bv(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord3xOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glMultiTexCoord3xOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSecondaryColor3ub:{auto const a0 = r.template arg<GLubyte>();auto const a1 = r.template arg<GLubyte>();auto const a2 = r.template arg<GLubyte>();table.glSecondaryColor3ub(a0,a1,a2);r.finishCall();break;}
+case TRACE_glFragmentMaterialfSGIX:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glFragmentMaterialfSGIX(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetVariantArrayObjectivATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetVariantArrayObjectivATI(a0,a1,a2);r.finishCall();break;}
+case TRACE_glSecondaryColor3ui:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glSecondaryColor3ui(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib1dARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();table.glVertexAttrib1dARB(a0,a1);r.finishCall();break;}
+case TRACE_glGetNamedBufferPointerv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<void**>();table.glGetNamedBufferPointerv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glLockArraysEXT:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();table.glLockArraysEXT(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribPointerNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const void*>();table.glVertexAttribPointerNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glConvolutionParameterf:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glConvolutionParameterf(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindBufferBaseEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();table.glBindBufferBaseEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoord2xvOES:{auto const a0 = r.template arg<const GLfixed*>();table.glTexCoord2xvOES(a0);r.finishCall();break;}
+case TRACE_glGetQueryBufferObjectui64v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLintptr>();table.glGetQueryBufferObjectui64v(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSetMultisamplefvAMD:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLfloat*>();table.glSetMultisamplefvAMD(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPathColorGenNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glPathColorGenNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib3sARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();table.glVertexAttrib3sARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttrib4ivARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttrib4ivARB(a0,a1);r.finishCall();break;}
+case TRACE_glGenTransformFeedbacks:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenTransformFeedbacks(a0,a1);r.finishCall();break;}
+case TRACE_glGetVertexAttribIuiv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetVertexAttribIuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glPixelTransformParameterfEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat>();table.glPixelTransformParameterfEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetTexParameterIuivEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint*>();table.glGetTexParameterIuivEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetObjectParameterivARB:{auto const a0 = r.template arg<GLhandleARB>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetObjectParameterivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexArraySecondaryColorOffsetEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLintptr>();table.glVertexArraySecondaryColorOffsetEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glWindowPos2fARB:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();table.glWindowPos2fARB(a0,a1);r.finishCall();break;}
+case TRACE_glCompressedTexSubImage2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<const GLvoid*>();table.glCompressedTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glCompressedTexSubImage3DARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLsizei>();auto const a10 = r.template arg<const void*>();table.glCompressedTexSubImage3DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glProgramBinary:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLsizei>();table.glProgramBinary(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glPresentFrameKeyedNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLenum>();auto const a5 = r.template arg<GLenum>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<GLuint>();auto const a10 = r.template arg<GLuint>();table.glPresentFrameKeyedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);r.finishCall();break;}
+case TRACE_glVertexAttribI4bv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLbyte*>();table.glVertexAttribI4bv(a0,a1);r.finishCall();break;}
+case TRACE_glPathCoverDepthFuncNV:{auto const a0 = r.template arg<GLenum>();table.glPathCoverDepthFuncNV(a0);r.finishCall();break;}
+case TRACE_glTransformFeedbackStreamAttribsNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const GLint*>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLint*>();auto const a4 = r.template arg<GLenum>();table.glTransformFeedbackStreamAttribsNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glSecondaryColor3usEXT:{auto const a0 = r.template arg<GLushort>();auto const a1 = r.template arg<GLushort>();auto const a2 = r.template arg<GLushort>();table.glSecondaryColor3usEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyColorTableSGI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();table.glCopyColorTableSGI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glProgramEnvParameter4fvARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<const GLfloat*>();table.glProgramEnvParameter4fvARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord4sARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();auto const a3 = r.template arg<GLshort>();auto const a4 = r.template arg<GLshort>();table.glMultiTexCoord4sARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetVertexArrayIndexed64iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint64*>();table.glGetVertexArrayIndexed64iv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMatrixMultTranspose3x3fNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMatrixMultTranspose3x3fNV(a0,a1);r.finishCall();break;}
+case TRACE_glTexParameterIiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glTexParameterIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexArrayAttribFormat:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLboolean>();auto const a5 = r.template arg<GLuint>();table.glVertexArrayAttribFormat(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glEndTransformFeedback:{table.glEndTransformFeedback();r.finishCall();break;}
+case TRACE_glDrawCommandsStatesAddressNV:{auto const a0 = r.template arg<const GLuint64*>();auto const a1 = r.template arg<const GLsizei*>();auto const a2 = r.template arg<const GLuint*>();auto const a3 = r.template arg<const GLuint*>();auto const a4 = r.template arg<GLuint>();table.glDrawCommandsStatesAddressNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glUniform4ui64NV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLuint64EXT>();auto const a2 = r.template arg<GLuint64EXT>();auto const a3 = r.template arg<GLuint64EXT>();auto const a4 = r.template arg<GLuint64EXT>();table.glUniform4ui64NV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMaterialiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLint*>();table.glMaterialiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexImage2DMultisample:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLboolean>();table.glTexImage2DMultisample(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glBindTextureEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindTextureEXT(a0,a1);r.finishCall();break;}
+case TRACE_glIsBuffer:{auto const a0 = r.template arg<GLuint>();auto const result = table.glIsBuffer(a0);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glVertexAttribI1iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI1iv(a0,a1);r.finishCall();break;}
+case TRACE_glGetFinalCombinerInputParameterfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetFinalCombinerInputParameterfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiTexCoord3bvOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLbyte*>();table.glMultiTexCoord3bvOES(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttribDivisor:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glVertexAttribDivisor(a0,a1);r.finishCall();break;}
+case TRACE_glCopyBufferSubData:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizeiptr>();table.glCopyBufferSubData(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBindTexGenParameterEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const result = table.glBindTexGenParameterEXT(a0,a1,a2);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glNormalStream3bATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();auto const a3 = r.template arg<GLbyte>();table.glNormalStream3bATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexStorageMem2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint64>();table.glTexStorageMem2DEXT(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glTextureImage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLenum>();auto const a9 = r.template arg<const void*>();table.glTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glGetColorTableParameteriv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetColorTableParameteriv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glActiveTextureARB:{auto const a0 = r.template arg<GLenum>();table.glActiveTextureARB(a0);r.finishCall();break;}
+case TRACE_glTexCoord4xOES:{auto const a0 = r.template arg<GLfixed>();auto const a1 = r.template arg<GLfixed>();auto const a2 = r.template arg<GLfixed>();auto const a3 = r.template arg<GLfixed>();table.glTexCoord4xOES(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedBufferStorageExternalEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLeglClientBufferEXT>();auto const a4 = r.template arg<GLbitfield>();table.glNamedBufferStorageExternalEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glSecondaryColor3fvEXT:{auto const a0 = r.template arg<const GLfloat*>();table.glSecondaryColor3fvEXT(a0);r.finishCall();break;}
+case TRACE_glUniformMatrix4x2fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix4x2fv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glStartInstrumentsSGIX:{table.glStartInstrumentsSGIX();r.finishCall();break;}
+case TRACE_glProgramNamedParameter4fvNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLubyte*>();auto const a3 = r.template arg<const GLfloat*>();table.glProgramNamedParameter4fvNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEndVideoCaptureNV:{auto const a0 = r.template arg<GLuint>();table.glEndVideoCaptureNV(a0);r.finishCall();break;}
+case TRACE_glGenLists:{auto const a0 = r.template arg<GLsizei>();auto const result = table.glGenLists(a0);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glUniform1fARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();table.glUniform1fARB(a0,a1);r.finishCall();break;}
+case TRACE_glNamedFramebufferTexture1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();table.glNamedFramebufferTexture1DEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glMapBufferRange:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLintptr>();auto const a2 = r.template arg<GLsizeiptr>();auto const a3 = r.template arg<GLbitfield>();auto const result = table.glMapBufferRange(a0,a1,a2,a3);r.finishCall();r.template result<void*>(result);break;}
+case TRACE_glMultiDrawElementsIndirectCountARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLintptr>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glMultiDrawElementsIndirectCountARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glProgramUniformMatrix4x2fv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLboolean>();auto const a4 = r.template arg<const GLfloat*>();table.glProgramUniformMatrix4x2fv(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetTextureParameterIivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetTextureParameterIivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexCoord3hNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLhalfNV>();auto const a2 = r.template arg<GLhalfNV>();auto const a3 = r.template arg<GLhalfNV>();table.glMultiTexCoord3hNV(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParametersI4uivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLuint*>();table.glNamedProgramLocalParametersI4uivEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glEndList:{table.glEndList();r.finishCall();break;}
+case TRACE_glTexCoord2fColor4fNormal3fVertex3fSUN:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();auto const a5 = r.template arg<GLfloat>();auto const a6 = r.template arg<GLfloat>();auto const a7 = r.template arg<GLfloat>();auto const a8 = r.template arg<GLfloat>();auto const a9 = r.template arg<GLfloat>();auto const a10 = r.template arg<GLfloat>();auto const a11 = r.template arg<GLfloat>();table.glTexCoord2fColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);r.finishCall();break;}
+case TRACE_glGenTransformFeedbacksNV:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenTransformFeedbacksNV(a0,a1);r.finishCall();break;}
+case TRACE_glEdgeFlagv:{auto const a0 = r.template arg<const GLboolean*>();table.glEdgeFlagv(a0);r.finishCall();break;}
+case TRACE_glVertexAttribI2iv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glVertexAttribI2iv(a0,a1);r.finishCall();break;}
+case TRACE_glCopyMultiTexImage2DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLint>();table.glCopyMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glUniformMatrix3x2dv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLdouble*>();table.glUniformMatrix3x2dv(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexImage3DMultisampleCoverageNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLboolean>();table.glTexImage3DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glGetShaderPrecisionFormat:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();auto const a3 = r.template arg<GLint*>();table.glGetShaderPrecisionFormat(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexSubImage4DSGIS:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<GLsizei>();auto const a10 = r.template arg<GLenum>();auto const a11 = r.template arg<GLenum>();auto const a12 = r.template arg<const void*>();table.glTexSubImage4DSGIS(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);r.finishCall();break;}
+case TRACE_glRasterSamplesEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLboolean>();table.glRasterSamplesEXT(a0,a1);r.finishCall();break;}
+case TRACE_glTextureView:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();auto const a6 = r.template arg<GLuint>();auto const a7 = r.template arg<GLuint>();table.glTextureView(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();break;}
+case TRACE_glEvalMapsNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();table.glEvalMapsNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetFragDataLocationEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetFragDataLocationEXT(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glGetCompressedMultiTexImageEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<void*>();table.glGetCompressedMultiTexImageEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glIndexMask:{auto const a0 = r.template arg<GLuint>();table.glIndexMask(a0);r.finishCall();break;}
+case TRACE_glPushClientAttrib:{auto const a0 = r.template arg<GLbitfield>();table.glPushClientAttrib(a0);r.finishCall();break;}
+case TRACE_glShaderSource:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLchar*const*>();auto const a3 = r.template arg<const GLint*>();table.glShaderSource(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glDispatchComputeGroupSizeARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLuint>();auto const a5 = r.template arg<GLuint>();table.glDispatchComputeGroupSizeARB(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glLGPUNamedBufferSubDataNVX:{auto const a0 = r.template arg<GLbitfield>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLintptr>();auto const a3 = r.template arg<GLsizeiptr>();auto const a4 = r.template arg<const void*>();table.glLGPUNamedBufferSubDataNVX(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glGetnPixelMapfv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLfloat*>();table.glGetnPixelMapfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexCoordP2uiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLuint*>();table.glTexCoordP2uiv(a0,a1);r.finishCall();break;}
+case TRACE_glUniform2f:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glUniform2f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetNamedBufferParameteri64v:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint64*>();table.glGetNamedBufferParameteri64v(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCommandListSegmentsNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();table.glCommandListSegmentsNV(a0,a1);r.finishCall();break;}
+case TRACE_glTextureParameterIivEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLint*>();table.glTextureParameterIivEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glMultiTexParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const GLfloat*>();table.glMultiTexParameterfvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glProgramUniform2ui64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLuint64>();auto const a3 = r.template arg<GLuint64>();table.glProgramUniform2ui64ARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertex4d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();auto const a3 = r.template arg<GLdouble>();table.glVertex4d(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNewObjectBufferATI:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<const void*>();auto const a2 = r.template arg<GLenum>();auto const result = table.glNewObjectBufferATI(a0,a1,a2);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glViewportSwizzleNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLenum>();auto const a4 = r.template arg<GLenum>();table.glViewportSwizzleNV(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glBufferData:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizeiptr>();auto const a2 = r.template arg<const void*>();auto const a3 = r.template arg<GLenum>();table.glBufferData(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTextureImage1DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLenum>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<const void*>();table.glTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glGetTexParameterIiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetTexParameterIiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glCopyTexSubImage1DEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();table.glCopyTexSubImage1DEXT(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glVertex4f:{auto const a0 = r.template arg<GLfloat>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();table.glVertex4f(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glUniformMatrix3fvARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLboolean>();auto const a3 = r.template arg<const GLfloat*>();table.glUniformMatrix3fvARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glTexCoordP1ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glTexCoordP1ui(a0,a1);r.finishCall();break;}
+case TRACE_glPointParameterfvEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glPointParameterfvEXT(a0,a1);r.finishCall();break;}
+case TRACE_glUniform4fARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const a3 = r.template arg<GLfloat>();auto const a4 = r.template arg<GLfloat>();table.glUniform4fARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glImportMemoryFdEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint>();table.glImportMemoryFdEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glCopyTextureSubImage3D:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();auto const a6 = r.template arg<GLint>();auto const a7 = r.template arg<GLsizei>();auto const a8 = r.template arg<GLsizei>();table.glCopyTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);r.finishCall();break;}
+case TRACE_glMultiTexCoord2fv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glMultiTexCoord2fv(a0,a1);r.finishCall();break;}
+case TRACE_glNamedFramebufferSamplePositionsfvAMD:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<const GLfloat*>();table.glNamedFramebufferSamplePositionsfvAMD(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNormalP3ui:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glNormalP3ui(a0,a1);r.finishCall();break;}
+case TRACE_glDrawRangeElementArrayATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();table.glDrawRangeElementArrayATI(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glVertexAttribI1i:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();table.glVertexAttribI1i(a0,a1);r.finishCall();break;}
+case TRACE_glDrawArraysInstancedARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();table.glDrawArraysInstancedARB(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glEnableVertexAttribAPPLE:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();table.glEnableVertexAttribAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glGetDebugMessageLogARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum*>();auto const a3 = r.template arg<GLenum*>();auto const a4 = r.template arg<GLuint*>();auto const a5 = r.template arg<GLenum*>();auto const a6 = r.template arg<GLsizei*>();auto const a7 = r.template arg<GLchar*>();auto const result = table.glGetDebugMessageLogARB(a0,a1,a2,a3,a4,a5,a6,a7);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glGetPathTexGenfvNV:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLfloat*>();table.glGetPathTexGenfvNV(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNamedProgramLocalParameters4fvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLuint>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<const GLfloat*>();table.glNamedProgramLocalParameters4fvEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glQueryResourceTagNV:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<const GLchar*>();table.glQueryResourceTagNV(a0,a1);r.finishCall();break;}
+case TRACE_glVertexStream3fvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLfloat*>();table.glVertexStream3fvATI(a0,a1);r.finishCall();break;}
+case TRACE_glFramebufferTexture3D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLuint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLint>();table.glFramebufferTexture3D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glCompressedTextureSubImage2DEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLint>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLsizei>();auto const a7 = r.template arg<GLenum>();auto const a8 = r.template arg<GLsizei>();auto const a9 = r.template arg<const void*>();table.glCompressedTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);r.finishCall();break;}
+case TRACE_glWindowPos3dv:{auto const a0 = r.template arg<const GLdouble*>();table.glWindowPos3dv(a0);r.finishCall();break;}
+case TRACE_glCopyConvolutionFilter2D:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint>();auto const a3 = r.template arg<GLint>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();table.glCopyConvolutionFilter2D(a0,a1,a2,a3,a4,a5);r.finishCall();break;}
+case TRACE_glReadInstrumentsSGIX:{auto const a0 = r.template arg<GLint>();table.glReadInstrumentsSGIX(a0);r.finishCall();break;}
+case TRACE_glProgramUniform2dvEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const GLdouble*>();table.glProgramUniform2dvEXT(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glSamplerParameterfv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<const GLfloat*>();table.glSamplerParameterfv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBindBufferARB:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();table.glBindBufferARB(a0,a1);r.finishCall();break;}
+case TRACE_glVertexAttrib1sNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();table.glVertexAttrib1sNV(a0,a1);r.finishCall();break;}
+case TRACE_glGetMaterialiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLint*>();table.glGetMaterialiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform1fv:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLfloat*>();table.glUniform1fv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glBeginOcclusionQueryNV:{auto const a0 = r.template arg<GLuint>();table.glBeginOcclusionQueryNV(a0);r.finishCall();break;}
+case TRACE_glGenFencesAPPLE:{auto const a0 = r.template arg<GLsizei>();auto const a1 = r.template arg<GLuint*>();table.glGenFencesAPPLE(a0,a1);r.finishCall();break;}
+case TRACE_glScissorIndexedv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLint*>();table.glScissorIndexedv(a0,a1);r.finishCall();break;}
+case TRACE_glDisableVariantClientStateEXT:{auto const a0 = r.template arg<GLuint>();table.glDisableVariantClientStateEXT(a0);r.finishCall();break;}
+case TRACE_glMinmaxEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLenum>();auto const a2 = r.template arg<GLboolean>();table.glMinmaxEXT(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormalPointervINTEL:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const void**>();table.glNormalPointervINTEL(a0,a1);r.finishCall();break;}
+case TRACE_glNormal3s:{auto const a0 = r.template arg<GLshort>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glNormal3s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetnPixelMapuiv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLuint*>();table.glGetnPixelMapuiv(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormalStream3bvATI:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLbyte*>();table.glNormalStream3bvATI(a0,a1);r.finishCall();break;}
+case TRACE_glGetObjectParameterivAPPLE:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLint*>();table.glGetObjectParameterivAPPLE(a0,a1,a2,a3);r.finishCall();break;}
+case TRACE_glNormal3i:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint>();table.glNormal3i(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUniform1ivARB:{auto const a0 = r.template arg<GLint>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<const GLint*>();table.glUniform1ivARB(a0,a1,a2);r.finishCall();break;}
+case TRACE_glNormal3d:{auto const a0 = r.template arg<GLdouble>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glNormal3d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glUpdateObjectBufferATI:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<const void*>();auto const a4 = r.template arg<GLenum>();table.glUpdateObjectBufferATI(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glNormal3b:{auto const a0 = r.template arg<GLbyte>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glNormal3b(a0,a1,a2);r.finishCall();break;}
+case TRACE_glGetUniformBufferSizeEXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const result = table.glGetUniformBufferSizeEXT(a0,a1);r.finishCall();r.template result<GLint>(result);break;}
+case TRACE_glMultiTexCoord4dv:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLdouble*>();table.glMultiTexCoord4dv(a0,a1);r.finishCall();break;}
+case TRACE_glProgramUniform3i64ARB:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLint64>();auto const a3 = r.template arg<GLint64>();auto const a4 = r.template arg<GLint64>();table.glProgramUniform3i64ARB(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib2d:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLdouble>();auto const a2 = r.template arg<GLdouble>();table.glVertexAttrib2d(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib2f:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();table.glVertexAttrib2f(a0,a1,a2);r.finishCall();break;}
+case TRACE_glMultiDrawElementsEXT:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<const GLsizei*>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<const void*const*>();auto const a4 = r.template arg<GLsizei>();table.glMultiDrawElementsEXT(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glVertexAttrib3dv:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLdouble*>();table.glVertexAttrib3dv(a0,a1);r.finishCall();break;}
+case TRACE_glMultiTexCoord2bOES:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLbyte>();auto const a2 = r.template arg<GLbyte>();table.glMultiTexCoord2bOES(a0,a1,a2);r.finishCall();break;}
+case TRACE_glVertexAttrib2s:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLshort>();auto const a2 = r.template arg<GLshort>();table.glVertexAttrib2s(a0,a1,a2);r.finishCall();break;}
+case TRACE_glTexImage3DMultisample:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLsizei>();auto const a2 = r.template arg<GLenum>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLsizei>();auto const a5 = r.template arg<GLsizei>();auto const a6 = r.template arg<GLboolean>();table.glTexImage3DMultisample(a0,a1,a2,a3,a4,a5,a6);r.finishCall();break;}
+case TRACE_glGetUniformBlockIndex:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<const GLchar*>();auto const result = table.glGetUniformBlockIndex(a0,a1);r.finishCall();r.template result<GLuint>(result);break;}
+case TRACE_glReleaseKeyedMutexWin32EXT:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLuint64>();auto const result = table.glReleaseKeyedMutexWin32EXT(a0,a1);r.finishCall();r.template result<GLboolean>(result);break;}
+case TRACE_glFrontFace:{auto const a0 = r.template arg<GLenum>();table.glFrontFace(a0);r.finishCall();break;}
+case TRACE_glEvalCoord1xOES:{auto const a0 = r.template arg<GLfixed>();table.glEvalCoord1xOES(a0);r.finishCall();break;}
+case TRACE_glDrawArraysInstancedBaseInstance:{auto const a0 = r.template arg<GLenum>();auto const a1 = r.template arg<GLint>();auto const a2 = r.template arg<GLsizei>();auto const a3 = r.template arg<GLsizei>();auto const a4 = r.template arg<GLuint>();table.glDrawArraysInstancedBaseInstance(a0,a1,a2,a3,a4);r.finishCall();break;}
+case TRACE_glIsPointInStrokePathNV:{auto const a0 = r.template arg<GLuint>();auto const a1 = r.template arg<GLfloat>();auto const a2 = r.template arg<GLfloat>();auto const result = table.glIsPointInStrokePathNV(a0,a1,a2);r.finishCall();r.template result<GLboolean>(result);break;}
@@ -0,0 +1,2925 @@
+#define glMultiDrawArraysIndirectBindlessCountNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysIndirectBindlessCountNV(__VA_ARGS__))
+#define glTextureParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterfv(__VA_ARGS__))
+#define glGetListParameterivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetListParameterivSGIX(__VA_ARGS__))
+#define glProgramUniform1i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1i64ARB(__VA_ARGS__))
+#define glVertexArrayElementBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayElementBuffer(__VA_ARGS__))
+#define glHintPGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glHintPGI(__VA_ARGS__))
+#define glStencilMaskSeparate(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilMaskSeparate(__VA_ARGS__))
+#define glGetFramebufferAttachmentParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFramebufferAttachmentParameterivEXT(__VA_ARGS__))
+#define glTextureStorage3DMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage3DMultisample(__VA_ARGS__))
+#define glGetIntegerIndexedvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetIntegerIndexedvEXT(__VA_ARGS__))
+#define glCopyTexImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexImage1D(__VA_ARGS__))
+#define glVertexAttrib4usv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4usv(__VA_ARGS__))
+#define glTexRenderbufferNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexRenderbufferNV(__VA_ARGS__))
+#define glVertexAttrib3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3hvNV(__VA_ARGS__))
+#define glProgramUniform4ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4ui64ARB(__VA_ARGS__))
+#define glInstrumentsBufferSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInstrumentsBufferSGIX(__VA_ARGS__))
+#define glIndexi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexi(__VA_ARGS__))
+#define glMultiTexCoord2sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2sARB(__VA_ARGS__))
+#define glProgramEnvParameter4fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameter4fARB(__VA_ARGS__))
+#define glCompressedTexSubImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexSubImage3D(__VA_ARGS__))
+#define glEvalCoord2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord2d(__VA_ARGS__))
+#define glEvalCoord2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord2f(__VA_ARGS__))
+#define glIndexd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexd(__VA_ARGS__))
+#define glSecondaryColor3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3hvNV(__VA_ARGS__))
+#define glIndexf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexf(__VA_ARGS__))
+#define glFrustumxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFrustumxOES(__VA_ARGS__))
+#define glTextureStorage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage3DEXT(__VA_ARGS__))
+#define glDrawCommandsStatesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawCommandsStatesNV(__VA_ARGS__))
+#define glUniform4uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4uiEXT(__VA_ARGS__))
+#define glProgramUniform3ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3ui64ARB(__VA_ARGS__))
+#define glIndexs(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexs(__VA_ARGS__))
+#define glVertexArrayBindVertexBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayBindVertexBufferEXT(__VA_ARGS__))
+#define glConvolutionParameteriEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameteriEXT(__VA_ARGS__))
+#define glColor4ubVertex2fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ubVertex2fSUN(__VA_ARGS__))
+#define glProgramUniform1ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1ivEXT(__VA_ARGS__))
+#define glGetnMapfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMapfv(__VA_ARGS__))
+#define glTransformFeedbackBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackBufferRange(__VA_ARGS__))
+#define glPathGlyphsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathGlyphsNV(__VA_ARGS__))
+#define glSecondaryColor3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3fv(__VA_ARGS__))
+#define glGetCombinerInputParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCombinerInputParameterivNV(__VA_ARGS__))
+#define glEndPerfMonitorAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndPerfMonitorAMD(__VA_ARGS__))
+#define glPointParameterfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfvARB(__VA_ARGS__))
+#define glVertex2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2xOES(__VA_ARGS__))
+#define glDrawElementsInstancedBaseInstance(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsInstancedBaseInstance(__VA_ARGS__))
+#define glMultTransposeMatrixdARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultTransposeMatrixdARB(__VA_ARGS__))
+#define glVertexAttribL4dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4dEXT(__VA_ARGS__))
+#define glVertex4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4iv(__VA_ARGS__))
+#define glCoverStrokePathInstancedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCoverStrokePathInstancedNV(__VA_ARGS__))
+#define glDeformSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeformSGIX(__VA_ARGS__))
+#define glUniform2ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2ui64NV(__VA_ARGS__))
+#define glCopyPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyPathNV(__VA_ARGS__))
+#define glVertexAttribP4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP4ui(__VA_ARGS__))
+#define glVertexAttribL2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2d(__VA_ARGS__))
+#define glGetMultisamplefv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultisamplefv(__VA_ARGS__))
+#define glCompressedMultiTexSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedMultiTexSubImage3DEXT(__VA_ARGS__))
+#define glVDPAURegisterOutputSurfaceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAURegisterOutputSurfaceNV(__VA_ARGS__))
+#define glMinSampleShading(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMinSampleShading(__VA_ARGS__))
+#define glProgramUniform4fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4fEXT(__VA_ARGS__))
+#define glCoverStrokePathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCoverStrokePathNV(__VA_ARGS__))
+#define glTextureImage2DMultisampleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage2DMultisampleNV(__VA_ARGS__))
+#define glVertex3bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3bOES(__VA_ARGS__))
+#define glImportMemoryWin32HandleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportMemoryWin32HandleEXT(__VA_ARGS__))
+#define glTessellationFactorAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTessellationFactorAMD(__VA_ARGS__))
+#define glDebugMessageControl(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageControl(__VA_ARGS__))
+#define glIsObjectBufferATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsObjectBufferATI(__VA_ARGS__))
+#define glPopAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPopAttrib(__VA_ARGS__))
+#define glProgramUniform4iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4iEXT(__VA_ARGS__))
+#define glVertexAttrib4ubNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4ubNV(__VA_ARGS__))
+#define glColorMaterial(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorMaterial(__VA_ARGS__))
+#define glVertexAttrib2svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2svARB(__VA_ARGS__))
+#define glMinSampleShadingARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMinSampleShadingARB(__VA_ARGS__))
+#define glColor3b(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3b(__VA_ARGS__))
+#define glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(__VA_ARGS__))
+#define glColor3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3f(__VA_ARGS__))
+#define glVDPAUGetSurfaceivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUGetSurfaceivNV(__VA_ARGS__))
+#define glColor3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3d(__VA_ARGS__))
+#define glGetnMapiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMapiv(__VA_ARGS__))
+#define glColor3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3i(__VA_ARGS__))
+#define glGetInternalformatSampleivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInternalformatSampleivNV(__VA_ARGS__))
+#define glVertexAttrib4ubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4ubv(__VA_ARGS__))
+#define glColor3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3s(__VA_ARGS__))
+#define glVertexAttribs4hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs4hvNV(__VA_ARGS__))
+#define glVertexAttrib4NubvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NubvARB(__VA_ARGS__))
+#define glMultiTexCoord3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3hvNV(__VA_ARGS__))
+#define glMatrixPushEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixPushEXT(__VA_ARGS__))
+#define glProgramUniform2fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2fEXT(__VA_ARGS__))
+#define glGetVertexArrayIndexediv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayIndexediv(__VA_ARGS__))
+#define glBlitFramebuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlitFramebuffer(__VA_ARGS__))
+#define glMultiTexCoordP2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP2ui(__VA_ARGS__))
+#define glColorPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorPointerListIBM(__VA_ARGS__))
+#define glVertexAttribL4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4d(__VA_ARGS__))
+#define glGetFragmentMaterialfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragmentMaterialfvSGIX(__VA_ARGS__))
+#define glVertex2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2iv(__VA_ARGS__))
+#define glGetTexEnvxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexEnvxvOES(__VA_ARGS__))
+#define glUniformMatrix3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3dv(__VA_ARGS__))
+#define glGetVertexAttribLdvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribLdvEXT(__VA_ARGS__))
+#define glTexCoordP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP3uiv(__VA_ARGS__))
+#define glDeformationMap3dSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeformationMap3dSGIX(__VA_ARGS__))
+#define glResumeTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResumeTransformFeedback(__VA_ARGS__))
+#define glInsertEventMarkerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInsertEventMarkerEXT(__VA_ARGS__))
+#define glTessellationModeAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTessellationModeAMD(__VA_ARGS__))
+#define glDrawCommandsAddressNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawCommandsAddressNV(__VA_ARGS__))
+#define glFogi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogi(__VA_ARGS__))
+#define glGetTexParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterxvOES(__VA_ARGS__))
+#define glVertexPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexPointer(__VA_ARGS__))
+#define glGetPerfMonitorCounterDataAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfMonitorCounterDataAMD(__VA_ARGS__))
+#define glFogf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogf(__VA_ARGS__))
+#define glMultiTexCoord1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1d(__VA_ARGS__))
+#define glMultiTexCoord1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1f(__VA_ARGS__))
+#define glGetMultiTexParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexParameterivEXT(__VA_ARGS__))
+#define glProgramUniformMatrix3x4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x4fvEXT(__VA_ARGS__))
+#define glVertexAttribI2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2i(__VA_ARGS__))
+#define glMultiTexCoord1i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1i(__VA_ARGS__))
+#define glDeleteSemaphoresEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteSemaphoresEXT(__VA_ARGS__))
+#define glLoadProgramNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadProgramNV(__VA_ARGS__))
+#define glWriteMaskEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWriteMaskEXT(__VA_ARGS__))
+#define glGetGraphicsResetStatus(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetGraphicsResetStatus(__VA_ARGS__))
+#define glVertexAttrib1fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1fv(__VA_ARGS__))
+#define glMultiTexCoord1s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1s(__VA_ARGS__))
+#define glImageTransformParameterfvHP(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImageTransformParameterfvHP(__VA_ARGS__))
+#define glFramebufferTexture2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture2D(__VA_ARGS__))
+#define glGetFragmentLightfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragmentLightfvSGIX(__VA_ARGS__))
+#define glListParameterfSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glListParameterfSGIX(__VA_ARGS__))
+#define glTexCoord3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3sv(__VA_ARGS__))
+#define glNamedFramebufferRenderbufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferRenderbufferEXT(__VA_ARGS__))
+#define glFragmentLightModelfSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightModelfSGIX(__VA_ARGS__))
+#define glIndexPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexPointerEXT(__VA_ARGS__))
+#define glBlendEquationSeparateATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationSeparateATI(__VA_ARGS__))
+#define glVertexArrayAttribIFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayAttribIFormat(__VA_ARGS__))
+#define glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(__VA_ARGS__))
+#define glReplacementCodeubvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeubvSUN(__VA_ARGS__))
+#define glGenFramebuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenFramebuffers(__VA_ARGS__))
+#define glPixelMapx(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelMapx(__VA_ARGS__))
+#define glTexSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage3DEXT(__VA_ARGS__))
+#define glGetAttachedShaders(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetAttachedShaders(__VA_ARGS__))
+#define glGetPixelTexGenParameterfvSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelTexGenParameterfvSGIS(__VA_ARGS__))
+#define glReplacementCodeuiNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiNormal3fVertex3fSUN(__VA_ARGS__))
+#define glGetDebugMessageLogAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDebugMessageLogAMD(__VA_ARGS__))
+#define glVertexStream4sATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4sATI(__VA_ARGS__))
+#define glVertexAttribs4dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs4dvNV(__VA_ARGS__))
+#define glGetnMapdvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMapdvARB(__VA_ARGS__))
+#define glOrthofOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glOrthofOES(__VA_ARGS__))
+#define glViewportArrayv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glViewportArrayv(__VA_ARGS__))
+#define glDrawElementArrayATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementArrayATI(__VA_ARGS__))
+#define glBufferStorageMemEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferStorageMemEXT(__VA_ARGS__))
+#define glGetPathColorGenfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathColorGenfvNV(__VA_ARGS__))
+#define glWindowPos3iMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3iMESA(__VA_ARGS__))
+#define glMultiTexCoord2s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2s(__VA_ARGS__))
+#define glVertex3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3dv(__VA_ARGS__))
+#define glVertexAttribI3uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3uivEXT(__VA_ARGS__))
+#define glUniform3ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3ui64ARB(__VA_ARGS__))
+#define glVertexAttrib2fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2fvNV(__VA_ARGS__))
+#define glGetNamedBufferSubDataEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferSubDataEXT(__VA_ARGS__))
+#define glConvolutionFilter2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionFilter2D(__VA_ARGS__))
+#define glMemoryBarrierByRegion(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMemoryBarrierByRegion(__VA_ARGS__))
+#define glVertexArrayBindingDivisor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayBindingDivisor(__VA_ARGS__))
+#define glMatrixRotatedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixRotatedEXT(__VA_ARGS__))
+#define glTexCoord2sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2sv(__VA_ARGS__))
+#define glIsProgramNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsProgramNV(__VA_ARGS__))
+#define glUniform2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2dv(__VA_ARGS__))
+#define glGetPixelMapuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelMapuiv(__VA_ARGS__))
+#define glDepthBoundsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthBoundsEXT(__VA_ARGS__))
+#define glVertexAttrib4hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4hvNV(__VA_ARGS__))
+#define glMultiTexParameteriEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexParameteriEXT(__VA_ARGS__))
+#define glGetPointerv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPointerv(__VA_ARGS__))
+#define glPathCommandsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathCommandsNV(__VA_ARGS__))
+#define glGetListParameterfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetListParameterfvSGIX(__VA_ARGS__))
+#define glGetUniformuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformuiv(__VA_ARGS__))
+#define glDebugMessageInsertAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageInsertAMD(__VA_ARGS__))
+#define glFrustum(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFrustum(__VA_ARGS__))
+#define glVertexAttribL1ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1ui64vNV(__VA_ARGS__))
+#define glClearColorxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearColorxOES(__VA_ARGS__))
+#define glProgramUniformMatrix3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3fv(__VA_ARGS__))
+#define glSampleMaskIndexedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleMaskIndexedNV(__VA_ARGS__))
+#define glCompileShaderIncludeARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompileShaderIncludeARB(__VA_ARGS__))
+#define glGetArrayObjectfvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetArrayObjectfvATI(__VA_ARGS__))
+#define glVertexStream4svATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4svATI(__VA_ARGS__))
+#define glMultiTexCoord4iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4iARB(__VA_ARGS__))
+#define glVariantfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantfvEXT(__VA_ARGS__))
+#define glMatrixLoadfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoadfEXT(__VA_ARGS__))
+#define glLoadIdentityDeformationMapSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadIdentityDeformationMapSGIX(__VA_ARGS__))
+#define glGetRenderbufferParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetRenderbufferParameteriv(__VA_ARGS__))
+#define glProgramUniform3fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3fEXT(__VA_ARGS__))
+#define glNamedRenderbufferStorage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedRenderbufferStorage(__VA_ARGS__))
+#define glBindFragDataLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindFragDataLocation(__VA_ARGS__))
+#define glPolygonOffsetClamp(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonOffsetClamp(__VA_ARGS__))
+#define glFogCoordPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordPointerListIBM(__VA_ARGS__))
+#define glFenceSync(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFenceSync(__VA_ARGS__))
+#define glGetVertexAttribIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribIivEXT(__VA_ARGS__))
+#define glFramebufferDrawBuffersEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferDrawBuffersEXT(__VA_ARGS__))
+#define glVertexAttribs4fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs4fvNV(__VA_ARGS__))
+#define glPauseTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPauseTransformFeedbackNV(__VA_ARGS__))
+#define glGetQueryObjecti64vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjecti64vEXT(__VA_ARGS__))
+#define glVDPAUSurfaceAccessNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUSurfaceAccessNV(__VA_ARGS__))
+#define glValidateProgramPipeline(...) (ge::gl::setCallSite(__FILE__,__LINE__),glValidateProgramPipeline(__VA_ARGS__))
+#define glTexPageCommitmentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexPageCommitmentARB(__VA_ARGS__))
+#define glWindowPos3dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3dvARB(__VA_ARGS__))
+#define glStencilStrokePathInstancedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilStrokePathInstancedNV(__VA_ARGS__))
+#define glFogfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogfv(__VA_ARGS__))
+#define glGenQueriesARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenQueriesARB(__VA_ARGS__))
+#define glProgramUniform2i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2i64NV(__VA_ARGS__))
+#define glVertexP4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexP4ui(__VA_ARGS__))
+#define glVertexStream1ivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1ivATI(__VA_ARGS__))
+#define glProgramEnvParameterI4iNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameterI4iNV(__VA_ARGS__))
+#define glGenVertexArraysAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenVertexArraysAPPLE(__VA_ARGS__))
+#define glDrawTransformFeedbackInstanced(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawTransformFeedbackInstanced(__VA_ARGS__))
+#define glStencilThenCoverStrokePathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilThenCoverStrokePathNV(__VA_ARGS__))
+#define glDeleteVertexArraysAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteVertexArraysAPPLE(__VA_ARGS__))
+#define glGetNamedBufferParameterui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferParameterui64vNV(__VA_ARGS__))
+#define glQueryMatrixxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glQueryMatrixxOES(__VA_ARGS__))
+#define glSecondaryColor3usv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3usv(__VA_ARGS__))
+#define glTranslatexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTranslatexOES(__VA_ARGS__))
+#define glDrawTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawTransformFeedback(__VA_ARGS__))
+#define glTexCoord2fColor4fNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fColor4fNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glVDPAURegisterVideoSurfaceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAURegisterVideoSurfaceNV(__VA_ARGS__))
+#define glGetTexParameterIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterIuiv(__VA_ARGS__))
+#define glBindBufferBaseNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferBaseNV(__VA_ARGS__))
+#define glIndexPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexPointer(__VA_ARGS__))
+#define glGenQueryResourceTagNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenQueryResourceTagNV(__VA_ARGS__))
+#define glVertexAttrib4Nbv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Nbv(__VA_ARGS__))
+#define glListParameteriSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glListParameteriSGIX(__VA_ARGS__))
+#define glBlendColorxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendColorxOES(__VA_ARGS__))
+#define glUniformui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformui64vNV(__VA_ARGS__))
+#define glIsSync(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsSync(__VA_ARGS__))
+#define glGetTextureParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterivEXT(__VA_ARGS__))
+#define glFogCoordhvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordhvNV(__VA_ARGS__))
+#define glFramebufferTextureLayerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureLayerEXT(__VA_ARGS__))
+#define glGetObjectPtrLabel(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectPtrLabel(__VA_ARGS__))
+#define glTextureParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameteri(__VA_ARGS__))
+#define glMultiTexCoord1fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1fARB(__VA_ARGS__))
+#define glUniformMatrix2x3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2x3dv(__VA_ARGS__))
+#define glFramebufferDrawBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferDrawBufferEXT(__VA_ARGS__))
+#define glCopyColorSubTable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyColorSubTable(__VA_ARGS__))
+#define glGetNamedFramebufferParameterfvAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedFramebufferParameterfvAMD(__VA_ARGS__))
+#define glVertexAttribL3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3d(__VA_ARGS__))
+#define glFragmentMaterialfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentMaterialfvSGIX(__VA_ARGS__))
+#define glMatrixLoadTranspose3x3fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoadTranspose3x3fNV(__VA_ARGS__))
+#define glDeleteNamesAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteNamesAMD(__VA_ARGS__))
+#define glDrawRangeElementsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawRangeElementsEXT(__VA_ARGS__))
+#define glOrtho(...) (ge::gl::setCallSite(__FILE__,__LINE__),glOrtho(__VA_ARGS__))
+#define glProgramUniform1dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1dvEXT(__VA_ARGS__))
+#define glColor4xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4xOES(__VA_ARGS__))
+#define glTexImage4DSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage4DSGIS(__VA_ARGS__))
+#define glProgramUniform1ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1ui(__VA_ARGS__))
+#define glDeleteBuffersARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteBuffersARB(__VA_ARGS__))
+#define glUnmapBufferARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnmapBufferARB(__VA_ARGS__))
+#define glCopyTexImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexImage2D(__VA_ARGS__))
+#define glMaterialxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaterialxOES(__VA_ARGS__))
+#define glProgramUniformMatrix2x4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x4fvEXT(__VA_ARGS__))
+#define glTestObjectAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTestObjectAPPLE(__VA_ARGS__))
+#define glRenderbufferStorageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderbufferStorageEXT(__VA_ARGS__))
+#define glVertexAttribL1ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1ui64ARB(__VA_ARGS__))
+#define glEndFragmentShaderATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndFragmentShaderATI(__VA_ARGS__))
+#define glPathParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathParameterivNV(__VA_ARGS__))
+#define glUniform4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4uiv(__VA_ARGS__))
+#define glFrameZoomSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFrameZoomSGIX(__VA_ARGS__))
+#define glSecondaryColor3fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3fEXT(__VA_ARGS__))
+#define glLGPUInterlockNVX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLGPUInterlockNVX(__VA_ARGS__))
+#define glVertexAttribL1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1dv(__VA_ARGS__))
+#define glNormalStream3svATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3svATI(__VA_ARGS__))
+#define glPathStencilFuncNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathStencilFuncNV(__VA_ARGS__))
+#define glSetInvariantEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSetInvariantEXT(__VA_ARGS__))
+#define glGetTexBumpParameterivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexBumpParameterivATI(__VA_ARGS__))
+#define glBlendEquationSeparateEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationSeparateEXT(__VA_ARGS__))
+#define glEndOcclusionQueryNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndOcclusionQueryNV(__VA_ARGS__))
+#define glScissorArrayv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScissorArrayv(__VA_ARGS__))
+#define glCallList(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCallList(__VA_ARGS__))
+#define glMapTexture2DINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapTexture2DINTEL(__VA_ARGS__))
+#define glGetVkProcAddrNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVkProcAddrNV(__VA_ARGS__))
+#define glPixelTransferxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransferxOES(__VA_ARGS__))
+#define glDeleteRenderbuffersEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteRenderbuffersEXT(__VA_ARGS__))
+#define glTexCoord4fColor4fNormal3fVertex4fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4fColor4fNormal3fVertex4fSUN(__VA_ARGS__))
+#define glProgramUniformMatrix4dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4dvEXT(__VA_ARGS__))
+#define glGetnColorTable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnColorTable(__VA_ARGS__))
+#define glFramebufferTextureLayerARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureLayerARB(__VA_ARGS__))
+#define glVertexAttribL2dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2dvEXT(__VA_ARGS__))
+#define glGetCombinerStageParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCombinerStageParameterfvNV(__VA_ARGS__))
+#define glMultiTexCoord1xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1xvOES(__VA_ARGS__))
+#define glMapBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapBuffer(__VA_ARGS__))
+#define glSecondaryColor3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3d(__VA_ARGS__))
+#define glSecondaryColor3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3f(__VA_ARGS__))
+#define glVertexAttribLFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribLFormat(__VA_ARGS__))
+#define glElementPointerAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glElementPointerAPPLE(__VA_ARGS__))
+#define glVertexStream1fATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1fATI(__VA_ARGS__))
+#define glCoverageModulationNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCoverageModulationNV(__VA_ARGS__))
+#define glSecondaryColor3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3i(__VA_ARGS__))
+#define glDeleteSync(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteSync(__VA_ARGS__))
+#define glGetProgramParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramParameterfvNV(__VA_ARGS__))
+#define glMaxShaderCompilerThreadsARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaxShaderCompilerThreadsARB(__VA_ARGS__))
+#define glUniformMatrix4x2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4x2dv(__VA_ARGS__))
+#define glVertexArrayVertexAttribLOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribLOffsetEXT(__VA_ARGS__))
+#define glSecondaryColor3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3s(__VA_ARGS__))
+#define glIsImageHandleResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsImageHandleResidentNV(__VA_ARGS__))
+#define glUniform3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3iv(__VA_ARGS__))
+#define glVertexAttribL3i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3i64vNV(__VA_ARGS__))
+#define glPolygonMode(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonMode(__VA_ARGS__))
+#define glFramebufferSamplePositionsfvAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferSamplePositionsfvAMD(__VA_ARGS__))
+#define glConvolutionFilter1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionFilter1DEXT(__VA_ARGS__))
+#define glVertexAttrib1dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1dvARB(__VA_ARGS__))
+#define glTextureSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureSubImage2DEXT(__VA_ARGS__))
+#define glIsVertexArrayAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsVertexArrayAPPLE(__VA_ARGS__))
+#define glUseProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUseProgram(__VA_ARGS__))
+#define glLineStipple(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLineStipple(__VA_ARGS__))
+#define glMultiTexCoord4fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4fvARB(__VA_ARGS__))
+#define glVideoCaptureNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVideoCaptureNV(__VA_ARGS__))
+#define glVertexArrayVertexAttribLFormatEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribLFormatEXT(__VA_ARGS__))
+#define glUniform3fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3fvARB(__VA_ARGS__))
+#define glProgramUniformMatrix3x2fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x2fvEXT(__VA_ARGS__))
+#define glCopyTextureSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureSubImage3DEXT(__VA_ARGS__))
+#define glMultiTexCoord2bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2bvOES(__VA_ARGS__))
+#define glDeleteObjectARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteObjectARB(__VA_ARGS__))
+#define glTextureLightEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureLightEXT(__VA_ARGS__))
+#define glRasterPos3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3i(__VA_ARGS__))
+#define glMultiTexCoord3dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3dARB(__VA_ARGS__))
+#define glNamedFramebufferTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTextureEXT(__VA_ARGS__))
+#define glTextureParameteriEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameteriEXT(__VA_ARGS__))
+#define glEvalCoord2xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord2xvOES(__VA_ARGS__))
+#define glBindVideoCaptureStreamBufferNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVideoCaptureStreamBufferNV(__VA_ARGS__))
+#define glTexImage2DMultisampleCoverageNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage2DMultisampleCoverageNV(__VA_ARGS__))
+#define glGetAttribLocationARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetAttribLocationARB(__VA_ARGS__))
+#define glDeleteShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteShader(__VA_ARGS__))
+#define glVertexAttrib1fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1fARB(__VA_ARGS__))
+#define glTexCoord2fColor4ubVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fColor4ubVertex3fSUN(__VA_ARGS__))
+#define glTexCoord4fVertex4fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4fVertex4fSUN(__VA_ARGS__))
+#define glGetMapdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapdv(__VA_ARGS__))
+#define glMapParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapParameterfvNV(__VA_ARGS__))
+#define glTextureParameterIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterIuiv(__VA_ARGS__))
+#define glTransformFeedbackAttribsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackAttribsNV(__VA_ARGS__))
+#define glFragmentLightfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightfvSGIX(__VA_ARGS__))
+#define glWindowPos3sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3sARB(__VA_ARGS__))
+#define glGetConvolutionParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionParameterfv(__VA_ARGS__))
+#define glCopyTexSubImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexSubImage3D(__VA_ARGS__))
+#define glVertexAttribI3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3i(__VA_ARGS__))
+#define glCreateShaderObjectARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateShaderObjectARB(__VA_ARGS__))
+#define glVertexAttribFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribFormat(__VA_ARGS__))
+#define glGetProgramivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramivARB(__VA_ARGS__))
+#define glVertexAttribI4usv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4usv(__VA_ARGS__))
+#define glTexParameterf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterf(__VA_ARGS__))
+#define glVertexAttribBinding(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribBinding(__VA_ARGS__))
+#define glGetHistogramParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogramParameteriv(__VA_ARGS__))
+#define glTexParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameteri(__VA_ARGS__))
+#define glGetShaderSource(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetShaderSource(__VA_ARGS__))
+#define glVertexAttrib4s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4s(__VA_ARGS__))
+#define glVertexAttrib4dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4dvNV(__VA_ARGS__))
+#define glVertexAttrib1dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1dvNV(__VA_ARGS__))
+#define glPopName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPopName(__VA_ARGS__))
+#define glTextureBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureBufferEXT(__VA_ARGS__))
+#define glGetMultiTexImageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexImageEXT(__VA_ARGS__))
+#define glGetPointerIndexedvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPointerIndexedvEXT(__VA_ARGS__))
+#define glIsNameAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsNameAMD(__VA_ARGS__))
+#define glColor4ub(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ub(__VA_ARGS__))
+#define glBufferParameteriAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferParameteriAPPLE(__VA_ARGS__))
+#define glColor4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ui(__VA_ARGS__))
+#define glGetInternalformativ(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInternalformativ(__VA_ARGS__))
+#define glColor4us(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4us(__VA_ARGS__))
+#define glVertexAttribP1uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP1uiv(__VA_ARGS__))
+#define glLinkProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLinkProgram(__VA_ARGS__))
+#define glTexCoord3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3s(__VA_ARGS__))
+#define glTexCoord2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2dv(__VA_ARGS__))
+#define glGetObjectLabel(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectLabel(__VA_ARGS__))
+#define glVertexPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexPointerEXT(__VA_ARGS__))
+#define glDebugMessageCallbackARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageCallbackARB(__VA_ARGS__))
+#define glGetString(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetString(__VA_ARGS__))
+#define glGetPathParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathParameterfvNV(__VA_ARGS__))
+#define glLightxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightxvOES(__VA_ARGS__))
+#define glEndQuery(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndQuery(__VA_ARGS__))
+#define glSecondaryColor3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3uiv(__VA_ARGS__))
+#define glPrioritizeTexturesxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrioritizeTexturesxOES(__VA_ARGS__))
+#define glEdgeFlagPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEdgeFlagPointer(__VA_ARGS__))
+#define glFramebufferParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferParameteri(__VA_ARGS__))
+#define glTexCoord3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3hNV(__VA_ARGS__))
+#define glMultiModeDrawElementsIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiModeDrawElementsIBM(__VA_ARGS__))
+#define glCopyPixels(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyPixels(__VA_ARGS__))
+#define glVertexAttribI2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2ui(__VA_ARGS__))
+#define glClampColorARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClampColorARB(__VA_ARGS__))
+#define glColorPointervINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorPointervINTEL(__VA_ARGS__))
+#define glDeleteTextures(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteTextures(__VA_ARGS__))
+#define glGetMinmaxParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMinmaxParameterfvEXT(__VA_ARGS__))
+#define glWindowPos3sMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3sMESA(__VA_ARGS__))
+#define glVertexAttrib4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4f(__VA_ARGS__))
+#define glNamedFramebufferParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferParameteri(__VA_ARGS__))
+#define glTexCoord2fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fVertex3fvSUN(__VA_ARGS__))
+#define glReplacementCodeusSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeusSUN(__VA_ARGS__))
+#define glGetNamedFramebufferParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedFramebufferParameteriv(__VA_ARGS__))
+#define glVertexStream1fvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1fvATI(__VA_ARGS__))
+#define glCreateVertexArrays(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateVertexArrays(__VA_ARGS__))
+#define glBeginConditionalRender(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginConditionalRender(__VA_ARGS__))
+#define glGetUnsignedBytevEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUnsignedBytevEXT(__VA_ARGS__))
+#define glConvolutionFilter1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionFilter1D(__VA_ARGS__))
+#define glMultiTexCoord3fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3fARB(__VA_ARGS__))
+#define glGetQueryObjectuivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjectuivARB(__VA_ARGS__))
+#define glScalexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScalexOES(__VA_ARGS__))
+#define glSamplerParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplerParameteri(__VA_ARGS__))
+#define glSamplerParameterf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplerParameterf(__VA_ARGS__))
+#define glShaderOp1EXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderOp1EXT(__VA_ARGS__))
+#define glBeginVideoCaptureNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginVideoCaptureNV(__VA_ARGS__))
+#define glGetnHistogram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnHistogram(__VA_ARGS__))
+#define glUniform1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1d(__VA_ARGS__))
+#define glRenderMode(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderMode(__VA_ARGS__))
+#define glClearColorIiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearColorIiEXT(__VA_ARGS__))
+#define glSignalSemaphoreEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSignalSemaphoreEXT(__VA_ARGS__))
+#define glGetCompressedTexImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCompressedTexImage(__VA_ARGS__))
+#define glCompressedTextureImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureImage1DEXT(__VA_ARGS__))
+#define glGetActiveUniformBlockiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveUniformBlockiv(__VA_ARGS__))
+#define glUniform1i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1i(__VA_ARGS__))
+#define glMultiDrawArraysIndirectCount(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysIndirectCount(__VA_ARGS__))
+#define glGetTexEnvfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexEnvfv(__VA_ARGS__))
+#define glColorTableParameterivSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTableParameterivSGI(__VA_ARGS__))
+#define glCullFace(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCullFace(__VA_ARGS__))
+#define glDeleteFencesAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteFencesAPPLE(__VA_ARGS__))
+#define glProgramUniform4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4i(__VA_ARGS__))
+#define glUniformHandleui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformHandleui64ARB(__VA_ARGS__))
+#define glProgramUniform4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4f(__VA_ARGS__))
+#define glViewportIndexedf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glViewportIndexedf(__VA_ARGS__))
+#define glProgramUniform4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4d(__VA_ARGS__))
+#define glTexCoord1xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1xOES(__VA_ARGS__))
+#define glVertexStream3ivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3ivATI(__VA_ARGS__))
+#define glPointAlongPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointAlongPathNV(__VA_ARGS__))
+#define glEndQueryARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndQueryARB(__VA_ARGS__))
+#define glVDPAUMapSurfacesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUMapSurfacesNV(__VA_ARGS__))
+#define glVertex3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3i(__VA_ARGS__))
+#define glVertexAttrib4uivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4uivARB(__VA_ARGS__))
+#define glTextureStorageMem3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorageMem3DEXT(__VA_ARGS__))
+#define glAttachShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAttachShader(__VA_ARGS__))
+#define glColor4hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4hNV(__VA_ARGS__))
+#define glGetFenceivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFenceivNV(__VA_ARGS__))
+#define glTexCoord2fColor4ubVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fColor4ubVertex3fvSUN(__VA_ARGS__))
+#define glGetColorTable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTable(__VA_ARGS__))
+#define glFogCoordPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordPointer(__VA_ARGS__))
+#define glTexStorageSparseAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorageSparseAMD(__VA_ARGS__))
+#define glUnmapNamedBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnmapNamedBuffer(__VA_ARGS__))
+#define glTexCoord4bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4bvOES(__VA_ARGS__))
+#define glVertexAttrib3fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3fARB(__VA_ARGS__))
+#define glRasterPos2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2xOES(__VA_ARGS__))
+#define glCreateMemoryObjectsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateMemoryObjectsEXT(__VA_ARGS__))
+#define glColor4ubVertex2fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ubVertex2fvSUN(__VA_ARGS__))
+#define glSecondaryColor3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3dv(__VA_ARGS__))
+#define glVertexAttribI4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4sv(__VA_ARGS__))
+#define glDrawTransformFeedbackStreamInstanced(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawTransformFeedbackStreamInstanced(__VA_ARGS__))
+#define glMultiTexCoord4ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4ivARB(__VA_ARGS__))
+#define glSpriteParameterfSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSpriteParameterfSGIX(__VA_ARGS__))
+#define glSecondaryColor3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3sv(__VA_ARGS__))
+#define glBindVideoCaptureStreamTextureNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVideoCaptureStreamTextureNV(__VA_ARGS__))
+#define glTexParameterIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterIuiv(__VA_ARGS__))
+#define glFlushPixelDataRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushPixelDataRangeNV(__VA_ARGS__))
+#define glWindowPos3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3fv(__VA_ARGS__))
+#define glVertexAttribLFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribLFormatNV(__VA_ARGS__))
+#define glLightModelfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightModelfv(__VA_ARGS__))
+#define glGetColorTableSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableSGI(__VA_ARGS__))
+#define glGetCompressedTexImageARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCompressedTexImageARB(__VA_ARGS__))
+#define glConvolutionParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameteri(__VA_ARGS__))
+#define glVertexWeighthNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexWeighthNV(__VA_ARGS__))
+#define glColorMaskIndexedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorMaskIndexedEXT(__VA_ARGS__))
+#define glColorMaski(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorMaski(__VA_ARGS__))
+#define glColorFragmentOp1ATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorFragmentOp1ATI(__VA_ARGS__))
+#define glVertexAttribI4ubvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4ubvEXT(__VA_ARGS__))
+#define glVertexAttrib1dNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1dNV(__VA_ARGS__))
+#define glUnmapObjectBufferATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnmapObjectBufferATI(__VA_ARGS__))
+#define glNamedProgramLocalParameterI4uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameterI4uiEXT(__VA_ARGS__))
+#define glProgramUniform1iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1iEXT(__VA_ARGS__))
+#define glDeleteQueriesARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteQueriesARB(__VA_ARGS__))
+#define glWindowPos3svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3svARB(__VA_ARGS__))
+#define glVertex4s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4s(__VA_ARGS__))
+#define glImportMemoryWin32NameEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportMemoryWin32NameEXT(__VA_ARGS__))
+#define glStringMarkerGREMEDY(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStringMarkerGREMEDY(__VA_ARGS__))
+#define glIsTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsTransformFeedback(__VA_ARGS__))
+#define glProgramUniformMatrix2x3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x3dvEXT(__VA_ARGS__))
+#define glGetObjectLabelEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectLabelEXT(__VA_ARGS__))
+#define glUniformHandleui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformHandleui64vNV(__VA_ARGS__))
+#define glRotated(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRotated(__VA_ARGS__))
+#define glIsProgramPipeline(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsProgramPipeline(__VA_ARGS__))
+#define glRotatef(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRotatef(__VA_ARGS__))
+#define glVertex4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4i(__VA_ARGS__))
+#define glGetActiveSubroutineUniformName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveSubroutineUniformName(__VA_ARGS__))
+#define glVertexAttrib4sNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4sNV(__VA_ARGS__))
+#define glProgramLocalParameter4dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameter4dvARB(__VA_ARGS__))
+#define glReplacementCodeubSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeubSUN(__VA_ARGS__))
+#define glMultiDrawElementsIndirectBindlessNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsIndirectBindlessNV(__VA_ARGS__))
+#define glImportSemaphoreWin32HandleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportSemaphoreWin32HandleEXT(__VA_ARGS__))
+#define glUniformMatrix3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3fv(__VA_ARGS__))
+#define glGetnMapfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMapfvARB(__VA_ARGS__))
+#define glGetnUniformfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformfv(__VA_ARGS__))
+#define glVertexAttribL2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2dv(__VA_ARGS__))
+#define glVertexWeightPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexWeightPointerEXT(__VA_ARGS__))
+#define glTangent3sEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3sEXT(__VA_ARGS__))
+#define glSecondaryColorPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColorPointer(__VA_ARGS__))
+#define glAlphaFunc(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAlphaFunc(__VA_ARGS__))
+#define glGetNamedStringARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedStringARB(__VA_ARGS__))
+#define glTexCoord4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4d(__VA_ARGS__))
+#define glBufferPageCommitmentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferPageCommitmentARB(__VA_ARGS__))
+#define glProgramLocalParameters4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameters4fvEXT(__VA_ARGS__))
+#define glStencilFunc(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilFunc(__VA_ARGS__))
+#define glSemaphoreParameterui64vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSemaphoreParameterui64vEXT(__VA_ARGS__))
+#define glGetVertexAttribdvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribdvNV(__VA_ARGS__))
+#define glTexCoord3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3dv(__VA_ARGS__))
+#define glGetQueryBufferObjectiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryBufferObjectiv(__VA_ARGS__))
+#define glTexGenxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGenxOES(__VA_ARGS__))
+#define glMultiTexCoord1fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1fvARB(__VA_ARGS__))
+#define glLightEnviSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightEnviSGIX(__VA_ARGS__))
+#define glGetProgramPipelineiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramPipelineiv(__VA_ARGS__))
+#define glVertexStream2ivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2ivATI(__VA_ARGS__))
+#define glGetColorTableEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableEXT(__VA_ARGS__))
+#define glGetShaderInfoLog(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetShaderInfoLog(__VA_ARGS__))
+#define glGetOcclusionQueryuivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetOcclusionQueryuivNV(__VA_ARGS__))
+#define glInvalidateNamedFramebufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateNamedFramebufferSubData(__VA_ARGS__))
+#define glVertexAttribL1i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1i64NV(__VA_ARGS__))
+#define glVDPAUInitNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUInitNV(__VA_ARGS__))
+#define glVertexAttrib1hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1hvNV(__VA_ARGS__))
+#define glVertexAttribI4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4i(__VA_ARGS__))
+#define glRasterPos2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2iv(__VA_ARGS__))
+#define glGetIntegerui64i_vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetIntegerui64i_vNV(__VA_ARGS__))
+#define glUniformHandleui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformHandleui64NV(__VA_ARGS__))
+#define glWindowPos3ivMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3ivMESA(__VA_ARGS__))
+#define glBlendEquationSeparate(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationSeparate(__VA_ARGS__))
+#define glDrawElementsInstancedARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsInstancedARB(__VA_ARGS__))
+#define glGetSubroutineIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSubroutineIndex(__VA_ARGS__))
+#define glVertexAttrib2sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2sv(__VA_ARGS__))
+#define glSamplePatternSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplePatternSGIS(__VA_ARGS__))
+#define glEGLImageTargetRenderbufferStorageOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEGLImageTargetRenderbufferStorageOES(__VA_ARGS__))
+#define glPushAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushAttrib(__VA_ARGS__))
+#define glVertex3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3hNV(__VA_ARGS__))
+#define glRasterPos3xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3xvOES(__VA_ARGS__))
+#define glPathParameterfNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathParameterfNV(__VA_ARGS__))
+#define glGetUniformi64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformi64vNV(__VA_ARGS__))
+#define glLightiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightiv(__VA_ARGS__))
+#define glMaterialxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaterialxvOES(__VA_ARGS__))
+#define glNamedProgramLocalParameter4fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameter4fEXT(__VA_ARGS__))
+#define glVertexAttribL1dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1dEXT(__VA_ARGS__))
+#define glGetnUniformdvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformdvARB(__VA_ARGS__))
+#define glSecondaryColor3bEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3bEXT(__VA_ARGS__))
+#define glBeginPerfQueryINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginPerfQueryINTEL(__VA_ARGS__))
+#define glProgramUniform1uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1uivEXT(__VA_ARGS__))
+#define glImageTransformParameterivHP(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImageTransformParameterivHP(__VA_ARGS__))
+#define glDeleteBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteBuffers(__VA_ARGS__))
+#define glBindProgramPipeline(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindProgramPipeline(__VA_ARGS__))
+#define glScissor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScissor(__VA_ARGS__))
+#define glProgramUniform4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4fv(__VA_ARGS__))
+#define glGetBooleanv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBooleanv(__VA_ARGS__))
+#define glMaterialfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaterialfv(__VA_ARGS__))
+#define glWindowPos4fvMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4fvMESA(__VA_ARGS__))
+#define glVertexAttribIPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribIPointerEXT(__VA_ARGS__))
+#define glProgramBufferParametersfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramBufferParametersfvNV(__VA_ARGS__))
+#define glAlphaFuncxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAlphaFuncxOES(__VA_ARGS__))
+#define glMultiDrawArraysIndirectAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysIndirectAMD(__VA_ARGS__))
+#define glNormalStream3ivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3ivATI(__VA_ARGS__))
+#define glTextureImage3DMultisampleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage3DMultisampleNV(__VA_ARGS__))
+#define glProgramUniform4uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4uivEXT(__VA_ARGS__))
+#define glReplacementCodeusvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeusvSUN(__VA_ARGS__))
+#define glPollInstrumentsSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPollInstrumentsSGIX(__VA_ARGS__))
+#define glGetTextureLevelParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureLevelParameteriv(__VA_ARGS__))
+#define glVertexAttribI2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2uiv(__VA_ARGS__))
+#define glMapControlPointsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapControlPointsNV(__VA_ARGS__))
+#define glColor4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4dv(__VA_ARGS__))
+#define glInvalidateBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateBufferSubData(__VA_ARGS__))
+#define glMultiTexCoord1hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1hNV(__VA_ARGS__))
+#define glPointParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfv(__VA_ARGS__))
+#define glUniformMatrix2fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2fvARB(__VA_ARGS__))
+#define glUniform2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2fv(__VA_ARGS__))
+#define glVertexPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexPointerListIBM(__VA_ARGS__))
+#define glGetMultiTexGenfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexGenfvEXT(__VA_ARGS__))
+#define glGetMinmaxEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMinmaxEXT(__VA_ARGS__))
+#define glIsFenceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsFenceNV(__VA_ARGS__))
+#define glMatrixFrustumEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixFrustumEXT(__VA_ARGS__))
+#define glDispatchComputeIndirect(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDispatchComputeIndirect(__VA_ARGS__))
+#define glQueryResourceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glQueryResourceNV(__VA_ARGS__))
+#define glMultiTexCoord4bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4bOES(__VA_ARGS__))
+#define glProgramEnvParameter4dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameter4dARB(__VA_ARGS__))
+#define glProgramUniform1uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1uiEXT(__VA_ARGS__))
+#define glBindBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferRange(__VA_ARGS__))
+#define glNormal3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3iv(__VA_ARGS__))
+#define glVertexAttribL3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3dv(__VA_ARGS__))
+#define glGetUniformdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformdv(__VA_ARGS__))
+#define glGetMultiTexLevelParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexLevelParameterfvEXT(__VA_ARGS__))
+#define glFinalCombinerInputNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinalCombinerInputNV(__VA_ARGS__))
+#define glCullParameterdvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCullParameterdvEXT(__VA_ARGS__))
+#define glMultiTexCoord4s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4s(__VA_ARGS__))
+#define glMapVertexAttrib1fAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapVertexAttrib1fAPPLE(__VA_ARGS__))
+#define glConvolutionParameterfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterfEXT(__VA_ARGS__))
+#define glTexCoord1iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1iv(__VA_ARGS__))
+#define glProgramUniform3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3fvEXT(__VA_ARGS__))
+#define glColor3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3uiv(__VA_ARGS__))
+#define glRenderGpuMaskNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderGpuMaskNV(__VA_ARGS__))
+#define glListBase(...) (ge::gl::setCallSite(__FILE__,__LINE__),glListBase(__VA_ARGS__))
+#define glTexCoord2bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2bOES(__VA_ARGS__))
+#define glBindMaterialParameterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindMaterialParameterEXT(__VA_ARGS__))
+#define glGlobalAlphaFactorubSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactorubSUN(__VA_ARGS__))
+#define glVertexAttribL1ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1ui64NV(__VA_ARGS__))
+#define glPointParameterfSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfSGIS(__VA_ARGS__))
+#define glGetImageTransformParameterivHP(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetImageTransformParameterivHP(__VA_ARGS__))
+#define glColorSubTableEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorSubTableEXT(__VA_ARGS__))
+#define glPixelTexGenParameterfvSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTexGenParameterfvSGIS(__VA_ARGS__))
+#define glClientWaitSync(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClientWaitSync(__VA_ARGS__))
+#define glQueryObjectParameteruiAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glQueryObjectParameteruiAMD(__VA_ARGS__))
+#define glVertexAttribs1fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs1fvNV(__VA_ARGS__))
+#define glVertexAttrib4NusvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NusvARB(__VA_ARGS__))
+#define glVariantPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantPointerEXT(__VA_ARGS__))
+#define glTextureBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureBuffer(__VA_ARGS__))
+#define glVertexAttribI1uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1uiEXT(__VA_ARGS__))
+#define glInvalidateTexImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateTexImage(__VA_ARGS__))
+#define glProgramEnvParametersI4ivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParametersI4ivNV(__VA_ARGS__))
+#define glPathGlyphIndexArrayNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathGlyphIndexArrayNV(__VA_ARGS__))
+#define glCopyImageSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyImageSubData(__VA_ARGS__))
+#define glGetUniformSubroutineuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformSubroutineuiv(__VA_ARGS__))
+#define glBindVertexBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVertexBuffer(__VA_ARGS__))
+#define glMultiTexCoord1iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1iARB(__VA_ARGS__))
+#define glDebugMessageInsert(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageInsert(__VA_ARGS__))
+#define glBeginVertexShaderEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginVertexShaderEXT(__VA_ARGS__))
+#define glIsVariantEnabledEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsVariantEnabledEXT(__VA_ARGS__))
+#define glPassThroughxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPassThroughxOES(__VA_ARGS__))
+#define glIsSampler(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsSampler(__VA_ARGS__))
+#define glConservativeRasterParameterfNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConservativeRasterParameterfNV(__VA_ARGS__))
+#define glMultiTexGenivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexGenivEXT(__VA_ARGS__))
+#define glNamedFramebufferTexture2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTexture2DEXT(__VA_ARGS__))
+#define glCopyTexSubImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexSubImage1D(__VA_ARGS__))
+#define glTexCoord1i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1i(__VA_ARGS__))
+#define glCheckFramebufferStatus(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCheckFramebufferStatus(__VA_ARGS__))
+#define glDrawElementArrayAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementArrayAPPLE(__VA_ARGS__))
+#define glTexCoord1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1d(__VA_ARGS__))
+#define glTexCoord1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1f(__VA_ARGS__))
+#define glFragmentLightivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightivSGIX(__VA_ARGS__))
+#define glBindImageTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindImageTexture(__VA_ARGS__))
+#define glTransformFeedbackVaryings(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackVaryings(__VA_ARGS__))
+#define glMulticastBufferSubDataNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastBufferSubDataNV(__VA_ARGS__))
+#define glDrawRangeElements(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawRangeElements(__VA_ARGS__))
+#define glTexCoord1s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1s(__VA_ARGS__))
+#define glBindBufferBase(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferBase(__VA_ARGS__))
+#define glColor3bv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3bv(__VA_ARGS__))
+#define glSyncTextureINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSyncTextureINTEL(__VA_ARGS__))
+#define glCreateSamplers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateSamplers(__VA_ARGS__))
+#define glCombinerParameterfNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerParameterfNV(__VA_ARGS__))
+#define glGetArrayObjectivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetArrayObjectivATI(__VA_ARGS__))
+#define glMultiDrawArrays(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArrays(__VA_ARGS__))
+#define glSampleMapATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleMapATI(__VA_ARGS__))
+#define glProgramUniform2i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2i64ARB(__VA_ARGS__))
+#define glBinormal3ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3ivEXT(__VA_ARGS__))
+#define glMultiDrawArraysIndirectCountARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysIndirectCountARB(__VA_ARGS__))
+#define glTextureStorageMem1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorageMem1DEXT(__VA_ARGS__))
+#define glWindowPos2ivMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2ivMESA(__VA_ARGS__))
+#define glTexCoordP4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP4ui(__VA_ARGS__))
+#define glMultiTexSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexSubImage1DEXT(__VA_ARGS__))
+#define glProgramUniformMatrix2x3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x3fvEXT(__VA_ARGS__))
+#define glBufferDataARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferDataARB(__VA_ARGS__))
+#define glVertexAttribIFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribIFormat(__VA_ARGS__))
+#define glCreateFramebuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateFramebuffers(__VA_ARGS__))
+#define glNormalStream3dvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3dvATI(__VA_ARGS__))
+#define glClearAccum(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearAccum(__VA_ARGS__))
+#define glUniform3i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3i64vNV(__VA_ARGS__))
+#define glNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3fVertex3fSUN(__VA_ARGS__))
+#define glUniform2uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2uivEXT(__VA_ARGS__))
+#define glBeginQuery(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginQuery(__VA_ARGS__))
+#define glStencilThenCoverStrokePathInstancedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilThenCoverStrokePathInstancedNV(__VA_ARGS__))
+#define glBindBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBuffer(__VA_ARGS__))
+#define glMap2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMap2d(__VA_ARGS__))
+#define glMap2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMap2f(__VA_ARGS__))
+#define glMakeImageHandleResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeImageHandleResidentNV(__VA_ARGS__))
+#define glUniformMatrix2x4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2x4fv(__VA_ARGS__))
+#define glGetMultiTexParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexParameterfvEXT(__VA_ARGS__))
+#define glDepthRangeIndexed(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRangeIndexed(__VA_ARGS__))
+#define glIsEnabled(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsEnabled(__VA_ARGS__))
+#define glMatrixScalefEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixScalefEXT(__VA_ARGS__))
+#define glGetTexEnviv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexEnviv(__VA_ARGS__))
+#define glBindTextureUnitParameterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTextureUnitParameterEXT(__VA_ARGS__))
+#define glGetnUniformfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformfvARB(__VA_ARGS__))
+#define glReplacementCodeuiNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glDeletePerfQueryINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeletePerfQueryINTEL(__VA_ARGS__))
+#define glActiveVaryingNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glActiveVaryingNV(__VA_ARGS__))
+#define glGetActiveUniformARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveUniformARB(__VA_ARGS__))
+#define glVertexAttribI3ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3ivEXT(__VA_ARGS__))
+#define glEvalCoord1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord1d(__VA_ARGS__))
+#define glNamedCopyBufferSubDataEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedCopyBufferSubDataEXT(__VA_ARGS__))
+#define glEvalCoord1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord1f(__VA_ARGS__))
+#define glPixelMapfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelMapfv(__VA_ARGS__))
+#define glVertexAttribI1ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1ivEXT(__VA_ARGS__))
+#define glCreateSyncFromCLeventARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateSyncFromCLeventARB(__VA_ARGS__))
+#define glGetPixelMapusv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelMapusv(__VA_ARGS__))
+#define glGetnColorTableARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnColorTableARB(__VA_ARGS__))
+#define glAccum(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAccum(__VA_ARGS__))
+#define glRasterPos3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3sv(__VA_ARGS__))
+#define glTexCoord2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2iv(__VA_ARGS__))
+#define glBlendFunciARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFunciARB(__VA_ARGS__))
+#define glProgramUniform3i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3i64vARB(__VA_ARGS__))
+#define glGetFramebufferAttachmentParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFramebufferAttachmentParameteriv(__VA_ARGS__))
+#define glProgramUniform4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4ui(__VA_ARGS__))
+#define glStencilMask(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilMask(__VA_ARGS__))
+#define glResetHistogramEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResetHistogramEXT(__VA_ARGS__))
+#define glLightxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightxOES(__VA_ARGS__))
+#define glNamedBufferData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferData(__VA_ARGS__))
+#define glVertexStream3sATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3sATI(__VA_ARGS__))
+#define glVertexAttrib3fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3fvARB(__VA_ARGS__))
+#define glClearNamedBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedBufferSubData(__VA_ARGS__))
+#define glProgramUniformHandleui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformHandleui64ARB(__VA_ARGS__))
+#define glUniform3iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3iARB(__VA_ARGS__))
+#define glCreateProgramObjectARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateProgramObjectARB(__VA_ARGS__))
+#define glMultiTexCoord1dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1dvARB(__VA_ARGS__))
+#define glGetObjectParameterfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectParameterfvARB(__VA_ARGS__))
+#define glRectsv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectsv(__VA_ARGS__))
+#define glMultiTexImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexImage2DEXT(__VA_ARGS__))
+#define glProgramUniform1i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1i64NV(__VA_ARGS__))
+#define glGetObjectBufferivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectBufferivATI(__VA_ARGS__))
+#define glUniform4i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4i64ARB(__VA_ARGS__))
+#define glReplacementCodeuiColor4ubVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiColor4ubVertex3fvSUN(__VA_ARGS__))
+#define glBlendFuncSeparateINGR(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncSeparateINGR(__VA_ARGS__))
+#define glGetVideoCaptureStreamfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoCaptureStreamfvNV(__VA_ARGS__))
+#define glVertexAttrib2fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2fARB(__VA_ARGS__))
+#define glGetTexGeniv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexGeniv(__VA_ARGS__))
+#define glPixelStorei(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelStorei(__VA_ARGS__))
+#define glGetCompressedTextureSubImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCompressedTextureSubImage(__VA_ARGS__))
+#define glCopyImageSubDataNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyImageSubDataNV(__VA_ARGS__))
+#define glActiveShaderProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glActiveShaderProgram(__VA_ARGS__))
+#define glVertexStream1iATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1iATI(__VA_ARGS__))
+#define glPatchParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPatchParameterfv(__VA_ARGS__))
+#define glIsFramebufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsFramebufferEXT(__VA_ARGS__))
+#define glTextureStorage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage2D(__VA_ARGS__))
+#define glProgramUniform1ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1ui64ARB(__VA_ARGS__))
+#define glTexBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexBufferRange(__VA_ARGS__))
+#define glGetPixelTexGenParameterivSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelTexGenParameterivSGIS(__VA_ARGS__))
+#define glTextureSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureSubImage3DEXT(__VA_ARGS__))
+#define glClipControl(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClipControl(__VA_ARGS__))
+#define glGetProgramResourceiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramResourceiv(__VA_ARGS__))
+#define glMultiTexCoordP2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP2uiv(__VA_ARGS__))
+#define glVertexAttribI3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3ui(__VA_ARGS__))
+#define glSampleMaskSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleMaskSGIS(__VA_ARGS__))
+#define glVertexAttrib4NivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NivARB(__VA_ARGS__))
+#define glGlobalAlphaFactorfSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactorfSUN(__VA_ARGS__))
+#define glBlendEquationSeparateIndexedAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationSeparateIndexedAMD(__VA_ARGS__))
+#define glGetPerfCounterInfoINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfCounterInfoINTEL(__VA_ARGS__))
+#define glDeleteProgramsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteProgramsNV(__VA_ARGS__))
+#define glPixelZoomxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelZoomxOES(__VA_ARGS__))
+#define glGetCombinerOutputParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCombinerOutputParameterivNV(__VA_ARGS__))
+#define glRasterPos2xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2xvOES(__VA_ARGS__))
+#define glGetTexImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexImage(__VA_ARGS__))
+#define glVertexArrayVertexBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexBuffers(__VA_ARGS__))
+#define glUniform1ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1ui64NV(__VA_ARGS__))
+#define glProgramParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameteri(__VA_ARGS__))
+#define glNormal3xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3xOES(__VA_ARGS__))
+#define glGetMapfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapfv(__VA_ARGS__))
+#define glVertexStream2dvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2dvATI(__VA_ARGS__))
+#define glPathStencilDepthOffsetNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathStencilDepthOffsetNV(__VA_ARGS__))
+#define glIsStateNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsStateNV(__VA_ARGS__))
+#define glGetIntegerui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetIntegerui64vNV(__VA_ARGS__))
+#define glGetImageTransformParameterfvHP(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetImageTransformParameterfvHP(__VA_ARGS__))
+#define glRasterPos2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2fv(__VA_ARGS__))
+#define glVertex3xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3xOES(__VA_ARGS__))
+#define glIsMemoryObjectEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsMemoryObjectEXT(__VA_ARGS__))
+#define glWeightPointerARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightPointerARB(__VA_ARGS__))
+#define glFinishFenceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinishFenceNV(__VA_ARGS__))
+#define glDepthRangexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRangexOES(__VA_ARGS__))
+#define glEnableVertexArrayAttribEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVertexArrayAttribEXT(__VA_ARGS__))
+#define glProgramUniform2uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2uivEXT(__VA_ARGS__))
+#define glGetDoubleIndexedvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDoubleIndexedvEXT(__VA_ARGS__))
+#define glWindowPos2fMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2fMESA(__VA_ARGS__))
+#define glSecondaryColor3b(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3b(__VA_ARGS__))
+#define glCopyConvolutionFilter1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyConvolutionFilter1DEXT(__VA_ARGS__))
+#define glWindowPos2sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2sv(__VA_ARGS__))
+#define glBindFramebufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindFramebufferEXT(__VA_ARGS__))
+#define glCreateShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateShader(__VA_ARGS__))
+#define glGenPathsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenPathsNV(__VA_ARGS__))
+#define glGenRenderbuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenRenderbuffers(__VA_ARGS__))
+#define glCopyTexSubImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexSubImage2D(__VA_ARGS__))
+#define glVertexAttrib4ubvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4ubvARB(__VA_ARGS__))
+#define glDrawTextureNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawTextureNV(__VA_ARGS__))
+#define glVertexAttribs1svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs1svNV(__VA_ARGS__))
+#define glClearNamedBufferSubDataEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedBufferSubDataEXT(__VA_ARGS__))
+#define glBlendFuncSeparate(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncSeparate(__VA_ARGS__))
+#define glPointParameterfARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfARB(__VA_ARGS__))
+#define glTexCoord2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fv(__VA_ARGS__))
+#define glGetVariantFloatvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVariantFloatvEXT(__VA_ARGS__))
+#define glVertexP2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexP2ui(__VA_ARGS__))
+#define glWindowPos2dMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2dMESA(__VA_ARGS__))
+#define glTexCoord4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4fv(__VA_ARGS__))
+#define glBindFragDataLocationEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindFragDataLocationEXT(__VA_ARGS__))
+#define glCompressedTexSubImage1DARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexSubImage1DARB(__VA_ARGS__))
+#define glGetTextureImageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureImageEXT(__VA_ARGS__))
+#define glFogCoordd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordd(__VA_ARGS__))
+#define glPointSize(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointSize(__VA_ARGS__))
+#define glBindTextureUnit(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTextureUnit(__VA_ARGS__))
+#define glProgramEnvParameterI4uiNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameterI4uiNV(__VA_ARGS__))
+#define glGetProgramPipelineInfoLog(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramPipelineInfoLog(__VA_ARGS__))
+#define glProgramUniform4i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4i64vARB(__VA_ARGS__))
+#define glVertexAttrib4Nuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Nuiv(__VA_ARGS__))
+#define glGetUniformfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformfvARB(__VA_ARGS__))
+#define glWaitSync(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWaitSync(__VA_ARGS__))
+#define glUniform3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3i(__VA_ARGS__))
+#define glBlendEquationSeparatei(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationSeparatei(__VA_ARGS__))
+#define glVertexAttrib2hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2hvNV(__VA_ARGS__))
+#define glTextureParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterivEXT(__VA_ARGS__))
+#define glUniform3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3d(__VA_ARGS__))
+#define glUniform3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3f(__VA_ARGS__))
+#define glActiveProgramEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glActiveProgramEXT(__VA_ARGS__))
+#define glProgramUniform3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3uiv(__VA_ARGS__))
+#define glUniform3ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3ui64vARB(__VA_ARGS__))
+#define glProgramUniform1ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1ui64vARB(__VA_ARGS__))
+#define glTextureParameterfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterfEXT(__VA_ARGS__))
+#define glSetFragmentShaderConstantATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSetFragmentShaderConstantATI(__VA_ARGS__))
+#define glColorSubTable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorSubTable(__VA_ARGS__))
+#define glReplacementCodeuiSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiSUN(__VA_ARGS__))
+#define glStateCaptureNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStateCaptureNV(__VA_ARGS__))
+#define glBindAttribLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindAttribLocation(__VA_ARGS__))
+#define glWeightusvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightusvARB(__VA_ARGS__))
+#define glGetFragDataIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragDataIndex(__VA_ARGS__))
+#define glMultiTexCoord2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2xOES(__VA_ARGS__))
+#define glColor3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3sv(__VA_ARGS__))
+#define glTexCoord2fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fVertex3fSUN(__VA_ARGS__))
+#define glGetMemoryObjectParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMemoryObjectParameterivEXT(__VA_ARGS__))
+#define glPolygonOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonOffsetEXT(__VA_ARGS__))
+#define glWeightPathsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightPathsNV(__VA_ARGS__))
+#define glCombinerStageParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerStageParameterfvNV(__VA_ARGS__))
+#define glPointParameterfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfEXT(__VA_ARGS__))
+#define glCopyTexImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexImage1DEXT(__VA_ARGS__))
+#define glVertex4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4sv(__VA_ARGS__))
+#define glMatrixMultfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMultfEXT(__VA_ARGS__))
+#define glCompressedTextureSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureSubImage3DEXT(__VA_ARGS__))
+#define glGetTexLevelParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexLevelParameterxvOES(__VA_ARGS__))
+#define glVertexAttribL3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3dvEXT(__VA_ARGS__))
+#define glMultiTexCoordP4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP4ui(__VA_ARGS__))
+#define glGetTextureLevelParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureLevelParameterivEXT(__VA_ARGS__))
+#define glAlphaFragmentOp2ATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAlphaFragmentOp2ATI(__VA_ARGS__))
+#define glDeleteFramebuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteFramebuffers(__VA_ARGS__))
+#define glDrawArrays(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArrays(__VA_ARGS__))
+#define glGetTransformFeedbackiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTransformFeedbackiv(__VA_ARGS__))
+#define glGetnTexImageARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnTexImageARB(__VA_ARGS__))
+#define glClear(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClear(__VA_ARGS__))
+#define glVertexArrayParameteriAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayParameteriAPPLE(__VA_ARGS__))
+#define glMultiTexCoord2dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2dvARB(__VA_ARGS__))
+#define glGetVideoCaptureStreamdvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoCaptureStreamdvNV(__VA_ARGS__))
+#define glFragmentLightModelivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightModelivSGIX(__VA_ARGS__))
+#define glVertexAttribP2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP2ui(__VA_ARGS__))
+#define glMultiTexCoordPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordPointerEXT(__VA_ARGS__))
+#define glProgramUniform3iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3iEXT(__VA_ARGS__))
+#define glTranslatef(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTranslatef(__VA_ARGS__))
+#define glVertexAttrib4Nub(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Nub(__VA_ARGS__))
+#define glTranslated(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTranslated(__VA_ARGS__))
+#define glSamplerParameterIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplerParameterIiv(__VA_ARGS__))
+#define glTexCoord4hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4hNV(__VA_ARGS__))
+#define glDrawElementsIndirect(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsIndirect(__VA_ARGS__))
+#define glDeletePerfMonitorsAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeletePerfMonitorsAMD(__VA_ARGS__))
+#define glIsRenderbufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsRenderbufferEXT(__VA_ARGS__))
+#define glDrawCommandsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawCommandsNV(__VA_ARGS__))
+#define glUniform3ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3ivARB(__VA_ARGS__))
+#define glBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferSubData(__VA_ARGS__))
+#define glSecondaryColor3bv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3bv(__VA_ARGS__))
+#define glMatrixMultTransposedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMultTransposedEXT(__VA_ARGS__))
+#define glRequestResidentProgramsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRequestResidentProgramsNV(__VA_ARGS__))
+#define glAlphaFragmentOp1ATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAlphaFragmentOp1ATI(__VA_ARGS__))
+#define glGetQueryObjecti64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjecti64v(__VA_ARGS__))
+#define glMatrixMult3x3fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMult3x3fNV(__VA_ARGS__))
+#define glColorTableParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTableParameteriv(__VA_ARGS__))
+#define glPathSubCommandsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathSubCommandsNV(__VA_ARGS__))
+#define glGetFinalCombinerInputParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFinalCombinerInputParameterivNV(__VA_ARGS__))
+#define glIsRenderbuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsRenderbuffer(__VA_ARGS__))
+#define glVertex3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3iv(__VA_ARGS__))
+#define glTexGenfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGenfv(__VA_ARGS__))
+#define glFrustumfOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFrustumfOES(__VA_ARGS__))
+#define glBindVertexBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVertexBuffers(__VA_ARGS__))
+#define glMateriali(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMateriali(__VA_ARGS__))
+#define glMultiTexCoord2svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2svARB(__VA_ARGS__))
+#define glDisableVertexAttribArray(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVertexAttribArray(__VA_ARGS__))
+#define glWindowPos3ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3ivARB(__VA_ARGS__))
+#define glTexCoordFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordFormatNV(__VA_ARGS__))
+#define glBlitNamedFramebuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlitNamedFramebuffer(__VA_ARGS__))
+#define glMatrixLoadTransposefEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoadTransposefEXT(__VA_ARGS__))
+#define glMultiTexGenfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexGenfEXT(__VA_ARGS__))
+#define glShaderStorageBlockBinding(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderStorageBlockBinding(__VA_ARGS__))
+#define glMaterialf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaterialf(__VA_ARGS__))
+#define glReplacementCodeuiColor4fNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiColor4fNormal3fVertex3fSUN(__VA_ARGS__))
+#define glCheckNamedFramebufferStatusEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCheckNamedFramebufferStatusEXT(__VA_ARGS__))
+#define glVertexArrayVertexAttribFormatEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribFormatEXT(__VA_ARGS__))
+#define glVertex2hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2hNV(__VA_ARGS__))
+#define glDeleteVertexShaderEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteVertexShaderEXT(__VA_ARGS__))
+#define glTexImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage3DEXT(__VA_ARGS__))
+#define glSignalVkFenceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSignalVkFenceNV(__VA_ARGS__))
+#define glProgramLocalParameterI4ivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameterI4ivNV(__VA_ARGS__))
+#define glGlobalAlphaFactoriSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactoriSUN(__VA_ARGS__))
+#define glTextureStorage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage1D(__VA_ARGS__))
+#define glBinormal3sEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3sEXT(__VA_ARGS__))
+#define glGetProgramInterfaceiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramInterfaceiv(__VA_ARGS__))
+#define glMatrixIndexPointerARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixIndexPointerARB(__VA_ARGS__))
+#define glTexCoordPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordPointerEXT(__VA_ARGS__))
+#define glMultiTexGeniEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexGeniEXT(__VA_ARGS__))
+#define glVertexAttrib2fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2fNV(__VA_ARGS__))
+#define glNamedProgramStringEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramStringEXT(__VA_ARGS__))
+#define glMapNamedBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapNamedBuffer(__VA_ARGS__))
+#define glGetMinmaxParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMinmaxParameteriv(__VA_ARGS__))
+#define glGetnUniformdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformdv(__VA_ARGS__))
+#define glEndConditionalRenderNVX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndConditionalRenderNVX(__VA_ARGS__))
+#define glBinormal3fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3fEXT(__VA_ARGS__))
+#define glNormalStream3iATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3iATI(__VA_ARGS__))
+#define glProgramBufferParametersIivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramBufferParametersIivNV(__VA_ARGS__))
+#define glMapGrid1xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapGrid1xOES(__VA_ARGS__))
+#define glGetVertexAttribPointervARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribPointervARB(__VA_ARGS__))
+#define glFlushMappedNamedBufferRangeEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushMappedNamedBufferRangeEXT(__VA_ARGS__))
+#define glGetVertexAttribIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribIiv(__VA_ARGS__))
+#define glVertexP4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexP4uiv(__VA_ARGS__))
+#define glUniformui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformui64NV(__VA_ARGS__))
+#define glColor4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4fv(__VA_ARGS__))
+#define glTexParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterxvOES(__VA_ARGS__))
+#define glPatchParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPatchParameteri(__VA_ARGS__))
+#define glMap1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMap1d(__VA_ARGS__))
+#define glGetTexFilterFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexFilterFuncSGIS(__VA_ARGS__))
+#define glVertexStream3dATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3dATI(__VA_ARGS__))
+#define glVertexArrayVertexBindingDivisorEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexBindingDivisorEXT(__VA_ARGS__))
+#define glMultiTexCoord3svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3svARB(__VA_ARGS__))
+#define glBindProgramNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindProgramNV(__VA_ARGS__))
+#define glGetConvolutionParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionParameteriv(__VA_ARGS__))
+#define glGetProgramLocalParameterfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramLocalParameterfvARB(__VA_ARGS__))
+#define glGenFragmentShadersATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenFragmentShadersATI(__VA_ARGS__))
+#define glTexBumpParameterivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexBumpParameterivATI(__VA_ARGS__))
+#define glGetNamedFramebufferAttachmentParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedFramebufferAttachmentParameteriv(__VA_ARGS__))
+#define glGetnSeparableFilter(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnSeparableFilter(__VA_ARGS__))
+#define glNormal3xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3xvOES(__VA_ARGS__))
+#define glPassTexCoordATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPassTexCoordATI(__VA_ARGS__))
+#define glFramebufferTextureFaceARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureFaceARB(__VA_ARGS__))
+#define glProgramUniform1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1dv(__VA_ARGS__))
+#define glTextureStorage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage2DEXT(__VA_ARGS__))
+#define glVertexArrayFogCoordOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayFogCoordOffsetEXT(__VA_ARGS__))
+#define glDeleteNamedStringARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteNamedStringARB(__VA_ARGS__))
+#define glMulticastGetQueryObjecti64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastGetQueryObjecti64vNV(__VA_ARGS__))
+#define glGenOcclusionQueriesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenOcclusionQueriesNV(__VA_ARGS__))
+#define glLighti(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLighti(__VA_ARGS__))
+#define glTexImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage1D(__VA_ARGS__))
+#define glLightf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightf(__VA_ARGS__))
+#define glClientAttribDefaultEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClientAttribDefaultEXT(__VA_ARGS__))
+#define glVertexAttrib4bvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4bvARB(__VA_ARGS__))
+#define glVertexAttribIFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribIFormatNV(__VA_ARGS__))
+#define glStencilFuncSeparate(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilFuncSeparate(__VA_ARGS__))
+#define glGetVertexAttribfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribfvARB(__VA_ARGS__))
+#define glVertexAttrib2dNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2dNV(__VA_ARGS__))
+#define glProgramUniform2iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2iEXT(__VA_ARGS__))
+#define glClientActiveVertexStreamATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClientActiveVertexStreamATI(__VA_ARGS__))
+#define glRasterPos3xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3xOES(__VA_ARGS__))
+#define glGetMapParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapParameterivNV(__VA_ARGS__))
+#define glSampleCoverage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleCoverage(__VA_ARGS__))
+#define glClearDepthxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearDepthxOES(__VA_ARGS__))
+#define glUniformBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformBufferEXT(__VA_ARGS__))
+#define glTexCoord2fNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glMulticastGetQueryObjectuivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastGetQueryObjectuivNV(__VA_ARGS__))
+#define glGetFirstPerfQueryIdINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFirstPerfQueryIdINTEL(__VA_ARGS__))
+#define glUnmapNamedBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnmapNamedBufferEXT(__VA_ARGS__))
+#define glGetTransformFeedbacki_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTransformFeedbacki_v(__VA_ARGS__))
+#define glUniform4fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4fvARB(__VA_ARGS__))
+#define glRenderbufferStorageMultisampleCoverageNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderbufferStorageMultisampleCoverageNV(__VA_ARGS__))
+#define glGetFloati_vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFloati_vEXT(__VA_ARGS__))
+#define glBindAttribLocationARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindAttribLocationARB(__VA_ARGS__))
+#define glBufferAddressRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferAddressRangeNV(__VA_ARGS__))
+#define glGenProgramsARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenProgramsARB(__VA_ARGS__))
+#define glMultiTexEnvivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexEnvivEXT(__VA_ARGS__))
+#define glSecondaryColor3uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3uiEXT(__VA_ARGS__))
+#define glCompressedTextureImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureImage2DEXT(__VA_ARGS__))
+#define glUniform2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2i(__VA_ARGS__))
+#define glCopyTexImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexImage2DEXT(__VA_ARGS__))
+#define glUniform2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2d(__VA_ARGS__))
+#define glVertexAttribL1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1d(__VA_ARGS__))
+#define glFramebufferTextureFaceEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureFaceEXT(__VA_ARGS__))
+#define glFramebufferTextureLayer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureLayer(__VA_ARGS__))
+#define glMultiTexCoord4bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4bvOES(__VA_ARGS__))
+#define glGetVertexArrayPointeri_vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayPointeri_vEXT(__VA_ARGS__))
+#define glNamedProgramLocalParameter4dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameter4dEXT(__VA_ARGS__))
+#define glBinormal3bEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3bEXT(__VA_ARGS__))
+#define glConvolutionFilter2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionFilter2DEXT(__VA_ARGS__))
+#define glProgramUniform2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2fv(__VA_ARGS__))
+#define glColor3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3fVertex3fSUN(__VA_ARGS__))
+#define glNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glCopyMultiTexSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyMultiTexSubImage3DEXT(__VA_ARGS__))
+#define glProgramLocalParameterI4iNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameterI4iNV(__VA_ARGS__))
+#define glProgramUniformMatrix2x4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x4dv(__VA_ARGS__))
+#define glPathMemoryGlyphIndexArrayNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathMemoryGlyphIndexArrayNV(__VA_ARGS__))
+#define glDrawArraysEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArraysEXT(__VA_ARGS__))
+#define glBlendEquationEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationEXT(__VA_ARGS__))
+#define glStencilOp(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilOp(__VA_ARGS__))
+#define glCopyTextureSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureSubImage2DEXT(__VA_ARGS__))
+#define glTexEnvf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexEnvf(__VA_ARGS__))
+#define glVertexAttrib2dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2dvNV(__VA_ARGS__))
+#define glGenPerfMonitorsAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenPerfMonitorsAMD(__VA_ARGS__))
+#define glGetInteger64i_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInteger64i_v(__VA_ARGS__))
+#define glGetHistogramParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogramParameterfv(__VA_ARGS__))
+#define glVertexFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexFormatNV(__VA_ARGS__))
+#define glBlendFuncIndexedAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncIndexedAMD(__VA_ARGS__))
+#define glTexEnvi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexEnvi(__VA_ARGS__))
+#define glMultiTexCoord1iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1iv(__VA_ARGS__))
+#define glIsEnabledi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsEnabledi(__VA_ARGS__))
+#define glVertexAttribL2ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2ui64vNV(__VA_ARGS__))
+#define glVertexAttribL4i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4i64NV(__VA_ARGS__))
+#define glMatrixTranslatedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixTranslatedEXT(__VA_ARGS__))
+#define glMakeTextureHandleResidentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeTextureHandleResidentARB(__VA_ARGS__))
+#define glMatrixMultdEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMultdEXT(__VA_ARGS__))
+#define glBinormal3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3dvEXT(__VA_ARGS__))
+#define glImportSyncEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportSyncEXT(__VA_ARGS__))
+#define glGetMapiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapiv(__VA_ARGS__))
+#define glImportSemaphoreFdEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportSemaphoreFdEXT(__VA_ARGS__))
+#define glMultiTexCoord4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4sv(__VA_ARGS__))
+#define glPNTrianglesiATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPNTrianglesiATI(__VA_ARGS__))
+#define glBindVertexArrayAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVertexArrayAPPLE(__VA_ARGS__))
+#define glObjectPtrLabel(...) (ge::gl::setCallSite(__FILE__,__LINE__),glObjectPtrLabel(__VA_ARGS__))
+#define glGetDebugMessageLog(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDebugMessageLog(__VA_ARGS__))
+#define glTrackMatrixNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTrackMatrixNV(__VA_ARGS__))
+#define glProgramPathFragmentInputGenNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramPathFragmentInputGenNV(__VA_ARGS__))
+#define glTangent3ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3ivEXT(__VA_ARGS__))
+#define glGetUniformfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformfv(__VA_ARGS__))
+#define glSecondaryColor3ubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3ubv(__VA_ARGS__))
+#define glMakeTextureHandleNonResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeTextureHandleNonResidentNV(__VA_ARGS__))
+#define glVertexAttribs4ubvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs4ubvNV(__VA_ARGS__))
+#define glClipPlanexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClipPlanexOES(__VA_ARGS__))
+#define glMultiTexCoord3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3iv(__VA_ARGS__))
+#define glGetnPolygonStippleARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPolygonStippleARB(__VA_ARGS__))
+#define glUniform2i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2i64vNV(__VA_ARGS__))
+#define glLightModelf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightModelf(__VA_ARGS__))
+#define glDeleteMemoryObjectsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteMemoryObjectsEXT(__VA_ARGS__))
+#define glMultiTexSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexSubImage2DEXT(__VA_ARGS__))
+#define glReplacementCodeuiColor3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiColor3fVertex3fSUN(__VA_ARGS__))
+#define glTangent3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3dvEXT(__VA_ARGS__))
+#define glLightModeli(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightModeli(__VA_ARGS__))
+#define glVertexWeighthvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexWeighthvNV(__VA_ARGS__))
+#define glWindowPos3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3iv(__VA_ARGS__))
+#define glMultiTexCoordP1uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP1uiv(__VA_ARGS__))
+#define glTransformPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformPathNV(__VA_ARGS__))
+#define glProgramNamedParameter4dNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramNamedParameter4dNV(__VA_ARGS__))
+#define glMultiDrawElementsIndirect(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsIndirect(__VA_ARGS__))
+#define glProgramUniform1dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1dEXT(__VA_ARGS__))
+#define glCallLists(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCallLists(__VA_ARGS__))
+#define glNormal3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3hvNV(__VA_ARGS__))
+#define glGetCombinerOutputParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCombinerOutputParameterfvNV(__VA_ARGS__))
+#define glVertexAttrib4sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4sARB(__VA_ARGS__))
+#define glTexCoord3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3i(__VA_ARGS__))
+#define glVertexAttribI3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3uiv(__VA_ARGS__))
+#define glPushDebugGroup(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushDebugGroup(__VA_ARGS__))
+#define glTexCoord3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3f(__VA_ARGS__))
+#define glTexCoord3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3d(__VA_ARGS__))
+#define glTexCoord2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2xOES(__VA_ARGS__))
+#define glGetStageIndexNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetStageIndexNV(__VA_ARGS__))
+#define glProgramUniform4i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4i64vNV(__VA_ARGS__))
+#define glGetNamedBufferPointervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferPointervEXT(__VA_ARGS__))
+#define glTextureBarrierNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureBarrierNV(__VA_ARGS__))
+#define glColor4ubVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ubVertex3fvSUN(__VA_ARGS__))
+#define glGetCommandHeaderNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCommandHeaderNV(__VA_ARGS__))
+#define glGetPerfMonitorCounterInfoAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfMonitorCounterInfoAMD(__VA_ARGS__))
+#define glVertexAttrib1svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1svARB(__VA_ARGS__))
+#define glCombinerParameteriNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerParameteriNV(__VA_ARGS__))
+#define glMatrixMultTransposefEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMultTransposefEXT(__VA_ARGS__))
+#define glDetailTexFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDetailTexFuncSGIS(__VA_ARGS__))
+#define glAreTexturesResident(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAreTexturesResident(__VA_ARGS__))
+#define glProgramUniform2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2d(__VA_ARGS__))
+#define glGetConvolutionParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionParameterfvEXT(__VA_ARGS__))
+#define glIndexPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexPointerListIBM(__VA_ARGS__))
+#define glVertexAttribI4iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4iEXT(__VA_ARGS__))
+#define glProgramUniform2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2f(__VA_ARGS__))
+#define glRasterPos4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4sv(__VA_ARGS__))
+#define glColor4s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4s(__VA_ARGS__))
+#define glMulticastGetQueryObjectivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastGetQueryObjectivNV(__VA_ARGS__))
+#define glColorFragmentOp3ATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorFragmentOp3ATI(__VA_ARGS__))
+#define glResizeBuffersMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResizeBuffersMESA(__VA_ARGS__))
+#define glGetMinmaxParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMinmaxParameterfv(__VA_ARGS__))
+#define glClientActiveTextureARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClientActiveTextureARB(__VA_ARGS__))
+#define glBindVertexArray(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVertexArray(__VA_ARGS__))
+#define glColor4b(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4b(__VA_ARGS__))
+#define glColor4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4f(__VA_ARGS__))
+#define glColor4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4d(__VA_ARGS__))
+#define glColor4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4i(__VA_ARGS__))
+#define glEdgeFlagFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEdgeFlagFormatNV(__VA_ARGS__))
+#define glNamedBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferSubData(__VA_ARGS__))
+#define glDrawElementsInstanced(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsInstanced(__VA_ARGS__))
+#define glGetMultiTexParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexParameterIivEXT(__VA_ARGS__))
+#define glVertex2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2dv(__VA_ARGS__))
+#define glDisableVertexArrayAttribEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVertexArrayAttribEXT(__VA_ARGS__))
+#define glObjectUnpurgeableAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glObjectUnpurgeableAPPLE(__VA_ARGS__))
+#define glVertexAttribs2dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs2dvNV(__VA_ARGS__))
+#define glReplacementCodeuiTexCoord2fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiTexCoord2fVertex3fSUN(__VA_ARGS__))
+#define glGetMapParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapParameterfvNV(__VA_ARGS__))
+#define glProgramUniform4ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4ivEXT(__VA_ARGS__))
+#define glProgramUniform3ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3ui64vNV(__VA_ARGS__))
+#define glRectfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectfv(__VA_ARGS__))
+#define glTexFilterFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexFilterFuncSGIS(__VA_ARGS__))
+#define glSpriteParameterfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSpriteParameterfvSGIX(__VA_ARGS__))
+#define glCopyMultiTexImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyMultiTexImage1DEXT(__VA_ARGS__))
+#define glGetVertexAttribIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribIuivEXT(__VA_ARGS__))
+#define glUniformMatrix2x4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2x4dv(__VA_ARGS__))
+#define glGetProgramResourceLocationIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramResourceLocationIndex(__VA_ARGS__))
+#define glColor3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3hNV(__VA_ARGS__))
+#define glViewport(...) (ge::gl::setCallSite(__FILE__,__LINE__),glViewport(__VA_ARGS__))
+#define glProgramNamedParameter4fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramNamedParameter4fNV(__VA_ARGS__))
+#define glGetInvariantBooleanvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInvariantBooleanvEXT(__VA_ARGS__))
+#define glTexStorage2DMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorage2DMultisample(__VA_ARGS__))
+#define glPixelStorex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelStorex(__VA_ARGS__))
+#define glVertexAttribL1dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1dvEXT(__VA_ARGS__))
+#define glGetActiveSubroutineUniformiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveSubroutineUniformiv(__VA_ARGS__))
+#define glVertexAttribPointerARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribPointerARB(__VA_ARGS__))
+#define glCompressedTexSubImage2DARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexSubImage2DARB(__VA_ARGS__))
+#define glTexStorageMem1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorageMem1DEXT(__VA_ARGS__))
+#define glVertex2hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2hvNV(__VA_ARGS__))
+#define glTexBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexBuffer(__VA_ARGS__))
+#define glArrayElement(...) (ge::gl::setCallSite(__FILE__,__LINE__),glArrayElement(__VA_ARGS__))
+#define glValidateProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glValidateProgram(__VA_ARGS__))
+#define glPixelStoref(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelStoref(__VA_ARGS__))
+#define glWindowPos3dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3dARB(__VA_ARGS__))
+#define glEvalCoord1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord1dv(__VA_ARGS__))
+#define glVertexAttribs2fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs2fvNV(__VA_ARGS__))
+#define glRecti(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRecti(__VA_ARGS__))
+#define glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glTexCoord1bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1bOES(__VA_ARGS__))
+#define glProgramUniform2i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2i64vARB(__VA_ARGS__))
+#define glWindowPos2dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2dARB(__VA_ARGS__))
+#define glGetProgramParameterdvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramParameterdvNV(__VA_ARGS__))
+#define glRectf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectf(__VA_ARGS__))
+#define glRectd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectd(__VA_ARGS__))
+#define glMap1xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMap1xOES(__VA_ARGS__))
+#define glVertexAttrib3fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3fvNV(__VA_ARGS__))
+#define glReferencePlaneSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReferencePlaneSGIX(__VA_ARGS__))
+#define glMulticastBlitFramebufferNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastBlitFramebufferNV(__VA_ARGS__))
+#define glGetCombinerInputParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCombinerInputParameterfvNV(__VA_ARGS__))
+#define glGetTextureSamplerHandleARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureSamplerHandleARB(__VA_ARGS__))
+#define glBindTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTexture(__VA_ARGS__))
+#define glRects(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRects(__VA_ARGS__))
+#define glGetActiveAttribARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveAttribARB(__VA_ARGS__))
+#define glHistogramEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glHistogramEXT(__VA_ARGS__))
+#define glGetTextureSamplerHandleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureSamplerHandleNV(__VA_ARGS__))
+#define glDetachShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDetachShader(__VA_ARGS__))
+#define glFinishTextureSUNX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinishTextureSUNX(__VA_ARGS__))
+#define glUniformMatrix3x4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3x4dv(__VA_ARGS__))
+#define glVertexAttrib4fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4fARB(__VA_ARGS__))
+#define glGetPathColorGenivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathColorGenivNV(__VA_ARGS__))
+#define glGetProgramResourceLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramResourceLocation(__VA_ARGS__))
+#define glVertexArrayAttribLFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayAttribLFormat(__VA_ARGS__))
+#define glGetTexLevelParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexLevelParameterfv(__VA_ARGS__))
+#define glVertexArrayVertexAttribOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribOffsetEXT(__VA_ARGS__))
+#define glIndexFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexFormatNV(__VA_ARGS__))
+#define glMultiTexCoord3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3i(__VA_ARGS__))
+#define glReplacementCodeuiVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiVertex3fvSUN(__VA_ARGS__))
+#define glViewportIndexedfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glViewportIndexedfv(__VA_ARGS__))
+#define glBindBuffersBase(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBuffersBase(__VA_ARGS__))
+#define glTexBumpParameterfvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexBumpParameterfvATI(__VA_ARGS__))
+#define glMatrixIndexuivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixIndexuivARB(__VA_ARGS__))
+#define glVertexAttrib1hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1hNV(__VA_ARGS__))
+#define glWindowPos3svMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3svMESA(__VA_ARGS__))
+#define glStencilOpSeparateATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilOpSeparateATI(__VA_ARGS__))
+#define glDrawElementsBaseVertex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsBaseVertex(__VA_ARGS__))
+#define glBlendEquationSeparateiARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationSeparateiARB(__VA_ARGS__))
+#define glVertexAttrib1fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1fNV(__VA_ARGS__))
+#define glMapVertexAttrib2fAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapVertexAttrib2fAPPLE(__VA_ARGS__))
+#define glCompressedTextureSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureSubImage1DEXT(__VA_ARGS__))
+#define glClearBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearBufferSubData(__VA_ARGS__))
+#define glTexStorage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorage1D(__VA_ARGS__))
+#define glVertexAttribI3iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3iEXT(__VA_ARGS__))
+#define glMakeTextureHandleNonResidentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeTextureHandleNonResidentARB(__VA_ARGS__))
+#define glMultiDrawElementArrayAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementArrayAPPLE(__VA_ARGS__))
+#define glVertexStream4dATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4dATI(__VA_ARGS__))
+#define glProgramUniformMatrix2dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2dvEXT(__VA_ARGS__))
+#define glVertexAttribs2hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs2hvNV(__VA_ARGS__))
+#define glGetUniformiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformiv(__VA_ARGS__))
+#define glClipPlanefOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClipPlanefOES(__VA_ARGS__))
+#define glRenderbufferStorage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderbufferStorage(__VA_ARGS__))
+#define glUniform4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4ui(__VA_ARGS__))
+#define glBindFramebuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindFramebuffer(__VA_ARGS__))
+#define glValidateProgramARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glValidateProgramARB(__VA_ARGS__))
+#define glTexGenf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGenf(__VA_ARGS__))
+#define glTexGend(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGend(__VA_ARGS__))
+#define glTexGeni(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGeni(__VA_ARGS__))
+#define glDeleteFramebuffersEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteFramebuffersEXT(__VA_ARGS__))
+#define glResetMinmaxEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResetMinmaxEXT(__VA_ARGS__))
+#define glVertexAttrib1fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1fvNV(__VA_ARGS__))
+#define glIsQueryARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsQueryARB(__VA_ARGS__))
+#define glEnableVariantClientStateEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVariantClientStateEXT(__VA_ARGS__))
+#define glScissorIndexed(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScissorIndexed(__VA_ARGS__))
+#define glGetInvariantIntegervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInvariantIntegervEXT(__VA_ARGS__))
+#define glProgramLocalParameterI4uiNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameterI4uiNV(__VA_ARGS__))
+#define glConvolutionParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterxvOES(__VA_ARGS__))
+#define glGenFramebuffersEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenFramebuffersEXT(__VA_ARGS__))
+#define glVertexArrayColorOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayColorOffsetEXT(__VA_ARGS__))
+#define glMultiTexCoord3ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3ivARB(__VA_ARGS__))
+#define glVertexWeightfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexWeightfEXT(__VA_ARGS__))
+#define glRasterPos4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4dv(__VA_ARGS__))
+#define glIsTextureHandleResidentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsTextureHandleResidentARB(__VA_ARGS__))
+#define glRasterPos2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2dv(__VA_ARGS__))
+#define glWindowPos4ivMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4ivMESA(__VA_ARGS__))
+#define glGetVariantPointervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVariantPointervEXT(__VA_ARGS__))
+#define glMapNamedBufferRangeEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapNamedBufferRangeEXT(__VA_ARGS__))
+#define glGetnUniformui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformui64vARB(__VA_ARGS__))
+#define glCreateShaderProgramv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateShaderProgramv(__VA_ARGS__))
+#define glGetQueryObjectiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjectiv(__VA_ARGS__))
+#define glMaxShaderCompilerThreadsKHR(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaxShaderCompilerThreadsKHR(__VA_ARGS__))
+#define glPNTrianglesfATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPNTrianglesfATI(__VA_ARGS__))
+#define glGlobalAlphaFactorusSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactorusSUN(__VA_ARGS__))
+#define glVertexAttrib3dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3dvNV(__VA_ARGS__))
+#define glMultiTexCoord3sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3sARB(__VA_ARGS__))
+#define glGenerateMipmap(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenerateMipmap(__VA_ARGS__))
+#define glCompressedTextureSubImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureSubImage2D(__VA_ARGS__))
+#define glNamedRenderbufferStorageMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedRenderbufferStorageMultisampleEXT(__VA_ARGS__))
+#define glPolygonOffsetClampEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonOffsetClampEXT(__VA_ARGS__))
+#define glTextureRangeAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureRangeAPPLE(__VA_ARGS__))
+#define glBlendEquationIndexedAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationIndexedAMD(__VA_ARGS__))
+#define glTexCoord2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2d(__VA_ARGS__))
+#define glPointParameteri(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameteri(__VA_ARGS__))
+#define glTexCoord2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2f(__VA_ARGS__))
+#define glGetUnsignedBytei_vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUnsignedBytei_vEXT(__VA_ARGS__))
+#define glColor4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4iv(__VA_ARGS__))
+#define glMapNamedBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapNamedBufferRange(__VA_ARGS__))
+#define glUnmapBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnmapBuffer(__VA_ARGS__))
+#define glSampleMaskEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleMaskEXT(__VA_ARGS__))
+#define glTexCoord2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2i(__VA_ARGS__))
+#define glTexCoord1xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1xvOES(__VA_ARGS__))
+#define glVertexAttrib1sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1sARB(__VA_ARGS__))
+#define glGetVertexArrayiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayiv(__VA_ARGS__))
+#define glProgramParameter4dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameter4dvNV(__VA_ARGS__))
+#define glTexCoord2s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2s(__VA_ARGS__))
+#define glTextureParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterIuivEXT(__VA_ARGS__))
+#define glGetColorTableParameterfvSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableParameterfvSGI(__VA_ARGS__))
+#define glTexCoord4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4dv(__VA_ARGS__))
+#define glVertexAttrib1svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1svNV(__VA_ARGS__))
+#define glNamedFramebufferTextureFaceEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTextureFaceEXT(__VA_ARGS__))
+#define glProgramUniform2ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2ui64vNV(__VA_ARGS__))
+#define glStencilFillPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilFillPathNV(__VA_ARGS__))
+#define glNormal3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3dv(__VA_ARGS__))
+#define glReleaseShaderCompiler(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReleaseShaderCompiler(__VA_ARGS__))
+#define glTexStorageMem3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorageMem3DEXT(__VA_ARGS__))
+#define glTexCoord3bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3bvOES(__VA_ARGS__))
+#define glIsVertexAttribEnabledAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsVertexAttribEnabledAPPLE(__VA_ARGS__))
+#define glTexCoord1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1dv(__VA_ARGS__))
+#define glReadPixels(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReadPixels(__VA_ARGS__))
+#define glVertexAttribI3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3iv(__VA_ARGS__))
+#define glSetFenceAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSetFenceAPPLE(__VA_ARGS__))
+#define glWeightsvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightsvARB(__VA_ARGS__))
+#define glShadeModel(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShadeModel(__VA_ARGS__))
+#define glTextureStorageMem3DMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorageMem3DMultisampleEXT(__VA_ARGS__))
+#define glMapGrid1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapGrid1d(__VA_ARGS__))
+#define glGetHistogramParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogramParameterivEXT(__VA_ARGS__))
+#define glConservativeRasterParameteriNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConservativeRasterParameteriNV(__VA_ARGS__))
+#define glClearNamedBufferData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedBufferData(__VA_ARGS__))
+#define glClearDepthf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearDepthf(__VA_ARGS__))
+#define glCreatePerfQueryINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreatePerfQueryINTEL(__VA_ARGS__))
+#define glFogCoordfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordfEXT(__VA_ARGS__))
+#define glVertexAttrib2dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2dARB(__VA_ARGS__))
+#define glMultiTexCoord4dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4dARB(__VA_ARGS__))
+#define glReadnPixelsARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReadnPixelsARB(__VA_ARGS__))
+#define glMultiTexBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexBufferEXT(__VA_ARGS__))
+#define glWindowPos4dvMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4dvMESA(__VA_ARGS__))
+#define glInvalidateNamedFramebufferData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateNamedFramebufferData(__VA_ARGS__))
+#define glSecondaryColorPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColorPointerListIBM(__VA_ARGS__))
+#define glRectiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectiv(__VA_ARGS__))
+#define glColorP4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorP4ui(__VA_ARGS__))
+#define glUseProgramStages(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUseProgramStages(__VA_ARGS__))
+#define glRasterPos3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3dv(__VA_ARGS__))
+#define glPathTexGenNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathTexGenNV(__VA_ARGS__))
+#define glVertexBlendEnviATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexBlendEnviATI(__VA_ARGS__))
+#define glUniform3i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3i64ARB(__VA_ARGS__))
+#define glLoadMatrixf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadMatrixf(__VA_ARGS__))
+#define glProgramUniform2dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2dEXT(__VA_ARGS__))
+#define glVertexAttribI4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4iv(__VA_ARGS__))
+#define glNamedFramebufferDrawBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferDrawBuffer(__VA_ARGS__))
+#define glColor4ubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ubv(__VA_ARGS__))
+#define glColor3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3hvNV(__VA_ARGS__))
+#define glGetMapAttribParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapAttribParameterfvNV(__VA_ARGS__))
+#define glGetBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferSubData(__VA_ARGS__))
+#define glGetVertexAttribLdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribLdv(__VA_ARGS__))
+#define glGetnUniformuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformuiv(__VA_ARGS__))
+#define glGetUniformui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformui64vNV(__VA_ARGS__))
+#define glNamedRenderbufferStorageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedRenderbufferStorageEXT(__VA_ARGS__))
+#define glVertexAttrib3dNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3dNV(__VA_ARGS__))
+#define glTextureStorage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage1DEXT(__VA_ARGS__))
+#define glPixelTexGenParameteriSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTexGenParameteriSGIS(__VA_ARGS__))
+#define glColorTableEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTableEXT(__VA_ARGS__))
+#define glGenBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenBuffers(__VA_ARGS__))
+#define glMultiTexCoord3xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3xvOES(__VA_ARGS__))
+#define glExecuteProgramNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glExecuteProgramNV(__VA_ARGS__))
+#define glVariantArrayObjectATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantArrayObjectATI(__VA_ARGS__))
+#define glColor3xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3xvOES(__VA_ARGS__))
+#define glGetnConvolutionFilterARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnConvolutionFilterARB(__VA_ARGS__))
+#define glNormalFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalFormatNV(__VA_ARGS__))
+#define glGetInvariantFloatvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInvariantFloatvEXT(__VA_ARGS__))
+#define glClearNamedFramebufferiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedFramebufferiv(__VA_ARGS__))
+#define glTexImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage3D(__VA_ARGS__))
+#define glGenSamplers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenSamplers(__VA_ARGS__))
+#define glIsFramebuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsFramebuffer(__VA_ARGS__))
+#define glProgramUniform3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3dvEXT(__VA_ARGS__))
+#define glGetVertexAttribfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribfvNV(__VA_ARGS__))
+#define glDrawRangeElementArrayAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawRangeElementArrayAPPLE(__VA_ARGS__))
+#define glUniform3i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3i64NV(__VA_ARGS__))
+#define glMatrixPopEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixPopEXT(__VA_ARGS__))
+#define glVertexStream1sATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1sATI(__VA_ARGS__))
+#define glGetnPixelMapuivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPixelMapuivARB(__VA_ARGS__))
+#define glMultiTexEnviEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexEnviEXT(__VA_ARGS__))
+#define glVertexAttribI2iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2iEXT(__VA_ARGS__))
+#define glProgramParameter4fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameter4fvNV(__VA_ARGS__))
+#define glWaitSemaphoreEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWaitSemaphoreEXT(__VA_ARGS__))
+#define glNamedFramebufferSampleLocationsfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferSampleLocationsfvNV(__VA_ARGS__))
+#define glTexCoordP4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP4uiv(__VA_ARGS__))
+#define glRectxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectxvOES(__VA_ARGS__))
+#define glGetVariantIntegervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVariantIntegervEXT(__VA_ARGS__))
+#define glDeleteLists(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteLists(__VA_ARGS__))
+#define glTexGendv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGendv(__VA_ARGS__))
+#define glVertexP2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexP2uiv(__VA_ARGS__))
+#define glGetPerfMonitorGroupsAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfMonitorGroupsAMD(__VA_ARGS__))
+#define glMultTransposeMatrixfARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultTransposeMatrixfARB(__VA_ARGS__))
+#define glVertexAttribI2ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2ivEXT(__VA_ARGS__))
+#define glReplacementCodeuiColor4fNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiColor4fNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glDeleteStatesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteStatesNV(__VA_ARGS__))
+#define glGetBufferParameteri64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferParameteri64v(__VA_ARGS__))
+#define glProgramUniform4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4dv(__VA_ARGS__))
+#define glEdgeFlagPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEdgeFlagPointerEXT(__VA_ARGS__))
+#define glVideoCaptureStreamParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVideoCaptureStreamParameterivNV(__VA_ARGS__))
+#define glVertexStream4iATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4iATI(__VA_ARGS__))
+#define glVDPAUFiniNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUFiniNV(__VA_ARGS__))
+#define glMakeBufferNonResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeBufferNonResidentNV(__VA_ARGS__))
+#define glUniform1ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1ui64ARB(__VA_ARGS__))
+#define glStencilStrokePathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilStrokePathNV(__VA_ARGS__))
+#define glVariantuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantuivEXT(__VA_ARGS__))
+#define glCopyTexSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexSubImage3DEXT(__VA_ARGS__))
+#define glSpriteParameteriSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSpriteParameteriSGIX(__VA_ARGS__))
+#define glMultiTexCoord1sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1sARB(__VA_ARGS__))
+#define glConvolutionParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterfv(__VA_ARGS__))
+#define glMakeTextureHandleResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeTextureHandleResidentNV(__VA_ARGS__))
+#define glMultMatrixxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultMatrixxOES(__VA_ARGS__))
+#define glTextureNormalEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureNormalEXT(__VA_ARGS__))
+#define glGetQueryivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryivARB(__VA_ARGS__))
+#define glCompressedMultiTexImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedMultiTexImage3DEXT(__VA_ARGS__))
+#define glGetInstrumentsSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInstrumentsSGIX(__VA_ARGS__))
+#define glProgramUniformMatrix4x3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x3fvEXT(__VA_ARGS__))
+#define glPointParameterf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterf(__VA_ARGS__))
+#define glProgramUniform3dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3dEXT(__VA_ARGS__))
+#define glMultiTexCoord2hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2hNV(__VA_ARGS__))
+#define glGetConvolutionFilterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionFilterEXT(__VA_ARGS__))
+#define glVertexAttrib2hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2hNV(__VA_ARGS__))
+#define glCurrentPaletteMatrixARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCurrentPaletteMatrixARB(__VA_ARGS__))
+#define glFogxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogxvOES(__VA_ARGS__))
+#define glCreateRenderbuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateRenderbuffers(__VA_ARGS__))
+#define glVertexAttrib4Nusv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Nusv(__VA_ARGS__))
+#define glCombinerInputNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerInputNV(__VA_ARGS__))
+#define glDepthFunc(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthFunc(__VA_ARGS__))
+#define glWindowPos4fMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4fMESA(__VA_ARGS__))
+#define glEnableClientStateIndexedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableClientStateIndexedEXT(__VA_ARGS__))
+#define glTexCoord4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4iv(__VA_ARGS__))
+#define glProgramUniform4i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4i64ARB(__VA_ARGS__))
+#define glBlendFunci(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFunci(__VA_ARGS__))
+#define glResolveDepthValuesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResolveDepthValuesNV(__VA_ARGS__))
+#define glTextureColorMaskSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureColorMaskSGIS(__VA_ARGS__))
+#define glCreateShaderProgramEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateShaderProgramEXT(__VA_ARGS__))
+#define glBufferStorage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferStorage(__VA_ARGS__))
+#define glMakeNamedBufferNonResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeNamedBufferNonResidentNV(__VA_ARGS__))
+#define glRenderbufferStorageMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderbufferStorageMultisampleEXT(__VA_ARGS__))
+#define glGetFloati_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFloati_v(__VA_ARGS__))
+#define glUniform2ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2ui64ARB(__VA_ARGS__))
+#define glVertex3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3fv(__VA_ARGS__))
+#define glGetUniformLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformLocation(__VA_ARGS__))
+#define glVertexStream1svATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1svATI(__VA_ARGS__))
+#define glVertexStream3fATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3fATI(__VA_ARGS__))
+#define glNamedFramebufferDrawBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferDrawBuffers(__VA_ARGS__))
+#define glUniform2ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2ui64vNV(__VA_ARGS__))
+#define glTexCoordPointervINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordPointervINTEL(__VA_ARGS__))
+#define glUniform4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4fv(__VA_ARGS__))
+#define glNormalPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalPointerEXT(__VA_ARGS__))
+#define glVertexAttrib4hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4hNV(__VA_ARGS__))
+#define glNormal3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3f(__VA_ARGS__))
+#define glVertexStream2iATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2iATI(__VA_ARGS__))
+#define glVertexAttribP4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP4uiv(__VA_ARGS__))
+#define glCompressedTextureSubImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureSubImage3D(__VA_ARGS__))
+#define glAsyncMarkerSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAsyncMarkerSGIX(__VA_ARGS__))
+#define glTextureStorageSparseAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorageSparseAMD(__VA_ARGS__))
+#define glGetConvolutionParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionParameterivEXT(__VA_ARGS__))
+#define glEndPerfQueryINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndPerfQueryINTEL(__VA_ARGS__))
+#define glFragmentLightModeliSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightModeliSGIX(__VA_ARGS__))
+#define glPrioritizeTexturesEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrioritizeTexturesEXT(__VA_ARGS__))
+#define glEndConditionalRender(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndConditionalRender(__VA_ARGS__))
+#define glEnableClientState(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableClientState(__VA_ARGS__))
+#define glResetHistogram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResetHistogram(__VA_ARGS__))
+#define glGetOcclusionQueryivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetOcclusionQueryivNV(__VA_ARGS__))
+#define glUniform1uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1uiEXT(__VA_ARGS__))
+#define glMultiTexCoord2sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2sv(__VA_ARGS__))
+#define glTexSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage2DEXT(__VA_ARGS__))
+#define glProgramUniform2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2uiv(__VA_ARGS__))
+#define glMultiTexCoord2iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2iARB(__VA_ARGS__))
+#define glGetQueryObjectuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjectuiv(__VA_ARGS__))
+#define glGenerateMultiTexMipmapEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenerateMultiTexMipmapEXT(__VA_ARGS__))
+#define glVertexAttrib4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4iv(__VA_ARGS__))
+#define glWindowPos3dvMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3dvMESA(__VA_ARGS__))
+#define glLabelObjectEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLabelObjectEXT(__VA_ARGS__))
+#define glProgramUniform1uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1uiv(__VA_ARGS__))
+#define glFramebufferTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture(__VA_ARGS__))
+#define glMultiTexEnvfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexEnvfEXT(__VA_ARGS__))
+#define glGetTexGendv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexGendv(__VA_ARGS__))
+#define glVertex4xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4xOES(__VA_ARGS__))
+#define glVertexAttribI2uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2uivEXT(__VA_ARGS__))
+#define glNamedProgramLocalParameter4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameter4fvEXT(__VA_ARGS__))
+#define glColor3usv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3usv(__VA_ARGS__))
+#define glGetPixelTransformParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelTransformParameterfvEXT(__VA_ARGS__))
+#define glIndexxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexxvOES(__VA_ARGS__))
+#define glDepthMask(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthMask(__VA_ARGS__))
+#define glProgramUniformMatrix2x4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x4fv(__VA_ARGS__))
+#define glAreProgramsResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAreProgramsResidentNV(__VA_ARGS__))
+#define glColorTable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTable(__VA_ARGS__))
+#define glBeginQueryIndexed(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginQueryIndexed(__VA_ARGS__))
+#define glVertexStream1dvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1dvATI(__VA_ARGS__))
+#define glGetMultiTexEnvfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexEnvfvEXT(__VA_ARGS__))
+#define glDeleteFencesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteFencesNV(__VA_ARGS__))
+#define glVertexAttribs1dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs1dvNV(__VA_ARGS__))
+#define glBufferStorageExternalEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferStorageExternalEXT(__VA_ARGS__))
+#define glVertexStream2sATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2sATI(__VA_ARGS__))
+#define glGetnSeparableFilterARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnSeparableFilterARB(__VA_ARGS__))
+#define glProgramUniform2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2dv(__VA_ARGS__))
+#define glActiveStencilFaceEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glActiveStencilFaceEXT(__VA_ARGS__))
+#define glProgramUniform4dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4dEXT(__VA_ARGS__))
+#define glPointSizexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointSizexOES(__VA_ARGS__))
+#define glRasterPos2sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2sv(__VA_ARGS__))
+#define glBindParameterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindParameterEXT(__VA_ARGS__))
+#define glTexCoord1sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1sv(__VA_ARGS__))
+#define glBlendParameteriNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendParameteriNV(__VA_ARGS__))
+#define glNamedProgramLocalParameter4dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameter4dvEXT(__VA_ARGS__))
+#define glProgramUniformHandleui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformHandleui64NV(__VA_ARGS__))
+#define glGetTextureParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterfvEXT(__VA_ARGS__))
+#define glGetPathMetricsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathMetricsNV(__VA_ARGS__))
+#define glVertex2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2i(__VA_ARGS__))
+#define glNewList(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNewList(__VA_ARGS__))
+#define glMatrixLoad3x3fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoad3x3fNV(__VA_ARGS__))
+#define glMultiTexCoord2fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2fARB(__VA_ARGS__))
+#define glWeightdvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightdvARB(__VA_ARGS__))
+#define glIsTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsTransformFeedbackNV(__VA_ARGS__))
+#define glVertexAttribDivisorARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribDivisorARB(__VA_ARGS__))
+#define glSecondaryColorP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColorP3uiv(__VA_ARGS__))
+#define glGetnCompressedTexImageARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnCompressedTexImageARB(__VA_ARGS__))
+#define glGetIntegerv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetIntegerv(__VA_ARGS__))
+#define glMatrixLoaddEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoaddEXT(__VA_ARGS__))
+#define glGetPathLengthNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathLengthNV(__VA_ARGS__))
+#define glProgramUniformMatrix3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3dv(__VA_ARGS__))
+#define glUniform4i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4i64NV(__VA_ARGS__))
+#define glGetHistogramEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogramEXT(__VA_ARGS__))
+#define glVertexAttrib4NuivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NuivARB(__VA_ARGS__))
+#define glMapGrid2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapGrid2xOES(__VA_ARGS__))
+#define glTexImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage2D(__VA_ARGS__))
+#define glWindowPos2fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2fvARB(__VA_ARGS__))
+#define glEnableIndexedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableIndexedEXT(__VA_ARGS__))
+#define glTexCoord1bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1bvOES(__VA_ARGS__))
+#define glDrawPixels(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawPixels(__VA_ARGS__))
+#define glMultMatrixd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultMatrixd(__VA_ARGS__))
+#define glMultMatrixf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultMatrixf(__VA_ARGS__))
+#define glReplacementCodePointerSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodePointerSUN(__VA_ARGS__))
+#define glLoadTransposeMatrixdARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadTransposeMatrixdARB(__VA_ARGS__))
+#define glVertexAttrib4Nubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Nubv(__VA_ARGS__))
+#define glVertexArrayVertexAttribIOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribIOffsetEXT(__VA_ARGS__))
+#define glCompileShaderARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompileShaderARB(__VA_ARGS__))
+#define glWindowPos3dMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3dMESA(__VA_ARGS__))
+#define glNormalStream3fvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3fvATI(__VA_ARGS__))
+#define glColor4usv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4usv(__VA_ARGS__))
+#define glMapGrid1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapGrid1f(__VA_ARGS__))
+#define glPolygonStipple(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonStipple(__VA_ARGS__))
+#define glUniform4ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4ui64ARB(__VA_ARGS__))
+#define glTextureRenderbufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureRenderbufferEXT(__VA_ARGS__))
+#define glGetSubroutineUniformLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSubroutineUniformLocation(__VA_ARGS__))
+#define glGetFramebufferParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFramebufferParameteriv(__VA_ARGS__))
+#define glPixelMapusv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelMapusv(__VA_ARGS__))
+#define glGetSamplerParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSamplerParameteriv(__VA_ARGS__))
+#define glVertexStream2fvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2fvATI(__VA_ARGS__))
+#define glProgramStringARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramStringARB(__VA_ARGS__))
+#define glProgramUniformMatrix3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3dvEXT(__VA_ARGS__))
+#define glSeparableFilter2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSeparableFilter2D(__VA_ARGS__))
+#define glVertexAttribI1uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1uiv(__VA_ARGS__))
+#define glLGPUCopyImageSubDataNVX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLGPUCopyImageSubDataNVX(__VA_ARGS__))
+#define glTexStorage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorage2D(__VA_ARGS__))
+#define glColor3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3fv(__VA_ARGS__))
+#define glGetMultiTexGendvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexGendvEXT(__VA_ARGS__))
+#define glVertexAttribL4dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4dvEXT(__VA_ARGS__))
+#define glGetActiveUniform(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveUniform(__VA_ARGS__))
+#define glUniform2ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2ui64vARB(__VA_ARGS__))
+#define glMakeNamedBufferResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeNamedBufferResidentNV(__VA_ARGS__))
+#define glPathGlyphIndexRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathGlyphIndexRangeNV(__VA_ARGS__))
+#define glColorPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorPointer(__VA_ARGS__))
+#define glProgramEnvParameterI4ivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameterI4ivNV(__VA_ARGS__))
+#define glMulticastGetQueryObjectui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastGetQueryObjectui64vNV(__VA_ARGS__))
+#define glMultiTexParameterfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexParameterfEXT(__VA_ARGS__))
+#define glNamedFramebufferTextureLayer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTextureLayer(__VA_ARGS__))
+#define glGetVertexArrayIntegervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayIntegervEXT(__VA_ARGS__))
+#define glVertexAttrib3dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3dARB(__VA_ARGS__))
+#define glVDPAUIsSurfaceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUIsSurfaceNV(__VA_ARGS__))
+#define glMultiTexImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexImage1DEXT(__VA_ARGS__))
+#define glIsAsyncMarkerSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsAsyncMarkerSGIX(__VA_ARGS__))
+#define glGetDoublei_vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDoublei_vEXT(__VA_ARGS__))
+#define glUniform2i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2i64NV(__VA_ARGS__))
+#define glIsCommandListNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsCommandListNV(__VA_ARGS__))
+#define glUniform3uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3uiEXT(__VA_ARGS__))
+#define glTexParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterIuivEXT(__VA_ARGS__))
+#define glProgramUniformMatrix4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4fv(__VA_ARGS__))
+#define glVertex2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2fv(__VA_ARGS__))
+#define glVertexAttribL3dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3dEXT(__VA_ARGS__))
+#define glFramebufferRenderbuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferRenderbuffer(__VA_ARGS__))
+#define glGetUniformLocationARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformLocationARB(__VA_ARGS__))
+#define glPathParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathParameterfvNV(__VA_ARGS__))
+#define glVertexAttrib3sNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3sNV(__VA_ARGS__))
+#define glGetDoublei_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDoublei_v(__VA_ARGS__))
+#define glVertexAttrib1sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1sv(__VA_ARGS__))
+#define glBindSampler(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindSampler(__VA_ARGS__))
+#define glLineWidth(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLineWidth(__VA_ARGS__))
+#define glVertexArrayRangeAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayRangeAPPLE(__VA_ARGS__))
+#define glBindBufferOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferOffsetEXT(__VA_ARGS__))
+#define glWeightfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightfvARB(__VA_ARGS__))
+#define glGetIntegeri_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetIntegeri_v(__VA_ARGS__))
+#define glGetTransformFeedbackVarying(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTransformFeedbackVarying(__VA_ARGS__))
+#define glProgramLocalParameter4fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameter4fvARB(__VA_ARGS__))
+#define glGetTransformFeedbackVaryingNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTransformFeedbackVaryingNV(__VA_ARGS__))
+#define glWindowPos2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2iv(__VA_ARGS__))
+#define glVertexStream1dATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream1dATI(__VA_ARGS__))
+#define glColorFragmentOp2ATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorFragmentOp2ATI(__VA_ARGS__))
+#define glFogiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogiv(__VA_ARGS__))
+#define glGetTextureHandleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureHandleNV(__VA_ARGS__))
+#define glLightModeliv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightModeliv(__VA_ARGS__))
+#define glDepthRangef(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRangef(__VA_ARGS__))
+#define glGetFragmentMaterialivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragmentMaterialivSGIX(__VA_ARGS__))
+#define glVideoCaptureStreamParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVideoCaptureStreamParameterfvNV(__VA_ARGS__))
+#define glDeleteProgramsARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteProgramsARB(__VA_ARGS__))
+#define glWindowPos3fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3fvARB(__VA_ARGS__))
+#define glFeedbackBufferxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFeedbackBufferxOES(__VA_ARGS__))
+#define glGetTexBumpParameterfvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexBumpParameterfvATI(__VA_ARGS__))
+#define glEnablei(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnablei(__VA_ARGS__))
+#define glGetActiveSubroutineName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveSubroutineName(__VA_ARGS__))
+#define glDrawBuffersARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawBuffersARB(__VA_ARGS__))
+#define glBindProgramARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindProgramARB(__VA_ARGS__))
+#define glEvalCoord1fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord1fv(__VA_ARGS__))
+#define glProgramUniform3ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3ui64vARB(__VA_ARGS__))
+#define glProgramUniformMatrix2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2dv(__VA_ARGS__))
+#define glMultiTexCoord2hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2hvNV(__VA_ARGS__))
+#define glGetFloatIndexedvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFloatIndexedvEXT(__VA_ARGS__))
+#define glSampleCoverageARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleCoverageARB(__VA_ARGS__))
+#define glProgramUniform2ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2ui64vARB(__VA_ARGS__))
+#define glPixelDataRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelDataRangeNV(__VA_ARGS__))
+#define glVertexStream3svATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3svATI(__VA_ARGS__))
+#define glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glTexCoord3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3hvNV(__VA_ARGS__))
+#define glSampleMaski(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSampleMaski(__VA_ARGS__))
+#define glIndexFuncEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexFuncEXT(__VA_ARGS__))
+#define glPointParameteriNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameteriNV(__VA_ARGS__))
+#define glUniformMatrix3x2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3x2fv(__VA_ARGS__))
+#define glGetFramebufferParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFramebufferParameterivEXT(__VA_ARGS__))
+#define glUniform2i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2i64ARB(__VA_ARGS__))
+#define glNamedBufferStorageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferStorageEXT(__VA_ARGS__))
+#define glNamedFramebufferTexture3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTexture3DEXT(__VA_ARGS__))
+#define glVertexAttrib2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2dv(__VA_ARGS__))
+#define glGetVertexArrayPointervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayPointervEXT(__VA_ARGS__))
+#define glGetVertexAttribArrayObjectivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribArrayObjectivATI(__VA_ARGS__))
+#define glProgramUniformMatrix3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3fvEXT(__VA_ARGS__))
+#define glEnableVertexArrayEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVertexArrayEXT(__VA_ARGS__))
+#define glColorTableParameterfvSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTableParameterfvSGI(__VA_ARGS__))
+#define glEdgeFlag(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEdgeFlag(__VA_ARGS__))
+#define glFogCoordf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordf(__VA_ARGS__))
+#define glVertex3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3d(__VA_ARGS__))
+#define glVertex3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3f(__VA_ARGS__))
+#define glSpriteParameterivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSpriteParameterivSGIX(__VA_ARGS__))
+#define glPathGlyphRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathGlyphRangeNV(__VA_ARGS__))
+#define glPrimitiveBoundingBoxARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrimitiveBoundingBoxARB(__VA_ARGS__))
+#define glVertexAttribL3ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3ui64vNV(__VA_ARGS__))
+#define glVertex3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3s(__VA_ARGS__))
+#define glTexCoordP2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP2ui(__VA_ARGS__))
+#define glProgramUniform2fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2fvEXT(__VA_ARGS__))
+#define glDeletePathsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeletePathsNV(__VA_ARGS__))
+#define glPrimitiveRestartIndexNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrimitiveRestartIndexNV(__VA_ARGS__))
+#define glTexCoord2fColor3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fColor3fVertex3fvSUN(__VA_ARGS__))
+#define glTexCoordPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordPointerListIBM(__VA_ARGS__))
+#define glRectxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectxOES(__VA_ARGS__))
+#define glCopyNamedBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyNamedBufferSubData(__VA_ARGS__))
+#define glGenProgramsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenProgramsNV(__VA_ARGS__))
+#define glFragmentLightfSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightfSGIX(__VA_ARGS__))
+#define glTexStorage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorage3D(__VA_ARGS__))
+#define glTextureParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameteriv(__VA_ARGS__))
+#define glNamedBufferDataEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferDataEXT(__VA_ARGS__))
+#define glImportSemaphoreWin32NameEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportSemaphoreWin32NameEXT(__VA_ARGS__))
+#define glMultiTexCoord3fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3fvARB(__VA_ARGS__))
+#define glUniformMatrix3x4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3x4fv(__VA_ARGS__))
+#define glSubpixelPrecisionBiasNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSubpixelPrecisionBiasNV(__VA_ARGS__))
+#define glNormalPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalPointer(__VA_ARGS__))
+#define glNamedFramebufferTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTexture(__VA_ARGS__))
+#define glVertexAttrib4NsvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NsvARB(__VA_ARGS__))
+#define glPassThrough(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPassThrough(__VA_ARGS__))
+#define glSecondaryColorP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColorP3ui(__VA_ARGS__))
+#define glInvalidateTexSubImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateTexSubImage(__VA_ARGS__))
+#define glIsImageHandleResidentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsImageHandleResidentARB(__VA_ARGS__))
+#define glTangent3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3fvEXT(__VA_ARGS__))
+#define glProgramUniformMatrix4x3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x3fv(__VA_ARGS__))
+#define glBegin(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBegin(__VA_ARGS__))
+#define glEvalCoord2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord2dv(__VA_ARGS__))
+#define glColor3ubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3ubv(__VA_ARGS__))
+#define glFogCoordfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordfvEXT(__VA_ARGS__))
+#define glVertexP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexP3ui(__VA_ARGS__))
+#define glLightfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightfv(__VA_ARGS__))
+#define glVertexAttribL3i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3i64NV(__VA_ARGS__))
+#define glStencilClearTagEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilClearTagEXT(__VA_ARGS__))
+#define glGetActiveUniformName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveUniformName(__VA_ARGS__))
+#define glTangentPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangentPointerEXT(__VA_ARGS__))
+#define glUniform4ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4ui64vNV(__VA_ARGS__))
+#define glDebugMessageEnableAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageEnableAMD(__VA_ARGS__))
+#define glProgramUniform2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2ui(__VA_ARGS__))
+#define glCopyTexSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexSubImage2DEXT(__VA_ARGS__))
+#define glGenRenderbuffersEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenRenderbuffersEXT(__VA_ARGS__))
+#define glNamedProgramLocalParameterI4ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameterI4ivEXT(__VA_ARGS__))
+#define glMultiTexCoord2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2f(__VA_ARGS__))
+#define glMapGrid2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapGrid2d(__VA_ARGS__))
+#define glGetMultiTexParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexParameterIuivEXT(__VA_ARGS__))
+#define glBlendEquationiARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationiARB(__VA_ARGS__))
+#define glTexParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameteriv(__VA_ARGS__))
+#define glUniform4ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4ivARB(__VA_ARGS__))
+#define glMatrixOrthoEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixOrthoEXT(__VA_ARGS__))
+#define glVertexArrayVertexBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexBuffer(__VA_ARGS__))
+#define glProgramLocalParametersI4ivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParametersI4ivNV(__VA_ARGS__))
+#define glProgramUniform4ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4ui64vNV(__VA_ARGS__))
+#define glGetNamedStringivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedStringivARB(__VA_ARGS__))
+#define glVertexAttribL1i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1i64vNV(__VA_ARGS__))
+#define glTransformFeedbackBufferBase(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackBufferBase(__VA_ARGS__))
+#define glIndexsv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexsv(__VA_ARGS__))
+#define glPointParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterivNV(__VA_ARGS__))
+#define glGetDetailTexFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDetailTexFuncSGIS(__VA_ARGS__))
+#define glReplacementCodeuiColor3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiColor3fVertex3fvSUN(__VA_ARGS__))
+#define glProgramLocalParameter4fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameter4fARB(__VA_ARGS__))
+#define glBitmap(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBitmap(__VA_ARGS__))
+#define glNamedFramebufferTextureLayerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTextureLayerEXT(__VA_ARGS__))
+#define glMultiTexGenfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexGenfvEXT(__VA_ARGS__))
+#define glGetNamedBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferSubData(__VA_ARGS__))
+#define glStencilFuncSeparateATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilFuncSeparateATI(__VA_ARGS__))
+#define glProgramUniform2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2iv(__VA_ARGS__))
+#define glGetQueryiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryiv(__VA_ARGS__))
+#define glTexCoord4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4f(__VA_ARGS__))
+#define glMapGrid2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapGrid2f(__VA_ARGS__))
+#define glListParameterivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glListParameterivSGIX(__VA_ARGS__))
+#define glCreateQueries(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateQueries(__VA_ARGS__))
+#define glGetSamplerParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSamplerParameterfv(__VA_ARGS__))
+#define glTexCoord4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4i(__VA_ARGS__))
+#define glObjectLabel(...) (ge::gl::setCallSite(__FILE__,__LINE__),glObjectLabel(__VA_ARGS__))
+#define glProgramUniform3i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3i64NV(__VA_ARGS__))
+#define glGetTextureHandleARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureHandleARB(__VA_ARGS__))
+#define glTexCoord4s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4s(__VA_ARGS__))
+#define glUniform4iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4iARB(__VA_ARGS__))
+#define glGetUniformIndices(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformIndices(__VA_ARGS__))
+#define glMultiTexImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexImage3DEXT(__VA_ARGS__))
+#define glCoverageModulationTableNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCoverageModulationTableNV(__VA_ARGS__))
+#define glPointParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameteriv(__VA_ARGS__))
+#define glMultiTexCoord4svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4svARB(__VA_ARGS__))
+#define glNormal3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3fv(__VA_ARGS__))
+#define glProgramUniformMatrix3x4dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x4dvEXT(__VA_ARGS__))
+#define glTexCoord1fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1fv(__VA_ARGS__))
+#define glProgramUniformMatrix4x3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x3dvEXT(__VA_ARGS__))
+#define glGetActiveVaryingNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveVaryingNV(__VA_ARGS__))
+#define glUniform1i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1i64vARB(__VA_ARGS__))
+#define glMultiTexCoord1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1dv(__VA_ARGS__))
+#define glTexCoord3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3fv(__VA_ARGS__))
+#define glMatrixTranslatefEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixTranslatefEXT(__VA_ARGS__))
+#define glProgramUniform1ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1ui64vNV(__VA_ARGS__))
+#define glTextureMaterialEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureMaterialEXT(__VA_ARGS__))
+#define glMultiTexCoordP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP3uiv(__VA_ARGS__))
+#define glVertexAttribP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP3ui(__VA_ARGS__))
+#define glInterpolatePathsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInterpolatePathsNV(__VA_ARGS__))
+#define glTextureBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureBufferRange(__VA_ARGS__))
+#define glVertexAttribL2dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2dEXT(__VA_ARGS__))
+#define glGetPixelTransformParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelTransformParameterivEXT(__VA_ARGS__))
+#define glTexCoord4xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4xvOES(__VA_ARGS__))
+#define glGetVariantBooleanvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVariantBooleanvEXT(__VA_ARGS__))
+#define glDepthRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRange(__VA_ARGS__))
+#define glGetVertexAttribdvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribdvARB(__VA_ARGS__))
+#define glGetColorTableParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableParameterfv(__VA_ARGS__))
+#define glDrawArraysInstancedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArraysInstancedEXT(__VA_ARGS__))
+#define glDisableClientStateIndexedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableClientStateIndexedEXT(__VA_ARGS__))
+#define glDrawBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawBuffer(__VA_ARGS__))
+#define glMultiDrawArraysIndirectBindlessNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysIndirectBindlessNV(__VA_ARGS__))
+#define glGetnPixelMapusv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPixelMapusv(__VA_ARGS__))
+#define glRasterPos3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3fv(__VA_ARGS__))
+#define glClearBufferuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearBufferuiv(__VA_ARGS__))
+#define glGetInternalformati64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInternalformati64v(__VA_ARGS__))
+#define glShaderSourceARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderSourceARB(__VA_ARGS__))
+#define glShaderOp3EXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderOp3EXT(__VA_ARGS__))
+#define glWindowPos2dvMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2dvMESA(__VA_ARGS__))
+#define glClearIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearIndex(__VA_ARGS__))
+#define glProvokingVertexEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProvokingVertexEXT(__VA_ARGS__))
+#define glVariantubvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantubvEXT(__VA_ARGS__))
+#define glFlush(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlush(__VA_ARGS__))
+#define glFramebufferTexture2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture2DEXT(__VA_ARGS__))
+#define glGetColorTableParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableParameterivEXT(__VA_ARGS__))
+#define glPresentFrameDualFillNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPresentFrameDualFillNV(__VA_ARGS__))
+#define glGenVertexShadersEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenVertexShadersEXT(__VA_ARGS__))
+#define glSpecializeShaderARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSpecializeShaderARB(__VA_ARGS__))
+#define glProgramUniformHandleui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformHandleui64vARB(__VA_ARGS__))
+#define glDepthRangefOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRangefOES(__VA_ARGS__))
+#define glDeleteVertexArrays(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteVertexArrays(__VA_ARGS__))
+#define glDrawElementsInstancedBaseVertexBaseInstance(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsInstancedBaseVertexBaseInstance(__VA_ARGS__))
+#define glGetTexLevelParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexLevelParameteriv(__VA_ARGS__))
+#define glDrawVkImageNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawVkImageNV(__VA_ARGS__))
+#define glWindowPos3iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3iARB(__VA_ARGS__))
+#define glPrioritizeTextures(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrioritizeTextures(__VA_ARGS__))
+#define glWindowPos3fvMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3fvMESA(__VA_ARGS__))
+#define glProgramUniformMatrix3x2dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x2dvEXT(__VA_ARGS__))
+#define glVertex4xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4xvOES(__VA_ARGS__))
+#define glTexStorage3DMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorage3DMultisample(__VA_ARGS__))
+#define glWindowPos2sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2sARB(__VA_ARGS__))
+#define glStencilOpValueAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilOpValueAMD(__VA_ARGS__))
+#define glProgramVertexLimitNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramVertexLimitNV(__VA_ARGS__))
+#define glGetTexParameterPointervAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterPointervAPPLE(__VA_ARGS__))
+#define glProgramUniform3uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3uivEXT(__VA_ARGS__))
+#define glClampColor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClampColor(__VA_ARGS__))
+#define glClearStencil(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearStencil(__VA_ARGS__))
+#define glTexCoordP1uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP1uiv(__VA_ARGS__))
+#define glVertexAttribs3svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs3svNV(__VA_ARGS__))
+#define glMultiTexCoord3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3fv(__VA_ARGS__))
+#define glVertexBlendEnvfATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexBlendEnvfATI(__VA_ARGS__))
+#define glIsFenceAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsFenceAPPLE(__VA_ARGS__))
+#define glGetBufferParameterui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferParameterui64vNV(__VA_ARGS__))
+#define glVertexAttribI4bvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4bvEXT(__VA_ARGS__))
+#define glUniform2fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2fARB(__VA_ARGS__))
+#define glStopInstrumentsSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStopInstrumentsSGIX(__VA_ARGS__))
+#define glVertexAttrib3fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3fNV(__VA_ARGS__))
+#define glMapVertexAttrib2dAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapVertexAttrib2dAPPLE(__VA_ARGS__))
+#define glVertex2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2f(__VA_ARGS__))
+#define glCopyTextureImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureImage2DEXT(__VA_ARGS__))
+#define glVertex2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2d(__VA_ARGS__))
+#define glSecondaryColor3bvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3bvEXT(__VA_ARGS__))
+#define glMultiTexCoord4fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4fARB(__VA_ARGS__))
+#define glPolygonOffset(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonOffset(__VA_ARGS__))
+#define glTangent3bvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3bvEXT(__VA_ARGS__))
+#define glHistogram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glHistogram(__VA_ARGS__))
+#define glGetProgramiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramiv(__VA_ARGS__))
+#define glMatrixIndexubvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixIndexubvARB(__VA_ARGS__))
+#define glVertex2s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2s(__VA_ARGS__))
+#define glGetVertexAttribLui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribLui64vNV(__VA_ARGS__))
+#define glGetProgramStringARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramStringARB(__VA_ARGS__))
+#define glFlushMappedBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushMappedBufferRange(__VA_ARGS__))
+#define glVertexAttribI3uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI3uiEXT(__VA_ARGS__))
+#define glLineWidthxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLineWidthxOES(__VA_ARGS__))
+#define glProgramUniformMatrix2fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2fvEXT(__VA_ARGS__))
+#define glGetTextureParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterIuivEXT(__VA_ARGS__))
+#define glGetMultiTexEnvivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexEnvivEXT(__VA_ARGS__))
+#define glPixelTexGenParameterivSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTexGenParameterivSGIS(__VA_ARGS__))
+#define glGenQueries(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenQueries(__VA_ARGS__))
+#define glGetPixelMapfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelMapfv(__VA_ARGS__))
+#define glBlendColorEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendColorEXT(__VA_ARGS__))
+#define glResetMinmax(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResetMinmax(__VA_ARGS__))
+#define glGetnUniformivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformivARB(__VA_ARGS__))
+#define glVertexBlendARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexBlendARB(__VA_ARGS__))
+#define glVertexAttrib4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4d(__VA_ARGS__))
+#define glGetVaryingLocationNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVaryingLocationNV(__VA_ARGS__))
+#define glGetMapAttribParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapAttribParameterivNV(__VA_ARGS__))
+#define glTexSubImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage3D(__VA_ARGS__))
+#define glDeleteSamplers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteSamplers(__VA_ARGS__))
+#define glGetLightxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetLightxOES(__VA_ARGS__))
+#define glGetVertexAttribArrayObjectfvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribArrayObjectfvATI(__VA_ARGS__))
+#define glVertexArrayNormalOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayNormalOffsetEXT(__VA_ARGS__))
+#define glGetBufferParameterivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferParameterivARB(__VA_ARGS__))
+#define glGetTextureParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterfv(__VA_ARGS__))
+#define glDrawMeshArraysSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawMeshArraysSUN(__VA_ARGS__))
+#define glVertexAttrib4dNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4dNV(__VA_ARGS__))
+#define glGetMultisamplefvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultisamplefvNV(__VA_ARGS__))
+#define glMapObjectBufferATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapObjectBufferATI(__VA_ARGS__))
+#define glGetPathCommandsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathCommandsNV(__VA_ARGS__))
+#define glVertexArrayTexCoordOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayTexCoordOffsetEXT(__VA_ARGS__))
+#define glGetHistogram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogram(__VA_ARGS__))
+#define glMatrixMode(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMode(__VA_ARGS__))
+#define glColorFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorFormatNV(__VA_ARGS__))
+#define glProgramUniformui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformui64NV(__VA_ARGS__))
+#define glProgramUniformMatrix4x2fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x2fvEXT(__VA_ARGS__))
+#define glLoadMatrixxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadMatrixxOES(__VA_ARGS__))
+#define glGetColorTableParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableParameterfvEXT(__VA_ARGS__))
+#define glRasterPos4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4i(__VA_ARGS__))
+#define glVertexAttribL2i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2i64NV(__VA_ARGS__))
+#define glBindTextures(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTextures(__VA_ARGS__))
+#define glMatrixRotatefEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixRotatefEXT(__VA_ARGS__))
+#define glGetClipPlanexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetClipPlanexOES(__VA_ARGS__))
+#define glSecondaryColor3uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3uivEXT(__VA_ARGS__))
+#define glGetPerfQueryInfoINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfQueryInfoINTEL(__VA_ARGS__))
+#define glGetDoublev(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDoublev(__VA_ARGS__))
+#define glBindBufferRangeEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferRangeEXT(__VA_ARGS__))
+#define glCompressedTexImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexImage2D(__VA_ARGS__))
+#define glMapBufferARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapBufferARB(__VA_ARGS__))
+#define glGetPathSpacingNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathSpacingNV(__VA_ARGS__))
+#define glUniform4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4dv(__VA_ARGS__))
+#define glGlobalAlphaFactordSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactordSUN(__VA_ARGS__))
+#define glProgramUniform3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3dv(__VA_ARGS__))
+#define glGetShaderSourceARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetShaderSourceARB(__VA_ARGS__))
+#define glVertexAttrib3dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3dvARB(__VA_ARGS__))
+#define glInvalidateBufferData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateBufferData(__VA_ARGS__))
+#define glMatrixLoad3x2fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoad3x2fNV(__VA_ARGS__))
+#define glCompressedTextureSubImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureSubImage1D(__VA_ARGS__))
+#define glTexCoord3xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3xvOES(__VA_ARGS__))
+#define glGenTexturesEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenTexturesEXT(__VA_ARGS__))
+#define glTangent3iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3iEXT(__VA_ARGS__))
+#define glClearTexImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearTexImage(__VA_ARGS__))
+#define glBinormal3bvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3bvEXT(__VA_ARGS__))
+#define glUniform3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3fv(__VA_ARGS__))
+#define glGetnPixelMapusvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPixelMapusvARB(__VA_ARGS__))
+#define glMemoryObjectParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMemoryObjectParameterivEXT(__VA_ARGS__))
+#define glGenSemaphoresEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenSemaphoresEXT(__VA_ARGS__))
+#define glMultiTexCoordP1ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP1ui(__VA_ARGS__))
+#define glClearNamedBufferDataEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedBufferDataEXT(__VA_ARGS__))
+#define glUniformMatrix4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4dv(__VA_ARGS__))
+#define glWindowPos3fMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3fMESA(__VA_ARGS__))
+#define glDeleteRenderbuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteRenderbuffers(__VA_ARGS__))
+#define glGetTextureLevelParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureLevelParameterfvEXT(__VA_ARGS__))
+#define glGetHistogramParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogramParameterxvOES(__VA_ARGS__))
+#define glMultiDrawElements(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElements(__VA_ARGS__))
+#define glMakeImageHandleNonResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeImageHandleNonResidentNV(__VA_ARGS__))
+#define glTexSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage1DEXT(__VA_ARGS__))
+#define glNormalStream3dATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3dATI(__VA_ARGS__))
+#define glVertexAttribL4i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4i64vNV(__VA_ARGS__))
+#define glDrawBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawBuffers(__VA_ARGS__))
+#define glCopyTextureSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureSubImage1DEXT(__VA_ARGS__))
+#define glWindowRectanglesEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowRectanglesEXT(__VA_ARGS__))
+#define glNamedFramebufferReadBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferReadBuffer(__VA_ARGS__))
+#define glUniform2i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2i64vARB(__VA_ARGS__))
+#define glVertexAttribI1uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1uivEXT(__VA_ARGS__))
+#define glGetTexGenfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexGenfv(__VA_ARGS__))
+#define glBeginQueryARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginQueryARB(__VA_ARGS__))
+#define glUniform1iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1iARB(__VA_ARGS__))
+#define glVertex4bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4bvOES(__VA_ARGS__))
+#define glInvalidateSubFramebuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateSubFramebuffer(__VA_ARGS__))
+#define glUniform1fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1fvARB(__VA_ARGS__))
+#define glTestFenceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTestFenceNV(__VA_ARGS__))
+#define glBindTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTransformFeedback(__VA_ARGS__))
+#define glMultiTexCoord2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2iv(__VA_ARGS__))
+#define glCopyMultiTexSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyMultiTexSubImage1DEXT(__VA_ARGS__))
+#define glVariantbvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantbvEXT(__VA_ARGS__))
+#define glTexCoord1hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1hNV(__VA_ARGS__))
+#define glGenFencesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenFencesNV(__VA_ARGS__))
+#define glRasterPos3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3iv(__VA_ARGS__))
+#define glVertexAttribL2ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2ui64NV(__VA_ARGS__))
+#define glMultiTexCoord1hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1hvNV(__VA_ARGS__))
+#define glGetnConvolutionFilter(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnConvolutionFilter(__VA_ARGS__))
+#define glNormal3bv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3bv(__VA_ARGS__))
+#define glWeightbvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightbvARB(__VA_ARGS__))
+#define glTexCoord4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4sv(__VA_ARGS__))
+#define glUniform2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2uiv(__VA_ARGS__))
+#define glBeginConditionalRenderNVX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginConditionalRenderNVX(__VA_ARGS__))
+#define glFinish(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinish(__VA_ARGS__))
+#define glColorTableParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTableParameterfv(__VA_ARGS__))
+#define glFragmentCoverageColorNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentCoverageColorNV(__VA_ARGS__))
+#define glProgramUniform3ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3ivEXT(__VA_ARGS__))
+#define glVertexArrayVertexOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexOffsetEXT(__VA_ARGS__))
+#define glViewportPositionWScaleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glViewportPositionWScaleNV(__VA_ARGS__))
+#define glGetProgramLocalParameterIuivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramLocalParameterIuivNV(__VA_ARGS__))
+#define glReplacementCodeuiTexCoord2fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiTexCoord2fVertex3fvSUN(__VA_ARGS__))
+#define glUniform1uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1uiv(__VA_ARGS__))
+#define glUniformMatrix2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2dv(__VA_ARGS__))
+#define glIndexdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexdv(__VA_ARGS__))
+#define glSecondaryColor3ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3ivEXT(__VA_ARGS__))
+#define glTexCoord3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3iv(__VA_ARGS__))
+#define glVertexStream4fvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4fvATI(__VA_ARGS__))
+#define glDeformationMap3fSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeformationMap3fSGIX(__VA_ARGS__))
+#define glClearDepth(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearDepth(__VA_ARGS__))
+#define glGenAsyncMarkersSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenAsyncMarkersSGIX(__VA_ARGS__))
+#define glDisableIndexedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableIndexedEXT(__VA_ARGS__))
+#define glVertexWeightfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexWeightfvEXT(__VA_ARGS__))
+#define glGetProgramLocalParameterIivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramLocalParameterIivNV(__VA_ARGS__))
+#define glCompressedTexImage3DARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexImage3DARB(__VA_ARGS__))
+#define glProgramParameter4fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameter4fNV(__VA_ARGS__))
+#define glConvolutionParameterxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterxOES(__VA_ARGS__))
+#define glInsertComponentEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInsertComponentEXT(__VA_ARGS__))
+#define glCreateTextures(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateTextures(__VA_ARGS__))
+#define glSecondaryColor3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3iv(__VA_ARGS__))
+#define glCreateBuffers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateBuffers(__VA_ARGS__))
+#define glMultiTexCoord2xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2xvOES(__VA_ARGS__))
+#define glTexGenxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGenxvOES(__VA_ARGS__))
+#define glMultTransposeMatrixf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultTransposeMatrixf(__VA_ARGS__))
+#define glBeginTransformFeedbackEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginTransformFeedbackEXT(__VA_ARGS__))
+#define glTexCoord2fColor3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fColor3fVertex3fSUN(__VA_ARGS__))
+#define glNormal3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3sv(__VA_ARGS__))
+#define glFreeObjectBufferATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFreeObjectBufferATI(__VA_ARGS__))
+#define glBlendBarrierNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendBarrierNV(__VA_ARGS__))
+#define glUniform4i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4i64vNV(__VA_ARGS__))
+#define glGetnUniformuivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformuivARB(__VA_ARGS__))
+#define glAlphaFragmentOp3ATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAlphaFragmentOp3ATI(__VA_ARGS__))
+#define glProgramEnvParameters4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameters4fvEXT(__VA_ARGS__))
+#define glBlendFuncSeparateEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncSeparateEXT(__VA_ARGS__))
+#define glConvolutionParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterivEXT(__VA_ARGS__))
+#define glPixelTexGenSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTexGenSGIX(__VA_ARGS__))
+#define glDeleteProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteProgram(__VA_ARGS__))
+#define glUniformMatrix4x3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4x3dv(__VA_ARGS__))
+#define glGetVideoCaptureStreamivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoCaptureStreamivNV(__VA_ARGS__))
+#define glProgramUniform4uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4uiEXT(__VA_ARGS__))
+#define glMakeImageHandleNonResidentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeImageHandleNonResidentARB(__VA_ARGS__))
+#define glSecondaryColor3dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3dEXT(__VA_ARGS__))
+#define glDeleteQueries(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteQueries(__VA_ARGS__))
+#define glNormalP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalP3uiv(__VA_ARGS__))
+#define glRasterPos2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2d(__VA_ARGS__))
+#define glInitNames(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInitNames(__VA_ARGS__))
+#define glBinormal3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3fvEXT(__VA_ARGS__))
+#define glColor3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3dv(__VA_ARGS__))
+#define glVertexArrayVertexAttribDivisorEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribDivisorEXT(__VA_ARGS__))
+#define glArrayElementEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glArrayElementEXT(__VA_ARGS__))
+#define glProgramParameter4dNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameter4dNV(__VA_ARGS__))
+#define glIndexxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexxOES(__VA_ARGS__))
+#define glUniform3uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3uivEXT(__VA_ARGS__))
+#define glPopGroupMarkerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPopGroupMarkerEXT(__VA_ARGS__))
+#define glClearNamedFramebufferuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedFramebufferuiv(__VA_ARGS__))
+#define glSetLocalConstantEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSetLocalConstantEXT(__VA_ARGS__))
+#define glProgramUniform1ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1ui64NV(__VA_ARGS__))
+#define glColor4hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4hvNV(__VA_ARGS__))
+#define glGetVertexAttribfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribfv(__VA_ARGS__))
+#define glDispatchCompute(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDispatchCompute(__VA_ARGS__))
+#define glGetActiveAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveAttrib(__VA_ARGS__))
+#define glFragmentColorMaterialSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentColorMaterialSGIX(__VA_ARGS__))
+#define glTexSubImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage2D(__VA_ARGS__))
+#define glGetnMinmaxARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMinmaxARB(__VA_ARGS__))
+#define glLogicOp(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLogicOp(__VA_ARGS__))
+#define glProgramUniformMatrix3x4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x4fv(__VA_ARGS__))
+#define glWindowPos4iMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4iMESA(__VA_ARGS__))
+#define glPixelTransferf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransferf(__VA_ARGS__))
+#define glGetTextureParameterIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterIuiv(__VA_ARGS__))
+#define glMultiTexCoord1xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1xOES(__VA_ARGS__))
+#define glProgramUniformMatrix4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4dv(__VA_ARGS__))
+#define glGetnUniformiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformiv(__VA_ARGS__))
+#define glFramebufferTexture1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture1DEXT(__VA_ARGS__))
+#define glVertexPointervINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexPointervINTEL(__VA_ARGS__))
+#define glTextureParameterIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterIiv(__VA_ARGS__))
+#define glGetSeparableFilterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSeparableFilterEXT(__VA_ARGS__))
+#define glMultiTexCoord3iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3iARB(__VA_ARGS__))
+#define glRasterPos4xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4xvOES(__VA_ARGS__))
+#define glDrawTransformFeedbackStream(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawTransformFeedbackStream(__VA_ARGS__))
+#define glVertex3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3hvNV(__VA_ARGS__))
+#define glVertexArrayMultiTexCoordOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayMultiTexCoordOffsetEXT(__VA_ARGS__))
+#define glProvokingVertex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProvokingVertex(__VA_ARGS__))
+#define glAccumxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAccumxOES(__VA_ARGS__))
+#define glShaderBinary(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderBinary(__VA_ARGS__))
+#define glGetMultiTexGenivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexGenivEXT(__VA_ARGS__))
+#define glPointParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterxvOES(__VA_ARGS__))
+#define glCreateStatesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateStatesNV(__VA_ARGS__))
+#define glClearDepthdNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearDepthdNV(__VA_ARGS__))
+#define glClearColorIuiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearColorIuiEXT(__VA_ARGS__))
+#define glBindMultiTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindMultiTextureEXT(__VA_ARGS__))
+#define glTexGeniv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexGeniv(__VA_ARGS__))
+#define glDrawElements(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElements(__VA_ARGS__))
+#define glProgramUniform4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4iv(__VA_ARGS__))
+#define glDisableVertexArrayEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVertexArrayEXT(__VA_ARGS__))
+#define glProgramUniform3ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3ui64NV(__VA_ARGS__))
+#define glClientActiveTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClientActiveTexture(__VA_ARGS__))
+#define glMultiTexParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexParameterIivEXT(__VA_ARGS__))
+#define glUniform1i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1i64ARB(__VA_ARGS__))
+#define glUniform1iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1iv(__VA_ARGS__))
+#define glMulticastBarrierNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastBarrierNV(__VA_ARGS__))
+#define glVertexAttribArrayObjectATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribArrayObjectATI(__VA_ARGS__))
+#define glUniform2iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2iARB(__VA_ARGS__))
+#define glDrawArraysInstanced(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArraysInstanced(__VA_ARGS__))
+#define glVertexAttrib2sNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2sNV(__VA_ARGS__))
+#define glTexBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexBufferEXT(__VA_ARGS__))
+#define glVertexStream2fATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2fATI(__VA_ARGS__))
+#define glDebugMessageCallbackAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageCallbackAMD(__VA_ARGS__))
+#define glSamplerParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplerParameteriv(__VA_ARGS__))
+#define glVertexAttrib4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4uiv(__VA_ARGS__))
+#define glEndQueryIndexed(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndQueryIndexed(__VA_ARGS__))
+#define glNormalStream3sATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3sATI(__VA_ARGS__))
+#define glProgramParameteriARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameteriARB(__VA_ARGS__))
+#define glTexEnvxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexEnvxOES(__VA_ARGS__))
+#define glProgramUniform1iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1iv(__VA_ARGS__))
+#define glDisableVertexAttribAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVertexAttribAPPLE(__VA_ARGS__))
+#define glBindRenderbuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindRenderbuffer(__VA_ARGS__))
+#define glMultiTexSubImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexSubImage3DEXT(__VA_ARGS__))
+#define glIsProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsProgram(__VA_ARGS__))
+#define glMultiDrawElementsIndirectAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsIndirectAMD(__VA_ARGS__))
+#define glGetProgramInfoLog(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramInfoLog(__VA_ARGS__))
+#define glGetLocalConstantBooleanvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetLocalConstantBooleanvEXT(__VA_ARGS__))
+#define glPixelTransformParameteriEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransformParameteriEXT(__VA_ARGS__))
+#define glTexCoord4bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4bOES(__VA_ARGS__))
+#define glVertexAttrib4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4fv(__VA_ARGS__))
+#define glProgramUniformMatrix2x3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x3dv(__VA_ARGS__))
+#define glProgramEnvParametersI4uivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParametersI4uivNV(__VA_ARGS__))
+#define glTexCoord3xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3xOES(__VA_ARGS__))
+#define glLoadTransposeMatrixfARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadTransposeMatrixfARB(__VA_ARGS__))
+#define glImageTransformParameteriHP(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImageTransformParameteriHP(__VA_ARGS__))
+#define glMultiTexCoord4xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4xOES(__VA_ARGS__))
+#define glVertexAttribs3fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs3fvNV(__VA_ARGS__))
+#define glVertexAttrib2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2fv(__VA_ARGS__))
+#define glUniform3ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3ui64NV(__VA_ARGS__))
+#define glCombinerParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerParameterfvNV(__VA_ARGS__))
+#define glFragmentMaterialiSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentMaterialiSGIX(__VA_ARGS__))
+#define glGetBooleani_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBooleani_v(__VA_ARGS__))
+#define glGetProgramResourceIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramResourceIndex(__VA_ARGS__))
+#define glBeginConditionalRenderNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginConditionalRenderNV(__VA_ARGS__))
+#define glDisableClientState(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableClientState(__VA_ARGS__))
+#define glPathFogGenNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathFogGenNV(__VA_ARGS__))
+#define glStencilThenCoverFillPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilThenCoverFillPathNV(__VA_ARGS__))
+#define glVertexArrayIndexOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayIndexOffsetEXT(__VA_ARGS__))
+#define glProgramBufferParametersIuivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramBufferParametersIuivNV(__VA_ARGS__))
+#define glPixelTransformParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransformParameterivEXT(__VA_ARGS__))
+#define glDisableClientStateiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableClientStateiEXT(__VA_ARGS__))
+#define glTexBufferARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexBufferARB(__VA_ARGS__))
+#define glGetLocalConstantIntegervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetLocalConstantIntegervEXT(__VA_ARGS__))
+#define glColor4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4uiv(__VA_ARGS__))
+#define glProgramUniform3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3i(__VA_ARGS__))
+#define glMultiDrawElementsIndirectBindlessCountNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsIndirectBindlessCountNV(__VA_ARGS__))
+#define glGetBufferPointervARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferPointervARB(__VA_ARGS__))
+#define glMultiTexParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexParameterIuivEXT(__VA_ARGS__))
+#define glEvalMesh2(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalMesh2(__VA_ARGS__))
+#define glEvalMesh1(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalMesh1(__VA_ARGS__))
+#define glProgramUniform3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3f(__VA_ARGS__))
+#define glStencilThenCoverFillPathInstancedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilThenCoverFillPathInstancedNV(__VA_ARGS__))
+#define glProgramUniform3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3d(__VA_ARGS__))
+#define glMapVertexAttrib1dAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapVertexAttrib1dAPPLE(__VA_ARGS__))
+#define glEvalCoord2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord2fv(__VA_ARGS__))
+#define glGetUniformivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformivARB(__VA_ARGS__))
+#define glLoadTransposeMatrixd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadTransposeMatrixd(__VA_ARGS__))
+#define glLoadTransposeMatrixf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadTransposeMatrixf(__VA_ARGS__))
+#define glGetPointervEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPointervEXT(__VA_ARGS__))
+#define glSignalVkSemaphoreNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSignalVkSemaphoreNV(__VA_ARGS__))
+#define glEndConditionalRenderNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndConditionalRenderNV(__VA_ARGS__))
+#define glTexCoord2fNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fNormal3fVertex3fSUN(__VA_ARGS__))
+#define glUniform3i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3i64vARB(__VA_ARGS__))
+#define glProgramUniform2uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2uiEXT(__VA_ARGS__))
+#define glVertexAttribI1ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1ui(__VA_ARGS__))
+#define glProgramNamedParameter4dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramNamedParameter4dvNV(__VA_ARGS__))
+#define glCompileCommandListNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompileCommandListNV(__VA_ARGS__))
+#define glGetRenderbufferParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetRenderbufferParameterivEXT(__VA_ARGS__))
+#define glGetnPolygonStipple(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPolygonStipple(__VA_ARGS__))
+#define glIsBufferResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsBufferResidentNV(__VA_ARGS__))
+#define glSecondaryColor3ubvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3ubvEXT(__VA_ARGS__))
+#define glGetNamedRenderbufferParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedRenderbufferParameterivEXT(__VA_ARGS__))
+#define glNamedFramebufferSampleLocationsfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferSampleLocationsfvARB(__VA_ARGS__))
+#define glMultiTexGendvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexGendvEXT(__VA_ARGS__))
+#define glVertexArrayRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayRangeNV(__VA_ARGS__))
+#define glIsTextureHandleResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsTextureHandleResidentNV(__VA_ARGS__))
+#define glGetProgramEnvParameterdvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramEnvParameterdvARB(__VA_ARGS__))
+#define glIsNamedStringARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsNamedStringARB(__VA_ARGS__))
+#define glSecondaryColorFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColorFormatNV(__VA_ARGS__))
+#define glVertexAttrib4ubvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4ubvNV(__VA_ARGS__))
+#define glTagSampleBufferSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTagSampleBufferSGIX(__VA_ARGS__))
+#define glVDPAUUnregisterSurfaceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUUnregisterSurfaceNV(__VA_ARGS__))
+#define glGetPerfQueryIdByNameINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfQueryIdByNameINTEL(__VA_ARGS__))
+#define glGetInteger64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInteger64v(__VA_ARGS__))
+#define glClipPlane(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClipPlane(__VA_ARGS__))
+#define glColor4ubVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4ubVertex3fSUN(__VA_ARGS__))
+#define glIndexub(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexub(__VA_ARGS__))
+#define glGetProgramEnvParameterfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramEnvParameterfvARB(__VA_ARGS__))
+#define glVertexAttrib4usvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4usvARB(__VA_ARGS__))
+#define glNamedFramebufferRenderbuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferRenderbuffer(__VA_ARGS__))
+#define glProgramUniformMatrix3x4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x4dv(__VA_ARGS__))
+#define glTestFenceAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTestFenceAPPLE(__VA_ARGS__))
+#define glVertexAttrib4Niv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Niv(__VA_ARGS__))
+#define glVertexAttribL2i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL2i64vNV(__VA_ARGS__))
+#define glColorP4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorP4uiv(__VA_ARGS__))
+#define glUniformMatrix2x3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2x3fv(__VA_ARGS__))
+#define glCallCommandListNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCallCommandListNV(__VA_ARGS__))
+#define glClearBufferiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearBufferiv(__VA_ARGS__))
+#define glNamedStringARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedStringARB(__VA_ARGS__))
+#define glMatrixMult3x2fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMult3x2fNV(__VA_ARGS__))
+#define glGetNamedProgramStringEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedProgramStringEXT(__VA_ARGS__))
+#define glGetnHistogramARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnHistogramARB(__VA_ARGS__))
+#define glGetTextureLevelParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureLevelParameterfv(__VA_ARGS__))
+#define glMultiTexCoord1fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1fv(__VA_ARGS__))
+#define glBitmapxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBitmapxOES(__VA_ARGS__))
+#define glGetSamplerParameterIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSamplerParameterIuiv(__VA_ARGS__))
+#define glTexCoordP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP3ui(__VA_ARGS__))
+#define glTextureSubImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureSubImage1D(__VA_ARGS__))
+#define glVertexAttribLPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribLPointerEXT(__VA_ARGS__))
+#define glFogCoordPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordPointerEXT(__VA_ARGS__))
+#define glWindowPos3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3s(__VA_ARGS__))
+#define glVertexAttribs2svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs2svNV(__VA_ARGS__))
+#define glTextureImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage3DEXT(__VA_ARGS__))
+#define glWindowPos3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3i(__VA_ARGS__))
+#define glWindowPos3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3d(__VA_ARGS__))
+#define glWindowPos3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3f(__VA_ARGS__))
+#define glIsEnabledIndexedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsEnabledIndexedEXT(__VA_ARGS__))
+#define glGetNamedProgramivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedProgramivEXT(__VA_ARGS__))
+#define glVertex3xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3xvOES(__VA_ARGS__))
+#define glColor3us(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3us(__VA_ARGS__))
+#define glBeginPerfMonitorAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginPerfMonitorAMD(__VA_ARGS__))
+#define glProgramUniformMatrix4x3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x3dv(__VA_ARGS__))
+#define glGetNamedProgramLocalParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedProgramLocalParameterIuivEXT(__VA_ARGS__))
+#define glReadnPixels(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReadnPixels(__VA_ARGS__))
+#define glMultiTexCoord4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4f(__VA_ARGS__))
+#define glColor3ub(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3ub(__VA_ARGS__))
+#define glMultiTexCoord4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4d(__VA_ARGS__))
+#define glVertexAttribL3ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL3ui64NV(__VA_ARGS__))
+#define glColor3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3ui(__VA_ARGS__))
+#define glProgramUniform4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4fvEXT(__VA_ARGS__))
+#define glVertexAttrib2sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2sARB(__VA_ARGS__))
+#define glMultiTexCoord4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4i(__VA_ARGS__))
+#define glCheckFramebufferStatusEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCheckFramebufferStatusEXT(__VA_ARGS__))
+#define glGetnMapivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMapivARB(__VA_ARGS__))
+#define glMultiTexCoord1ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1ivARB(__VA_ARGS__))
+#define glDisableVertexAttribArrayARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVertexAttribArrayARB(__VA_ARGS__))
+#define glGetPolygonStipple(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPolygonStipple(__VA_ARGS__))
+#define glVertexAttribI4ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4ui(__VA_ARGS__))
+#define glGetPathDashArrayNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathDashArrayNV(__VA_ARGS__))
+#define glMultiTexRenderbufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexRenderbufferEXT(__VA_ARGS__))
+#define glCopyTextureSubImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureSubImage1D(__VA_ARGS__))
+#define glDeleteOcclusionQueriesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteOcclusionQueriesNV(__VA_ARGS__))
+#define glVertex4hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4hvNV(__VA_ARGS__))
+#define glGetnTexImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnTexImage(__VA_ARGS__))
+#define glProgramLocalParameter4dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameter4dARB(__VA_ARGS__))
+#define glBlendEquation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquation(__VA_ARGS__))
+#define glUnlockArraysEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnlockArraysEXT(__VA_ARGS__))
+#define glGetQueryObjectui64vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjectui64vEXT(__VA_ARGS__))
+#define glVertexAttribI4uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4uivEXT(__VA_ARGS__))
+#define glUniform1i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1i64vNV(__VA_ARGS__))
+#define glMultiTexCoord3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3dv(__VA_ARGS__))
+#define glColor4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4sv(__VA_ARGS__))
+#define glVertexStream4ivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4ivATI(__VA_ARGS__))
+#define glPopClientAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPopClientAttrib(__VA_ARGS__))
+#define glClearBufferData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearBufferData(__VA_ARGS__))
+#define glGetProgramivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramivNV(__VA_ARGS__))
+#define glBeginTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginTransformFeedback(__VA_ARGS__))
+#define glFinishObjectAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinishObjectAPPLE(__VA_ARGS__))
+#define glGetMinmaxParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMinmaxParameterivEXT(__VA_ARGS__))
+#define glColor3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3iv(__VA_ARGS__))
+#define glVertexAttrib3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3sv(__VA_ARGS__))
+#define glCompressedTexImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexImage1D(__VA_ARGS__))
+#define glDeleteTransformFeedbacks(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteTransformFeedbacks(__VA_ARGS__))
+#define glGetVideoi64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoi64vNV(__VA_ARGS__))
+#define glDrawRangeElementsBaseVertex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawRangeElementsBaseVertex(__VA_ARGS__))
+#define glUniform4i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4i64vARB(__VA_ARGS__))
+#define glTextureStorage3DMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage3DMultisampleEXT(__VA_ARGS__))
+#define glGetTexParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterfv(__VA_ARGS__))
+#define glProgramUniformui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformui64vNV(__VA_ARGS__))
+#define glCompressedMultiTexImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedMultiTexImage1DEXT(__VA_ARGS__))
+#define glProgramUniform2ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2ivEXT(__VA_ARGS__))
+#define glPushGroupMarkerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushGroupMarkerEXT(__VA_ARGS__))
+#define glVertexAttrib1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1dv(__VA_ARGS__))
+#define glMatrixLoadIdentityEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoadIdentityEXT(__VA_ARGS__))
+#define glMultTransposeMatrixxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultTransposeMatrixxOES(__VA_ARGS__))
+#define glGetPixelMapxv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPixelMapxv(__VA_ARGS__))
+#define glFramebufferSampleLocationsfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferSampleLocationsfvARB(__VA_ARGS__))
+#define glGetLightiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetLightiv(__VA_ARGS__))
+#define glBlendFuncSeparatei(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncSeparatei(__VA_ARGS__))
+#define glAcquireKeyedMutexWin32EXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAcquireKeyedMutexWin32EXT(__VA_ARGS__))
+#define glGetBooleanIndexedvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBooleanIndexedvEXT(__VA_ARGS__))
+#define glGetProgramSubroutineParameteruivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramSubroutineParameteruivNV(__VA_ARGS__))
+#define glUniform2ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2ui(__VA_ARGS__))
+#define glApplyFramebufferAttachmentCMAAINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glApplyFramebufferAttachmentCMAAINTEL(__VA_ARGS__))
+#define glWindowPos2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2fv(__VA_ARGS__))
+#define glWaitVkSemaphoreNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWaitVkSemaphoreNV(__VA_ARGS__))
+#define glDisablei(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisablei(__VA_ARGS__))
+#define glSelectPerfMonitorCountersAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSelectPerfMonitorCountersAMD(__VA_ARGS__))
+#define glGetVertexAttribLi64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribLi64vNV(__VA_ARGS__))
+#define glBlendFuncSeparateiARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncSeparateiARB(__VA_ARGS__))
+#define glWeightuivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightuivARB(__VA_ARGS__))
+#define glWindowPos2iARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2iARB(__VA_ARGS__))
+#define glGetProgramLocalParameterdvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramLocalParameterdvARB(__VA_ARGS__))
+#define glGetUniformui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformui64vARB(__VA_ARGS__))
+#define glSecondaryColor3us(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3us(__VA_ARGS__))
+#define glGetSynciv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSynciv(__VA_ARGS__))
+#define glMakeImageHandleResidentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeImageHandleResidentARB(__VA_ARGS__))
+#define glGetProgramNamedParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramNamedParameterfvNV(__VA_ARGS__))
+#define glTextureStorage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage3D(__VA_ARGS__))
+#define glVertexAttrib4svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4svNV(__VA_ARGS__))
+#define glProgramUniform2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2i(__VA_ARGS__))
+#define glListDrawCommandsStatesClientNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glListDrawCommandsStatesClientNV(__VA_ARGS__))
+#define glProgramLocalParametersI4uivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParametersI4uivNV(__VA_ARGS__))
+#define glBeginTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginTransformFeedbackNV(__VA_ARGS__))
+#define glGetProgramBinary(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramBinary(__VA_ARGS__))
+#define glBinormal3iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3iEXT(__VA_ARGS__))
+#define glEvalPoint1(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalPoint1(__VA_ARGS__))
+#define glEvalPoint2(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalPoint2(__VA_ARGS__))
+#define glPauseTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPauseTransformFeedback(__VA_ARGS__))
+#define glWindowPos2sMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2sMESA(__VA_ARGS__))
+#define glGlobalAlphaFactorbSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactorbSUN(__VA_ARGS__))
+#define glCreateTransformFeedbacks(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateTransformFeedbacks(__VA_ARGS__))
+#define glTexturePageCommitmentEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexturePageCommitmentEXT(__VA_ARGS__))
+#define glTransformFeedbackVaryingsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackVaryingsNV(__VA_ARGS__))
+#define glTexSubImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage1D(__VA_ARGS__))
+#define glConvolutionParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterfvEXT(__VA_ARGS__))
+#define glBlitFramebufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlitFramebufferEXT(__VA_ARGS__))
+#define glUniformMatrix4fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4fvARB(__VA_ARGS__))
+#define glProgramEnvParameter4dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameter4dvARB(__VA_ARGS__))
+#define glTextureStorageMem2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorageMem2DEXT(__VA_ARGS__))
+#define glVertexAttribP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP3uiv(__VA_ARGS__))
+#define glFogCoordFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordFormatNV(__VA_ARGS__))
+#define glGetMultiTexLevelParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMultiTexLevelParameterivEXT(__VA_ARGS__))
+#define glIsOcclusionQueryNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsOcclusionQueryNV(__VA_ARGS__))
+#define glCompressedTexImage2DARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexImage2DARB(__VA_ARGS__))
+#define glGetProgramEnvParameterIuivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramEnvParameterIuivNV(__VA_ARGS__))
+#define glVertexAttrib4sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4sv(__VA_ARGS__))
+#define glVertexAttrib4fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4fvARB(__VA_ARGS__))
+#define glLoadName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadName(__VA_ARGS__))
+#define glBindVertexShaderEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindVertexShaderEXT(__VA_ARGS__))
+#define glGetNamedProgramLocalParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedProgramLocalParameterIivEXT(__VA_ARGS__))
+#define glProgramUniform3uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3uiEXT(__VA_ARGS__))
+#define glProgramUniformMatrix4x2dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x2dvEXT(__VA_ARGS__))
+#define glTexCoord1hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord1hvNV(__VA_ARGS__))
+#define glLoadMatrixd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadMatrixd(__VA_ARGS__))
+#define glTexParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterfv(__VA_ARGS__))
+#define glVariantdvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantdvEXT(__VA_ARGS__))
+#define glCullParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCullParameterfvEXT(__VA_ARGS__))
+#define glUniform3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3dv(__VA_ARGS__))
+#define glProgramUniform3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3fv(__VA_ARGS__))
+#define glIsBufferARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsBufferARB(__VA_ARGS__))
+#define glMultiTexCoord1bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1bOES(__VA_ARGS__))
+#define glFogCoordhNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordhNV(__VA_ARGS__))
+#define glFramebufferSampleLocationsfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferSampleLocationsfvNV(__VA_ARGS__))
+#define glGenSymbolsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenSymbolsEXT(__VA_ARGS__))
+#define glGetConvolutionFilter(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionFilter(__VA_ARGS__))
+#define glProgramUniform1fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1fvEXT(__VA_ARGS__))
+#define glGetNextPerfQueryIdINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNextPerfQueryIdINTEL(__VA_ARGS__))
+#define glCompressedTexImage1DARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexImage1DARB(__VA_ARGS__))
+#define glBindSamplers(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindSamplers(__VA_ARGS__))
+#define glGetProgramEnvParameterIivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramEnvParameterIivNV(__VA_ARGS__))
+#define glGetQueryObjectui64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjectui64v(__VA_ARGS__))
+#define glVertexAttribL4ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4ui64vNV(__VA_ARGS__))
+#define glGetVideoivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoivNV(__VA_ARGS__))
+#define glGetTextureImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureImage(__VA_ARGS__))
+#define glProgramUniform1fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1fv(__VA_ARGS__))
+#define glUniformMatrix4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4fv(__VA_ARGS__))
+#define glColorMask(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorMask(__VA_ARGS__))
+#define glBeginFragmentShaderATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginFragmentShaderATI(__VA_ARGS__))
+#define glMultiDrawArraysEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysEXT(__VA_ARGS__))
+#define glGenNamesAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenNamesAMD(__VA_ARGS__))
+#define glPathParameteriNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathParameteriNV(__VA_ARGS__))
+#define glCreateCommandListsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateCommandListsNV(__VA_ARGS__))
+#define glDeleteProgramPipelines(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteProgramPipelines(__VA_ARGS__))
+#define glCopyColorSubTableEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyColorSubTableEXT(__VA_ARGS__))
+#define glVariantsvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantsvEXT(__VA_ARGS__))
+#define glGenProgramPipelines(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenProgramPipelines(__VA_ARGS__))
+#define glVertexArrayEdgeFlagOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayEdgeFlagOffsetEXT(__VA_ARGS__))
+#define glWindowPos2s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2s(__VA_ARGS__))
+#define glSecondaryColor3iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3iEXT(__VA_ARGS__))
+#define glWindowPos2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2i(__VA_ARGS__))
+#define glWindowPos2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2f(__VA_ARGS__))
+#define glWindowPos2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2d(__VA_ARGS__))
+#define glUniform4uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4uivEXT(__VA_ARGS__))
+#define glOrthoxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glOrthoxOES(__VA_ARGS__))
+#define glUniformSubroutinesuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformSubroutinesuiv(__VA_ARGS__))
+#define glRectdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRectdv(__VA_ARGS__))
+#define glProgramUniform1i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1i64vNV(__VA_ARGS__))
+#define glVertexAttribI4uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4uiEXT(__VA_ARGS__))
+#define glSecondaryColor3ubEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3ubEXT(__VA_ARGS__))
+#define glCompressedMultiTexSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedMultiTexSubImage1DEXT(__VA_ARGS__))
+#define glMultiTexGendEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexGendEXT(__VA_ARGS__))
+#define glColorP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorP3uiv(__VA_ARGS__))
+#define glFogCoordfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoordfv(__VA_ARGS__))
+#define glCompileShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompileShader(__VA_ARGS__))
+#define glTexCoord2hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2hNV(__VA_ARGS__))
+#define glUniform1uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1uivEXT(__VA_ARGS__))
+#define glMatrixLoadTransposedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixLoadTransposedEXT(__VA_ARGS__))
+#define glIndexfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexfv(__VA_ARGS__))
+#define glGetCompressedTextureImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCompressedTextureImage(__VA_ARGS__))
+#define glGetUniformuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformuivEXT(__VA_ARGS__))
+#define glGetnPixelMapfvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPixelMapfvARB(__VA_ARGS__))
+#define glFramebufferTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureEXT(__VA_ARGS__))
+#define glMultiDrawElementsIndirectCount(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsIndirectCount(__VA_ARGS__))
+#define glVertexAttribIPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribIPointer(__VA_ARGS__))
+#define glMultiTexCoordP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP3ui(__VA_ARGS__))
+#define glEvaluateDepthValuesARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvaluateDepthValuesARB(__VA_ARGS__))
+#define glGetNamedBufferParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferParameteriv(__VA_ARGS__))
+#define glGetNamedProgramLocalParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedProgramLocalParameterfvEXT(__VA_ARGS__))
+#define glColor4fNormal3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4fNormal3fVertex3fvSUN(__VA_ARGS__))
+#define glSeparableFilter2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSeparableFilter2DEXT(__VA_ARGS__))
+#define glTexParameterxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterxOES(__VA_ARGS__))
+#define glClearAccumxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearAccumxOES(__VA_ARGS__))
+#define glInvalidateFramebuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInvalidateFramebuffer(__VA_ARGS__))
+#define glWeightubvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightubvARB(__VA_ARGS__))
+#define glVertexAttrib1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1d(__VA_ARGS__))
+#define glVertexAttrib1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1f(__VA_ARGS__))
+#define glVertex4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4fv(__VA_ARGS__))
+#define glClearNamedFramebufferfi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedFramebufferfi(__VA_ARGS__))
+#define glGetQueryBufferObjectuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryBufferObjectuiv(__VA_ARGS__))
+#define glClearNamedFramebufferfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearNamedFramebufferfv(__VA_ARGS__))
+#define glEndVertexShaderEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndVertexShaderEXT(__VA_ARGS__))
+#define glVertexAttrib1s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1s(__VA_ARGS__))
+#define glMultiTexCoord4dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4dvARB(__VA_ARGS__))
+#define glMultiTexCoord1sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1sv(__VA_ARGS__))
+#define glUniform1ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1ui64vNV(__VA_ARGS__))
+#define glGetClipPlanefOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetClipPlanefOES(__VA_ARGS__))
+#define glRasterPos2s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2s(__VA_ARGS__))
+#define glWeightivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWeightivARB(__VA_ARGS__))
+#define glMultiTexCoord4hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4hvNV(__VA_ARGS__))
+#define glNormal3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3hNV(__VA_ARGS__))
+#define glGetSeparableFilter(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSeparableFilter(__VA_ARGS__))
+#define glGetPathTexGenivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathTexGenivNV(__VA_ARGS__))
+#define glColor4bv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4bv(__VA_ARGS__))
+#define glRasterPos2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2f(__VA_ARGS__))
+#define glNamedBufferPageCommitmentARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferPageCommitmentARB(__VA_ARGS__))
+#define glLoadIdentity(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadIdentity(__VA_ARGS__))
+#define glRasterPos2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos2i(__VA_ARGS__))
+#define glRasterPos4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4iv(__VA_ARGS__))
+#define glMultiTexCoord2fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2fvARB(__VA_ARGS__))
+#define glUniformMatrix4x3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4x3fv(__VA_ARGS__))
+#define glClearBufferfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearBufferfv(__VA_ARGS__))
+#define glMultiTexCoord4hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4hNV(__VA_ARGS__))
+#define glTextureBarrier(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureBarrier(__VA_ARGS__))
+#define glReplacementCodeuivSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuivSUN(__VA_ARGS__))
+#define glDeleteAsyncMarkersSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteAsyncMarkersSGIX(__VA_ARGS__))
+#define glTexCoord2bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2bvOES(__VA_ARGS__))
+#define glEvalCoord2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord2xOES(__VA_ARGS__))
+#define glGetSharpenTexFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSharpenTexFuncSGIS(__VA_ARGS__))
+#define glProgramUniformHandleui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformHandleui64vNV(__VA_ARGS__))
+#define glIglooInterfaceSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIglooInterfaceSGIX(__VA_ARGS__))
+#define glWindowPos2dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2dvARB(__VA_ARGS__))
+#define glClearBufferfi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearBufferfi(__VA_ARGS__))
+#define glDrawArraysIndirect(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArraysIndirect(__VA_ARGS__))
+#define glGenVertexArrays(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenVertexArrays(__VA_ARGS__))
+#define glGetTransformFeedbacki64_v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTransformFeedbacki64_v(__VA_ARGS__))
+#define glEnableVertexArrayAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVertexArrayAttrib(__VA_ARGS__))
+#define glProgramUniformMatrix3x2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x2dv(__VA_ARGS__))
+#define glVertexStream4fATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4fATI(__VA_ARGS__))
+#define glVertexBindingDivisor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexBindingDivisor(__VA_ARGS__))
+#define glGetSamplerParameterIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSamplerParameterIiv(__VA_ARGS__))
+#define glGetCoverageModulationTableNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCoverageModulationTableNV(__VA_ARGS__))
+#define glDepthRangedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRangedNV(__VA_ARGS__))
+#define glVertexAttrib3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3f(__VA_ARGS__))
+#define glMultiDrawRangeElementArrayAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawRangeElementArrayAPPLE(__VA_ARGS__))
+#define glVertexAttribFormatNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribFormatNV(__VA_ARGS__))
+#define glGetQueryBufferObjecti64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryBufferObjecti64v(__VA_ARGS__))
+#define glGetVertexAttribdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribdv(__VA_ARGS__))
+#define glGetUniformi64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformi64vARB(__VA_ARGS__))
+#define glAreTexturesResidentEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAreTexturesResidentEXT(__VA_ARGS__))
+#define glGetHandleARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHandleARB(__VA_ARGS__))
+#define glVideoCaptureStreamParameterdvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVideoCaptureStreamParameterdvNV(__VA_ARGS__))
+#define glMapParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapParameterivNV(__VA_ARGS__))
+#define glIsVertexArray(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsVertexArray(__VA_ARGS__))
+#define glSecondaryColor3sEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3sEXT(__VA_ARGS__))
+#define glGetTexParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterIivEXT(__VA_ARGS__))
+#define glFrameTerminatorGREMEDY(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFrameTerminatorGREMEDY(__VA_ARGS__))
+#define glBlendBarrierKHR(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendBarrierKHR(__VA_ARGS__))
+#define glVertexAttrib4NubARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NubARB(__VA_ARGS__))
+#define glPrimitiveRestartNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrimitiveRestartNV(__VA_ARGS__))
+#define glVertexAttribL1ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL1ui64vARB(__VA_ARGS__))
+#define glVertexAttribI4ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4ivEXT(__VA_ARGS__))
+#define glVertexAttribs4svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs4svNV(__VA_ARGS__))
+#define glUniform1ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1ui(__VA_ARGS__))
+#define glVertexAttrib2fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2fvARB(__VA_ARGS__))
+#define glVertexAttribI4svEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4svEXT(__VA_ARGS__))
+#define glTextureImage3DMultisampleCoverageNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage3DMultisampleCoverageNV(__VA_ARGS__))
+#define glMemoryBarrier(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMemoryBarrier(__VA_ARGS__))
+#define glGetVariantArrayObjectfvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVariantArrayObjectfvATI(__VA_ARGS__))
+#define glTexCoord4fColor4fNormal3fVertex4fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4fColor4fNormal3fVertex4fvSUN(__VA_ARGS__))
+#define glIsProgramARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsProgramARB(__VA_ARGS__))
+#define glBindImageTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindImageTextureEXT(__VA_ARGS__))
+#define glGetFragDataLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragDataLocation(__VA_ARGS__))
+#define glMultiTexCoord1svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1svARB(__VA_ARGS__))
+#define glGetMapxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapxvOES(__VA_ARGS__))
+#define glTextureStorage2DMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage2DMultisampleEXT(__VA_ARGS__))
+#define glGetMaterialfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMaterialfv(__VA_ARGS__))
+#define glVertexAttrib4NbvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4NbvARB(__VA_ARGS__))
+#define glPixelMapuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelMapuiv(__VA_ARGS__))
+#define glColorPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorPointerEXT(__VA_ARGS__))
+#define glEnableClientStateiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableClientStateiEXT(__VA_ARGS__))
+#define glClearTexSubImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearTexSubImage(__VA_ARGS__))
+#define glEvalCoord1xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord1xvOES(__VA_ARGS__))
+#define glDetachObjectARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDetachObjectARB(__VA_ARGS__))
+#define glGetTextureParameterIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterIiv(__VA_ARGS__))
+#define glVariantusvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantusvEXT(__VA_ARGS__))
+#define glCompressedTextureImage3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureImage3DEXT(__VA_ARGS__))
+#define glMultiTexCoord1dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1dARB(__VA_ARGS__))
+#define glGetVertexArrayIntegeri_vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayIntegeri_vEXT(__VA_ARGS__))
+#define glVertexAttribI4ubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4ubv(__VA_ARGS__))
+#define glPixelTexGenParameterfSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTexGenParameterfSGIS(__VA_ARGS__))
+#define glProgramUniformMatrix4x2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x2dv(__VA_ARGS__))
+#define glUniform3fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3fARB(__VA_ARGS__))
+#define glIsShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsShader(__VA_ARGS__))
+#define glConvolutionParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameteriv(__VA_ARGS__))
+#define glCopyMultiTexSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyMultiTexSubImage2DEXT(__VA_ARGS__))
+#define glEnableVertexAttribArrayARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVertexAttribArrayARB(__VA_ARGS__))
+#define glMulticastCopyBufferSubDataNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastCopyBufferSubDataNV(__VA_ARGS__))
+#define glEnable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnable(__VA_ARGS__))
+#define glGetActiveUniformsiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveUniformsiv(__VA_ARGS__))
+#define glGetVertexAttribivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribivARB(__VA_ARGS__))
+#define glTexCoord4hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4hvNV(__VA_ARGS__))
+#define glUseProgramObjectARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUseProgramObjectARB(__VA_ARGS__))
+#define glGetAttribLocation(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetAttribLocation(__VA_ARGS__))
+#define glVertexAttrib4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4dv(__VA_ARGS__))
+#define glGetTextureParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameteriv(__VA_ARGS__))
+#define glNamedBufferStorageMemEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferStorageMemEXT(__VA_ARGS__))
+#define glPathSubCoordsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathSubCoordsNV(__VA_ARGS__))
+#define glMatrixIndexusvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixIndexusvARB(__VA_ARGS__))
+#define glGetVideouivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideouivNV(__VA_ARGS__))
+#define glGetVideoCaptureivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoCaptureivNV(__VA_ARGS__))
+#define glProgramUniform3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3ui(__VA_ARGS__))
+#define glVertexAttrib3svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3svARB(__VA_ARGS__))
+#define glGetNamedBufferParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferParameterivEXT(__VA_ARGS__))
+#define glMatrixScaledEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixScaledEXT(__VA_ARGS__))
+#define glProgramUniformMatrix2x3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x3fv(__VA_ARGS__))
+#define glGetFragmentLightivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragmentLightivSGIX(__VA_ARGS__))
+#define glGetStringi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetStringi(__VA_ARGS__))
+#define glWindowPos2svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2svARB(__VA_ARGS__))
+#define glVertexAttrib2svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2svNV(__VA_ARGS__))
+#define glWindowPos2ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2ivARB(__VA_ARGS__))
+#define glGetVertexAttribPointervNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribPointervNV(__VA_ARGS__))
+#define glPushMatrix(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushMatrix(__VA_ARGS__))
+#define glEdgeFlagPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEdgeFlagPointerListIBM(__VA_ARGS__))
+#define glGenerateMipmapEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenerateMipmapEXT(__VA_ARGS__))
+#define glWindowPos3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3sv(__VA_ARGS__))
+#define glPathCoordsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathCoordsNV(__VA_ARGS__))
+#define glProgramUniform1i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1i(__VA_ARGS__))
+#define glProgramUniform1d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1d(__VA_ARGS__))
+#define glProgramUniform1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1f(__VA_ARGS__))
+#define glProgramParameteriEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameteriEXT(__VA_ARGS__))
+#define glCompressedMultiTexImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedMultiTexImage2DEXT(__VA_ARGS__))
+#define glProgramUniform3iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3iv(__VA_ARGS__))
+#define glIndexiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexiv(__VA_ARGS__))
+#define glMultiTexCoord4xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4xvOES(__VA_ARGS__))
+#define glEGLImageTargetTexture2DOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEGLImageTargetTexture2DOES(__VA_ARGS__))
+#define glPixelZoom(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelZoom(__VA_ARGS__))
+#define glVertex3bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3bvOES(__VA_ARGS__))
+#define glFramebufferReadBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferReadBufferEXT(__VA_ARGS__))
+#define glExtractComponentEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glExtractComponentEXT(__VA_ARGS__))
+#define glCombinerParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerParameterivNV(__VA_ARGS__))
+#define glMinmax(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMinmax(__VA_ARGS__))
+#define glColorP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorP3ui(__VA_ARGS__))
+#define glPointParameterfvSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfvSGIS(__VA_ARGS__))
+#define glBlendEquationi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendEquationi(__VA_ARGS__))
+#define glGetFogFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFogFuncSGIS(__VA_ARGS__))
+#define glVertexAttrib4fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4fvNV(__VA_ARGS__))
+#define glGetnMinmax(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMinmax(__VA_ARGS__))
+#define glFragmentLightiSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightiSGIX(__VA_ARGS__))
+#define glMultiTexCoord1bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord1bvOES(__VA_ARGS__))
+#define glSecondaryColorPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColorPointerEXT(__VA_ARGS__))
+#define glMultiTexCoordP4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoordP4uiv(__VA_ARGS__))
+#define glGetBufferSubDataARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferSubDataARB(__VA_ARGS__))
+#define glSecondaryColor3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3hNV(__VA_ARGS__))
+#define glGetPathParameterivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathParameterivNV(__VA_ARGS__))
+#define glFlushRasterSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushRasterSGIX(__VA_ARGS__))
+#define glElementPointerATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glElementPointerATI(__VA_ARGS__))
+#define glGetAttachedObjectsARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetAttachedObjectsARB(__VA_ARGS__))
+#define glUniform4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4iv(__VA_ARGS__))
+#define glFogxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogxOES(__VA_ARGS__))
+#define glSharpenTexFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSharpenTexFuncSGIS(__VA_ARGS__))
+#define glClearDepthfOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearDepthfOES(__VA_ARGS__))
+#define glDeleteCommandListsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteCommandListsNV(__VA_ARGS__))
+#define glSpecializeShader(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSpecializeShader(__VA_ARGS__))
+#define glVertex4hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4hNV(__VA_ARGS__))
+#define glSecondaryColor3dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3dvEXT(__VA_ARGS__))
+#define glGenTextures(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenTextures(__VA_ARGS__))
+#define glTextureStorage2DMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorage2DMultisample(__VA_ARGS__))
+#define glUniform3ui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3ui64vNV(__VA_ARGS__))
+#define glBlendFuncSeparateIndexedAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFuncSeparateIndexedAMD(__VA_ARGS__))
+#define glMakeBufferResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMakeBufferResidentNV(__VA_ARGS__))
+#define glShaderOp2EXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderOp2EXT(__VA_ARGS__))
+#define glGetVertexAttribivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribivNV(__VA_ARGS__))
+#define glTexParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterIivEXT(__VA_ARGS__))
+#define glGetPerfQueryDataINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfQueryDataINTEL(__VA_ARGS__))
+#define glVertexAttrib4dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4dvARB(__VA_ARGS__))
+#define glTextureSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureSubImage1DEXT(__VA_ARGS__))
+#define glGetActiveUniformBlockName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveUniformBlockName(__VA_ARGS__))
+#define glVertexAttrib2dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2dvARB(__VA_ARGS__))
+#define glVertexAttribPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribPointer(__VA_ARGS__))
+#define glDepthBoundsdNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthBoundsdNV(__VA_ARGS__))
+#define glDeleteTexturesEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteTexturesEXT(__VA_ARGS__))
+#define glDrawBuffersATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawBuffersATI(__VA_ARGS__))
+#define glLightModelxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightModelxvOES(__VA_ARGS__))
+#define glApplyTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glApplyTextureEXT(__VA_ARGS__))
+#define glGetImageHandleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetImageHandleNV(__VA_ARGS__))
+#define glGetMinmax(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMinmax(__VA_ARGS__))
+#define glGetFixedvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFixedvOES(__VA_ARGS__))
+#define glSamplePatternEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplePatternEXT(__VA_ARGS__))
+#define glUniform1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1f(__VA_ARGS__))
+#define glColor4fNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4fNormal3fVertex3fSUN(__VA_ARGS__))
+#define glFogCoorddvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoorddvEXT(__VA_ARGS__))
+#define glCopyTextureImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureImage1DEXT(__VA_ARGS__))
+#define glFlushMappedBufferRangeAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushMappedBufferRangeAPPLE(__VA_ARGS__))
+#define glVertex3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex3sv(__VA_ARGS__))
+#define glFlushStaticDataIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushStaticDataIBM(__VA_ARGS__))
+#define glProgramUniform4ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4ui64NV(__VA_ARGS__))
+#define glRasterPos4xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4xOES(__VA_ARGS__))
+#define glVertexAttribP1ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP1ui(__VA_ARGS__))
+#define glProgramUniform4dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4dvEXT(__VA_ARGS__))
+#define glEndTransformFeedbackEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndTransformFeedbackEXT(__VA_ARGS__))
+#define glBinormal3dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3dEXT(__VA_ARGS__))
+#define glGetTextureSubImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureSubImage(__VA_ARGS__))
+#define glGetNamedRenderbufferParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedRenderbufferParameteriv(__VA_ARGS__))
+#define glBindBuffersRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBuffersRange(__VA_ARGS__))
+#define glFinishAsyncSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinishAsyncSGIX(__VA_ARGS__))
+#define glBindFragDataLocationIndexed(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindFragDataLocationIndexed(__VA_ARGS__))
+#define glMultiTexCoord2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2dv(__VA_ARGS__))
+#define glUniform2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2iv(__VA_ARGS__))
+#define glProgramUniform2i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2i64vNV(__VA_ARGS__))
+#define glFlushVertexArrayRangeAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushVertexArrayRangeAPPLE(__VA_ARGS__))
+#define glTextureParameterf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterf(__VA_ARGS__))
+#define glMultiTexCoord3dvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3dvARB(__VA_ARGS__))
+#define glFeedbackBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFeedbackBuffer(__VA_ARGS__))
+#define glDebugMessageInsertARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageInsertARB(__VA_ARGS__))
+#define glMultiTexCoord2i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2i(__VA_ARGS__))
+#define glTextureSubImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureSubImage3D(__VA_ARGS__))
+#define glFramebufferTexture1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture1D(__VA_ARGS__))
+#define glGetShaderiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetShaderiv(__VA_ARGS__))
+#define glMultiTexCoord2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2d(__VA_ARGS__))
+#define glArrayObjectATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glArrayObjectATI(__VA_ARGS__))
+#define glGetPointeri_vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPointeri_vEXT(__VA_ARGS__))
+#define glGetPerfMonitorCountersAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfMonitorCountersAMD(__VA_ARGS__))
+#define glNamedBufferStorage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferStorage(__VA_ARGS__))
+#define glTexEnvxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexEnvxvOES(__VA_ARGS__))
+#define glProgramUniform2ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2ui64NV(__VA_ARGS__))
+#define glMultiTexCoord3bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3bOES(__VA_ARGS__))
+#define glUniform1dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1dv(__VA_ARGS__))
+#define glPixelTransferi(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransferi(__VA_ARGS__))
+#define glSecondaryColor3usvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3usvEXT(__VA_ARGS__))
+#define glProgramEnvParameterI4uivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameterI4uivNV(__VA_ARGS__))
+#define glVertex2sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2sv(__VA_ARGS__))
+#define glWindowPos4dMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4dMESA(__VA_ARGS__))
+#define glDebugMessageControlARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageControlARB(__VA_ARGS__))
+#define glIsTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsTextureEXT(__VA_ARGS__))
+#define glFragmentMaterialivSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentMaterialivSGIX(__VA_ARGS__))
+#define glLinkProgramARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLinkProgramARB(__VA_ARGS__))
+#define glFinishFenceAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFinishFenceAPPLE(__VA_ARGS__))
+#define glVertexArrayVertexAttribBindingEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribBindingEXT(__VA_ARGS__))
+#define glTexStorageMem3DMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorageMem3DMultisampleEXT(__VA_ARGS__))
+#define glUniform1ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1ui64vARB(__VA_ARGS__))
+#define glMultiTexCoord4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4fv(__VA_ARGS__))
+#define glMulticastFramebufferSampleLocationsfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastFramebufferSampleLocationsfvNV(__VA_ARGS__))
+#define glRasterPos3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3d(__VA_ARGS__))
+#define glPollAsyncSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPollAsyncSGIX(__VA_ARGS__))
+#define glRasterPos3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3f(__VA_ARGS__))
+#define glCompressedTexImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexImage3D(__VA_ARGS__))
+#define glVariantivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVariantivEXT(__VA_ARGS__))
+#define glUnmapTexture2DINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUnmapTexture2DINTEL(__VA_ARGS__))
+#define glMulticastWaitSyncNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastWaitSyncNV(__VA_ARGS__))
+#define glGetVertexAttribiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribiv(__VA_ARGS__))
+#define glGetPathCoordsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathCoordsNV(__VA_ARGS__))
+#define glColor4xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor4xvOES(__VA_ARGS__))
+#define glVertexAttrib3fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3fv(__VA_ARGS__))
+#define glRasterPos3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos3s(__VA_ARGS__))
+#define glVertex4bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4bOES(__VA_ARGS__))
+#define glTransformFeedbackVaryingsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackVaryingsEXT(__VA_ARGS__))
+#define glCombinerOutputNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCombinerOutputNV(__VA_ARGS__))
+#define glWindowPos4sMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4sMESA(__VA_ARGS__))
+#define glVertexAttrib4svARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4svARB(__VA_ARGS__))
+#define glIsList(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsList(__VA_ARGS__))
+#define glGetInfoLogARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetInfoLogARB(__VA_ARGS__))
+#define glUniformMatrix2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix2fv(__VA_ARGS__))
+#define glVertexAttribs3dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs3dvNV(__VA_ARGS__))
+#define glGlobalAlphaFactorsSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactorsSUN(__VA_ARGS__))
+#define glGetTrackMatrixivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTrackMatrixivNV(__VA_ARGS__))
+#define glTextureParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterfvEXT(__VA_ARGS__))
+#define glIsNamedBufferResidentNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsNamedBufferResidentNV(__VA_ARGS__))
+#define glProgramUniform4ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4ui64vARB(__VA_ARGS__))
+#define glTbufferMask3DFX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTbufferMask3DFX(__VA_ARGS__))
+#define glCoverFillPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCoverFillPathNV(__VA_ARGS__))
+#define glVertexAttrib1fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1fvARB(__VA_ARGS__))
+#define glGenerateTextureMipmap(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenerateTextureMipmap(__VA_ARGS__))
+#define glNamedProgramLocalParameterI4uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameterI4uivEXT(__VA_ARGS__))
+#define glMultiDrawElementsBaseVertex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsBaseVertex(__VA_ARGS__))
+#define glProgramSubroutineParametersuivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramSubroutineParametersuivNV(__VA_ARGS__))
+#define glProgramUniformMatrix2x4dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2x4dvEXT(__VA_ARGS__))
+#define glRotatexOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRotatexOES(__VA_ARGS__))
+#define glMemoryBarrierEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMemoryBarrierEXT(__VA_ARGS__))
+#define glVertexAttrib3svNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3svNV(__VA_ARGS__))
+#define glVertexStream3iATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3iATI(__VA_ARGS__))
+#define glCompressedTexSubImage1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexSubImage1D(__VA_ARGS__))
+#define glSetFenceNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSetFenceNV(__VA_ARGS__))
+#define glAttachObjectARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAttachObjectARB(__VA_ARGS__))
+#define glCopyConvolutionFilter1D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyConvolutionFilter1D(__VA_ARGS__))
+#define glTexStorageMem2DMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorageMem2DMultisampleEXT(__VA_ARGS__))
+#define glProgramParameters4fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameters4fvNV(__VA_ARGS__))
+#define glNamedFramebufferParameteriEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferParameteriEXT(__VA_ARGS__))
+#define glVertexAttrib4Nsv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4Nsv(__VA_ARGS__))
+#define glVertexAttribI4usvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4usvEXT(__VA_ARGS__))
+#define glTextureBufferRangeEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureBufferRangeEXT(__VA_ARGS__))
+#define glVertexP3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexP3uiv(__VA_ARGS__))
+#define glIsPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsPathNV(__VA_ARGS__))
+#define glGetnUniformi64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnUniformi64vARB(__VA_ARGS__))
+#define glFramebufferTextureMultiviewOVR(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureMultiviewOVR(__VA_ARGS__))
+#define glCompressedMultiTexSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedMultiTexSubImage2DEXT(__VA_ARGS__))
+#define glGetnMapdv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnMapdv(__VA_ARGS__))
+#define glDebugMessageCallback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDebugMessageCallback(__VA_ARGS__))
+#define glTangent3svEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3svEXT(__VA_ARGS__))
+#define glVertexAttribParameteriAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribParameteriAMD(__VA_ARGS__))
+#define glBufferSubDataARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferSubDataARB(__VA_ARGS__))
+#define glGetVertexAttribLui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribLui64vARB(__VA_ARGS__))
+#define glVertexAttribL4ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4ui64NV(__VA_ARGS__))
+#define glReplacementCodeuiColor4ubVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiColor4ubVertex3fSUN(__VA_ARGS__))
+#define glImageTransformParameterfHP(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImageTransformParameterfHP(__VA_ARGS__))
+#define glMap1f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMap1f(__VA_ARGS__))
+#define glRasterPos4fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4fv(__VA_ARGS__))
+#define glVertex2bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2bvOES(__VA_ARGS__))
+#define glGetMapControlPointsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMapControlPointsNV(__VA_ARGS__))
+#define glNamedProgramLocalParametersI4ivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParametersI4ivEXT(__VA_ARGS__))
+#define glBindBufferRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferRangeNV(__VA_ARGS__))
+#define glVertexStream3dvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3dvATI(__VA_ARGS__))
+#define glNormalPointerListIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalPointerListIBM(__VA_ARGS__))
+#define glFogFuncSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogFuncSGIS(__VA_ARGS__))
+#define glMultiModeDrawArraysIBM(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiModeDrawArraysIBM(__VA_ARGS__))
+#define glGetNamedFramebufferAttachmentParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedFramebufferAttachmentParameterivEXT(__VA_ARGS__))
+#define glGetFloatv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFloatv(__VA_ARGS__))
+#define glVertexArrayVertexAttribIFormatEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayVertexAttribIFormatEXT(__VA_ARGS__))
+#define glHint(...) (ge::gl::setCallSite(__FILE__,__LINE__),glHint(__VA_ARGS__))
+#define glVertexStream2svATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2svATI(__VA_ARGS__))
+#define glMultiDrawArraysIndirect(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawArraysIndirect(__VA_ARGS__))
+#define glMultiTexEnvfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexEnvfvEXT(__VA_ARGS__))
+#define glVertexAttribP2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribP2uiv(__VA_ARGS__))
+#define glProgramUniform1i64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1i64vARB(__VA_ARGS__))
+#define glFramebufferTextureARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTextureARB(__VA_ARGS__))
+#define glPushClientAttribDefaultEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushClientAttribDefaultEXT(__VA_ARGS__))
+#define glScalef(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScalef(__VA_ARGS__))
+#define glScaled(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScaled(__VA_ARGS__))
+#define glGetConvolutionParameterxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetConvolutionParameterxvOES(__VA_ARGS__))
+#define glGetProgramResourceName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramResourceName(__VA_ARGS__))
+#define glCopyColorTable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyColorTable(__VA_ARGS__))
+#define glDepthRangeArrayv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDepthRangeArrayv(__VA_ARGS__))
+#define glCoverFillPathInstancedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCoverFillPathInstancedNV(__VA_ARGS__))
+#define glMultiTexParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexParameterivEXT(__VA_ARGS__))
+#define glGetActiveAtomicCounterBufferiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetActiveAtomicCounterBufferiv(__VA_ARGS__))
+#define glStencilOpSeparate(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilOpSeparate(__VA_ARGS__))
+#define glVertexAttrib4fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4fNV(__VA_ARGS__))
+#define glGetColorTableParameterivSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableParameterivSGI(__VA_ARGS__))
+#define glVertexArrayAttribBinding(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayAttribBinding(__VA_ARGS__))
+#define glIsSemaphoreEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsSemaphoreEXT(__VA_ARGS__))
+#define glProgramParameters4dvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramParameters4dvNV(__VA_ARGS__))
+#define glVertexAttribL4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribL4dv(__VA_ARGS__))
+#define glGetTexParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameteriv(__VA_ARGS__))
+#define glGetUniformOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformOffsetEXT(__VA_ARGS__))
+#define glGetVertexAttribPointerv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribPointerv(__VA_ARGS__))
+#define glResumeTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glResumeTransformFeedbackNV(__VA_ARGS__))
+#define glProgramUniform3i64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3i64vNV(__VA_ARGS__))
+#define glTangent3fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3fEXT(__VA_ARGS__))
+#define glGetPathMetricRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathMetricRangeNV(__VA_ARGS__))
+#define glWindowPos2iMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2iMESA(__VA_ARGS__))
+#define glVertex2xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2xvOES(__VA_ARGS__))
+#define glGetnCompressedTexImage(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnCompressedTexImage(__VA_ARGS__))
+#define glWindowPos2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2dv(__VA_ARGS__))
+#define glReplacementCodeuiVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReplacementCodeuiVertex3fSUN(__VA_ARGS__))
+#define glGetTransformFeedbackVaryingEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTransformFeedbackVaryingEXT(__VA_ARGS__))
+#define glWindowPos3fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3fARB(__VA_ARGS__))
+#define glMapNamedBufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapNamedBufferEXT(__VA_ARGS__))
+#define glDisable(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisable(__VA_ARGS__))
+#define glIsPointInFillPathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsPointInFillPathNV(__VA_ARGS__))
+#define glVertexAttribI2uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2uiEXT(__VA_ARGS__))
+#define glProgramUniform4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4uiv(__VA_ARGS__))
+#define glQueryCounter(...) (ge::gl::setCallSite(__FILE__,__LINE__),glQueryCounter(__VA_ARGS__))
+#define glFramebufferRenderbufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferRenderbufferEXT(__VA_ARGS__))
+#define glBinormal3svEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormal3svEXT(__VA_ARGS__))
+#define glBindBufferOffsetNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferOffsetNV(__VA_ARGS__))
+#define glCopyTextureSubImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureSubImage2D(__VA_ARGS__))
+#define glGetProgramResourcefvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramResourcefvNV(__VA_ARGS__))
+#define glBinormalPointerEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBinormalPointerEXT(__VA_ARGS__))
+#define glGetLightfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetLightfv(__VA_ARGS__))
+#define glMulticastCopyImageSubDataNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMulticastCopyImageSubDataNV(__VA_ARGS__))
+#define glVertex2bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex2bOES(__VA_ARGS__))
+#define glUniform2ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2ivARB(__VA_ARGS__))
+#define glMultiTexCoord3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3s(__VA_ARGS__))
+#define glGetHistogramParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetHistogramParameterfvEXT(__VA_ARGS__))
+#define glGetProgramStringNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramStringNV(__VA_ARGS__))
+#define glGetTexGenxvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexGenxvOES(__VA_ARGS__))
+#define glTextureSubImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureSubImage2D(__VA_ARGS__))
+#define glObjectPurgeableAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glObjectPurgeableAPPLE(__VA_ARGS__))
+#define glColorTableSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColorTableSGI(__VA_ARGS__))
+#define glCopyConvolutionFilter2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyConvolutionFilter2DEXT(__VA_ARGS__))
+#define glMultiTexCoord3f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3f(__VA_ARGS__))
+#define glMultiTexCoord3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3d(__VA_ARGS__))
+#define glFogCoorddv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoorddv(__VA_ARGS__))
+#define glGetBufferPointerv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferPointerv(__VA_ARGS__))
+#define glProgramUniform1fEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform1fEXT(__VA_ARGS__))
+#define glWindowPos2fvMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2fvMESA(__VA_ARGS__))
+#define glAlphaToCoverageDitherControlNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glAlphaToCoverageDitherControlNV(__VA_ARGS__))
+#define glPolygonOffsetxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPolygonOffsetxOES(__VA_ARGS__))
+#define glVertexAttrib4dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4dARB(__VA_ARGS__))
+#define glUniformHandleui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformHandleui64vARB(__VA_ARGS__))
+#define glFragmentLightModelfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentLightModelfvSGIX(__VA_ARGS__))
+#define glSwizzleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSwizzleEXT(__VA_ARGS__))
+#define glBindFragmentShaderATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindFragmentShaderATI(__VA_ARGS__))
+#define glVertexAttribs3hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs3hvNV(__VA_ARGS__))
+#define glGenBuffersARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenBuffersARB(__VA_ARGS__))
+#define glTextureStorageMem2DMultisampleEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureStorageMem2DMultisampleEXT(__VA_ARGS__))
+#define glListParameterfvSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glListParameterfvSGIX(__VA_ARGS__))
+#define glNamedRenderbufferStorageMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedRenderbufferStorageMultisample(__VA_ARGS__))
+#define glVertexAttribI1iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1iEXT(__VA_ARGS__))
+#define glMultiTexCoord2ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2ivARB(__VA_ARGS__))
+#define glLightModelxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLightModelxOES(__VA_ARGS__))
+#define glColor3xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3xOES(__VA_ARGS__))
+#define glReadBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReadBuffer(__VA_ARGS__))
+#define glStencilFillPathInstancedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStencilFillPathInstancedNV(__VA_ARGS__))
+#define glVDPAUUnmapSurfacesNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVDPAUUnmapSurfacesNV(__VA_ARGS__))
+#define glProgramUniform4i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform4i64NV(__VA_ARGS__))
+#define glVertexStream4dvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream4dvATI(__VA_ARGS__))
+#define glIsQuery(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsQuery(__VA_ARGS__))
+#define glProgramUniformMatrix4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4fvEXT(__VA_ARGS__))
+#define glVertexAttrib3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3hNV(__VA_ARGS__))
+#define glFlushMappedNamedBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushMappedNamedBufferRange(__VA_ARGS__))
+#define glPushName(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushName(__VA_ARGS__))
+#define glGetClipPlane(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetClipPlane(__VA_ARGS__))
+#define glVertex4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4dv(__VA_ARGS__))
+#define glVertexAttrib3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3d(__VA_ARGS__))
+#define glBlendColor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendColor(__VA_ARGS__))
+#define glBindTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTransformFeedbackNV(__VA_ARGS__))
+#define glSamplerParameterIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplerParameterIuiv(__VA_ARGS__))
+#define glIndexubv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexubv(__VA_ARGS__))
+#define glNamedBufferPageCommitmentEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferPageCommitmentEXT(__VA_ARGS__))
+#define glCheckNamedFramebufferStatus(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCheckNamedFramebufferStatus(__VA_ARGS__))
+#define glGetObjectBufferfvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectBufferfvATI(__VA_ARGS__))
+#define glRasterPos4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4d(__VA_ARGS__))
+#define glRasterPos4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4f(__VA_ARGS__))
+#define glGetPerfMonitorCounterStringAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfMonitorCounterStringAMD(__VA_ARGS__))
+#define glVertexAttrib3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3s(__VA_ARGS__))
+#define glDrawElementsInstancedEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsInstancedEXT(__VA_ARGS__))
+#define glNamedProgramLocalParameterI4iEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameterI4iEXT(__VA_ARGS__))
+#define glRasterPos4s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterPos4s(__VA_ARGS__))
+#define glGetProgramStageiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramStageiv(__VA_ARGS__))
+#define glGetMaterialxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMaterialxOES(__VA_ARGS__))
+#define glPopMatrix(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPopMatrix(__VA_ARGS__))
+#define glGetVideoui64vNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVideoui64vNV(__VA_ARGS__))
+#define glTangent3bEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3bEXT(__VA_ARGS__))
+#define glGetGraphicsResetStatusARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetGraphicsResetStatusARB(__VA_ARGS__))
+#define glUniform4i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4i(__VA_ARGS__))
+#define glActiveTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glActiveTexture(__VA_ARGS__))
+#define glEnableVertexAttribArray(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVertexAttribArray(__VA_ARGS__))
+#define glTexCoord4fVertex4fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4fVertex4fvSUN(__VA_ARGS__))
+#define glUniform4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4d(__VA_ARGS__))
+#define glUniform4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4f(__VA_ARGS__))
+#define glRenderbufferStorageMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRenderbufferStorageMultisample(__VA_ARGS__))
+#define glCreateProgramPipelines(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateProgramPipelines(__VA_ARGS__))
+#define glVertexAttribLPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribLPointer(__VA_ARGS__))
+#define glUniform2uiEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2uiEXT(__VA_ARGS__))
+#define glMultiTexCoord3sv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3sv(__VA_ARGS__))
+#define glDrawElementsInstancedBaseVertex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawElementsInstancedBaseVertex(__VA_ARGS__))
+#define glPixelTransformParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransformParameterfvEXT(__VA_ARGS__))
+#define glDrawTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawTransformFeedbackNV(__VA_ARGS__))
+#define glTextureImage2DMultisampleCoverageNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage2DMultisampleCoverageNV(__VA_ARGS__))
+#define glNamedRenderbufferStorageMultisampleCoverageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedRenderbufferStorageMultisampleCoverageEXT(__VA_ARGS__))
+#define glIsTexture(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsTexture(__VA_ARGS__))
+#define glMultiTexCoord4iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4iv(__VA_ARGS__))
+#define glTexEnvfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexEnvfv(__VA_ARGS__))
+#define glPopDebugGroup(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPopDebugGroup(__VA_ARGS__))
+#define glUniformBlockBinding(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformBlockBinding(__VA_ARGS__))
+#define glWindowPos2svMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2svMESA(__VA_ARGS__))
+#define glGenerateTextureMipmapEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenerateTextureMipmapEXT(__VA_ARGS__))
+#define glBindLightParameterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindLightParameterEXT(__VA_ARGS__))
+#define glTexCoord3bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord3bOES(__VA_ARGS__))
+#define glTexCoordPointer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordPointer(__VA_ARGS__))
+#define glProgramUniformMatrix3x2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix3x2fv(__VA_ARGS__))
+#define glUniform2fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2fvARB(__VA_ARGS__))
+#define glProgramLocalParameterI4uivNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramLocalParameterI4uivNV(__VA_ARGS__))
+#define glFlushVertexArrayRangeNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFlushVertexArrayRangeNV(__VA_ARGS__))
+#define glSecondaryColor3svEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3svEXT(__VA_ARGS__))
+#define glGetBufferParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetBufferParameteriv(__VA_ARGS__))
+#define glGetQueryIndexediv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryIndexediv(__VA_ARGS__))
+#define glFramebufferTexture3DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture3DEXT(__VA_ARGS__))
+#define glLoadTransposeMatrixxOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLoadTransposeMatrixxOES(__VA_ARGS__))
+#define glDeleteTransformFeedbacksNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteTransformFeedbacksNV(__VA_ARGS__))
+#define glGetCompressedTextureImageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCompressedTextureImageEXT(__VA_ARGS__))
+#define glIndexMaterialEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexMaterialEXT(__VA_ARGS__))
+#define glFogCoorddEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFogCoorddEXT(__VA_ARGS__))
+#define glTexCoord2hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2hvNV(__VA_ARGS__))
+#define glGetFramebufferParameterfvAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFramebufferParameterfvAMD(__VA_ARGS__))
+#define glTexEnviv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexEnviv(__VA_ARGS__))
+#define glEndTransformFeedbackNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndTransformFeedbackNV(__VA_ARGS__))
+#define glGlobalAlphaFactoruiSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGlobalAlphaFactoruiSUN(__VA_ARGS__))
+#define glSelectBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSelectBuffer(__VA_ARGS__))
+#define glNamedBufferSubDataEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferSubDataEXT(__VA_ARGS__))
+#define glDisableVertexArrayAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVertexArrayAttrib(__VA_ARGS__))
+#define glBlendFunc(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBlendFunc(__VA_ARGS__))
+#define glCreateProgram(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCreateProgram(__VA_ARGS__))
+#define glVertexStream2dATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream2dATI(__VA_ARGS__))
+#define glUniform4ui64vARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4ui64vARB(__VA_ARGS__))
+#define glGetSemaphoreParameterui64vEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetSemaphoreParameterui64vEXT(__VA_ARGS__))
+#define glPrimitiveRestartIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPrimitiveRestartIndex(__VA_ARGS__))
+#define glNormalStream3fATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3fATI(__VA_ARGS__))
+#define glProgramUniformMatrix2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix2fv(__VA_ARGS__))
+#define glVertexAttribs1hvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribs1hvNV(__VA_ARGS__))
+#define glWindowPos4svMESA(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos4svMESA(__VA_ARGS__))
+#define glDeleteFragmentShaderATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteFragmentShaderATI(__VA_ARGS__))
+#define glBindImageTextures(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindImageTextures(__VA_ARGS__))
+#define glMap2xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMap2xOES(__VA_ARGS__))
+#define glEnd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnd(__VA_ARGS__))
+#define glMultiTexCoord2dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2dARB(__VA_ARGS__))
+#define glUniform1i64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1i64NV(__VA_ARGS__))
+#define glPathStringNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathStringNV(__VA_ARGS__))
+#define glGetNamedFramebufferParameterivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedFramebufferParameterivEXT(__VA_ARGS__))
+#define glGetProgramNamedParameterdvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetProgramNamedParameterdvNV(__VA_ARGS__))
+#define glPathDashArrayNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathDashArrayNV(__VA_ARGS__))
+#define glUniform3uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3uiv(__VA_ARGS__))
+#define glColor3fVertex3fvSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glColor3fVertex3fvSUN(__VA_ARGS__))
+#define glMultTransposeMatrixd(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultTransposeMatrixd(__VA_ARGS__))
+#define glClearColor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glClearColor(__VA_ARGS__))
+#define glGetImageHandleARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetImageHandleARB(__VA_ARGS__))
+#define glTangent3dEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTangent3dEXT(__VA_ARGS__))
+#define glGetQueryObjectivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryObjectivARB(__VA_ARGS__))
+#define glGetLocalConstantFloatvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetLocalConstantFloatvEXT(__VA_ARGS__))
+#define glUseShaderProgramEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUseShaderProgramEXT(__VA_ARGS__))
+#define glBindRenderbufferEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindRenderbufferEXT(__VA_ARGS__))
+#define glInterleavedArrays(...) (ge::gl::setCallSite(__FILE__,__LINE__),glInterleavedArrays(__VA_ARGS__))
+#define glGetPerfMonitorGroupStringAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPerfMonitorGroupStringAMD(__VA_ARGS__))
+#define glUniform3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform3ui(__VA_ARGS__))
+#define glGetNamedProgramLocalParameterdvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedProgramLocalParameterdvEXT(__VA_ARGS__))
+#define glDeleteQueryResourceTagNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDeleteQueryResourceTagNV(__VA_ARGS__))
+#define glVertexAttribI4uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4uiv(__VA_ARGS__))
+#define glVertexAttrib4bv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4bv(__VA_ARGS__))
+#define glMultiTexCoord3xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3xOES(__VA_ARGS__))
+#define glSecondaryColor3ub(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3ub(__VA_ARGS__))
+#define glFragmentMaterialfSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFragmentMaterialfSGIX(__VA_ARGS__))
+#define glGetVariantArrayObjectivATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVariantArrayObjectivATI(__VA_ARGS__))
+#define glSecondaryColor3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3ui(__VA_ARGS__))
+#define glVertexAttrib1dARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1dARB(__VA_ARGS__))
+#define glGetNamedBufferPointerv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferPointerv(__VA_ARGS__))
+#define glLockArraysEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLockArraysEXT(__VA_ARGS__))
+#define glVertexAttribPointerNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribPointerNV(__VA_ARGS__))
+#define glConvolutionParameterf(...) (ge::gl::setCallSite(__FILE__,__LINE__),glConvolutionParameterf(__VA_ARGS__))
+#define glBindBufferBaseEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferBaseEXT(__VA_ARGS__))
+#define glTexCoord2xvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2xvOES(__VA_ARGS__))
+#define glGetQueryBufferObjectui64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetQueryBufferObjectui64v(__VA_ARGS__))
+#define glSetMultisamplefvAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSetMultisamplefvAMD(__VA_ARGS__))
+#define glPathColorGenNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathColorGenNV(__VA_ARGS__))
+#define glVertexAttrib3sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3sARB(__VA_ARGS__))
+#define glVertexAttrib4ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib4ivARB(__VA_ARGS__))
+#define glGenTransformFeedbacks(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenTransformFeedbacks(__VA_ARGS__))
+#define glGetVertexAttribIuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexAttribIuiv(__VA_ARGS__))
+#define glPixelTransformParameterfEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPixelTransformParameterfEXT(__VA_ARGS__))
+#define glGetTexParameterIuivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterIuivEXT(__VA_ARGS__))
+#define glGetObjectParameterivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectParameterivARB(__VA_ARGS__))
+#define glVertexArraySecondaryColorOffsetEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArraySecondaryColorOffsetEXT(__VA_ARGS__))
+#define glWindowPos2fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos2fARB(__VA_ARGS__))
+#define glCompressedTexSubImage2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexSubImage2D(__VA_ARGS__))
+#define glCompressedTexSubImage3DARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTexSubImage3DARB(__VA_ARGS__))
+#define glProgramBinary(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramBinary(__VA_ARGS__))
+#define glPresentFrameKeyedNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPresentFrameKeyedNV(__VA_ARGS__))
+#define glVertexAttribI4bv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI4bv(__VA_ARGS__))
+#define glPathCoverDepthFuncNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPathCoverDepthFuncNV(__VA_ARGS__))
+#define glTransformFeedbackStreamAttribsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTransformFeedbackStreamAttribsNV(__VA_ARGS__))
+#define glSecondaryColor3usEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3usEXT(__VA_ARGS__))
+#define glCopyColorTableSGI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyColorTableSGI(__VA_ARGS__))
+#define glProgramEnvParameter4fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramEnvParameter4fvARB(__VA_ARGS__))
+#define glMultiTexCoord4sARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4sARB(__VA_ARGS__))
+#define glGetVertexArrayIndexed64iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetVertexArrayIndexed64iv(__VA_ARGS__))
+#define glMatrixMultTranspose3x3fNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMatrixMultTranspose3x3fNV(__VA_ARGS__))
+#define glTexParameterIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexParameterIiv(__VA_ARGS__))
+#define glVertexArrayAttribFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexArrayAttribFormat(__VA_ARGS__))
+#define glEndTransformFeedback(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndTransformFeedback(__VA_ARGS__))
+#define glDrawCommandsStatesAddressNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawCommandsStatesAddressNV(__VA_ARGS__))
+#define glUniform4ui64NV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4ui64NV(__VA_ARGS__))
+#define glMaterialiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMaterialiv(__VA_ARGS__))
+#define glTexImage2DMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage2DMultisample(__VA_ARGS__))
+#define glBindTextureEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTextureEXT(__VA_ARGS__))
+#define glIsBuffer(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsBuffer(__VA_ARGS__))
+#define glVertexAttribI1iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1iv(__VA_ARGS__))
+#define glGetFinalCombinerInputParameterfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFinalCombinerInputParameterfvNV(__VA_ARGS__))
+#define glMultiTexCoord3bvOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3bvOES(__VA_ARGS__))
+#define glVertexAttribDivisor(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribDivisor(__VA_ARGS__))
+#define glCopyBufferSubData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyBufferSubData(__VA_ARGS__))
+#define glBindTexGenParameterEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindTexGenParameterEXT(__VA_ARGS__))
+#define glNormalStream3bATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3bATI(__VA_ARGS__))
+#define glTexStorageMem2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexStorageMem2DEXT(__VA_ARGS__))
+#define glTextureImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage2DEXT(__VA_ARGS__))
+#define glGetColorTableParameteriv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetColorTableParameteriv(__VA_ARGS__))
+#define glActiveTextureARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glActiveTextureARB(__VA_ARGS__))
+#define glTexCoord4xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord4xOES(__VA_ARGS__))
+#define glNamedBufferStorageExternalEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedBufferStorageExternalEXT(__VA_ARGS__))
+#define glSecondaryColor3fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSecondaryColor3fvEXT(__VA_ARGS__))
+#define glUniformMatrix4x2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix4x2fv(__VA_ARGS__))
+#define glStartInstrumentsSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glStartInstrumentsSGIX(__VA_ARGS__))
+#define glProgramNamedParameter4fvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramNamedParameter4fvNV(__VA_ARGS__))
+#define glEndVideoCaptureNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndVideoCaptureNV(__VA_ARGS__))
+#define glGenLists(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenLists(__VA_ARGS__))
+#define glUniform1fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1fARB(__VA_ARGS__))
+#define glNamedFramebufferTexture1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferTexture1DEXT(__VA_ARGS__))
+#define glMapBufferRange(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMapBufferRange(__VA_ARGS__))
+#define glMultiDrawElementsIndirectCountARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsIndirectCountARB(__VA_ARGS__))
+#define glProgramUniformMatrix4x2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniformMatrix4x2fv(__VA_ARGS__))
+#define glGetTextureParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTextureParameterIivEXT(__VA_ARGS__))
+#define glMultiTexCoord3hNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord3hNV(__VA_ARGS__))
+#define glNamedProgramLocalParametersI4uivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParametersI4uivEXT(__VA_ARGS__))
+#define glEndList(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEndList(__VA_ARGS__))
+#define glTexCoord2fColor4fNormal3fVertex3fSUN(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoord2fColor4fNormal3fVertex3fSUN(__VA_ARGS__))
+#define glGenTransformFeedbacksNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenTransformFeedbacksNV(__VA_ARGS__))
+#define glEdgeFlagv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEdgeFlagv(__VA_ARGS__))
+#define glVertexAttribI2iv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI2iv(__VA_ARGS__))
+#define glCopyMultiTexImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyMultiTexImage2DEXT(__VA_ARGS__))
+#define glUniformMatrix3x2dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3x2dv(__VA_ARGS__))
+#define glTexImage3DMultisampleCoverageNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage3DMultisampleCoverageNV(__VA_ARGS__))
+#define glGetShaderPrecisionFormat(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetShaderPrecisionFormat(__VA_ARGS__))
+#define glTexSubImage4DSGIS(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexSubImage4DSGIS(__VA_ARGS__))
+#define glRasterSamplesEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glRasterSamplesEXT(__VA_ARGS__))
+#define glTextureView(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureView(__VA_ARGS__))
+#define glEvalMapsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalMapsNV(__VA_ARGS__))
+#define glGetFragDataLocationEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetFragDataLocationEXT(__VA_ARGS__))
+#define glGetCompressedMultiTexImageEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetCompressedMultiTexImageEXT(__VA_ARGS__))
+#define glIndexMask(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIndexMask(__VA_ARGS__))
+#define glPushClientAttrib(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPushClientAttrib(__VA_ARGS__))
+#define glShaderSource(...) (ge::gl::setCallSite(__FILE__,__LINE__),glShaderSource(__VA_ARGS__))
+#define glDispatchComputeGroupSizeARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDispatchComputeGroupSizeARB(__VA_ARGS__))
+#define glLGPUNamedBufferSubDataNVX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glLGPUNamedBufferSubDataNVX(__VA_ARGS__))
+#define glGetnPixelMapfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPixelMapfv(__VA_ARGS__))
+#define glTexCoordP2uiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP2uiv(__VA_ARGS__))
+#define glUniform2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform2f(__VA_ARGS__))
+#define glGetNamedBufferParameteri64v(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetNamedBufferParameteri64v(__VA_ARGS__))
+#define glCommandListSegmentsNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCommandListSegmentsNV(__VA_ARGS__))
+#define glTextureParameterIivEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureParameterIivEXT(__VA_ARGS__))
+#define glMultiTexParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexParameterfvEXT(__VA_ARGS__))
+#define glProgramUniform2ui64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2ui64ARB(__VA_ARGS__))
+#define glVertex4d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4d(__VA_ARGS__))
+#define glNewObjectBufferATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNewObjectBufferATI(__VA_ARGS__))
+#define glViewportSwizzleNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glViewportSwizzleNV(__VA_ARGS__))
+#define glBufferData(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBufferData(__VA_ARGS__))
+#define glTextureImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTextureImage1DEXT(__VA_ARGS__))
+#define glGetTexParameterIiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetTexParameterIiv(__VA_ARGS__))
+#define glCopyTexSubImage1DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTexSubImage1DEXT(__VA_ARGS__))
+#define glVertex4f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertex4f(__VA_ARGS__))
+#define glUniformMatrix3fvARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniformMatrix3fvARB(__VA_ARGS__))
+#define glTexCoordP1ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexCoordP1ui(__VA_ARGS__))
+#define glPointParameterfvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glPointParameterfvEXT(__VA_ARGS__))
+#define glUniform4fARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform4fARB(__VA_ARGS__))
+#define glImportMemoryFdEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glImportMemoryFdEXT(__VA_ARGS__))
+#define glCopyTextureSubImage3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyTextureSubImage3D(__VA_ARGS__))
+#define glMultiTexCoord2fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2fv(__VA_ARGS__))
+#define glNamedFramebufferSamplePositionsfvAMD(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedFramebufferSamplePositionsfvAMD(__VA_ARGS__))
+#define glNormalP3ui(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalP3ui(__VA_ARGS__))
+#define glDrawRangeElementArrayATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawRangeElementArrayATI(__VA_ARGS__))
+#define glVertexAttribI1i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttribI1i(__VA_ARGS__))
+#define glDrawArraysInstancedARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArraysInstancedARB(__VA_ARGS__))
+#define glEnableVertexAttribAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEnableVertexAttribAPPLE(__VA_ARGS__))
+#define glGetDebugMessageLogARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetDebugMessageLogARB(__VA_ARGS__))
+#define glGetPathTexGenfvNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetPathTexGenfvNV(__VA_ARGS__))
+#define glNamedProgramLocalParameters4fvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNamedProgramLocalParameters4fvEXT(__VA_ARGS__))
+#define glQueryResourceTagNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glQueryResourceTagNV(__VA_ARGS__))
+#define glVertexStream3fvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexStream3fvATI(__VA_ARGS__))
+#define glFramebufferTexture3D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFramebufferTexture3D(__VA_ARGS__))
+#define glCompressedTextureSubImage2DEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCompressedTextureSubImage2DEXT(__VA_ARGS__))
+#define glWindowPos3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glWindowPos3dv(__VA_ARGS__))
+#define glCopyConvolutionFilter2D(...) (ge::gl::setCallSite(__FILE__,__LINE__),glCopyConvolutionFilter2D(__VA_ARGS__))
+#define glReadInstrumentsSGIX(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReadInstrumentsSGIX(__VA_ARGS__))
+#define glProgramUniform2dvEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform2dvEXT(__VA_ARGS__))
+#define glSamplerParameterfv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glSamplerParameterfv(__VA_ARGS__))
+#define glBindBufferARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBindBufferARB(__VA_ARGS__))
+#define glVertexAttrib1sNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib1sNV(__VA_ARGS__))
+#define glGetMaterialiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetMaterialiv(__VA_ARGS__))
+#define glUniform1fv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1fv(__VA_ARGS__))
+#define glBeginOcclusionQueryNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glBeginOcclusionQueryNV(__VA_ARGS__))
+#define glGenFencesAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGenFencesAPPLE(__VA_ARGS__))
+#define glScissorIndexedv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glScissorIndexedv(__VA_ARGS__))
+#define glDisableVariantClientStateEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDisableVariantClientStateEXT(__VA_ARGS__))
+#define glMinmaxEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMinmaxEXT(__VA_ARGS__))
+#define glNormalPointervINTEL(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalPointervINTEL(__VA_ARGS__))
+#define glNormal3s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3s(__VA_ARGS__))
+#define glGetnPixelMapuiv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetnPixelMapuiv(__VA_ARGS__))
+#define glNormalStream3bvATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormalStream3bvATI(__VA_ARGS__))
+#define glGetObjectParameterivAPPLE(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetObjectParameterivAPPLE(__VA_ARGS__))
+#define glNormal3i(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3i(__VA_ARGS__))
+#define glUniform1ivARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUniform1ivARB(__VA_ARGS__))
+#define glNormal3d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3d(__VA_ARGS__))
+#define glUpdateObjectBufferATI(...) (ge::gl::setCallSite(__FILE__,__LINE__),glUpdateObjectBufferATI(__VA_ARGS__))
+#define glNormal3b(...) (ge::gl::setCallSite(__FILE__,__LINE__),glNormal3b(__VA_ARGS__))
+#define glGetUniformBufferSizeEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformBufferSizeEXT(__VA_ARGS__))
+#define glMultiTexCoord4dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord4dv(__VA_ARGS__))
+#define glProgramUniform3i64ARB(...) (ge::gl::setCallSite(__FILE__,__LINE__),glProgramUniform3i64ARB(__VA_ARGS__))
+#define glVertexAttrib2d(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2d(__VA_ARGS__))
+#define glVertexAttrib2f(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2f(__VA_ARGS__))
+#define glMultiDrawElementsEXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiDrawElementsEXT(__VA_ARGS__))
+#define glVertexAttrib3dv(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib3dv(__VA_ARGS__))
+#define glMultiTexCoord2bOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glMultiTexCoord2bOES(__VA_ARGS__))
+#define glVertexAttrib2s(...) (ge::gl::setCallSite(__FILE__,__LINE__),glVertexAttrib2s(__VA_ARGS__))
+#define glTexImage3DMultisample(...) (ge::gl::setCallSite(__FILE__,__LINE__),glTexImage3DMultisample(__VA_ARGS__))
+#define glGetUniformBlockIndex(...) (ge::gl::setCallSite(__FILE__,__LINE__),glGetUniformBlockIndex(__VA_ARGS__))
+#define glReleaseKeyedMutexWin32EXT(...) (ge::gl::setCallSite(__FILE__,__LINE__),glReleaseKeyedMutexWin32EXT(__VA_ARGS__))
+#define glFrontFace(...) (ge::gl::setCallSite(__FILE__,__LINE__),glFrontFace(__VA_ARGS__))
+#define glEvalCoord1xOES(...) (ge::gl::setCallSite(__FILE__,__LINE__),glEvalCoord1xOES(__VA_ARGS__))
+#define glDrawArraysInstancedBaseInstance(...) (ge::gl::setCallSite(__FILE__,__LINE__),glDrawArraysInstancedBaseInstance(__VA_ARGS__))
+#define glIsPointInStrokePathNV(...) (ge::gl::setCallSite(__FILE__,__LINE__),glIsPointInStrokePathNV(__VA_ARGS__))
@@ -0,0 +1,2925 @@
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV){this->m_orig_glMultiDrawArraysIndirectBindlessCountNV = this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV;this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&ValidationTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_validation;}
+if(this->m_ptr_glTextureParameterfv){this->m_orig_glTextureParameterfv = this->m_ptr_glTextureParameterfv;this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&ValidationTableDecorator::m_glTextureParameterfv_validation;}
+if(this->m_ptr_glGetListParameterivSGIX){this->m_orig_glGetListParameterivSGIX = this->m_ptr_glGetListParameterivSGIX;this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&ValidationTableDecorator::m_glGetListParameterivSGIX_validation;}
+if(this->m_ptr_glProgramUniform1i64ARB){this->m_orig_glProgramUniform1i64ARB = this->m_ptr_glProgramUniform1i64ARB;this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&ValidationTableDecorator::m_glProgramUniform1i64ARB_validation;}
+if(this->m_ptr_glVertexArrayElementBuffer){this->m_orig_glVertexArrayElementBuffer = this->m_ptr_glVertexArrayElementBuffer;this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&ValidationTableDecorator::m_glVertexArrayElementBuffer_validation;}
+if(this->m_ptr_glHintPGI){this->m_orig_glHintPGI = this->m_ptr_glHintPGI;this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&ValidationTableDecorator::m_glHintPGI_validation;}
+if(this->m_ptr_glStencilMaskSeparate){this->m_orig_glStencilMaskSeparate = this->m_ptr_glStencilMaskSeparate;this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&ValidationTableDecorator::m_glStencilMaskSeparate_validation;}
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT){this->m_orig_glGetFramebufferAttachmentParameterivEXT = this->m_ptr_glGetFramebufferAttachmentParameterivEXT;this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_validation;}
+if(this->m_ptr_glTextureStorage3DMultisample){this->m_orig_glTextureStorage3DMultisample = this->m_ptr_glTextureStorage3DMultisample;this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&ValidationTableDecorator::m_glTextureStorage3DMultisample_validation;}
+if(this->m_ptr_glGetIntegerIndexedvEXT){this->m_orig_glGetIntegerIndexedvEXT = this->m_ptr_glGetIntegerIndexedvEXT;this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&ValidationTableDecorator::m_glGetIntegerIndexedvEXT_validation;}
+if(this->m_ptr_glCopyTexImage1D){this->m_orig_glCopyTexImage1D = this->m_ptr_glCopyTexImage1D;this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&ValidationTableDecorator::m_glCopyTexImage1D_validation;}
+if(this->m_ptr_glVertexAttrib4usv){this->m_orig_glVertexAttrib4usv = this->m_ptr_glVertexAttrib4usv;this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&ValidationTableDecorator::m_glVertexAttrib4usv_validation;}
+if(this->m_ptr_glTexRenderbufferNV){this->m_orig_glTexRenderbufferNV = this->m_ptr_glTexRenderbufferNV;this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&ValidationTableDecorator::m_glTexRenderbufferNV_validation;}
+if(this->m_ptr_glVertexAttrib3hvNV){this->m_orig_glVertexAttrib3hvNV = this->m_ptr_glVertexAttrib3hvNV;this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&ValidationTableDecorator::m_glVertexAttrib3hvNV_validation;}
+if(this->m_ptr_glProgramUniform4ui64ARB){this->m_orig_glProgramUniform4ui64ARB = this->m_ptr_glProgramUniform4ui64ARB;this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&ValidationTableDecorator::m_glProgramUniform4ui64ARB_validation;}
+if(this->m_ptr_glInstrumentsBufferSGIX){this->m_orig_glInstrumentsBufferSGIX = this->m_ptr_glInstrumentsBufferSGIX;this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&ValidationTableDecorator::m_glInstrumentsBufferSGIX_validation;}
+if(this->m_ptr_glIndexi){this->m_orig_glIndexi = this->m_ptr_glIndexi;this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&ValidationTableDecorator::m_glIndexi_validation;}
+if(this->m_ptr_glMultiTexCoord2sARB){this->m_orig_glMultiTexCoord2sARB = this->m_ptr_glMultiTexCoord2sARB;this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2sARB_validation;}
+if(this->m_ptr_glProgramEnvParameter4fARB){this->m_orig_glProgramEnvParameter4fARB = this->m_ptr_glProgramEnvParameter4fARB;this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&ValidationTableDecorator::m_glProgramEnvParameter4fARB_validation;}
+if(this->m_ptr_glCompressedTexSubImage3D){this->m_orig_glCompressedTexSubImage3D = this->m_ptr_glCompressedTexSubImage3D;this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&ValidationTableDecorator::m_glCompressedTexSubImage3D_validation;}
+if(this->m_ptr_glEvalCoord2d){this->m_orig_glEvalCoord2d = this->m_ptr_glEvalCoord2d;this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&ValidationTableDecorator::m_glEvalCoord2d_validation;}
+if(this->m_ptr_glEvalCoord2f){this->m_orig_glEvalCoord2f = this->m_ptr_glEvalCoord2f;this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&ValidationTableDecorator::m_glEvalCoord2f_validation;}
+if(this->m_ptr_glIndexd){this->m_orig_glIndexd = this->m_ptr_glIndexd;this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&ValidationTableDecorator::m_glIndexd_validation;}
+if(this->m_ptr_glSecondaryColor3hvNV){this->m_orig_glSecondaryColor3hvNV = this->m_ptr_glSecondaryColor3hvNV;this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&ValidationTableDecorator::m_glSecondaryColor3hvNV_validation;}
+if(this->m_ptr_glIndexf){this->m_orig_glIndexf = this->m_ptr_glIndexf;this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&ValidationTableDecorator::m_glIndexf_validation;}
+if(this->m_ptr_glFrustumxOES){this->m_orig_glFrustumxOES = this->m_ptr_glFrustumxOES;this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&ValidationTableDecorator::m_glFrustumxOES_validation;}
+if(this->m_ptr_glTextureStorage3DEXT){this->m_orig_glTextureStorage3DEXT = this->m_ptr_glTextureStorage3DEXT;this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&ValidationTableDecorator::m_glTextureStorage3DEXT_validation;}
+if(this->m_ptr_glDrawCommandsStatesNV){this->m_orig_glDrawCommandsStatesNV = this->m_ptr_glDrawCommandsStatesNV;this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&ValidationTableDecorator::m_glDrawCommandsStatesNV_validation;}
+if(this->m_ptr_glUniform4uiEXT){this->m_orig_glUniform4uiEXT = this->m_ptr_glUniform4uiEXT;this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&ValidationTableDecorator::m_glUniform4uiEXT_validation;}
+if(this->m_ptr_glProgramUniform3ui64ARB){this->m_orig_glProgramUniform3ui64ARB = this->m_ptr_glProgramUniform3ui64ARB;this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&ValidationTableDecorator::m_glProgramUniform3ui64ARB_validation;}
+if(this->m_ptr_glIndexs){this->m_orig_glIndexs = this->m_ptr_glIndexs;this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&ValidationTableDecorator::m_glIndexs_validation;}
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT){this->m_orig_glVertexArrayBindVertexBufferEXT = this->m_ptr_glVertexArrayBindVertexBufferEXT;this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&ValidationTableDecorator::m_glVertexArrayBindVertexBufferEXT_validation;}
+if(this->m_ptr_glConvolutionParameteriEXT){this->m_orig_glConvolutionParameteriEXT = this->m_ptr_glConvolutionParameteriEXT;this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&ValidationTableDecorator::m_glConvolutionParameteriEXT_validation;}
+if(this->m_ptr_glColor4ubVertex2fSUN){this->m_orig_glColor4ubVertex2fSUN = this->m_ptr_glColor4ubVertex2fSUN;this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&ValidationTableDecorator::m_glColor4ubVertex2fSUN_validation;}
+if(this->m_ptr_glProgramUniform1ivEXT){this->m_orig_glProgramUniform1ivEXT = this->m_ptr_glProgramUniform1ivEXT;this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&ValidationTableDecorator::m_glProgramUniform1ivEXT_validation;}
+if(this->m_ptr_glGetnMapfv){this->m_orig_glGetnMapfv = this->m_ptr_glGetnMapfv;this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&ValidationTableDecorator::m_glGetnMapfv_validation;}
+if(this->m_ptr_glTransformFeedbackBufferRange){this->m_orig_glTransformFeedbackBufferRange = this->m_ptr_glTransformFeedbackBufferRange;this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&ValidationTableDecorator::m_glTransformFeedbackBufferRange_validation;}
+if(this->m_ptr_glPathGlyphsNV){this->m_orig_glPathGlyphsNV = this->m_ptr_glPathGlyphsNV;this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&ValidationTableDecorator::m_glPathGlyphsNV_validation;}
+if(this->m_ptr_glSecondaryColor3fv){this->m_orig_glSecondaryColor3fv = this->m_ptr_glSecondaryColor3fv;this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&ValidationTableDecorator::m_glSecondaryColor3fv_validation;}
+if(this->m_ptr_glGetCombinerInputParameterivNV){this->m_orig_glGetCombinerInputParameterivNV = this->m_ptr_glGetCombinerInputParameterivNV;this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&ValidationTableDecorator::m_glGetCombinerInputParameterivNV_validation;}
+if(this->m_ptr_glEndPerfMonitorAMD){this->m_orig_glEndPerfMonitorAMD = this->m_ptr_glEndPerfMonitorAMD;this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&ValidationTableDecorator::m_glEndPerfMonitorAMD_validation;}
+if(this->m_ptr_glPointParameterfvARB){this->m_orig_glPointParameterfvARB = this->m_ptr_glPointParameterfvARB;this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&ValidationTableDecorator::m_glPointParameterfvARB_validation;}
+if(this->m_ptr_glVertex2xOES){this->m_orig_glVertex2xOES = this->m_ptr_glVertex2xOES;this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&ValidationTableDecorator::m_glVertex2xOES_validation;}
+if(this->m_ptr_glDrawElementsInstancedBaseInstance){this->m_orig_glDrawElementsInstancedBaseInstance = this->m_ptr_glDrawElementsInstancedBaseInstance;this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&ValidationTableDecorator::m_glDrawElementsInstancedBaseInstance_validation;}
+if(this->m_ptr_glMultTransposeMatrixdARB){this->m_orig_glMultTransposeMatrixdARB = this->m_ptr_glMultTransposeMatrixdARB;this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&ValidationTableDecorator::m_glMultTransposeMatrixdARB_validation;}
+if(this->m_ptr_glVertexAttribL4dEXT){this->m_orig_glVertexAttribL4dEXT = this->m_ptr_glVertexAttribL4dEXT;this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&ValidationTableDecorator::m_glVertexAttribL4dEXT_validation;}
+if(this->m_ptr_glVertex4iv){this->m_orig_glVertex4iv = this->m_ptr_glVertex4iv;this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&ValidationTableDecorator::m_glVertex4iv_validation;}
+if(this->m_ptr_glCoverStrokePathInstancedNV){this->m_orig_glCoverStrokePathInstancedNV = this->m_ptr_glCoverStrokePathInstancedNV;this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&ValidationTableDecorator::m_glCoverStrokePathInstancedNV_validation;}
+if(this->m_ptr_glDeformSGIX){this->m_orig_glDeformSGIX = this->m_ptr_glDeformSGIX;this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&ValidationTableDecorator::m_glDeformSGIX_validation;}
+if(this->m_ptr_glUniform2ui64NV){this->m_orig_glUniform2ui64NV = this->m_ptr_glUniform2ui64NV;this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&ValidationTableDecorator::m_glUniform2ui64NV_validation;}
+if(this->m_ptr_glCopyPathNV){this->m_orig_glCopyPathNV = this->m_ptr_glCopyPathNV;this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&ValidationTableDecorator::m_glCopyPathNV_validation;}
+if(this->m_ptr_glVertexAttribP4ui){this->m_orig_glVertexAttribP4ui = this->m_ptr_glVertexAttribP4ui;this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&ValidationTableDecorator::m_glVertexAttribP4ui_validation;}
+if(this->m_ptr_glVertexAttribL2d){this->m_orig_glVertexAttribL2d = this->m_ptr_glVertexAttribL2d;this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&ValidationTableDecorator::m_glVertexAttribL2d_validation;}
+if(this->m_ptr_glGetMultisamplefv){this->m_orig_glGetMultisamplefv = this->m_ptr_glGetMultisamplefv;this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&ValidationTableDecorator::m_glGetMultisamplefv_validation;}
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT){this->m_orig_glCompressedMultiTexSubImage3DEXT = this->m_ptr_glCompressedMultiTexSubImage3DEXT;this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCompressedMultiTexSubImage3DEXT_validation;}
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV){this->m_orig_glVDPAURegisterOutputSurfaceNV = this->m_ptr_glVDPAURegisterOutputSurfaceNV;this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&ValidationTableDecorator::m_glVDPAURegisterOutputSurfaceNV_validation;}
+if(this->m_ptr_glMinSampleShading){this->m_orig_glMinSampleShading = this->m_ptr_glMinSampleShading;this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&ValidationTableDecorator::m_glMinSampleShading_validation;}
+if(this->m_ptr_glProgramUniform4fEXT){this->m_orig_glProgramUniform4fEXT = this->m_ptr_glProgramUniform4fEXT;this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&ValidationTableDecorator::m_glProgramUniform4fEXT_validation;}
+if(this->m_ptr_glCoverStrokePathNV){this->m_orig_glCoverStrokePathNV = this->m_ptr_glCoverStrokePathNV;this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&ValidationTableDecorator::m_glCoverStrokePathNV_validation;}
+if(this->m_ptr_glTextureImage2DMultisampleNV){this->m_orig_glTextureImage2DMultisampleNV = this->m_ptr_glTextureImage2DMultisampleNV;this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&ValidationTableDecorator::m_glTextureImage2DMultisampleNV_validation;}
+if(this->m_ptr_glVertex3bOES){this->m_orig_glVertex3bOES = this->m_ptr_glVertex3bOES;this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&ValidationTableDecorator::m_glVertex3bOES_validation;}
+if(this->m_ptr_glImportMemoryWin32HandleEXT){this->m_orig_glImportMemoryWin32HandleEXT = this->m_ptr_glImportMemoryWin32HandleEXT;this->m_ptr_glImportMemoryWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)&ValidationTableDecorator::m_glImportMemoryWin32HandleEXT_validation;}
+if(this->m_ptr_glTessellationFactorAMD){this->m_orig_glTessellationFactorAMD = this->m_ptr_glTessellationFactorAMD;this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&ValidationTableDecorator::m_glTessellationFactorAMD_validation;}
+if(this->m_ptr_glDebugMessageControl){this->m_orig_glDebugMessageControl = this->m_ptr_glDebugMessageControl;this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&ValidationTableDecorator::m_glDebugMessageControl_validation;}
+if(this->m_ptr_glIsObjectBufferATI){this->m_orig_glIsObjectBufferATI = this->m_ptr_glIsObjectBufferATI;this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&ValidationTableDecorator::m_glIsObjectBufferATI_validation;}
+if(this->m_ptr_glPopAttrib){this->m_orig_glPopAttrib = this->m_ptr_glPopAttrib;this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&ValidationTableDecorator::m_glPopAttrib_validation;}
+if(this->m_ptr_glProgramUniform4iEXT){this->m_orig_glProgramUniform4iEXT = this->m_ptr_glProgramUniform4iEXT;this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&ValidationTableDecorator::m_glProgramUniform4iEXT_validation;}
+if(this->m_ptr_glVertexAttrib4ubNV){this->m_orig_glVertexAttrib4ubNV = this->m_ptr_glVertexAttrib4ubNV;this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&ValidationTableDecorator::m_glVertexAttrib4ubNV_validation;}
+if(this->m_ptr_glColorMaterial){this->m_orig_glColorMaterial = this->m_ptr_glColorMaterial;this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&ValidationTableDecorator::m_glColorMaterial_validation;}
+if(this->m_ptr_glVertexAttrib2svARB){this->m_orig_glVertexAttrib2svARB = this->m_ptr_glVertexAttrib2svARB;this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&ValidationTableDecorator::m_glVertexAttrib2svARB_validation;}
+if(this->m_ptr_glMinSampleShadingARB){this->m_orig_glMinSampleShadingARB = this->m_ptr_glMinSampleShadingARB;this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&ValidationTableDecorator::m_glMinSampleShadingARB_validation;}
+if(this->m_ptr_glColor3b){this->m_orig_glColor3b = this->m_ptr_glColor3b;this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&ValidationTableDecorator::m_glColor3b_validation;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glColor3f){this->m_orig_glColor3f = this->m_ptr_glColor3f;this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&ValidationTableDecorator::m_glColor3f_validation;}
+if(this->m_ptr_glVDPAUGetSurfaceivNV){this->m_orig_glVDPAUGetSurfaceivNV = this->m_ptr_glVDPAUGetSurfaceivNV;this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&ValidationTableDecorator::m_glVDPAUGetSurfaceivNV_validation;}
+if(this->m_ptr_glColor3d){this->m_orig_glColor3d = this->m_ptr_glColor3d;this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&ValidationTableDecorator::m_glColor3d_validation;}
+if(this->m_ptr_glGetnMapiv){this->m_orig_glGetnMapiv = this->m_ptr_glGetnMapiv;this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&ValidationTableDecorator::m_glGetnMapiv_validation;}
+if(this->m_ptr_glColor3i){this->m_orig_glColor3i = this->m_ptr_glColor3i;this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&ValidationTableDecorator::m_glColor3i_validation;}
+if(this->m_ptr_glGetInternalformatSampleivNV){this->m_orig_glGetInternalformatSampleivNV = this->m_ptr_glGetInternalformatSampleivNV;this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&ValidationTableDecorator::m_glGetInternalformatSampleivNV_validation;}
+if(this->m_ptr_glVertexAttrib4ubv){this->m_orig_glVertexAttrib4ubv = this->m_ptr_glVertexAttrib4ubv;this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&ValidationTableDecorator::m_glVertexAttrib4ubv_validation;}
+if(this->m_ptr_glColor3s){this->m_orig_glColor3s = this->m_ptr_glColor3s;this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&ValidationTableDecorator::m_glColor3s_validation;}
+if(this->m_ptr_glVertexAttribs4hvNV){this->m_orig_glVertexAttribs4hvNV = this->m_ptr_glVertexAttribs4hvNV;this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&ValidationTableDecorator::m_glVertexAttribs4hvNV_validation;}
+if(this->m_ptr_glVertexAttrib4NubvARB){this->m_orig_glVertexAttrib4NubvARB = this->m_ptr_glVertexAttrib4NubvARB;this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NubvARB_validation;}
+if(this->m_ptr_glMultiTexCoord3hvNV){this->m_orig_glMultiTexCoord3hvNV = this->m_ptr_glMultiTexCoord3hvNV;this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&ValidationTableDecorator::m_glMultiTexCoord3hvNV_validation;}
+if(this->m_ptr_glMatrixPushEXT){this->m_orig_glMatrixPushEXT = this->m_ptr_glMatrixPushEXT;this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&ValidationTableDecorator::m_glMatrixPushEXT_validation;}
+if(this->m_ptr_glProgramUniform2fEXT){this->m_orig_glProgramUniform2fEXT = this->m_ptr_glProgramUniform2fEXT;this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&ValidationTableDecorator::m_glProgramUniform2fEXT_validation;}
+if(this->m_ptr_glGetVertexArrayIndexediv){this->m_orig_glGetVertexArrayIndexediv = this->m_ptr_glGetVertexArrayIndexediv;this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&ValidationTableDecorator::m_glGetVertexArrayIndexediv_validation;}
+if(this->m_ptr_glBlitFramebuffer){this->m_orig_glBlitFramebuffer = this->m_ptr_glBlitFramebuffer;this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&ValidationTableDecorator::m_glBlitFramebuffer_validation;}
+if(this->m_ptr_glMultiTexCoordP2ui){this->m_orig_glMultiTexCoordP2ui = this->m_ptr_glMultiTexCoordP2ui;this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&ValidationTableDecorator::m_glMultiTexCoordP2ui_validation;}
+if(this->m_ptr_glColorPointerListIBM){this->m_orig_glColorPointerListIBM = this->m_ptr_glColorPointerListIBM;this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glColorPointerListIBM_validation;}
+if(this->m_ptr_glVertexAttribL4d){this->m_orig_glVertexAttribL4d = this->m_ptr_glVertexAttribL4d;this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&ValidationTableDecorator::m_glVertexAttribL4d_validation;}
+if(this->m_ptr_glGetFragmentMaterialfvSGIX){this->m_orig_glGetFragmentMaterialfvSGIX = this->m_ptr_glGetFragmentMaterialfvSGIX;this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&ValidationTableDecorator::m_glGetFragmentMaterialfvSGIX_validation;}
+if(this->m_ptr_glVertex2iv){this->m_orig_glVertex2iv = this->m_ptr_glVertex2iv;this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&ValidationTableDecorator::m_glVertex2iv_validation;}
+if(this->m_ptr_glGetTexEnvxvOES){this->m_orig_glGetTexEnvxvOES = this->m_ptr_glGetTexEnvxvOES;this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&ValidationTableDecorator::m_glGetTexEnvxvOES_validation;}
+if(this->m_ptr_glUniformMatrix3dv){this->m_orig_glUniformMatrix3dv = this->m_ptr_glUniformMatrix3dv;this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&ValidationTableDecorator::m_glUniformMatrix3dv_validation;}
+if(this->m_ptr_glGetVertexAttribLdvEXT){this->m_orig_glGetVertexAttribLdvEXT = this->m_ptr_glGetVertexAttribLdvEXT;this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&ValidationTableDecorator::m_glGetVertexAttribLdvEXT_validation;}
+if(this->m_ptr_glTexCoordP3uiv){this->m_orig_glTexCoordP3uiv = this->m_ptr_glTexCoordP3uiv;this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&ValidationTableDecorator::m_glTexCoordP3uiv_validation;}
+if(this->m_ptr_glDeformationMap3dSGIX){this->m_orig_glDeformationMap3dSGIX = this->m_ptr_glDeformationMap3dSGIX;this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&ValidationTableDecorator::m_glDeformationMap3dSGIX_validation;}
+if(this->m_ptr_glResumeTransformFeedback){this->m_orig_glResumeTransformFeedback = this->m_ptr_glResumeTransformFeedback;this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glResumeTransformFeedback_validation;}
+if(this->m_ptr_glInsertEventMarkerEXT){this->m_orig_glInsertEventMarkerEXT = this->m_ptr_glInsertEventMarkerEXT;this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&ValidationTableDecorator::m_glInsertEventMarkerEXT_validation;}
+if(this->m_ptr_glTessellationModeAMD){this->m_orig_glTessellationModeAMD = this->m_ptr_glTessellationModeAMD;this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&ValidationTableDecorator::m_glTessellationModeAMD_validation;}
+if(this->m_ptr_glDrawCommandsAddressNV){this->m_orig_glDrawCommandsAddressNV = this->m_ptr_glDrawCommandsAddressNV;this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&ValidationTableDecorator::m_glDrawCommandsAddressNV_validation;}
+if(this->m_ptr_glFogi){this->m_orig_glFogi = this->m_ptr_glFogi;this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&ValidationTableDecorator::m_glFogi_validation;}
+if(this->m_ptr_glGetTexParameterxvOES){this->m_orig_glGetTexParameterxvOES = this->m_ptr_glGetTexParameterxvOES;this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&ValidationTableDecorator::m_glGetTexParameterxvOES_validation;}
+if(this->m_ptr_glVertexPointer){this->m_orig_glVertexPointer = this->m_ptr_glVertexPointer;this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&ValidationTableDecorator::m_glVertexPointer_validation;}
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD){this->m_orig_glGetPerfMonitorCounterDataAMD = this->m_ptr_glGetPerfMonitorCounterDataAMD;this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&ValidationTableDecorator::m_glGetPerfMonitorCounterDataAMD_validation;}
+if(this->m_ptr_glFogf){this->m_orig_glFogf = this->m_ptr_glFogf;this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&ValidationTableDecorator::m_glFogf_validation;}
+if(this->m_ptr_glMultiTexCoord1d){this->m_orig_glMultiTexCoord1d = this->m_ptr_glMultiTexCoord1d;this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&ValidationTableDecorator::m_glMultiTexCoord1d_validation;}
+if(this->m_ptr_glMultiTexCoord1f){this->m_orig_glMultiTexCoord1f = this->m_ptr_glMultiTexCoord1f;this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&ValidationTableDecorator::m_glMultiTexCoord1f_validation;}
+if(this->m_ptr_glGetMultiTexParameterivEXT){this->m_orig_glGetMultiTexParameterivEXT = this->m_ptr_glGetMultiTexParameterivEXT;this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexParameterivEXT_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT){this->m_orig_glProgramUniformMatrix3x4fvEXT = this->m_ptr_glProgramUniformMatrix3x4fvEXT;this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x4fvEXT_validation;}
+if(this->m_ptr_glVertexAttribI2i){this->m_orig_glVertexAttribI2i = this->m_ptr_glVertexAttribI2i;this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&ValidationTableDecorator::m_glVertexAttribI2i_validation;}
+if(this->m_ptr_glMultiTexCoord1i){this->m_orig_glMultiTexCoord1i = this->m_ptr_glMultiTexCoord1i;this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&ValidationTableDecorator::m_glMultiTexCoord1i_validation;}
+if(this->m_ptr_glDeleteSemaphoresEXT){this->m_orig_glDeleteSemaphoresEXT = this->m_ptr_glDeleteSemaphoresEXT;this->m_ptr_glDeleteSemaphoresEXT = (FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC)&ValidationTableDecorator::m_glDeleteSemaphoresEXT_validation;}
+if(this->m_ptr_glLoadProgramNV){this->m_orig_glLoadProgramNV = this->m_ptr_glLoadProgramNV;this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&ValidationTableDecorator::m_glLoadProgramNV_validation;}
+if(this->m_ptr_glWriteMaskEXT){this->m_orig_glWriteMaskEXT = this->m_ptr_glWriteMaskEXT;this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&ValidationTableDecorator::m_glWriteMaskEXT_validation;}
+if(this->m_ptr_glGetGraphicsResetStatus){this->m_orig_glGetGraphicsResetStatus = this->m_ptr_glGetGraphicsResetStatus;this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&ValidationTableDecorator::m_glGetGraphicsResetStatus_validation;}
+if(this->m_ptr_glVertexAttrib1fv){this->m_orig_glVertexAttrib1fv = this->m_ptr_glVertexAttrib1fv;this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&ValidationTableDecorator::m_glVertexAttrib1fv_validation;}
+if(this->m_ptr_glMultiTexCoord1s){this->m_orig_glMultiTexCoord1s = this->m_ptr_glMultiTexCoord1s;this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&ValidationTableDecorator::m_glMultiTexCoord1s_validation;}
+if(this->m_ptr_glImageTransformParameterfvHP){this->m_orig_glImageTransformParameterfvHP = this->m_ptr_glImageTransformParameterfvHP;this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&ValidationTableDecorator::m_glImageTransformParameterfvHP_validation;}
+if(this->m_ptr_glFramebufferTexture2D){this->m_orig_glFramebufferTexture2D = this->m_ptr_glFramebufferTexture2D;this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&ValidationTableDecorator::m_glFramebufferTexture2D_validation;}
+if(this->m_ptr_glGetFragmentLightfvSGIX){this->m_orig_glGetFragmentLightfvSGIX = this->m_ptr_glGetFragmentLightfvSGIX;this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&ValidationTableDecorator::m_glGetFragmentLightfvSGIX_validation;}
+if(this->m_ptr_glListParameterfSGIX){this->m_orig_glListParameterfSGIX = this->m_ptr_glListParameterfSGIX;this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&ValidationTableDecorator::m_glListParameterfSGIX_validation;}
+if(this->m_ptr_glTexCoord3sv){this->m_orig_glTexCoord3sv = this->m_ptr_glTexCoord3sv;this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&ValidationTableDecorator::m_glTexCoord3sv_validation;}
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT){this->m_orig_glNamedFramebufferRenderbufferEXT = this->m_ptr_glNamedFramebufferRenderbufferEXT;this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&ValidationTableDecorator::m_glNamedFramebufferRenderbufferEXT_validation;}
+if(this->m_ptr_glFragmentLightModelfSGIX){this->m_orig_glFragmentLightModelfSGIX = this->m_ptr_glFragmentLightModelfSGIX;this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&ValidationTableDecorator::m_glFragmentLightModelfSGIX_validation;}
+if(this->m_ptr_glIndexPointerEXT){this->m_orig_glIndexPointerEXT = this->m_ptr_glIndexPointerEXT;this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&ValidationTableDecorator::m_glIndexPointerEXT_validation;}
+if(this->m_ptr_glBlendEquationSeparateATI){this->m_orig_glBlendEquationSeparateATI = this->m_ptr_glBlendEquationSeparateATI;this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&ValidationTableDecorator::m_glBlendEquationSeparateATI_validation;}
+if(this->m_ptr_glVertexArrayAttribIFormat){this->m_orig_glVertexArrayAttribIFormat = this->m_ptr_glVertexArrayAttribIFormat;this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&ValidationTableDecorator::m_glVertexArrayAttribIFormat_validation;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glReplacementCodeubvSUN){this->m_orig_glReplacementCodeubvSUN = this->m_ptr_glReplacementCodeubvSUN;this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeubvSUN_validation;}
+if(this->m_ptr_glGenFramebuffers){this->m_orig_glGenFramebuffers = this->m_ptr_glGenFramebuffers;this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&ValidationTableDecorator::m_glGenFramebuffers_validation;}
+if(this->m_ptr_glPixelMapx){this->m_orig_glPixelMapx = this->m_ptr_glPixelMapx;this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&ValidationTableDecorator::m_glPixelMapx_validation;}
+if(this->m_ptr_glTexSubImage3DEXT){this->m_orig_glTexSubImage3DEXT = this->m_ptr_glTexSubImage3DEXT;this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glTexSubImage3DEXT_validation;}
+if(this->m_ptr_glGetAttachedShaders){this->m_orig_glGetAttachedShaders = this->m_ptr_glGetAttachedShaders;this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&ValidationTableDecorator::m_glGetAttachedShaders_validation;}
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS){this->m_orig_glGetPixelTexGenParameterfvSGIS = this->m_ptr_glGetPixelTexGenParameterfvSGIS;this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&ValidationTableDecorator::m_glGetPixelTexGenParameterfvSGIS_validation;}
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glGetDebugMessageLogAMD){this->m_orig_glGetDebugMessageLogAMD = this->m_ptr_glGetDebugMessageLogAMD;this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&ValidationTableDecorator::m_glGetDebugMessageLogAMD_validation;}
+if(this->m_ptr_glVertexStream4sATI){this->m_orig_glVertexStream4sATI = this->m_ptr_glVertexStream4sATI;this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&ValidationTableDecorator::m_glVertexStream4sATI_validation;}
+if(this->m_ptr_glVertexAttribs4dvNV){this->m_orig_glVertexAttribs4dvNV = this->m_ptr_glVertexAttribs4dvNV;this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&ValidationTableDecorator::m_glVertexAttribs4dvNV_validation;}
+if(this->m_ptr_glGetnMapdvARB){this->m_orig_glGetnMapdvARB = this->m_ptr_glGetnMapdvARB;this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&ValidationTableDecorator::m_glGetnMapdvARB_validation;}
+if(this->m_ptr_glOrthofOES){this->m_orig_glOrthofOES = this->m_ptr_glOrthofOES;this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&ValidationTableDecorator::m_glOrthofOES_validation;}
+if(this->m_ptr_glViewportArrayv){this->m_orig_glViewportArrayv = this->m_ptr_glViewportArrayv;this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&ValidationTableDecorator::m_glViewportArrayv_validation;}
+if(this->m_ptr_glDrawElementArrayATI){this->m_orig_glDrawElementArrayATI = this->m_ptr_glDrawElementArrayATI;this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&ValidationTableDecorator::m_glDrawElementArrayATI_validation;}
+if(this->m_ptr_glBufferStorageMemEXT){this->m_orig_glBufferStorageMemEXT = this->m_ptr_glBufferStorageMemEXT;this->m_ptr_glBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC)&ValidationTableDecorator::m_glBufferStorageMemEXT_validation;}
+if(this->m_ptr_glGetPathColorGenfvNV){this->m_orig_glGetPathColorGenfvNV = this->m_ptr_glGetPathColorGenfvNV;this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&ValidationTableDecorator::m_glGetPathColorGenfvNV_validation;}
+if(this->m_ptr_glWindowPos3iMESA){this->m_orig_glWindowPos3iMESA = this->m_ptr_glWindowPos3iMESA;this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&ValidationTableDecorator::m_glWindowPos3iMESA_validation;}
+if(this->m_ptr_glMultiTexCoord2s){this->m_orig_glMultiTexCoord2s = this->m_ptr_glMultiTexCoord2s;this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&ValidationTableDecorator::m_glMultiTexCoord2s_validation;}
+if(this->m_ptr_glVertex3dv){this->m_orig_glVertex3dv = this->m_ptr_glVertex3dv;this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&ValidationTableDecorator::m_glVertex3dv_validation;}
+if(this->m_ptr_glVertexAttribI3uivEXT){this->m_orig_glVertexAttribI3uivEXT = this->m_ptr_glVertexAttribI3uivEXT;this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI3uivEXT_validation;}
+if(this->m_ptr_glUniform3ui64ARB){this->m_orig_glUniform3ui64ARB = this->m_ptr_glUniform3ui64ARB;this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&ValidationTableDecorator::m_glUniform3ui64ARB_validation;}
+if(this->m_ptr_glVertexAttrib2fvNV){this->m_orig_glVertexAttrib2fvNV = this->m_ptr_glVertexAttrib2fvNV;this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&ValidationTableDecorator::m_glVertexAttrib2fvNV_validation;}
+if(this->m_ptr_glGetNamedBufferSubDataEXT){this->m_orig_glGetNamedBufferSubDataEXT = this->m_ptr_glGetNamedBufferSubDataEXT;this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&ValidationTableDecorator::m_glGetNamedBufferSubDataEXT_validation;}
+if(this->m_ptr_glConvolutionFilter2D){this->m_orig_glConvolutionFilter2D = this->m_ptr_glConvolutionFilter2D;this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&ValidationTableDecorator::m_glConvolutionFilter2D_validation;}
+if(this->m_ptr_glMemoryBarrierByRegion){this->m_orig_glMemoryBarrierByRegion = this->m_ptr_glMemoryBarrierByRegion;this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&ValidationTableDecorator::m_glMemoryBarrierByRegion_validation;}
+if(this->m_ptr_glVertexArrayBindingDivisor){this->m_orig_glVertexArrayBindingDivisor = this->m_ptr_glVertexArrayBindingDivisor;this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&ValidationTableDecorator::m_glVertexArrayBindingDivisor_validation;}
+if(this->m_ptr_glMatrixRotatedEXT){this->m_orig_glMatrixRotatedEXT = this->m_ptr_glMatrixRotatedEXT;this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&ValidationTableDecorator::m_glMatrixRotatedEXT_validation;}
+if(this->m_ptr_glTexCoord2sv){this->m_orig_glTexCoord2sv = this->m_ptr_glTexCoord2sv;this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&ValidationTableDecorator::m_glTexCoord2sv_validation;}
+if(this->m_ptr_glIsProgramNV){this->m_orig_glIsProgramNV = this->m_ptr_glIsProgramNV;this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&ValidationTableDecorator::m_glIsProgramNV_validation;}
+if(this->m_ptr_glUniform2dv){this->m_orig_glUniform2dv = this->m_ptr_glUniform2dv;this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&ValidationTableDecorator::m_glUniform2dv_validation;}
+if(this->m_ptr_glGetPixelMapuiv){this->m_orig_glGetPixelMapuiv = this->m_ptr_glGetPixelMapuiv;this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&ValidationTableDecorator::m_glGetPixelMapuiv_validation;}
+if(this->m_ptr_glDepthBoundsEXT){this->m_orig_glDepthBoundsEXT = this->m_ptr_glDepthBoundsEXT;this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&ValidationTableDecorator::m_glDepthBoundsEXT_validation;}
+if(this->m_ptr_glVertexAttrib4hvNV){this->m_orig_glVertexAttrib4hvNV = this->m_ptr_glVertexAttrib4hvNV;this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&ValidationTableDecorator::m_glVertexAttrib4hvNV_validation;}
+if(this->m_ptr_glMultiTexParameteriEXT){this->m_orig_glMultiTexParameteriEXT = this->m_ptr_glMultiTexParameteriEXT;this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&ValidationTableDecorator::m_glMultiTexParameteriEXT_validation;}
+if(this->m_ptr_glGetPointerv){this->m_orig_glGetPointerv = this->m_ptr_glGetPointerv;this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&ValidationTableDecorator::m_glGetPointerv_validation;}
+if(this->m_ptr_glPathCommandsNV){this->m_orig_glPathCommandsNV = this->m_ptr_glPathCommandsNV;this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&ValidationTableDecorator::m_glPathCommandsNV_validation;}
+if(this->m_ptr_glGetListParameterfvSGIX){this->m_orig_glGetListParameterfvSGIX = this->m_ptr_glGetListParameterfvSGIX;this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&ValidationTableDecorator::m_glGetListParameterfvSGIX_validation;}
+if(this->m_ptr_glGetUniformuiv){this->m_orig_glGetUniformuiv = this->m_ptr_glGetUniformuiv;this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&ValidationTableDecorator::m_glGetUniformuiv_validation;}
+if(this->m_ptr_glDebugMessageInsertAMD){this->m_orig_glDebugMessageInsertAMD = this->m_ptr_glDebugMessageInsertAMD;this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&ValidationTableDecorator::m_glDebugMessageInsertAMD_validation;}
+if(this->m_ptr_glFrustum){this->m_orig_glFrustum = this->m_ptr_glFrustum;this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&ValidationTableDecorator::m_glFrustum_validation;}
+if(this->m_ptr_glVertexAttribL1ui64vNV){this->m_orig_glVertexAttribL1ui64vNV = this->m_ptr_glVertexAttribL1ui64vNV;this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL1ui64vNV_validation;}
+if(this->m_ptr_glClearColorxOES){this->m_orig_glClearColorxOES = this->m_ptr_glClearColorxOES;this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&ValidationTableDecorator::m_glClearColorxOES_validation;}
+if(this->m_ptr_glProgramUniformMatrix3fv){this->m_orig_glProgramUniformMatrix3fv = this->m_ptr_glProgramUniformMatrix3fv;this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3fv_validation;}
+if(this->m_ptr_glSampleMaskIndexedNV){this->m_orig_glSampleMaskIndexedNV = this->m_ptr_glSampleMaskIndexedNV;this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&ValidationTableDecorator::m_glSampleMaskIndexedNV_validation;}
+if(this->m_ptr_glCompileShaderIncludeARB){this->m_orig_glCompileShaderIncludeARB = this->m_ptr_glCompileShaderIncludeARB;this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&ValidationTableDecorator::m_glCompileShaderIncludeARB_validation;}
+if(this->m_ptr_glGetArrayObjectfvATI){this->m_orig_glGetArrayObjectfvATI = this->m_ptr_glGetArrayObjectfvATI;this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&ValidationTableDecorator::m_glGetArrayObjectfvATI_validation;}
+if(this->m_ptr_glVertexStream4svATI){this->m_orig_glVertexStream4svATI = this->m_ptr_glVertexStream4svATI;this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&ValidationTableDecorator::m_glVertexStream4svATI_validation;}
+if(this->m_ptr_glMultiTexCoord4iARB){this->m_orig_glMultiTexCoord4iARB = this->m_ptr_glMultiTexCoord4iARB;this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4iARB_validation;}
+if(this->m_ptr_glVariantfvEXT){this->m_orig_glVariantfvEXT = this->m_ptr_glVariantfvEXT;this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&ValidationTableDecorator::m_glVariantfvEXT_validation;}
+if(this->m_ptr_glMatrixLoadfEXT){this->m_orig_glMatrixLoadfEXT = this->m_ptr_glMatrixLoadfEXT;this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&ValidationTableDecorator::m_glMatrixLoadfEXT_validation;}
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX){this->m_orig_glLoadIdentityDeformationMapSGIX = this->m_ptr_glLoadIdentityDeformationMapSGIX;this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&ValidationTableDecorator::m_glLoadIdentityDeformationMapSGIX_validation;}
+if(this->m_ptr_glGetRenderbufferParameteriv){this->m_orig_glGetRenderbufferParameteriv = this->m_ptr_glGetRenderbufferParameteriv;this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetRenderbufferParameteriv_validation;}
+if(this->m_ptr_glProgramUniform3fEXT){this->m_orig_glProgramUniform3fEXT = this->m_ptr_glProgramUniform3fEXT;this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&ValidationTableDecorator::m_glProgramUniform3fEXT_validation;}
+if(this->m_ptr_glNamedRenderbufferStorage){this->m_orig_glNamedRenderbufferStorage = this->m_ptr_glNamedRenderbufferStorage;this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&ValidationTableDecorator::m_glNamedRenderbufferStorage_validation;}
+if(this->m_ptr_glBindFragDataLocation){this->m_orig_glBindFragDataLocation = this->m_ptr_glBindFragDataLocation;this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&ValidationTableDecorator::m_glBindFragDataLocation_validation;}
+if(this->m_ptr_glPolygonOffsetClamp){this->m_orig_glPolygonOffsetClamp = this->m_ptr_glPolygonOffsetClamp;this->m_ptr_glPolygonOffsetClamp = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC)&ValidationTableDecorator::m_glPolygonOffsetClamp_validation;}
+if(this->m_ptr_glFogCoordPointerListIBM){this->m_orig_glFogCoordPointerListIBM = this->m_ptr_glFogCoordPointerListIBM;this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glFogCoordPointerListIBM_validation;}
+if(this->m_ptr_glFenceSync){this->m_orig_glFenceSync = this->m_ptr_glFenceSync;this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&ValidationTableDecorator::m_glFenceSync_validation;}
+if(this->m_ptr_glGetVertexAttribIivEXT){this->m_orig_glGetVertexAttribIivEXT = this->m_ptr_glGetVertexAttribIivEXT;this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&ValidationTableDecorator::m_glGetVertexAttribIivEXT_validation;}
+if(this->m_ptr_glFramebufferDrawBuffersEXT){this->m_orig_glFramebufferDrawBuffersEXT = this->m_ptr_glFramebufferDrawBuffersEXT;this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&ValidationTableDecorator::m_glFramebufferDrawBuffersEXT_validation;}
+if(this->m_ptr_glVertexAttribs4fvNV){this->m_orig_glVertexAttribs4fvNV = this->m_ptr_glVertexAttribs4fvNV;this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&ValidationTableDecorator::m_glVertexAttribs4fvNV_validation;}
+if(this->m_ptr_glPauseTransformFeedbackNV){this->m_orig_glPauseTransformFeedbackNV = this->m_ptr_glPauseTransformFeedbackNV;this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glPauseTransformFeedbackNV_validation;}
+if(this->m_ptr_glGetQueryObjecti64vEXT){this->m_orig_glGetQueryObjecti64vEXT = this->m_ptr_glGetQueryObjecti64vEXT;this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&ValidationTableDecorator::m_glGetQueryObjecti64vEXT_validation;}
+if(this->m_ptr_glVDPAUSurfaceAccessNV){this->m_orig_glVDPAUSurfaceAccessNV = this->m_ptr_glVDPAUSurfaceAccessNV;this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&ValidationTableDecorator::m_glVDPAUSurfaceAccessNV_validation;}
+if(this->m_ptr_glValidateProgramPipeline){this->m_orig_glValidateProgramPipeline = this->m_ptr_glValidateProgramPipeline;this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&ValidationTableDecorator::m_glValidateProgramPipeline_validation;}
+if(this->m_ptr_glTexPageCommitmentARB){this->m_orig_glTexPageCommitmentARB = this->m_ptr_glTexPageCommitmentARB;this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&ValidationTableDecorator::m_glTexPageCommitmentARB_validation;}
+if(this->m_ptr_glWindowPos3dvARB){this->m_orig_glWindowPos3dvARB = this->m_ptr_glWindowPos3dvARB;this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&ValidationTableDecorator::m_glWindowPos3dvARB_validation;}
+if(this->m_ptr_glStencilStrokePathInstancedNV){this->m_orig_glStencilStrokePathInstancedNV = this->m_ptr_glStencilStrokePathInstancedNV;this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&ValidationTableDecorator::m_glStencilStrokePathInstancedNV_validation;}
+if(this->m_ptr_glFogfv){this->m_orig_glFogfv = this->m_ptr_glFogfv;this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&ValidationTableDecorator::m_glFogfv_validation;}
+if(this->m_ptr_glGenQueriesARB){this->m_orig_glGenQueriesARB = this->m_ptr_glGenQueriesARB;this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&ValidationTableDecorator::m_glGenQueriesARB_validation;}
+if(this->m_ptr_glProgramUniform2i64NV){this->m_orig_glProgramUniform2i64NV = this->m_ptr_glProgramUniform2i64NV;this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&ValidationTableDecorator::m_glProgramUniform2i64NV_validation;}
+if(this->m_ptr_glVertexP4ui){this->m_orig_glVertexP4ui = this->m_ptr_glVertexP4ui;this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&ValidationTableDecorator::m_glVertexP4ui_validation;}
+if(this->m_ptr_glVertexStream1ivATI){this->m_orig_glVertexStream1ivATI = this->m_ptr_glVertexStream1ivATI;this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&ValidationTableDecorator::m_glVertexStream1ivATI_validation;}
+if(this->m_ptr_glProgramEnvParameterI4iNV){this->m_orig_glProgramEnvParameterI4iNV = this->m_ptr_glProgramEnvParameterI4iNV;this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&ValidationTableDecorator::m_glProgramEnvParameterI4iNV_validation;}
+if(this->m_ptr_glGenVertexArraysAPPLE){this->m_orig_glGenVertexArraysAPPLE = this->m_ptr_glGenVertexArraysAPPLE;this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&ValidationTableDecorator::m_glGenVertexArraysAPPLE_validation;}
+if(this->m_ptr_glDrawTransformFeedbackInstanced){this->m_orig_glDrawTransformFeedbackInstanced = this->m_ptr_glDrawTransformFeedbackInstanced;this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&ValidationTableDecorator::m_glDrawTransformFeedbackInstanced_validation;}
+if(this->m_ptr_glStencilThenCoverStrokePathNV){this->m_orig_glStencilThenCoverStrokePathNV = this->m_ptr_glStencilThenCoverStrokePathNV;this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&ValidationTableDecorator::m_glStencilThenCoverStrokePathNV_validation;}
+if(this->m_ptr_glDeleteVertexArraysAPPLE){this->m_orig_glDeleteVertexArraysAPPLE = this->m_ptr_glDeleteVertexArraysAPPLE;this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&ValidationTableDecorator::m_glDeleteVertexArraysAPPLE_validation;}
+if(this->m_ptr_glGetNamedBufferParameterui64vNV){this->m_orig_glGetNamedBufferParameterui64vNV = this->m_ptr_glGetNamedBufferParameterui64vNV;this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&ValidationTableDecorator::m_glGetNamedBufferParameterui64vNV_validation;}
+if(this->m_ptr_glQueryMatrixxOES){this->m_orig_glQueryMatrixxOES = this->m_ptr_glQueryMatrixxOES;this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&ValidationTableDecorator::m_glQueryMatrixxOES_validation;}
+if(this->m_ptr_glSecondaryColor3usv){this->m_orig_glSecondaryColor3usv = this->m_ptr_glSecondaryColor3usv;this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&ValidationTableDecorator::m_glSecondaryColor3usv_validation;}
+if(this->m_ptr_glTranslatexOES){this->m_orig_glTranslatexOES = this->m_ptr_glTranslatexOES;this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&ValidationTableDecorator::m_glTranslatexOES_validation;}
+if(this->m_ptr_glDrawTransformFeedback){this->m_orig_glDrawTransformFeedback = this->m_ptr_glDrawTransformFeedback;this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glDrawTransformFeedback_validation;}
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN){this->m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN;this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV){this->m_orig_glVDPAURegisterVideoSurfaceNV = this->m_ptr_glVDPAURegisterVideoSurfaceNV;this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&ValidationTableDecorator::m_glVDPAURegisterVideoSurfaceNV_validation;}
+if(this->m_ptr_glGetTexParameterIuiv){this->m_orig_glGetTexParameterIuiv = this->m_ptr_glGetTexParameterIuiv;this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&ValidationTableDecorator::m_glGetTexParameterIuiv_validation;}
+if(this->m_ptr_glBindBufferBaseNV){this->m_orig_glBindBufferBaseNV = this->m_ptr_glBindBufferBaseNV;this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&ValidationTableDecorator::m_glBindBufferBaseNV_validation;}
+if(this->m_ptr_glIndexPointer){this->m_orig_glIndexPointer = this->m_ptr_glIndexPointer;this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&ValidationTableDecorator::m_glIndexPointer_validation;}
+if(this->m_ptr_glGenQueryResourceTagNV){this->m_orig_glGenQueryResourceTagNV = this->m_ptr_glGenQueryResourceTagNV;this->m_ptr_glGenQueryResourceTagNV = (FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC)&ValidationTableDecorator::m_glGenQueryResourceTagNV_validation;}
+if(this->m_ptr_glVertexAttrib4Nbv){this->m_orig_glVertexAttrib4Nbv = this->m_ptr_glVertexAttrib4Nbv;this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&ValidationTableDecorator::m_glVertexAttrib4Nbv_validation;}
+if(this->m_ptr_glListParameteriSGIX){this->m_orig_glListParameteriSGIX = this->m_ptr_glListParameteriSGIX;this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&ValidationTableDecorator::m_glListParameteriSGIX_validation;}
+if(this->m_ptr_glBlendColorxOES){this->m_orig_glBlendColorxOES = this->m_ptr_glBlendColorxOES;this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&ValidationTableDecorator::m_glBlendColorxOES_validation;}
+if(this->m_ptr_glUniformui64vNV){this->m_orig_glUniformui64vNV = this->m_ptr_glUniformui64vNV;this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&ValidationTableDecorator::m_glUniformui64vNV_validation;}
+if(this->m_ptr_glIsSync){this->m_orig_glIsSync = this->m_ptr_glIsSync;this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&ValidationTableDecorator::m_glIsSync_validation;}
+if(this->m_ptr_glGetTextureParameterivEXT){this->m_orig_glGetTextureParameterivEXT = this->m_ptr_glGetTextureParameterivEXT;this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetTextureParameterivEXT_validation;}
+if(this->m_ptr_glFogCoordhvNV){this->m_orig_glFogCoordhvNV = this->m_ptr_glFogCoordhvNV;this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&ValidationTableDecorator::m_glFogCoordhvNV_validation;}
+if(this->m_ptr_glFramebufferTextureLayerEXT){this->m_orig_glFramebufferTextureLayerEXT = this->m_ptr_glFramebufferTextureLayerEXT;this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&ValidationTableDecorator::m_glFramebufferTextureLayerEXT_validation;}
+if(this->m_ptr_glGetObjectPtrLabel){this->m_orig_glGetObjectPtrLabel = this->m_ptr_glGetObjectPtrLabel;this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&ValidationTableDecorator::m_glGetObjectPtrLabel_validation;}
+if(this->m_ptr_glTextureParameteri){this->m_orig_glTextureParameteri = this->m_ptr_glTextureParameteri;this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&ValidationTableDecorator::m_glTextureParameteri_validation;}
+if(this->m_ptr_glMultiTexCoord1fARB){this->m_orig_glMultiTexCoord1fARB = this->m_ptr_glMultiTexCoord1fARB;this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1fARB_validation;}
+if(this->m_ptr_glUniformMatrix2x3dv){this->m_orig_glUniformMatrix2x3dv = this->m_ptr_glUniformMatrix2x3dv;this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&ValidationTableDecorator::m_glUniformMatrix2x3dv_validation;}
+if(this->m_ptr_glFramebufferDrawBufferEXT){this->m_orig_glFramebufferDrawBufferEXT = this->m_ptr_glFramebufferDrawBufferEXT;this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&ValidationTableDecorator::m_glFramebufferDrawBufferEXT_validation;}
+if(this->m_ptr_glCopyColorSubTable){this->m_orig_glCopyColorSubTable = this->m_ptr_glCopyColorSubTable;this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&ValidationTableDecorator::m_glCopyColorSubTable_validation;}
+if(this->m_ptr_glGetNamedFramebufferParameterfvAMD){this->m_orig_glGetNamedFramebufferParameterfvAMD = this->m_ptr_glGetNamedFramebufferParameterfvAMD;this->m_ptr_glGetNamedFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)&ValidationTableDecorator::m_glGetNamedFramebufferParameterfvAMD_validation;}
+if(this->m_ptr_glVertexAttribL3d){this->m_orig_glVertexAttribL3d = this->m_ptr_glVertexAttribL3d;this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&ValidationTableDecorator::m_glVertexAttribL3d_validation;}
+if(this->m_ptr_glFragmentMaterialfvSGIX){this->m_orig_glFragmentMaterialfvSGIX = this->m_ptr_glFragmentMaterialfvSGIX;this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&ValidationTableDecorator::m_glFragmentMaterialfvSGIX_validation;}
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV){this->m_orig_glMatrixLoadTranspose3x3fNV = this->m_ptr_glMatrixLoadTranspose3x3fNV;this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&ValidationTableDecorator::m_glMatrixLoadTranspose3x3fNV_validation;}
+if(this->m_ptr_glDeleteNamesAMD){this->m_orig_glDeleteNamesAMD = this->m_ptr_glDeleteNamesAMD;this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&ValidationTableDecorator::m_glDeleteNamesAMD_validation;}
+if(this->m_ptr_glDrawRangeElementsEXT){this->m_orig_glDrawRangeElementsEXT = this->m_ptr_glDrawRangeElementsEXT;this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&ValidationTableDecorator::m_glDrawRangeElementsEXT_validation;}
+if(this->m_ptr_glOrtho){this->m_orig_glOrtho = this->m_ptr_glOrtho;this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&ValidationTableDecorator::m_glOrtho_validation;}
+if(this->m_ptr_glProgramUniform1dvEXT){this->m_orig_glProgramUniform1dvEXT = this->m_ptr_glProgramUniform1dvEXT;this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&ValidationTableDecorator::m_glProgramUniform1dvEXT_validation;}
+if(this->m_ptr_glColor4xOES){this->m_orig_glColor4xOES = this->m_ptr_glColor4xOES;this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&ValidationTableDecorator::m_glColor4xOES_validation;}
+if(this->m_ptr_glTexImage4DSGIS){this->m_orig_glTexImage4DSGIS = this->m_ptr_glTexImage4DSGIS;this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&ValidationTableDecorator::m_glTexImage4DSGIS_validation;}
+if(this->m_ptr_glProgramUniform1ui){this->m_orig_glProgramUniform1ui = this->m_ptr_glProgramUniform1ui;this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&ValidationTableDecorator::m_glProgramUniform1ui_validation;}
+if(this->m_ptr_glDeleteBuffersARB){this->m_orig_glDeleteBuffersARB = this->m_ptr_glDeleteBuffersARB;this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&ValidationTableDecorator::m_glDeleteBuffersARB_validation;}
+if(this->m_ptr_glUnmapBufferARB){this->m_orig_glUnmapBufferARB = this->m_ptr_glUnmapBufferARB;this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&ValidationTableDecorator::m_glUnmapBufferARB_validation;}
+if(this->m_ptr_glCopyTexImage2D){this->m_orig_glCopyTexImage2D = this->m_ptr_glCopyTexImage2D;this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&ValidationTableDecorator::m_glCopyTexImage2D_validation;}
+if(this->m_ptr_glMaterialxOES){this->m_orig_glMaterialxOES = this->m_ptr_glMaterialxOES;this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&ValidationTableDecorator::m_glMaterialxOES_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT){this->m_orig_glProgramUniformMatrix2x4fvEXT = this->m_ptr_glProgramUniformMatrix2x4fvEXT;this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x4fvEXT_validation;}
+if(this->m_ptr_glTestObjectAPPLE){this->m_orig_glTestObjectAPPLE = this->m_ptr_glTestObjectAPPLE;this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&ValidationTableDecorator::m_glTestObjectAPPLE_validation;}
+if(this->m_ptr_glRenderbufferStorageEXT){this->m_orig_glRenderbufferStorageEXT = this->m_ptr_glRenderbufferStorageEXT;this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&ValidationTableDecorator::m_glRenderbufferStorageEXT_validation;}
+if(this->m_ptr_glVertexAttribL1ui64ARB){this->m_orig_glVertexAttribL1ui64ARB = this->m_ptr_glVertexAttribL1ui64ARB;this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&ValidationTableDecorator::m_glVertexAttribL1ui64ARB_validation;}
+if(this->m_ptr_glEndFragmentShaderATI){this->m_orig_glEndFragmentShaderATI = this->m_ptr_glEndFragmentShaderATI;this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&ValidationTableDecorator::m_glEndFragmentShaderATI_validation;}
+if(this->m_ptr_glPathParameterivNV){this->m_orig_glPathParameterivNV = this->m_ptr_glPathParameterivNV;this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&ValidationTableDecorator::m_glPathParameterivNV_validation;}
+if(this->m_ptr_glUniform4uiv){this->m_orig_glUniform4uiv = this->m_ptr_glUniform4uiv;this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&ValidationTableDecorator::m_glUniform4uiv_validation;}
+if(this->m_ptr_glFrameZoomSGIX){this->m_orig_glFrameZoomSGIX = this->m_ptr_glFrameZoomSGIX;this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&ValidationTableDecorator::m_glFrameZoomSGIX_validation;}
+if(this->m_ptr_glSecondaryColor3fEXT){this->m_orig_glSecondaryColor3fEXT = this->m_ptr_glSecondaryColor3fEXT;this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3fEXT_validation;}
+if(this->m_ptr_glLGPUInterlockNVX){this->m_orig_glLGPUInterlockNVX = this->m_ptr_glLGPUInterlockNVX;this->m_ptr_glLGPUInterlockNVX = (FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC)&ValidationTableDecorator::m_glLGPUInterlockNVX_validation;}
+if(this->m_ptr_glVertexAttribL1dv){this->m_orig_glVertexAttribL1dv = this->m_ptr_glVertexAttribL1dv;this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&ValidationTableDecorator::m_glVertexAttribL1dv_validation;}
+if(this->m_ptr_glNormalStream3svATI){this->m_orig_glNormalStream3svATI = this->m_ptr_glNormalStream3svATI;this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&ValidationTableDecorator::m_glNormalStream3svATI_validation;}
+if(this->m_ptr_glPathStencilFuncNV){this->m_orig_glPathStencilFuncNV = this->m_ptr_glPathStencilFuncNV;this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&ValidationTableDecorator::m_glPathStencilFuncNV_validation;}
+if(this->m_ptr_glSetInvariantEXT){this->m_orig_glSetInvariantEXT = this->m_ptr_glSetInvariantEXT;this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&ValidationTableDecorator::m_glSetInvariantEXT_validation;}
+if(this->m_ptr_glGetTexBumpParameterivATI){this->m_orig_glGetTexBumpParameterivATI = this->m_ptr_glGetTexBumpParameterivATI;this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&ValidationTableDecorator::m_glGetTexBumpParameterivATI_validation;}
+if(this->m_ptr_glBlendEquationSeparateEXT){this->m_orig_glBlendEquationSeparateEXT = this->m_ptr_glBlendEquationSeparateEXT;this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&ValidationTableDecorator::m_glBlendEquationSeparateEXT_validation;}
+if(this->m_ptr_glEndOcclusionQueryNV){this->m_orig_glEndOcclusionQueryNV = this->m_ptr_glEndOcclusionQueryNV;this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&ValidationTableDecorator::m_glEndOcclusionQueryNV_validation;}
+if(this->m_ptr_glScissorArrayv){this->m_orig_glScissorArrayv = this->m_ptr_glScissorArrayv;this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&ValidationTableDecorator::m_glScissorArrayv_validation;}
+if(this->m_ptr_glCallList){this->m_orig_glCallList = this->m_ptr_glCallList;this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&ValidationTableDecorator::m_glCallList_validation;}
+if(this->m_ptr_glMapTexture2DINTEL){this->m_orig_glMapTexture2DINTEL = this->m_ptr_glMapTexture2DINTEL;this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&ValidationTableDecorator::m_glMapTexture2DINTEL_validation;}
+if(this->m_ptr_glGetVkProcAddrNV){this->m_orig_glGetVkProcAddrNV = this->m_ptr_glGetVkProcAddrNV;this->m_ptr_glGetVkProcAddrNV = (FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC)&ValidationTableDecorator::m_glGetVkProcAddrNV_validation;}
+if(this->m_ptr_glPixelTransferxOES){this->m_orig_glPixelTransferxOES = this->m_ptr_glPixelTransferxOES;this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&ValidationTableDecorator::m_glPixelTransferxOES_validation;}
+if(this->m_ptr_glDeleteRenderbuffersEXT){this->m_orig_glDeleteRenderbuffersEXT = this->m_ptr_glDeleteRenderbuffersEXT;this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&ValidationTableDecorator::m_glDeleteRenderbuffersEXT_validation;}
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN){this->m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN;this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&ValidationTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_validation;}
+if(this->m_ptr_glProgramUniformMatrix4dvEXT){this->m_orig_glProgramUniformMatrix4dvEXT = this->m_ptr_glProgramUniformMatrix4dvEXT;this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4dvEXT_validation;}
+if(this->m_ptr_glGetnColorTable){this->m_orig_glGetnColorTable = this->m_ptr_glGetnColorTable;this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&ValidationTableDecorator::m_glGetnColorTable_validation;}
+if(this->m_ptr_glFramebufferTextureLayerARB){this->m_orig_glFramebufferTextureLayerARB = this->m_ptr_glFramebufferTextureLayerARB;this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&ValidationTableDecorator::m_glFramebufferTextureLayerARB_validation;}
+if(this->m_ptr_glVertexAttribL2dvEXT){this->m_orig_glVertexAttribL2dvEXT = this->m_ptr_glVertexAttribL2dvEXT;this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&ValidationTableDecorator::m_glVertexAttribL2dvEXT_validation;}
+if(this->m_ptr_glGetCombinerStageParameterfvNV){this->m_orig_glGetCombinerStageParameterfvNV = this->m_ptr_glGetCombinerStageParameterfvNV;this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetCombinerStageParameterfvNV_validation;}
+if(this->m_ptr_glMultiTexCoord1xvOES){this->m_orig_glMultiTexCoord1xvOES = this->m_ptr_glMultiTexCoord1xvOES;this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord1xvOES_validation;}
+if(this->m_ptr_glMapBuffer){this->m_orig_glMapBuffer = this->m_ptr_glMapBuffer;this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&ValidationTableDecorator::m_glMapBuffer_validation;}
+if(this->m_ptr_glSecondaryColor3d){this->m_orig_glSecondaryColor3d = this->m_ptr_glSecondaryColor3d;this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&ValidationTableDecorator::m_glSecondaryColor3d_validation;}
+if(this->m_ptr_glSecondaryColor3f){this->m_orig_glSecondaryColor3f = this->m_ptr_glSecondaryColor3f;this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&ValidationTableDecorator::m_glSecondaryColor3f_validation;}
+if(this->m_ptr_glVertexAttribLFormat){this->m_orig_glVertexAttribLFormat = this->m_ptr_glVertexAttribLFormat;this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&ValidationTableDecorator::m_glVertexAttribLFormat_validation;}
+if(this->m_ptr_glElementPointerAPPLE){this->m_orig_glElementPointerAPPLE = this->m_ptr_glElementPointerAPPLE;this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&ValidationTableDecorator::m_glElementPointerAPPLE_validation;}
+if(this->m_ptr_glVertexStream1fATI){this->m_orig_glVertexStream1fATI = this->m_ptr_glVertexStream1fATI;this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&ValidationTableDecorator::m_glVertexStream1fATI_validation;}
+if(this->m_ptr_glCoverageModulationNV){this->m_orig_glCoverageModulationNV = this->m_ptr_glCoverageModulationNV;this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&ValidationTableDecorator::m_glCoverageModulationNV_validation;}
+if(this->m_ptr_glSecondaryColor3i){this->m_orig_glSecondaryColor3i = this->m_ptr_glSecondaryColor3i;this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&ValidationTableDecorator::m_glSecondaryColor3i_validation;}
+if(this->m_ptr_glDeleteSync){this->m_orig_glDeleteSync = this->m_ptr_glDeleteSync;this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&ValidationTableDecorator::m_glDeleteSync_validation;}
+if(this->m_ptr_glGetProgramParameterfvNV){this->m_orig_glGetProgramParameterfvNV = this->m_ptr_glGetProgramParameterfvNV;this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetProgramParameterfvNV_validation;}
+if(this->m_ptr_glMaxShaderCompilerThreadsARB){this->m_orig_glMaxShaderCompilerThreadsARB = this->m_ptr_glMaxShaderCompilerThreadsARB;this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&ValidationTableDecorator::m_glMaxShaderCompilerThreadsARB_validation;}
+if(this->m_ptr_glUniformMatrix4x2dv){this->m_orig_glUniformMatrix4x2dv = this->m_ptr_glUniformMatrix4x2dv;this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&ValidationTableDecorator::m_glUniformMatrix4x2dv_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT){this->m_orig_glVertexArrayVertexAttribLOffsetEXT = this->m_ptr_glVertexArrayVertexAttribLOffsetEXT;this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_validation;}
+if(this->m_ptr_glSecondaryColor3s){this->m_orig_glSecondaryColor3s = this->m_ptr_glSecondaryColor3s;this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&ValidationTableDecorator::m_glSecondaryColor3s_validation;}
+if(this->m_ptr_glIsImageHandleResidentNV){this->m_orig_glIsImageHandleResidentNV = this->m_ptr_glIsImageHandleResidentNV;this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&ValidationTableDecorator::m_glIsImageHandleResidentNV_validation;}
+if(this->m_ptr_glUniform3iv){this->m_orig_glUniform3iv = this->m_ptr_glUniform3iv;this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&ValidationTableDecorator::m_glUniform3iv_validation;}
+if(this->m_ptr_glVertexAttribL3i64vNV){this->m_orig_glVertexAttribL3i64vNV = this->m_ptr_glVertexAttribL3i64vNV;this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL3i64vNV_validation;}
+if(this->m_ptr_glPolygonMode){this->m_orig_glPolygonMode = this->m_ptr_glPolygonMode;this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&ValidationTableDecorator::m_glPolygonMode_validation;}
+if(this->m_ptr_glFramebufferSamplePositionsfvAMD){this->m_orig_glFramebufferSamplePositionsfvAMD = this->m_ptr_glFramebufferSamplePositionsfvAMD;this->m_ptr_glFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&ValidationTableDecorator::m_glFramebufferSamplePositionsfvAMD_validation;}
+if(this->m_ptr_glConvolutionFilter1DEXT){this->m_orig_glConvolutionFilter1DEXT = this->m_ptr_glConvolutionFilter1DEXT;this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&ValidationTableDecorator::m_glConvolutionFilter1DEXT_validation;}
+if(this->m_ptr_glVertexAttrib1dvARB){this->m_orig_glVertexAttrib1dvARB = this->m_ptr_glVertexAttrib1dvARB;this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&ValidationTableDecorator::m_glVertexAttrib1dvARB_validation;}
+if(this->m_ptr_glTextureSubImage2DEXT){this->m_orig_glTextureSubImage2DEXT = this->m_ptr_glTextureSubImage2DEXT;this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glTextureSubImage2DEXT_validation;}
+if(this->m_ptr_glIsVertexArrayAPPLE){this->m_orig_glIsVertexArrayAPPLE = this->m_ptr_glIsVertexArrayAPPLE;this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&ValidationTableDecorator::m_glIsVertexArrayAPPLE_validation;}
+if(this->m_ptr_glUseProgram){this->m_orig_glUseProgram = this->m_ptr_glUseProgram;this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&ValidationTableDecorator::m_glUseProgram_validation;}
+if(this->m_ptr_glLineStipple){this->m_orig_glLineStipple = this->m_ptr_glLineStipple;this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&ValidationTableDecorator::m_glLineStipple_validation;}
+if(this->m_ptr_glMultiTexCoord4fvARB){this->m_orig_glMultiTexCoord4fvARB = this->m_ptr_glMultiTexCoord4fvARB;this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4fvARB_validation;}
+if(this->m_ptr_glVideoCaptureNV){this->m_orig_glVideoCaptureNV = this->m_ptr_glVideoCaptureNV;this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&ValidationTableDecorator::m_glVideoCaptureNV_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT){this->m_orig_glVertexArrayVertexAttribLFormatEXT = this->m_ptr_glVertexArrayVertexAttribLFormatEXT;this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_validation;}
+if(this->m_ptr_glUniform3fvARB){this->m_orig_glUniform3fvARB = this->m_ptr_glUniform3fvARB;this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&ValidationTableDecorator::m_glUniform3fvARB_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT){this->m_orig_glProgramUniformMatrix3x2fvEXT = this->m_ptr_glProgramUniformMatrix3x2fvEXT;this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x2fvEXT_validation;}
+if(this->m_ptr_glCopyTextureSubImage3DEXT){this->m_orig_glCopyTextureSubImage3DEXT = this->m_ptr_glCopyTextureSubImage3DEXT;this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCopyTextureSubImage3DEXT_validation;}
+if(this->m_ptr_glMultiTexCoord2bvOES){this->m_orig_glMultiTexCoord2bvOES = this->m_ptr_glMultiTexCoord2bvOES;this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord2bvOES_validation;}
+if(this->m_ptr_glDeleteObjectARB){this->m_orig_glDeleteObjectARB = this->m_ptr_glDeleteObjectARB;this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&ValidationTableDecorator::m_glDeleteObjectARB_validation;}
+if(this->m_ptr_glTextureLightEXT){this->m_orig_glTextureLightEXT = this->m_ptr_glTextureLightEXT;this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&ValidationTableDecorator::m_glTextureLightEXT_validation;}
+if(this->m_ptr_glRasterPos3i){this->m_orig_glRasterPos3i = this->m_ptr_glRasterPos3i;this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&ValidationTableDecorator::m_glRasterPos3i_validation;}
+if(this->m_ptr_glMultiTexCoord3dARB){this->m_orig_glMultiTexCoord3dARB = this->m_ptr_glMultiTexCoord3dARB;this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3dARB_validation;}
+if(this->m_ptr_glNamedFramebufferTextureEXT){this->m_orig_glNamedFramebufferTextureEXT = this->m_ptr_glNamedFramebufferTextureEXT;this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&ValidationTableDecorator::m_glNamedFramebufferTextureEXT_validation;}
+if(this->m_ptr_glTextureParameteriEXT){this->m_orig_glTextureParameteriEXT = this->m_ptr_glTextureParameteriEXT;this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&ValidationTableDecorator::m_glTextureParameteriEXT_validation;}
+if(this->m_ptr_glEvalCoord2xvOES){this->m_orig_glEvalCoord2xvOES = this->m_ptr_glEvalCoord2xvOES;this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&ValidationTableDecorator::m_glEvalCoord2xvOES_validation;}
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV){this->m_orig_glBindVideoCaptureStreamBufferNV = this->m_ptr_glBindVideoCaptureStreamBufferNV;this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&ValidationTableDecorator::m_glBindVideoCaptureStreamBufferNV_validation;}
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV){this->m_orig_glTexImage2DMultisampleCoverageNV = this->m_ptr_glTexImage2DMultisampleCoverageNV;this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&ValidationTableDecorator::m_glTexImage2DMultisampleCoverageNV_validation;}
+if(this->m_ptr_glGetAttribLocationARB){this->m_orig_glGetAttribLocationARB = this->m_ptr_glGetAttribLocationARB;this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&ValidationTableDecorator::m_glGetAttribLocationARB_validation;}
+if(this->m_ptr_glDeleteShader){this->m_orig_glDeleteShader = this->m_ptr_glDeleteShader;this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&ValidationTableDecorator::m_glDeleteShader_validation;}
+if(this->m_ptr_glVertexAttrib1fARB){this->m_orig_glVertexAttrib1fARB = this->m_ptr_glVertexAttrib1fARB;this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&ValidationTableDecorator::m_glVertexAttrib1fARB_validation;}
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN){this->m_orig_glTexCoord2fColor4ubVertex3fSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fSUN;this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&ValidationTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_validation;}
+if(this->m_ptr_glTexCoord4fVertex4fSUN){this->m_orig_glTexCoord4fVertex4fSUN = this->m_ptr_glTexCoord4fVertex4fSUN;this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&ValidationTableDecorator::m_glTexCoord4fVertex4fSUN_validation;}
+if(this->m_ptr_glGetMapdv){this->m_orig_glGetMapdv = this->m_ptr_glGetMapdv;this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&ValidationTableDecorator::m_glGetMapdv_validation;}
+if(this->m_ptr_glMapParameterfvNV){this->m_orig_glMapParameterfvNV = this->m_ptr_glMapParameterfvNV;this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&ValidationTableDecorator::m_glMapParameterfvNV_validation;}
+if(this->m_ptr_glTextureParameterIuiv){this->m_orig_glTextureParameterIuiv = this->m_ptr_glTextureParameterIuiv;this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&ValidationTableDecorator::m_glTextureParameterIuiv_validation;}
+if(this->m_ptr_glTransformFeedbackAttribsNV){this->m_orig_glTransformFeedbackAttribsNV = this->m_ptr_glTransformFeedbackAttribsNV;this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&ValidationTableDecorator::m_glTransformFeedbackAttribsNV_validation;}
+if(this->m_ptr_glFragmentLightfvSGIX){this->m_orig_glFragmentLightfvSGIX = this->m_ptr_glFragmentLightfvSGIX;this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&ValidationTableDecorator::m_glFragmentLightfvSGIX_validation;}
+if(this->m_ptr_glWindowPos3sARB){this->m_orig_glWindowPos3sARB = this->m_ptr_glWindowPos3sARB;this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&ValidationTableDecorator::m_glWindowPos3sARB_validation;}
+if(this->m_ptr_glGetConvolutionParameterfv){this->m_orig_glGetConvolutionParameterfv = this->m_ptr_glGetConvolutionParameterfv;this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&ValidationTableDecorator::m_glGetConvolutionParameterfv_validation;}
+if(this->m_ptr_glCopyTexSubImage3D){this->m_orig_glCopyTexSubImage3D = this->m_ptr_glCopyTexSubImage3D;this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&ValidationTableDecorator::m_glCopyTexSubImage3D_validation;}
+if(this->m_ptr_glVertexAttribI3i){this->m_orig_glVertexAttribI3i = this->m_ptr_glVertexAttribI3i;this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&ValidationTableDecorator::m_glVertexAttribI3i_validation;}
+if(this->m_ptr_glCreateShaderObjectARB){this->m_orig_glCreateShaderObjectARB = this->m_ptr_glCreateShaderObjectARB;this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&ValidationTableDecorator::m_glCreateShaderObjectARB_validation;}
+if(this->m_ptr_glVertexAttribFormat){this->m_orig_glVertexAttribFormat = this->m_ptr_glVertexAttribFormat;this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&ValidationTableDecorator::m_glVertexAttribFormat_validation;}
+if(this->m_ptr_glGetProgramivARB){this->m_orig_glGetProgramivARB = this->m_ptr_glGetProgramivARB;this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&ValidationTableDecorator::m_glGetProgramivARB_validation;}
+if(this->m_ptr_glVertexAttribI4usv){this->m_orig_glVertexAttribI4usv = this->m_ptr_glVertexAttribI4usv;this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&ValidationTableDecorator::m_glVertexAttribI4usv_validation;}
+if(this->m_ptr_glTexParameterf){this->m_orig_glTexParameterf = this->m_ptr_glTexParameterf;this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&ValidationTableDecorator::m_glTexParameterf_validation;}
+if(this->m_ptr_glVertexAttribBinding){this->m_orig_glVertexAttribBinding = this->m_ptr_glVertexAttribBinding;this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&ValidationTableDecorator::m_glVertexAttribBinding_validation;}
+if(this->m_ptr_glGetHistogramParameteriv){this->m_orig_glGetHistogramParameteriv = this->m_ptr_glGetHistogramParameteriv;this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&ValidationTableDecorator::m_glGetHistogramParameteriv_validation;}
+if(this->m_ptr_glTexParameteri){this->m_orig_glTexParameteri = this->m_ptr_glTexParameteri;this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&ValidationTableDecorator::m_glTexParameteri_validation;}
+if(this->m_ptr_glGetShaderSource){this->m_orig_glGetShaderSource = this->m_ptr_glGetShaderSource;this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&ValidationTableDecorator::m_glGetShaderSource_validation;}
+if(this->m_ptr_glVertexAttrib4s){this->m_orig_glVertexAttrib4s = this->m_ptr_glVertexAttrib4s;this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&ValidationTableDecorator::m_glVertexAttrib4s_validation;}
+if(this->m_ptr_glVertexAttrib4dvNV){this->m_orig_glVertexAttrib4dvNV = this->m_ptr_glVertexAttrib4dvNV;this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&ValidationTableDecorator::m_glVertexAttrib4dvNV_validation;}
+if(this->m_ptr_glVertexAttrib1dvNV){this->m_orig_glVertexAttrib1dvNV = this->m_ptr_glVertexAttrib1dvNV;this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&ValidationTableDecorator::m_glVertexAttrib1dvNV_validation;}
+if(this->m_ptr_glPopName){this->m_orig_glPopName = this->m_ptr_glPopName;this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&ValidationTableDecorator::m_glPopName_validation;}
+if(this->m_ptr_glTextureBufferEXT){this->m_orig_glTextureBufferEXT = this->m_ptr_glTextureBufferEXT;this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&ValidationTableDecorator::m_glTextureBufferEXT_validation;}
+if(this->m_ptr_glGetMultiTexImageEXT){this->m_orig_glGetMultiTexImageEXT = this->m_ptr_glGetMultiTexImageEXT;this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&ValidationTableDecorator::m_glGetMultiTexImageEXT_validation;}
+if(this->m_ptr_glGetPointerIndexedvEXT){this->m_orig_glGetPointerIndexedvEXT = this->m_ptr_glGetPointerIndexedvEXT;this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&ValidationTableDecorator::m_glGetPointerIndexedvEXT_validation;}
+if(this->m_ptr_glIsNameAMD){this->m_orig_glIsNameAMD = this->m_ptr_glIsNameAMD;this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&ValidationTableDecorator::m_glIsNameAMD_validation;}
+if(this->m_ptr_glColor4ub){this->m_orig_glColor4ub = this->m_ptr_glColor4ub;this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&ValidationTableDecorator::m_glColor4ub_validation;}
+if(this->m_ptr_glBufferParameteriAPPLE){this->m_orig_glBufferParameteriAPPLE = this->m_ptr_glBufferParameteriAPPLE;this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&ValidationTableDecorator::m_glBufferParameteriAPPLE_validation;}
+if(this->m_ptr_glColor4ui){this->m_orig_glColor4ui = this->m_ptr_glColor4ui;this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&ValidationTableDecorator::m_glColor4ui_validation;}
+if(this->m_ptr_glGetInternalformativ){this->m_orig_glGetInternalformativ = this->m_ptr_glGetInternalformativ;this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&ValidationTableDecorator::m_glGetInternalformativ_validation;}
+if(this->m_ptr_glColor4us){this->m_orig_glColor4us = this->m_ptr_glColor4us;this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&ValidationTableDecorator::m_glColor4us_validation;}
+if(this->m_ptr_glVertexAttribP1uiv){this->m_orig_glVertexAttribP1uiv = this->m_ptr_glVertexAttribP1uiv;this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&ValidationTableDecorator::m_glVertexAttribP1uiv_validation;}
+if(this->m_ptr_glLinkProgram){this->m_orig_glLinkProgram = this->m_ptr_glLinkProgram;this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&ValidationTableDecorator::m_glLinkProgram_validation;}
+if(this->m_ptr_glTexCoord3s){this->m_orig_glTexCoord3s = this->m_ptr_glTexCoord3s;this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&ValidationTableDecorator::m_glTexCoord3s_validation;}
+if(this->m_ptr_glTexCoord2dv){this->m_orig_glTexCoord2dv = this->m_ptr_glTexCoord2dv;this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&ValidationTableDecorator::m_glTexCoord2dv_validation;}
+if(this->m_ptr_glGetObjectLabel){this->m_orig_glGetObjectLabel = this->m_ptr_glGetObjectLabel;this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&ValidationTableDecorator::m_glGetObjectLabel_validation;}
+if(this->m_ptr_glVertexPointerEXT){this->m_orig_glVertexPointerEXT = this->m_ptr_glVertexPointerEXT;this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&ValidationTableDecorator::m_glVertexPointerEXT_validation;}
+if(this->m_ptr_glDebugMessageCallbackARB){this->m_orig_glDebugMessageCallbackARB = this->m_ptr_glDebugMessageCallbackARB;this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&ValidationTableDecorator::m_glDebugMessageCallbackARB_validation;}
+if(this->m_ptr_glGetString){this->m_orig_glGetString = this->m_ptr_glGetString;this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&ValidationTableDecorator::m_glGetString_validation;}
+if(this->m_ptr_glGetPathParameterfvNV){this->m_orig_glGetPathParameterfvNV = this->m_ptr_glGetPathParameterfvNV;this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetPathParameterfvNV_validation;}
+if(this->m_ptr_glLightxvOES){this->m_orig_glLightxvOES = this->m_ptr_glLightxvOES;this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&ValidationTableDecorator::m_glLightxvOES_validation;}
+if(this->m_ptr_glEndQuery){this->m_orig_glEndQuery = this->m_ptr_glEndQuery;this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&ValidationTableDecorator::m_glEndQuery_validation;}
+if(this->m_ptr_glSecondaryColor3uiv){this->m_orig_glSecondaryColor3uiv = this->m_ptr_glSecondaryColor3uiv;this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&ValidationTableDecorator::m_glSecondaryColor3uiv_validation;}
+if(this->m_ptr_glPrioritizeTexturesxOES){this->m_orig_glPrioritizeTexturesxOES = this->m_ptr_glPrioritizeTexturesxOES;this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&ValidationTableDecorator::m_glPrioritizeTexturesxOES_validation;}
+if(this->m_ptr_glEdgeFlagPointer){this->m_orig_glEdgeFlagPointer = this->m_ptr_glEdgeFlagPointer;this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&ValidationTableDecorator::m_glEdgeFlagPointer_validation;}
+if(this->m_ptr_glFramebufferParameteri){this->m_orig_glFramebufferParameteri = this->m_ptr_glFramebufferParameteri;this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&ValidationTableDecorator::m_glFramebufferParameteri_validation;}
+if(this->m_ptr_glTexCoord3hNV){this->m_orig_glTexCoord3hNV = this->m_ptr_glTexCoord3hNV;this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&ValidationTableDecorator::m_glTexCoord3hNV_validation;}
+if(this->m_ptr_glMultiModeDrawElementsIBM){this->m_orig_glMultiModeDrawElementsIBM = this->m_ptr_glMultiModeDrawElementsIBM;this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&ValidationTableDecorator::m_glMultiModeDrawElementsIBM_validation;}
+if(this->m_ptr_glCopyPixels){this->m_orig_glCopyPixels = this->m_ptr_glCopyPixels;this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&ValidationTableDecorator::m_glCopyPixels_validation;}
+if(this->m_ptr_glVertexAttribI2ui){this->m_orig_glVertexAttribI2ui = this->m_ptr_glVertexAttribI2ui;this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&ValidationTableDecorator::m_glVertexAttribI2ui_validation;}
+if(this->m_ptr_glClampColorARB){this->m_orig_glClampColorARB = this->m_ptr_glClampColorARB;this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&ValidationTableDecorator::m_glClampColorARB_validation;}
+if(this->m_ptr_glColorPointervINTEL){this->m_orig_glColorPointervINTEL = this->m_ptr_glColorPointervINTEL;this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&ValidationTableDecorator::m_glColorPointervINTEL_validation;}
+if(this->m_ptr_glDeleteTextures){this->m_orig_glDeleteTextures = this->m_ptr_glDeleteTextures;this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&ValidationTableDecorator::m_glDeleteTextures_validation;}
+if(this->m_ptr_glGetMinmaxParameterfvEXT){this->m_orig_glGetMinmaxParameterfvEXT = this->m_ptr_glGetMinmaxParameterfvEXT;this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetMinmaxParameterfvEXT_validation;}
+if(this->m_ptr_glWindowPos3sMESA){this->m_orig_glWindowPos3sMESA = this->m_ptr_glWindowPos3sMESA;this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&ValidationTableDecorator::m_glWindowPos3sMESA_validation;}
+if(this->m_ptr_glVertexAttrib4f){this->m_orig_glVertexAttrib4f = this->m_ptr_glVertexAttrib4f;this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&ValidationTableDecorator::m_glVertexAttrib4f_validation;}
+if(this->m_ptr_glNamedFramebufferParameteri){this->m_orig_glNamedFramebufferParameteri = this->m_ptr_glNamedFramebufferParameteri;this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&ValidationTableDecorator::m_glNamedFramebufferParameteri_validation;}
+if(this->m_ptr_glTexCoord2fVertex3fvSUN){this->m_orig_glTexCoord2fVertex3fvSUN = this->m_ptr_glTexCoord2fVertex3fvSUN;this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glTexCoord2fVertex3fvSUN_validation;}
+if(this->m_ptr_glReplacementCodeusSUN){this->m_orig_glReplacementCodeusSUN = this->m_ptr_glReplacementCodeusSUN;this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&ValidationTableDecorator::m_glReplacementCodeusSUN_validation;}
+if(this->m_ptr_glGetNamedFramebufferParameteriv){this->m_orig_glGetNamedFramebufferParameteriv = this->m_ptr_glGetNamedFramebufferParameteriv;this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetNamedFramebufferParameteriv_validation;}
+if(this->m_ptr_glVertexStream1fvATI){this->m_orig_glVertexStream1fvATI = this->m_ptr_glVertexStream1fvATI;this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&ValidationTableDecorator::m_glVertexStream1fvATI_validation;}
+if(this->m_ptr_glCreateVertexArrays){this->m_orig_glCreateVertexArrays = this->m_ptr_glCreateVertexArrays;this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&ValidationTableDecorator::m_glCreateVertexArrays_validation;}
+if(this->m_ptr_glBeginConditionalRender){this->m_orig_glBeginConditionalRender = this->m_ptr_glBeginConditionalRender;this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&ValidationTableDecorator::m_glBeginConditionalRender_validation;}
+if(this->m_ptr_glGetUnsignedBytevEXT){this->m_orig_glGetUnsignedBytevEXT = this->m_ptr_glGetUnsignedBytevEXT;this->m_ptr_glGetUnsignedBytevEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC)&ValidationTableDecorator::m_glGetUnsignedBytevEXT_validation;}
+if(this->m_ptr_glConvolutionFilter1D){this->m_orig_glConvolutionFilter1D = this->m_ptr_glConvolutionFilter1D;this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&ValidationTableDecorator::m_glConvolutionFilter1D_validation;}
+if(this->m_ptr_glMultiTexCoord3fARB){this->m_orig_glMultiTexCoord3fARB = this->m_ptr_glMultiTexCoord3fARB;this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3fARB_validation;}
+if(this->m_ptr_glGetQueryObjectuivARB){this->m_orig_glGetQueryObjectuivARB = this->m_ptr_glGetQueryObjectuivARB;this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&ValidationTableDecorator::m_glGetQueryObjectuivARB_validation;}
+if(this->m_ptr_glScalexOES){this->m_orig_glScalexOES = this->m_ptr_glScalexOES;this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&ValidationTableDecorator::m_glScalexOES_validation;}
+if(this->m_ptr_glSamplerParameteri){this->m_orig_glSamplerParameteri = this->m_ptr_glSamplerParameteri;this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&ValidationTableDecorator::m_glSamplerParameteri_validation;}
+if(this->m_ptr_glSamplerParameterf){this->m_orig_glSamplerParameterf = this->m_ptr_glSamplerParameterf;this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&ValidationTableDecorator::m_glSamplerParameterf_validation;}
+if(this->m_ptr_glShaderOp1EXT){this->m_orig_glShaderOp1EXT = this->m_ptr_glShaderOp1EXT;this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&ValidationTableDecorator::m_glShaderOp1EXT_validation;}
+if(this->m_ptr_glBeginVideoCaptureNV){this->m_orig_glBeginVideoCaptureNV = this->m_ptr_glBeginVideoCaptureNV;this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&ValidationTableDecorator::m_glBeginVideoCaptureNV_validation;}
+if(this->m_ptr_glGetnHistogram){this->m_orig_glGetnHistogram = this->m_ptr_glGetnHistogram;this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&ValidationTableDecorator::m_glGetnHistogram_validation;}
+if(this->m_ptr_glUniform1d){this->m_orig_glUniform1d = this->m_ptr_glUniform1d;this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&ValidationTableDecorator::m_glUniform1d_validation;}
+if(this->m_ptr_glRenderMode){this->m_orig_glRenderMode = this->m_ptr_glRenderMode;this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&ValidationTableDecorator::m_glRenderMode_validation;}
+if(this->m_ptr_glClearColorIiEXT){this->m_orig_glClearColorIiEXT = this->m_ptr_glClearColorIiEXT;this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&ValidationTableDecorator::m_glClearColorIiEXT_validation;}
+if(this->m_ptr_glSignalSemaphoreEXT){this->m_orig_glSignalSemaphoreEXT = this->m_ptr_glSignalSemaphoreEXT;this->m_ptr_glSignalSemaphoreEXT = (FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC)&ValidationTableDecorator::m_glSignalSemaphoreEXT_validation;}
+if(this->m_ptr_glGetCompressedTexImage){this->m_orig_glGetCompressedTexImage = this->m_ptr_glGetCompressedTexImage;this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&ValidationTableDecorator::m_glGetCompressedTexImage_validation;}
+if(this->m_ptr_glCompressedTextureImage1DEXT){this->m_orig_glCompressedTextureImage1DEXT = this->m_ptr_glCompressedTextureImage1DEXT;this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCompressedTextureImage1DEXT_validation;}
+if(this->m_ptr_glGetActiveUniformBlockiv){this->m_orig_glGetActiveUniformBlockiv = this->m_ptr_glGetActiveUniformBlockiv;this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&ValidationTableDecorator::m_glGetActiveUniformBlockiv_validation;}
+if(this->m_ptr_glUniform1i){this->m_orig_glUniform1i = this->m_ptr_glUniform1i;this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&ValidationTableDecorator::m_glUniform1i_validation;}
+if(this->m_ptr_glMultiDrawArraysIndirectCount){this->m_orig_glMultiDrawArraysIndirectCount = this->m_ptr_glMultiDrawArraysIndirectCount;this->m_ptr_glMultiDrawArraysIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)&ValidationTableDecorator::m_glMultiDrawArraysIndirectCount_validation;}
+if(this->m_ptr_glGetTexEnvfv){this->m_orig_glGetTexEnvfv = this->m_ptr_glGetTexEnvfv;this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&ValidationTableDecorator::m_glGetTexEnvfv_validation;}
+if(this->m_ptr_glColorTableParameterivSGI){this->m_orig_glColorTableParameterivSGI = this->m_ptr_glColorTableParameterivSGI;this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&ValidationTableDecorator::m_glColorTableParameterivSGI_validation;}
+if(this->m_ptr_glCullFace){this->m_orig_glCullFace = this->m_ptr_glCullFace;this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&ValidationTableDecorator::m_glCullFace_validation;}
+if(this->m_ptr_glDeleteFencesAPPLE){this->m_orig_glDeleteFencesAPPLE = this->m_ptr_glDeleteFencesAPPLE;this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&ValidationTableDecorator::m_glDeleteFencesAPPLE_validation;}
+if(this->m_ptr_glProgramUniform4i){this->m_orig_glProgramUniform4i = this->m_ptr_glProgramUniform4i;this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&ValidationTableDecorator::m_glProgramUniform4i_validation;}
+if(this->m_ptr_glUniformHandleui64ARB){this->m_orig_glUniformHandleui64ARB = this->m_ptr_glUniformHandleui64ARB;this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&ValidationTableDecorator::m_glUniformHandleui64ARB_validation;}
+if(this->m_ptr_glProgramUniform4f){this->m_orig_glProgramUniform4f = this->m_ptr_glProgramUniform4f;this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&ValidationTableDecorator::m_glProgramUniform4f_validation;}
+if(this->m_ptr_glViewportIndexedf){this->m_orig_glViewportIndexedf = this->m_ptr_glViewportIndexedf;this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&ValidationTableDecorator::m_glViewportIndexedf_validation;}
+if(this->m_ptr_glProgramUniform4d){this->m_orig_glProgramUniform4d = this->m_ptr_glProgramUniform4d;this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&ValidationTableDecorator::m_glProgramUniform4d_validation;}
+if(this->m_ptr_glTexCoord1xOES){this->m_orig_glTexCoord1xOES = this->m_ptr_glTexCoord1xOES;this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&ValidationTableDecorator::m_glTexCoord1xOES_validation;}
+if(this->m_ptr_glVertexStream3ivATI){this->m_orig_glVertexStream3ivATI = this->m_ptr_glVertexStream3ivATI;this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&ValidationTableDecorator::m_glVertexStream3ivATI_validation;}
+if(this->m_ptr_glPointAlongPathNV){this->m_orig_glPointAlongPathNV = this->m_ptr_glPointAlongPathNV;this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&ValidationTableDecorator::m_glPointAlongPathNV_validation;}
+if(this->m_ptr_glEndQueryARB){this->m_orig_glEndQueryARB = this->m_ptr_glEndQueryARB;this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&ValidationTableDecorator::m_glEndQueryARB_validation;}
+if(this->m_ptr_glVDPAUMapSurfacesNV){this->m_orig_glVDPAUMapSurfacesNV = this->m_ptr_glVDPAUMapSurfacesNV;this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&ValidationTableDecorator::m_glVDPAUMapSurfacesNV_validation;}
+if(this->m_ptr_glVertex3i){this->m_orig_glVertex3i = this->m_ptr_glVertex3i;this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&ValidationTableDecorator::m_glVertex3i_validation;}
+if(this->m_ptr_glVertexAttrib4uivARB){this->m_orig_glVertexAttrib4uivARB = this->m_ptr_glVertexAttrib4uivARB;this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4uivARB_validation;}
+if(this->m_ptr_glTextureStorageMem3DEXT){this->m_orig_glTextureStorageMem3DEXT = this->m_ptr_glTextureStorageMem3DEXT;this->m_ptr_glTextureStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC)&ValidationTableDecorator::m_glTextureStorageMem3DEXT_validation;}
+if(this->m_ptr_glAttachShader){this->m_orig_glAttachShader = this->m_ptr_glAttachShader;this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&ValidationTableDecorator::m_glAttachShader_validation;}
+if(this->m_ptr_glColor4hNV){this->m_orig_glColor4hNV = this->m_ptr_glColor4hNV;this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&ValidationTableDecorator::m_glColor4hNV_validation;}
+if(this->m_ptr_glGetFenceivNV){this->m_orig_glGetFenceivNV = this->m_ptr_glGetFenceivNV;this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&ValidationTableDecorator::m_glGetFenceivNV_validation;}
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN){this->m_orig_glTexCoord2fColor4ubVertex3fvSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN;this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_validation;}
+if(this->m_ptr_glGetColorTable){this->m_orig_glGetColorTable = this->m_ptr_glGetColorTable;this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&ValidationTableDecorator::m_glGetColorTable_validation;}
+if(this->m_ptr_glFogCoordPointer){this->m_orig_glFogCoordPointer = this->m_ptr_glFogCoordPointer;this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&ValidationTableDecorator::m_glFogCoordPointer_validation;}
+if(this->m_ptr_glTexStorageSparseAMD){this->m_orig_glTexStorageSparseAMD = this->m_ptr_glTexStorageSparseAMD;this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&ValidationTableDecorator::m_glTexStorageSparseAMD_validation;}
+if(this->m_ptr_glUnmapNamedBuffer){this->m_orig_glUnmapNamedBuffer = this->m_ptr_glUnmapNamedBuffer;this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&ValidationTableDecorator::m_glUnmapNamedBuffer_validation;}
+if(this->m_ptr_glTexCoord4bvOES){this->m_orig_glTexCoord4bvOES = this->m_ptr_glTexCoord4bvOES;this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&ValidationTableDecorator::m_glTexCoord4bvOES_validation;}
+if(this->m_ptr_glVertexAttrib3fARB){this->m_orig_glVertexAttrib3fARB = this->m_ptr_glVertexAttrib3fARB;this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&ValidationTableDecorator::m_glVertexAttrib3fARB_validation;}
+if(this->m_ptr_glRasterPos2xOES){this->m_orig_glRasterPos2xOES = this->m_ptr_glRasterPos2xOES;this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&ValidationTableDecorator::m_glRasterPos2xOES_validation;}
+if(this->m_ptr_glCreateMemoryObjectsEXT){this->m_orig_glCreateMemoryObjectsEXT = this->m_ptr_glCreateMemoryObjectsEXT;this->m_ptr_glCreateMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC)&ValidationTableDecorator::m_glCreateMemoryObjectsEXT_validation;}
+if(this->m_ptr_glColor4ubVertex2fvSUN){this->m_orig_glColor4ubVertex2fvSUN = this->m_ptr_glColor4ubVertex2fvSUN;this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&ValidationTableDecorator::m_glColor4ubVertex2fvSUN_validation;}
+if(this->m_ptr_glSecondaryColor3dv){this->m_orig_glSecondaryColor3dv = this->m_ptr_glSecondaryColor3dv;this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&ValidationTableDecorator::m_glSecondaryColor3dv_validation;}
+if(this->m_ptr_glVertexAttribI4sv){this->m_orig_glVertexAttribI4sv = this->m_ptr_glVertexAttribI4sv;this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&ValidationTableDecorator::m_glVertexAttribI4sv_validation;}
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced){this->m_orig_glDrawTransformFeedbackStreamInstanced = this->m_ptr_glDrawTransformFeedbackStreamInstanced;this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&ValidationTableDecorator::m_glDrawTransformFeedbackStreamInstanced_validation;}
+if(this->m_ptr_glMultiTexCoord4ivARB){this->m_orig_glMultiTexCoord4ivARB = this->m_ptr_glMultiTexCoord4ivARB;this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4ivARB_validation;}
+if(this->m_ptr_glSpriteParameterfSGIX){this->m_orig_glSpriteParameterfSGIX = this->m_ptr_glSpriteParameterfSGIX;this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&ValidationTableDecorator::m_glSpriteParameterfSGIX_validation;}
+if(this->m_ptr_glSecondaryColor3sv){this->m_orig_glSecondaryColor3sv = this->m_ptr_glSecondaryColor3sv;this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&ValidationTableDecorator::m_glSecondaryColor3sv_validation;}
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV){this->m_orig_glBindVideoCaptureStreamTextureNV = this->m_ptr_glBindVideoCaptureStreamTextureNV;this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&ValidationTableDecorator::m_glBindVideoCaptureStreamTextureNV_validation;}
+if(this->m_ptr_glTexParameterIuiv){this->m_orig_glTexParameterIuiv = this->m_ptr_glTexParameterIuiv;this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&ValidationTableDecorator::m_glTexParameterIuiv_validation;}
+if(this->m_ptr_glFlushPixelDataRangeNV){this->m_orig_glFlushPixelDataRangeNV = this->m_ptr_glFlushPixelDataRangeNV;this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&ValidationTableDecorator::m_glFlushPixelDataRangeNV_validation;}
+if(this->m_ptr_glWindowPos3fv){this->m_orig_glWindowPos3fv = this->m_ptr_glWindowPos3fv;this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&ValidationTableDecorator::m_glWindowPos3fv_validation;}
+if(this->m_ptr_glVertexAttribLFormatNV){this->m_orig_glVertexAttribLFormatNV = this->m_ptr_glVertexAttribLFormatNV;this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&ValidationTableDecorator::m_glVertexAttribLFormatNV_validation;}
+if(this->m_ptr_glLightModelfv){this->m_orig_glLightModelfv = this->m_ptr_glLightModelfv;this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&ValidationTableDecorator::m_glLightModelfv_validation;}
+if(this->m_ptr_glGetColorTableSGI){this->m_orig_glGetColorTableSGI = this->m_ptr_glGetColorTableSGI;this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&ValidationTableDecorator::m_glGetColorTableSGI_validation;}
+if(this->m_ptr_glGetCompressedTexImageARB){this->m_orig_glGetCompressedTexImageARB = this->m_ptr_glGetCompressedTexImageARB;this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&ValidationTableDecorator::m_glGetCompressedTexImageARB_validation;}
+if(this->m_ptr_glConvolutionParameteri){this->m_orig_glConvolutionParameteri = this->m_ptr_glConvolutionParameteri;this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&ValidationTableDecorator::m_glConvolutionParameteri_validation;}
+if(this->m_ptr_glVertexWeighthNV){this->m_orig_glVertexWeighthNV = this->m_ptr_glVertexWeighthNV;this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&ValidationTableDecorator::m_glVertexWeighthNV_validation;}
+if(this->m_ptr_glColorMaskIndexedEXT){this->m_orig_glColorMaskIndexedEXT = this->m_ptr_glColorMaskIndexedEXT;this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&ValidationTableDecorator::m_glColorMaskIndexedEXT_validation;}
+if(this->m_ptr_glColorMaski){this->m_orig_glColorMaski = this->m_ptr_glColorMaski;this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&ValidationTableDecorator::m_glColorMaski_validation;}
+if(this->m_ptr_glColorFragmentOp1ATI){this->m_orig_glColorFragmentOp1ATI = this->m_ptr_glColorFragmentOp1ATI;this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&ValidationTableDecorator::m_glColorFragmentOp1ATI_validation;}
+if(this->m_ptr_glVertexAttribI4ubvEXT){this->m_orig_glVertexAttribI4ubvEXT = this->m_ptr_glVertexAttribI4ubvEXT;this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4ubvEXT_validation;}
+if(this->m_ptr_glVertexAttrib1dNV){this->m_orig_glVertexAttrib1dNV = this->m_ptr_glVertexAttrib1dNV;this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&ValidationTableDecorator::m_glVertexAttrib1dNV_validation;}
+if(this->m_ptr_glUnmapObjectBufferATI){this->m_orig_glUnmapObjectBufferATI = this->m_ptr_glUnmapObjectBufferATI;this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&ValidationTableDecorator::m_glUnmapObjectBufferATI_validation;}
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT){this->m_orig_glNamedProgramLocalParameterI4uiEXT = this->m_ptr_glNamedProgramLocalParameterI4uiEXT;this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_validation;}
+if(this->m_ptr_glProgramUniform1iEXT){this->m_orig_glProgramUniform1iEXT = this->m_ptr_glProgramUniform1iEXT;this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&ValidationTableDecorator::m_glProgramUniform1iEXT_validation;}
+if(this->m_ptr_glDeleteQueriesARB){this->m_orig_glDeleteQueriesARB = this->m_ptr_glDeleteQueriesARB;this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&ValidationTableDecorator::m_glDeleteQueriesARB_validation;}
+if(this->m_ptr_glWindowPos3svARB){this->m_orig_glWindowPos3svARB = this->m_ptr_glWindowPos3svARB;this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&ValidationTableDecorator::m_glWindowPos3svARB_validation;}
+if(this->m_ptr_glVertex4s){this->m_orig_glVertex4s = this->m_ptr_glVertex4s;this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&ValidationTableDecorator::m_glVertex4s_validation;}
+if(this->m_ptr_glImportMemoryWin32NameEXT){this->m_orig_glImportMemoryWin32NameEXT = this->m_ptr_glImportMemoryWin32NameEXT;this->m_ptr_glImportMemoryWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC)&ValidationTableDecorator::m_glImportMemoryWin32NameEXT_validation;}
+if(this->m_ptr_glStringMarkerGREMEDY){this->m_orig_glStringMarkerGREMEDY = this->m_ptr_glStringMarkerGREMEDY;this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&ValidationTableDecorator::m_glStringMarkerGREMEDY_validation;}
+if(this->m_ptr_glIsTransformFeedback){this->m_orig_glIsTransformFeedback = this->m_ptr_glIsTransformFeedback;this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glIsTransformFeedback_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT){this->m_orig_glProgramUniformMatrix2x3dvEXT = this->m_ptr_glProgramUniformMatrix2x3dvEXT;this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x3dvEXT_validation;}
+if(this->m_ptr_glGetObjectLabelEXT){this->m_orig_glGetObjectLabelEXT = this->m_ptr_glGetObjectLabelEXT;this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&ValidationTableDecorator::m_glGetObjectLabelEXT_validation;}
+if(this->m_ptr_glUniformHandleui64vNV){this->m_orig_glUniformHandleui64vNV = this->m_ptr_glUniformHandleui64vNV;this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&ValidationTableDecorator::m_glUniformHandleui64vNV_validation;}
+if(this->m_ptr_glRotated){this->m_orig_glRotated = this->m_ptr_glRotated;this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&ValidationTableDecorator::m_glRotated_validation;}
+if(this->m_ptr_glIsProgramPipeline){this->m_orig_glIsProgramPipeline = this->m_ptr_glIsProgramPipeline;this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&ValidationTableDecorator::m_glIsProgramPipeline_validation;}
+if(this->m_ptr_glRotatef){this->m_orig_glRotatef = this->m_ptr_glRotatef;this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&ValidationTableDecorator::m_glRotatef_validation;}
+if(this->m_ptr_glVertex4i){this->m_orig_glVertex4i = this->m_ptr_glVertex4i;this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&ValidationTableDecorator::m_glVertex4i_validation;}
+if(this->m_ptr_glGetActiveSubroutineUniformName){this->m_orig_glGetActiveSubroutineUniformName = this->m_ptr_glGetActiveSubroutineUniformName;this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&ValidationTableDecorator::m_glGetActiveSubroutineUniformName_validation;}
+if(this->m_ptr_glVertexAttrib4sNV){this->m_orig_glVertexAttrib4sNV = this->m_ptr_glVertexAttrib4sNV;this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&ValidationTableDecorator::m_glVertexAttrib4sNV_validation;}
+if(this->m_ptr_glProgramLocalParameter4dvARB){this->m_orig_glProgramLocalParameter4dvARB = this->m_ptr_glProgramLocalParameter4dvARB;this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&ValidationTableDecorator::m_glProgramLocalParameter4dvARB_validation;}
+if(this->m_ptr_glReplacementCodeubSUN){this->m_orig_glReplacementCodeubSUN = this->m_ptr_glReplacementCodeubSUN;this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&ValidationTableDecorator::m_glReplacementCodeubSUN_validation;}
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV){this->m_orig_glMultiDrawElementsIndirectBindlessNV = this->m_ptr_glMultiDrawElementsIndirectBindlessNV;this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&ValidationTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_validation;}
+if(this->m_ptr_glImportSemaphoreWin32HandleEXT){this->m_orig_glImportSemaphoreWin32HandleEXT = this->m_ptr_glImportSemaphoreWin32HandleEXT;this->m_ptr_glImportSemaphoreWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)&ValidationTableDecorator::m_glImportSemaphoreWin32HandleEXT_validation;}
+if(this->m_ptr_glUniformMatrix3fv){this->m_orig_glUniformMatrix3fv = this->m_ptr_glUniformMatrix3fv;this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&ValidationTableDecorator::m_glUniformMatrix3fv_validation;}
+if(this->m_ptr_glGetnMapfvARB){this->m_orig_glGetnMapfvARB = this->m_ptr_glGetnMapfvARB;this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&ValidationTableDecorator::m_glGetnMapfvARB_validation;}
+if(this->m_ptr_glGetnUniformfv){this->m_orig_glGetnUniformfv = this->m_ptr_glGetnUniformfv;this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&ValidationTableDecorator::m_glGetnUniformfv_validation;}
+if(this->m_ptr_glVertexAttribL2dv){this->m_orig_glVertexAttribL2dv = this->m_ptr_glVertexAttribL2dv;this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&ValidationTableDecorator::m_glVertexAttribL2dv_validation;}
+if(this->m_ptr_glVertexWeightPointerEXT){this->m_orig_glVertexWeightPointerEXT = this->m_ptr_glVertexWeightPointerEXT;this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&ValidationTableDecorator::m_glVertexWeightPointerEXT_validation;}
+if(this->m_ptr_glTangent3sEXT){this->m_orig_glTangent3sEXT = this->m_ptr_glTangent3sEXT;this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&ValidationTableDecorator::m_glTangent3sEXT_validation;}
+if(this->m_ptr_glSecondaryColorPointer){this->m_orig_glSecondaryColorPointer = this->m_ptr_glSecondaryColorPointer;this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&ValidationTableDecorator::m_glSecondaryColorPointer_validation;}
+if(this->m_ptr_glAlphaFunc){this->m_orig_glAlphaFunc = this->m_ptr_glAlphaFunc;this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&ValidationTableDecorator::m_glAlphaFunc_validation;}
+if(this->m_ptr_glGetNamedStringARB){this->m_orig_glGetNamedStringARB = this->m_ptr_glGetNamedStringARB;this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&ValidationTableDecorator::m_glGetNamedStringARB_validation;}
+if(this->m_ptr_glTexCoord4d){this->m_orig_glTexCoord4d = this->m_ptr_glTexCoord4d;this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&ValidationTableDecorator::m_glTexCoord4d_validation;}
+if(this->m_ptr_glBufferPageCommitmentARB){this->m_orig_glBufferPageCommitmentARB = this->m_ptr_glBufferPageCommitmentARB;this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&ValidationTableDecorator::m_glBufferPageCommitmentARB_validation;}
+if(this->m_ptr_glProgramLocalParameters4fvEXT){this->m_orig_glProgramLocalParameters4fvEXT = this->m_ptr_glProgramLocalParameters4fvEXT;this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&ValidationTableDecorator::m_glProgramLocalParameters4fvEXT_validation;}
+if(this->m_ptr_glStencilFunc){this->m_orig_glStencilFunc = this->m_ptr_glStencilFunc;this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&ValidationTableDecorator::m_glStencilFunc_validation;}
+if(this->m_ptr_glSemaphoreParameterui64vEXT){this->m_orig_glSemaphoreParameterui64vEXT = this->m_ptr_glSemaphoreParameterui64vEXT;this->m_ptr_glSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC)&ValidationTableDecorator::m_glSemaphoreParameterui64vEXT_validation;}
+if(this->m_ptr_glGetVertexAttribdvNV){this->m_orig_glGetVertexAttribdvNV = this->m_ptr_glGetVertexAttribdvNV;this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&ValidationTableDecorator::m_glGetVertexAttribdvNV_validation;}
+if(this->m_ptr_glTexCoord3dv){this->m_orig_glTexCoord3dv = this->m_ptr_glTexCoord3dv;this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&ValidationTableDecorator::m_glTexCoord3dv_validation;}
+if(this->m_ptr_glGetQueryBufferObjectiv){this->m_orig_glGetQueryBufferObjectiv = this->m_ptr_glGetQueryBufferObjectiv;this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&ValidationTableDecorator::m_glGetQueryBufferObjectiv_validation;}
+if(this->m_ptr_glTexGenxOES){this->m_orig_glTexGenxOES = this->m_ptr_glTexGenxOES;this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&ValidationTableDecorator::m_glTexGenxOES_validation;}
+if(this->m_ptr_glMultiTexCoord1fvARB){this->m_orig_glMultiTexCoord1fvARB = this->m_ptr_glMultiTexCoord1fvARB;this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1fvARB_validation;}
+if(this->m_ptr_glLightEnviSGIX){this->m_orig_glLightEnviSGIX = this->m_ptr_glLightEnviSGIX;this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&ValidationTableDecorator::m_glLightEnviSGIX_validation;}
+if(this->m_ptr_glGetProgramPipelineiv){this->m_orig_glGetProgramPipelineiv = this->m_ptr_glGetProgramPipelineiv;this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&ValidationTableDecorator::m_glGetProgramPipelineiv_validation;}
+if(this->m_ptr_glVertexStream2ivATI){this->m_orig_glVertexStream2ivATI = this->m_ptr_glVertexStream2ivATI;this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&ValidationTableDecorator::m_glVertexStream2ivATI_validation;}
+if(this->m_ptr_glGetColorTableEXT){this->m_orig_glGetColorTableEXT = this->m_ptr_glGetColorTableEXT;this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&ValidationTableDecorator::m_glGetColorTableEXT_validation;}
+if(this->m_ptr_glGetShaderInfoLog){this->m_orig_glGetShaderInfoLog = this->m_ptr_glGetShaderInfoLog;this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&ValidationTableDecorator::m_glGetShaderInfoLog_validation;}
+if(this->m_ptr_glGetOcclusionQueryuivNV){this->m_orig_glGetOcclusionQueryuivNV = this->m_ptr_glGetOcclusionQueryuivNV;this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&ValidationTableDecorator::m_glGetOcclusionQueryuivNV_validation;}
+if(this->m_ptr_glInvalidateNamedFramebufferSubData){this->m_orig_glInvalidateNamedFramebufferSubData = this->m_ptr_glInvalidateNamedFramebufferSubData;this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glInvalidateNamedFramebufferSubData_validation;}
+if(this->m_ptr_glVertexAttribL1i64NV){this->m_orig_glVertexAttribL1i64NV = this->m_ptr_glVertexAttribL1i64NV;this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&ValidationTableDecorator::m_glVertexAttribL1i64NV_validation;}
+if(this->m_ptr_glVDPAUInitNV){this->m_orig_glVDPAUInitNV = this->m_ptr_glVDPAUInitNV;this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&ValidationTableDecorator::m_glVDPAUInitNV_validation;}
+if(this->m_ptr_glVertexAttrib1hvNV){this->m_orig_glVertexAttrib1hvNV = this->m_ptr_glVertexAttrib1hvNV;this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&ValidationTableDecorator::m_glVertexAttrib1hvNV_validation;}
+if(this->m_ptr_glVertexAttribI4i){this->m_orig_glVertexAttribI4i = this->m_ptr_glVertexAttribI4i;this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&ValidationTableDecorator::m_glVertexAttribI4i_validation;}
+if(this->m_ptr_glRasterPos2iv){this->m_orig_glRasterPos2iv = this->m_ptr_glRasterPos2iv;this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&ValidationTableDecorator::m_glRasterPos2iv_validation;}
+if(this->m_ptr_glGetIntegerui64i_vNV){this->m_orig_glGetIntegerui64i_vNV = this->m_ptr_glGetIntegerui64i_vNV;this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&ValidationTableDecorator::m_glGetIntegerui64i_vNV_validation;}
+if(this->m_ptr_glUniformHandleui64NV){this->m_orig_glUniformHandleui64NV = this->m_ptr_glUniformHandleui64NV;this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&ValidationTableDecorator::m_glUniformHandleui64NV_validation;}
+if(this->m_ptr_glWindowPos3ivMESA){this->m_orig_glWindowPos3ivMESA = this->m_ptr_glWindowPos3ivMESA;this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&ValidationTableDecorator::m_glWindowPos3ivMESA_validation;}
+if(this->m_ptr_glBlendEquationSeparate){this->m_orig_glBlendEquationSeparate = this->m_ptr_glBlendEquationSeparate;this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&ValidationTableDecorator::m_glBlendEquationSeparate_validation;}
+if(this->m_ptr_glDrawElementsInstancedARB){this->m_orig_glDrawElementsInstancedARB = this->m_ptr_glDrawElementsInstancedARB;this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&ValidationTableDecorator::m_glDrawElementsInstancedARB_validation;}
+if(this->m_ptr_glGetSubroutineIndex){this->m_orig_glGetSubroutineIndex = this->m_ptr_glGetSubroutineIndex;this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&ValidationTableDecorator::m_glGetSubroutineIndex_validation;}
+if(this->m_ptr_glVertexAttrib2sv){this->m_orig_glVertexAttrib2sv = this->m_ptr_glVertexAttrib2sv;this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&ValidationTableDecorator::m_glVertexAttrib2sv_validation;}
+if(this->m_ptr_glSamplePatternSGIS){this->m_orig_glSamplePatternSGIS = this->m_ptr_glSamplePatternSGIS;this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&ValidationTableDecorator::m_glSamplePatternSGIS_validation;}
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES){this->m_orig_glEGLImageTargetRenderbufferStorageOES = this->m_ptr_glEGLImageTargetRenderbufferStorageOES;this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&ValidationTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_validation;}
+if(this->m_ptr_glPushAttrib){this->m_orig_glPushAttrib = this->m_ptr_glPushAttrib;this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&ValidationTableDecorator::m_glPushAttrib_validation;}
+if(this->m_ptr_glVertex3hNV){this->m_orig_glVertex3hNV = this->m_ptr_glVertex3hNV;this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&ValidationTableDecorator::m_glVertex3hNV_validation;}
+if(this->m_ptr_glRasterPos3xvOES){this->m_orig_glRasterPos3xvOES = this->m_ptr_glRasterPos3xvOES;this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&ValidationTableDecorator::m_glRasterPos3xvOES_validation;}
+if(this->m_ptr_glPathParameterfNV){this->m_orig_glPathParameterfNV = this->m_ptr_glPathParameterfNV;this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&ValidationTableDecorator::m_glPathParameterfNV_validation;}
+if(this->m_ptr_glGetUniformi64vNV){this->m_orig_glGetUniformi64vNV = this->m_ptr_glGetUniformi64vNV;this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&ValidationTableDecorator::m_glGetUniformi64vNV_validation;}
+if(this->m_ptr_glLightiv){this->m_orig_glLightiv = this->m_ptr_glLightiv;this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&ValidationTableDecorator::m_glLightiv_validation;}
+if(this->m_ptr_glMaterialxvOES){this->m_orig_glMaterialxvOES = this->m_ptr_glMaterialxvOES;this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&ValidationTableDecorator::m_glMaterialxvOES_validation;}
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT){this->m_orig_glNamedProgramLocalParameter4fEXT = this->m_ptr_glNamedProgramLocalParameter4fEXT;this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameter4fEXT_validation;}
+if(this->m_ptr_glVertexAttribL1dEXT){this->m_orig_glVertexAttribL1dEXT = this->m_ptr_glVertexAttribL1dEXT;this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&ValidationTableDecorator::m_glVertexAttribL1dEXT_validation;}
+if(this->m_ptr_glGetnUniformdvARB){this->m_orig_glGetnUniformdvARB = this->m_ptr_glGetnUniformdvARB;this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&ValidationTableDecorator::m_glGetnUniformdvARB_validation;}
+if(this->m_ptr_glSecondaryColor3bEXT){this->m_orig_glSecondaryColor3bEXT = this->m_ptr_glSecondaryColor3bEXT;this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3bEXT_validation;}
+if(this->m_ptr_glBeginPerfQueryINTEL){this->m_orig_glBeginPerfQueryINTEL = this->m_ptr_glBeginPerfQueryINTEL;this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&ValidationTableDecorator::m_glBeginPerfQueryINTEL_validation;}
+if(this->m_ptr_glProgramUniform1uivEXT){this->m_orig_glProgramUniform1uivEXT = this->m_ptr_glProgramUniform1uivEXT;this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&ValidationTableDecorator::m_glProgramUniform1uivEXT_validation;}
+if(this->m_ptr_glImageTransformParameterivHP){this->m_orig_glImageTransformParameterivHP = this->m_ptr_glImageTransformParameterivHP;this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&ValidationTableDecorator::m_glImageTransformParameterivHP_validation;}
+if(this->m_ptr_glDeleteBuffers){this->m_orig_glDeleteBuffers = this->m_ptr_glDeleteBuffers;this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&ValidationTableDecorator::m_glDeleteBuffers_validation;}
+if(this->m_ptr_glBindProgramPipeline){this->m_orig_glBindProgramPipeline = this->m_ptr_glBindProgramPipeline;this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&ValidationTableDecorator::m_glBindProgramPipeline_validation;}
+if(this->m_ptr_glScissor){this->m_orig_glScissor = this->m_ptr_glScissor;this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&ValidationTableDecorator::m_glScissor_validation;}
+if(this->m_ptr_glProgramUniform4fv){this->m_orig_glProgramUniform4fv = this->m_ptr_glProgramUniform4fv;this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&ValidationTableDecorator::m_glProgramUniform4fv_validation;}
+if(this->m_ptr_glGetBooleanv){this->m_orig_glGetBooleanv = this->m_ptr_glGetBooleanv;this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&ValidationTableDecorator::m_glGetBooleanv_validation;}
+if(this->m_ptr_glMaterialfv){this->m_orig_glMaterialfv = this->m_ptr_glMaterialfv;this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&ValidationTableDecorator::m_glMaterialfv_validation;}
+if(this->m_ptr_glWindowPos4fvMESA){this->m_orig_glWindowPos4fvMESA = this->m_ptr_glWindowPos4fvMESA;this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&ValidationTableDecorator::m_glWindowPos4fvMESA_validation;}
+if(this->m_ptr_glVertexAttribIPointerEXT){this->m_orig_glVertexAttribIPointerEXT = this->m_ptr_glVertexAttribIPointerEXT;this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&ValidationTableDecorator::m_glVertexAttribIPointerEXT_validation;}
+if(this->m_ptr_glProgramBufferParametersfvNV){this->m_orig_glProgramBufferParametersfvNV = this->m_ptr_glProgramBufferParametersfvNV;this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&ValidationTableDecorator::m_glProgramBufferParametersfvNV_validation;}
+if(this->m_ptr_glAlphaFuncxOES){this->m_orig_glAlphaFuncxOES = this->m_ptr_glAlphaFuncxOES;this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&ValidationTableDecorator::m_glAlphaFuncxOES_validation;}
+if(this->m_ptr_glMultiDrawArraysIndirectAMD){this->m_orig_glMultiDrawArraysIndirectAMD = this->m_ptr_glMultiDrawArraysIndirectAMD;this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&ValidationTableDecorator::m_glMultiDrawArraysIndirectAMD_validation;}
+if(this->m_ptr_glNormalStream3ivATI){this->m_orig_glNormalStream3ivATI = this->m_ptr_glNormalStream3ivATI;this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&ValidationTableDecorator::m_glNormalStream3ivATI_validation;}
+if(this->m_ptr_glTextureImage3DMultisampleNV){this->m_orig_glTextureImage3DMultisampleNV = this->m_ptr_glTextureImage3DMultisampleNV;this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&ValidationTableDecorator::m_glTextureImage3DMultisampleNV_validation;}
+if(this->m_ptr_glProgramUniform4uivEXT){this->m_orig_glProgramUniform4uivEXT = this->m_ptr_glProgramUniform4uivEXT;this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&ValidationTableDecorator::m_glProgramUniform4uivEXT_validation;}
+if(this->m_ptr_glReplacementCodeusvSUN){this->m_orig_glReplacementCodeusvSUN = this->m_ptr_glReplacementCodeusvSUN;this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeusvSUN_validation;}
+if(this->m_ptr_glPollInstrumentsSGIX){this->m_orig_glPollInstrumentsSGIX = this->m_ptr_glPollInstrumentsSGIX;this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&ValidationTableDecorator::m_glPollInstrumentsSGIX_validation;}
+if(this->m_ptr_glGetTextureLevelParameteriv){this->m_orig_glGetTextureLevelParameteriv = this->m_ptr_glGetTextureLevelParameteriv;this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&ValidationTableDecorator::m_glGetTextureLevelParameteriv_validation;}
+if(this->m_ptr_glVertexAttribI2uiv){this->m_orig_glVertexAttribI2uiv = this->m_ptr_glVertexAttribI2uiv;this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&ValidationTableDecorator::m_glVertexAttribI2uiv_validation;}
+if(this->m_ptr_glMapControlPointsNV){this->m_orig_glMapControlPointsNV = this->m_ptr_glMapControlPointsNV;this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&ValidationTableDecorator::m_glMapControlPointsNV_validation;}
+if(this->m_ptr_glColor4dv){this->m_orig_glColor4dv = this->m_ptr_glColor4dv;this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&ValidationTableDecorator::m_glColor4dv_validation;}
+if(this->m_ptr_glInvalidateBufferSubData){this->m_orig_glInvalidateBufferSubData = this->m_ptr_glInvalidateBufferSubData;this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glInvalidateBufferSubData_validation;}
+if(this->m_ptr_glMultiTexCoord1hNV){this->m_orig_glMultiTexCoord1hNV = this->m_ptr_glMultiTexCoord1hNV;this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&ValidationTableDecorator::m_glMultiTexCoord1hNV_validation;}
+if(this->m_ptr_glPointParameterfv){this->m_orig_glPointParameterfv = this->m_ptr_glPointParameterfv;this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&ValidationTableDecorator::m_glPointParameterfv_validation;}
+if(this->m_ptr_glUniformMatrix2fvARB){this->m_orig_glUniformMatrix2fvARB = this->m_ptr_glUniformMatrix2fvARB;this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&ValidationTableDecorator::m_glUniformMatrix2fvARB_validation;}
+if(this->m_ptr_glUniform2fv){this->m_orig_glUniform2fv = this->m_ptr_glUniform2fv;this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&ValidationTableDecorator::m_glUniform2fv_validation;}
+if(this->m_ptr_glVertexPointerListIBM){this->m_orig_glVertexPointerListIBM = this->m_ptr_glVertexPointerListIBM;this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glVertexPointerListIBM_validation;}
+if(this->m_ptr_glGetMultiTexGenfvEXT){this->m_orig_glGetMultiTexGenfvEXT = this->m_ptr_glGetMultiTexGenfvEXT;this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexGenfvEXT_validation;}
+if(this->m_ptr_glGetMinmaxEXT){this->m_orig_glGetMinmaxEXT = this->m_ptr_glGetMinmaxEXT;this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&ValidationTableDecorator::m_glGetMinmaxEXT_validation;}
+if(this->m_ptr_glIsFenceNV){this->m_orig_glIsFenceNV = this->m_ptr_glIsFenceNV;this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&ValidationTableDecorator::m_glIsFenceNV_validation;}
+if(this->m_ptr_glMatrixFrustumEXT){this->m_orig_glMatrixFrustumEXT = this->m_ptr_glMatrixFrustumEXT;this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&ValidationTableDecorator::m_glMatrixFrustumEXT_validation;}
+if(this->m_ptr_glDispatchComputeIndirect){this->m_orig_glDispatchComputeIndirect = this->m_ptr_glDispatchComputeIndirect;this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&ValidationTableDecorator::m_glDispatchComputeIndirect_validation;}
+if(this->m_ptr_glQueryResourceNV){this->m_orig_glQueryResourceNV = this->m_ptr_glQueryResourceNV;this->m_ptr_glQueryResourceNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC)&ValidationTableDecorator::m_glQueryResourceNV_validation;}
+if(this->m_ptr_glMultiTexCoord4bOES){this->m_orig_glMultiTexCoord4bOES = this->m_ptr_glMultiTexCoord4bOES;this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&ValidationTableDecorator::m_glMultiTexCoord4bOES_validation;}
+if(this->m_ptr_glProgramEnvParameter4dARB){this->m_orig_glProgramEnvParameter4dARB = this->m_ptr_glProgramEnvParameter4dARB;this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&ValidationTableDecorator::m_glProgramEnvParameter4dARB_validation;}
+if(this->m_ptr_glProgramUniform1uiEXT){this->m_orig_glProgramUniform1uiEXT = this->m_ptr_glProgramUniform1uiEXT;this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&ValidationTableDecorator::m_glProgramUniform1uiEXT_validation;}
+if(this->m_ptr_glBindBufferRange){this->m_orig_glBindBufferRange = this->m_ptr_glBindBufferRange;this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&ValidationTableDecorator::m_glBindBufferRange_validation;}
+if(this->m_ptr_glNormal3iv){this->m_orig_glNormal3iv = this->m_ptr_glNormal3iv;this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&ValidationTableDecorator::m_glNormal3iv_validation;}
+if(this->m_ptr_glVertexAttribL3dv){this->m_orig_glVertexAttribL3dv = this->m_ptr_glVertexAttribL3dv;this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&ValidationTableDecorator::m_glVertexAttribL3dv_validation;}
+if(this->m_ptr_glGetUniformdv){this->m_orig_glGetUniformdv = this->m_ptr_glGetUniformdv;this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&ValidationTableDecorator::m_glGetUniformdv_validation;}
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT){this->m_orig_glGetMultiTexLevelParameterfvEXT = this->m_ptr_glGetMultiTexLevelParameterfvEXT;this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexLevelParameterfvEXT_validation;}
+if(this->m_ptr_glFinalCombinerInputNV){this->m_orig_glFinalCombinerInputNV = this->m_ptr_glFinalCombinerInputNV;this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&ValidationTableDecorator::m_glFinalCombinerInputNV_validation;}
+if(this->m_ptr_glCullParameterdvEXT){this->m_orig_glCullParameterdvEXT = this->m_ptr_glCullParameterdvEXT;this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&ValidationTableDecorator::m_glCullParameterdvEXT_validation;}
+if(this->m_ptr_glMultiTexCoord4s){this->m_orig_glMultiTexCoord4s = this->m_ptr_glMultiTexCoord4s;this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&ValidationTableDecorator::m_glMultiTexCoord4s_validation;}
+if(this->m_ptr_glMapVertexAttrib1fAPPLE){this->m_orig_glMapVertexAttrib1fAPPLE = this->m_ptr_glMapVertexAttrib1fAPPLE;this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&ValidationTableDecorator::m_glMapVertexAttrib1fAPPLE_validation;}
+if(this->m_ptr_glConvolutionParameterfEXT){this->m_orig_glConvolutionParameterfEXT = this->m_ptr_glConvolutionParameterfEXT;this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&ValidationTableDecorator::m_glConvolutionParameterfEXT_validation;}
+if(this->m_ptr_glTexCoord1iv){this->m_orig_glTexCoord1iv = this->m_ptr_glTexCoord1iv;this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&ValidationTableDecorator::m_glTexCoord1iv_validation;}
+if(this->m_ptr_glProgramUniform3fvEXT){this->m_orig_glProgramUniform3fvEXT = this->m_ptr_glProgramUniform3fvEXT;this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&ValidationTableDecorator::m_glProgramUniform3fvEXT_validation;}
+if(this->m_ptr_glColor3uiv){this->m_orig_glColor3uiv = this->m_ptr_glColor3uiv;this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&ValidationTableDecorator::m_glColor3uiv_validation;}
+if(this->m_ptr_glRenderGpuMaskNV){this->m_orig_glRenderGpuMaskNV = this->m_ptr_glRenderGpuMaskNV;this->m_ptr_glRenderGpuMaskNV = (FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC)&ValidationTableDecorator::m_glRenderGpuMaskNV_validation;}
+if(this->m_ptr_glListBase){this->m_orig_glListBase = this->m_ptr_glListBase;this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&ValidationTableDecorator::m_glListBase_validation;}
+if(this->m_ptr_glTexCoord2bOES){this->m_orig_glTexCoord2bOES = this->m_ptr_glTexCoord2bOES;this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&ValidationTableDecorator::m_glTexCoord2bOES_validation;}
+if(this->m_ptr_glBindMaterialParameterEXT){this->m_orig_glBindMaterialParameterEXT = this->m_ptr_glBindMaterialParameterEXT;this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&ValidationTableDecorator::m_glBindMaterialParameterEXT_validation;}
+if(this->m_ptr_glGlobalAlphaFactorubSUN){this->m_orig_glGlobalAlphaFactorubSUN = this->m_ptr_glGlobalAlphaFactorubSUN;this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactorubSUN_validation;}
+if(this->m_ptr_glVertexAttribL1ui64NV){this->m_orig_glVertexAttribL1ui64NV = this->m_ptr_glVertexAttribL1ui64NV;this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&ValidationTableDecorator::m_glVertexAttribL1ui64NV_validation;}
+if(this->m_ptr_glPointParameterfSGIS){this->m_orig_glPointParameterfSGIS = this->m_ptr_glPointParameterfSGIS;this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&ValidationTableDecorator::m_glPointParameterfSGIS_validation;}
+if(this->m_ptr_glGetImageTransformParameterivHP){this->m_orig_glGetImageTransformParameterivHP = this->m_ptr_glGetImageTransformParameterivHP;this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&ValidationTableDecorator::m_glGetImageTransformParameterivHP_validation;}
+if(this->m_ptr_glColorSubTableEXT){this->m_orig_glColorSubTableEXT = this->m_ptr_glColorSubTableEXT;this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&ValidationTableDecorator::m_glColorSubTableEXT_validation;}
+if(this->m_ptr_glPixelTexGenParameterfvSGIS){this->m_orig_glPixelTexGenParameterfvSGIS = this->m_ptr_glPixelTexGenParameterfvSGIS;this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&ValidationTableDecorator::m_glPixelTexGenParameterfvSGIS_validation;}
+if(this->m_ptr_glClientWaitSync){this->m_orig_glClientWaitSync = this->m_ptr_glClientWaitSync;this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&ValidationTableDecorator::m_glClientWaitSync_validation;}
+if(this->m_ptr_glQueryObjectParameteruiAMD){this->m_orig_glQueryObjectParameteruiAMD = this->m_ptr_glQueryObjectParameteruiAMD;this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&ValidationTableDecorator::m_glQueryObjectParameteruiAMD_validation;}
+if(this->m_ptr_glVertexAttribs1fvNV){this->m_orig_glVertexAttribs1fvNV = this->m_ptr_glVertexAttribs1fvNV;this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&ValidationTableDecorator::m_glVertexAttribs1fvNV_validation;}
+if(this->m_ptr_glVertexAttrib4NusvARB){this->m_orig_glVertexAttrib4NusvARB = this->m_ptr_glVertexAttrib4NusvARB;this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NusvARB_validation;}
+if(this->m_ptr_glVariantPointerEXT){this->m_orig_glVariantPointerEXT = this->m_ptr_glVariantPointerEXT;this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&ValidationTableDecorator::m_glVariantPointerEXT_validation;}
+if(this->m_ptr_glTextureBuffer){this->m_orig_glTextureBuffer = this->m_ptr_glTextureBuffer;this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&ValidationTableDecorator::m_glTextureBuffer_validation;}
+if(this->m_ptr_glVertexAttribI1uiEXT){this->m_orig_glVertexAttribI1uiEXT = this->m_ptr_glVertexAttribI1uiEXT;this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&ValidationTableDecorator::m_glVertexAttribI1uiEXT_validation;}
+if(this->m_ptr_glInvalidateTexImage){this->m_orig_glInvalidateTexImage = this->m_ptr_glInvalidateTexImage;this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&ValidationTableDecorator::m_glInvalidateTexImage_validation;}
+if(this->m_ptr_glProgramEnvParametersI4ivNV){this->m_orig_glProgramEnvParametersI4ivNV = this->m_ptr_glProgramEnvParametersI4ivNV;this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&ValidationTableDecorator::m_glProgramEnvParametersI4ivNV_validation;}
+if(this->m_ptr_glPathGlyphIndexArrayNV){this->m_orig_glPathGlyphIndexArrayNV = this->m_ptr_glPathGlyphIndexArrayNV;this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&ValidationTableDecorator::m_glPathGlyphIndexArrayNV_validation;}
+if(this->m_ptr_glCopyImageSubData){this->m_orig_glCopyImageSubData = this->m_ptr_glCopyImageSubData;this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&ValidationTableDecorator::m_glCopyImageSubData_validation;}
+if(this->m_ptr_glGetUniformSubroutineuiv){this->m_orig_glGetUniformSubroutineuiv = this->m_ptr_glGetUniformSubroutineuiv;this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&ValidationTableDecorator::m_glGetUniformSubroutineuiv_validation;}
+if(this->m_ptr_glBindVertexBuffer){this->m_orig_glBindVertexBuffer = this->m_ptr_glBindVertexBuffer;this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&ValidationTableDecorator::m_glBindVertexBuffer_validation;}
+if(this->m_ptr_glMultiTexCoord1iARB){this->m_orig_glMultiTexCoord1iARB = this->m_ptr_glMultiTexCoord1iARB;this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1iARB_validation;}
+if(this->m_ptr_glDebugMessageInsert){this->m_orig_glDebugMessageInsert = this->m_ptr_glDebugMessageInsert;this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&ValidationTableDecorator::m_glDebugMessageInsert_validation;}
+if(this->m_ptr_glBeginVertexShaderEXT){this->m_orig_glBeginVertexShaderEXT = this->m_ptr_glBeginVertexShaderEXT;this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&ValidationTableDecorator::m_glBeginVertexShaderEXT_validation;}
+if(this->m_ptr_glIsVariantEnabledEXT){this->m_orig_glIsVariantEnabledEXT = this->m_ptr_glIsVariantEnabledEXT;this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&ValidationTableDecorator::m_glIsVariantEnabledEXT_validation;}
+if(this->m_ptr_glPassThroughxOES){this->m_orig_glPassThroughxOES = this->m_ptr_glPassThroughxOES;this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&ValidationTableDecorator::m_glPassThroughxOES_validation;}
+if(this->m_ptr_glIsSampler){this->m_orig_glIsSampler = this->m_ptr_glIsSampler;this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&ValidationTableDecorator::m_glIsSampler_validation;}
+if(this->m_ptr_glConservativeRasterParameterfNV){this->m_orig_glConservativeRasterParameterfNV = this->m_ptr_glConservativeRasterParameterfNV;this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&ValidationTableDecorator::m_glConservativeRasterParameterfNV_validation;}
+if(this->m_ptr_glMultiTexGenivEXT){this->m_orig_glMultiTexGenivEXT = this->m_ptr_glMultiTexGenivEXT;this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&ValidationTableDecorator::m_glMultiTexGenivEXT_validation;}
+if(this->m_ptr_glNamedFramebufferTexture2DEXT){this->m_orig_glNamedFramebufferTexture2DEXT = this->m_ptr_glNamedFramebufferTexture2DEXT;this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&ValidationTableDecorator::m_glNamedFramebufferTexture2DEXT_validation;}
+if(this->m_ptr_glCopyTexSubImage1D){this->m_orig_glCopyTexSubImage1D = this->m_ptr_glCopyTexSubImage1D;this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&ValidationTableDecorator::m_glCopyTexSubImage1D_validation;}
+if(this->m_ptr_glTexCoord1i){this->m_orig_glTexCoord1i = this->m_ptr_glTexCoord1i;this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&ValidationTableDecorator::m_glTexCoord1i_validation;}
+if(this->m_ptr_glCheckFramebufferStatus){this->m_orig_glCheckFramebufferStatus = this->m_ptr_glCheckFramebufferStatus;this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&ValidationTableDecorator::m_glCheckFramebufferStatus_validation;}
+if(this->m_ptr_glDrawElementArrayAPPLE){this->m_orig_glDrawElementArrayAPPLE = this->m_ptr_glDrawElementArrayAPPLE;this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&ValidationTableDecorator::m_glDrawElementArrayAPPLE_validation;}
+if(this->m_ptr_glTexCoord1d){this->m_orig_glTexCoord1d = this->m_ptr_glTexCoord1d;this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&ValidationTableDecorator::m_glTexCoord1d_validation;}
+if(this->m_ptr_glTexCoord1f){this->m_orig_glTexCoord1f = this->m_ptr_glTexCoord1f;this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&ValidationTableDecorator::m_glTexCoord1f_validation;}
+if(this->m_ptr_glFragmentLightivSGIX){this->m_orig_glFragmentLightivSGIX = this->m_ptr_glFragmentLightivSGIX;this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&ValidationTableDecorator::m_glFragmentLightivSGIX_validation;}
+if(this->m_ptr_glBindImageTexture){this->m_orig_glBindImageTexture = this->m_ptr_glBindImageTexture;this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&ValidationTableDecorator::m_glBindImageTexture_validation;}
+if(this->m_ptr_glTransformFeedbackVaryings){this->m_orig_glTransformFeedbackVaryings = this->m_ptr_glTransformFeedbackVaryings;this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&ValidationTableDecorator::m_glTransformFeedbackVaryings_validation;}
+if(this->m_ptr_glMulticastBufferSubDataNV){this->m_orig_glMulticastBufferSubDataNV = this->m_ptr_glMulticastBufferSubDataNV;this->m_ptr_glMulticastBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC)&ValidationTableDecorator::m_glMulticastBufferSubDataNV_validation;}
+if(this->m_ptr_glDrawRangeElements){this->m_orig_glDrawRangeElements = this->m_ptr_glDrawRangeElements;this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&ValidationTableDecorator::m_glDrawRangeElements_validation;}
+if(this->m_ptr_glTexCoord1s){this->m_orig_glTexCoord1s = this->m_ptr_glTexCoord1s;this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&ValidationTableDecorator::m_glTexCoord1s_validation;}
+if(this->m_ptr_glBindBufferBase){this->m_orig_glBindBufferBase = this->m_ptr_glBindBufferBase;this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&ValidationTableDecorator::m_glBindBufferBase_validation;}
+if(this->m_ptr_glColor3bv){this->m_orig_glColor3bv = this->m_ptr_glColor3bv;this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&ValidationTableDecorator::m_glColor3bv_validation;}
+if(this->m_ptr_glSyncTextureINTEL){this->m_orig_glSyncTextureINTEL = this->m_ptr_glSyncTextureINTEL;this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&ValidationTableDecorator::m_glSyncTextureINTEL_validation;}
+if(this->m_ptr_glCreateSamplers){this->m_orig_glCreateSamplers = this->m_ptr_glCreateSamplers;this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&ValidationTableDecorator::m_glCreateSamplers_validation;}
+if(this->m_ptr_glCombinerParameterfNV){this->m_orig_glCombinerParameterfNV = this->m_ptr_glCombinerParameterfNV;this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&ValidationTableDecorator::m_glCombinerParameterfNV_validation;}
+if(this->m_ptr_glGetArrayObjectivATI){this->m_orig_glGetArrayObjectivATI = this->m_ptr_glGetArrayObjectivATI;this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&ValidationTableDecorator::m_glGetArrayObjectivATI_validation;}
+if(this->m_ptr_glMultiDrawArrays){this->m_orig_glMultiDrawArrays = this->m_ptr_glMultiDrawArrays;this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&ValidationTableDecorator::m_glMultiDrawArrays_validation;}
+if(this->m_ptr_glSampleMapATI){this->m_orig_glSampleMapATI = this->m_ptr_glSampleMapATI;this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&ValidationTableDecorator::m_glSampleMapATI_validation;}
+if(this->m_ptr_glProgramUniform2i64ARB){this->m_orig_glProgramUniform2i64ARB = this->m_ptr_glProgramUniform2i64ARB;this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&ValidationTableDecorator::m_glProgramUniform2i64ARB_validation;}
+if(this->m_ptr_glBinormal3ivEXT){this->m_orig_glBinormal3ivEXT = this->m_ptr_glBinormal3ivEXT;this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&ValidationTableDecorator::m_glBinormal3ivEXT_validation;}
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB){this->m_orig_glMultiDrawArraysIndirectCountARB = this->m_ptr_glMultiDrawArraysIndirectCountARB;this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&ValidationTableDecorator::m_glMultiDrawArraysIndirectCountARB_validation;}
+if(this->m_ptr_glTextureStorageMem1DEXT){this->m_orig_glTextureStorageMem1DEXT = this->m_ptr_glTextureStorageMem1DEXT;this->m_ptr_glTextureStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC)&ValidationTableDecorator::m_glTextureStorageMem1DEXT_validation;}
+if(this->m_ptr_glWindowPos2ivMESA){this->m_orig_glWindowPos2ivMESA = this->m_ptr_glWindowPos2ivMESA;this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&ValidationTableDecorator::m_glWindowPos2ivMESA_validation;}
+if(this->m_ptr_glTexCoordP4ui){this->m_orig_glTexCoordP4ui = this->m_ptr_glTexCoordP4ui;this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&ValidationTableDecorator::m_glTexCoordP4ui_validation;}
+if(this->m_ptr_glMultiTexSubImage1DEXT){this->m_orig_glMultiTexSubImage1DEXT = this->m_ptr_glMultiTexSubImage1DEXT;this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glMultiTexSubImage1DEXT_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT){this->m_orig_glProgramUniformMatrix2x3fvEXT = this->m_ptr_glProgramUniformMatrix2x3fvEXT;this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x3fvEXT_validation;}
+if(this->m_ptr_glBufferDataARB){this->m_orig_glBufferDataARB = this->m_ptr_glBufferDataARB;this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&ValidationTableDecorator::m_glBufferDataARB_validation;}
+if(this->m_ptr_glVertexAttribIFormat){this->m_orig_glVertexAttribIFormat = this->m_ptr_glVertexAttribIFormat;this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&ValidationTableDecorator::m_glVertexAttribIFormat_validation;}
+if(this->m_ptr_glCreateFramebuffers){this->m_orig_glCreateFramebuffers = this->m_ptr_glCreateFramebuffers;this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&ValidationTableDecorator::m_glCreateFramebuffers_validation;}
+if(this->m_ptr_glNormalStream3dvATI){this->m_orig_glNormalStream3dvATI = this->m_ptr_glNormalStream3dvATI;this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&ValidationTableDecorator::m_glNormalStream3dvATI_validation;}
+if(this->m_ptr_glClearAccum){this->m_orig_glClearAccum = this->m_ptr_glClearAccum;this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&ValidationTableDecorator::m_glClearAccum_validation;}
+if(this->m_ptr_glUniform3i64vNV){this->m_orig_glUniform3i64vNV = this->m_ptr_glUniform3i64vNV;this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&ValidationTableDecorator::m_glUniform3i64vNV_validation;}
+if(this->m_ptr_glNormal3fVertex3fSUN){this->m_orig_glNormal3fVertex3fSUN = this->m_ptr_glNormal3fVertex3fSUN;this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glUniform2uivEXT){this->m_orig_glUniform2uivEXT = this->m_ptr_glUniform2uivEXT;this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&ValidationTableDecorator::m_glUniform2uivEXT_validation;}
+if(this->m_ptr_glBeginQuery){this->m_orig_glBeginQuery = this->m_ptr_glBeginQuery;this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&ValidationTableDecorator::m_glBeginQuery_validation;}
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV){this->m_orig_glStencilThenCoverStrokePathInstancedNV = this->m_ptr_glStencilThenCoverStrokePathInstancedNV;this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&ValidationTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_validation;}
+if(this->m_ptr_glBindBuffer){this->m_orig_glBindBuffer = this->m_ptr_glBindBuffer;this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&ValidationTableDecorator::m_glBindBuffer_validation;}
+if(this->m_ptr_glMap2d){this->m_orig_glMap2d = this->m_ptr_glMap2d;this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&ValidationTableDecorator::m_glMap2d_validation;}
+if(this->m_ptr_glMap2f){this->m_orig_glMap2f = this->m_ptr_glMap2f;this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&ValidationTableDecorator::m_glMap2f_validation;}
+if(this->m_ptr_glMakeImageHandleResidentNV){this->m_orig_glMakeImageHandleResidentNV = this->m_ptr_glMakeImageHandleResidentNV;this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&ValidationTableDecorator::m_glMakeImageHandleResidentNV_validation;}
+if(this->m_ptr_glUniformMatrix2x4fv){this->m_orig_glUniformMatrix2x4fv = this->m_ptr_glUniformMatrix2x4fv;this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&ValidationTableDecorator::m_glUniformMatrix2x4fv_validation;}
+if(this->m_ptr_glGetMultiTexParameterfvEXT){this->m_orig_glGetMultiTexParameterfvEXT = this->m_ptr_glGetMultiTexParameterfvEXT;this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexParameterfvEXT_validation;}
+if(this->m_ptr_glDepthRangeIndexed){this->m_orig_glDepthRangeIndexed = this->m_ptr_glDepthRangeIndexed;this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&ValidationTableDecorator::m_glDepthRangeIndexed_validation;}
+if(this->m_ptr_glIsEnabled){this->m_orig_glIsEnabled = this->m_ptr_glIsEnabled;this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&ValidationTableDecorator::m_glIsEnabled_validation;}
+if(this->m_ptr_glMatrixScalefEXT){this->m_orig_glMatrixScalefEXT = this->m_ptr_glMatrixScalefEXT;this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&ValidationTableDecorator::m_glMatrixScalefEXT_validation;}
+if(this->m_ptr_glGetTexEnviv){this->m_orig_glGetTexEnviv = this->m_ptr_glGetTexEnviv;this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&ValidationTableDecorator::m_glGetTexEnviv_validation;}
+if(this->m_ptr_glBindTextureUnitParameterEXT){this->m_orig_glBindTextureUnitParameterEXT = this->m_ptr_glBindTextureUnitParameterEXT;this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&ValidationTableDecorator::m_glBindTextureUnitParameterEXT_validation;}
+if(this->m_ptr_glGetnUniformfvARB){this->m_orig_glGetnUniformfvARB = this->m_ptr_glGetnUniformfvARB;this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&ValidationTableDecorator::m_glGetnUniformfvARB_validation;}
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glDeletePerfQueryINTEL){this->m_orig_glDeletePerfQueryINTEL = this->m_ptr_glDeletePerfQueryINTEL;this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&ValidationTableDecorator::m_glDeletePerfQueryINTEL_validation;}
+if(this->m_ptr_glActiveVaryingNV){this->m_orig_glActiveVaryingNV = this->m_ptr_glActiveVaryingNV;this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&ValidationTableDecorator::m_glActiveVaryingNV_validation;}
+if(this->m_ptr_glGetActiveUniformARB){this->m_orig_glGetActiveUniformARB = this->m_ptr_glGetActiveUniformARB;this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&ValidationTableDecorator::m_glGetActiveUniformARB_validation;}
+if(this->m_ptr_glVertexAttribI3ivEXT){this->m_orig_glVertexAttribI3ivEXT = this->m_ptr_glVertexAttribI3ivEXT;this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI3ivEXT_validation;}
+if(this->m_ptr_glEvalCoord1d){this->m_orig_glEvalCoord1d = this->m_ptr_glEvalCoord1d;this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&ValidationTableDecorator::m_glEvalCoord1d_validation;}
+if(this->m_ptr_glNamedCopyBufferSubDataEXT){this->m_orig_glNamedCopyBufferSubDataEXT = this->m_ptr_glNamedCopyBufferSubDataEXT;this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&ValidationTableDecorator::m_glNamedCopyBufferSubDataEXT_validation;}
+if(this->m_ptr_glEvalCoord1f){this->m_orig_glEvalCoord1f = this->m_ptr_glEvalCoord1f;this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&ValidationTableDecorator::m_glEvalCoord1f_validation;}
+if(this->m_ptr_glPixelMapfv){this->m_orig_glPixelMapfv = this->m_ptr_glPixelMapfv;this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&ValidationTableDecorator::m_glPixelMapfv_validation;}
+if(this->m_ptr_glVertexAttribI1ivEXT){this->m_orig_glVertexAttribI1ivEXT = this->m_ptr_glVertexAttribI1ivEXT;this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI1ivEXT_validation;}
+if(this->m_ptr_glCreateSyncFromCLeventARB){this->m_orig_glCreateSyncFromCLeventARB = this->m_ptr_glCreateSyncFromCLeventARB;this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&ValidationTableDecorator::m_glCreateSyncFromCLeventARB_validation;}
+if(this->m_ptr_glGetPixelMapusv){this->m_orig_glGetPixelMapusv = this->m_ptr_glGetPixelMapusv;this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&ValidationTableDecorator::m_glGetPixelMapusv_validation;}
+if(this->m_ptr_glGetnColorTableARB){this->m_orig_glGetnColorTableARB = this->m_ptr_glGetnColorTableARB;this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&ValidationTableDecorator::m_glGetnColorTableARB_validation;}
+if(this->m_ptr_glAccum){this->m_orig_glAccum = this->m_ptr_glAccum;this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&ValidationTableDecorator::m_glAccum_validation;}
+if(this->m_ptr_glRasterPos3sv){this->m_orig_glRasterPos3sv = this->m_ptr_glRasterPos3sv;this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&ValidationTableDecorator::m_glRasterPos3sv_validation;}
+if(this->m_ptr_glTexCoord2iv){this->m_orig_glTexCoord2iv = this->m_ptr_glTexCoord2iv;this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&ValidationTableDecorator::m_glTexCoord2iv_validation;}
+if(this->m_ptr_glBlendFunciARB){this->m_orig_glBlendFunciARB = this->m_ptr_glBlendFunciARB;this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&ValidationTableDecorator::m_glBlendFunciARB_validation;}
+if(this->m_ptr_glProgramUniform3i64vARB){this->m_orig_glProgramUniform3i64vARB = this->m_ptr_glProgramUniform3i64vARB;this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&ValidationTableDecorator::m_glProgramUniform3i64vARB_validation;}
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv){this->m_orig_glGetFramebufferAttachmentParameteriv = this->m_ptr_glGetFramebufferAttachmentParameteriv;this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ValidationTableDecorator::m_glGetFramebufferAttachmentParameteriv_validation;}
+if(this->m_ptr_glProgramUniform4ui){this->m_orig_glProgramUniform4ui = this->m_ptr_glProgramUniform4ui;this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&ValidationTableDecorator::m_glProgramUniform4ui_validation;}
+if(this->m_ptr_glStencilMask){this->m_orig_glStencilMask = this->m_ptr_glStencilMask;this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&ValidationTableDecorator::m_glStencilMask_validation;}
+if(this->m_ptr_glResetHistogramEXT){this->m_orig_glResetHistogramEXT = this->m_ptr_glResetHistogramEXT;this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&ValidationTableDecorator::m_glResetHistogramEXT_validation;}
+if(this->m_ptr_glLightxOES){this->m_orig_glLightxOES = this->m_ptr_glLightxOES;this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&ValidationTableDecorator::m_glLightxOES_validation;}
+if(this->m_ptr_glNamedBufferData){this->m_orig_glNamedBufferData = this->m_ptr_glNamedBufferData;this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&ValidationTableDecorator::m_glNamedBufferData_validation;}
+if(this->m_ptr_glVertexStream3sATI){this->m_orig_glVertexStream3sATI = this->m_ptr_glVertexStream3sATI;this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&ValidationTableDecorator::m_glVertexStream3sATI_validation;}
+if(this->m_ptr_glVertexAttrib3fvARB){this->m_orig_glVertexAttrib3fvARB = this->m_ptr_glVertexAttrib3fvARB;this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&ValidationTableDecorator::m_glVertexAttrib3fvARB_validation;}
+if(this->m_ptr_glClearNamedBufferSubData){this->m_orig_glClearNamedBufferSubData = this->m_ptr_glClearNamedBufferSubData;this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glClearNamedBufferSubData_validation;}
+if(this->m_ptr_glProgramUniformHandleui64ARB){this->m_orig_glProgramUniformHandleui64ARB = this->m_ptr_glProgramUniformHandleui64ARB;this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&ValidationTableDecorator::m_glProgramUniformHandleui64ARB_validation;}
+if(this->m_ptr_glUniform3iARB){this->m_orig_glUniform3iARB = this->m_ptr_glUniform3iARB;this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&ValidationTableDecorator::m_glUniform3iARB_validation;}
+if(this->m_ptr_glCreateProgramObjectARB){this->m_orig_glCreateProgramObjectARB = this->m_ptr_glCreateProgramObjectARB;this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&ValidationTableDecorator::m_glCreateProgramObjectARB_validation;}
+if(this->m_ptr_glMultiTexCoord1dvARB){this->m_orig_glMultiTexCoord1dvARB = this->m_ptr_glMultiTexCoord1dvARB;this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1dvARB_validation;}
+if(this->m_ptr_glGetObjectParameterfvARB){this->m_orig_glGetObjectParameterfvARB = this->m_ptr_glGetObjectParameterfvARB;this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&ValidationTableDecorator::m_glGetObjectParameterfvARB_validation;}
+if(this->m_ptr_glRectsv){this->m_orig_glRectsv = this->m_ptr_glRectsv;this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&ValidationTableDecorator::m_glRectsv_validation;}
+if(this->m_ptr_glMultiTexImage2DEXT){this->m_orig_glMultiTexImage2DEXT = this->m_ptr_glMultiTexImage2DEXT;this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&ValidationTableDecorator::m_glMultiTexImage2DEXT_validation;}
+if(this->m_ptr_glProgramUniform1i64NV){this->m_orig_glProgramUniform1i64NV = this->m_ptr_glProgramUniform1i64NV;this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&ValidationTableDecorator::m_glProgramUniform1i64NV_validation;}
+if(this->m_ptr_glGetObjectBufferivATI){this->m_orig_glGetObjectBufferivATI = this->m_ptr_glGetObjectBufferivATI;this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&ValidationTableDecorator::m_glGetObjectBufferivATI_validation;}
+if(this->m_ptr_glUniform4i64ARB){this->m_orig_glUniform4i64ARB = this->m_ptr_glUniform4i64ARB;this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&ValidationTableDecorator::m_glUniform4i64ARB_validation;}
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN){this->m_orig_glReplacementCodeuiColor4ubVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_validation;}
+if(this->m_ptr_glBlendFuncSeparateINGR){this->m_orig_glBlendFuncSeparateINGR = this->m_ptr_glBlendFuncSeparateINGR;this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&ValidationTableDecorator::m_glBlendFuncSeparateINGR_validation;}
+if(this->m_ptr_glGetVideoCaptureStreamfvNV){this->m_orig_glGetVideoCaptureStreamfvNV = this->m_ptr_glGetVideoCaptureStreamfvNV;this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&ValidationTableDecorator::m_glGetVideoCaptureStreamfvNV_validation;}
+if(this->m_ptr_glVertexAttrib2fARB){this->m_orig_glVertexAttrib2fARB = this->m_ptr_glVertexAttrib2fARB;this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&ValidationTableDecorator::m_glVertexAttrib2fARB_validation;}
+if(this->m_ptr_glGetTexGeniv){this->m_orig_glGetTexGeniv = this->m_ptr_glGetTexGeniv;this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&ValidationTableDecorator::m_glGetTexGeniv_validation;}
+if(this->m_ptr_glPixelStorei){this->m_orig_glPixelStorei = this->m_ptr_glPixelStorei;this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&ValidationTableDecorator::m_glPixelStorei_validation;}
+if(this->m_ptr_glGetCompressedTextureSubImage){this->m_orig_glGetCompressedTextureSubImage = this->m_ptr_glGetCompressedTextureSubImage;this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&ValidationTableDecorator::m_glGetCompressedTextureSubImage_validation;}
+if(this->m_ptr_glCopyImageSubDataNV){this->m_orig_glCopyImageSubDataNV = this->m_ptr_glCopyImageSubDataNV;this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&ValidationTableDecorator::m_glCopyImageSubDataNV_validation;}
+if(this->m_ptr_glActiveShaderProgram){this->m_orig_glActiveShaderProgram = this->m_ptr_glActiveShaderProgram;this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&ValidationTableDecorator::m_glActiveShaderProgram_validation;}
+if(this->m_ptr_glVertexStream1iATI){this->m_orig_glVertexStream1iATI = this->m_ptr_glVertexStream1iATI;this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&ValidationTableDecorator::m_glVertexStream1iATI_validation;}
+if(this->m_ptr_glPatchParameterfv){this->m_orig_glPatchParameterfv = this->m_ptr_glPatchParameterfv;this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&ValidationTableDecorator::m_glPatchParameterfv_validation;}
+if(this->m_ptr_glIsFramebufferEXT){this->m_orig_glIsFramebufferEXT = this->m_ptr_glIsFramebufferEXT;this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&ValidationTableDecorator::m_glIsFramebufferEXT_validation;}
+if(this->m_ptr_glTextureStorage2D){this->m_orig_glTextureStorage2D = this->m_ptr_glTextureStorage2D;this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&ValidationTableDecorator::m_glTextureStorage2D_validation;}
+if(this->m_ptr_glProgramUniform1ui64ARB){this->m_orig_glProgramUniform1ui64ARB = this->m_ptr_glProgramUniform1ui64ARB;this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&ValidationTableDecorator::m_glProgramUniform1ui64ARB_validation;}
+if(this->m_ptr_glTexBufferRange){this->m_orig_glTexBufferRange = this->m_ptr_glTexBufferRange;this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&ValidationTableDecorator::m_glTexBufferRange_validation;}
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS){this->m_orig_glGetPixelTexGenParameterivSGIS = this->m_ptr_glGetPixelTexGenParameterivSGIS;this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&ValidationTableDecorator::m_glGetPixelTexGenParameterivSGIS_validation;}
+if(this->m_ptr_glTextureSubImage3DEXT){this->m_orig_glTextureSubImage3DEXT = this->m_ptr_glTextureSubImage3DEXT;this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glTextureSubImage3DEXT_validation;}
+if(this->m_ptr_glClipControl){this->m_orig_glClipControl = this->m_ptr_glClipControl;this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&ValidationTableDecorator::m_glClipControl_validation;}
+if(this->m_ptr_glGetProgramResourceiv){this->m_orig_glGetProgramResourceiv = this->m_ptr_glGetProgramResourceiv;this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&ValidationTableDecorator::m_glGetProgramResourceiv_validation;}
+if(this->m_ptr_glMultiTexCoordP2uiv){this->m_orig_glMultiTexCoordP2uiv = this->m_ptr_glMultiTexCoordP2uiv;this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&ValidationTableDecorator::m_glMultiTexCoordP2uiv_validation;}
+if(this->m_ptr_glVertexAttribI3ui){this->m_orig_glVertexAttribI3ui = this->m_ptr_glVertexAttribI3ui;this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&ValidationTableDecorator::m_glVertexAttribI3ui_validation;}
+if(this->m_ptr_glSampleMaskSGIS){this->m_orig_glSampleMaskSGIS = this->m_ptr_glSampleMaskSGIS;this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&ValidationTableDecorator::m_glSampleMaskSGIS_validation;}
+if(this->m_ptr_glVertexAttrib4NivARB){this->m_orig_glVertexAttrib4NivARB = this->m_ptr_glVertexAttrib4NivARB;this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NivARB_validation;}
+if(this->m_ptr_glGlobalAlphaFactorfSUN){this->m_orig_glGlobalAlphaFactorfSUN = this->m_ptr_glGlobalAlphaFactorfSUN;this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactorfSUN_validation;}
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD){this->m_orig_glBlendEquationSeparateIndexedAMD = this->m_ptr_glBlendEquationSeparateIndexedAMD;this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&ValidationTableDecorator::m_glBlendEquationSeparateIndexedAMD_validation;}
+if(this->m_ptr_glGetPerfCounterInfoINTEL){this->m_orig_glGetPerfCounterInfoINTEL = this->m_ptr_glGetPerfCounterInfoINTEL;this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&ValidationTableDecorator::m_glGetPerfCounterInfoINTEL_validation;}
+if(this->m_ptr_glDeleteProgramsNV){this->m_orig_glDeleteProgramsNV = this->m_ptr_glDeleteProgramsNV;this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&ValidationTableDecorator::m_glDeleteProgramsNV_validation;}
+if(this->m_ptr_glPixelZoomxOES){this->m_orig_glPixelZoomxOES = this->m_ptr_glPixelZoomxOES;this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&ValidationTableDecorator::m_glPixelZoomxOES_validation;}
+if(this->m_ptr_glGetCombinerOutputParameterivNV){this->m_orig_glGetCombinerOutputParameterivNV = this->m_ptr_glGetCombinerOutputParameterivNV;this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&ValidationTableDecorator::m_glGetCombinerOutputParameterivNV_validation;}
+if(this->m_ptr_glRasterPos2xvOES){this->m_orig_glRasterPos2xvOES = this->m_ptr_glRasterPos2xvOES;this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&ValidationTableDecorator::m_glRasterPos2xvOES_validation;}
+if(this->m_ptr_glGetTexImage){this->m_orig_glGetTexImage = this->m_ptr_glGetTexImage;this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&ValidationTableDecorator::m_glGetTexImage_validation;}
+if(this->m_ptr_glVertexArrayVertexBuffers){this->m_orig_glVertexArrayVertexBuffers = this->m_ptr_glVertexArrayVertexBuffers;this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&ValidationTableDecorator::m_glVertexArrayVertexBuffers_validation;}
+if(this->m_ptr_glUniform1ui64NV){this->m_orig_glUniform1ui64NV = this->m_ptr_glUniform1ui64NV;this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&ValidationTableDecorator::m_glUniform1ui64NV_validation;}
+if(this->m_ptr_glProgramParameteri){this->m_orig_glProgramParameteri = this->m_ptr_glProgramParameteri;this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&ValidationTableDecorator::m_glProgramParameteri_validation;}
+if(this->m_ptr_glNormal3xOES){this->m_orig_glNormal3xOES = this->m_ptr_glNormal3xOES;this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&ValidationTableDecorator::m_glNormal3xOES_validation;}
+if(this->m_ptr_glGetMapfv){this->m_orig_glGetMapfv = this->m_ptr_glGetMapfv;this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&ValidationTableDecorator::m_glGetMapfv_validation;}
+if(this->m_ptr_glVertexStream2dvATI){this->m_orig_glVertexStream2dvATI = this->m_ptr_glVertexStream2dvATI;this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&ValidationTableDecorator::m_glVertexStream2dvATI_validation;}
+if(this->m_ptr_glPathStencilDepthOffsetNV){this->m_orig_glPathStencilDepthOffsetNV = this->m_ptr_glPathStencilDepthOffsetNV;this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&ValidationTableDecorator::m_glPathStencilDepthOffsetNV_validation;}
+if(this->m_ptr_glIsStateNV){this->m_orig_glIsStateNV = this->m_ptr_glIsStateNV;this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&ValidationTableDecorator::m_glIsStateNV_validation;}
+if(this->m_ptr_glGetIntegerui64vNV){this->m_orig_glGetIntegerui64vNV = this->m_ptr_glGetIntegerui64vNV;this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&ValidationTableDecorator::m_glGetIntegerui64vNV_validation;}
+if(this->m_ptr_glGetImageTransformParameterfvHP){this->m_orig_glGetImageTransformParameterfvHP = this->m_ptr_glGetImageTransformParameterfvHP;this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&ValidationTableDecorator::m_glGetImageTransformParameterfvHP_validation;}
+if(this->m_ptr_glRasterPos2fv){this->m_orig_glRasterPos2fv = this->m_ptr_glRasterPos2fv;this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&ValidationTableDecorator::m_glRasterPos2fv_validation;}
+if(this->m_ptr_glVertex3xOES){this->m_orig_glVertex3xOES = this->m_ptr_glVertex3xOES;this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&ValidationTableDecorator::m_glVertex3xOES_validation;}
+if(this->m_ptr_glIsMemoryObjectEXT){this->m_orig_glIsMemoryObjectEXT = this->m_ptr_glIsMemoryObjectEXT;this->m_ptr_glIsMemoryObjectEXT = (FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC)&ValidationTableDecorator::m_glIsMemoryObjectEXT_validation;}
+if(this->m_ptr_glWeightPointerARB){this->m_orig_glWeightPointerARB = this->m_ptr_glWeightPointerARB;this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&ValidationTableDecorator::m_glWeightPointerARB_validation;}
+if(this->m_ptr_glFinishFenceNV){this->m_orig_glFinishFenceNV = this->m_ptr_glFinishFenceNV;this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&ValidationTableDecorator::m_glFinishFenceNV_validation;}
+if(this->m_ptr_glDepthRangexOES){this->m_orig_glDepthRangexOES = this->m_ptr_glDepthRangexOES;this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&ValidationTableDecorator::m_glDepthRangexOES_validation;}
+if(this->m_ptr_glEnableVertexArrayAttribEXT){this->m_orig_glEnableVertexArrayAttribEXT = this->m_ptr_glEnableVertexArrayAttribEXT;this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&ValidationTableDecorator::m_glEnableVertexArrayAttribEXT_validation;}
+if(this->m_ptr_glProgramUniform2uivEXT){this->m_orig_glProgramUniform2uivEXT = this->m_ptr_glProgramUniform2uivEXT;this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&ValidationTableDecorator::m_glProgramUniform2uivEXT_validation;}
+if(this->m_ptr_glGetDoubleIndexedvEXT){this->m_orig_glGetDoubleIndexedvEXT = this->m_ptr_glGetDoubleIndexedvEXT;this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&ValidationTableDecorator::m_glGetDoubleIndexedvEXT_validation;}
+if(this->m_ptr_glWindowPos2fMESA){this->m_orig_glWindowPos2fMESA = this->m_ptr_glWindowPos2fMESA;this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&ValidationTableDecorator::m_glWindowPos2fMESA_validation;}
+if(this->m_ptr_glSecondaryColor3b){this->m_orig_glSecondaryColor3b = this->m_ptr_glSecondaryColor3b;this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&ValidationTableDecorator::m_glSecondaryColor3b_validation;}
+if(this->m_ptr_glCopyConvolutionFilter1DEXT){this->m_orig_glCopyConvolutionFilter1DEXT = this->m_ptr_glCopyConvolutionFilter1DEXT;this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&ValidationTableDecorator::m_glCopyConvolutionFilter1DEXT_validation;}
+if(this->m_ptr_glWindowPos2sv){this->m_orig_glWindowPos2sv = this->m_ptr_glWindowPos2sv;this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&ValidationTableDecorator::m_glWindowPos2sv_validation;}
+if(this->m_ptr_glBindFramebufferEXT){this->m_orig_glBindFramebufferEXT = this->m_ptr_glBindFramebufferEXT;this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&ValidationTableDecorator::m_glBindFramebufferEXT_validation;}
+if(this->m_ptr_glCreateShader){this->m_orig_glCreateShader = this->m_ptr_glCreateShader;this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&ValidationTableDecorator::m_glCreateShader_validation;}
+if(this->m_ptr_glGenPathsNV){this->m_orig_glGenPathsNV = this->m_ptr_glGenPathsNV;this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&ValidationTableDecorator::m_glGenPathsNV_validation;}
+if(this->m_ptr_glGenRenderbuffers){this->m_orig_glGenRenderbuffers = this->m_ptr_glGenRenderbuffers;this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&ValidationTableDecorator::m_glGenRenderbuffers_validation;}
+if(this->m_ptr_glCopyTexSubImage2D){this->m_orig_glCopyTexSubImage2D = this->m_ptr_glCopyTexSubImage2D;this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&ValidationTableDecorator::m_glCopyTexSubImage2D_validation;}
+if(this->m_ptr_glVertexAttrib4ubvARB){this->m_orig_glVertexAttrib4ubvARB = this->m_ptr_glVertexAttrib4ubvARB;this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4ubvARB_validation;}
+if(this->m_ptr_glDrawTextureNV){this->m_orig_glDrawTextureNV = this->m_ptr_glDrawTextureNV;this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&ValidationTableDecorator::m_glDrawTextureNV_validation;}
+if(this->m_ptr_glVertexAttribs1svNV){this->m_orig_glVertexAttribs1svNV = this->m_ptr_glVertexAttribs1svNV;this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&ValidationTableDecorator::m_glVertexAttribs1svNV_validation;}
+if(this->m_ptr_glClearNamedBufferSubDataEXT){this->m_orig_glClearNamedBufferSubDataEXT = this->m_ptr_glClearNamedBufferSubDataEXT;this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&ValidationTableDecorator::m_glClearNamedBufferSubDataEXT_validation;}
+if(this->m_ptr_glBlendFuncSeparate){this->m_orig_glBlendFuncSeparate = this->m_ptr_glBlendFuncSeparate;this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&ValidationTableDecorator::m_glBlendFuncSeparate_validation;}
+if(this->m_ptr_glPointParameterfARB){this->m_orig_glPointParameterfARB = this->m_ptr_glPointParameterfARB;this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&ValidationTableDecorator::m_glPointParameterfARB_validation;}
+if(this->m_ptr_glTexCoord2fv){this->m_orig_glTexCoord2fv = this->m_ptr_glTexCoord2fv;this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&ValidationTableDecorator::m_glTexCoord2fv_validation;}
+if(this->m_ptr_glGetVariantFloatvEXT){this->m_orig_glGetVariantFloatvEXT = this->m_ptr_glGetVariantFloatvEXT;this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&ValidationTableDecorator::m_glGetVariantFloatvEXT_validation;}
+if(this->m_ptr_glVertexP2ui){this->m_orig_glVertexP2ui = this->m_ptr_glVertexP2ui;this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&ValidationTableDecorator::m_glVertexP2ui_validation;}
+if(this->m_ptr_glWindowPos2dMESA){this->m_orig_glWindowPos2dMESA = this->m_ptr_glWindowPos2dMESA;this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&ValidationTableDecorator::m_glWindowPos2dMESA_validation;}
+if(this->m_ptr_glTexCoord4fv){this->m_orig_glTexCoord4fv = this->m_ptr_glTexCoord4fv;this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&ValidationTableDecorator::m_glTexCoord4fv_validation;}
+if(this->m_ptr_glBindFragDataLocationEXT){this->m_orig_glBindFragDataLocationEXT = this->m_ptr_glBindFragDataLocationEXT;this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&ValidationTableDecorator::m_glBindFragDataLocationEXT_validation;}
+if(this->m_ptr_glCompressedTexSubImage1DARB){this->m_orig_glCompressedTexSubImage1DARB = this->m_ptr_glCompressedTexSubImage1DARB;this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&ValidationTableDecorator::m_glCompressedTexSubImage1DARB_validation;}
+if(this->m_ptr_glGetTextureImageEXT){this->m_orig_glGetTextureImageEXT = this->m_ptr_glGetTextureImageEXT;this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&ValidationTableDecorator::m_glGetTextureImageEXT_validation;}
+if(this->m_ptr_glFogCoordd){this->m_orig_glFogCoordd = this->m_ptr_glFogCoordd;this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&ValidationTableDecorator::m_glFogCoordd_validation;}
+if(this->m_ptr_glPointSize){this->m_orig_glPointSize = this->m_ptr_glPointSize;this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&ValidationTableDecorator::m_glPointSize_validation;}
+if(this->m_ptr_glBindTextureUnit){this->m_orig_glBindTextureUnit = this->m_ptr_glBindTextureUnit;this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&ValidationTableDecorator::m_glBindTextureUnit_validation;}
+if(this->m_ptr_glProgramEnvParameterI4uiNV){this->m_orig_glProgramEnvParameterI4uiNV = this->m_ptr_glProgramEnvParameterI4uiNV;this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&ValidationTableDecorator::m_glProgramEnvParameterI4uiNV_validation;}
+if(this->m_ptr_glGetProgramPipelineInfoLog){this->m_orig_glGetProgramPipelineInfoLog = this->m_ptr_glGetProgramPipelineInfoLog;this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&ValidationTableDecorator::m_glGetProgramPipelineInfoLog_validation;}
+if(this->m_ptr_glProgramUniform4i64vARB){this->m_orig_glProgramUniform4i64vARB = this->m_ptr_glProgramUniform4i64vARB;this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&ValidationTableDecorator::m_glProgramUniform4i64vARB_validation;}
+if(this->m_ptr_glVertexAttrib4Nuiv){this->m_orig_glVertexAttrib4Nuiv = this->m_ptr_glVertexAttrib4Nuiv;this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&ValidationTableDecorator::m_glVertexAttrib4Nuiv_validation;}
+if(this->m_ptr_glGetUniformfvARB){this->m_orig_glGetUniformfvARB = this->m_ptr_glGetUniformfvARB;this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&ValidationTableDecorator::m_glGetUniformfvARB_validation;}
+if(this->m_ptr_glWaitSync){this->m_orig_glWaitSync = this->m_ptr_glWaitSync;this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&ValidationTableDecorator::m_glWaitSync_validation;}
+if(this->m_ptr_glUniform3i){this->m_orig_glUniform3i = this->m_ptr_glUniform3i;this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&ValidationTableDecorator::m_glUniform3i_validation;}
+if(this->m_ptr_glBlendEquationSeparatei){this->m_orig_glBlendEquationSeparatei = this->m_ptr_glBlendEquationSeparatei;this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&ValidationTableDecorator::m_glBlendEquationSeparatei_validation;}
+if(this->m_ptr_glVertexAttrib2hvNV){this->m_orig_glVertexAttrib2hvNV = this->m_ptr_glVertexAttrib2hvNV;this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&ValidationTableDecorator::m_glVertexAttrib2hvNV_validation;}
+if(this->m_ptr_glTextureParameterivEXT){this->m_orig_glTextureParameterivEXT = this->m_ptr_glTextureParameterivEXT;this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glTextureParameterivEXT_validation;}
+if(this->m_ptr_glUniform3d){this->m_orig_glUniform3d = this->m_ptr_glUniform3d;this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&ValidationTableDecorator::m_glUniform3d_validation;}
+if(this->m_ptr_glUniform3f){this->m_orig_glUniform3f = this->m_ptr_glUniform3f;this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&ValidationTableDecorator::m_glUniform3f_validation;}
+if(this->m_ptr_glActiveProgramEXT){this->m_orig_glActiveProgramEXT = this->m_ptr_glActiveProgramEXT;this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&ValidationTableDecorator::m_glActiveProgramEXT_validation;}
+if(this->m_ptr_glProgramUniform3uiv){this->m_orig_glProgramUniform3uiv = this->m_ptr_glProgramUniform3uiv;this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&ValidationTableDecorator::m_glProgramUniform3uiv_validation;}
+if(this->m_ptr_glUniform3ui64vARB){this->m_orig_glUniform3ui64vARB = this->m_ptr_glUniform3ui64vARB;this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&ValidationTableDecorator::m_glUniform3ui64vARB_validation;}
+if(this->m_ptr_glProgramUniform1ui64vARB){this->m_orig_glProgramUniform1ui64vARB = this->m_ptr_glProgramUniform1ui64vARB;this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&ValidationTableDecorator::m_glProgramUniform1ui64vARB_validation;}
+if(this->m_ptr_glTextureParameterfEXT){this->m_orig_glTextureParameterfEXT = this->m_ptr_glTextureParameterfEXT;this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&ValidationTableDecorator::m_glTextureParameterfEXT_validation;}
+if(this->m_ptr_glSetFragmentShaderConstantATI){this->m_orig_glSetFragmentShaderConstantATI = this->m_ptr_glSetFragmentShaderConstantATI;this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&ValidationTableDecorator::m_glSetFragmentShaderConstantATI_validation;}
+if(this->m_ptr_glColorSubTable){this->m_orig_glColorSubTable = this->m_ptr_glColorSubTable;this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&ValidationTableDecorator::m_glColorSubTable_validation;}
+if(this->m_ptr_glReplacementCodeuiSUN){this->m_orig_glReplacementCodeuiSUN = this->m_ptr_glReplacementCodeuiSUN;this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiSUN_validation;}
+if(this->m_ptr_glStateCaptureNV){this->m_orig_glStateCaptureNV = this->m_ptr_glStateCaptureNV;this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&ValidationTableDecorator::m_glStateCaptureNV_validation;}
+if(this->m_ptr_glBindAttribLocation){this->m_orig_glBindAttribLocation = this->m_ptr_glBindAttribLocation;this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&ValidationTableDecorator::m_glBindAttribLocation_validation;}
+if(this->m_ptr_glWeightusvARB){this->m_orig_glWeightusvARB = this->m_ptr_glWeightusvARB;this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&ValidationTableDecorator::m_glWeightusvARB_validation;}
+if(this->m_ptr_glGetFragDataIndex){this->m_orig_glGetFragDataIndex = this->m_ptr_glGetFragDataIndex;this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&ValidationTableDecorator::m_glGetFragDataIndex_validation;}
+if(this->m_ptr_glMultiTexCoord2xOES){this->m_orig_glMultiTexCoord2xOES = this->m_ptr_glMultiTexCoord2xOES;this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&ValidationTableDecorator::m_glMultiTexCoord2xOES_validation;}
+if(this->m_ptr_glColor3sv){this->m_orig_glColor3sv = this->m_ptr_glColor3sv;this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&ValidationTableDecorator::m_glColor3sv_validation;}
+if(this->m_ptr_glTexCoord2fVertex3fSUN){this->m_orig_glTexCoord2fVertex3fSUN = this->m_ptr_glTexCoord2fVertex3fSUN;this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glTexCoord2fVertex3fSUN_validation;}
+if(this->m_ptr_glGetMemoryObjectParameterivEXT){this->m_orig_glGetMemoryObjectParameterivEXT = this->m_ptr_glGetMemoryObjectParameterivEXT;this->m_ptr_glGetMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetMemoryObjectParameterivEXT_validation;}
+if(this->m_ptr_glPolygonOffsetEXT){this->m_orig_glPolygonOffsetEXT = this->m_ptr_glPolygonOffsetEXT;this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&ValidationTableDecorator::m_glPolygonOffsetEXT_validation;}
+if(this->m_ptr_glWeightPathsNV){this->m_orig_glWeightPathsNV = this->m_ptr_glWeightPathsNV;this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&ValidationTableDecorator::m_glWeightPathsNV_validation;}
+if(this->m_ptr_glCombinerStageParameterfvNV){this->m_orig_glCombinerStageParameterfvNV = this->m_ptr_glCombinerStageParameterfvNV;this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&ValidationTableDecorator::m_glCombinerStageParameterfvNV_validation;}
+if(this->m_ptr_glPointParameterfEXT){this->m_orig_glPointParameterfEXT = this->m_ptr_glPointParameterfEXT;this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&ValidationTableDecorator::m_glPointParameterfEXT_validation;}
+if(this->m_ptr_glCopyTexImage1DEXT){this->m_orig_glCopyTexImage1DEXT = this->m_ptr_glCopyTexImage1DEXT;this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCopyTexImage1DEXT_validation;}
+if(this->m_ptr_glVertex4sv){this->m_orig_glVertex4sv = this->m_ptr_glVertex4sv;this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&ValidationTableDecorator::m_glVertex4sv_validation;}
+if(this->m_ptr_glMatrixMultfEXT){this->m_orig_glMatrixMultfEXT = this->m_ptr_glMatrixMultfEXT;this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&ValidationTableDecorator::m_glMatrixMultfEXT_validation;}
+if(this->m_ptr_glCompressedTextureSubImage3DEXT){this->m_orig_glCompressedTextureSubImage3DEXT = this->m_ptr_glCompressedTextureSubImage3DEXT;this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCompressedTextureSubImage3DEXT_validation;}
+if(this->m_ptr_glGetTexLevelParameterxvOES){this->m_orig_glGetTexLevelParameterxvOES = this->m_ptr_glGetTexLevelParameterxvOES;this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&ValidationTableDecorator::m_glGetTexLevelParameterxvOES_validation;}
+if(this->m_ptr_glVertexAttribL3dvEXT){this->m_orig_glVertexAttribL3dvEXT = this->m_ptr_glVertexAttribL3dvEXT;this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&ValidationTableDecorator::m_glVertexAttribL3dvEXT_validation;}
+if(this->m_ptr_glMultiTexCoordP4ui){this->m_orig_glMultiTexCoordP4ui = this->m_ptr_glMultiTexCoordP4ui;this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&ValidationTableDecorator::m_glMultiTexCoordP4ui_validation;}
+if(this->m_ptr_glGetTextureLevelParameterivEXT){this->m_orig_glGetTextureLevelParameterivEXT = this->m_ptr_glGetTextureLevelParameterivEXT;this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetTextureLevelParameterivEXT_validation;}
+if(this->m_ptr_glAlphaFragmentOp2ATI){this->m_orig_glAlphaFragmentOp2ATI = this->m_ptr_glAlphaFragmentOp2ATI;this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&ValidationTableDecorator::m_glAlphaFragmentOp2ATI_validation;}
+if(this->m_ptr_glDeleteFramebuffers){this->m_orig_glDeleteFramebuffers = this->m_ptr_glDeleteFramebuffers;this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&ValidationTableDecorator::m_glDeleteFramebuffers_validation;}
+if(this->m_ptr_glDrawArrays){this->m_orig_glDrawArrays = this->m_ptr_glDrawArrays;this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&ValidationTableDecorator::m_glDrawArrays_validation;}
+if(this->m_ptr_glGetTransformFeedbackiv){this->m_orig_glGetTransformFeedbackiv = this->m_ptr_glGetTransformFeedbackiv;this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&ValidationTableDecorator::m_glGetTransformFeedbackiv_validation;}
+if(this->m_ptr_glGetnTexImageARB){this->m_orig_glGetnTexImageARB = this->m_ptr_glGetnTexImageARB;this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&ValidationTableDecorator::m_glGetnTexImageARB_validation;}
+if(this->m_ptr_glClear){this->m_orig_glClear = this->m_ptr_glClear;this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&ValidationTableDecorator::m_glClear_validation;}
+if(this->m_ptr_glVertexArrayParameteriAPPLE){this->m_orig_glVertexArrayParameteriAPPLE = this->m_ptr_glVertexArrayParameteriAPPLE;this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&ValidationTableDecorator::m_glVertexArrayParameteriAPPLE_validation;}
+if(this->m_ptr_glMultiTexCoord2dvARB){this->m_orig_glMultiTexCoord2dvARB = this->m_ptr_glMultiTexCoord2dvARB;this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2dvARB_validation;}
+if(this->m_ptr_glGetVideoCaptureStreamdvNV){this->m_orig_glGetVideoCaptureStreamdvNV = this->m_ptr_glGetVideoCaptureStreamdvNV;this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&ValidationTableDecorator::m_glGetVideoCaptureStreamdvNV_validation;}
+if(this->m_ptr_glFragmentLightModelivSGIX){this->m_orig_glFragmentLightModelivSGIX = this->m_ptr_glFragmentLightModelivSGIX;this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&ValidationTableDecorator::m_glFragmentLightModelivSGIX_validation;}
+if(this->m_ptr_glVertexAttribP2ui){this->m_orig_glVertexAttribP2ui = this->m_ptr_glVertexAttribP2ui;this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&ValidationTableDecorator::m_glVertexAttribP2ui_validation;}
+if(this->m_ptr_glMultiTexCoordPointerEXT){this->m_orig_glMultiTexCoordPointerEXT = this->m_ptr_glMultiTexCoordPointerEXT;this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&ValidationTableDecorator::m_glMultiTexCoordPointerEXT_validation;}
+if(this->m_ptr_glProgramUniform3iEXT){this->m_orig_glProgramUniform3iEXT = this->m_ptr_glProgramUniform3iEXT;this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&ValidationTableDecorator::m_glProgramUniform3iEXT_validation;}
+if(this->m_ptr_glTranslatef){this->m_orig_glTranslatef = this->m_ptr_glTranslatef;this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&ValidationTableDecorator::m_glTranslatef_validation;}
+if(this->m_ptr_glVertexAttrib4Nub){this->m_orig_glVertexAttrib4Nub = this->m_ptr_glVertexAttrib4Nub;this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&ValidationTableDecorator::m_glVertexAttrib4Nub_validation;}
+if(this->m_ptr_glTranslated){this->m_orig_glTranslated = this->m_ptr_glTranslated;this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&ValidationTableDecorator::m_glTranslated_validation;}
+if(this->m_ptr_glSamplerParameterIiv){this->m_orig_glSamplerParameterIiv = this->m_ptr_glSamplerParameterIiv;this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&ValidationTableDecorator::m_glSamplerParameterIiv_validation;}
+if(this->m_ptr_glTexCoord4hNV){this->m_orig_glTexCoord4hNV = this->m_ptr_glTexCoord4hNV;this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&ValidationTableDecorator::m_glTexCoord4hNV_validation;}
+if(this->m_ptr_glDrawElementsIndirect){this->m_orig_glDrawElementsIndirect = this->m_ptr_glDrawElementsIndirect;this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&ValidationTableDecorator::m_glDrawElementsIndirect_validation;}
+if(this->m_ptr_glDeletePerfMonitorsAMD){this->m_orig_glDeletePerfMonitorsAMD = this->m_ptr_glDeletePerfMonitorsAMD;this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&ValidationTableDecorator::m_glDeletePerfMonitorsAMD_validation;}
+if(this->m_ptr_glIsRenderbufferEXT){this->m_orig_glIsRenderbufferEXT = this->m_ptr_glIsRenderbufferEXT;this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&ValidationTableDecorator::m_glIsRenderbufferEXT_validation;}
+if(this->m_ptr_glDrawCommandsNV){this->m_orig_glDrawCommandsNV = this->m_ptr_glDrawCommandsNV;this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&ValidationTableDecorator::m_glDrawCommandsNV_validation;}
+if(this->m_ptr_glUniform3ivARB){this->m_orig_glUniform3ivARB = this->m_ptr_glUniform3ivARB;this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&ValidationTableDecorator::m_glUniform3ivARB_validation;}
+if(this->m_ptr_glBufferSubData){this->m_orig_glBufferSubData = this->m_ptr_glBufferSubData;this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glBufferSubData_validation;}
+if(this->m_ptr_glSecondaryColor3bv){this->m_orig_glSecondaryColor3bv = this->m_ptr_glSecondaryColor3bv;this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&ValidationTableDecorator::m_glSecondaryColor3bv_validation;}
+if(this->m_ptr_glMatrixMultTransposedEXT){this->m_orig_glMatrixMultTransposedEXT = this->m_ptr_glMatrixMultTransposedEXT;this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&ValidationTableDecorator::m_glMatrixMultTransposedEXT_validation;}
+if(this->m_ptr_glRequestResidentProgramsNV){this->m_orig_glRequestResidentProgramsNV = this->m_ptr_glRequestResidentProgramsNV;this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&ValidationTableDecorator::m_glRequestResidentProgramsNV_validation;}
+if(this->m_ptr_glAlphaFragmentOp1ATI){this->m_orig_glAlphaFragmentOp1ATI = this->m_ptr_glAlphaFragmentOp1ATI;this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&ValidationTableDecorator::m_glAlphaFragmentOp1ATI_validation;}
+if(this->m_ptr_glGetQueryObjecti64v){this->m_orig_glGetQueryObjecti64v = this->m_ptr_glGetQueryObjecti64v;this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&ValidationTableDecorator::m_glGetQueryObjecti64v_validation;}
+if(this->m_ptr_glMatrixMult3x3fNV){this->m_orig_glMatrixMult3x3fNV = this->m_ptr_glMatrixMult3x3fNV;this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&ValidationTableDecorator::m_glMatrixMult3x3fNV_validation;}
+if(this->m_ptr_glColorTableParameteriv){this->m_orig_glColorTableParameteriv = this->m_ptr_glColorTableParameteriv;this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&ValidationTableDecorator::m_glColorTableParameteriv_validation;}
+if(this->m_ptr_glPathSubCommandsNV){this->m_orig_glPathSubCommandsNV = this->m_ptr_glPathSubCommandsNV;this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&ValidationTableDecorator::m_glPathSubCommandsNV_validation;}
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV){this->m_orig_glGetFinalCombinerInputParameterivNV = this->m_ptr_glGetFinalCombinerInputParameterivNV;this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&ValidationTableDecorator::m_glGetFinalCombinerInputParameterivNV_validation;}
+if(this->m_ptr_glIsRenderbuffer){this->m_orig_glIsRenderbuffer = this->m_ptr_glIsRenderbuffer;this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&ValidationTableDecorator::m_glIsRenderbuffer_validation;}
+if(this->m_ptr_glVertex3iv){this->m_orig_glVertex3iv = this->m_ptr_glVertex3iv;this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&ValidationTableDecorator::m_glVertex3iv_validation;}
+if(this->m_ptr_glTexGenfv){this->m_orig_glTexGenfv = this->m_ptr_glTexGenfv;this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&ValidationTableDecorator::m_glTexGenfv_validation;}
+if(this->m_ptr_glFrustumfOES){this->m_orig_glFrustumfOES = this->m_ptr_glFrustumfOES;this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&ValidationTableDecorator::m_glFrustumfOES_validation;}
+if(this->m_ptr_glBindVertexBuffers){this->m_orig_glBindVertexBuffers = this->m_ptr_glBindVertexBuffers;this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&ValidationTableDecorator::m_glBindVertexBuffers_validation;}
+if(this->m_ptr_glMateriali){this->m_orig_glMateriali = this->m_ptr_glMateriali;this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&ValidationTableDecorator::m_glMateriali_validation;}
+if(this->m_ptr_glMultiTexCoord2svARB){this->m_orig_glMultiTexCoord2svARB = this->m_ptr_glMultiTexCoord2svARB;this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2svARB_validation;}
+if(this->m_ptr_glDisableVertexAttribArray){this->m_orig_glDisableVertexAttribArray = this->m_ptr_glDisableVertexAttribArray;this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&ValidationTableDecorator::m_glDisableVertexAttribArray_validation;}
+if(this->m_ptr_glWindowPos3ivARB){this->m_orig_glWindowPos3ivARB = this->m_ptr_glWindowPos3ivARB;this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&ValidationTableDecorator::m_glWindowPos3ivARB_validation;}
+if(this->m_ptr_glTexCoordFormatNV){this->m_orig_glTexCoordFormatNV = this->m_ptr_glTexCoordFormatNV;this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&ValidationTableDecorator::m_glTexCoordFormatNV_validation;}
+if(this->m_ptr_glBlitNamedFramebuffer){this->m_orig_glBlitNamedFramebuffer = this->m_ptr_glBlitNamedFramebuffer;this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&ValidationTableDecorator::m_glBlitNamedFramebuffer_validation;}
+if(this->m_ptr_glMatrixLoadTransposefEXT){this->m_orig_glMatrixLoadTransposefEXT = this->m_ptr_glMatrixLoadTransposefEXT;this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&ValidationTableDecorator::m_glMatrixLoadTransposefEXT_validation;}
+if(this->m_ptr_glMultiTexGenfEXT){this->m_orig_glMultiTexGenfEXT = this->m_ptr_glMultiTexGenfEXT;this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&ValidationTableDecorator::m_glMultiTexGenfEXT_validation;}
+if(this->m_ptr_glShaderStorageBlockBinding){this->m_orig_glShaderStorageBlockBinding = this->m_ptr_glShaderStorageBlockBinding;this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&ValidationTableDecorator::m_glShaderStorageBlockBinding_validation;}
+if(this->m_ptr_glMaterialf){this->m_orig_glMaterialf = this->m_ptr_glMaterialf;this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&ValidationTableDecorator::m_glMaterialf_validation;}
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN){this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT){this->m_orig_glCheckNamedFramebufferStatusEXT = this->m_ptr_glCheckNamedFramebufferStatusEXT;this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&ValidationTableDecorator::m_glCheckNamedFramebufferStatusEXT_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT){this->m_orig_glVertexArrayVertexAttribFormatEXT = this->m_ptr_glVertexArrayVertexAttribFormatEXT;this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribFormatEXT_validation;}
+if(this->m_ptr_glVertex2hNV){this->m_orig_glVertex2hNV = this->m_ptr_glVertex2hNV;this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&ValidationTableDecorator::m_glVertex2hNV_validation;}
+if(this->m_ptr_glDeleteVertexShaderEXT){this->m_orig_glDeleteVertexShaderEXT = this->m_ptr_glDeleteVertexShaderEXT;this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&ValidationTableDecorator::m_glDeleteVertexShaderEXT_validation;}
+if(this->m_ptr_glTexImage3DEXT){this->m_orig_glTexImage3DEXT = this->m_ptr_glTexImage3DEXT;this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&ValidationTableDecorator::m_glTexImage3DEXT_validation;}
+if(this->m_ptr_glSignalVkFenceNV){this->m_orig_glSignalVkFenceNV = this->m_ptr_glSignalVkFenceNV;this->m_ptr_glSignalVkFenceNV = (FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC)&ValidationTableDecorator::m_glSignalVkFenceNV_validation;}
+if(this->m_ptr_glProgramLocalParameterI4ivNV){this->m_orig_glProgramLocalParameterI4ivNV = this->m_ptr_glProgramLocalParameterI4ivNV;this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&ValidationTableDecorator::m_glProgramLocalParameterI4ivNV_validation;}
+if(this->m_ptr_glGlobalAlphaFactoriSUN){this->m_orig_glGlobalAlphaFactoriSUN = this->m_ptr_glGlobalAlphaFactoriSUN;this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactoriSUN_validation;}
+if(this->m_ptr_glTextureStorage1D){this->m_orig_glTextureStorage1D = this->m_ptr_glTextureStorage1D;this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&ValidationTableDecorator::m_glTextureStorage1D_validation;}
+if(this->m_ptr_glBinormal3sEXT){this->m_orig_glBinormal3sEXT = this->m_ptr_glBinormal3sEXT;this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&ValidationTableDecorator::m_glBinormal3sEXT_validation;}
+if(this->m_ptr_glGetProgramInterfaceiv){this->m_orig_glGetProgramInterfaceiv = this->m_ptr_glGetProgramInterfaceiv;this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&ValidationTableDecorator::m_glGetProgramInterfaceiv_validation;}
+if(this->m_ptr_glMatrixIndexPointerARB){this->m_orig_glMatrixIndexPointerARB = this->m_ptr_glMatrixIndexPointerARB;this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&ValidationTableDecorator::m_glMatrixIndexPointerARB_validation;}
+if(this->m_ptr_glTexCoordPointerEXT){this->m_orig_glTexCoordPointerEXT = this->m_ptr_glTexCoordPointerEXT;this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&ValidationTableDecorator::m_glTexCoordPointerEXT_validation;}
+if(this->m_ptr_glMultiTexGeniEXT){this->m_orig_glMultiTexGeniEXT = this->m_ptr_glMultiTexGeniEXT;this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&ValidationTableDecorator::m_glMultiTexGeniEXT_validation;}
+if(this->m_ptr_glVertexAttrib2fNV){this->m_orig_glVertexAttrib2fNV = this->m_ptr_glVertexAttrib2fNV;this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&ValidationTableDecorator::m_glVertexAttrib2fNV_validation;}
+if(this->m_ptr_glNamedProgramStringEXT){this->m_orig_glNamedProgramStringEXT = this->m_ptr_glNamedProgramStringEXT;this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&ValidationTableDecorator::m_glNamedProgramStringEXT_validation;}
+if(this->m_ptr_glMapNamedBuffer){this->m_orig_glMapNamedBuffer = this->m_ptr_glMapNamedBuffer;this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&ValidationTableDecorator::m_glMapNamedBuffer_validation;}
+if(this->m_ptr_glGetMinmaxParameteriv){this->m_orig_glGetMinmaxParameteriv = this->m_ptr_glGetMinmaxParameteriv;this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&ValidationTableDecorator::m_glGetMinmaxParameteriv_validation;}
+if(this->m_ptr_glGetnUniformdv){this->m_orig_glGetnUniformdv = this->m_ptr_glGetnUniformdv;this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&ValidationTableDecorator::m_glGetnUniformdv_validation;}
+if(this->m_ptr_glEndConditionalRenderNVX){this->m_orig_glEndConditionalRenderNVX = this->m_ptr_glEndConditionalRenderNVX;this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&ValidationTableDecorator::m_glEndConditionalRenderNVX_validation;}
+if(this->m_ptr_glBinormal3fEXT){this->m_orig_glBinormal3fEXT = this->m_ptr_glBinormal3fEXT;this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&ValidationTableDecorator::m_glBinormal3fEXT_validation;}
+if(this->m_ptr_glNormalStream3iATI){this->m_orig_glNormalStream3iATI = this->m_ptr_glNormalStream3iATI;this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&ValidationTableDecorator::m_glNormalStream3iATI_validation;}
+if(this->m_ptr_glProgramBufferParametersIivNV){this->m_orig_glProgramBufferParametersIivNV = this->m_ptr_glProgramBufferParametersIivNV;this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&ValidationTableDecorator::m_glProgramBufferParametersIivNV_validation;}
+if(this->m_ptr_glMapGrid1xOES){this->m_orig_glMapGrid1xOES = this->m_ptr_glMapGrid1xOES;this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&ValidationTableDecorator::m_glMapGrid1xOES_validation;}
+if(this->m_ptr_glGetVertexAttribPointervARB){this->m_orig_glGetVertexAttribPointervARB = this->m_ptr_glGetVertexAttribPointervARB;this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&ValidationTableDecorator::m_glGetVertexAttribPointervARB_validation;}
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT){this->m_orig_glFlushMappedNamedBufferRangeEXT = this->m_ptr_glFlushMappedNamedBufferRangeEXT;this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&ValidationTableDecorator::m_glFlushMappedNamedBufferRangeEXT_validation;}
+if(this->m_ptr_glGetVertexAttribIiv){this->m_orig_glGetVertexAttribIiv = this->m_ptr_glGetVertexAttribIiv;this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&ValidationTableDecorator::m_glGetVertexAttribIiv_validation;}
+if(this->m_ptr_glVertexP4uiv){this->m_orig_glVertexP4uiv = this->m_ptr_glVertexP4uiv;this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&ValidationTableDecorator::m_glVertexP4uiv_validation;}
+if(this->m_ptr_glUniformui64NV){this->m_orig_glUniformui64NV = this->m_ptr_glUniformui64NV;this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&ValidationTableDecorator::m_glUniformui64NV_validation;}
+if(this->m_ptr_glColor4fv){this->m_orig_glColor4fv = this->m_ptr_glColor4fv;this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&ValidationTableDecorator::m_glColor4fv_validation;}
+if(this->m_ptr_glTexParameterxvOES){this->m_orig_glTexParameterxvOES = this->m_ptr_glTexParameterxvOES;this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&ValidationTableDecorator::m_glTexParameterxvOES_validation;}
+if(this->m_ptr_glPatchParameteri){this->m_orig_glPatchParameteri = this->m_ptr_glPatchParameteri;this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&ValidationTableDecorator::m_glPatchParameteri_validation;}
+if(this->m_ptr_glMap1d){this->m_orig_glMap1d = this->m_ptr_glMap1d;this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&ValidationTableDecorator::m_glMap1d_validation;}
+if(this->m_ptr_glGetTexFilterFuncSGIS){this->m_orig_glGetTexFilterFuncSGIS = this->m_ptr_glGetTexFilterFuncSGIS;this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&ValidationTableDecorator::m_glGetTexFilterFuncSGIS_validation;}
+if(this->m_ptr_glVertexStream3dATI){this->m_orig_glVertexStream3dATI = this->m_ptr_glVertexStream3dATI;this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&ValidationTableDecorator::m_glVertexStream3dATI_validation;}
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT){this->m_orig_glVertexArrayVertexBindingDivisorEXT = this->m_ptr_glVertexArrayVertexBindingDivisorEXT;this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3svARB){this->m_orig_glMultiTexCoord3svARB = this->m_ptr_glMultiTexCoord3svARB;this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3svARB_validation;}
+if(this->m_ptr_glBindProgramNV){this->m_orig_glBindProgramNV = this->m_ptr_glBindProgramNV;this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&ValidationTableDecorator::m_glBindProgramNV_validation;}
+if(this->m_ptr_glGetConvolutionParameteriv){this->m_orig_glGetConvolutionParameteriv = this->m_ptr_glGetConvolutionParameteriv;this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&ValidationTableDecorator::m_glGetConvolutionParameteriv_validation;}
+if(this->m_ptr_glGetProgramLocalParameterfvARB){this->m_orig_glGetProgramLocalParameterfvARB = this->m_ptr_glGetProgramLocalParameterfvARB;this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&ValidationTableDecorator::m_glGetProgramLocalParameterfvARB_validation;}
+if(this->m_ptr_glGenFragmentShadersATI){this->m_orig_glGenFragmentShadersATI = this->m_ptr_glGenFragmentShadersATI;this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&ValidationTableDecorator::m_glGenFragmentShadersATI_validation;}
+if(this->m_ptr_glTexBumpParameterivATI){this->m_orig_glTexBumpParameterivATI = this->m_ptr_glTexBumpParameterivATI;this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&ValidationTableDecorator::m_glTexBumpParameterivATI_validation;}
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv){this->m_orig_glGetNamedFramebufferAttachmentParameteriv = this->m_ptr_glGetNamedFramebufferAttachmentParameteriv;this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ValidationTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_validation;}
+if(this->m_ptr_glGetnSeparableFilter){this->m_orig_glGetnSeparableFilter = this->m_ptr_glGetnSeparableFilter;this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&ValidationTableDecorator::m_glGetnSeparableFilter_validation;}
+if(this->m_ptr_glNormal3xvOES){this->m_orig_glNormal3xvOES = this->m_ptr_glNormal3xvOES;this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&ValidationTableDecorator::m_glNormal3xvOES_validation;}
+if(this->m_ptr_glPassTexCoordATI){this->m_orig_glPassTexCoordATI = this->m_ptr_glPassTexCoordATI;this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&ValidationTableDecorator::m_glPassTexCoordATI_validation;}
+if(this->m_ptr_glFramebufferTextureFaceARB){this->m_orig_glFramebufferTextureFaceARB = this->m_ptr_glFramebufferTextureFaceARB;this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&ValidationTableDecorator::m_glFramebufferTextureFaceARB_validation;}
+if(this->m_ptr_glProgramUniform1dv){this->m_orig_glProgramUniform1dv = this->m_ptr_glProgramUniform1dv;this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&ValidationTableDecorator::m_glProgramUniform1dv_validation;}
+if(this->m_ptr_glTextureStorage2DEXT){this->m_orig_glTextureStorage2DEXT = this->m_ptr_glTextureStorage2DEXT;this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&ValidationTableDecorator::m_glTextureStorage2DEXT_validation;}
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT){this->m_orig_glVertexArrayFogCoordOffsetEXT = this->m_ptr_glVertexArrayFogCoordOffsetEXT;this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayFogCoordOffsetEXT_validation;}
+if(this->m_ptr_glDeleteNamedStringARB){this->m_orig_glDeleteNamedStringARB = this->m_ptr_glDeleteNamedStringARB;this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&ValidationTableDecorator::m_glDeleteNamedStringARB_validation;}
+if(this->m_ptr_glMulticastGetQueryObjecti64vNV){this->m_orig_glMulticastGetQueryObjecti64vNV = this->m_ptr_glMulticastGetQueryObjecti64vNV;this->m_ptr_glMulticastGetQueryObjecti64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)&ValidationTableDecorator::m_glMulticastGetQueryObjecti64vNV_validation;}
+if(this->m_ptr_glGenOcclusionQueriesNV){this->m_orig_glGenOcclusionQueriesNV = this->m_ptr_glGenOcclusionQueriesNV;this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&ValidationTableDecorator::m_glGenOcclusionQueriesNV_validation;}
+if(this->m_ptr_glLighti){this->m_orig_glLighti = this->m_ptr_glLighti;this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&ValidationTableDecorator::m_glLighti_validation;}
+if(this->m_ptr_glTexImage1D){this->m_orig_glTexImage1D = this->m_ptr_glTexImage1D;this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&ValidationTableDecorator::m_glTexImage1D_validation;}
+if(this->m_ptr_glLightf){this->m_orig_glLightf = this->m_ptr_glLightf;this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&ValidationTableDecorator::m_glLightf_validation;}
+if(this->m_ptr_glClientAttribDefaultEXT){this->m_orig_glClientAttribDefaultEXT = this->m_ptr_glClientAttribDefaultEXT;this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&ValidationTableDecorator::m_glClientAttribDefaultEXT_validation;}
+if(this->m_ptr_glVertexAttrib4bvARB){this->m_orig_glVertexAttrib4bvARB = this->m_ptr_glVertexAttrib4bvARB;this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4bvARB_validation;}
+if(this->m_ptr_glVertexAttribIFormatNV){this->m_orig_glVertexAttribIFormatNV = this->m_ptr_glVertexAttribIFormatNV;this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&ValidationTableDecorator::m_glVertexAttribIFormatNV_validation;}
+if(this->m_ptr_glStencilFuncSeparate){this->m_orig_glStencilFuncSeparate = this->m_ptr_glStencilFuncSeparate;this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&ValidationTableDecorator::m_glStencilFuncSeparate_validation;}
+if(this->m_ptr_glGetVertexAttribfvARB){this->m_orig_glGetVertexAttribfvARB = this->m_ptr_glGetVertexAttribfvARB;this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&ValidationTableDecorator::m_glGetVertexAttribfvARB_validation;}
+if(this->m_ptr_glVertexAttrib2dNV){this->m_orig_glVertexAttrib2dNV = this->m_ptr_glVertexAttrib2dNV;this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&ValidationTableDecorator::m_glVertexAttrib2dNV_validation;}
+if(this->m_ptr_glProgramUniform2iEXT){this->m_orig_glProgramUniform2iEXT = this->m_ptr_glProgramUniform2iEXT;this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&ValidationTableDecorator::m_glProgramUniform2iEXT_validation;}
+if(this->m_ptr_glClientActiveVertexStreamATI){this->m_orig_glClientActiveVertexStreamATI = this->m_ptr_glClientActiveVertexStreamATI;this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&ValidationTableDecorator::m_glClientActiveVertexStreamATI_validation;}
+if(this->m_ptr_glRasterPos3xOES){this->m_orig_glRasterPos3xOES = this->m_ptr_glRasterPos3xOES;this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&ValidationTableDecorator::m_glRasterPos3xOES_validation;}
+if(this->m_ptr_glGetMapParameterivNV){this->m_orig_glGetMapParameterivNV = this->m_ptr_glGetMapParameterivNV;this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&ValidationTableDecorator::m_glGetMapParameterivNV_validation;}
+if(this->m_ptr_glSampleCoverage){this->m_orig_glSampleCoverage = this->m_ptr_glSampleCoverage;this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&ValidationTableDecorator::m_glSampleCoverage_validation;}
+if(this->m_ptr_glClearDepthxOES){this->m_orig_glClearDepthxOES = this->m_ptr_glClearDepthxOES;this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&ValidationTableDecorator::m_glClearDepthxOES_validation;}
+if(this->m_ptr_glUniformBufferEXT){this->m_orig_glUniformBufferEXT = this->m_ptr_glUniformBufferEXT;this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&ValidationTableDecorator::m_glUniformBufferEXT_validation;}
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN){this->m_orig_glTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN;this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glMulticastGetQueryObjectuivNV){this->m_orig_glMulticastGetQueryObjectuivNV = this->m_ptr_glMulticastGetQueryObjectuivNV;this->m_ptr_glMulticastGetQueryObjectuivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)&ValidationTableDecorator::m_glMulticastGetQueryObjectuivNV_validation;}
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL){this->m_orig_glGetFirstPerfQueryIdINTEL = this->m_ptr_glGetFirstPerfQueryIdINTEL;this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&ValidationTableDecorator::m_glGetFirstPerfQueryIdINTEL_validation;}
+if(this->m_ptr_glUnmapNamedBufferEXT){this->m_orig_glUnmapNamedBufferEXT = this->m_ptr_glUnmapNamedBufferEXT;this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&ValidationTableDecorator::m_glUnmapNamedBufferEXT_validation;}
+if(this->m_ptr_glGetTransformFeedbacki_v){this->m_orig_glGetTransformFeedbacki_v = this->m_ptr_glGetTransformFeedbacki_v;this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&ValidationTableDecorator::m_glGetTransformFeedbacki_v_validation;}
+if(this->m_ptr_glUniform4fvARB){this->m_orig_glUniform4fvARB = this->m_ptr_glUniform4fvARB;this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&ValidationTableDecorator::m_glUniform4fvARB_validation;}
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV){this->m_orig_glRenderbufferStorageMultisampleCoverageNV = this->m_ptr_glRenderbufferStorageMultisampleCoverageNV;this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&ValidationTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_validation;}
+if(this->m_ptr_glGetFloati_vEXT){this->m_orig_glGetFloati_vEXT = this->m_ptr_glGetFloati_vEXT;this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&ValidationTableDecorator::m_glGetFloati_vEXT_validation;}
+if(this->m_ptr_glBindAttribLocationARB){this->m_orig_glBindAttribLocationARB = this->m_ptr_glBindAttribLocationARB;this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&ValidationTableDecorator::m_glBindAttribLocationARB_validation;}
+if(this->m_ptr_glBufferAddressRangeNV){this->m_orig_glBufferAddressRangeNV = this->m_ptr_glBufferAddressRangeNV;this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&ValidationTableDecorator::m_glBufferAddressRangeNV_validation;}
+if(this->m_ptr_glGenProgramsARB){this->m_orig_glGenProgramsARB = this->m_ptr_glGenProgramsARB;this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&ValidationTableDecorator::m_glGenProgramsARB_validation;}
+if(this->m_ptr_glMultiTexEnvivEXT){this->m_orig_glMultiTexEnvivEXT = this->m_ptr_glMultiTexEnvivEXT;this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&ValidationTableDecorator::m_glMultiTexEnvivEXT_validation;}
+if(this->m_ptr_glSecondaryColor3uiEXT){this->m_orig_glSecondaryColor3uiEXT = this->m_ptr_glSecondaryColor3uiEXT;this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3uiEXT_validation;}
+if(this->m_ptr_glCompressedTextureImage2DEXT){this->m_orig_glCompressedTextureImage2DEXT = this->m_ptr_glCompressedTextureImage2DEXT;this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCompressedTextureImage2DEXT_validation;}
+if(this->m_ptr_glUniform2i){this->m_orig_glUniform2i = this->m_ptr_glUniform2i;this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&ValidationTableDecorator::m_glUniform2i_validation;}
+if(this->m_ptr_glCopyTexImage2DEXT){this->m_orig_glCopyTexImage2DEXT = this->m_ptr_glCopyTexImage2DEXT;this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCopyTexImage2DEXT_validation;}
+if(this->m_ptr_glUniform2d){this->m_orig_glUniform2d = this->m_ptr_glUniform2d;this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&ValidationTableDecorator::m_glUniform2d_validation;}
+if(this->m_ptr_glVertexAttribL1d){this->m_orig_glVertexAttribL1d = this->m_ptr_glVertexAttribL1d;this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&ValidationTableDecorator::m_glVertexAttribL1d_validation;}
+if(this->m_ptr_glFramebufferTextureFaceEXT){this->m_orig_glFramebufferTextureFaceEXT = this->m_ptr_glFramebufferTextureFaceEXT;this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&ValidationTableDecorator::m_glFramebufferTextureFaceEXT_validation;}
+if(this->m_ptr_glFramebufferTextureLayer){this->m_orig_glFramebufferTextureLayer = this->m_ptr_glFramebufferTextureLayer;this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&ValidationTableDecorator::m_glFramebufferTextureLayer_validation;}
+if(this->m_ptr_glMultiTexCoord4bvOES){this->m_orig_glMultiTexCoord4bvOES = this->m_ptr_glMultiTexCoord4bvOES;this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord4bvOES_validation;}
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT){this->m_orig_glGetVertexArrayPointeri_vEXT = this->m_ptr_glGetVertexArrayPointeri_vEXT;this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&ValidationTableDecorator::m_glGetVertexArrayPointeri_vEXT_validation;}
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT){this->m_orig_glNamedProgramLocalParameter4dEXT = this->m_ptr_glNamedProgramLocalParameter4dEXT;this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameter4dEXT_validation;}
+if(this->m_ptr_glBinormal3bEXT){this->m_orig_glBinormal3bEXT = this->m_ptr_glBinormal3bEXT;this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&ValidationTableDecorator::m_glBinormal3bEXT_validation;}
+if(this->m_ptr_glConvolutionFilter2DEXT){this->m_orig_glConvolutionFilter2DEXT = this->m_ptr_glConvolutionFilter2DEXT;this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&ValidationTableDecorator::m_glConvolutionFilter2DEXT_validation;}
+if(this->m_ptr_glProgramUniform2fv){this->m_orig_glProgramUniform2fv = this->m_ptr_glProgramUniform2fv;this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&ValidationTableDecorator::m_glProgramUniform2fv_validation;}
+if(this->m_ptr_glColor3fVertex3fSUN){this->m_orig_glColor3fVertex3fSUN = this->m_ptr_glColor3fVertex3fSUN;this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glColor3fVertex3fSUN_validation;}
+if(this->m_ptr_glNormal3fVertex3fvSUN){this->m_orig_glNormal3fVertex3fvSUN = this->m_ptr_glNormal3fVertex3fvSUN;this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT){this->m_orig_glCopyMultiTexSubImage3DEXT = this->m_ptr_glCopyMultiTexSubImage3DEXT;this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCopyMultiTexSubImage3DEXT_validation;}
+if(this->m_ptr_glProgramLocalParameterI4iNV){this->m_orig_glProgramLocalParameterI4iNV = this->m_ptr_glProgramLocalParameterI4iNV;this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&ValidationTableDecorator::m_glProgramLocalParameterI4iNV_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x4dv){this->m_orig_glProgramUniformMatrix2x4dv = this->m_ptr_glProgramUniformMatrix2x4dv;this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x4dv_validation;}
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV){this->m_orig_glPathMemoryGlyphIndexArrayNV = this->m_ptr_glPathMemoryGlyphIndexArrayNV;this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&ValidationTableDecorator::m_glPathMemoryGlyphIndexArrayNV_validation;}
+if(this->m_ptr_glDrawArraysEXT){this->m_orig_glDrawArraysEXT = this->m_ptr_glDrawArraysEXT;this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&ValidationTableDecorator::m_glDrawArraysEXT_validation;}
+if(this->m_ptr_glBlendEquationEXT){this->m_orig_glBlendEquationEXT = this->m_ptr_glBlendEquationEXT;this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&ValidationTableDecorator::m_glBlendEquationEXT_validation;}
+if(this->m_ptr_glStencilOp){this->m_orig_glStencilOp = this->m_ptr_glStencilOp;this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&ValidationTableDecorator::m_glStencilOp_validation;}
+if(this->m_ptr_glCopyTextureSubImage2DEXT){this->m_orig_glCopyTextureSubImage2DEXT = this->m_ptr_glCopyTextureSubImage2DEXT;this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCopyTextureSubImage2DEXT_validation;}
+if(this->m_ptr_glTexEnvf){this->m_orig_glTexEnvf = this->m_ptr_glTexEnvf;this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&ValidationTableDecorator::m_glTexEnvf_validation;}
+if(this->m_ptr_glVertexAttrib2dvNV){this->m_orig_glVertexAttrib2dvNV = this->m_ptr_glVertexAttrib2dvNV;this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&ValidationTableDecorator::m_glVertexAttrib2dvNV_validation;}
+if(this->m_ptr_glGenPerfMonitorsAMD){this->m_orig_glGenPerfMonitorsAMD = this->m_ptr_glGenPerfMonitorsAMD;this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&ValidationTableDecorator::m_glGenPerfMonitorsAMD_validation;}
+if(this->m_ptr_glGetInteger64i_v){this->m_orig_glGetInteger64i_v = this->m_ptr_glGetInteger64i_v;this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&ValidationTableDecorator::m_glGetInteger64i_v_validation;}
+if(this->m_ptr_glGetHistogramParameterfv){this->m_orig_glGetHistogramParameterfv = this->m_ptr_glGetHistogramParameterfv;this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&ValidationTableDecorator::m_glGetHistogramParameterfv_validation;}
+if(this->m_ptr_glVertexFormatNV){this->m_orig_glVertexFormatNV = this->m_ptr_glVertexFormatNV;this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&ValidationTableDecorator::m_glVertexFormatNV_validation;}
+if(this->m_ptr_glBlendFuncIndexedAMD){this->m_orig_glBlendFuncIndexedAMD = this->m_ptr_glBlendFuncIndexedAMD;this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&ValidationTableDecorator::m_glBlendFuncIndexedAMD_validation;}
+if(this->m_ptr_glTexEnvi){this->m_orig_glTexEnvi = this->m_ptr_glTexEnvi;this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&ValidationTableDecorator::m_glTexEnvi_validation;}
+if(this->m_ptr_glMultiTexCoord1iv){this->m_orig_glMultiTexCoord1iv = this->m_ptr_glMultiTexCoord1iv;this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&ValidationTableDecorator::m_glMultiTexCoord1iv_validation;}
+if(this->m_ptr_glIsEnabledi){this->m_orig_glIsEnabledi = this->m_ptr_glIsEnabledi;this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&ValidationTableDecorator::m_glIsEnabledi_validation;}
+if(this->m_ptr_glVertexAttribL2ui64vNV){this->m_orig_glVertexAttribL2ui64vNV = this->m_ptr_glVertexAttribL2ui64vNV;this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL2ui64vNV_validation;}
+if(this->m_ptr_glVertexAttribL4i64NV){this->m_orig_glVertexAttribL4i64NV = this->m_ptr_glVertexAttribL4i64NV;this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&ValidationTableDecorator::m_glVertexAttribL4i64NV_validation;}
+if(this->m_ptr_glMatrixTranslatedEXT){this->m_orig_glMatrixTranslatedEXT = this->m_ptr_glMatrixTranslatedEXT;this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&ValidationTableDecorator::m_glMatrixTranslatedEXT_validation;}
+if(this->m_ptr_glMakeTextureHandleResidentARB){this->m_orig_glMakeTextureHandleResidentARB = this->m_ptr_glMakeTextureHandleResidentARB;this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&ValidationTableDecorator::m_glMakeTextureHandleResidentARB_validation;}
+if(this->m_ptr_glMatrixMultdEXT){this->m_orig_glMatrixMultdEXT = this->m_ptr_glMatrixMultdEXT;this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&ValidationTableDecorator::m_glMatrixMultdEXT_validation;}
+if(this->m_ptr_glBinormal3dvEXT){this->m_orig_glBinormal3dvEXT = this->m_ptr_glBinormal3dvEXT;this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&ValidationTableDecorator::m_glBinormal3dvEXT_validation;}
+if(this->m_ptr_glImportSyncEXT){this->m_orig_glImportSyncEXT = this->m_ptr_glImportSyncEXT;this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&ValidationTableDecorator::m_glImportSyncEXT_validation;}
+if(this->m_ptr_glGetMapiv){this->m_orig_glGetMapiv = this->m_ptr_glGetMapiv;this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&ValidationTableDecorator::m_glGetMapiv_validation;}
+if(this->m_ptr_glImportSemaphoreFdEXT){this->m_orig_glImportSemaphoreFdEXT = this->m_ptr_glImportSemaphoreFdEXT;this->m_ptr_glImportSemaphoreFdEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC)&ValidationTableDecorator::m_glImportSemaphoreFdEXT_validation;}
+if(this->m_ptr_glMultiTexCoord4sv){this->m_orig_glMultiTexCoord4sv = this->m_ptr_glMultiTexCoord4sv;this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&ValidationTableDecorator::m_glMultiTexCoord4sv_validation;}
+if(this->m_ptr_glPNTrianglesiATI){this->m_orig_glPNTrianglesiATI = this->m_ptr_glPNTrianglesiATI;this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&ValidationTableDecorator::m_glPNTrianglesiATI_validation;}
+if(this->m_ptr_glBindVertexArrayAPPLE){this->m_orig_glBindVertexArrayAPPLE = this->m_ptr_glBindVertexArrayAPPLE;this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&ValidationTableDecorator::m_glBindVertexArrayAPPLE_validation;}
+if(this->m_ptr_glObjectPtrLabel){this->m_orig_glObjectPtrLabel = this->m_ptr_glObjectPtrLabel;this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&ValidationTableDecorator::m_glObjectPtrLabel_validation;}
+if(this->m_ptr_glGetDebugMessageLog){this->m_orig_glGetDebugMessageLog = this->m_ptr_glGetDebugMessageLog;this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&ValidationTableDecorator::m_glGetDebugMessageLog_validation;}
+if(this->m_ptr_glTrackMatrixNV){this->m_orig_glTrackMatrixNV = this->m_ptr_glTrackMatrixNV;this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&ValidationTableDecorator::m_glTrackMatrixNV_validation;}
+if(this->m_ptr_glProgramPathFragmentInputGenNV){this->m_orig_glProgramPathFragmentInputGenNV = this->m_ptr_glProgramPathFragmentInputGenNV;this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&ValidationTableDecorator::m_glProgramPathFragmentInputGenNV_validation;}
+if(this->m_ptr_glTangent3ivEXT){this->m_orig_glTangent3ivEXT = this->m_ptr_glTangent3ivEXT;this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&ValidationTableDecorator::m_glTangent3ivEXT_validation;}
+if(this->m_ptr_glGetUniformfv){this->m_orig_glGetUniformfv = this->m_ptr_glGetUniformfv;this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&ValidationTableDecorator::m_glGetUniformfv_validation;}
+if(this->m_ptr_glSecondaryColor3ubv){this->m_orig_glSecondaryColor3ubv = this->m_ptr_glSecondaryColor3ubv;this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&ValidationTableDecorator::m_glSecondaryColor3ubv_validation;}
+if(this->m_ptr_glMakeTextureHandleNonResidentNV){this->m_orig_glMakeTextureHandleNonResidentNV = this->m_ptr_glMakeTextureHandleNonResidentNV;this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&ValidationTableDecorator::m_glMakeTextureHandleNonResidentNV_validation;}
+if(this->m_ptr_glVertexAttribs4ubvNV){this->m_orig_glVertexAttribs4ubvNV = this->m_ptr_glVertexAttribs4ubvNV;this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&ValidationTableDecorator::m_glVertexAttribs4ubvNV_validation;}
+if(this->m_ptr_glClipPlanexOES){this->m_orig_glClipPlanexOES = this->m_ptr_glClipPlanexOES;this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&ValidationTableDecorator::m_glClipPlanexOES_validation;}
+if(this->m_ptr_glMultiTexCoord3iv){this->m_orig_glMultiTexCoord3iv = this->m_ptr_glMultiTexCoord3iv;this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&ValidationTableDecorator::m_glMultiTexCoord3iv_validation;}
+if(this->m_ptr_glGetnPolygonStippleARB){this->m_orig_glGetnPolygonStippleARB = this->m_ptr_glGetnPolygonStippleARB;this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&ValidationTableDecorator::m_glGetnPolygonStippleARB_validation;}
+if(this->m_ptr_glUniform2i64vNV){this->m_orig_glUniform2i64vNV = this->m_ptr_glUniform2i64vNV;this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&ValidationTableDecorator::m_glUniform2i64vNV_validation;}
+if(this->m_ptr_glLightModelf){this->m_orig_glLightModelf = this->m_ptr_glLightModelf;this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&ValidationTableDecorator::m_glLightModelf_validation;}
+if(this->m_ptr_glDeleteMemoryObjectsEXT){this->m_orig_glDeleteMemoryObjectsEXT = this->m_ptr_glDeleteMemoryObjectsEXT;this->m_ptr_glDeleteMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC)&ValidationTableDecorator::m_glDeleteMemoryObjectsEXT_validation;}
+if(this->m_ptr_glMultiTexSubImage2DEXT){this->m_orig_glMultiTexSubImage2DEXT = this->m_ptr_glMultiTexSubImage2DEXT;this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glMultiTexSubImage2DEXT_validation;}
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN){this->m_orig_glReplacementCodeuiColor3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN;this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_validation;}
+if(this->m_ptr_glTangent3dvEXT){this->m_orig_glTangent3dvEXT = this->m_ptr_glTangent3dvEXT;this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&ValidationTableDecorator::m_glTangent3dvEXT_validation;}
+if(this->m_ptr_glLightModeli){this->m_orig_glLightModeli = this->m_ptr_glLightModeli;this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&ValidationTableDecorator::m_glLightModeli_validation;}
+if(this->m_ptr_glVertexWeighthvNV){this->m_orig_glVertexWeighthvNV = this->m_ptr_glVertexWeighthvNV;this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&ValidationTableDecorator::m_glVertexWeighthvNV_validation;}
+if(this->m_ptr_glWindowPos3iv){this->m_orig_glWindowPos3iv = this->m_ptr_glWindowPos3iv;this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&ValidationTableDecorator::m_glWindowPos3iv_validation;}
+if(this->m_ptr_glMultiTexCoordP1uiv){this->m_orig_glMultiTexCoordP1uiv = this->m_ptr_glMultiTexCoordP1uiv;this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&ValidationTableDecorator::m_glMultiTexCoordP1uiv_validation;}
+if(this->m_ptr_glTransformPathNV){this->m_orig_glTransformPathNV = this->m_ptr_glTransformPathNV;this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&ValidationTableDecorator::m_glTransformPathNV_validation;}
+if(this->m_ptr_glProgramNamedParameter4dNV){this->m_orig_glProgramNamedParameter4dNV = this->m_ptr_glProgramNamedParameter4dNV;this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&ValidationTableDecorator::m_glProgramNamedParameter4dNV_validation;}
+if(this->m_ptr_glMultiDrawElementsIndirect){this->m_orig_glMultiDrawElementsIndirect = this->m_ptr_glMultiDrawElementsIndirect;this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&ValidationTableDecorator::m_glMultiDrawElementsIndirect_validation;}
+if(this->m_ptr_glProgramUniform1dEXT){this->m_orig_glProgramUniform1dEXT = this->m_ptr_glProgramUniform1dEXT;this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&ValidationTableDecorator::m_glProgramUniform1dEXT_validation;}
+if(this->m_ptr_glCallLists){this->m_orig_glCallLists = this->m_ptr_glCallLists;this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&ValidationTableDecorator::m_glCallLists_validation;}
+if(this->m_ptr_glNormal3hvNV){this->m_orig_glNormal3hvNV = this->m_ptr_glNormal3hvNV;this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&ValidationTableDecorator::m_glNormal3hvNV_validation;}
+if(this->m_ptr_glGetCombinerOutputParameterfvNV){this->m_orig_glGetCombinerOutputParameterfvNV = this->m_ptr_glGetCombinerOutputParameterfvNV;this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetCombinerOutputParameterfvNV_validation;}
+if(this->m_ptr_glVertexAttrib4sARB){this->m_orig_glVertexAttrib4sARB = this->m_ptr_glVertexAttrib4sARB;this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&ValidationTableDecorator::m_glVertexAttrib4sARB_validation;}
+if(this->m_ptr_glTexCoord3i){this->m_orig_glTexCoord3i = this->m_ptr_glTexCoord3i;this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&ValidationTableDecorator::m_glTexCoord3i_validation;}
+if(this->m_ptr_glVertexAttribI3uiv){this->m_orig_glVertexAttribI3uiv = this->m_ptr_glVertexAttribI3uiv;this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&ValidationTableDecorator::m_glVertexAttribI3uiv_validation;}
+if(this->m_ptr_glPushDebugGroup){this->m_orig_glPushDebugGroup = this->m_ptr_glPushDebugGroup;this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&ValidationTableDecorator::m_glPushDebugGroup_validation;}
+if(this->m_ptr_glTexCoord3f){this->m_orig_glTexCoord3f = this->m_ptr_glTexCoord3f;this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&ValidationTableDecorator::m_glTexCoord3f_validation;}
+if(this->m_ptr_glTexCoord3d){this->m_orig_glTexCoord3d = this->m_ptr_glTexCoord3d;this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&ValidationTableDecorator::m_glTexCoord3d_validation;}
+if(this->m_ptr_glTexCoord2xOES){this->m_orig_glTexCoord2xOES = this->m_ptr_glTexCoord2xOES;this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&ValidationTableDecorator::m_glTexCoord2xOES_validation;}
+if(this->m_ptr_glGetStageIndexNV){this->m_orig_glGetStageIndexNV = this->m_ptr_glGetStageIndexNV;this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&ValidationTableDecorator::m_glGetStageIndexNV_validation;}
+if(this->m_ptr_glProgramUniform4i64vNV){this->m_orig_glProgramUniform4i64vNV = this->m_ptr_glProgramUniform4i64vNV;this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&ValidationTableDecorator::m_glProgramUniform4i64vNV_validation;}
+if(this->m_ptr_glGetNamedBufferPointervEXT){this->m_orig_glGetNamedBufferPointervEXT = this->m_ptr_glGetNamedBufferPointervEXT;this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&ValidationTableDecorator::m_glGetNamedBufferPointervEXT_validation;}
+if(this->m_ptr_glTextureBarrierNV){this->m_orig_glTextureBarrierNV = this->m_ptr_glTextureBarrierNV;this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&ValidationTableDecorator::m_glTextureBarrierNV_validation;}
+if(this->m_ptr_glColor4ubVertex3fvSUN){this->m_orig_glColor4ubVertex3fvSUN = this->m_ptr_glColor4ubVertex3fvSUN;this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glColor4ubVertex3fvSUN_validation;}
+if(this->m_ptr_glGetCommandHeaderNV){this->m_orig_glGetCommandHeaderNV = this->m_ptr_glGetCommandHeaderNV;this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&ValidationTableDecorator::m_glGetCommandHeaderNV_validation;}
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD){this->m_orig_glGetPerfMonitorCounterInfoAMD = this->m_ptr_glGetPerfMonitorCounterInfoAMD;this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&ValidationTableDecorator::m_glGetPerfMonitorCounterInfoAMD_validation;}
+if(this->m_ptr_glVertexAttrib1svARB){this->m_orig_glVertexAttrib1svARB = this->m_ptr_glVertexAttrib1svARB;this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&ValidationTableDecorator::m_glVertexAttrib1svARB_validation;}
+if(this->m_ptr_glCombinerParameteriNV){this->m_orig_glCombinerParameteriNV = this->m_ptr_glCombinerParameteriNV;this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&ValidationTableDecorator::m_glCombinerParameteriNV_validation;}
+if(this->m_ptr_glMatrixMultTransposefEXT){this->m_orig_glMatrixMultTransposefEXT = this->m_ptr_glMatrixMultTransposefEXT;this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&ValidationTableDecorator::m_glMatrixMultTransposefEXT_validation;}
+if(this->m_ptr_glDetailTexFuncSGIS){this->m_orig_glDetailTexFuncSGIS = this->m_ptr_glDetailTexFuncSGIS;this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&ValidationTableDecorator::m_glDetailTexFuncSGIS_validation;}
+if(this->m_ptr_glAreTexturesResident){this->m_orig_glAreTexturesResident = this->m_ptr_glAreTexturesResident;this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&ValidationTableDecorator::m_glAreTexturesResident_validation;}
+if(this->m_ptr_glProgramUniform2d){this->m_orig_glProgramUniform2d = this->m_ptr_glProgramUniform2d;this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&ValidationTableDecorator::m_glProgramUniform2d_validation;}
+if(this->m_ptr_glGetConvolutionParameterfvEXT){this->m_orig_glGetConvolutionParameterfvEXT = this->m_ptr_glGetConvolutionParameterfvEXT;this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetConvolutionParameterfvEXT_validation;}
+if(this->m_ptr_glIndexPointerListIBM){this->m_orig_glIndexPointerListIBM = this->m_ptr_glIndexPointerListIBM;this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glIndexPointerListIBM_validation;}
+if(this->m_ptr_glVertexAttribI4iEXT){this->m_orig_glVertexAttribI4iEXT = this->m_ptr_glVertexAttribI4iEXT;this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4iEXT_validation;}
+if(this->m_ptr_glProgramUniform2f){this->m_orig_glProgramUniform2f = this->m_ptr_glProgramUniform2f;this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&ValidationTableDecorator::m_glProgramUniform2f_validation;}
+if(this->m_ptr_glRasterPos4sv){this->m_orig_glRasterPos4sv = this->m_ptr_glRasterPos4sv;this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&ValidationTableDecorator::m_glRasterPos4sv_validation;}
+if(this->m_ptr_glColor4s){this->m_orig_glColor4s = this->m_ptr_glColor4s;this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&ValidationTableDecorator::m_glColor4s_validation;}
+if(this->m_ptr_glMulticastGetQueryObjectivNV){this->m_orig_glMulticastGetQueryObjectivNV = this->m_ptr_glMulticastGetQueryObjectivNV;this->m_ptr_glMulticastGetQueryObjectivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC)&ValidationTableDecorator::m_glMulticastGetQueryObjectivNV_validation;}
+if(this->m_ptr_glColorFragmentOp3ATI){this->m_orig_glColorFragmentOp3ATI = this->m_ptr_glColorFragmentOp3ATI;this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&ValidationTableDecorator::m_glColorFragmentOp3ATI_validation;}
+if(this->m_ptr_glResizeBuffersMESA){this->m_orig_glResizeBuffersMESA = this->m_ptr_glResizeBuffersMESA;this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&ValidationTableDecorator::m_glResizeBuffersMESA_validation;}
+if(this->m_ptr_glGetMinmaxParameterfv){this->m_orig_glGetMinmaxParameterfv = this->m_ptr_glGetMinmaxParameterfv;this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&ValidationTableDecorator::m_glGetMinmaxParameterfv_validation;}
+if(this->m_ptr_glClientActiveTextureARB){this->m_orig_glClientActiveTextureARB = this->m_ptr_glClientActiveTextureARB;this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&ValidationTableDecorator::m_glClientActiveTextureARB_validation;}
+if(this->m_ptr_glBindVertexArray){this->m_orig_glBindVertexArray = this->m_ptr_glBindVertexArray;this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&ValidationTableDecorator::m_glBindVertexArray_validation;}
+if(this->m_ptr_glColor4b){this->m_orig_glColor4b = this->m_ptr_glColor4b;this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&ValidationTableDecorator::m_glColor4b_validation;}
+if(this->m_ptr_glColor4f){this->m_orig_glColor4f = this->m_ptr_glColor4f;this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&ValidationTableDecorator::m_glColor4f_validation;}
+if(this->m_ptr_glColor4d){this->m_orig_glColor4d = this->m_ptr_glColor4d;this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&ValidationTableDecorator::m_glColor4d_validation;}
+if(this->m_ptr_glColor4i){this->m_orig_glColor4i = this->m_ptr_glColor4i;this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&ValidationTableDecorator::m_glColor4i_validation;}
+if(this->m_ptr_glEdgeFlagFormatNV){this->m_orig_glEdgeFlagFormatNV = this->m_ptr_glEdgeFlagFormatNV;this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&ValidationTableDecorator::m_glEdgeFlagFormatNV_validation;}
+if(this->m_ptr_glNamedBufferSubData){this->m_orig_glNamedBufferSubData = this->m_ptr_glNamedBufferSubData;this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glNamedBufferSubData_validation;}
+if(this->m_ptr_glDrawElementsInstanced){this->m_orig_glDrawElementsInstanced = this->m_ptr_glDrawElementsInstanced;this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&ValidationTableDecorator::m_glDrawElementsInstanced_validation;}
+if(this->m_ptr_glGetMultiTexParameterIivEXT){this->m_orig_glGetMultiTexParameterIivEXT = this->m_ptr_glGetMultiTexParameterIivEXT;this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexParameterIivEXT_validation;}
+if(this->m_ptr_glVertex2dv){this->m_orig_glVertex2dv = this->m_ptr_glVertex2dv;this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&ValidationTableDecorator::m_glVertex2dv_validation;}
+if(this->m_ptr_glDisableVertexArrayAttribEXT){this->m_orig_glDisableVertexArrayAttribEXT = this->m_ptr_glDisableVertexArrayAttribEXT;this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&ValidationTableDecorator::m_glDisableVertexArrayAttribEXT_validation;}
+if(this->m_ptr_glObjectUnpurgeableAPPLE){this->m_orig_glObjectUnpurgeableAPPLE = this->m_ptr_glObjectUnpurgeableAPPLE;this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&ValidationTableDecorator::m_glObjectUnpurgeableAPPLE_validation;}
+if(this->m_ptr_glVertexAttribs2dvNV){this->m_orig_glVertexAttribs2dvNV = this->m_ptr_glVertexAttribs2dvNV;this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&ValidationTableDecorator::m_glVertexAttribs2dvNV_validation;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN){this->m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_validation;}
+if(this->m_ptr_glGetMapParameterfvNV){this->m_orig_glGetMapParameterfvNV = this->m_ptr_glGetMapParameterfvNV;this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetMapParameterfvNV_validation;}
+if(this->m_ptr_glProgramUniform4ivEXT){this->m_orig_glProgramUniform4ivEXT = this->m_ptr_glProgramUniform4ivEXT;this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&ValidationTableDecorator::m_glProgramUniform4ivEXT_validation;}
+if(this->m_ptr_glProgramUniform3ui64vNV){this->m_orig_glProgramUniform3ui64vNV = this->m_ptr_glProgramUniform3ui64vNV;this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&ValidationTableDecorator::m_glProgramUniform3ui64vNV_validation;}
+if(this->m_ptr_glRectfv){this->m_orig_glRectfv = this->m_ptr_glRectfv;this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&ValidationTableDecorator::m_glRectfv_validation;}
+if(this->m_ptr_glTexFilterFuncSGIS){this->m_orig_glTexFilterFuncSGIS = this->m_ptr_glTexFilterFuncSGIS;this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&ValidationTableDecorator::m_glTexFilterFuncSGIS_validation;}
+if(this->m_ptr_glSpriteParameterfvSGIX){this->m_orig_glSpriteParameterfvSGIX = this->m_ptr_glSpriteParameterfvSGIX;this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&ValidationTableDecorator::m_glSpriteParameterfvSGIX_validation;}
+if(this->m_ptr_glCopyMultiTexImage1DEXT){this->m_orig_glCopyMultiTexImage1DEXT = this->m_ptr_glCopyMultiTexImage1DEXT;this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCopyMultiTexImage1DEXT_validation;}
+if(this->m_ptr_glGetVertexAttribIuivEXT){this->m_orig_glGetVertexAttribIuivEXT = this->m_ptr_glGetVertexAttribIuivEXT;this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&ValidationTableDecorator::m_glGetVertexAttribIuivEXT_validation;}
+if(this->m_ptr_glUniformMatrix2x4dv){this->m_orig_glUniformMatrix2x4dv = this->m_ptr_glUniformMatrix2x4dv;this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&ValidationTableDecorator::m_glUniformMatrix2x4dv_validation;}
+if(this->m_ptr_glGetProgramResourceLocationIndex){this->m_orig_glGetProgramResourceLocationIndex = this->m_ptr_glGetProgramResourceLocationIndex;this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&ValidationTableDecorator::m_glGetProgramResourceLocationIndex_validation;}
+if(this->m_ptr_glColor3hNV){this->m_orig_glColor3hNV = this->m_ptr_glColor3hNV;this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&ValidationTableDecorator::m_glColor3hNV_validation;}
+if(this->m_ptr_glViewport){this->m_orig_glViewport = this->m_ptr_glViewport;this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&ValidationTableDecorator::m_glViewport_validation;}
+if(this->m_ptr_glProgramNamedParameter4fNV){this->m_orig_glProgramNamedParameter4fNV = this->m_ptr_glProgramNamedParameter4fNV;this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&ValidationTableDecorator::m_glProgramNamedParameter4fNV_validation;}
+if(this->m_ptr_glGetInvariantBooleanvEXT){this->m_orig_glGetInvariantBooleanvEXT = this->m_ptr_glGetInvariantBooleanvEXT;this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&ValidationTableDecorator::m_glGetInvariantBooleanvEXT_validation;}
+if(this->m_ptr_glTexStorage2DMultisample){this->m_orig_glTexStorage2DMultisample = this->m_ptr_glTexStorage2DMultisample;this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&ValidationTableDecorator::m_glTexStorage2DMultisample_validation;}
+if(this->m_ptr_glPixelStorex){this->m_orig_glPixelStorex = this->m_ptr_glPixelStorex;this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&ValidationTableDecorator::m_glPixelStorex_validation;}
+if(this->m_ptr_glVertexAttribL1dvEXT){this->m_orig_glVertexAttribL1dvEXT = this->m_ptr_glVertexAttribL1dvEXT;this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&ValidationTableDecorator::m_glVertexAttribL1dvEXT_validation;}
+if(this->m_ptr_glGetActiveSubroutineUniformiv){this->m_orig_glGetActiveSubroutineUniformiv = this->m_ptr_glGetActiveSubroutineUniformiv;this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&ValidationTableDecorator::m_glGetActiveSubroutineUniformiv_validation;}
+if(this->m_ptr_glVertexAttribPointerARB){this->m_orig_glVertexAttribPointerARB = this->m_ptr_glVertexAttribPointerARB;this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&ValidationTableDecorator::m_glVertexAttribPointerARB_validation;}
+if(this->m_ptr_glCompressedTexSubImage2DARB){this->m_orig_glCompressedTexSubImage2DARB = this->m_ptr_glCompressedTexSubImage2DARB;this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&ValidationTableDecorator::m_glCompressedTexSubImage2DARB_validation;}
+if(this->m_ptr_glTexStorageMem1DEXT){this->m_orig_glTexStorageMem1DEXT = this->m_ptr_glTexStorageMem1DEXT;this->m_ptr_glTexStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC)&ValidationTableDecorator::m_glTexStorageMem1DEXT_validation;}
+if(this->m_ptr_glVertex2hvNV){this->m_orig_glVertex2hvNV = this->m_ptr_glVertex2hvNV;this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&ValidationTableDecorator::m_glVertex2hvNV_validation;}
+if(this->m_ptr_glTexBuffer){this->m_orig_glTexBuffer = this->m_ptr_glTexBuffer;this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&ValidationTableDecorator::m_glTexBuffer_validation;}
+if(this->m_ptr_glArrayElement){this->m_orig_glArrayElement = this->m_ptr_glArrayElement;this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&ValidationTableDecorator::m_glArrayElement_validation;}
+if(this->m_ptr_glValidateProgram){this->m_orig_glValidateProgram = this->m_ptr_glValidateProgram;this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&ValidationTableDecorator::m_glValidateProgram_validation;}
+if(this->m_ptr_glPixelStoref){this->m_orig_glPixelStoref = this->m_ptr_glPixelStoref;this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&ValidationTableDecorator::m_glPixelStoref_validation;}
+if(this->m_ptr_glWindowPos3dARB){this->m_orig_glWindowPos3dARB = this->m_ptr_glWindowPos3dARB;this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&ValidationTableDecorator::m_glWindowPos3dARB_validation;}
+if(this->m_ptr_glEvalCoord1dv){this->m_orig_glEvalCoord1dv = this->m_ptr_glEvalCoord1dv;this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&ValidationTableDecorator::m_glEvalCoord1dv_validation;}
+if(this->m_ptr_glVertexAttribs2fvNV){this->m_orig_glVertexAttribs2fvNV = this->m_ptr_glVertexAttribs2fvNV;this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&ValidationTableDecorator::m_glVertexAttribs2fvNV_validation;}
+if(this->m_ptr_glRecti){this->m_orig_glRecti = this->m_ptr_glRecti;this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&ValidationTableDecorator::m_glRecti_validation;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glTexCoord1bOES){this->m_orig_glTexCoord1bOES = this->m_ptr_glTexCoord1bOES;this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&ValidationTableDecorator::m_glTexCoord1bOES_validation;}
+if(this->m_ptr_glProgramUniform2i64vARB){this->m_orig_glProgramUniform2i64vARB = this->m_ptr_glProgramUniform2i64vARB;this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&ValidationTableDecorator::m_glProgramUniform2i64vARB_validation;}
+if(this->m_ptr_glWindowPos2dARB){this->m_orig_glWindowPos2dARB = this->m_ptr_glWindowPos2dARB;this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&ValidationTableDecorator::m_glWindowPos2dARB_validation;}
+if(this->m_ptr_glGetProgramParameterdvNV){this->m_orig_glGetProgramParameterdvNV = this->m_ptr_glGetProgramParameterdvNV;this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&ValidationTableDecorator::m_glGetProgramParameterdvNV_validation;}
+if(this->m_ptr_glRectf){this->m_orig_glRectf = this->m_ptr_glRectf;this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&ValidationTableDecorator::m_glRectf_validation;}
+if(this->m_ptr_glRectd){this->m_orig_glRectd = this->m_ptr_glRectd;this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&ValidationTableDecorator::m_glRectd_validation;}
+if(this->m_ptr_glMap1xOES){this->m_orig_glMap1xOES = this->m_ptr_glMap1xOES;this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&ValidationTableDecorator::m_glMap1xOES_validation;}
+if(this->m_ptr_glVertexAttrib3fvNV){this->m_orig_glVertexAttrib3fvNV = this->m_ptr_glVertexAttrib3fvNV;this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&ValidationTableDecorator::m_glVertexAttrib3fvNV_validation;}
+if(this->m_ptr_glReferencePlaneSGIX){this->m_orig_glReferencePlaneSGIX = this->m_ptr_glReferencePlaneSGIX;this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&ValidationTableDecorator::m_glReferencePlaneSGIX_validation;}
+if(this->m_ptr_glMulticastBlitFramebufferNV){this->m_orig_glMulticastBlitFramebufferNV = this->m_ptr_glMulticastBlitFramebufferNV;this->m_ptr_glMulticastBlitFramebufferNV = (FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC)&ValidationTableDecorator::m_glMulticastBlitFramebufferNV_validation;}
+if(this->m_ptr_glGetCombinerInputParameterfvNV){this->m_orig_glGetCombinerInputParameterfvNV = this->m_ptr_glGetCombinerInputParameterfvNV;this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetCombinerInputParameterfvNV_validation;}
+if(this->m_ptr_glGetTextureSamplerHandleARB){this->m_orig_glGetTextureSamplerHandleARB = this->m_ptr_glGetTextureSamplerHandleARB;this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&ValidationTableDecorator::m_glGetTextureSamplerHandleARB_validation;}
+if(this->m_ptr_glBindTexture){this->m_orig_glBindTexture = this->m_ptr_glBindTexture;this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&ValidationTableDecorator::m_glBindTexture_validation;}
+if(this->m_ptr_glRects){this->m_orig_glRects = this->m_ptr_glRects;this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&ValidationTableDecorator::m_glRects_validation;}
+if(this->m_ptr_glGetActiveAttribARB){this->m_orig_glGetActiveAttribARB = this->m_ptr_glGetActiveAttribARB;this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&ValidationTableDecorator::m_glGetActiveAttribARB_validation;}
+if(this->m_ptr_glHistogramEXT){this->m_orig_glHistogramEXT = this->m_ptr_glHistogramEXT;this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&ValidationTableDecorator::m_glHistogramEXT_validation;}
+if(this->m_ptr_glGetTextureSamplerHandleNV){this->m_orig_glGetTextureSamplerHandleNV = this->m_ptr_glGetTextureSamplerHandleNV;this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&ValidationTableDecorator::m_glGetTextureSamplerHandleNV_validation;}
+if(this->m_ptr_glDetachShader){this->m_orig_glDetachShader = this->m_ptr_glDetachShader;this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&ValidationTableDecorator::m_glDetachShader_validation;}
+if(this->m_ptr_glFinishTextureSUNX){this->m_orig_glFinishTextureSUNX = this->m_ptr_glFinishTextureSUNX;this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&ValidationTableDecorator::m_glFinishTextureSUNX_validation;}
+if(this->m_ptr_glUniformMatrix3x4dv){this->m_orig_glUniformMatrix3x4dv = this->m_ptr_glUniformMatrix3x4dv;this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&ValidationTableDecorator::m_glUniformMatrix3x4dv_validation;}
+if(this->m_ptr_glVertexAttrib4fARB){this->m_orig_glVertexAttrib4fARB = this->m_ptr_glVertexAttrib4fARB;this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&ValidationTableDecorator::m_glVertexAttrib4fARB_validation;}
+if(this->m_ptr_glGetPathColorGenivNV){this->m_orig_glGetPathColorGenivNV = this->m_ptr_glGetPathColorGenivNV;this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&ValidationTableDecorator::m_glGetPathColorGenivNV_validation;}
+if(this->m_ptr_glGetProgramResourceLocation){this->m_orig_glGetProgramResourceLocation = this->m_ptr_glGetProgramResourceLocation;this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&ValidationTableDecorator::m_glGetProgramResourceLocation_validation;}
+if(this->m_ptr_glVertexArrayAttribLFormat){this->m_orig_glVertexArrayAttribLFormat = this->m_ptr_glVertexArrayAttribLFormat;this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&ValidationTableDecorator::m_glVertexArrayAttribLFormat_validation;}
+if(this->m_ptr_glGetTexLevelParameterfv){this->m_orig_glGetTexLevelParameterfv = this->m_ptr_glGetTexLevelParameterfv;this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&ValidationTableDecorator::m_glGetTexLevelParameterfv_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT){this->m_orig_glVertexArrayVertexAttribOffsetEXT = this->m_ptr_glVertexArrayVertexAttribOffsetEXT;this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_validation;}
+if(this->m_ptr_glIndexFormatNV){this->m_orig_glIndexFormatNV = this->m_ptr_glIndexFormatNV;this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&ValidationTableDecorator::m_glIndexFormatNV_validation;}
+if(this->m_ptr_glMultiTexCoord3i){this->m_orig_glMultiTexCoord3i = this->m_ptr_glMultiTexCoord3i;this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&ValidationTableDecorator::m_glMultiTexCoord3i_validation;}
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN){this->m_orig_glReplacementCodeuiVertex3fvSUN = this->m_ptr_glReplacementCodeuiVertex3fvSUN;this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiVertex3fvSUN_validation;}
+if(this->m_ptr_glViewportIndexedfv){this->m_orig_glViewportIndexedfv = this->m_ptr_glViewportIndexedfv;this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&ValidationTableDecorator::m_glViewportIndexedfv_validation;}
+if(this->m_ptr_glBindBuffersBase){this->m_orig_glBindBuffersBase = this->m_ptr_glBindBuffersBase;this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&ValidationTableDecorator::m_glBindBuffersBase_validation;}
+if(this->m_ptr_glTexBumpParameterfvATI){this->m_orig_glTexBumpParameterfvATI = this->m_ptr_glTexBumpParameterfvATI;this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&ValidationTableDecorator::m_glTexBumpParameterfvATI_validation;}
+if(this->m_ptr_glMatrixIndexuivARB){this->m_orig_glMatrixIndexuivARB = this->m_ptr_glMatrixIndexuivARB;this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&ValidationTableDecorator::m_glMatrixIndexuivARB_validation;}
+if(this->m_ptr_glVertexAttrib1hNV){this->m_orig_glVertexAttrib1hNV = this->m_ptr_glVertexAttrib1hNV;this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&ValidationTableDecorator::m_glVertexAttrib1hNV_validation;}
+if(this->m_ptr_glWindowPos3svMESA){this->m_orig_glWindowPos3svMESA = this->m_ptr_glWindowPos3svMESA;this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&ValidationTableDecorator::m_glWindowPos3svMESA_validation;}
+if(this->m_ptr_glStencilOpSeparateATI){this->m_orig_glStencilOpSeparateATI = this->m_ptr_glStencilOpSeparateATI;this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&ValidationTableDecorator::m_glStencilOpSeparateATI_validation;}
+if(this->m_ptr_glDrawElementsBaseVertex){this->m_orig_glDrawElementsBaseVertex = this->m_ptr_glDrawElementsBaseVertex;this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&ValidationTableDecorator::m_glDrawElementsBaseVertex_validation;}
+if(this->m_ptr_glBlendEquationSeparateiARB){this->m_orig_glBlendEquationSeparateiARB = this->m_ptr_glBlendEquationSeparateiARB;this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&ValidationTableDecorator::m_glBlendEquationSeparateiARB_validation;}
+if(this->m_ptr_glVertexAttrib1fNV){this->m_orig_glVertexAttrib1fNV = this->m_ptr_glVertexAttrib1fNV;this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&ValidationTableDecorator::m_glVertexAttrib1fNV_validation;}
+if(this->m_ptr_glMapVertexAttrib2fAPPLE){this->m_orig_glMapVertexAttrib2fAPPLE = this->m_ptr_glMapVertexAttrib2fAPPLE;this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&ValidationTableDecorator::m_glMapVertexAttrib2fAPPLE_validation;}
+if(this->m_ptr_glCompressedTextureSubImage1DEXT){this->m_orig_glCompressedTextureSubImage1DEXT = this->m_ptr_glCompressedTextureSubImage1DEXT;this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCompressedTextureSubImage1DEXT_validation;}
+if(this->m_ptr_glClearBufferSubData){this->m_orig_glClearBufferSubData = this->m_ptr_glClearBufferSubData;this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glClearBufferSubData_validation;}
+if(this->m_ptr_glTexStorage1D){this->m_orig_glTexStorage1D = this->m_ptr_glTexStorage1D;this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&ValidationTableDecorator::m_glTexStorage1D_validation;}
+if(this->m_ptr_glVertexAttribI3iEXT){this->m_orig_glVertexAttribI3iEXT = this->m_ptr_glVertexAttribI3iEXT;this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&ValidationTableDecorator::m_glVertexAttribI3iEXT_validation;}
+if(this->m_ptr_glMakeTextureHandleNonResidentARB){this->m_orig_glMakeTextureHandleNonResidentARB = this->m_ptr_glMakeTextureHandleNonResidentARB;this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&ValidationTableDecorator::m_glMakeTextureHandleNonResidentARB_validation;}
+if(this->m_ptr_glMultiDrawElementArrayAPPLE){this->m_orig_glMultiDrawElementArrayAPPLE = this->m_ptr_glMultiDrawElementArrayAPPLE;this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&ValidationTableDecorator::m_glMultiDrawElementArrayAPPLE_validation;}
+if(this->m_ptr_glVertexStream4dATI){this->m_orig_glVertexStream4dATI = this->m_ptr_glVertexStream4dATI;this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&ValidationTableDecorator::m_glVertexStream4dATI_validation;}
+if(this->m_ptr_glProgramUniformMatrix2dvEXT){this->m_orig_glProgramUniformMatrix2dvEXT = this->m_ptr_glProgramUniformMatrix2dvEXT;this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2dvEXT_validation;}
+if(this->m_ptr_glVertexAttribs2hvNV){this->m_orig_glVertexAttribs2hvNV = this->m_ptr_glVertexAttribs2hvNV;this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&ValidationTableDecorator::m_glVertexAttribs2hvNV_validation;}
+if(this->m_ptr_glGetUniformiv){this->m_orig_glGetUniformiv = this->m_ptr_glGetUniformiv;this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&ValidationTableDecorator::m_glGetUniformiv_validation;}
+if(this->m_ptr_glClipPlanefOES){this->m_orig_glClipPlanefOES = this->m_ptr_glClipPlanefOES;this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&ValidationTableDecorator::m_glClipPlanefOES_validation;}
+if(this->m_ptr_glRenderbufferStorage){this->m_orig_glRenderbufferStorage = this->m_ptr_glRenderbufferStorage;this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&ValidationTableDecorator::m_glRenderbufferStorage_validation;}
+if(this->m_ptr_glUniform4ui){this->m_orig_glUniform4ui = this->m_ptr_glUniform4ui;this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&ValidationTableDecorator::m_glUniform4ui_validation;}
+if(this->m_ptr_glBindFramebuffer){this->m_orig_glBindFramebuffer = this->m_ptr_glBindFramebuffer;this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&ValidationTableDecorator::m_glBindFramebuffer_validation;}
+if(this->m_ptr_glValidateProgramARB){this->m_orig_glValidateProgramARB = this->m_ptr_glValidateProgramARB;this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&ValidationTableDecorator::m_glValidateProgramARB_validation;}
+if(this->m_ptr_glTexGenf){this->m_orig_glTexGenf = this->m_ptr_glTexGenf;this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&ValidationTableDecorator::m_glTexGenf_validation;}
+if(this->m_ptr_glTexGend){this->m_orig_glTexGend = this->m_ptr_glTexGend;this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&ValidationTableDecorator::m_glTexGend_validation;}
+if(this->m_ptr_glTexGeni){this->m_orig_glTexGeni = this->m_ptr_glTexGeni;this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&ValidationTableDecorator::m_glTexGeni_validation;}
+if(this->m_ptr_glDeleteFramebuffersEXT){this->m_orig_glDeleteFramebuffersEXT = this->m_ptr_glDeleteFramebuffersEXT;this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&ValidationTableDecorator::m_glDeleteFramebuffersEXT_validation;}
+if(this->m_ptr_glResetMinmaxEXT){this->m_orig_glResetMinmaxEXT = this->m_ptr_glResetMinmaxEXT;this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&ValidationTableDecorator::m_glResetMinmaxEXT_validation;}
+if(this->m_ptr_glVertexAttrib1fvNV){this->m_orig_glVertexAttrib1fvNV = this->m_ptr_glVertexAttrib1fvNV;this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&ValidationTableDecorator::m_glVertexAttrib1fvNV_validation;}
+if(this->m_ptr_glIsQueryARB){this->m_orig_glIsQueryARB = this->m_ptr_glIsQueryARB;this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&ValidationTableDecorator::m_glIsQueryARB_validation;}
+if(this->m_ptr_glEnableVariantClientStateEXT){this->m_orig_glEnableVariantClientStateEXT = this->m_ptr_glEnableVariantClientStateEXT;this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&ValidationTableDecorator::m_glEnableVariantClientStateEXT_validation;}
+if(this->m_ptr_glScissorIndexed){this->m_orig_glScissorIndexed = this->m_ptr_glScissorIndexed;this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&ValidationTableDecorator::m_glScissorIndexed_validation;}
+if(this->m_ptr_glGetInvariantIntegervEXT){this->m_orig_glGetInvariantIntegervEXT = this->m_ptr_glGetInvariantIntegervEXT;this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&ValidationTableDecorator::m_glGetInvariantIntegervEXT_validation;}
+if(this->m_ptr_glProgramLocalParameterI4uiNV){this->m_orig_glProgramLocalParameterI4uiNV = this->m_ptr_glProgramLocalParameterI4uiNV;this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&ValidationTableDecorator::m_glProgramLocalParameterI4uiNV_validation;}
+if(this->m_ptr_glConvolutionParameterxvOES){this->m_orig_glConvolutionParameterxvOES = this->m_ptr_glConvolutionParameterxvOES;this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&ValidationTableDecorator::m_glConvolutionParameterxvOES_validation;}
+if(this->m_ptr_glGenFramebuffersEXT){this->m_orig_glGenFramebuffersEXT = this->m_ptr_glGenFramebuffersEXT;this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&ValidationTableDecorator::m_glGenFramebuffersEXT_validation;}
+if(this->m_ptr_glVertexArrayColorOffsetEXT){this->m_orig_glVertexArrayColorOffsetEXT = this->m_ptr_glVertexArrayColorOffsetEXT;this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayColorOffsetEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3ivARB){this->m_orig_glMultiTexCoord3ivARB = this->m_ptr_glMultiTexCoord3ivARB;this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3ivARB_validation;}
+if(this->m_ptr_glVertexWeightfEXT){this->m_orig_glVertexWeightfEXT = this->m_ptr_glVertexWeightfEXT;this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&ValidationTableDecorator::m_glVertexWeightfEXT_validation;}
+if(this->m_ptr_glRasterPos4dv){this->m_orig_glRasterPos4dv = this->m_ptr_glRasterPos4dv;this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&ValidationTableDecorator::m_glRasterPos4dv_validation;}
+if(this->m_ptr_glIsTextureHandleResidentARB){this->m_orig_glIsTextureHandleResidentARB = this->m_ptr_glIsTextureHandleResidentARB;this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&ValidationTableDecorator::m_glIsTextureHandleResidentARB_validation;}
+if(this->m_ptr_glRasterPos2dv){this->m_orig_glRasterPos2dv = this->m_ptr_glRasterPos2dv;this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&ValidationTableDecorator::m_glRasterPos2dv_validation;}
+if(this->m_ptr_glWindowPos4ivMESA){this->m_orig_glWindowPos4ivMESA = this->m_ptr_glWindowPos4ivMESA;this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&ValidationTableDecorator::m_glWindowPos4ivMESA_validation;}
+if(this->m_ptr_glGetVariantPointervEXT){this->m_orig_glGetVariantPointervEXT = this->m_ptr_glGetVariantPointervEXT;this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&ValidationTableDecorator::m_glGetVariantPointervEXT_validation;}
+if(this->m_ptr_glMapNamedBufferRangeEXT){this->m_orig_glMapNamedBufferRangeEXT = this->m_ptr_glMapNamedBufferRangeEXT;this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&ValidationTableDecorator::m_glMapNamedBufferRangeEXT_validation;}
+if(this->m_ptr_glGetnUniformui64vARB){this->m_orig_glGetnUniformui64vARB = this->m_ptr_glGetnUniformui64vARB;this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&ValidationTableDecorator::m_glGetnUniformui64vARB_validation;}
+if(this->m_ptr_glCreateShaderProgramv){this->m_orig_glCreateShaderProgramv = this->m_ptr_glCreateShaderProgramv;this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&ValidationTableDecorator::m_glCreateShaderProgramv_validation;}
+if(this->m_ptr_glGetQueryObjectiv){this->m_orig_glGetQueryObjectiv = this->m_ptr_glGetQueryObjectiv;this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&ValidationTableDecorator::m_glGetQueryObjectiv_validation;}
+if(this->m_ptr_glMaxShaderCompilerThreadsKHR){this->m_orig_glMaxShaderCompilerThreadsKHR = this->m_ptr_glMaxShaderCompilerThreadsKHR;this->m_ptr_glMaxShaderCompilerThreadsKHR = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC)&ValidationTableDecorator::m_glMaxShaderCompilerThreadsKHR_validation;}
+if(this->m_ptr_glPNTrianglesfATI){this->m_orig_glPNTrianglesfATI = this->m_ptr_glPNTrianglesfATI;this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&ValidationTableDecorator::m_glPNTrianglesfATI_validation;}
+if(this->m_ptr_glGlobalAlphaFactorusSUN){this->m_orig_glGlobalAlphaFactorusSUN = this->m_ptr_glGlobalAlphaFactorusSUN;this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactorusSUN_validation;}
+if(this->m_ptr_glVertexAttrib3dvNV){this->m_orig_glVertexAttrib3dvNV = this->m_ptr_glVertexAttrib3dvNV;this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&ValidationTableDecorator::m_glVertexAttrib3dvNV_validation;}
+if(this->m_ptr_glMultiTexCoord3sARB){this->m_orig_glMultiTexCoord3sARB = this->m_ptr_glMultiTexCoord3sARB;this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3sARB_validation;}
+if(this->m_ptr_glGenerateMipmap){this->m_orig_glGenerateMipmap = this->m_ptr_glGenerateMipmap;this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&ValidationTableDecorator::m_glGenerateMipmap_validation;}
+if(this->m_ptr_glCompressedTextureSubImage2D){this->m_orig_glCompressedTextureSubImage2D = this->m_ptr_glCompressedTextureSubImage2D;this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&ValidationTableDecorator::m_glCompressedTextureSubImage2D_validation;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT){this->m_orig_glNamedRenderbufferStorageMultisampleEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleEXT;this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_validation;}
+if(this->m_ptr_glPolygonOffsetClampEXT){this->m_orig_glPolygonOffsetClampEXT = this->m_ptr_glPolygonOffsetClampEXT;this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&ValidationTableDecorator::m_glPolygonOffsetClampEXT_validation;}
+if(this->m_ptr_glTextureRangeAPPLE){this->m_orig_glTextureRangeAPPLE = this->m_ptr_glTextureRangeAPPLE;this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&ValidationTableDecorator::m_glTextureRangeAPPLE_validation;}
+if(this->m_ptr_glBlendEquationIndexedAMD){this->m_orig_glBlendEquationIndexedAMD = this->m_ptr_glBlendEquationIndexedAMD;this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&ValidationTableDecorator::m_glBlendEquationIndexedAMD_validation;}
+if(this->m_ptr_glTexCoord2d){this->m_orig_glTexCoord2d = this->m_ptr_glTexCoord2d;this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&ValidationTableDecorator::m_glTexCoord2d_validation;}
+if(this->m_ptr_glPointParameteri){this->m_orig_glPointParameteri = this->m_ptr_glPointParameteri;this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&ValidationTableDecorator::m_glPointParameteri_validation;}
+if(this->m_ptr_glTexCoord2f){this->m_orig_glTexCoord2f = this->m_ptr_glTexCoord2f;this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&ValidationTableDecorator::m_glTexCoord2f_validation;}
+if(this->m_ptr_glGetUnsignedBytei_vEXT){this->m_orig_glGetUnsignedBytei_vEXT = this->m_ptr_glGetUnsignedBytei_vEXT;this->m_ptr_glGetUnsignedBytei_vEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC)&ValidationTableDecorator::m_glGetUnsignedBytei_vEXT_validation;}
+if(this->m_ptr_glColor4iv){this->m_orig_glColor4iv = this->m_ptr_glColor4iv;this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&ValidationTableDecorator::m_glColor4iv_validation;}
+if(this->m_ptr_glMapNamedBufferRange){this->m_orig_glMapNamedBufferRange = this->m_ptr_glMapNamedBufferRange;this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&ValidationTableDecorator::m_glMapNamedBufferRange_validation;}
+if(this->m_ptr_glUnmapBuffer){this->m_orig_glUnmapBuffer = this->m_ptr_glUnmapBuffer;this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&ValidationTableDecorator::m_glUnmapBuffer_validation;}
+if(this->m_ptr_glSampleMaskEXT){this->m_orig_glSampleMaskEXT = this->m_ptr_glSampleMaskEXT;this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&ValidationTableDecorator::m_glSampleMaskEXT_validation;}
+if(this->m_ptr_glTexCoord2i){this->m_orig_glTexCoord2i = this->m_ptr_glTexCoord2i;this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&ValidationTableDecorator::m_glTexCoord2i_validation;}
+if(this->m_ptr_glTexCoord1xvOES){this->m_orig_glTexCoord1xvOES = this->m_ptr_glTexCoord1xvOES;this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&ValidationTableDecorator::m_glTexCoord1xvOES_validation;}
+if(this->m_ptr_glVertexAttrib1sARB){this->m_orig_glVertexAttrib1sARB = this->m_ptr_glVertexAttrib1sARB;this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&ValidationTableDecorator::m_glVertexAttrib1sARB_validation;}
+if(this->m_ptr_glGetVertexArrayiv){this->m_orig_glGetVertexArrayiv = this->m_ptr_glGetVertexArrayiv;this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&ValidationTableDecorator::m_glGetVertexArrayiv_validation;}
+if(this->m_ptr_glProgramParameter4dvNV){this->m_orig_glProgramParameter4dvNV = this->m_ptr_glProgramParameter4dvNV;this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&ValidationTableDecorator::m_glProgramParameter4dvNV_validation;}
+if(this->m_ptr_glTexCoord2s){this->m_orig_glTexCoord2s = this->m_ptr_glTexCoord2s;this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&ValidationTableDecorator::m_glTexCoord2s_validation;}
+if(this->m_ptr_glTextureParameterIuivEXT){this->m_orig_glTextureParameterIuivEXT = this->m_ptr_glTextureParameterIuivEXT;this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glTextureParameterIuivEXT_validation;}
+if(this->m_ptr_glGetColorTableParameterfvSGI){this->m_orig_glGetColorTableParameterfvSGI = this->m_ptr_glGetColorTableParameterfvSGI;this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&ValidationTableDecorator::m_glGetColorTableParameterfvSGI_validation;}
+if(this->m_ptr_glTexCoord4dv){this->m_orig_glTexCoord4dv = this->m_ptr_glTexCoord4dv;this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&ValidationTableDecorator::m_glTexCoord4dv_validation;}
+if(this->m_ptr_glVertexAttrib1svNV){this->m_orig_glVertexAttrib1svNV = this->m_ptr_glVertexAttrib1svNV;this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&ValidationTableDecorator::m_glVertexAttrib1svNV_validation;}
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT){this->m_orig_glNamedFramebufferTextureFaceEXT = this->m_ptr_glNamedFramebufferTextureFaceEXT;this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&ValidationTableDecorator::m_glNamedFramebufferTextureFaceEXT_validation;}
+if(this->m_ptr_glProgramUniform2ui64vNV){this->m_orig_glProgramUniform2ui64vNV = this->m_ptr_glProgramUniform2ui64vNV;this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&ValidationTableDecorator::m_glProgramUniform2ui64vNV_validation;}
+if(this->m_ptr_glStencilFillPathNV){this->m_orig_glStencilFillPathNV = this->m_ptr_glStencilFillPathNV;this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&ValidationTableDecorator::m_glStencilFillPathNV_validation;}
+if(this->m_ptr_glNormal3dv){this->m_orig_glNormal3dv = this->m_ptr_glNormal3dv;this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&ValidationTableDecorator::m_glNormal3dv_validation;}
+if(this->m_ptr_glReleaseShaderCompiler){this->m_orig_glReleaseShaderCompiler = this->m_ptr_glReleaseShaderCompiler;this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&ValidationTableDecorator::m_glReleaseShaderCompiler_validation;}
+if(this->m_ptr_glTexStorageMem3DEXT){this->m_orig_glTexStorageMem3DEXT = this->m_ptr_glTexStorageMem3DEXT;this->m_ptr_glTexStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC)&ValidationTableDecorator::m_glTexStorageMem3DEXT_validation;}
+if(this->m_ptr_glTexCoord3bvOES){this->m_orig_glTexCoord3bvOES = this->m_ptr_glTexCoord3bvOES;this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&ValidationTableDecorator::m_glTexCoord3bvOES_validation;}
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE){this->m_orig_glIsVertexAttribEnabledAPPLE = this->m_ptr_glIsVertexAttribEnabledAPPLE;this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&ValidationTableDecorator::m_glIsVertexAttribEnabledAPPLE_validation;}
+if(this->m_ptr_glTexCoord1dv){this->m_orig_glTexCoord1dv = this->m_ptr_glTexCoord1dv;this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&ValidationTableDecorator::m_glTexCoord1dv_validation;}
+if(this->m_ptr_glReadPixels){this->m_orig_glReadPixels = this->m_ptr_glReadPixels;this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&ValidationTableDecorator::m_glReadPixels_validation;}
+if(this->m_ptr_glVertexAttribI3iv){this->m_orig_glVertexAttribI3iv = this->m_ptr_glVertexAttribI3iv;this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&ValidationTableDecorator::m_glVertexAttribI3iv_validation;}
+if(this->m_ptr_glSetFenceAPPLE){this->m_orig_glSetFenceAPPLE = this->m_ptr_glSetFenceAPPLE;this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&ValidationTableDecorator::m_glSetFenceAPPLE_validation;}
+if(this->m_ptr_glWeightsvARB){this->m_orig_glWeightsvARB = this->m_ptr_glWeightsvARB;this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&ValidationTableDecorator::m_glWeightsvARB_validation;}
+if(this->m_ptr_glShadeModel){this->m_orig_glShadeModel = this->m_ptr_glShadeModel;this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&ValidationTableDecorator::m_glShadeModel_validation;}
+if(this->m_ptr_glTextureStorageMem3DMultisampleEXT){this->m_orig_glTextureStorageMem3DMultisampleEXT = this->m_ptr_glTextureStorageMem3DMultisampleEXT;this->m_ptr_glTextureStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glTextureStorageMem3DMultisampleEXT_validation;}
+if(this->m_ptr_glMapGrid1d){this->m_orig_glMapGrid1d = this->m_ptr_glMapGrid1d;this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&ValidationTableDecorator::m_glMapGrid1d_validation;}
+if(this->m_ptr_glGetHistogramParameterivEXT){this->m_orig_glGetHistogramParameterivEXT = this->m_ptr_glGetHistogramParameterivEXT;this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetHistogramParameterivEXT_validation;}
+if(this->m_ptr_glConservativeRasterParameteriNV){this->m_orig_glConservativeRasterParameteriNV = this->m_ptr_glConservativeRasterParameteriNV;this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&ValidationTableDecorator::m_glConservativeRasterParameteriNV_validation;}
+if(this->m_ptr_glClearNamedBufferData){this->m_orig_glClearNamedBufferData = this->m_ptr_glClearNamedBufferData;this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&ValidationTableDecorator::m_glClearNamedBufferData_validation;}
+if(this->m_ptr_glClearDepthf){this->m_orig_glClearDepthf = this->m_ptr_glClearDepthf;this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&ValidationTableDecorator::m_glClearDepthf_validation;}
+if(this->m_ptr_glCreatePerfQueryINTEL){this->m_orig_glCreatePerfQueryINTEL = this->m_ptr_glCreatePerfQueryINTEL;this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&ValidationTableDecorator::m_glCreatePerfQueryINTEL_validation;}
+if(this->m_ptr_glFogCoordfEXT){this->m_orig_glFogCoordfEXT = this->m_ptr_glFogCoordfEXT;this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&ValidationTableDecorator::m_glFogCoordfEXT_validation;}
+if(this->m_ptr_glVertexAttrib2dARB){this->m_orig_glVertexAttrib2dARB = this->m_ptr_glVertexAttrib2dARB;this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&ValidationTableDecorator::m_glVertexAttrib2dARB_validation;}
+if(this->m_ptr_glMultiTexCoord4dARB){this->m_orig_glMultiTexCoord4dARB = this->m_ptr_glMultiTexCoord4dARB;this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4dARB_validation;}
+if(this->m_ptr_glReadnPixelsARB){this->m_orig_glReadnPixelsARB = this->m_ptr_glReadnPixelsARB;this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&ValidationTableDecorator::m_glReadnPixelsARB_validation;}
+if(this->m_ptr_glMultiTexBufferEXT){this->m_orig_glMultiTexBufferEXT = this->m_ptr_glMultiTexBufferEXT;this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&ValidationTableDecorator::m_glMultiTexBufferEXT_validation;}
+if(this->m_ptr_glWindowPos4dvMESA){this->m_orig_glWindowPos4dvMESA = this->m_ptr_glWindowPos4dvMESA;this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&ValidationTableDecorator::m_glWindowPos4dvMESA_validation;}
+if(this->m_ptr_glInvalidateNamedFramebufferData){this->m_orig_glInvalidateNamedFramebufferData = this->m_ptr_glInvalidateNamedFramebufferData;this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&ValidationTableDecorator::m_glInvalidateNamedFramebufferData_validation;}
+if(this->m_ptr_glSecondaryColorPointerListIBM){this->m_orig_glSecondaryColorPointerListIBM = this->m_ptr_glSecondaryColorPointerListIBM;this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glSecondaryColorPointerListIBM_validation;}
+if(this->m_ptr_glRectiv){this->m_orig_glRectiv = this->m_ptr_glRectiv;this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&ValidationTableDecorator::m_glRectiv_validation;}
+if(this->m_ptr_glColorP4ui){this->m_orig_glColorP4ui = this->m_ptr_glColorP4ui;this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&ValidationTableDecorator::m_glColorP4ui_validation;}
+if(this->m_ptr_glUseProgramStages){this->m_orig_glUseProgramStages = this->m_ptr_glUseProgramStages;this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&ValidationTableDecorator::m_glUseProgramStages_validation;}
+if(this->m_ptr_glRasterPos3dv){this->m_orig_glRasterPos3dv = this->m_ptr_glRasterPos3dv;this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&ValidationTableDecorator::m_glRasterPos3dv_validation;}
+if(this->m_ptr_glPathTexGenNV){this->m_orig_glPathTexGenNV = this->m_ptr_glPathTexGenNV;this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&ValidationTableDecorator::m_glPathTexGenNV_validation;}
+if(this->m_ptr_glVertexBlendEnviATI){this->m_orig_glVertexBlendEnviATI = this->m_ptr_glVertexBlendEnviATI;this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&ValidationTableDecorator::m_glVertexBlendEnviATI_validation;}
+if(this->m_ptr_glUniform3i64ARB){this->m_orig_glUniform3i64ARB = this->m_ptr_glUniform3i64ARB;this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&ValidationTableDecorator::m_glUniform3i64ARB_validation;}
+if(this->m_ptr_glLoadMatrixf){this->m_orig_glLoadMatrixf = this->m_ptr_glLoadMatrixf;this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&ValidationTableDecorator::m_glLoadMatrixf_validation;}
+if(this->m_ptr_glProgramUniform2dEXT){this->m_orig_glProgramUniform2dEXT = this->m_ptr_glProgramUniform2dEXT;this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&ValidationTableDecorator::m_glProgramUniform2dEXT_validation;}
+if(this->m_ptr_glVertexAttribI4iv){this->m_orig_glVertexAttribI4iv = this->m_ptr_glVertexAttribI4iv;this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&ValidationTableDecorator::m_glVertexAttribI4iv_validation;}
+if(this->m_ptr_glNamedFramebufferDrawBuffer){this->m_orig_glNamedFramebufferDrawBuffer = this->m_ptr_glNamedFramebufferDrawBuffer;this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&ValidationTableDecorator::m_glNamedFramebufferDrawBuffer_validation;}
+if(this->m_ptr_glColor4ubv){this->m_orig_glColor4ubv = this->m_ptr_glColor4ubv;this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&ValidationTableDecorator::m_glColor4ubv_validation;}
+if(this->m_ptr_glColor3hvNV){this->m_orig_glColor3hvNV = this->m_ptr_glColor3hvNV;this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&ValidationTableDecorator::m_glColor3hvNV_validation;}
+if(this->m_ptr_glGetMapAttribParameterfvNV){this->m_orig_glGetMapAttribParameterfvNV = this->m_ptr_glGetMapAttribParameterfvNV;this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetMapAttribParameterfvNV_validation;}
+if(this->m_ptr_glGetBufferSubData){this->m_orig_glGetBufferSubData = this->m_ptr_glGetBufferSubData;this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glGetBufferSubData_validation;}
+if(this->m_ptr_glGetVertexAttribLdv){this->m_orig_glGetVertexAttribLdv = this->m_ptr_glGetVertexAttribLdv;this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&ValidationTableDecorator::m_glGetVertexAttribLdv_validation;}
+if(this->m_ptr_glGetnUniformuiv){this->m_orig_glGetnUniformuiv = this->m_ptr_glGetnUniformuiv;this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&ValidationTableDecorator::m_glGetnUniformuiv_validation;}
+if(this->m_ptr_glGetUniformui64vNV){this->m_orig_glGetUniformui64vNV = this->m_ptr_glGetUniformui64vNV;this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&ValidationTableDecorator::m_glGetUniformui64vNV_validation;}
+if(this->m_ptr_glNamedRenderbufferStorageEXT){this->m_orig_glNamedRenderbufferStorageEXT = this->m_ptr_glNamedRenderbufferStorageEXT;this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&ValidationTableDecorator::m_glNamedRenderbufferStorageEXT_validation;}
+if(this->m_ptr_glVertexAttrib3dNV){this->m_orig_glVertexAttrib3dNV = this->m_ptr_glVertexAttrib3dNV;this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&ValidationTableDecorator::m_glVertexAttrib3dNV_validation;}
+if(this->m_ptr_glTextureStorage1DEXT){this->m_orig_glTextureStorage1DEXT = this->m_ptr_glTextureStorage1DEXT;this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&ValidationTableDecorator::m_glTextureStorage1DEXT_validation;}
+if(this->m_ptr_glPixelTexGenParameteriSGIS){this->m_orig_glPixelTexGenParameteriSGIS = this->m_ptr_glPixelTexGenParameteriSGIS;this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&ValidationTableDecorator::m_glPixelTexGenParameteriSGIS_validation;}
+if(this->m_ptr_glColorTableEXT){this->m_orig_glColorTableEXT = this->m_ptr_glColorTableEXT;this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&ValidationTableDecorator::m_glColorTableEXT_validation;}
+if(this->m_ptr_glGenBuffers){this->m_orig_glGenBuffers = this->m_ptr_glGenBuffers;this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&ValidationTableDecorator::m_glGenBuffers_validation;}
+if(this->m_ptr_glMultiTexCoord3xvOES){this->m_orig_glMultiTexCoord3xvOES = this->m_ptr_glMultiTexCoord3xvOES;this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord3xvOES_validation;}
+if(this->m_ptr_glExecuteProgramNV){this->m_orig_glExecuteProgramNV = this->m_ptr_glExecuteProgramNV;this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&ValidationTableDecorator::m_glExecuteProgramNV_validation;}
+if(this->m_ptr_glVariantArrayObjectATI){this->m_orig_glVariantArrayObjectATI = this->m_ptr_glVariantArrayObjectATI;this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&ValidationTableDecorator::m_glVariantArrayObjectATI_validation;}
+if(this->m_ptr_glColor3xvOES){this->m_orig_glColor3xvOES = this->m_ptr_glColor3xvOES;this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&ValidationTableDecorator::m_glColor3xvOES_validation;}
+if(this->m_ptr_glGetnConvolutionFilterARB){this->m_orig_glGetnConvolutionFilterARB = this->m_ptr_glGetnConvolutionFilterARB;this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&ValidationTableDecorator::m_glGetnConvolutionFilterARB_validation;}
+if(this->m_ptr_glNormalFormatNV){this->m_orig_glNormalFormatNV = this->m_ptr_glNormalFormatNV;this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&ValidationTableDecorator::m_glNormalFormatNV_validation;}
+if(this->m_ptr_glGetInvariantFloatvEXT){this->m_orig_glGetInvariantFloatvEXT = this->m_ptr_glGetInvariantFloatvEXT;this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&ValidationTableDecorator::m_glGetInvariantFloatvEXT_validation;}
+if(this->m_ptr_glClearNamedFramebufferiv){this->m_orig_glClearNamedFramebufferiv = this->m_ptr_glClearNamedFramebufferiv;this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&ValidationTableDecorator::m_glClearNamedFramebufferiv_validation;}
+if(this->m_ptr_glTexImage3D){this->m_orig_glTexImage3D = this->m_ptr_glTexImage3D;this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&ValidationTableDecorator::m_glTexImage3D_validation;}
+if(this->m_ptr_glGenSamplers){this->m_orig_glGenSamplers = this->m_ptr_glGenSamplers;this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&ValidationTableDecorator::m_glGenSamplers_validation;}
+if(this->m_ptr_glIsFramebuffer){this->m_orig_glIsFramebuffer = this->m_ptr_glIsFramebuffer;this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&ValidationTableDecorator::m_glIsFramebuffer_validation;}
+if(this->m_ptr_glProgramUniform3dvEXT){this->m_orig_glProgramUniform3dvEXT = this->m_ptr_glProgramUniform3dvEXT;this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&ValidationTableDecorator::m_glProgramUniform3dvEXT_validation;}
+if(this->m_ptr_glGetVertexAttribfvNV){this->m_orig_glGetVertexAttribfvNV = this->m_ptr_glGetVertexAttribfvNV;this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&ValidationTableDecorator::m_glGetVertexAttribfvNV_validation;}
+if(this->m_ptr_glDrawRangeElementArrayAPPLE){this->m_orig_glDrawRangeElementArrayAPPLE = this->m_ptr_glDrawRangeElementArrayAPPLE;this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&ValidationTableDecorator::m_glDrawRangeElementArrayAPPLE_validation;}
+if(this->m_ptr_glUniform3i64NV){this->m_orig_glUniform3i64NV = this->m_ptr_glUniform3i64NV;this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&ValidationTableDecorator::m_glUniform3i64NV_validation;}
+if(this->m_ptr_glMatrixPopEXT){this->m_orig_glMatrixPopEXT = this->m_ptr_glMatrixPopEXT;this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&ValidationTableDecorator::m_glMatrixPopEXT_validation;}
+if(this->m_ptr_glVertexStream1sATI){this->m_orig_glVertexStream1sATI = this->m_ptr_glVertexStream1sATI;this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&ValidationTableDecorator::m_glVertexStream1sATI_validation;}
+if(this->m_ptr_glGetnPixelMapuivARB){this->m_orig_glGetnPixelMapuivARB = this->m_ptr_glGetnPixelMapuivARB;this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&ValidationTableDecorator::m_glGetnPixelMapuivARB_validation;}
+if(this->m_ptr_glMultiTexEnviEXT){this->m_orig_glMultiTexEnviEXT = this->m_ptr_glMultiTexEnviEXT;this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&ValidationTableDecorator::m_glMultiTexEnviEXT_validation;}
+if(this->m_ptr_glVertexAttribI2iEXT){this->m_orig_glVertexAttribI2iEXT = this->m_ptr_glVertexAttribI2iEXT;this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&ValidationTableDecorator::m_glVertexAttribI2iEXT_validation;}
+if(this->m_ptr_glProgramParameter4fvNV){this->m_orig_glProgramParameter4fvNV = this->m_ptr_glProgramParameter4fvNV;this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&ValidationTableDecorator::m_glProgramParameter4fvNV_validation;}
+if(this->m_ptr_glWaitSemaphoreEXT){this->m_orig_glWaitSemaphoreEXT = this->m_ptr_glWaitSemaphoreEXT;this->m_ptr_glWaitSemaphoreEXT = (FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC)&ValidationTableDecorator::m_glWaitSemaphoreEXT_validation;}
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV){this->m_orig_glNamedFramebufferSampleLocationsfvNV = this->m_ptr_glNamedFramebufferSampleLocationsfvNV;this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ValidationTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_validation;}
+if(this->m_ptr_glTexCoordP4uiv){this->m_orig_glTexCoordP4uiv = this->m_ptr_glTexCoordP4uiv;this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&ValidationTableDecorator::m_glTexCoordP4uiv_validation;}
+if(this->m_ptr_glRectxvOES){this->m_orig_glRectxvOES = this->m_ptr_glRectxvOES;this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&ValidationTableDecorator::m_glRectxvOES_validation;}
+if(this->m_ptr_glGetVariantIntegervEXT){this->m_orig_glGetVariantIntegervEXT = this->m_ptr_glGetVariantIntegervEXT;this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&ValidationTableDecorator::m_glGetVariantIntegervEXT_validation;}
+if(this->m_ptr_glDeleteLists){this->m_orig_glDeleteLists = this->m_ptr_glDeleteLists;this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&ValidationTableDecorator::m_glDeleteLists_validation;}
+if(this->m_ptr_glTexGendv){this->m_orig_glTexGendv = this->m_ptr_glTexGendv;this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&ValidationTableDecorator::m_glTexGendv_validation;}
+if(this->m_ptr_glVertexP2uiv){this->m_orig_glVertexP2uiv = this->m_ptr_glVertexP2uiv;this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&ValidationTableDecorator::m_glVertexP2uiv_validation;}
+if(this->m_ptr_glGetPerfMonitorGroupsAMD){this->m_orig_glGetPerfMonitorGroupsAMD = this->m_ptr_glGetPerfMonitorGroupsAMD;this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&ValidationTableDecorator::m_glGetPerfMonitorGroupsAMD_validation;}
+if(this->m_ptr_glMultTransposeMatrixfARB){this->m_orig_glMultTransposeMatrixfARB = this->m_ptr_glMultTransposeMatrixfARB;this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&ValidationTableDecorator::m_glMultTransposeMatrixfARB_validation;}
+if(this->m_ptr_glVertexAttribI2ivEXT){this->m_orig_glVertexAttribI2ivEXT = this->m_ptr_glVertexAttribI2ivEXT;this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI2ivEXT_validation;}
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glDeleteStatesNV){this->m_orig_glDeleteStatesNV = this->m_ptr_glDeleteStatesNV;this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&ValidationTableDecorator::m_glDeleteStatesNV_validation;}
+if(this->m_ptr_glGetBufferParameteri64v){this->m_orig_glGetBufferParameteri64v = this->m_ptr_glGetBufferParameteri64v;this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&ValidationTableDecorator::m_glGetBufferParameteri64v_validation;}
+if(this->m_ptr_glProgramUniform4dv){this->m_orig_glProgramUniform4dv = this->m_ptr_glProgramUniform4dv;this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&ValidationTableDecorator::m_glProgramUniform4dv_validation;}
+if(this->m_ptr_glEdgeFlagPointerEXT){this->m_orig_glEdgeFlagPointerEXT = this->m_ptr_glEdgeFlagPointerEXT;this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&ValidationTableDecorator::m_glEdgeFlagPointerEXT_validation;}
+if(this->m_ptr_glVideoCaptureStreamParameterivNV){this->m_orig_glVideoCaptureStreamParameterivNV = this->m_ptr_glVideoCaptureStreamParameterivNV;this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&ValidationTableDecorator::m_glVideoCaptureStreamParameterivNV_validation;}
+if(this->m_ptr_glVertexStream4iATI){this->m_orig_glVertexStream4iATI = this->m_ptr_glVertexStream4iATI;this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&ValidationTableDecorator::m_glVertexStream4iATI_validation;}
+if(this->m_ptr_glVDPAUFiniNV){this->m_orig_glVDPAUFiniNV = this->m_ptr_glVDPAUFiniNV;this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&ValidationTableDecorator::m_glVDPAUFiniNV_validation;}
+if(this->m_ptr_glMakeBufferNonResidentNV){this->m_orig_glMakeBufferNonResidentNV = this->m_ptr_glMakeBufferNonResidentNV;this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&ValidationTableDecorator::m_glMakeBufferNonResidentNV_validation;}
+if(this->m_ptr_glUniform1ui64ARB){this->m_orig_glUniform1ui64ARB = this->m_ptr_glUniform1ui64ARB;this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&ValidationTableDecorator::m_glUniform1ui64ARB_validation;}
+if(this->m_ptr_glStencilStrokePathNV){this->m_orig_glStencilStrokePathNV = this->m_ptr_glStencilStrokePathNV;this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&ValidationTableDecorator::m_glStencilStrokePathNV_validation;}
+if(this->m_ptr_glVariantuivEXT){this->m_orig_glVariantuivEXT = this->m_ptr_glVariantuivEXT;this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&ValidationTableDecorator::m_glVariantuivEXT_validation;}
+if(this->m_ptr_glCopyTexSubImage3DEXT){this->m_orig_glCopyTexSubImage3DEXT = this->m_ptr_glCopyTexSubImage3DEXT;this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCopyTexSubImage3DEXT_validation;}
+if(this->m_ptr_glSpriteParameteriSGIX){this->m_orig_glSpriteParameteriSGIX = this->m_ptr_glSpriteParameteriSGIX;this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&ValidationTableDecorator::m_glSpriteParameteriSGIX_validation;}
+if(this->m_ptr_glMultiTexCoord1sARB){this->m_orig_glMultiTexCoord1sARB = this->m_ptr_glMultiTexCoord1sARB;this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1sARB_validation;}
+if(this->m_ptr_glConvolutionParameterfv){this->m_orig_glConvolutionParameterfv = this->m_ptr_glConvolutionParameterfv;this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&ValidationTableDecorator::m_glConvolutionParameterfv_validation;}
+if(this->m_ptr_glMakeTextureHandleResidentNV){this->m_orig_glMakeTextureHandleResidentNV = this->m_ptr_glMakeTextureHandleResidentNV;this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&ValidationTableDecorator::m_glMakeTextureHandleResidentNV_validation;}
+if(this->m_ptr_glMultMatrixxOES){this->m_orig_glMultMatrixxOES = this->m_ptr_glMultMatrixxOES;this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&ValidationTableDecorator::m_glMultMatrixxOES_validation;}
+if(this->m_ptr_glTextureNormalEXT){this->m_orig_glTextureNormalEXT = this->m_ptr_glTextureNormalEXT;this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&ValidationTableDecorator::m_glTextureNormalEXT_validation;}
+if(this->m_ptr_glGetQueryivARB){this->m_orig_glGetQueryivARB = this->m_ptr_glGetQueryivARB;this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&ValidationTableDecorator::m_glGetQueryivARB_validation;}
+if(this->m_ptr_glCompressedMultiTexImage3DEXT){this->m_orig_glCompressedMultiTexImage3DEXT = this->m_ptr_glCompressedMultiTexImage3DEXT;this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCompressedMultiTexImage3DEXT_validation;}
+if(this->m_ptr_glGetInstrumentsSGIX){this->m_orig_glGetInstrumentsSGIX = this->m_ptr_glGetInstrumentsSGIX;this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&ValidationTableDecorator::m_glGetInstrumentsSGIX_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT){this->m_orig_glProgramUniformMatrix4x3fvEXT = this->m_ptr_glProgramUniformMatrix4x3fvEXT;this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x3fvEXT_validation;}
+if(this->m_ptr_glPointParameterf){this->m_orig_glPointParameterf = this->m_ptr_glPointParameterf;this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&ValidationTableDecorator::m_glPointParameterf_validation;}
+if(this->m_ptr_glProgramUniform3dEXT){this->m_orig_glProgramUniform3dEXT = this->m_ptr_glProgramUniform3dEXT;this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&ValidationTableDecorator::m_glProgramUniform3dEXT_validation;}
+if(this->m_ptr_glMultiTexCoord2hNV){this->m_orig_glMultiTexCoord2hNV = this->m_ptr_glMultiTexCoord2hNV;this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&ValidationTableDecorator::m_glMultiTexCoord2hNV_validation;}
+if(this->m_ptr_glGetConvolutionFilterEXT){this->m_orig_glGetConvolutionFilterEXT = this->m_ptr_glGetConvolutionFilterEXT;this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&ValidationTableDecorator::m_glGetConvolutionFilterEXT_validation;}
+if(this->m_ptr_glVertexAttrib2hNV){this->m_orig_glVertexAttrib2hNV = this->m_ptr_glVertexAttrib2hNV;this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&ValidationTableDecorator::m_glVertexAttrib2hNV_validation;}
+if(this->m_ptr_glCurrentPaletteMatrixARB){this->m_orig_glCurrentPaletteMatrixARB = this->m_ptr_glCurrentPaletteMatrixARB;this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&ValidationTableDecorator::m_glCurrentPaletteMatrixARB_validation;}
+if(this->m_ptr_glFogxvOES){this->m_orig_glFogxvOES = this->m_ptr_glFogxvOES;this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&ValidationTableDecorator::m_glFogxvOES_validation;}
+if(this->m_ptr_glCreateRenderbuffers){this->m_orig_glCreateRenderbuffers = this->m_ptr_glCreateRenderbuffers;this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&ValidationTableDecorator::m_glCreateRenderbuffers_validation;}
+if(this->m_ptr_glVertexAttrib4Nusv){this->m_orig_glVertexAttrib4Nusv = this->m_ptr_glVertexAttrib4Nusv;this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&ValidationTableDecorator::m_glVertexAttrib4Nusv_validation;}
+if(this->m_ptr_glCombinerInputNV){this->m_orig_glCombinerInputNV = this->m_ptr_glCombinerInputNV;this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&ValidationTableDecorator::m_glCombinerInputNV_validation;}
+if(this->m_ptr_glDepthFunc){this->m_orig_glDepthFunc = this->m_ptr_glDepthFunc;this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&ValidationTableDecorator::m_glDepthFunc_validation;}
+if(this->m_ptr_glWindowPos4fMESA){this->m_orig_glWindowPos4fMESA = this->m_ptr_glWindowPos4fMESA;this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&ValidationTableDecorator::m_glWindowPos4fMESA_validation;}
+if(this->m_ptr_glEnableClientStateIndexedEXT){this->m_orig_glEnableClientStateIndexedEXT = this->m_ptr_glEnableClientStateIndexedEXT;this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&ValidationTableDecorator::m_glEnableClientStateIndexedEXT_validation;}
+if(this->m_ptr_glTexCoord4iv){this->m_orig_glTexCoord4iv = this->m_ptr_glTexCoord4iv;this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&ValidationTableDecorator::m_glTexCoord4iv_validation;}
+if(this->m_ptr_glProgramUniform4i64ARB){this->m_orig_glProgramUniform4i64ARB = this->m_ptr_glProgramUniform4i64ARB;this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&ValidationTableDecorator::m_glProgramUniform4i64ARB_validation;}
+if(this->m_ptr_glBlendFunci){this->m_orig_glBlendFunci = this->m_ptr_glBlendFunci;this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&ValidationTableDecorator::m_glBlendFunci_validation;}
+if(this->m_ptr_glResolveDepthValuesNV){this->m_orig_glResolveDepthValuesNV = this->m_ptr_glResolveDepthValuesNV;this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&ValidationTableDecorator::m_glResolveDepthValuesNV_validation;}
+if(this->m_ptr_glTextureColorMaskSGIS){this->m_orig_glTextureColorMaskSGIS = this->m_ptr_glTextureColorMaskSGIS;this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&ValidationTableDecorator::m_glTextureColorMaskSGIS_validation;}
+if(this->m_ptr_glCreateShaderProgramEXT){this->m_orig_glCreateShaderProgramEXT = this->m_ptr_glCreateShaderProgramEXT;this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&ValidationTableDecorator::m_glCreateShaderProgramEXT_validation;}
+if(this->m_ptr_glBufferStorage){this->m_orig_glBufferStorage = this->m_ptr_glBufferStorage;this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&ValidationTableDecorator::m_glBufferStorage_validation;}
+if(this->m_ptr_glMakeNamedBufferNonResidentNV){this->m_orig_glMakeNamedBufferNonResidentNV = this->m_ptr_glMakeNamedBufferNonResidentNV;this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&ValidationTableDecorator::m_glMakeNamedBufferNonResidentNV_validation;}
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT){this->m_orig_glRenderbufferStorageMultisampleEXT = this->m_ptr_glRenderbufferStorageMultisampleEXT;this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glRenderbufferStorageMultisampleEXT_validation;}
+if(this->m_ptr_glGetFloati_v){this->m_orig_glGetFloati_v = this->m_ptr_glGetFloati_v;this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&ValidationTableDecorator::m_glGetFloati_v_validation;}
+if(this->m_ptr_glUniform2ui64ARB){this->m_orig_glUniform2ui64ARB = this->m_ptr_glUniform2ui64ARB;this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&ValidationTableDecorator::m_glUniform2ui64ARB_validation;}
+if(this->m_ptr_glVertex3fv){this->m_orig_glVertex3fv = this->m_ptr_glVertex3fv;this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&ValidationTableDecorator::m_glVertex3fv_validation;}
+if(this->m_ptr_glGetUniformLocation){this->m_orig_glGetUniformLocation = this->m_ptr_glGetUniformLocation;this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&ValidationTableDecorator::m_glGetUniformLocation_validation;}
+if(this->m_ptr_glVertexStream1svATI){this->m_orig_glVertexStream1svATI = this->m_ptr_glVertexStream1svATI;this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&ValidationTableDecorator::m_glVertexStream1svATI_validation;}
+if(this->m_ptr_glVertexStream3fATI){this->m_orig_glVertexStream3fATI = this->m_ptr_glVertexStream3fATI;this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&ValidationTableDecorator::m_glVertexStream3fATI_validation;}
+if(this->m_ptr_glNamedFramebufferDrawBuffers){this->m_orig_glNamedFramebufferDrawBuffers = this->m_ptr_glNamedFramebufferDrawBuffers;this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&ValidationTableDecorator::m_glNamedFramebufferDrawBuffers_validation;}
+if(this->m_ptr_glUniform2ui64vNV){this->m_orig_glUniform2ui64vNV = this->m_ptr_glUniform2ui64vNV;this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&ValidationTableDecorator::m_glUniform2ui64vNV_validation;}
+if(this->m_ptr_glTexCoordPointervINTEL){this->m_orig_glTexCoordPointervINTEL = this->m_ptr_glTexCoordPointervINTEL;this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&ValidationTableDecorator::m_glTexCoordPointervINTEL_validation;}
+if(this->m_ptr_glUniform4fv){this->m_orig_glUniform4fv = this->m_ptr_glUniform4fv;this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&ValidationTableDecorator::m_glUniform4fv_validation;}
+if(this->m_ptr_glNormalPointerEXT){this->m_orig_glNormalPointerEXT = this->m_ptr_glNormalPointerEXT;this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&ValidationTableDecorator::m_glNormalPointerEXT_validation;}
+if(this->m_ptr_glVertexAttrib4hNV){this->m_orig_glVertexAttrib4hNV = this->m_ptr_glVertexAttrib4hNV;this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&ValidationTableDecorator::m_glVertexAttrib4hNV_validation;}
+if(this->m_ptr_glNormal3f){this->m_orig_glNormal3f = this->m_ptr_glNormal3f;this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&ValidationTableDecorator::m_glNormal3f_validation;}
+if(this->m_ptr_glVertexStream2iATI){this->m_orig_glVertexStream2iATI = this->m_ptr_glVertexStream2iATI;this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&ValidationTableDecorator::m_glVertexStream2iATI_validation;}
+if(this->m_ptr_glVertexAttribP4uiv){this->m_orig_glVertexAttribP4uiv = this->m_ptr_glVertexAttribP4uiv;this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&ValidationTableDecorator::m_glVertexAttribP4uiv_validation;}
+if(this->m_ptr_glCompressedTextureSubImage3D){this->m_orig_glCompressedTextureSubImage3D = this->m_ptr_glCompressedTextureSubImage3D;this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&ValidationTableDecorator::m_glCompressedTextureSubImage3D_validation;}
+if(this->m_ptr_glAsyncMarkerSGIX){this->m_orig_glAsyncMarkerSGIX = this->m_ptr_glAsyncMarkerSGIX;this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&ValidationTableDecorator::m_glAsyncMarkerSGIX_validation;}
+if(this->m_ptr_glTextureStorageSparseAMD){this->m_orig_glTextureStorageSparseAMD = this->m_ptr_glTextureStorageSparseAMD;this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&ValidationTableDecorator::m_glTextureStorageSparseAMD_validation;}
+if(this->m_ptr_glGetConvolutionParameterivEXT){this->m_orig_glGetConvolutionParameterivEXT = this->m_ptr_glGetConvolutionParameterivEXT;this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetConvolutionParameterivEXT_validation;}
+if(this->m_ptr_glEndPerfQueryINTEL){this->m_orig_glEndPerfQueryINTEL = this->m_ptr_glEndPerfQueryINTEL;this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&ValidationTableDecorator::m_glEndPerfQueryINTEL_validation;}
+if(this->m_ptr_glFragmentLightModeliSGIX){this->m_orig_glFragmentLightModeliSGIX = this->m_ptr_glFragmentLightModeliSGIX;this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&ValidationTableDecorator::m_glFragmentLightModeliSGIX_validation;}
+if(this->m_ptr_glPrioritizeTexturesEXT){this->m_orig_glPrioritizeTexturesEXT = this->m_ptr_glPrioritizeTexturesEXT;this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&ValidationTableDecorator::m_glPrioritizeTexturesEXT_validation;}
+if(this->m_ptr_glEndConditionalRender){this->m_orig_glEndConditionalRender = this->m_ptr_glEndConditionalRender;this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&ValidationTableDecorator::m_glEndConditionalRender_validation;}
+if(this->m_ptr_glEnableClientState){this->m_orig_glEnableClientState = this->m_ptr_glEnableClientState;this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&ValidationTableDecorator::m_glEnableClientState_validation;}
+if(this->m_ptr_glResetHistogram){this->m_orig_glResetHistogram = this->m_ptr_glResetHistogram;this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&ValidationTableDecorator::m_glResetHistogram_validation;}
+if(this->m_ptr_glGetOcclusionQueryivNV){this->m_orig_glGetOcclusionQueryivNV = this->m_ptr_glGetOcclusionQueryivNV;this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&ValidationTableDecorator::m_glGetOcclusionQueryivNV_validation;}
+if(this->m_ptr_glUniform1uiEXT){this->m_orig_glUniform1uiEXT = this->m_ptr_glUniform1uiEXT;this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&ValidationTableDecorator::m_glUniform1uiEXT_validation;}
+if(this->m_ptr_glMultiTexCoord2sv){this->m_orig_glMultiTexCoord2sv = this->m_ptr_glMultiTexCoord2sv;this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&ValidationTableDecorator::m_glMultiTexCoord2sv_validation;}
+if(this->m_ptr_glTexSubImage2DEXT){this->m_orig_glTexSubImage2DEXT = this->m_ptr_glTexSubImage2DEXT;this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glTexSubImage2DEXT_validation;}
+if(this->m_ptr_glProgramUniform2uiv){this->m_orig_glProgramUniform2uiv = this->m_ptr_glProgramUniform2uiv;this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&ValidationTableDecorator::m_glProgramUniform2uiv_validation;}
+if(this->m_ptr_glMultiTexCoord2iARB){this->m_orig_glMultiTexCoord2iARB = this->m_ptr_glMultiTexCoord2iARB;this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2iARB_validation;}
+if(this->m_ptr_glGetQueryObjectuiv){this->m_orig_glGetQueryObjectuiv = this->m_ptr_glGetQueryObjectuiv;this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&ValidationTableDecorator::m_glGetQueryObjectuiv_validation;}
+if(this->m_ptr_glGenerateMultiTexMipmapEXT){this->m_orig_glGenerateMultiTexMipmapEXT = this->m_ptr_glGenerateMultiTexMipmapEXT;this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&ValidationTableDecorator::m_glGenerateMultiTexMipmapEXT_validation;}
+if(this->m_ptr_glVertexAttrib4iv){this->m_orig_glVertexAttrib4iv = this->m_ptr_glVertexAttrib4iv;this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&ValidationTableDecorator::m_glVertexAttrib4iv_validation;}
+if(this->m_ptr_glWindowPos3dvMESA){this->m_orig_glWindowPos3dvMESA = this->m_ptr_glWindowPos3dvMESA;this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&ValidationTableDecorator::m_glWindowPos3dvMESA_validation;}
+if(this->m_ptr_glLabelObjectEXT){this->m_orig_glLabelObjectEXT = this->m_ptr_glLabelObjectEXT;this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&ValidationTableDecorator::m_glLabelObjectEXT_validation;}
+if(this->m_ptr_glProgramUniform1uiv){this->m_orig_glProgramUniform1uiv = this->m_ptr_glProgramUniform1uiv;this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&ValidationTableDecorator::m_glProgramUniform1uiv_validation;}
+if(this->m_ptr_glFramebufferTexture){this->m_orig_glFramebufferTexture = this->m_ptr_glFramebufferTexture;this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&ValidationTableDecorator::m_glFramebufferTexture_validation;}
+if(this->m_ptr_glMultiTexEnvfEXT){this->m_orig_glMultiTexEnvfEXT = this->m_ptr_glMultiTexEnvfEXT;this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&ValidationTableDecorator::m_glMultiTexEnvfEXT_validation;}
+if(this->m_ptr_glGetTexGendv){this->m_orig_glGetTexGendv = this->m_ptr_glGetTexGendv;this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&ValidationTableDecorator::m_glGetTexGendv_validation;}
+if(this->m_ptr_glVertex4xOES){this->m_orig_glVertex4xOES = this->m_ptr_glVertex4xOES;this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&ValidationTableDecorator::m_glVertex4xOES_validation;}
+if(this->m_ptr_glVertexAttribI2uivEXT){this->m_orig_glVertexAttribI2uivEXT = this->m_ptr_glVertexAttribI2uivEXT;this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI2uivEXT_validation;}
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT){this->m_orig_glNamedProgramLocalParameter4fvEXT = this->m_ptr_glNamedProgramLocalParameter4fvEXT;this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameter4fvEXT_validation;}
+if(this->m_ptr_glColor3usv){this->m_orig_glColor3usv = this->m_ptr_glColor3usv;this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&ValidationTableDecorator::m_glColor3usv_validation;}
+if(this->m_ptr_glGetPixelTransformParameterfvEXT){this->m_orig_glGetPixelTransformParameterfvEXT = this->m_ptr_glGetPixelTransformParameterfvEXT;this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetPixelTransformParameterfvEXT_validation;}
+if(this->m_ptr_glIndexxvOES){this->m_orig_glIndexxvOES = this->m_ptr_glIndexxvOES;this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&ValidationTableDecorator::m_glIndexxvOES_validation;}
+if(this->m_ptr_glDepthMask){this->m_orig_glDepthMask = this->m_ptr_glDepthMask;this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&ValidationTableDecorator::m_glDepthMask_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x4fv){this->m_orig_glProgramUniformMatrix2x4fv = this->m_ptr_glProgramUniformMatrix2x4fv;this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x4fv_validation;}
+if(this->m_ptr_glAreProgramsResidentNV){this->m_orig_glAreProgramsResidentNV = this->m_ptr_glAreProgramsResidentNV;this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&ValidationTableDecorator::m_glAreProgramsResidentNV_validation;}
+if(this->m_ptr_glColorTable){this->m_orig_glColorTable = this->m_ptr_glColorTable;this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&ValidationTableDecorator::m_glColorTable_validation;}
+if(this->m_ptr_glBeginQueryIndexed){this->m_orig_glBeginQueryIndexed = this->m_ptr_glBeginQueryIndexed;this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&ValidationTableDecorator::m_glBeginQueryIndexed_validation;}
+if(this->m_ptr_glVertexStream1dvATI){this->m_orig_glVertexStream1dvATI = this->m_ptr_glVertexStream1dvATI;this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&ValidationTableDecorator::m_glVertexStream1dvATI_validation;}
+if(this->m_ptr_glGetMultiTexEnvfvEXT){this->m_orig_glGetMultiTexEnvfvEXT = this->m_ptr_glGetMultiTexEnvfvEXT;this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexEnvfvEXT_validation;}
+if(this->m_ptr_glDeleteFencesNV){this->m_orig_glDeleteFencesNV = this->m_ptr_glDeleteFencesNV;this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&ValidationTableDecorator::m_glDeleteFencesNV_validation;}
+if(this->m_ptr_glVertexAttribs1dvNV){this->m_orig_glVertexAttribs1dvNV = this->m_ptr_glVertexAttribs1dvNV;this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&ValidationTableDecorator::m_glVertexAttribs1dvNV_validation;}
+if(this->m_ptr_glBufferStorageExternalEXT){this->m_orig_glBufferStorageExternalEXT = this->m_ptr_glBufferStorageExternalEXT;this->m_ptr_glBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC)&ValidationTableDecorator::m_glBufferStorageExternalEXT_validation;}
+if(this->m_ptr_glVertexStream2sATI){this->m_orig_glVertexStream2sATI = this->m_ptr_glVertexStream2sATI;this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&ValidationTableDecorator::m_glVertexStream2sATI_validation;}
+if(this->m_ptr_glGetnSeparableFilterARB){this->m_orig_glGetnSeparableFilterARB = this->m_ptr_glGetnSeparableFilterARB;this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&ValidationTableDecorator::m_glGetnSeparableFilterARB_validation;}
+if(this->m_ptr_glProgramUniform2dv){this->m_orig_glProgramUniform2dv = this->m_ptr_glProgramUniform2dv;this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&ValidationTableDecorator::m_glProgramUniform2dv_validation;}
+if(this->m_ptr_glActiveStencilFaceEXT){this->m_orig_glActiveStencilFaceEXT = this->m_ptr_glActiveStencilFaceEXT;this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&ValidationTableDecorator::m_glActiveStencilFaceEXT_validation;}
+if(this->m_ptr_glProgramUniform4dEXT){this->m_orig_glProgramUniform4dEXT = this->m_ptr_glProgramUniform4dEXT;this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&ValidationTableDecorator::m_glProgramUniform4dEXT_validation;}
+if(this->m_ptr_glPointSizexOES){this->m_orig_glPointSizexOES = this->m_ptr_glPointSizexOES;this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&ValidationTableDecorator::m_glPointSizexOES_validation;}
+if(this->m_ptr_glRasterPos2sv){this->m_orig_glRasterPos2sv = this->m_ptr_glRasterPos2sv;this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&ValidationTableDecorator::m_glRasterPos2sv_validation;}
+if(this->m_ptr_glBindParameterEXT){this->m_orig_glBindParameterEXT = this->m_ptr_glBindParameterEXT;this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&ValidationTableDecorator::m_glBindParameterEXT_validation;}
+if(this->m_ptr_glTexCoord1sv){this->m_orig_glTexCoord1sv = this->m_ptr_glTexCoord1sv;this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&ValidationTableDecorator::m_glTexCoord1sv_validation;}
+if(this->m_ptr_glBlendParameteriNV){this->m_orig_glBlendParameteriNV = this->m_ptr_glBlendParameteriNV;this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&ValidationTableDecorator::m_glBlendParameteriNV_validation;}
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT){this->m_orig_glNamedProgramLocalParameter4dvEXT = this->m_ptr_glNamedProgramLocalParameter4dvEXT;this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameter4dvEXT_validation;}
+if(this->m_ptr_glProgramUniformHandleui64NV){this->m_orig_glProgramUniformHandleui64NV = this->m_ptr_glProgramUniformHandleui64NV;this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&ValidationTableDecorator::m_glProgramUniformHandleui64NV_validation;}
+if(this->m_ptr_glGetTextureParameterfvEXT){this->m_orig_glGetTextureParameterfvEXT = this->m_ptr_glGetTextureParameterfvEXT;this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetTextureParameterfvEXT_validation;}
+if(this->m_ptr_glGetPathMetricsNV){this->m_orig_glGetPathMetricsNV = this->m_ptr_glGetPathMetricsNV;this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&ValidationTableDecorator::m_glGetPathMetricsNV_validation;}
+if(this->m_ptr_glVertex2i){this->m_orig_glVertex2i = this->m_ptr_glVertex2i;this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&ValidationTableDecorator::m_glVertex2i_validation;}
+if(this->m_ptr_glNewList){this->m_orig_glNewList = this->m_ptr_glNewList;this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&ValidationTableDecorator::m_glNewList_validation;}
+if(this->m_ptr_glMatrixLoad3x3fNV){this->m_orig_glMatrixLoad3x3fNV = this->m_ptr_glMatrixLoad3x3fNV;this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&ValidationTableDecorator::m_glMatrixLoad3x3fNV_validation;}
+if(this->m_ptr_glMultiTexCoord2fARB){this->m_orig_glMultiTexCoord2fARB = this->m_ptr_glMultiTexCoord2fARB;this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2fARB_validation;}
+if(this->m_ptr_glWeightdvARB){this->m_orig_glWeightdvARB = this->m_ptr_glWeightdvARB;this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&ValidationTableDecorator::m_glWeightdvARB_validation;}
+if(this->m_ptr_glIsTransformFeedbackNV){this->m_orig_glIsTransformFeedbackNV = this->m_ptr_glIsTransformFeedbackNV;this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glIsTransformFeedbackNV_validation;}
+if(this->m_ptr_glVertexAttribDivisorARB){this->m_orig_glVertexAttribDivisorARB = this->m_ptr_glVertexAttribDivisorARB;this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&ValidationTableDecorator::m_glVertexAttribDivisorARB_validation;}
+if(this->m_ptr_glSecondaryColorP3uiv){this->m_orig_glSecondaryColorP3uiv = this->m_ptr_glSecondaryColorP3uiv;this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&ValidationTableDecorator::m_glSecondaryColorP3uiv_validation;}
+if(this->m_ptr_glGetnCompressedTexImageARB){this->m_orig_glGetnCompressedTexImageARB = this->m_ptr_glGetnCompressedTexImageARB;this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&ValidationTableDecorator::m_glGetnCompressedTexImageARB_validation;}
+if(this->m_ptr_glGetIntegerv){this->m_orig_glGetIntegerv = this->m_ptr_glGetIntegerv;this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&ValidationTableDecorator::m_glGetIntegerv_validation;}
+if(this->m_ptr_glMatrixLoaddEXT){this->m_orig_glMatrixLoaddEXT = this->m_ptr_glMatrixLoaddEXT;this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&ValidationTableDecorator::m_glMatrixLoaddEXT_validation;}
+if(this->m_ptr_glGetPathLengthNV){this->m_orig_glGetPathLengthNV = this->m_ptr_glGetPathLengthNV;this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&ValidationTableDecorator::m_glGetPathLengthNV_validation;}
+if(this->m_ptr_glProgramUniformMatrix3dv){this->m_orig_glProgramUniformMatrix3dv = this->m_ptr_glProgramUniformMatrix3dv;this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3dv_validation;}
+if(this->m_ptr_glUniform4i64NV){this->m_orig_glUniform4i64NV = this->m_ptr_glUniform4i64NV;this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&ValidationTableDecorator::m_glUniform4i64NV_validation;}
+if(this->m_ptr_glGetHistogramEXT){this->m_orig_glGetHistogramEXT = this->m_ptr_glGetHistogramEXT;this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&ValidationTableDecorator::m_glGetHistogramEXT_validation;}
+if(this->m_ptr_glVertexAttrib4NuivARB){this->m_orig_glVertexAttrib4NuivARB = this->m_ptr_glVertexAttrib4NuivARB;this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NuivARB_validation;}
+if(this->m_ptr_glMapGrid2xOES){this->m_orig_glMapGrid2xOES = this->m_ptr_glMapGrid2xOES;this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&ValidationTableDecorator::m_glMapGrid2xOES_validation;}
+if(this->m_ptr_glTexImage2D){this->m_orig_glTexImage2D = this->m_ptr_glTexImage2D;this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&ValidationTableDecorator::m_glTexImage2D_validation;}
+if(this->m_ptr_glWindowPos2fvARB){this->m_orig_glWindowPos2fvARB = this->m_ptr_glWindowPos2fvARB;this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&ValidationTableDecorator::m_glWindowPos2fvARB_validation;}
+if(this->m_ptr_glEnableIndexedEXT){this->m_orig_glEnableIndexedEXT = this->m_ptr_glEnableIndexedEXT;this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&ValidationTableDecorator::m_glEnableIndexedEXT_validation;}
+if(this->m_ptr_glTexCoord1bvOES){this->m_orig_glTexCoord1bvOES = this->m_ptr_glTexCoord1bvOES;this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&ValidationTableDecorator::m_glTexCoord1bvOES_validation;}
+if(this->m_ptr_glDrawPixels){this->m_orig_glDrawPixels = this->m_ptr_glDrawPixels;this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&ValidationTableDecorator::m_glDrawPixels_validation;}
+if(this->m_ptr_glMultMatrixd){this->m_orig_glMultMatrixd = this->m_ptr_glMultMatrixd;this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&ValidationTableDecorator::m_glMultMatrixd_validation;}
+if(this->m_ptr_glMultMatrixf){this->m_orig_glMultMatrixf = this->m_ptr_glMultMatrixf;this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&ValidationTableDecorator::m_glMultMatrixf_validation;}
+if(this->m_ptr_glReplacementCodePointerSUN){this->m_orig_glReplacementCodePointerSUN = this->m_ptr_glReplacementCodePointerSUN;this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&ValidationTableDecorator::m_glReplacementCodePointerSUN_validation;}
+if(this->m_ptr_glLoadTransposeMatrixdARB){this->m_orig_glLoadTransposeMatrixdARB = this->m_ptr_glLoadTransposeMatrixdARB;this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&ValidationTableDecorator::m_glLoadTransposeMatrixdARB_validation;}
+if(this->m_ptr_glVertexAttrib4Nubv){this->m_orig_glVertexAttrib4Nubv = this->m_ptr_glVertexAttrib4Nubv;this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&ValidationTableDecorator::m_glVertexAttrib4Nubv_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT){this->m_orig_glVertexArrayVertexAttribIOffsetEXT = this->m_ptr_glVertexArrayVertexAttribIOffsetEXT;this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_validation;}
+if(this->m_ptr_glCompileShaderARB){this->m_orig_glCompileShaderARB = this->m_ptr_glCompileShaderARB;this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&ValidationTableDecorator::m_glCompileShaderARB_validation;}
+if(this->m_ptr_glWindowPos3dMESA){this->m_orig_glWindowPos3dMESA = this->m_ptr_glWindowPos3dMESA;this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&ValidationTableDecorator::m_glWindowPos3dMESA_validation;}
+if(this->m_ptr_glNormalStream3fvATI){this->m_orig_glNormalStream3fvATI = this->m_ptr_glNormalStream3fvATI;this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&ValidationTableDecorator::m_glNormalStream3fvATI_validation;}
+if(this->m_ptr_glColor4usv){this->m_orig_glColor4usv = this->m_ptr_glColor4usv;this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&ValidationTableDecorator::m_glColor4usv_validation;}
+if(this->m_ptr_glMapGrid1f){this->m_orig_glMapGrid1f = this->m_ptr_glMapGrid1f;this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&ValidationTableDecorator::m_glMapGrid1f_validation;}
+if(this->m_ptr_glPolygonStipple){this->m_orig_glPolygonStipple = this->m_ptr_glPolygonStipple;this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&ValidationTableDecorator::m_glPolygonStipple_validation;}
+if(this->m_ptr_glUniform4ui64ARB){this->m_orig_glUniform4ui64ARB = this->m_ptr_glUniform4ui64ARB;this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&ValidationTableDecorator::m_glUniform4ui64ARB_validation;}
+if(this->m_ptr_glTextureRenderbufferEXT){this->m_orig_glTextureRenderbufferEXT = this->m_ptr_glTextureRenderbufferEXT;this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&ValidationTableDecorator::m_glTextureRenderbufferEXT_validation;}
+if(this->m_ptr_glGetSubroutineUniformLocation){this->m_orig_glGetSubroutineUniformLocation = this->m_ptr_glGetSubroutineUniformLocation;this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&ValidationTableDecorator::m_glGetSubroutineUniformLocation_validation;}
+if(this->m_ptr_glGetFramebufferParameteriv){this->m_orig_glGetFramebufferParameteriv = this->m_ptr_glGetFramebufferParameteriv;this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetFramebufferParameteriv_validation;}
+if(this->m_ptr_glPixelMapusv){this->m_orig_glPixelMapusv = this->m_ptr_glPixelMapusv;this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&ValidationTableDecorator::m_glPixelMapusv_validation;}
+if(this->m_ptr_glGetSamplerParameteriv){this->m_orig_glGetSamplerParameteriv = this->m_ptr_glGetSamplerParameteriv;this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetSamplerParameteriv_validation;}
+if(this->m_ptr_glVertexStream2fvATI){this->m_orig_glVertexStream2fvATI = this->m_ptr_glVertexStream2fvATI;this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&ValidationTableDecorator::m_glVertexStream2fvATI_validation;}
+if(this->m_ptr_glProgramStringARB){this->m_orig_glProgramStringARB = this->m_ptr_glProgramStringARB;this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&ValidationTableDecorator::m_glProgramStringARB_validation;}
+if(this->m_ptr_glProgramUniformMatrix3dvEXT){this->m_orig_glProgramUniformMatrix3dvEXT = this->m_ptr_glProgramUniformMatrix3dvEXT;this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3dvEXT_validation;}
+if(this->m_ptr_glSeparableFilter2D){this->m_orig_glSeparableFilter2D = this->m_ptr_glSeparableFilter2D;this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&ValidationTableDecorator::m_glSeparableFilter2D_validation;}
+if(this->m_ptr_glVertexAttribI1uiv){this->m_orig_glVertexAttribI1uiv = this->m_ptr_glVertexAttribI1uiv;this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&ValidationTableDecorator::m_glVertexAttribI1uiv_validation;}
+if(this->m_ptr_glLGPUCopyImageSubDataNVX){this->m_orig_glLGPUCopyImageSubDataNVX = this->m_ptr_glLGPUCopyImageSubDataNVX;this->m_ptr_glLGPUCopyImageSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC)&ValidationTableDecorator::m_glLGPUCopyImageSubDataNVX_validation;}
+if(this->m_ptr_glTexStorage2D){this->m_orig_glTexStorage2D = this->m_ptr_glTexStorage2D;this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&ValidationTableDecorator::m_glTexStorage2D_validation;}
+if(this->m_ptr_glColor3fv){this->m_orig_glColor3fv = this->m_ptr_glColor3fv;this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&ValidationTableDecorator::m_glColor3fv_validation;}
+if(this->m_ptr_glGetMultiTexGendvEXT){this->m_orig_glGetMultiTexGendvEXT = this->m_ptr_glGetMultiTexGendvEXT;this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexGendvEXT_validation;}
+if(this->m_ptr_glVertexAttribL4dvEXT){this->m_orig_glVertexAttribL4dvEXT = this->m_ptr_glVertexAttribL4dvEXT;this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&ValidationTableDecorator::m_glVertexAttribL4dvEXT_validation;}
+if(this->m_ptr_glGetActiveUniform){this->m_orig_glGetActiveUniform = this->m_ptr_glGetActiveUniform;this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&ValidationTableDecorator::m_glGetActiveUniform_validation;}
+if(this->m_ptr_glUniform2ui64vARB){this->m_orig_glUniform2ui64vARB = this->m_ptr_glUniform2ui64vARB;this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&ValidationTableDecorator::m_glUniform2ui64vARB_validation;}
+if(this->m_ptr_glMakeNamedBufferResidentNV){this->m_orig_glMakeNamedBufferResidentNV = this->m_ptr_glMakeNamedBufferResidentNV;this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&ValidationTableDecorator::m_glMakeNamedBufferResidentNV_validation;}
+if(this->m_ptr_glPathGlyphIndexRangeNV){this->m_orig_glPathGlyphIndexRangeNV = this->m_ptr_glPathGlyphIndexRangeNV;this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&ValidationTableDecorator::m_glPathGlyphIndexRangeNV_validation;}
+if(this->m_ptr_glColorPointer){this->m_orig_glColorPointer = this->m_ptr_glColorPointer;this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&ValidationTableDecorator::m_glColorPointer_validation;}
+if(this->m_ptr_glProgramEnvParameterI4ivNV){this->m_orig_glProgramEnvParameterI4ivNV = this->m_ptr_glProgramEnvParameterI4ivNV;this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&ValidationTableDecorator::m_glProgramEnvParameterI4ivNV_validation;}
+if(this->m_ptr_glMulticastGetQueryObjectui64vNV){this->m_orig_glMulticastGetQueryObjectui64vNV = this->m_ptr_glMulticastGetQueryObjectui64vNV;this->m_ptr_glMulticastGetQueryObjectui64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)&ValidationTableDecorator::m_glMulticastGetQueryObjectui64vNV_validation;}
+if(this->m_ptr_glMultiTexParameterfEXT){this->m_orig_glMultiTexParameterfEXT = this->m_ptr_glMultiTexParameterfEXT;this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&ValidationTableDecorator::m_glMultiTexParameterfEXT_validation;}
+if(this->m_ptr_glNamedFramebufferTextureLayer){this->m_orig_glNamedFramebufferTextureLayer = this->m_ptr_glNamedFramebufferTextureLayer;this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&ValidationTableDecorator::m_glNamedFramebufferTextureLayer_validation;}
+if(this->m_ptr_glGetVertexArrayIntegervEXT){this->m_orig_glGetVertexArrayIntegervEXT = this->m_ptr_glGetVertexArrayIntegervEXT;this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&ValidationTableDecorator::m_glGetVertexArrayIntegervEXT_validation;}
+if(this->m_ptr_glVertexAttrib3dARB){this->m_orig_glVertexAttrib3dARB = this->m_ptr_glVertexAttrib3dARB;this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&ValidationTableDecorator::m_glVertexAttrib3dARB_validation;}
+if(this->m_ptr_glVDPAUIsSurfaceNV){this->m_orig_glVDPAUIsSurfaceNV = this->m_ptr_glVDPAUIsSurfaceNV;this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&ValidationTableDecorator::m_glVDPAUIsSurfaceNV_validation;}
+if(this->m_ptr_glMultiTexImage1DEXT){this->m_orig_glMultiTexImage1DEXT = this->m_ptr_glMultiTexImage1DEXT;this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&ValidationTableDecorator::m_glMultiTexImage1DEXT_validation;}
+if(this->m_ptr_glIsAsyncMarkerSGIX){this->m_orig_glIsAsyncMarkerSGIX = this->m_ptr_glIsAsyncMarkerSGIX;this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&ValidationTableDecorator::m_glIsAsyncMarkerSGIX_validation;}
+if(this->m_ptr_glGetDoublei_vEXT){this->m_orig_glGetDoublei_vEXT = this->m_ptr_glGetDoublei_vEXT;this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&ValidationTableDecorator::m_glGetDoublei_vEXT_validation;}
+if(this->m_ptr_glUniform2i64NV){this->m_orig_glUniform2i64NV = this->m_ptr_glUniform2i64NV;this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&ValidationTableDecorator::m_glUniform2i64NV_validation;}
+if(this->m_ptr_glIsCommandListNV){this->m_orig_glIsCommandListNV = this->m_ptr_glIsCommandListNV;this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&ValidationTableDecorator::m_glIsCommandListNV_validation;}
+if(this->m_ptr_glUniform3uiEXT){this->m_orig_glUniform3uiEXT = this->m_ptr_glUniform3uiEXT;this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&ValidationTableDecorator::m_glUniform3uiEXT_validation;}
+if(this->m_ptr_glTexParameterIuivEXT){this->m_orig_glTexParameterIuivEXT = this->m_ptr_glTexParameterIuivEXT;this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glTexParameterIuivEXT_validation;}
+if(this->m_ptr_glProgramUniformMatrix4fv){this->m_orig_glProgramUniformMatrix4fv = this->m_ptr_glProgramUniformMatrix4fv;this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4fv_validation;}
+if(this->m_ptr_glVertex2fv){this->m_orig_glVertex2fv = this->m_ptr_glVertex2fv;this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&ValidationTableDecorator::m_glVertex2fv_validation;}
+if(this->m_ptr_glVertexAttribL3dEXT){this->m_orig_glVertexAttribL3dEXT = this->m_ptr_glVertexAttribL3dEXT;this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&ValidationTableDecorator::m_glVertexAttribL3dEXT_validation;}
+if(this->m_ptr_glFramebufferRenderbuffer){this->m_orig_glFramebufferRenderbuffer = this->m_ptr_glFramebufferRenderbuffer;this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&ValidationTableDecorator::m_glFramebufferRenderbuffer_validation;}
+if(this->m_ptr_glGetUniformLocationARB){this->m_orig_glGetUniformLocationARB = this->m_ptr_glGetUniformLocationARB;this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&ValidationTableDecorator::m_glGetUniformLocationARB_validation;}
+if(this->m_ptr_glPathParameterfvNV){this->m_orig_glPathParameterfvNV = this->m_ptr_glPathParameterfvNV;this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&ValidationTableDecorator::m_glPathParameterfvNV_validation;}
+if(this->m_ptr_glVertexAttrib3sNV){this->m_orig_glVertexAttrib3sNV = this->m_ptr_glVertexAttrib3sNV;this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&ValidationTableDecorator::m_glVertexAttrib3sNV_validation;}
+if(this->m_ptr_glGetDoublei_v){this->m_orig_glGetDoublei_v = this->m_ptr_glGetDoublei_v;this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&ValidationTableDecorator::m_glGetDoublei_v_validation;}
+if(this->m_ptr_glVertexAttrib1sv){this->m_orig_glVertexAttrib1sv = this->m_ptr_glVertexAttrib1sv;this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&ValidationTableDecorator::m_glVertexAttrib1sv_validation;}
+if(this->m_ptr_glBindSampler){this->m_orig_glBindSampler = this->m_ptr_glBindSampler;this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&ValidationTableDecorator::m_glBindSampler_validation;}
+if(this->m_ptr_glLineWidth){this->m_orig_glLineWidth = this->m_ptr_glLineWidth;this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&ValidationTableDecorator::m_glLineWidth_validation;}
+if(this->m_ptr_glVertexArrayRangeAPPLE){this->m_orig_glVertexArrayRangeAPPLE = this->m_ptr_glVertexArrayRangeAPPLE;this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&ValidationTableDecorator::m_glVertexArrayRangeAPPLE_validation;}
+if(this->m_ptr_glBindBufferOffsetEXT){this->m_orig_glBindBufferOffsetEXT = this->m_ptr_glBindBufferOffsetEXT;this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&ValidationTableDecorator::m_glBindBufferOffsetEXT_validation;}
+if(this->m_ptr_glWeightfvARB){this->m_orig_glWeightfvARB = this->m_ptr_glWeightfvARB;this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&ValidationTableDecorator::m_glWeightfvARB_validation;}
+if(this->m_ptr_glGetIntegeri_v){this->m_orig_glGetIntegeri_v = this->m_ptr_glGetIntegeri_v;this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&ValidationTableDecorator::m_glGetIntegeri_v_validation;}
+if(this->m_ptr_glGetTransformFeedbackVarying){this->m_orig_glGetTransformFeedbackVarying = this->m_ptr_glGetTransformFeedbackVarying;this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&ValidationTableDecorator::m_glGetTransformFeedbackVarying_validation;}
+if(this->m_ptr_glProgramLocalParameter4fvARB){this->m_orig_glProgramLocalParameter4fvARB = this->m_ptr_glProgramLocalParameter4fvARB;this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&ValidationTableDecorator::m_glProgramLocalParameter4fvARB_validation;}
+if(this->m_ptr_glGetTransformFeedbackVaryingNV){this->m_orig_glGetTransformFeedbackVaryingNV = this->m_ptr_glGetTransformFeedbackVaryingNV;this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&ValidationTableDecorator::m_glGetTransformFeedbackVaryingNV_validation;}
+if(this->m_ptr_glWindowPos2iv){this->m_orig_glWindowPos2iv = this->m_ptr_glWindowPos2iv;this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&ValidationTableDecorator::m_glWindowPos2iv_validation;}
+if(this->m_ptr_glVertexStream1dATI){this->m_orig_glVertexStream1dATI = this->m_ptr_glVertexStream1dATI;this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&ValidationTableDecorator::m_glVertexStream1dATI_validation;}
+if(this->m_ptr_glColorFragmentOp2ATI){this->m_orig_glColorFragmentOp2ATI = this->m_ptr_glColorFragmentOp2ATI;this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&ValidationTableDecorator::m_glColorFragmentOp2ATI_validation;}
+if(this->m_ptr_glFogiv){this->m_orig_glFogiv = this->m_ptr_glFogiv;this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&ValidationTableDecorator::m_glFogiv_validation;}
+if(this->m_ptr_glGetTextureHandleNV){this->m_orig_glGetTextureHandleNV = this->m_ptr_glGetTextureHandleNV;this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&ValidationTableDecorator::m_glGetTextureHandleNV_validation;}
+if(this->m_ptr_glLightModeliv){this->m_orig_glLightModeliv = this->m_ptr_glLightModeliv;this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&ValidationTableDecorator::m_glLightModeliv_validation;}
+if(this->m_ptr_glDepthRangef){this->m_orig_glDepthRangef = this->m_ptr_glDepthRangef;this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&ValidationTableDecorator::m_glDepthRangef_validation;}
+if(this->m_ptr_glGetFragmentMaterialivSGIX){this->m_orig_glGetFragmentMaterialivSGIX = this->m_ptr_glGetFragmentMaterialivSGIX;this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&ValidationTableDecorator::m_glGetFragmentMaterialivSGIX_validation;}
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV){this->m_orig_glVideoCaptureStreamParameterfvNV = this->m_ptr_glVideoCaptureStreamParameterfvNV;this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&ValidationTableDecorator::m_glVideoCaptureStreamParameterfvNV_validation;}
+if(this->m_ptr_glDeleteProgramsARB){this->m_orig_glDeleteProgramsARB = this->m_ptr_glDeleteProgramsARB;this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&ValidationTableDecorator::m_glDeleteProgramsARB_validation;}
+if(this->m_ptr_glWindowPos3fvARB){this->m_orig_glWindowPos3fvARB = this->m_ptr_glWindowPos3fvARB;this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&ValidationTableDecorator::m_glWindowPos3fvARB_validation;}
+if(this->m_ptr_glFeedbackBufferxOES){this->m_orig_glFeedbackBufferxOES = this->m_ptr_glFeedbackBufferxOES;this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&ValidationTableDecorator::m_glFeedbackBufferxOES_validation;}
+if(this->m_ptr_glGetTexBumpParameterfvATI){this->m_orig_glGetTexBumpParameterfvATI = this->m_ptr_glGetTexBumpParameterfvATI;this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&ValidationTableDecorator::m_glGetTexBumpParameterfvATI_validation;}
+if(this->m_ptr_glEnablei){this->m_orig_glEnablei = this->m_ptr_glEnablei;this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&ValidationTableDecorator::m_glEnablei_validation;}
+if(this->m_ptr_glGetActiveSubroutineName){this->m_orig_glGetActiveSubroutineName = this->m_ptr_glGetActiveSubroutineName;this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&ValidationTableDecorator::m_glGetActiveSubroutineName_validation;}
+if(this->m_ptr_glDrawBuffersARB){this->m_orig_glDrawBuffersARB = this->m_ptr_glDrawBuffersARB;this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&ValidationTableDecorator::m_glDrawBuffersARB_validation;}
+if(this->m_ptr_glBindProgramARB){this->m_orig_glBindProgramARB = this->m_ptr_glBindProgramARB;this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&ValidationTableDecorator::m_glBindProgramARB_validation;}
+if(this->m_ptr_glEvalCoord1fv){this->m_orig_glEvalCoord1fv = this->m_ptr_glEvalCoord1fv;this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&ValidationTableDecorator::m_glEvalCoord1fv_validation;}
+if(this->m_ptr_glProgramUniform3ui64vARB){this->m_orig_glProgramUniform3ui64vARB = this->m_ptr_glProgramUniform3ui64vARB;this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&ValidationTableDecorator::m_glProgramUniform3ui64vARB_validation;}
+if(this->m_ptr_glProgramUniformMatrix2dv){this->m_orig_glProgramUniformMatrix2dv = this->m_ptr_glProgramUniformMatrix2dv;this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2dv_validation;}
+if(this->m_ptr_glMultiTexCoord2hvNV){this->m_orig_glMultiTexCoord2hvNV = this->m_ptr_glMultiTexCoord2hvNV;this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&ValidationTableDecorator::m_glMultiTexCoord2hvNV_validation;}
+if(this->m_ptr_glGetFloatIndexedvEXT){this->m_orig_glGetFloatIndexedvEXT = this->m_ptr_glGetFloatIndexedvEXT;this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&ValidationTableDecorator::m_glGetFloatIndexedvEXT_validation;}
+if(this->m_ptr_glSampleCoverageARB){this->m_orig_glSampleCoverageARB = this->m_ptr_glSampleCoverageARB;this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&ValidationTableDecorator::m_glSampleCoverageARB_validation;}
+if(this->m_ptr_glProgramUniform2ui64vARB){this->m_orig_glProgramUniform2ui64vARB = this->m_ptr_glProgramUniform2ui64vARB;this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&ValidationTableDecorator::m_glProgramUniform2ui64vARB_validation;}
+if(this->m_ptr_glPixelDataRangeNV){this->m_orig_glPixelDataRangeNV = this->m_ptr_glPixelDataRangeNV;this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&ValidationTableDecorator::m_glPixelDataRangeNV_validation;}
+if(this->m_ptr_glVertexStream3svATI){this->m_orig_glVertexStream3svATI = this->m_ptr_glVertexStream3svATI;this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&ValidationTableDecorator::m_glVertexStream3svATI_validation;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN){this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glTexCoord3hvNV){this->m_orig_glTexCoord3hvNV = this->m_ptr_glTexCoord3hvNV;this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&ValidationTableDecorator::m_glTexCoord3hvNV_validation;}
+if(this->m_ptr_glSampleMaski){this->m_orig_glSampleMaski = this->m_ptr_glSampleMaski;this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&ValidationTableDecorator::m_glSampleMaski_validation;}
+if(this->m_ptr_glIndexFuncEXT){this->m_orig_glIndexFuncEXT = this->m_ptr_glIndexFuncEXT;this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&ValidationTableDecorator::m_glIndexFuncEXT_validation;}
+if(this->m_ptr_glPointParameteriNV){this->m_orig_glPointParameteriNV = this->m_ptr_glPointParameteriNV;this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&ValidationTableDecorator::m_glPointParameteriNV_validation;}
+if(this->m_ptr_glUniformMatrix3x2fv){this->m_orig_glUniformMatrix3x2fv = this->m_ptr_glUniformMatrix3x2fv;this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&ValidationTableDecorator::m_glUniformMatrix3x2fv_validation;}
+if(this->m_ptr_glGetFramebufferParameterivEXT){this->m_orig_glGetFramebufferParameterivEXT = this->m_ptr_glGetFramebufferParameterivEXT;this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetFramebufferParameterivEXT_validation;}
+if(this->m_ptr_glUniform2i64ARB){this->m_orig_glUniform2i64ARB = this->m_ptr_glUniform2i64ARB;this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&ValidationTableDecorator::m_glUniform2i64ARB_validation;}
+if(this->m_ptr_glNamedBufferStorageEXT){this->m_orig_glNamedBufferStorageEXT = this->m_ptr_glNamedBufferStorageEXT;this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&ValidationTableDecorator::m_glNamedBufferStorageEXT_validation;}
+if(this->m_ptr_glNamedFramebufferTexture3DEXT){this->m_orig_glNamedFramebufferTexture3DEXT = this->m_ptr_glNamedFramebufferTexture3DEXT;this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&ValidationTableDecorator::m_glNamedFramebufferTexture3DEXT_validation;}
+if(this->m_ptr_glVertexAttrib2dv){this->m_orig_glVertexAttrib2dv = this->m_ptr_glVertexAttrib2dv;this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&ValidationTableDecorator::m_glVertexAttrib2dv_validation;}
+if(this->m_ptr_glGetVertexArrayPointervEXT){this->m_orig_glGetVertexArrayPointervEXT = this->m_ptr_glGetVertexArrayPointervEXT;this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&ValidationTableDecorator::m_glGetVertexArrayPointervEXT_validation;}
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI){this->m_orig_glGetVertexAttribArrayObjectivATI = this->m_ptr_glGetVertexAttribArrayObjectivATI;this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&ValidationTableDecorator::m_glGetVertexAttribArrayObjectivATI_validation;}
+if(this->m_ptr_glProgramUniformMatrix3fvEXT){this->m_orig_glProgramUniformMatrix3fvEXT = this->m_ptr_glProgramUniformMatrix3fvEXT;this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3fvEXT_validation;}
+if(this->m_ptr_glEnableVertexArrayEXT){this->m_orig_glEnableVertexArrayEXT = this->m_ptr_glEnableVertexArrayEXT;this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&ValidationTableDecorator::m_glEnableVertexArrayEXT_validation;}
+if(this->m_ptr_glColorTableParameterfvSGI){this->m_orig_glColorTableParameterfvSGI = this->m_ptr_glColorTableParameterfvSGI;this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&ValidationTableDecorator::m_glColorTableParameterfvSGI_validation;}
+if(this->m_ptr_glEdgeFlag){this->m_orig_glEdgeFlag = this->m_ptr_glEdgeFlag;this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&ValidationTableDecorator::m_glEdgeFlag_validation;}
+if(this->m_ptr_glFogCoordf){this->m_orig_glFogCoordf = this->m_ptr_glFogCoordf;this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&ValidationTableDecorator::m_glFogCoordf_validation;}
+if(this->m_ptr_glVertex3d){this->m_orig_glVertex3d = this->m_ptr_glVertex3d;this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&ValidationTableDecorator::m_glVertex3d_validation;}
+if(this->m_ptr_glVertex3f){this->m_orig_glVertex3f = this->m_ptr_glVertex3f;this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&ValidationTableDecorator::m_glVertex3f_validation;}
+if(this->m_ptr_glSpriteParameterivSGIX){this->m_orig_glSpriteParameterivSGIX = this->m_ptr_glSpriteParameterivSGIX;this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&ValidationTableDecorator::m_glSpriteParameterivSGIX_validation;}
+if(this->m_ptr_glPathGlyphRangeNV){this->m_orig_glPathGlyphRangeNV = this->m_ptr_glPathGlyphRangeNV;this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&ValidationTableDecorator::m_glPathGlyphRangeNV_validation;}
+if(this->m_ptr_glPrimitiveBoundingBoxARB){this->m_orig_glPrimitiveBoundingBoxARB = this->m_ptr_glPrimitiveBoundingBoxARB;this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&ValidationTableDecorator::m_glPrimitiveBoundingBoxARB_validation;}
+if(this->m_ptr_glVertexAttribL3ui64vNV){this->m_orig_glVertexAttribL3ui64vNV = this->m_ptr_glVertexAttribL3ui64vNV;this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL3ui64vNV_validation;}
+if(this->m_ptr_glVertex3s){this->m_orig_glVertex3s = this->m_ptr_glVertex3s;this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&ValidationTableDecorator::m_glVertex3s_validation;}
+if(this->m_ptr_glTexCoordP2ui){this->m_orig_glTexCoordP2ui = this->m_ptr_glTexCoordP2ui;this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&ValidationTableDecorator::m_glTexCoordP2ui_validation;}
+if(this->m_ptr_glProgramUniform2fvEXT){this->m_orig_glProgramUniform2fvEXT = this->m_ptr_glProgramUniform2fvEXT;this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&ValidationTableDecorator::m_glProgramUniform2fvEXT_validation;}
+if(this->m_ptr_glDeletePathsNV){this->m_orig_glDeletePathsNV = this->m_ptr_glDeletePathsNV;this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&ValidationTableDecorator::m_glDeletePathsNV_validation;}
+if(this->m_ptr_glPrimitiveRestartIndexNV){this->m_orig_glPrimitiveRestartIndexNV = this->m_ptr_glPrimitiveRestartIndexNV;this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&ValidationTableDecorator::m_glPrimitiveRestartIndexNV_validation;}
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN){this->m_orig_glTexCoord2fColor3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor3fVertex3fvSUN;this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_validation;}
+if(this->m_ptr_glTexCoordPointerListIBM){this->m_orig_glTexCoordPointerListIBM = this->m_ptr_glTexCoordPointerListIBM;this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glTexCoordPointerListIBM_validation;}
+if(this->m_ptr_glRectxOES){this->m_orig_glRectxOES = this->m_ptr_glRectxOES;this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&ValidationTableDecorator::m_glRectxOES_validation;}
+if(this->m_ptr_glCopyNamedBufferSubData){this->m_orig_glCopyNamedBufferSubData = this->m_ptr_glCopyNamedBufferSubData;this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glCopyNamedBufferSubData_validation;}
+if(this->m_ptr_glGenProgramsNV){this->m_orig_glGenProgramsNV = this->m_ptr_glGenProgramsNV;this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&ValidationTableDecorator::m_glGenProgramsNV_validation;}
+if(this->m_ptr_glFragmentLightfSGIX){this->m_orig_glFragmentLightfSGIX = this->m_ptr_glFragmentLightfSGIX;this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&ValidationTableDecorator::m_glFragmentLightfSGIX_validation;}
+if(this->m_ptr_glTexStorage3D){this->m_orig_glTexStorage3D = this->m_ptr_glTexStorage3D;this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&ValidationTableDecorator::m_glTexStorage3D_validation;}
+if(this->m_ptr_glTextureParameteriv){this->m_orig_glTextureParameteriv = this->m_ptr_glTextureParameteriv;this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&ValidationTableDecorator::m_glTextureParameteriv_validation;}
+if(this->m_ptr_glNamedBufferDataEXT){this->m_orig_glNamedBufferDataEXT = this->m_ptr_glNamedBufferDataEXT;this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&ValidationTableDecorator::m_glNamedBufferDataEXT_validation;}
+if(this->m_ptr_glImportSemaphoreWin32NameEXT){this->m_orig_glImportSemaphoreWin32NameEXT = this->m_ptr_glImportSemaphoreWin32NameEXT;this->m_ptr_glImportSemaphoreWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)&ValidationTableDecorator::m_glImportSemaphoreWin32NameEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3fvARB){this->m_orig_glMultiTexCoord3fvARB = this->m_ptr_glMultiTexCoord3fvARB;this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3fvARB_validation;}
+if(this->m_ptr_glUniformMatrix3x4fv){this->m_orig_glUniformMatrix3x4fv = this->m_ptr_glUniformMatrix3x4fv;this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&ValidationTableDecorator::m_glUniformMatrix3x4fv_validation;}
+if(this->m_ptr_glSubpixelPrecisionBiasNV){this->m_orig_glSubpixelPrecisionBiasNV = this->m_ptr_glSubpixelPrecisionBiasNV;this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&ValidationTableDecorator::m_glSubpixelPrecisionBiasNV_validation;}
+if(this->m_ptr_glNormalPointer){this->m_orig_glNormalPointer = this->m_ptr_glNormalPointer;this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&ValidationTableDecorator::m_glNormalPointer_validation;}
+if(this->m_ptr_glNamedFramebufferTexture){this->m_orig_glNamedFramebufferTexture = this->m_ptr_glNamedFramebufferTexture;this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&ValidationTableDecorator::m_glNamedFramebufferTexture_validation;}
+if(this->m_ptr_glVertexAttrib4NsvARB){this->m_orig_glVertexAttrib4NsvARB = this->m_ptr_glVertexAttrib4NsvARB;this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NsvARB_validation;}
+if(this->m_ptr_glPassThrough){this->m_orig_glPassThrough = this->m_ptr_glPassThrough;this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&ValidationTableDecorator::m_glPassThrough_validation;}
+if(this->m_ptr_glSecondaryColorP3ui){this->m_orig_glSecondaryColorP3ui = this->m_ptr_glSecondaryColorP3ui;this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&ValidationTableDecorator::m_glSecondaryColorP3ui_validation;}
+if(this->m_ptr_glInvalidateTexSubImage){this->m_orig_glInvalidateTexSubImage = this->m_ptr_glInvalidateTexSubImage;this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&ValidationTableDecorator::m_glInvalidateTexSubImage_validation;}
+if(this->m_ptr_glIsImageHandleResidentARB){this->m_orig_glIsImageHandleResidentARB = this->m_ptr_glIsImageHandleResidentARB;this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&ValidationTableDecorator::m_glIsImageHandleResidentARB_validation;}
+if(this->m_ptr_glTangent3fvEXT){this->m_orig_glTangent3fvEXT = this->m_ptr_glTangent3fvEXT;this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&ValidationTableDecorator::m_glTangent3fvEXT_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x3fv){this->m_orig_glProgramUniformMatrix4x3fv = this->m_ptr_glProgramUniformMatrix4x3fv;this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x3fv_validation;}
+if(this->m_ptr_glBegin){this->m_orig_glBegin = this->m_ptr_glBegin;this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&ValidationTableDecorator::m_glBegin_validation;}
+if(this->m_ptr_glEvalCoord2dv){this->m_orig_glEvalCoord2dv = this->m_ptr_glEvalCoord2dv;this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&ValidationTableDecorator::m_glEvalCoord2dv_validation;}
+if(this->m_ptr_glColor3ubv){this->m_orig_glColor3ubv = this->m_ptr_glColor3ubv;this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&ValidationTableDecorator::m_glColor3ubv_validation;}
+if(this->m_ptr_glFogCoordfvEXT){this->m_orig_glFogCoordfvEXT = this->m_ptr_glFogCoordfvEXT;this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&ValidationTableDecorator::m_glFogCoordfvEXT_validation;}
+if(this->m_ptr_glVertexP3ui){this->m_orig_glVertexP3ui = this->m_ptr_glVertexP3ui;this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&ValidationTableDecorator::m_glVertexP3ui_validation;}
+if(this->m_ptr_glLightfv){this->m_orig_glLightfv = this->m_ptr_glLightfv;this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&ValidationTableDecorator::m_glLightfv_validation;}
+if(this->m_ptr_glVertexAttribL3i64NV){this->m_orig_glVertexAttribL3i64NV = this->m_ptr_glVertexAttribL3i64NV;this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&ValidationTableDecorator::m_glVertexAttribL3i64NV_validation;}
+if(this->m_ptr_glStencilClearTagEXT){this->m_orig_glStencilClearTagEXT = this->m_ptr_glStencilClearTagEXT;this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&ValidationTableDecorator::m_glStencilClearTagEXT_validation;}
+if(this->m_ptr_glGetActiveUniformName){this->m_orig_glGetActiveUniformName = this->m_ptr_glGetActiveUniformName;this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&ValidationTableDecorator::m_glGetActiveUniformName_validation;}
+if(this->m_ptr_glTangentPointerEXT){this->m_orig_glTangentPointerEXT = this->m_ptr_glTangentPointerEXT;this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&ValidationTableDecorator::m_glTangentPointerEXT_validation;}
+if(this->m_ptr_glUniform4ui64vNV){this->m_orig_glUniform4ui64vNV = this->m_ptr_glUniform4ui64vNV;this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&ValidationTableDecorator::m_glUniform4ui64vNV_validation;}
+if(this->m_ptr_glDebugMessageEnableAMD){this->m_orig_glDebugMessageEnableAMD = this->m_ptr_glDebugMessageEnableAMD;this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&ValidationTableDecorator::m_glDebugMessageEnableAMD_validation;}
+if(this->m_ptr_glProgramUniform2ui){this->m_orig_glProgramUniform2ui = this->m_ptr_glProgramUniform2ui;this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&ValidationTableDecorator::m_glProgramUniform2ui_validation;}
+if(this->m_ptr_glCopyTexSubImage2DEXT){this->m_orig_glCopyTexSubImage2DEXT = this->m_ptr_glCopyTexSubImage2DEXT;this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCopyTexSubImage2DEXT_validation;}
+if(this->m_ptr_glGenRenderbuffersEXT){this->m_orig_glGenRenderbuffersEXT = this->m_ptr_glGenRenderbuffersEXT;this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&ValidationTableDecorator::m_glGenRenderbuffersEXT_validation;}
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT){this->m_orig_glNamedProgramLocalParameterI4ivEXT = this->m_ptr_glNamedProgramLocalParameterI4ivEXT;this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_validation;}
+if(this->m_ptr_glMultiTexCoord2f){this->m_orig_glMultiTexCoord2f = this->m_ptr_glMultiTexCoord2f;this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&ValidationTableDecorator::m_glMultiTexCoord2f_validation;}
+if(this->m_ptr_glMapGrid2d){this->m_orig_glMapGrid2d = this->m_ptr_glMapGrid2d;this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&ValidationTableDecorator::m_glMapGrid2d_validation;}
+if(this->m_ptr_glGetMultiTexParameterIuivEXT){this->m_orig_glGetMultiTexParameterIuivEXT = this->m_ptr_glGetMultiTexParameterIuivEXT;this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexParameterIuivEXT_validation;}
+if(this->m_ptr_glBlendEquationiARB){this->m_orig_glBlendEquationiARB = this->m_ptr_glBlendEquationiARB;this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&ValidationTableDecorator::m_glBlendEquationiARB_validation;}
+if(this->m_ptr_glTexParameteriv){this->m_orig_glTexParameteriv = this->m_ptr_glTexParameteriv;this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&ValidationTableDecorator::m_glTexParameteriv_validation;}
+if(this->m_ptr_glUniform4ivARB){this->m_orig_glUniform4ivARB = this->m_ptr_glUniform4ivARB;this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&ValidationTableDecorator::m_glUniform4ivARB_validation;}
+if(this->m_ptr_glMatrixOrthoEXT){this->m_orig_glMatrixOrthoEXT = this->m_ptr_glMatrixOrthoEXT;this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&ValidationTableDecorator::m_glMatrixOrthoEXT_validation;}
+if(this->m_ptr_glVertexArrayVertexBuffer){this->m_orig_glVertexArrayVertexBuffer = this->m_ptr_glVertexArrayVertexBuffer;this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&ValidationTableDecorator::m_glVertexArrayVertexBuffer_validation;}
+if(this->m_ptr_glProgramLocalParametersI4ivNV){this->m_orig_glProgramLocalParametersI4ivNV = this->m_ptr_glProgramLocalParametersI4ivNV;this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&ValidationTableDecorator::m_glProgramLocalParametersI4ivNV_validation;}
+if(this->m_ptr_glProgramUniform4ui64vNV){this->m_orig_glProgramUniform4ui64vNV = this->m_ptr_glProgramUniform4ui64vNV;this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&ValidationTableDecorator::m_glProgramUniform4ui64vNV_validation;}
+if(this->m_ptr_glGetNamedStringivARB){this->m_orig_glGetNamedStringivARB = this->m_ptr_glGetNamedStringivARB;this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&ValidationTableDecorator::m_glGetNamedStringivARB_validation;}
+if(this->m_ptr_glVertexAttribL1i64vNV){this->m_orig_glVertexAttribL1i64vNV = this->m_ptr_glVertexAttribL1i64vNV;this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL1i64vNV_validation;}
+if(this->m_ptr_glTransformFeedbackBufferBase){this->m_orig_glTransformFeedbackBufferBase = this->m_ptr_glTransformFeedbackBufferBase;this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&ValidationTableDecorator::m_glTransformFeedbackBufferBase_validation;}
+if(this->m_ptr_glIndexsv){this->m_orig_glIndexsv = this->m_ptr_glIndexsv;this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&ValidationTableDecorator::m_glIndexsv_validation;}
+if(this->m_ptr_glPointParameterivNV){this->m_orig_glPointParameterivNV = this->m_ptr_glPointParameterivNV;this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&ValidationTableDecorator::m_glPointParameterivNV_validation;}
+if(this->m_ptr_glGetDetailTexFuncSGIS){this->m_orig_glGetDetailTexFuncSGIS = this->m_ptr_glGetDetailTexFuncSGIS;this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&ValidationTableDecorator::m_glGetDetailTexFuncSGIS_validation;}
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN){this->m_orig_glReplacementCodeuiColor3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_validation;}
+if(this->m_ptr_glProgramLocalParameter4fARB){this->m_orig_glProgramLocalParameter4fARB = this->m_ptr_glProgramLocalParameter4fARB;this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&ValidationTableDecorator::m_glProgramLocalParameter4fARB_validation;}
+if(this->m_ptr_glBitmap){this->m_orig_glBitmap = this->m_ptr_glBitmap;this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&ValidationTableDecorator::m_glBitmap_validation;}
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT){this->m_orig_glNamedFramebufferTextureLayerEXT = this->m_ptr_glNamedFramebufferTextureLayerEXT;this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&ValidationTableDecorator::m_glNamedFramebufferTextureLayerEXT_validation;}
+if(this->m_ptr_glMultiTexGenfvEXT){this->m_orig_glMultiTexGenfvEXT = this->m_ptr_glMultiTexGenfvEXT;this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&ValidationTableDecorator::m_glMultiTexGenfvEXT_validation;}
+if(this->m_ptr_glGetNamedBufferSubData){this->m_orig_glGetNamedBufferSubData = this->m_ptr_glGetNamedBufferSubData;this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glGetNamedBufferSubData_validation;}
+if(this->m_ptr_glStencilFuncSeparateATI){this->m_orig_glStencilFuncSeparateATI = this->m_ptr_glStencilFuncSeparateATI;this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&ValidationTableDecorator::m_glStencilFuncSeparateATI_validation;}
+if(this->m_ptr_glProgramUniform2iv){this->m_orig_glProgramUniform2iv = this->m_ptr_glProgramUniform2iv;this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&ValidationTableDecorator::m_glProgramUniform2iv_validation;}
+if(this->m_ptr_glGetQueryiv){this->m_orig_glGetQueryiv = this->m_ptr_glGetQueryiv;this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&ValidationTableDecorator::m_glGetQueryiv_validation;}
+if(this->m_ptr_glTexCoord4f){this->m_orig_glTexCoord4f = this->m_ptr_glTexCoord4f;this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&ValidationTableDecorator::m_glTexCoord4f_validation;}
+if(this->m_ptr_glMapGrid2f){this->m_orig_glMapGrid2f = this->m_ptr_glMapGrid2f;this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&ValidationTableDecorator::m_glMapGrid2f_validation;}
+if(this->m_ptr_glListParameterivSGIX){this->m_orig_glListParameterivSGIX = this->m_ptr_glListParameterivSGIX;this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&ValidationTableDecorator::m_glListParameterivSGIX_validation;}
+if(this->m_ptr_glCreateQueries){this->m_orig_glCreateQueries = this->m_ptr_glCreateQueries;this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&ValidationTableDecorator::m_glCreateQueries_validation;}
+if(this->m_ptr_glGetSamplerParameterfv){this->m_orig_glGetSamplerParameterfv = this->m_ptr_glGetSamplerParameterfv;this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&ValidationTableDecorator::m_glGetSamplerParameterfv_validation;}
+if(this->m_ptr_glTexCoord4i){this->m_orig_glTexCoord4i = this->m_ptr_glTexCoord4i;this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&ValidationTableDecorator::m_glTexCoord4i_validation;}
+if(this->m_ptr_glObjectLabel){this->m_orig_glObjectLabel = this->m_ptr_glObjectLabel;this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&ValidationTableDecorator::m_glObjectLabel_validation;}
+if(this->m_ptr_glProgramUniform3i64NV){this->m_orig_glProgramUniform3i64NV = this->m_ptr_glProgramUniform3i64NV;this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&ValidationTableDecorator::m_glProgramUniform3i64NV_validation;}
+if(this->m_ptr_glGetTextureHandleARB){this->m_orig_glGetTextureHandleARB = this->m_ptr_glGetTextureHandleARB;this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&ValidationTableDecorator::m_glGetTextureHandleARB_validation;}
+if(this->m_ptr_glTexCoord4s){this->m_orig_glTexCoord4s = this->m_ptr_glTexCoord4s;this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&ValidationTableDecorator::m_glTexCoord4s_validation;}
+if(this->m_ptr_glUniform4iARB){this->m_orig_glUniform4iARB = this->m_ptr_glUniform4iARB;this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&ValidationTableDecorator::m_glUniform4iARB_validation;}
+if(this->m_ptr_glGetUniformIndices){this->m_orig_glGetUniformIndices = this->m_ptr_glGetUniformIndices;this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&ValidationTableDecorator::m_glGetUniformIndices_validation;}
+if(this->m_ptr_glMultiTexImage3DEXT){this->m_orig_glMultiTexImage3DEXT = this->m_ptr_glMultiTexImage3DEXT;this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&ValidationTableDecorator::m_glMultiTexImage3DEXT_validation;}
+if(this->m_ptr_glCoverageModulationTableNV){this->m_orig_glCoverageModulationTableNV = this->m_ptr_glCoverageModulationTableNV;this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&ValidationTableDecorator::m_glCoverageModulationTableNV_validation;}
+if(this->m_ptr_glPointParameteriv){this->m_orig_glPointParameteriv = this->m_ptr_glPointParameteriv;this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&ValidationTableDecorator::m_glPointParameteriv_validation;}
+if(this->m_ptr_glMultiTexCoord4svARB){this->m_orig_glMultiTexCoord4svARB = this->m_ptr_glMultiTexCoord4svARB;this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4svARB_validation;}
+if(this->m_ptr_glNormal3fv){this->m_orig_glNormal3fv = this->m_ptr_glNormal3fv;this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&ValidationTableDecorator::m_glNormal3fv_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT){this->m_orig_glProgramUniformMatrix3x4dvEXT = this->m_ptr_glProgramUniformMatrix3x4dvEXT;this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x4dvEXT_validation;}
+if(this->m_ptr_glTexCoord1fv){this->m_orig_glTexCoord1fv = this->m_ptr_glTexCoord1fv;this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&ValidationTableDecorator::m_glTexCoord1fv_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT){this->m_orig_glProgramUniformMatrix4x3dvEXT = this->m_ptr_glProgramUniformMatrix4x3dvEXT;this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x3dvEXT_validation;}
+if(this->m_ptr_glGetActiveVaryingNV){this->m_orig_glGetActiveVaryingNV = this->m_ptr_glGetActiveVaryingNV;this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&ValidationTableDecorator::m_glGetActiveVaryingNV_validation;}
+if(this->m_ptr_glUniform1i64vARB){this->m_orig_glUniform1i64vARB = this->m_ptr_glUniform1i64vARB;this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&ValidationTableDecorator::m_glUniform1i64vARB_validation;}
+if(this->m_ptr_glMultiTexCoord1dv){this->m_orig_glMultiTexCoord1dv = this->m_ptr_glMultiTexCoord1dv;this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&ValidationTableDecorator::m_glMultiTexCoord1dv_validation;}
+if(this->m_ptr_glTexCoord3fv){this->m_orig_glTexCoord3fv = this->m_ptr_glTexCoord3fv;this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&ValidationTableDecorator::m_glTexCoord3fv_validation;}
+if(this->m_ptr_glMatrixTranslatefEXT){this->m_orig_glMatrixTranslatefEXT = this->m_ptr_glMatrixTranslatefEXT;this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&ValidationTableDecorator::m_glMatrixTranslatefEXT_validation;}
+if(this->m_ptr_glProgramUniform1ui64vNV){this->m_orig_glProgramUniform1ui64vNV = this->m_ptr_glProgramUniform1ui64vNV;this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&ValidationTableDecorator::m_glProgramUniform1ui64vNV_validation;}
+if(this->m_ptr_glTextureMaterialEXT){this->m_orig_glTextureMaterialEXT = this->m_ptr_glTextureMaterialEXT;this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&ValidationTableDecorator::m_glTextureMaterialEXT_validation;}
+if(this->m_ptr_glMultiTexCoordP3uiv){this->m_orig_glMultiTexCoordP3uiv = this->m_ptr_glMultiTexCoordP3uiv;this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&ValidationTableDecorator::m_glMultiTexCoordP3uiv_validation;}
+if(this->m_ptr_glVertexAttribP3ui){this->m_orig_glVertexAttribP3ui = this->m_ptr_glVertexAttribP3ui;this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&ValidationTableDecorator::m_glVertexAttribP3ui_validation;}
+if(this->m_ptr_glInterpolatePathsNV){this->m_orig_glInterpolatePathsNV = this->m_ptr_glInterpolatePathsNV;this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&ValidationTableDecorator::m_glInterpolatePathsNV_validation;}
+if(this->m_ptr_glTextureBufferRange){this->m_orig_glTextureBufferRange = this->m_ptr_glTextureBufferRange;this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&ValidationTableDecorator::m_glTextureBufferRange_validation;}
+if(this->m_ptr_glVertexAttribL2dEXT){this->m_orig_glVertexAttribL2dEXT = this->m_ptr_glVertexAttribL2dEXT;this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&ValidationTableDecorator::m_glVertexAttribL2dEXT_validation;}
+if(this->m_ptr_glGetPixelTransformParameterivEXT){this->m_orig_glGetPixelTransformParameterivEXT = this->m_ptr_glGetPixelTransformParameterivEXT;this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetPixelTransformParameterivEXT_validation;}
+if(this->m_ptr_glTexCoord4xvOES){this->m_orig_glTexCoord4xvOES = this->m_ptr_glTexCoord4xvOES;this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&ValidationTableDecorator::m_glTexCoord4xvOES_validation;}
+if(this->m_ptr_glGetVariantBooleanvEXT){this->m_orig_glGetVariantBooleanvEXT = this->m_ptr_glGetVariantBooleanvEXT;this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&ValidationTableDecorator::m_glGetVariantBooleanvEXT_validation;}
+if(this->m_ptr_glDepthRange){this->m_orig_glDepthRange = this->m_ptr_glDepthRange;this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&ValidationTableDecorator::m_glDepthRange_validation;}
+if(this->m_ptr_glGetVertexAttribdvARB){this->m_orig_glGetVertexAttribdvARB = this->m_ptr_glGetVertexAttribdvARB;this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&ValidationTableDecorator::m_glGetVertexAttribdvARB_validation;}
+if(this->m_ptr_glGetColorTableParameterfv){this->m_orig_glGetColorTableParameterfv = this->m_ptr_glGetColorTableParameterfv;this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&ValidationTableDecorator::m_glGetColorTableParameterfv_validation;}
+if(this->m_ptr_glDrawArraysInstancedEXT){this->m_orig_glDrawArraysInstancedEXT = this->m_ptr_glDrawArraysInstancedEXT;this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&ValidationTableDecorator::m_glDrawArraysInstancedEXT_validation;}
+if(this->m_ptr_glDisableClientStateIndexedEXT){this->m_orig_glDisableClientStateIndexedEXT = this->m_ptr_glDisableClientStateIndexedEXT;this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&ValidationTableDecorator::m_glDisableClientStateIndexedEXT_validation;}
+if(this->m_ptr_glDrawBuffer){this->m_orig_glDrawBuffer = this->m_ptr_glDrawBuffer;this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&ValidationTableDecorator::m_glDrawBuffer_validation;}
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV){this->m_orig_glMultiDrawArraysIndirectBindlessNV = this->m_ptr_glMultiDrawArraysIndirectBindlessNV;this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&ValidationTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_validation;}
+if(this->m_ptr_glGetnPixelMapusv){this->m_orig_glGetnPixelMapusv = this->m_ptr_glGetnPixelMapusv;this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&ValidationTableDecorator::m_glGetnPixelMapusv_validation;}
+if(this->m_ptr_glRasterPos3fv){this->m_orig_glRasterPos3fv = this->m_ptr_glRasterPos3fv;this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&ValidationTableDecorator::m_glRasterPos3fv_validation;}
+if(this->m_ptr_glClearBufferuiv){this->m_orig_glClearBufferuiv = this->m_ptr_glClearBufferuiv;this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&ValidationTableDecorator::m_glClearBufferuiv_validation;}
+if(this->m_ptr_glGetInternalformati64v){this->m_orig_glGetInternalformati64v = this->m_ptr_glGetInternalformati64v;this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&ValidationTableDecorator::m_glGetInternalformati64v_validation;}
+if(this->m_ptr_glShaderSourceARB){this->m_orig_glShaderSourceARB = this->m_ptr_glShaderSourceARB;this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&ValidationTableDecorator::m_glShaderSourceARB_validation;}
+if(this->m_ptr_glShaderOp3EXT){this->m_orig_glShaderOp3EXT = this->m_ptr_glShaderOp3EXT;this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&ValidationTableDecorator::m_glShaderOp3EXT_validation;}
+if(this->m_ptr_glWindowPos2dvMESA){this->m_orig_glWindowPos2dvMESA = this->m_ptr_glWindowPos2dvMESA;this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&ValidationTableDecorator::m_glWindowPos2dvMESA_validation;}
+if(this->m_ptr_glClearIndex){this->m_orig_glClearIndex = this->m_ptr_glClearIndex;this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&ValidationTableDecorator::m_glClearIndex_validation;}
+if(this->m_ptr_glProvokingVertexEXT){this->m_orig_glProvokingVertexEXT = this->m_ptr_glProvokingVertexEXT;this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&ValidationTableDecorator::m_glProvokingVertexEXT_validation;}
+if(this->m_ptr_glVariantubvEXT){this->m_orig_glVariantubvEXT = this->m_ptr_glVariantubvEXT;this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&ValidationTableDecorator::m_glVariantubvEXT_validation;}
+if(this->m_ptr_glFlush){this->m_orig_glFlush = this->m_ptr_glFlush;this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&ValidationTableDecorator::m_glFlush_validation;}
+if(this->m_ptr_glFramebufferTexture2DEXT){this->m_orig_glFramebufferTexture2DEXT = this->m_ptr_glFramebufferTexture2DEXT;this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&ValidationTableDecorator::m_glFramebufferTexture2DEXT_validation;}
+if(this->m_ptr_glGetColorTableParameterivEXT){this->m_orig_glGetColorTableParameterivEXT = this->m_ptr_glGetColorTableParameterivEXT;this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetColorTableParameterivEXT_validation;}
+if(this->m_ptr_glPresentFrameDualFillNV){this->m_orig_glPresentFrameDualFillNV = this->m_ptr_glPresentFrameDualFillNV;this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&ValidationTableDecorator::m_glPresentFrameDualFillNV_validation;}
+if(this->m_ptr_glGenVertexShadersEXT){this->m_orig_glGenVertexShadersEXT = this->m_ptr_glGenVertexShadersEXT;this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&ValidationTableDecorator::m_glGenVertexShadersEXT_validation;}
+if(this->m_ptr_glSpecializeShaderARB){this->m_orig_glSpecializeShaderARB = this->m_ptr_glSpecializeShaderARB;this->m_ptr_glSpecializeShaderARB = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC)&ValidationTableDecorator::m_glSpecializeShaderARB_validation;}
+if(this->m_ptr_glProgramUniformHandleui64vARB){this->m_orig_glProgramUniformHandleui64vARB = this->m_ptr_glProgramUniformHandleui64vARB;this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&ValidationTableDecorator::m_glProgramUniformHandleui64vARB_validation;}
+if(this->m_ptr_glDepthRangefOES){this->m_orig_glDepthRangefOES = this->m_ptr_glDepthRangefOES;this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&ValidationTableDecorator::m_glDepthRangefOES_validation;}
+if(this->m_ptr_glDeleteVertexArrays){this->m_orig_glDeleteVertexArrays = this->m_ptr_glDeleteVertexArrays;this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&ValidationTableDecorator::m_glDeleteVertexArrays_validation;}
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance){this->m_orig_glDrawElementsInstancedBaseVertexBaseInstance = this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance;this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&ValidationTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_validation;}
+if(this->m_ptr_glGetTexLevelParameteriv){this->m_orig_glGetTexLevelParameteriv = this->m_ptr_glGetTexLevelParameteriv;this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&ValidationTableDecorator::m_glGetTexLevelParameteriv_validation;}
+if(this->m_ptr_glDrawVkImageNV){this->m_orig_glDrawVkImageNV = this->m_ptr_glDrawVkImageNV;this->m_ptr_glDrawVkImageNV = (FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC)&ValidationTableDecorator::m_glDrawVkImageNV_validation;}
+if(this->m_ptr_glWindowPos3iARB){this->m_orig_glWindowPos3iARB = this->m_ptr_glWindowPos3iARB;this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&ValidationTableDecorator::m_glWindowPos3iARB_validation;}
+if(this->m_ptr_glPrioritizeTextures){this->m_orig_glPrioritizeTextures = this->m_ptr_glPrioritizeTextures;this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&ValidationTableDecorator::m_glPrioritizeTextures_validation;}
+if(this->m_ptr_glWindowPos3fvMESA){this->m_orig_glWindowPos3fvMESA = this->m_ptr_glWindowPos3fvMESA;this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&ValidationTableDecorator::m_glWindowPos3fvMESA_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT){this->m_orig_glProgramUniformMatrix3x2dvEXT = this->m_ptr_glProgramUniformMatrix3x2dvEXT;this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x2dvEXT_validation;}
+if(this->m_ptr_glVertex4xvOES){this->m_orig_glVertex4xvOES = this->m_ptr_glVertex4xvOES;this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&ValidationTableDecorator::m_glVertex4xvOES_validation;}
+if(this->m_ptr_glTexStorage3DMultisample){this->m_orig_glTexStorage3DMultisample = this->m_ptr_glTexStorage3DMultisample;this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&ValidationTableDecorator::m_glTexStorage3DMultisample_validation;}
+if(this->m_ptr_glWindowPos2sARB){this->m_orig_glWindowPos2sARB = this->m_ptr_glWindowPos2sARB;this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&ValidationTableDecorator::m_glWindowPos2sARB_validation;}
+if(this->m_ptr_glStencilOpValueAMD){this->m_orig_glStencilOpValueAMD = this->m_ptr_glStencilOpValueAMD;this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&ValidationTableDecorator::m_glStencilOpValueAMD_validation;}
+if(this->m_ptr_glProgramVertexLimitNV){this->m_orig_glProgramVertexLimitNV = this->m_ptr_glProgramVertexLimitNV;this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&ValidationTableDecorator::m_glProgramVertexLimitNV_validation;}
+if(this->m_ptr_glGetTexParameterPointervAPPLE){this->m_orig_glGetTexParameterPointervAPPLE = this->m_ptr_glGetTexParameterPointervAPPLE;this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&ValidationTableDecorator::m_glGetTexParameterPointervAPPLE_validation;}
+if(this->m_ptr_glProgramUniform3uivEXT){this->m_orig_glProgramUniform3uivEXT = this->m_ptr_glProgramUniform3uivEXT;this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&ValidationTableDecorator::m_glProgramUniform3uivEXT_validation;}
+if(this->m_ptr_glClampColor){this->m_orig_glClampColor = this->m_ptr_glClampColor;this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&ValidationTableDecorator::m_glClampColor_validation;}
+if(this->m_ptr_glClearStencil){this->m_orig_glClearStencil = this->m_ptr_glClearStencil;this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&ValidationTableDecorator::m_glClearStencil_validation;}
+if(this->m_ptr_glTexCoordP1uiv){this->m_orig_glTexCoordP1uiv = this->m_ptr_glTexCoordP1uiv;this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&ValidationTableDecorator::m_glTexCoordP1uiv_validation;}
+if(this->m_ptr_glVertexAttribs3svNV){this->m_orig_glVertexAttribs3svNV = this->m_ptr_glVertexAttribs3svNV;this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&ValidationTableDecorator::m_glVertexAttribs3svNV_validation;}
+if(this->m_ptr_glMultiTexCoord3fv){this->m_orig_glMultiTexCoord3fv = this->m_ptr_glMultiTexCoord3fv;this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&ValidationTableDecorator::m_glMultiTexCoord3fv_validation;}
+if(this->m_ptr_glVertexBlendEnvfATI){this->m_orig_glVertexBlendEnvfATI = this->m_ptr_glVertexBlendEnvfATI;this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&ValidationTableDecorator::m_glVertexBlendEnvfATI_validation;}
+if(this->m_ptr_glIsFenceAPPLE){this->m_orig_glIsFenceAPPLE = this->m_ptr_glIsFenceAPPLE;this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&ValidationTableDecorator::m_glIsFenceAPPLE_validation;}
+if(this->m_ptr_glGetBufferParameterui64vNV){this->m_orig_glGetBufferParameterui64vNV = this->m_ptr_glGetBufferParameterui64vNV;this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&ValidationTableDecorator::m_glGetBufferParameterui64vNV_validation;}
+if(this->m_ptr_glVertexAttribI4bvEXT){this->m_orig_glVertexAttribI4bvEXT = this->m_ptr_glVertexAttribI4bvEXT;this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4bvEXT_validation;}
+if(this->m_ptr_glUniform2fARB){this->m_orig_glUniform2fARB = this->m_ptr_glUniform2fARB;this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&ValidationTableDecorator::m_glUniform2fARB_validation;}
+if(this->m_ptr_glStopInstrumentsSGIX){this->m_orig_glStopInstrumentsSGIX = this->m_ptr_glStopInstrumentsSGIX;this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&ValidationTableDecorator::m_glStopInstrumentsSGIX_validation;}
+if(this->m_ptr_glVertexAttrib3fNV){this->m_orig_glVertexAttrib3fNV = this->m_ptr_glVertexAttrib3fNV;this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&ValidationTableDecorator::m_glVertexAttrib3fNV_validation;}
+if(this->m_ptr_glMapVertexAttrib2dAPPLE){this->m_orig_glMapVertexAttrib2dAPPLE = this->m_ptr_glMapVertexAttrib2dAPPLE;this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&ValidationTableDecorator::m_glMapVertexAttrib2dAPPLE_validation;}
+if(this->m_ptr_glVertex2f){this->m_orig_glVertex2f = this->m_ptr_glVertex2f;this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&ValidationTableDecorator::m_glVertex2f_validation;}
+if(this->m_ptr_glCopyTextureImage2DEXT){this->m_orig_glCopyTextureImage2DEXT = this->m_ptr_glCopyTextureImage2DEXT;this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCopyTextureImage2DEXT_validation;}
+if(this->m_ptr_glVertex2d){this->m_orig_glVertex2d = this->m_ptr_glVertex2d;this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&ValidationTableDecorator::m_glVertex2d_validation;}
+if(this->m_ptr_glSecondaryColor3bvEXT){this->m_orig_glSecondaryColor3bvEXT = this->m_ptr_glSecondaryColor3bvEXT;this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3bvEXT_validation;}
+if(this->m_ptr_glMultiTexCoord4fARB){this->m_orig_glMultiTexCoord4fARB = this->m_ptr_glMultiTexCoord4fARB;this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4fARB_validation;}
+if(this->m_ptr_glPolygonOffset){this->m_orig_glPolygonOffset = this->m_ptr_glPolygonOffset;this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&ValidationTableDecorator::m_glPolygonOffset_validation;}
+if(this->m_ptr_glTangent3bvEXT){this->m_orig_glTangent3bvEXT = this->m_ptr_glTangent3bvEXT;this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&ValidationTableDecorator::m_glTangent3bvEXT_validation;}
+if(this->m_ptr_glHistogram){this->m_orig_glHistogram = this->m_ptr_glHistogram;this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&ValidationTableDecorator::m_glHistogram_validation;}
+if(this->m_ptr_glGetProgramiv){this->m_orig_glGetProgramiv = this->m_ptr_glGetProgramiv;this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&ValidationTableDecorator::m_glGetProgramiv_validation;}
+if(this->m_ptr_glMatrixIndexubvARB){this->m_orig_glMatrixIndexubvARB = this->m_ptr_glMatrixIndexubvARB;this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&ValidationTableDecorator::m_glMatrixIndexubvARB_validation;}
+if(this->m_ptr_glVertex2s){this->m_orig_glVertex2s = this->m_ptr_glVertex2s;this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&ValidationTableDecorator::m_glVertex2s_validation;}
+if(this->m_ptr_glGetVertexAttribLui64vNV){this->m_orig_glGetVertexAttribLui64vNV = this->m_ptr_glGetVertexAttribLui64vNV;this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&ValidationTableDecorator::m_glGetVertexAttribLui64vNV_validation;}
+if(this->m_ptr_glGetProgramStringARB){this->m_orig_glGetProgramStringARB = this->m_ptr_glGetProgramStringARB;this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&ValidationTableDecorator::m_glGetProgramStringARB_validation;}
+if(this->m_ptr_glFlushMappedBufferRange){this->m_orig_glFlushMappedBufferRange = this->m_ptr_glFlushMappedBufferRange;this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&ValidationTableDecorator::m_glFlushMappedBufferRange_validation;}
+if(this->m_ptr_glVertexAttribI3uiEXT){this->m_orig_glVertexAttribI3uiEXT = this->m_ptr_glVertexAttribI3uiEXT;this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&ValidationTableDecorator::m_glVertexAttribI3uiEXT_validation;}
+if(this->m_ptr_glLineWidthxOES){this->m_orig_glLineWidthxOES = this->m_ptr_glLineWidthxOES;this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&ValidationTableDecorator::m_glLineWidthxOES_validation;}
+if(this->m_ptr_glProgramUniformMatrix2fvEXT){this->m_orig_glProgramUniformMatrix2fvEXT = this->m_ptr_glProgramUniformMatrix2fvEXT;this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2fvEXT_validation;}
+if(this->m_ptr_glGetTextureParameterIuivEXT){this->m_orig_glGetTextureParameterIuivEXT = this->m_ptr_glGetTextureParameterIuivEXT;this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glGetTextureParameterIuivEXT_validation;}
+if(this->m_ptr_glGetMultiTexEnvivEXT){this->m_orig_glGetMultiTexEnvivEXT = this->m_ptr_glGetMultiTexEnvivEXT;this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexEnvivEXT_validation;}
+if(this->m_ptr_glPixelTexGenParameterivSGIS){this->m_orig_glPixelTexGenParameterivSGIS = this->m_ptr_glPixelTexGenParameterivSGIS;this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&ValidationTableDecorator::m_glPixelTexGenParameterivSGIS_validation;}
+if(this->m_ptr_glGenQueries){this->m_orig_glGenQueries = this->m_ptr_glGenQueries;this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&ValidationTableDecorator::m_glGenQueries_validation;}
+if(this->m_ptr_glGetPixelMapfv){this->m_orig_glGetPixelMapfv = this->m_ptr_glGetPixelMapfv;this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&ValidationTableDecorator::m_glGetPixelMapfv_validation;}
+if(this->m_ptr_glBlendColorEXT){this->m_orig_glBlendColorEXT = this->m_ptr_glBlendColorEXT;this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&ValidationTableDecorator::m_glBlendColorEXT_validation;}
+if(this->m_ptr_glResetMinmax){this->m_orig_glResetMinmax = this->m_ptr_glResetMinmax;this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&ValidationTableDecorator::m_glResetMinmax_validation;}
+if(this->m_ptr_glGetnUniformivARB){this->m_orig_glGetnUniformivARB = this->m_ptr_glGetnUniformivARB;this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&ValidationTableDecorator::m_glGetnUniformivARB_validation;}
+if(this->m_ptr_glVertexBlendARB){this->m_orig_glVertexBlendARB = this->m_ptr_glVertexBlendARB;this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&ValidationTableDecorator::m_glVertexBlendARB_validation;}
+if(this->m_ptr_glVertexAttrib4d){this->m_orig_glVertexAttrib4d = this->m_ptr_glVertexAttrib4d;this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&ValidationTableDecorator::m_glVertexAttrib4d_validation;}
+if(this->m_ptr_glGetVaryingLocationNV){this->m_orig_glGetVaryingLocationNV = this->m_ptr_glGetVaryingLocationNV;this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&ValidationTableDecorator::m_glGetVaryingLocationNV_validation;}
+if(this->m_ptr_glGetMapAttribParameterivNV){this->m_orig_glGetMapAttribParameterivNV = this->m_ptr_glGetMapAttribParameterivNV;this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&ValidationTableDecorator::m_glGetMapAttribParameterivNV_validation;}
+if(this->m_ptr_glTexSubImage3D){this->m_orig_glTexSubImage3D = this->m_ptr_glTexSubImage3D;this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&ValidationTableDecorator::m_glTexSubImage3D_validation;}
+if(this->m_ptr_glDeleteSamplers){this->m_orig_glDeleteSamplers = this->m_ptr_glDeleteSamplers;this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&ValidationTableDecorator::m_glDeleteSamplers_validation;}
+if(this->m_ptr_glGetLightxOES){this->m_orig_glGetLightxOES = this->m_ptr_glGetLightxOES;this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&ValidationTableDecorator::m_glGetLightxOES_validation;}
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI){this->m_orig_glGetVertexAttribArrayObjectfvATI = this->m_ptr_glGetVertexAttribArrayObjectfvATI;this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&ValidationTableDecorator::m_glGetVertexAttribArrayObjectfvATI_validation;}
+if(this->m_ptr_glVertexArrayNormalOffsetEXT){this->m_orig_glVertexArrayNormalOffsetEXT = this->m_ptr_glVertexArrayNormalOffsetEXT;this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayNormalOffsetEXT_validation;}
+if(this->m_ptr_glGetBufferParameterivARB){this->m_orig_glGetBufferParameterivARB = this->m_ptr_glGetBufferParameterivARB;this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&ValidationTableDecorator::m_glGetBufferParameterivARB_validation;}
+if(this->m_ptr_glGetTextureParameterfv){this->m_orig_glGetTextureParameterfv = this->m_ptr_glGetTextureParameterfv;this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&ValidationTableDecorator::m_glGetTextureParameterfv_validation;}
+if(this->m_ptr_glDrawMeshArraysSUN){this->m_orig_glDrawMeshArraysSUN = this->m_ptr_glDrawMeshArraysSUN;this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&ValidationTableDecorator::m_glDrawMeshArraysSUN_validation;}
+if(this->m_ptr_glVertexAttrib4dNV){this->m_orig_glVertexAttrib4dNV = this->m_ptr_glVertexAttrib4dNV;this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&ValidationTableDecorator::m_glVertexAttrib4dNV_validation;}
+if(this->m_ptr_glGetMultisamplefvNV){this->m_orig_glGetMultisamplefvNV = this->m_ptr_glGetMultisamplefvNV;this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&ValidationTableDecorator::m_glGetMultisamplefvNV_validation;}
+if(this->m_ptr_glMapObjectBufferATI){this->m_orig_glMapObjectBufferATI = this->m_ptr_glMapObjectBufferATI;this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&ValidationTableDecorator::m_glMapObjectBufferATI_validation;}
+if(this->m_ptr_glGetPathCommandsNV){this->m_orig_glGetPathCommandsNV = this->m_ptr_glGetPathCommandsNV;this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&ValidationTableDecorator::m_glGetPathCommandsNV_validation;}
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT){this->m_orig_glVertexArrayTexCoordOffsetEXT = this->m_ptr_glVertexArrayTexCoordOffsetEXT;this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayTexCoordOffsetEXT_validation;}
+if(this->m_ptr_glGetHistogram){this->m_orig_glGetHistogram = this->m_ptr_glGetHistogram;this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&ValidationTableDecorator::m_glGetHistogram_validation;}
+if(this->m_ptr_glMatrixMode){this->m_orig_glMatrixMode = this->m_ptr_glMatrixMode;this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&ValidationTableDecorator::m_glMatrixMode_validation;}
+if(this->m_ptr_glColorFormatNV){this->m_orig_glColorFormatNV = this->m_ptr_glColorFormatNV;this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&ValidationTableDecorator::m_glColorFormatNV_validation;}
+if(this->m_ptr_glProgramUniformui64NV){this->m_orig_glProgramUniformui64NV = this->m_ptr_glProgramUniformui64NV;this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&ValidationTableDecorator::m_glProgramUniformui64NV_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT){this->m_orig_glProgramUniformMatrix4x2fvEXT = this->m_ptr_glProgramUniformMatrix4x2fvEXT;this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x2fvEXT_validation;}
+if(this->m_ptr_glLoadMatrixxOES){this->m_orig_glLoadMatrixxOES = this->m_ptr_glLoadMatrixxOES;this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&ValidationTableDecorator::m_glLoadMatrixxOES_validation;}
+if(this->m_ptr_glGetColorTableParameterfvEXT){this->m_orig_glGetColorTableParameterfvEXT = this->m_ptr_glGetColorTableParameterfvEXT;this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetColorTableParameterfvEXT_validation;}
+if(this->m_ptr_glRasterPos4i){this->m_orig_glRasterPos4i = this->m_ptr_glRasterPos4i;this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&ValidationTableDecorator::m_glRasterPos4i_validation;}
+if(this->m_ptr_glVertexAttribL2i64NV){this->m_orig_glVertexAttribL2i64NV = this->m_ptr_glVertexAttribL2i64NV;this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&ValidationTableDecorator::m_glVertexAttribL2i64NV_validation;}
+if(this->m_ptr_glBindTextures){this->m_orig_glBindTextures = this->m_ptr_glBindTextures;this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&ValidationTableDecorator::m_glBindTextures_validation;}
+if(this->m_ptr_glMatrixRotatefEXT){this->m_orig_glMatrixRotatefEXT = this->m_ptr_glMatrixRotatefEXT;this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&ValidationTableDecorator::m_glMatrixRotatefEXT_validation;}
+if(this->m_ptr_glGetClipPlanexOES){this->m_orig_glGetClipPlanexOES = this->m_ptr_glGetClipPlanexOES;this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&ValidationTableDecorator::m_glGetClipPlanexOES_validation;}
+if(this->m_ptr_glSecondaryColor3uivEXT){this->m_orig_glSecondaryColor3uivEXT = this->m_ptr_glSecondaryColor3uivEXT;this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3uivEXT_validation;}
+if(this->m_ptr_glGetPerfQueryInfoINTEL){this->m_orig_glGetPerfQueryInfoINTEL = this->m_ptr_glGetPerfQueryInfoINTEL;this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&ValidationTableDecorator::m_glGetPerfQueryInfoINTEL_validation;}
+if(this->m_ptr_glGetDoublev){this->m_orig_glGetDoublev = this->m_ptr_glGetDoublev;this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&ValidationTableDecorator::m_glGetDoublev_validation;}
+if(this->m_ptr_glBindBufferRangeEXT){this->m_orig_glBindBufferRangeEXT = this->m_ptr_glBindBufferRangeEXT;this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&ValidationTableDecorator::m_glBindBufferRangeEXT_validation;}
+if(this->m_ptr_glCompressedTexImage2D){this->m_orig_glCompressedTexImage2D = this->m_ptr_glCompressedTexImage2D;this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&ValidationTableDecorator::m_glCompressedTexImage2D_validation;}
+if(this->m_ptr_glMapBufferARB){this->m_orig_glMapBufferARB = this->m_ptr_glMapBufferARB;this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&ValidationTableDecorator::m_glMapBufferARB_validation;}
+if(this->m_ptr_glGetPathSpacingNV){this->m_orig_glGetPathSpacingNV = this->m_ptr_glGetPathSpacingNV;this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&ValidationTableDecorator::m_glGetPathSpacingNV_validation;}
+if(this->m_ptr_glUniform4dv){this->m_orig_glUniform4dv = this->m_ptr_glUniform4dv;this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&ValidationTableDecorator::m_glUniform4dv_validation;}
+if(this->m_ptr_glGlobalAlphaFactordSUN){this->m_orig_glGlobalAlphaFactordSUN = this->m_ptr_glGlobalAlphaFactordSUN;this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactordSUN_validation;}
+if(this->m_ptr_glProgramUniform3dv){this->m_orig_glProgramUniform3dv = this->m_ptr_glProgramUniform3dv;this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&ValidationTableDecorator::m_glProgramUniform3dv_validation;}
+if(this->m_ptr_glGetShaderSourceARB){this->m_orig_glGetShaderSourceARB = this->m_ptr_glGetShaderSourceARB;this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&ValidationTableDecorator::m_glGetShaderSourceARB_validation;}
+if(this->m_ptr_glVertexAttrib3dvARB){this->m_orig_glVertexAttrib3dvARB = this->m_ptr_glVertexAttrib3dvARB;this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&ValidationTableDecorator::m_glVertexAttrib3dvARB_validation;}
+if(this->m_ptr_glInvalidateBufferData){this->m_orig_glInvalidateBufferData = this->m_ptr_glInvalidateBufferData;this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&ValidationTableDecorator::m_glInvalidateBufferData_validation;}
+if(this->m_ptr_glMatrixLoad3x2fNV){this->m_orig_glMatrixLoad3x2fNV = this->m_ptr_glMatrixLoad3x2fNV;this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&ValidationTableDecorator::m_glMatrixLoad3x2fNV_validation;}
+if(this->m_ptr_glCompressedTextureSubImage1D){this->m_orig_glCompressedTextureSubImage1D = this->m_ptr_glCompressedTextureSubImage1D;this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&ValidationTableDecorator::m_glCompressedTextureSubImage1D_validation;}
+if(this->m_ptr_glTexCoord3xvOES){this->m_orig_glTexCoord3xvOES = this->m_ptr_glTexCoord3xvOES;this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&ValidationTableDecorator::m_glTexCoord3xvOES_validation;}
+if(this->m_ptr_glGenTexturesEXT){this->m_orig_glGenTexturesEXT = this->m_ptr_glGenTexturesEXT;this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&ValidationTableDecorator::m_glGenTexturesEXT_validation;}
+if(this->m_ptr_glTangent3iEXT){this->m_orig_glTangent3iEXT = this->m_ptr_glTangent3iEXT;this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&ValidationTableDecorator::m_glTangent3iEXT_validation;}
+if(this->m_ptr_glClearTexImage){this->m_orig_glClearTexImage = this->m_ptr_glClearTexImage;this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&ValidationTableDecorator::m_glClearTexImage_validation;}
+if(this->m_ptr_glBinormal3bvEXT){this->m_orig_glBinormal3bvEXT = this->m_ptr_glBinormal3bvEXT;this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&ValidationTableDecorator::m_glBinormal3bvEXT_validation;}
+if(this->m_ptr_glUniform3fv){this->m_orig_glUniform3fv = this->m_ptr_glUniform3fv;this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&ValidationTableDecorator::m_glUniform3fv_validation;}
+if(this->m_ptr_glGetnPixelMapusvARB){this->m_orig_glGetnPixelMapusvARB = this->m_ptr_glGetnPixelMapusvARB;this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&ValidationTableDecorator::m_glGetnPixelMapusvARB_validation;}
+if(this->m_ptr_glMemoryObjectParameterivEXT){this->m_orig_glMemoryObjectParameterivEXT = this->m_ptr_glMemoryObjectParameterivEXT;this->m_ptr_glMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glMemoryObjectParameterivEXT_validation;}
+if(this->m_ptr_glGenSemaphoresEXT){this->m_orig_glGenSemaphoresEXT = this->m_ptr_glGenSemaphoresEXT;this->m_ptr_glGenSemaphoresEXT = (FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC)&ValidationTableDecorator::m_glGenSemaphoresEXT_validation;}
+if(this->m_ptr_glMultiTexCoordP1ui){this->m_orig_glMultiTexCoordP1ui = this->m_ptr_glMultiTexCoordP1ui;this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&ValidationTableDecorator::m_glMultiTexCoordP1ui_validation;}
+if(this->m_ptr_glClearNamedBufferDataEXT){this->m_orig_glClearNamedBufferDataEXT = this->m_ptr_glClearNamedBufferDataEXT;this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&ValidationTableDecorator::m_glClearNamedBufferDataEXT_validation;}
+if(this->m_ptr_glUniformMatrix4dv){this->m_orig_glUniformMatrix4dv = this->m_ptr_glUniformMatrix4dv;this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&ValidationTableDecorator::m_glUniformMatrix4dv_validation;}
+if(this->m_ptr_glWindowPos3fMESA){this->m_orig_glWindowPos3fMESA = this->m_ptr_glWindowPos3fMESA;this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&ValidationTableDecorator::m_glWindowPos3fMESA_validation;}
+if(this->m_ptr_glDeleteRenderbuffers){this->m_orig_glDeleteRenderbuffers = this->m_ptr_glDeleteRenderbuffers;this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&ValidationTableDecorator::m_glDeleteRenderbuffers_validation;}
+if(this->m_ptr_glGetTextureLevelParameterfvEXT){this->m_orig_glGetTextureLevelParameterfvEXT = this->m_ptr_glGetTextureLevelParameterfvEXT;this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetTextureLevelParameterfvEXT_validation;}
+if(this->m_ptr_glGetHistogramParameterxvOES){this->m_orig_glGetHistogramParameterxvOES = this->m_ptr_glGetHistogramParameterxvOES;this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&ValidationTableDecorator::m_glGetHistogramParameterxvOES_validation;}
+if(this->m_ptr_glMultiDrawElements){this->m_orig_glMultiDrawElements = this->m_ptr_glMultiDrawElements;this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&ValidationTableDecorator::m_glMultiDrawElements_validation;}
+if(this->m_ptr_glMakeImageHandleNonResidentNV){this->m_orig_glMakeImageHandleNonResidentNV = this->m_ptr_glMakeImageHandleNonResidentNV;this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&ValidationTableDecorator::m_glMakeImageHandleNonResidentNV_validation;}
+if(this->m_ptr_glTexSubImage1DEXT){this->m_orig_glTexSubImage1DEXT = this->m_ptr_glTexSubImage1DEXT;this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glTexSubImage1DEXT_validation;}
+if(this->m_ptr_glNormalStream3dATI){this->m_orig_glNormalStream3dATI = this->m_ptr_glNormalStream3dATI;this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&ValidationTableDecorator::m_glNormalStream3dATI_validation;}
+if(this->m_ptr_glVertexAttribL4i64vNV){this->m_orig_glVertexAttribL4i64vNV = this->m_ptr_glVertexAttribL4i64vNV;this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL4i64vNV_validation;}
+if(this->m_ptr_glDrawBuffers){this->m_orig_glDrawBuffers = this->m_ptr_glDrawBuffers;this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&ValidationTableDecorator::m_glDrawBuffers_validation;}
+if(this->m_ptr_glCopyTextureSubImage1DEXT){this->m_orig_glCopyTextureSubImage1DEXT = this->m_ptr_glCopyTextureSubImage1DEXT;this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCopyTextureSubImage1DEXT_validation;}
+if(this->m_ptr_glWindowRectanglesEXT){this->m_orig_glWindowRectanglesEXT = this->m_ptr_glWindowRectanglesEXT;this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&ValidationTableDecorator::m_glWindowRectanglesEXT_validation;}
+if(this->m_ptr_glNamedFramebufferReadBuffer){this->m_orig_glNamedFramebufferReadBuffer = this->m_ptr_glNamedFramebufferReadBuffer;this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&ValidationTableDecorator::m_glNamedFramebufferReadBuffer_validation;}
+if(this->m_ptr_glUniform2i64vARB){this->m_orig_glUniform2i64vARB = this->m_ptr_glUniform2i64vARB;this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&ValidationTableDecorator::m_glUniform2i64vARB_validation;}
+if(this->m_ptr_glVertexAttribI1uivEXT){this->m_orig_glVertexAttribI1uivEXT = this->m_ptr_glVertexAttribI1uivEXT;this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI1uivEXT_validation;}
+if(this->m_ptr_glGetTexGenfv){this->m_orig_glGetTexGenfv = this->m_ptr_glGetTexGenfv;this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&ValidationTableDecorator::m_glGetTexGenfv_validation;}
+if(this->m_ptr_glBeginQueryARB){this->m_orig_glBeginQueryARB = this->m_ptr_glBeginQueryARB;this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&ValidationTableDecorator::m_glBeginQueryARB_validation;}
+if(this->m_ptr_glUniform1iARB){this->m_orig_glUniform1iARB = this->m_ptr_glUniform1iARB;this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&ValidationTableDecorator::m_glUniform1iARB_validation;}
+if(this->m_ptr_glVertex4bvOES){this->m_orig_glVertex4bvOES = this->m_ptr_glVertex4bvOES;this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&ValidationTableDecorator::m_glVertex4bvOES_validation;}
+if(this->m_ptr_glInvalidateSubFramebuffer){this->m_orig_glInvalidateSubFramebuffer = this->m_ptr_glInvalidateSubFramebuffer;this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&ValidationTableDecorator::m_glInvalidateSubFramebuffer_validation;}
+if(this->m_ptr_glUniform1fvARB){this->m_orig_glUniform1fvARB = this->m_ptr_glUniform1fvARB;this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&ValidationTableDecorator::m_glUniform1fvARB_validation;}
+if(this->m_ptr_glTestFenceNV){this->m_orig_glTestFenceNV = this->m_ptr_glTestFenceNV;this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&ValidationTableDecorator::m_glTestFenceNV_validation;}
+if(this->m_ptr_glBindTransformFeedback){this->m_orig_glBindTransformFeedback = this->m_ptr_glBindTransformFeedback;this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glBindTransformFeedback_validation;}
+if(this->m_ptr_glMultiTexCoord2iv){this->m_orig_glMultiTexCoord2iv = this->m_ptr_glMultiTexCoord2iv;this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&ValidationTableDecorator::m_glMultiTexCoord2iv_validation;}
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT){this->m_orig_glCopyMultiTexSubImage1DEXT = this->m_ptr_glCopyMultiTexSubImage1DEXT;this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCopyMultiTexSubImage1DEXT_validation;}
+if(this->m_ptr_glVariantbvEXT){this->m_orig_glVariantbvEXT = this->m_ptr_glVariantbvEXT;this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&ValidationTableDecorator::m_glVariantbvEXT_validation;}
+if(this->m_ptr_glTexCoord1hNV){this->m_orig_glTexCoord1hNV = this->m_ptr_glTexCoord1hNV;this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&ValidationTableDecorator::m_glTexCoord1hNV_validation;}
+if(this->m_ptr_glGenFencesNV){this->m_orig_glGenFencesNV = this->m_ptr_glGenFencesNV;this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&ValidationTableDecorator::m_glGenFencesNV_validation;}
+if(this->m_ptr_glRasterPos3iv){this->m_orig_glRasterPos3iv = this->m_ptr_glRasterPos3iv;this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&ValidationTableDecorator::m_glRasterPos3iv_validation;}
+if(this->m_ptr_glVertexAttribL2ui64NV){this->m_orig_glVertexAttribL2ui64NV = this->m_ptr_glVertexAttribL2ui64NV;this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&ValidationTableDecorator::m_glVertexAttribL2ui64NV_validation;}
+if(this->m_ptr_glMultiTexCoord1hvNV){this->m_orig_glMultiTexCoord1hvNV = this->m_ptr_glMultiTexCoord1hvNV;this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&ValidationTableDecorator::m_glMultiTexCoord1hvNV_validation;}
+if(this->m_ptr_glGetnConvolutionFilter){this->m_orig_glGetnConvolutionFilter = this->m_ptr_glGetnConvolutionFilter;this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&ValidationTableDecorator::m_glGetnConvolutionFilter_validation;}
+if(this->m_ptr_glNormal3bv){this->m_orig_glNormal3bv = this->m_ptr_glNormal3bv;this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&ValidationTableDecorator::m_glNormal3bv_validation;}
+if(this->m_ptr_glWeightbvARB){this->m_orig_glWeightbvARB = this->m_ptr_glWeightbvARB;this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&ValidationTableDecorator::m_glWeightbvARB_validation;}
+if(this->m_ptr_glTexCoord4sv){this->m_orig_glTexCoord4sv = this->m_ptr_glTexCoord4sv;this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&ValidationTableDecorator::m_glTexCoord4sv_validation;}
+if(this->m_ptr_glUniform2uiv){this->m_orig_glUniform2uiv = this->m_ptr_glUniform2uiv;this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&ValidationTableDecorator::m_glUniform2uiv_validation;}
+if(this->m_ptr_glBeginConditionalRenderNVX){this->m_orig_glBeginConditionalRenderNVX = this->m_ptr_glBeginConditionalRenderNVX;this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&ValidationTableDecorator::m_glBeginConditionalRenderNVX_validation;}
+if(this->m_ptr_glFinish){this->m_orig_glFinish = this->m_ptr_glFinish;this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&ValidationTableDecorator::m_glFinish_validation;}
+if(this->m_ptr_glColorTableParameterfv){this->m_orig_glColorTableParameterfv = this->m_ptr_glColorTableParameterfv;this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&ValidationTableDecorator::m_glColorTableParameterfv_validation;}
+if(this->m_ptr_glFragmentCoverageColorNV){this->m_orig_glFragmentCoverageColorNV = this->m_ptr_glFragmentCoverageColorNV;this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&ValidationTableDecorator::m_glFragmentCoverageColorNV_validation;}
+if(this->m_ptr_glProgramUniform3ivEXT){this->m_orig_glProgramUniform3ivEXT = this->m_ptr_glProgramUniform3ivEXT;this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&ValidationTableDecorator::m_glProgramUniform3ivEXT_validation;}
+if(this->m_ptr_glVertexArrayVertexOffsetEXT){this->m_orig_glVertexArrayVertexOffsetEXT = this->m_ptr_glVertexArrayVertexOffsetEXT;this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexOffsetEXT_validation;}
+if(this->m_ptr_glViewportPositionWScaleNV){this->m_orig_glViewportPositionWScaleNV = this->m_ptr_glViewportPositionWScaleNV;this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&ValidationTableDecorator::m_glViewportPositionWScaleNV_validation;}
+if(this->m_ptr_glGetProgramLocalParameterIuivNV){this->m_orig_glGetProgramLocalParameterIuivNV = this->m_ptr_glGetProgramLocalParameterIuivNV;this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&ValidationTableDecorator::m_glGetProgramLocalParameterIuivNV_validation;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN){this->m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_validation;}
+if(this->m_ptr_glUniform1uiv){this->m_orig_glUniform1uiv = this->m_ptr_glUniform1uiv;this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&ValidationTableDecorator::m_glUniform1uiv_validation;}
+if(this->m_ptr_glUniformMatrix2dv){this->m_orig_glUniformMatrix2dv = this->m_ptr_glUniformMatrix2dv;this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&ValidationTableDecorator::m_glUniformMatrix2dv_validation;}
+if(this->m_ptr_glIndexdv){this->m_orig_glIndexdv = this->m_ptr_glIndexdv;this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&ValidationTableDecorator::m_glIndexdv_validation;}
+if(this->m_ptr_glSecondaryColor3ivEXT){this->m_orig_glSecondaryColor3ivEXT = this->m_ptr_glSecondaryColor3ivEXT;this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3ivEXT_validation;}
+if(this->m_ptr_glTexCoord3iv){this->m_orig_glTexCoord3iv = this->m_ptr_glTexCoord3iv;this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&ValidationTableDecorator::m_glTexCoord3iv_validation;}
+if(this->m_ptr_glVertexStream4fvATI){this->m_orig_glVertexStream4fvATI = this->m_ptr_glVertexStream4fvATI;this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&ValidationTableDecorator::m_glVertexStream4fvATI_validation;}
+if(this->m_ptr_glDeformationMap3fSGIX){this->m_orig_glDeformationMap3fSGIX = this->m_ptr_glDeformationMap3fSGIX;this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&ValidationTableDecorator::m_glDeformationMap3fSGIX_validation;}
+if(this->m_ptr_glClearDepth){this->m_orig_glClearDepth = this->m_ptr_glClearDepth;this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&ValidationTableDecorator::m_glClearDepth_validation;}
+if(this->m_ptr_glGenAsyncMarkersSGIX){this->m_orig_glGenAsyncMarkersSGIX = this->m_ptr_glGenAsyncMarkersSGIX;this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&ValidationTableDecorator::m_glGenAsyncMarkersSGIX_validation;}
+if(this->m_ptr_glDisableIndexedEXT){this->m_orig_glDisableIndexedEXT = this->m_ptr_glDisableIndexedEXT;this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&ValidationTableDecorator::m_glDisableIndexedEXT_validation;}
+if(this->m_ptr_glVertexWeightfvEXT){this->m_orig_glVertexWeightfvEXT = this->m_ptr_glVertexWeightfvEXT;this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&ValidationTableDecorator::m_glVertexWeightfvEXT_validation;}
+if(this->m_ptr_glGetProgramLocalParameterIivNV){this->m_orig_glGetProgramLocalParameterIivNV = this->m_ptr_glGetProgramLocalParameterIivNV;this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&ValidationTableDecorator::m_glGetProgramLocalParameterIivNV_validation;}
+if(this->m_ptr_glCompressedTexImage3DARB){this->m_orig_glCompressedTexImage3DARB = this->m_ptr_glCompressedTexImage3DARB;this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&ValidationTableDecorator::m_glCompressedTexImage3DARB_validation;}
+if(this->m_ptr_glProgramParameter4fNV){this->m_orig_glProgramParameter4fNV = this->m_ptr_glProgramParameter4fNV;this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&ValidationTableDecorator::m_glProgramParameter4fNV_validation;}
+if(this->m_ptr_glConvolutionParameterxOES){this->m_orig_glConvolutionParameterxOES = this->m_ptr_glConvolutionParameterxOES;this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&ValidationTableDecorator::m_glConvolutionParameterxOES_validation;}
+if(this->m_ptr_glInsertComponentEXT){this->m_orig_glInsertComponentEXT = this->m_ptr_glInsertComponentEXT;this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&ValidationTableDecorator::m_glInsertComponentEXT_validation;}
+if(this->m_ptr_glCreateTextures){this->m_orig_glCreateTextures = this->m_ptr_glCreateTextures;this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&ValidationTableDecorator::m_glCreateTextures_validation;}
+if(this->m_ptr_glSecondaryColor3iv){this->m_orig_glSecondaryColor3iv = this->m_ptr_glSecondaryColor3iv;this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&ValidationTableDecorator::m_glSecondaryColor3iv_validation;}
+if(this->m_ptr_glCreateBuffers){this->m_orig_glCreateBuffers = this->m_ptr_glCreateBuffers;this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&ValidationTableDecorator::m_glCreateBuffers_validation;}
+if(this->m_ptr_glMultiTexCoord2xvOES){this->m_orig_glMultiTexCoord2xvOES = this->m_ptr_glMultiTexCoord2xvOES;this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord2xvOES_validation;}
+if(this->m_ptr_glTexGenxvOES){this->m_orig_glTexGenxvOES = this->m_ptr_glTexGenxvOES;this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&ValidationTableDecorator::m_glTexGenxvOES_validation;}
+if(this->m_ptr_glMultTransposeMatrixf){this->m_orig_glMultTransposeMatrixf = this->m_ptr_glMultTransposeMatrixf;this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&ValidationTableDecorator::m_glMultTransposeMatrixf_validation;}
+if(this->m_ptr_glBeginTransformFeedbackEXT){this->m_orig_glBeginTransformFeedbackEXT = this->m_ptr_glBeginTransformFeedbackEXT;this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&ValidationTableDecorator::m_glBeginTransformFeedbackEXT_validation;}
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN){this->m_orig_glTexCoord2fColor3fVertex3fSUN = this->m_ptr_glTexCoord2fColor3fVertex3fSUN;this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_validation;}
+if(this->m_ptr_glNormal3sv){this->m_orig_glNormal3sv = this->m_ptr_glNormal3sv;this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&ValidationTableDecorator::m_glNormal3sv_validation;}
+if(this->m_ptr_glFreeObjectBufferATI){this->m_orig_glFreeObjectBufferATI = this->m_ptr_glFreeObjectBufferATI;this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&ValidationTableDecorator::m_glFreeObjectBufferATI_validation;}
+if(this->m_ptr_glBlendBarrierNV){this->m_orig_glBlendBarrierNV = this->m_ptr_glBlendBarrierNV;this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&ValidationTableDecorator::m_glBlendBarrierNV_validation;}
+if(this->m_ptr_glUniform4i64vNV){this->m_orig_glUniform4i64vNV = this->m_ptr_glUniform4i64vNV;this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&ValidationTableDecorator::m_glUniform4i64vNV_validation;}
+if(this->m_ptr_glGetnUniformuivARB){this->m_orig_glGetnUniformuivARB = this->m_ptr_glGetnUniformuivARB;this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&ValidationTableDecorator::m_glGetnUniformuivARB_validation;}
+if(this->m_ptr_glAlphaFragmentOp3ATI){this->m_orig_glAlphaFragmentOp3ATI = this->m_ptr_glAlphaFragmentOp3ATI;this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&ValidationTableDecorator::m_glAlphaFragmentOp3ATI_validation;}
+if(this->m_ptr_glProgramEnvParameters4fvEXT){this->m_orig_glProgramEnvParameters4fvEXT = this->m_ptr_glProgramEnvParameters4fvEXT;this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&ValidationTableDecorator::m_glProgramEnvParameters4fvEXT_validation;}
+if(this->m_ptr_glBlendFuncSeparateEXT){this->m_orig_glBlendFuncSeparateEXT = this->m_ptr_glBlendFuncSeparateEXT;this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&ValidationTableDecorator::m_glBlendFuncSeparateEXT_validation;}
+if(this->m_ptr_glConvolutionParameterivEXT){this->m_orig_glConvolutionParameterivEXT = this->m_ptr_glConvolutionParameterivEXT;this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glConvolutionParameterivEXT_validation;}
+if(this->m_ptr_glPixelTexGenSGIX){this->m_orig_glPixelTexGenSGIX = this->m_ptr_glPixelTexGenSGIX;this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&ValidationTableDecorator::m_glPixelTexGenSGIX_validation;}
+if(this->m_ptr_glDeleteProgram){this->m_orig_glDeleteProgram = this->m_ptr_glDeleteProgram;this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&ValidationTableDecorator::m_glDeleteProgram_validation;}
+if(this->m_ptr_glUniformMatrix4x3dv){this->m_orig_glUniformMatrix4x3dv = this->m_ptr_glUniformMatrix4x3dv;this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&ValidationTableDecorator::m_glUniformMatrix4x3dv_validation;}
+if(this->m_ptr_glGetVideoCaptureStreamivNV){this->m_orig_glGetVideoCaptureStreamivNV = this->m_ptr_glGetVideoCaptureStreamivNV;this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&ValidationTableDecorator::m_glGetVideoCaptureStreamivNV_validation;}
+if(this->m_ptr_glProgramUniform4uiEXT){this->m_orig_glProgramUniform4uiEXT = this->m_ptr_glProgramUniform4uiEXT;this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&ValidationTableDecorator::m_glProgramUniform4uiEXT_validation;}
+if(this->m_ptr_glMakeImageHandleNonResidentARB){this->m_orig_glMakeImageHandleNonResidentARB = this->m_ptr_glMakeImageHandleNonResidentARB;this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&ValidationTableDecorator::m_glMakeImageHandleNonResidentARB_validation;}
+if(this->m_ptr_glSecondaryColor3dEXT){this->m_orig_glSecondaryColor3dEXT = this->m_ptr_glSecondaryColor3dEXT;this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3dEXT_validation;}
+if(this->m_ptr_glDeleteQueries){this->m_orig_glDeleteQueries = this->m_ptr_glDeleteQueries;this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&ValidationTableDecorator::m_glDeleteQueries_validation;}
+if(this->m_ptr_glNormalP3uiv){this->m_orig_glNormalP3uiv = this->m_ptr_glNormalP3uiv;this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&ValidationTableDecorator::m_glNormalP3uiv_validation;}
+if(this->m_ptr_glRasterPos2d){this->m_orig_glRasterPos2d = this->m_ptr_glRasterPos2d;this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&ValidationTableDecorator::m_glRasterPos2d_validation;}
+if(this->m_ptr_glInitNames){this->m_orig_glInitNames = this->m_ptr_glInitNames;this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&ValidationTableDecorator::m_glInitNames_validation;}
+if(this->m_ptr_glBinormal3fvEXT){this->m_orig_glBinormal3fvEXT = this->m_ptr_glBinormal3fvEXT;this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&ValidationTableDecorator::m_glBinormal3fvEXT_validation;}
+if(this->m_ptr_glColor3dv){this->m_orig_glColor3dv = this->m_ptr_glColor3dv;this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&ValidationTableDecorator::m_glColor3dv_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT){this->m_orig_glVertexArrayVertexAttribDivisorEXT = this->m_ptr_glVertexArrayVertexAttribDivisorEXT;this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_validation;}
+if(this->m_ptr_glArrayElementEXT){this->m_orig_glArrayElementEXT = this->m_ptr_glArrayElementEXT;this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&ValidationTableDecorator::m_glArrayElementEXT_validation;}
+if(this->m_ptr_glProgramParameter4dNV){this->m_orig_glProgramParameter4dNV = this->m_ptr_glProgramParameter4dNV;this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&ValidationTableDecorator::m_glProgramParameter4dNV_validation;}
+if(this->m_ptr_glIndexxOES){this->m_orig_glIndexxOES = this->m_ptr_glIndexxOES;this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&ValidationTableDecorator::m_glIndexxOES_validation;}
+if(this->m_ptr_glUniform3uivEXT){this->m_orig_glUniform3uivEXT = this->m_ptr_glUniform3uivEXT;this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&ValidationTableDecorator::m_glUniform3uivEXT_validation;}
+if(this->m_ptr_glPopGroupMarkerEXT){this->m_orig_glPopGroupMarkerEXT = this->m_ptr_glPopGroupMarkerEXT;this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&ValidationTableDecorator::m_glPopGroupMarkerEXT_validation;}
+if(this->m_ptr_glClearNamedFramebufferuiv){this->m_orig_glClearNamedFramebufferuiv = this->m_ptr_glClearNamedFramebufferuiv;this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&ValidationTableDecorator::m_glClearNamedFramebufferuiv_validation;}
+if(this->m_ptr_glSetLocalConstantEXT){this->m_orig_glSetLocalConstantEXT = this->m_ptr_glSetLocalConstantEXT;this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&ValidationTableDecorator::m_glSetLocalConstantEXT_validation;}
+if(this->m_ptr_glProgramUniform1ui64NV){this->m_orig_glProgramUniform1ui64NV = this->m_ptr_glProgramUniform1ui64NV;this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&ValidationTableDecorator::m_glProgramUniform1ui64NV_validation;}
+if(this->m_ptr_glColor4hvNV){this->m_orig_glColor4hvNV = this->m_ptr_glColor4hvNV;this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&ValidationTableDecorator::m_glColor4hvNV_validation;}
+if(this->m_ptr_glGetVertexAttribfv){this->m_orig_glGetVertexAttribfv = this->m_ptr_glGetVertexAttribfv;this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&ValidationTableDecorator::m_glGetVertexAttribfv_validation;}
+if(this->m_ptr_glDispatchCompute){this->m_orig_glDispatchCompute = this->m_ptr_glDispatchCompute;this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&ValidationTableDecorator::m_glDispatchCompute_validation;}
+if(this->m_ptr_glGetActiveAttrib){this->m_orig_glGetActiveAttrib = this->m_ptr_glGetActiveAttrib;this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&ValidationTableDecorator::m_glGetActiveAttrib_validation;}
+if(this->m_ptr_glFragmentColorMaterialSGIX){this->m_orig_glFragmentColorMaterialSGIX = this->m_ptr_glFragmentColorMaterialSGIX;this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&ValidationTableDecorator::m_glFragmentColorMaterialSGIX_validation;}
+if(this->m_ptr_glTexSubImage2D){this->m_orig_glTexSubImage2D = this->m_ptr_glTexSubImage2D;this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&ValidationTableDecorator::m_glTexSubImage2D_validation;}
+if(this->m_ptr_glGetnMinmaxARB){this->m_orig_glGetnMinmaxARB = this->m_ptr_glGetnMinmaxARB;this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&ValidationTableDecorator::m_glGetnMinmaxARB_validation;}
+if(this->m_ptr_glLogicOp){this->m_orig_glLogicOp = this->m_ptr_glLogicOp;this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&ValidationTableDecorator::m_glLogicOp_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x4fv){this->m_orig_glProgramUniformMatrix3x4fv = this->m_ptr_glProgramUniformMatrix3x4fv;this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x4fv_validation;}
+if(this->m_ptr_glWindowPos4iMESA){this->m_orig_glWindowPos4iMESA = this->m_ptr_glWindowPos4iMESA;this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&ValidationTableDecorator::m_glWindowPos4iMESA_validation;}
+if(this->m_ptr_glPixelTransferf){this->m_orig_glPixelTransferf = this->m_ptr_glPixelTransferf;this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&ValidationTableDecorator::m_glPixelTransferf_validation;}
+if(this->m_ptr_glGetTextureParameterIuiv){this->m_orig_glGetTextureParameterIuiv = this->m_ptr_glGetTextureParameterIuiv;this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&ValidationTableDecorator::m_glGetTextureParameterIuiv_validation;}
+if(this->m_ptr_glMultiTexCoord1xOES){this->m_orig_glMultiTexCoord1xOES = this->m_ptr_glMultiTexCoord1xOES;this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&ValidationTableDecorator::m_glMultiTexCoord1xOES_validation;}
+if(this->m_ptr_glProgramUniformMatrix4dv){this->m_orig_glProgramUniformMatrix4dv = this->m_ptr_glProgramUniformMatrix4dv;this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4dv_validation;}
+if(this->m_ptr_glGetnUniformiv){this->m_orig_glGetnUniformiv = this->m_ptr_glGetnUniformiv;this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&ValidationTableDecorator::m_glGetnUniformiv_validation;}
+if(this->m_ptr_glFramebufferTexture1DEXT){this->m_orig_glFramebufferTexture1DEXT = this->m_ptr_glFramebufferTexture1DEXT;this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&ValidationTableDecorator::m_glFramebufferTexture1DEXT_validation;}
+if(this->m_ptr_glVertexPointervINTEL){this->m_orig_glVertexPointervINTEL = this->m_ptr_glVertexPointervINTEL;this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&ValidationTableDecorator::m_glVertexPointervINTEL_validation;}
+if(this->m_ptr_glTextureParameterIiv){this->m_orig_glTextureParameterIiv = this->m_ptr_glTextureParameterIiv;this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&ValidationTableDecorator::m_glTextureParameterIiv_validation;}
+if(this->m_ptr_glGetSeparableFilterEXT){this->m_orig_glGetSeparableFilterEXT = this->m_ptr_glGetSeparableFilterEXT;this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&ValidationTableDecorator::m_glGetSeparableFilterEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3iARB){this->m_orig_glMultiTexCoord3iARB = this->m_ptr_glMultiTexCoord3iARB;this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3iARB_validation;}
+if(this->m_ptr_glRasterPos4xvOES){this->m_orig_glRasterPos4xvOES = this->m_ptr_glRasterPos4xvOES;this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&ValidationTableDecorator::m_glRasterPos4xvOES_validation;}
+if(this->m_ptr_glDrawTransformFeedbackStream){this->m_orig_glDrawTransformFeedbackStream = this->m_ptr_glDrawTransformFeedbackStream;this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&ValidationTableDecorator::m_glDrawTransformFeedbackStream_validation;}
+if(this->m_ptr_glVertex3hvNV){this->m_orig_glVertex3hvNV = this->m_ptr_glVertex3hvNV;this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&ValidationTableDecorator::m_glVertex3hvNV_validation;}
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT){this->m_orig_glVertexArrayMultiTexCoordOffsetEXT = this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT;this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_validation;}
+if(this->m_ptr_glProvokingVertex){this->m_orig_glProvokingVertex = this->m_ptr_glProvokingVertex;this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&ValidationTableDecorator::m_glProvokingVertex_validation;}
+if(this->m_ptr_glAccumxOES){this->m_orig_glAccumxOES = this->m_ptr_glAccumxOES;this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&ValidationTableDecorator::m_glAccumxOES_validation;}
+if(this->m_ptr_glShaderBinary){this->m_orig_glShaderBinary = this->m_ptr_glShaderBinary;this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&ValidationTableDecorator::m_glShaderBinary_validation;}
+if(this->m_ptr_glGetMultiTexGenivEXT){this->m_orig_glGetMultiTexGenivEXT = this->m_ptr_glGetMultiTexGenivEXT;this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexGenivEXT_validation;}
+if(this->m_ptr_glPointParameterxvOES){this->m_orig_glPointParameterxvOES = this->m_ptr_glPointParameterxvOES;this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&ValidationTableDecorator::m_glPointParameterxvOES_validation;}
+if(this->m_ptr_glCreateStatesNV){this->m_orig_glCreateStatesNV = this->m_ptr_glCreateStatesNV;this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&ValidationTableDecorator::m_glCreateStatesNV_validation;}
+if(this->m_ptr_glClearDepthdNV){this->m_orig_glClearDepthdNV = this->m_ptr_glClearDepthdNV;this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&ValidationTableDecorator::m_glClearDepthdNV_validation;}
+if(this->m_ptr_glClearColorIuiEXT){this->m_orig_glClearColorIuiEXT = this->m_ptr_glClearColorIuiEXT;this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&ValidationTableDecorator::m_glClearColorIuiEXT_validation;}
+if(this->m_ptr_glBindMultiTextureEXT){this->m_orig_glBindMultiTextureEXT = this->m_ptr_glBindMultiTextureEXT;this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&ValidationTableDecorator::m_glBindMultiTextureEXT_validation;}
+if(this->m_ptr_glTexGeniv){this->m_orig_glTexGeniv = this->m_ptr_glTexGeniv;this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&ValidationTableDecorator::m_glTexGeniv_validation;}
+if(this->m_ptr_glDrawElements){this->m_orig_glDrawElements = this->m_ptr_glDrawElements;this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&ValidationTableDecorator::m_glDrawElements_validation;}
+if(this->m_ptr_glProgramUniform4iv){this->m_orig_glProgramUniform4iv = this->m_ptr_glProgramUniform4iv;this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&ValidationTableDecorator::m_glProgramUniform4iv_validation;}
+if(this->m_ptr_glDisableVertexArrayEXT){this->m_orig_glDisableVertexArrayEXT = this->m_ptr_glDisableVertexArrayEXT;this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&ValidationTableDecorator::m_glDisableVertexArrayEXT_validation;}
+if(this->m_ptr_glProgramUniform3ui64NV){this->m_orig_glProgramUniform3ui64NV = this->m_ptr_glProgramUniform3ui64NV;this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&ValidationTableDecorator::m_glProgramUniform3ui64NV_validation;}
+if(this->m_ptr_glClientActiveTexture){this->m_orig_glClientActiveTexture = this->m_ptr_glClientActiveTexture;this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&ValidationTableDecorator::m_glClientActiveTexture_validation;}
+if(this->m_ptr_glMultiTexParameterIivEXT){this->m_orig_glMultiTexParameterIivEXT = this->m_ptr_glMultiTexParameterIivEXT;this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glMultiTexParameterIivEXT_validation;}
+if(this->m_ptr_glUniform1i64ARB){this->m_orig_glUniform1i64ARB = this->m_ptr_glUniform1i64ARB;this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&ValidationTableDecorator::m_glUniform1i64ARB_validation;}
+if(this->m_ptr_glUniform1iv){this->m_orig_glUniform1iv = this->m_ptr_glUniform1iv;this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&ValidationTableDecorator::m_glUniform1iv_validation;}
+if(this->m_ptr_glMulticastBarrierNV){this->m_orig_glMulticastBarrierNV = this->m_ptr_glMulticastBarrierNV;this->m_ptr_glMulticastBarrierNV = (FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC)&ValidationTableDecorator::m_glMulticastBarrierNV_validation;}
+if(this->m_ptr_glVertexAttribArrayObjectATI){this->m_orig_glVertexAttribArrayObjectATI = this->m_ptr_glVertexAttribArrayObjectATI;this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&ValidationTableDecorator::m_glVertexAttribArrayObjectATI_validation;}
+if(this->m_ptr_glUniform2iARB){this->m_orig_glUniform2iARB = this->m_ptr_glUniform2iARB;this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&ValidationTableDecorator::m_glUniform2iARB_validation;}
+if(this->m_ptr_glDrawArraysInstanced){this->m_orig_glDrawArraysInstanced = this->m_ptr_glDrawArraysInstanced;this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&ValidationTableDecorator::m_glDrawArraysInstanced_validation;}
+if(this->m_ptr_glVertexAttrib2sNV){this->m_orig_glVertexAttrib2sNV = this->m_ptr_glVertexAttrib2sNV;this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&ValidationTableDecorator::m_glVertexAttrib2sNV_validation;}
+if(this->m_ptr_glTexBufferEXT){this->m_orig_glTexBufferEXT = this->m_ptr_glTexBufferEXT;this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&ValidationTableDecorator::m_glTexBufferEXT_validation;}
+if(this->m_ptr_glVertexStream2fATI){this->m_orig_glVertexStream2fATI = this->m_ptr_glVertexStream2fATI;this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&ValidationTableDecorator::m_glVertexStream2fATI_validation;}
+if(this->m_ptr_glDebugMessageCallbackAMD){this->m_orig_glDebugMessageCallbackAMD = this->m_ptr_glDebugMessageCallbackAMD;this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&ValidationTableDecorator::m_glDebugMessageCallbackAMD_validation;}
+if(this->m_ptr_glSamplerParameteriv){this->m_orig_glSamplerParameteriv = this->m_ptr_glSamplerParameteriv;this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&ValidationTableDecorator::m_glSamplerParameteriv_validation;}
+if(this->m_ptr_glVertexAttrib4uiv){this->m_orig_glVertexAttrib4uiv = this->m_ptr_glVertexAttrib4uiv;this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&ValidationTableDecorator::m_glVertexAttrib4uiv_validation;}
+if(this->m_ptr_glEndQueryIndexed){this->m_orig_glEndQueryIndexed = this->m_ptr_glEndQueryIndexed;this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&ValidationTableDecorator::m_glEndQueryIndexed_validation;}
+if(this->m_ptr_glNormalStream3sATI){this->m_orig_glNormalStream3sATI = this->m_ptr_glNormalStream3sATI;this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&ValidationTableDecorator::m_glNormalStream3sATI_validation;}
+if(this->m_ptr_glProgramParameteriARB){this->m_orig_glProgramParameteriARB = this->m_ptr_glProgramParameteriARB;this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&ValidationTableDecorator::m_glProgramParameteriARB_validation;}
+if(this->m_ptr_glTexEnvxOES){this->m_orig_glTexEnvxOES = this->m_ptr_glTexEnvxOES;this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&ValidationTableDecorator::m_glTexEnvxOES_validation;}
+if(this->m_ptr_glProgramUniform1iv){this->m_orig_glProgramUniform1iv = this->m_ptr_glProgramUniform1iv;this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&ValidationTableDecorator::m_glProgramUniform1iv_validation;}
+if(this->m_ptr_glDisableVertexAttribAPPLE){this->m_orig_glDisableVertexAttribAPPLE = this->m_ptr_glDisableVertexAttribAPPLE;this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&ValidationTableDecorator::m_glDisableVertexAttribAPPLE_validation;}
+if(this->m_ptr_glBindRenderbuffer){this->m_orig_glBindRenderbuffer = this->m_ptr_glBindRenderbuffer;this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&ValidationTableDecorator::m_glBindRenderbuffer_validation;}
+if(this->m_ptr_glMultiTexSubImage3DEXT){this->m_orig_glMultiTexSubImage3DEXT = this->m_ptr_glMultiTexSubImage3DEXT;this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&ValidationTableDecorator::m_glMultiTexSubImage3DEXT_validation;}
+if(this->m_ptr_glIsProgram){this->m_orig_glIsProgram = this->m_ptr_glIsProgram;this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&ValidationTableDecorator::m_glIsProgram_validation;}
+if(this->m_ptr_glMultiDrawElementsIndirectAMD){this->m_orig_glMultiDrawElementsIndirectAMD = this->m_ptr_glMultiDrawElementsIndirectAMD;this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&ValidationTableDecorator::m_glMultiDrawElementsIndirectAMD_validation;}
+if(this->m_ptr_glGetProgramInfoLog){this->m_orig_glGetProgramInfoLog = this->m_ptr_glGetProgramInfoLog;this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&ValidationTableDecorator::m_glGetProgramInfoLog_validation;}
+if(this->m_ptr_glGetLocalConstantBooleanvEXT){this->m_orig_glGetLocalConstantBooleanvEXT = this->m_ptr_glGetLocalConstantBooleanvEXT;this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&ValidationTableDecorator::m_glGetLocalConstantBooleanvEXT_validation;}
+if(this->m_ptr_glPixelTransformParameteriEXT){this->m_orig_glPixelTransformParameteriEXT = this->m_ptr_glPixelTransformParameteriEXT;this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&ValidationTableDecorator::m_glPixelTransformParameteriEXT_validation;}
+if(this->m_ptr_glTexCoord4bOES){this->m_orig_glTexCoord4bOES = this->m_ptr_glTexCoord4bOES;this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&ValidationTableDecorator::m_glTexCoord4bOES_validation;}
+if(this->m_ptr_glVertexAttrib4fv){this->m_orig_glVertexAttrib4fv = this->m_ptr_glVertexAttrib4fv;this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&ValidationTableDecorator::m_glVertexAttrib4fv_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x3dv){this->m_orig_glProgramUniformMatrix2x3dv = this->m_ptr_glProgramUniformMatrix2x3dv;this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x3dv_validation;}
+if(this->m_ptr_glProgramEnvParametersI4uivNV){this->m_orig_glProgramEnvParametersI4uivNV = this->m_ptr_glProgramEnvParametersI4uivNV;this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&ValidationTableDecorator::m_glProgramEnvParametersI4uivNV_validation;}
+if(this->m_ptr_glTexCoord3xOES){this->m_orig_glTexCoord3xOES = this->m_ptr_glTexCoord3xOES;this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&ValidationTableDecorator::m_glTexCoord3xOES_validation;}
+if(this->m_ptr_glLoadTransposeMatrixfARB){this->m_orig_glLoadTransposeMatrixfARB = this->m_ptr_glLoadTransposeMatrixfARB;this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&ValidationTableDecorator::m_glLoadTransposeMatrixfARB_validation;}
+if(this->m_ptr_glImageTransformParameteriHP){this->m_orig_glImageTransformParameteriHP = this->m_ptr_glImageTransformParameteriHP;this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&ValidationTableDecorator::m_glImageTransformParameteriHP_validation;}
+if(this->m_ptr_glMultiTexCoord4xOES){this->m_orig_glMultiTexCoord4xOES = this->m_ptr_glMultiTexCoord4xOES;this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&ValidationTableDecorator::m_glMultiTexCoord4xOES_validation;}
+if(this->m_ptr_glVertexAttribs3fvNV){this->m_orig_glVertexAttribs3fvNV = this->m_ptr_glVertexAttribs3fvNV;this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&ValidationTableDecorator::m_glVertexAttribs3fvNV_validation;}
+if(this->m_ptr_glVertexAttrib2fv){this->m_orig_glVertexAttrib2fv = this->m_ptr_glVertexAttrib2fv;this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&ValidationTableDecorator::m_glVertexAttrib2fv_validation;}
+if(this->m_ptr_glUniform3ui64NV){this->m_orig_glUniform3ui64NV = this->m_ptr_glUniform3ui64NV;this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&ValidationTableDecorator::m_glUniform3ui64NV_validation;}
+if(this->m_ptr_glCombinerParameterfvNV){this->m_orig_glCombinerParameterfvNV = this->m_ptr_glCombinerParameterfvNV;this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&ValidationTableDecorator::m_glCombinerParameterfvNV_validation;}
+if(this->m_ptr_glFragmentMaterialiSGIX){this->m_orig_glFragmentMaterialiSGIX = this->m_ptr_glFragmentMaterialiSGIX;this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&ValidationTableDecorator::m_glFragmentMaterialiSGIX_validation;}
+if(this->m_ptr_glGetBooleani_v){this->m_orig_glGetBooleani_v = this->m_ptr_glGetBooleani_v;this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&ValidationTableDecorator::m_glGetBooleani_v_validation;}
+if(this->m_ptr_glGetProgramResourceIndex){this->m_orig_glGetProgramResourceIndex = this->m_ptr_glGetProgramResourceIndex;this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&ValidationTableDecorator::m_glGetProgramResourceIndex_validation;}
+if(this->m_ptr_glBeginConditionalRenderNV){this->m_orig_glBeginConditionalRenderNV = this->m_ptr_glBeginConditionalRenderNV;this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&ValidationTableDecorator::m_glBeginConditionalRenderNV_validation;}
+if(this->m_ptr_glDisableClientState){this->m_orig_glDisableClientState = this->m_ptr_glDisableClientState;this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&ValidationTableDecorator::m_glDisableClientState_validation;}
+if(this->m_ptr_glPathFogGenNV){this->m_orig_glPathFogGenNV = this->m_ptr_glPathFogGenNV;this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&ValidationTableDecorator::m_glPathFogGenNV_validation;}
+if(this->m_ptr_glStencilThenCoverFillPathNV){this->m_orig_glStencilThenCoverFillPathNV = this->m_ptr_glStencilThenCoverFillPathNV;this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&ValidationTableDecorator::m_glStencilThenCoverFillPathNV_validation;}
+if(this->m_ptr_glVertexArrayIndexOffsetEXT){this->m_orig_glVertexArrayIndexOffsetEXT = this->m_ptr_glVertexArrayIndexOffsetEXT;this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayIndexOffsetEXT_validation;}
+if(this->m_ptr_glProgramBufferParametersIuivNV){this->m_orig_glProgramBufferParametersIuivNV = this->m_ptr_glProgramBufferParametersIuivNV;this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&ValidationTableDecorator::m_glProgramBufferParametersIuivNV_validation;}
+if(this->m_ptr_glPixelTransformParameterivEXT){this->m_orig_glPixelTransformParameterivEXT = this->m_ptr_glPixelTransformParameterivEXT;this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glPixelTransformParameterivEXT_validation;}
+if(this->m_ptr_glDisableClientStateiEXT){this->m_orig_glDisableClientStateiEXT = this->m_ptr_glDisableClientStateiEXT;this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&ValidationTableDecorator::m_glDisableClientStateiEXT_validation;}
+if(this->m_ptr_glTexBufferARB){this->m_orig_glTexBufferARB = this->m_ptr_glTexBufferARB;this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&ValidationTableDecorator::m_glTexBufferARB_validation;}
+if(this->m_ptr_glGetLocalConstantIntegervEXT){this->m_orig_glGetLocalConstantIntegervEXT = this->m_ptr_glGetLocalConstantIntegervEXT;this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&ValidationTableDecorator::m_glGetLocalConstantIntegervEXT_validation;}
+if(this->m_ptr_glColor4uiv){this->m_orig_glColor4uiv = this->m_ptr_glColor4uiv;this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&ValidationTableDecorator::m_glColor4uiv_validation;}
+if(this->m_ptr_glProgramUniform3i){this->m_orig_glProgramUniform3i = this->m_ptr_glProgramUniform3i;this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&ValidationTableDecorator::m_glProgramUniform3i_validation;}
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV){this->m_orig_glMultiDrawElementsIndirectBindlessCountNV = this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV;this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&ValidationTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_validation;}
+if(this->m_ptr_glGetBufferPointervARB){this->m_orig_glGetBufferPointervARB = this->m_ptr_glGetBufferPointervARB;this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&ValidationTableDecorator::m_glGetBufferPointervARB_validation;}
+if(this->m_ptr_glMultiTexParameterIuivEXT){this->m_orig_glMultiTexParameterIuivEXT = this->m_ptr_glMultiTexParameterIuivEXT;this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glMultiTexParameterIuivEXT_validation;}
+if(this->m_ptr_glEvalMesh2){this->m_orig_glEvalMesh2 = this->m_ptr_glEvalMesh2;this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&ValidationTableDecorator::m_glEvalMesh2_validation;}
+if(this->m_ptr_glEvalMesh1){this->m_orig_glEvalMesh1 = this->m_ptr_glEvalMesh1;this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&ValidationTableDecorator::m_glEvalMesh1_validation;}
+if(this->m_ptr_glProgramUniform3f){this->m_orig_glProgramUniform3f = this->m_ptr_glProgramUniform3f;this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&ValidationTableDecorator::m_glProgramUniform3f_validation;}
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV){this->m_orig_glStencilThenCoverFillPathInstancedNV = this->m_ptr_glStencilThenCoverFillPathInstancedNV;this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&ValidationTableDecorator::m_glStencilThenCoverFillPathInstancedNV_validation;}
+if(this->m_ptr_glProgramUniform3d){this->m_orig_glProgramUniform3d = this->m_ptr_glProgramUniform3d;this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&ValidationTableDecorator::m_glProgramUniform3d_validation;}
+if(this->m_ptr_glMapVertexAttrib1dAPPLE){this->m_orig_glMapVertexAttrib1dAPPLE = this->m_ptr_glMapVertexAttrib1dAPPLE;this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&ValidationTableDecorator::m_glMapVertexAttrib1dAPPLE_validation;}
+if(this->m_ptr_glEvalCoord2fv){this->m_orig_glEvalCoord2fv = this->m_ptr_glEvalCoord2fv;this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&ValidationTableDecorator::m_glEvalCoord2fv_validation;}
+if(this->m_ptr_glGetUniformivARB){this->m_orig_glGetUniformivARB = this->m_ptr_glGetUniformivARB;this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&ValidationTableDecorator::m_glGetUniformivARB_validation;}
+if(this->m_ptr_glLoadTransposeMatrixd){this->m_orig_glLoadTransposeMatrixd = this->m_ptr_glLoadTransposeMatrixd;this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&ValidationTableDecorator::m_glLoadTransposeMatrixd_validation;}
+if(this->m_ptr_glLoadTransposeMatrixf){this->m_orig_glLoadTransposeMatrixf = this->m_ptr_glLoadTransposeMatrixf;this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&ValidationTableDecorator::m_glLoadTransposeMatrixf_validation;}
+if(this->m_ptr_glGetPointervEXT){this->m_orig_glGetPointervEXT = this->m_ptr_glGetPointervEXT;this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&ValidationTableDecorator::m_glGetPointervEXT_validation;}
+if(this->m_ptr_glSignalVkSemaphoreNV){this->m_orig_glSignalVkSemaphoreNV = this->m_ptr_glSignalVkSemaphoreNV;this->m_ptr_glSignalVkSemaphoreNV = (FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC)&ValidationTableDecorator::m_glSignalVkSemaphoreNV_validation;}
+if(this->m_ptr_glEndConditionalRenderNV){this->m_orig_glEndConditionalRenderNV = this->m_ptr_glEndConditionalRenderNV;this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&ValidationTableDecorator::m_glEndConditionalRenderNV_validation;}
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN){this->m_orig_glTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fSUN;this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glUniform3i64vARB){this->m_orig_glUniform3i64vARB = this->m_ptr_glUniform3i64vARB;this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&ValidationTableDecorator::m_glUniform3i64vARB_validation;}
+if(this->m_ptr_glProgramUniform2uiEXT){this->m_orig_glProgramUniform2uiEXT = this->m_ptr_glProgramUniform2uiEXT;this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&ValidationTableDecorator::m_glProgramUniform2uiEXT_validation;}
+if(this->m_ptr_glVertexAttribI1ui){this->m_orig_glVertexAttribI1ui = this->m_ptr_glVertexAttribI1ui;this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&ValidationTableDecorator::m_glVertexAttribI1ui_validation;}
+if(this->m_ptr_glProgramNamedParameter4dvNV){this->m_orig_glProgramNamedParameter4dvNV = this->m_ptr_glProgramNamedParameter4dvNV;this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&ValidationTableDecorator::m_glProgramNamedParameter4dvNV_validation;}
+if(this->m_ptr_glCompileCommandListNV){this->m_orig_glCompileCommandListNV = this->m_ptr_glCompileCommandListNV;this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&ValidationTableDecorator::m_glCompileCommandListNV_validation;}
+if(this->m_ptr_glGetRenderbufferParameterivEXT){this->m_orig_glGetRenderbufferParameterivEXT = this->m_ptr_glGetRenderbufferParameterivEXT;this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetRenderbufferParameterivEXT_validation;}
+if(this->m_ptr_glGetnPolygonStipple){this->m_orig_glGetnPolygonStipple = this->m_ptr_glGetnPolygonStipple;this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&ValidationTableDecorator::m_glGetnPolygonStipple_validation;}
+if(this->m_ptr_glIsBufferResidentNV){this->m_orig_glIsBufferResidentNV = this->m_ptr_glIsBufferResidentNV;this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&ValidationTableDecorator::m_glIsBufferResidentNV_validation;}
+if(this->m_ptr_glSecondaryColor3ubvEXT){this->m_orig_glSecondaryColor3ubvEXT = this->m_ptr_glSecondaryColor3ubvEXT;this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3ubvEXT_validation;}
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT){this->m_orig_glGetNamedRenderbufferParameterivEXT = this->m_ptr_glGetNamedRenderbufferParameterivEXT;this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetNamedRenderbufferParameterivEXT_validation;}
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB){this->m_orig_glNamedFramebufferSampleLocationsfvARB = this->m_ptr_glNamedFramebufferSampleLocationsfvARB;this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ValidationTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_validation;}
+if(this->m_ptr_glMultiTexGendvEXT){this->m_orig_glMultiTexGendvEXT = this->m_ptr_glMultiTexGendvEXT;this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&ValidationTableDecorator::m_glMultiTexGendvEXT_validation;}
+if(this->m_ptr_glVertexArrayRangeNV){this->m_orig_glVertexArrayRangeNV = this->m_ptr_glVertexArrayRangeNV;this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&ValidationTableDecorator::m_glVertexArrayRangeNV_validation;}
+if(this->m_ptr_glIsTextureHandleResidentNV){this->m_orig_glIsTextureHandleResidentNV = this->m_ptr_glIsTextureHandleResidentNV;this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&ValidationTableDecorator::m_glIsTextureHandleResidentNV_validation;}
+if(this->m_ptr_glGetProgramEnvParameterdvARB){this->m_orig_glGetProgramEnvParameterdvARB = this->m_ptr_glGetProgramEnvParameterdvARB;this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&ValidationTableDecorator::m_glGetProgramEnvParameterdvARB_validation;}
+if(this->m_ptr_glIsNamedStringARB){this->m_orig_glIsNamedStringARB = this->m_ptr_glIsNamedStringARB;this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&ValidationTableDecorator::m_glIsNamedStringARB_validation;}
+if(this->m_ptr_glSecondaryColorFormatNV){this->m_orig_glSecondaryColorFormatNV = this->m_ptr_glSecondaryColorFormatNV;this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&ValidationTableDecorator::m_glSecondaryColorFormatNV_validation;}
+if(this->m_ptr_glVertexAttrib4ubvNV){this->m_orig_glVertexAttrib4ubvNV = this->m_ptr_glVertexAttrib4ubvNV;this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&ValidationTableDecorator::m_glVertexAttrib4ubvNV_validation;}
+if(this->m_ptr_glTagSampleBufferSGIX){this->m_orig_glTagSampleBufferSGIX = this->m_ptr_glTagSampleBufferSGIX;this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&ValidationTableDecorator::m_glTagSampleBufferSGIX_validation;}
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV){this->m_orig_glVDPAUUnregisterSurfaceNV = this->m_ptr_glVDPAUUnregisterSurfaceNV;this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&ValidationTableDecorator::m_glVDPAUUnregisterSurfaceNV_validation;}
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL){this->m_orig_glGetPerfQueryIdByNameINTEL = this->m_ptr_glGetPerfQueryIdByNameINTEL;this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&ValidationTableDecorator::m_glGetPerfQueryIdByNameINTEL_validation;}
+if(this->m_ptr_glGetInteger64v){this->m_orig_glGetInteger64v = this->m_ptr_glGetInteger64v;this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&ValidationTableDecorator::m_glGetInteger64v_validation;}
+if(this->m_ptr_glClipPlane){this->m_orig_glClipPlane = this->m_ptr_glClipPlane;this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&ValidationTableDecorator::m_glClipPlane_validation;}
+if(this->m_ptr_glColor4ubVertex3fSUN){this->m_orig_glColor4ubVertex3fSUN = this->m_ptr_glColor4ubVertex3fSUN;this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&ValidationTableDecorator::m_glColor4ubVertex3fSUN_validation;}
+if(this->m_ptr_glIndexub){this->m_orig_glIndexub = this->m_ptr_glIndexub;this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&ValidationTableDecorator::m_glIndexub_validation;}
+if(this->m_ptr_glGetProgramEnvParameterfvARB){this->m_orig_glGetProgramEnvParameterfvARB = this->m_ptr_glGetProgramEnvParameterfvARB;this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&ValidationTableDecorator::m_glGetProgramEnvParameterfvARB_validation;}
+if(this->m_ptr_glVertexAttrib4usvARB){this->m_orig_glVertexAttrib4usvARB = this->m_ptr_glVertexAttrib4usvARB;this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4usvARB_validation;}
+if(this->m_ptr_glNamedFramebufferRenderbuffer){this->m_orig_glNamedFramebufferRenderbuffer = this->m_ptr_glNamedFramebufferRenderbuffer;this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&ValidationTableDecorator::m_glNamedFramebufferRenderbuffer_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x4dv){this->m_orig_glProgramUniformMatrix3x4dv = this->m_ptr_glProgramUniformMatrix3x4dv;this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x4dv_validation;}
+if(this->m_ptr_glTestFenceAPPLE){this->m_orig_glTestFenceAPPLE = this->m_ptr_glTestFenceAPPLE;this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&ValidationTableDecorator::m_glTestFenceAPPLE_validation;}
+if(this->m_ptr_glVertexAttrib4Niv){this->m_orig_glVertexAttrib4Niv = this->m_ptr_glVertexAttrib4Niv;this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&ValidationTableDecorator::m_glVertexAttrib4Niv_validation;}
+if(this->m_ptr_glVertexAttribL2i64vNV){this->m_orig_glVertexAttribL2i64vNV = this->m_ptr_glVertexAttribL2i64vNV;this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL2i64vNV_validation;}
+if(this->m_ptr_glColorP4uiv){this->m_orig_glColorP4uiv = this->m_ptr_glColorP4uiv;this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&ValidationTableDecorator::m_glColorP4uiv_validation;}
+if(this->m_ptr_glUniformMatrix2x3fv){this->m_orig_glUniformMatrix2x3fv = this->m_ptr_glUniformMatrix2x3fv;this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&ValidationTableDecorator::m_glUniformMatrix2x3fv_validation;}
+if(this->m_ptr_glCallCommandListNV){this->m_orig_glCallCommandListNV = this->m_ptr_glCallCommandListNV;this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&ValidationTableDecorator::m_glCallCommandListNV_validation;}
+if(this->m_ptr_glClearBufferiv){this->m_orig_glClearBufferiv = this->m_ptr_glClearBufferiv;this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&ValidationTableDecorator::m_glClearBufferiv_validation;}
+if(this->m_ptr_glNamedStringARB){this->m_orig_glNamedStringARB = this->m_ptr_glNamedStringARB;this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&ValidationTableDecorator::m_glNamedStringARB_validation;}
+if(this->m_ptr_glMatrixMult3x2fNV){this->m_orig_glMatrixMult3x2fNV = this->m_ptr_glMatrixMult3x2fNV;this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&ValidationTableDecorator::m_glMatrixMult3x2fNV_validation;}
+if(this->m_ptr_glGetNamedProgramStringEXT){this->m_orig_glGetNamedProgramStringEXT = this->m_ptr_glGetNamedProgramStringEXT;this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&ValidationTableDecorator::m_glGetNamedProgramStringEXT_validation;}
+if(this->m_ptr_glGetnHistogramARB){this->m_orig_glGetnHistogramARB = this->m_ptr_glGetnHistogramARB;this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&ValidationTableDecorator::m_glGetnHistogramARB_validation;}
+if(this->m_ptr_glGetTextureLevelParameterfv){this->m_orig_glGetTextureLevelParameterfv = this->m_ptr_glGetTextureLevelParameterfv;this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&ValidationTableDecorator::m_glGetTextureLevelParameterfv_validation;}
+if(this->m_ptr_glMultiTexCoord1fv){this->m_orig_glMultiTexCoord1fv = this->m_ptr_glMultiTexCoord1fv;this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&ValidationTableDecorator::m_glMultiTexCoord1fv_validation;}
+if(this->m_ptr_glBitmapxOES){this->m_orig_glBitmapxOES = this->m_ptr_glBitmapxOES;this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&ValidationTableDecorator::m_glBitmapxOES_validation;}
+if(this->m_ptr_glGetSamplerParameterIuiv){this->m_orig_glGetSamplerParameterIuiv = this->m_ptr_glGetSamplerParameterIuiv;this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&ValidationTableDecorator::m_glGetSamplerParameterIuiv_validation;}
+if(this->m_ptr_glTexCoordP3ui){this->m_orig_glTexCoordP3ui = this->m_ptr_glTexCoordP3ui;this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&ValidationTableDecorator::m_glTexCoordP3ui_validation;}
+if(this->m_ptr_glTextureSubImage1D){this->m_orig_glTextureSubImage1D = this->m_ptr_glTextureSubImage1D;this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&ValidationTableDecorator::m_glTextureSubImage1D_validation;}
+if(this->m_ptr_glVertexAttribLPointerEXT){this->m_orig_glVertexAttribLPointerEXT = this->m_ptr_glVertexAttribLPointerEXT;this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&ValidationTableDecorator::m_glVertexAttribLPointerEXT_validation;}
+if(this->m_ptr_glFogCoordPointerEXT){this->m_orig_glFogCoordPointerEXT = this->m_ptr_glFogCoordPointerEXT;this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&ValidationTableDecorator::m_glFogCoordPointerEXT_validation;}
+if(this->m_ptr_glWindowPos3s){this->m_orig_glWindowPos3s = this->m_ptr_glWindowPos3s;this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&ValidationTableDecorator::m_glWindowPos3s_validation;}
+if(this->m_ptr_glVertexAttribs2svNV){this->m_orig_glVertexAttribs2svNV = this->m_ptr_glVertexAttribs2svNV;this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&ValidationTableDecorator::m_glVertexAttribs2svNV_validation;}
+if(this->m_ptr_glTextureImage3DEXT){this->m_orig_glTextureImage3DEXT = this->m_ptr_glTextureImage3DEXT;this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&ValidationTableDecorator::m_glTextureImage3DEXT_validation;}
+if(this->m_ptr_glWindowPos3i){this->m_orig_glWindowPos3i = this->m_ptr_glWindowPos3i;this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&ValidationTableDecorator::m_glWindowPos3i_validation;}
+if(this->m_ptr_glWindowPos3d){this->m_orig_glWindowPos3d = this->m_ptr_glWindowPos3d;this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&ValidationTableDecorator::m_glWindowPos3d_validation;}
+if(this->m_ptr_glWindowPos3f){this->m_orig_glWindowPos3f = this->m_ptr_glWindowPos3f;this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&ValidationTableDecorator::m_glWindowPos3f_validation;}
+if(this->m_ptr_glIsEnabledIndexedEXT){this->m_orig_glIsEnabledIndexedEXT = this->m_ptr_glIsEnabledIndexedEXT;this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&ValidationTableDecorator::m_glIsEnabledIndexedEXT_validation;}
+if(this->m_ptr_glGetNamedProgramivEXT){this->m_orig_glGetNamedProgramivEXT = this->m_ptr_glGetNamedProgramivEXT;this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&ValidationTableDecorator::m_glGetNamedProgramivEXT_validation;}
+if(this->m_ptr_glVertex3xvOES){this->m_orig_glVertex3xvOES = this->m_ptr_glVertex3xvOES;this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&ValidationTableDecorator::m_glVertex3xvOES_validation;}
+if(this->m_ptr_glColor3us){this->m_orig_glColor3us = this->m_ptr_glColor3us;this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&ValidationTableDecorator::m_glColor3us_validation;}
+if(this->m_ptr_glBeginPerfMonitorAMD){this->m_orig_glBeginPerfMonitorAMD = this->m_ptr_glBeginPerfMonitorAMD;this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&ValidationTableDecorator::m_glBeginPerfMonitorAMD_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x3dv){this->m_orig_glProgramUniformMatrix4x3dv = this->m_ptr_glProgramUniformMatrix4x3dv;this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x3dv_validation;}
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT){this->m_orig_glGetNamedProgramLocalParameterIuivEXT = this->m_ptr_glGetNamedProgramLocalParameterIuivEXT;this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_validation;}
+if(this->m_ptr_glReadnPixels){this->m_orig_glReadnPixels = this->m_ptr_glReadnPixels;this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&ValidationTableDecorator::m_glReadnPixels_validation;}
+if(this->m_ptr_glMultiTexCoord4f){this->m_orig_glMultiTexCoord4f = this->m_ptr_glMultiTexCoord4f;this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&ValidationTableDecorator::m_glMultiTexCoord4f_validation;}
+if(this->m_ptr_glColor3ub){this->m_orig_glColor3ub = this->m_ptr_glColor3ub;this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&ValidationTableDecorator::m_glColor3ub_validation;}
+if(this->m_ptr_glMultiTexCoord4d){this->m_orig_glMultiTexCoord4d = this->m_ptr_glMultiTexCoord4d;this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&ValidationTableDecorator::m_glMultiTexCoord4d_validation;}
+if(this->m_ptr_glVertexAttribL3ui64NV){this->m_orig_glVertexAttribL3ui64NV = this->m_ptr_glVertexAttribL3ui64NV;this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&ValidationTableDecorator::m_glVertexAttribL3ui64NV_validation;}
+if(this->m_ptr_glColor3ui){this->m_orig_glColor3ui = this->m_ptr_glColor3ui;this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&ValidationTableDecorator::m_glColor3ui_validation;}
+if(this->m_ptr_glProgramUniform4fvEXT){this->m_orig_glProgramUniform4fvEXT = this->m_ptr_glProgramUniform4fvEXT;this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&ValidationTableDecorator::m_glProgramUniform4fvEXT_validation;}
+if(this->m_ptr_glVertexAttrib2sARB){this->m_orig_glVertexAttrib2sARB = this->m_ptr_glVertexAttrib2sARB;this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&ValidationTableDecorator::m_glVertexAttrib2sARB_validation;}
+if(this->m_ptr_glMultiTexCoord4i){this->m_orig_glMultiTexCoord4i = this->m_ptr_glMultiTexCoord4i;this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&ValidationTableDecorator::m_glMultiTexCoord4i_validation;}
+if(this->m_ptr_glCheckFramebufferStatusEXT){this->m_orig_glCheckFramebufferStatusEXT = this->m_ptr_glCheckFramebufferStatusEXT;this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&ValidationTableDecorator::m_glCheckFramebufferStatusEXT_validation;}
+if(this->m_ptr_glGetnMapivARB){this->m_orig_glGetnMapivARB = this->m_ptr_glGetnMapivARB;this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&ValidationTableDecorator::m_glGetnMapivARB_validation;}
+if(this->m_ptr_glMultiTexCoord1ivARB){this->m_orig_glMultiTexCoord1ivARB = this->m_ptr_glMultiTexCoord1ivARB;this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1ivARB_validation;}
+if(this->m_ptr_glDisableVertexAttribArrayARB){this->m_orig_glDisableVertexAttribArrayARB = this->m_ptr_glDisableVertexAttribArrayARB;this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&ValidationTableDecorator::m_glDisableVertexAttribArrayARB_validation;}
+if(this->m_ptr_glGetPolygonStipple){this->m_orig_glGetPolygonStipple = this->m_ptr_glGetPolygonStipple;this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&ValidationTableDecorator::m_glGetPolygonStipple_validation;}
+if(this->m_ptr_glVertexAttribI4ui){this->m_orig_glVertexAttribI4ui = this->m_ptr_glVertexAttribI4ui;this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&ValidationTableDecorator::m_glVertexAttribI4ui_validation;}
+if(this->m_ptr_glGetPathDashArrayNV){this->m_orig_glGetPathDashArrayNV = this->m_ptr_glGetPathDashArrayNV;this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&ValidationTableDecorator::m_glGetPathDashArrayNV_validation;}
+if(this->m_ptr_glMultiTexRenderbufferEXT){this->m_orig_glMultiTexRenderbufferEXT = this->m_ptr_glMultiTexRenderbufferEXT;this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&ValidationTableDecorator::m_glMultiTexRenderbufferEXT_validation;}
+if(this->m_ptr_glCopyTextureSubImage1D){this->m_orig_glCopyTextureSubImage1D = this->m_ptr_glCopyTextureSubImage1D;this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&ValidationTableDecorator::m_glCopyTextureSubImage1D_validation;}
+if(this->m_ptr_glDeleteOcclusionQueriesNV){this->m_orig_glDeleteOcclusionQueriesNV = this->m_ptr_glDeleteOcclusionQueriesNV;this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&ValidationTableDecorator::m_glDeleteOcclusionQueriesNV_validation;}
+if(this->m_ptr_glVertex4hvNV){this->m_orig_glVertex4hvNV = this->m_ptr_glVertex4hvNV;this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&ValidationTableDecorator::m_glVertex4hvNV_validation;}
+if(this->m_ptr_glGetnTexImage){this->m_orig_glGetnTexImage = this->m_ptr_glGetnTexImage;this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&ValidationTableDecorator::m_glGetnTexImage_validation;}
+if(this->m_ptr_glProgramLocalParameter4dARB){this->m_orig_glProgramLocalParameter4dARB = this->m_ptr_glProgramLocalParameter4dARB;this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&ValidationTableDecorator::m_glProgramLocalParameter4dARB_validation;}
+if(this->m_ptr_glBlendEquation){this->m_orig_glBlendEquation = this->m_ptr_glBlendEquation;this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&ValidationTableDecorator::m_glBlendEquation_validation;}
+if(this->m_ptr_glUnlockArraysEXT){this->m_orig_glUnlockArraysEXT = this->m_ptr_glUnlockArraysEXT;this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&ValidationTableDecorator::m_glUnlockArraysEXT_validation;}
+if(this->m_ptr_glGetQueryObjectui64vEXT){this->m_orig_glGetQueryObjectui64vEXT = this->m_ptr_glGetQueryObjectui64vEXT;this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&ValidationTableDecorator::m_glGetQueryObjectui64vEXT_validation;}
+if(this->m_ptr_glVertexAttribI4uivEXT){this->m_orig_glVertexAttribI4uivEXT = this->m_ptr_glVertexAttribI4uivEXT;this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4uivEXT_validation;}
+if(this->m_ptr_glUniform1i64vNV){this->m_orig_glUniform1i64vNV = this->m_ptr_glUniform1i64vNV;this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&ValidationTableDecorator::m_glUniform1i64vNV_validation;}
+if(this->m_ptr_glMultiTexCoord3dv){this->m_orig_glMultiTexCoord3dv = this->m_ptr_glMultiTexCoord3dv;this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&ValidationTableDecorator::m_glMultiTexCoord3dv_validation;}
+if(this->m_ptr_glColor4sv){this->m_orig_glColor4sv = this->m_ptr_glColor4sv;this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&ValidationTableDecorator::m_glColor4sv_validation;}
+if(this->m_ptr_glVertexStream4ivATI){this->m_orig_glVertexStream4ivATI = this->m_ptr_glVertexStream4ivATI;this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&ValidationTableDecorator::m_glVertexStream4ivATI_validation;}
+if(this->m_ptr_glPopClientAttrib){this->m_orig_glPopClientAttrib = this->m_ptr_glPopClientAttrib;this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&ValidationTableDecorator::m_glPopClientAttrib_validation;}
+if(this->m_ptr_glClearBufferData){this->m_orig_glClearBufferData = this->m_ptr_glClearBufferData;this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&ValidationTableDecorator::m_glClearBufferData_validation;}
+if(this->m_ptr_glGetProgramivNV){this->m_orig_glGetProgramivNV = this->m_ptr_glGetProgramivNV;this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&ValidationTableDecorator::m_glGetProgramivNV_validation;}
+if(this->m_ptr_glBeginTransformFeedback){this->m_orig_glBeginTransformFeedback = this->m_ptr_glBeginTransformFeedback;this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glBeginTransformFeedback_validation;}
+if(this->m_ptr_glFinishObjectAPPLE){this->m_orig_glFinishObjectAPPLE = this->m_ptr_glFinishObjectAPPLE;this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&ValidationTableDecorator::m_glFinishObjectAPPLE_validation;}
+if(this->m_ptr_glGetMinmaxParameterivEXT){this->m_orig_glGetMinmaxParameterivEXT = this->m_ptr_glGetMinmaxParameterivEXT;this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetMinmaxParameterivEXT_validation;}
+if(this->m_ptr_glColor3iv){this->m_orig_glColor3iv = this->m_ptr_glColor3iv;this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&ValidationTableDecorator::m_glColor3iv_validation;}
+if(this->m_ptr_glVertexAttrib3sv){this->m_orig_glVertexAttrib3sv = this->m_ptr_glVertexAttrib3sv;this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&ValidationTableDecorator::m_glVertexAttrib3sv_validation;}
+if(this->m_ptr_glCompressedTexImage1D){this->m_orig_glCompressedTexImage1D = this->m_ptr_glCompressedTexImage1D;this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&ValidationTableDecorator::m_glCompressedTexImage1D_validation;}
+if(this->m_ptr_glDeleteTransformFeedbacks){this->m_orig_glDeleteTransformFeedbacks = this->m_ptr_glDeleteTransformFeedbacks;this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&ValidationTableDecorator::m_glDeleteTransformFeedbacks_validation;}
+if(this->m_ptr_glGetVideoi64vNV){this->m_orig_glGetVideoi64vNV = this->m_ptr_glGetVideoi64vNV;this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&ValidationTableDecorator::m_glGetVideoi64vNV_validation;}
+if(this->m_ptr_glDrawRangeElementsBaseVertex){this->m_orig_glDrawRangeElementsBaseVertex = this->m_ptr_glDrawRangeElementsBaseVertex;this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&ValidationTableDecorator::m_glDrawRangeElementsBaseVertex_validation;}
+if(this->m_ptr_glUniform4i64vARB){this->m_orig_glUniform4i64vARB = this->m_ptr_glUniform4i64vARB;this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&ValidationTableDecorator::m_glUniform4i64vARB_validation;}
+if(this->m_ptr_glTextureStorage3DMultisampleEXT){this->m_orig_glTextureStorage3DMultisampleEXT = this->m_ptr_glTextureStorage3DMultisampleEXT;this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glTextureStorage3DMultisampleEXT_validation;}
+if(this->m_ptr_glGetTexParameterfv){this->m_orig_glGetTexParameterfv = this->m_ptr_glGetTexParameterfv;this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&ValidationTableDecorator::m_glGetTexParameterfv_validation;}
+if(this->m_ptr_glProgramUniformui64vNV){this->m_orig_glProgramUniformui64vNV = this->m_ptr_glProgramUniformui64vNV;this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&ValidationTableDecorator::m_glProgramUniformui64vNV_validation;}
+if(this->m_ptr_glCompressedMultiTexImage1DEXT){this->m_orig_glCompressedMultiTexImage1DEXT = this->m_ptr_glCompressedMultiTexImage1DEXT;this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCompressedMultiTexImage1DEXT_validation;}
+if(this->m_ptr_glProgramUniform2ivEXT){this->m_orig_glProgramUniform2ivEXT = this->m_ptr_glProgramUniform2ivEXT;this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&ValidationTableDecorator::m_glProgramUniform2ivEXT_validation;}
+if(this->m_ptr_glPushGroupMarkerEXT){this->m_orig_glPushGroupMarkerEXT = this->m_ptr_glPushGroupMarkerEXT;this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&ValidationTableDecorator::m_glPushGroupMarkerEXT_validation;}
+if(this->m_ptr_glVertexAttrib1dv){this->m_orig_glVertexAttrib1dv = this->m_ptr_glVertexAttrib1dv;this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&ValidationTableDecorator::m_glVertexAttrib1dv_validation;}
+if(this->m_ptr_glMatrixLoadIdentityEXT){this->m_orig_glMatrixLoadIdentityEXT = this->m_ptr_glMatrixLoadIdentityEXT;this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&ValidationTableDecorator::m_glMatrixLoadIdentityEXT_validation;}
+if(this->m_ptr_glMultTransposeMatrixxOES){this->m_orig_glMultTransposeMatrixxOES = this->m_ptr_glMultTransposeMatrixxOES;this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&ValidationTableDecorator::m_glMultTransposeMatrixxOES_validation;}
+if(this->m_ptr_glGetPixelMapxv){this->m_orig_glGetPixelMapxv = this->m_ptr_glGetPixelMapxv;this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&ValidationTableDecorator::m_glGetPixelMapxv_validation;}
+if(this->m_ptr_glFramebufferSampleLocationsfvARB){this->m_orig_glFramebufferSampleLocationsfvARB = this->m_ptr_glFramebufferSampleLocationsfvARB;this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ValidationTableDecorator::m_glFramebufferSampleLocationsfvARB_validation;}
+if(this->m_ptr_glGetLightiv){this->m_orig_glGetLightiv = this->m_ptr_glGetLightiv;this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&ValidationTableDecorator::m_glGetLightiv_validation;}
+if(this->m_ptr_glBlendFuncSeparatei){this->m_orig_glBlendFuncSeparatei = this->m_ptr_glBlendFuncSeparatei;this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&ValidationTableDecorator::m_glBlendFuncSeparatei_validation;}
+if(this->m_ptr_glAcquireKeyedMutexWin32EXT){this->m_orig_glAcquireKeyedMutexWin32EXT = this->m_ptr_glAcquireKeyedMutexWin32EXT;this->m_ptr_glAcquireKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)&ValidationTableDecorator::m_glAcquireKeyedMutexWin32EXT_validation;}
+if(this->m_ptr_glGetBooleanIndexedvEXT){this->m_orig_glGetBooleanIndexedvEXT = this->m_ptr_glGetBooleanIndexedvEXT;this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&ValidationTableDecorator::m_glGetBooleanIndexedvEXT_validation;}
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV){this->m_orig_glGetProgramSubroutineParameteruivNV = this->m_ptr_glGetProgramSubroutineParameteruivNV;this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&ValidationTableDecorator::m_glGetProgramSubroutineParameteruivNV_validation;}
+if(this->m_ptr_glUniform2ui){this->m_orig_glUniform2ui = this->m_ptr_glUniform2ui;this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&ValidationTableDecorator::m_glUniform2ui_validation;}
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL){this->m_orig_glApplyFramebufferAttachmentCMAAINTEL = this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL;this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&ValidationTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_validation;}
+if(this->m_ptr_glWindowPos2fv){this->m_orig_glWindowPos2fv = this->m_ptr_glWindowPos2fv;this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&ValidationTableDecorator::m_glWindowPos2fv_validation;}
+if(this->m_ptr_glWaitVkSemaphoreNV){this->m_orig_glWaitVkSemaphoreNV = this->m_ptr_glWaitVkSemaphoreNV;this->m_ptr_glWaitVkSemaphoreNV = (FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC)&ValidationTableDecorator::m_glWaitVkSemaphoreNV_validation;}
+if(this->m_ptr_glDisablei){this->m_orig_glDisablei = this->m_ptr_glDisablei;this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&ValidationTableDecorator::m_glDisablei_validation;}
+if(this->m_ptr_glSelectPerfMonitorCountersAMD){this->m_orig_glSelectPerfMonitorCountersAMD = this->m_ptr_glSelectPerfMonitorCountersAMD;this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&ValidationTableDecorator::m_glSelectPerfMonitorCountersAMD_validation;}
+if(this->m_ptr_glGetVertexAttribLi64vNV){this->m_orig_glGetVertexAttribLi64vNV = this->m_ptr_glGetVertexAttribLi64vNV;this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&ValidationTableDecorator::m_glGetVertexAttribLi64vNV_validation;}
+if(this->m_ptr_glBlendFuncSeparateiARB){this->m_orig_glBlendFuncSeparateiARB = this->m_ptr_glBlendFuncSeparateiARB;this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&ValidationTableDecorator::m_glBlendFuncSeparateiARB_validation;}
+if(this->m_ptr_glWeightuivARB){this->m_orig_glWeightuivARB = this->m_ptr_glWeightuivARB;this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&ValidationTableDecorator::m_glWeightuivARB_validation;}
+if(this->m_ptr_glWindowPos2iARB){this->m_orig_glWindowPos2iARB = this->m_ptr_glWindowPos2iARB;this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&ValidationTableDecorator::m_glWindowPos2iARB_validation;}
+if(this->m_ptr_glGetProgramLocalParameterdvARB){this->m_orig_glGetProgramLocalParameterdvARB = this->m_ptr_glGetProgramLocalParameterdvARB;this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&ValidationTableDecorator::m_glGetProgramLocalParameterdvARB_validation;}
+if(this->m_ptr_glGetUniformui64vARB){this->m_orig_glGetUniformui64vARB = this->m_ptr_glGetUniformui64vARB;this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&ValidationTableDecorator::m_glGetUniformui64vARB_validation;}
+if(this->m_ptr_glSecondaryColor3us){this->m_orig_glSecondaryColor3us = this->m_ptr_glSecondaryColor3us;this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&ValidationTableDecorator::m_glSecondaryColor3us_validation;}
+if(this->m_ptr_glGetSynciv){this->m_orig_glGetSynciv = this->m_ptr_glGetSynciv;this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&ValidationTableDecorator::m_glGetSynciv_validation;}
+if(this->m_ptr_glMakeImageHandleResidentARB){this->m_orig_glMakeImageHandleResidentARB = this->m_ptr_glMakeImageHandleResidentARB;this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&ValidationTableDecorator::m_glMakeImageHandleResidentARB_validation;}
+if(this->m_ptr_glGetProgramNamedParameterfvNV){this->m_orig_glGetProgramNamedParameterfvNV = this->m_ptr_glGetProgramNamedParameterfvNV;this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetProgramNamedParameterfvNV_validation;}
+if(this->m_ptr_glTextureStorage3D){this->m_orig_glTextureStorage3D = this->m_ptr_glTextureStorage3D;this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&ValidationTableDecorator::m_glTextureStorage3D_validation;}
+if(this->m_ptr_glVertexAttrib4svNV){this->m_orig_glVertexAttrib4svNV = this->m_ptr_glVertexAttrib4svNV;this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&ValidationTableDecorator::m_glVertexAttrib4svNV_validation;}
+if(this->m_ptr_glProgramUniform2i){this->m_orig_glProgramUniform2i = this->m_ptr_glProgramUniform2i;this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&ValidationTableDecorator::m_glProgramUniform2i_validation;}
+if(this->m_ptr_glListDrawCommandsStatesClientNV){this->m_orig_glListDrawCommandsStatesClientNV = this->m_ptr_glListDrawCommandsStatesClientNV;this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&ValidationTableDecorator::m_glListDrawCommandsStatesClientNV_validation;}
+if(this->m_ptr_glProgramLocalParametersI4uivNV){this->m_orig_glProgramLocalParametersI4uivNV = this->m_ptr_glProgramLocalParametersI4uivNV;this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&ValidationTableDecorator::m_glProgramLocalParametersI4uivNV_validation;}
+if(this->m_ptr_glBeginTransformFeedbackNV){this->m_orig_glBeginTransformFeedbackNV = this->m_ptr_glBeginTransformFeedbackNV;this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glBeginTransformFeedbackNV_validation;}
+if(this->m_ptr_glGetProgramBinary){this->m_orig_glGetProgramBinary = this->m_ptr_glGetProgramBinary;this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&ValidationTableDecorator::m_glGetProgramBinary_validation;}
+if(this->m_ptr_glBinormal3iEXT){this->m_orig_glBinormal3iEXT = this->m_ptr_glBinormal3iEXT;this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&ValidationTableDecorator::m_glBinormal3iEXT_validation;}
+if(this->m_ptr_glEvalPoint1){this->m_orig_glEvalPoint1 = this->m_ptr_glEvalPoint1;this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&ValidationTableDecorator::m_glEvalPoint1_validation;}
+if(this->m_ptr_glEvalPoint2){this->m_orig_glEvalPoint2 = this->m_ptr_glEvalPoint2;this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&ValidationTableDecorator::m_glEvalPoint2_validation;}
+if(this->m_ptr_glPauseTransformFeedback){this->m_orig_glPauseTransformFeedback = this->m_ptr_glPauseTransformFeedback;this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glPauseTransformFeedback_validation;}
+if(this->m_ptr_glWindowPos2sMESA){this->m_orig_glWindowPos2sMESA = this->m_ptr_glWindowPos2sMESA;this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&ValidationTableDecorator::m_glWindowPos2sMESA_validation;}
+if(this->m_ptr_glGlobalAlphaFactorbSUN){this->m_orig_glGlobalAlphaFactorbSUN = this->m_ptr_glGlobalAlphaFactorbSUN;this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactorbSUN_validation;}
+if(this->m_ptr_glCreateTransformFeedbacks){this->m_orig_glCreateTransformFeedbacks = this->m_ptr_glCreateTransformFeedbacks;this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&ValidationTableDecorator::m_glCreateTransformFeedbacks_validation;}
+if(this->m_ptr_glTexturePageCommitmentEXT){this->m_orig_glTexturePageCommitmentEXT = this->m_ptr_glTexturePageCommitmentEXT;this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&ValidationTableDecorator::m_glTexturePageCommitmentEXT_validation;}
+if(this->m_ptr_glTransformFeedbackVaryingsNV){this->m_orig_glTransformFeedbackVaryingsNV = this->m_ptr_glTransformFeedbackVaryingsNV;this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&ValidationTableDecorator::m_glTransformFeedbackVaryingsNV_validation;}
+if(this->m_ptr_glTexSubImage1D){this->m_orig_glTexSubImage1D = this->m_ptr_glTexSubImage1D;this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&ValidationTableDecorator::m_glTexSubImage1D_validation;}
+if(this->m_ptr_glConvolutionParameterfvEXT){this->m_orig_glConvolutionParameterfvEXT = this->m_ptr_glConvolutionParameterfvEXT;this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glConvolutionParameterfvEXT_validation;}
+if(this->m_ptr_glBlitFramebufferEXT){this->m_orig_glBlitFramebufferEXT = this->m_ptr_glBlitFramebufferEXT;this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&ValidationTableDecorator::m_glBlitFramebufferEXT_validation;}
+if(this->m_ptr_glUniformMatrix4fvARB){this->m_orig_glUniformMatrix4fvARB = this->m_ptr_glUniformMatrix4fvARB;this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&ValidationTableDecorator::m_glUniformMatrix4fvARB_validation;}
+if(this->m_ptr_glProgramEnvParameter4dvARB){this->m_orig_glProgramEnvParameter4dvARB = this->m_ptr_glProgramEnvParameter4dvARB;this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&ValidationTableDecorator::m_glProgramEnvParameter4dvARB_validation;}
+if(this->m_ptr_glTextureStorageMem2DEXT){this->m_orig_glTextureStorageMem2DEXT = this->m_ptr_glTextureStorageMem2DEXT;this->m_ptr_glTextureStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC)&ValidationTableDecorator::m_glTextureStorageMem2DEXT_validation;}
+if(this->m_ptr_glVertexAttribP3uiv){this->m_orig_glVertexAttribP3uiv = this->m_ptr_glVertexAttribP3uiv;this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&ValidationTableDecorator::m_glVertexAttribP3uiv_validation;}
+if(this->m_ptr_glFogCoordFormatNV){this->m_orig_glFogCoordFormatNV = this->m_ptr_glFogCoordFormatNV;this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&ValidationTableDecorator::m_glFogCoordFormatNV_validation;}
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT){this->m_orig_glGetMultiTexLevelParameterivEXT = this->m_ptr_glGetMultiTexLevelParameterivEXT;this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetMultiTexLevelParameterivEXT_validation;}
+if(this->m_ptr_glIsOcclusionQueryNV){this->m_orig_glIsOcclusionQueryNV = this->m_ptr_glIsOcclusionQueryNV;this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&ValidationTableDecorator::m_glIsOcclusionQueryNV_validation;}
+if(this->m_ptr_glCompressedTexImage2DARB){this->m_orig_glCompressedTexImage2DARB = this->m_ptr_glCompressedTexImage2DARB;this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&ValidationTableDecorator::m_glCompressedTexImage2DARB_validation;}
+if(this->m_ptr_glGetProgramEnvParameterIuivNV){this->m_orig_glGetProgramEnvParameterIuivNV = this->m_ptr_glGetProgramEnvParameterIuivNV;this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&ValidationTableDecorator::m_glGetProgramEnvParameterIuivNV_validation;}
+if(this->m_ptr_glVertexAttrib4sv){this->m_orig_glVertexAttrib4sv = this->m_ptr_glVertexAttrib4sv;this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&ValidationTableDecorator::m_glVertexAttrib4sv_validation;}
+if(this->m_ptr_glVertexAttrib4fvARB){this->m_orig_glVertexAttrib4fvARB = this->m_ptr_glVertexAttrib4fvARB;this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4fvARB_validation;}
+if(this->m_ptr_glLoadName){this->m_orig_glLoadName = this->m_ptr_glLoadName;this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&ValidationTableDecorator::m_glLoadName_validation;}
+if(this->m_ptr_glBindVertexShaderEXT){this->m_orig_glBindVertexShaderEXT = this->m_ptr_glBindVertexShaderEXT;this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&ValidationTableDecorator::m_glBindVertexShaderEXT_validation;}
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT){this->m_orig_glGetNamedProgramLocalParameterIivEXT = this->m_ptr_glGetNamedProgramLocalParameterIivEXT;this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_validation;}
+if(this->m_ptr_glProgramUniform3uiEXT){this->m_orig_glProgramUniform3uiEXT = this->m_ptr_glProgramUniform3uiEXT;this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&ValidationTableDecorator::m_glProgramUniform3uiEXT_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT){this->m_orig_glProgramUniformMatrix4x2dvEXT = this->m_ptr_glProgramUniformMatrix4x2dvEXT;this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x2dvEXT_validation;}
+if(this->m_ptr_glTexCoord1hvNV){this->m_orig_glTexCoord1hvNV = this->m_ptr_glTexCoord1hvNV;this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&ValidationTableDecorator::m_glTexCoord1hvNV_validation;}
+if(this->m_ptr_glLoadMatrixd){this->m_orig_glLoadMatrixd = this->m_ptr_glLoadMatrixd;this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&ValidationTableDecorator::m_glLoadMatrixd_validation;}
+if(this->m_ptr_glTexParameterfv){this->m_orig_glTexParameterfv = this->m_ptr_glTexParameterfv;this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&ValidationTableDecorator::m_glTexParameterfv_validation;}
+if(this->m_ptr_glVariantdvEXT){this->m_orig_glVariantdvEXT = this->m_ptr_glVariantdvEXT;this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&ValidationTableDecorator::m_glVariantdvEXT_validation;}
+if(this->m_ptr_glCullParameterfvEXT){this->m_orig_glCullParameterfvEXT = this->m_ptr_glCullParameterfvEXT;this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glCullParameterfvEXT_validation;}
+if(this->m_ptr_glUniform3dv){this->m_orig_glUniform3dv = this->m_ptr_glUniform3dv;this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&ValidationTableDecorator::m_glUniform3dv_validation;}
+if(this->m_ptr_glProgramUniform3fv){this->m_orig_glProgramUniform3fv = this->m_ptr_glProgramUniform3fv;this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&ValidationTableDecorator::m_glProgramUniform3fv_validation;}
+if(this->m_ptr_glIsBufferARB){this->m_orig_glIsBufferARB = this->m_ptr_glIsBufferARB;this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&ValidationTableDecorator::m_glIsBufferARB_validation;}
+if(this->m_ptr_glMultiTexCoord1bOES){this->m_orig_glMultiTexCoord1bOES = this->m_ptr_glMultiTexCoord1bOES;this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&ValidationTableDecorator::m_glMultiTexCoord1bOES_validation;}
+if(this->m_ptr_glFogCoordhNV){this->m_orig_glFogCoordhNV = this->m_ptr_glFogCoordhNV;this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&ValidationTableDecorator::m_glFogCoordhNV_validation;}
+if(this->m_ptr_glFramebufferSampleLocationsfvNV){this->m_orig_glFramebufferSampleLocationsfvNV = this->m_ptr_glFramebufferSampleLocationsfvNV;this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ValidationTableDecorator::m_glFramebufferSampleLocationsfvNV_validation;}
+if(this->m_ptr_glGenSymbolsEXT){this->m_orig_glGenSymbolsEXT = this->m_ptr_glGenSymbolsEXT;this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&ValidationTableDecorator::m_glGenSymbolsEXT_validation;}
+if(this->m_ptr_glGetConvolutionFilter){this->m_orig_glGetConvolutionFilter = this->m_ptr_glGetConvolutionFilter;this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&ValidationTableDecorator::m_glGetConvolutionFilter_validation;}
+if(this->m_ptr_glProgramUniform1fvEXT){this->m_orig_glProgramUniform1fvEXT = this->m_ptr_glProgramUniform1fvEXT;this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&ValidationTableDecorator::m_glProgramUniform1fvEXT_validation;}
+if(this->m_ptr_glGetNextPerfQueryIdINTEL){this->m_orig_glGetNextPerfQueryIdINTEL = this->m_ptr_glGetNextPerfQueryIdINTEL;this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&ValidationTableDecorator::m_glGetNextPerfQueryIdINTEL_validation;}
+if(this->m_ptr_glCompressedTexImage1DARB){this->m_orig_glCompressedTexImage1DARB = this->m_ptr_glCompressedTexImage1DARB;this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&ValidationTableDecorator::m_glCompressedTexImage1DARB_validation;}
+if(this->m_ptr_glBindSamplers){this->m_orig_glBindSamplers = this->m_ptr_glBindSamplers;this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&ValidationTableDecorator::m_glBindSamplers_validation;}
+if(this->m_ptr_glGetProgramEnvParameterIivNV){this->m_orig_glGetProgramEnvParameterIivNV = this->m_ptr_glGetProgramEnvParameterIivNV;this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&ValidationTableDecorator::m_glGetProgramEnvParameterIivNV_validation;}
+if(this->m_ptr_glGetQueryObjectui64v){this->m_orig_glGetQueryObjectui64v = this->m_ptr_glGetQueryObjectui64v;this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&ValidationTableDecorator::m_glGetQueryObjectui64v_validation;}
+if(this->m_ptr_glVertexAttribL4ui64vNV){this->m_orig_glVertexAttribL4ui64vNV = this->m_ptr_glVertexAttribL4ui64vNV;this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&ValidationTableDecorator::m_glVertexAttribL4ui64vNV_validation;}
+if(this->m_ptr_glGetVideoivNV){this->m_orig_glGetVideoivNV = this->m_ptr_glGetVideoivNV;this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&ValidationTableDecorator::m_glGetVideoivNV_validation;}
+if(this->m_ptr_glGetTextureImage){this->m_orig_glGetTextureImage = this->m_ptr_glGetTextureImage;this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&ValidationTableDecorator::m_glGetTextureImage_validation;}
+if(this->m_ptr_glProgramUniform1fv){this->m_orig_glProgramUniform1fv = this->m_ptr_glProgramUniform1fv;this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&ValidationTableDecorator::m_glProgramUniform1fv_validation;}
+if(this->m_ptr_glUniformMatrix4fv){this->m_orig_glUniformMatrix4fv = this->m_ptr_glUniformMatrix4fv;this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&ValidationTableDecorator::m_glUniformMatrix4fv_validation;}
+if(this->m_ptr_glColorMask){this->m_orig_glColorMask = this->m_ptr_glColorMask;this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&ValidationTableDecorator::m_glColorMask_validation;}
+if(this->m_ptr_glBeginFragmentShaderATI){this->m_orig_glBeginFragmentShaderATI = this->m_ptr_glBeginFragmentShaderATI;this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&ValidationTableDecorator::m_glBeginFragmentShaderATI_validation;}
+if(this->m_ptr_glMultiDrawArraysEXT){this->m_orig_glMultiDrawArraysEXT = this->m_ptr_glMultiDrawArraysEXT;this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&ValidationTableDecorator::m_glMultiDrawArraysEXT_validation;}
+if(this->m_ptr_glGenNamesAMD){this->m_orig_glGenNamesAMD = this->m_ptr_glGenNamesAMD;this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&ValidationTableDecorator::m_glGenNamesAMD_validation;}
+if(this->m_ptr_glPathParameteriNV){this->m_orig_glPathParameteriNV = this->m_ptr_glPathParameteriNV;this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&ValidationTableDecorator::m_glPathParameteriNV_validation;}
+if(this->m_ptr_glCreateCommandListsNV){this->m_orig_glCreateCommandListsNV = this->m_ptr_glCreateCommandListsNV;this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&ValidationTableDecorator::m_glCreateCommandListsNV_validation;}
+if(this->m_ptr_glDeleteProgramPipelines){this->m_orig_glDeleteProgramPipelines = this->m_ptr_glDeleteProgramPipelines;this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&ValidationTableDecorator::m_glDeleteProgramPipelines_validation;}
+if(this->m_ptr_glCopyColorSubTableEXT){this->m_orig_glCopyColorSubTableEXT = this->m_ptr_glCopyColorSubTableEXT;this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&ValidationTableDecorator::m_glCopyColorSubTableEXT_validation;}
+if(this->m_ptr_glVariantsvEXT){this->m_orig_glVariantsvEXT = this->m_ptr_glVariantsvEXT;this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&ValidationTableDecorator::m_glVariantsvEXT_validation;}
+if(this->m_ptr_glGenProgramPipelines){this->m_orig_glGenProgramPipelines = this->m_ptr_glGenProgramPipelines;this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&ValidationTableDecorator::m_glGenProgramPipelines_validation;}
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT){this->m_orig_glVertexArrayEdgeFlagOffsetEXT = this->m_ptr_glVertexArrayEdgeFlagOffsetEXT;this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_validation;}
+if(this->m_ptr_glWindowPos2s){this->m_orig_glWindowPos2s = this->m_ptr_glWindowPos2s;this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&ValidationTableDecorator::m_glWindowPos2s_validation;}
+if(this->m_ptr_glSecondaryColor3iEXT){this->m_orig_glSecondaryColor3iEXT = this->m_ptr_glSecondaryColor3iEXT;this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3iEXT_validation;}
+if(this->m_ptr_glWindowPos2i){this->m_orig_glWindowPos2i = this->m_ptr_glWindowPos2i;this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&ValidationTableDecorator::m_glWindowPos2i_validation;}
+if(this->m_ptr_glWindowPos2f){this->m_orig_glWindowPos2f = this->m_ptr_glWindowPos2f;this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&ValidationTableDecorator::m_glWindowPos2f_validation;}
+if(this->m_ptr_glWindowPos2d){this->m_orig_glWindowPos2d = this->m_ptr_glWindowPos2d;this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&ValidationTableDecorator::m_glWindowPos2d_validation;}
+if(this->m_ptr_glUniform4uivEXT){this->m_orig_glUniform4uivEXT = this->m_ptr_glUniform4uivEXT;this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&ValidationTableDecorator::m_glUniform4uivEXT_validation;}
+if(this->m_ptr_glOrthoxOES){this->m_orig_glOrthoxOES = this->m_ptr_glOrthoxOES;this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&ValidationTableDecorator::m_glOrthoxOES_validation;}
+if(this->m_ptr_glUniformSubroutinesuiv){this->m_orig_glUniformSubroutinesuiv = this->m_ptr_glUniformSubroutinesuiv;this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&ValidationTableDecorator::m_glUniformSubroutinesuiv_validation;}
+if(this->m_ptr_glRectdv){this->m_orig_glRectdv = this->m_ptr_glRectdv;this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&ValidationTableDecorator::m_glRectdv_validation;}
+if(this->m_ptr_glProgramUniform1i64vNV){this->m_orig_glProgramUniform1i64vNV = this->m_ptr_glProgramUniform1i64vNV;this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&ValidationTableDecorator::m_glProgramUniform1i64vNV_validation;}
+if(this->m_ptr_glVertexAttribI4uiEXT){this->m_orig_glVertexAttribI4uiEXT = this->m_ptr_glVertexAttribI4uiEXT;this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4uiEXT_validation;}
+if(this->m_ptr_glSecondaryColor3ubEXT){this->m_orig_glSecondaryColor3ubEXT = this->m_ptr_glSecondaryColor3ubEXT;this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3ubEXT_validation;}
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT){this->m_orig_glCompressedMultiTexSubImage1DEXT = this->m_ptr_glCompressedMultiTexSubImage1DEXT;this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCompressedMultiTexSubImage1DEXT_validation;}
+if(this->m_ptr_glMultiTexGendEXT){this->m_orig_glMultiTexGendEXT = this->m_ptr_glMultiTexGendEXT;this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&ValidationTableDecorator::m_glMultiTexGendEXT_validation;}
+if(this->m_ptr_glColorP3uiv){this->m_orig_glColorP3uiv = this->m_ptr_glColorP3uiv;this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&ValidationTableDecorator::m_glColorP3uiv_validation;}
+if(this->m_ptr_glFogCoordfv){this->m_orig_glFogCoordfv = this->m_ptr_glFogCoordfv;this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&ValidationTableDecorator::m_glFogCoordfv_validation;}
+if(this->m_ptr_glCompileShader){this->m_orig_glCompileShader = this->m_ptr_glCompileShader;this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&ValidationTableDecorator::m_glCompileShader_validation;}
+if(this->m_ptr_glTexCoord2hNV){this->m_orig_glTexCoord2hNV = this->m_ptr_glTexCoord2hNV;this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&ValidationTableDecorator::m_glTexCoord2hNV_validation;}
+if(this->m_ptr_glUniform1uivEXT){this->m_orig_glUniform1uivEXT = this->m_ptr_glUniform1uivEXT;this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&ValidationTableDecorator::m_glUniform1uivEXT_validation;}
+if(this->m_ptr_glMatrixLoadTransposedEXT){this->m_orig_glMatrixLoadTransposedEXT = this->m_ptr_glMatrixLoadTransposedEXT;this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&ValidationTableDecorator::m_glMatrixLoadTransposedEXT_validation;}
+if(this->m_ptr_glIndexfv){this->m_orig_glIndexfv = this->m_ptr_glIndexfv;this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&ValidationTableDecorator::m_glIndexfv_validation;}
+if(this->m_ptr_glGetCompressedTextureImage){this->m_orig_glGetCompressedTextureImage = this->m_ptr_glGetCompressedTextureImage;this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&ValidationTableDecorator::m_glGetCompressedTextureImage_validation;}
+if(this->m_ptr_glGetUniformuivEXT){this->m_orig_glGetUniformuivEXT = this->m_ptr_glGetUniformuivEXT;this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&ValidationTableDecorator::m_glGetUniformuivEXT_validation;}
+if(this->m_ptr_glGetnPixelMapfvARB){this->m_orig_glGetnPixelMapfvARB = this->m_ptr_glGetnPixelMapfvARB;this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&ValidationTableDecorator::m_glGetnPixelMapfvARB_validation;}
+if(this->m_ptr_glFramebufferTextureEXT){this->m_orig_glFramebufferTextureEXT = this->m_ptr_glFramebufferTextureEXT;this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&ValidationTableDecorator::m_glFramebufferTextureEXT_validation;}
+if(this->m_ptr_glMultiDrawElementsIndirectCount){this->m_orig_glMultiDrawElementsIndirectCount = this->m_ptr_glMultiDrawElementsIndirectCount;this->m_ptr_glMultiDrawElementsIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)&ValidationTableDecorator::m_glMultiDrawElementsIndirectCount_validation;}
+if(this->m_ptr_glVertexAttribIPointer){this->m_orig_glVertexAttribIPointer = this->m_ptr_glVertexAttribIPointer;this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&ValidationTableDecorator::m_glVertexAttribIPointer_validation;}
+if(this->m_ptr_glMultiTexCoordP3ui){this->m_orig_glMultiTexCoordP3ui = this->m_ptr_glMultiTexCoordP3ui;this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&ValidationTableDecorator::m_glMultiTexCoordP3ui_validation;}
+if(this->m_ptr_glEvaluateDepthValuesARB){this->m_orig_glEvaluateDepthValuesARB = this->m_ptr_glEvaluateDepthValuesARB;this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&ValidationTableDecorator::m_glEvaluateDepthValuesARB_validation;}
+if(this->m_ptr_glGetNamedBufferParameteriv){this->m_orig_glGetNamedBufferParameteriv = this->m_ptr_glGetNamedBufferParameteriv;this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetNamedBufferParameteriv_validation;}
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT){this->m_orig_glGetNamedProgramLocalParameterfvEXT = this->m_ptr_glGetNamedProgramLocalParameterfvEXT;this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_validation;}
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN){this->m_orig_glColor4fNormal3fVertex3fvSUN = this->m_ptr_glColor4fNormal3fVertex3fvSUN;this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glColor4fNormal3fVertex3fvSUN_validation;}
+if(this->m_ptr_glSeparableFilter2DEXT){this->m_orig_glSeparableFilter2DEXT = this->m_ptr_glSeparableFilter2DEXT;this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&ValidationTableDecorator::m_glSeparableFilter2DEXT_validation;}
+if(this->m_ptr_glTexParameterxOES){this->m_orig_glTexParameterxOES = this->m_ptr_glTexParameterxOES;this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&ValidationTableDecorator::m_glTexParameterxOES_validation;}
+if(this->m_ptr_glClearAccumxOES){this->m_orig_glClearAccumxOES = this->m_ptr_glClearAccumxOES;this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&ValidationTableDecorator::m_glClearAccumxOES_validation;}
+if(this->m_ptr_glInvalidateFramebuffer){this->m_orig_glInvalidateFramebuffer = this->m_ptr_glInvalidateFramebuffer;this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&ValidationTableDecorator::m_glInvalidateFramebuffer_validation;}
+if(this->m_ptr_glWeightubvARB){this->m_orig_glWeightubvARB = this->m_ptr_glWeightubvARB;this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&ValidationTableDecorator::m_glWeightubvARB_validation;}
+if(this->m_ptr_glVertexAttrib1d){this->m_orig_glVertexAttrib1d = this->m_ptr_glVertexAttrib1d;this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&ValidationTableDecorator::m_glVertexAttrib1d_validation;}
+if(this->m_ptr_glVertexAttrib1f){this->m_orig_glVertexAttrib1f = this->m_ptr_glVertexAttrib1f;this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&ValidationTableDecorator::m_glVertexAttrib1f_validation;}
+if(this->m_ptr_glVertex4fv){this->m_orig_glVertex4fv = this->m_ptr_glVertex4fv;this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&ValidationTableDecorator::m_glVertex4fv_validation;}
+if(this->m_ptr_glClearNamedFramebufferfi){this->m_orig_glClearNamedFramebufferfi = this->m_ptr_glClearNamedFramebufferfi;this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&ValidationTableDecorator::m_glClearNamedFramebufferfi_validation;}
+if(this->m_ptr_glGetQueryBufferObjectuiv){this->m_orig_glGetQueryBufferObjectuiv = this->m_ptr_glGetQueryBufferObjectuiv;this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&ValidationTableDecorator::m_glGetQueryBufferObjectuiv_validation;}
+if(this->m_ptr_glClearNamedFramebufferfv){this->m_orig_glClearNamedFramebufferfv = this->m_ptr_glClearNamedFramebufferfv;this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&ValidationTableDecorator::m_glClearNamedFramebufferfv_validation;}
+if(this->m_ptr_glEndVertexShaderEXT){this->m_orig_glEndVertexShaderEXT = this->m_ptr_glEndVertexShaderEXT;this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&ValidationTableDecorator::m_glEndVertexShaderEXT_validation;}
+if(this->m_ptr_glVertexAttrib1s){this->m_orig_glVertexAttrib1s = this->m_ptr_glVertexAttrib1s;this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&ValidationTableDecorator::m_glVertexAttrib1s_validation;}
+if(this->m_ptr_glMultiTexCoord4dvARB){this->m_orig_glMultiTexCoord4dvARB = this->m_ptr_glMultiTexCoord4dvARB;this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4dvARB_validation;}
+if(this->m_ptr_glMultiTexCoord1sv){this->m_orig_glMultiTexCoord1sv = this->m_ptr_glMultiTexCoord1sv;this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&ValidationTableDecorator::m_glMultiTexCoord1sv_validation;}
+if(this->m_ptr_glUniform1ui64vNV){this->m_orig_glUniform1ui64vNV = this->m_ptr_glUniform1ui64vNV;this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&ValidationTableDecorator::m_glUniform1ui64vNV_validation;}
+if(this->m_ptr_glGetClipPlanefOES){this->m_orig_glGetClipPlanefOES = this->m_ptr_glGetClipPlanefOES;this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&ValidationTableDecorator::m_glGetClipPlanefOES_validation;}
+if(this->m_ptr_glRasterPos2s){this->m_orig_glRasterPos2s = this->m_ptr_glRasterPos2s;this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&ValidationTableDecorator::m_glRasterPos2s_validation;}
+if(this->m_ptr_glWeightivARB){this->m_orig_glWeightivARB = this->m_ptr_glWeightivARB;this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&ValidationTableDecorator::m_glWeightivARB_validation;}
+if(this->m_ptr_glMultiTexCoord4hvNV){this->m_orig_glMultiTexCoord4hvNV = this->m_ptr_glMultiTexCoord4hvNV;this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&ValidationTableDecorator::m_glMultiTexCoord4hvNV_validation;}
+if(this->m_ptr_glNormal3hNV){this->m_orig_glNormal3hNV = this->m_ptr_glNormal3hNV;this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&ValidationTableDecorator::m_glNormal3hNV_validation;}
+if(this->m_ptr_glGetSeparableFilter){this->m_orig_glGetSeparableFilter = this->m_ptr_glGetSeparableFilter;this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&ValidationTableDecorator::m_glGetSeparableFilter_validation;}
+if(this->m_ptr_glGetPathTexGenivNV){this->m_orig_glGetPathTexGenivNV = this->m_ptr_glGetPathTexGenivNV;this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&ValidationTableDecorator::m_glGetPathTexGenivNV_validation;}
+if(this->m_ptr_glColor4bv){this->m_orig_glColor4bv = this->m_ptr_glColor4bv;this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&ValidationTableDecorator::m_glColor4bv_validation;}
+if(this->m_ptr_glRasterPos2f){this->m_orig_glRasterPos2f = this->m_ptr_glRasterPos2f;this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&ValidationTableDecorator::m_glRasterPos2f_validation;}
+if(this->m_ptr_glNamedBufferPageCommitmentARB){this->m_orig_glNamedBufferPageCommitmentARB = this->m_ptr_glNamedBufferPageCommitmentARB;this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&ValidationTableDecorator::m_glNamedBufferPageCommitmentARB_validation;}
+if(this->m_ptr_glLoadIdentity){this->m_orig_glLoadIdentity = this->m_ptr_glLoadIdentity;this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&ValidationTableDecorator::m_glLoadIdentity_validation;}
+if(this->m_ptr_glRasterPos2i){this->m_orig_glRasterPos2i = this->m_ptr_glRasterPos2i;this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&ValidationTableDecorator::m_glRasterPos2i_validation;}
+if(this->m_ptr_glRasterPos4iv){this->m_orig_glRasterPos4iv = this->m_ptr_glRasterPos4iv;this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&ValidationTableDecorator::m_glRasterPos4iv_validation;}
+if(this->m_ptr_glMultiTexCoord2fvARB){this->m_orig_glMultiTexCoord2fvARB = this->m_ptr_glMultiTexCoord2fvARB;this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2fvARB_validation;}
+if(this->m_ptr_glUniformMatrix4x3fv){this->m_orig_glUniformMatrix4x3fv = this->m_ptr_glUniformMatrix4x3fv;this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&ValidationTableDecorator::m_glUniformMatrix4x3fv_validation;}
+if(this->m_ptr_glClearBufferfv){this->m_orig_glClearBufferfv = this->m_ptr_glClearBufferfv;this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&ValidationTableDecorator::m_glClearBufferfv_validation;}
+if(this->m_ptr_glMultiTexCoord4hNV){this->m_orig_glMultiTexCoord4hNV = this->m_ptr_glMultiTexCoord4hNV;this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&ValidationTableDecorator::m_glMultiTexCoord4hNV_validation;}
+if(this->m_ptr_glTextureBarrier){this->m_orig_glTextureBarrier = this->m_ptr_glTextureBarrier;this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&ValidationTableDecorator::m_glTextureBarrier_validation;}
+if(this->m_ptr_glReplacementCodeuivSUN){this->m_orig_glReplacementCodeuivSUN = this->m_ptr_glReplacementCodeuivSUN;this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuivSUN_validation;}
+if(this->m_ptr_glDeleteAsyncMarkersSGIX){this->m_orig_glDeleteAsyncMarkersSGIX = this->m_ptr_glDeleteAsyncMarkersSGIX;this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&ValidationTableDecorator::m_glDeleteAsyncMarkersSGIX_validation;}
+if(this->m_ptr_glTexCoord2bvOES){this->m_orig_glTexCoord2bvOES = this->m_ptr_glTexCoord2bvOES;this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&ValidationTableDecorator::m_glTexCoord2bvOES_validation;}
+if(this->m_ptr_glEvalCoord2xOES){this->m_orig_glEvalCoord2xOES = this->m_ptr_glEvalCoord2xOES;this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&ValidationTableDecorator::m_glEvalCoord2xOES_validation;}
+if(this->m_ptr_glGetSharpenTexFuncSGIS){this->m_orig_glGetSharpenTexFuncSGIS = this->m_ptr_glGetSharpenTexFuncSGIS;this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&ValidationTableDecorator::m_glGetSharpenTexFuncSGIS_validation;}
+if(this->m_ptr_glProgramUniformHandleui64vNV){this->m_orig_glProgramUniformHandleui64vNV = this->m_ptr_glProgramUniformHandleui64vNV;this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&ValidationTableDecorator::m_glProgramUniformHandleui64vNV_validation;}
+if(this->m_ptr_glIglooInterfaceSGIX){this->m_orig_glIglooInterfaceSGIX = this->m_ptr_glIglooInterfaceSGIX;this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&ValidationTableDecorator::m_glIglooInterfaceSGIX_validation;}
+if(this->m_ptr_glWindowPos2dvARB){this->m_orig_glWindowPos2dvARB = this->m_ptr_glWindowPos2dvARB;this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&ValidationTableDecorator::m_glWindowPos2dvARB_validation;}
+if(this->m_ptr_glClearBufferfi){this->m_orig_glClearBufferfi = this->m_ptr_glClearBufferfi;this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&ValidationTableDecorator::m_glClearBufferfi_validation;}
+if(this->m_ptr_glDrawArraysIndirect){this->m_orig_glDrawArraysIndirect = this->m_ptr_glDrawArraysIndirect;this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&ValidationTableDecorator::m_glDrawArraysIndirect_validation;}
+if(this->m_ptr_glGenVertexArrays){this->m_orig_glGenVertexArrays = this->m_ptr_glGenVertexArrays;this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&ValidationTableDecorator::m_glGenVertexArrays_validation;}
+if(this->m_ptr_glGetTransformFeedbacki64_v){this->m_orig_glGetTransformFeedbacki64_v = this->m_ptr_glGetTransformFeedbacki64_v;this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&ValidationTableDecorator::m_glGetTransformFeedbacki64_v_validation;}
+if(this->m_ptr_glEnableVertexArrayAttrib){this->m_orig_glEnableVertexArrayAttrib = this->m_ptr_glEnableVertexArrayAttrib;this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&ValidationTableDecorator::m_glEnableVertexArrayAttrib_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x2dv){this->m_orig_glProgramUniformMatrix3x2dv = this->m_ptr_glProgramUniformMatrix3x2dv;this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x2dv_validation;}
+if(this->m_ptr_glVertexStream4fATI){this->m_orig_glVertexStream4fATI = this->m_ptr_glVertexStream4fATI;this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&ValidationTableDecorator::m_glVertexStream4fATI_validation;}
+if(this->m_ptr_glVertexBindingDivisor){this->m_orig_glVertexBindingDivisor = this->m_ptr_glVertexBindingDivisor;this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&ValidationTableDecorator::m_glVertexBindingDivisor_validation;}
+if(this->m_ptr_glGetSamplerParameterIiv){this->m_orig_glGetSamplerParameterIiv = this->m_ptr_glGetSamplerParameterIiv;this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&ValidationTableDecorator::m_glGetSamplerParameterIiv_validation;}
+if(this->m_ptr_glGetCoverageModulationTableNV){this->m_orig_glGetCoverageModulationTableNV = this->m_ptr_glGetCoverageModulationTableNV;this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&ValidationTableDecorator::m_glGetCoverageModulationTableNV_validation;}
+if(this->m_ptr_glDepthRangedNV){this->m_orig_glDepthRangedNV = this->m_ptr_glDepthRangedNV;this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&ValidationTableDecorator::m_glDepthRangedNV_validation;}
+if(this->m_ptr_glVertexAttrib3f){this->m_orig_glVertexAttrib3f = this->m_ptr_glVertexAttrib3f;this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&ValidationTableDecorator::m_glVertexAttrib3f_validation;}
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE){this->m_orig_glMultiDrawRangeElementArrayAPPLE = this->m_ptr_glMultiDrawRangeElementArrayAPPLE;this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&ValidationTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_validation;}
+if(this->m_ptr_glVertexAttribFormatNV){this->m_orig_glVertexAttribFormatNV = this->m_ptr_glVertexAttribFormatNV;this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&ValidationTableDecorator::m_glVertexAttribFormatNV_validation;}
+if(this->m_ptr_glGetQueryBufferObjecti64v){this->m_orig_glGetQueryBufferObjecti64v = this->m_ptr_glGetQueryBufferObjecti64v;this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&ValidationTableDecorator::m_glGetQueryBufferObjecti64v_validation;}
+if(this->m_ptr_glGetVertexAttribdv){this->m_orig_glGetVertexAttribdv = this->m_ptr_glGetVertexAttribdv;this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&ValidationTableDecorator::m_glGetVertexAttribdv_validation;}
+if(this->m_ptr_glGetUniformi64vARB){this->m_orig_glGetUniformi64vARB = this->m_ptr_glGetUniformi64vARB;this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&ValidationTableDecorator::m_glGetUniformi64vARB_validation;}
+if(this->m_ptr_glAreTexturesResidentEXT){this->m_orig_glAreTexturesResidentEXT = this->m_ptr_glAreTexturesResidentEXT;this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&ValidationTableDecorator::m_glAreTexturesResidentEXT_validation;}
+if(this->m_ptr_glGetHandleARB){this->m_orig_glGetHandleARB = this->m_ptr_glGetHandleARB;this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&ValidationTableDecorator::m_glGetHandleARB_validation;}
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV){this->m_orig_glVideoCaptureStreamParameterdvNV = this->m_ptr_glVideoCaptureStreamParameterdvNV;this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&ValidationTableDecorator::m_glVideoCaptureStreamParameterdvNV_validation;}
+if(this->m_ptr_glMapParameterivNV){this->m_orig_glMapParameterivNV = this->m_ptr_glMapParameterivNV;this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&ValidationTableDecorator::m_glMapParameterivNV_validation;}
+if(this->m_ptr_glIsVertexArray){this->m_orig_glIsVertexArray = this->m_ptr_glIsVertexArray;this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&ValidationTableDecorator::m_glIsVertexArray_validation;}
+if(this->m_ptr_glSecondaryColor3sEXT){this->m_orig_glSecondaryColor3sEXT = this->m_ptr_glSecondaryColor3sEXT;this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3sEXT_validation;}
+if(this->m_ptr_glGetTexParameterIivEXT){this->m_orig_glGetTexParameterIivEXT = this->m_ptr_glGetTexParameterIivEXT;this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glGetTexParameterIivEXT_validation;}
+if(this->m_ptr_glFrameTerminatorGREMEDY){this->m_orig_glFrameTerminatorGREMEDY = this->m_ptr_glFrameTerminatorGREMEDY;this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&ValidationTableDecorator::m_glFrameTerminatorGREMEDY_validation;}
+if(this->m_ptr_glBlendBarrierKHR){this->m_orig_glBlendBarrierKHR = this->m_ptr_glBlendBarrierKHR;this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&ValidationTableDecorator::m_glBlendBarrierKHR_validation;}
+if(this->m_ptr_glVertexAttrib4NubARB){this->m_orig_glVertexAttrib4NubARB = this->m_ptr_glVertexAttrib4NubARB;this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NubARB_validation;}
+if(this->m_ptr_glPrimitiveRestartNV){this->m_orig_glPrimitiveRestartNV = this->m_ptr_glPrimitiveRestartNV;this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&ValidationTableDecorator::m_glPrimitiveRestartNV_validation;}
+if(this->m_ptr_glVertexAttribL1ui64vARB){this->m_orig_glVertexAttribL1ui64vARB = this->m_ptr_glVertexAttribL1ui64vARB;this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&ValidationTableDecorator::m_glVertexAttribL1ui64vARB_validation;}
+if(this->m_ptr_glVertexAttribI4ivEXT){this->m_orig_glVertexAttribI4ivEXT = this->m_ptr_glVertexAttribI4ivEXT;this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4ivEXT_validation;}
+if(this->m_ptr_glVertexAttribs4svNV){this->m_orig_glVertexAttribs4svNV = this->m_ptr_glVertexAttribs4svNV;this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&ValidationTableDecorator::m_glVertexAttribs4svNV_validation;}
+if(this->m_ptr_glUniform1ui){this->m_orig_glUniform1ui = this->m_ptr_glUniform1ui;this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&ValidationTableDecorator::m_glUniform1ui_validation;}
+if(this->m_ptr_glVertexAttrib2fvARB){this->m_orig_glVertexAttrib2fvARB = this->m_ptr_glVertexAttrib2fvARB;this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&ValidationTableDecorator::m_glVertexAttrib2fvARB_validation;}
+if(this->m_ptr_glVertexAttribI4svEXT){this->m_orig_glVertexAttribI4svEXT = this->m_ptr_glVertexAttribI4svEXT;this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4svEXT_validation;}
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV){this->m_orig_glTextureImage3DMultisampleCoverageNV = this->m_ptr_glTextureImage3DMultisampleCoverageNV;this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&ValidationTableDecorator::m_glTextureImage3DMultisampleCoverageNV_validation;}
+if(this->m_ptr_glMemoryBarrier){this->m_orig_glMemoryBarrier = this->m_ptr_glMemoryBarrier;this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&ValidationTableDecorator::m_glMemoryBarrier_validation;}
+if(this->m_ptr_glGetVariantArrayObjectfvATI){this->m_orig_glGetVariantArrayObjectfvATI = this->m_ptr_glGetVariantArrayObjectfvATI;this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&ValidationTableDecorator::m_glGetVariantArrayObjectfvATI_validation;}
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN){this->m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN;this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&ValidationTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_validation;}
+if(this->m_ptr_glIsProgramARB){this->m_orig_glIsProgramARB = this->m_ptr_glIsProgramARB;this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&ValidationTableDecorator::m_glIsProgramARB_validation;}
+if(this->m_ptr_glBindImageTextureEXT){this->m_orig_glBindImageTextureEXT = this->m_ptr_glBindImageTextureEXT;this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&ValidationTableDecorator::m_glBindImageTextureEXT_validation;}
+if(this->m_ptr_glGetFragDataLocation){this->m_orig_glGetFragDataLocation = this->m_ptr_glGetFragDataLocation;this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&ValidationTableDecorator::m_glGetFragDataLocation_validation;}
+if(this->m_ptr_glMultiTexCoord1svARB){this->m_orig_glMultiTexCoord1svARB = this->m_ptr_glMultiTexCoord1svARB;this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1svARB_validation;}
+if(this->m_ptr_glGetMapxvOES){this->m_orig_glGetMapxvOES = this->m_ptr_glGetMapxvOES;this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&ValidationTableDecorator::m_glGetMapxvOES_validation;}
+if(this->m_ptr_glTextureStorage2DMultisampleEXT){this->m_orig_glTextureStorage2DMultisampleEXT = this->m_ptr_glTextureStorage2DMultisampleEXT;this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glTextureStorage2DMultisampleEXT_validation;}
+if(this->m_ptr_glGetMaterialfv){this->m_orig_glGetMaterialfv = this->m_ptr_glGetMaterialfv;this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&ValidationTableDecorator::m_glGetMaterialfv_validation;}
+if(this->m_ptr_glVertexAttrib4NbvARB){this->m_orig_glVertexAttrib4NbvARB = this->m_ptr_glVertexAttrib4NbvARB;this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4NbvARB_validation;}
+if(this->m_ptr_glPixelMapuiv){this->m_orig_glPixelMapuiv = this->m_ptr_glPixelMapuiv;this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&ValidationTableDecorator::m_glPixelMapuiv_validation;}
+if(this->m_ptr_glColorPointerEXT){this->m_orig_glColorPointerEXT = this->m_ptr_glColorPointerEXT;this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&ValidationTableDecorator::m_glColorPointerEXT_validation;}
+if(this->m_ptr_glEnableClientStateiEXT){this->m_orig_glEnableClientStateiEXT = this->m_ptr_glEnableClientStateiEXT;this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&ValidationTableDecorator::m_glEnableClientStateiEXT_validation;}
+if(this->m_ptr_glClearTexSubImage){this->m_orig_glClearTexSubImage = this->m_ptr_glClearTexSubImage;this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&ValidationTableDecorator::m_glClearTexSubImage_validation;}
+if(this->m_ptr_glEvalCoord1xvOES){this->m_orig_glEvalCoord1xvOES = this->m_ptr_glEvalCoord1xvOES;this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&ValidationTableDecorator::m_glEvalCoord1xvOES_validation;}
+if(this->m_ptr_glDetachObjectARB){this->m_orig_glDetachObjectARB = this->m_ptr_glDetachObjectARB;this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&ValidationTableDecorator::m_glDetachObjectARB_validation;}
+if(this->m_ptr_glGetTextureParameterIiv){this->m_orig_glGetTextureParameterIiv = this->m_ptr_glGetTextureParameterIiv;this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&ValidationTableDecorator::m_glGetTextureParameterIiv_validation;}
+if(this->m_ptr_glVariantusvEXT){this->m_orig_glVariantusvEXT = this->m_ptr_glVariantusvEXT;this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&ValidationTableDecorator::m_glVariantusvEXT_validation;}
+if(this->m_ptr_glCompressedTextureImage3DEXT){this->m_orig_glCompressedTextureImage3DEXT = this->m_ptr_glCompressedTextureImage3DEXT;this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&ValidationTableDecorator::m_glCompressedTextureImage3DEXT_validation;}
+if(this->m_ptr_glMultiTexCoord1dARB){this->m_orig_glMultiTexCoord1dARB = this->m_ptr_glMultiTexCoord1dARB;this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&ValidationTableDecorator::m_glMultiTexCoord1dARB_validation;}
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT){this->m_orig_glGetVertexArrayIntegeri_vEXT = this->m_ptr_glGetVertexArrayIntegeri_vEXT;this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&ValidationTableDecorator::m_glGetVertexArrayIntegeri_vEXT_validation;}
+if(this->m_ptr_glVertexAttribI4ubv){this->m_orig_glVertexAttribI4ubv = this->m_ptr_glVertexAttribI4ubv;this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&ValidationTableDecorator::m_glVertexAttribI4ubv_validation;}
+if(this->m_ptr_glPixelTexGenParameterfSGIS){this->m_orig_glPixelTexGenParameterfSGIS = this->m_ptr_glPixelTexGenParameterfSGIS;this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&ValidationTableDecorator::m_glPixelTexGenParameterfSGIS_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x2dv){this->m_orig_glProgramUniformMatrix4x2dv = this->m_ptr_glProgramUniformMatrix4x2dv;this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x2dv_validation;}
+if(this->m_ptr_glUniform3fARB){this->m_orig_glUniform3fARB = this->m_ptr_glUniform3fARB;this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&ValidationTableDecorator::m_glUniform3fARB_validation;}
+if(this->m_ptr_glIsShader){this->m_orig_glIsShader = this->m_ptr_glIsShader;this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&ValidationTableDecorator::m_glIsShader_validation;}
+if(this->m_ptr_glConvolutionParameteriv){this->m_orig_glConvolutionParameteriv = this->m_ptr_glConvolutionParameteriv;this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&ValidationTableDecorator::m_glConvolutionParameteriv_validation;}
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT){this->m_orig_glCopyMultiTexSubImage2DEXT = this->m_ptr_glCopyMultiTexSubImage2DEXT;this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCopyMultiTexSubImage2DEXT_validation;}
+if(this->m_ptr_glEnableVertexAttribArrayARB){this->m_orig_glEnableVertexAttribArrayARB = this->m_ptr_glEnableVertexAttribArrayARB;this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&ValidationTableDecorator::m_glEnableVertexAttribArrayARB_validation;}
+if(this->m_ptr_glMulticastCopyBufferSubDataNV){this->m_orig_glMulticastCopyBufferSubDataNV = this->m_ptr_glMulticastCopyBufferSubDataNV;this->m_ptr_glMulticastCopyBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)&ValidationTableDecorator::m_glMulticastCopyBufferSubDataNV_validation;}
+if(this->m_ptr_glEnable){this->m_orig_glEnable = this->m_ptr_glEnable;this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&ValidationTableDecorator::m_glEnable_validation;}
+if(this->m_ptr_glGetActiveUniformsiv){this->m_orig_glGetActiveUniformsiv = this->m_ptr_glGetActiveUniformsiv;this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&ValidationTableDecorator::m_glGetActiveUniformsiv_validation;}
+if(this->m_ptr_glGetVertexAttribivARB){this->m_orig_glGetVertexAttribivARB = this->m_ptr_glGetVertexAttribivARB;this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&ValidationTableDecorator::m_glGetVertexAttribivARB_validation;}
+if(this->m_ptr_glTexCoord4hvNV){this->m_orig_glTexCoord4hvNV = this->m_ptr_glTexCoord4hvNV;this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&ValidationTableDecorator::m_glTexCoord4hvNV_validation;}
+if(this->m_ptr_glUseProgramObjectARB){this->m_orig_glUseProgramObjectARB = this->m_ptr_glUseProgramObjectARB;this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&ValidationTableDecorator::m_glUseProgramObjectARB_validation;}
+if(this->m_ptr_glGetAttribLocation){this->m_orig_glGetAttribLocation = this->m_ptr_glGetAttribLocation;this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&ValidationTableDecorator::m_glGetAttribLocation_validation;}
+if(this->m_ptr_glVertexAttrib4dv){this->m_orig_glVertexAttrib4dv = this->m_ptr_glVertexAttrib4dv;this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&ValidationTableDecorator::m_glVertexAttrib4dv_validation;}
+if(this->m_ptr_glGetTextureParameteriv){this->m_orig_glGetTextureParameteriv = this->m_ptr_glGetTextureParameteriv;this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&ValidationTableDecorator::m_glGetTextureParameteriv_validation;}
+if(this->m_ptr_glNamedBufferStorageMemEXT){this->m_orig_glNamedBufferStorageMemEXT = this->m_ptr_glNamedBufferStorageMemEXT;this->m_ptr_glNamedBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)&ValidationTableDecorator::m_glNamedBufferStorageMemEXT_validation;}
+if(this->m_ptr_glPathSubCoordsNV){this->m_orig_glPathSubCoordsNV = this->m_ptr_glPathSubCoordsNV;this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&ValidationTableDecorator::m_glPathSubCoordsNV_validation;}
+if(this->m_ptr_glMatrixIndexusvARB){this->m_orig_glMatrixIndexusvARB = this->m_ptr_glMatrixIndexusvARB;this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&ValidationTableDecorator::m_glMatrixIndexusvARB_validation;}
+if(this->m_ptr_glGetVideouivNV){this->m_orig_glGetVideouivNV = this->m_ptr_glGetVideouivNV;this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&ValidationTableDecorator::m_glGetVideouivNV_validation;}
+if(this->m_ptr_glGetVideoCaptureivNV){this->m_orig_glGetVideoCaptureivNV = this->m_ptr_glGetVideoCaptureivNV;this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&ValidationTableDecorator::m_glGetVideoCaptureivNV_validation;}
+if(this->m_ptr_glProgramUniform3ui){this->m_orig_glProgramUniform3ui = this->m_ptr_glProgramUniform3ui;this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&ValidationTableDecorator::m_glProgramUniform3ui_validation;}
+if(this->m_ptr_glVertexAttrib3svARB){this->m_orig_glVertexAttrib3svARB = this->m_ptr_glVertexAttrib3svARB;this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&ValidationTableDecorator::m_glVertexAttrib3svARB_validation;}
+if(this->m_ptr_glGetNamedBufferParameterivEXT){this->m_orig_glGetNamedBufferParameterivEXT = this->m_ptr_glGetNamedBufferParameterivEXT;this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetNamedBufferParameterivEXT_validation;}
+if(this->m_ptr_glMatrixScaledEXT){this->m_orig_glMatrixScaledEXT = this->m_ptr_glMatrixScaledEXT;this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&ValidationTableDecorator::m_glMatrixScaledEXT_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x3fv){this->m_orig_glProgramUniformMatrix2x3fv = this->m_ptr_glProgramUniformMatrix2x3fv;this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x3fv_validation;}
+if(this->m_ptr_glGetFragmentLightivSGIX){this->m_orig_glGetFragmentLightivSGIX = this->m_ptr_glGetFragmentLightivSGIX;this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&ValidationTableDecorator::m_glGetFragmentLightivSGIX_validation;}
+if(this->m_ptr_glGetStringi){this->m_orig_glGetStringi = this->m_ptr_glGetStringi;this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&ValidationTableDecorator::m_glGetStringi_validation;}
+if(this->m_ptr_glWindowPos2svARB){this->m_orig_glWindowPos2svARB = this->m_ptr_glWindowPos2svARB;this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&ValidationTableDecorator::m_glWindowPos2svARB_validation;}
+if(this->m_ptr_glVertexAttrib2svNV){this->m_orig_glVertexAttrib2svNV = this->m_ptr_glVertexAttrib2svNV;this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&ValidationTableDecorator::m_glVertexAttrib2svNV_validation;}
+if(this->m_ptr_glWindowPos2ivARB){this->m_orig_glWindowPos2ivARB = this->m_ptr_glWindowPos2ivARB;this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&ValidationTableDecorator::m_glWindowPos2ivARB_validation;}
+if(this->m_ptr_glGetVertexAttribPointervNV){this->m_orig_glGetVertexAttribPointervNV = this->m_ptr_glGetVertexAttribPointervNV;this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&ValidationTableDecorator::m_glGetVertexAttribPointervNV_validation;}
+if(this->m_ptr_glPushMatrix){this->m_orig_glPushMatrix = this->m_ptr_glPushMatrix;this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&ValidationTableDecorator::m_glPushMatrix_validation;}
+if(this->m_ptr_glEdgeFlagPointerListIBM){this->m_orig_glEdgeFlagPointerListIBM = this->m_ptr_glEdgeFlagPointerListIBM;this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glEdgeFlagPointerListIBM_validation;}
+if(this->m_ptr_glGenerateMipmapEXT){this->m_orig_glGenerateMipmapEXT = this->m_ptr_glGenerateMipmapEXT;this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&ValidationTableDecorator::m_glGenerateMipmapEXT_validation;}
+if(this->m_ptr_glWindowPos3sv){this->m_orig_glWindowPos3sv = this->m_ptr_glWindowPos3sv;this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&ValidationTableDecorator::m_glWindowPos3sv_validation;}
+if(this->m_ptr_glPathCoordsNV){this->m_orig_glPathCoordsNV = this->m_ptr_glPathCoordsNV;this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&ValidationTableDecorator::m_glPathCoordsNV_validation;}
+if(this->m_ptr_glProgramUniform1i){this->m_orig_glProgramUniform1i = this->m_ptr_glProgramUniform1i;this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&ValidationTableDecorator::m_glProgramUniform1i_validation;}
+if(this->m_ptr_glProgramUniform1d){this->m_orig_glProgramUniform1d = this->m_ptr_glProgramUniform1d;this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&ValidationTableDecorator::m_glProgramUniform1d_validation;}
+if(this->m_ptr_glProgramUniform1f){this->m_orig_glProgramUniform1f = this->m_ptr_glProgramUniform1f;this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&ValidationTableDecorator::m_glProgramUniform1f_validation;}
+if(this->m_ptr_glProgramParameteriEXT){this->m_orig_glProgramParameteriEXT = this->m_ptr_glProgramParameteriEXT;this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&ValidationTableDecorator::m_glProgramParameteriEXT_validation;}
+if(this->m_ptr_glCompressedMultiTexImage2DEXT){this->m_orig_glCompressedMultiTexImage2DEXT = this->m_ptr_glCompressedMultiTexImage2DEXT;this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCompressedMultiTexImage2DEXT_validation;}
+if(this->m_ptr_glProgramUniform3iv){this->m_orig_glProgramUniform3iv = this->m_ptr_glProgramUniform3iv;this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&ValidationTableDecorator::m_glProgramUniform3iv_validation;}
+if(this->m_ptr_glIndexiv){this->m_orig_glIndexiv = this->m_ptr_glIndexiv;this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&ValidationTableDecorator::m_glIndexiv_validation;}
+if(this->m_ptr_glMultiTexCoord4xvOES){this->m_orig_glMultiTexCoord4xvOES = this->m_ptr_glMultiTexCoord4xvOES;this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord4xvOES_validation;}
+if(this->m_ptr_glEGLImageTargetTexture2DOES){this->m_orig_glEGLImageTargetTexture2DOES = this->m_ptr_glEGLImageTargetTexture2DOES;this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&ValidationTableDecorator::m_glEGLImageTargetTexture2DOES_validation;}
+if(this->m_ptr_glPixelZoom){this->m_orig_glPixelZoom = this->m_ptr_glPixelZoom;this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&ValidationTableDecorator::m_glPixelZoom_validation;}
+if(this->m_ptr_glVertex3bvOES){this->m_orig_glVertex3bvOES = this->m_ptr_glVertex3bvOES;this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&ValidationTableDecorator::m_glVertex3bvOES_validation;}
+if(this->m_ptr_glFramebufferReadBufferEXT){this->m_orig_glFramebufferReadBufferEXT = this->m_ptr_glFramebufferReadBufferEXT;this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&ValidationTableDecorator::m_glFramebufferReadBufferEXT_validation;}
+if(this->m_ptr_glExtractComponentEXT){this->m_orig_glExtractComponentEXT = this->m_ptr_glExtractComponentEXT;this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&ValidationTableDecorator::m_glExtractComponentEXT_validation;}
+if(this->m_ptr_glCombinerParameterivNV){this->m_orig_glCombinerParameterivNV = this->m_ptr_glCombinerParameterivNV;this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&ValidationTableDecorator::m_glCombinerParameterivNV_validation;}
+if(this->m_ptr_glMinmax){this->m_orig_glMinmax = this->m_ptr_glMinmax;this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&ValidationTableDecorator::m_glMinmax_validation;}
+if(this->m_ptr_glColorP3ui){this->m_orig_glColorP3ui = this->m_ptr_glColorP3ui;this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&ValidationTableDecorator::m_glColorP3ui_validation;}
+if(this->m_ptr_glPointParameterfvSGIS){this->m_orig_glPointParameterfvSGIS = this->m_ptr_glPointParameterfvSGIS;this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&ValidationTableDecorator::m_glPointParameterfvSGIS_validation;}
+if(this->m_ptr_glBlendEquationi){this->m_orig_glBlendEquationi = this->m_ptr_glBlendEquationi;this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&ValidationTableDecorator::m_glBlendEquationi_validation;}
+if(this->m_ptr_glGetFogFuncSGIS){this->m_orig_glGetFogFuncSGIS = this->m_ptr_glGetFogFuncSGIS;this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&ValidationTableDecorator::m_glGetFogFuncSGIS_validation;}
+if(this->m_ptr_glVertexAttrib4fvNV){this->m_orig_glVertexAttrib4fvNV = this->m_ptr_glVertexAttrib4fvNV;this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&ValidationTableDecorator::m_glVertexAttrib4fvNV_validation;}
+if(this->m_ptr_glGetnMinmax){this->m_orig_glGetnMinmax = this->m_ptr_glGetnMinmax;this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&ValidationTableDecorator::m_glGetnMinmax_validation;}
+if(this->m_ptr_glFragmentLightiSGIX){this->m_orig_glFragmentLightiSGIX = this->m_ptr_glFragmentLightiSGIX;this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&ValidationTableDecorator::m_glFragmentLightiSGIX_validation;}
+if(this->m_ptr_glMultiTexCoord1bvOES){this->m_orig_glMultiTexCoord1bvOES = this->m_ptr_glMultiTexCoord1bvOES;this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord1bvOES_validation;}
+if(this->m_ptr_glSecondaryColorPointerEXT){this->m_orig_glSecondaryColorPointerEXT = this->m_ptr_glSecondaryColorPointerEXT;this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&ValidationTableDecorator::m_glSecondaryColorPointerEXT_validation;}
+if(this->m_ptr_glMultiTexCoordP4uiv){this->m_orig_glMultiTexCoordP4uiv = this->m_ptr_glMultiTexCoordP4uiv;this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&ValidationTableDecorator::m_glMultiTexCoordP4uiv_validation;}
+if(this->m_ptr_glGetBufferSubDataARB){this->m_orig_glGetBufferSubDataARB = this->m_ptr_glGetBufferSubDataARB;this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&ValidationTableDecorator::m_glGetBufferSubDataARB_validation;}
+if(this->m_ptr_glSecondaryColor3hNV){this->m_orig_glSecondaryColor3hNV = this->m_ptr_glSecondaryColor3hNV;this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&ValidationTableDecorator::m_glSecondaryColor3hNV_validation;}
+if(this->m_ptr_glGetPathParameterivNV){this->m_orig_glGetPathParameterivNV = this->m_ptr_glGetPathParameterivNV;this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&ValidationTableDecorator::m_glGetPathParameterivNV_validation;}
+if(this->m_ptr_glFlushRasterSGIX){this->m_orig_glFlushRasterSGIX = this->m_ptr_glFlushRasterSGIX;this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&ValidationTableDecorator::m_glFlushRasterSGIX_validation;}
+if(this->m_ptr_glElementPointerATI){this->m_orig_glElementPointerATI = this->m_ptr_glElementPointerATI;this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&ValidationTableDecorator::m_glElementPointerATI_validation;}
+if(this->m_ptr_glGetAttachedObjectsARB){this->m_orig_glGetAttachedObjectsARB = this->m_ptr_glGetAttachedObjectsARB;this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&ValidationTableDecorator::m_glGetAttachedObjectsARB_validation;}
+if(this->m_ptr_glUniform4iv){this->m_orig_glUniform4iv = this->m_ptr_glUniform4iv;this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&ValidationTableDecorator::m_glUniform4iv_validation;}
+if(this->m_ptr_glFogxOES){this->m_orig_glFogxOES = this->m_ptr_glFogxOES;this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&ValidationTableDecorator::m_glFogxOES_validation;}
+if(this->m_ptr_glSharpenTexFuncSGIS){this->m_orig_glSharpenTexFuncSGIS = this->m_ptr_glSharpenTexFuncSGIS;this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&ValidationTableDecorator::m_glSharpenTexFuncSGIS_validation;}
+if(this->m_ptr_glClearDepthfOES){this->m_orig_glClearDepthfOES = this->m_ptr_glClearDepthfOES;this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&ValidationTableDecorator::m_glClearDepthfOES_validation;}
+if(this->m_ptr_glDeleteCommandListsNV){this->m_orig_glDeleteCommandListsNV = this->m_ptr_glDeleteCommandListsNV;this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&ValidationTableDecorator::m_glDeleteCommandListsNV_validation;}
+if(this->m_ptr_glSpecializeShader){this->m_orig_glSpecializeShader = this->m_ptr_glSpecializeShader;this->m_ptr_glSpecializeShader = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC)&ValidationTableDecorator::m_glSpecializeShader_validation;}
+if(this->m_ptr_glVertex4hNV){this->m_orig_glVertex4hNV = this->m_ptr_glVertex4hNV;this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&ValidationTableDecorator::m_glVertex4hNV_validation;}
+if(this->m_ptr_glSecondaryColor3dvEXT){this->m_orig_glSecondaryColor3dvEXT = this->m_ptr_glSecondaryColor3dvEXT;this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3dvEXT_validation;}
+if(this->m_ptr_glGenTextures){this->m_orig_glGenTextures = this->m_ptr_glGenTextures;this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&ValidationTableDecorator::m_glGenTextures_validation;}
+if(this->m_ptr_glTextureStorage2DMultisample){this->m_orig_glTextureStorage2DMultisample = this->m_ptr_glTextureStorage2DMultisample;this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&ValidationTableDecorator::m_glTextureStorage2DMultisample_validation;}
+if(this->m_ptr_glUniform3ui64vNV){this->m_orig_glUniform3ui64vNV = this->m_ptr_glUniform3ui64vNV;this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&ValidationTableDecorator::m_glUniform3ui64vNV_validation;}
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD){this->m_orig_glBlendFuncSeparateIndexedAMD = this->m_ptr_glBlendFuncSeparateIndexedAMD;this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&ValidationTableDecorator::m_glBlendFuncSeparateIndexedAMD_validation;}
+if(this->m_ptr_glMakeBufferResidentNV){this->m_orig_glMakeBufferResidentNV = this->m_ptr_glMakeBufferResidentNV;this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&ValidationTableDecorator::m_glMakeBufferResidentNV_validation;}
+if(this->m_ptr_glShaderOp2EXT){this->m_orig_glShaderOp2EXT = this->m_ptr_glShaderOp2EXT;this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&ValidationTableDecorator::m_glShaderOp2EXT_validation;}
+if(this->m_ptr_glGetVertexAttribivNV){this->m_orig_glGetVertexAttribivNV = this->m_ptr_glGetVertexAttribivNV;this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&ValidationTableDecorator::m_glGetVertexAttribivNV_validation;}
+if(this->m_ptr_glTexParameterIivEXT){this->m_orig_glTexParameterIivEXT = this->m_ptr_glTexParameterIivEXT;this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glTexParameterIivEXT_validation;}
+if(this->m_ptr_glGetPerfQueryDataINTEL){this->m_orig_glGetPerfQueryDataINTEL = this->m_ptr_glGetPerfQueryDataINTEL;this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&ValidationTableDecorator::m_glGetPerfQueryDataINTEL_validation;}
+if(this->m_ptr_glVertexAttrib4dvARB){this->m_orig_glVertexAttrib4dvARB = this->m_ptr_glVertexAttrib4dvARB;this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4dvARB_validation;}
+if(this->m_ptr_glTextureSubImage1DEXT){this->m_orig_glTextureSubImage1DEXT = this->m_ptr_glTextureSubImage1DEXT;this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glTextureSubImage1DEXT_validation;}
+if(this->m_ptr_glGetActiveUniformBlockName){this->m_orig_glGetActiveUniformBlockName = this->m_ptr_glGetActiveUniformBlockName;this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&ValidationTableDecorator::m_glGetActiveUniformBlockName_validation;}
+if(this->m_ptr_glVertexAttrib2dvARB){this->m_orig_glVertexAttrib2dvARB = this->m_ptr_glVertexAttrib2dvARB;this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&ValidationTableDecorator::m_glVertexAttrib2dvARB_validation;}
+if(this->m_ptr_glVertexAttribPointer){this->m_orig_glVertexAttribPointer = this->m_ptr_glVertexAttribPointer;this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&ValidationTableDecorator::m_glVertexAttribPointer_validation;}
+if(this->m_ptr_glDepthBoundsdNV){this->m_orig_glDepthBoundsdNV = this->m_ptr_glDepthBoundsdNV;this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&ValidationTableDecorator::m_glDepthBoundsdNV_validation;}
+if(this->m_ptr_glDeleteTexturesEXT){this->m_orig_glDeleteTexturesEXT = this->m_ptr_glDeleteTexturesEXT;this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&ValidationTableDecorator::m_glDeleteTexturesEXT_validation;}
+if(this->m_ptr_glDrawBuffersATI){this->m_orig_glDrawBuffersATI = this->m_ptr_glDrawBuffersATI;this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&ValidationTableDecorator::m_glDrawBuffersATI_validation;}
+if(this->m_ptr_glLightModelxvOES){this->m_orig_glLightModelxvOES = this->m_ptr_glLightModelxvOES;this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&ValidationTableDecorator::m_glLightModelxvOES_validation;}
+if(this->m_ptr_glApplyTextureEXT){this->m_orig_glApplyTextureEXT = this->m_ptr_glApplyTextureEXT;this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&ValidationTableDecorator::m_glApplyTextureEXT_validation;}
+if(this->m_ptr_glGetImageHandleNV){this->m_orig_glGetImageHandleNV = this->m_ptr_glGetImageHandleNV;this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&ValidationTableDecorator::m_glGetImageHandleNV_validation;}
+if(this->m_ptr_glGetMinmax){this->m_orig_glGetMinmax = this->m_ptr_glGetMinmax;this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&ValidationTableDecorator::m_glGetMinmax_validation;}
+if(this->m_ptr_glGetFixedvOES){this->m_orig_glGetFixedvOES = this->m_ptr_glGetFixedvOES;this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&ValidationTableDecorator::m_glGetFixedvOES_validation;}
+if(this->m_ptr_glSamplePatternEXT){this->m_orig_glSamplePatternEXT = this->m_ptr_glSamplePatternEXT;this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&ValidationTableDecorator::m_glSamplePatternEXT_validation;}
+if(this->m_ptr_glUniform1f){this->m_orig_glUniform1f = this->m_ptr_glUniform1f;this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&ValidationTableDecorator::m_glUniform1f_validation;}
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN){this->m_orig_glColor4fNormal3fVertex3fSUN = this->m_ptr_glColor4fNormal3fVertex3fSUN;this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glColor4fNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glFogCoorddvEXT){this->m_orig_glFogCoorddvEXT = this->m_ptr_glFogCoorddvEXT;this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&ValidationTableDecorator::m_glFogCoorddvEXT_validation;}
+if(this->m_ptr_glCopyTextureImage1DEXT){this->m_orig_glCopyTextureImage1DEXT = this->m_ptr_glCopyTextureImage1DEXT;this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCopyTextureImage1DEXT_validation;}
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE){this->m_orig_glFlushMappedBufferRangeAPPLE = this->m_ptr_glFlushMappedBufferRangeAPPLE;this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&ValidationTableDecorator::m_glFlushMappedBufferRangeAPPLE_validation;}
+if(this->m_ptr_glVertex3sv){this->m_orig_glVertex3sv = this->m_ptr_glVertex3sv;this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&ValidationTableDecorator::m_glVertex3sv_validation;}
+if(this->m_ptr_glFlushStaticDataIBM){this->m_orig_glFlushStaticDataIBM = this->m_ptr_glFlushStaticDataIBM;this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&ValidationTableDecorator::m_glFlushStaticDataIBM_validation;}
+if(this->m_ptr_glProgramUniform4ui64NV){this->m_orig_glProgramUniform4ui64NV = this->m_ptr_glProgramUniform4ui64NV;this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&ValidationTableDecorator::m_glProgramUniform4ui64NV_validation;}
+if(this->m_ptr_glRasterPos4xOES){this->m_orig_glRasterPos4xOES = this->m_ptr_glRasterPos4xOES;this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&ValidationTableDecorator::m_glRasterPos4xOES_validation;}
+if(this->m_ptr_glVertexAttribP1ui){this->m_orig_glVertexAttribP1ui = this->m_ptr_glVertexAttribP1ui;this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&ValidationTableDecorator::m_glVertexAttribP1ui_validation;}
+if(this->m_ptr_glProgramUniform4dvEXT){this->m_orig_glProgramUniform4dvEXT = this->m_ptr_glProgramUniform4dvEXT;this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&ValidationTableDecorator::m_glProgramUniform4dvEXT_validation;}
+if(this->m_ptr_glEndTransformFeedbackEXT){this->m_orig_glEndTransformFeedbackEXT = this->m_ptr_glEndTransformFeedbackEXT;this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&ValidationTableDecorator::m_glEndTransformFeedbackEXT_validation;}
+if(this->m_ptr_glBinormal3dEXT){this->m_orig_glBinormal3dEXT = this->m_ptr_glBinormal3dEXT;this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&ValidationTableDecorator::m_glBinormal3dEXT_validation;}
+if(this->m_ptr_glGetTextureSubImage){this->m_orig_glGetTextureSubImage = this->m_ptr_glGetTextureSubImage;this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&ValidationTableDecorator::m_glGetTextureSubImage_validation;}
+if(this->m_ptr_glGetNamedRenderbufferParameteriv){this->m_orig_glGetNamedRenderbufferParameteriv = this->m_ptr_glGetNamedRenderbufferParameteriv;this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetNamedRenderbufferParameteriv_validation;}
+if(this->m_ptr_glBindBuffersRange){this->m_orig_glBindBuffersRange = this->m_ptr_glBindBuffersRange;this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&ValidationTableDecorator::m_glBindBuffersRange_validation;}
+if(this->m_ptr_glFinishAsyncSGIX){this->m_orig_glFinishAsyncSGIX = this->m_ptr_glFinishAsyncSGIX;this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&ValidationTableDecorator::m_glFinishAsyncSGIX_validation;}
+if(this->m_ptr_glBindFragDataLocationIndexed){this->m_orig_glBindFragDataLocationIndexed = this->m_ptr_glBindFragDataLocationIndexed;this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&ValidationTableDecorator::m_glBindFragDataLocationIndexed_validation;}
+if(this->m_ptr_glMultiTexCoord2dv){this->m_orig_glMultiTexCoord2dv = this->m_ptr_glMultiTexCoord2dv;this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&ValidationTableDecorator::m_glMultiTexCoord2dv_validation;}
+if(this->m_ptr_glUniform2iv){this->m_orig_glUniform2iv = this->m_ptr_glUniform2iv;this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&ValidationTableDecorator::m_glUniform2iv_validation;}
+if(this->m_ptr_glProgramUniform2i64vNV){this->m_orig_glProgramUniform2i64vNV = this->m_ptr_glProgramUniform2i64vNV;this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&ValidationTableDecorator::m_glProgramUniform2i64vNV_validation;}
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE){this->m_orig_glFlushVertexArrayRangeAPPLE = this->m_ptr_glFlushVertexArrayRangeAPPLE;this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&ValidationTableDecorator::m_glFlushVertexArrayRangeAPPLE_validation;}
+if(this->m_ptr_glTextureParameterf){this->m_orig_glTextureParameterf = this->m_ptr_glTextureParameterf;this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&ValidationTableDecorator::m_glTextureParameterf_validation;}
+if(this->m_ptr_glMultiTexCoord3dvARB){this->m_orig_glMultiTexCoord3dvARB = this->m_ptr_glMultiTexCoord3dvARB;this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord3dvARB_validation;}
+if(this->m_ptr_glFeedbackBuffer){this->m_orig_glFeedbackBuffer = this->m_ptr_glFeedbackBuffer;this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&ValidationTableDecorator::m_glFeedbackBuffer_validation;}
+if(this->m_ptr_glDebugMessageInsertARB){this->m_orig_glDebugMessageInsertARB = this->m_ptr_glDebugMessageInsertARB;this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&ValidationTableDecorator::m_glDebugMessageInsertARB_validation;}
+if(this->m_ptr_glMultiTexCoord2i){this->m_orig_glMultiTexCoord2i = this->m_ptr_glMultiTexCoord2i;this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&ValidationTableDecorator::m_glMultiTexCoord2i_validation;}
+if(this->m_ptr_glTextureSubImage3D){this->m_orig_glTextureSubImage3D = this->m_ptr_glTextureSubImage3D;this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&ValidationTableDecorator::m_glTextureSubImage3D_validation;}
+if(this->m_ptr_glFramebufferTexture1D){this->m_orig_glFramebufferTexture1D = this->m_ptr_glFramebufferTexture1D;this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&ValidationTableDecorator::m_glFramebufferTexture1D_validation;}
+if(this->m_ptr_glGetShaderiv){this->m_orig_glGetShaderiv = this->m_ptr_glGetShaderiv;this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&ValidationTableDecorator::m_glGetShaderiv_validation;}
+if(this->m_ptr_glMultiTexCoord2d){this->m_orig_glMultiTexCoord2d = this->m_ptr_glMultiTexCoord2d;this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&ValidationTableDecorator::m_glMultiTexCoord2d_validation;}
+if(this->m_ptr_glArrayObjectATI){this->m_orig_glArrayObjectATI = this->m_ptr_glArrayObjectATI;this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&ValidationTableDecorator::m_glArrayObjectATI_validation;}
+if(this->m_ptr_glGetPointeri_vEXT){this->m_orig_glGetPointeri_vEXT = this->m_ptr_glGetPointeri_vEXT;this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&ValidationTableDecorator::m_glGetPointeri_vEXT_validation;}
+if(this->m_ptr_glGetPerfMonitorCountersAMD){this->m_orig_glGetPerfMonitorCountersAMD = this->m_ptr_glGetPerfMonitorCountersAMD;this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&ValidationTableDecorator::m_glGetPerfMonitorCountersAMD_validation;}
+if(this->m_ptr_glNamedBufferStorage){this->m_orig_glNamedBufferStorage = this->m_ptr_glNamedBufferStorage;this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&ValidationTableDecorator::m_glNamedBufferStorage_validation;}
+if(this->m_ptr_glTexEnvxvOES){this->m_orig_glTexEnvxvOES = this->m_ptr_glTexEnvxvOES;this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&ValidationTableDecorator::m_glTexEnvxvOES_validation;}
+if(this->m_ptr_glProgramUniform2ui64NV){this->m_orig_glProgramUniform2ui64NV = this->m_ptr_glProgramUniform2ui64NV;this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&ValidationTableDecorator::m_glProgramUniform2ui64NV_validation;}
+if(this->m_ptr_glMultiTexCoord3bOES){this->m_orig_glMultiTexCoord3bOES = this->m_ptr_glMultiTexCoord3bOES;this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&ValidationTableDecorator::m_glMultiTexCoord3bOES_validation;}
+if(this->m_ptr_glUniform1dv){this->m_orig_glUniform1dv = this->m_ptr_glUniform1dv;this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&ValidationTableDecorator::m_glUniform1dv_validation;}
+if(this->m_ptr_glPixelTransferi){this->m_orig_glPixelTransferi = this->m_ptr_glPixelTransferi;this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&ValidationTableDecorator::m_glPixelTransferi_validation;}
+if(this->m_ptr_glSecondaryColor3usvEXT){this->m_orig_glSecondaryColor3usvEXT = this->m_ptr_glSecondaryColor3usvEXT;this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3usvEXT_validation;}
+if(this->m_ptr_glProgramEnvParameterI4uivNV){this->m_orig_glProgramEnvParameterI4uivNV = this->m_ptr_glProgramEnvParameterI4uivNV;this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&ValidationTableDecorator::m_glProgramEnvParameterI4uivNV_validation;}
+if(this->m_ptr_glVertex2sv){this->m_orig_glVertex2sv = this->m_ptr_glVertex2sv;this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&ValidationTableDecorator::m_glVertex2sv_validation;}
+if(this->m_ptr_glWindowPos4dMESA){this->m_orig_glWindowPos4dMESA = this->m_ptr_glWindowPos4dMESA;this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&ValidationTableDecorator::m_glWindowPos4dMESA_validation;}
+if(this->m_ptr_glDebugMessageControlARB){this->m_orig_glDebugMessageControlARB = this->m_ptr_glDebugMessageControlARB;this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&ValidationTableDecorator::m_glDebugMessageControlARB_validation;}
+if(this->m_ptr_glIsTextureEXT){this->m_orig_glIsTextureEXT = this->m_ptr_glIsTextureEXT;this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&ValidationTableDecorator::m_glIsTextureEXT_validation;}
+if(this->m_ptr_glFragmentMaterialivSGIX){this->m_orig_glFragmentMaterialivSGIX = this->m_ptr_glFragmentMaterialivSGIX;this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&ValidationTableDecorator::m_glFragmentMaterialivSGIX_validation;}
+if(this->m_ptr_glLinkProgramARB){this->m_orig_glLinkProgramARB = this->m_ptr_glLinkProgramARB;this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&ValidationTableDecorator::m_glLinkProgramARB_validation;}
+if(this->m_ptr_glFinishFenceAPPLE){this->m_orig_glFinishFenceAPPLE = this->m_ptr_glFinishFenceAPPLE;this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&ValidationTableDecorator::m_glFinishFenceAPPLE_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT){this->m_orig_glVertexArrayVertexAttribBindingEXT = this->m_ptr_glVertexArrayVertexAttribBindingEXT;this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribBindingEXT_validation;}
+if(this->m_ptr_glTexStorageMem3DMultisampleEXT){this->m_orig_glTexStorageMem3DMultisampleEXT = this->m_ptr_glTexStorageMem3DMultisampleEXT;this->m_ptr_glTexStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glTexStorageMem3DMultisampleEXT_validation;}
+if(this->m_ptr_glUniform1ui64vARB){this->m_orig_glUniform1ui64vARB = this->m_ptr_glUniform1ui64vARB;this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&ValidationTableDecorator::m_glUniform1ui64vARB_validation;}
+if(this->m_ptr_glMultiTexCoord4fv){this->m_orig_glMultiTexCoord4fv = this->m_ptr_glMultiTexCoord4fv;this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&ValidationTableDecorator::m_glMultiTexCoord4fv_validation;}
+if(this->m_ptr_glMulticastFramebufferSampleLocationsfvNV){this->m_orig_glMulticastFramebufferSampleLocationsfvNV = this->m_ptr_glMulticastFramebufferSampleLocationsfvNV;this->m_ptr_glMulticastFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ValidationTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_validation;}
+if(this->m_ptr_glRasterPos3d){this->m_orig_glRasterPos3d = this->m_ptr_glRasterPos3d;this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&ValidationTableDecorator::m_glRasterPos3d_validation;}
+if(this->m_ptr_glPollAsyncSGIX){this->m_orig_glPollAsyncSGIX = this->m_ptr_glPollAsyncSGIX;this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&ValidationTableDecorator::m_glPollAsyncSGIX_validation;}
+if(this->m_ptr_glRasterPos3f){this->m_orig_glRasterPos3f = this->m_ptr_glRasterPos3f;this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&ValidationTableDecorator::m_glRasterPos3f_validation;}
+if(this->m_ptr_glCompressedTexImage3D){this->m_orig_glCompressedTexImage3D = this->m_ptr_glCompressedTexImage3D;this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&ValidationTableDecorator::m_glCompressedTexImage3D_validation;}
+if(this->m_ptr_glVariantivEXT){this->m_orig_glVariantivEXT = this->m_ptr_glVariantivEXT;this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&ValidationTableDecorator::m_glVariantivEXT_validation;}
+if(this->m_ptr_glUnmapTexture2DINTEL){this->m_orig_glUnmapTexture2DINTEL = this->m_ptr_glUnmapTexture2DINTEL;this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&ValidationTableDecorator::m_glUnmapTexture2DINTEL_validation;}
+if(this->m_ptr_glMulticastWaitSyncNV){this->m_orig_glMulticastWaitSyncNV = this->m_ptr_glMulticastWaitSyncNV;this->m_ptr_glMulticastWaitSyncNV = (FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC)&ValidationTableDecorator::m_glMulticastWaitSyncNV_validation;}
+if(this->m_ptr_glGetVertexAttribiv){this->m_orig_glGetVertexAttribiv = this->m_ptr_glGetVertexAttribiv;this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&ValidationTableDecorator::m_glGetVertexAttribiv_validation;}
+if(this->m_ptr_glGetPathCoordsNV){this->m_orig_glGetPathCoordsNV = this->m_ptr_glGetPathCoordsNV;this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&ValidationTableDecorator::m_glGetPathCoordsNV_validation;}
+if(this->m_ptr_glColor4xvOES){this->m_orig_glColor4xvOES = this->m_ptr_glColor4xvOES;this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&ValidationTableDecorator::m_glColor4xvOES_validation;}
+if(this->m_ptr_glVertexAttrib3fv){this->m_orig_glVertexAttrib3fv = this->m_ptr_glVertexAttrib3fv;this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&ValidationTableDecorator::m_glVertexAttrib3fv_validation;}
+if(this->m_ptr_glRasterPos3s){this->m_orig_glRasterPos3s = this->m_ptr_glRasterPos3s;this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&ValidationTableDecorator::m_glRasterPos3s_validation;}
+if(this->m_ptr_glVertex4bOES){this->m_orig_glVertex4bOES = this->m_ptr_glVertex4bOES;this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&ValidationTableDecorator::m_glVertex4bOES_validation;}
+if(this->m_ptr_glTransformFeedbackVaryingsEXT){this->m_orig_glTransformFeedbackVaryingsEXT = this->m_ptr_glTransformFeedbackVaryingsEXT;this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&ValidationTableDecorator::m_glTransformFeedbackVaryingsEXT_validation;}
+if(this->m_ptr_glCombinerOutputNV){this->m_orig_glCombinerOutputNV = this->m_ptr_glCombinerOutputNV;this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&ValidationTableDecorator::m_glCombinerOutputNV_validation;}
+if(this->m_ptr_glWindowPos4sMESA){this->m_orig_glWindowPos4sMESA = this->m_ptr_glWindowPos4sMESA;this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&ValidationTableDecorator::m_glWindowPos4sMESA_validation;}
+if(this->m_ptr_glVertexAttrib4svARB){this->m_orig_glVertexAttrib4svARB = this->m_ptr_glVertexAttrib4svARB;this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4svARB_validation;}
+if(this->m_ptr_glIsList){this->m_orig_glIsList = this->m_ptr_glIsList;this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&ValidationTableDecorator::m_glIsList_validation;}
+if(this->m_ptr_glGetInfoLogARB){this->m_orig_glGetInfoLogARB = this->m_ptr_glGetInfoLogARB;this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&ValidationTableDecorator::m_glGetInfoLogARB_validation;}
+if(this->m_ptr_glUniformMatrix2fv){this->m_orig_glUniformMatrix2fv = this->m_ptr_glUniformMatrix2fv;this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&ValidationTableDecorator::m_glUniformMatrix2fv_validation;}
+if(this->m_ptr_glVertexAttribs3dvNV){this->m_orig_glVertexAttribs3dvNV = this->m_ptr_glVertexAttribs3dvNV;this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&ValidationTableDecorator::m_glVertexAttribs3dvNV_validation;}
+if(this->m_ptr_glGlobalAlphaFactorsSUN){this->m_orig_glGlobalAlphaFactorsSUN = this->m_ptr_glGlobalAlphaFactorsSUN;this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactorsSUN_validation;}
+if(this->m_ptr_glGetTrackMatrixivNV){this->m_orig_glGetTrackMatrixivNV = this->m_ptr_glGetTrackMatrixivNV;this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&ValidationTableDecorator::m_glGetTrackMatrixivNV_validation;}
+if(this->m_ptr_glTextureParameterfvEXT){this->m_orig_glTextureParameterfvEXT = this->m_ptr_glTextureParameterfvEXT;this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glTextureParameterfvEXT_validation;}
+if(this->m_ptr_glIsNamedBufferResidentNV){this->m_orig_glIsNamedBufferResidentNV = this->m_ptr_glIsNamedBufferResidentNV;this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&ValidationTableDecorator::m_glIsNamedBufferResidentNV_validation;}
+if(this->m_ptr_glProgramUniform4ui64vARB){this->m_orig_glProgramUniform4ui64vARB = this->m_ptr_glProgramUniform4ui64vARB;this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&ValidationTableDecorator::m_glProgramUniform4ui64vARB_validation;}
+if(this->m_ptr_glTbufferMask3DFX){this->m_orig_glTbufferMask3DFX = this->m_ptr_glTbufferMask3DFX;this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&ValidationTableDecorator::m_glTbufferMask3DFX_validation;}
+if(this->m_ptr_glCoverFillPathNV){this->m_orig_glCoverFillPathNV = this->m_ptr_glCoverFillPathNV;this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&ValidationTableDecorator::m_glCoverFillPathNV_validation;}
+if(this->m_ptr_glVertexAttrib1fvARB){this->m_orig_glVertexAttrib1fvARB = this->m_ptr_glVertexAttrib1fvARB;this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&ValidationTableDecorator::m_glVertexAttrib1fvARB_validation;}
+if(this->m_ptr_glGenerateTextureMipmap){this->m_orig_glGenerateTextureMipmap = this->m_ptr_glGenerateTextureMipmap;this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&ValidationTableDecorator::m_glGenerateTextureMipmap_validation;}
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT){this->m_orig_glNamedProgramLocalParameterI4uivEXT = this->m_ptr_glNamedProgramLocalParameterI4uivEXT;this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_validation;}
+if(this->m_ptr_glMultiDrawElementsBaseVertex){this->m_orig_glMultiDrawElementsBaseVertex = this->m_ptr_glMultiDrawElementsBaseVertex;this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&ValidationTableDecorator::m_glMultiDrawElementsBaseVertex_validation;}
+if(this->m_ptr_glProgramSubroutineParametersuivNV){this->m_orig_glProgramSubroutineParametersuivNV = this->m_ptr_glProgramSubroutineParametersuivNV;this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&ValidationTableDecorator::m_glProgramSubroutineParametersuivNV_validation;}
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT){this->m_orig_glProgramUniformMatrix2x4dvEXT = this->m_ptr_glProgramUniformMatrix2x4dvEXT;this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2x4dvEXT_validation;}
+if(this->m_ptr_glRotatexOES){this->m_orig_glRotatexOES = this->m_ptr_glRotatexOES;this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&ValidationTableDecorator::m_glRotatexOES_validation;}
+if(this->m_ptr_glMemoryBarrierEXT){this->m_orig_glMemoryBarrierEXT = this->m_ptr_glMemoryBarrierEXT;this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&ValidationTableDecorator::m_glMemoryBarrierEXT_validation;}
+if(this->m_ptr_glVertexAttrib3svNV){this->m_orig_glVertexAttrib3svNV = this->m_ptr_glVertexAttrib3svNV;this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&ValidationTableDecorator::m_glVertexAttrib3svNV_validation;}
+if(this->m_ptr_glVertexStream3iATI){this->m_orig_glVertexStream3iATI = this->m_ptr_glVertexStream3iATI;this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&ValidationTableDecorator::m_glVertexStream3iATI_validation;}
+if(this->m_ptr_glCompressedTexSubImage1D){this->m_orig_glCompressedTexSubImage1D = this->m_ptr_glCompressedTexSubImage1D;this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&ValidationTableDecorator::m_glCompressedTexSubImage1D_validation;}
+if(this->m_ptr_glSetFenceNV){this->m_orig_glSetFenceNV = this->m_ptr_glSetFenceNV;this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&ValidationTableDecorator::m_glSetFenceNV_validation;}
+if(this->m_ptr_glAttachObjectARB){this->m_orig_glAttachObjectARB = this->m_ptr_glAttachObjectARB;this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&ValidationTableDecorator::m_glAttachObjectARB_validation;}
+if(this->m_ptr_glCopyConvolutionFilter1D){this->m_orig_glCopyConvolutionFilter1D = this->m_ptr_glCopyConvolutionFilter1D;this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&ValidationTableDecorator::m_glCopyConvolutionFilter1D_validation;}
+if(this->m_ptr_glTexStorageMem2DMultisampleEXT){this->m_orig_glTexStorageMem2DMultisampleEXT = this->m_ptr_glTexStorageMem2DMultisampleEXT;this->m_ptr_glTexStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glTexStorageMem2DMultisampleEXT_validation;}
+if(this->m_ptr_glProgramParameters4fvNV){this->m_orig_glProgramParameters4fvNV = this->m_ptr_glProgramParameters4fvNV;this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&ValidationTableDecorator::m_glProgramParameters4fvNV_validation;}
+if(this->m_ptr_glNamedFramebufferParameteriEXT){this->m_orig_glNamedFramebufferParameteriEXT = this->m_ptr_glNamedFramebufferParameteriEXT;this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&ValidationTableDecorator::m_glNamedFramebufferParameteriEXT_validation;}
+if(this->m_ptr_glVertexAttrib4Nsv){this->m_orig_glVertexAttrib4Nsv = this->m_ptr_glVertexAttrib4Nsv;this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&ValidationTableDecorator::m_glVertexAttrib4Nsv_validation;}
+if(this->m_ptr_glVertexAttribI4usvEXT){this->m_orig_glVertexAttribI4usvEXT = this->m_ptr_glVertexAttribI4usvEXT;this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&ValidationTableDecorator::m_glVertexAttribI4usvEXT_validation;}
+if(this->m_ptr_glTextureBufferRangeEXT){this->m_orig_glTextureBufferRangeEXT = this->m_ptr_glTextureBufferRangeEXT;this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&ValidationTableDecorator::m_glTextureBufferRangeEXT_validation;}
+if(this->m_ptr_glVertexP3uiv){this->m_orig_glVertexP3uiv = this->m_ptr_glVertexP3uiv;this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&ValidationTableDecorator::m_glVertexP3uiv_validation;}
+if(this->m_ptr_glIsPathNV){this->m_orig_glIsPathNV = this->m_ptr_glIsPathNV;this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&ValidationTableDecorator::m_glIsPathNV_validation;}
+if(this->m_ptr_glGetnUniformi64vARB){this->m_orig_glGetnUniformi64vARB = this->m_ptr_glGetnUniformi64vARB;this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&ValidationTableDecorator::m_glGetnUniformi64vARB_validation;}
+if(this->m_ptr_glFramebufferTextureMultiviewOVR){this->m_orig_glFramebufferTextureMultiviewOVR = this->m_ptr_glFramebufferTextureMultiviewOVR;this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&ValidationTableDecorator::m_glFramebufferTextureMultiviewOVR_validation;}
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT){this->m_orig_glCompressedMultiTexSubImage2DEXT = this->m_ptr_glCompressedMultiTexSubImage2DEXT;this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCompressedMultiTexSubImage2DEXT_validation;}
+if(this->m_ptr_glGetnMapdv){this->m_orig_glGetnMapdv = this->m_ptr_glGetnMapdv;this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&ValidationTableDecorator::m_glGetnMapdv_validation;}
+if(this->m_ptr_glDebugMessageCallback){this->m_orig_glDebugMessageCallback = this->m_ptr_glDebugMessageCallback;this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&ValidationTableDecorator::m_glDebugMessageCallback_validation;}
+if(this->m_ptr_glTangent3svEXT){this->m_orig_glTangent3svEXT = this->m_ptr_glTangent3svEXT;this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&ValidationTableDecorator::m_glTangent3svEXT_validation;}
+if(this->m_ptr_glVertexAttribParameteriAMD){this->m_orig_glVertexAttribParameteriAMD = this->m_ptr_glVertexAttribParameteriAMD;this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&ValidationTableDecorator::m_glVertexAttribParameteriAMD_validation;}
+if(this->m_ptr_glBufferSubDataARB){this->m_orig_glBufferSubDataARB = this->m_ptr_glBufferSubDataARB;this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&ValidationTableDecorator::m_glBufferSubDataARB_validation;}
+if(this->m_ptr_glGetVertexAttribLui64vARB){this->m_orig_glGetVertexAttribLui64vARB = this->m_ptr_glGetVertexAttribLui64vARB;this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&ValidationTableDecorator::m_glGetVertexAttribLui64vARB_validation;}
+if(this->m_ptr_glVertexAttribL4ui64NV){this->m_orig_glVertexAttribL4ui64NV = this->m_ptr_glVertexAttribL4ui64NV;this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&ValidationTableDecorator::m_glVertexAttribL4ui64NV_validation;}
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN){this->m_orig_glReplacementCodeuiColor4ubVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN;this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_validation;}
+if(this->m_ptr_glImageTransformParameterfHP){this->m_orig_glImageTransformParameterfHP = this->m_ptr_glImageTransformParameterfHP;this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&ValidationTableDecorator::m_glImageTransformParameterfHP_validation;}
+if(this->m_ptr_glMap1f){this->m_orig_glMap1f = this->m_ptr_glMap1f;this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&ValidationTableDecorator::m_glMap1f_validation;}
+if(this->m_ptr_glRasterPos4fv){this->m_orig_glRasterPos4fv = this->m_ptr_glRasterPos4fv;this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&ValidationTableDecorator::m_glRasterPos4fv_validation;}
+if(this->m_ptr_glVertex2bvOES){this->m_orig_glVertex2bvOES = this->m_ptr_glVertex2bvOES;this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&ValidationTableDecorator::m_glVertex2bvOES_validation;}
+if(this->m_ptr_glGetMapControlPointsNV){this->m_orig_glGetMapControlPointsNV = this->m_ptr_glGetMapControlPointsNV;this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&ValidationTableDecorator::m_glGetMapControlPointsNV_validation;}
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT){this->m_orig_glNamedProgramLocalParametersI4ivEXT = this->m_ptr_glNamedProgramLocalParametersI4ivEXT;this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_validation;}
+if(this->m_ptr_glBindBufferRangeNV){this->m_orig_glBindBufferRangeNV = this->m_ptr_glBindBufferRangeNV;this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&ValidationTableDecorator::m_glBindBufferRangeNV_validation;}
+if(this->m_ptr_glVertexStream3dvATI){this->m_orig_glVertexStream3dvATI = this->m_ptr_glVertexStream3dvATI;this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&ValidationTableDecorator::m_glVertexStream3dvATI_validation;}
+if(this->m_ptr_glNormalPointerListIBM){this->m_orig_glNormalPointerListIBM = this->m_ptr_glNormalPointerListIBM;this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&ValidationTableDecorator::m_glNormalPointerListIBM_validation;}
+if(this->m_ptr_glFogFuncSGIS){this->m_orig_glFogFuncSGIS = this->m_ptr_glFogFuncSGIS;this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&ValidationTableDecorator::m_glFogFuncSGIS_validation;}
+if(this->m_ptr_glMultiModeDrawArraysIBM){this->m_orig_glMultiModeDrawArraysIBM = this->m_ptr_glMultiModeDrawArraysIBM;this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&ValidationTableDecorator::m_glMultiModeDrawArraysIBM_validation;}
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT){this->m_orig_glGetNamedFramebufferAttachmentParameterivEXT = this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT;this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_validation;}
+if(this->m_ptr_glGetFloatv){this->m_orig_glGetFloatv = this->m_ptr_glGetFloatv;this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&ValidationTableDecorator::m_glGetFloatv_validation;}
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT){this->m_orig_glVertexArrayVertexAttribIFormatEXT = this->m_ptr_glVertexArrayVertexAttribIFormatEXT;this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&ValidationTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_validation;}
+if(this->m_ptr_glHint){this->m_orig_glHint = this->m_ptr_glHint;this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&ValidationTableDecorator::m_glHint_validation;}
+if(this->m_ptr_glVertexStream2svATI){this->m_orig_glVertexStream2svATI = this->m_ptr_glVertexStream2svATI;this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&ValidationTableDecorator::m_glVertexStream2svATI_validation;}
+if(this->m_ptr_glMultiDrawArraysIndirect){this->m_orig_glMultiDrawArraysIndirect = this->m_ptr_glMultiDrawArraysIndirect;this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&ValidationTableDecorator::m_glMultiDrawArraysIndirect_validation;}
+if(this->m_ptr_glMultiTexEnvfvEXT){this->m_orig_glMultiTexEnvfvEXT = this->m_ptr_glMultiTexEnvfvEXT;this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&ValidationTableDecorator::m_glMultiTexEnvfvEXT_validation;}
+if(this->m_ptr_glVertexAttribP2uiv){this->m_orig_glVertexAttribP2uiv = this->m_ptr_glVertexAttribP2uiv;this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&ValidationTableDecorator::m_glVertexAttribP2uiv_validation;}
+if(this->m_ptr_glProgramUniform1i64vARB){this->m_orig_glProgramUniform1i64vARB = this->m_ptr_glProgramUniform1i64vARB;this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&ValidationTableDecorator::m_glProgramUniform1i64vARB_validation;}
+if(this->m_ptr_glFramebufferTextureARB){this->m_orig_glFramebufferTextureARB = this->m_ptr_glFramebufferTextureARB;this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&ValidationTableDecorator::m_glFramebufferTextureARB_validation;}
+if(this->m_ptr_glPushClientAttribDefaultEXT){this->m_orig_glPushClientAttribDefaultEXT = this->m_ptr_glPushClientAttribDefaultEXT;this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&ValidationTableDecorator::m_glPushClientAttribDefaultEXT_validation;}
+if(this->m_ptr_glScalef){this->m_orig_glScalef = this->m_ptr_glScalef;this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&ValidationTableDecorator::m_glScalef_validation;}
+if(this->m_ptr_glScaled){this->m_orig_glScaled = this->m_ptr_glScaled;this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&ValidationTableDecorator::m_glScaled_validation;}
+if(this->m_ptr_glGetConvolutionParameterxvOES){this->m_orig_glGetConvolutionParameterxvOES = this->m_ptr_glGetConvolutionParameterxvOES;this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&ValidationTableDecorator::m_glGetConvolutionParameterxvOES_validation;}
+if(this->m_ptr_glGetProgramResourceName){this->m_orig_glGetProgramResourceName = this->m_ptr_glGetProgramResourceName;this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&ValidationTableDecorator::m_glGetProgramResourceName_validation;}
+if(this->m_ptr_glCopyColorTable){this->m_orig_glCopyColorTable = this->m_ptr_glCopyColorTable;this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&ValidationTableDecorator::m_glCopyColorTable_validation;}
+if(this->m_ptr_glDepthRangeArrayv){this->m_orig_glDepthRangeArrayv = this->m_ptr_glDepthRangeArrayv;this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&ValidationTableDecorator::m_glDepthRangeArrayv_validation;}
+if(this->m_ptr_glCoverFillPathInstancedNV){this->m_orig_glCoverFillPathInstancedNV = this->m_ptr_glCoverFillPathInstancedNV;this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&ValidationTableDecorator::m_glCoverFillPathInstancedNV_validation;}
+if(this->m_ptr_glMultiTexParameterivEXT){this->m_orig_glMultiTexParameterivEXT = this->m_ptr_glMultiTexParameterivEXT;this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glMultiTexParameterivEXT_validation;}
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv){this->m_orig_glGetActiveAtomicCounterBufferiv = this->m_ptr_glGetActiveAtomicCounterBufferiv;this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&ValidationTableDecorator::m_glGetActiveAtomicCounterBufferiv_validation;}
+if(this->m_ptr_glStencilOpSeparate){this->m_orig_glStencilOpSeparate = this->m_ptr_glStencilOpSeparate;this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&ValidationTableDecorator::m_glStencilOpSeparate_validation;}
+if(this->m_ptr_glVertexAttrib4fNV){this->m_orig_glVertexAttrib4fNV = this->m_ptr_glVertexAttrib4fNV;this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&ValidationTableDecorator::m_glVertexAttrib4fNV_validation;}
+if(this->m_ptr_glGetColorTableParameterivSGI){this->m_orig_glGetColorTableParameterivSGI = this->m_ptr_glGetColorTableParameterivSGI;this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&ValidationTableDecorator::m_glGetColorTableParameterivSGI_validation;}
+if(this->m_ptr_glVertexArrayAttribBinding){this->m_orig_glVertexArrayAttribBinding = this->m_ptr_glVertexArrayAttribBinding;this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&ValidationTableDecorator::m_glVertexArrayAttribBinding_validation;}
+if(this->m_ptr_glIsSemaphoreEXT){this->m_orig_glIsSemaphoreEXT = this->m_ptr_glIsSemaphoreEXT;this->m_ptr_glIsSemaphoreEXT = (FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC)&ValidationTableDecorator::m_glIsSemaphoreEXT_validation;}
+if(this->m_ptr_glProgramParameters4dvNV){this->m_orig_glProgramParameters4dvNV = this->m_ptr_glProgramParameters4dvNV;this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&ValidationTableDecorator::m_glProgramParameters4dvNV_validation;}
+if(this->m_ptr_glVertexAttribL4dv){this->m_orig_glVertexAttribL4dv = this->m_ptr_glVertexAttribL4dv;this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&ValidationTableDecorator::m_glVertexAttribL4dv_validation;}
+if(this->m_ptr_glGetTexParameteriv){this->m_orig_glGetTexParameteriv = this->m_ptr_glGetTexParameteriv;this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&ValidationTableDecorator::m_glGetTexParameteriv_validation;}
+if(this->m_ptr_glGetUniformOffsetEXT){this->m_orig_glGetUniformOffsetEXT = this->m_ptr_glGetUniformOffsetEXT;this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&ValidationTableDecorator::m_glGetUniformOffsetEXT_validation;}
+if(this->m_ptr_glGetVertexAttribPointerv){this->m_orig_glGetVertexAttribPointerv = this->m_ptr_glGetVertexAttribPointerv;this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&ValidationTableDecorator::m_glGetVertexAttribPointerv_validation;}
+if(this->m_ptr_glResumeTransformFeedbackNV){this->m_orig_glResumeTransformFeedbackNV = this->m_ptr_glResumeTransformFeedbackNV;this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glResumeTransformFeedbackNV_validation;}
+if(this->m_ptr_glProgramUniform3i64vNV){this->m_orig_glProgramUniform3i64vNV = this->m_ptr_glProgramUniform3i64vNV;this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&ValidationTableDecorator::m_glProgramUniform3i64vNV_validation;}
+if(this->m_ptr_glTangent3fEXT){this->m_orig_glTangent3fEXT = this->m_ptr_glTangent3fEXT;this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&ValidationTableDecorator::m_glTangent3fEXT_validation;}
+if(this->m_ptr_glGetPathMetricRangeNV){this->m_orig_glGetPathMetricRangeNV = this->m_ptr_glGetPathMetricRangeNV;this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&ValidationTableDecorator::m_glGetPathMetricRangeNV_validation;}
+if(this->m_ptr_glWindowPos2iMESA){this->m_orig_glWindowPos2iMESA = this->m_ptr_glWindowPos2iMESA;this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&ValidationTableDecorator::m_glWindowPos2iMESA_validation;}
+if(this->m_ptr_glVertex2xvOES){this->m_orig_glVertex2xvOES = this->m_ptr_glVertex2xvOES;this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&ValidationTableDecorator::m_glVertex2xvOES_validation;}
+if(this->m_ptr_glGetnCompressedTexImage){this->m_orig_glGetnCompressedTexImage = this->m_ptr_glGetnCompressedTexImage;this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&ValidationTableDecorator::m_glGetnCompressedTexImage_validation;}
+if(this->m_ptr_glWindowPos2dv){this->m_orig_glWindowPos2dv = this->m_ptr_glWindowPos2dv;this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&ValidationTableDecorator::m_glWindowPos2dv_validation;}
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN){this->m_orig_glReplacementCodeuiVertex3fSUN = this->m_ptr_glReplacementCodeuiVertex3fSUN;this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&ValidationTableDecorator::m_glReplacementCodeuiVertex3fSUN_validation;}
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT){this->m_orig_glGetTransformFeedbackVaryingEXT = this->m_ptr_glGetTransformFeedbackVaryingEXT;this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&ValidationTableDecorator::m_glGetTransformFeedbackVaryingEXT_validation;}
+if(this->m_ptr_glWindowPos3fARB){this->m_orig_glWindowPos3fARB = this->m_ptr_glWindowPos3fARB;this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&ValidationTableDecorator::m_glWindowPos3fARB_validation;}
+if(this->m_ptr_glMapNamedBufferEXT){this->m_orig_glMapNamedBufferEXT = this->m_ptr_glMapNamedBufferEXT;this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&ValidationTableDecorator::m_glMapNamedBufferEXT_validation;}
+if(this->m_ptr_glDisable){this->m_orig_glDisable = this->m_ptr_glDisable;this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&ValidationTableDecorator::m_glDisable_validation;}
+if(this->m_ptr_glIsPointInFillPathNV){this->m_orig_glIsPointInFillPathNV = this->m_ptr_glIsPointInFillPathNV;this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&ValidationTableDecorator::m_glIsPointInFillPathNV_validation;}
+if(this->m_ptr_glVertexAttribI2uiEXT){this->m_orig_glVertexAttribI2uiEXT = this->m_ptr_glVertexAttribI2uiEXT;this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&ValidationTableDecorator::m_glVertexAttribI2uiEXT_validation;}
+if(this->m_ptr_glProgramUniform4uiv){this->m_orig_glProgramUniform4uiv = this->m_ptr_glProgramUniform4uiv;this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&ValidationTableDecorator::m_glProgramUniform4uiv_validation;}
+if(this->m_ptr_glQueryCounter){this->m_orig_glQueryCounter = this->m_ptr_glQueryCounter;this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&ValidationTableDecorator::m_glQueryCounter_validation;}
+if(this->m_ptr_glFramebufferRenderbufferEXT){this->m_orig_glFramebufferRenderbufferEXT = this->m_ptr_glFramebufferRenderbufferEXT;this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&ValidationTableDecorator::m_glFramebufferRenderbufferEXT_validation;}
+if(this->m_ptr_glBinormal3svEXT){this->m_orig_glBinormal3svEXT = this->m_ptr_glBinormal3svEXT;this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&ValidationTableDecorator::m_glBinormal3svEXT_validation;}
+if(this->m_ptr_glBindBufferOffsetNV){this->m_orig_glBindBufferOffsetNV = this->m_ptr_glBindBufferOffsetNV;this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&ValidationTableDecorator::m_glBindBufferOffsetNV_validation;}
+if(this->m_ptr_glCopyTextureSubImage2D){this->m_orig_glCopyTextureSubImage2D = this->m_ptr_glCopyTextureSubImage2D;this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&ValidationTableDecorator::m_glCopyTextureSubImage2D_validation;}
+if(this->m_ptr_glGetProgramResourcefvNV){this->m_orig_glGetProgramResourcefvNV = this->m_ptr_glGetProgramResourcefvNV;this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&ValidationTableDecorator::m_glGetProgramResourcefvNV_validation;}
+if(this->m_ptr_glBinormalPointerEXT){this->m_orig_glBinormalPointerEXT = this->m_ptr_glBinormalPointerEXT;this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&ValidationTableDecorator::m_glBinormalPointerEXT_validation;}
+if(this->m_ptr_glGetLightfv){this->m_orig_glGetLightfv = this->m_ptr_glGetLightfv;this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&ValidationTableDecorator::m_glGetLightfv_validation;}
+if(this->m_ptr_glMulticastCopyImageSubDataNV){this->m_orig_glMulticastCopyImageSubDataNV = this->m_ptr_glMulticastCopyImageSubDataNV;this->m_ptr_glMulticastCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC)&ValidationTableDecorator::m_glMulticastCopyImageSubDataNV_validation;}
+if(this->m_ptr_glVertex2bOES){this->m_orig_glVertex2bOES = this->m_ptr_glVertex2bOES;this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&ValidationTableDecorator::m_glVertex2bOES_validation;}
+if(this->m_ptr_glUniform2ivARB){this->m_orig_glUniform2ivARB = this->m_ptr_glUniform2ivARB;this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&ValidationTableDecorator::m_glUniform2ivARB_validation;}
+if(this->m_ptr_glMultiTexCoord3s){this->m_orig_glMultiTexCoord3s = this->m_ptr_glMultiTexCoord3s;this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&ValidationTableDecorator::m_glMultiTexCoord3s_validation;}
+if(this->m_ptr_glGetHistogramParameterfvEXT){this->m_orig_glGetHistogramParameterfvEXT = this->m_ptr_glGetHistogramParameterfvEXT;this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glGetHistogramParameterfvEXT_validation;}
+if(this->m_ptr_glGetProgramStringNV){this->m_orig_glGetProgramStringNV = this->m_ptr_glGetProgramStringNV;this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&ValidationTableDecorator::m_glGetProgramStringNV_validation;}
+if(this->m_ptr_glGetTexGenxvOES){this->m_orig_glGetTexGenxvOES = this->m_ptr_glGetTexGenxvOES;this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&ValidationTableDecorator::m_glGetTexGenxvOES_validation;}
+if(this->m_ptr_glTextureSubImage2D){this->m_orig_glTextureSubImage2D = this->m_ptr_glTextureSubImage2D;this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&ValidationTableDecorator::m_glTextureSubImage2D_validation;}
+if(this->m_ptr_glObjectPurgeableAPPLE){this->m_orig_glObjectPurgeableAPPLE = this->m_ptr_glObjectPurgeableAPPLE;this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&ValidationTableDecorator::m_glObjectPurgeableAPPLE_validation;}
+if(this->m_ptr_glColorTableSGI){this->m_orig_glColorTableSGI = this->m_ptr_glColorTableSGI;this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&ValidationTableDecorator::m_glColorTableSGI_validation;}
+if(this->m_ptr_glCopyConvolutionFilter2DEXT){this->m_orig_glCopyConvolutionFilter2DEXT = this->m_ptr_glCopyConvolutionFilter2DEXT;this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&ValidationTableDecorator::m_glCopyConvolutionFilter2DEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3f){this->m_orig_glMultiTexCoord3f = this->m_ptr_glMultiTexCoord3f;this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&ValidationTableDecorator::m_glMultiTexCoord3f_validation;}
+if(this->m_ptr_glMultiTexCoord3d){this->m_orig_glMultiTexCoord3d = this->m_ptr_glMultiTexCoord3d;this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&ValidationTableDecorator::m_glMultiTexCoord3d_validation;}
+if(this->m_ptr_glFogCoorddv){this->m_orig_glFogCoorddv = this->m_ptr_glFogCoorddv;this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&ValidationTableDecorator::m_glFogCoorddv_validation;}
+if(this->m_ptr_glGetBufferPointerv){this->m_orig_glGetBufferPointerv = this->m_ptr_glGetBufferPointerv;this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&ValidationTableDecorator::m_glGetBufferPointerv_validation;}
+if(this->m_ptr_glProgramUniform1fEXT){this->m_orig_glProgramUniform1fEXT = this->m_ptr_glProgramUniform1fEXT;this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&ValidationTableDecorator::m_glProgramUniform1fEXT_validation;}
+if(this->m_ptr_glWindowPos2fvMESA){this->m_orig_glWindowPos2fvMESA = this->m_ptr_glWindowPos2fvMESA;this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&ValidationTableDecorator::m_glWindowPos2fvMESA_validation;}
+if(this->m_ptr_glAlphaToCoverageDitherControlNV){this->m_orig_glAlphaToCoverageDitherControlNV = this->m_ptr_glAlphaToCoverageDitherControlNV;this->m_ptr_glAlphaToCoverageDitherControlNV = (FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)&ValidationTableDecorator::m_glAlphaToCoverageDitherControlNV_validation;}
+if(this->m_ptr_glPolygonOffsetxOES){this->m_orig_glPolygonOffsetxOES = this->m_ptr_glPolygonOffsetxOES;this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&ValidationTableDecorator::m_glPolygonOffsetxOES_validation;}
+if(this->m_ptr_glVertexAttrib4dARB){this->m_orig_glVertexAttrib4dARB = this->m_ptr_glVertexAttrib4dARB;this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&ValidationTableDecorator::m_glVertexAttrib4dARB_validation;}
+if(this->m_ptr_glUniformHandleui64vARB){this->m_orig_glUniformHandleui64vARB = this->m_ptr_glUniformHandleui64vARB;this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&ValidationTableDecorator::m_glUniformHandleui64vARB_validation;}
+if(this->m_ptr_glFragmentLightModelfvSGIX){this->m_orig_glFragmentLightModelfvSGIX = this->m_ptr_glFragmentLightModelfvSGIX;this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&ValidationTableDecorator::m_glFragmentLightModelfvSGIX_validation;}
+if(this->m_ptr_glSwizzleEXT){this->m_orig_glSwizzleEXT = this->m_ptr_glSwizzleEXT;this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&ValidationTableDecorator::m_glSwizzleEXT_validation;}
+if(this->m_ptr_glBindFragmentShaderATI){this->m_orig_glBindFragmentShaderATI = this->m_ptr_glBindFragmentShaderATI;this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&ValidationTableDecorator::m_glBindFragmentShaderATI_validation;}
+if(this->m_ptr_glVertexAttribs3hvNV){this->m_orig_glVertexAttribs3hvNV = this->m_ptr_glVertexAttribs3hvNV;this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&ValidationTableDecorator::m_glVertexAttribs3hvNV_validation;}
+if(this->m_ptr_glGenBuffersARB){this->m_orig_glGenBuffersARB = this->m_ptr_glGenBuffersARB;this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&ValidationTableDecorator::m_glGenBuffersARB_validation;}
+if(this->m_ptr_glTextureStorageMem2DMultisampleEXT){this->m_orig_glTextureStorageMem2DMultisampleEXT = this->m_ptr_glTextureStorageMem2DMultisampleEXT;this->m_ptr_glTextureStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)&ValidationTableDecorator::m_glTextureStorageMem2DMultisampleEXT_validation;}
+if(this->m_ptr_glListParameterfvSGIX){this->m_orig_glListParameterfvSGIX = this->m_ptr_glListParameterfvSGIX;this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&ValidationTableDecorator::m_glListParameterfvSGIX_validation;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisample){this->m_orig_glNamedRenderbufferStorageMultisample = this->m_ptr_glNamedRenderbufferStorageMultisample;this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ValidationTableDecorator::m_glNamedRenderbufferStorageMultisample_validation;}
+if(this->m_ptr_glVertexAttribI1iEXT){this->m_orig_glVertexAttribI1iEXT = this->m_ptr_glVertexAttribI1iEXT;this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&ValidationTableDecorator::m_glVertexAttribI1iEXT_validation;}
+if(this->m_ptr_glMultiTexCoord2ivARB){this->m_orig_glMultiTexCoord2ivARB = this->m_ptr_glMultiTexCoord2ivARB;this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2ivARB_validation;}
+if(this->m_ptr_glLightModelxOES){this->m_orig_glLightModelxOES = this->m_ptr_glLightModelxOES;this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&ValidationTableDecorator::m_glLightModelxOES_validation;}
+if(this->m_ptr_glColor3xOES){this->m_orig_glColor3xOES = this->m_ptr_glColor3xOES;this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&ValidationTableDecorator::m_glColor3xOES_validation;}
+if(this->m_ptr_glReadBuffer){this->m_orig_glReadBuffer = this->m_ptr_glReadBuffer;this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&ValidationTableDecorator::m_glReadBuffer_validation;}
+if(this->m_ptr_glStencilFillPathInstancedNV){this->m_orig_glStencilFillPathInstancedNV = this->m_ptr_glStencilFillPathInstancedNV;this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&ValidationTableDecorator::m_glStencilFillPathInstancedNV_validation;}
+if(this->m_ptr_glVDPAUUnmapSurfacesNV){this->m_orig_glVDPAUUnmapSurfacesNV = this->m_ptr_glVDPAUUnmapSurfacesNV;this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&ValidationTableDecorator::m_glVDPAUUnmapSurfacesNV_validation;}
+if(this->m_ptr_glProgramUniform4i64NV){this->m_orig_glProgramUniform4i64NV = this->m_ptr_glProgramUniform4i64NV;this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&ValidationTableDecorator::m_glProgramUniform4i64NV_validation;}
+if(this->m_ptr_glVertexStream4dvATI){this->m_orig_glVertexStream4dvATI = this->m_ptr_glVertexStream4dvATI;this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&ValidationTableDecorator::m_glVertexStream4dvATI_validation;}
+if(this->m_ptr_glIsQuery){this->m_orig_glIsQuery = this->m_ptr_glIsQuery;this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&ValidationTableDecorator::m_glIsQuery_validation;}
+if(this->m_ptr_glProgramUniformMatrix4fvEXT){this->m_orig_glProgramUniformMatrix4fvEXT = this->m_ptr_glProgramUniformMatrix4fvEXT;this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4fvEXT_validation;}
+if(this->m_ptr_glVertexAttrib3hNV){this->m_orig_glVertexAttrib3hNV = this->m_ptr_glVertexAttrib3hNV;this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&ValidationTableDecorator::m_glVertexAttrib3hNV_validation;}
+if(this->m_ptr_glFlushMappedNamedBufferRange){this->m_orig_glFlushMappedNamedBufferRange = this->m_ptr_glFlushMappedNamedBufferRange;this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&ValidationTableDecorator::m_glFlushMappedNamedBufferRange_validation;}
+if(this->m_ptr_glPushName){this->m_orig_glPushName = this->m_ptr_glPushName;this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&ValidationTableDecorator::m_glPushName_validation;}
+if(this->m_ptr_glGetClipPlane){this->m_orig_glGetClipPlane = this->m_ptr_glGetClipPlane;this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&ValidationTableDecorator::m_glGetClipPlane_validation;}
+if(this->m_ptr_glVertex4dv){this->m_orig_glVertex4dv = this->m_ptr_glVertex4dv;this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&ValidationTableDecorator::m_glVertex4dv_validation;}
+if(this->m_ptr_glVertexAttrib3d){this->m_orig_glVertexAttrib3d = this->m_ptr_glVertexAttrib3d;this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&ValidationTableDecorator::m_glVertexAttrib3d_validation;}
+if(this->m_ptr_glBlendColor){this->m_orig_glBlendColor = this->m_ptr_glBlendColor;this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&ValidationTableDecorator::m_glBlendColor_validation;}
+if(this->m_ptr_glBindTransformFeedbackNV){this->m_orig_glBindTransformFeedbackNV = this->m_ptr_glBindTransformFeedbackNV;this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glBindTransformFeedbackNV_validation;}
+if(this->m_ptr_glSamplerParameterIuiv){this->m_orig_glSamplerParameterIuiv = this->m_ptr_glSamplerParameterIuiv;this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&ValidationTableDecorator::m_glSamplerParameterIuiv_validation;}
+if(this->m_ptr_glIndexubv){this->m_orig_glIndexubv = this->m_ptr_glIndexubv;this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&ValidationTableDecorator::m_glIndexubv_validation;}
+if(this->m_ptr_glNamedBufferPageCommitmentEXT){this->m_orig_glNamedBufferPageCommitmentEXT = this->m_ptr_glNamedBufferPageCommitmentEXT;this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&ValidationTableDecorator::m_glNamedBufferPageCommitmentEXT_validation;}
+if(this->m_ptr_glCheckNamedFramebufferStatus){this->m_orig_glCheckNamedFramebufferStatus = this->m_ptr_glCheckNamedFramebufferStatus;this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&ValidationTableDecorator::m_glCheckNamedFramebufferStatus_validation;}
+if(this->m_ptr_glGetObjectBufferfvATI){this->m_orig_glGetObjectBufferfvATI = this->m_ptr_glGetObjectBufferfvATI;this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&ValidationTableDecorator::m_glGetObjectBufferfvATI_validation;}
+if(this->m_ptr_glRasterPos4d){this->m_orig_glRasterPos4d = this->m_ptr_glRasterPos4d;this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&ValidationTableDecorator::m_glRasterPos4d_validation;}
+if(this->m_ptr_glRasterPos4f){this->m_orig_glRasterPos4f = this->m_ptr_glRasterPos4f;this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&ValidationTableDecorator::m_glRasterPos4f_validation;}
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD){this->m_orig_glGetPerfMonitorCounterStringAMD = this->m_ptr_glGetPerfMonitorCounterStringAMD;this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&ValidationTableDecorator::m_glGetPerfMonitorCounterStringAMD_validation;}
+if(this->m_ptr_glVertexAttrib3s){this->m_orig_glVertexAttrib3s = this->m_ptr_glVertexAttrib3s;this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&ValidationTableDecorator::m_glVertexAttrib3s_validation;}
+if(this->m_ptr_glDrawElementsInstancedEXT){this->m_orig_glDrawElementsInstancedEXT = this->m_ptr_glDrawElementsInstancedEXT;this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&ValidationTableDecorator::m_glDrawElementsInstancedEXT_validation;}
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT){this->m_orig_glNamedProgramLocalParameterI4iEXT = this->m_ptr_glNamedProgramLocalParameterI4iEXT;this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameterI4iEXT_validation;}
+if(this->m_ptr_glRasterPos4s){this->m_orig_glRasterPos4s = this->m_ptr_glRasterPos4s;this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&ValidationTableDecorator::m_glRasterPos4s_validation;}
+if(this->m_ptr_glGetProgramStageiv){this->m_orig_glGetProgramStageiv = this->m_ptr_glGetProgramStageiv;this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&ValidationTableDecorator::m_glGetProgramStageiv_validation;}
+if(this->m_ptr_glGetMaterialxOES){this->m_orig_glGetMaterialxOES = this->m_ptr_glGetMaterialxOES;this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&ValidationTableDecorator::m_glGetMaterialxOES_validation;}
+if(this->m_ptr_glPopMatrix){this->m_orig_glPopMatrix = this->m_ptr_glPopMatrix;this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&ValidationTableDecorator::m_glPopMatrix_validation;}
+if(this->m_ptr_glGetVideoui64vNV){this->m_orig_glGetVideoui64vNV = this->m_ptr_glGetVideoui64vNV;this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&ValidationTableDecorator::m_glGetVideoui64vNV_validation;}
+if(this->m_ptr_glTangent3bEXT){this->m_orig_glTangent3bEXT = this->m_ptr_glTangent3bEXT;this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&ValidationTableDecorator::m_glTangent3bEXT_validation;}
+if(this->m_ptr_glGetGraphicsResetStatusARB){this->m_orig_glGetGraphicsResetStatusARB = this->m_ptr_glGetGraphicsResetStatusARB;this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&ValidationTableDecorator::m_glGetGraphicsResetStatusARB_validation;}
+if(this->m_ptr_glUniform4i){this->m_orig_glUniform4i = this->m_ptr_glUniform4i;this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&ValidationTableDecorator::m_glUniform4i_validation;}
+if(this->m_ptr_glActiveTexture){this->m_orig_glActiveTexture = this->m_ptr_glActiveTexture;this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&ValidationTableDecorator::m_glActiveTexture_validation;}
+if(this->m_ptr_glEnableVertexAttribArray){this->m_orig_glEnableVertexAttribArray = this->m_ptr_glEnableVertexAttribArray;this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&ValidationTableDecorator::m_glEnableVertexAttribArray_validation;}
+if(this->m_ptr_glTexCoord4fVertex4fvSUN){this->m_orig_glTexCoord4fVertex4fvSUN = this->m_ptr_glTexCoord4fVertex4fvSUN;this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&ValidationTableDecorator::m_glTexCoord4fVertex4fvSUN_validation;}
+if(this->m_ptr_glUniform4d){this->m_orig_glUniform4d = this->m_ptr_glUniform4d;this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&ValidationTableDecorator::m_glUniform4d_validation;}
+if(this->m_ptr_glUniform4f){this->m_orig_glUniform4f = this->m_ptr_glUniform4f;this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&ValidationTableDecorator::m_glUniform4f_validation;}
+if(this->m_ptr_glRenderbufferStorageMultisample){this->m_orig_glRenderbufferStorageMultisample = this->m_ptr_glRenderbufferStorageMultisample;this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ValidationTableDecorator::m_glRenderbufferStorageMultisample_validation;}
+if(this->m_ptr_glCreateProgramPipelines){this->m_orig_glCreateProgramPipelines = this->m_ptr_glCreateProgramPipelines;this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&ValidationTableDecorator::m_glCreateProgramPipelines_validation;}
+if(this->m_ptr_glVertexAttribLPointer){this->m_orig_glVertexAttribLPointer = this->m_ptr_glVertexAttribLPointer;this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&ValidationTableDecorator::m_glVertexAttribLPointer_validation;}
+if(this->m_ptr_glUniform2uiEXT){this->m_orig_glUniform2uiEXT = this->m_ptr_glUniform2uiEXT;this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&ValidationTableDecorator::m_glUniform2uiEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3sv){this->m_orig_glMultiTexCoord3sv = this->m_ptr_glMultiTexCoord3sv;this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&ValidationTableDecorator::m_glMultiTexCoord3sv_validation;}
+if(this->m_ptr_glDrawElementsInstancedBaseVertex){this->m_orig_glDrawElementsInstancedBaseVertex = this->m_ptr_glDrawElementsInstancedBaseVertex;this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&ValidationTableDecorator::m_glDrawElementsInstancedBaseVertex_validation;}
+if(this->m_ptr_glPixelTransformParameterfvEXT){this->m_orig_glPixelTransformParameterfvEXT = this->m_ptr_glPixelTransformParameterfvEXT;this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glPixelTransformParameterfvEXT_validation;}
+if(this->m_ptr_glDrawTransformFeedbackNV){this->m_orig_glDrawTransformFeedbackNV = this->m_ptr_glDrawTransformFeedbackNV;this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glDrawTransformFeedbackNV_validation;}
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV){this->m_orig_glTextureImage2DMultisampleCoverageNV = this->m_ptr_glTextureImage2DMultisampleCoverageNV;this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&ValidationTableDecorator::m_glTextureImage2DMultisampleCoverageNV_validation;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT){this->m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT;this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&ValidationTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_validation;}
+if(this->m_ptr_glIsTexture){this->m_orig_glIsTexture = this->m_ptr_glIsTexture;this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&ValidationTableDecorator::m_glIsTexture_validation;}
+if(this->m_ptr_glMultiTexCoord4iv){this->m_orig_glMultiTexCoord4iv = this->m_ptr_glMultiTexCoord4iv;this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&ValidationTableDecorator::m_glMultiTexCoord4iv_validation;}
+if(this->m_ptr_glTexEnvfv){this->m_orig_glTexEnvfv = this->m_ptr_glTexEnvfv;this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&ValidationTableDecorator::m_glTexEnvfv_validation;}
+if(this->m_ptr_glPopDebugGroup){this->m_orig_glPopDebugGroup = this->m_ptr_glPopDebugGroup;this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&ValidationTableDecorator::m_glPopDebugGroup_validation;}
+if(this->m_ptr_glUniformBlockBinding){this->m_orig_glUniformBlockBinding = this->m_ptr_glUniformBlockBinding;this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&ValidationTableDecorator::m_glUniformBlockBinding_validation;}
+if(this->m_ptr_glWindowPos2svMESA){this->m_orig_glWindowPos2svMESA = this->m_ptr_glWindowPos2svMESA;this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&ValidationTableDecorator::m_glWindowPos2svMESA_validation;}
+if(this->m_ptr_glGenerateTextureMipmapEXT){this->m_orig_glGenerateTextureMipmapEXT = this->m_ptr_glGenerateTextureMipmapEXT;this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&ValidationTableDecorator::m_glGenerateTextureMipmapEXT_validation;}
+if(this->m_ptr_glBindLightParameterEXT){this->m_orig_glBindLightParameterEXT = this->m_ptr_glBindLightParameterEXT;this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&ValidationTableDecorator::m_glBindLightParameterEXT_validation;}
+if(this->m_ptr_glTexCoord3bOES){this->m_orig_glTexCoord3bOES = this->m_ptr_glTexCoord3bOES;this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&ValidationTableDecorator::m_glTexCoord3bOES_validation;}
+if(this->m_ptr_glTexCoordPointer){this->m_orig_glTexCoordPointer = this->m_ptr_glTexCoordPointer;this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&ValidationTableDecorator::m_glTexCoordPointer_validation;}
+if(this->m_ptr_glProgramUniformMatrix3x2fv){this->m_orig_glProgramUniformMatrix3x2fv = this->m_ptr_glProgramUniformMatrix3x2fv;this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix3x2fv_validation;}
+if(this->m_ptr_glUniform2fvARB){this->m_orig_glUniform2fvARB = this->m_ptr_glUniform2fvARB;this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&ValidationTableDecorator::m_glUniform2fvARB_validation;}
+if(this->m_ptr_glProgramLocalParameterI4uivNV){this->m_orig_glProgramLocalParameterI4uivNV = this->m_ptr_glProgramLocalParameterI4uivNV;this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&ValidationTableDecorator::m_glProgramLocalParameterI4uivNV_validation;}
+if(this->m_ptr_glFlushVertexArrayRangeNV){this->m_orig_glFlushVertexArrayRangeNV = this->m_ptr_glFlushVertexArrayRangeNV;this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&ValidationTableDecorator::m_glFlushVertexArrayRangeNV_validation;}
+if(this->m_ptr_glSecondaryColor3svEXT){this->m_orig_glSecondaryColor3svEXT = this->m_ptr_glSecondaryColor3svEXT;this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3svEXT_validation;}
+if(this->m_ptr_glGetBufferParameteriv){this->m_orig_glGetBufferParameteriv = this->m_ptr_glGetBufferParameteriv;this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&ValidationTableDecorator::m_glGetBufferParameteriv_validation;}
+if(this->m_ptr_glGetQueryIndexediv){this->m_orig_glGetQueryIndexediv = this->m_ptr_glGetQueryIndexediv;this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&ValidationTableDecorator::m_glGetQueryIndexediv_validation;}
+if(this->m_ptr_glFramebufferTexture3DEXT){this->m_orig_glFramebufferTexture3DEXT = this->m_ptr_glFramebufferTexture3DEXT;this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&ValidationTableDecorator::m_glFramebufferTexture3DEXT_validation;}
+if(this->m_ptr_glLoadTransposeMatrixxOES){this->m_orig_glLoadTransposeMatrixxOES = this->m_ptr_glLoadTransposeMatrixxOES;this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&ValidationTableDecorator::m_glLoadTransposeMatrixxOES_validation;}
+if(this->m_ptr_glDeleteTransformFeedbacksNV){this->m_orig_glDeleteTransformFeedbacksNV = this->m_ptr_glDeleteTransformFeedbacksNV;this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&ValidationTableDecorator::m_glDeleteTransformFeedbacksNV_validation;}
+if(this->m_ptr_glGetCompressedTextureImageEXT){this->m_orig_glGetCompressedTextureImageEXT = this->m_ptr_glGetCompressedTextureImageEXT;this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&ValidationTableDecorator::m_glGetCompressedTextureImageEXT_validation;}
+if(this->m_ptr_glIndexMaterialEXT){this->m_orig_glIndexMaterialEXT = this->m_ptr_glIndexMaterialEXT;this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&ValidationTableDecorator::m_glIndexMaterialEXT_validation;}
+if(this->m_ptr_glFogCoorddEXT){this->m_orig_glFogCoorddEXT = this->m_ptr_glFogCoorddEXT;this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&ValidationTableDecorator::m_glFogCoorddEXT_validation;}
+if(this->m_ptr_glTexCoord2hvNV){this->m_orig_glTexCoord2hvNV = this->m_ptr_glTexCoord2hvNV;this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&ValidationTableDecorator::m_glTexCoord2hvNV_validation;}
+if(this->m_ptr_glGetFramebufferParameterfvAMD){this->m_orig_glGetFramebufferParameterfvAMD = this->m_ptr_glGetFramebufferParameterfvAMD;this->m_ptr_glGetFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)&ValidationTableDecorator::m_glGetFramebufferParameterfvAMD_validation;}
+if(this->m_ptr_glTexEnviv){this->m_orig_glTexEnviv = this->m_ptr_glTexEnviv;this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&ValidationTableDecorator::m_glTexEnviv_validation;}
+if(this->m_ptr_glEndTransformFeedbackNV){this->m_orig_glEndTransformFeedbackNV = this->m_ptr_glEndTransformFeedbackNV;this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&ValidationTableDecorator::m_glEndTransformFeedbackNV_validation;}
+if(this->m_ptr_glGlobalAlphaFactoruiSUN){this->m_orig_glGlobalAlphaFactoruiSUN = this->m_ptr_glGlobalAlphaFactoruiSUN;this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&ValidationTableDecorator::m_glGlobalAlphaFactoruiSUN_validation;}
+if(this->m_ptr_glSelectBuffer){this->m_orig_glSelectBuffer = this->m_ptr_glSelectBuffer;this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&ValidationTableDecorator::m_glSelectBuffer_validation;}
+if(this->m_ptr_glNamedBufferSubDataEXT){this->m_orig_glNamedBufferSubDataEXT = this->m_ptr_glNamedBufferSubDataEXT;this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&ValidationTableDecorator::m_glNamedBufferSubDataEXT_validation;}
+if(this->m_ptr_glDisableVertexArrayAttrib){this->m_orig_glDisableVertexArrayAttrib = this->m_ptr_glDisableVertexArrayAttrib;this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&ValidationTableDecorator::m_glDisableVertexArrayAttrib_validation;}
+if(this->m_ptr_glBlendFunc){this->m_orig_glBlendFunc = this->m_ptr_glBlendFunc;this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&ValidationTableDecorator::m_glBlendFunc_validation;}
+if(this->m_ptr_glCreateProgram){this->m_orig_glCreateProgram = this->m_ptr_glCreateProgram;this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&ValidationTableDecorator::m_glCreateProgram_validation;}
+if(this->m_ptr_glVertexStream2dATI){this->m_orig_glVertexStream2dATI = this->m_ptr_glVertexStream2dATI;this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&ValidationTableDecorator::m_glVertexStream2dATI_validation;}
+if(this->m_ptr_glUniform4ui64vARB){this->m_orig_glUniform4ui64vARB = this->m_ptr_glUniform4ui64vARB;this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&ValidationTableDecorator::m_glUniform4ui64vARB_validation;}
+if(this->m_ptr_glGetSemaphoreParameterui64vEXT){this->m_orig_glGetSemaphoreParameterui64vEXT = this->m_ptr_glGetSemaphoreParameterui64vEXT;this->m_ptr_glGetSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)&ValidationTableDecorator::m_glGetSemaphoreParameterui64vEXT_validation;}
+if(this->m_ptr_glPrimitiveRestartIndex){this->m_orig_glPrimitiveRestartIndex = this->m_ptr_glPrimitiveRestartIndex;this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&ValidationTableDecorator::m_glPrimitiveRestartIndex_validation;}
+if(this->m_ptr_glNormalStream3fATI){this->m_orig_glNormalStream3fATI = this->m_ptr_glNormalStream3fATI;this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&ValidationTableDecorator::m_glNormalStream3fATI_validation;}
+if(this->m_ptr_glProgramUniformMatrix2fv){this->m_orig_glProgramUniformMatrix2fv = this->m_ptr_glProgramUniformMatrix2fv;this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix2fv_validation;}
+if(this->m_ptr_glVertexAttribs1hvNV){this->m_orig_glVertexAttribs1hvNV = this->m_ptr_glVertexAttribs1hvNV;this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&ValidationTableDecorator::m_glVertexAttribs1hvNV_validation;}
+if(this->m_ptr_glWindowPos4svMESA){this->m_orig_glWindowPos4svMESA = this->m_ptr_glWindowPos4svMESA;this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&ValidationTableDecorator::m_glWindowPos4svMESA_validation;}
+if(this->m_ptr_glDeleteFragmentShaderATI){this->m_orig_glDeleteFragmentShaderATI = this->m_ptr_glDeleteFragmentShaderATI;this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&ValidationTableDecorator::m_glDeleteFragmentShaderATI_validation;}
+if(this->m_ptr_glBindImageTextures){this->m_orig_glBindImageTextures = this->m_ptr_glBindImageTextures;this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&ValidationTableDecorator::m_glBindImageTextures_validation;}
+if(this->m_ptr_glMap2xOES){this->m_orig_glMap2xOES = this->m_ptr_glMap2xOES;this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&ValidationTableDecorator::m_glMap2xOES_validation;}
+if(this->m_ptr_glEnd){this->m_orig_glEnd = this->m_ptr_glEnd;this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&ValidationTableDecorator::m_glEnd_validation;}
+if(this->m_ptr_glMultiTexCoord2dARB){this->m_orig_glMultiTexCoord2dARB = this->m_ptr_glMultiTexCoord2dARB;this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&ValidationTableDecorator::m_glMultiTexCoord2dARB_validation;}
+if(this->m_ptr_glUniform1i64NV){this->m_orig_glUniform1i64NV = this->m_ptr_glUniform1i64NV;this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&ValidationTableDecorator::m_glUniform1i64NV_validation;}
+if(this->m_ptr_glPathStringNV){this->m_orig_glPathStringNV = this->m_ptr_glPathStringNV;this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&ValidationTableDecorator::m_glPathStringNV_validation;}
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT){this->m_orig_glGetNamedFramebufferParameterivEXT = this->m_ptr_glGetNamedFramebufferParameterivEXT;this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&ValidationTableDecorator::m_glGetNamedFramebufferParameterivEXT_validation;}
+if(this->m_ptr_glGetProgramNamedParameterdvNV){this->m_orig_glGetProgramNamedParameterdvNV = this->m_ptr_glGetProgramNamedParameterdvNV;this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&ValidationTableDecorator::m_glGetProgramNamedParameterdvNV_validation;}
+if(this->m_ptr_glPathDashArrayNV){this->m_orig_glPathDashArrayNV = this->m_ptr_glPathDashArrayNV;this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&ValidationTableDecorator::m_glPathDashArrayNV_validation;}
+if(this->m_ptr_glUniform3uiv){this->m_orig_glUniform3uiv = this->m_ptr_glUniform3uiv;this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&ValidationTableDecorator::m_glUniform3uiv_validation;}
+if(this->m_ptr_glColor3fVertex3fvSUN){this->m_orig_glColor3fVertex3fvSUN = this->m_ptr_glColor3fVertex3fvSUN;this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&ValidationTableDecorator::m_glColor3fVertex3fvSUN_validation;}
+if(this->m_ptr_glMultTransposeMatrixd){this->m_orig_glMultTransposeMatrixd = this->m_ptr_glMultTransposeMatrixd;this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&ValidationTableDecorator::m_glMultTransposeMatrixd_validation;}
+if(this->m_ptr_glClearColor){this->m_orig_glClearColor = this->m_ptr_glClearColor;this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&ValidationTableDecorator::m_glClearColor_validation;}
+if(this->m_ptr_glGetImageHandleARB){this->m_orig_glGetImageHandleARB = this->m_ptr_glGetImageHandleARB;this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&ValidationTableDecorator::m_glGetImageHandleARB_validation;}
+if(this->m_ptr_glTangent3dEXT){this->m_orig_glTangent3dEXT = this->m_ptr_glTangent3dEXT;this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&ValidationTableDecorator::m_glTangent3dEXT_validation;}
+if(this->m_ptr_glGetQueryObjectivARB){this->m_orig_glGetQueryObjectivARB = this->m_ptr_glGetQueryObjectivARB;this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&ValidationTableDecorator::m_glGetQueryObjectivARB_validation;}
+if(this->m_ptr_glGetLocalConstantFloatvEXT){this->m_orig_glGetLocalConstantFloatvEXT = this->m_ptr_glGetLocalConstantFloatvEXT;this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&ValidationTableDecorator::m_glGetLocalConstantFloatvEXT_validation;}
+if(this->m_ptr_glUseShaderProgramEXT){this->m_orig_glUseShaderProgramEXT = this->m_ptr_glUseShaderProgramEXT;this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&ValidationTableDecorator::m_glUseShaderProgramEXT_validation;}
+if(this->m_ptr_glBindRenderbufferEXT){this->m_orig_glBindRenderbufferEXT = this->m_ptr_glBindRenderbufferEXT;this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&ValidationTableDecorator::m_glBindRenderbufferEXT_validation;}
+if(this->m_ptr_glInterleavedArrays){this->m_orig_glInterleavedArrays = this->m_ptr_glInterleavedArrays;this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&ValidationTableDecorator::m_glInterleavedArrays_validation;}
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD){this->m_orig_glGetPerfMonitorGroupStringAMD = this->m_ptr_glGetPerfMonitorGroupStringAMD;this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&ValidationTableDecorator::m_glGetPerfMonitorGroupStringAMD_validation;}
+if(this->m_ptr_glUniform3ui){this->m_orig_glUniform3ui = this->m_ptr_glUniform3ui;this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&ValidationTableDecorator::m_glUniform3ui_validation;}
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT){this->m_orig_glGetNamedProgramLocalParameterdvEXT = this->m_ptr_glGetNamedProgramLocalParameterdvEXT;this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&ValidationTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_validation;}
+if(this->m_ptr_glDeleteQueryResourceTagNV){this->m_orig_glDeleteQueryResourceTagNV = this->m_ptr_glDeleteQueryResourceTagNV;this->m_ptr_glDeleteQueryResourceTagNV = (FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC)&ValidationTableDecorator::m_glDeleteQueryResourceTagNV_validation;}
+if(this->m_ptr_glVertexAttribI4uiv){this->m_orig_glVertexAttribI4uiv = this->m_ptr_glVertexAttribI4uiv;this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&ValidationTableDecorator::m_glVertexAttribI4uiv_validation;}
+if(this->m_ptr_glVertexAttrib4bv){this->m_orig_glVertexAttrib4bv = this->m_ptr_glVertexAttrib4bv;this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&ValidationTableDecorator::m_glVertexAttrib4bv_validation;}
+if(this->m_ptr_glMultiTexCoord3xOES){this->m_orig_glMultiTexCoord3xOES = this->m_ptr_glMultiTexCoord3xOES;this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&ValidationTableDecorator::m_glMultiTexCoord3xOES_validation;}
+if(this->m_ptr_glSecondaryColor3ub){this->m_orig_glSecondaryColor3ub = this->m_ptr_glSecondaryColor3ub;this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&ValidationTableDecorator::m_glSecondaryColor3ub_validation;}
+if(this->m_ptr_glFragmentMaterialfSGIX){this->m_orig_glFragmentMaterialfSGIX = this->m_ptr_glFragmentMaterialfSGIX;this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&ValidationTableDecorator::m_glFragmentMaterialfSGIX_validation;}
+if(this->m_ptr_glGetVariantArrayObjectivATI){this->m_orig_glGetVariantArrayObjectivATI = this->m_ptr_glGetVariantArrayObjectivATI;this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&ValidationTableDecorator::m_glGetVariantArrayObjectivATI_validation;}
+if(this->m_ptr_glSecondaryColor3ui){this->m_orig_glSecondaryColor3ui = this->m_ptr_glSecondaryColor3ui;this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&ValidationTableDecorator::m_glSecondaryColor3ui_validation;}
+if(this->m_ptr_glVertexAttrib1dARB){this->m_orig_glVertexAttrib1dARB = this->m_ptr_glVertexAttrib1dARB;this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&ValidationTableDecorator::m_glVertexAttrib1dARB_validation;}
+if(this->m_ptr_glGetNamedBufferPointerv){this->m_orig_glGetNamedBufferPointerv = this->m_ptr_glGetNamedBufferPointerv;this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&ValidationTableDecorator::m_glGetNamedBufferPointerv_validation;}
+if(this->m_ptr_glLockArraysEXT){this->m_orig_glLockArraysEXT = this->m_ptr_glLockArraysEXT;this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&ValidationTableDecorator::m_glLockArraysEXT_validation;}
+if(this->m_ptr_glVertexAttribPointerNV){this->m_orig_glVertexAttribPointerNV = this->m_ptr_glVertexAttribPointerNV;this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&ValidationTableDecorator::m_glVertexAttribPointerNV_validation;}
+if(this->m_ptr_glConvolutionParameterf){this->m_orig_glConvolutionParameterf = this->m_ptr_glConvolutionParameterf;this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&ValidationTableDecorator::m_glConvolutionParameterf_validation;}
+if(this->m_ptr_glBindBufferBaseEXT){this->m_orig_glBindBufferBaseEXT = this->m_ptr_glBindBufferBaseEXT;this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&ValidationTableDecorator::m_glBindBufferBaseEXT_validation;}
+if(this->m_ptr_glTexCoord2xvOES){this->m_orig_glTexCoord2xvOES = this->m_ptr_glTexCoord2xvOES;this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&ValidationTableDecorator::m_glTexCoord2xvOES_validation;}
+if(this->m_ptr_glGetQueryBufferObjectui64v){this->m_orig_glGetQueryBufferObjectui64v = this->m_ptr_glGetQueryBufferObjectui64v;this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&ValidationTableDecorator::m_glGetQueryBufferObjectui64v_validation;}
+if(this->m_ptr_glSetMultisamplefvAMD){this->m_orig_glSetMultisamplefvAMD = this->m_ptr_glSetMultisamplefvAMD;this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&ValidationTableDecorator::m_glSetMultisamplefvAMD_validation;}
+if(this->m_ptr_glPathColorGenNV){this->m_orig_glPathColorGenNV = this->m_ptr_glPathColorGenNV;this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&ValidationTableDecorator::m_glPathColorGenNV_validation;}
+if(this->m_ptr_glVertexAttrib3sARB){this->m_orig_glVertexAttrib3sARB = this->m_ptr_glVertexAttrib3sARB;this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&ValidationTableDecorator::m_glVertexAttrib3sARB_validation;}
+if(this->m_ptr_glVertexAttrib4ivARB){this->m_orig_glVertexAttrib4ivARB = this->m_ptr_glVertexAttrib4ivARB;this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&ValidationTableDecorator::m_glVertexAttrib4ivARB_validation;}
+if(this->m_ptr_glGenTransformFeedbacks){this->m_orig_glGenTransformFeedbacks = this->m_ptr_glGenTransformFeedbacks;this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&ValidationTableDecorator::m_glGenTransformFeedbacks_validation;}
+if(this->m_ptr_glGetVertexAttribIuiv){this->m_orig_glGetVertexAttribIuiv = this->m_ptr_glGetVertexAttribIuiv;this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&ValidationTableDecorator::m_glGetVertexAttribIuiv_validation;}
+if(this->m_ptr_glPixelTransformParameterfEXT){this->m_orig_glPixelTransformParameterfEXT = this->m_ptr_glPixelTransformParameterfEXT;this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&ValidationTableDecorator::m_glPixelTransformParameterfEXT_validation;}
+if(this->m_ptr_glGetTexParameterIuivEXT){this->m_orig_glGetTexParameterIuivEXT = this->m_ptr_glGetTexParameterIuivEXT;this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&ValidationTableDecorator::m_glGetTexParameterIuivEXT_validation;}
+if(this->m_ptr_glGetObjectParameterivARB){this->m_orig_glGetObjectParameterivARB = this->m_ptr_glGetObjectParameterivARB;this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&ValidationTableDecorator::m_glGetObjectParameterivARB_validation;}
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT){this->m_orig_glVertexArraySecondaryColorOffsetEXT = this->m_ptr_glVertexArraySecondaryColorOffsetEXT;this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&ValidationTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_validation;}
+if(this->m_ptr_glWindowPos2fARB){this->m_orig_glWindowPos2fARB = this->m_ptr_glWindowPos2fARB;this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&ValidationTableDecorator::m_glWindowPos2fARB_validation;}
+if(this->m_ptr_glCompressedTexSubImage2D){this->m_orig_glCompressedTexSubImage2D = this->m_ptr_glCompressedTexSubImage2D;this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&ValidationTableDecorator::m_glCompressedTexSubImage2D_validation;}
+if(this->m_ptr_glCompressedTexSubImage3DARB){this->m_orig_glCompressedTexSubImage3DARB = this->m_ptr_glCompressedTexSubImage3DARB;this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&ValidationTableDecorator::m_glCompressedTexSubImage3DARB_validation;}
+if(this->m_ptr_glProgramBinary){this->m_orig_glProgramBinary = this->m_ptr_glProgramBinary;this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&ValidationTableDecorator::m_glProgramBinary_validation;}
+if(this->m_ptr_glPresentFrameKeyedNV){this->m_orig_glPresentFrameKeyedNV = this->m_ptr_glPresentFrameKeyedNV;this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&ValidationTableDecorator::m_glPresentFrameKeyedNV_validation;}
+if(this->m_ptr_glVertexAttribI4bv){this->m_orig_glVertexAttribI4bv = this->m_ptr_glVertexAttribI4bv;this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&ValidationTableDecorator::m_glVertexAttribI4bv_validation;}
+if(this->m_ptr_glPathCoverDepthFuncNV){this->m_orig_glPathCoverDepthFuncNV = this->m_ptr_glPathCoverDepthFuncNV;this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&ValidationTableDecorator::m_glPathCoverDepthFuncNV_validation;}
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV){this->m_orig_glTransformFeedbackStreamAttribsNV = this->m_ptr_glTransformFeedbackStreamAttribsNV;this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&ValidationTableDecorator::m_glTransformFeedbackStreamAttribsNV_validation;}
+if(this->m_ptr_glSecondaryColor3usEXT){this->m_orig_glSecondaryColor3usEXT = this->m_ptr_glSecondaryColor3usEXT;this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3usEXT_validation;}
+if(this->m_ptr_glCopyColorTableSGI){this->m_orig_glCopyColorTableSGI = this->m_ptr_glCopyColorTableSGI;this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&ValidationTableDecorator::m_glCopyColorTableSGI_validation;}
+if(this->m_ptr_glProgramEnvParameter4fvARB){this->m_orig_glProgramEnvParameter4fvARB = this->m_ptr_glProgramEnvParameter4fvARB;this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&ValidationTableDecorator::m_glProgramEnvParameter4fvARB_validation;}
+if(this->m_ptr_glMultiTexCoord4sARB){this->m_orig_glMultiTexCoord4sARB = this->m_ptr_glMultiTexCoord4sARB;this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&ValidationTableDecorator::m_glMultiTexCoord4sARB_validation;}
+if(this->m_ptr_glGetVertexArrayIndexed64iv){this->m_orig_glGetVertexArrayIndexed64iv = this->m_ptr_glGetVertexArrayIndexed64iv;this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&ValidationTableDecorator::m_glGetVertexArrayIndexed64iv_validation;}
+if(this->m_ptr_glMatrixMultTranspose3x3fNV){this->m_orig_glMatrixMultTranspose3x3fNV = this->m_ptr_glMatrixMultTranspose3x3fNV;this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&ValidationTableDecorator::m_glMatrixMultTranspose3x3fNV_validation;}
+if(this->m_ptr_glTexParameterIiv){this->m_orig_glTexParameterIiv = this->m_ptr_glTexParameterIiv;this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&ValidationTableDecorator::m_glTexParameterIiv_validation;}
+if(this->m_ptr_glVertexArrayAttribFormat){this->m_orig_glVertexArrayAttribFormat = this->m_ptr_glVertexArrayAttribFormat;this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&ValidationTableDecorator::m_glVertexArrayAttribFormat_validation;}
+if(this->m_ptr_glEndTransformFeedback){this->m_orig_glEndTransformFeedback = this->m_ptr_glEndTransformFeedback;this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&ValidationTableDecorator::m_glEndTransformFeedback_validation;}
+if(this->m_ptr_glDrawCommandsStatesAddressNV){this->m_orig_glDrawCommandsStatesAddressNV = this->m_ptr_glDrawCommandsStatesAddressNV;this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&ValidationTableDecorator::m_glDrawCommandsStatesAddressNV_validation;}
+if(this->m_ptr_glUniform4ui64NV){this->m_orig_glUniform4ui64NV = this->m_ptr_glUniform4ui64NV;this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&ValidationTableDecorator::m_glUniform4ui64NV_validation;}
+if(this->m_ptr_glMaterialiv){this->m_orig_glMaterialiv = this->m_ptr_glMaterialiv;this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&ValidationTableDecorator::m_glMaterialiv_validation;}
+if(this->m_ptr_glTexImage2DMultisample){this->m_orig_glTexImage2DMultisample = this->m_ptr_glTexImage2DMultisample;this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&ValidationTableDecorator::m_glTexImage2DMultisample_validation;}
+if(this->m_ptr_glBindTextureEXT){this->m_orig_glBindTextureEXT = this->m_ptr_glBindTextureEXT;this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&ValidationTableDecorator::m_glBindTextureEXT_validation;}
+if(this->m_ptr_glIsBuffer){this->m_orig_glIsBuffer = this->m_ptr_glIsBuffer;this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&ValidationTableDecorator::m_glIsBuffer_validation;}
+if(this->m_ptr_glVertexAttribI1iv){this->m_orig_glVertexAttribI1iv = this->m_ptr_glVertexAttribI1iv;this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&ValidationTableDecorator::m_glVertexAttribI1iv_validation;}
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV){this->m_orig_glGetFinalCombinerInputParameterfvNV = this->m_ptr_glGetFinalCombinerInputParameterfvNV;this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&ValidationTableDecorator::m_glGetFinalCombinerInputParameterfvNV_validation;}
+if(this->m_ptr_glMultiTexCoord3bvOES){this->m_orig_glMultiTexCoord3bvOES = this->m_ptr_glMultiTexCoord3bvOES;this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&ValidationTableDecorator::m_glMultiTexCoord3bvOES_validation;}
+if(this->m_ptr_glVertexAttribDivisor){this->m_orig_glVertexAttribDivisor = this->m_ptr_glVertexAttribDivisor;this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&ValidationTableDecorator::m_glVertexAttribDivisor_validation;}
+if(this->m_ptr_glCopyBufferSubData){this->m_orig_glCopyBufferSubData = this->m_ptr_glCopyBufferSubData;this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&ValidationTableDecorator::m_glCopyBufferSubData_validation;}
+if(this->m_ptr_glBindTexGenParameterEXT){this->m_orig_glBindTexGenParameterEXT = this->m_ptr_glBindTexGenParameterEXT;this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&ValidationTableDecorator::m_glBindTexGenParameterEXT_validation;}
+if(this->m_ptr_glNormalStream3bATI){this->m_orig_glNormalStream3bATI = this->m_ptr_glNormalStream3bATI;this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&ValidationTableDecorator::m_glNormalStream3bATI_validation;}
+if(this->m_ptr_glTexStorageMem2DEXT){this->m_orig_glTexStorageMem2DEXT = this->m_ptr_glTexStorageMem2DEXT;this->m_ptr_glTexStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC)&ValidationTableDecorator::m_glTexStorageMem2DEXT_validation;}
+if(this->m_ptr_glTextureImage2DEXT){this->m_orig_glTextureImage2DEXT = this->m_ptr_glTextureImage2DEXT;this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&ValidationTableDecorator::m_glTextureImage2DEXT_validation;}
+if(this->m_ptr_glGetColorTableParameteriv){this->m_orig_glGetColorTableParameteriv = this->m_ptr_glGetColorTableParameteriv;this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&ValidationTableDecorator::m_glGetColorTableParameteriv_validation;}
+if(this->m_ptr_glActiveTextureARB){this->m_orig_glActiveTextureARB = this->m_ptr_glActiveTextureARB;this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&ValidationTableDecorator::m_glActiveTextureARB_validation;}
+if(this->m_ptr_glTexCoord4xOES){this->m_orig_glTexCoord4xOES = this->m_ptr_glTexCoord4xOES;this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&ValidationTableDecorator::m_glTexCoord4xOES_validation;}
+if(this->m_ptr_glNamedBufferStorageExternalEXT){this->m_orig_glNamedBufferStorageExternalEXT = this->m_ptr_glNamedBufferStorageExternalEXT;this->m_ptr_glNamedBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)&ValidationTableDecorator::m_glNamedBufferStorageExternalEXT_validation;}
+if(this->m_ptr_glSecondaryColor3fvEXT){this->m_orig_glSecondaryColor3fvEXT = this->m_ptr_glSecondaryColor3fvEXT;this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&ValidationTableDecorator::m_glSecondaryColor3fvEXT_validation;}
+if(this->m_ptr_glUniformMatrix4x2fv){this->m_orig_glUniformMatrix4x2fv = this->m_ptr_glUniformMatrix4x2fv;this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&ValidationTableDecorator::m_glUniformMatrix4x2fv_validation;}
+if(this->m_ptr_glStartInstrumentsSGIX){this->m_orig_glStartInstrumentsSGIX = this->m_ptr_glStartInstrumentsSGIX;this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&ValidationTableDecorator::m_glStartInstrumentsSGIX_validation;}
+if(this->m_ptr_glProgramNamedParameter4fvNV){this->m_orig_glProgramNamedParameter4fvNV = this->m_ptr_glProgramNamedParameter4fvNV;this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&ValidationTableDecorator::m_glProgramNamedParameter4fvNV_validation;}
+if(this->m_ptr_glEndVideoCaptureNV){this->m_orig_glEndVideoCaptureNV = this->m_ptr_glEndVideoCaptureNV;this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&ValidationTableDecorator::m_glEndVideoCaptureNV_validation;}
+if(this->m_ptr_glGenLists){this->m_orig_glGenLists = this->m_ptr_glGenLists;this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&ValidationTableDecorator::m_glGenLists_validation;}
+if(this->m_ptr_glUniform1fARB){this->m_orig_glUniform1fARB = this->m_ptr_glUniform1fARB;this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&ValidationTableDecorator::m_glUniform1fARB_validation;}
+if(this->m_ptr_glNamedFramebufferTexture1DEXT){this->m_orig_glNamedFramebufferTexture1DEXT = this->m_ptr_glNamedFramebufferTexture1DEXT;this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&ValidationTableDecorator::m_glNamedFramebufferTexture1DEXT_validation;}
+if(this->m_ptr_glMapBufferRange){this->m_orig_glMapBufferRange = this->m_ptr_glMapBufferRange;this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&ValidationTableDecorator::m_glMapBufferRange_validation;}
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB){this->m_orig_glMultiDrawElementsIndirectCountARB = this->m_ptr_glMultiDrawElementsIndirectCountARB;this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&ValidationTableDecorator::m_glMultiDrawElementsIndirectCountARB_validation;}
+if(this->m_ptr_glProgramUniformMatrix4x2fv){this->m_orig_glProgramUniformMatrix4x2fv = this->m_ptr_glProgramUniformMatrix4x2fv;this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&ValidationTableDecorator::m_glProgramUniformMatrix4x2fv_validation;}
+if(this->m_ptr_glGetTextureParameterIivEXT){this->m_orig_glGetTextureParameterIivEXT = this->m_ptr_glGetTextureParameterIivEXT;this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glGetTextureParameterIivEXT_validation;}
+if(this->m_ptr_glMultiTexCoord3hNV){this->m_orig_glMultiTexCoord3hNV = this->m_ptr_glMultiTexCoord3hNV;this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&ValidationTableDecorator::m_glMultiTexCoord3hNV_validation;}
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT){this->m_orig_glNamedProgramLocalParametersI4uivEXT = this->m_ptr_glNamedProgramLocalParametersI4uivEXT;this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_validation;}
+if(this->m_ptr_glEndList){this->m_orig_glEndList = this->m_ptr_glEndList;this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&ValidationTableDecorator::m_glEndList_validation;}
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN){this->m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN;this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ValidationTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_validation;}
+if(this->m_ptr_glGenTransformFeedbacksNV){this->m_orig_glGenTransformFeedbacksNV = this->m_ptr_glGenTransformFeedbacksNV;this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&ValidationTableDecorator::m_glGenTransformFeedbacksNV_validation;}
+if(this->m_ptr_glEdgeFlagv){this->m_orig_glEdgeFlagv = this->m_ptr_glEdgeFlagv;this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&ValidationTableDecorator::m_glEdgeFlagv_validation;}
+if(this->m_ptr_glVertexAttribI2iv){this->m_orig_glVertexAttribI2iv = this->m_ptr_glVertexAttribI2iv;this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&ValidationTableDecorator::m_glVertexAttribI2iv_validation;}
+if(this->m_ptr_glCopyMultiTexImage2DEXT){this->m_orig_glCopyMultiTexImage2DEXT = this->m_ptr_glCopyMultiTexImage2DEXT;this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCopyMultiTexImage2DEXT_validation;}
+if(this->m_ptr_glUniformMatrix3x2dv){this->m_orig_glUniformMatrix3x2dv = this->m_ptr_glUniformMatrix3x2dv;this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&ValidationTableDecorator::m_glUniformMatrix3x2dv_validation;}
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV){this->m_orig_glTexImage3DMultisampleCoverageNV = this->m_ptr_glTexImage3DMultisampleCoverageNV;this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&ValidationTableDecorator::m_glTexImage3DMultisampleCoverageNV_validation;}
+if(this->m_ptr_glGetShaderPrecisionFormat){this->m_orig_glGetShaderPrecisionFormat = this->m_ptr_glGetShaderPrecisionFormat;this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&ValidationTableDecorator::m_glGetShaderPrecisionFormat_validation;}
+if(this->m_ptr_glTexSubImage4DSGIS){this->m_orig_glTexSubImage4DSGIS = this->m_ptr_glTexSubImage4DSGIS;this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&ValidationTableDecorator::m_glTexSubImage4DSGIS_validation;}
+if(this->m_ptr_glRasterSamplesEXT){this->m_orig_glRasterSamplesEXT = this->m_ptr_glRasterSamplesEXT;this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&ValidationTableDecorator::m_glRasterSamplesEXT_validation;}
+if(this->m_ptr_glTextureView){this->m_orig_glTextureView = this->m_ptr_glTextureView;this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&ValidationTableDecorator::m_glTextureView_validation;}
+if(this->m_ptr_glEvalMapsNV){this->m_orig_glEvalMapsNV = this->m_ptr_glEvalMapsNV;this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&ValidationTableDecorator::m_glEvalMapsNV_validation;}
+if(this->m_ptr_glGetFragDataLocationEXT){this->m_orig_glGetFragDataLocationEXT = this->m_ptr_glGetFragDataLocationEXT;this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&ValidationTableDecorator::m_glGetFragDataLocationEXT_validation;}
+if(this->m_ptr_glGetCompressedMultiTexImageEXT){this->m_orig_glGetCompressedMultiTexImageEXT = this->m_ptr_glGetCompressedMultiTexImageEXT;this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&ValidationTableDecorator::m_glGetCompressedMultiTexImageEXT_validation;}
+if(this->m_ptr_glIndexMask){this->m_orig_glIndexMask = this->m_ptr_glIndexMask;this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&ValidationTableDecorator::m_glIndexMask_validation;}
+if(this->m_ptr_glPushClientAttrib){this->m_orig_glPushClientAttrib = this->m_ptr_glPushClientAttrib;this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&ValidationTableDecorator::m_glPushClientAttrib_validation;}
+if(this->m_ptr_glShaderSource){this->m_orig_glShaderSource = this->m_ptr_glShaderSource;this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&ValidationTableDecorator::m_glShaderSource_validation;}
+if(this->m_ptr_glDispatchComputeGroupSizeARB){this->m_orig_glDispatchComputeGroupSizeARB = this->m_ptr_glDispatchComputeGroupSizeARB;this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&ValidationTableDecorator::m_glDispatchComputeGroupSizeARB_validation;}
+if(this->m_ptr_glLGPUNamedBufferSubDataNVX){this->m_orig_glLGPUNamedBufferSubDataNVX = this->m_ptr_glLGPUNamedBufferSubDataNVX;this->m_ptr_glLGPUNamedBufferSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)&ValidationTableDecorator::m_glLGPUNamedBufferSubDataNVX_validation;}
+if(this->m_ptr_glGetnPixelMapfv){this->m_orig_glGetnPixelMapfv = this->m_ptr_glGetnPixelMapfv;this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&ValidationTableDecorator::m_glGetnPixelMapfv_validation;}
+if(this->m_ptr_glTexCoordP2uiv){this->m_orig_glTexCoordP2uiv = this->m_ptr_glTexCoordP2uiv;this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&ValidationTableDecorator::m_glTexCoordP2uiv_validation;}
+if(this->m_ptr_glUniform2f){this->m_orig_glUniform2f = this->m_ptr_glUniform2f;this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&ValidationTableDecorator::m_glUniform2f_validation;}
+if(this->m_ptr_glGetNamedBufferParameteri64v){this->m_orig_glGetNamedBufferParameteri64v = this->m_ptr_glGetNamedBufferParameteri64v;this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&ValidationTableDecorator::m_glGetNamedBufferParameteri64v_validation;}
+if(this->m_ptr_glCommandListSegmentsNV){this->m_orig_glCommandListSegmentsNV = this->m_ptr_glCommandListSegmentsNV;this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&ValidationTableDecorator::m_glCommandListSegmentsNV_validation;}
+if(this->m_ptr_glTextureParameterIivEXT){this->m_orig_glTextureParameterIivEXT = this->m_ptr_glTextureParameterIivEXT;this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&ValidationTableDecorator::m_glTextureParameterIivEXT_validation;}
+if(this->m_ptr_glMultiTexParameterfvEXT){this->m_orig_glMultiTexParameterfvEXT = this->m_ptr_glMultiTexParameterfvEXT;this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glMultiTexParameterfvEXT_validation;}
+if(this->m_ptr_glProgramUniform2ui64ARB){this->m_orig_glProgramUniform2ui64ARB = this->m_ptr_glProgramUniform2ui64ARB;this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&ValidationTableDecorator::m_glProgramUniform2ui64ARB_validation;}
+if(this->m_ptr_glVertex4d){this->m_orig_glVertex4d = this->m_ptr_glVertex4d;this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&ValidationTableDecorator::m_glVertex4d_validation;}
+if(this->m_ptr_glNewObjectBufferATI){this->m_orig_glNewObjectBufferATI = this->m_ptr_glNewObjectBufferATI;this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&ValidationTableDecorator::m_glNewObjectBufferATI_validation;}
+if(this->m_ptr_glViewportSwizzleNV){this->m_orig_glViewportSwizzleNV = this->m_ptr_glViewportSwizzleNV;this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&ValidationTableDecorator::m_glViewportSwizzleNV_validation;}
+if(this->m_ptr_glBufferData){this->m_orig_glBufferData = this->m_ptr_glBufferData;this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&ValidationTableDecorator::m_glBufferData_validation;}
+if(this->m_ptr_glTextureImage1DEXT){this->m_orig_glTextureImage1DEXT = this->m_ptr_glTextureImage1DEXT;this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&ValidationTableDecorator::m_glTextureImage1DEXT_validation;}
+if(this->m_ptr_glGetTexParameterIiv){this->m_orig_glGetTexParameterIiv = this->m_ptr_glGetTexParameterIiv;this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&ValidationTableDecorator::m_glGetTexParameterIiv_validation;}
+if(this->m_ptr_glCopyTexSubImage1DEXT){this->m_orig_glCopyTexSubImage1DEXT = this->m_ptr_glCopyTexSubImage1DEXT;this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&ValidationTableDecorator::m_glCopyTexSubImage1DEXT_validation;}
+if(this->m_ptr_glVertex4f){this->m_orig_glVertex4f = this->m_ptr_glVertex4f;this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&ValidationTableDecorator::m_glVertex4f_validation;}
+if(this->m_ptr_glUniformMatrix3fvARB){this->m_orig_glUniformMatrix3fvARB = this->m_ptr_glUniformMatrix3fvARB;this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&ValidationTableDecorator::m_glUniformMatrix3fvARB_validation;}
+if(this->m_ptr_glTexCoordP1ui){this->m_orig_glTexCoordP1ui = this->m_ptr_glTexCoordP1ui;this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&ValidationTableDecorator::m_glTexCoordP1ui_validation;}
+if(this->m_ptr_glPointParameterfvEXT){this->m_orig_glPointParameterfvEXT = this->m_ptr_glPointParameterfvEXT;this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&ValidationTableDecorator::m_glPointParameterfvEXT_validation;}
+if(this->m_ptr_glUniform4fARB){this->m_orig_glUniform4fARB = this->m_ptr_glUniform4fARB;this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&ValidationTableDecorator::m_glUniform4fARB_validation;}
+if(this->m_ptr_glImportMemoryFdEXT){this->m_orig_glImportMemoryFdEXT = this->m_ptr_glImportMemoryFdEXT;this->m_ptr_glImportMemoryFdEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC)&ValidationTableDecorator::m_glImportMemoryFdEXT_validation;}
+if(this->m_ptr_glCopyTextureSubImage3D){this->m_orig_glCopyTextureSubImage3D = this->m_ptr_glCopyTextureSubImage3D;this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&ValidationTableDecorator::m_glCopyTextureSubImage3D_validation;}
+if(this->m_ptr_glMultiTexCoord2fv){this->m_orig_glMultiTexCoord2fv = this->m_ptr_glMultiTexCoord2fv;this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&ValidationTableDecorator::m_glMultiTexCoord2fv_validation;}
+if(this->m_ptr_glNamedFramebufferSamplePositionsfvAMD){this->m_orig_glNamedFramebufferSamplePositionsfvAMD = this->m_ptr_glNamedFramebufferSamplePositionsfvAMD;this->m_ptr_glNamedFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&ValidationTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_validation;}
+if(this->m_ptr_glNormalP3ui){this->m_orig_glNormalP3ui = this->m_ptr_glNormalP3ui;this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&ValidationTableDecorator::m_glNormalP3ui_validation;}
+if(this->m_ptr_glDrawRangeElementArrayATI){this->m_orig_glDrawRangeElementArrayATI = this->m_ptr_glDrawRangeElementArrayATI;this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&ValidationTableDecorator::m_glDrawRangeElementArrayATI_validation;}
+if(this->m_ptr_glVertexAttribI1i){this->m_orig_glVertexAttribI1i = this->m_ptr_glVertexAttribI1i;this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&ValidationTableDecorator::m_glVertexAttribI1i_validation;}
+if(this->m_ptr_glDrawArraysInstancedARB){this->m_orig_glDrawArraysInstancedARB = this->m_ptr_glDrawArraysInstancedARB;this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&ValidationTableDecorator::m_glDrawArraysInstancedARB_validation;}
+if(this->m_ptr_glEnableVertexAttribAPPLE){this->m_orig_glEnableVertexAttribAPPLE = this->m_ptr_glEnableVertexAttribAPPLE;this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&ValidationTableDecorator::m_glEnableVertexAttribAPPLE_validation;}
+if(this->m_ptr_glGetDebugMessageLogARB){this->m_orig_glGetDebugMessageLogARB = this->m_ptr_glGetDebugMessageLogARB;this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&ValidationTableDecorator::m_glGetDebugMessageLogARB_validation;}
+if(this->m_ptr_glGetPathTexGenfvNV){this->m_orig_glGetPathTexGenfvNV = this->m_ptr_glGetPathTexGenfvNV;this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&ValidationTableDecorator::m_glGetPathTexGenfvNV_validation;}
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT){this->m_orig_glNamedProgramLocalParameters4fvEXT = this->m_ptr_glNamedProgramLocalParameters4fvEXT;this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&ValidationTableDecorator::m_glNamedProgramLocalParameters4fvEXT_validation;}
+if(this->m_ptr_glQueryResourceTagNV){this->m_orig_glQueryResourceTagNV = this->m_ptr_glQueryResourceTagNV;this->m_ptr_glQueryResourceTagNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC)&ValidationTableDecorator::m_glQueryResourceTagNV_validation;}
+if(this->m_ptr_glVertexStream3fvATI){this->m_orig_glVertexStream3fvATI = this->m_ptr_glVertexStream3fvATI;this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&ValidationTableDecorator::m_glVertexStream3fvATI_validation;}
+if(this->m_ptr_glFramebufferTexture3D){this->m_orig_glFramebufferTexture3D = this->m_ptr_glFramebufferTexture3D;this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&ValidationTableDecorator::m_glFramebufferTexture3D_validation;}
+if(this->m_ptr_glCompressedTextureSubImage2DEXT){this->m_orig_glCompressedTextureSubImage2DEXT = this->m_ptr_glCompressedTextureSubImage2DEXT;this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&ValidationTableDecorator::m_glCompressedTextureSubImage2DEXT_validation;}
+if(this->m_ptr_glWindowPos3dv){this->m_orig_glWindowPos3dv = this->m_ptr_glWindowPos3dv;this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&ValidationTableDecorator::m_glWindowPos3dv_validation;}
+if(this->m_ptr_glCopyConvolutionFilter2D){this->m_orig_glCopyConvolutionFilter2D = this->m_ptr_glCopyConvolutionFilter2D;this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&ValidationTableDecorator::m_glCopyConvolutionFilter2D_validation;}
+if(this->m_ptr_glReadInstrumentsSGIX){this->m_orig_glReadInstrumentsSGIX = this->m_ptr_glReadInstrumentsSGIX;this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&ValidationTableDecorator::m_glReadInstrumentsSGIX_validation;}
+if(this->m_ptr_glProgramUniform2dvEXT){this->m_orig_glProgramUniform2dvEXT = this->m_ptr_glProgramUniform2dvEXT;this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&ValidationTableDecorator::m_glProgramUniform2dvEXT_validation;}
+if(this->m_ptr_glSamplerParameterfv){this->m_orig_glSamplerParameterfv = this->m_ptr_glSamplerParameterfv;this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&ValidationTableDecorator::m_glSamplerParameterfv_validation;}
+if(this->m_ptr_glBindBufferARB){this->m_orig_glBindBufferARB = this->m_ptr_glBindBufferARB;this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&ValidationTableDecorator::m_glBindBufferARB_validation;}
+if(this->m_ptr_glVertexAttrib1sNV){this->m_orig_glVertexAttrib1sNV = this->m_ptr_glVertexAttrib1sNV;this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&ValidationTableDecorator::m_glVertexAttrib1sNV_validation;}
+if(this->m_ptr_glGetMaterialiv){this->m_orig_glGetMaterialiv = this->m_ptr_glGetMaterialiv;this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&ValidationTableDecorator::m_glGetMaterialiv_validation;}
+if(this->m_ptr_glUniform1fv){this->m_orig_glUniform1fv = this->m_ptr_glUniform1fv;this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&ValidationTableDecorator::m_glUniform1fv_validation;}
+if(this->m_ptr_glBeginOcclusionQueryNV){this->m_orig_glBeginOcclusionQueryNV = this->m_ptr_glBeginOcclusionQueryNV;this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&ValidationTableDecorator::m_glBeginOcclusionQueryNV_validation;}
+if(this->m_ptr_glGenFencesAPPLE){this->m_orig_glGenFencesAPPLE = this->m_ptr_glGenFencesAPPLE;this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&ValidationTableDecorator::m_glGenFencesAPPLE_validation;}
+if(this->m_ptr_glScissorIndexedv){this->m_orig_glScissorIndexedv = this->m_ptr_glScissorIndexedv;this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&ValidationTableDecorator::m_glScissorIndexedv_validation;}
+if(this->m_ptr_glDisableVariantClientStateEXT){this->m_orig_glDisableVariantClientStateEXT = this->m_ptr_glDisableVariantClientStateEXT;this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&ValidationTableDecorator::m_glDisableVariantClientStateEXT_validation;}
+if(this->m_ptr_glMinmaxEXT){this->m_orig_glMinmaxEXT = this->m_ptr_glMinmaxEXT;this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&ValidationTableDecorator::m_glMinmaxEXT_validation;}
+if(this->m_ptr_glNormalPointervINTEL){this->m_orig_glNormalPointervINTEL = this->m_ptr_glNormalPointervINTEL;this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&ValidationTableDecorator::m_glNormalPointervINTEL_validation;}
+if(this->m_ptr_glNormal3s){this->m_orig_glNormal3s = this->m_ptr_glNormal3s;this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&ValidationTableDecorator::m_glNormal3s_validation;}
+if(this->m_ptr_glGetnPixelMapuiv){this->m_orig_glGetnPixelMapuiv = this->m_ptr_glGetnPixelMapuiv;this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&ValidationTableDecorator::m_glGetnPixelMapuiv_validation;}
+if(this->m_ptr_glNormalStream3bvATI){this->m_orig_glNormalStream3bvATI = this->m_ptr_glNormalStream3bvATI;this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&ValidationTableDecorator::m_glNormalStream3bvATI_validation;}
+if(this->m_ptr_glGetObjectParameterivAPPLE){this->m_orig_glGetObjectParameterivAPPLE = this->m_ptr_glGetObjectParameterivAPPLE;this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&ValidationTableDecorator::m_glGetObjectParameterivAPPLE_validation;}
+if(this->m_ptr_glNormal3i){this->m_orig_glNormal3i = this->m_ptr_glNormal3i;this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&ValidationTableDecorator::m_glNormal3i_validation;}
+if(this->m_ptr_glUniform1ivARB){this->m_orig_glUniform1ivARB = this->m_ptr_glUniform1ivARB;this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&ValidationTableDecorator::m_glUniform1ivARB_validation;}
+if(this->m_ptr_glNormal3d){this->m_orig_glNormal3d = this->m_ptr_glNormal3d;this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&ValidationTableDecorator::m_glNormal3d_validation;}
+if(this->m_ptr_glUpdateObjectBufferATI){this->m_orig_glUpdateObjectBufferATI = this->m_ptr_glUpdateObjectBufferATI;this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&ValidationTableDecorator::m_glUpdateObjectBufferATI_validation;}
+if(this->m_ptr_glNormal3b){this->m_orig_glNormal3b = this->m_ptr_glNormal3b;this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&ValidationTableDecorator::m_glNormal3b_validation;}
+if(this->m_ptr_glGetUniformBufferSizeEXT){this->m_orig_glGetUniformBufferSizeEXT = this->m_ptr_glGetUniformBufferSizeEXT;this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&ValidationTableDecorator::m_glGetUniformBufferSizeEXT_validation;}
+if(this->m_ptr_glMultiTexCoord4dv){this->m_orig_glMultiTexCoord4dv = this->m_ptr_glMultiTexCoord4dv;this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&ValidationTableDecorator::m_glMultiTexCoord4dv_validation;}
+if(this->m_ptr_glProgramUniform3i64ARB){this->m_orig_glProgramUniform3i64ARB = this->m_ptr_glProgramUniform3i64ARB;this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&ValidationTableDecorator::m_glProgramUniform3i64ARB_validation;}
+if(this->m_ptr_glVertexAttrib2d){this->m_orig_glVertexAttrib2d = this->m_ptr_glVertexAttrib2d;this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&ValidationTableDecorator::m_glVertexAttrib2d_validation;}
+if(this->m_ptr_glVertexAttrib2f){this->m_orig_glVertexAttrib2f = this->m_ptr_glVertexAttrib2f;this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&ValidationTableDecorator::m_glVertexAttrib2f_validation;}
+if(this->m_ptr_glMultiDrawElementsEXT){this->m_orig_glMultiDrawElementsEXT = this->m_ptr_glMultiDrawElementsEXT;this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&ValidationTableDecorator::m_glMultiDrawElementsEXT_validation;}
+if(this->m_ptr_glVertexAttrib3dv){this->m_orig_glVertexAttrib3dv = this->m_ptr_glVertexAttrib3dv;this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&ValidationTableDecorator::m_glVertexAttrib3dv_validation;}
+if(this->m_ptr_glMultiTexCoord2bOES){this->m_orig_glMultiTexCoord2bOES = this->m_ptr_glMultiTexCoord2bOES;this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&ValidationTableDecorator::m_glMultiTexCoord2bOES_validation;}
+if(this->m_ptr_glVertexAttrib2s){this->m_orig_glVertexAttrib2s = this->m_ptr_glVertexAttrib2s;this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&ValidationTableDecorator::m_glVertexAttrib2s_validation;}
+if(this->m_ptr_glTexImage3DMultisample){this->m_orig_glTexImage3DMultisample = this->m_ptr_glTexImage3DMultisample;this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&ValidationTableDecorator::m_glTexImage3DMultisample_validation;}
+if(this->m_ptr_glGetUniformBlockIndex){this->m_orig_glGetUniformBlockIndex = this->m_ptr_glGetUniformBlockIndex;this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&ValidationTableDecorator::m_glGetUniformBlockIndex_validation;}
+if(this->m_ptr_glReleaseKeyedMutexWin32EXT){this->m_orig_glReleaseKeyedMutexWin32EXT = this->m_ptr_glReleaseKeyedMutexWin32EXT;this->m_ptr_glReleaseKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)&ValidationTableDecorator::m_glReleaseKeyedMutexWin32EXT_validation;}
+if(this->m_ptr_glFrontFace){this->m_orig_glFrontFace = this->m_ptr_glFrontFace;this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&ValidationTableDecorator::m_glFrontFace_validation;}
+if(this->m_ptr_glEvalCoord1xOES){this->m_orig_glEvalCoord1xOES = this->m_ptr_glEvalCoord1xOES;this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&ValidationTableDecorator::m_glEvalCoord1xOES_validation;}
+if(this->m_ptr_glDrawArraysInstancedBaseInstance){this->m_orig_glDrawArraysInstancedBaseInstance = this->m_ptr_glDrawArraysInstancedBaseInstance;this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&ValidationTableDecorator::m_glDrawArraysInstancedBaseInstance_validation;}
+if(this->m_ptr_glIsPointInStrokePathNV){this->m_orig_glIsPointInStrokePathNV = this->m_ptr_glIsPointInStrokePathNV;this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&ValidationTableDecorator::m_glIsPointInStrokePathNV_validation;}
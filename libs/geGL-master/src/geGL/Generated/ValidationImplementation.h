@@ -0,0 +1,5850 @@
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC m_orig_glMultiDrawArraysIndirectBindlessCountNV = nullptr;
+void m_glMultiDrawArraysIndirectBindlessCountNV_validation(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{(this->*(this->m_orig_glMultiDrawArraysIndirectBindlessCountNV))(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);this->m_checkErrors("glMultiDrawArraysIndirectBindlessCountNV");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC m_orig_glTextureParameterfv = nullptr;
+void m_glTextureParameterfv_validation(GLuint texture,GLenum pname,const GLfloat* param)const{(this->*(this->m_orig_glTextureParameterfv))(texture,pname,param);this->m_checkErrors("glTextureParameterfv");}
+FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC m_orig_glGetListParameterivSGIX = nullptr;
+void m_glGetListParameterivSGIX_validation(GLuint list,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetListParameterivSGIX))(list,pname,params);this->m_checkErrors("glGetListParameterivSGIX");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC m_orig_glProgramUniform1i64ARB = nullptr;
+void m_glProgramUniform1i64ARB_validation(GLuint program,GLint location,GLint64 x)const{(this->*(this->m_orig_glProgramUniform1i64ARB))(program,location,x);this->m_checkErrors("glProgramUniform1i64ARB");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC m_orig_glVertexArrayElementBuffer = nullptr;
+void m_glVertexArrayElementBuffer_validation(GLuint vaobj,GLuint buffer)const{(this->*(this->m_orig_glVertexArrayElementBuffer))(vaobj,buffer);this->m_checkErrors("glVertexArrayElementBuffer");}
+FunctionTable::MEMBERPFNGLHINTPGIPROC m_orig_glHintPGI = nullptr;
+void m_glHintPGI_validation(GLenum target,GLint mode)const{(this->*(this->m_orig_glHintPGI))(target,mode);this->m_checkErrors("glHintPGI");}
+FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC m_orig_glStencilMaskSeparate = nullptr;
+void m_glStencilMaskSeparate_validation(GLenum face,GLuint mask)const{(this->*(this->m_orig_glStencilMaskSeparate))(face,mask);this->m_checkErrors("glStencilMaskSeparate");}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC m_orig_glGetFramebufferAttachmentParameterivEXT = nullptr;
+void m_glGetFramebufferAttachmentParameterivEXT_validation(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFramebufferAttachmentParameterivEXT))(target,attachment,pname,params);this->m_checkErrors("glGetFramebufferAttachmentParameterivEXT");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC m_orig_glTextureStorage3DMultisample = nullptr;
+void m_glTextureStorage3DMultisample_validation(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTextureStorage3DMultisample))(texture,samples,internalformat,width,height,depth,fixedsamplelocations);this->m_checkErrors("glTextureStorage3DMultisample");}
+FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC m_orig_glGetIntegerIndexedvEXT = nullptr;
+void m_glGetIntegerIndexedvEXT_validation(GLenum target,GLuint index,GLint* data)const{(this->*(this->m_orig_glGetIntegerIndexedvEXT))(target,index,data);this->m_checkErrors("glGetIntegerIndexedvEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC m_orig_glCopyTexImage1D = nullptr;
+void m_glCopyTexImage1D_validation(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{(this->*(this->m_orig_glCopyTexImage1D))(target,level,internalformat,x,y,width,border);this->m_checkErrors("glCopyTexImage1D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC m_orig_glVertexAttrib4usv = nullptr;
+void m_glVertexAttrib4usv_validation(GLuint index,const GLushort* v)const{(this->*(this->m_orig_glVertexAttrib4usv))(index,v);this->m_checkErrors("glVertexAttrib4usv");}
+FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC m_orig_glTexRenderbufferNV = nullptr;
+void m_glTexRenderbufferNV_validation(GLenum target,GLuint renderbuffer)const{(this->*(this->m_orig_glTexRenderbufferNV))(target,renderbuffer);this->m_checkErrors("glTexRenderbufferNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC m_orig_glVertexAttrib3hvNV = nullptr;
+void m_glVertexAttrib3hvNV_validation(GLuint index,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttrib3hvNV))(index,v);this->m_checkErrors("glVertexAttrib3hvNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC m_orig_glProgramUniform4ui64ARB = nullptr;
+void m_glProgramUniform4ui64ARB_validation(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{(this->*(this->m_orig_glProgramUniform4ui64ARB))(program,location,x,y,z,w);this->m_checkErrors("glProgramUniform4ui64ARB");}
+FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC m_orig_glInstrumentsBufferSGIX = nullptr;
+void m_glInstrumentsBufferSGIX_validation(GLsizei size,GLint* buffer)const{(this->*(this->m_orig_glInstrumentsBufferSGIX))(size,buffer);this->m_checkErrors("glInstrumentsBufferSGIX");}
+FunctionTable::MEMBERPFNGLINDEXIPROC m_orig_glIndexi = nullptr;
+void m_glIndexi_validation(GLint c)const{(this->*(this->m_orig_glIndexi))(c);this->m_checkErrors("glIndexi");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC m_orig_glMultiTexCoord2sARB = nullptr;
+void m_glMultiTexCoord2sARB_validation(GLenum target,GLshort s,GLshort t)const{(this->*(this->m_orig_glMultiTexCoord2sARB))(target,s,t);this->m_checkErrors("glMultiTexCoord2sARB");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC m_orig_glProgramEnvParameter4fARB = nullptr;
+void m_glProgramEnvParameter4fARB_validation(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glProgramEnvParameter4fARB))(target,index,x,y,z,w);this->m_checkErrors("glProgramEnvParameter4fARB");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC m_orig_glCompressedTexSubImage3D = nullptr;
+void m_glCompressedTexSubImage3D_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const GLvoid* data)const{(this->*(this->m_orig_glCompressedTexSubImage3D))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);this->m_checkErrors("glCompressedTexSubImage3D");}
+FunctionTable::MEMBERPFNGLEVALCOORD2DPROC m_orig_glEvalCoord2d = nullptr;
+void m_glEvalCoord2d_validation(GLdouble u,GLdouble v)const{(this->*(this->m_orig_glEvalCoord2d))(u,v);this->m_checkErrors("glEvalCoord2d");}
+FunctionTable::MEMBERPFNGLEVALCOORD2FPROC m_orig_glEvalCoord2f = nullptr;
+void m_glEvalCoord2f_validation(GLfloat u,GLfloat v)const{(this->*(this->m_orig_glEvalCoord2f))(u,v);this->m_checkErrors("glEvalCoord2f");}
+FunctionTable::MEMBERPFNGLINDEXDPROC m_orig_glIndexd = nullptr;
+void m_glIndexd_validation(GLdouble c)const{(this->*(this->m_orig_glIndexd))(c);this->m_checkErrors("glIndexd");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC m_orig_glSecondaryColor3hvNV = nullptr;
+void m_glSecondaryColor3hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glSecondaryColor3hvNV))(v);this->m_checkErrors("glSecondaryColor3hvNV");}
+FunctionTable::MEMBERPFNGLINDEXFPROC m_orig_glIndexf = nullptr;
+void m_glIndexf_validation(GLfloat c)const{(this->*(this->m_orig_glIndexf))(c);this->m_checkErrors("glIndexf");}
+FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC m_orig_glFrustumxOES = nullptr;
+void m_glFrustumxOES_validation(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{(this->*(this->m_orig_glFrustumxOES))(l,r,b,t,n,f);this->m_checkErrors("glFrustumxOES");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC m_orig_glTextureStorage3DEXT = nullptr;
+void m_glTextureStorage3DEXT_validation(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{(this->*(this->m_orig_glTextureStorage3DEXT))(texture,target,levels,internalformat,width,height,depth);this->m_checkErrors("glTextureStorage3DEXT");}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC m_orig_glDrawCommandsStatesNV = nullptr;
+void m_glDrawCommandsStatesNV_validation(GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{(this->*(this->m_orig_glDrawCommandsStatesNV))(buffer,indirects,sizes,states,fbos,count);this->m_checkErrors("glDrawCommandsStatesNV");}
+FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC m_orig_glUniform4uiEXT = nullptr;
+void m_glUniform4uiEXT_validation(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{(this->*(this->m_orig_glUniform4uiEXT))(location,v0,v1,v2,v3);this->m_checkErrors("glUniform4uiEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC m_orig_glProgramUniform3ui64ARB = nullptr;
+void m_glProgramUniform3ui64ARB_validation(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{(this->*(this->m_orig_glProgramUniform3ui64ARB))(program,location,x,y,z);this->m_checkErrors("glProgramUniform3ui64ARB");}
+FunctionTable::MEMBERPFNGLINDEXSPROC m_orig_glIndexs = nullptr;
+void m_glIndexs_validation(GLshort c)const{(this->*(this->m_orig_glIndexs))(c);this->m_checkErrors("glIndexs");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC m_orig_glVertexArrayBindVertexBufferEXT = nullptr;
+void m_glVertexArrayBindVertexBufferEXT_validation(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{(this->*(this->m_orig_glVertexArrayBindVertexBufferEXT))(vaobj,bindingindex,buffer,offset,stride);this->m_checkErrors("glVertexArrayBindVertexBufferEXT");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC m_orig_glConvolutionParameteriEXT = nullptr;
+void m_glConvolutionParameteriEXT_validation(GLenum target,GLenum pname,GLint params)const{(this->*(this->m_orig_glConvolutionParameteriEXT))(target,pname,params);this->m_checkErrors("glConvolutionParameteriEXT");}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC m_orig_glColor4ubVertex2fSUN = nullptr;
+void m_glColor4ubVertex2fSUN_validation(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y)const{(this->*(this->m_orig_glColor4ubVertex2fSUN))(r,g,b,a,x,y);this->m_checkErrors("glColor4ubVertex2fSUN");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC m_orig_glProgramUniform1ivEXT = nullptr;
+void m_glProgramUniform1ivEXT_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform1ivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform1ivEXT");}
+FunctionTable::MEMBERPFNGLGETNMAPFVPROC m_orig_glGetnMapfv = nullptr;
+void m_glGetnMapfv_validation(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{(this->*(this->m_orig_glGetnMapfv))(target,query,bufSize,v);this->m_checkErrors("glGetnMapfv");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC m_orig_glTransformFeedbackBufferRange = nullptr;
+void m_glTransformFeedbackBufferRange_validation(GLuint xfb,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glTransformFeedbackBufferRange))(xfb,index,buffer,offset,size);this->m_checkErrors("glTransformFeedbackBufferRange");}
+FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC m_orig_glPathGlyphsNV = nullptr;
+void m_glPathGlyphsNV_validation(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLsizei numGlyphs,GLenum type,const void* charcodes,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{(this->*(this->m_orig_glPathGlyphsNV))(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);this->m_checkErrors("glPathGlyphsNV");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC m_orig_glSecondaryColor3fv = nullptr;
+void m_glSecondaryColor3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glSecondaryColor3fv))(v);this->m_checkErrors("glSecondaryColor3fv");}
+FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC m_orig_glGetCombinerInputParameterivNV = nullptr;
+void m_glGetCombinerInputParameterivNV_validation(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetCombinerInputParameterivNV))(stage,portion,variable,pname,params);this->m_checkErrors("glGetCombinerInputParameterivNV");}
+FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC m_orig_glEndPerfMonitorAMD = nullptr;
+void m_glEndPerfMonitorAMD_validation(GLuint monitor)const{(this->*(this->m_orig_glEndPerfMonitorAMD))(monitor);this->m_checkErrors("glEndPerfMonitorAMD");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC m_orig_glPointParameterfvARB = nullptr;
+void m_glPointParameterfvARB_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glPointParameterfvARB))(pname,params);this->m_checkErrors("glPointParameterfvARB");}
+FunctionTable::MEMBERPFNGLVERTEX2XOESPROC m_orig_glVertex2xOES = nullptr;
+void m_glVertex2xOES_validation(GLfixed x)const{(this->*(this->m_orig_glVertex2xOES))(x);this->m_checkErrors("glVertex2xOES");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC m_orig_glDrawElementsInstancedBaseInstance = nullptr;
+void m_glDrawElementsInstancedBaseInstance_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLuint baseinstance)const{(this->*(this->m_orig_glDrawElementsInstancedBaseInstance))(mode,count,type,indices,instancecount,baseinstance);this->m_checkErrors("glDrawElementsInstancedBaseInstance");}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC m_orig_glMultTransposeMatrixdARB = nullptr;
+void m_glMultTransposeMatrixdARB_validation(const GLdouble* m)const{(this->*(this->m_orig_glMultTransposeMatrixdARB))(m);this->m_checkErrors("glMultTransposeMatrixdARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC m_orig_glVertexAttribL4dEXT = nullptr;
+void m_glVertexAttribL4dEXT_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertexAttribL4dEXT))(index,x,y,z,w);this->m_checkErrors("glVertexAttribL4dEXT");}
+FunctionTable::MEMBERPFNGLVERTEX4IVPROC m_orig_glVertex4iv = nullptr;
+void m_glVertex4iv_validation(const GLint* v)const{(this->*(this->m_orig_glVertex4iv))(v);this->m_checkErrors("glVertex4iv");}
+FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC m_orig_glCoverStrokePathInstancedNV = nullptr;
+void m_glCoverStrokePathInstancedNV_validation(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glCoverStrokePathInstancedNV))(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);this->m_checkErrors("glCoverStrokePathInstancedNV");}
+FunctionTable::MEMBERPFNGLDEFORMSGIXPROC m_orig_glDeformSGIX = nullptr;
+void m_glDeformSGIX_validation(GLbitfield mask)const{(this->*(this->m_orig_glDeformSGIX))(mask);this->m_checkErrors("glDeformSGIX");}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC m_orig_glUniform2ui64NV = nullptr;
+void m_glUniform2ui64NV_validation(GLint location,GLuint64EXT x,GLuint64EXT y)const{(this->*(this->m_orig_glUniform2ui64NV))(location,x,y);this->m_checkErrors("glUniform2ui64NV");}
+FunctionTable::MEMBERPFNGLCOPYPATHNVPROC m_orig_glCopyPathNV = nullptr;
+void m_glCopyPathNV_validation(GLuint resultPath,GLuint srcPath)const{(this->*(this->m_orig_glCopyPathNV))(resultPath,srcPath);this->m_checkErrors("glCopyPathNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC m_orig_glVertexAttribP4ui = nullptr;
+void m_glVertexAttribP4ui_validation(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{(this->*(this->m_orig_glVertexAttribP4ui))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP4ui");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC m_orig_glVertexAttribL2d = nullptr;
+void m_glVertexAttribL2d_validation(GLuint index,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertexAttribL2d))(index,x,y);this->m_checkErrors("glVertexAttribL2d");}
+FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC m_orig_glGetMultisamplefv = nullptr;
+void m_glGetMultisamplefv_validation(GLenum pname,GLuint index,GLfloat* val)const{(this->*(this->m_orig_glGetMultisamplefv))(pname,index,val);this->m_checkErrors("glGetMultisamplefv");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC m_orig_glCompressedMultiTexSubImage3DEXT = nullptr;
+void m_glCompressedMultiTexSubImage3DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedMultiTexSubImage3DEXT))(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);this->m_checkErrors("glCompressedMultiTexSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC m_orig_glVDPAURegisterOutputSurfaceNV = nullptr;
+GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_validation(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{GLvdpauSurfaceNV const result = (this->*(this->m_orig_glVDPAURegisterOutputSurfaceNV))(vdpSurface,target,numTextureNames,textureNames);this->m_checkErrors("glVDPAURegisterOutputSurfaceNV");return result;}
+FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC m_orig_glMinSampleShading = nullptr;
+void m_glMinSampleShading_validation(GLfloat value)const{(this->*(this->m_orig_glMinSampleShading))(value);this->m_checkErrors("glMinSampleShading");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC m_orig_glProgramUniform4fEXT = nullptr;
+void m_glProgramUniform4fEXT_validation(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{(this->*(this->m_orig_glProgramUniform4fEXT))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4fEXT");}
+FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC m_orig_glCoverStrokePathNV = nullptr;
+void m_glCoverStrokePathNV_validation(GLuint path,GLenum coverMode)const{(this->*(this->m_orig_glCoverStrokePathNV))(path,coverMode);this->m_checkErrors("glCoverStrokePathNV");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC m_orig_glTextureImage2DMultisampleNV = nullptr;
+void m_glTextureImage2DMultisampleNV_validation(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{(this->*(this->m_orig_glTextureImage2DMultisampleNV))(texture,target,samples,internalFormat,width,height,fixedSampleLocations);this->m_checkErrors("glTextureImage2DMultisampleNV");}
+FunctionTable::MEMBERPFNGLVERTEX3BOESPROC m_orig_glVertex3bOES = nullptr;
+void m_glVertex3bOES_validation(GLbyte x,GLbyte y,GLbyte z)const{(this->*(this->m_orig_glVertex3bOES))(x,y,z);this->m_checkErrors("glVertex3bOES");}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC m_orig_glImportMemoryWin32HandleEXT = nullptr;
+void m_glImportMemoryWin32HandleEXT_validation(GLuint memory,GLuint64 size,GLenum handleType,void* handle)const{(this->*(this->m_orig_glImportMemoryWin32HandleEXT))(memory,size,handleType,handle);this->m_checkErrors("glImportMemoryWin32HandleEXT");}
+FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC m_orig_glTessellationFactorAMD = nullptr;
+void m_glTessellationFactorAMD_validation(GLfloat factor)const{(this->*(this->m_orig_glTessellationFactorAMD))(factor);this->m_checkErrors("glTessellationFactorAMD");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC m_orig_glDebugMessageControl = nullptr;
+void m_glDebugMessageControl_validation(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{(this->*(this->m_orig_glDebugMessageControl))(source,type,severity,count,ids,enabled);this->m_checkErrors("glDebugMessageControl");}
+FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC m_orig_glIsObjectBufferATI = nullptr;
+GLboolean m_glIsObjectBufferATI_validation(GLuint buffer)const{GLboolean const result = (this->*(this->m_orig_glIsObjectBufferATI))(buffer);this->m_checkErrors("glIsObjectBufferATI");return result;}
+FunctionTable::MEMBERPFNGLPOPATTRIBPROC m_orig_glPopAttrib = nullptr;
+void m_glPopAttrib_validation()const{(this->*(this->m_orig_glPopAttrib))();this->m_checkErrors("glPopAttrib");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC m_orig_glProgramUniform4iEXT = nullptr;
+void m_glProgramUniform4iEXT_validation(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{(this->*(this->m_orig_glProgramUniform4iEXT))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4iEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC m_orig_glVertexAttrib4ubNV = nullptr;
+void m_glVertexAttrib4ubNV_validation(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{(this->*(this->m_orig_glVertexAttrib4ubNV))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4ubNV");}
+FunctionTable::MEMBERPFNGLCOLORMATERIALPROC m_orig_glColorMaterial = nullptr;
+void m_glColorMaterial_validation(GLenum face,GLenum mode)const{(this->*(this->m_orig_glColorMaterial))(face,mode);this->m_checkErrors("glColorMaterial");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC m_orig_glVertexAttrib2svARB = nullptr;
+void m_glVertexAttrib2svARB_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib2svARB))(index,v);this->m_checkErrors("glVertexAttrib2svARB");}
+FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC m_orig_glMinSampleShadingARB = nullptr;
+void m_glMinSampleShadingARB_validation(GLfloat value)const{(this->*(this->m_orig_glMinSampleShadingARB))(value);this->m_checkErrors("glMinSampleShadingARB");}
+FunctionTable::MEMBERPFNGLCOLOR3BPROC m_orig_glColor3b = nullptr;
+void m_glColor3b_validation(GLbyte red,GLbyte green,GLbyte blue)const{(this->*(this->m_orig_glColor3b))(red,green,blue);this->m_checkErrors("glColor3b");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_validation(GLuint rc,GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN))(rc,s,t,nx,ny,nz,x,y,z);this->m_checkErrors("glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLCOLOR3FPROC m_orig_glColor3f = nullptr;
+void m_glColor3f_validation(GLfloat red,GLfloat green,GLfloat blue)const{(this->*(this->m_orig_glColor3f))(red,green,blue);this->m_checkErrors("glColor3f");}
+FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC m_orig_glVDPAUGetSurfaceivNV = nullptr;
+void m_glVDPAUGetSurfaceivNV_validation(GLvdpauSurfaceNV surface,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{(this->*(this->m_orig_glVDPAUGetSurfaceivNV))(surface,pname,bufSize,length,values);this->m_checkErrors("glVDPAUGetSurfaceivNV");}
+FunctionTable::MEMBERPFNGLCOLOR3DPROC m_orig_glColor3d = nullptr;
+void m_glColor3d_validation(GLdouble red,GLdouble green,GLdouble blue)const{(this->*(this->m_orig_glColor3d))(red,green,blue);this->m_checkErrors("glColor3d");}
+FunctionTable::MEMBERPFNGLGETNMAPIVPROC m_orig_glGetnMapiv = nullptr;
+void m_glGetnMapiv_validation(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{(this->*(this->m_orig_glGetnMapiv))(target,query,bufSize,v);this->m_checkErrors("glGetnMapiv");}
+FunctionTable::MEMBERPFNGLCOLOR3IPROC m_orig_glColor3i = nullptr;
+void m_glColor3i_validation(GLint red,GLint green,GLint blue)const{(this->*(this->m_orig_glColor3i))(red,green,blue);this->m_checkErrors("glColor3i");}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC m_orig_glGetInternalformatSampleivNV = nullptr;
+void m_glGetInternalformatSampleivNV_validation(GLenum target,GLenum internalformat,GLsizei samples,GLenum pname,GLsizei bufSize,GLint* params)const{(this->*(this->m_orig_glGetInternalformatSampleivNV))(target,internalformat,samples,pname,bufSize,params);this->m_checkErrors("glGetInternalformatSampleivNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC m_orig_glVertexAttrib4ubv = nullptr;
+void m_glVertexAttrib4ubv_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttrib4ubv))(index,v);this->m_checkErrors("glVertexAttrib4ubv");}
+FunctionTable::MEMBERPFNGLCOLOR3SPROC m_orig_glColor3s = nullptr;
+void m_glColor3s_validation(GLshort red,GLshort green,GLshort blue)const{(this->*(this->m_orig_glColor3s))(red,green,blue);this->m_checkErrors("glColor3s");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC m_orig_glVertexAttribs4hvNV = nullptr;
+void m_glVertexAttribs4hvNV_validation(GLuint index,GLsizei n,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttribs4hvNV))(index,n,v);this->m_checkErrors("glVertexAttribs4hvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC m_orig_glVertexAttrib4NubvARB = nullptr;
+void m_glVertexAttrib4NubvARB_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttrib4NubvARB))(index,v);this->m_checkErrors("glVertexAttrib4NubvARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC m_orig_glMultiTexCoord3hvNV = nullptr;
+void m_glMultiTexCoord3hvNV_validation(GLenum target,const GLhalfNV* v)const{(this->*(this->m_orig_glMultiTexCoord3hvNV))(target,v);this->m_checkErrors("glMultiTexCoord3hvNV");}
+FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC m_orig_glMatrixPushEXT = nullptr;
+void m_glMatrixPushEXT_validation(GLenum mode)const{(this->*(this->m_orig_glMatrixPushEXT))(mode);this->m_checkErrors("glMatrixPushEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC m_orig_glProgramUniform2fEXT = nullptr;
+void m_glProgramUniform2fEXT_validation(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{(this->*(this->m_orig_glProgramUniform2fEXT))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2fEXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC m_orig_glGetVertexArrayIndexediv = nullptr;
+void m_glGetVertexArrayIndexediv_validation(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetVertexArrayIndexediv))(vaobj,index,pname,param);this->m_checkErrors("glGetVertexArrayIndexediv");}
+FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC m_orig_glBlitFramebuffer = nullptr;
+void m_glBlitFramebuffer_validation(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{(this->*(this->m_orig_glBlitFramebuffer))(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->m_checkErrors("glBlitFramebuffer");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC m_orig_glMultiTexCoordP2ui = nullptr;
+void m_glMultiTexCoordP2ui_validation(GLenum texture,GLenum type,GLuint coords)const{(this->*(this->m_orig_glMultiTexCoordP2ui))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP2ui");}
+FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC m_orig_glColorPointerListIBM = nullptr;
+void m_glColorPointerListIBM_validation(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glColorPointerListIBM))(size,type,stride,pointer,ptrstride);this->m_checkErrors("glColorPointerListIBM");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC m_orig_glVertexAttribL4d = nullptr;
+void m_glVertexAttribL4d_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertexAttribL4d))(index,x,y,z,w);this->m_checkErrors("glVertexAttribL4d");}
+FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC m_orig_glGetFragmentMaterialfvSGIX = nullptr;
+void m_glGetFragmentMaterialfvSGIX_validation(GLenum face,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetFragmentMaterialfvSGIX))(face,pname,params);this->m_checkErrors("glGetFragmentMaterialfvSGIX");}
+FunctionTable::MEMBERPFNGLVERTEX2IVPROC m_orig_glVertex2iv = nullptr;
+void m_glVertex2iv_validation(const GLint* v)const{(this->*(this->m_orig_glVertex2iv))(v);this->m_checkErrors("glVertex2iv");}
+FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC m_orig_glGetTexEnvxvOES = nullptr;
+void m_glGetTexEnvxvOES_validation(GLenum target,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetTexEnvxvOES))(target,pname,params);this->m_checkErrors("glGetTexEnvxvOES");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC m_orig_glUniformMatrix3dv = nullptr;
+void m_glUniformMatrix3dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix3dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3dv");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC m_orig_glGetVertexAttribLdvEXT = nullptr;
+void m_glGetVertexAttribLdvEXT_validation(GLuint index,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetVertexAttribLdvEXT))(index,pname,params);this->m_checkErrors("glGetVertexAttribLdvEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC m_orig_glTexCoordP3uiv = nullptr;
+void m_glTexCoordP3uiv_validation(GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glTexCoordP3uiv))(type,coords);this->m_checkErrors("glTexCoordP3uiv");}
+FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC m_orig_glDeformationMap3dSGIX = nullptr;
+void m_glDeformationMap3dSGIX_validation(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,GLdouble w1,GLdouble w2,GLint wstride,GLint worder,const GLdouble* points)const{(this->*(this->m_orig_glDeformationMap3dSGIX))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);this->m_checkErrors("glDeformationMap3dSGIX");}
+FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC m_orig_glResumeTransformFeedback = nullptr;
+void m_glResumeTransformFeedback_validation()const{(this->*(this->m_orig_glResumeTransformFeedback))();this->m_checkErrors("glResumeTransformFeedback");}
+FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC m_orig_glInsertEventMarkerEXT = nullptr;
+void m_glInsertEventMarkerEXT_validation(GLsizei length,const GLchar* marker)const{(this->*(this->m_orig_glInsertEventMarkerEXT))(length,marker);this->m_checkErrors("glInsertEventMarkerEXT");}
+FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC m_orig_glTessellationModeAMD = nullptr;
+void m_glTessellationModeAMD_validation(GLenum mode)const{(this->*(this->m_orig_glTessellationModeAMD))(mode);this->m_checkErrors("glTessellationModeAMD");}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC m_orig_glDrawCommandsAddressNV = nullptr;
+void m_glDrawCommandsAddressNV_validation(GLenum primitiveMode,const GLuint64* indirects,const GLsizei* sizes,GLuint count)const{(this->*(this->m_orig_glDrawCommandsAddressNV))(primitiveMode,indirects,sizes,count);this->m_checkErrors("glDrawCommandsAddressNV");}
+FunctionTable::MEMBERPFNGLFOGIPROC m_orig_glFogi = nullptr;
+void m_glFogi_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glFogi))(pname,param);this->m_checkErrors("glFogi");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC m_orig_glGetTexParameterxvOES = nullptr;
+void m_glGetTexParameterxvOES_validation(GLenum target,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetTexParameterxvOES))(target,pname,params);this->m_checkErrors("glGetTexParameterxvOES");}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC m_orig_glVertexPointer = nullptr;
+void m_glVertexPointer_validation(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{(this->*(this->m_orig_glVertexPointer))(size,type,stride,ptr);this->m_checkErrors("glVertexPointer");}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC m_orig_glGetPerfMonitorCounterDataAMD = nullptr;
+void m_glGetPerfMonitorCounterDataAMD_validation(GLuint monitor,GLenum pname,GLsizei dataSize,GLuint* data,GLint* bytesWritten)const{(this->*(this->m_orig_glGetPerfMonitorCounterDataAMD))(monitor,pname,dataSize,data,bytesWritten);this->m_checkErrors("glGetPerfMonitorCounterDataAMD");}
+FunctionTable::MEMBERPFNGLFOGFPROC m_orig_glFogf = nullptr;
+void m_glFogf_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glFogf))(pname,param);this->m_checkErrors("glFogf");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC m_orig_glMultiTexCoord1d = nullptr;
+void m_glMultiTexCoord1d_validation(GLenum target,GLdouble s)const{(this->*(this->m_orig_glMultiTexCoord1d))(target,s);this->m_checkErrors("glMultiTexCoord1d");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC m_orig_glMultiTexCoord1f = nullptr;
+void m_glMultiTexCoord1f_validation(GLenum target,GLfloat s)const{(this->*(this->m_orig_glMultiTexCoord1f))(target,s);this->m_checkErrors("glMultiTexCoord1f");}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC m_orig_glGetMultiTexParameterivEXT = nullptr;
+void m_glGetMultiTexParameterivEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMultiTexParameterivEXT))(texunit,target,pname,params);this->m_checkErrors("glGetMultiTexParameterivEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC m_orig_glProgramUniformMatrix3x4fvEXT = nullptr;
+void m_glProgramUniformMatrix3x4fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x4fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x4fvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC m_orig_glVertexAttribI2i = nullptr;
+void m_glVertexAttribI2i_validation(GLuint index,GLint x,GLint y)const{(this->*(this->m_orig_glVertexAttribI2i))(index,x,y);this->m_checkErrors("glVertexAttribI2i");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC m_orig_glMultiTexCoord1i = nullptr;
+void m_glMultiTexCoord1i_validation(GLenum target,GLint s)const{(this->*(this->m_orig_glMultiTexCoord1i))(target,s);this->m_checkErrors("glMultiTexCoord1i");}
+FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC m_orig_glDeleteSemaphoresEXT = nullptr;
+void m_glDeleteSemaphoresEXT_validation(GLsizei n,const GLuint* semaphores)const{(this->*(this->m_orig_glDeleteSemaphoresEXT))(n,semaphores);this->m_checkErrors("glDeleteSemaphoresEXT");}
+FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC m_orig_glLoadProgramNV = nullptr;
+void m_glLoadProgramNV_validation(GLenum target,GLuint id,GLsizei len,const GLubyte* program)const{(this->*(this->m_orig_glLoadProgramNV))(target,id,len,program);this->m_checkErrors("glLoadProgramNV");}
+FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC m_orig_glWriteMaskEXT = nullptr;
+void m_glWriteMaskEXT_validation(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{(this->*(this->m_orig_glWriteMaskEXT))(res,in,outX,outY,outZ,outW);this->m_checkErrors("glWriteMaskEXT");}
+FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC m_orig_glGetGraphicsResetStatus = nullptr;
+GLenum m_glGetGraphicsResetStatus_validation()const{GLenum const result = (this->*(this->m_orig_glGetGraphicsResetStatus))();this->m_checkErrors("glGetGraphicsResetStatus");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC m_orig_glVertexAttrib1fv = nullptr;
+void m_glVertexAttrib1fv_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib1fv))(index,v);this->m_checkErrors("glVertexAttrib1fv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC m_orig_glMultiTexCoord1s = nullptr;
+void m_glMultiTexCoord1s_validation(GLenum target,GLshort s)const{(this->*(this->m_orig_glMultiTexCoord1s))(target,s);this->m_checkErrors("glMultiTexCoord1s");}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC m_orig_glImageTransformParameterfvHP = nullptr;
+void m_glImageTransformParameterfvHP_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glImageTransformParameterfvHP))(target,pname,params);this->m_checkErrors("glImageTransformParameterfvHP");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC m_orig_glFramebufferTexture2D = nullptr;
+void m_glFramebufferTexture2D_validation(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTexture2D))(target,attachment,textarget,texture,level);this->m_checkErrors("glFramebufferTexture2D");}
+FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC m_orig_glGetFragmentLightfvSGIX = nullptr;
+void m_glGetFragmentLightfvSGIX_validation(GLenum light,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetFragmentLightfvSGIX))(light,pname,params);this->m_checkErrors("glGetFragmentLightfvSGIX");}
+FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC m_orig_glListParameterfSGIX = nullptr;
+void m_glListParameterfSGIX_validation(GLuint list,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glListParameterfSGIX))(list,pname,param);this->m_checkErrors("glListParameterfSGIX");}
+FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC m_orig_glTexCoord3sv = nullptr;
+void m_glTexCoord3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glTexCoord3sv))(v);this->m_checkErrors("glTexCoord3sv");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC m_orig_glNamedFramebufferRenderbufferEXT = nullptr;
+void m_glNamedFramebufferRenderbufferEXT_validation(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{(this->*(this->m_orig_glNamedFramebufferRenderbufferEXT))(framebuffer,attachment,renderbuffertarget,renderbuffer);this->m_checkErrors("glNamedFramebufferRenderbufferEXT");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC m_orig_glFragmentLightModelfSGIX = nullptr;
+void m_glFragmentLightModelfSGIX_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glFragmentLightModelfSGIX))(pname,param);this->m_checkErrors("glFragmentLightModelfSGIX");}
+FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC m_orig_glIndexPointerEXT = nullptr;
+void m_glIndexPointerEXT_validation(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{(this->*(this->m_orig_glIndexPointerEXT))(type,stride,count,pointer);this->m_checkErrors("glIndexPointerEXT");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC m_orig_glBlendEquationSeparateATI = nullptr;
+void m_glBlendEquationSeparateATI_validation(GLenum modeRGB,GLenum modeA)const{(this->*(this->m_orig_glBlendEquationSeparateATI))(modeRGB,modeA);this->m_checkErrors("glBlendEquationSeparateATI");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC m_orig_glVertexArrayAttribIFormat = nullptr;
+void m_glVertexArrayAttribIFormat_validation(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexArrayAttribIFormat))(vaobj,attribindex,size,type,relativeoffset);this->m_checkErrors("glVertexArrayAttribIFormat");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_validation(GLuint rc,GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN))(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);this->m_checkErrors("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC m_orig_glReplacementCodeubvSUN = nullptr;
+void m_glReplacementCodeubvSUN_validation(const GLubyte* code)const{(this->*(this->m_orig_glReplacementCodeubvSUN))(code);this->m_checkErrors("glReplacementCodeubvSUN");}
+FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC m_orig_glGenFramebuffers = nullptr;
+void m_glGenFramebuffers_validation(GLsizei n,GLuint* framebuffers)const{(this->*(this->m_orig_glGenFramebuffers))(n,framebuffers);this->m_checkErrors("glGenFramebuffers");}
+FunctionTable::MEMBERPFNGLPIXELMAPXPROC m_orig_glPixelMapx = nullptr;
+void m_glPixelMapx_validation(GLenum map,GLint size,const GLfixed* values)const{(this->*(this->m_orig_glPixelMapx))(map,size,values);this->m_checkErrors("glPixelMapx");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC m_orig_glTexSubImage3DEXT = nullptr;
+void m_glTexSubImage3DEXT_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTexSubImage3DEXT))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->m_checkErrors("glTexSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC m_orig_glGetAttachedShaders = nullptr;
+void m_glGetAttachedShaders_validation(GLuint program,GLsizei maxCount,GLsizei* count,GLuint* shaders)const{(this->*(this->m_orig_glGetAttachedShaders))(program,maxCount,count,shaders);this->m_checkErrors("glGetAttachedShaders");}
+FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC m_orig_glGetPixelTexGenParameterfvSGIS = nullptr;
+void m_glGetPixelTexGenParameterfvSGIS_validation(GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetPixelTexGenParameterfvSGIS))(pname,params);this->m_checkErrors("glGetPixelTexGenParameterfvSGIS");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiNormal3fVertex3fSUN_validation(GLuint rc,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiNormal3fVertex3fSUN))(rc,nx,ny,nz,x,y,z);this->m_checkErrors("glReplacementCodeuiNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC m_orig_glGetDebugMessageLogAMD = nullptr;
+GLuint m_glGetDebugMessageLogAMD_validation(GLuint count,GLsizei bufsize,GLenum* categories,GLuint* severities,GLuint* ids,GLsizei* lengths,GLchar* message)const{GLuint const result = (this->*(this->m_orig_glGetDebugMessageLogAMD))(count,bufsize,categories,severities,ids,lengths,message);this->m_checkErrors("glGetDebugMessageLogAMD");return result;}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC m_orig_glVertexStream4sATI = nullptr;
+void m_glVertexStream4sATI_validation(GLenum stream,GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glVertexStream4sATI))(stream,x,y,z,w);this->m_checkErrors("glVertexStream4sATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC m_orig_glVertexAttribs4dvNV = nullptr;
+void m_glVertexAttribs4dvNV_validation(GLuint index,GLsizei count,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribs4dvNV))(index,count,v);this->m_checkErrors("glVertexAttribs4dvNV");}
+FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC m_orig_glGetnMapdvARB = nullptr;
+void m_glGetnMapdvARB_validation(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{(this->*(this->m_orig_glGetnMapdvARB))(target,query,bufSize,v);this->m_checkErrors("glGetnMapdvARB");}
+FunctionTable::MEMBERPFNGLORTHOFOESPROC m_orig_glOrthofOES = nullptr;
+void m_glOrthofOES_validation(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{(this->*(this->m_orig_glOrthofOES))(l,r,b,t,n,f);this->m_checkErrors("glOrthofOES");}
+FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC m_orig_glViewportArrayv = nullptr;
+void m_glViewportArrayv_validation(GLuint first,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glViewportArrayv))(first,count,v);this->m_checkErrors("glViewportArrayv");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC m_orig_glDrawElementArrayATI = nullptr;
+void m_glDrawElementArrayATI_validation(GLenum mode,GLsizei count)const{(this->*(this->m_orig_glDrawElementArrayATI))(mode,count);this->m_checkErrors("glDrawElementArrayATI");}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC m_orig_glBufferStorageMemEXT = nullptr;
+void m_glBufferStorageMemEXT_validation(GLenum target,GLsizeiptr size,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glBufferStorageMemEXT))(target,size,memory,offset);this->m_checkErrors("glBufferStorageMemEXT");}
+FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC m_orig_glGetPathColorGenfvNV = nullptr;
+void m_glGetPathColorGenfvNV_validation(GLenum color,GLenum pname,GLfloat* value)const{(this->*(this->m_orig_glGetPathColorGenfvNV))(color,pname,value);this->m_checkErrors("glGetPathColorGenfvNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC m_orig_glWindowPos3iMESA = nullptr;
+void m_glWindowPos3iMESA_validation(GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glWindowPos3iMESA))(x,y,z);this->m_checkErrors("glWindowPos3iMESA");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC m_orig_glMultiTexCoord2s = nullptr;
+void m_glMultiTexCoord2s_validation(GLenum target,GLshort s,GLshort t)const{(this->*(this->m_orig_glMultiTexCoord2s))(target,s,t);this->m_checkErrors("glMultiTexCoord2s");}
+FunctionTable::MEMBERPFNGLVERTEX3DVPROC m_orig_glVertex3dv = nullptr;
+void m_glVertex3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glVertex3dv))(v);this->m_checkErrors("glVertex3dv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC m_orig_glVertexAttribI3uivEXT = nullptr;
+void m_glVertexAttribI3uivEXT_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI3uivEXT))(index,v);this->m_checkErrors("glVertexAttribI3uivEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC m_orig_glUniform3ui64ARB = nullptr;
+void m_glUniform3ui64ARB_validation(GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{(this->*(this->m_orig_glUniform3ui64ARB))(location,x,y,z);this->m_checkErrors("glUniform3ui64ARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC m_orig_glVertexAttrib2fvNV = nullptr;
+void m_glVertexAttrib2fvNV_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib2fvNV))(index,v);this->m_checkErrors("glVertexAttrib2fvNV");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC m_orig_glGetNamedBufferSubDataEXT = nullptr;
+void m_glGetNamedBufferSubDataEXT_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{(this->*(this->m_orig_glGetNamedBufferSubDataEXT))(buffer,offset,size,data);this->m_checkErrors("glGetNamedBufferSubDataEXT");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC m_orig_glConvolutionFilter2D = nullptr;
+void m_glConvolutionFilter2D_validation(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* image)const{(this->*(this->m_orig_glConvolutionFilter2D))(target,internalformat,width,height,format,type,image);this->m_checkErrors("glConvolutionFilter2D");}
+FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC m_orig_glMemoryBarrierByRegion = nullptr;
+void m_glMemoryBarrierByRegion_validation(GLbitfield barriers)const{(this->*(this->m_orig_glMemoryBarrierByRegion))(barriers);this->m_checkErrors("glMemoryBarrierByRegion");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC m_orig_glVertexArrayBindingDivisor = nullptr;
+void m_glVertexArrayBindingDivisor_validation(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{(this->*(this->m_orig_glVertexArrayBindingDivisor))(vaobj,bindingindex,divisor);this->m_checkErrors("glVertexArrayBindingDivisor");}
+FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC m_orig_glMatrixRotatedEXT = nullptr;
+void m_glMatrixRotatedEXT_validation(GLenum mode,GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glMatrixRotatedEXT))(mode,angle,x,y,z);this->m_checkErrors("glMatrixRotatedEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC m_orig_glTexCoord2sv = nullptr;
+void m_glTexCoord2sv_validation(const GLshort* v)const{(this->*(this->m_orig_glTexCoord2sv))(v);this->m_checkErrors("glTexCoord2sv");}
+FunctionTable::MEMBERPFNGLISPROGRAMNVPROC m_orig_glIsProgramNV = nullptr;
+GLboolean m_glIsProgramNV_validation(GLuint id)const{GLboolean const result = (this->*(this->m_orig_glIsProgramNV))(id);this->m_checkErrors("glIsProgramNV");return result;}
+FunctionTable::MEMBERPFNGLUNIFORM2DVPROC m_orig_glUniform2dv = nullptr;
+void m_glUniform2dv_validation(GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glUniform2dv))(location,count,value);this->m_checkErrors("glUniform2dv");}
+FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC m_orig_glGetPixelMapuiv = nullptr;
+void m_glGetPixelMapuiv_validation(GLenum map,GLuint* values)const{(this->*(this->m_orig_glGetPixelMapuiv))(map,values);this->m_checkErrors("glGetPixelMapuiv");}
+FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC m_orig_glDepthBoundsEXT = nullptr;
+void m_glDepthBoundsEXT_validation(GLclampd zmin,GLclampd zmax)const{(this->*(this->m_orig_glDepthBoundsEXT))(zmin,zmax);this->m_checkErrors("glDepthBoundsEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC m_orig_glVertexAttrib4hvNV = nullptr;
+void m_glVertexAttrib4hvNV_validation(GLuint index,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttrib4hvNV))(index,v);this->m_checkErrors("glVertexAttrib4hvNV");}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC m_orig_glMultiTexParameteriEXT = nullptr;
+void m_glMultiTexParameteriEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glMultiTexParameteriEXT))(texunit,target,pname,param);this->m_checkErrors("glMultiTexParameteriEXT");}
+FunctionTable::MEMBERPFNGLGETPOINTERVPROC m_orig_glGetPointerv = nullptr;
+void m_glGetPointerv_validation(GLenum pname,GLvoid** params)const{(this->*(this->m_orig_glGetPointerv))(pname,params);this->m_checkErrors("glGetPointerv");}
+FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC m_orig_glPathCommandsNV = nullptr;
+void m_glPathCommandsNV_validation(GLuint path,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{(this->*(this->m_orig_glPathCommandsNV))(path,numCommands,commands,numCoords,coordType,coords);this->m_checkErrors("glPathCommandsNV");}
+FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC m_orig_glGetListParameterfvSGIX = nullptr;
+void m_glGetListParameterfvSGIX_validation(GLuint list,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetListParameterfvSGIX))(list,pname,params);this->m_checkErrors("glGetListParameterfvSGIX");}
+FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC m_orig_glGetUniformuiv = nullptr;
+void m_glGetUniformuiv_validation(GLuint program,GLint location,GLuint* params)const{(this->*(this->m_orig_glGetUniformuiv))(program,location,params);this->m_checkErrors("glGetUniformuiv");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC m_orig_glDebugMessageInsertAMD = nullptr;
+void m_glDebugMessageInsertAMD_validation(GLenum category,GLenum severity,GLuint id,GLsizei length,const GLchar* buf)const{(this->*(this->m_orig_glDebugMessageInsertAMD))(category,severity,id,length,buf);this->m_checkErrors("glDebugMessageInsertAMD");}
+FunctionTable::MEMBERPFNGLFRUSTUMPROC m_orig_glFrustum = nullptr;
+void m_glFrustum_validation(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{(this->*(this->m_orig_glFrustum))(left,right,bottom,top,near_val,far_val);this->m_checkErrors("glFrustum");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC m_orig_glVertexAttribL1ui64vNV = nullptr;
+void m_glVertexAttribL1ui64vNV_validation(GLuint index,const GLuint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL1ui64vNV))(index,v);this->m_checkErrors("glVertexAttribL1ui64vNV");}
+FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC m_orig_glClearColorxOES = nullptr;
+void m_glClearColorxOES_validation(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{(this->*(this->m_orig_glClearColorxOES))(red,green,blue,alpha);this->m_checkErrors("glClearColorxOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC m_orig_glProgramUniformMatrix3fv = nullptr;
+void m_glProgramUniformMatrix3fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix3fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3fv");}
+FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC m_orig_glSampleMaskIndexedNV = nullptr;
+void m_glSampleMaskIndexedNV_validation(GLuint index,GLbitfield mask)const{(this->*(this->m_orig_glSampleMaskIndexedNV))(index,mask);this->m_checkErrors("glSampleMaskIndexedNV");}
+FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC m_orig_glCompileShaderIncludeARB = nullptr;
+void m_glCompileShaderIncludeARB_validation(GLuint shader,GLsizei count,const GLchar*const* path,const GLint* length)const{(this->*(this->m_orig_glCompileShaderIncludeARB))(shader,count,path,length);this->m_checkErrors("glCompileShaderIncludeARB");}
+FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC m_orig_glGetArrayObjectfvATI = nullptr;
+void m_glGetArrayObjectfvATI_validation(GLenum array,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetArrayObjectfvATI))(array,pname,params);this->m_checkErrors("glGetArrayObjectfvATI");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC m_orig_glVertexStream4svATI = nullptr;
+void m_glVertexStream4svATI_validation(GLenum stream,const GLshort* coords)const{(this->*(this->m_orig_glVertexStream4svATI))(stream,coords);this->m_checkErrors("glVertexStream4svATI");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC m_orig_glMultiTexCoord4iARB = nullptr;
+void m_glMultiTexCoord4iARB_validation(GLenum target,GLint s,GLint t,GLint r,GLint q)const{(this->*(this->m_orig_glMultiTexCoord4iARB))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4iARB");}
+FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC m_orig_glVariantfvEXT = nullptr;
+void m_glVariantfvEXT_validation(GLuint id,const GLfloat* addr)const{(this->*(this->m_orig_glVariantfvEXT))(id,addr);this->m_checkErrors("glVariantfvEXT");}
+FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC m_orig_glMatrixLoadfEXT = nullptr;
+void m_glMatrixLoadfEXT_validation(GLenum mode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixLoadfEXT))(mode,m);this->m_checkErrors("glMatrixLoadfEXT");}
+FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC m_orig_glLoadIdentityDeformationMapSGIX = nullptr;
+void m_glLoadIdentityDeformationMapSGIX_validation(GLbitfield mask)const{(this->*(this->m_orig_glLoadIdentityDeformationMapSGIX))(mask);this->m_checkErrors("glLoadIdentityDeformationMapSGIX");}
+FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC m_orig_glGetRenderbufferParameteriv = nullptr;
+void m_glGetRenderbufferParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetRenderbufferParameteriv))(target,pname,params);this->m_checkErrors("glGetRenderbufferParameteriv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC m_orig_glProgramUniform3fEXT = nullptr;
+void m_glProgramUniform3fEXT_validation(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{(this->*(this->m_orig_glProgramUniform3fEXT))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3fEXT");}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC m_orig_glNamedRenderbufferStorage = nullptr;
+void m_glNamedRenderbufferStorage_validation(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glNamedRenderbufferStorage))(renderbuffer,internalformat,width,height);this->m_checkErrors("glNamedRenderbufferStorage");}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC m_orig_glBindFragDataLocation = nullptr;
+void m_glBindFragDataLocation_validation(GLuint program,GLuint color,const GLchar* name)const{(this->*(this->m_orig_glBindFragDataLocation))(program,color,name);this->m_checkErrors("glBindFragDataLocation");}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC m_orig_glPolygonOffsetClamp = nullptr;
+void m_glPolygonOffsetClamp_validation(GLfloat factor,GLfloat units,GLfloat clamp)const{(this->*(this->m_orig_glPolygonOffsetClamp))(factor,units,clamp);this->m_checkErrors("glPolygonOffsetClamp");}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC m_orig_glFogCoordPointerListIBM = nullptr;
+void m_glFogCoordPointerListIBM_validation(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glFogCoordPointerListIBM))(type,stride,pointer,ptrstride);this->m_checkErrors("glFogCoordPointerListIBM");}
+FunctionTable::MEMBERPFNGLFENCESYNCPROC m_orig_glFenceSync = nullptr;
+GLsync m_glFenceSync_validation(GLenum condition,GLbitfield flags)const{GLsync const result = (this->*(this->m_orig_glFenceSync))(condition,flags);this->m_checkErrors("glFenceSync");return result;}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC m_orig_glGetVertexAttribIivEXT = nullptr;
+void m_glGetVertexAttribIivEXT_validation(GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVertexAttribIivEXT))(index,pname,params);this->m_checkErrors("glGetVertexAttribIivEXT");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC m_orig_glFramebufferDrawBuffersEXT = nullptr;
+void m_glFramebufferDrawBuffersEXT_validation(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{(this->*(this->m_orig_glFramebufferDrawBuffersEXT))(framebuffer,n,bufs);this->m_checkErrors("glFramebufferDrawBuffersEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC m_orig_glVertexAttribs4fvNV = nullptr;
+void m_glVertexAttribs4fvNV_validation(GLuint index,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttribs4fvNV))(index,count,v);this->m_checkErrors("glVertexAttribs4fvNV");}
+FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC m_orig_glPauseTransformFeedbackNV = nullptr;
+void m_glPauseTransformFeedbackNV_validation()const{(this->*(this->m_orig_glPauseTransformFeedbackNV))();this->m_checkErrors("glPauseTransformFeedbackNV");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC m_orig_glGetQueryObjecti64vEXT = nullptr;
+void m_glGetQueryObjecti64vEXT_validation(GLuint id,GLenum pname,GLint64* params)const{(this->*(this->m_orig_glGetQueryObjecti64vEXT))(id,pname,params);this->m_checkErrors("glGetQueryObjecti64vEXT");}
+FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC m_orig_glVDPAUSurfaceAccessNV = nullptr;
+void m_glVDPAUSurfaceAccessNV_validation(GLvdpauSurfaceNV surface,GLenum access)const{(this->*(this->m_orig_glVDPAUSurfaceAccessNV))(surface,access);this->m_checkErrors("glVDPAUSurfaceAccessNV");}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC m_orig_glValidateProgramPipeline = nullptr;
+void m_glValidateProgramPipeline_validation(GLuint pipeline)const{(this->*(this->m_orig_glValidateProgramPipeline))(pipeline);this->m_checkErrors("glValidateProgramPipeline");}
+FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC m_orig_glTexPageCommitmentARB = nullptr;
+void m_glTexPageCommitmentARB_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{(this->*(this->m_orig_glTexPageCommitmentARB))(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);this->m_checkErrors("glTexPageCommitmentARB");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC m_orig_glWindowPos3dvARB = nullptr;
+void m_glWindowPos3dvARB_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos3dvARB))(v);this->m_checkErrors("glWindowPos3dvARB");}
+FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC m_orig_glStencilStrokePathInstancedNV = nullptr;
+void m_glStencilStrokePathInstancedNV_validation(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glStencilStrokePathInstancedNV))(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);this->m_checkErrors("glStencilStrokePathInstancedNV");}
+FunctionTable::MEMBERPFNGLFOGFVPROC m_orig_glFogfv = nullptr;
+void m_glFogfv_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glFogfv))(pname,params);this->m_checkErrors("glFogfv");}
+FunctionTable::MEMBERPFNGLGENQUERIESARBPROC m_orig_glGenQueriesARB = nullptr;
+void m_glGenQueriesARB_validation(GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glGenQueriesARB))(n,ids);this->m_checkErrors("glGenQueriesARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC m_orig_glProgramUniform2i64NV = nullptr;
+void m_glProgramUniform2i64NV_validation(GLuint program,GLint location,GLint64EXT x,GLint64EXT y)const{(this->*(this->m_orig_glProgramUniform2i64NV))(program,location,x,y);this->m_checkErrors("glProgramUniform2i64NV");}
+FunctionTable::MEMBERPFNGLVERTEXP4UIPROC m_orig_glVertexP4ui = nullptr;
+void m_glVertexP4ui_validation(GLenum type,GLuint value)const{(this->*(this->m_orig_glVertexP4ui))(type,value);this->m_checkErrors("glVertexP4ui");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC m_orig_glVertexStream1ivATI = nullptr;
+void m_glVertexStream1ivATI_validation(GLenum stream,const GLint* coords)const{(this->*(this->m_orig_glVertexStream1ivATI))(stream,coords);this->m_checkErrors("glVertexStream1ivATI");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC m_orig_glProgramEnvParameterI4iNV = nullptr;
+void m_glProgramEnvParameterI4iNV_validation(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glProgramEnvParameterI4iNV))(target,index,x,y,z,w);this->m_checkErrors("glProgramEnvParameterI4iNV");}
+FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC m_orig_glGenVertexArraysAPPLE = nullptr;
+void m_glGenVertexArraysAPPLE_validation(GLsizei n,GLuint* arrays)const{(this->*(this->m_orig_glGenVertexArraysAPPLE))(n,arrays);this->m_checkErrors("glGenVertexArraysAPPLE");}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC m_orig_glDrawTransformFeedbackInstanced = nullptr;
+void m_glDrawTransformFeedbackInstanced_validation(GLenum mode,GLuint id,GLsizei instancecount)const{(this->*(this->m_orig_glDrawTransformFeedbackInstanced))(mode,id,instancecount);this->m_checkErrors("glDrawTransformFeedbackInstanced");}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC m_orig_glStencilThenCoverStrokePathNV = nullptr;
+void m_glStencilThenCoverStrokePathNV_validation(GLuint path,GLint reference,GLuint mask,GLenum coverMode)const{(this->*(this->m_orig_glStencilThenCoverStrokePathNV))(path,reference,mask,coverMode);this->m_checkErrors("glStencilThenCoverStrokePathNV");}
+FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC m_orig_glDeleteVertexArraysAPPLE = nullptr;
+void m_glDeleteVertexArraysAPPLE_validation(GLsizei n,const GLuint* arrays)const{(this->*(this->m_orig_glDeleteVertexArraysAPPLE))(n,arrays);this->m_checkErrors("glDeleteVertexArraysAPPLE");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC m_orig_glGetNamedBufferParameterui64vNV = nullptr;
+void m_glGetNamedBufferParameterui64vNV_validation(GLuint buffer,GLenum pname,GLuint64EXT* params)const{(this->*(this->m_orig_glGetNamedBufferParameterui64vNV))(buffer,pname,params);this->m_checkErrors("glGetNamedBufferParameterui64vNV");}
+FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC m_orig_glQueryMatrixxOES = nullptr;
+GLbitfield m_glQueryMatrixxOES_validation(GLfixed* mantissa,GLint* exponent)const{GLbitfield const result = (this->*(this->m_orig_glQueryMatrixxOES))(mantissa,exponent);this->m_checkErrors("glQueryMatrixxOES");return result;}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC m_orig_glSecondaryColor3usv = nullptr;
+void m_glSecondaryColor3usv_validation(const GLushort* v)const{(this->*(this->m_orig_glSecondaryColor3usv))(v);this->m_checkErrors("glSecondaryColor3usv");}
+FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC m_orig_glTranslatexOES = nullptr;
+void m_glTranslatexOES_validation(GLfixed x,GLfixed y,GLfixed z)const{(this->*(this->m_orig_glTranslatexOES))(x,y,z);this->m_checkErrors("glTranslatexOES");}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC m_orig_glDrawTransformFeedback = nullptr;
+void m_glDrawTransformFeedback_validation(GLenum mode,GLuint id)const{(this->*(this->m_orig_glDrawTransformFeedback))(mode,id);this->m_checkErrors("glDrawTransformFeedback");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_validation(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN))(tc,c,n,v);this->m_checkErrors("glTexCoord2fColor4fNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC m_orig_glVDPAURegisterVideoSurfaceNV = nullptr;
+GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_validation(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{GLvdpauSurfaceNV const result = (this->*(this->m_orig_glVDPAURegisterVideoSurfaceNV))(vdpSurface,target,numTextureNames,textureNames);this->m_checkErrors("glVDPAURegisterVideoSurfaceNV");return result;}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC m_orig_glGetTexParameterIuiv = nullptr;
+void m_glGetTexParameterIuiv_validation(GLenum target,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetTexParameterIuiv))(target,pname,params);this->m_checkErrors("glGetTexParameterIuiv");}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC m_orig_glBindBufferBaseNV = nullptr;
+void m_glBindBufferBaseNV_validation(GLenum target,GLuint index,GLuint buffer)const{(this->*(this->m_orig_glBindBufferBaseNV))(target,index,buffer);this->m_checkErrors("glBindBufferBaseNV");}
+FunctionTable::MEMBERPFNGLINDEXPOINTERPROC m_orig_glIndexPointer = nullptr;
+void m_glIndexPointer_validation(GLenum type,GLsizei stride,const GLvoid* ptr)const{(this->*(this->m_orig_glIndexPointer))(type,stride,ptr);this->m_checkErrors("glIndexPointer");}
+FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC m_orig_glGenQueryResourceTagNV = nullptr;
+void m_glGenQueryResourceTagNV_validation(GLsizei n,GLint* tagIds)const{(this->*(this->m_orig_glGenQueryResourceTagNV))(n,tagIds);this->m_checkErrors("glGenQueryResourceTagNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC m_orig_glVertexAttrib4Nbv = nullptr;
+void m_glVertexAttrib4Nbv_validation(GLuint index,const GLbyte* v)const{(this->*(this->m_orig_glVertexAttrib4Nbv))(index,v);this->m_checkErrors("glVertexAttrib4Nbv");}
+FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC m_orig_glListParameteriSGIX = nullptr;
+void m_glListParameteriSGIX_validation(GLuint list,GLenum pname,GLint param)const{(this->*(this->m_orig_glListParameteriSGIX))(list,pname,param);this->m_checkErrors("glListParameteriSGIX");}
+FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC m_orig_glBlendColorxOES = nullptr;
+void m_glBlendColorxOES_validation(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{(this->*(this->m_orig_glBlendColorxOES))(red,green,blue,alpha);this->m_checkErrors("glBlendColorxOES");}
+FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC m_orig_glUniformui64vNV = nullptr;
+void m_glUniformui64vNV_validation(GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glUniformui64vNV))(location,count,value);this->m_checkErrors("glUniformui64vNV");}
+FunctionTable::MEMBERPFNGLISSYNCPROC m_orig_glIsSync = nullptr;
+GLboolean m_glIsSync_validation(GLsync sync)const{GLboolean const result = (this->*(this->m_orig_glIsSync))(sync);this->m_checkErrors("glIsSync");return result;}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC m_orig_glGetTextureParameterivEXT = nullptr;
+void m_glGetTextureParameterivEXT_validation(GLuint texture,GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTextureParameterivEXT))(texture,target,pname,params);this->m_checkErrors("glGetTextureParameterivEXT");}
+FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC m_orig_glFogCoordhvNV = nullptr;
+void m_glFogCoordhvNV_validation(const GLhalfNV* fog)const{(this->*(this->m_orig_glFogCoordhvNV))(fog);this->m_checkErrors("glFogCoordhvNV");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC m_orig_glFramebufferTextureLayerEXT = nullptr;
+void m_glFramebufferTextureLayerEXT_validation(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{(this->*(this->m_orig_glFramebufferTextureLayerEXT))(target,attachment,texture,level,layer);this->m_checkErrors("glFramebufferTextureLayerEXT");}
+FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC m_orig_glGetObjectPtrLabel = nullptr;
+void m_glGetObjectPtrLabel_validation(const void* ptr,GLsizei bufSize,GLsizei* length,GLchar* label)const{(this->*(this->m_orig_glGetObjectPtrLabel))(ptr,bufSize,length,label);this->m_checkErrors("glGetObjectPtrLabel");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC m_orig_glTextureParameteri = nullptr;
+void m_glTextureParameteri_validation(GLuint texture,GLenum pname,GLint param)const{(this->*(this->m_orig_glTextureParameteri))(texture,pname,param);this->m_checkErrors("glTextureParameteri");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC m_orig_glMultiTexCoord1fARB = nullptr;
+void m_glMultiTexCoord1fARB_validation(GLenum target,GLfloat s)const{(this->*(this->m_orig_glMultiTexCoord1fARB))(target,s);this->m_checkErrors("glMultiTexCoord1fARB");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC m_orig_glUniformMatrix2x3dv = nullptr;
+void m_glUniformMatrix2x3dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix2x3dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2x3dv");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC m_orig_glFramebufferDrawBufferEXT = nullptr;
+void m_glFramebufferDrawBufferEXT_validation(GLuint framebuffer,GLenum mode)const{(this->*(this->m_orig_glFramebufferDrawBufferEXT))(framebuffer,mode);this->m_checkErrors("glFramebufferDrawBufferEXT");}
+FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC m_orig_glCopyColorSubTable = nullptr;
+void m_glCopyColorSubTable_validation(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyColorSubTable))(target,start,x,y,width);this->m_checkErrors("glCopyColorSubTable");}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC m_orig_glGetNamedFramebufferParameterfvAMD = nullptr;
+void m_glGetNamedFramebufferParameterfvAMD_validation(GLuint framebuffer,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{(this->*(this->m_orig_glGetNamedFramebufferParameterfvAMD))(framebuffer,pname,numsamples,pixelindex,size,values);this->m_checkErrors("glGetNamedFramebufferParameterfvAMD");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC m_orig_glVertexAttribL3d = nullptr;
+void m_glVertexAttribL3d_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertexAttribL3d))(index,x,y,z);this->m_checkErrors("glVertexAttribL3d");}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC m_orig_glFragmentMaterialfvSGIX = nullptr;
+void m_glFragmentMaterialfvSGIX_validation(GLenum face,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glFragmentMaterialfvSGIX))(face,pname,params);this->m_checkErrors("glFragmentMaterialfvSGIX");}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC m_orig_glMatrixLoadTranspose3x3fNV = nullptr;
+void m_glMatrixLoadTranspose3x3fNV_validation(GLenum matrixMode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixLoadTranspose3x3fNV))(matrixMode,m);this->m_checkErrors("glMatrixLoadTranspose3x3fNV");}
+FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC m_orig_glDeleteNamesAMD = nullptr;
+void m_glDeleteNamesAMD_validation(GLenum identifier,GLuint num,const GLuint* names)const{(this->*(this->m_orig_glDeleteNamesAMD))(identifier,num,names);this->m_checkErrors("glDeleteNamesAMD");}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC m_orig_glDrawRangeElementsEXT = nullptr;
+void m_glDrawRangeElementsEXT_validation(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices)const{(this->*(this->m_orig_glDrawRangeElementsEXT))(mode,start,end,count,type,indices);this->m_checkErrors("glDrawRangeElementsEXT");}
+FunctionTable::MEMBERPFNGLORTHOPROC m_orig_glOrtho = nullptr;
+void m_glOrtho_validation(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{(this->*(this->m_orig_glOrtho))(left,right,bottom,top,near_val,far_val);this->m_checkErrors("glOrtho");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC m_orig_glProgramUniform1dvEXT = nullptr;
+void m_glProgramUniform1dvEXT_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform1dvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform1dvEXT");}
+FunctionTable::MEMBERPFNGLCOLOR4XOESPROC m_orig_glColor4xOES = nullptr;
+void m_glColor4xOES_validation(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{(this->*(this->m_orig_glColor4xOES))(red,green,blue,alpha);this->m_checkErrors("glColor4xOES");}
+FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC m_orig_glTexImage4DSGIS = nullptr;
+void m_glTexImage4DSGIS_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTexImage4DSGIS))(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);this->m_checkErrors("glTexImage4DSGIS");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC m_orig_glProgramUniform1ui = nullptr;
+void m_glProgramUniform1ui_validation(GLuint program,GLint location,GLuint v0)const{(this->*(this->m_orig_glProgramUniform1ui))(program,location,v0);this->m_checkErrors("glProgramUniform1ui");}
+FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC m_orig_glDeleteBuffersARB = nullptr;
+void m_glDeleteBuffersARB_validation(GLsizei n,const GLuint* buffers)const{(this->*(this->m_orig_glDeleteBuffersARB))(n,buffers);this->m_checkErrors("glDeleteBuffersARB");}
+FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC m_orig_glUnmapBufferARB = nullptr;
+GLboolean m_glUnmapBufferARB_validation(GLenum target)const{GLboolean const result = (this->*(this->m_orig_glUnmapBufferARB))(target);this->m_checkErrors("glUnmapBufferARB");return result;}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC m_orig_glCopyTexImage2D = nullptr;
+void m_glCopyTexImage2D_validation(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{(this->*(this->m_orig_glCopyTexImage2D))(target,level,internalformat,x,y,width,height,border);this->m_checkErrors("glCopyTexImage2D");}
+FunctionTable::MEMBERPFNGLMATERIALXOESPROC m_orig_glMaterialxOES = nullptr;
+void m_glMaterialxOES_validation(GLenum face,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glMaterialxOES))(face,pname,param);this->m_checkErrors("glMaterialxOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC m_orig_glProgramUniformMatrix2x4fvEXT = nullptr;
+void m_glProgramUniformMatrix2x4fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x4fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x4fvEXT");}
+FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC m_orig_glTestObjectAPPLE = nullptr;
+GLboolean m_glTestObjectAPPLE_validation(GLenum object,GLuint name)const{GLboolean const result = (this->*(this->m_orig_glTestObjectAPPLE))(object,name);this->m_checkErrors("glTestObjectAPPLE");return result;}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC m_orig_glRenderbufferStorageEXT = nullptr;
+void m_glRenderbufferStorageEXT_validation(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glRenderbufferStorageEXT))(target,internalformat,width,height);this->m_checkErrors("glRenderbufferStorageEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC m_orig_glVertexAttribL1ui64ARB = nullptr;
+void m_glVertexAttribL1ui64ARB_validation(GLuint index,GLuint64EXT x)const{(this->*(this->m_orig_glVertexAttribL1ui64ARB))(index,x);this->m_checkErrors("glVertexAttribL1ui64ARB");}
+FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC m_orig_glEndFragmentShaderATI = nullptr;
+void m_glEndFragmentShaderATI_validation()const{(this->*(this->m_orig_glEndFragmentShaderATI))();this->m_checkErrors("glEndFragmentShaderATI");}
+FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC m_orig_glPathParameterivNV = nullptr;
+void m_glPathParameterivNV_validation(GLuint path,GLenum pname,const GLint* value)const{(this->*(this->m_orig_glPathParameterivNV))(path,pname,value);this->m_checkErrors("glPathParameterivNV");}
+FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC m_orig_glUniform4uiv = nullptr;
+void m_glUniform4uiv_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform4uiv))(location,count,value);this->m_checkErrors("glUniform4uiv");}
+FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC m_orig_glFrameZoomSGIX = nullptr;
+void m_glFrameZoomSGIX_validation(GLint factor)const{(this->*(this->m_orig_glFrameZoomSGIX))(factor);this->m_checkErrors("glFrameZoomSGIX");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC m_orig_glSecondaryColor3fEXT = nullptr;
+void m_glSecondaryColor3fEXT_validation(GLfloat red,GLfloat green,GLfloat blue)const{(this->*(this->m_orig_glSecondaryColor3fEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3fEXT");}
+FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC m_orig_glLGPUInterlockNVX = nullptr;
+void m_glLGPUInterlockNVX_validation()const{(this->*(this->m_orig_glLGPUInterlockNVX))();this->m_checkErrors("glLGPUInterlockNVX");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC m_orig_glVertexAttribL1dv = nullptr;
+void m_glVertexAttribL1dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL1dv))(index,v);this->m_checkErrors("glVertexAttribL1dv");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC m_orig_glNormalStream3svATI = nullptr;
+void m_glNormalStream3svATI_validation(GLenum stream,const GLshort* coords)const{(this->*(this->m_orig_glNormalStream3svATI))(stream,coords);this->m_checkErrors("glNormalStream3svATI");}
+FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC m_orig_glPathStencilFuncNV = nullptr;
+void m_glPathStencilFuncNV_validation(GLenum func,GLint ref,GLuint mask)const{(this->*(this->m_orig_glPathStencilFuncNV))(func,ref,mask);this->m_checkErrors("glPathStencilFuncNV");}
+FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC m_orig_glSetInvariantEXT = nullptr;
+void m_glSetInvariantEXT_validation(GLuint id,GLenum type,const void* addr)const{(this->*(this->m_orig_glSetInvariantEXT))(id,type,addr);this->m_checkErrors("glSetInvariantEXT");}
+FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC m_orig_glGetTexBumpParameterivATI = nullptr;
+void m_glGetTexBumpParameterivATI_validation(GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetTexBumpParameterivATI))(pname,param);this->m_checkErrors("glGetTexBumpParameterivATI");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC m_orig_glBlendEquationSeparateEXT = nullptr;
+void m_glBlendEquationSeparateEXT_validation(GLenum modeRGB,GLenum modeAlpha)const{(this->*(this->m_orig_glBlendEquationSeparateEXT))(modeRGB,modeAlpha);this->m_checkErrors("glBlendEquationSeparateEXT");}
+FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC m_orig_glEndOcclusionQueryNV = nullptr;
+void m_glEndOcclusionQueryNV_validation()const{(this->*(this->m_orig_glEndOcclusionQueryNV))();this->m_checkErrors("glEndOcclusionQueryNV");}
+FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC m_orig_glScissorArrayv = nullptr;
+void m_glScissorArrayv_validation(GLuint first,GLsizei count,const GLint* v)const{(this->*(this->m_orig_glScissorArrayv))(first,count,v);this->m_checkErrors("glScissorArrayv");}
+FunctionTable::MEMBERPFNGLCALLLISTPROC m_orig_glCallList = nullptr;
+void m_glCallList_validation(GLuint list)const{(this->*(this->m_orig_glCallList))(list);this->m_checkErrors("glCallList");}
+FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC m_orig_glMapTexture2DINTEL = nullptr;
+void* m_glMapTexture2DINTEL_validation(GLuint texture,GLint level,GLbitfield access,GLint* stride,GLenum* layout)const{void* const result = (this->*(this->m_orig_glMapTexture2DINTEL))(texture,level,access,stride,layout);this->m_checkErrors("glMapTexture2DINTEL");return result;}
+FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC m_orig_glGetVkProcAddrNV = nullptr;
+GLVULKANPROCNV m_glGetVkProcAddrNV_validation(const GLchar* name)const{GLVULKANPROCNV const result = (this->*(this->m_orig_glGetVkProcAddrNV))(name);this->m_checkErrors("glGetVkProcAddrNV");return result;}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC m_orig_glPixelTransferxOES = nullptr;
+void m_glPixelTransferxOES_validation(GLenum pname,GLfixed param)const{(this->*(this->m_orig_glPixelTransferxOES))(pname,param);this->m_checkErrors("glPixelTransferxOES");}
+FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC m_orig_glDeleteRenderbuffersEXT = nullptr;
+void m_glDeleteRenderbuffersEXT_validation(GLsizei n,const GLuint* renderbuffers)const{(this->*(this->m_orig_glDeleteRenderbuffersEXT))(n,renderbuffers);this->m_checkErrors("glDeleteRenderbuffersEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN = nullptr;
+void m_glTexCoord4fColor4fNormal3fVertex4fSUN_validation(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN))(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);this->m_checkErrors("glTexCoord4fColor4fNormal3fVertex4fSUN");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC m_orig_glProgramUniformMatrix4dvEXT = nullptr;
+void m_glProgramUniformMatrix4dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix4dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4dvEXT");}
+FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC m_orig_glGetnColorTable = nullptr;
+void m_glGetnColorTable_validation(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{(this->*(this->m_orig_glGetnColorTable))(target,format,type,bufSize,table);this->m_checkErrors("glGetnColorTable");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC m_orig_glFramebufferTextureLayerARB = nullptr;
+void m_glFramebufferTextureLayerARB_validation(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{(this->*(this->m_orig_glFramebufferTextureLayerARB))(target,attachment,texture,level,layer);this->m_checkErrors("glFramebufferTextureLayerARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC m_orig_glVertexAttribL2dvEXT = nullptr;
+void m_glVertexAttribL2dvEXT_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL2dvEXT))(index,v);this->m_checkErrors("glVertexAttribL2dvEXT");}
+FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC m_orig_glGetCombinerStageParameterfvNV = nullptr;
+void m_glGetCombinerStageParameterfvNV_validation(GLenum stage,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetCombinerStageParameterfvNV))(stage,pname,params);this->m_checkErrors("glGetCombinerStageParameterfvNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC m_orig_glMultiTexCoord1xvOES = nullptr;
+void m_glMultiTexCoord1xvOES_validation(GLenum texture,const GLfixed* coords)const{(this->*(this->m_orig_glMultiTexCoord1xvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord1xvOES");}
+FunctionTable::MEMBERPFNGLMAPBUFFERPROC m_orig_glMapBuffer = nullptr;
+void* m_glMapBuffer_validation(GLenum target,GLenum access)const{void* const result = (this->*(this->m_orig_glMapBuffer))(target,access);this->m_checkErrors("glMapBuffer");return result;}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC m_orig_glSecondaryColor3d = nullptr;
+void m_glSecondaryColor3d_validation(GLdouble red,GLdouble green,GLdouble blue)const{(this->*(this->m_orig_glSecondaryColor3d))(red,green,blue);this->m_checkErrors("glSecondaryColor3d");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC m_orig_glSecondaryColor3f = nullptr;
+void m_glSecondaryColor3f_validation(GLfloat red,GLfloat green,GLfloat blue)const{(this->*(this->m_orig_glSecondaryColor3f))(red,green,blue);this->m_checkErrors("glSecondaryColor3f");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC m_orig_glVertexAttribLFormat = nullptr;
+void m_glVertexAttribLFormat_validation(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexAttribLFormat))(attribindex,size,type,relativeoffset);this->m_checkErrors("glVertexAttribLFormat");}
+FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC m_orig_glElementPointerAPPLE = nullptr;
+void m_glElementPointerAPPLE_validation(GLenum type,const void* pointer)const{(this->*(this->m_orig_glElementPointerAPPLE))(type,pointer);this->m_checkErrors("glElementPointerAPPLE");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC m_orig_glVertexStream1fATI = nullptr;
+void m_glVertexStream1fATI_validation(GLenum stream,GLfloat x)const{(this->*(this->m_orig_glVertexStream1fATI))(stream,x);this->m_checkErrors("glVertexStream1fATI");}
+FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC m_orig_glCoverageModulationNV = nullptr;
+void m_glCoverageModulationNV_validation(GLenum components)const{(this->*(this->m_orig_glCoverageModulationNV))(components);this->m_checkErrors("glCoverageModulationNV");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC m_orig_glSecondaryColor3i = nullptr;
+void m_glSecondaryColor3i_validation(GLint red,GLint green,GLint blue)const{(this->*(this->m_orig_glSecondaryColor3i))(red,green,blue);this->m_checkErrors("glSecondaryColor3i");}
+FunctionTable::MEMBERPFNGLDELETESYNCPROC m_orig_glDeleteSync = nullptr;
+void m_glDeleteSync_validation(GLsync sync)const{(this->*(this->m_orig_glDeleteSync))(sync);this->m_checkErrors("glDeleteSync");}
+FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC m_orig_glGetProgramParameterfvNV = nullptr;
+void m_glGetProgramParameterfvNV_validation(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetProgramParameterfvNV))(target,index,pname,params);this->m_checkErrors("glGetProgramParameterfvNV");}
+FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC m_orig_glMaxShaderCompilerThreadsARB = nullptr;
+void m_glMaxShaderCompilerThreadsARB_validation(GLuint count)const{(this->*(this->m_orig_glMaxShaderCompilerThreadsARB))(count);this->m_checkErrors("glMaxShaderCompilerThreadsARB");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC m_orig_glUniformMatrix4x2dv = nullptr;
+void m_glUniformMatrix4x2dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix4x2dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4x2dv");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC m_orig_glVertexArrayVertexAttribLOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribLOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayVertexAttribLOffsetEXT))(vaobj,buffer,index,size,type,stride,offset);this->m_checkErrors("glVertexArrayVertexAttribLOffsetEXT");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC m_orig_glSecondaryColor3s = nullptr;
+void m_glSecondaryColor3s_validation(GLshort red,GLshort green,GLshort blue)const{(this->*(this->m_orig_glSecondaryColor3s))(red,green,blue);this->m_checkErrors("glSecondaryColor3s");}
+FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC m_orig_glIsImageHandleResidentNV = nullptr;
+GLboolean m_glIsImageHandleResidentNV_validation(GLuint64 handle)const{GLboolean const result = (this->*(this->m_orig_glIsImageHandleResidentNV))(handle);this->m_checkErrors("glIsImageHandleResidentNV");return result;}
+FunctionTable::MEMBERPFNGLUNIFORM3IVPROC m_orig_glUniform3iv = nullptr;
+void m_glUniform3iv_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform3iv))(location,count,value);this->m_checkErrors("glUniform3iv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC m_orig_glVertexAttribL3i64vNV = nullptr;
+void m_glVertexAttribL3i64vNV_validation(GLuint index,const GLint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL3i64vNV))(index,v);this->m_checkErrors("glVertexAttribL3i64vNV");}
+FunctionTable::MEMBERPFNGLPOLYGONMODEPROC m_orig_glPolygonMode = nullptr;
+void m_glPolygonMode_validation(GLenum face,GLenum mode)const{(this->*(this->m_orig_glPolygonMode))(face,mode);this->m_checkErrors("glPolygonMode");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC m_orig_glFramebufferSamplePositionsfvAMD = nullptr;
+void m_glFramebufferSamplePositionsfvAMD_validation(GLenum target,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{(this->*(this->m_orig_glFramebufferSamplePositionsfvAMD))(target,numsamples,pixelindex,values);this->m_checkErrors("glFramebufferSamplePositionsfvAMD");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC m_orig_glConvolutionFilter1DEXT = nullptr;
+void m_glConvolutionFilter1DEXT_validation(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* image)const{(this->*(this->m_orig_glConvolutionFilter1DEXT))(target,internalformat,width,format,type,image);this->m_checkErrors("glConvolutionFilter1DEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC m_orig_glVertexAttrib1dvARB = nullptr;
+void m_glVertexAttrib1dvARB_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib1dvARB))(index,v);this->m_checkErrors("glVertexAttrib1dvARB");}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC m_orig_glTextureSubImage2DEXT = nullptr;
+void m_glTextureSubImage2DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureSubImage2DEXT))(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);this->m_checkErrors("glTextureSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC m_orig_glIsVertexArrayAPPLE = nullptr;
+GLboolean m_glIsVertexArrayAPPLE_validation(GLuint array)const{GLboolean const result = (this->*(this->m_orig_glIsVertexArrayAPPLE))(array);this->m_checkErrors("glIsVertexArrayAPPLE");return result;}
+FunctionTable::MEMBERPFNGLUSEPROGRAMPROC m_orig_glUseProgram = nullptr;
+void m_glUseProgram_validation(GLuint program)const{(this->*(this->m_orig_glUseProgram))(program);this->m_checkErrors("glUseProgram");}
+FunctionTable::MEMBERPFNGLLINESTIPPLEPROC m_orig_glLineStipple = nullptr;
+void m_glLineStipple_validation(GLint factor,GLushort pattern)const{(this->*(this->m_orig_glLineStipple))(factor,pattern);this->m_checkErrors("glLineStipple");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC m_orig_glMultiTexCoord4fvARB = nullptr;
+void m_glMultiTexCoord4fvARB_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord4fvARB))(target,v);this->m_checkErrors("glMultiTexCoord4fvARB");}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC m_orig_glVideoCaptureNV = nullptr;
+GLenum m_glVideoCaptureNV_validation(GLuint video_capture_slot,GLuint* sequence_num,GLuint64EXT* capture_time)const{GLenum const result = (this->*(this->m_orig_glVideoCaptureNV))(video_capture_slot,sequence_num,capture_time);this->m_checkErrors("glVideoCaptureNV");return result;}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC m_orig_glVertexArrayVertexAttribLFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribLFormatEXT_validation(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexArrayVertexAttribLFormatEXT))(vaobj,attribindex,size,type,relativeoffset);this->m_checkErrors("glVertexArrayVertexAttribLFormatEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC m_orig_glUniform3fvARB = nullptr;
+void m_glUniform3fvARB_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform3fvARB))(location,count,value);this->m_checkErrors("glUniform3fvARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC m_orig_glProgramUniformMatrix3x2fvEXT = nullptr;
+void m_glProgramUniformMatrix3x2fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x2fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x2fvEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC m_orig_glCopyTextureSubImage3DEXT = nullptr;
+void m_glCopyTextureSubImage3DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTextureSubImage3DEXT))(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);this->m_checkErrors("glCopyTextureSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC m_orig_glMultiTexCoord2bvOES = nullptr;
+void m_glMultiTexCoord2bvOES_validation(GLenum texture,const GLbyte* coords)const{(this->*(this->m_orig_glMultiTexCoord2bvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord2bvOES");}
+FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC m_orig_glDeleteObjectARB = nullptr;
+void m_glDeleteObjectARB_validation(GLhandleARB obj)const{(this->*(this->m_orig_glDeleteObjectARB))(obj);this->m_checkErrors("glDeleteObjectARB");}
+FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC m_orig_glTextureLightEXT = nullptr;
+void m_glTextureLightEXT_validation(GLenum pname)const{(this->*(this->m_orig_glTextureLightEXT))(pname);this->m_checkErrors("glTextureLightEXT");}
+FunctionTable::MEMBERPFNGLRASTERPOS3IPROC m_orig_glRasterPos3i = nullptr;
+void m_glRasterPos3i_validation(GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glRasterPos3i))(x,y,z);this->m_checkErrors("glRasterPos3i");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC m_orig_glMultiTexCoord3dARB = nullptr;
+void m_glMultiTexCoord3dARB_validation(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{(this->*(this->m_orig_glMultiTexCoord3dARB))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3dARB");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC m_orig_glNamedFramebufferTextureEXT = nullptr;
+void m_glNamedFramebufferTextureEXT_validation(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{(this->*(this->m_orig_glNamedFramebufferTextureEXT))(framebuffer,attachment,texture,level);this->m_checkErrors("glNamedFramebufferTextureEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC m_orig_glTextureParameteriEXT = nullptr;
+void m_glTextureParameteriEXT_validation(GLuint texture,GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glTextureParameteriEXT))(texture,target,pname,param);this->m_checkErrors("glTextureParameteriEXT");}
+FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC m_orig_glEvalCoord2xvOES = nullptr;
+void m_glEvalCoord2xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glEvalCoord2xvOES))(coords);this->m_checkErrors("glEvalCoord2xvOES");}
+FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC m_orig_glBindVideoCaptureStreamBufferNV = nullptr;
+void m_glBindVideoCaptureStreamBufferNV_validation(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLintptrARB offset)const{(this->*(this->m_orig_glBindVideoCaptureStreamBufferNV))(video_capture_slot,stream,frame_region,offset);this->m_checkErrors("glBindVideoCaptureStreamBufferNV");}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC m_orig_glTexImage2DMultisampleCoverageNV = nullptr;
+void m_glTexImage2DMultisampleCoverageNV_validation(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{(this->*(this->m_orig_glTexImage2DMultisampleCoverageNV))(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);this->m_checkErrors("glTexImage2DMultisampleCoverageNV");}
+FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC m_orig_glGetAttribLocationARB = nullptr;
+GLint m_glGetAttribLocationARB_validation(GLhandleARB programObj,const GLcharARB* name)const{GLint const result = (this->*(this->m_orig_glGetAttribLocationARB))(programObj,name);this->m_checkErrors("glGetAttribLocationARB");return result;}
+FunctionTable::MEMBERPFNGLDELETESHADERPROC m_orig_glDeleteShader = nullptr;
+void m_glDeleteShader_validation(GLuint shader)const{(this->*(this->m_orig_glDeleteShader))(shader);this->m_checkErrors("glDeleteShader");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC m_orig_glVertexAttrib1fARB = nullptr;
+void m_glVertexAttrib1fARB_validation(GLuint index,GLfloat x)const{(this->*(this->m_orig_glVertexAttrib1fARB))(index,x);this->m_checkErrors("glVertexAttrib1fARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC m_orig_glTexCoord2fColor4ubVertex3fSUN = nullptr;
+void m_glTexCoord2fColor4ubVertex3fSUN_validation(GLfloat s,GLfloat t,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glTexCoord2fColor4ubVertex3fSUN))(s,t,r,g,b,a,x,y,z);this->m_checkErrors("glTexCoord2fColor4ubVertex3fSUN");}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC m_orig_glTexCoord4fVertex4fSUN = nullptr;
+void m_glTexCoord4fVertex4fSUN_validation(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glTexCoord4fVertex4fSUN))(s,t,p,q,x,y,z,w);this->m_checkErrors("glTexCoord4fVertex4fSUN");}
+FunctionTable::MEMBERPFNGLGETMAPDVPROC m_orig_glGetMapdv = nullptr;
+void m_glGetMapdv_validation(GLenum target,GLenum query,GLdouble* v)const{(this->*(this->m_orig_glGetMapdv))(target,query,v);this->m_checkErrors("glGetMapdv");}
+FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC m_orig_glMapParameterfvNV = nullptr;
+void m_glMapParameterfvNV_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glMapParameterfvNV))(target,pname,params);this->m_checkErrors("glMapParameterfvNV");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC m_orig_glTextureParameterIuiv = nullptr;
+void m_glTextureParameterIuiv_validation(GLuint texture,GLenum pname,const GLuint* params)const{(this->*(this->m_orig_glTextureParameterIuiv))(texture,pname,params);this->m_checkErrors("glTextureParameterIuiv");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC m_orig_glTransformFeedbackAttribsNV = nullptr;
+void m_glTransformFeedbackAttribsNV_validation(GLsizei count,const GLint* attribs,GLenum bufferMode)const{(this->*(this->m_orig_glTransformFeedbackAttribsNV))(count,attribs,bufferMode);this->m_checkErrors("glTransformFeedbackAttribsNV");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC m_orig_glFragmentLightfvSGIX = nullptr;
+void m_glFragmentLightfvSGIX_validation(GLenum light,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glFragmentLightfvSGIX))(light,pname,params);this->m_checkErrors("glFragmentLightfvSGIX");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC m_orig_glWindowPos3sARB = nullptr;
+void m_glWindowPos3sARB_validation(GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glWindowPos3sARB))(x,y,z);this->m_checkErrors("glWindowPos3sARB");}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC m_orig_glGetConvolutionParameterfv = nullptr;
+void m_glGetConvolutionParameterfv_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetConvolutionParameterfv))(target,pname,params);this->m_checkErrors("glGetConvolutionParameterfv");}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC m_orig_glCopyTexSubImage3D = nullptr;
+void m_glCopyTexSubImage3D_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTexSubImage3D))(target,level,xoffset,yoffset,zoffset,x,y,width,height);this->m_checkErrors("glCopyTexSubImage3D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC m_orig_glVertexAttribI3i = nullptr;
+void m_glVertexAttribI3i_validation(GLuint index,GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glVertexAttribI3i))(index,x,y,z);this->m_checkErrors("glVertexAttribI3i");}
+FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC m_orig_glCreateShaderObjectARB = nullptr;
+GLhandleARB m_glCreateShaderObjectARB_validation(GLenum shaderType)const{GLhandleARB const result = (this->*(this->m_orig_glCreateShaderObjectARB))(shaderType);this->m_checkErrors("glCreateShaderObjectARB");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC m_orig_glVertexAttribFormat = nullptr;
+void m_glVertexAttribFormat_validation(GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexAttribFormat))(attribindex,size,type,normalized,relativeoffset);this->m_checkErrors("glVertexAttribFormat");}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC m_orig_glGetProgramivARB = nullptr;
+void m_glGetProgramivARB_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetProgramivARB))(target,pname,params);this->m_checkErrors("glGetProgramivARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC m_orig_glVertexAttribI4usv = nullptr;
+void m_glVertexAttribI4usv_validation(GLuint index,const GLushort* v)const{(this->*(this->m_orig_glVertexAttribI4usv))(index,v);this->m_checkErrors("glVertexAttribI4usv");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC m_orig_glTexParameterf = nullptr;
+void m_glTexParameterf_validation(GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glTexParameterf))(target,pname,param);this->m_checkErrors("glTexParameterf");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC m_orig_glVertexAttribBinding = nullptr;
+void m_glVertexAttribBinding_validation(GLuint attribindex,GLuint bindingindex)const{(this->*(this->m_orig_glVertexAttribBinding))(attribindex,bindingindex);this->m_checkErrors("glVertexAttribBinding");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC m_orig_glGetHistogramParameteriv = nullptr;
+void m_glGetHistogramParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetHistogramParameteriv))(target,pname,params);this->m_checkErrors("glGetHistogramParameteriv");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC m_orig_glTexParameteri = nullptr;
+void m_glTexParameteri_validation(GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glTexParameteri))(target,pname,param);this->m_checkErrors("glTexParameteri");}
+FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC m_orig_glGetShaderSource = nullptr;
+void m_glGetShaderSource_validation(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* source)const{(this->*(this->m_orig_glGetShaderSource))(shader,bufSize,length,source);this->m_checkErrors("glGetShaderSource");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC m_orig_glVertexAttrib4s = nullptr;
+void m_glVertexAttrib4s_validation(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glVertexAttrib4s))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4s");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC m_orig_glVertexAttrib4dvNV = nullptr;
+void m_glVertexAttrib4dvNV_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib4dvNV))(index,v);this->m_checkErrors("glVertexAttrib4dvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC m_orig_glVertexAttrib1dvNV = nullptr;
+void m_glVertexAttrib1dvNV_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib1dvNV))(index,v);this->m_checkErrors("glVertexAttrib1dvNV");}
+FunctionTable::MEMBERPFNGLPOPNAMEPROC m_orig_glPopName = nullptr;
+void m_glPopName_validation()const{(this->*(this->m_orig_glPopName))();this->m_checkErrors("glPopName");}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC m_orig_glTextureBufferEXT = nullptr;
+void m_glTextureBufferEXT_validation(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer)const{(this->*(this->m_orig_glTextureBufferEXT))(texture,target,internalformat,buffer);this->m_checkErrors("glTextureBufferEXT");}
+FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC m_orig_glGetMultiTexImageEXT = nullptr;
+void m_glGetMultiTexImageEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{(this->*(this->m_orig_glGetMultiTexImageEXT))(texunit,target,level,format,type,pixels);this->m_checkErrors("glGetMultiTexImageEXT");}
+FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC m_orig_glGetPointerIndexedvEXT = nullptr;
+void m_glGetPointerIndexedvEXT_validation(GLenum target,GLuint index,void** data)const{(this->*(this->m_orig_glGetPointerIndexedvEXT))(target,index,data);this->m_checkErrors("glGetPointerIndexedvEXT");}
+FunctionTable::MEMBERPFNGLISNAMEAMDPROC m_orig_glIsNameAMD = nullptr;
+GLboolean m_glIsNameAMD_validation(GLenum identifier,GLuint name)const{GLboolean const result = (this->*(this->m_orig_glIsNameAMD))(identifier,name);this->m_checkErrors("glIsNameAMD");return result;}
+FunctionTable::MEMBERPFNGLCOLOR4UBPROC m_orig_glColor4ub = nullptr;
+void m_glColor4ub_validation(GLubyte red,GLubyte green,GLubyte blue,GLubyte alpha)const{(this->*(this->m_orig_glColor4ub))(red,green,blue,alpha);this->m_checkErrors("glColor4ub");}
+FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC m_orig_glBufferParameteriAPPLE = nullptr;
+void m_glBufferParameteriAPPLE_validation(GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glBufferParameteriAPPLE))(target,pname,param);this->m_checkErrors("glBufferParameteriAPPLE");}
+FunctionTable::MEMBERPFNGLCOLOR4UIPROC m_orig_glColor4ui = nullptr;
+void m_glColor4ui_validation(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{(this->*(this->m_orig_glColor4ui))(red,green,blue,alpha);this->m_checkErrors("glColor4ui");}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC m_orig_glGetInternalformativ = nullptr;
+void m_glGetInternalformativ_validation(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint* params)const{(this->*(this->m_orig_glGetInternalformativ))(target,internalformat,pname,bufSize,params);this->m_checkErrors("glGetInternalformativ");}
+FunctionTable::MEMBERPFNGLCOLOR4USPROC m_orig_glColor4us = nullptr;
+void m_glColor4us_validation(GLushort red,GLushort green,GLushort blue,GLushort alpha)const{(this->*(this->m_orig_glColor4us))(red,green,blue,alpha);this->m_checkErrors("glColor4us");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC m_orig_glVertexAttribP1uiv = nullptr;
+void m_glVertexAttribP1uiv_validation(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{(this->*(this->m_orig_glVertexAttribP1uiv))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP1uiv");}
+FunctionTable::MEMBERPFNGLLINKPROGRAMPROC m_orig_glLinkProgram = nullptr;
+void m_glLinkProgram_validation(GLuint program)const{(this->*(this->m_orig_glLinkProgram))(program);this->m_checkErrors("glLinkProgram");}
+FunctionTable::MEMBERPFNGLTEXCOORD3SPROC m_orig_glTexCoord3s = nullptr;
+void m_glTexCoord3s_validation(GLshort s,GLshort t,GLshort r)const{(this->*(this->m_orig_glTexCoord3s))(s,t,r);this->m_checkErrors("glTexCoord3s");}
+FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC m_orig_glTexCoord2dv = nullptr;
+void m_glTexCoord2dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glTexCoord2dv))(v);this->m_checkErrors("glTexCoord2dv");}
+FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC m_orig_glGetObjectLabel = nullptr;
+void m_glGetObjectLabel_validation(GLenum identifier,GLuint name,GLsizei bufSize,GLsizei* length,GLchar* label)const{(this->*(this->m_orig_glGetObjectLabel))(identifier,name,bufSize,length,label);this->m_checkErrors("glGetObjectLabel");}
+FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC m_orig_glVertexPointerEXT = nullptr;
+void m_glVertexPointerEXT_validation(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{(this->*(this->m_orig_glVertexPointerEXT))(size,type,stride,count,pointer);this->m_checkErrors("glVertexPointerEXT");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC m_orig_glDebugMessageCallbackARB = nullptr;
+void m_glDebugMessageCallbackARB_validation(GLDEBUGPROCARB callback,const void* userParam)const{(this->*(this->m_orig_glDebugMessageCallbackARB))(callback,userParam);this->m_checkErrors("glDebugMessageCallbackARB");}
+FunctionTable::MEMBERPFNGLGETSTRINGPROC m_orig_glGetString = nullptr;
+const GLubyte* m_glGetString_validation(GLenum name)const{const GLubyte* const result = (this->*(this->m_orig_glGetString))(name);this->m_checkErrors("glGetString");return result;}
+FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC m_orig_glGetPathParameterfvNV = nullptr;
+void m_glGetPathParameterfvNV_validation(GLuint path,GLenum pname,GLfloat* value)const{(this->*(this->m_orig_glGetPathParameterfvNV))(path,pname,value);this->m_checkErrors("glGetPathParameterfvNV");}
+FunctionTable::MEMBERPFNGLLIGHTXVOESPROC m_orig_glLightxvOES = nullptr;
+void m_glLightxvOES_validation(GLenum light,GLenum pname,const GLfixed* params)const{(this->*(this->m_orig_glLightxvOES))(light,pname,params);this->m_checkErrors("glLightxvOES");}
+FunctionTable::MEMBERPFNGLENDQUERYPROC m_orig_glEndQuery = nullptr;
+void m_glEndQuery_validation(GLenum target)const{(this->*(this->m_orig_glEndQuery))(target);this->m_checkErrors("glEndQuery");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC m_orig_glSecondaryColor3uiv = nullptr;
+void m_glSecondaryColor3uiv_validation(const GLuint* v)const{(this->*(this->m_orig_glSecondaryColor3uiv))(v);this->m_checkErrors("glSecondaryColor3uiv");}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC m_orig_glPrioritizeTexturesxOES = nullptr;
+void m_glPrioritizeTexturesxOES_validation(GLsizei n,const GLuint* textures,const GLfixed* priorities)const{(this->*(this->m_orig_glPrioritizeTexturesxOES))(n,textures,priorities);this->m_checkErrors("glPrioritizeTexturesxOES");}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC m_orig_glEdgeFlagPointer = nullptr;
+void m_glEdgeFlagPointer_validation(GLsizei stride,const GLvoid* ptr)const{(this->*(this->m_orig_glEdgeFlagPointer))(stride,ptr);this->m_checkErrors("glEdgeFlagPointer");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC m_orig_glFramebufferParameteri = nullptr;
+void m_glFramebufferParameteri_validation(GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glFramebufferParameteri))(target,pname,param);this->m_checkErrors("glFramebufferParameteri");}
+FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC m_orig_glTexCoord3hNV = nullptr;
+void m_glTexCoord3hNV_validation(GLhalfNV s,GLhalfNV t,GLhalfNV r)const{(this->*(this->m_orig_glTexCoord3hNV))(s,t,r);this->m_checkErrors("glTexCoord3hNV");}
+FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC m_orig_glMultiModeDrawElementsIBM = nullptr;
+void m_glMultiModeDrawElementsIBM_validation(const GLenum* mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount,GLint modestride)const{(this->*(this->m_orig_glMultiModeDrawElementsIBM))(mode,count,type,indices,primcount,modestride);this->m_checkErrors("glMultiModeDrawElementsIBM");}
+FunctionTable::MEMBERPFNGLCOPYPIXELSPROC m_orig_glCopyPixels = nullptr;
+void m_glCopyPixels_validation(GLint x,GLint y,GLsizei width,GLsizei height,GLenum type)const{(this->*(this->m_orig_glCopyPixels))(x,y,width,height,type);this->m_checkErrors("glCopyPixels");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC m_orig_glVertexAttribI2ui = nullptr;
+void m_glVertexAttribI2ui_validation(GLuint index,GLuint x,GLuint y)const{(this->*(this->m_orig_glVertexAttribI2ui))(index,x,y);this->m_checkErrors("glVertexAttribI2ui");}
+FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC m_orig_glClampColorARB = nullptr;
+void m_glClampColorARB_validation(GLenum target,GLenum clamp)const{(this->*(this->m_orig_glClampColorARB))(target,clamp);this->m_checkErrors("glClampColorARB");}
+FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC m_orig_glColorPointervINTEL = nullptr;
+void m_glColorPointervINTEL_validation(GLint size,GLenum type,const void** pointer)const{(this->*(this->m_orig_glColorPointervINTEL))(size,type,pointer);this->m_checkErrors("glColorPointervINTEL");}
+FunctionTable::MEMBERPFNGLDELETETEXTURESPROC m_orig_glDeleteTextures = nullptr;
+void m_glDeleteTextures_validation(GLsizei n,const GLuint* textures)const{(this->*(this->m_orig_glDeleteTextures))(n,textures);this->m_checkErrors("glDeleteTextures");}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC m_orig_glGetMinmaxParameterfvEXT = nullptr;
+void m_glGetMinmaxParameterfvEXT_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMinmaxParameterfvEXT))(target,pname,params);this->m_checkErrors("glGetMinmaxParameterfvEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC m_orig_glWindowPos3sMESA = nullptr;
+void m_glWindowPos3sMESA_validation(GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glWindowPos3sMESA))(x,y,z);this->m_checkErrors("glWindowPos3sMESA");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC m_orig_glVertexAttrib4f = nullptr;
+void m_glVertexAttrib4f_validation(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glVertexAttrib4f))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4f");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC m_orig_glNamedFramebufferParameteri = nullptr;
+void m_glNamedFramebufferParameteri_validation(GLuint framebuffer,GLenum pname,GLint param)const{(this->*(this->m_orig_glNamedFramebufferParameteri))(framebuffer,pname,param);this->m_checkErrors("glNamedFramebufferParameteri");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC m_orig_glTexCoord2fVertex3fvSUN = nullptr;
+void m_glTexCoord2fVertex3fvSUN_validation(const GLfloat* tc,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord2fVertex3fvSUN))(tc,v);this->m_checkErrors("glTexCoord2fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC m_orig_glReplacementCodeusSUN = nullptr;
+void m_glReplacementCodeusSUN_validation(GLushort code)const{(this->*(this->m_orig_glReplacementCodeusSUN))(code);this->m_checkErrors("glReplacementCodeusSUN");}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC m_orig_glGetNamedFramebufferParameteriv = nullptr;
+void m_glGetNamedFramebufferParameteriv_validation(GLuint framebuffer,GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetNamedFramebufferParameteriv))(framebuffer,pname,param);this->m_checkErrors("glGetNamedFramebufferParameteriv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC m_orig_glVertexStream1fvATI = nullptr;
+void m_glVertexStream1fvATI_validation(GLenum stream,const GLfloat* coords)const{(this->*(this->m_orig_glVertexStream1fvATI))(stream,coords);this->m_checkErrors("glVertexStream1fvATI");}
+FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC m_orig_glCreateVertexArrays = nullptr;
+void m_glCreateVertexArrays_validation(GLsizei n,GLuint* arrays)const{(this->*(this->m_orig_glCreateVertexArrays))(n,arrays);this->m_checkErrors("glCreateVertexArrays");}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC m_orig_glBeginConditionalRender = nullptr;
+void m_glBeginConditionalRender_validation(GLuint id,GLenum mode)const{(this->*(this->m_orig_glBeginConditionalRender))(id,mode);this->m_checkErrors("glBeginConditionalRender");}
+FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC m_orig_glGetUnsignedBytevEXT = nullptr;
+void m_glGetUnsignedBytevEXT_validation(GLenum pname,GLubyte* data)const{(this->*(this->m_orig_glGetUnsignedBytevEXT))(pname,data);this->m_checkErrors("glGetUnsignedBytevEXT");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC m_orig_glConvolutionFilter1D = nullptr;
+void m_glConvolutionFilter1D_validation(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* image)const{(this->*(this->m_orig_glConvolutionFilter1D))(target,internalformat,width,format,type,image);this->m_checkErrors("glConvolutionFilter1D");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC m_orig_glMultiTexCoord3fARB = nullptr;
+void m_glMultiTexCoord3fARB_validation(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{(this->*(this->m_orig_glMultiTexCoord3fARB))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3fARB");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC m_orig_glGetQueryObjectuivARB = nullptr;
+void m_glGetQueryObjectuivARB_validation(GLuint id,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetQueryObjectuivARB))(id,pname,params);this->m_checkErrors("glGetQueryObjectuivARB");}
+FunctionTable::MEMBERPFNGLSCALEXOESPROC m_orig_glScalexOES = nullptr;
+void m_glScalexOES_validation(GLfixed x,GLfixed y,GLfixed z)const{(this->*(this->m_orig_glScalexOES))(x,y,z);this->m_checkErrors("glScalexOES");}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC m_orig_glSamplerParameteri = nullptr;
+void m_glSamplerParameteri_validation(GLuint sampler,GLenum pname,GLint param)const{(this->*(this->m_orig_glSamplerParameteri))(sampler,pname,param);this->m_checkErrors("glSamplerParameteri");}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC m_orig_glSamplerParameterf = nullptr;
+void m_glSamplerParameterf_validation(GLuint sampler,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glSamplerParameterf))(sampler,pname,param);this->m_checkErrors("glSamplerParameterf");}
+FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC m_orig_glShaderOp1EXT = nullptr;
+void m_glShaderOp1EXT_validation(GLenum op,GLuint res,GLuint arg1)const{(this->*(this->m_orig_glShaderOp1EXT))(op,res,arg1);this->m_checkErrors("glShaderOp1EXT");}
+FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC m_orig_glBeginVideoCaptureNV = nullptr;
+void m_glBeginVideoCaptureNV_validation(GLuint video_capture_slot)const{(this->*(this->m_orig_glBeginVideoCaptureNV))(video_capture_slot);this->m_checkErrors("glBeginVideoCaptureNV");}
+FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC m_orig_glGetnHistogram = nullptr;
+void m_glGetnHistogram_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{(this->*(this->m_orig_glGetnHistogram))(target,reset,format,type,bufSize,values);this->m_checkErrors("glGetnHistogram");}
+FunctionTable::MEMBERPFNGLUNIFORM1DPROC m_orig_glUniform1d = nullptr;
+void m_glUniform1d_validation(GLint location,GLdouble x)const{(this->*(this->m_orig_glUniform1d))(location,x);this->m_checkErrors("glUniform1d");}
+FunctionTable::MEMBERPFNGLRENDERMODEPROC m_orig_glRenderMode = nullptr;
+GLint m_glRenderMode_validation(GLenum mode)const{GLint const result = (this->*(this->m_orig_glRenderMode))(mode);this->m_checkErrors("glRenderMode");return result;}
+FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC m_orig_glClearColorIiEXT = nullptr;
+void m_glClearColorIiEXT_validation(GLint red,GLint green,GLint blue,GLint alpha)const{(this->*(this->m_orig_glClearColorIiEXT))(red,green,blue,alpha);this->m_checkErrors("glClearColorIiEXT");}
+FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC m_orig_glSignalSemaphoreEXT = nullptr;
+void m_glSignalSemaphoreEXT_validation(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* dstLayouts)const{(this->*(this->m_orig_glSignalSemaphoreEXT))(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,dstLayouts);this->m_checkErrors("glSignalSemaphoreEXT");}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC m_orig_glGetCompressedTexImage = nullptr;
+void m_glGetCompressedTexImage_validation(GLenum target,GLint lod,GLvoid* img)const{(this->*(this->m_orig_glGetCompressedTexImage))(target,lod,img);this->m_checkErrors("glGetCompressedTexImage");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC m_orig_glCompressedTextureImage1DEXT = nullptr;
+void m_glCompressedTextureImage1DEXT_validation(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedTextureImage1DEXT))(texture,target,level,internalformat,width,border,imageSize,bits);this->m_checkErrors("glCompressedTextureImage1DEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC m_orig_glGetActiveUniformBlockiv = nullptr;
+void m_glGetActiveUniformBlockiv_validation(GLuint program,GLuint uniformBlockIndex,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetActiveUniformBlockiv))(program,uniformBlockIndex,pname,params);this->m_checkErrors("glGetActiveUniformBlockiv");}
+FunctionTable::MEMBERPFNGLUNIFORM1IPROC m_orig_glUniform1i = nullptr;
+void m_glUniform1i_validation(GLint location,GLint v0)const{(this->*(this->m_orig_glUniform1i))(location,v0);this->m_checkErrors("glUniform1i");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC m_orig_glMultiDrawArraysIndirectCount = nullptr;
+void m_glMultiDrawArraysIndirectCount_validation(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawArraysIndirectCount))(mode,indirect,drawcount,maxdrawcount,stride);this->m_checkErrors("glMultiDrawArraysIndirectCount");}
+FunctionTable::MEMBERPFNGLGETTEXENVFVPROC m_orig_glGetTexEnvfv = nullptr;
+void m_glGetTexEnvfv_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTexEnvfv))(target,pname,params);this->m_checkErrors("glGetTexEnvfv");}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC m_orig_glColorTableParameterivSGI = nullptr;
+void m_glColorTableParameterivSGI_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glColorTableParameterivSGI))(target,pname,params);this->m_checkErrors("glColorTableParameterivSGI");}
+FunctionTable::MEMBERPFNGLCULLFACEPROC m_orig_glCullFace = nullptr;
+void m_glCullFace_validation(GLenum mode)const{(this->*(this->m_orig_glCullFace))(mode);this->m_checkErrors("glCullFace");}
+FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC m_orig_glDeleteFencesAPPLE = nullptr;
+void m_glDeleteFencesAPPLE_validation(GLsizei n,const GLuint* fences)const{(this->*(this->m_orig_glDeleteFencesAPPLE))(n,fences);this->m_checkErrors("glDeleteFencesAPPLE");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC m_orig_glProgramUniform4i = nullptr;
+void m_glProgramUniform4i_validation(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{(this->*(this->m_orig_glProgramUniform4i))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4i");}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC m_orig_glUniformHandleui64ARB = nullptr;
+void m_glUniformHandleui64ARB_validation(GLint location,GLuint64 value)const{(this->*(this->m_orig_glUniformHandleui64ARB))(location,value);this->m_checkErrors("glUniformHandleui64ARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC m_orig_glProgramUniform4f = nullptr;
+void m_glProgramUniform4f_validation(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{(this->*(this->m_orig_glProgramUniform4f))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4f");}
+FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC m_orig_glViewportIndexedf = nullptr;
+void m_glViewportIndexedf_validation(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h)const{(this->*(this->m_orig_glViewportIndexedf))(index,x,y,w,h);this->m_checkErrors("glViewportIndexedf");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC m_orig_glProgramUniform4d = nullptr;
+void m_glProgramUniform4d_validation(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2,GLdouble v3)const{(this->*(this->m_orig_glProgramUniform4d))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4d");}
+FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC m_orig_glTexCoord1xOES = nullptr;
+void m_glTexCoord1xOES_validation(GLfixed s)const{(this->*(this->m_orig_glTexCoord1xOES))(s);this->m_checkErrors("glTexCoord1xOES");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC m_orig_glVertexStream3ivATI = nullptr;
+void m_glVertexStream3ivATI_validation(GLenum stream,const GLint* coords)const{(this->*(this->m_orig_glVertexStream3ivATI))(stream,coords);this->m_checkErrors("glVertexStream3ivATI");}
+FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC m_orig_glPointAlongPathNV = nullptr;
+GLboolean m_glPointAlongPathNV_validation(GLuint path,GLsizei startSegment,GLsizei numSegments,GLfloat distance,GLfloat* x,GLfloat* y,GLfloat* tangentX,GLfloat* tangentY)const{GLboolean const result = (this->*(this->m_orig_glPointAlongPathNV))(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);this->m_checkErrors("glPointAlongPathNV");return result;}
+FunctionTable::MEMBERPFNGLENDQUERYARBPROC m_orig_glEndQueryARB = nullptr;
+void m_glEndQueryARB_validation(GLenum target)const{(this->*(this->m_orig_glEndQueryARB))(target);this->m_checkErrors("glEndQueryARB");}
+FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC m_orig_glVDPAUMapSurfacesNV = nullptr;
+void m_glVDPAUMapSurfacesNV_validation(GLsizei numSurfaces,const GLvdpauSurfaceNV* surfaces)const{(this->*(this->m_orig_glVDPAUMapSurfacesNV))(numSurfaces,surfaces);this->m_checkErrors("glVDPAUMapSurfacesNV");}
+FunctionTable::MEMBERPFNGLVERTEX3IPROC m_orig_glVertex3i = nullptr;
+void m_glVertex3i_validation(GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glVertex3i))(x,y,z);this->m_checkErrors("glVertex3i");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC m_orig_glVertexAttrib4uivARB = nullptr;
+void m_glVertexAttrib4uivARB_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttrib4uivARB))(index,v);this->m_checkErrors("glVertexAttrib4uivARB");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC m_orig_glTextureStorageMem3DEXT = nullptr;
+void m_glTextureStorageMem3DEXT_validation(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTextureStorageMem3DEXT))(texture,levels,internalFormat,width,height,depth,memory,offset);this->m_checkErrors("glTextureStorageMem3DEXT");}
+FunctionTable::MEMBERPFNGLATTACHSHADERPROC m_orig_glAttachShader = nullptr;
+void m_glAttachShader_validation(GLuint program,GLuint shader)const{(this->*(this->m_orig_glAttachShader))(program,shader);this->m_checkErrors("glAttachShader");}
+FunctionTable::MEMBERPFNGLCOLOR4HNVPROC m_orig_glColor4hNV = nullptr;
+void m_glColor4hNV_validation(GLhalfNV red,GLhalfNV green,GLhalfNV blue,GLhalfNV alpha)const{(this->*(this->m_orig_glColor4hNV))(red,green,blue,alpha);this->m_checkErrors("glColor4hNV");}
+FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC m_orig_glGetFenceivNV = nullptr;
+void m_glGetFenceivNV_validation(GLuint fence,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFenceivNV))(fence,pname,params);this->m_checkErrors("glGetFenceivNV");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC m_orig_glTexCoord2fColor4ubVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor4ubVertex3fvSUN_validation(const GLfloat* tc,const GLubyte* c,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord2fColor4ubVertex3fvSUN))(tc,c,v);this->m_checkErrors("glTexCoord2fColor4ubVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC m_orig_glGetColorTable = nullptr;
+void m_glGetColorTable_validation(GLenum target,GLenum format,GLenum type,GLvoid* table)const{(this->*(this->m_orig_glGetColorTable))(target,format,type,table);this->m_checkErrors("glGetColorTable");}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC m_orig_glFogCoordPointer = nullptr;
+void m_glFogCoordPointer_validation(GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glFogCoordPointer))(type,stride,pointer);this->m_checkErrors("glFogCoordPointer");}
+FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC m_orig_glTexStorageSparseAMD = nullptr;
+void m_glTexStorageSparseAMD_validation(GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{(this->*(this->m_orig_glTexStorageSparseAMD))(target,internalFormat,width,height,depth,layers,flags);this->m_checkErrors("glTexStorageSparseAMD");}
+FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC m_orig_glUnmapNamedBuffer = nullptr;
+GLboolean m_glUnmapNamedBuffer_validation(GLuint buffer)const{GLboolean const result = (this->*(this->m_orig_glUnmapNamedBuffer))(buffer);this->m_checkErrors("glUnmapNamedBuffer");return result;}
+FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC m_orig_glTexCoord4bvOES = nullptr;
+void m_glTexCoord4bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glTexCoord4bvOES))(coords);this->m_checkErrors("glTexCoord4bvOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC m_orig_glVertexAttrib3fARB = nullptr;
+void m_glVertexAttrib3fARB_validation(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glVertexAttrib3fARB))(index,x,y,z);this->m_checkErrors("glVertexAttrib3fARB");}
+FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC m_orig_glRasterPos2xOES = nullptr;
+void m_glRasterPos2xOES_validation(GLfixed x,GLfixed y)const{(this->*(this->m_orig_glRasterPos2xOES))(x,y);this->m_checkErrors("glRasterPos2xOES");}
+FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC m_orig_glCreateMemoryObjectsEXT = nullptr;
+void m_glCreateMemoryObjectsEXT_validation(GLsizei n,GLuint* memoryObjects)const{(this->*(this->m_orig_glCreateMemoryObjectsEXT))(n,memoryObjects);this->m_checkErrors("glCreateMemoryObjectsEXT");}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC m_orig_glColor4ubVertex2fvSUN = nullptr;
+void m_glColor4ubVertex2fvSUN_validation(const GLubyte* c,const GLfloat* v)const{(this->*(this->m_orig_glColor4ubVertex2fvSUN))(c,v);this->m_checkErrors("glColor4ubVertex2fvSUN");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC m_orig_glSecondaryColor3dv = nullptr;
+void m_glSecondaryColor3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glSecondaryColor3dv))(v);this->m_checkErrors("glSecondaryColor3dv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC m_orig_glVertexAttribI4sv = nullptr;
+void m_glVertexAttribI4sv_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttribI4sv))(index,v);this->m_checkErrors("glVertexAttribI4sv");}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC m_orig_glDrawTransformFeedbackStreamInstanced = nullptr;
+void m_glDrawTransformFeedbackStreamInstanced_validation(GLenum mode,GLuint id,GLuint stream,GLsizei instancecount)const{(this->*(this->m_orig_glDrawTransformFeedbackStreamInstanced))(mode,id,stream,instancecount);this->m_checkErrors("glDrawTransformFeedbackStreamInstanced");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC m_orig_glMultiTexCoord4ivARB = nullptr;
+void m_glMultiTexCoord4ivARB_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord4ivARB))(target,v);this->m_checkErrors("glMultiTexCoord4ivARB");}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC m_orig_glSpriteParameterfSGIX = nullptr;
+void m_glSpriteParameterfSGIX_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glSpriteParameterfSGIX))(pname,param);this->m_checkErrors("glSpriteParameterfSGIX");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC m_orig_glSecondaryColor3sv = nullptr;
+void m_glSecondaryColor3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glSecondaryColor3sv))(v);this->m_checkErrors("glSecondaryColor3sv");}
+FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC m_orig_glBindVideoCaptureStreamTextureNV = nullptr;
+void m_glBindVideoCaptureStreamTextureNV_validation(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLenum target,GLuint texture)const{(this->*(this->m_orig_glBindVideoCaptureStreamTextureNV))(video_capture_slot,stream,frame_region,target,texture);this->m_checkErrors("glBindVideoCaptureStreamTextureNV");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC m_orig_glTexParameterIuiv = nullptr;
+void m_glTexParameterIuiv_validation(GLenum target,GLenum pname,const GLuint* params)const{(this->*(this->m_orig_glTexParameterIuiv))(target,pname,params);this->m_checkErrors("glTexParameterIuiv");}
+FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC m_orig_glFlushPixelDataRangeNV = nullptr;
+void m_glFlushPixelDataRangeNV_validation(GLenum target)const{(this->*(this->m_orig_glFlushPixelDataRangeNV))(target);this->m_checkErrors("glFlushPixelDataRangeNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC m_orig_glWindowPos3fv = nullptr;
+void m_glWindowPos3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos3fv))(v);this->m_checkErrors("glWindowPos3fv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC m_orig_glVertexAttribLFormatNV = nullptr;
+void m_glVertexAttribLFormatNV_validation(GLuint index,GLint size,GLenum type,GLsizei stride)const{(this->*(this->m_orig_glVertexAttribLFormatNV))(index,size,type,stride);this->m_checkErrors("glVertexAttribLFormatNV");}
+FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC m_orig_glLightModelfv = nullptr;
+void m_glLightModelfv_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glLightModelfv))(pname,params);this->m_checkErrors("glLightModelfv");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC m_orig_glGetColorTableSGI = nullptr;
+void m_glGetColorTableSGI_validation(GLenum target,GLenum format,GLenum type,void* table)const{(this->*(this->m_orig_glGetColorTableSGI))(target,format,type,table);this->m_checkErrors("glGetColorTableSGI");}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC m_orig_glGetCompressedTexImageARB = nullptr;
+void m_glGetCompressedTexImageARB_validation(GLenum target,GLint level,void* img)const{(this->*(this->m_orig_glGetCompressedTexImageARB))(target,level,img);this->m_checkErrors("glGetCompressedTexImageARB");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC m_orig_glConvolutionParameteri = nullptr;
+void m_glConvolutionParameteri_validation(GLenum target,GLenum pname,GLint params)const{(this->*(this->m_orig_glConvolutionParameteri))(target,pname,params);this->m_checkErrors("glConvolutionParameteri");}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC m_orig_glVertexWeighthNV = nullptr;
+void m_glVertexWeighthNV_validation(GLhalfNV weight)const{(this->*(this->m_orig_glVertexWeighthNV))(weight);this->m_checkErrors("glVertexWeighthNV");}
+FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC m_orig_glColorMaskIndexedEXT = nullptr;
+void m_glColorMaskIndexedEXT_validation(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{(this->*(this->m_orig_glColorMaskIndexedEXT))(index,r,g,b,a);this->m_checkErrors("glColorMaskIndexedEXT");}
+FunctionTable::MEMBERPFNGLCOLORMASKIPROC m_orig_glColorMaski = nullptr;
+void m_glColorMaski_validation(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{(this->*(this->m_orig_glColorMaski))(index,r,g,b,a);this->m_checkErrors("glColorMaski");}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC m_orig_glColorFragmentOp1ATI = nullptr;
+void m_glColorFragmentOp1ATI_validation(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{(this->*(this->m_orig_glColorFragmentOp1ATI))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);this->m_checkErrors("glColorFragmentOp1ATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC m_orig_glVertexAttribI4ubvEXT = nullptr;
+void m_glVertexAttribI4ubvEXT_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttribI4ubvEXT))(index,v);this->m_checkErrors("glVertexAttribI4ubvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC m_orig_glVertexAttrib1dNV = nullptr;
+void m_glVertexAttrib1dNV_validation(GLuint index,GLdouble x)const{(this->*(this->m_orig_glVertexAttrib1dNV))(index,x);this->m_checkErrors("glVertexAttrib1dNV");}
+FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC m_orig_glUnmapObjectBufferATI = nullptr;
+void m_glUnmapObjectBufferATI_validation(GLuint buffer)const{(this->*(this->m_orig_glUnmapObjectBufferATI))(buffer);this->m_checkErrors("glUnmapObjectBufferATI");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC m_orig_glNamedProgramLocalParameterI4uiEXT = nullptr;
+void m_glNamedProgramLocalParameterI4uiEXT_validation(GLuint program,GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{(this->*(this->m_orig_glNamedProgramLocalParameterI4uiEXT))(program,target,index,x,y,z,w);this->m_checkErrors("glNamedProgramLocalParameterI4uiEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC m_orig_glProgramUniform1iEXT = nullptr;
+void m_glProgramUniform1iEXT_validation(GLuint program,GLint location,GLint v0)const{(this->*(this->m_orig_glProgramUniform1iEXT))(program,location,v0);this->m_checkErrors("glProgramUniform1iEXT");}
+FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC m_orig_glDeleteQueriesARB = nullptr;
+void m_glDeleteQueriesARB_validation(GLsizei n,const GLuint* ids)const{(this->*(this->m_orig_glDeleteQueriesARB))(n,ids);this->m_checkErrors("glDeleteQueriesARB");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC m_orig_glWindowPos3svARB = nullptr;
+void m_glWindowPos3svARB_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos3svARB))(v);this->m_checkErrors("glWindowPos3svARB");}
+FunctionTable::MEMBERPFNGLVERTEX4SPROC m_orig_glVertex4s = nullptr;
+void m_glVertex4s_validation(GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glVertex4s))(x,y,z,w);this->m_checkErrors("glVertex4s");}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC m_orig_glImportMemoryWin32NameEXT = nullptr;
+void m_glImportMemoryWin32NameEXT_validation(GLuint memory,GLuint64 size,GLenum handleType,const void* name)const{(this->*(this->m_orig_glImportMemoryWin32NameEXT))(memory,size,handleType,name);this->m_checkErrors("glImportMemoryWin32NameEXT");}
+FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC m_orig_glStringMarkerGREMEDY = nullptr;
+void m_glStringMarkerGREMEDY_validation(GLsizei len,const void* string)const{(this->*(this->m_orig_glStringMarkerGREMEDY))(len,string);this->m_checkErrors("glStringMarkerGREMEDY");}
+FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC m_orig_glIsTransformFeedback = nullptr;
+GLboolean m_glIsTransformFeedback_validation(GLuint id)const{GLboolean const result = (this->*(this->m_orig_glIsTransformFeedback))(id);this->m_checkErrors("glIsTransformFeedback");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC m_orig_glProgramUniformMatrix2x3dvEXT = nullptr;
+void m_glProgramUniformMatrix2x3dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x3dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x3dvEXT");}
+FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC m_orig_glGetObjectLabelEXT = nullptr;
+void m_glGetObjectLabelEXT_validation(GLenum type,GLuint object,GLsizei bufSize,GLsizei* length,GLchar* label)const{(this->*(this->m_orig_glGetObjectLabelEXT))(type,object,bufSize,length,label);this->m_checkErrors("glGetObjectLabelEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC m_orig_glUniformHandleui64vNV = nullptr;
+void m_glUniformHandleui64vNV_validation(GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glUniformHandleui64vNV))(location,count,value);this->m_checkErrors("glUniformHandleui64vNV");}
+FunctionTable::MEMBERPFNGLROTATEDPROC m_orig_glRotated = nullptr;
+void m_glRotated_validation(GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glRotated))(angle,x,y,z);this->m_checkErrors("glRotated");}
+FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC m_orig_glIsProgramPipeline = nullptr;
+GLboolean m_glIsProgramPipeline_validation(GLuint pipeline)const{GLboolean const result = (this->*(this->m_orig_glIsProgramPipeline))(pipeline);this->m_checkErrors("glIsProgramPipeline");return result;}
+FunctionTable::MEMBERPFNGLROTATEFPROC m_orig_glRotatef = nullptr;
+void m_glRotatef_validation(GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glRotatef))(angle,x,y,z);this->m_checkErrors("glRotatef");}
+FunctionTable::MEMBERPFNGLVERTEX4IPROC m_orig_glVertex4i = nullptr;
+void m_glVertex4i_validation(GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glVertex4i))(x,y,z,w);this->m_checkErrors("glVertex4i");}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC m_orig_glGetActiveSubroutineUniformName = nullptr;
+void m_glGetActiveSubroutineUniformName_validation(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{(this->*(this->m_orig_glGetActiveSubroutineUniformName))(program,shadertype,index,bufsize,length,name);this->m_checkErrors("glGetActiveSubroutineUniformName");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC m_orig_glVertexAttrib4sNV = nullptr;
+void m_glVertexAttrib4sNV_validation(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glVertexAttrib4sNV))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4sNV");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC m_orig_glProgramLocalParameter4dvARB = nullptr;
+void m_glProgramLocalParameter4dvARB_validation(GLenum target,GLuint index,const GLdouble* params)const{(this->*(this->m_orig_glProgramLocalParameter4dvARB))(target,index,params);this->m_checkErrors("glProgramLocalParameter4dvARB");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC m_orig_glReplacementCodeubSUN = nullptr;
+void m_glReplacementCodeubSUN_validation(GLubyte code)const{(this->*(this->m_orig_glReplacementCodeubSUN))(code);this->m_checkErrors("glReplacementCodeubSUN");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC m_orig_glMultiDrawElementsIndirectBindlessNV = nullptr;
+void m_glMultiDrawElementsIndirectBindlessNV_validation(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{(this->*(this->m_orig_glMultiDrawElementsIndirectBindlessNV))(mode,type,indirect,drawCount,stride,vertexBufferCount);this->m_checkErrors("glMultiDrawElementsIndirectBindlessNV");}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC m_orig_glImportSemaphoreWin32HandleEXT = nullptr;
+void m_glImportSemaphoreWin32HandleEXT_validation(GLuint semaphore,GLenum handleType,void* handle)const{(this->*(this->m_orig_glImportSemaphoreWin32HandleEXT))(semaphore,handleType,handle);this->m_checkErrors("glImportSemaphoreWin32HandleEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC m_orig_glUniformMatrix3fv = nullptr;
+void m_glUniformMatrix3fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix3fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3fv");}
+FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC m_orig_glGetnMapfvARB = nullptr;
+void m_glGetnMapfvARB_validation(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{(this->*(this->m_orig_glGetnMapfvARB))(target,query,bufSize,v);this->m_checkErrors("glGetnMapfvARB");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC m_orig_glGetnUniformfv = nullptr;
+void m_glGetnUniformfv_validation(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{(this->*(this->m_orig_glGetnUniformfv))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformfv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC m_orig_glVertexAttribL2dv = nullptr;
+void m_glVertexAttribL2dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL2dv))(index,v);this->m_checkErrors("glVertexAttribL2dv");}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC m_orig_glVertexWeightPointerEXT = nullptr;
+void m_glVertexWeightPointerEXT_validation(GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexWeightPointerEXT))(size,type,stride,pointer);this->m_checkErrors("glVertexWeightPointerEXT");}
+FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC m_orig_glTangent3sEXT = nullptr;
+void m_glTangent3sEXT_validation(GLshort tx,GLshort ty,GLshort tz)const{(this->*(this->m_orig_glTangent3sEXT))(tx,ty,tz);this->m_checkErrors("glTangent3sEXT");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC m_orig_glSecondaryColorPointer = nullptr;
+void m_glSecondaryColorPointer_validation(GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glSecondaryColorPointer))(size,type,stride,pointer);this->m_checkErrors("glSecondaryColorPointer");}
+FunctionTable::MEMBERPFNGLALPHAFUNCPROC m_orig_glAlphaFunc = nullptr;
+void m_glAlphaFunc_validation(GLenum func,GLclampf ref)const{(this->*(this->m_orig_glAlphaFunc))(func,ref);this->m_checkErrors("glAlphaFunc");}
+FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC m_orig_glGetNamedStringARB = nullptr;
+void m_glGetNamedStringARB_validation(GLint namelen,const GLchar* name,GLsizei bufSize,GLint* stringlen,GLchar* string)const{(this->*(this->m_orig_glGetNamedStringARB))(namelen,name,bufSize,stringlen,string);this->m_checkErrors("glGetNamedStringARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD4DPROC m_orig_glTexCoord4d = nullptr;
+void m_glTexCoord4d_validation(GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{(this->*(this->m_orig_glTexCoord4d))(s,t,r,q);this->m_checkErrors("glTexCoord4d");}
+FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC m_orig_glBufferPageCommitmentARB = nullptr;
+void m_glBufferPageCommitmentARB_validation(GLenum target,GLintptr offset,GLsizeiptr size,GLboolean commit)const{(this->*(this->m_orig_glBufferPageCommitmentARB))(target,offset,size,commit);this->m_checkErrors("glBufferPageCommitmentARB");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC m_orig_glProgramLocalParameters4fvEXT = nullptr;
+void m_glProgramLocalParameters4fvEXT_validation(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{(this->*(this->m_orig_glProgramLocalParameters4fvEXT))(target,index,count,params);this->m_checkErrors("glProgramLocalParameters4fvEXT");}
+FunctionTable::MEMBERPFNGLSTENCILFUNCPROC m_orig_glStencilFunc = nullptr;
+void m_glStencilFunc_validation(GLenum func,GLint ref,GLuint mask)const{(this->*(this->m_orig_glStencilFunc))(func,ref,mask);this->m_checkErrors("glStencilFunc");}
+FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC m_orig_glSemaphoreParameterui64vEXT = nullptr;
+void m_glSemaphoreParameterui64vEXT_validation(GLuint semaphore,GLenum pname,const GLuint64* params)const{(this->*(this->m_orig_glSemaphoreParameterui64vEXT))(semaphore,pname,params);this->m_checkErrors("glSemaphoreParameterui64vEXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC m_orig_glGetVertexAttribdvNV = nullptr;
+void m_glGetVertexAttribdvNV_validation(GLuint index,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetVertexAttribdvNV))(index,pname,params);this->m_checkErrors("glGetVertexAttribdvNV");}
+FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC m_orig_glTexCoord3dv = nullptr;
+void m_glTexCoord3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glTexCoord3dv))(v);this->m_checkErrors("glTexCoord3dv");}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC m_orig_glGetQueryBufferObjectiv = nullptr;
+void m_glGetQueryBufferObjectiv_validation(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{(this->*(this->m_orig_glGetQueryBufferObjectiv))(id,buffer,pname,offset);this->m_checkErrors("glGetQueryBufferObjectiv");}
+FunctionTable::MEMBERPFNGLTEXGENXOESPROC m_orig_glTexGenxOES = nullptr;
+void m_glTexGenxOES_validation(GLenum coord,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glTexGenxOES))(coord,pname,param);this->m_checkErrors("glTexGenxOES");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC m_orig_glMultiTexCoord1fvARB = nullptr;
+void m_glMultiTexCoord1fvARB_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord1fvARB))(target,v);this->m_checkErrors("glMultiTexCoord1fvARB");}
+FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC m_orig_glLightEnviSGIX = nullptr;
+void m_glLightEnviSGIX_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glLightEnviSGIX))(pname,param);this->m_checkErrors("glLightEnviSGIX");}
+FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC m_orig_glGetProgramPipelineiv = nullptr;
+void m_glGetProgramPipelineiv_validation(GLuint pipeline,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetProgramPipelineiv))(pipeline,pname,params);this->m_checkErrors("glGetProgramPipelineiv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC m_orig_glVertexStream2ivATI = nullptr;
+void m_glVertexStream2ivATI_validation(GLenum stream,const GLint* coords)const{(this->*(this->m_orig_glVertexStream2ivATI))(stream,coords);this->m_checkErrors("glVertexStream2ivATI");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC m_orig_glGetColorTableEXT = nullptr;
+void m_glGetColorTableEXT_validation(GLenum target,GLenum format,GLenum type,void* data)const{(this->*(this->m_orig_glGetColorTableEXT))(target,format,type,data);this->m_checkErrors("glGetColorTableEXT");}
+FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC m_orig_glGetShaderInfoLog = nullptr;
+void m_glGetShaderInfoLog_validation(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{(this->*(this->m_orig_glGetShaderInfoLog))(shader,bufSize,length,infoLog);this->m_checkErrors("glGetShaderInfoLog");}
+FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC m_orig_glGetOcclusionQueryuivNV = nullptr;
+void m_glGetOcclusionQueryuivNV_validation(GLuint id,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetOcclusionQueryuivNV))(id,pname,params);this->m_checkErrors("glGetOcclusionQueryuivNV");}
+FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC m_orig_glInvalidateNamedFramebufferSubData = nullptr;
+void m_glInvalidateNamedFramebufferSubData_validation(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glInvalidateNamedFramebufferSubData))(framebuffer,numAttachments,attachments,x,y,width,height);this->m_checkErrors("glInvalidateNamedFramebufferSubData");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC m_orig_glVertexAttribL1i64NV = nullptr;
+void m_glVertexAttribL1i64NV_validation(GLuint index,GLint64EXT x)const{(this->*(this->m_orig_glVertexAttribL1i64NV))(index,x);this->m_checkErrors("glVertexAttribL1i64NV");}
+FunctionTable::MEMBERPFNGLVDPAUINITNVPROC m_orig_glVDPAUInitNV = nullptr;
+void m_glVDPAUInitNV_validation(const void* vdpDevice,const void* getProcAddress)const{(this->*(this->m_orig_glVDPAUInitNV))(vdpDevice,getProcAddress);this->m_checkErrors("glVDPAUInitNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC m_orig_glVertexAttrib1hvNV = nullptr;
+void m_glVertexAttrib1hvNV_validation(GLuint index,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttrib1hvNV))(index,v);this->m_checkErrors("glVertexAttrib1hvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC m_orig_glVertexAttribI4i = nullptr;
+void m_glVertexAttribI4i_validation(GLuint index,GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glVertexAttribI4i))(index,x,y,z,w);this->m_checkErrors("glVertexAttribI4i");}
+FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC m_orig_glRasterPos2iv = nullptr;
+void m_glRasterPos2iv_validation(const GLint* v)const{(this->*(this->m_orig_glRasterPos2iv))(v);this->m_checkErrors("glRasterPos2iv");}
+FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC m_orig_glGetIntegerui64i_vNV = nullptr;
+void m_glGetIntegerui64i_vNV_validation(GLenum value,GLuint index,GLuint64EXT* result)const{(this->*(this->m_orig_glGetIntegerui64i_vNV))(value,index,result);this->m_checkErrors("glGetIntegerui64i_vNV");}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC m_orig_glUniformHandleui64NV = nullptr;
+void m_glUniformHandleui64NV_validation(GLint location,GLuint64 value)const{(this->*(this->m_orig_glUniformHandleui64NV))(location,value);this->m_checkErrors("glUniformHandleui64NV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC m_orig_glWindowPos3ivMESA = nullptr;
+void m_glWindowPos3ivMESA_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos3ivMESA))(v);this->m_checkErrors("glWindowPos3ivMESA");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC m_orig_glBlendEquationSeparate = nullptr;
+void m_glBlendEquationSeparate_validation(GLenum modeRGB,GLenum modeAlpha)const{(this->*(this->m_orig_glBlendEquationSeparate))(modeRGB,modeAlpha);this->m_checkErrors("glBlendEquationSeparate");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC m_orig_glDrawElementsInstancedARB = nullptr;
+void m_glDrawElementsInstancedARB_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{(this->*(this->m_orig_glDrawElementsInstancedARB))(mode,count,type,indices,primcount);this->m_checkErrors("glDrawElementsInstancedARB");}
+FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC m_orig_glGetSubroutineIndex = nullptr;
+GLuint m_glGetSubroutineIndex_validation(GLuint program,GLenum shadertype,const GLchar* name)const{GLuint const result = (this->*(this->m_orig_glGetSubroutineIndex))(program,shadertype,name);this->m_checkErrors("glGetSubroutineIndex");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC m_orig_glVertexAttrib2sv = nullptr;
+void m_glVertexAttrib2sv_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib2sv))(index,v);this->m_checkErrors("glVertexAttrib2sv");}
+FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC m_orig_glSamplePatternSGIS = nullptr;
+void m_glSamplePatternSGIS_validation(GLenum pattern)const{(this->*(this->m_orig_glSamplePatternSGIS))(pattern);this->m_checkErrors("glSamplePatternSGIS");}
+FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC m_orig_glEGLImageTargetRenderbufferStorageOES = nullptr;
+void m_glEGLImageTargetRenderbufferStorageOES_validation(GLenum target,GLeglImageOES image)const{(this->*(this->m_orig_glEGLImageTargetRenderbufferStorageOES))(target,image);this->m_checkErrors("glEGLImageTargetRenderbufferStorageOES");}
+FunctionTable::MEMBERPFNGLPUSHATTRIBPROC m_orig_glPushAttrib = nullptr;
+void m_glPushAttrib_validation(GLbitfield mask)const{(this->*(this->m_orig_glPushAttrib))(mask);this->m_checkErrors("glPushAttrib");}
+FunctionTable::MEMBERPFNGLVERTEX3HNVPROC m_orig_glVertex3hNV = nullptr;
+void m_glVertex3hNV_validation(GLhalfNV x,GLhalfNV y,GLhalfNV z)const{(this->*(this->m_orig_glVertex3hNV))(x,y,z);this->m_checkErrors("glVertex3hNV");}
+FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC m_orig_glRasterPos3xvOES = nullptr;
+void m_glRasterPos3xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glRasterPos3xvOES))(coords);this->m_checkErrors("glRasterPos3xvOES");}
+FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC m_orig_glPathParameterfNV = nullptr;
+void m_glPathParameterfNV_validation(GLuint path,GLenum pname,GLfloat value)const{(this->*(this->m_orig_glPathParameterfNV))(path,pname,value);this->m_checkErrors("glPathParameterfNV");}
+FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC m_orig_glGetUniformi64vNV = nullptr;
+void m_glGetUniformi64vNV_validation(GLuint program,GLint location,GLint64EXT* params)const{(this->*(this->m_orig_glGetUniformi64vNV))(program,location,params);this->m_checkErrors("glGetUniformi64vNV");}
+FunctionTable::MEMBERPFNGLLIGHTIVPROC m_orig_glLightiv = nullptr;
+void m_glLightiv_validation(GLenum light,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glLightiv))(light,pname,params);this->m_checkErrors("glLightiv");}
+FunctionTable::MEMBERPFNGLMATERIALXVOESPROC m_orig_glMaterialxvOES = nullptr;
+void m_glMaterialxvOES_validation(GLenum face,GLenum pname,const GLfixed* param)const{(this->*(this->m_orig_glMaterialxvOES))(face,pname,param);this->m_checkErrors("glMaterialxvOES");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC m_orig_glNamedProgramLocalParameter4fEXT = nullptr;
+void m_glNamedProgramLocalParameter4fEXT_validation(GLuint program,GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glNamedProgramLocalParameter4fEXT))(program,target,index,x,y,z,w);this->m_checkErrors("glNamedProgramLocalParameter4fEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC m_orig_glVertexAttribL1dEXT = nullptr;
+void m_glVertexAttribL1dEXT_validation(GLuint index,GLdouble x)const{(this->*(this->m_orig_glVertexAttribL1dEXT))(index,x);this->m_checkErrors("glVertexAttribL1dEXT");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC m_orig_glGetnUniformdvARB = nullptr;
+void m_glGetnUniformdvARB_validation(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{(this->*(this->m_orig_glGetnUniformdvARB))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformdvARB");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC m_orig_glSecondaryColor3bEXT = nullptr;
+void m_glSecondaryColor3bEXT_validation(GLbyte red,GLbyte green,GLbyte blue)const{(this->*(this->m_orig_glSecondaryColor3bEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3bEXT");}
+FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC m_orig_glBeginPerfQueryINTEL = nullptr;
+void m_glBeginPerfQueryINTEL_validation(GLuint queryHandle)const{(this->*(this->m_orig_glBeginPerfQueryINTEL))(queryHandle);this->m_checkErrors("glBeginPerfQueryINTEL");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC m_orig_glProgramUniform1uivEXT = nullptr;
+void m_glProgramUniform1uivEXT_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform1uivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform1uivEXT");}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC m_orig_glImageTransformParameterivHP = nullptr;
+void m_glImageTransformParameterivHP_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glImageTransformParameterivHP))(target,pname,params);this->m_checkErrors("glImageTransformParameterivHP");}
+FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC m_orig_glDeleteBuffers = nullptr;
+void m_glDeleteBuffers_validation(GLsizei n,const GLuint* buffers)const{(this->*(this->m_orig_glDeleteBuffers))(n,buffers);this->m_checkErrors("glDeleteBuffers");}
+FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC m_orig_glBindProgramPipeline = nullptr;
+void m_glBindProgramPipeline_validation(GLuint pipeline)const{(this->*(this->m_orig_glBindProgramPipeline))(pipeline);this->m_checkErrors("glBindProgramPipeline");}
+FunctionTable::MEMBERPFNGLSCISSORPROC m_orig_glScissor = nullptr;
+void m_glScissor_validation(GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glScissor))(x,y,width,height);this->m_checkErrors("glScissor");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC m_orig_glProgramUniform4fv = nullptr;
+void m_glProgramUniform4fv_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform4fv))(program,location,count,value);this->m_checkErrors("glProgramUniform4fv");}
+FunctionTable::MEMBERPFNGLGETBOOLEANVPROC m_orig_glGetBooleanv = nullptr;
+void m_glGetBooleanv_validation(GLenum pname,GLboolean* params)const{(this->*(this->m_orig_glGetBooleanv))(pname,params);this->m_checkErrors("glGetBooleanv");}
+FunctionTable::MEMBERPFNGLMATERIALFVPROC m_orig_glMaterialfv = nullptr;
+void m_glMaterialfv_validation(GLenum face,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glMaterialfv))(face,pname,params);this->m_checkErrors("glMaterialfv");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC m_orig_glWindowPos4fvMESA = nullptr;
+void m_glWindowPos4fvMESA_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos4fvMESA))(v);this->m_checkErrors("glWindowPos4fvMESA");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC m_orig_glVertexAttribIPointerEXT = nullptr;
+void m_glVertexAttribIPointerEXT_validation(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribIPointerEXT))(index,size,type,stride,pointer);this->m_checkErrors("glVertexAttribIPointerEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC m_orig_glProgramBufferParametersfvNV = nullptr;
+void m_glProgramBufferParametersfvNV_validation(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLfloat* params)const{(this->*(this->m_orig_glProgramBufferParametersfvNV))(target,bindingIndex,wordIndex,count,params);this->m_checkErrors("glProgramBufferParametersfvNV");}
+FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC m_orig_glAlphaFuncxOES = nullptr;
+void m_glAlphaFuncxOES_validation(GLenum func,GLfixed ref)const{(this->*(this->m_orig_glAlphaFuncxOES))(func,ref);this->m_checkErrors("glAlphaFuncxOES");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC m_orig_glMultiDrawArraysIndirectAMD = nullptr;
+void m_glMultiDrawArraysIndirectAMD_validation(GLenum mode,const void* indirect,GLsizei primcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawArraysIndirectAMD))(mode,indirect,primcount,stride);this->m_checkErrors("glMultiDrawArraysIndirectAMD");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC m_orig_glNormalStream3ivATI = nullptr;
+void m_glNormalStream3ivATI_validation(GLenum stream,const GLint* coords)const{(this->*(this->m_orig_glNormalStream3ivATI))(stream,coords);this->m_checkErrors("glNormalStream3ivATI");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC m_orig_glTextureImage3DMultisampleNV = nullptr;
+void m_glTextureImage3DMultisampleNV_validation(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{(this->*(this->m_orig_glTextureImage3DMultisampleNV))(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);this->m_checkErrors("glTextureImage3DMultisampleNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC m_orig_glProgramUniform4uivEXT = nullptr;
+void m_glProgramUniform4uivEXT_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform4uivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform4uivEXT");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC m_orig_glReplacementCodeusvSUN = nullptr;
+void m_glReplacementCodeusvSUN_validation(const GLushort* code)const{(this->*(this->m_orig_glReplacementCodeusvSUN))(code);this->m_checkErrors("glReplacementCodeusvSUN");}
+FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC m_orig_glPollInstrumentsSGIX = nullptr;
+GLint m_glPollInstrumentsSGIX_validation(GLint* marker_p)const{GLint const result = (this->*(this->m_orig_glPollInstrumentsSGIX))(marker_p);this->m_checkErrors("glPollInstrumentsSGIX");return result;}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC m_orig_glGetTextureLevelParameteriv = nullptr;
+void m_glGetTextureLevelParameteriv_validation(GLuint texture,GLint level,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTextureLevelParameteriv))(texture,level,pname,params);this->m_checkErrors("glGetTextureLevelParameteriv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC m_orig_glVertexAttribI2uiv = nullptr;
+void m_glVertexAttribI2uiv_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI2uiv))(index,v);this->m_checkErrors("glVertexAttribI2uiv");}
+FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC m_orig_glMapControlPointsNV = nullptr;
+void m_glMapControlPointsNV_validation(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLint uorder,GLint vorder,GLboolean packed,const void* points)const{(this->*(this->m_orig_glMapControlPointsNV))(target,index,type,ustride,vstride,uorder,vorder,packed,points);this->m_checkErrors("glMapControlPointsNV");}
+FunctionTable::MEMBERPFNGLCOLOR4DVPROC m_orig_glColor4dv = nullptr;
+void m_glColor4dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glColor4dv))(v);this->m_checkErrors("glColor4dv");}
+FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC m_orig_glInvalidateBufferSubData = nullptr;
+void m_glInvalidateBufferSubData_validation(GLuint buffer,GLintptr offset,GLsizeiptr length)const{(this->*(this->m_orig_glInvalidateBufferSubData))(buffer,offset,length);this->m_checkErrors("glInvalidateBufferSubData");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC m_orig_glMultiTexCoord1hNV = nullptr;
+void m_glMultiTexCoord1hNV_validation(GLenum target,GLhalfNV s)const{(this->*(this->m_orig_glMultiTexCoord1hNV))(target,s);this->m_checkErrors("glMultiTexCoord1hNV");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC m_orig_glPointParameterfv = nullptr;
+void m_glPointParameterfv_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glPointParameterfv))(pname,params);this->m_checkErrors("glPointParameterfv");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC m_orig_glUniformMatrix2fvARB = nullptr;
+void m_glUniformMatrix2fvARB_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix2fvARB))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2fvARB");}
+FunctionTable::MEMBERPFNGLUNIFORM2FVPROC m_orig_glUniform2fv = nullptr;
+void m_glUniform2fv_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform2fv))(location,count,value);this->m_checkErrors("glUniform2fv");}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC m_orig_glVertexPointerListIBM = nullptr;
+void m_glVertexPointerListIBM_validation(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glVertexPointerListIBM))(size,type,stride,pointer,ptrstride);this->m_checkErrors("glVertexPointerListIBM");}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC m_orig_glGetMultiTexGenfvEXT = nullptr;
+void m_glGetMultiTexGenfvEXT_validation(GLenum texunit,GLenum coord,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMultiTexGenfvEXT))(texunit,coord,pname,params);this->m_checkErrors("glGetMultiTexGenfvEXT");}
+FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC m_orig_glGetMinmaxEXT = nullptr;
+void m_glGetMinmaxEXT_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{(this->*(this->m_orig_glGetMinmaxEXT))(target,reset,format,type,values);this->m_checkErrors("glGetMinmaxEXT");}
+FunctionTable::MEMBERPFNGLISFENCENVPROC m_orig_glIsFenceNV = nullptr;
+GLboolean m_glIsFenceNV_validation(GLuint fence)const{GLboolean const result = (this->*(this->m_orig_glIsFenceNV))(fence);this->m_checkErrors("glIsFenceNV");return result;}
+FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC m_orig_glMatrixFrustumEXT = nullptr;
+void m_glMatrixFrustumEXT_validation(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{(this->*(this->m_orig_glMatrixFrustumEXT))(mode,left,right,bottom,top,zNear,zFar);this->m_checkErrors("glMatrixFrustumEXT");}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC m_orig_glDispatchComputeIndirect = nullptr;
+void m_glDispatchComputeIndirect_validation(GLintptr indirect)const{(this->*(this->m_orig_glDispatchComputeIndirect))(indirect);this->m_checkErrors("glDispatchComputeIndirect");}
+FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC m_orig_glQueryResourceNV = nullptr;
+GLint m_glQueryResourceNV_validation(GLenum queryType,GLint tagId,GLuint bufSize,GLint* buffer)const{GLint const result = (this->*(this->m_orig_glQueryResourceNV))(queryType,tagId,bufSize,buffer);this->m_checkErrors("glQueryResourceNV");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC m_orig_glMultiTexCoord4bOES = nullptr;
+void m_glMultiTexCoord4bOES_validation(GLenum texture,GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{(this->*(this->m_orig_glMultiTexCoord4bOES))(texture,s,t,r,q);this->m_checkErrors("glMultiTexCoord4bOES");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC m_orig_glProgramEnvParameter4dARB = nullptr;
+void m_glProgramEnvParameter4dARB_validation(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glProgramEnvParameter4dARB))(target,index,x,y,z,w);this->m_checkErrors("glProgramEnvParameter4dARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC m_orig_glProgramUniform1uiEXT = nullptr;
+void m_glProgramUniform1uiEXT_validation(GLuint program,GLint location,GLuint v0)const{(this->*(this->m_orig_glProgramUniform1uiEXT))(program,location,v0);this->m_checkErrors("glProgramUniform1uiEXT");}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC m_orig_glBindBufferRange = nullptr;
+void m_glBindBufferRange_validation(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glBindBufferRange))(target,index,buffer,offset,size);this->m_checkErrors("glBindBufferRange");}
+FunctionTable::MEMBERPFNGLNORMAL3IVPROC m_orig_glNormal3iv = nullptr;
+void m_glNormal3iv_validation(const GLint* v)const{(this->*(this->m_orig_glNormal3iv))(v);this->m_checkErrors("glNormal3iv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC m_orig_glVertexAttribL3dv = nullptr;
+void m_glVertexAttribL3dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL3dv))(index,v);this->m_checkErrors("glVertexAttribL3dv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC m_orig_glGetUniformdv = nullptr;
+void m_glGetUniformdv_validation(GLuint program,GLint location,GLdouble* params)const{(this->*(this->m_orig_glGetUniformdv))(program,location,params);this->m_checkErrors("glGetUniformdv");}
+FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC m_orig_glGetMultiTexLevelParameterfvEXT = nullptr;
+void m_glGetMultiTexLevelParameterfvEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMultiTexLevelParameterfvEXT))(texunit,target,level,pname,params);this->m_checkErrors("glGetMultiTexLevelParameterfvEXT");}
+FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC m_orig_glFinalCombinerInputNV = nullptr;
+void m_glFinalCombinerInputNV_validation(GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{(this->*(this->m_orig_glFinalCombinerInputNV))(variable,input,mapping,componentUsage);this->m_checkErrors("glFinalCombinerInputNV");}
+FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC m_orig_glCullParameterdvEXT = nullptr;
+void m_glCullParameterdvEXT_validation(GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glCullParameterdvEXT))(pname,params);this->m_checkErrors("glCullParameterdvEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC m_orig_glMultiTexCoord4s = nullptr;
+void m_glMultiTexCoord4s_validation(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{(this->*(this->m_orig_glMultiTexCoord4s))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4s");}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC m_orig_glMapVertexAttrib1fAPPLE = nullptr;
+void m_glMapVertexAttrib1fAPPLE_validation(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{(this->*(this->m_orig_glMapVertexAttrib1fAPPLE))(index,size,u1,u2,stride,order,points);this->m_checkErrors("glMapVertexAttrib1fAPPLE");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC m_orig_glConvolutionParameterfEXT = nullptr;
+void m_glConvolutionParameterfEXT_validation(GLenum target,GLenum pname,GLfloat params)const{(this->*(this->m_orig_glConvolutionParameterfEXT))(target,pname,params);this->m_checkErrors("glConvolutionParameterfEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC m_orig_glTexCoord1iv = nullptr;
+void m_glTexCoord1iv_validation(const GLint* v)const{(this->*(this->m_orig_glTexCoord1iv))(v);this->m_checkErrors("glTexCoord1iv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC m_orig_glProgramUniform3fvEXT = nullptr;
+void m_glProgramUniform3fvEXT_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform3fvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform3fvEXT");}
+FunctionTable::MEMBERPFNGLCOLOR3UIVPROC m_orig_glColor3uiv = nullptr;
+void m_glColor3uiv_validation(const GLuint* v)const{(this->*(this->m_orig_glColor3uiv))(v);this->m_checkErrors("glColor3uiv");}
+FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC m_orig_glRenderGpuMaskNV = nullptr;
+void m_glRenderGpuMaskNV_validation(GLbitfield mask)const{(this->*(this->m_orig_glRenderGpuMaskNV))(mask);this->m_checkErrors("glRenderGpuMaskNV");}
+FunctionTable::MEMBERPFNGLLISTBASEPROC m_orig_glListBase = nullptr;
+void m_glListBase_validation(GLuint base)const{(this->*(this->m_orig_glListBase))(base);this->m_checkErrors("glListBase");}
+FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC m_orig_glTexCoord2bOES = nullptr;
+void m_glTexCoord2bOES_validation(GLbyte s,GLbyte t)const{(this->*(this->m_orig_glTexCoord2bOES))(s,t);this->m_checkErrors("glTexCoord2bOES");}
+FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC m_orig_glBindMaterialParameterEXT = nullptr;
+GLuint m_glBindMaterialParameterEXT_validation(GLenum face,GLenum value)const{GLuint const result = (this->*(this->m_orig_glBindMaterialParameterEXT))(face,value);this->m_checkErrors("glBindMaterialParameterEXT");return result;}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC m_orig_glGlobalAlphaFactorubSUN = nullptr;
+void m_glGlobalAlphaFactorubSUN_validation(GLubyte factor)const{(this->*(this->m_orig_glGlobalAlphaFactorubSUN))(factor);this->m_checkErrors("glGlobalAlphaFactorubSUN");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC m_orig_glVertexAttribL1ui64NV = nullptr;
+void m_glVertexAttribL1ui64NV_validation(GLuint index,GLuint64EXT x)const{(this->*(this->m_orig_glVertexAttribL1ui64NV))(index,x);this->m_checkErrors("glVertexAttribL1ui64NV");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC m_orig_glPointParameterfSGIS = nullptr;
+void m_glPointParameterfSGIS_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPointParameterfSGIS))(pname,param);this->m_checkErrors("glPointParameterfSGIS");}
+FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC m_orig_glGetImageTransformParameterivHP = nullptr;
+void m_glGetImageTransformParameterivHP_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetImageTransformParameterivHP))(target,pname,params);this->m_checkErrors("glGetImageTransformParameterivHP");}
+FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC m_orig_glColorSubTableEXT = nullptr;
+void m_glColorSubTableEXT_validation(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glColorSubTableEXT))(target,start,count,format,type,data);this->m_checkErrors("glColorSubTableEXT");}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC m_orig_glPixelTexGenParameterfvSGIS = nullptr;
+void m_glPixelTexGenParameterfvSGIS_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glPixelTexGenParameterfvSGIS))(pname,params);this->m_checkErrors("glPixelTexGenParameterfvSGIS");}
+FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC m_orig_glClientWaitSync = nullptr;
+GLenum m_glClientWaitSync_validation(GLsync sync,GLbitfield flags,GLuint64 timeout)const{GLenum const result = (this->*(this->m_orig_glClientWaitSync))(sync,flags,timeout);this->m_checkErrors("glClientWaitSync");return result;}
+FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC m_orig_glQueryObjectParameteruiAMD = nullptr;
+void m_glQueryObjectParameteruiAMD_validation(GLenum target,GLuint id,GLenum pname,GLuint param)const{(this->*(this->m_orig_glQueryObjectParameteruiAMD))(target,id,pname,param);this->m_checkErrors("glQueryObjectParameteruiAMD");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC m_orig_glVertexAttribs1fvNV = nullptr;
+void m_glVertexAttribs1fvNV_validation(GLuint index,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttribs1fvNV))(index,count,v);this->m_checkErrors("glVertexAttribs1fvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC m_orig_glVertexAttrib4NusvARB = nullptr;
+void m_glVertexAttrib4NusvARB_validation(GLuint index,const GLushort* v)const{(this->*(this->m_orig_glVertexAttrib4NusvARB))(index,v);this->m_checkErrors("glVertexAttrib4NusvARB");}
+FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC m_orig_glVariantPointerEXT = nullptr;
+void m_glVariantPointerEXT_validation(GLuint id,GLenum type,GLuint stride,const void* addr)const{(this->*(this->m_orig_glVariantPointerEXT))(id,type,stride,addr);this->m_checkErrors("glVariantPointerEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC m_orig_glTextureBuffer = nullptr;
+void m_glTextureBuffer_validation(GLuint texture,GLenum internalformat,GLuint buffer)const{(this->*(this->m_orig_glTextureBuffer))(texture,internalformat,buffer);this->m_checkErrors("glTextureBuffer");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC m_orig_glVertexAttribI1uiEXT = nullptr;
+void m_glVertexAttribI1uiEXT_validation(GLuint index,GLuint x)const{(this->*(this->m_orig_glVertexAttribI1uiEXT))(index,x);this->m_checkErrors("glVertexAttribI1uiEXT");}
+FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC m_orig_glInvalidateTexImage = nullptr;
+void m_glInvalidateTexImage_validation(GLuint texture,GLint level)const{(this->*(this->m_orig_glInvalidateTexImage))(texture,level);this->m_checkErrors("glInvalidateTexImage");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC m_orig_glProgramEnvParametersI4ivNV = nullptr;
+void m_glProgramEnvParametersI4ivNV_validation(GLenum target,GLuint index,GLsizei count,const GLint* params)const{(this->*(this->m_orig_glProgramEnvParametersI4ivNV))(target,index,count,params);this->m_checkErrors("glProgramEnvParametersI4ivNV");}
+FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC m_orig_glPathGlyphIndexArrayNV = nullptr;
+GLenum m_glPathGlyphIndexArrayNV_validation(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{GLenum const result = (this->*(this->m_orig_glPathGlyphIndexArrayNV))(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);this->m_checkErrors("glPathGlyphIndexArrayNV");return result;}
+FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC m_orig_glCopyImageSubData = nullptr;
+void m_glCopyImageSubData_validation(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{(this->*(this->m_orig_glCopyImageSubData))(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);this->m_checkErrors("glCopyImageSubData");}
+FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC m_orig_glGetUniformSubroutineuiv = nullptr;
+void m_glGetUniformSubroutineuiv_validation(GLenum shadertype,GLint location,GLuint* params)const{(this->*(this->m_orig_glGetUniformSubroutineuiv))(shadertype,location,params);this->m_checkErrors("glGetUniformSubroutineuiv");}
+FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC m_orig_glBindVertexBuffer = nullptr;
+void m_glBindVertexBuffer_validation(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{(this->*(this->m_orig_glBindVertexBuffer))(bindingindex,buffer,offset,stride);this->m_checkErrors("glBindVertexBuffer");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC m_orig_glMultiTexCoord1iARB = nullptr;
+void m_glMultiTexCoord1iARB_validation(GLenum target,GLint s)const{(this->*(this->m_orig_glMultiTexCoord1iARB))(target,s);this->m_checkErrors("glMultiTexCoord1iARB");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC m_orig_glDebugMessageInsert = nullptr;
+void m_glDebugMessageInsert_validation(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{(this->*(this->m_orig_glDebugMessageInsert))(source,type,id,severity,length,buf);this->m_checkErrors("glDebugMessageInsert");}
+FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC m_orig_glBeginVertexShaderEXT = nullptr;
+void m_glBeginVertexShaderEXT_validation()const{(this->*(this->m_orig_glBeginVertexShaderEXT))();this->m_checkErrors("glBeginVertexShaderEXT");}
+FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC m_orig_glIsVariantEnabledEXT = nullptr;
+GLboolean m_glIsVariantEnabledEXT_validation(GLuint id,GLenum cap)const{GLboolean const result = (this->*(this->m_orig_glIsVariantEnabledEXT))(id,cap);this->m_checkErrors("glIsVariantEnabledEXT");return result;}
+FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC m_orig_glPassThroughxOES = nullptr;
+void m_glPassThroughxOES_validation(GLfixed token)const{(this->*(this->m_orig_glPassThroughxOES))(token);this->m_checkErrors("glPassThroughxOES");}
+FunctionTable::MEMBERPFNGLISSAMPLERPROC m_orig_glIsSampler = nullptr;
+GLboolean m_glIsSampler_validation(GLuint sampler)const{GLboolean const result = (this->*(this->m_orig_glIsSampler))(sampler);this->m_checkErrors("glIsSampler");return result;}
+FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC m_orig_glConservativeRasterParameterfNV = nullptr;
+void m_glConservativeRasterParameterfNV_validation(GLenum pname,GLfloat value)const{(this->*(this->m_orig_glConservativeRasterParameterfNV))(pname,value);this->m_checkErrors("glConservativeRasterParameterfNV");}
+FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC m_orig_glMultiTexGenivEXT = nullptr;
+void m_glMultiTexGenivEXT_validation(GLenum texunit,GLenum coord,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMultiTexGenivEXT))(texunit,coord,pname,params);this->m_checkErrors("glMultiTexGenivEXT");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC m_orig_glNamedFramebufferTexture2DEXT = nullptr;
+void m_glNamedFramebufferTexture2DEXT_validation(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{(this->*(this->m_orig_glNamedFramebufferTexture2DEXT))(framebuffer,attachment,textarget,texture,level);this->m_checkErrors("glNamedFramebufferTexture2DEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC m_orig_glCopyTexSubImage1D = nullptr;
+void m_glCopyTexSubImage1D_validation(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyTexSubImage1D))(target,level,xoffset,x,y,width);this->m_checkErrors("glCopyTexSubImage1D");}
+FunctionTable::MEMBERPFNGLTEXCOORD1IPROC m_orig_glTexCoord1i = nullptr;
+void m_glTexCoord1i_validation(GLint s)const{(this->*(this->m_orig_glTexCoord1i))(s);this->m_checkErrors("glTexCoord1i");}
+FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC m_orig_glCheckFramebufferStatus = nullptr;
+GLenum m_glCheckFramebufferStatus_validation(GLenum target)const{GLenum const result = (this->*(this->m_orig_glCheckFramebufferStatus))(target);this->m_checkErrors("glCheckFramebufferStatus");return result;}
+FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC m_orig_glDrawElementArrayAPPLE = nullptr;
+void m_glDrawElementArrayAPPLE_validation(GLenum mode,GLint first,GLsizei count)const{(this->*(this->m_orig_glDrawElementArrayAPPLE))(mode,first,count);this->m_checkErrors("glDrawElementArrayAPPLE");}
+FunctionTable::MEMBERPFNGLTEXCOORD1DPROC m_orig_glTexCoord1d = nullptr;
+void m_glTexCoord1d_validation(GLdouble s)const{(this->*(this->m_orig_glTexCoord1d))(s);this->m_checkErrors("glTexCoord1d");}
+FunctionTable::MEMBERPFNGLTEXCOORD1FPROC m_orig_glTexCoord1f = nullptr;
+void m_glTexCoord1f_validation(GLfloat s)const{(this->*(this->m_orig_glTexCoord1f))(s);this->m_checkErrors("glTexCoord1f");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC m_orig_glFragmentLightivSGIX = nullptr;
+void m_glFragmentLightivSGIX_validation(GLenum light,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glFragmentLightivSGIX))(light,pname,params);this->m_checkErrors("glFragmentLightivSGIX");}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC m_orig_glBindImageTexture = nullptr;
+void m_glBindImageTexture_validation(GLuint unit,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLenum format)const{(this->*(this->m_orig_glBindImageTexture))(unit,texture,level,layered,layer,access,format);this->m_checkErrors("glBindImageTexture");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC m_orig_glTransformFeedbackVaryings = nullptr;
+void m_glTransformFeedbackVaryings_validation(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{(this->*(this->m_orig_glTransformFeedbackVaryings))(program,count,varyings,bufferMode);this->m_checkErrors("glTransformFeedbackVaryings");}
+FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC m_orig_glMulticastBufferSubDataNV = nullptr;
+void m_glMulticastBufferSubDataNV_validation(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const GLvoid* data)const{(this->*(this->m_orig_glMulticastBufferSubDataNV))(gpuMask,buffer,offset,size,data);this->m_checkErrors("glMulticastBufferSubDataNV");}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC m_orig_glDrawRangeElements = nullptr;
+void m_glDrawRangeElements_validation(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const GLvoid* indices)const{(this->*(this->m_orig_glDrawRangeElements))(mode,start,end,count,type,indices);this->m_checkErrors("glDrawRangeElements");}
+FunctionTable::MEMBERPFNGLTEXCOORD1SPROC m_orig_glTexCoord1s = nullptr;
+void m_glTexCoord1s_validation(GLshort s)const{(this->*(this->m_orig_glTexCoord1s))(s);this->m_checkErrors("glTexCoord1s");}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC m_orig_glBindBufferBase = nullptr;
+void m_glBindBufferBase_validation(GLenum target,GLuint index,GLuint buffer)const{(this->*(this->m_orig_glBindBufferBase))(target,index,buffer);this->m_checkErrors("glBindBufferBase");}
+FunctionTable::MEMBERPFNGLCOLOR3BVPROC m_orig_glColor3bv = nullptr;
+void m_glColor3bv_validation(const GLbyte* v)const{(this->*(this->m_orig_glColor3bv))(v);this->m_checkErrors("glColor3bv");}
+FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC m_orig_glSyncTextureINTEL = nullptr;
+void m_glSyncTextureINTEL_validation(GLuint texture)const{(this->*(this->m_orig_glSyncTextureINTEL))(texture);this->m_checkErrors("glSyncTextureINTEL");}
+FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC m_orig_glCreateSamplers = nullptr;
+void m_glCreateSamplers_validation(GLsizei n,GLuint* samplers)const{(this->*(this->m_orig_glCreateSamplers))(n,samplers);this->m_checkErrors("glCreateSamplers");}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC m_orig_glCombinerParameterfNV = nullptr;
+void m_glCombinerParameterfNV_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glCombinerParameterfNV))(pname,param);this->m_checkErrors("glCombinerParameterfNV");}
+FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC m_orig_glGetArrayObjectivATI = nullptr;
+void m_glGetArrayObjectivATI_validation(GLenum array,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetArrayObjectivATI))(array,pname,params);this->m_checkErrors("glGetArrayObjectivATI");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC m_orig_glMultiDrawArrays = nullptr;
+void m_glMultiDrawArrays_validation(GLenum mode,const GLint* first,const GLsizei* count,GLsizei drawcount)const{(this->*(this->m_orig_glMultiDrawArrays))(mode,first,count,drawcount);this->m_checkErrors("glMultiDrawArrays");}
+FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC m_orig_glSampleMapATI = nullptr;
+void m_glSampleMapATI_validation(GLuint dst,GLuint interp,GLenum swizzle)const{(this->*(this->m_orig_glSampleMapATI))(dst,interp,swizzle);this->m_checkErrors("glSampleMapATI");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC m_orig_glProgramUniform2i64ARB = nullptr;
+void m_glProgramUniform2i64ARB_validation(GLuint program,GLint location,GLint64 x,GLint64 y)const{(this->*(this->m_orig_glProgramUniform2i64ARB))(program,location,x,y);this->m_checkErrors("glProgramUniform2i64ARB");}
+FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC m_orig_glBinormal3ivEXT = nullptr;
+void m_glBinormal3ivEXT_validation(const GLint* v)const{(this->*(this->m_orig_glBinormal3ivEXT))(v);this->m_checkErrors("glBinormal3ivEXT");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC m_orig_glMultiDrawArraysIndirectCountARB = nullptr;
+void m_glMultiDrawArraysIndirectCountARB_validation(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawArraysIndirectCountARB))(mode,indirect,drawcount,maxdrawcount,stride);this->m_checkErrors("glMultiDrawArraysIndirectCountARB");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC m_orig_glTextureStorageMem1DEXT = nullptr;
+void m_glTextureStorageMem1DEXT_validation(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTextureStorageMem1DEXT))(texture,levels,internalFormat,width,memory,offset);this->m_checkErrors("glTextureStorageMem1DEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC m_orig_glWindowPos2ivMESA = nullptr;
+void m_glWindowPos2ivMESA_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos2ivMESA))(v);this->m_checkErrors("glWindowPos2ivMESA");}
+FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC m_orig_glTexCoordP4ui = nullptr;
+void m_glTexCoordP4ui_validation(GLenum type,GLuint coords)const{(this->*(this->m_orig_glTexCoordP4ui))(type,coords);this->m_checkErrors("glTexCoordP4ui");}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC m_orig_glMultiTexSubImage1DEXT = nullptr;
+void m_glMultiTexSubImage1DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glMultiTexSubImage1DEXT))(texunit,target,level,xoffset,width,format,type,pixels);this->m_checkErrors("glMultiTexSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC m_orig_glProgramUniformMatrix2x3fvEXT = nullptr;
+void m_glProgramUniformMatrix2x3fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x3fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x3fvEXT");}
+FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC m_orig_glBufferDataARB = nullptr;
+void m_glBufferDataARB_validation(GLenum target,GLsizeiptrARB size,const void* data,GLenum usage)const{(this->*(this->m_orig_glBufferDataARB))(target,size,data,usage);this->m_checkErrors("glBufferDataARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC m_orig_glVertexAttribIFormat = nullptr;
+void m_glVertexAttribIFormat_validation(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexAttribIFormat))(attribindex,size,type,relativeoffset);this->m_checkErrors("glVertexAttribIFormat");}
+FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC m_orig_glCreateFramebuffers = nullptr;
+void m_glCreateFramebuffers_validation(GLsizei n,GLuint* framebuffers)const{(this->*(this->m_orig_glCreateFramebuffers))(n,framebuffers);this->m_checkErrors("glCreateFramebuffers");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC m_orig_glNormalStream3dvATI = nullptr;
+void m_glNormalStream3dvATI_validation(GLenum stream,const GLdouble* coords)const{(this->*(this->m_orig_glNormalStream3dvATI))(stream,coords);this->m_checkErrors("glNormalStream3dvATI");}
+FunctionTable::MEMBERPFNGLCLEARACCUMPROC m_orig_glClearAccum = nullptr;
+void m_glClearAccum_validation(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{(this->*(this->m_orig_glClearAccum))(red,green,blue,alpha);this->m_checkErrors("glClearAccum");}
+FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC m_orig_glUniform3i64vNV = nullptr;
+void m_glUniform3i64vNV_validation(GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glUniform3i64vNV))(location,count,value);this->m_checkErrors("glUniform3i64vNV");}
+FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC m_orig_glNormal3fVertex3fSUN = nullptr;
+void m_glNormal3fVertex3fSUN_validation(GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glNormal3fVertex3fSUN))(nx,ny,nz,x,y,z);this->m_checkErrors("glNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC m_orig_glUniform2uivEXT = nullptr;
+void m_glUniform2uivEXT_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform2uivEXT))(location,count,value);this->m_checkErrors("glUniform2uivEXT");}
+FunctionTable::MEMBERPFNGLBEGINQUERYPROC m_orig_glBeginQuery = nullptr;
+void m_glBeginQuery_validation(GLenum target,GLuint id)const{(this->*(this->m_orig_glBeginQuery))(target,id);this->m_checkErrors("glBeginQuery");}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC m_orig_glStencilThenCoverStrokePathInstancedNV = nullptr;
+void m_glStencilThenCoverStrokePathInstancedNV_validation(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glStencilThenCoverStrokePathInstancedNV))(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);this->m_checkErrors("glStencilThenCoverStrokePathInstancedNV");}
+FunctionTable::MEMBERPFNGLBINDBUFFERPROC m_orig_glBindBuffer = nullptr;
+void m_glBindBuffer_validation(GLenum target,GLuint buffer)const{(this->*(this->m_orig_glBindBuffer))(target,buffer);this->m_checkErrors("glBindBuffer");}
+FunctionTable::MEMBERPFNGLMAP2DPROC m_orig_glMap2d = nullptr;
+void m_glMap2d_validation(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{(this->*(this->m_orig_glMap2d))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->m_checkErrors("glMap2d");}
+FunctionTable::MEMBERPFNGLMAP2FPROC m_orig_glMap2f = nullptr;
+void m_glMap2f_validation(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{(this->*(this->m_orig_glMap2f))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->m_checkErrors("glMap2f");}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC m_orig_glMakeImageHandleResidentNV = nullptr;
+void m_glMakeImageHandleResidentNV_validation(GLuint64 handle,GLenum access)const{(this->*(this->m_orig_glMakeImageHandleResidentNV))(handle,access);this->m_checkErrors("glMakeImageHandleResidentNV");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC m_orig_glUniformMatrix2x4fv = nullptr;
+void m_glUniformMatrix2x4fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix2x4fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2x4fv");}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC m_orig_glGetMultiTexParameterfvEXT = nullptr;
+void m_glGetMultiTexParameterfvEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMultiTexParameterfvEXT))(texunit,target,pname,params);this->m_checkErrors("glGetMultiTexParameterfvEXT");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC m_orig_glDepthRangeIndexed = nullptr;
+void m_glDepthRangeIndexed_validation(GLuint index,GLdouble n,GLdouble f)const{(this->*(this->m_orig_glDepthRangeIndexed))(index,n,f);this->m_checkErrors("glDepthRangeIndexed");}
+FunctionTable::MEMBERPFNGLISENABLEDPROC m_orig_glIsEnabled = nullptr;
+GLboolean m_glIsEnabled_validation(GLenum cap)const{GLboolean const result = (this->*(this->m_orig_glIsEnabled))(cap);this->m_checkErrors("glIsEnabled");return result;}
+FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC m_orig_glMatrixScalefEXT = nullptr;
+void m_glMatrixScalefEXT_validation(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glMatrixScalefEXT))(mode,x,y,z);this->m_checkErrors("glMatrixScalefEXT");}
+FunctionTable::MEMBERPFNGLGETTEXENVIVPROC m_orig_glGetTexEnviv = nullptr;
+void m_glGetTexEnviv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTexEnviv))(target,pname,params);this->m_checkErrors("glGetTexEnviv");}
+FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC m_orig_glBindTextureUnitParameterEXT = nullptr;
+GLuint m_glBindTextureUnitParameterEXT_validation(GLenum unit,GLenum value)const{GLuint const result = (this->*(this->m_orig_glBindTextureUnitParameterEXT))(unit,value);this->m_checkErrors("glBindTextureUnitParameterEXT");return result;}
+FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC m_orig_glGetnUniformfvARB = nullptr;
+void m_glGetnUniformfvARB_validation(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{(this->*(this->m_orig_glGetnUniformfvARB))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformfvARB");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiNormal3fVertex3fvSUN_validation(const GLuint* rc,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiNormal3fVertex3fvSUN))(rc,n,v);this->m_checkErrors("glReplacementCodeuiNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC m_orig_glDeletePerfQueryINTEL = nullptr;
+void m_glDeletePerfQueryINTEL_validation(GLuint queryHandle)const{(this->*(this->m_orig_glDeletePerfQueryINTEL))(queryHandle);this->m_checkErrors("glDeletePerfQueryINTEL");}
+FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC m_orig_glActiveVaryingNV = nullptr;
+void m_glActiveVaryingNV_validation(GLuint program,const GLchar* name)const{(this->*(this->m_orig_glActiveVaryingNV))(program,name);this->m_checkErrors("glActiveVaryingNV");}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC m_orig_glGetActiveUniformARB = nullptr;
+void m_glGetActiveUniformARB_validation(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{(this->*(this->m_orig_glGetActiveUniformARB))(programObj,index,maxLength,length,size,type,name);this->m_checkErrors("glGetActiveUniformARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC m_orig_glVertexAttribI3ivEXT = nullptr;
+void m_glVertexAttribI3ivEXT_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI3ivEXT))(index,v);this->m_checkErrors("glVertexAttribI3ivEXT");}
+FunctionTable::MEMBERPFNGLEVALCOORD1DPROC m_orig_glEvalCoord1d = nullptr;
+void m_glEvalCoord1d_validation(GLdouble u)const{(this->*(this->m_orig_glEvalCoord1d))(u);this->m_checkErrors("glEvalCoord1d");}
+FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC m_orig_glNamedCopyBufferSubDataEXT = nullptr;
+void m_glNamedCopyBufferSubDataEXT_validation(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{(this->*(this->m_orig_glNamedCopyBufferSubDataEXT))(readBuffer,writeBuffer,readOffset,writeOffset,size);this->m_checkErrors("glNamedCopyBufferSubDataEXT");}
+FunctionTable::MEMBERPFNGLEVALCOORD1FPROC m_orig_glEvalCoord1f = nullptr;
+void m_glEvalCoord1f_validation(GLfloat u)const{(this->*(this->m_orig_glEvalCoord1f))(u);this->m_checkErrors("glEvalCoord1f");}
+FunctionTable::MEMBERPFNGLPIXELMAPFVPROC m_orig_glPixelMapfv = nullptr;
+void m_glPixelMapfv_validation(GLenum map,GLsizei mapsize,const GLfloat* values)const{(this->*(this->m_orig_glPixelMapfv))(map,mapsize,values);this->m_checkErrors("glPixelMapfv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC m_orig_glVertexAttribI1ivEXT = nullptr;
+void m_glVertexAttribI1ivEXT_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI1ivEXT))(index,v);this->m_checkErrors("glVertexAttribI1ivEXT");}
+FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC m_orig_glCreateSyncFromCLeventARB = nullptr;
+GLsync m_glCreateSyncFromCLeventARB_validation(struct _cl_context* context,struct _cl_event* event,GLbitfield flags)const{GLsync const result = (this->*(this->m_orig_glCreateSyncFromCLeventARB))(context,event,flags);this->m_checkErrors("glCreateSyncFromCLeventARB");return result;}
+FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC m_orig_glGetPixelMapusv = nullptr;
+void m_glGetPixelMapusv_validation(GLenum map,GLushort* values)const{(this->*(this->m_orig_glGetPixelMapusv))(map,values);this->m_checkErrors("glGetPixelMapusv");}
+FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC m_orig_glGetnColorTableARB = nullptr;
+void m_glGetnColorTableARB_validation(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{(this->*(this->m_orig_glGetnColorTableARB))(target,format,type,bufSize,table);this->m_checkErrors("glGetnColorTableARB");}
+FunctionTable::MEMBERPFNGLACCUMPROC m_orig_glAccum = nullptr;
+void m_glAccum_validation(GLenum op,GLfloat value)const{(this->*(this->m_orig_glAccum))(op,value);this->m_checkErrors("glAccum");}
+FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC m_orig_glRasterPos3sv = nullptr;
+void m_glRasterPos3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glRasterPos3sv))(v);this->m_checkErrors("glRasterPos3sv");}
+FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC m_orig_glTexCoord2iv = nullptr;
+void m_glTexCoord2iv_validation(const GLint* v)const{(this->*(this->m_orig_glTexCoord2iv))(v);this->m_checkErrors("glTexCoord2iv");}
+FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC m_orig_glBlendFunciARB = nullptr;
+void m_glBlendFunciARB_validation(GLuint buf,GLenum src,GLenum dst)const{(this->*(this->m_orig_glBlendFunciARB))(buf,src,dst);this->m_checkErrors("glBlendFunciARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC m_orig_glProgramUniform3i64vARB = nullptr;
+void m_glProgramUniform3i64vARB_validation(GLuint program,GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glProgramUniform3i64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform3i64vARB");}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC m_orig_glGetFramebufferAttachmentParameteriv = nullptr;
+void m_glGetFramebufferAttachmentParameteriv_validation(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFramebufferAttachmentParameteriv))(target,attachment,pname,params);this->m_checkErrors("glGetFramebufferAttachmentParameteriv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC m_orig_glProgramUniform4ui = nullptr;
+void m_glProgramUniform4ui_validation(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{(this->*(this->m_orig_glProgramUniform4ui))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4ui");}
+FunctionTable::MEMBERPFNGLSTENCILMASKPROC m_orig_glStencilMask = nullptr;
+void m_glStencilMask_validation(GLuint mask)const{(this->*(this->m_orig_glStencilMask))(mask);this->m_checkErrors("glStencilMask");}
+FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC m_orig_glResetHistogramEXT = nullptr;
+void m_glResetHistogramEXT_validation(GLenum target)const{(this->*(this->m_orig_glResetHistogramEXT))(target);this->m_checkErrors("glResetHistogramEXT");}
+FunctionTable::MEMBERPFNGLLIGHTXOESPROC m_orig_glLightxOES = nullptr;
+void m_glLightxOES_validation(GLenum light,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glLightxOES))(light,pname,param);this->m_checkErrors("glLightxOES");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC m_orig_glNamedBufferData = nullptr;
+void m_glNamedBufferData_validation(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{(this->*(this->m_orig_glNamedBufferData))(buffer,size,data,usage);this->m_checkErrors("glNamedBufferData");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC m_orig_glVertexStream3sATI = nullptr;
+void m_glVertexStream3sATI_validation(GLenum stream,GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glVertexStream3sATI))(stream,x,y,z);this->m_checkErrors("glVertexStream3sATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC m_orig_glVertexAttrib3fvARB = nullptr;
+void m_glVertexAttrib3fvARB_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib3fvARB))(index,v);this->m_checkErrors("glVertexAttrib3fvARB");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC m_orig_glClearNamedBufferSubData = nullptr;
+void m_glClearNamedBufferSubData_validation(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearNamedBufferSubData))(buffer,internalformat,offset,size,format,type,data);this->m_checkErrors("glClearNamedBufferSubData");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC m_orig_glProgramUniformHandleui64ARB = nullptr;
+void m_glProgramUniformHandleui64ARB_validation(GLuint program,GLint location,GLuint64 value)const{(this->*(this->m_orig_glProgramUniformHandleui64ARB))(program,location,value);this->m_checkErrors("glProgramUniformHandleui64ARB");}
+FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC m_orig_glUniform3iARB = nullptr;
+void m_glUniform3iARB_validation(GLint location,GLint v0,GLint v1,GLint v2)const{(this->*(this->m_orig_glUniform3iARB))(location,v0,v1,v2);this->m_checkErrors("glUniform3iARB");}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC m_orig_glCreateProgramObjectARB = nullptr;
+GLhandleARB m_glCreateProgramObjectARB_validation()const{GLhandleARB const result = (this->*(this->m_orig_glCreateProgramObjectARB))();this->m_checkErrors("glCreateProgramObjectARB");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC m_orig_glMultiTexCoord1dvARB = nullptr;
+void m_glMultiTexCoord1dvARB_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord1dvARB))(target,v);this->m_checkErrors("glMultiTexCoord1dvARB");}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC m_orig_glGetObjectParameterfvARB = nullptr;
+void m_glGetObjectParameterfvARB_validation(GLhandleARB obj,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetObjectParameterfvARB))(obj,pname,params);this->m_checkErrors("glGetObjectParameterfvARB");}
+FunctionTable::MEMBERPFNGLRECTSVPROC m_orig_glRectsv = nullptr;
+void m_glRectsv_validation(const GLshort* v1,const GLshort* v2)const{(this->*(this->m_orig_glRectsv))(v1,v2);this->m_checkErrors("glRectsv");}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC m_orig_glMultiTexImage2DEXT = nullptr;
+void m_glMultiTexImage2DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glMultiTexImage2DEXT))(texunit,target,level,internalformat,width,height,border,format,type,pixels);this->m_checkErrors("glMultiTexImage2DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC m_orig_glProgramUniform1i64NV = nullptr;
+void m_glProgramUniform1i64NV_validation(GLuint program,GLint location,GLint64EXT x)const{(this->*(this->m_orig_glProgramUniform1i64NV))(program,location,x);this->m_checkErrors("glProgramUniform1i64NV");}
+FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC m_orig_glGetObjectBufferivATI = nullptr;
+void m_glGetObjectBufferivATI_validation(GLuint buffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetObjectBufferivATI))(buffer,pname,params);this->m_checkErrors("glGetObjectBufferivATI");}
+FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC m_orig_glUniform4i64ARB = nullptr;
+void m_glUniform4i64ARB_validation(GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{(this->*(this->m_orig_glUniform4i64ARB))(location,x,y,z,w);this->m_checkErrors("glUniform4i64ARB");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC m_orig_glReplacementCodeuiColor4ubVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor4ubVertex3fvSUN_validation(const GLuint* rc,const GLubyte* c,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiColor4ubVertex3fvSUN))(rc,c,v);this->m_checkErrors("glReplacementCodeuiColor4ubVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC m_orig_glBlendFuncSeparateINGR = nullptr;
+void m_glBlendFuncSeparateINGR_validation(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{(this->*(this->m_orig_glBlendFuncSeparateINGR))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);this->m_checkErrors("glBlendFuncSeparateINGR");}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC m_orig_glGetVideoCaptureStreamfvNV = nullptr;
+void m_glGetVideoCaptureStreamfvNV_validation(GLuint video_capture_slot,GLuint stream,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetVideoCaptureStreamfvNV))(video_capture_slot,stream,pname,params);this->m_checkErrors("glGetVideoCaptureStreamfvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC m_orig_glVertexAttrib2fARB = nullptr;
+void m_glVertexAttrib2fARB_validation(GLuint index,GLfloat x,GLfloat y)const{(this->*(this->m_orig_glVertexAttrib2fARB))(index,x,y);this->m_checkErrors("glVertexAttrib2fARB");}
+FunctionTable::MEMBERPFNGLGETTEXGENIVPROC m_orig_glGetTexGeniv = nullptr;
+void m_glGetTexGeniv_validation(GLenum coord,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTexGeniv))(coord,pname,params);this->m_checkErrors("glGetTexGeniv");}
+FunctionTable::MEMBERPFNGLPIXELSTOREIPROC m_orig_glPixelStorei = nullptr;
+void m_glPixelStorei_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glPixelStorei))(pname,param);this->m_checkErrors("glPixelStorei");}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC m_orig_glGetCompressedTextureSubImage = nullptr;
+void m_glGetCompressedTextureSubImage_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei bufSize,void* pixels)const{(this->*(this->m_orig_glGetCompressedTextureSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);this->m_checkErrors("glGetCompressedTextureSubImage");}
+FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC m_orig_glCopyImageSubDataNV = nullptr;
+void m_glCopyImageSubDataNV_validation(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{(this->*(this->m_orig_glCopyImageSubDataNV))(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);this->m_checkErrors("glCopyImageSubDataNV");}
+FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC m_orig_glActiveShaderProgram = nullptr;
+void m_glActiveShaderProgram_validation(GLuint pipeline,GLuint program)const{(this->*(this->m_orig_glActiveShaderProgram))(pipeline,program);this->m_checkErrors("glActiveShaderProgram");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC m_orig_glVertexStream1iATI = nullptr;
+void m_glVertexStream1iATI_validation(GLenum stream,GLint x)const{(this->*(this->m_orig_glVertexStream1iATI))(stream,x);this->m_checkErrors("glVertexStream1iATI");}
+FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC m_orig_glPatchParameterfv = nullptr;
+void m_glPatchParameterfv_validation(GLenum pname,const GLfloat* values)const{(this->*(this->m_orig_glPatchParameterfv))(pname,values);this->m_checkErrors("glPatchParameterfv");}
+FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC m_orig_glIsFramebufferEXT = nullptr;
+GLboolean m_glIsFramebufferEXT_validation(GLuint framebuffer)const{GLboolean const result = (this->*(this->m_orig_glIsFramebufferEXT))(framebuffer);this->m_checkErrors("glIsFramebufferEXT");return result;}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC m_orig_glTextureStorage2D = nullptr;
+void m_glTextureStorage2D_validation(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glTextureStorage2D))(texture,levels,internalformat,width,height);this->m_checkErrors("glTextureStorage2D");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC m_orig_glProgramUniform1ui64ARB = nullptr;
+void m_glProgramUniform1ui64ARB_validation(GLuint program,GLint location,GLuint64 x)const{(this->*(this->m_orig_glProgramUniform1ui64ARB))(program,location,x);this->m_checkErrors("glProgramUniform1ui64ARB");}
+FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC m_orig_glTexBufferRange = nullptr;
+void m_glTexBufferRange_validation(GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glTexBufferRange))(target,internalformat,buffer,offset,size);this->m_checkErrors("glTexBufferRange");}
+FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC m_orig_glGetPixelTexGenParameterivSGIS = nullptr;
+void m_glGetPixelTexGenParameterivSGIS_validation(GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetPixelTexGenParameterivSGIS))(pname,params);this->m_checkErrors("glGetPixelTexGenParameterivSGIS");}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC m_orig_glTextureSubImage3DEXT = nullptr;
+void m_glTextureSubImage3DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureSubImage3DEXT))(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->m_checkErrors("glTextureSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLCLIPCONTROLPROC m_orig_glClipControl = nullptr;
+void m_glClipControl_validation(GLenum origin,GLenum depth)const{(this->*(this->m_orig_glClipControl))(origin,depth);this->m_checkErrors("glClipControl");}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC m_orig_glGetProgramResourceiv = nullptr;
+void m_glGetProgramResourceiv_validation(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLint* params)const{(this->*(this->m_orig_glGetProgramResourceiv))(program,programInterface,index,propCount,props,bufSize,length,params);this->m_checkErrors("glGetProgramResourceiv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC m_orig_glMultiTexCoordP2uiv = nullptr;
+void m_glMultiTexCoordP2uiv_validation(GLenum texture,GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glMultiTexCoordP2uiv))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP2uiv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC m_orig_glVertexAttribI3ui = nullptr;
+void m_glVertexAttribI3ui_validation(GLuint index,GLuint x,GLuint y,GLuint z)const{(this->*(this->m_orig_glVertexAttribI3ui))(index,x,y,z);this->m_checkErrors("glVertexAttribI3ui");}
+FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC m_orig_glSampleMaskSGIS = nullptr;
+void m_glSampleMaskSGIS_validation(GLclampf value,GLboolean invert)const{(this->*(this->m_orig_glSampleMaskSGIS))(value,invert);this->m_checkErrors("glSampleMaskSGIS");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC m_orig_glVertexAttrib4NivARB = nullptr;
+void m_glVertexAttrib4NivARB_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttrib4NivARB))(index,v);this->m_checkErrors("glVertexAttrib4NivARB");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC m_orig_glGlobalAlphaFactorfSUN = nullptr;
+void m_glGlobalAlphaFactorfSUN_validation(GLfloat factor)const{(this->*(this->m_orig_glGlobalAlphaFactorfSUN))(factor);this->m_checkErrors("glGlobalAlphaFactorfSUN");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC m_orig_glBlendEquationSeparateIndexedAMD = nullptr;
+void m_glBlendEquationSeparateIndexedAMD_validation(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{(this->*(this->m_orig_glBlendEquationSeparateIndexedAMD))(buf,modeRGB,modeAlpha);this->m_checkErrors("glBlendEquationSeparateIndexedAMD");}
+FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC m_orig_glGetPerfCounterInfoINTEL = nullptr;
+void m_glGetPerfCounterInfoINTEL_validation(GLuint queryId,GLuint counterId,GLuint counterNameLength,GLchar* counterName,GLuint counterDescLength,GLchar* counterDesc,GLuint* counterOffset,GLuint* counterDataSize,GLuint* counterTypeEnum,GLuint* counterDataTypeEnum,GLuint64* rawCounterMaxValue)const{(this->*(this->m_orig_glGetPerfCounterInfoINTEL))(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);this->m_checkErrors("glGetPerfCounterInfoINTEL");}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC m_orig_glDeleteProgramsNV = nullptr;
+void m_glDeleteProgramsNV_validation(GLsizei n,const GLuint* programs)const{(this->*(this->m_orig_glDeleteProgramsNV))(n,programs);this->m_checkErrors("glDeleteProgramsNV");}
+FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC m_orig_glPixelZoomxOES = nullptr;
+void m_glPixelZoomxOES_validation(GLfixed xfactor,GLfixed yfactor)const{(this->*(this->m_orig_glPixelZoomxOES))(xfactor,yfactor);this->m_checkErrors("glPixelZoomxOES");}
+FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC m_orig_glGetCombinerOutputParameterivNV = nullptr;
+void m_glGetCombinerOutputParameterivNV_validation(GLenum stage,GLenum portion,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetCombinerOutputParameterivNV))(stage,portion,pname,params);this->m_checkErrors("glGetCombinerOutputParameterivNV");}
+FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC m_orig_glRasterPos2xvOES = nullptr;
+void m_glRasterPos2xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glRasterPos2xvOES))(coords);this->m_checkErrors("glRasterPos2xvOES");}
+FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC m_orig_glGetTexImage = nullptr;
+void m_glGetTexImage_validation(GLenum target,GLint level,GLenum format,GLenum type,GLvoid* pixels)const{(this->*(this->m_orig_glGetTexImage))(target,level,format,type,pixels);this->m_checkErrors("glGetTexImage");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC m_orig_glVertexArrayVertexBuffers = nullptr;
+void m_glVertexArrayVertexBuffers_validation(GLuint vaobj,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{(this->*(this->m_orig_glVertexArrayVertexBuffers))(vaobj,first,count,buffers,offsets,strides);this->m_checkErrors("glVertexArrayVertexBuffers");}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC m_orig_glUniform1ui64NV = nullptr;
+void m_glUniform1ui64NV_validation(GLint location,GLuint64EXT x)const{(this->*(this->m_orig_glUniform1ui64NV))(location,x);this->m_checkErrors("glUniform1ui64NV");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC m_orig_glProgramParameteri = nullptr;
+void m_glProgramParameteri_validation(GLuint program,GLenum pname,GLint value)const{(this->*(this->m_orig_glProgramParameteri))(program,pname,value);this->m_checkErrors("glProgramParameteri");}
+FunctionTable::MEMBERPFNGLNORMAL3XOESPROC m_orig_glNormal3xOES = nullptr;
+void m_glNormal3xOES_validation(GLfixed nx,GLfixed ny,GLfixed nz)const{(this->*(this->m_orig_glNormal3xOES))(nx,ny,nz);this->m_checkErrors("glNormal3xOES");}
+FunctionTable::MEMBERPFNGLGETMAPFVPROC m_orig_glGetMapfv = nullptr;
+void m_glGetMapfv_validation(GLenum target,GLenum query,GLfloat* v)const{(this->*(this->m_orig_glGetMapfv))(target,query,v);this->m_checkErrors("glGetMapfv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC m_orig_glVertexStream2dvATI = nullptr;
+void m_glVertexStream2dvATI_validation(GLenum stream,const GLdouble* coords)const{(this->*(this->m_orig_glVertexStream2dvATI))(stream,coords);this->m_checkErrors("glVertexStream2dvATI");}
+FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC m_orig_glPathStencilDepthOffsetNV = nullptr;
+void m_glPathStencilDepthOffsetNV_validation(GLfloat factor,GLfloat units)const{(this->*(this->m_orig_glPathStencilDepthOffsetNV))(factor,units);this->m_checkErrors("glPathStencilDepthOffsetNV");}
+FunctionTable::MEMBERPFNGLISSTATENVPROC m_orig_glIsStateNV = nullptr;
+GLboolean m_glIsStateNV_validation(GLuint state)const{GLboolean const result = (this->*(this->m_orig_glIsStateNV))(state);this->m_checkErrors("glIsStateNV");return result;}
+FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC m_orig_glGetIntegerui64vNV = nullptr;
+void m_glGetIntegerui64vNV_validation(GLenum value,GLuint64EXT* result)const{(this->*(this->m_orig_glGetIntegerui64vNV))(value,result);this->m_checkErrors("glGetIntegerui64vNV");}
+FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC m_orig_glGetImageTransformParameterfvHP = nullptr;
+void m_glGetImageTransformParameterfvHP_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetImageTransformParameterfvHP))(target,pname,params);this->m_checkErrors("glGetImageTransformParameterfvHP");}
+FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC m_orig_glRasterPos2fv = nullptr;
+void m_glRasterPos2fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glRasterPos2fv))(v);this->m_checkErrors("glRasterPos2fv");}
+FunctionTable::MEMBERPFNGLVERTEX3XOESPROC m_orig_glVertex3xOES = nullptr;
+void m_glVertex3xOES_validation(GLfixed x,GLfixed y)const{(this->*(this->m_orig_glVertex3xOES))(x,y);this->m_checkErrors("glVertex3xOES");}
+FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC m_orig_glIsMemoryObjectEXT = nullptr;
+GLboolean m_glIsMemoryObjectEXT_validation(GLuint memoryObject)const{GLboolean const result = (this->*(this->m_orig_glIsMemoryObjectEXT))(memoryObject);this->m_checkErrors("glIsMemoryObjectEXT");return result;}
+FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC m_orig_glWeightPointerARB = nullptr;
+void m_glWeightPointerARB_validation(GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glWeightPointerARB))(size,type,stride,pointer);this->m_checkErrors("glWeightPointerARB");}
+FunctionTable::MEMBERPFNGLFINISHFENCENVPROC m_orig_glFinishFenceNV = nullptr;
+void m_glFinishFenceNV_validation(GLuint fence)const{(this->*(this->m_orig_glFinishFenceNV))(fence);this->m_checkErrors("glFinishFenceNV");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC m_orig_glDepthRangexOES = nullptr;
+void m_glDepthRangexOES_validation(GLfixed n,GLfixed f)const{(this->*(this->m_orig_glDepthRangexOES))(n,f);this->m_checkErrors("glDepthRangexOES");}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC m_orig_glEnableVertexArrayAttribEXT = nullptr;
+void m_glEnableVertexArrayAttribEXT_validation(GLuint vaobj,GLuint index)const{(this->*(this->m_orig_glEnableVertexArrayAttribEXT))(vaobj,index);this->m_checkErrors("glEnableVertexArrayAttribEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC m_orig_glProgramUniform2uivEXT = nullptr;
+void m_glProgramUniform2uivEXT_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform2uivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform2uivEXT");}
+FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC m_orig_glGetDoubleIndexedvEXT = nullptr;
+void m_glGetDoubleIndexedvEXT_validation(GLenum target,GLuint index,GLdouble* data)const{(this->*(this->m_orig_glGetDoubleIndexedvEXT))(target,index,data);this->m_checkErrors("glGetDoubleIndexedvEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC m_orig_glWindowPos2fMESA = nullptr;
+void m_glWindowPos2fMESA_validation(GLfloat x,GLfloat y)const{(this->*(this->m_orig_glWindowPos2fMESA))(x,y);this->m_checkErrors("glWindowPos2fMESA");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC m_orig_glSecondaryColor3b = nullptr;
+void m_glSecondaryColor3b_validation(GLbyte red,GLbyte green,GLbyte blue)const{(this->*(this->m_orig_glSecondaryColor3b))(red,green,blue);this->m_checkErrors("glSecondaryColor3b");}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC m_orig_glCopyConvolutionFilter1DEXT = nullptr;
+void m_glCopyConvolutionFilter1DEXT_validation(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyConvolutionFilter1DEXT))(target,internalformat,x,y,width);this->m_checkErrors("glCopyConvolutionFilter1DEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC m_orig_glWindowPos2sv = nullptr;
+void m_glWindowPos2sv_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos2sv))(v);this->m_checkErrors("glWindowPos2sv");}
+FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC m_orig_glBindFramebufferEXT = nullptr;
+void m_glBindFramebufferEXT_validation(GLenum target,GLuint framebuffer)const{(this->*(this->m_orig_glBindFramebufferEXT))(target,framebuffer);this->m_checkErrors("glBindFramebufferEXT");}
+FunctionTable::MEMBERPFNGLCREATESHADERPROC m_orig_glCreateShader = nullptr;
+GLuint m_glCreateShader_validation(GLenum type)const{GLuint const result = (this->*(this->m_orig_glCreateShader))(type);this->m_checkErrors("glCreateShader");return result;}
+FunctionTable::MEMBERPFNGLGENPATHSNVPROC m_orig_glGenPathsNV = nullptr;
+GLuint m_glGenPathsNV_validation(GLsizei range)const{GLuint const result = (this->*(this->m_orig_glGenPathsNV))(range);this->m_checkErrors("glGenPathsNV");return result;}
+FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC m_orig_glGenRenderbuffers = nullptr;
+void m_glGenRenderbuffers_validation(GLsizei n,GLuint* renderbuffers)const{(this->*(this->m_orig_glGenRenderbuffers))(n,renderbuffers);this->m_checkErrors("glGenRenderbuffers");}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC m_orig_glCopyTexSubImage2D = nullptr;
+void m_glCopyTexSubImage2D_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTexSubImage2D))(target,level,xoffset,yoffset,x,y,width,height);this->m_checkErrors("glCopyTexSubImage2D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC m_orig_glVertexAttrib4ubvARB = nullptr;
+void m_glVertexAttrib4ubvARB_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttrib4ubvARB))(index,v);this->m_checkErrors("glVertexAttrib4ubvARB");}
+FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC m_orig_glDrawTextureNV = nullptr;
+void m_glDrawTextureNV_validation(GLuint texture,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{(this->*(this->m_orig_glDrawTextureNV))(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);this->m_checkErrors("glDrawTextureNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC m_orig_glVertexAttribs1svNV = nullptr;
+void m_glVertexAttribs1svNV_validation(GLuint index,GLsizei count,const GLshort* v)const{(this->*(this->m_orig_glVertexAttribs1svNV))(index,count,v);this->m_checkErrors("glVertexAttribs1svNV");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC m_orig_glClearNamedBufferSubDataEXT = nullptr;
+void m_glClearNamedBufferSubDataEXT_validation(GLuint buffer,GLenum internalformat,GLsizeiptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearNamedBufferSubDataEXT))(buffer,internalformat,offset,size,format,type,data);this->m_checkErrors("glClearNamedBufferSubDataEXT");}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC m_orig_glBlendFuncSeparate = nullptr;
+void m_glBlendFuncSeparate_validation(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{(this->*(this->m_orig_glBlendFuncSeparate))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);this->m_checkErrors("glBlendFuncSeparate");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC m_orig_glPointParameterfARB = nullptr;
+void m_glPointParameterfARB_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPointParameterfARB))(pname,param);this->m_checkErrors("glPointParameterfARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC m_orig_glTexCoord2fv = nullptr;
+void m_glTexCoord2fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glTexCoord2fv))(v);this->m_checkErrors("glTexCoord2fv");}
+FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC m_orig_glGetVariantFloatvEXT = nullptr;
+void m_glGetVariantFloatvEXT_validation(GLuint id,GLenum value,GLfloat* data)const{(this->*(this->m_orig_glGetVariantFloatvEXT))(id,value,data);this->m_checkErrors("glGetVariantFloatvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXP2UIPROC m_orig_glVertexP2ui = nullptr;
+void m_glVertexP2ui_validation(GLenum type,GLuint value)const{(this->*(this->m_orig_glVertexP2ui))(type,value);this->m_checkErrors("glVertexP2ui");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC m_orig_glWindowPos2dMESA = nullptr;
+void m_glWindowPos2dMESA_validation(GLdouble x,GLdouble y)const{(this->*(this->m_orig_glWindowPos2dMESA))(x,y);this->m_checkErrors("glWindowPos2dMESA");}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC m_orig_glTexCoord4fv = nullptr;
+void m_glTexCoord4fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glTexCoord4fv))(v);this->m_checkErrors("glTexCoord4fv");}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC m_orig_glBindFragDataLocationEXT = nullptr;
+void m_glBindFragDataLocationEXT_validation(GLuint program,GLuint color,const GLchar* name)const{(this->*(this->m_orig_glBindFragDataLocationEXT))(program,color,name);this->m_checkErrors("glBindFragDataLocationEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC m_orig_glCompressedTexSubImage1DARB = nullptr;
+void m_glCompressedTexSubImage1DARB_validation(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTexSubImage1DARB))(target,level,xoffset,width,format,imageSize,data);this->m_checkErrors("glCompressedTexSubImage1DARB");}
+FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC m_orig_glGetTextureImageEXT = nullptr;
+void m_glGetTextureImageEXT_validation(GLuint texture,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{(this->*(this->m_orig_glGetTextureImageEXT))(texture,target,level,format,type,pixels);this->m_checkErrors("glGetTextureImageEXT");}
+FunctionTable::MEMBERPFNGLFOGCOORDDPROC m_orig_glFogCoordd = nullptr;
+void m_glFogCoordd_validation(GLdouble coord)const{(this->*(this->m_orig_glFogCoordd))(coord);this->m_checkErrors("glFogCoordd");}
+FunctionTable::MEMBERPFNGLPOINTSIZEPROC m_orig_glPointSize = nullptr;
+void m_glPointSize_validation(GLfloat size)const{(this->*(this->m_orig_glPointSize))(size);this->m_checkErrors("glPointSize");}
+FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC m_orig_glBindTextureUnit = nullptr;
+void m_glBindTextureUnit_validation(GLuint unit,GLuint texture)const{(this->*(this->m_orig_glBindTextureUnit))(unit,texture);this->m_checkErrors("glBindTextureUnit");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC m_orig_glProgramEnvParameterI4uiNV = nullptr;
+void m_glProgramEnvParameterI4uiNV_validation(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{(this->*(this->m_orig_glProgramEnvParameterI4uiNV))(target,index,x,y,z,w);this->m_checkErrors("glProgramEnvParameterI4uiNV");}
+FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC m_orig_glGetProgramPipelineInfoLog = nullptr;
+void m_glGetProgramPipelineInfoLog_validation(GLuint pipeline,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{(this->*(this->m_orig_glGetProgramPipelineInfoLog))(pipeline,bufSize,length,infoLog);this->m_checkErrors("glGetProgramPipelineInfoLog");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC m_orig_glProgramUniform4i64vARB = nullptr;
+void m_glProgramUniform4i64vARB_validation(GLuint program,GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glProgramUniform4i64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform4i64vARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC m_orig_glVertexAttrib4Nuiv = nullptr;
+void m_glVertexAttrib4Nuiv_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttrib4Nuiv))(index,v);this->m_checkErrors("glVertexAttrib4Nuiv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC m_orig_glGetUniformfvARB = nullptr;
+void m_glGetUniformfvARB_validation(GLhandleARB programObj,GLint location,GLfloat* params)const{(this->*(this->m_orig_glGetUniformfvARB))(programObj,location,params);this->m_checkErrors("glGetUniformfvARB");}
+FunctionTable::MEMBERPFNGLWAITSYNCPROC m_orig_glWaitSync = nullptr;
+void m_glWaitSync_validation(GLsync sync,GLbitfield flags,GLuint64 timeout)const{(this->*(this->m_orig_glWaitSync))(sync,flags,timeout);this->m_checkErrors("glWaitSync");}
+FunctionTable::MEMBERPFNGLUNIFORM3IPROC m_orig_glUniform3i = nullptr;
+void m_glUniform3i_validation(GLint location,GLint v0,GLint v1,GLint v2)const{(this->*(this->m_orig_glUniform3i))(location,v0,v1,v2);this->m_checkErrors("glUniform3i");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC m_orig_glBlendEquationSeparatei = nullptr;
+void m_glBlendEquationSeparatei_validation(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{(this->*(this->m_orig_glBlendEquationSeparatei))(buf,modeRGB,modeAlpha);this->m_checkErrors("glBlendEquationSeparatei");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC m_orig_glVertexAttrib2hvNV = nullptr;
+void m_glVertexAttrib2hvNV_validation(GLuint index,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttrib2hvNV))(index,v);this->m_checkErrors("glVertexAttrib2hvNV");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC m_orig_glTextureParameterivEXT = nullptr;
+void m_glTextureParameterivEXT_validation(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTextureParameterivEXT))(texture,target,pname,params);this->m_checkErrors("glTextureParameterivEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM3DPROC m_orig_glUniform3d = nullptr;
+void m_glUniform3d_validation(GLint location,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glUniform3d))(location,x,y,z);this->m_checkErrors("glUniform3d");}
+FunctionTable::MEMBERPFNGLUNIFORM3FPROC m_orig_glUniform3f = nullptr;
+void m_glUniform3f_validation(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{(this->*(this->m_orig_glUniform3f))(location,v0,v1,v2);this->m_checkErrors("glUniform3f");}
+FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC m_orig_glActiveProgramEXT = nullptr;
+void m_glActiveProgramEXT_validation(GLuint program)const{(this->*(this->m_orig_glActiveProgramEXT))(program);this->m_checkErrors("glActiveProgramEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC m_orig_glProgramUniform3uiv = nullptr;
+void m_glProgramUniform3uiv_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform3uiv))(program,location,count,value);this->m_checkErrors("glProgramUniform3uiv");}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC m_orig_glUniform3ui64vARB = nullptr;
+void m_glUniform3ui64vARB_validation(GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glUniform3ui64vARB))(location,count,value);this->m_checkErrors("glUniform3ui64vARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC m_orig_glProgramUniform1ui64vARB = nullptr;
+void m_glProgramUniform1ui64vARB_validation(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glProgramUniform1ui64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform1ui64vARB");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC m_orig_glTextureParameterfEXT = nullptr;
+void m_glTextureParameterfEXT_validation(GLuint texture,GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glTextureParameterfEXT))(texture,target,pname,param);this->m_checkErrors("glTextureParameterfEXT");}
+FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC m_orig_glSetFragmentShaderConstantATI = nullptr;
+void m_glSetFragmentShaderConstantATI_validation(GLuint dst,const GLfloat* value)const{(this->*(this->m_orig_glSetFragmentShaderConstantATI))(dst,value);this->m_checkErrors("glSetFragmentShaderConstantATI");}
+FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC m_orig_glColorSubTable = nullptr;
+void m_glColorSubTable_validation(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const GLvoid* data)const{(this->*(this->m_orig_glColorSubTable))(target,start,count,format,type,data);this->m_checkErrors("glColorSubTable");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC m_orig_glReplacementCodeuiSUN = nullptr;
+void m_glReplacementCodeuiSUN_validation(GLuint code)const{(this->*(this->m_orig_glReplacementCodeuiSUN))(code);this->m_checkErrors("glReplacementCodeuiSUN");}
+FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC m_orig_glStateCaptureNV = nullptr;
+void m_glStateCaptureNV_validation(GLuint state,GLenum mode)const{(this->*(this->m_orig_glStateCaptureNV))(state,mode);this->m_checkErrors("glStateCaptureNV");}
+FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC m_orig_glBindAttribLocation = nullptr;
+void m_glBindAttribLocation_validation(GLuint program,GLuint index,const GLchar* name)const{(this->*(this->m_orig_glBindAttribLocation))(program,index,name);this->m_checkErrors("glBindAttribLocation");}
+FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC m_orig_glWeightusvARB = nullptr;
+void m_glWeightusvARB_validation(GLint size,const GLushort* weights)const{(this->*(this->m_orig_glWeightusvARB))(size,weights);this->m_checkErrors("glWeightusvARB");}
+FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC m_orig_glGetFragDataIndex = nullptr;
+GLint m_glGetFragDataIndex_validation(GLuint program,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetFragDataIndex))(program,name);this->m_checkErrors("glGetFragDataIndex");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC m_orig_glMultiTexCoord2xOES = nullptr;
+void m_glMultiTexCoord2xOES_validation(GLenum texture,GLfixed s,GLfixed t)const{(this->*(this->m_orig_glMultiTexCoord2xOES))(texture,s,t);this->m_checkErrors("glMultiTexCoord2xOES");}
+FunctionTable::MEMBERPFNGLCOLOR3SVPROC m_orig_glColor3sv = nullptr;
+void m_glColor3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glColor3sv))(v);this->m_checkErrors("glColor3sv");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC m_orig_glTexCoord2fVertex3fSUN = nullptr;
+void m_glTexCoord2fVertex3fSUN_validation(GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glTexCoord2fVertex3fSUN))(s,t,x,y,z);this->m_checkErrors("glTexCoord2fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC m_orig_glGetMemoryObjectParameterivEXT = nullptr;
+void m_glGetMemoryObjectParameterivEXT_validation(GLuint memoryObject,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMemoryObjectParameterivEXT))(memoryObject,pname,params);this->m_checkErrors("glGetMemoryObjectParameterivEXT");}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC m_orig_glPolygonOffsetEXT = nullptr;
+void m_glPolygonOffsetEXT_validation(GLfloat factor,GLfloat bias)const{(this->*(this->m_orig_glPolygonOffsetEXT))(factor,bias);this->m_checkErrors("glPolygonOffsetEXT");}
+FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC m_orig_glWeightPathsNV = nullptr;
+void m_glWeightPathsNV_validation(GLuint resultPath,GLsizei numPaths,const GLuint* paths,const GLfloat* weights)const{(this->*(this->m_orig_glWeightPathsNV))(resultPath,numPaths,paths,weights);this->m_checkErrors("glWeightPathsNV");}
+FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC m_orig_glCombinerStageParameterfvNV = nullptr;
+void m_glCombinerStageParameterfvNV_validation(GLenum stage,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glCombinerStageParameterfvNV))(stage,pname,params);this->m_checkErrors("glCombinerStageParameterfvNV");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC m_orig_glPointParameterfEXT = nullptr;
+void m_glPointParameterfEXT_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPointParameterfEXT))(pname,param);this->m_checkErrors("glPointParameterfEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC m_orig_glCopyTexImage1DEXT = nullptr;
+void m_glCopyTexImage1DEXT_validation(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{(this->*(this->m_orig_glCopyTexImage1DEXT))(target,level,internalformat,x,y,width,border);this->m_checkErrors("glCopyTexImage1DEXT");}
+FunctionTable::MEMBERPFNGLVERTEX4SVPROC m_orig_glVertex4sv = nullptr;
+void m_glVertex4sv_validation(const GLshort* v)const{(this->*(this->m_orig_glVertex4sv))(v);this->m_checkErrors("glVertex4sv");}
+FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC m_orig_glMatrixMultfEXT = nullptr;
+void m_glMatrixMultfEXT_validation(GLenum mode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixMultfEXT))(mode,m);this->m_checkErrors("glMatrixMultfEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC m_orig_glCompressedTextureSubImage3DEXT = nullptr;
+void m_glCompressedTextureSubImage3DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedTextureSubImage3DEXT))(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);this->m_checkErrors("glCompressedTextureSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC m_orig_glGetTexLevelParameterxvOES = nullptr;
+void m_glGetTexLevelParameterxvOES_validation(GLenum target,GLint level,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetTexLevelParameterxvOES))(target,level,pname,params);this->m_checkErrors("glGetTexLevelParameterxvOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC m_orig_glVertexAttribL3dvEXT = nullptr;
+void m_glVertexAttribL3dvEXT_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL3dvEXT))(index,v);this->m_checkErrors("glVertexAttribL3dvEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC m_orig_glMultiTexCoordP4ui = nullptr;
+void m_glMultiTexCoordP4ui_validation(GLenum texture,GLenum type,GLuint coords)const{(this->*(this->m_orig_glMultiTexCoordP4ui))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP4ui");}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC m_orig_glGetTextureLevelParameterivEXT = nullptr;
+void m_glGetTextureLevelParameterivEXT_validation(GLuint texture,GLenum target,GLint level,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTextureLevelParameterivEXT))(texture,target,level,pname,params);this->m_checkErrors("glGetTextureLevelParameterivEXT");}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC m_orig_glAlphaFragmentOp2ATI = nullptr;
+void m_glAlphaFragmentOp2ATI_validation(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{(this->*(this->m_orig_glAlphaFragmentOp2ATI))(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);this->m_checkErrors("glAlphaFragmentOp2ATI");}
+FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC m_orig_glDeleteFramebuffers = nullptr;
+void m_glDeleteFramebuffers_validation(GLsizei n,const GLuint* framebuffers)const{(this->*(this->m_orig_glDeleteFramebuffers))(n,framebuffers);this->m_checkErrors("glDeleteFramebuffers");}
+FunctionTable::MEMBERPFNGLDRAWARRAYSPROC m_orig_glDrawArrays = nullptr;
+void m_glDrawArrays_validation(GLenum mode,GLint first,GLsizei count)const{(this->*(this->m_orig_glDrawArrays))(mode,first,count);this->m_checkErrors("glDrawArrays");}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC m_orig_glGetTransformFeedbackiv = nullptr;
+void m_glGetTransformFeedbackiv_validation(GLuint xfb,GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetTransformFeedbackiv))(xfb,pname,param);this->m_checkErrors("glGetTransformFeedbackiv");}
+FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC m_orig_glGetnTexImageARB = nullptr;
+void m_glGetnTexImageARB_validation(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* img)const{(this->*(this->m_orig_glGetnTexImageARB))(target,level,format,type,bufSize,img);this->m_checkErrors("glGetnTexImageARB");}
+FunctionTable::MEMBERPFNGLCLEARPROC m_orig_glClear = nullptr;
+void m_glClear_validation(GLbitfield mask)const{(this->*(this->m_orig_glClear))(mask);this->m_checkErrors("glClear");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC m_orig_glVertexArrayParameteriAPPLE = nullptr;
+void m_glVertexArrayParameteriAPPLE_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glVertexArrayParameteriAPPLE))(pname,param);this->m_checkErrors("glVertexArrayParameteriAPPLE");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC m_orig_glMultiTexCoord2dvARB = nullptr;
+void m_glMultiTexCoord2dvARB_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord2dvARB))(target,v);this->m_checkErrors("glMultiTexCoord2dvARB");}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC m_orig_glGetVideoCaptureStreamdvNV = nullptr;
+void m_glGetVideoCaptureStreamdvNV_validation(GLuint video_capture_slot,GLuint stream,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetVideoCaptureStreamdvNV))(video_capture_slot,stream,pname,params);this->m_checkErrors("glGetVideoCaptureStreamdvNV");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC m_orig_glFragmentLightModelivSGIX = nullptr;
+void m_glFragmentLightModelivSGIX_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glFragmentLightModelivSGIX))(pname,params);this->m_checkErrors("glFragmentLightModelivSGIX");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC m_orig_glVertexAttribP2ui = nullptr;
+void m_glVertexAttribP2ui_validation(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{(this->*(this->m_orig_glVertexAttribP2ui))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP2ui");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC m_orig_glMultiTexCoordPointerEXT = nullptr;
+void m_glMultiTexCoordPointerEXT_validation(GLenum texunit,GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glMultiTexCoordPointerEXT))(texunit,size,type,stride,pointer);this->m_checkErrors("glMultiTexCoordPointerEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC m_orig_glProgramUniform3iEXT = nullptr;
+void m_glProgramUniform3iEXT_validation(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{(this->*(this->m_orig_glProgramUniform3iEXT))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3iEXT");}
+FunctionTable::MEMBERPFNGLTRANSLATEFPROC m_orig_glTranslatef = nullptr;
+void m_glTranslatef_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glTranslatef))(x,y,z);this->m_checkErrors("glTranslatef");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC m_orig_glVertexAttrib4Nub = nullptr;
+void m_glVertexAttrib4Nub_validation(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{(this->*(this->m_orig_glVertexAttrib4Nub))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4Nub");}
+FunctionTable::MEMBERPFNGLTRANSLATEDPROC m_orig_glTranslated = nullptr;
+void m_glTranslated_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glTranslated))(x,y,z);this->m_checkErrors("glTranslated");}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC m_orig_glSamplerParameterIiv = nullptr;
+void m_glSamplerParameterIiv_validation(GLuint sampler,GLenum pname,const GLint* param)const{(this->*(this->m_orig_glSamplerParameterIiv))(sampler,pname,param);this->m_checkErrors("glSamplerParameterIiv");}
+FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC m_orig_glTexCoord4hNV = nullptr;
+void m_glTexCoord4hNV_validation(GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{(this->*(this->m_orig_glTexCoord4hNV))(s,t,r,q);this->m_checkErrors("glTexCoord4hNV");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC m_orig_glDrawElementsIndirect = nullptr;
+void m_glDrawElementsIndirect_validation(GLenum mode,GLenum type,const void* indirect)const{(this->*(this->m_orig_glDrawElementsIndirect))(mode,type,indirect);this->m_checkErrors("glDrawElementsIndirect");}
+FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC m_orig_glDeletePerfMonitorsAMD = nullptr;
+void m_glDeletePerfMonitorsAMD_validation(GLsizei n,GLuint* monitors)const{(this->*(this->m_orig_glDeletePerfMonitorsAMD))(n,monitors);this->m_checkErrors("glDeletePerfMonitorsAMD");}
+FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC m_orig_glIsRenderbufferEXT = nullptr;
+GLboolean m_glIsRenderbufferEXT_validation(GLuint renderbuffer)const{GLboolean const result = (this->*(this->m_orig_glIsRenderbufferEXT))(renderbuffer);this->m_checkErrors("glIsRenderbufferEXT");return result;}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC m_orig_glDrawCommandsNV = nullptr;
+void m_glDrawCommandsNV_validation(GLenum primitiveMode,GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,GLuint count)const{(this->*(this->m_orig_glDrawCommandsNV))(primitiveMode,buffer,indirects,sizes,count);this->m_checkErrors("glDrawCommandsNV");}
+FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC m_orig_glUniform3ivARB = nullptr;
+void m_glUniform3ivARB_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform3ivARB))(location,count,value);this->m_checkErrors("glUniform3ivARB");}
+FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC m_orig_glBufferSubData = nullptr;
+void m_glBufferSubData_validation(GLenum target,GLintptr offset,GLsizeiptr size,const void* data)const{(this->*(this->m_orig_glBufferSubData))(target,offset,size,data);this->m_checkErrors("glBufferSubData");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC m_orig_glSecondaryColor3bv = nullptr;
+void m_glSecondaryColor3bv_validation(const GLbyte* v)const{(this->*(this->m_orig_glSecondaryColor3bv))(v);this->m_checkErrors("glSecondaryColor3bv");}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC m_orig_glMatrixMultTransposedEXT = nullptr;
+void m_glMatrixMultTransposedEXT_validation(GLenum mode,const GLdouble* m)const{(this->*(this->m_orig_glMatrixMultTransposedEXT))(mode,m);this->m_checkErrors("glMatrixMultTransposedEXT");}
+FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC m_orig_glRequestResidentProgramsNV = nullptr;
+void m_glRequestResidentProgramsNV_validation(GLsizei n,const GLuint* programs)const{(this->*(this->m_orig_glRequestResidentProgramsNV))(n,programs);this->m_checkErrors("glRequestResidentProgramsNV");}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC m_orig_glAlphaFragmentOp1ATI = nullptr;
+void m_glAlphaFragmentOp1ATI_validation(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{(this->*(this->m_orig_glAlphaFragmentOp1ATI))(op,dst,dstMod,arg1,arg1Rep,arg1Mod);this->m_checkErrors("glAlphaFragmentOp1ATI");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC m_orig_glGetQueryObjecti64v = nullptr;
+void m_glGetQueryObjecti64v_validation(GLuint id,GLenum pname,GLint64* params)const{(this->*(this->m_orig_glGetQueryObjecti64v))(id,pname,params);this->m_checkErrors("glGetQueryObjecti64v");}
+FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC m_orig_glMatrixMult3x3fNV = nullptr;
+void m_glMatrixMult3x3fNV_validation(GLenum matrixMode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixMult3x3fNV))(matrixMode,m);this->m_checkErrors("glMatrixMult3x3fNV");}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC m_orig_glColorTableParameteriv = nullptr;
+void m_glColorTableParameteriv_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glColorTableParameteriv))(target,pname,params);this->m_checkErrors("glColorTableParameteriv");}
+FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC m_orig_glPathSubCommandsNV = nullptr;
+void m_glPathSubCommandsNV_validation(GLuint path,GLsizei commandStart,GLsizei commandsToDelete,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{(this->*(this->m_orig_glPathSubCommandsNV))(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);this->m_checkErrors("glPathSubCommandsNV");}
+FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC m_orig_glGetFinalCombinerInputParameterivNV = nullptr;
+void m_glGetFinalCombinerInputParameterivNV_validation(GLenum variable,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFinalCombinerInputParameterivNV))(variable,pname,params);this->m_checkErrors("glGetFinalCombinerInputParameterivNV");}
+FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC m_orig_glIsRenderbuffer = nullptr;
+GLboolean m_glIsRenderbuffer_validation(GLuint renderbuffer)const{GLboolean const result = (this->*(this->m_orig_glIsRenderbuffer))(renderbuffer);this->m_checkErrors("glIsRenderbuffer");return result;}
+FunctionTable::MEMBERPFNGLVERTEX3IVPROC m_orig_glVertex3iv = nullptr;
+void m_glVertex3iv_validation(const GLint* v)const{(this->*(this->m_orig_glVertex3iv))(v);this->m_checkErrors("glVertex3iv");}
+FunctionTable::MEMBERPFNGLTEXGENFVPROC m_orig_glTexGenfv = nullptr;
+void m_glTexGenfv_validation(GLenum coord,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glTexGenfv))(coord,pname,params);this->m_checkErrors("glTexGenfv");}
+FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC m_orig_glFrustumfOES = nullptr;
+void m_glFrustumfOES_validation(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{(this->*(this->m_orig_glFrustumfOES))(l,r,b,t,n,f);this->m_checkErrors("glFrustumfOES");}
+FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC m_orig_glBindVertexBuffers = nullptr;
+void m_glBindVertexBuffers_validation(GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{(this->*(this->m_orig_glBindVertexBuffers))(first,count,buffers,offsets,strides);this->m_checkErrors("glBindVertexBuffers");}
+FunctionTable::MEMBERPFNGLMATERIALIPROC m_orig_glMateriali = nullptr;
+void m_glMateriali_validation(GLenum face,GLenum pname,GLint param)const{(this->*(this->m_orig_glMateriali))(face,pname,param);this->m_checkErrors("glMateriali");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC m_orig_glMultiTexCoord2svARB = nullptr;
+void m_glMultiTexCoord2svARB_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord2svARB))(target,v);this->m_checkErrors("glMultiTexCoord2svARB");}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC m_orig_glDisableVertexAttribArray = nullptr;
+void m_glDisableVertexAttribArray_validation(GLuint index)const{(this->*(this->m_orig_glDisableVertexAttribArray))(index);this->m_checkErrors("glDisableVertexAttribArray");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC m_orig_glWindowPos3ivARB = nullptr;
+void m_glWindowPos3ivARB_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos3ivARB))(v);this->m_checkErrors("glWindowPos3ivARB");}
+FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC m_orig_glTexCoordFormatNV = nullptr;
+void m_glTexCoordFormatNV_validation(GLint size,GLenum type,GLsizei stride)const{(this->*(this->m_orig_glTexCoordFormatNV))(size,type,stride);this->m_checkErrors("glTexCoordFormatNV");}
+FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC m_orig_glBlitNamedFramebuffer = nullptr;
+void m_glBlitNamedFramebuffer_validation(GLuint readFramebuffer,GLuint drawFramebuffer,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{(this->*(this->m_orig_glBlitNamedFramebuffer))(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->m_checkErrors("glBlitNamedFramebuffer");}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC m_orig_glMatrixLoadTransposefEXT = nullptr;
+void m_glMatrixLoadTransposefEXT_validation(GLenum mode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixLoadTransposefEXT))(mode,m);this->m_checkErrors("glMatrixLoadTransposefEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC m_orig_glMultiTexGenfEXT = nullptr;
+void m_glMultiTexGenfEXT_validation(GLenum texunit,GLenum coord,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glMultiTexGenfEXT))(texunit,coord,pname,param);this->m_checkErrors("glMultiTexGenfEXT");}
+FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC m_orig_glShaderStorageBlockBinding = nullptr;
+void m_glShaderStorageBlockBinding_validation(GLuint program,GLuint storageBlockIndex,GLuint storageBlockBinding)const{(this->*(this->m_orig_glShaderStorageBlockBinding))(program,storageBlockIndex,storageBlockBinding);this->m_checkErrors("glShaderStorageBlockBinding");}
+FunctionTable::MEMBERPFNGLMATERIALFPROC m_orig_glMaterialf = nullptr;
+void m_glMaterialf_validation(GLenum face,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glMaterialf))(face,pname,param);this->m_checkErrors("glMaterialf");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_validation(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN))(rc,r,g,b,a,nx,ny,nz,x,y,z);this->m_checkErrors("glReplacementCodeuiColor4fNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC m_orig_glCheckNamedFramebufferStatusEXT = nullptr;
+GLenum m_glCheckNamedFramebufferStatusEXT_validation(GLuint framebuffer,GLenum target)const{GLenum const result = (this->*(this->m_orig_glCheckNamedFramebufferStatusEXT))(framebuffer,target);this->m_checkErrors("glCheckNamedFramebufferStatusEXT");return result;}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC m_orig_glVertexArrayVertexAttribFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribFormatEXT_validation(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexArrayVertexAttribFormatEXT))(vaobj,attribindex,size,type,normalized,relativeoffset);this->m_checkErrors("glVertexArrayVertexAttribFormatEXT");}
+FunctionTable::MEMBERPFNGLVERTEX2HNVPROC m_orig_glVertex2hNV = nullptr;
+void m_glVertex2hNV_validation(GLhalfNV x,GLhalfNV y)const{(this->*(this->m_orig_glVertex2hNV))(x,y);this->m_checkErrors("glVertex2hNV");}
+FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC m_orig_glDeleteVertexShaderEXT = nullptr;
+void m_glDeleteVertexShaderEXT_validation(GLuint id)const{(this->*(this->m_orig_glDeleteVertexShaderEXT))(id);this->m_checkErrors("glDeleteVertexShaderEXT");}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC m_orig_glTexImage3DEXT = nullptr;
+void m_glTexImage3DEXT_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTexImage3DEXT))(target,level,internalformat,width,height,depth,border,format,type,pixels);this->m_checkErrors("glTexImage3DEXT");}
+FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC m_orig_glSignalVkFenceNV = nullptr;
+void m_glSignalVkFenceNV_validation(GLuint64 vkFence)const{(this->*(this->m_orig_glSignalVkFenceNV))(vkFence);this->m_checkErrors("glSignalVkFenceNV");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC m_orig_glProgramLocalParameterI4ivNV = nullptr;
+void m_glProgramLocalParameterI4ivNV_validation(GLenum target,GLuint index,const GLint* params)const{(this->*(this->m_orig_glProgramLocalParameterI4ivNV))(target,index,params);this->m_checkErrors("glProgramLocalParameterI4ivNV");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC m_orig_glGlobalAlphaFactoriSUN = nullptr;
+void m_glGlobalAlphaFactoriSUN_validation(GLint factor)const{(this->*(this->m_orig_glGlobalAlphaFactoriSUN))(factor);this->m_checkErrors("glGlobalAlphaFactoriSUN");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC m_orig_glTextureStorage1D = nullptr;
+void m_glTextureStorage1D_validation(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width)const{(this->*(this->m_orig_glTextureStorage1D))(texture,levels,internalformat,width);this->m_checkErrors("glTextureStorage1D");}
+FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC m_orig_glBinormal3sEXT = nullptr;
+void m_glBinormal3sEXT_validation(GLshort bx,GLshort by,GLshort bz)const{(this->*(this->m_orig_glBinormal3sEXT))(bx,by,bz);this->m_checkErrors("glBinormal3sEXT");}
+FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC m_orig_glGetProgramInterfaceiv = nullptr;
+void m_glGetProgramInterfaceiv_validation(GLuint program,GLenum programInterface,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetProgramInterfaceiv))(program,programInterface,pname,params);this->m_checkErrors("glGetProgramInterfaceiv");}
+FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC m_orig_glMatrixIndexPointerARB = nullptr;
+void m_glMatrixIndexPointerARB_validation(GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glMatrixIndexPointerARB))(size,type,stride,pointer);this->m_checkErrors("glMatrixIndexPointerARB");}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC m_orig_glTexCoordPointerEXT = nullptr;
+void m_glTexCoordPointerEXT_validation(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{(this->*(this->m_orig_glTexCoordPointerEXT))(size,type,stride,count,pointer);this->m_checkErrors("glTexCoordPointerEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC m_orig_glMultiTexGeniEXT = nullptr;
+void m_glMultiTexGeniEXT_validation(GLenum texunit,GLenum coord,GLenum pname,GLint param)const{(this->*(this->m_orig_glMultiTexGeniEXT))(texunit,coord,pname,param);this->m_checkErrors("glMultiTexGeniEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC m_orig_glVertexAttrib2fNV = nullptr;
+void m_glVertexAttrib2fNV_validation(GLuint index,GLfloat x,GLfloat y)const{(this->*(this->m_orig_glVertexAttrib2fNV))(index,x,y);this->m_checkErrors("glVertexAttrib2fNV");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC m_orig_glNamedProgramStringEXT = nullptr;
+void m_glNamedProgramStringEXT_validation(GLuint program,GLenum target,GLenum format,GLsizei len,const void* string)const{(this->*(this->m_orig_glNamedProgramStringEXT))(program,target,format,len,string);this->m_checkErrors("glNamedProgramStringEXT");}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC m_orig_glMapNamedBuffer = nullptr;
+void* m_glMapNamedBuffer_validation(GLuint buffer,GLenum access)const{void* const result = (this->*(this->m_orig_glMapNamedBuffer))(buffer,access);this->m_checkErrors("glMapNamedBuffer");return result;}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC m_orig_glGetMinmaxParameteriv = nullptr;
+void m_glGetMinmaxParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMinmaxParameteriv))(target,pname,params);this->m_checkErrors("glGetMinmaxParameteriv");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC m_orig_glGetnUniformdv = nullptr;
+void m_glGetnUniformdv_validation(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{(this->*(this->m_orig_glGetnUniformdv))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformdv");}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC m_orig_glEndConditionalRenderNVX = nullptr;
+void m_glEndConditionalRenderNVX_validation()const{(this->*(this->m_orig_glEndConditionalRenderNVX))();this->m_checkErrors("glEndConditionalRenderNVX");}
+FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC m_orig_glBinormal3fEXT = nullptr;
+void m_glBinormal3fEXT_validation(GLfloat bx,GLfloat by,GLfloat bz)const{(this->*(this->m_orig_glBinormal3fEXT))(bx,by,bz);this->m_checkErrors("glBinormal3fEXT");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC m_orig_glNormalStream3iATI = nullptr;
+void m_glNormalStream3iATI_validation(GLenum stream,GLint nx,GLint ny,GLint nz)const{(this->*(this->m_orig_glNormalStream3iATI))(stream,nx,ny,nz);this->m_checkErrors("glNormalStream3iATI");}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC m_orig_glProgramBufferParametersIivNV = nullptr;
+void m_glProgramBufferParametersIivNV_validation(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLint* params)const{(this->*(this->m_orig_glProgramBufferParametersIivNV))(target,bindingIndex,wordIndex,count,params);this->m_checkErrors("glProgramBufferParametersIivNV");}
+FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC m_orig_glMapGrid1xOES = nullptr;
+void m_glMapGrid1xOES_validation(GLint n,GLfixed u1,GLfixed u2)const{(this->*(this->m_orig_glMapGrid1xOES))(n,u1,u2);this->m_checkErrors("glMapGrid1xOES");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC m_orig_glGetVertexAttribPointervARB = nullptr;
+void m_glGetVertexAttribPointervARB_validation(GLuint index,GLenum pname,void** pointer)const{(this->*(this->m_orig_glGetVertexAttribPointervARB))(index,pname,pointer);this->m_checkErrors("glGetVertexAttribPointervARB");}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC m_orig_glFlushMappedNamedBufferRangeEXT = nullptr;
+void m_glFlushMappedNamedBufferRangeEXT_validation(GLuint buffer,GLintptr offset,GLsizeiptr length)const{(this->*(this->m_orig_glFlushMappedNamedBufferRangeEXT))(buffer,offset,length);this->m_checkErrors("glFlushMappedNamedBufferRangeEXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC m_orig_glGetVertexAttribIiv = nullptr;
+void m_glGetVertexAttribIiv_validation(GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVertexAttribIiv))(index,pname,params);this->m_checkErrors("glGetVertexAttribIiv");}
+FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC m_orig_glVertexP4uiv = nullptr;
+void m_glVertexP4uiv_validation(GLenum type,const GLuint* value)const{(this->*(this->m_orig_glVertexP4uiv))(type,value);this->m_checkErrors("glVertexP4uiv");}
+FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC m_orig_glUniformui64NV = nullptr;
+void m_glUniformui64NV_validation(GLint location,GLuint64EXT value)const{(this->*(this->m_orig_glUniformui64NV))(location,value);this->m_checkErrors("glUniformui64NV");}
+FunctionTable::MEMBERPFNGLCOLOR4FVPROC m_orig_glColor4fv = nullptr;
+void m_glColor4fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glColor4fv))(v);this->m_checkErrors("glColor4fv");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC m_orig_glTexParameterxvOES = nullptr;
+void m_glTexParameterxvOES_validation(GLenum target,GLenum pname,const GLfixed* params)const{(this->*(this->m_orig_glTexParameterxvOES))(target,pname,params);this->m_checkErrors("glTexParameterxvOES");}
+FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC m_orig_glPatchParameteri = nullptr;
+void m_glPatchParameteri_validation(GLenum pname,GLint value)const{(this->*(this->m_orig_glPatchParameteri))(pname,value);this->m_checkErrors("glPatchParameteri");}
+FunctionTable::MEMBERPFNGLMAP1DPROC m_orig_glMap1d = nullptr;
+void m_glMap1d_validation(GLenum target,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{(this->*(this->m_orig_glMap1d))(target,u1,u2,stride,order,points);this->m_checkErrors("glMap1d");}
+FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC m_orig_glGetTexFilterFuncSGIS = nullptr;
+void m_glGetTexFilterFuncSGIS_validation(GLenum target,GLenum filter,GLfloat* weights)const{(this->*(this->m_orig_glGetTexFilterFuncSGIS))(target,filter,weights);this->m_checkErrors("glGetTexFilterFuncSGIS");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC m_orig_glVertexStream3dATI = nullptr;
+void m_glVertexStream3dATI_validation(GLenum stream,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertexStream3dATI))(stream,x,y,z);this->m_checkErrors("glVertexStream3dATI");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC m_orig_glVertexArrayVertexBindingDivisorEXT = nullptr;
+void m_glVertexArrayVertexBindingDivisorEXT_validation(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{(this->*(this->m_orig_glVertexArrayVertexBindingDivisorEXT))(vaobj,bindingindex,divisor);this->m_checkErrors("glVertexArrayVertexBindingDivisorEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC m_orig_glMultiTexCoord3svARB = nullptr;
+void m_glMultiTexCoord3svARB_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord3svARB))(target,v);this->m_checkErrors("glMultiTexCoord3svARB");}
+FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC m_orig_glBindProgramNV = nullptr;
+void m_glBindProgramNV_validation(GLenum target,GLuint id)const{(this->*(this->m_orig_glBindProgramNV))(target,id);this->m_checkErrors("glBindProgramNV");}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC m_orig_glGetConvolutionParameteriv = nullptr;
+void m_glGetConvolutionParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetConvolutionParameteriv))(target,pname,params);this->m_checkErrors("glGetConvolutionParameteriv");}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC m_orig_glGetProgramLocalParameterfvARB = nullptr;
+void m_glGetProgramLocalParameterfvARB_validation(GLenum target,GLuint index,GLfloat* params)const{(this->*(this->m_orig_glGetProgramLocalParameterfvARB))(target,index,params);this->m_checkErrors("glGetProgramLocalParameterfvARB");}
+FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC m_orig_glGenFragmentShadersATI = nullptr;
+GLuint m_glGenFragmentShadersATI_validation(GLuint range)const{GLuint const result = (this->*(this->m_orig_glGenFragmentShadersATI))(range);this->m_checkErrors("glGenFragmentShadersATI");return result;}
+FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC m_orig_glTexBumpParameterivATI = nullptr;
+void m_glTexBumpParameterivATI_validation(GLenum pname,const GLint* param)const{(this->*(this->m_orig_glTexBumpParameterivATI))(pname,param);this->m_checkErrors("glTexBumpParameterivATI");}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC m_orig_glGetNamedFramebufferAttachmentParameteriv = nullptr;
+void m_glGetNamedFramebufferAttachmentParameteriv_validation(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedFramebufferAttachmentParameteriv))(framebuffer,attachment,pname,params);this->m_checkErrors("glGetNamedFramebufferAttachmentParameteriv");}
+FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC m_orig_glGetnSeparableFilter = nullptr;
+void m_glGetnSeparableFilter_validation(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{(this->*(this->m_orig_glGetnSeparableFilter))(target,format,type,rowBufSize,row,columnBufSize,column,span);this->m_checkErrors("glGetnSeparableFilter");}
+FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC m_orig_glNormal3xvOES = nullptr;
+void m_glNormal3xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glNormal3xvOES))(coords);this->m_checkErrors("glNormal3xvOES");}
+FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC m_orig_glPassTexCoordATI = nullptr;
+void m_glPassTexCoordATI_validation(GLuint dst,GLuint coord,GLenum swizzle)const{(this->*(this->m_orig_glPassTexCoordATI))(dst,coord,swizzle);this->m_checkErrors("glPassTexCoordATI");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC m_orig_glFramebufferTextureFaceARB = nullptr;
+void m_glFramebufferTextureFaceARB_validation(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{(this->*(this->m_orig_glFramebufferTextureFaceARB))(target,attachment,texture,level,face);this->m_checkErrors("glFramebufferTextureFaceARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC m_orig_glProgramUniform1dv = nullptr;
+void m_glProgramUniform1dv_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform1dv))(program,location,count,value);this->m_checkErrors("glProgramUniform1dv");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC m_orig_glTextureStorage2DEXT = nullptr;
+void m_glTextureStorage2DEXT_validation(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glTextureStorage2DEXT))(texture,target,levels,internalformat,width,height);this->m_checkErrors("glTextureStorage2DEXT");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC m_orig_glVertexArrayFogCoordOffsetEXT = nullptr;
+void m_glVertexArrayFogCoordOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayFogCoordOffsetEXT))(vaobj,buffer,type,stride,offset);this->m_checkErrors("glVertexArrayFogCoordOffsetEXT");}
+FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC m_orig_glDeleteNamedStringARB = nullptr;
+void m_glDeleteNamedStringARB_validation(GLint namelen,const GLchar* name)const{(this->*(this->m_orig_glDeleteNamedStringARB))(namelen,name);this->m_checkErrors("glDeleteNamedStringARB");}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC m_orig_glMulticastGetQueryObjecti64vNV = nullptr;
+void m_glMulticastGetQueryObjecti64vNV_validation(GLuint gpu,GLuint id,GLenum pname,GLint64* params)const{(this->*(this->m_orig_glMulticastGetQueryObjecti64vNV))(gpu,id,pname,params);this->m_checkErrors("glMulticastGetQueryObjecti64vNV");}
+FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC m_orig_glGenOcclusionQueriesNV = nullptr;
+void m_glGenOcclusionQueriesNV_validation(GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glGenOcclusionQueriesNV))(n,ids);this->m_checkErrors("glGenOcclusionQueriesNV");}
+FunctionTable::MEMBERPFNGLLIGHTIPROC m_orig_glLighti = nullptr;
+void m_glLighti_validation(GLenum light,GLenum pname,GLint param)const{(this->*(this->m_orig_glLighti))(light,pname,param);this->m_checkErrors("glLighti");}
+FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC m_orig_glTexImage1D = nullptr;
+void m_glTexImage1D_validation(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glTexImage1D))(target,level,internalFormat,width,border,format,type,pixels);this->m_checkErrors("glTexImage1D");}
+FunctionTable::MEMBERPFNGLLIGHTFPROC m_orig_glLightf = nullptr;
+void m_glLightf_validation(GLenum light,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glLightf))(light,pname,param);this->m_checkErrors("glLightf");}
+FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC m_orig_glClientAttribDefaultEXT = nullptr;
+void m_glClientAttribDefaultEXT_validation(GLbitfield mask)const{(this->*(this->m_orig_glClientAttribDefaultEXT))(mask);this->m_checkErrors("glClientAttribDefaultEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC m_orig_glVertexAttrib4bvARB = nullptr;
+void m_glVertexAttrib4bvARB_validation(GLuint index,const GLbyte* v)const{(this->*(this->m_orig_glVertexAttrib4bvARB))(index,v);this->m_checkErrors("glVertexAttrib4bvARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC m_orig_glVertexAttribIFormatNV = nullptr;
+void m_glVertexAttribIFormatNV_validation(GLuint index,GLint size,GLenum type,GLsizei stride)const{(this->*(this->m_orig_glVertexAttribIFormatNV))(index,size,type,stride);this->m_checkErrors("glVertexAttribIFormatNV");}
+FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC m_orig_glStencilFuncSeparate = nullptr;
+void m_glStencilFuncSeparate_validation(GLenum face,GLenum func,GLint ref,GLuint mask)const{(this->*(this->m_orig_glStencilFuncSeparate))(face,func,ref,mask);this->m_checkErrors("glStencilFuncSeparate");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC m_orig_glGetVertexAttribfvARB = nullptr;
+void m_glGetVertexAttribfvARB_validation(GLuint index,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetVertexAttribfvARB))(index,pname,params);this->m_checkErrors("glGetVertexAttribfvARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC m_orig_glVertexAttrib2dNV = nullptr;
+void m_glVertexAttrib2dNV_validation(GLuint index,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertexAttrib2dNV))(index,x,y);this->m_checkErrors("glVertexAttrib2dNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC m_orig_glProgramUniform2iEXT = nullptr;
+void m_glProgramUniform2iEXT_validation(GLuint program,GLint location,GLint v0,GLint v1)const{(this->*(this->m_orig_glProgramUniform2iEXT))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2iEXT");}
+FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC m_orig_glClientActiveVertexStreamATI = nullptr;
+void m_glClientActiveVertexStreamATI_validation(GLenum stream)const{(this->*(this->m_orig_glClientActiveVertexStreamATI))(stream);this->m_checkErrors("glClientActiveVertexStreamATI");}
+FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC m_orig_glRasterPos3xOES = nullptr;
+void m_glRasterPos3xOES_validation(GLfixed x,GLfixed y,GLfixed z)const{(this->*(this->m_orig_glRasterPos3xOES))(x,y,z);this->m_checkErrors("glRasterPos3xOES");}
+FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC m_orig_glGetMapParameterivNV = nullptr;
+void m_glGetMapParameterivNV_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMapParameterivNV))(target,pname,params);this->m_checkErrors("glGetMapParameterivNV");}
+FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC m_orig_glSampleCoverage = nullptr;
+void m_glSampleCoverage_validation(GLclampf value,GLboolean invert)const{(this->*(this->m_orig_glSampleCoverage))(value,invert);this->m_checkErrors("glSampleCoverage");}
+FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC m_orig_glClearDepthxOES = nullptr;
+void m_glClearDepthxOES_validation(GLfixed depth)const{(this->*(this->m_orig_glClearDepthxOES))(depth);this->m_checkErrors("glClearDepthxOES");}
+FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC m_orig_glUniformBufferEXT = nullptr;
+void m_glUniformBufferEXT_validation(GLuint program,GLint location,GLuint buffer)const{(this->*(this->m_orig_glUniformBufferEXT))(program,location,buffer);this->m_checkErrors("glUniformBufferEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC m_orig_glTexCoord2fNormal3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fNormal3fVertex3fvSUN_validation(const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord2fNormal3fVertex3fvSUN))(tc,n,v);this->m_checkErrors("glTexCoord2fNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC m_orig_glMulticastGetQueryObjectuivNV = nullptr;
+void m_glMulticastGetQueryObjectuivNV_validation(GLuint gpu,GLuint id,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glMulticastGetQueryObjectuivNV))(gpu,id,pname,params);this->m_checkErrors("glMulticastGetQueryObjectuivNV");}
+FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC m_orig_glGetFirstPerfQueryIdINTEL = nullptr;
+void m_glGetFirstPerfQueryIdINTEL_validation(GLuint* queryId)const{(this->*(this->m_orig_glGetFirstPerfQueryIdINTEL))(queryId);this->m_checkErrors("glGetFirstPerfQueryIdINTEL");}
+FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC m_orig_glUnmapNamedBufferEXT = nullptr;
+GLboolean m_glUnmapNamedBufferEXT_validation(GLuint buffer)const{GLboolean const result = (this->*(this->m_orig_glUnmapNamedBufferEXT))(buffer);this->m_checkErrors("glUnmapNamedBufferEXT");return result;}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC m_orig_glGetTransformFeedbacki_v = nullptr;
+void m_glGetTransformFeedbacki_v_validation(GLuint xfb,GLenum pname,GLuint index,GLint* param)const{(this->*(this->m_orig_glGetTransformFeedbacki_v))(xfb,pname,index,param);this->m_checkErrors("glGetTransformFeedbacki_v");}
+FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC m_orig_glUniform4fvARB = nullptr;
+void m_glUniform4fvARB_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform4fvARB))(location,count,value);this->m_checkErrors("glUniform4fvARB");}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC m_orig_glRenderbufferStorageMultisampleCoverageNV = nullptr;
+void m_glRenderbufferStorageMultisampleCoverageNV_validation(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glRenderbufferStorageMultisampleCoverageNV))(target,coverageSamples,colorSamples,internalformat,width,height);this->m_checkErrors("glRenderbufferStorageMultisampleCoverageNV");}
+FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC m_orig_glGetFloati_vEXT = nullptr;
+void m_glGetFloati_vEXT_validation(GLenum pname,GLuint index,GLfloat* params)const{(this->*(this->m_orig_glGetFloati_vEXT))(pname,index,params);this->m_checkErrors("glGetFloati_vEXT");}
+FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC m_orig_glBindAttribLocationARB = nullptr;
+void m_glBindAttribLocationARB_validation(GLhandleARB programObj,GLuint index,const GLcharARB* name)const{(this->*(this->m_orig_glBindAttribLocationARB))(programObj,index,name);this->m_checkErrors("glBindAttribLocationARB");}
+FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC m_orig_glBufferAddressRangeNV = nullptr;
+void m_glBufferAddressRangeNV_validation(GLenum pname,GLuint index,GLuint64EXT address,GLsizeiptr length)const{(this->*(this->m_orig_glBufferAddressRangeNV))(pname,index,address,length);this->m_checkErrors("glBufferAddressRangeNV");}
+FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC m_orig_glGenProgramsARB = nullptr;
+void m_glGenProgramsARB_validation(GLsizei n,GLuint* programs)const{(this->*(this->m_orig_glGenProgramsARB))(n,programs);this->m_checkErrors("glGenProgramsARB");}
+FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC m_orig_glMultiTexEnvivEXT = nullptr;
+void m_glMultiTexEnvivEXT_validation(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMultiTexEnvivEXT))(texunit,target,pname,params);this->m_checkErrors("glMultiTexEnvivEXT");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC m_orig_glSecondaryColor3uiEXT = nullptr;
+void m_glSecondaryColor3uiEXT_validation(GLuint red,GLuint green,GLuint blue)const{(this->*(this->m_orig_glSecondaryColor3uiEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3uiEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC m_orig_glCompressedTextureImage2DEXT = nullptr;
+void m_glCompressedTextureImage2DEXT_validation(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedTextureImage2DEXT))(texture,target,level,internalformat,width,height,border,imageSize,bits);this->m_checkErrors("glCompressedTextureImage2DEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM2IPROC m_orig_glUniform2i = nullptr;
+void m_glUniform2i_validation(GLint location,GLint v0,GLint v1)const{(this->*(this->m_orig_glUniform2i))(location,v0,v1);this->m_checkErrors("glUniform2i");}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC m_orig_glCopyTexImage2DEXT = nullptr;
+void m_glCopyTexImage2DEXT_validation(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{(this->*(this->m_orig_glCopyTexImage2DEXT))(target,level,internalformat,x,y,width,height,border);this->m_checkErrors("glCopyTexImage2DEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM2DPROC m_orig_glUniform2d = nullptr;
+void m_glUniform2d_validation(GLint location,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glUniform2d))(location,x,y);this->m_checkErrors("glUniform2d");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC m_orig_glVertexAttribL1d = nullptr;
+void m_glVertexAttribL1d_validation(GLuint index,GLdouble x)const{(this->*(this->m_orig_glVertexAttribL1d))(index,x);this->m_checkErrors("glVertexAttribL1d");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC m_orig_glFramebufferTextureFaceEXT = nullptr;
+void m_glFramebufferTextureFaceEXT_validation(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{(this->*(this->m_orig_glFramebufferTextureFaceEXT))(target,attachment,texture,level,face);this->m_checkErrors("glFramebufferTextureFaceEXT");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC m_orig_glFramebufferTextureLayer = nullptr;
+void m_glFramebufferTextureLayer_validation(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{(this->*(this->m_orig_glFramebufferTextureLayer))(target,attachment,texture,level,layer);this->m_checkErrors("glFramebufferTextureLayer");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC m_orig_glMultiTexCoord4bvOES = nullptr;
+void m_glMultiTexCoord4bvOES_validation(GLenum texture,const GLbyte* coords)const{(this->*(this->m_orig_glMultiTexCoord4bvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord4bvOES");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC m_orig_glGetVertexArrayPointeri_vEXT = nullptr;
+void m_glGetVertexArrayPointeri_vEXT_validation(GLuint vaobj,GLuint index,GLenum pname,void** param)const{(this->*(this->m_orig_glGetVertexArrayPointeri_vEXT))(vaobj,index,pname,param);this->m_checkErrors("glGetVertexArrayPointeri_vEXT");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC m_orig_glNamedProgramLocalParameter4dEXT = nullptr;
+void m_glNamedProgramLocalParameter4dEXT_validation(GLuint program,GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glNamedProgramLocalParameter4dEXT))(program,target,index,x,y,z,w);this->m_checkErrors("glNamedProgramLocalParameter4dEXT");}
+FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC m_orig_glBinormal3bEXT = nullptr;
+void m_glBinormal3bEXT_validation(GLbyte bx,GLbyte by,GLbyte bz)const{(this->*(this->m_orig_glBinormal3bEXT))(bx,by,bz);this->m_checkErrors("glBinormal3bEXT");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC m_orig_glConvolutionFilter2DEXT = nullptr;
+void m_glConvolutionFilter2DEXT_validation(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* image)const{(this->*(this->m_orig_glConvolutionFilter2DEXT))(target,internalformat,width,height,format,type,image);this->m_checkErrors("glConvolutionFilter2DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC m_orig_glProgramUniform2fv = nullptr;
+void m_glProgramUniform2fv_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform2fv))(program,location,count,value);this->m_checkErrors("glProgramUniform2fv");}
+FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC m_orig_glColor3fVertex3fSUN = nullptr;
+void m_glColor3fVertex3fSUN_validation(GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glColor3fVertex3fSUN))(r,g,b,x,y,z);this->m_checkErrors("glColor3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC m_orig_glNormal3fVertex3fvSUN = nullptr;
+void m_glNormal3fVertex3fvSUN_validation(const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glNormal3fVertex3fvSUN))(n,v);this->m_checkErrors("glNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC m_orig_glCopyMultiTexSubImage3DEXT = nullptr;
+void m_glCopyMultiTexSubImage3DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyMultiTexSubImage3DEXT))(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);this->m_checkErrors("glCopyMultiTexSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC m_orig_glProgramLocalParameterI4iNV = nullptr;
+void m_glProgramLocalParameterI4iNV_validation(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glProgramLocalParameterI4iNV))(target,index,x,y,z,w);this->m_checkErrors("glProgramLocalParameterI4iNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC m_orig_glProgramUniformMatrix2x4dv = nullptr;
+void m_glProgramUniformMatrix2x4dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x4dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x4dv");}
+FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC m_orig_glPathMemoryGlyphIndexArrayNV = nullptr;
+GLenum m_glPathMemoryGlyphIndexArrayNV_validation(GLuint firstPathName,GLenum fontTarget,GLsizeiptr fontSize,const void* fontData,GLsizei faceIndex,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{GLenum const result = (this->*(this->m_orig_glPathMemoryGlyphIndexArrayNV))(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);this->m_checkErrors("glPathMemoryGlyphIndexArrayNV");return result;}
+FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC m_orig_glDrawArraysEXT = nullptr;
+void m_glDrawArraysEXT_validation(GLenum mode,GLint first,GLsizei count)const{(this->*(this->m_orig_glDrawArraysEXT))(mode,first,count);this->m_checkErrors("glDrawArraysEXT");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC m_orig_glBlendEquationEXT = nullptr;
+void m_glBlendEquationEXT_validation(GLenum mode)const{(this->*(this->m_orig_glBlendEquationEXT))(mode);this->m_checkErrors("glBlendEquationEXT");}
+FunctionTable::MEMBERPFNGLSTENCILOPPROC m_orig_glStencilOp = nullptr;
+void m_glStencilOp_validation(GLenum fail,GLenum zfail,GLenum zpass)const{(this->*(this->m_orig_glStencilOp))(fail,zfail,zpass);this->m_checkErrors("glStencilOp");}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC m_orig_glCopyTextureSubImage2DEXT = nullptr;
+void m_glCopyTextureSubImage2DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTextureSubImage2DEXT))(texture,target,level,xoffset,yoffset,x,y,width,height);this->m_checkErrors("glCopyTextureSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLTEXENVFPROC m_orig_glTexEnvf = nullptr;
+void m_glTexEnvf_validation(GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glTexEnvf))(target,pname,param);this->m_checkErrors("glTexEnvf");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC m_orig_glVertexAttrib2dvNV = nullptr;
+void m_glVertexAttrib2dvNV_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib2dvNV))(index,v);this->m_checkErrors("glVertexAttrib2dvNV");}
+FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC m_orig_glGenPerfMonitorsAMD = nullptr;
+void m_glGenPerfMonitorsAMD_validation(GLsizei n,GLuint* monitors)const{(this->*(this->m_orig_glGenPerfMonitorsAMD))(n,monitors);this->m_checkErrors("glGenPerfMonitorsAMD");}
+FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC m_orig_glGetInteger64i_v = nullptr;
+void m_glGetInteger64i_v_validation(GLenum target,GLuint index,GLint64* data)const{(this->*(this->m_orig_glGetInteger64i_v))(target,index,data);this->m_checkErrors("glGetInteger64i_v");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC m_orig_glGetHistogramParameterfv = nullptr;
+void m_glGetHistogramParameterfv_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetHistogramParameterfv))(target,pname,params);this->m_checkErrors("glGetHistogramParameterfv");}
+FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC m_orig_glVertexFormatNV = nullptr;
+void m_glVertexFormatNV_validation(GLint size,GLenum type,GLsizei stride)const{(this->*(this->m_orig_glVertexFormatNV))(size,type,stride);this->m_checkErrors("glVertexFormatNV");}
+FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC m_orig_glBlendFuncIndexedAMD = nullptr;
+void m_glBlendFuncIndexedAMD_validation(GLuint buf,GLenum src,GLenum dst)const{(this->*(this->m_orig_glBlendFuncIndexedAMD))(buf,src,dst);this->m_checkErrors("glBlendFuncIndexedAMD");}
+FunctionTable::MEMBERPFNGLTEXENVIPROC m_orig_glTexEnvi = nullptr;
+void m_glTexEnvi_validation(GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glTexEnvi))(target,pname,param);this->m_checkErrors("glTexEnvi");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC m_orig_glMultiTexCoord1iv = nullptr;
+void m_glMultiTexCoord1iv_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord1iv))(target,v);this->m_checkErrors("glMultiTexCoord1iv");}
+FunctionTable::MEMBERPFNGLISENABLEDIPROC m_orig_glIsEnabledi = nullptr;
+GLboolean m_glIsEnabledi_validation(GLenum target,GLuint index)const{GLboolean const result = (this->*(this->m_orig_glIsEnabledi))(target,index);this->m_checkErrors("glIsEnabledi");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC m_orig_glVertexAttribL2ui64vNV = nullptr;
+void m_glVertexAttribL2ui64vNV_validation(GLuint index,const GLuint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL2ui64vNV))(index,v);this->m_checkErrors("glVertexAttribL2ui64vNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC m_orig_glVertexAttribL4i64NV = nullptr;
+void m_glVertexAttribL4i64NV_validation(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{(this->*(this->m_orig_glVertexAttribL4i64NV))(index,x,y,z,w);this->m_checkErrors("glVertexAttribL4i64NV");}
+FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC m_orig_glMatrixTranslatedEXT = nullptr;
+void m_glMatrixTranslatedEXT_validation(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glMatrixTranslatedEXT))(mode,x,y,z);this->m_checkErrors("glMatrixTranslatedEXT");}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC m_orig_glMakeTextureHandleResidentARB = nullptr;
+void m_glMakeTextureHandleResidentARB_validation(GLuint64 handle)const{(this->*(this->m_orig_glMakeTextureHandleResidentARB))(handle);this->m_checkErrors("glMakeTextureHandleResidentARB");}
+FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC m_orig_glMatrixMultdEXT = nullptr;
+void m_glMatrixMultdEXT_validation(GLenum mode,const GLdouble* m)const{(this->*(this->m_orig_glMatrixMultdEXT))(mode,m);this->m_checkErrors("glMatrixMultdEXT");}
+FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC m_orig_glBinormal3dvEXT = nullptr;
+void m_glBinormal3dvEXT_validation(const GLdouble* v)const{(this->*(this->m_orig_glBinormal3dvEXT))(v);this->m_checkErrors("glBinormal3dvEXT");}
+FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC m_orig_glImportSyncEXT = nullptr;
+GLsync m_glImportSyncEXT_validation(GLenum external_sync_type,GLintptr external_sync,GLbitfield flags)const{GLsync const result = (this->*(this->m_orig_glImportSyncEXT))(external_sync_type,external_sync,flags);this->m_checkErrors("glImportSyncEXT");return result;}
+FunctionTable::MEMBERPFNGLGETMAPIVPROC m_orig_glGetMapiv = nullptr;
+void m_glGetMapiv_validation(GLenum target,GLenum query,GLint* v)const{(this->*(this->m_orig_glGetMapiv))(target,query,v);this->m_checkErrors("glGetMapiv");}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC m_orig_glImportSemaphoreFdEXT = nullptr;
+void m_glImportSemaphoreFdEXT_validation(GLuint semaphore,GLenum handleType,GLint fd)const{(this->*(this->m_orig_glImportSemaphoreFdEXT))(semaphore,handleType,fd);this->m_checkErrors("glImportSemaphoreFdEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC m_orig_glMultiTexCoord4sv = nullptr;
+void m_glMultiTexCoord4sv_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord4sv))(target,v);this->m_checkErrors("glMultiTexCoord4sv");}
+FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC m_orig_glPNTrianglesiATI = nullptr;
+void m_glPNTrianglesiATI_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glPNTrianglesiATI))(pname,param);this->m_checkErrors("glPNTrianglesiATI");}
+FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC m_orig_glBindVertexArrayAPPLE = nullptr;
+void m_glBindVertexArrayAPPLE_validation(GLuint array)const{(this->*(this->m_orig_glBindVertexArrayAPPLE))(array);this->m_checkErrors("glBindVertexArrayAPPLE");}
+FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC m_orig_glObjectPtrLabel = nullptr;
+void m_glObjectPtrLabel_validation(const void* ptr,GLsizei length,const GLchar* label)const{(this->*(this->m_orig_glObjectPtrLabel))(ptr,length,label);this->m_checkErrors("glObjectPtrLabel");}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC m_orig_glGetDebugMessageLog = nullptr;
+GLuint m_glGetDebugMessageLog_validation(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{GLuint const result = (this->*(this->m_orig_glGetDebugMessageLog))(count,bufSize,sources,types,ids,severities,lengths,messageLog);this->m_checkErrors("glGetDebugMessageLog");return result;}
+FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC m_orig_glTrackMatrixNV = nullptr;
+void m_glTrackMatrixNV_validation(GLenum target,GLuint address,GLenum matrix,GLenum transform)const{(this->*(this->m_orig_glTrackMatrixNV))(target,address,matrix,transform);this->m_checkErrors("glTrackMatrixNV");}
+FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC m_orig_glProgramPathFragmentInputGenNV = nullptr;
+void m_glProgramPathFragmentInputGenNV_validation(GLuint program,GLint location,GLenum genMode,GLint components,const GLfloat* coeffs)const{(this->*(this->m_orig_glProgramPathFragmentInputGenNV))(program,location,genMode,components,coeffs);this->m_checkErrors("glProgramPathFragmentInputGenNV");}
+FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC m_orig_glTangent3ivEXT = nullptr;
+void m_glTangent3ivEXT_validation(const GLint* v)const{(this->*(this->m_orig_glTangent3ivEXT))(v);this->m_checkErrors("glTangent3ivEXT");}
+FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC m_orig_glGetUniformfv = nullptr;
+void m_glGetUniformfv_validation(GLuint program,GLint location,GLfloat* params)const{(this->*(this->m_orig_glGetUniformfv))(program,location,params);this->m_checkErrors("glGetUniformfv");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC m_orig_glSecondaryColor3ubv = nullptr;
+void m_glSecondaryColor3ubv_validation(const GLubyte* v)const{(this->*(this->m_orig_glSecondaryColor3ubv))(v);this->m_checkErrors("glSecondaryColor3ubv");}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC m_orig_glMakeTextureHandleNonResidentNV = nullptr;
+void m_glMakeTextureHandleNonResidentNV_validation(GLuint64 handle)const{(this->*(this->m_orig_glMakeTextureHandleNonResidentNV))(handle);this->m_checkErrors("glMakeTextureHandleNonResidentNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC m_orig_glVertexAttribs4ubvNV = nullptr;
+void m_glVertexAttribs4ubvNV_validation(GLuint index,GLsizei count,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttribs4ubvNV))(index,count,v);this->m_checkErrors("glVertexAttribs4ubvNV");}
+FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC m_orig_glClipPlanexOES = nullptr;
+void m_glClipPlanexOES_validation(GLenum plane,const GLfixed* equation)const{(this->*(this->m_orig_glClipPlanexOES))(plane,equation);this->m_checkErrors("glClipPlanexOES");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC m_orig_glMultiTexCoord3iv = nullptr;
+void m_glMultiTexCoord3iv_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord3iv))(target,v);this->m_checkErrors("glMultiTexCoord3iv");}
+FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC m_orig_glGetnPolygonStippleARB = nullptr;
+void m_glGetnPolygonStippleARB_validation(GLsizei bufSize,GLubyte* pattern)const{(this->*(this->m_orig_glGetnPolygonStippleARB))(bufSize,pattern);this->m_checkErrors("glGetnPolygonStippleARB");}
+FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC m_orig_glUniform2i64vNV = nullptr;
+void m_glUniform2i64vNV_validation(GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glUniform2i64vNV))(location,count,value);this->m_checkErrors("glUniform2i64vNV");}
+FunctionTable::MEMBERPFNGLLIGHTMODELFPROC m_orig_glLightModelf = nullptr;
+void m_glLightModelf_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glLightModelf))(pname,param);this->m_checkErrors("glLightModelf");}
+FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC m_orig_glDeleteMemoryObjectsEXT = nullptr;
+void m_glDeleteMemoryObjectsEXT_validation(GLsizei n,const GLuint* memoryObjects)const{(this->*(this->m_orig_glDeleteMemoryObjectsEXT))(n,memoryObjects);this->m_checkErrors("glDeleteMemoryObjectsEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC m_orig_glMultiTexSubImage2DEXT = nullptr;
+void m_glMultiTexSubImage2DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glMultiTexSubImage2DEXT))(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);this->m_checkErrors("glMultiTexSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiColor3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor3fVertex3fSUN_validation(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiColor3fVertex3fSUN))(rc,r,g,b,x,y,z);this->m_checkErrors("glReplacementCodeuiColor3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC m_orig_glTangent3dvEXT = nullptr;
+void m_glTangent3dvEXT_validation(const GLdouble* v)const{(this->*(this->m_orig_glTangent3dvEXT))(v);this->m_checkErrors("glTangent3dvEXT");}
+FunctionTable::MEMBERPFNGLLIGHTMODELIPROC m_orig_glLightModeli = nullptr;
+void m_glLightModeli_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glLightModeli))(pname,param);this->m_checkErrors("glLightModeli");}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC m_orig_glVertexWeighthvNV = nullptr;
+void m_glVertexWeighthvNV_validation(const GLhalfNV* weight)const{(this->*(this->m_orig_glVertexWeighthvNV))(weight);this->m_checkErrors("glVertexWeighthvNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC m_orig_glWindowPos3iv = nullptr;
+void m_glWindowPos3iv_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos3iv))(v);this->m_checkErrors("glWindowPos3iv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC m_orig_glMultiTexCoordP1uiv = nullptr;
+void m_glMultiTexCoordP1uiv_validation(GLenum texture,GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glMultiTexCoordP1uiv))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP1uiv");}
+FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC m_orig_glTransformPathNV = nullptr;
+void m_glTransformPathNV_validation(GLuint resultPath,GLuint srcPath,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glTransformPathNV))(resultPath,srcPath,transformType,transformValues);this->m_checkErrors("glTransformPathNV");}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC m_orig_glProgramNamedParameter4dNV = nullptr;
+void m_glProgramNamedParameter4dNV_validation(GLuint id,GLsizei len,const GLubyte* name,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glProgramNamedParameter4dNV))(id,len,name,x,y,z,w);this->m_checkErrors("glProgramNamedParameter4dNV");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC m_orig_glMultiDrawElementsIndirect = nullptr;
+void m_glMultiDrawElementsIndirect_validation(GLenum mode,GLenum type,const void* indirect,GLsizei drawcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawElementsIndirect))(mode,type,indirect,drawcount,stride);this->m_checkErrors("glMultiDrawElementsIndirect");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC m_orig_glProgramUniform1dEXT = nullptr;
+void m_glProgramUniform1dEXT_validation(GLuint program,GLint location,GLdouble x)const{(this->*(this->m_orig_glProgramUniform1dEXT))(program,location,x);this->m_checkErrors("glProgramUniform1dEXT");}
+FunctionTable::MEMBERPFNGLCALLLISTSPROC m_orig_glCallLists = nullptr;
+void m_glCallLists_validation(GLsizei n,GLenum type,const GLvoid* lists)const{(this->*(this->m_orig_glCallLists))(n,type,lists);this->m_checkErrors("glCallLists");}
+FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC m_orig_glNormal3hvNV = nullptr;
+void m_glNormal3hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glNormal3hvNV))(v);this->m_checkErrors("glNormal3hvNV");}
+FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC m_orig_glGetCombinerOutputParameterfvNV = nullptr;
+void m_glGetCombinerOutputParameterfvNV_validation(GLenum stage,GLenum portion,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetCombinerOutputParameterfvNV))(stage,portion,pname,params);this->m_checkErrors("glGetCombinerOutputParameterfvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC m_orig_glVertexAttrib4sARB = nullptr;
+void m_glVertexAttrib4sARB_validation(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glVertexAttrib4sARB))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4sARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD3IPROC m_orig_glTexCoord3i = nullptr;
+void m_glTexCoord3i_validation(GLint s,GLint t,GLint r)const{(this->*(this->m_orig_glTexCoord3i))(s,t,r);this->m_checkErrors("glTexCoord3i");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC m_orig_glVertexAttribI3uiv = nullptr;
+void m_glVertexAttribI3uiv_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI3uiv))(index,v);this->m_checkErrors("glVertexAttribI3uiv");}
+FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC m_orig_glPushDebugGroup = nullptr;
+void m_glPushDebugGroup_validation(GLenum source,GLuint id,GLsizei length,const GLchar* message)const{(this->*(this->m_orig_glPushDebugGroup))(source,id,length,message);this->m_checkErrors("glPushDebugGroup");}
+FunctionTable::MEMBERPFNGLTEXCOORD3FPROC m_orig_glTexCoord3f = nullptr;
+void m_glTexCoord3f_validation(GLfloat s,GLfloat t,GLfloat r)const{(this->*(this->m_orig_glTexCoord3f))(s,t,r);this->m_checkErrors("glTexCoord3f");}
+FunctionTable::MEMBERPFNGLTEXCOORD3DPROC m_orig_glTexCoord3d = nullptr;
+void m_glTexCoord3d_validation(GLdouble s,GLdouble t,GLdouble r)const{(this->*(this->m_orig_glTexCoord3d))(s,t,r);this->m_checkErrors("glTexCoord3d");}
+FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC m_orig_glTexCoord2xOES = nullptr;
+void m_glTexCoord2xOES_validation(GLfixed s,GLfixed t)const{(this->*(this->m_orig_glTexCoord2xOES))(s,t);this->m_checkErrors("glTexCoord2xOES");}
+FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC m_orig_glGetStageIndexNV = nullptr;
+GLushort m_glGetStageIndexNV_validation(GLenum shadertype)const{GLushort const result = (this->*(this->m_orig_glGetStageIndexNV))(shadertype);this->m_checkErrors("glGetStageIndexNV");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC m_orig_glProgramUniform4i64vNV = nullptr;
+void m_glProgramUniform4i64vNV_validation(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glProgramUniform4i64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform4i64vNV");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC m_orig_glGetNamedBufferPointervEXT = nullptr;
+void m_glGetNamedBufferPointervEXT_validation(GLuint buffer,GLenum pname,void** params)const{(this->*(this->m_orig_glGetNamedBufferPointervEXT))(buffer,pname,params);this->m_checkErrors("glGetNamedBufferPointervEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC m_orig_glTextureBarrierNV = nullptr;
+void m_glTextureBarrierNV_validation()const{(this->*(this->m_orig_glTextureBarrierNV))();this->m_checkErrors("glTextureBarrierNV");}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC m_orig_glColor4ubVertex3fvSUN = nullptr;
+void m_glColor4ubVertex3fvSUN_validation(const GLubyte* c,const GLfloat* v)const{(this->*(this->m_orig_glColor4ubVertex3fvSUN))(c,v);this->m_checkErrors("glColor4ubVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC m_orig_glGetCommandHeaderNV = nullptr;
+GLuint m_glGetCommandHeaderNV_validation(GLenum tokenID,GLuint size)const{GLuint const result = (this->*(this->m_orig_glGetCommandHeaderNV))(tokenID,size);this->m_checkErrors("glGetCommandHeaderNV");return result;}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC m_orig_glGetPerfMonitorCounterInfoAMD = nullptr;
+void m_glGetPerfMonitorCounterInfoAMD_validation(GLuint group,GLuint counter,GLenum pname,void* data)const{(this->*(this->m_orig_glGetPerfMonitorCounterInfoAMD))(group,counter,pname,data);this->m_checkErrors("glGetPerfMonitorCounterInfoAMD");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC m_orig_glVertexAttrib1svARB = nullptr;
+void m_glVertexAttrib1svARB_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib1svARB))(index,v);this->m_checkErrors("glVertexAttrib1svARB");}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC m_orig_glCombinerParameteriNV = nullptr;
+void m_glCombinerParameteriNV_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glCombinerParameteriNV))(pname,param);this->m_checkErrors("glCombinerParameteriNV");}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC m_orig_glMatrixMultTransposefEXT = nullptr;
+void m_glMatrixMultTransposefEXT_validation(GLenum mode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixMultTransposefEXT))(mode,m);this->m_checkErrors("glMatrixMultTransposefEXT");}
+FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC m_orig_glDetailTexFuncSGIS = nullptr;
+void m_glDetailTexFuncSGIS_validation(GLenum target,GLsizei n,const GLfloat* points)const{(this->*(this->m_orig_glDetailTexFuncSGIS))(target,n,points);this->m_checkErrors("glDetailTexFuncSGIS");}
+FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC m_orig_glAreTexturesResident = nullptr;
+GLboolean m_glAreTexturesResident_validation(GLsizei n,const GLuint* textures,GLboolean* residences)const{GLboolean const result = (this->*(this->m_orig_glAreTexturesResident))(n,textures,residences);this->m_checkErrors("glAreTexturesResident");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC m_orig_glProgramUniform2d = nullptr;
+void m_glProgramUniform2d_validation(GLuint program,GLint location,GLdouble v0,GLdouble v1)const{(this->*(this->m_orig_glProgramUniform2d))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2d");}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC m_orig_glGetConvolutionParameterfvEXT = nullptr;
+void m_glGetConvolutionParameterfvEXT_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetConvolutionParameterfvEXT))(target,pname,params);this->m_checkErrors("glGetConvolutionParameterfvEXT");}
+FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC m_orig_glIndexPointerListIBM = nullptr;
+void m_glIndexPointerListIBM_validation(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glIndexPointerListIBM))(type,stride,pointer,ptrstride);this->m_checkErrors("glIndexPointerListIBM");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC m_orig_glVertexAttribI4iEXT = nullptr;
+void m_glVertexAttribI4iEXT_validation(GLuint index,GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glVertexAttribI4iEXT))(index,x,y,z,w);this->m_checkErrors("glVertexAttribI4iEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC m_orig_glProgramUniform2f = nullptr;
+void m_glProgramUniform2f_validation(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{(this->*(this->m_orig_glProgramUniform2f))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2f");}
+FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC m_orig_glRasterPos4sv = nullptr;
+void m_glRasterPos4sv_validation(const GLshort* v)const{(this->*(this->m_orig_glRasterPos4sv))(v);this->m_checkErrors("glRasterPos4sv");}
+FunctionTable::MEMBERPFNGLCOLOR4SPROC m_orig_glColor4s = nullptr;
+void m_glColor4s_validation(GLshort red,GLshort green,GLshort blue,GLshort alpha)const{(this->*(this->m_orig_glColor4s))(red,green,blue,alpha);this->m_checkErrors("glColor4s");}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC m_orig_glMulticastGetQueryObjectivNV = nullptr;
+void m_glMulticastGetQueryObjectivNV_validation(GLuint gpu,GLuint id,GLenum pname,GLint* params)const{(this->*(this->m_orig_glMulticastGetQueryObjectivNV))(gpu,id,pname,params);this->m_checkErrors("glMulticastGetQueryObjectivNV");}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC m_orig_glColorFragmentOp3ATI = nullptr;
+void m_glColorFragmentOp3ATI_validation(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{(this->*(this->m_orig_glColorFragmentOp3ATI))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);this->m_checkErrors("glColorFragmentOp3ATI");}
+FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC m_orig_glResizeBuffersMESA = nullptr;
+void m_glResizeBuffersMESA_validation()const{(this->*(this->m_orig_glResizeBuffersMESA))();this->m_checkErrors("glResizeBuffersMESA");}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC m_orig_glGetMinmaxParameterfv = nullptr;
+void m_glGetMinmaxParameterfv_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMinmaxParameterfv))(target,pname,params);this->m_checkErrors("glGetMinmaxParameterfv");}
+FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC m_orig_glClientActiveTextureARB = nullptr;
+void m_glClientActiveTextureARB_validation(GLenum texture)const{(this->*(this->m_orig_glClientActiveTextureARB))(texture);this->m_checkErrors("glClientActiveTextureARB");}
+FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC m_orig_glBindVertexArray = nullptr;
+void m_glBindVertexArray_validation(GLuint array)const{(this->*(this->m_orig_glBindVertexArray))(array);this->m_checkErrors("glBindVertexArray");}
+FunctionTable::MEMBERPFNGLCOLOR4BPROC m_orig_glColor4b = nullptr;
+void m_glColor4b_validation(GLbyte red,GLbyte green,GLbyte blue,GLbyte alpha)const{(this->*(this->m_orig_glColor4b))(red,green,blue,alpha);this->m_checkErrors("glColor4b");}
+FunctionTable::MEMBERPFNGLCOLOR4FPROC m_orig_glColor4f = nullptr;
+void m_glColor4f_validation(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{(this->*(this->m_orig_glColor4f))(red,green,blue,alpha);this->m_checkErrors("glColor4f");}
+FunctionTable::MEMBERPFNGLCOLOR4DPROC m_orig_glColor4d = nullptr;
+void m_glColor4d_validation(GLdouble red,GLdouble green,GLdouble blue,GLdouble alpha)const{(this->*(this->m_orig_glColor4d))(red,green,blue,alpha);this->m_checkErrors("glColor4d");}
+FunctionTable::MEMBERPFNGLCOLOR4IPROC m_orig_glColor4i = nullptr;
+void m_glColor4i_validation(GLint red,GLint green,GLint blue,GLint alpha)const{(this->*(this->m_orig_glColor4i))(red,green,blue,alpha);this->m_checkErrors("glColor4i");}
+FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC m_orig_glEdgeFlagFormatNV = nullptr;
+void m_glEdgeFlagFormatNV_validation(GLsizei stride)const{(this->*(this->m_orig_glEdgeFlagFormatNV))(stride);this->m_checkErrors("glEdgeFlagFormatNV");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC m_orig_glNamedBufferSubData = nullptr;
+void m_glNamedBufferSubData_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{(this->*(this->m_orig_glNamedBufferSubData))(buffer,offset,size,data);this->m_checkErrors("glNamedBufferSubData");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC m_orig_glDrawElementsInstanced = nullptr;
+void m_glDrawElementsInstanced_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount)const{(this->*(this->m_orig_glDrawElementsInstanced))(mode,count,type,indices,instancecount);this->m_checkErrors("glDrawElementsInstanced");}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC m_orig_glGetMultiTexParameterIivEXT = nullptr;
+void m_glGetMultiTexParameterIivEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMultiTexParameterIivEXT))(texunit,target,pname,params);this->m_checkErrors("glGetMultiTexParameterIivEXT");}
+FunctionTable::MEMBERPFNGLVERTEX2DVPROC m_orig_glVertex2dv = nullptr;
+void m_glVertex2dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glVertex2dv))(v);this->m_checkErrors("glVertex2dv");}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC m_orig_glDisableVertexArrayAttribEXT = nullptr;
+void m_glDisableVertexArrayAttribEXT_validation(GLuint vaobj,GLuint index)const{(this->*(this->m_orig_glDisableVertexArrayAttribEXT))(vaobj,index);this->m_checkErrors("glDisableVertexArrayAttribEXT");}
+FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC m_orig_glObjectUnpurgeableAPPLE = nullptr;
+GLenum m_glObjectUnpurgeableAPPLE_validation(GLenum objectType,GLuint name,GLenum option)const{GLenum const result = (this->*(this->m_orig_glObjectUnpurgeableAPPLE))(objectType,name,option);this->m_checkErrors("glObjectUnpurgeableAPPLE");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC m_orig_glVertexAttribs2dvNV = nullptr;
+void m_glVertexAttribs2dvNV_validation(GLuint index,GLsizei count,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribs2dvNV))(index,count,v);this->m_checkErrors("glVertexAttribs2dvNV");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fVertex3fSUN_validation(GLuint rc,GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN))(rc,s,t,x,y,z);this->m_checkErrors("glReplacementCodeuiTexCoord2fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC m_orig_glGetMapParameterfvNV = nullptr;
+void m_glGetMapParameterfvNV_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMapParameterfvNV))(target,pname,params);this->m_checkErrors("glGetMapParameterfvNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC m_orig_glProgramUniform4ivEXT = nullptr;
+void m_glProgramUniform4ivEXT_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform4ivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform4ivEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC m_orig_glProgramUniform3ui64vNV = nullptr;
+void m_glProgramUniform3ui64vNV_validation(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glProgramUniform3ui64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform3ui64vNV");}
+FunctionTable::MEMBERPFNGLRECTFVPROC m_orig_glRectfv = nullptr;
+void m_glRectfv_validation(const GLfloat* v1,const GLfloat* v2)const{(this->*(this->m_orig_glRectfv))(v1,v2);this->m_checkErrors("glRectfv");}
+FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC m_orig_glTexFilterFuncSGIS = nullptr;
+void m_glTexFilterFuncSGIS_validation(GLenum target,GLenum filter,GLsizei n,const GLfloat* weights)const{(this->*(this->m_orig_glTexFilterFuncSGIS))(target,filter,n,weights);this->m_checkErrors("glTexFilterFuncSGIS");}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC m_orig_glSpriteParameterfvSGIX = nullptr;
+void m_glSpriteParameterfvSGIX_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glSpriteParameterfvSGIX))(pname,params);this->m_checkErrors("glSpriteParameterfvSGIX");}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC m_orig_glCopyMultiTexImage1DEXT = nullptr;
+void m_glCopyMultiTexImage1DEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{(this->*(this->m_orig_glCopyMultiTexImage1DEXT))(texunit,target,level,internalformat,x,y,width,border);this->m_checkErrors("glCopyMultiTexImage1DEXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC m_orig_glGetVertexAttribIuivEXT = nullptr;
+void m_glGetVertexAttribIuivEXT_validation(GLuint index,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetVertexAttribIuivEXT))(index,pname,params);this->m_checkErrors("glGetVertexAttribIuivEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC m_orig_glUniformMatrix2x4dv = nullptr;
+void m_glUniformMatrix2x4dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix2x4dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2x4dv");}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC m_orig_glGetProgramResourceLocationIndex = nullptr;
+GLint m_glGetProgramResourceLocationIndex_validation(GLuint program,GLenum programInterface,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetProgramResourceLocationIndex))(program,programInterface,name);this->m_checkErrors("glGetProgramResourceLocationIndex");return result;}
+FunctionTable::MEMBERPFNGLCOLOR3HNVPROC m_orig_glColor3hNV = nullptr;
+void m_glColor3hNV_validation(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{(this->*(this->m_orig_glColor3hNV))(red,green,blue);this->m_checkErrors("glColor3hNV");}
+FunctionTable::MEMBERPFNGLVIEWPORTPROC m_orig_glViewport = nullptr;
+void m_glViewport_validation(GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glViewport))(x,y,width,height);this->m_checkErrors("glViewport");}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC m_orig_glProgramNamedParameter4fNV = nullptr;
+void m_glProgramNamedParameter4fNV_validation(GLuint id,GLsizei len,const GLubyte* name,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glProgramNamedParameter4fNV))(id,len,name,x,y,z,w);this->m_checkErrors("glProgramNamedParameter4fNV");}
+FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC m_orig_glGetInvariantBooleanvEXT = nullptr;
+void m_glGetInvariantBooleanvEXT_validation(GLuint id,GLenum value,GLboolean* data)const{(this->*(this->m_orig_glGetInvariantBooleanvEXT))(id,value,data);this->m_checkErrors("glGetInvariantBooleanvEXT");}
+FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC m_orig_glTexStorage2DMultisample = nullptr;
+void m_glTexStorage2DMultisample_validation(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTexStorage2DMultisample))(target,samples,internalformat,width,height,fixedsamplelocations);this->m_checkErrors("glTexStorage2DMultisample");}
+FunctionTable::MEMBERPFNGLPIXELSTOREXPROC m_orig_glPixelStorex = nullptr;
+void m_glPixelStorex_validation(GLenum pname,GLfixed param)const{(this->*(this->m_orig_glPixelStorex))(pname,param);this->m_checkErrors("glPixelStorex");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC m_orig_glVertexAttribL1dvEXT = nullptr;
+void m_glVertexAttribL1dvEXT_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL1dvEXT))(index,v);this->m_checkErrors("glVertexAttribL1dvEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC m_orig_glGetActiveSubroutineUniformiv = nullptr;
+void m_glGetActiveSubroutineUniformiv_validation(GLuint program,GLenum shadertype,GLuint index,GLenum pname,GLint* values)const{(this->*(this->m_orig_glGetActiveSubroutineUniformiv))(program,shadertype,index,pname,values);this->m_checkErrors("glGetActiveSubroutineUniformiv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC m_orig_glVertexAttribPointerARB = nullptr;
+void m_glVertexAttribPointerARB_validation(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribPointerARB))(index,size,type,normalized,stride,pointer);this->m_checkErrors("glVertexAttribPointerARB");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC m_orig_glCompressedTexSubImage2DARB = nullptr;
+void m_glCompressedTexSubImage2DARB_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTexSubImage2DARB))(target,level,xoffset,yoffset,width,height,format,imageSize,data);this->m_checkErrors("glCompressedTexSubImage2DARB");}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC m_orig_glTexStorageMem1DEXT = nullptr;
+void m_glTexStorageMem1DEXT_validation(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTexStorageMem1DEXT))(target,levels,internalFormat,width,memory,offset);this->m_checkErrors("glTexStorageMem1DEXT");}
+FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC m_orig_glVertex2hvNV = nullptr;
+void m_glVertex2hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glVertex2hvNV))(v);this->m_checkErrors("glVertex2hvNV");}
+FunctionTable::MEMBERPFNGLTEXBUFFERPROC m_orig_glTexBuffer = nullptr;
+void m_glTexBuffer_validation(GLenum target,GLenum internalformat,GLuint buffer)const{(this->*(this->m_orig_glTexBuffer))(target,internalformat,buffer);this->m_checkErrors("glTexBuffer");}
+FunctionTable::MEMBERPFNGLARRAYELEMENTPROC m_orig_glArrayElement = nullptr;
+void m_glArrayElement_validation(GLint i)const{(this->*(this->m_orig_glArrayElement))(i);this->m_checkErrors("glArrayElement");}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC m_orig_glValidateProgram = nullptr;
+void m_glValidateProgram_validation(GLuint program)const{(this->*(this->m_orig_glValidateProgram))(program);this->m_checkErrors("glValidateProgram");}
+FunctionTable::MEMBERPFNGLPIXELSTOREFPROC m_orig_glPixelStoref = nullptr;
+void m_glPixelStoref_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPixelStoref))(pname,param);this->m_checkErrors("glPixelStoref");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC m_orig_glWindowPos3dARB = nullptr;
+void m_glWindowPos3dARB_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glWindowPos3dARB))(x,y,z);this->m_checkErrors("glWindowPos3dARB");}
+FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC m_orig_glEvalCoord1dv = nullptr;
+void m_glEvalCoord1dv_validation(const GLdouble* u)const{(this->*(this->m_orig_glEvalCoord1dv))(u);this->m_checkErrors("glEvalCoord1dv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC m_orig_glVertexAttribs2fvNV = nullptr;
+void m_glVertexAttribs2fvNV_validation(GLuint index,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttribs2fvNV))(index,count,v);this->m_checkErrors("glVertexAttribs2fvNV");}
+FunctionTable::MEMBERPFNGLRECTIPROC m_orig_glRecti = nullptr;
+void m_glRecti_validation(GLint x1,GLint y1,GLint x2,GLint y2)const{(this->*(this->m_orig_glRecti))(x1,y1,x2,y2);this->m_checkErrors("glRecti");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_validation(const GLuint* rc,const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN))(rc,tc,c,n,v);this->m_checkErrors("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC m_orig_glTexCoord1bOES = nullptr;
+void m_glTexCoord1bOES_validation(GLbyte s)const{(this->*(this->m_orig_glTexCoord1bOES))(s);this->m_checkErrors("glTexCoord1bOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC m_orig_glProgramUniform2i64vARB = nullptr;
+void m_glProgramUniform2i64vARB_validation(GLuint program,GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glProgramUniform2i64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform2i64vARB");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC m_orig_glWindowPos2dARB = nullptr;
+void m_glWindowPos2dARB_validation(GLdouble x,GLdouble y)const{(this->*(this->m_orig_glWindowPos2dARB))(x,y);this->m_checkErrors("glWindowPos2dARB");}
+FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC m_orig_glGetProgramParameterdvNV = nullptr;
+void m_glGetProgramParameterdvNV_validation(GLenum target,GLuint index,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetProgramParameterdvNV))(target,index,pname,params);this->m_checkErrors("glGetProgramParameterdvNV");}
+FunctionTable::MEMBERPFNGLRECTFPROC m_orig_glRectf = nullptr;
+void m_glRectf_validation(GLfloat x1,GLfloat y1,GLfloat x2,GLfloat y2)const{(this->*(this->m_orig_glRectf))(x1,y1,x2,y2);this->m_checkErrors("glRectf");}
+FunctionTable::MEMBERPFNGLRECTDPROC m_orig_glRectd = nullptr;
+void m_glRectd_validation(GLdouble x1,GLdouble y1,GLdouble x2,GLdouble y2)const{(this->*(this->m_orig_glRectd))(x1,y1,x2,y2);this->m_checkErrors("glRectd");}
+FunctionTable::MEMBERPFNGLMAP1XOESPROC m_orig_glMap1xOES = nullptr;
+void m_glMap1xOES_validation(GLenum target,GLfixed u1,GLfixed u2,GLint stride,GLint order,GLfixed points)const{(this->*(this->m_orig_glMap1xOES))(target,u1,u2,stride,order,points);this->m_checkErrors("glMap1xOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC m_orig_glVertexAttrib3fvNV = nullptr;
+void m_glVertexAttrib3fvNV_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib3fvNV))(index,v);this->m_checkErrors("glVertexAttrib3fvNV");}
+FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC m_orig_glReferencePlaneSGIX = nullptr;
+void m_glReferencePlaneSGIX_validation(const GLdouble* equation)const{(this->*(this->m_orig_glReferencePlaneSGIX))(equation);this->m_checkErrors("glReferencePlaneSGIX");}
+FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC m_orig_glMulticastBlitFramebufferNV = nullptr;
+void m_glMulticastBlitFramebufferNV_validation(GLuint srcGpu,GLuint dstGpu,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{(this->*(this->m_orig_glMulticastBlitFramebufferNV))(srcGpu,dstGpu,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->m_checkErrors("glMulticastBlitFramebufferNV");}
+FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC m_orig_glGetCombinerInputParameterfvNV = nullptr;
+void m_glGetCombinerInputParameterfvNV_validation(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetCombinerInputParameterfvNV))(stage,portion,variable,pname,params);this->m_checkErrors("glGetCombinerInputParameterfvNV");}
+FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC m_orig_glGetTextureSamplerHandleARB = nullptr;
+GLuint64 m_glGetTextureSamplerHandleARB_validation(GLuint texture,GLuint sampler)const{GLuint64 const result = (this->*(this->m_orig_glGetTextureSamplerHandleARB))(texture,sampler);this->m_checkErrors("glGetTextureSamplerHandleARB");return result;}
+FunctionTable::MEMBERPFNGLBINDTEXTUREPROC m_orig_glBindTexture = nullptr;
+void m_glBindTexture_validation(GLenum target,GLuint texture)const{(this->*(this->m_orig_glBindTexture))(target,texture);this->m_checkErrors("glBindTexture");}
+FunctionTable::MEMBERPFNGLRECTSPROC m_orig_glRects = nullptr;
+void m_glRects_validation(GLshort x1,GLshort y1,GLshort x2,GLshort y2)const{(this->*(this->m_orig_glRects))(x1,y1,x2,y2);this->m_checkErrors("glRects");}
+FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC m_orig_glGetActiveAttribARB = nullptr;
+void m_glGetActiveAttribARB_validation(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{(this->*(this->m_orig_glGetActiveAttribARB))(programObj,index,maxLength,length,size,type,name);this->m_checkErrors("glGetActiveAttribARB");}
+FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC m_orig_glHistogramEXT = nullptr;
+void m_glHistogramEXT_validation(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{(this->*(this->m_orig_glHistogramEXT))(target,width,internalformat,sink);this->m_checkErrors("glHistogramEXT");}
+FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC m_orig_glGetTextureSamplerHandleNV = nullptr;
+GLuint64 m_glGetTextureSamplerHandleNV_validation(GLuint texture,GLuint sampler)const{GLuint64 const result = (this->*(this->m_orig_glGetTextureSamplerHandleNV))(texture,sampler);this->m_checkErrors("glGetTextureSamplerHandleNV");return result;}
+FunctionTable::MEMBERPFNGLDETACHSHADERPROC m_orig_glDetachShader = nullptr;
+void m_glDetachShader_validation(GLuint program,GLuint shader)const{(this->*(this->m_orig_glDetachShader))(program,shader);this->m_checkErrors("glDetachShader");}
+FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC m_orig_glFinishTextureSUNX = nullptr;
+void m_glFinishTextureSUNX_validation()const{(this->*(this->m_orig_glFinishTextureSUNX))();this->m_checkErrors("glFinishTextureSUNX");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC m_orig_glUniformMatrix3x4dv = nullptr;
+void m_glUniformMatrix3x4dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix3x4dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3x4dv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC m_orig_glVertexAttrib4fARB = nullptr;
+void m_glVertexAttrib4fARB_validation(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glVertexAttrib4fARB))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4fARB");}
+FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC m_orig_glGetPathColorGenivNV = nullptr;
+void m_glGetPathColorGenivNV_validation(GLenum color,GLenum pname,GLint* value)const{(this->*(this->m_orig_glGetPathColorGenivNV))(color,pname,value);this->m_checkErrors("glGetPathColorGenivNV");}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC m_orig_glGetProgramResourceLocation = nullptr;
+GLint m_glGetProgramResourceLocation_validation(GLuint program,GLenum programInterface,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetProgramResourceLocation))(program,programInterface,name);this->m_checkErrors("glGetProgramResourceLocation");return result;}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC m_orig_glVertexArrayAttribLFormat = nullptr;
+void m_glVertexArrayAttribLFormat_validation(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexArrayAttribLFormat))(vaobj,attribindex,size,type,relativeoffset);this->m_checkErrors("glVertexArrayAttribLFormat");}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC m_orig_glGetTexLevelParameterfv = nullptr;
+void m_glGetTexLevelParameterfv_validation(GLenum target,GLint level,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTexLevelParameterfv))(target,level,pname,params);this->m_checkErrors("glGetTexLevelParameterfv");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC m_orig_glVertexArrayVertexAttribOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayVertexAttribOffsetEXT))(vaobj,buffer,index,size,type,normalized,stride,offset);this->m_checkErrors("glVertexArrayVertexAttribOffsetEXT");}
+FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC m_orig_glIndexFormatNV = nullptr;
+void m_glIndexFormatNV_validation(GLenum type,GLsizei stride)const{(this->*(this->m_orig_glIndexFormatNV))(type,stride);this->m_checkErrors("glIndexFormatNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC m_orig_glMultiTexCoord3i = nullptr;
+void m_glMultiTexCoord3i_validation(GLenum target,GLint s,GLint t,GLint r)const{(this->*(this->m_orig_glMultiTexCoord3i))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3i");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC m_orig_glReplacementCodeuiVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiVertex3fvSUN_validation(const GLuint* rc,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiVertex3fvSUN))(rc,v);this->m_checkErrors("glReplacementCodeuiVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC m_orig_glViewportIndexedfv = nullptr;
+void m_glViewportIndexedfv_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glViewportIndexedfv))(index,v);this->m_checkErrors("glViewportIndexedfv");}
+FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC m_orig_glBindBuffersBase = nullptr;
+void m_glBindBuffersBase_validation(GLenum target,GLuint first,GLsizei count,const GLuint* buffers)const{(this->*(this->m_orig_glBindBuffersBase))(target,first,count,buffers);this->m_checkErrors("glBindBuffersBase");}
+FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC m_orig_glTexBumpParameterfvATI = nullptr;
+void m_glTexBumpParameterfvATI_validation(GLenum pname,const GLfloat* param)const{(this->*(this->m_orig_glTexBumpParameterfvATI))(pname,param);this->m_checkErrors("glTexBumpParameterfvATI");}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC m_orig_glMatrixIndexuivARB = nullptr;
+void m_glMatrixIndexuivARB_validation(GLint size,const GLuint* indices)const{(this->*(this->m_orig_glMatrixIndexuivARB))(size,indices);this->m_checkErrors("glMatrixIndexuivARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC m_orig_glVertexAttrib1hNV = nullptr;
+void m_glVertexAttrib1hNV_validation(GLuint index,GLhalfNV x)const{(this->*(this->m_orig_glVertexAttrib1hNV))(index,x);this->m_checkErrors("glVertexAttrib1hNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC m_orig_glWindowPos3svMESA = nullptr;
+void m_glWindowPos3svMESA_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos3svMESA))(v);this->m_checkErrors("glWindowPos3svMESA");}
+FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC m_orig_glStencilOpSeparateATI = nullptr;
+void m_glStencilOpSeparateATI_validation(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{(this->*(this->m_orig_glStencilOpSeparateATI))(face,sfail,dpfail,dppass);this->m_checkErrors("glStencilOpSeparateATI");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC m_orig_glDrawElementsBaseVertex = nullptr;
+void m_glDrawElementsBaseVertex_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{(this->*(this->m_orig_glDrawElementsBaseVertex))(mode,count,type,indices,basevertex);this->m_checkErrors("glDrawElementsBaseVertex");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC m_orig_glBlendEquationSeparateiARB = nullptr;
+void m_glBlendEquationSeparateiARB_validation(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{(this->*(this->m_orig_glBlendEquationSeparateiARB))(buf,modeRGB,modeAlpha);this->m_checkErrors("glBlendEquationSeparateiARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC m_orig_glVertexAttrib1fNV = nullptr;
+void m_glVertexAttrib1fNV_validation(GLuint index,GLfloat x)const{(this->*(this->m_orig_glVertexAttrib1fNV))(index,x);this->m_checkErrors("glVertexAttrib1fNV");}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC m_orig_glMapVertexAttrib2fAPPLE = nullptr;
+void m_glMapVertexAttrib2fAPPLE_validation(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{(this->*(this->m_orig_glMapVertexAttrib2fAPPLE))(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->m_checkErrors("glMapVertexAttrib2fAPPLE");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC m_orig_glCompressedTextureSubImage1DEXT = nullptr;
+void m_glCompressedTextureSubImage1DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedTextureSubImage1DEXT))(texture,target,level,xoffset,width,format,imageSize,bits);this->m_checkErrors("glCompressedTextureSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC m_orig_glClearBufferSubData = nullptr;
+void m_glClearBufferSubData_validation(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearBufferSubData))(target,internalformat,offset,size,format,type,data);this->m_checkErrors("glClearBufferSubData");}
+FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC m_orig_glTexStorage1D = nullptr;
+void m_glTexStorage1D_validation(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{(this->*(this->m_orig_glTexStorage1D))(target,levels,internalformat,width);this->m_checkErrors("glTexStorage1D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC m_orig_glVertexAttribI3iEXT = nullptr;
+void m_glVertexAttribI3iEXT_validation(GLuint index,GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glVertexAttribI3iEXT))(index,x,y,z);this->m_checkErrors("glVertexAttribI3iEXT");}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC m_orig_glMakeTextureHandleNonResidentARB = nullptr;
+void m_glMakeTextureHandleNonResidentARB_validation(GLuint64 handle)const{(this->*(this->m_orig_glMakeTextureHandleNonResidentARB))(handle);this->m_checkErrors("glMakeTextureHandleNonResidentARB");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC m_orig_glMultiDrawElementArrayAPPLE = nullptr;
+void m_glMultiDrawElementArrayAPPLE_validation(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{(this->*(this->m_orig_glMultiDrawElementArrayAPPLE))(mode,first,count,primcount);this->m_checkErrors("glMultiDrawElementArrayAPPLE");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC m_orig_glVertexStream4dATI = nullptr;
+void m_glVertexStream4dATI_validation(GLenum stream,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertexStream4dATI))(stream,x,y,z,w);this->m_checkErrors("glVertexStream4dATI");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC m_orig_glProgramUniformMatrix2dvEXT = nullptr;
+void m_glProgramUniformMatrix2dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix2dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2dvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC m_orig_glVertexAttribs2hvNV = nullptr;
+void m_glVertexAttribs2hvNV_validation(GLuint index,GLsizei n,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttribs2hvNV))(index,n,v);this->m_checkErrors("glVertexAttribs2hvNV");}
+FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC m_orig_glGetUniformiv = nullptr;
+void m_glGetUniformiv_validation(GLuint program,GLint location,GLint* params)const{(this->*(this->m_orig_glGetUniformiv))(program,location,params);this->m_checkErrors("glGetUniformiv");}
+FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC m_orig_glClipPlanefOES = nullptr;
+void m_glClipPlanefOES_validation(GLenum plane,const GLfloat* equation)const{(this->*(this->m_orig_glClipPlanefOES))(plane,equation);this->m_checkErrors("glClipPlanefOES");}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC m_orig_glRenderbufferStorage = nullptr;
+void m_glRenderbufferStorage_validation(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glRenderbufferStorage))(target,internalformat,width,height);this->m_checkErrors("glRenderbufferStorage");}
+FunctionTable::MEMBERPFNGLUNIFORM4UIPROC m_orig_glUniform4ui = nullptr;
+void m_glUniform4ui_validation(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{(this->*(this->m_orig_glUniform4ui))(location,v0,v1,v2,v3);this->m_checkErrors("glUniform4ui");}
+FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC m_orig_glBindFramebuffer = nullptr;
+void m_glBindFramebuffer_validation(GLenum target,GLuint framebuffer)const{(this->*(this->m_orig_glBindFramebuffer))(target,framebuffer);this->m_checkErrors("glBindFramebuffer");}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC m_orig_glValidateProgramARB = nullptr;
+void m_glValidateProgramARB_validation(GLhandleARB programObj)const{(this->*(this->m_orig_glValidateProgramARB))(programObj);this->m_checkErrors("glValidateProgramARB");}
+FunctionTable::MEMBERPFNGLTEXGENFPROC m_orig_glTexGenf = nullptr;
+void m_glTexGenf_validation(GLenum coord,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glTexGenf))(coord,pname,param);this->m_checkErrors("glTexGenf");}
+FunctionTable::MEMBERPFNGLTEXGENDPROC m_orig_glTexGend = nullptr;
+void m_glTexGend_validation(GLenum coord,GLenum pname,GLdouble param)const{(this->*(this->m_orig_glTexGend))(coord,pname,param);this->m_checkErrors("glTexGend");}
+FunctionTable::MEMBERPFNGLTEXGENIPROC m_orig_glTexGeni = nullptr;
+void m_glTexGeni_validation(GLenum coord,GLenum pname,GLint param)const{(this->*(this->m_orig_glTexGeni))(coord,pname,param);this->m_checkErrors("glTexGeni");}
+FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC m_orig_glDeleteFramebuffersEXT = nullptr;
+void m_glDeleteFramebuffersEXT_validation(GLsizei n,const GLuint* framebuffers)const{(this->*(this->m_orig_glDeleteFramebuffersEXT))(n,framebuffers);this->m_checkErrors("glDeleteFramebuffersEXT");}
+FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC m_orig_glResetMinmaxEXT = nullptr;
+void m_glResetMinmaxEXT_validation(GLenum target)const{(this->*(this->m_orig_glResetMinmaxEXT))(target);this->m_checkErrors("glResetMinmaxEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC m_orig_glVertexAttrib1fvNV = nullptr;
+void m_glVertexAttrib1fvNV_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib1fvNV))(index,v);this->m_checkErrors("glVertexAttrib1fvNV");}
+FunctionTable::MEMBERPFNGLISQUERYARBPROC m_orig_glIsQueryARB = nullptr;
+GLboolean m_glIsQueryARB_validation(GLuint id)const{GLboolean const result = (this->*(this->m_orig_glIsQueryARB))(id);this->m_checkErrors("glIsQueryARB");return result;}
+FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC m_orig_glEnableVariantClientStateEXT = nullptr;
+void m_glEnableVariantClientStateEXT_validation(GLuint id)const{(this->*(this->m_orig_glEnableVariantClientStateEXT))(id);this->m_checkErrors("glEnableVariantClientStateEXT");}
+FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC m_orig_glScissorIndexed = nullptr;
+void m_glScissorIndexed_validation(GLuint index,GLint left,GLint bottom,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glScissorIndexed))(index,left,bottom,width,height);this->m_checkErrors("glScissorIndexed");}
+FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC m_orig_glGetInvariantIntegervEXT = nullptr;
+void m_glGetInvariantIntegervEXT_validation(GLuint id,GLenum value,GLint* data)const{(this->*(this->m_orig_glGetInvariantIntegervEXT))(id,value,data);this->m_checkErrors("glGetInvariantIntegervEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC m_orig_glProgramLocalParameterI4uiNV = nullptr;
+void m_glProgramLocalParameterI4uiNV_validation(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{(this->*(this->m_orig_glProgramLocalParameterI4uiNV))(target,index,x,y,z,w);this->m_checkErrors("glProgramLocalParameterI4uiNV");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC m_orig_glConvolutionParameterxvOES = nullptr;
+void m_glConvolutionParameterxvOES_validation(GLenum target,GLenum pname,const GLfixed* params)const{(this->*(this->m_orig_glConvolutionParameterxvOES))(target,pname,params);this->m_checkErrors("glConvolutionParameterxvOES");}
+FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC m_orig_glGenFramebuffersEXT = nullptr;
+void m_glGenFramebuffersEXT_validation(GLsizei n,GLuint* framebuffers)const{(this->*(this->m_orig_glGenFramebuffersEXT))(n,framebuffers);this->m_checkErrors("glGenFramebuffersEXT");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC m_orig_glVertexArrayColorOffsetEXT = nullptr;
+void m_glVertexArrayColorOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayColorOffsetEXT))(vaobj,buffer,size,type,stride,offset);this->m_checkErrors("glVertexArrayColorOffsetEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC m_orig_glMultiTexCoord3ivARB = nullptr;
+void m_glMultiTexCoord3ivARB_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord3ivARB))(target,v);this->m_checkErrors("glMultiTexCoord3ivARB");}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC m_orig_glVertexWeightfEXT = nullptr;
+void m_glVertexWeightfEXT_validation(GLfloat weight)const{(this->*(this->m_orig_glVertexWeightfEXT))(weight);this->m_checkErrors("glVertexWeightfEXT");}
+FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC m_orig_glRasterPos4dv = nullptr;
+void m_glRasterPos4dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glRasterPos4dv))(v);this->m_checkErrors("glRasterPos4dv");}
+FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC m_orig_glIsTextureHandleResidentARB = nullptr;
+GLboolean m_glIsTextureHandleResidentARB_validation(GLuint64 handle)const{GLboolean const result = (this->*(this->m_orig_glIsTextureHandleResidentARB))(handle);this->m_checkErrors("glIsTextureHandleResidentARB");return result;}
+FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC m_orig_glRasterPos2dv = nullptr;
+void m_glRasterPos2dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glRasterPos2dv))(v);this->m_checkErrors("glRasterPos2dv");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC m_orig_glWindowPos4ivMESA = nullptr;
+void m_glWindowPos4ivMESA_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos4ivMESA))(v);this->m_checkErrors("glWindowPos4ivMESA");}
+FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC m_orig_glGetVariantPointervEXT = nullptr;
+void m_glGetVariantPointervEXT_validation(GLuint id,GLenum value,void** data)const{(this->*(this->m_orig_glGetVariantPointervEXT))(id,value,data);this->m_checkErrors("glGetVariantPointervEXT");}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC m_orig_glMapNamedBufferRangeEXT = nullptr;
+void* m_glMapNamedBufferRangeEXT_validation(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{void* const result = (this->*(this->m_orig_glMapNamedBufferRangeEXT))(buffer,offset,length,access);this->m_checkErrors("glMapNamedBufferRangeEXT");return result;}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC m_orig_glGetnUniformui64vARB = nullptr;
+void m_glGetnUniformui64vARB_validation(GLuint program,GLint location,GLsizei bufSize,GLuint64* params)const{(this->*(this->m_orig_glGetnUniformui64vARB))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformui64vARB");}
+FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC m_orig_glCreateShaderProgramv = nullptr;
+GLuint m_glCreateShaderProgramv_validation(GLenum type,GLsizei count,const GLchar*const* strings)const{GLuint const result = (this->*(this->m_orig_glCreateShaderProgramv))(type,count,strings);this->m_checkErrors("glCreateShaderProgramv");return result;}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC m_orig_glGetQueryObjectiv = nullptr;
+void m_glGetQueryObjectiv_validation(GLuint id,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetQueryObjectiv))(id,pname,params);this->m_checkErrors("glGetQueryObjectiv");}
+FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC m_orig_glMaxShaderCompilerThreadsKHR = nullptr;
+void m_glMaxShaderCompilerThreadsKHR_validation(GLuint count)const{(this->*(this->m_orig_glMaxShaderCompilerThreadsKHR))(count);this->m_checkErrors("glMaxShaderCompilerThreadsKHR");}
+FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC m_orig_glPNTrianglesfATI = nullptr;
+void m_glPNTrianglesfATI_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPNTrianglesfATI))(pname,param);this->m_checkErrors("glPNTrianglesfATI");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC m_orig_glGlobalAlphaFactorusSUN = nullptr;
+void m_glGlobalAlphaFactorusSUN_validation(GLushort factor)const{(this->*(this->m_orig_glGlobalAlphaFactorusSUN))(factor);this->m_checkErrors("glGlobalAlphaFactorusSUN");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC m_orig_glVertexAttrib3dvNV = nullptr;
+void m_glVertexAttrib3dvNV_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib3dvNV))(index,v);this->m_checkErrors("glVertexAttrib3dvNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC m_orig_glMultiTexCoord3sARB = nullptr;
+void m_glMultiTexCoord3sARB_validation(GLenum target,GLshort s,GLshort t,GLshort r)const{(this->*(this->m_orig_glMultiTexCoord3sARB))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3sARB");}
+FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC m_orig_glGenerateMipmap = nullptr;
+void m_glGenerateMipmap_validation(GLenum target)const{(this->*(this->m_orig_glGenerateMipmap))(target);this->m_checkErrors("glGenerateMipmap");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC m_orig_glCompressedTextureSubImage2D = nullptr;
+void m_glCompressedTextureSubImage2D_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTextureSubImage2D))(texture,level,xoffset,yoffset,width,height,format,imageSize,data);this->m_checkErrors("glCompressedTextureSubImage2D");}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC m_orig_glNamedRenderbufferStorageMultisampleEXT = nullptr;
+void m_glNamedRenderbufferStorageMultisampleEXT_validation(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glNamedRenderbufferStorageMultisampleEXT))(renderbuffer,samples,internalformat,width,height);this->m_checkErrors("glNamedRenderbufferStorageMultisampleEXT");}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC m_orig_glPolygonOffsetClampEXT = nullptr;
+void m_glPolygonOffsetClampEXT_validation(GLfloat factor,GLfloat units,GLfloat clamp)const{(this->*(this->m_orig_glPolygonOffsetClampEXT))(factor,units,clamp);this->m_checkErrors("glPolygonOffsetClampEXT");}
+FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC m_orig_glTextureRangeAPPLE = nullptr;
+void m_glTextureRangeAPPLE_validation(GLenum target,GLsizei length,const void* pointer)const{(this->*(this->m_orig_glTextureRangeAPPLE))(target,length,pointer);this->m_checkErrors("glTextureRangeAPPLE");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC m_orig_glBlendEquationIndexedAMD = nullptr;
+void m_glBlendEquationIndexedAMD_validation(GLuint buf,GLenum mode)const{(this->*(this->m_orig_glBlendEquationIndexedAMD))(buf,mode);this->m_checkErrors("glBlendEquationIndexedAMD");}
+FunctionTable::MEMBERPFNGLTEXCOORD2DPROC m_orig_glTexCoord2d = nullptr;
+void m_glTexCoord2d_validation(GLdouble s,GLdouble t)const{(this->*(this->m_orig_glTexCoord2d))(s,t);this->m_checkErrors("glTexCoord2d");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC m_orig_glPointParameteri = nullptr;
+void m_glPointParameteri_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glPointParameteri))(pname,param);this->m_checkErrors("glPointParameteri");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FPROC m_orig_glTexCoord2f = nullptr;
+void m_glTexCoord2f_validation(GLfloat s,GLfloat t)const{(this->*(this->m_orig_glTexCoord2f))(s,t);this->m_checkErrors("glTexCoord2f");}
+FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC m_orig_glGetUnsignedBytei_vEXT = nullptr;
+void m_glGetUnsignedBytei_vEXT_validation(GLenum target,GLuint index,GLubyte* data)const{(this->*(this->m_orig_glGetUnsignedBytei_vEXT))(target,index,data);this->m_checkErrors("glGetUnsignedBytei_vEXT");}
+FunctionTable::MEMBERPFNGLCOLOR4IVPROC m_orig_glColor4iv = nullptr;
+void m_glColor4iv_validation(const GLint* v)const{(this->*(this->m_orig_glColor4iv))(v);this->m_checkErrors("glColor4iv");}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC m_orig_glMapNamedBufferRange = nullptr;
+void* m_glMapNamedBufferRange_validation(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{void* const result = (this->*(this->m_orig_glMapNamedBufferRange))(buffer,offset,length,access);this->m_checkErrors("glMapNamedBufferRange");return result;}
+FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC m_orig_glUnmapBuffer = nullptr;
+GLboolean m_glUnmapBuffer_validation(GLenum target)const{GLboolean const result = (this->*(this->m_orig_glUnmapBuffer))(target);this->m_checkErrors("glUnmapBuffer");return result;}
+FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC m_orig_glSampleMaskEXT = nullptr;
+void m_glSampleMaskEXT_validation(GLclampf value,GLboolean invert)const{(this->*(this->m_orig_glSampleMaskEXT))(value,invert);this->m_checkErrors("glSampleMaskEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD2IPROC m_orig_glTexCoord2i = nullptr;
+void m_glTexCoord2i_validation(GLint s,GLint t)const{(this->*(this->m_orig_glTexCoord2i))(s,t);this->m_checkErrors("glTexCoord2i");}
+FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC m_orig_glTexCoord1xvOES = nullptr;
+void m_glTexCoord1xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glTexCoord1xvOES))(coords);this->m_checkErrors("glTexCoord1xvOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC m_orig_glVertexAttrib1sARB = nullptr;
+void m_glVertexAttrib1sARB_validation(GLuint index,GLshort x)const{(this->*(this->m_orig_glVertexAttrib1sARB))(index,x);this->m_checkErrors("glVertexAttrib1sARB");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC m_orig_glGetVertexArrayiv = nullptr;
+void m_glGetVertexArrayiv_validation(GLuint vaobj,GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetVertexArrayiv))(vaobj,pname,param);this->m_checkErrors("glGetVertexArrayiv");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC m_orig_glProgramParameter4dvNV = nullptr;
+void m_glProgramParameter4dvNV_validation(GLenum target,GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glProgramParameter4dvNV))(target,index,v);this->m_checkErrors("glProgramParameter4dvNV");}
+FunctionTable::MEMBERPFNGLTEXCOORD2SPROC m_orig_glTexCoord2s = nullptr;
+void m_glTexCoord2s_validation(GLshort s,GLshort t)const{(this->*(this->m_orig_glTexCoord2s))(s,t);this->m_checkErrors("glTexCoord2s");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC m_orig_glTextureParameterIuivEXT = nullptr;
+void m_glTextureParameterIuivEXT_validation(GLuint texture,GLenum target,GLenum pname,const GLuint* params)const{(this->*(this->m_orig_glTextureParameterIuivEXT))(texture,target,pname,params);this->m_checkErrors("glTextureParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC m_orig_glGetColorTableParameterfvSGI = nullptr;
+void m_glGetColorTableParameterfvSGI_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetColorTableParameterfvSGI))(target,pname,params);this->m_checkErrors("glGetColorTableParameterfvSGI");}
+FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC m_orig_glTexCoord4dv = nullptr;
+void m_glTexCoord4dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glTexCoord4dv))(v);this->m_checkErrors("glTexCoord4dv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC m_orig_glVertexAttrib1svNV = nullptr;
+void m_glVertexAttrib1svNV_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib1svNV))(index,v);this->m_checkErrors("glVertexAttrib1svNV");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC m_orig_glNamedFramebufferTextureFaceEXT = nullptr;
+void m_glNamedFramebufferTextureFaceEXT_validation(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLenum face)const{(this->*(this->m_orig_glNamedFramebufferTextureFaceEXT))(framebuffer,attachment,texture,level,face);this->m_checkErrors("glNamedFramebufferTextureFaceEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC m_orig_glProgramUniform2ui64vNV = nullptr;
+void m_glProgramUniform2ui64vNV_validation(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glProgramUniform2ui64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform2ui64vNV");}
+FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC m_orig_glStencilFillPathNV = nullptr;
+void m_glStencilFillPathNV_validation(GLuint path,GLenum fillMode,GLuint mask)const{(this->*(this->m_orig_glStencilFillPathNV))(path,fillMode,mask);this->m_checkErrors("glStencilFillPathNV");}
+FunctionTable::MEMBERPFNGLNORMAL3DVPROC m_orig_glNormal3dv = nullptr;
+void m_glNormal3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glNormal3dv))(v);this->m_checkErrors("glNormal3dv");}
+FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC m_orig_glReleaseShaderCompiler = nullptr;
+void m_glReleaseShaderCompiler_validation()const{(this->*(this->m_orig_glReleaseShaderCompiler))();this->m_checkErrors("glReleaseShaderCompiler");}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC m_orig_glTexStorageMem3DEXT = nullptr;
+void m_glTexStorageMem3DEXT_validation(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTexStorageMem3DEXT))(target,levels,internalFormat,width,height,depth,memory,offset);this->m_checkErrors("glTexStorageMem3DEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC m_orig_glTexCoord3bvOES = nullptr;
+void m_glTexCoord3bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glTexCoord3bvOES))(coords);this->m_checkErrors("glTexCoord3bvOES");}
+FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC m_orig_glIsVertexAttribEnabledAPPLE = nullptr;
+GLboolean m_glIsVertexAttribEnabledAPPLE_validation(GLuint index,GLenum pname)const{GLboolean const result = (this->*(this->m_orig_glIsVertexAttribEnabledAPPLE))(index,pname);this->m_checkErrors("glIsVertexAttribEnabledAPPLE");return result;}
+FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC m_orig_glTexCoord1dv = nullptr;
+void m_glTexCoord1dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glTexCoord1dv))(v);this->m_checkErrors("glTexCoord1dv");}
+FunctionTable::MEMBERPFNGLREADPIXELSPROC m_orig_glReadPixels = nullptr;
+void m_glReadPixels_validation(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLvoid* pixels)const{(this->*(this->m_orig_glReadPixels))(x,y,width,height,format,type,pixels);this->m_checkErrors("glReadPixels");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC m_orig_glVertexAttribI3iv = nullptr;
+void m_glVertexAttribI3iv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI3iv))(index,v);this->m_checkErrors("glVertexAttribI3iv");}
+FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC m_orig_glSetFenceAPPLE = nullptr;
+void m_glSetFenceAPPLE_validation(GLuint fence)const{(this->*(this->m_orig_glSetFenceAPPLE))(fence);this->m_checkErrors("glSetFenceAPPLE");}
+FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC m_orig_glWeightsvARB = nullptr;
+void m_glWeightsvARB_validation(GLint size,const GLshort* weights)const{(this->*(this->m_orig_glWeightsvARB))(size,weights);this->m_checkErrors("glWeightsvARB");}
+FunctionTable::MEMBERPFNGLSHADEMODELPROC m_orig_glShadeModel = nullptr;
+void m_glShadeModel_validation(GLenum mode)const{(this->*(this->m_orig_glShadeModel))(mode);this->m_checkErrors("glShadeModel");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC m_orig_glTextureStorageMem3DMultisampleEXT = nullptr;
+void m_glTextureStorageMem3DMultisampleEXT_validation(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTextureStorageMem3DMultisampleEXT))(texture,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);this->m_checkErrors("glTextureStorageMem3DMultisampleEXT");}
+FunctionTable::MEMBERPFNGLMAPGRID1DPROC m_orig_glMapGrid1d = nullptr;
+void m_glMapGrid1d_validation(GLint un,GLdouble u1,GLdouble u2)const{(this->*(this->m_orig_glMapGrid1d))(un,u1,u2);this->m_checkErrors("glMapGrid1d");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC m_orig_glGetHistogramParameterivEXT = nullptr;
+void m_glGetHistogramParameterivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetHistogramParameterivEXT))(target,pname,params);this->m_checkErrors("glGetHistogramParameterivEXT");}
+FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC m_orig_glConservativeRasterParameteriNV = nullptr;
+void m_glConservativeRasterParameteriNV_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glConservativeRasterParameteriNV))(pname,param);this->m_checkErrors("glConservativeRasterParameteriNV");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC m_orig_glClearNamedBufferData = nullptr;
+void m_glClearNamedBufferData_validation(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearNamedBufferData))(buffer,internalformat,format,type,data);this->m_checkErrors("glClearNamedBufferData");}
+FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC m_orig_glClearDepthf = nullptr;
+void m_glClearDepthf_validation(GLfloat d)const{(this->*(this->m_orig_glClearDepthf))(d);this->m_checkErrors("glClearDepthf");}
+FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC m_orig_glCreatePerfQueryINTEL = nullptr;
+void m_glCreatePerfQueryINTEL_validation(GLuint queryId,GLuint* queryHandle)const{(this->*(this->m_orig_glCreatePerfQueryINTEL))(queryId,queryHandle);this->m_checkErrors("glCreatePerfQueryINTEL");}
+FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC m_orig_glFogCoordfEXT = nullptr;
+void m_glFogCoordfEXT_validation(GLfloat coord)const{(this->*(this->m_orig_glFogCoordfEXT))(coord);this->m_checkErrors("glFogCoordfEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC m_orig_glVertexAttrib2dARB = nullptr;
+void m_glVertexAttrib2dARB_validation(GLuint index,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertexAttrib2dARB))(index,x,y);this->m_checkErrors("glVertexAttrib2dARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC m_orig_glMultiTexCoord4dARB = nullptr;
+void m_glMultiTexCoord4dARB_validation(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{(this->*(this->m_orig_glMultiTexCoord4dARB))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4dARB");}
+FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC m_orig_glReadnPixelsARB = nullptr;
+void m_glReadnPixelsARB_validation(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{(this->*(this->m_orig_glReadnPixelsARB))(x,y,width,height,format,type,bufSize,data);this->m_checkErrors("glReadnPixelsARB");}
+FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC m_orig_glMultiTexBufferEXT = nullptr;
+void m_glMultiTexBufferEXT_validation(GLenum texunit,GLenum target,GLenum internalformat,GLuint buffer)const{(this->*(this->m_orig_glMultiTexBufferEXT))(texunit,target,internalformat,buffer);this->m_checkErrors("glMultiTexBufferEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC m_orig_glWindowPos4dvMESA = nullptr;
+void m_glWindowPos4dvMESA_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos4dvMESA))(v);this->m_checkErrors("glWindowPos4dvMESA");}
+FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC m_orig_glInvalidateNamedFramebufferData = nullptr;
+void m_glInvalidateNamedFramebufferData_validation(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments)const{(this->*(this->m_orig_glInvalidateNamedFramebufferData))(framebuffer,numAttachments,attachments);this->m_checkErrors("glInvalidateNamedFramebufferData");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC m_orig_glSecondaryColorPointerListIBM = nullptr;
+void m_glSecondaryColorPointerListIBM_validation(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glSecondaryColorPointerListIBM))(size,type,stride,pointer,ptrstride);this->m_checkErrors("glSecondaryColorPointerListIBM");}
+FunctionTable::MEMBERPFNGLRECTIVPROC m_orig_glRectiv = nullptr;
+void m_glRectiv_validation(const GLint* v1,const GLint* v2)const{(this->*(this->m_orig_glRectiv))(v1,v2);this->m_checkErrors("glRectiv");}
+FunctionTable::MEMBERPFNGLCOLORP4UIPROC m_orig_glColorP4ui = nullptr;
+void m_glColorP4ui_validation(GLenum type,GLuint color)const{(this->*(this->m_orig_glColorP4ui))(type,color);this->m_checkErrors("glColorP4ui");}
+FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC m_orig_glUseProgramStages = nullptr;
+void m_glUseProgramStages_validation(GLuint pipeline,GLbitfield stages,GLuint program)const{(this->*(this->m_orig_glUseProgramStages))(pipeline,stages,program);this->m_checkErrors("glUseProgramStages");}
+FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC m_orig_glRasterPos3dv = nullptr;
+void m_glRasterPos3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glRasterPos3dv))(v);this->m_checkErrors("glRasterPos3dv");}
+FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC m_orig_glPathTexGenNV = nullptr;
+void m_glPathTexGenNV_validation(GLenum texCoordSet,GLenum genMode,GLint components,const GLfloat* coeffs)const{(this->*(this->m_orig_glPathTexGenNV))(texCoordSet,genMode,components,coeffs);this->m_checkErrors("glPathTexGenNV");}
+FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC m_orig_glVertexBlendEnviATI = nullptr;
+void m_glVertexBlendEnviATI_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glVertexBlendEnviATI))(pname,param);this->m_checkErrors("glVertexBlendEnviATI");}
+FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC m_orig_glUniform3i64ARB = nullptr;
+void m_glUniform3i64ARB_validation(GLint location,GLint64 x,GLint64 y,GLint64 z)const{(this->*(this->m_orig_glUniform3i64ARB))(location,x,y,z);this->m_checkErrors("glUniform3i64ARB");}
+FunctionTable::MEMBERPFNGLLOADMATRIXFPROC m_orig_glLoadMatrixf = nullptr;
+void m_glLoadMatrixf_validation(const GLfloat* m)const{(this->*(this->m_orig_glLoadMatrixf))(m);this->m_checkErrors("glLoadMatrixf");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC m_orig_glProgramUniform2dEXT = nullptr;
+void m_glProgramUniform2dEXT_validation(GLuint program,GLint location,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glProgramUniform2dEXT))(program,location,x,y);this->m_checkErrors("glProgramUniform2dEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC m_orig_glVertexAttribI4iv = nullptr;
+void m_glVertexAttribI4iv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI4iv))(index,v);this->m_checkErrors("glVertexAttribI4iv");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC m_orig_glNamedFramebufferDrawBuffer = nullptr;
+void m_glNamedFramebufferDrawBuffer_validation(GLuint framebuffer,GLenum buf)const{(this->*(this->m_orig_glNamedFramebufferDrawBuffer))(framebuffer,buf);this->m_checkErrors("glNamedFramebufferDrawBuffer");}
+FunctionTable::MEMBERPFNGLCOLOR4UBVPROC m_orig_glColor4ubv = nullptr;
+void m_glColor4ubv_validation(const GLubyte* v)const{(this->*(this->m_orig_glColor4ubv))(v);this->m_checkErrors("glColor4ubv");}
+FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC m_orig_glColor3hvNV = nullptr;
+void m_glColor3hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glColor3hvNV))(v);this->m_checkErrors("glColor3hvNV");}
+FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC m_orig_glGetMapAttribParameterfvNV = nullptr;
+void m_glGetMapAttribParameterfvNV_validation(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMapAttribParameterfvNV))(target,index,pname,params);this->m_checkErrors("glGetMapAttribParameterfvNV");}
+FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC m_orig_glGetBufferSubData = nullptr;
+void m_glGetBufferSubData_validation(GLenum target,GLintptr offset,GLsizeiptr size,void* data)const{(this->*(this->m_orig_glGetBufferSubData))(target,offset,size,data);this->m_checkErrors("glGetBufferSubData");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC m_orig_glGetVertexAttribLdv = nullptr;
+void m_glGetVertexAttribLdv_validation(GLuint index,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetVertexAttribLdv))(index,pname,params);this->m_checkErrors("glGetVertexAttribLdv");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC m_orig_glGetnUniformuiv = nullptr;
+void m_glGetnUniformuiv_validation(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{(this->*(this->m_orig_glGetnUniformuiv))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformuiv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC m_orig_glGetUniformui64vNV = nullptr;
+void m_glGetUniformui64vNV_validation(GLuint program,GLint location,GLuint64EXT* params)const{(this->*(this->m_orig_glGetUniformui64vNV))(program,location,params);this->m_checkErrors("glGetUniformui64vNV");}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC m_orig_glNamedRenderbufferStorageEXT = nullptr;
+void m_glNamedRenderbufferStorageEXT_validation(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glNamedRenderbufferStorageEXT))(renderbuffer,internalformat,width,height);this->m_checkErrors("glNamedRenderbufferStorageEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC m_orig_glVertexAttrib3dNV = nullptr;
+void m_glVertexAttrib3dNV_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertexAttrib3dNV))(index,x,y,z);this->m_checkErrors("glVertexAttrib3dNV");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC m_orig_glTextureStorage1DEXT = nullptr;
+void m_glTextureStorage1DEXT_validation(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{(this->*(this->m_orig_glTextureStorage1DEXT))(texture,target,levels,internalformat,width);this->m_checkErrors("glTextureStorage1DEXT");}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC m_orig_glPixelTexGenParameteriSGIS = nullptr;
+void m_glPixelTexGenParameteriSGIS_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glPixelTexGenParameteriSGIS))(pname,param);this->m_checkErrors("glPixelTexGenParameteriSGIS");}
+FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC m_orig_glColorTableEXT = nullptr;
+void m_glColorTableEXT_validation(GLenum target,GLenum internalFormat,GLsizei width,GLenum format,GLenum type,const void* table)const{(this->*(this->m_orig_glColorTableEXT))(target,internalFormat,width,format,type,table);this->m_checkErrors("glColorTableEXT");}
+FunctionTable::MEMBERPFNGLGENBUFFERSPROC m_orig_glGenBuffers = nullptr;
+void m_glGenBuffers_validation(GLsizei n,GLuint* buffers)const{(this->*(this->m_orig_glGenBuffers))(n,buffers);this->m_checkErrors("glGenBuffers");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC m_orig_glMultiTexCoord3xvOES = nullptr;
+void m_glMultiTexCoord3xvOES_validation(GLenum texture,const GLfixed* coords)const{(this->*(this->m_orig_glMultiTexCoord3xvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord3xvOES");}
+FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC m_orig_glExecuteProgramNV = nullptr;
+void m_glExecuteProgramNV_validation(GLenum target,GLuint id,const GLfloat* params)const{(this->*(this->m_orig_glExecuteProgramNV))(target,id,params);this->m_checkErrors("glExecuteProgramNV");}
+FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC m_orig_glVariantArrayObjectATI = nullptr;
+void m_glVariantArrayObjectATI_validation(GLuint id,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{(this->*(this->m_orig_glVariantArrayObjectATI))(id,type,stride,buffer,offset);this->m_checkErrors("glVariantArrayObjectATI");}
+FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC m_orig_glColor3xvOES = nullptr;
+void m_glColor3xvOES_validation(const GLfixed* components)const{(this->*(this->m_orig_glColor3xvOES))(components);this->m_checkErrors("glColor3xvOES");}
+FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC m_orig_glGetnConvolutionFilterARB = nullptr;
+void m_glGetnConvolutionFilterARB_validation(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{(this->*(this->m_orig_glGetnConvolutionFilterARB))(target,format,type,bufSize,image);this->m_checkErrors("glGetnConvolutionFilterARB");}
+FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC m_orig_glNormalFormatNV = nullptr;
+void m_glNormalFormatNV_validation(GLenum type,GLsizei stride)const{(this->*(this->m_orig_glNormalFormatNV))(type,stride);this->m_checkErrors("glNormalFormatNV");}
+FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC m_orig_glGetInvariantFloatvEXT = nullptr;
+void m_glGetInvariantFloatvEXT_validation(GLuint id,GLenum value,GLfloat* data)const{(this->*(this->m_orig_glGetInvariantFloatvEXT))(id,value,data);this->m_checkErrors("glGetInvariantFloatvEXT");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC m_orig_glClearNamedFramebufferiv = nullptr;
+void m_glClearNamedFramebufferiv_validation(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLint* value)const{(this->*(this->m_orig_glClearNamedFramebufferiv))(framebuffer,buffer,drawbuffer,value);this->m_checkErrors("glClearNamedFramebufferiv");}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC m_orig_glTexImage3D = nullptr;
+void m_glTexImage3D_validation(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glTexImage3D))(target,level,internalFormat,width,height,depth,border,format,type,pixels);this->m_checkErrors("glTexImage3D");}
+FunctionTable::MEMBERPFNGLGENSAMPLERSPROC m_orig_glGenSamplers = nullptr;
+void m_glGenSamplers_validation(GLsizei count,GLuint* samplers)const{(this->*(this->m_orig_glGenSamplers))(count,samplers);this->m_checkErrors("glGenSamplers");}
+FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC m_orig_glIsFramebuffer = nullptr;
+GLboolean m_glIsFramebuffer_validation(GLuint framebuffer)const{GLboolean const result = (this->*(this->m_orig_glIsFramebuffer))(framebuffer);this->m_checkErrors("glIsFramebuffer");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC m_orig_glProgramUniform3dvEXT = nullptr;
+void m_glProgramUniform3dvEXT_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform3dvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform3dvEXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC m_orig_glGetVertexAttribfvNV = nullptr;
+void m_glGetVertexAttribfvNV_validation(GLuint index,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetVertexAttribfvNV))(index,pname,params);this->m_checkErrors("glGetVertexAttribfvNV");}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC m_orig_glDrawRangeElementArrayAPPLE = nullptr;
+void m_glDrawRangeElementArrayAPPLE_validation(GLenum mode,GLuint start,GLuint end,GLint first,GLsizei count)const{(this->*(this->m_orig_glDrawRangeElementArrayAPPLE))(mode,start,end,first,count);this->m_checkErrors("glDrawRangeElementArrayAPPLE");}
+FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC m_orig_glUniform3i64NV = nullptr;
+void m_glUniform3i64NV_validation(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{(this->*(this->m_orig_glUniform3i64NV))(location,x,y,z);this->m_checkErrors("glUniform3i64NV");}
+FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC m_orig_glMatrixPopEXT = nullptr;
+void m_glMatrixPopEXT_validation(GLenum mode)const{(this->*(this->m_orig_glMatrixPopEXT))(mode);this->m_checkErrors("glMatrixPopEXT");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC m_orig_glVertexStream1sATI = nullptr;
+void m_glVertexStream1sATI_validation(GLenum stream,GLshort x)const{(this->*(this->m_orig_glVertexStream1sATI))(stream,x);this->m_checkErrors("glVertexStream1sATI");}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC m_orig_glGetnPixelMapuivARB = nullptr;
+void m_glGetnPixelMapuivARB_validation(GLenum map,GLsizei bufSize,GLuint* values)const{(this->*(this->m_orig_glGetnPixelMapuivARB))(map,bufSize,values);this->m_checkErrors("glGetnPixelMapuivARB");}
+FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC m_orig_glMultiTexEnviEXT = nullptr;
+void m_glMultiTexEnviEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glMultiTexEnviEXT))(texunit,target,pname,param);this->m_checkErrors("glMultiTexEnviEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC m_orig_glVertexAttribI2iEXT = nullptr;
+void m_glVertexAttribI2iEXT_validation(GLuint index,GLint x,GLint y)const{(this->*(this->m_orig_glVertexAttribI2iEXT))(index,x,y);this->m_checkErrors("glVertexAttribI2iEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC m_orig_glProgramParameter4fvNV = nullptr;
+void m_glProgramParameter4fvNV_validation(GLenum target,GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glProgramParameter4fvNV))(target,index,v);this->m_checkErrors("glProgramParameter4fvNV");}
+FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC m_orig_glWaitSemaphoreEXT = nullptr;
+void m_glWaitSemaphoreEXT_validation(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* srcLayouts)const{(this->*(this->m_orig_glWaitSemaphoreEXT))(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,srcLayouts);this->m_checkErrors("glWaitSemaphoreEXT");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_orig_glNamedFramebufferSampleLocationsfvNV = nullptr;
+void m_glNamedFramebufferSampleLocationsfvNV_validation(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glNamedFramebufferSampleLocationsfvNV))(framebuffer,start,count,v);this->m_checkErrors("glNamedFramebufferSampleLocationsfvNV");}
+FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC m_orig_glTexCoordP4uiv = nullptr;
+void m_glTexCoordP4uiv_validation(GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glTexCoordP4uiv))(type,coords);this->m_checkErrors("glTexCoordP4uiv");}
+FunctionTable::MEMBERPFNGLRECTXVOESPROC m_orig_glRectxvOES = nullptr;
+void m_glRectxvOES_validation(const GLfixed* v1,const GLfixed* v2)const{(this->*(this->m_orig_glRectxvOES))(v1,v2);this->m_checkErrors("glRectxvOES");}
+FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC m_orig_glGetVariantIntegervEXT = nullptr;
+void m_glGetVariantIntegervEXT_validation(GLuint id,GLenum value,GLint* data)const{(this->*(this->m_orig_glGetVariantIntegervEXT))(id,value,data);this->m_checkErrors("glGetVariantIntegervEXT");}
+FunctionTable::MEMBERPFNGLDELETELISTSPROC m_orig_glDeleteLists = nullptr;
+void m_glDeleteLists_validation(GLuint list,GLsizei range)const{(this->*(this->m_orig_glDeleteLists))(list,range);this->m_checkErrors("glDeleteLists");}
+FunctionTable::MEMBERPFNGLTEXGENDVPROC m_orig_glTexGendv = nullptr;
+void m_glTexGendv_validation(GLenum coord,GLenum pname,const GLdouble* params)const{(this->*(this->m_orig_glTexGendv))(coord,pname,params);this->m_checkErrors("glTexGendv");}
+FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC m_orig_glVertexP2uiv = nullptr;
+void m_glVertexP2uiv_validation(GLenum type,const GLuint* value)const{(this->*(this->m_orig_glVertexP2uiv))(type,value);this->m_checkErrors("glVertexP2uiv");}
+FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC m_orig_glGetPerfMonitorGroupsAMD = nullptr;
+void m_glGetPerfMonitorGroupsAMD_validation(GLint* numGroups,GLsizei groupsSize,GLuint* groups)const{(this->*(this->m_orig_glGetPerfMonitorGroupsAMD))(numGroups,groupsSize,groups);this->m_checkErrors("glGetPerfMonitorGroupsAMD");}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC m_orig_glMultTransposeMatrixfARB = nullptr;
+void m_glMultTransposeMatrixfARB_validation(const GLfloat* m)const{(this->*(this->m_orig_glMultTransposeMatrixfARB))(m);this->m_checkErrors("glMultTransposeMatrixfARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC m_orig_glVertexAttribI2ivEXT = nullptr;
+void m_glVertexAttribI2ivEXT_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI2ivEXT))(index,v);this->m_checkErrors("glVertexAttribI2ivEXT");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_validation(const GLuint* rc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN))(rc,c,n,v);this->m_checkErrors("glReplacementCodeuiColor4fNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLDELETESTATESNVPROC m_orig_glDeleteStatesNV = nullptr;
+void m_glDeleteStatesNV_validation(GLsizei n,const GLuint* states)const{(this->*(this->m_orig_glDeleteStatesNV))(n,states);this->m_checkErrors("glDeleteStatesNV");}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC m_orig_glGetBufferParameteri64v = nullptr;
+void m_glGetBufferParameteri64v_validation(GLenum target,GLenum pname,GLint64* params)const{(this->*(this->m_orig_glGetBufferParameteri64v))(target,pname,params);this->m_checkErrors("glGetBufferParameteri64v");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC m_orig_glProgramUniform4dv = nullptr;
+void m_glProgramUniform4dv_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform4dv))(program,location,count,value);this->m_checkErrors("glProgramUniform4dv");}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC m_orig_glEdgeFlagPointerEXT = nullptr;
+void m_glEdgeFlagPointerEXT_validation(GLsizei stride,GLsizei count,const GLboolean* pointer)const{(this->*(this->m_orig_glEdgeFlagPointerEXT))(stride,count,pointer);this->m_checkErrors("glEdgeFlagPointerEXT");}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC m_orig_glVideoCaptureStreamParameterivNV = nullptr;
+void m_glVideoCaptureStreamParameterivNV_validation(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glVideoCaptureStreamParameterivNV))(video_capture_slot,stream,pname,params);this->m_checkErrors("glVideoCaptureStreamParameterivNV");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC m_orig_glVertexStream4iATI = nullptr;
+void m_glVertexStream4iATI_validation(GLenum stream,GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glVertexStream4iATI))(stream,x,y,z,w);this->m_checkErrors("glVertexStream4iATI");}
+FunctionTable::MEMBERPFNGLVDPAUFININVPROC m_orig_glVDPAUFiniNV = nullptr;
+void m_glVDPAUFiniNV_validation()const{(this->*(this->m_orig_glVDPAUFiniNV))();this->m_checkErrors("glVDPAUFiniNV");}
+FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC m_orig_glMakeBufferNonResidentNV = nullptr;
+void m_glMakeBufferNonResidentNV_validation(GLenum target)const{(this->*(this->m_orig_glMakeBufferNonResidentNV))(target);this->m_checkErrors("glMakeBufferNonResidentNV");}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC m_orig_glUniform1ui64ARB = nullptr;
+void m_glUniform1ui64ARB_validation(GLint location,GLuint64 x)const{(this->*(this->m_orig_glUniform1ui64ARB))(location,x);this->m_checkErrors("glUniform1ui64ARB");}
+FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC m_orig_glStencilStrokePathNV = nullptr;
+void m_glStencilStrokePathNV_validation(GLuint path,GLint reference,GLuint mask)const{(this->*(this->m_orig_glStencilStrokePathNV))(path,reference,mask);this->m_checkErrors("glStencilStrokePathNV");}
+FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC m_orig_glVariantuivEXT = nullptr;
+void m_glVariantuivEXT_validation(GLuint id,const GLuint* addr)const{(this->*(this->m_orig_glVariantuivEXT))(id,addr);this->m_checkErrors("glVariantuivEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC m_orig_glCopyTexSubImage3DEXT = nullptr;
+void m_glCopyTexSubImage3DEXT_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTexSubImage3DEXT))(target,level,xoffset,yoffset,zoffset,x,y,width,height);this->m_checkErrors("glCopyTexSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC m_orig_glSpriteParameteriSGIX = nullptr;
+void m_glSpriteParameteriSGIX_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glSpriteParameteriSGIX))(pname,param);this->m_checkErrors("glSpriteParameteriSGIX");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC m_orig_glMultiTexCoord1sARB = nullptr;
+void m_glMultiTexCoord1sARB_validation(GLenum target,GLshort s)const{(this->*(this->m_orig_glMultiTexCoord1sARB))(target,s);this->m_checkErrors("glMultiTexCoord1sARB");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC m_orig_glConvolutionParameterfv = nullptr;
+void m_glConvolutionParameterfv_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glConvolutionParameterfv))(target,pname,params);this->m_checkErrors("glConvolutionParameterfv");}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC m_orig_glMakeTextureHandleResidentNV = nullptr;
+void m_glMakeTextureHandleResidentNV_validation(GLuint64 handle)const{(this->*(this->m_orig_glMakeTextureHandleResidentNV))(handle);this->m_checkErrors("glMakeTextureHandleResidentNV");}
+FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC m_orig_glMultMatrixxOES = nullptr;
+void m_glMultMatrixxOES_validation(const GLfixed* m)const{(this->*(this->m_orig_glMultMatrixxOES))(m);this->m_checkErrors("glMultMatrixxOES");}
+FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC m_orig_glTextureNormalEXT = nullptr;
+void m_glTextureNormalEXT_validation(GLenum mode)const{(this->*(this->m_orig_glTextureNormalEXT))(mode);this->m_checkErrors("glTextureNormalEXT");}
+FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC m_orig_glGetQueryivARB = nullptr;
+void m_glGetQueryivARB_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetQueryivARB))(target,pname,params);this->m_checkErrors("glGetQueryivARB");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC m_orig_glCompressedMultiTexImage3DEXT = nullptr;
+void m_glCompressedMultiTexImage3DEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedMultiTexImage3DEXT))(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);this->m_checkErrors("glCompressedMultiTexImage3DEXT");}
+FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC m_orig_glGetInstrumentsSGIX = nullptr;
+GLint m_glGetInstrumentsSGIX_validation()const{GLint const result = (this->*(this->m_orig_glGetInstrumentsSGIX))();this->m_checkErrors("glGetInstrumentsSGIX");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC m_orig_glProgramUniformMatrix4x3fvEXT = nullptr;
+void m_glProgramUniformMatrix4x3fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x3fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x3fvEXT");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC m_orig_glPointParameterf = nullptr;
+void m_glPointParameterf_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPointParameterf))(pname,param);this->m_checkErrors("glPointParameterf");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC m_orig_glProgramUniform3dEXT = nullptr;
+void m_glProgramUniform3dEXT_validation(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glProgramUniform3dEXT))(program,location,x,y,z);this->m_checkErrors("glProgramUniform3dEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC m_orig_glMultiTexCoord2hNV = nullptr;
+void m_glMultiTexCoord2hNV_validation(GLenum target,GLhalfNV s,GLhalfNV t)const{(this->*(this->m_orig_glMultiTexCoord2hNV))(target,s,t);this->m_checkErrors("glMultiTexCoord2hNV");}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC m_orig_glGetConvolutionFilterEXT = nullptr;
+void m_glGetConvolutionFilterEXT_validation(GLenum target,GLenum format,GLenum type,void* image)const{(this->*(this->m_orig_glGetConvolutionFilterEXT))(target,format,type,image);this->m_checkErrors("glGetConvolutionFilterEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC m_orig_glVertexAttrib2hNV = nullptr;
+void m_glVertexAttrib2hNV_validation(GLuint index,GLhalfNV x,GLhalfNV y)const{(this->*(this->m_orig_glVertexAttrib2hNV))(index,x,y);this->m_checkErrors("glVertexAttrib2hNV");}
+FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC m_orig_glCurrentPaletteMatrixARB = nullptr;
+void m_glCurrentPaletteMatrixARB_validation(GLint index)const{(this->*(this->m_orig_glCurrentPaletteMatrixARB))(index);this->m_checkErrors("glCurrentPaletteMatrixARB");}
+FunctionTable::MEMBERPFNGLFOGXVOESPROC m_orig_glFogxvOES = nullptr;
+void m_glFogxvOES_validation(GLenum pname,const GLfixed* param)const{(this->*(this->m_orig_glFogxvOES))(pname,param);this->m_checkErrors("glFogxvOES");}
+FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC m_orig_glCreateRenderbuffers = nullptr;
+void m_glCreateRenderbuffers_validation(GLsizei n,GLuint* renderbuffers)const{(this->*(this->m_orig_glCreateRenderbuffers))(n,renderbuffers);this->m_checkErrors("glCreateRenderbuffers");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC m_orig_glVertexAttrib4Nusv = nullptr;
+void m_glVertexAttrib4Nusv_validation(GLuint index,const GLushort* v)const{(this->*(this->m_orig_glVertexAttrib4Nusv))(index,v);this->m_checkErrors("glVertexAttrib4Nusv");}
+FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC m_orig_glCombinerInputNV = nullptr;
+void m_glCombinerInputNV_validation(GLenum stage,GLenum portion,GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{(this->*(this->m_orig_glCombinerInputNV))(stage,portion,variable,input,mapping,componentUsage);this->m_checkErrors("glCombinerInputNV");}
+FunctionTable::MEMBERPFNGLDEPTHFUNCPROC m_orig_glDepthFunc = nullptr;
+void m_glDepthFunc_validation(GLenum func)const{(this->*(this->m_orig_glDepthFunc))(func);this->m_checkErrors("glDepthFunc");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC m_orig_glWindowPos4fMESA = nullptr;
+void m_glWindowPos4fMESA_validation(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glWindowPos4fMESA))(x,y,z,w);this->m_checkErrors("glWindowPos4fMESA");}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC m_orig_glEnableClientStateIndexedEXT = nullptr;
+void m_glEnableClientStateIndexedEXT_validation(GLenum array,GLuint index)const{(this->*(this->m_orig_glEnableClientStateIndexedEXT))(array,index);this->m_checkErrors("glEnableClientStateIndexedEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC m_orig_glTexCoord4iv = nullptr;
+void m_glTexCoord4iv_validation(const GLint* v)const{(this->*(this->m_orig_glTexCoord4iv))(v);this->m_checkErrors("glTexCoord4iv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC m_orig_glProgramUniform4i64ARB = nullptr;
+void m_glProgramUniform4i64ARB_validation(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{(this->*(this->m_orig_glProgramUniform4i64ARB))(program,location,x,y,z,w);this->m_checkErrors("glProgramUniform4i64ARB");}
+FunctionTable::MEMBERPFNGLBLENDFUNCIPROC m_orig_glBlendFunci = nullptr;
+void m_glBlendFunci_validation(GLuint buf,GLenum src,GLenum dst)const{(this->*(this->m_orig_glBlendFunci))(buf,src,dst);this->m_checkErrors("glBlendFunci");}
+FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC m_orig_glResolveDepthValuesNV = nullptr;
+void m_glResolveDepthValuesNV_validation()const{(this->*(this->m_orig_glResolveDepthValuesNV))();this->m_checkErrors("glResolveDepthValuesNV");}
+FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC m_orig_glTextureColorMaskSGIS = nullptr;
+void m_glTextureColorMaskSGIS_validation(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{(this->*(this->m_orig_glTextureColorMaskSGIS))(red,green,blue,alpha);this->m_checkErrors("glTextureColorMaskSGIS");}
+FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC m_orig_glCreateShaderProgramEXT = nullptr;
+GLuint m_glCreateShaderProgramEXT_validation(GLenum type,const GLchar* string)const{GLuint const result = (this->*(this->m_orig_glCreateShaderProgramEXT))(type,string);this->m_checkErrors("glCreateShaderProgramEXT");return result;}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC m_orig_glBufferStorage = nullptr;
+void m_glBufferStorage_validation(GLenum target,GLsizeiptr size,const void* data,GLbitfield flags)const{(this->*(this->m_orig_glBufferStorage))(target,size,data,flags);this->m_checkErrors("glBufferStorage");}
+FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC m_orig_glMakeNamedBufferNonResidentNV = nullptr;
+void m_glMakeNamedBufferNonResidentNV_validation(GLuint buffer)const{(this->*(this->m_orig_glMakeNamedBufferNonResidentNV))(buffer);this->m_checkErrors("glMakeNamedBufferNonResidentNV");}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC m_orig_glRenderbufferStorageMultisampleEXT = nullptr;
+void m_glRenderbufferStorageMultisampleEXT_validation(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glRenderbufferStorageMultisampleEXT))(target,samples,internalformat,width,height);this->m_checkErrors("glRenderbufferStorageMultisampleEXT");}
+FunctionTable::MEMBERPFNGLGETFLOATI_VPROC m_orig_glGetFloati_v = nullptr;
+void m_glGetFloati_v_validation(GLenum target,GLuint index,GLfloat* data)const{(this->*(this->m_orig_glGetFloati_v))(target,index,data);this->m_checkErrors("glGetFloati_v");}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC m_orig_glUniform2ui64ARB = nullptr;
+void m_glUniform2ui64ARB_validation(GLint location,GLuint64 x,GLuint64 y)const{(this->*(this->m_orig_glUniform2ui64ARB))(location,x,y);this->m_checkErrors("glUniform2ui64ARB");}
+FunctionTable::MEMBERPFNGLVERTEX3FVPROC m_orig_glVertex3fv = nullptr;
+void m_glVertex3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glVertex3fv))(v);this->m_checkErrors("glVertex3fv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC m_orig_glGetUniformLocation = nullptr;
+GLint m_glGetUniformLocation_validation(GLuint program,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetUniformLocation))(program,name);this->m_checkErrors("glGetUniformLocation");return result;}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC m_orig_glVertexStream1svATI = nullptr;
+void m_glVertexStream1svATI_validation(GLenum stream,const GLshort* coords)const{(this->*(this->m_orig_glVertexStream1svATI))(stream,coords);this->m_checkErrors("glVertexStream1svATI");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC m_orig_glVertexStream3fATI = nullptr;
+void m_glVertexStream3fATI_validation(GLenum stream,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glVertexStream3fATI))(stream,x,y,z);this->m_checkErrors("glVertexStream3fATI");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC m_orig_glNamedFramebufferDrawBuffers = nullptr;
+void m_glNamedFramebufferDrawBuffers_validation(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{(this->*(this->m_orig_glNamedFramebufferDrawBuffers))(framebuffer,n,bufs);this->m_checkErrors("glNamedFramebufferDrawBuffers");}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC m_orig_glUniform2ui64vNV = nullptr;
+void m_glUniform2ui64vNV_validation(GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glUniform2ui64vNV))(location,count,value);this->m_checkErrors("glUniform2ui64vNV");}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC m_orig_glTexCoordPointervINTEL = nullptr;
+void m_glTexCoordPointervINTEL_validation(GLint size,GLenum type,const void** pointer)const{(this->*(this->m_orig_glTexCoordPointervINTEL))(size,type,pointer);this->m_checkErrors("glTexCoordPointervINTEL");}
+FunctionTable::MEMBERPFNGLUNIFORM4FVPROC m_orig_glUniform4fv = nullptr;
+void m_glUniform4fv_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform4fv))(location,count,value);this->m_checkErrors("glUniform4fv");}
+FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC m_orig_glNormalPointerEXT = nullptr;
+void m_glNormalPointerEXT_validation(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{(this->*(this->m_orig_glNormalPointerEXT))(type,stride,count,pointer);this->m_checkErrors("glNormalPointerEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC m_orig_glVertexAttrib4hNV = nullptr;
+void m_glVertexAttrib4hNV_validation(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{(this->*(this->m_orig_glVertexAttrib4hNV))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4hNV");}
+FunctionTable::MEMBERPFNGLNORMAL3FPROC m_orig_glNormal3f = nullptr;
+void m_glNormal3f_validation(GLfloat nx,GLfloat ny,GLfloat nz)const{(this->*(this->m_orig_glNormal3f))(nx,ny,nz);this->m_checkErrors("glNormal3f");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC m_orig_glVertexStream2iATI = nullptr;
+void m_glVertexStream2iATI_validation(GLenum stream,GLint x,GLint y)const{(this->*(this->m_orig_glVertexStream2iATI))(stream,x,y);this->m_checkErrors("glVertexStream2iATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC m_orig_glVertexAttribP4uiv = nullptr;
+void m_glVertexAttribP4uiv_validation(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{(this->*(this->m_orig_glVertexAttribP4uiv))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP4uiv");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC m_orig_glCompressedTextureSubImage3D = nullptr;
+void m_glCompressedTextureSubImage3D_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTextureSubImage3D))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);this->m_checkErrors("glCompressedTextureSubImage3D");}
+FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC m_orig_glAsyncMarkerSGIX = nullptr;
+void m_glAsyncMarkerSGIX_validation(GLuint marker)const{(this->*(this->m_orig_glAsyncMarkerSGIX))(marker);this->m_checkErrors("glAsyncMarkerSGIX");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC m_orig_glTextureStorageSparseAMD = nullptr;
+void m_glTextureStorageSparseAMD_validation(GLuint texture,GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{(this->*(this->m_orig_glTextureStorageSparseAMD))(texture,target,internalFormat,width,height,depth,layers,flags);this->m_checkErrors("glTextureStorageSparseAMD");}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC m_orig_glGetConvolutionParameterivEXT = nullptr;
+void m_glGetConvolutionParameterivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetConvolutionParameterivEXT))(target,pname,params);this->m_checkErrors("glGetConvolutionParameterivEXT");}
+FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC m_orig_glEndPerfQueryINTEL = nullptr;
+void m_glEndPerfQueryINTEL_validation(GLuint queryHandle)const{(this->*(this->m_orig_glEndPerfQueryINTEL))(queryHandle);this->m_checkErrors("glEndPerfQueryINTEL");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC m_orig_glFragmentLightModeliSGIX = nullptr;
+void m_glFragmentLightModeliSGIX_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glFragmentLightModeliSGIX))(pname,param);this->m_checkErrors("glFragmentLightModeliSGIX");}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC m_orig_glPrioritizeTexturesEXT = nullptr;
+void m_glPrioritizeTexturesEXT_validation(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{(this->*(this->m_orig_glPrioritizeTexturesEXT))(n,textures,priorities);this->m_checkErrors("glPrioritizeTexturesEXT");}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC m_orig_glEndConditionalRender = nullptr;
+void m_glEndConditionalRender_validation()const{(this->*(this->m_orig_glEndConditionalRender))();this->m_checkErrors("glEndConditionalRender");}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC m_orig_glEnableClientState = nullptr;
+void m_glEnableClientState_validation(GLenum cap)const{(this->*(this->m_orig_glEnableClientState))(cap);this->m_checkErrors("glEnableClientState");}
+FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC m_orig_glResetHistogram = nullptr;
+void m_glResetHistogram_validation(GLenum target)const{(this->*(this->m_orig_glResetHistogram))(target);this->m_checkErrors("glResetHistogram");}
+FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC m_orig_glGetOcclusionQueryivNV = nullptr;
+void m_glGetOcclusionQueryivNV_validation(GLuint id,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetOcclusionQueryivNV))(id,pname,params);this->m_checkErrors("glGetOcclusionQueryivNV");}
+FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC m_orig_glUniform1uiEXT = nullptr;
+void m_glUniform1uiEXT_validation(GLint location,GLuint v0)const{(this->*(this->m_orig_glUniform1uiEXT))(location,v0);this->m_checkErrors("glUniform1uiEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC m_orig_glMultiTexCoord2sv = nullptr;
+void m_glMultiTexCoord2sv_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord2sv))(target,v);this->m_checkErrors("glMultiTexCoord2sv");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC m_orig_glTexSubImage2DEXT = nullptr;
+void m_glTexSubImage2DEXT_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTexSubImage2DEXT))(target,level,xoffset,yoffset,width,height,format,type,pixels);this->m_checkErrors("glTexSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC m_orig_glProgramUniform2uiv = nullptr;
+void m_glProgramUniform2uiv_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform2uiv))(program,location,count,value);this->m_checkErrors("glProgramUniform2uiv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC m_orig_glMultiTexCoord2iARB = nullptr;
+void m_glMultiTexCoord2iARB_validation(GLenum target,GLint s,GLint t)const{(this->*(this->m_orig_glMultiTexCoord2iARB))(target,s,t);this->m_checkErrors("glMultiTexCoord2iARB");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC m_orig_glGetQueryObjectuiv = nullptr;
+void m_glGetQueryObjectuiv_validation(GLuint id,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetQueryObjectuiv))(id,pname,params);this->m_checkErrors("glGetQueryObjectuiv");}
+FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC m_orig_glGenerateMultiTexMipmapEXT = nullptr;
+void m_glGenerateMultiTexMipmapEXT_validation(GLenum texunit,GLenum target)const{(this->*(this->m_orig_glGenerateMultiTexMipmapEXT))(texunit,target);this->m_checkErrors("glGenerateMultiTexMipmapEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC m_orig_glVertexAttrib4iv = nullptr;
+void m_glVertexAttrib4iv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttrib4iv))(index,v);this->m_checkErrors("glVertexAttrib4iv");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC m_orig_glWindowPos3dvMESA = nullptr;
+void m_glWindowPos3dvMESA_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos3dvMESA))(v);this->m_checkErrors("glWindowPos3dvMESA");}
+FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC m_orig_glLabelObjectEXT = nullptr;
+void m_glLabelObjectEXT_validation(GLenum type,GLuint object,GLsizei length,const GLchar* label)const{(this->*(this->m_orig_glLabelObjectEXT))(type,object,length,label);this->m_checkErrors("glLabelObjectEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC m_orig_glProgramUniform1uiv = nullptr;
+void m_glProgramUniform1uiv_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform1uiv))(program,location,count,value);this->m_checkErrors("glProgramUniform1uiv");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC m_orig_glFramebufferTexture = nullptr;
+void m_glFramebufferTexture_validation(GLenum target,GLenum attachment,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTexture))(target,attachment,texture,level);this->m_checkErrors("glFramebufferTexture");}
+FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC m_orig_glMultiTexEnvfEXT = nullptr;
+void m_glMultiTexEnvfEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glMultiTexEnvfEXT))(texunit,target,pname,param);this->m_checkErrors("glMultiTexEnvfEXT");}
+FunctionTable::MEMBERPFNGLGETTEXGENDVPROC m_orig_glGetTexGendv = nullptr;
+void m_glGetTexGendv_validation(GLenum coord,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetTexGendv))(coord,pname,params);this->m_checkErrors("glGetTexGendv");}
+FunctionTable::MEMBERPFNGLVERTEX4XOESPROC m_orig_glVertex4xOES = nullptr;
+void m_glVertex4xOES_validation(GLfixed x,GLfixed y,GLfixed z)const{(this->*(this->m_orig_glVertex4xOES))(x,y,z);this->m_checkErrors("glVertex4xOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC m_orig_glVertexAttribI2uivEXT = nullptr;
+void m_glVertexAttribI2uivEXT_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI2uivEXT))(index,v);this->m_checkErrors("glVertexAttribI2uivEXT");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC m_orig_glNamedProgramLocalParameter4fvEXT = nullptr;
+void m_glNamedProgramLocalParameter4fvEXT_validation(GLuint program,GLenum target,GLuint index,const GLfloat* params)const{(this->*(this->m_orig_glNamedProgramLocalParameter4fvEXT))(program,target,index,params);this->m_checkErrors("glNamedProgramLocalParameter4fvEXT");}
+FunctionTable::MEMBERPFNGLCOLOR3USVPROC m_orig_glColor3usv = nullptr;
+void m_glColor3usv_validation(const GLushort* v)const{(this->*(this->m_orig_glColor3usv))(v);this->m_checkErrors("glColor3usv");}
+FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC m_orig_glGetPixelTransformParameterfvEXT = nullptr;
+void m_glGetPixelTransformParameterfvEXT_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetPixelTransformParameterfvEXT))(target,pname,params);this->m_checkErrors("glGetPixelTransformParameterfvEXT");}
+FunctionTable::MEMBERPFNGLINDEXXVOESPROC m_orig_glIndexxvOES = nullptr;
+void m_glIndexxvOES_validation(const GLfixed* component)const{(this->*(this->m_orig_glIndexxvOES))(component);this->m_checkErrors("glIndexxvOES");}
+FunctionTable::MEMBERPFNGLDEPTHMASKPROC m_orig_glDepthMask = nullptr;
+void m_glDepthMask_validation(GLboolean flag)const{(this->*(this->m_orig_glDepthMask))(flag);this->m_checkErrors("glDepthMask");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC m_orig_glProgramUniformMatrix2x4fv = nullptr;
+void m_glProgramUniformMatrix2x4fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x4fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x4fv");}
+FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC m_orig_glAreProgramsResidentNV = nullptr;
+GLboolean m_glAreProgramsResidentNV_validation(GLsizei n,const GLuint* programs,GLboolean* residences)const{GLboolean const result = (this->*(this->m_orig_glAreProgramsResidentNV))(n,programs,residences);this->m_checkErrors("glAreProgramsResidentNV");return result;}
+FunctionTable::MEMBERPFNGLCOLORTABLEPROC m_orig_glColorTable = nullptr;
+void m_glColorTable_validation(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* table)const{(this->*(this->m_orig_glColorTable))(target,internalformat,width,format,type,table);this->m_checkErrors("glColorTable");}
+FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC m_orig_glBeginQueryIndexed = nullptr;
+void m_glBeginQueryIndexed_validation(GLenum target,GLuint index,GLuint id)const{(this->*(this->m_orig_glBeginQueryIndexed))(target,index,id);this->m_checkErrors("glBeginQueryIndexed");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC m_orig_glVertexStream1dvATI = nullptr;
+void m_glVertexStream1dvATI_validation(GLenum stream,const GLdouble* coords)const{(this->*(this->m_orig_glVertexStream1dvATI))(stream,coords);this->m_checkErrors("glVertexStream1dvATI");}
+FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC m_orig_glGetMultiTexEnvfvEXT = nullptr;
+void m_glGetMultiTexEnvfvEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMultiTexEnvfvEXT))(texunit,target,pname,params);this->m_checkErrors("glGetMultiTexEnvfvEXT");}
+FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC m_orig_glDeleteFencesNV = nullptr;
+void m_glDeleteFencesNV_validation(GLsizei n,const GLuint* fences)const{(this->*(this->m_orig_glDeleteFencesNV))(n,fences);this->m_checkErrors("glDeleteFencesNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC m_orig_glVertexAttribs1dvNV = nullptr;
+void m_glVertexAttribs1dvNV_validation(GLuint index,GLsizei count,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribs1dvNV))(index,count,v);this->m_checkErrors("glVertexAttribs1dvNV");}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC m_orig_glBufferStorageExternalEXT = nullptr;
+void m_glBufferStorageExternalEXT_validation(GLenum target,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{(this->*(this->m_orig_glBufferStorageExternalEXT))(target,offset,size,clientBuffer,flags);this->m_checkErrors("glBufferStorageExternalEXT");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC m_orig_glVertexStream2sATI = nullptr;
+void m_glVertexStream2sATI_validation(GLenum stream,GLshort x,GLshort y)const{(this->*(this->m_orig_glVertexStream2sATI))(stream,x,y);this->m_checkErrors("glVertexStream2sATI");}
+FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC m_orig_glGetnSeparableFilterARB = nullptr;
+void m_glGetnSeparableFilterARB_validation(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{(this->*(this->m_orig_glGetnSeparableFilterARB))(target,format,type,rowBufSize,row,columnBufSize,column,span);this->m_checkErrors("glGetnSeparableFilterARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC m_orig_glProgramUniform2dv = nullptr;
+void m_glProgramUniform2dv_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform2dv))(program,location,count,value);this->m_checkErrors("glProgramUniform2dv");}
+FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC m_orig_glActiveStencilFaceEXT = nullptr;
+void m_glActiveStencilFaceEXT_validation(GLenum face)const{(this->*(this->m_orig_glActiveStencilFaceEXT))(face);this->m_checkErrors("glActiveStencilFaceEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC m_orig_glProgramUniform4dEXT = nullptr;
+void m_glProgramUniform4dEXT_validation(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glProgramUniform4dEXT))(program,location,x,y,z,w);this->m_checkErrors("glProgramUniform4dEXT");}
+FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC m_orig_glPointSizexOES = nullptr;
+void m_glPointSizexOES_validation(GLfixed size)const{(this->*(this->m_orig_glPointSizexOES))(size);this->m_checkErrors("glPointSizexOES");}
+FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC m_orig_glRasterPos2sv = nullptr;
+void m_glRasterPos2sv_validation(const GLshort* v)const{(this->*(this->m_orig_glRasterPos2sv))(v);this->m_checkErrors("glRasterPos2sv");}
+FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC m_orig_glBindParameterEXT = nullptr;
+GLuint m_glBindParameterEXT_validation(GLenum value)const{GLuint const result = (this->*(this->m_orig_glBindParameterEXT))(value);this->m_checkErrors("glBindParameterEXT");return result;}
+FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC m_orig_glTexCoord1sv = nullptr;
+void m_glTexCoord1sv_validation(const GLshort* v)const{(this->*(this->m_orig_glTexCoord1sv))(v);this->m_checkErrors("glTexCoord1sv");}
+FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC m_orig_glBlendParameteriNV = nullptr;
+void m_glBlendParameteriNV_validation(GLenum pname,GLint value)const{(this->*(this->m_orig_glBlendParameteriNV))(pname,value);this->m_checkErrors("glBlendParameteriNV");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC m_orig_glNamedProgramLocalParameter4dvEXT = nullptr;
+void m_glNamedProgramLocalParameter4dvEXT_validation(GLuint program,GLenum target,GLuint index,const GLdouble* params)const{(this->*(this->m_orig_glNamedProgramLocalParameter4dvEXT))(program,target,index,params);this->m_checkErrors("glNamedProgramLocalParameter4dvEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC m_orig_glProgramUniformHandleui64NV = nullptr;
+void m_glProgramUniformHandleui64NV_validation(GLuint program,GLint location,GLuint64 value)const{(this->*(this->m_orig_glProgramUniformHandleui64NV))(program,location,value);this->m_checkErrors("glProgramUniformHandleui64NV");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC m_orig_glGetTextureParameterfvEXT = nullptr;
+void m_glGetTextureParameterfvEXT_validation(GLuint texture,GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTextureParameterfvEXT))(texture,target,pname,params);this->m_checkErrors("glGetTextureParameterfvEXT");}
+FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC m_orig_glGetPathMetricsNV = nullptr;
+void m_glGetPathMetricsNV_validation(GLbitfield metricQueryMask,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLsizei stride,GLfloat* metrics)const{(this->*(this->m_orig_glGetPathMetricsNV))(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);this->m_checkErrors("glGetPathMetricsNV");}
+FunctionTable::MEMBERPFNGLVERTEX2IPROC m_orig_glVertex2i = nullptr;
+void m_glVertex2i_validation(GLint x,GLint y)const{(this->*(this->m_orig_glVertex2i))(x,y);this->m_checkErrors("glVertex2i");}
+FunctionTable::MEMBERPFNGLNEWLISTPROC m_orig_glNewList = nullptr;
+void m_glNewList_validation(GLuint list,GLenum mode)const{(this->*(this->m_orig_glNewList))(list,mode);this->m_checkErrors("glNewList");}
+FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC m_orig_glMatrixLoad3x3fNV = nullptr;
+void m_glMatrixLoad3x3fNV_validation(GLenum matrixMode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixLoad3x3fNV))(matrixMode,m);this->m_checkErrors("glMatrixLoad3x3fNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC m_orig_glMultiTexCoord2fARB = nullptr;
+void m_glMultiTexCoord2fARB_validation(GLenum target,GLfloat s,GLfloat t)const{(this->*(this->m_orig_glMultiTexCoord2fARB))(target,s,t);this->m_checkErrors("glMultiTexCoord2fARB");}
+FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC m_orig_glWeightdvARB = nullptr;
+void m_glWeightdvARB_validation(GLint size,const GLdouble* weights)const{(this->*(this->m_orig_glWeightdvARB))(size,weights);this->m_checkErrors("glWeightdvARB");}
+FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC m_orig_glIsTransformFeedbackNV = nullptr;
+GLboolean m_glIsTransformFeedbackNV_validation(GLuint id)const{GLboolean const result = (this->*(this->m_orig_glIsTransformFeedbackNV))(id);this->m_checkErrors("glIsTransformFeedbackNV");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC m_orig_glVertexAttribDivisorARB = nullptr;
+void m_glVertexAttribDivisorARB_validation(GLuint index,GLuint divisor)const{(this->*(this->m_orig_glVertexAttribDivisorARB))(index,divisor);this->m_checkErrors("glVertexAttribDivisorARB");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC m_orig_glSecondaryColorP3uiv = nullptr;
+void m_glSecondaryColorP3uiv_validation(GLenum type,const GLuint* color)const{(this->*(this->m_orig_glSecondaryColorP3uiv))(type,color);this->m_checkErrors("glSecondaryColorP3uiv");}
+FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC m_orig_glGetnCompressedTexImageARB = nullptr;
+void m_glGetnCompressedTexImageARB_validation(GLenum target,GLint lod,GLsizei bufSize,void* img)const{(this->*(this->m_orig_glGetnCompressedTexImageARB))(target,lod,bufSize,img);this->m_checkErrors("glGetnCompressedTexImageARB");}
+FunctionTable::MEMBERPFNGLGETINTEGERVPROC m_orig_glGetIntegerv = nullptr;
+void m_glGetIntegerv_validation(GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetIntegerv))(pname,params);this->m_checkErrors("glGetIntegerv");}
+FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC m_orig_glMatrixLoaddEXT = nullptr;
+void m_glMatrixLoaddEXT_validation(GLenum mode,const GLdouble* m)const{(this->*(this->m_orig_glMatrixLoaddEXT))(mode,m);this->m_checkErrors("glMatrixLoaddEXT");}
+FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC m_orig_glGetPathLengthNV = nullptr;
+GLfloat m_glGetPathLengthNV_validation(GLuint path,GLsizei startSegment,GLsizei numSegments)const{GLfloat const result = (this->*(this->m_orig_glGetPathLengthNV))(path,startSegment,numSegments);this->m_checkErrors("glGetPathLengthNV");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC m_orig_glProgramUniformMatrix3dv = nullptr;
+void m_glProgramUniformMatrix3dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix3dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3dv");}
+FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC m_orig_glUniform4i64NV = nullptr;
+void m_glUniform4i64NV_validation(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{(this->*(this->m_orig_glUniform4i64NV))(location,x,y,z,w);this->m_checkErrors("glUniform4i64NV");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC m_orig_glGetHistogramEXT = nullptr;
+void m_glGetHistogramEXT_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{(this->*(this->m_orig_glGetHistogramEXT))(target,reset,format,type,values);this->m_checkErrors("glGetHistogramEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC m_orig_glVertexAttrib4NuivARB = nullptr;
+void m_glVertexAttrib4NuivARB_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttrib4NuivARB))(index,v);this->m_checkErrors("glVertexAttrib4NuivARB");}
+FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC m_orig_glMapGrid2xOES = nullptr;
+void m_glMapGrid2xOES_validation(GLint n,GLfixed u1,GLfixed u2,GLfixed v1,GLfixed v2)const{(this->*(this->m_orig_glMapGrid2xOES))(n,u1,u2,v1,v2);this->m_checkErrors("glMapGrid2xOES");}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC m_orig_glTexImage2D = nullptr;
+void m_glTexImage2D_validation(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glTexImage2D))(target,level,internalFormat,width,height,border,format,type,pixels);this->m_checkErrors("glTexImage2D");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC m_orig_glWindowPos2fvARB = nullptr;
+void m_glWindowPos2fvARB_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos2fvARB))(v);this->m_checkErrors("glWindowPos2fvARB");}
+FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC m_orig_glEnableIndexedEXT = nullptr;
+void m_glEnableIndexedEXT_validation(GLenum target,GLuint index)const{(this->*(this->m_orig_glEnableIndexedEXT))(target,index);this->m_checkErrors("glEnableIndexedEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC m_orig_glTexCoord1bvOES = nullptr;
+void m_glTexCoord1bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glTexCoord1bvOES))(coords);this->m_checkErrors("glTexCoord1bvOES");}
+FunctionTable::MEMBERPFNGLDRAWPIXELSPROC m_orig_glDrawPixels = nullptr;
+void m_glDrawPixels_validation(GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glDrawPixels))(width,height,format,type,pixels);this->m_checkErrors("glDrawPixels");}
+FunctionTable::MEMBERPFNGLMULTMATRIXDPROC m_orig_glMultMatrixd = nullptr;
+void m_glMultMatrixd_validation(const GLdouble* m)const{(this->*(this->m_orig_glMultMatrixd))(m);this->m_checkErrors("glMultMatrixd");}
+FunctionTable::MEMBERPFNGLMULTMATRIXFPROC m_orig_glMultMatrixf = nullptr;
+void m_glMultMatrixf_validation(const GLfloat* m)const{(this->*(this->m_orig_glMultMatrixf))(m);this->m_checkErrors("glMultMatrixf");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC m_orig_glReplacementCodePointerSUN = nullptr;
+void m_glReplacementCodePointerSUN_validation(GLenum type,GLsizei stride,const void** pointer)const{(this->*(this->m_orig_glReplacementCodePointerSUN))(type,stride,pointer);this->m_checkErrors("glReplacementCodePointerSUN");}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC m_orig_glLoadTransposeMatrixdARB = nullptr;
+void m_glLoadTransposeMatrixdARB_validation(const GLdouble* m)const{(this->*(this->m_orig_glLoadTransposeMatrixdARB))(m);this->m_checkErrors("glLoadTransposeMatrixdARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC m_orig_glVertexAttrib4Nubv = nullptr;
+void m_glVertexAttrib4Nubv_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttrib4Nubv))(index,v);this->m_checkErrors("glVertexAttrib4Nubv");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC m_orig_glVertexArrayVertexAttribIOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribIOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayVertexAttribIOffsetEXT))(vaobj,buffer,index,size,type,stride,offset);this->m_checkErrors("glVertexArrayVertexAttribIOffsetEXT");}
+FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC m_orig_glCompileShaderARB = nullptr;
+void m_glCompileShaderARB_validation(GLhandleARB shaderObj)const{(this->*(this->m_orig_glCompileShaderARB))(shaderObj);this->m_checkErrors("glCompileShaderARB");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC m_orig_glWindowPos3dMESA = nullptr;
+void m_glWindowPos3dMESA_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glWindowPos3dMESA))(x,y,z);this->m_checkErrors("glWindowPos3dMESA");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC m_orig_glNormalStream3fvATI = nullptr;
+void m_glNormalStream3fvATI_validation(GLenum stream,const GLfloat* coords)const{(this->*(this->m_orig_glNormalStream3fvATI))(stream,coords);this->m_checkErrors("glNormalStream3fvATI");}
+FunctionTable::MEMBERPFNGLCOLOR4USVPROC m_orig_glColor4usv = nullptr;
+void m_glColor4usv_validation(const GLushort* v)const{(this->*(this->m_orig_glColor4usv))(v);this->m_checkErrors("glColor4usv");}
+FunctionTable::MEMBERPFNGLMAPGRID1FPROC m_orig_glMapGrid1f = nullptr;
+void m_glMapGrid1f_validation(GLint un,GLfloat u1,GLfloat u2)const{(this->*(this->m_orig_glMapGrid1f))(un,u1,u2);this->m_checkErrors("glMapGrid1f");}
+FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC m_orig_glPolygonStipple = nullptr;
+void m_glPolygonStipple_validation(const GLubyte* mask)const{(this->*(this->m_orig_glPolygonStipple))(mask);this->m_checkErrors("glPolygonStipple");}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC m_orig_glUniform4ui64ARB = nullptr;
+void m_glUniform4ui64ARB_validation(GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{(this->*(this->m_orig_glUniform4ui64ARB))(location,x,y,z,w);this->m_checkErrors("glUniform4ui64ARB");}
+FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC m_orig_glTextureRenderbufferEXT = nullptr;
+void m_glTextureRenderbufferEXT_validation(GLuint texture,GLenum target,GLuint renderbuffer)const{(this->*(this->m_orig_glTextureRenderbufferEXT))(texture,target,renderbuffer);this->m_checkErrors("glTextureRenderbufferEXT");}
+FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC m_orig_glGetSubroutineUniformLocation = nullptr;
+GLint m_glGetSubroutineUniformLocation_validation(GLuint program,GLenum shadertype,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetSubroutineUniformLocation))(program,shadertype,name);this->m_checkErrors("glGetSubroutineUniformLocation");return result;}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC m_orig_glGetFramebufferParameteriv = nullptr;
+void m_glGetFramebufferParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFramebufferParameteriv))(target,pname,params);this->m_checkErrors("glGetFramebufferParameteriv");}
+FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC m_orig_glPixelMapusv = nullptr;
+void m_glPixelMapusv_validation(GLenum map,GLsizei mapsize,const GLushort* values)const{(this->*(this->m_orig_glPixelMapusv))(map,mapsize,values);this->m_checkErrors("glPixelMapusv");}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC m_orig_glGetSamplerParameteriv = nullptr;
+void m_glGetSamplerParameteriv_validation(GLuint sampler,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetSamplerParameteriv))(sampler,pname,params);this->m_checkErrors("glGetSamplerParameteriv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC m_orig_glVertexStream2fvATI = nullptr;
+void m_glVertexStream2fvATI_validation(GLenum stream,const GLfloat* coords)const{(this->*(this->m_orig_glVertexStream2fvATI))(stream,coords);this->m_checkErrors("glVertexStream2fvATI");}
+FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC m_orig_glProgramStringARB = nullptr;
+void m_glProgramStringARB_validation(GLenum target,GLenum format,GLsizei len,const void* string)const{(this->*(this->m_orig_glProgramStringARB))(target,format,len,string);this->m_checkErrors("glProgramStringARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC m_orig_glProgramUniformMatrix3dvEXT = nullptr;
+void m_glProgramUniformMatrix3dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix3dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3dvEXT");}
+FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC m_orig_glSeparableFilter2D = nullptr;
+void m_glSeparableFilter2D_validation(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* row,const GLvoid* column)const{(this->*(this->m_orig_glSeparableFilter2D))(target,internalformat,width,height,format,type,row,column);this->m_checkErrors("glSeparableFilter2D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC m_orig_glVertexAttribI1uiv = nullptr;
+void m_glVertexAttribI1uiv_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI1uiv))(index,v);this->m_checkErrors("glVertexAttribI1uiv");}
+FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC m_orig_glLGPUCopyImageSubDataNVX = nullptr;
+void m_glLGPUCopyImageSubDataNVX_validation(GLuint sourceGpu,GLbitfield destinationGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srxY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{(this->*(this->m_orig_glLGPUCopyImageSubDataNVX))(sourceGpu,destinationGpuMask,srcName,srcTarget,srcLevel,srcX,srxY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);this->m_checkErrors("glLGPUCopyImageSubDataNVX");}
+FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC m_orig_glTexStorage2D = nullptr;
+void m_glTexStorage2D_validation(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glTexStorage2D))(target,levels,internalformat,width,height);this->m_checkErrors("glTexStorage2D");}
+FunctionTable::MEMBERPFNGLCOLOR3FVPROC m_orig_glColor3fv = nullptr;
+void m_glColor3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glColor3fv))(v);this->m_checkErrors("glColor3fv");}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC m_orig_glGetMultiTexGendvEXT = nullptr;
+void m_glGetMultiTexGendvEXT_validation(GLenum texunit,GLenum coord,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetMultiTexGendvEXT))(texunit,coord,pname,params);this->m_checkErrors("glGetMultiTexGendvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC m_orig_glVertexAttribL4dvEXT = nullptr;
+void m_glVertexAttribL4dvEXT_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL4dvEXT))(index,v);this->m_checkErrors("glVertexAttribL4dvEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC m_orig_glGetActiveUniform = nullptr;
+void m_glGetActiveUniform_validation(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{(this->*(this->m_orig_glGetActiveUniform))(program,index,bufSize,length,size,type,name);this->m_checkErrors("glGetActiveUniform");}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC m_orig_glUniform2ui64vARB = nullptr;
+void m_glUniform2ui64vARB_validation(GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glUniform2ui64vARB))(location,count,value);this->m_checkErrors("glUniform2ui64vARB");}
+FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC m_orig_glMakeNamedBufferResidentNV = nullptr;
+void m_glMakeNamedBufferResidentNV_validation(GLuint buffer,GLenum access)const{(this->*(this->m_orig_glMakeNamedBufferResidentNV))(buffer,access);this->m_checkErrors("glMakeNamedBufferResidentNV");}
+FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC m_orig_glPathGlyphIndexRangeNV = nullptr;
+GLenum m_glPathGlyphIndexRangeNV_validation(GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint pathParameterTemplate,GLfloat emScale,GLuint* baseAndCount)const{GLenum const result = (this->*(this->m_orig_glPathGlyphIndexRangeNV))(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);this->m_checkErrors("glPathGlyphIndexRangeNV");return result;}
+FunctionTable::MEMBERPFNGLCOLORPOINTERPROC m_orig_glColorPointer = nullptr;
+void m_glColorPointer_validation(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{(this->*(this->m_orig_glColorPointer))(size,type,stride,ptr);this->m_checkErrors("glColorPointer");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC m_orig_glProgramEnvParameterI4ivNV = nullptr;
+void m_glProgramEnvParameterI4ivNV_validation(GLenum target,GLuint index,const GLint* params)const{(this->*(this->m_orig_glProgramEnvParameterI4ivNV))(target,index,params);this->m_checkErrors("glProgramEnvParameterI4ivNV");}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC m_orig_glMulticastGetQueryObjectui64vNV = nullptr;
+void m_glMulticastGetQueryObjectui64vNV_validation(GLuint gpu,GLuint id,GLenum pname,GLuint64* params)const{(this->*(this->m_orig_glMulticastGetQueryObjectui64vNV))(gpu,id,pname,params);this->m_checkErrors("glMulticastGetQueryObjectui64vNV");}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC m_orig_glMultiTexParameterfEXT = nullptr;
+void m_glMultiTexParameterfEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glMultiTexParameterfEXT))(texunit,target,pname,param);this->m_checkErrors("glMultiTexParameterfEXT");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC m_orig_glNamedFramebufferTextureLayer = nullptr;
+void m_glNamedFramebufferTextureLayer_validation(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{(this->*(this->m_orig_glNamedFramebufferTextureLayer))(framebuffer,attachment,texture,level,layer);this->m_checkErrors("glNamedFramebufferTextureLayer");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC m_orig_glGetVertexArrayIntegervEXT = nullptr;
+void m_glGetVertexArrayIntegervEXT_validation(GLuint vaobj,GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetVertexArrayIntegervEXT))(vaobj,pname,param);this->m_checkErrors("glGetVertexArrayIntegervEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC m_orig_glVertexAttrib3dARB = nullptr;
+void m_glVertexAttrib3dARB_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertexAttrib3dARB))(index,x,y,z);this->m_checkErrors("glVertexAttrib3dARB");}
+FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC m_orig_glVDPAUIsSurfaceNV = nullptr;
+GLboolean m_glVDPAUIsSurfaceNV_validation(GLvdpauSurfaceNV surface)const{GLboolean const result = (this->*(this->m_orig_glVDPAUIsSurfaceNV))(surface);this->m_checkErrors("glVDPAUIsSurfaceNV");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC m_orig_glMultiTexImage1DEXT = nullptr;
+void m_glMultiTexImage1DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glMultiTexImage1DEXT))(texunit,target,level,internalformat,width,border,format,type,pixels);this->m_checkErrors("glMultiTexImage1DEXT");}
+FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC m_orig_glIsAsyncMarkerSGIX = nullptr;
+GLboolean m_glIsAsyncMarkerSGIX_validation(GLuint marker)const{GLboolean const result = (this->*(this->m_orig_glIsAsyncMarkerSGIX))(marker);this->m_checkErrors("glIsAsyncMarkerSGIX");return result;}
+FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC m_orig_glGetDoublei_vEXT = nullptr;
+void m_glGetDoublei_vEXT_validation(GLenum pname,GLuint index,GLdouble* params)const{(this->*(this->m_orig_glGetDoublei_vEXT))(pname,index,params);this->m_checkErrors("glGetDoublei_vEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC m_orig_glUniform2i64NV = nullptr;
+void m_glUniform2i64NV_validation(GLint location,GLint64EXT x,GLint64EXT y)const{(this->*(this->m_orig_glUniform2i64NV))(location,x,y);this->m_checkErrors("glUniform2i64NV");}
+FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC m_orig_glIsCommandListNV = nullptr;
+GLboolean m_glIsCommandListNV_validation(GLuint list)const{GLboolean const result = (this->*(this->m_orig_glIsCommandListNV))(list);this->m_checkErrors("glIsCommandListNV");return result;}
+FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC m_orig_glUniform3uiEXT = nullptr;
+void m_glUniform3uiEXT_validation(GLint location,GLuint v0,GLuint v1,GLuint v2)const{(this->*(this->m_orig_glUniform3uiEXT))(location,v0,v1,v2);this->m_checkErrors("glUniform3uiEXT");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC m_orig_glTexParameterIuivEXT = nullptr;
+void m_glTexParameterIuivEXT_validation(GLenum target,GLenum pname,const GLuint* params)const{(this->*(this->m_orig_glTexParameterIuivEXT))(target,pname,params);this->m_checkErrors("glTexParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC m_orig_glProgramUniformMatrix4fv = nullptr;
+void m_glProgramUniformMatrix4fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix4fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4fv");}
+FunctionTable::MEMBERPFNGLVERTEX2FVPROC m_orig_glVertex2fv = nullptr;
+void m_glVertex2fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glVertex2fv))(v);this->m_checkErrors("glVertex2fv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC m_orig_glVertexAttribL3dEXT = nullptr;
+void m_glVertexAttribL3dEXT_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertexAttribL3dEXT))(index,x,y,z);this->m_checkErrors("glVertexAttribL3dEXT");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC m_orig_glFramebufferRenderbuffer = nullptr;
+void m_glFramebufferRenderbuffer_validation(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{(this->*(this->m_orig_glFramebufferRenderbuffer))(target,attachment,renderbuffertarget,renderbuffer);this->m_checkErrors("glFramebufferRenderbuffer");}
+FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC m_orig_glGetUniformLocationARB = nullptr;
+GLint m_glGetUniformLocationARB_validation(GLhandleARB programObj,const GLcharARB* name)const{GLint const result = (this->*(this->m_orig_glGetUniformLocationARB))(programObj,name);this->m_checkErrors("glGetUniformLocationARB");return result;}
+FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC m_orig_glPathParameterfvNV = nullptr;
+void m_glPathParameterfvNV_validation(GLuint path,GLenum pname,const GLfloat* value)const{(this->*(this->m_orig_glPathParameterfvNV))(path,pname,value);this->m_checkErrors("glPathParameterfvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC m_orig_glVertexAttrib3sNV = nullptr;
+void m_glVertexAttrib3sNV_validation(GLuint index,GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glVertexAttrib3sNV))(index,x,y,z);this->m_checkErrors("glVertexAttrib3sNV");}
+FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC m_orig_glGetDoublei_v = nullptr;
+void m_glGetDoublei_v_validation(GLenum target,GLuint index,GLdouble* data)const{(this->*(this->m_orig_glGetDoublei_v))(target,index,data);this->m_checkErrors("glGetDoublei_v");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC m_orig_glVertexAttrib1sv = nullptr;
+void m_glVertexAttrib1sv_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib1sv))(index,v);this->m_checkErrors("glVertexAttrib1sv");}
+FunctionTable::MEMBERPFNGLBINDSAMPLERPROC m_orig_glBindSampler = nullptr;
+void m_glBindSampler_validation(GLuint unit,GLuint sampler)const{(this->*(this->m_orig_glBindSampler))(unit,sampler);this->m_checkErrors("glBindSampler");}
+FunctionTable::MEMBERPFNGLLINEWIDTHPROC m_orig_glLineWidth = nullptr;
+void m_glLineWidth_validation(GLfloat width)const{(this->*(this->m_orig_glLineWidth))(width);this->m_checkErrors("glLineWidth");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC m_orig_glVertexArrayRangeAPPLE = nullptr;
+void m_glVertexArrayRangeAPPLE_validation(GLsizei length,void* pointer)const{(this->*(this->m_orig_glVertexArrayRangeAPPLE))(length,pointer);this->m_checkErrors("glVertexArrayRangeAPPLE");}
+FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC m_orig_glBindBufferOffsetEXT = nullptr;
+void m_glBindBufferOffsetEXT_validation(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{(this->*(this->m_orig_glBindBufferOffsetEXT))(target,index,buffer,offset);this->m_checkErrors("glBindBufferOffsetEXT");}
+FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC m_orig_glWeightfvARB = nullptr;
+void m_glWeightfvARB_validation(GLint size,const GLfloat* weights)const{(this->*(this->m_orig_glWeightfvARB))(size,weights);this->m_checkErrors("glWeightfvARB");}
+FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC m_orig_glGetIntegeri_v = nullptr;
+void m_glGetIntegeri_v_validation(GLenum target,GLuint index,GLint* data)const{(this->*(this->m_orig_glGetIntegeri_v))(target,index,data);this->m_checkErrors("glGetIntegeri_v");}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC m_orig_glGetTransformFeedbackVarying = nullptr;
+void m_glGetTransformFeedbackVarying_validation(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{(this->*(this->m_orig_glGetTransformFeedbackVarying))(program,index,bufSize,length,size,type,name);this->m_checkErrors("glGetTransformFeedbackVarying");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC m_orig_glProgramLocalParameter4fvARB = nullptr;
+void m_glProgramLocalParameter4fvARB_validation(GLenum target,GLuint index,const GLfloat* params)const{(this->*(this->m_orig_glProgramLocalParameter4fvARB))(target,index,params);this->m_checkErrors("glProgramLocalParameter4fvARB");}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC m_orig_glGetTransformFeedbackVaryingNV = nullptr;
+void m_glGetTransformFeedbackVaryingNV_validation(GLuint program,GLuint index,GLint* location)const{(this->*(this->m_orig_glGetTransformFeedbackVaryingNV))(program,index,location);this->m_checkErrors("glGetTransformFeedbackVaryingNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC m_orig_glWindowPos2iv = nullptr;
+void m_glWindowPos2iv_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos2iv))(v);this->m_checkErrors("glWindowPos2iv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC m_orig_glVertexStream1dATI = nullptr;
+void m_glVertexStream1dATI_validation(GLenum stream,GLdouble x)const{(this->*(this->m_orig_glVertexStream1dATI))(stream,x);this->m_checkErrors("glVertexStream1dATI");}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC m_orig_glColorFragmentOp2ATI = nullptr;
+void m_glColorFragmentOp2ATI_validation(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{(this->*(this->m_orig_glColorFragmentOp2ATI))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);this->m_checkErrors("glColorFragmentOp2ATI");}
+FunctionTable::MEMBERPFNGLFOGIVPROC m_orig_glFogiv = nullptr;
+void m_glFogiv_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glFogiv))(pname,params);this->m_checkErrors("glFogiv");}
+FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC m_orig_glGetTextureHandleNV = nullptr;
+GLuint64 m_glGetTextureHandleNV_validation(GLuint texture)const{GLuint64 const result = (this->*(this->m_orig_glGetTextureHandleNV))(texture);this->m_checkErrors("glGetTextureHandleNV");return result;}
+FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC m_orig_glLightModeliv = nullptr;
+void m_glLightModeliv_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glLightModeliv))(pname,params);this->m_checkErrors("glLightModeliv");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC m_orig_glDepthRangef = nullptr;
+void m_glDepthRangef_validation(GLfloat n,GLfloat f)const{(this->*(this->m_orig_glDepthRangef))(n,f);this->m_checkErrors("glDepthRangef");}
+FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC m_orig_glGetFragmentMaterialivSGIX = nullptr;
+void m_glGetFragmentMaterialivSGIX_validation(GLenum face,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFragmentMaterialivSGIX))(face,pname,params);this->m_checkErrors("glGetFragmentMaterialivSGIX");}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC m_orig_glVideoCaptureStreamParameterfvNV = nullptr;
+void m_glVideoCaptureStreamParameterfvNV_validation(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glVideoCaptureStreamParameterfvNV))(video_capture_slot,stream,pname,params);this->m_checkErrors("glVideoCaptureStreamParameterfvNV");}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC m_orig_glDeleteProgramsARB = nullptr;
+void m_glDeleteProgramsARB_validation(GLsizei n,const GLuint* programs)const{(this->*(this->m_orig_glDeleteProgramsARB))(n,programs);this->m_checkErrors("glDeleteProgramsARB");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC m_orig_glWindowPos3fvARB = nullptr;
+void m_glWindowPos3fvARB_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos3fvARB))(v);this->m_checkErrors("glWindowPos3fvARB");}
+FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC m_orig_glFeedbackBufferxOES = nullptr;
+void m_glFeedbackBufferxOES_validation(GLsizei n,GLenum type,const GLfixed* buffer)const{(this->*(this->m_orig_glFeedbackBufferxOES))(n,type,buffer);this->m_checkErrors("glFeedbackBufferxOES");}
+FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC m_orig_glGetTexBumpParameterfvATI = nullptr;
+void m_glGetTexBumpParameterfvATI_validation(GLenum pname,GLfloat* param)const{(this->*(this->m_orig_glGetTexBumpParameterfvATI))(pname,param);this->m_checkErrors("glGetTexBumpParameterfvATI");}
+FunctionTable::MEMBERPFNGLENABLEIPROC m_orig_glEnablei = nullptr;
+void m_glEnablei_validation(GLenum target,GLuint index)const{(this->*(this->m_orig_glEnablei))(target,index);this->m_checkErrors("glEnablei");}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC m_orig_glGetActiveSubroutineName = nullptr;
+void m_glGetActiveSubroutineName_validation(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{(this->*(this->m_orig_glGetActiveSubroutineName))(program,shadertype,index,bufsize,length,name);this->m_checkErrors("glGetActiveSubroutineName");}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC m_orig_glDrawBuffersARB = nullptr;
+void m_glDrawBuffersARB_validation(GLsizei n,const GLenum* bufs)const{(this->*(this->m_orig_glDrawBuffersARB))(n,bufs);this->m_checkErrors("glDrawBuffersARB");}
+FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC m_orig_glBindProgramARB = nullptr;
+void m_glBindProgramARB_validation(GLenum target,GLuint program)const{(this->*(this->m_orig_glBindProgramARB))(target,program);this->m_checkErrors("glBindProgramARB");}
+FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC m_orig_glEvalCoord1fv = nullptr;
+void m_glEvalCoord1fv_validation(const GLfloat* u)const{(this->*(this->m_orig_glEvalCoord1fv))(u);this->m_checkErrors("glEvalCoord1fv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC m_orig_glProgramUniform3ui64vARB = nullptr;
+void m_glProgramUniform3ui64vARB_validation(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glProgramUniform3ui64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform3ui64vARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC m_orig_glProgramUniformMatrix2dv = nullptr;
+void m_glProgramUniformMatrix2dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix2dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2dv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC m_orig_glMultiTexCoord2hvNV = nullptr;
+void m_glMultiTexCoord2hvNV_validation(GLenum target,const GLhalfNV* v)const{(this->*(this->m_orig_glMultiTexCoord2hvNV))(target,v);this->m_checkErrors("glMultiTexCoord2hvNV");}
+FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC m_orig_glGetFloatIndexedvEXT = nullptr;
+void m_glGetFloatIndexedvEXT_validation(GLenum target,GLuint index,GLfloat* data)const{(this->*(this->m_orig_glGetFloatIndexedvEXT))(target,index,data);this->m_checkErrors("glGetFloatIndexedvEXT");}
+FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC m_orig_glSampleCoverageARB = nullptr;
+void m_glSampleCoverageARB_validation(GLfloat value,GLboolean invert)const{(this->*(this->m_orig_glSampleCoverageARB))(value,invert);this->m_checkErrors("glSampleCoverageARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC m_orig_glProgramUniform2ui64vARB = nullptr;
+void m_glProgramUniform2ui64vARB_validation(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glProgramUniform2ui64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform2ui64vARB");}
+FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC m_orig_glPixelDataRangeNV = nullptr;
+void m_glPixelDataRangeNV_validation(GLenum target,GLsizei length,const void* pointer)const{(this->*(this->m_orig_glPixelDataRangeNV))(target,length,pointer);this->m_checkErrors("glPixelDataRangeNV");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC m_orig_glVertexStream3svATI = nullptr;
+void m_glVertexStream3svATI_validation(GLenum stream,const GLshort* coords)const{(this->*(this->m_orig_glVertexStream3svATI))(stream,coords);this->m_checkErrors("glVertexStream3svATI");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_validation(const GLuint* rc,const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN))(rc,tc,n,v);this->m_checkErrors("glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC m_orig_glTexCoord3hvNV = nullptr;
+void m_glTexCoord3hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glTexCoord3hvNV))(v);this->m_checkErrors("glTexCoord3hvNV");}
+FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC m_orig_glSampleMaski = nullptr;
+void m_glSampleMaski_validation(GLuint maskNumber,GLbitfield mask)const{(this->*(this->m_orig_glSampleMaski))(maskNumber,mask);this->m_checkErrors("glSampleMaski");}
+FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC m_orig_glIndexFuncEXT = nullptr;
+void m_glIndexFuncEXT_validation(GLenum func,GLclampf ref)const{(this->*(this->m_orig_glIndexFuncEXT))(func,ref);this->m_checkErrors("glIndexFuncEXT");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC m_orig_glPointParameteriNV = nullptr;
+void m_glPointParameteriNV_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glPointParameteriNV))(pname,param);this->m_checkErrors("glPointParameteriNV");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC m_orig_glUniformMatrix3x2fv = nullptr;
+void m_glUniformMatrix3x2fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix3x2fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3x2fv");}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC m_orig_glGetFramebufferParameterivEXT = nullptr;
+void m_glGetFramebufferParameterivEXT_validation(GLuint framebuffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFramebufferParameterivEXT))(framebuffer,pname,params);this->m_checkErrors("glGetFramebufferParameterivEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC m_orig_glUniform2i64ARB = nullptr;
+void m_glUniform2i64ARB_validation(GLint location,GLint64 x,GLint64 y)const{(this->*(this->m_orig_glUniform2i64ARB))(location,x,y);this->m_checkErrors("glUniform2i64ARB");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC m_orig_glNamedBufferStorageEXT = nullptr;
+void m_glNamedBufferStorageEXT_validation(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{(this->*(this->m_orig_glNamedBufferStorageEXT))(buffer,size,data,flags);this->m_checkErrors("glNamedBufferStorageEXT");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC m_orig_glNamedFramebufferTexture3DEXT = nullptr;
+void m_glNamedFramebufferTexture3DEXT_validation(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{(this->*(this->m_orig_glNamedFramebufferTexture3DEXT))(framebuffer,attachment,textarget,texture,level,zoffset);this->m_checkErrors("glNamedFramebufferTexture3DEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC m_orig_glVertexAttrib2dv = nullptr;
+void m_glVertexAttrib2dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib2dv))(index,v);this->m_checkErrors("glVertexAttrib2dv");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC m_orig_glGetVertexArrayPointervEXT = nullptr;
+void m_glGetVertexArrayPointervEXT_validation(GLuint vaobj,GLenum pname,void** param)const{(this->*(this->m_orig_glGetVertexArrayPointervEXT))(vaobj,pname,param);this->m_checkErrors("glGetVertexArrayPointervEXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC m_orig_glGetVertexAttribArrayObjectivATI = nullptr;
+void m_glGetVertexAttribArrayObjectivATI_validation(GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVertexAttribArrayObjectivATI))(index,pname,params);this->m_checkErrors("glGetVertexAttribArrayObjectivATI");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC m_orig_glProgramUniformMatrix3fvEXT = nullptr;
+void m_glProgramUniformMatrix3fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix3fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3fvEXT");}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC m_orig_glEnableVertexArrayEXT = nullptr;
+void m_glEnableVertexArrayEXT_validation(GLuint vaobj,GLenum array)const{(this->*(this->m_orig_glEnableVertexArrayEXT))(vaobj,array);this->m_checkErrors("glEnableVertexArrayEXT");}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC m_orig_glColorTableParameterfvSGI = nullptr;
+void m_glColorTableParameterfvSGI_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glColorTableParameterfvSGI))(target,pname,params);this->m_checkErrors("glColorTableParameterfvSGI");}
+FunctionTable::MEMBERPFNGLEDGEFLAGPROC m_orig_glEdgeFlag = nullptr;
+void m_glEdgeFlag_validation(GLboolean flag)const{(this->*(this->m_orig_glEdgeFlag))(flag);this->m_checkErrors("glEdgeFlag");}
+FunctionTable::MEMBERPFNGLFOGCOORDFPROC m_orig_glFogCoordf = nullptr;
+void m_glFogCoordf_validation(GLfloat coord)const{(this->*(this->m_orig_glFogCoordf))(coord);this->m_checkErrors("glFogCoordf");}
+FunctionTable::MEMBERPFNGLVERTEX3DPROC m_orig_glVertex3d = nullptr;
+void m_glVertex3d_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertex3d))(x,y,z);this->m_checkErrors("glVertex3d");}
+FunctionTable::MEMBERPFNGLVERTEX3FPROC m_orig_glVertex3f = nullptr;
+void m_glVertex3f_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glVertex3f))(x,y,z);this->m_checkErrors("glVertex3f");}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC m_orig_glSpriteParameterivSGIX = nullptr;
+void m_glSpriteParameterivSGIX_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glSpriteParameterivSGIX))(pname,params);this->m_checkErrors("glSpriteParameterivSGIX");}
+FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC m_orig_glPathGlyphRangeNV = nullptr;
+void m_glPathGlyphRangeNV_validation(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyph,GLsizei numGlyphs,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{(this->*(this->m_orig_glPathGlyphRangeNV))(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);this->m_checkErrors("glPathGlyphRangeNV");}
+FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC m_orig_glPrimitiveBoundingBoxARB = nullptr;
+void m_glPrimitiveBoundingBoxARB_validation(GLfloat minX,GLfloat minY,GLfloat minZ,GLfloat minW,GLfloat maxX,GLfloat maxY,GLfloat maxZ,GLfloat maxW)const{(this->*(this->m_orig_glPrimitiveBoundingBoxARB))(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);this->m_checkErrors("glPrimitiveBoundingBoxARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC m_orig_glVertexAttribL3ui64vNV = nullptr;
+void m_glVertexAttribL3ui64vNV_validation(GLuint index,const GLuint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL3ui64vNV))(index,v);this->m_checkErrors("glVertexAttribL3ui64vNV");}
+FunctionTable::MEMBERPFNGLVERTEX3SPROC m_orig_glVertex3s = nullptr;
+void m_glVertex3s_validation(GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glVertex3s))(x,y,z);this->m_checkErrors("glVertex3s");}
+FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC m_orig_glTexCoordP2ui = nullptr;
+void m_glTexCoordP2ui_validation(GLenum type,GLuint coords)const{(this->*(this->m_orig_glTexCoordP2ui))(type,coords);this->m_checkErrors("glTexCoordP2ui");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC m_orig_glProgramUniform2fvEXT = nullptr;
+void m_glProgramUniform2fvEXT_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform2fvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform2fvEXT");}
+FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC m_orig_glDeletePathsNV = nullptr;
+void m_glDeletePathsNV_validation(GLuint path,GLsizei range)const{(this->*(this->m_orig_glDeletePathsNV))(path,range);this->m_checkErrors("glDeletePathsNV");}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC m_orig_glPrimitiveRestartIndexNV = nullptr;
+void m_glPrimitiveRestartIndexNV_validation(GLuint index)const{(this->*(this->m_orig_glPrimitiveRestartIndexNV))(index);this->m_checkErrors("glPrimitiveRestartIndexNV");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC m_orig_glTexCoord2fColor3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor3fVertex3fvSUN_validation(const GLfloat* tc,const GLfloat* c,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord2fColor3fVertex3fvSUN))(tc,c,v);this->m_checkErrors("glTexCoord2fColor3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC m_orig_glTexCoordPointerListIBM = nullptr;
+void m_glTexCoordPointerListIBM_validation(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glTexCoordPointerListIBM))(size,type,stride,pointer,ptrstride);this->m_checkErrors("glTexCoordPointerListIBM");}
+FunctionTable::MEMBERPFNGLRECTXOESPROC m_orig_glRectxOES = nullptr;
+void m_glRectxOES_validation(GLfixed x1,GLfixed y1,GLfixed x2,GLfixed y2)const{(this->*(this->m_orig_glRectxOES))(x1,y1,x2,y2);this->m_checkErrors("glRectxOES");}
+FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC m_orig_glCopyNamedBufferSubData = nullptr;
+void m_glCopyNamedBufferSubData_validation(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{(this->*(this->m_orig_glCopyNamedBufferSubData))(readBuffer,writeBuffer,readOffset,writeOffset,size);this->m_checkErrors("glCopyNamedBufferSubData");}
+FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC m_orig_glGenProgramsNV = nullptr;
+void m_glGenProgramsNV_validation(GLsizei n,GLuint* programs)const{(this->*(this->m_orig_glGenProgramsNV))(n,programs);this->m_checkErrors("glGenProgramsNV");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC m_orig_glFragmentLightfSGIX = nullptr;
+void m_glFragmentLightfSGIX_validation(GLenum light,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glFragmentLightfSGIX))(light,pname,param);this->m_checkErrors("glFragmentLightfSGIX");}
+FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC m_orig_glTexStorage3D = nullptr;
+void m_glTexStorage3D_validation(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{(this->*(this->m_orig_glTexStorage3D))(target,levels,internalformat,width,height,depth);this->m_checkErrors("glTexStorage3D");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC m_orig_glTextureParameteriv = nullptr;
+void m_glTextureParameteriv_validation(GLuint texture,GLenum pname,const GLint* param)const{(this->*(this->m_orig_glTextureParameteriv))(texture,pname,param);this->m_checkErrors("glTextureParameteriv");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC m_orig_glNamedBufferDataEXT = nullptr;
+void m_glNamedBufferDataEXT_validation(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{(this->*(this->m_orig_glNamedBufferDataEXT))(buffer,size,data,usage);this->m_checkErrors("glNamedBufferDataEXT");}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC m_orig_glImportSemaphoreWin32NameEXT = nullptr;
+void m_glImportSemaphoreWin32NameEXT_validation(GLuint semaphore,GLenum handleType,const void* name)const{(this->*(this->m_orig_glImportSemaphoreWin32NameEXT))(semaphore,handleType,name);this->m_checkErrors("glImportSemaphoreWin32NameEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC m_orig_glMultiTexCoord3fvARB = nullptr;
+void m_glMultiTexCoord3fvARB_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord3fvARB))(target,v);this->m_checkErrors("glMultiTexCoord3fvARB");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC m_orig_glUniformMatrix3x4fv = nullptr;
+void m_glUniformMatrix3x4fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix3x4fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3x4fv");}
+FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC m_orig_glSubpixelPrecisionBiasNV = nullptr;
+void m_glSubpixelPrecisionBiasNV_validation(GLuint xbits,GLuint ybits)const{(this->*(this->m_orig_glSubpixelPrecisionBiasNV))(xbits,ybits);this->m_checkErrors("glSubpixelPrecisionBiasNV");}
+FunctionTable::MEMBERPFNGLNORMALPOINTERPROC m_orig_glNormalPointer = nullptr;
+void m_glNormalPointer_validation(GLenum type,GLsizei stride,const GLvoid* ptr)const{(this->*(this->m_orig_glNormalPointer))(type,stride,ptr);this->m_checkErrors("glNormalPointer");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC m_orig_glNamedFramebufferTexture = nullptr;
+void m_glNamedFramebufferTexture_validation(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{(this->*(this->m_orig_glNamedFramebufferTexture))(framebuffer,attachment,texture,level);this->m_checkErrors("glNamedFramebufferTexture");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC m_orig_glVertexAttrib4NsvARB = nullptr;
+void m_glVertexAttrib4NsvARB_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib4NsvARB))(index,v);this->m_checkErrors("glVertexAttrib4NsvARB");}
+FunctionTable::MEMBERPFNGLPASSTHROUGHPROC m_orig_glPassThrough = nullptr;
+void m_glPassThrough_validation(GLfloat token)const{(this->*(this->m_orig_glPassThrough))(token);this->m_checkErrors("glPassThrough");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC m_orig_glSecondaryColorP3ui = nullptr;
+void m_glSecondaryColorP3ui_validation(GLenum type,GLuint color)const{(this->*(this->m_orig_glSecondaryColorP3ui))(type,color);this->m_checkErrors("glSecondaryColorP3ui");}
+FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC m_orig_glInvalidateTexSubImage = nullptr;
+void m_glInvalidateTexSubImage_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth)const{(this->*(this->m_orig_glInvalidateTexSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth);this->m_checkErrors("glInvalidateTexSubImage");}
+FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC m_orig_glIsImageHandleResidentARB = nullptr;
+GLboolean m_glIsImageHandleResidentARB_validation(GLuint64 handle)const{GLboolean const result = (this->*(this->m_orig_glIsImageHandleResidentARB))(handle);this->m_checkErrors("glIsImageHandleResidentARB");return result;}
+FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC m_orig_glTangent3fvEXT = nullptr;
+void m_glTangent3fvEXT_validation(const GLfloat* v)const{(this->*(this->m_orig_glTangent3fvEXT))(v);this->m_checkErrors("glTangent3fvEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC m_orig_glProgramUniformMatrix4x3fv = nullptr;
+void m_glProgramUniformMatrix4x3fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x3fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x3fv");}
+FunctionTable::MEMBERPFNGLBEGINPROC m_orig_glBegin = nullptr;
+void m_glBegin_validation(GLenum mode)const{(this->*(this->m_orig_glBegin))(mode);this->m_checkErrors("glBegin");}
+FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC m_orig_glEvalCoord2dv = nullptr;
+void m_glEvalCoord2dv_validation(const GLdouble* u)const{(this->*(this->m_orig_glEvalCoord2dv))(u);this->m_checkErrors("glEvalCoord2dv");}
+FunctionTable::MEMBERPFNGLCOLOR3UBVPROC m_orig_glColor3ubv = nullptr;
+void m_glColor3ubv_validation(const GLubyte* v)const{(this->*(this->m_orig_glColor3ubv))(v);this->m_checkErrors("glColor3ubv");}
+FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC m_orig_glFogCoordfvEXT = nullptr;
+void m_glFogCoordfvEXT_validation(const GLfloat* coord)const{(this->*(this->m_orig_glFogCoordfvEXT))(coord);this->m_checkErrors("glFogCoordfvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXP3UIPROC m_orig_glVertexP3ui = nullptr;
+void m_glVertexP3ui_validation(GLenum type,GLuint value)const{(this->*(this->m_orig_glVertexP3ui))(type,value);this->m_checkErrors("glVertexP3ui");}
+FunctionTable::MEMBERPFNGLLIGHTFVPROC m_orig_glLightfv = nullptr;
+void m_glLightfv_validation(GLenum light,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glLightfv))(light,pname,params);this->m_checkErrors("glLightfv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC m_orig_glVertexAttribL3i64NV = nullptr;
+void m_glVertexAttribL3i64NV_validation(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{(this->*(this->m_orig_glVertexAttribL3i64NV))(index,x,y,z);this->m_checkErrors("glVertexAttribL3i64NV");}
+FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC m_orig_glStencilClearTagEXT = nullptr;
+void m_glStencilClearTagEXT_validation(GLsizei stencilTagBits,GLuint stencilClearTag)const{(this->*(this->m_orig_glStencilClearTagEXT))(stencilTagBits,stencilClearTag);this->m_checkErrors("glStencilClearTagEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC m_orig_glGetActiveUniformName = nullptr;
+void m_glGetActiveUniformName_validation(GLuint program,GLuint uniformIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformName)const{(this->*(this->m_orig_glGetActiveUniformName))(program,uniformIndex,bufSize,length,uniformName);this->m_checkErrors("glGetActiveUniformName");}
+FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC m_orig_glTangentPointerEXT = nullptr;
+void m_glTangentPointerEXT_validation(GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glTangentPointerEXT))(type,stride,pointer);this->m_checkErrors("glTangentPointerEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC m_orig_glUniform4ui64vNV = nullptr;
+void m_glUniform4ui64vNV_validation(GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glUniform4ui64vNV))(location,count,value);this->m_checkErrors("glUniform4ui64vNV");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC m_orig_glDebugMessageEnableAMD = nullptr;
+void m_glDebugMessageEnableAMD_validation(GLenum category,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{(this->*(this->m_orig_glDebugMessageEnableAMD))(category,severity,count,ids,enabled);this->m_checkErrors("glDebugMessageEnableAMD");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC m_orig_glProgramUniform2ui = nullptr;
+void m_glProgramUniform2ui_validation(GLuint program,GLint location,GLuint v0,GLuint v1)const{(this->*(this->m_orig_glProgramUniform2ui))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2ui");}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC m_orig_glCopyTexSubImage2DEXT = nullptr;
+void m_glCopyTexSubImage2DEXT_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTexSubImage2DEXT))(target,level,xoffset,yoffset,x,y,width,height);this->m_checkErrors("glCopyTexSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC m_orig_glGenRenderbuffersEXT = nullptr;
+void m_glGenRenderbuffersEXT_validation(GLsizei n,GLuint* renderbuffers)const{(this->*(this->m_orig_glGenRenderbuffersEXT))(n,renderbuffers);this->m_checkErrors("glGenRenderbuffersEXT");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC m_orig_glNamedProgramLocalParameterI4ivEXT = nullptr;
+void m_glNamedProgramLocalParameterI4ivEXT_validation(GLuint program,GLenum target,GLuint index,const GLint* params)const{(this->*(this->m_orig_glNamedProgramLocalParameterI4ivEXT))(program,target,index,params);this->m_checkErrors("glNamedProgramLocalParameterI4ivEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC m_orig_glMultiTexCoord2f = nullptr;
+void m_glMultiTexCoord2f_validation(GLenum target,GLfloat s,GLfloat t)const{(this->*(this->m_orig_glMultiTexCoord2f))(target,s,t);this->m_checkErrors("glMultiTexCoord2f");}
+FunctionTable::MEMBERPFNGLMAPGRID2DPROC m_orig_glMapGrid2d = nullptr;
+void m_glMapGrid2d_validation(GLint un,GLdouble u1,GLdouble u2,GLint vn,GLdouble v1,GLdouble v2)const{(this->*(this->m_orig_glMapGrid2d))(un,u1,u2,vn,v1,v2);this->m_checkErrors("glMapGrid2d");}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC m_orig_glGetMultiTexParameterIuivEXT = nullptr;
+void m_glGetMultiTexParameterIuivEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetMultiTexParameterIuivEXT))(texunit,target,pname,params);this->m_checkErrors("glGetMultiTexParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC m_orig_glBlendEquationiARB = nullptr;
+void m_glBlendEquationiARB_validation(GLuint buf,GLenum mode)const{(this->*(this->m_orig_glBlendEquationiARB))(buf,mode);this->m_checkErrors("glBlendEquationiARB");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC m_orig_glTexParameteriv = nullptr;
+void m_glTexParameteriv_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTexParameteriv))(target,pname,params);this->m_checkErrors("glTexParameteriv");}
+FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC m_orig_glUniform4ivARB = nullptr;
+void m_glUniform4ivARB_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform4ivARB))(location,count,value);this->m_checkErrors("glUniform4ivARB");}
+FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC m_orig_glMatrixOrthoEXT = nullptr;
+void m_glMatrixOrthoEXT_validation(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{(this->*(this->m_orig_glMatrixOrthoEXT))(mode,left,right,bottom,top,zNear,zFar);this->m_checkErrors("glMatrixOrthoEXT");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC m_orig_glVertexArrayVertexBuffer = nullptr;
+void m_glVertexArrayVertexBuffer_validation(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{(this->*(this->m_orig_glVertexArrayVertexBuffer))(vaobj,bindingindex,buffer,offset,stride);this->m_checkErrors("glVertexArrayVertexBuffer");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC m_orig_glProgramLocalParametersI4ivNV = nullptr;
+void m_glProgramLocalParametersI4ivNV_validation(GLenum target,GLuint index,GLsizei count,const GLint* params)const{(this->*(this->m_orig_glProgramLocalParametersI4ivNV))(target,index,count,params);this->m_checkErrors("glProgramLocalParametersI4ivNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC m_orig_glProgramUniform4ui64vNV = nullptr;
+void m_glProgramUniform4ui64vNV_validation(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glProgramUniform4ui64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform4ui64vNV");}
+FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC m_orig_glGetNamedStringivARB = nullptr;
+void m_glGetNamedStringivARB_validation(GLint namelen,const GLchar* name,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedStringivARB))(namelen,name,pname,params);this->m_checkErrors("glGetNamedStringivARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC m_orig_glVertexAttribL1i64vNV = nullptr;
+void m_glVertexAttribL1i64vNV_validation(GLuint index,const GLint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL1i64vNV))(index,v);this->m_checkErrors("glVertexAttribL1i64vNV");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC m_orig_glTransformFeedbackBufferBase = nullptr;
+void m_glTransformFeedbackBufferBase_validation(GLuint xfb,GLuint index,GLuint buffer)const{(this->*(this->m_orig_glTransformFeedbackBufferBase))(xfb,index,buffer);this->m_checkErrors("glTransformFeedbackBufferBase");}
+FunctionTable::MEMBERPFNGLINDEXSVPROC m_orig_glIndexsv = nullptr;
+void m_glIndexsv_validation(const GLshort* c)const{(this->*(this->m_orig_glIndexsv))(c);this->m_checkErrors("glIndexsv");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC m_orig_glPointParameterivNV = nullptr;
+void m_glPointParameterivNV_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glPointParameterivNV))(pname,params);this->m_checkErrors("glPointParameterivNV");}
+FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC m_orig_glGetDetailTexFuncSGIS = nullptr;
+void m_glGetDetailTexFuncSGIS_validation(GLenum target,GLfloat* points)const{(this->*(this->m_orig_glGetDetailTexFuncSGIS))(target,points);this->m_checkErrors("glGetDetailTexFuncSGIS");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiColor3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor3fVertex3fvSUN_validation(const GLuint* rc,const GLfloat* c,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiColor3fVertex3fvSUN))(rc,c,v);this->m_checkErrors("glReplacementCodeuiColor3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC m_orig_glProgramLocalParameter4fARB = nullptr;
+void m_glProgramLocalParameter4fARB_validation(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glProgramLocalParameter4fARB))(target,index,x,y,z,w);this->m_checkErrors("glProgramLocalParameter4fARB");}
+FunctionTable::MEMBERPFNGLBITMAPPROC m_orig_glBitmap = nullptr;
+void m_glBitmap_validation(GLsizei width,GLsizei height,GLfloat xorig,GLfloat yorig,GLfloat xmove,GLfloat ymove,const GLubyte* bitmap)const{(this->*(this->m_orig_glBitmap))(width,height,xorig,yorig,xmove,ymove,bitmap);this->m_checkErrors("glBitmap");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC m_orig_glNamedFramebufferTextureLayerEXT = nullptr;
+void m_glNamedFramebufferTextureLayerEXT_validation(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{(this->*(this->m_orig_glNamedFramebufferTextureLayerEXT))(framebuffer,attachment,texture,level,layer);this->m_checkErrors("glNamedFramebufferTextureLayerEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC m_orig_glMultiTexGenfvEXT = nullptr;
+void m_glMultiTexGenfvEXT_validation(GLenum texunit,GLenum coord,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glMultiTexGenfvEXT))(texunit,coord,pname,params);this->m_checkErrors("glMultiTexGenfvEXT");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC m_orig_glGetNamedBufferSubData = nullptr;
+void m_glGetNamedBufferSubData_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{(this->*(this->m_orig_glGetNamedBufferSubData))(buffer,offset,size,data);this->m_checkErrors("glGetNamedBufferSubData");}
+FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC m_orig_glStencilFuncSeparateATI = nullptr;
+void m_glStencilFuncSeparateATI_validation(GLenum frontfunc,GLenum backfunc,GLint ref,GLuint mask)const{(this->*(this->m_orig_glStencilFuncSeparateATI))(frontfunc,backfunc,ref,mask);this->m_checkErrors("glStencilFuncSeparateATI");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC m_orig_glProgramUniform2iv = nullptr;
+void m_glProgramUniform2iv_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform2iv))(program,location,count,value);this->m_checkErrors("glProgramUniform2iv");}
+FunctionTable::MEMBERPFNGLGETQUERYIVPROC m_orig_glGetQueryiv = nullptr;
+void m_glGetQueryiv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetQueryiv))(target,pname,params);this->m_checkErrors("glGetQueryiv");}
+FunctionTable::MEMBERPFNGLTEXCOORD4FPROC m_orig_glTexCoord4f = nullptr;
+void m_glTexCoord4f_validation(GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{(this->*(this->m_orig_glTexCoord4f))(s,t,r,q);this->m_checkErrors("glTexCoord4f");}
+FunctionTable::MEMBERPFNGLMAPGRID2FPROC m_orig_glMapGrid2f = nullptr;
+void m_glMapGrid2f_validation(GLint un,GLfloat u1,GLfloat u2,GLint vn,GLfloat v1,GLfloat v2)const{(this->*(this->m_orig_glMapGrid2f))(un,u1,u2,vn,v1,v2);this->m_checkErrors("glMapGrid2f");}
+FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC m_orig_glListParameterivSGIX = nullptr;
+void m_glListParameterivSGIX_validation(GLuint list,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glListParameterivSGIX))(list,pname,params);this->m_checkErrors("glListParameterivSGIX");}
+FunctionTable::MEMBERPFNGLCREATEQUERIESPROC m_orig_glCreateQueries = nullptr;
+void m_glCreateQueries_validation(GLenum target,GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glCreateQueries))(target,n,ids);this->m_checkErrors("glCreateQueries");}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC m_orig_glGetSamplerParameterfv = nullptr;
+void m_glGetSamplerParameterfv_validation(GLuint sampler,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetSamplerParameterfv))(sampler,pname,params);this->m_checkErrors("glGetSamplerParameterfv");}
+FunctionTable::MEMBERPFNGLTEXCOORD4IPROC m_orig_glTexCoord4i = nullptr;
+void m_glTexCoord4i_validation(GLint s,GLint t,GLint r,GLint q)const{(this->*(this->m_orig_glTexCoord4i))(s,t,r,q);this->m_checkErrors("glTexCoord4i");}
+FunctionTable::MEMBERPFNGLOBJECTLABELPROC m_orig_glObjectLabel = nullptr;
+void m_glObjectLabel_validation(GLenum identifier,GLuint name,GLsizei length,const GLchar* label)const{(this->*(this->m_orig_glObjectLabel))(identifier,name,length,label);this->m_checkErrors("glObjectLabel");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC m_orig_glProgramUniform3i64NV = nullptr;
+void m_glProgramUniform3i64NV_validation(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{(this->*(this->m_orig_glProgramUniform3i64NV))(program,location,x,y,z);this->m_checkErrors("glProgramUniform3i64NV");}
+FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC m_orig_glGetTextureHandleARB = nullptr;
+GLuint64 m_glGetTextureHandleARB_validation(GLuint texture)const{GLuint64 const result = (this->*(this->m_orig_glGetTextureHandleARB))(texture);this->m_checkErrors("glGetTextureHandleARB");return result;}
+FunctionTable::MEMBERPFNGLTEXCOORD4SPROC m_orig_glTexCoord4s = nullptr;
+void m_glTexCoord4s_validation(GLshort s,GLshort t,GLshort r,GLshort q)const{(this->*(this->m_orig_glTexCoord4s))(s,t,r,q);this->m_checkErrors("glTexCoord4s");}
+FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC m_orig_glUniform4iARB = nullptr;
+void m_glUniform4iARB_validation(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{(this->*(this->m_orig_glUniform4iARB))(location,v0,v1,v2,v3);this->m_checkErrors("glUniform4iARB");}
+FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC m_orig_glGetUniformIndices = nullptr;
+void m_glGetUniformIndices_validation(GLuint program,GLsizei uniformCount,const GLchar*const* uniformNames,GLuint* uniformIndices)const{(this->*(this->m_orig_glGetUniformIndices))(program,uniformCount,uniformNames,uniformIndices);this->m_checkErrors("glGetUniformIndices");}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC m_orig_glMultiTexImage3DEXT = nullptr;
+void m_glMultiTexImage3DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glMultiTexImage3DEXT))(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);this->m_checkErrors("glMultiTexImage3DEXT");}
+FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC m_orig_glCoverageModulationTableNV = nullptr;
+void m_glCoverageModulationTableNV_validation(GLsizei n,const GLfloat* v)const{(this->*(this->m_orig_glCoverageModulationTableNV))(n,v);this->m_checkErrors("glCoverageModulationTableNV");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC m_orig_glPointParameteriv = nullptr;
+void m_glPointParameteriv_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glPointParameteriv))(pname,params);this->m_checkErrors("glPointParameteriv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC m_orig_glMultiTexCoord4svARB = nullptr;
+void m_glMultiTexCoord4svARB_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord4svARB))(target,v);this->m_checkErrors("glMultiTexCoord4svARB");}
+FunctionTable::MEMBERPFNGLNORMAL3FVPROC m_orig_glNormal3fv = nullptr;
+void m_glNormal3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glNormal3fv))(v);this->m_checkErrors("glNormal3fv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC m_orig_glProgramUniformMatrix3x4dvEXT = nullptr;
+void m_glProgramUniformMatrix3x4dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x4dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x4dvEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC m_orig_glTexCoord1fv = nullptr;
+void m_glTexCoord1fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glTexCoord1fv))(v);this->m_checkErrors("glTexCoord1fv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC m_orig_glProgramUniformMatrix4x3dvEXT = nullptr;
+void m_glProgramUniformMatrix4x3dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x3dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x3dvEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC m_orig_glGetActiveVaryingNV = nullptr;
+void m_glGetActiveVaryingNV_validation(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{(this->*(this->m_orig_glGetActiveVaryingNV))(program,index,bufSize,length,size,type,name);this->m_checkErrors("glGetActiveVaryingNV");}
+FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC m_orig_glUniform1i64vARB = nullptr;
+void m_glUniform1i64vARB_validation(GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glUniform1i64vARB))(location,count,value);this->m_checkErrors("glUniform1i64vARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC m_orig_glMultiTexCoord1dv = nullptr;
+void m_glMultiTexCoord1dv_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord1dv))(target,v);this->m_checkErrors("glMultiTexCoord1dv");}
+FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC m_orig_glTexCoord3fv = nullptr;
+void m_glTexCoord3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glTexCoord3fv))(v);this->m_checkErrors("glTexCoord3fv");}
+FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC m_orig_glMatrixTranslatefEXT = nullptr;
+void m_glMatrixTranslatefEXT_validation(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glMatrixTranslatefEXT))(mode,x,y,z);this->m_checkErrors("glMatrixTranslatefEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC m_orig_glProgramUniform1ui64vNV = nullptr;
+void m_glProgramUniform1ui64vNV_validation(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glProgramUniform1ui64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform1ui64vNV");}
+FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC m_orig_glTextureMaterialEXT = nullptr;
+void m_glTextureMaterialEXT_validation(GLenum face,GLenum mode)const{(this->*(this->m_orig_glTextureMaterialEXT))(face,mode);this->m_checkErrors("glTextureMaterialEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC m_orig_glMultiTexCoordP3uiv = nullptr;
+void m_glMultiTexCoordP3uiv_validation(GLenum texture,GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glMultiTexCoordP3uiv))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP3uiv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC m_orig_glVertexAttribP3ui = nullptr;
+void m_glVertexAttribP3ui_validation(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{(this->*(this->m_orig_glVertexAttribP3ui))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP3ui");}
+FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC m_orig_glInterpolatePathsNV = nullptr;
+void m_glInterpolatePathsNV_validation(GLuint resultPath,GLuint pathA,GLuint pathB,GLfloat weight)const{(this->*(this->m_orig_glInterpolatePathsNV))(resultPath,pathA,pathB,weight);this->m_checkErrors("glInterpolatePathsNV");}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC m_orig_glTextureBufferRange = nullptr;
+void m_glTextureBufferRange_validation(GLuint texture,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glTextureBufferRange))(texture,internalformat,buffer,offset,size);this->m_checkErrors("glTextureBufferRange");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC m_orig_glVertexAttribL2dEXT = nullptr;
+void m_glVertexAttribL2dEXT_validation(GLuint index,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertexAttribL2dEXT))(index,x,y);this->m_checkErrors("glVertexAttribL2dEXT");}
+FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC m_orig_glGetPixelTransformParameterivEXT = nullptr;
+void m_glGetPixelTransformParameterivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetPixelTransformParameterivEXT))(target,pname,params);this->m_checkErrors("glGetPixelTransformParameterivEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC m_orig_glTexCoord4xvOES = nullptr;
+void m_glTexCoord4xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glTexCoord4xvOES))(coords);this->m_checkErrors("glTexCoord4xvOES");}
+FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC m_orig_glGetVariantBooleanvEXT = nullptr;
+void m_glGetVariantBooleanvEXT_validation(GLuint id,GLenum value,GLboolean* data)const{(this->*(this->m_orig_glGetVariantBooleanvEXT))(id,value,data);this->m_checkErrors("glGetVariantBooleanvEXT");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEPROC m_orig_glDepthRange = nullptr;
+void m_glDepthRange_validation(GLclampd near_val,GLclampd far_val)const{(this->*(this->m_orig_glDepthRange))(near_val,far_val);this->m_checkErrors("glDepthRange");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC m_orig_glGetVertexAttribdvARB = nullptr;
+void m_glGetVertexAttribdvARB_validation(GLuint index,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetVertexAttribdvARB))(index,pname,params);this->m_checkErrors("glGetVertexAttribdvARB");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC m_orig_glGetColorTableParameterfv = nullptr;
+void m_glGetColorTableParameterfv_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetColorTableParameterfv))(target,pname,params);this->m_checkErrors("glGetColorTableParameterfv");}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC m_orig_glDrawArraysInstancedEXT = nullptr;
+void m_glDrawArraysInstancedEXT_validation(GLenum mode,GLint start,GLsizei count,GLsizei primcount)const{(this->*(this->m_orig_glDrawArraysInstancedEXT))(mode,start,count,primcount);this->m_checkErrors("glDrawArraysInstancedEXT");}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC m_orig_glDisableClientStateIndexedEXT = nullptr;
+void m_glDisableClientStateIndexedEXT_validation(GLenum array,GLuint index)const{(this->*(this->m_orig_glDisableClientStateIndexedEXT))(array,index);this->m_checkErrors("glDisableClientStateIndexedEXT");}
+FunctionTable::MEMBERPFNGLDRAWBUFFERPROC m_orig_glDrawBuffer = nullptr;
+void m_glDrawBuffer_validation(GLenum mode)const{(this->*(this->m_orig_glDrawBuffer))(mode);this->m_checkErrors("glDrawBuffer");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC m_orig_glMultiDrawArraysIndirectBindlessNV = nullptr;
+void m_glMultiDrawArraysIndirectBindlessNV_validation(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{(this->*(this->m_orig_glMultiDrawArraysIndirectBindlessNV))(mode,indirect,drawCount,stride,vertexBufferCount);this->m_checkErrors("glMultiDrawArraysIndirectBindlessNV");}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC m_orig_glGetnPixelMapusv = nullptr;
+void m_glGetnPixelMapusv_validation(GLenum map,GLsizei bufSize,GLushort* values)const{(this->*(this->m_orig_glGetnPixelMapusv))(map,bufSize,values);this->m_checkErrors("glGetnPixelMapusv");}
+FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC m_orig_glRasterPos3fv = nullptr;
+void m_glRasterPos3fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glRasterPos3fv))(v);this->m_checkErrors("glRasterPos3fv");}
+FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC m_orig_glClearBufferuiv = nullptr;
+void m_glClearBufferuiv_validation(GLenum buffer,GLint drawbuffer,const GLuint* value)const{(this->*(this->m_orig_glClearBufferuiv))(buffer,drawbuffer,value);this->m_checkErrors("glClearBufferuiv");}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC m_orig_glGetInternalformati64v = nullptr;
+void m_glGetInternalformati64v_validation(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint64* params)const{(this->*(this->m_orig_glGetInternalformati64v))(target,internalformat,pname,bufSize,params);this->m_checkErrors("glGetInternalformati64v");}
+FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC m_orig_glShaderSourceARB = nullptr;
+void m_glShaderSourceARB_validation(GLhandleARB shaderObj,GLsizei count,const GLcharARB** string,const GLint* length)const{(this->*(this->m_orig_glShaderSourceARB))(shaderObj,count,string,length);this->m_checkErrors("glShaderSourceARB");}
+FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC m_orig_glShaderOp3EXT = nullptr;
+void m_glShaderOp3EXT_validation(GLenum op,GLuint res,GLuint arg1,GLuint arg2,GLuint arg3)const{(this->*(this->m_orig_glShaderOp3EXT))(op,res,arg1,arg2,arg3);this->m_checkErrors("glShaderOp3EXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC m_orig_glWindowPos2dvMESA = nullptr;
+void m_glWindowPos2dvMESA_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos2dvMESA))(v);this->m_checkErrors("glWindowPos2dvMESA");}
+FunctionTable::MEMBERPFNGLCLEARINDEXPROC m_orig_glClearIndex = nullptr;
+void m_glClearIndex_validation(GLfloat c)const{(this->*(this->m_orig_glClearIndex))(c);this->m_checkErrors("glClearIndex");}
+FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC m_orig_glProvokingVertexEXT = nullptr;
+void m_glProvokingVertexEXT_validation(GLenum mode)const{(this->*(this->m_orig_glProvokingVertexEXT))(mode);this->m_checkErrors("glProvokingVertexEXT");}
+FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC m_orig_glVariantubvEXT = nullptr;
+void m_glVariantubvEXT_validation(GLuint id,const GLubyte* addr)const{(this->*(this->m_orig_glVariantubvEXT))(id,addr);this->m_checkErrors("glVariantubvEXT");}
+FunctionTable::MEMBERPFNGLFLUSHPROC m_orig_glFlush = nullptr;
+void m_glFlush_validation()const{(this->*(this->m_orig_glFlush))();this->m_checkErrors("glFlush");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC m_orig_glFramebufferTexture2DEXT = nullptr;
+void m_glFramebufferTexture2DEXT_validation(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTexture2DEXT))(target,attachment,textarget,texture,level);this->m_checkErrors("glFramebufferTexture2DEXT");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC m_orig_glGetColorTableParameterivEXT = nullptr;
+void m_glGetColorTableParameterivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetColorTableParameterivEXT))(target,pname,params);this->m_checkErrors("glGetColorTableParameterivEXT");}
+FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC m_orig_glPresentFrameDualFillNV = nullptr;
+void m_glPresentFrameDualFillNV_validation(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLenum target1,GLuint fill1,GLenum target2,GLuint fill2,GLenum target3,GLuint fill3)const{(this->*(this->m_orig_glPresentFrameDualFillNV))(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);this->m_checkErrors("glPresentFrameDualFillNV");}
+FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC m_orig_glGenVertexShadersEXT = nullptr;
+GLuint m_glGenVertexShadersEXT_validation(GLuint range)const{GLuint const result = (this->*(this->m_orig_glGenVertexShadersEXT))(range);this->m_checkErrors("glGenVertexShadersEXT");return result;}
+FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC m_orig_glSpecializeShaderARB = nullptr;
+void m_glSpecializeShaderARB_validation(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{(this->*(this->m_orig_glSpecializeShaderARB))(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);this->m_checkErrors("glSpecializeShaderARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC m_orig_glProgramUniformHandleui64vARB = nullptr;
+void m_glProgramUniformHandleui64vARB_validation(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{(this->*(this->m_orig_glProgramUniformHandleui64vARB))(program,location,count,values);this->m_checkErrors("glProgramUniformHandleui64vARB");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC m_orig_glDepthRangefOES = nullptr;
+void m_glDepthRangefOES_validation(GLclampf n,GLclampf f)const{(this->*(this->m_orig_glDepthRangefOES))(n,f);this->m_checkErrors("glDepthRangefOES");}
+FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC m_orig_glDeleteVertexArrays = nullptr;
+void m_glDeleteVertexArrays_validation(GLsizei n,const GLuint* arrays)const{(this->*(this->m_orig_glDeleteVertexArrays))(n,arrays);this->m_checkErrors("glDeleteVertexArrays");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC m_orig_glDrawElementsInstancedBaseVertexBaseInstance = nullptr;
+void m_glDrawElementsInstancedBaseVertexBaseInstance_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex,GLuint baseinstance)const{(this->*(this->m_orig_glDrawElementsInstancedBaseVertexBaseInstance))(mode,count,type,indices,instancecount,basevertex,baseinstance);this->m_checkErrors("glDrawElementsInstancedBaseVertexBaseInstance");}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC m_orig_glGetTexLevelParameteriv = nullptr;
+void m_glGetTexLevelParameteriv_validation(GLenum target,GLint level,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTexLevelParameteriv))(target,level,pname,params);this->m_checkErrors("glGetTexLevelParameteriv");}
+FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC m_orig_glDrawVkImageNV = nullptr;
+void m_glDrawVkImageNV_validation(GLuint64 vkImage,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{(this->*(this->m_orig_glDrawVkImageNV))(vkImage,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);this->m_checkErrors("glDrawVkImageNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC m_orig_glWindowPos3iARB = nullptr;
+void m_glWindowPos3iARB_validation(GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glWindowPos3iARB))(x,y,z);this->m_checkErrors("glWindowPos3iARB");}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC m_orig_glPrioritizeTextures = nullptr;
+void m_glPrioritizeTextures_validation(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{(this->*(this->m_orig_glPrioritizeTextures))(n,textures,priorities);this->m_checkErrors("glPrioritizeTextures");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC m_orig_glWindowPos3fvMESA = nullptr;
+void m_glWindowPos3fvMESA_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos3fvMESA))(v);this->m_checkErrors("glWindowPos3fvMESA");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC m_orig_glProgramUniformMatrix3x2dvEXT = nullptr;
+void m_glProgramUniformMatrix3x2dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x2dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x2dvEXT");}
+FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC m_orig_glVertex4xvOES = nullptr;
+void m_glVertex4xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glVertex4xvOES))(coords);this->m_checkErrors("glVertex4xvOES");}
+FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC m_orig_glTexStorage3DMultisample = nullptr;
+void m_glTexStorage3DMultisample_validation(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTexStorage3DMultisample))(target,samples,internalformat,width,height,depth,fixedsamplelocations);this->m_checkErrors("glTexStorage3DMultisample");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC m_orig_glWindowPos2sARB = nullptr;
+void m_glWindowPos2sARB_validation(GLshort x,GLshort y)const{(this->*(this->m_orig_glWindowPos2sARB))(x,y);this->m_checkErrors("glWindowPos2sARB");}
+FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC m_orig_glStencilOpValueAMD = nullptr;
+void m_glStencilOpValueAMD_validation(GLenum face,GLuint value)const{(this->*(this->m_orig_glStencilOpValueAMD))(face,value);this->m_checkErrors("glStencilOpValueAMD");}
+FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC m_orig_glProgramVertexLimitNV = nullptr;
+void m_glProgramVertexLimitNV_validation(GLenum target,GLint limit)const{(this->*(this->m_orig_glProgramVertexLimitNV))(target,limit);this->m_checkErrors("glProgramVertexLimitNV");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC m_orig_glGetTexParameterPointervAPPLE = nullptr;
+void m_glGetTexParameterPointervAPPLE_validation(GLenum target,GLenum pname,void** params)const{(this->*(this->m_orig_glGetTexParameterPointervAPPLE))(target,pname,params);this->m_checkErrors("glGetTexParameterPointervAPPLE");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC m_orig_glProgramUniform3uivEXT = nullptr;
+void m_glProgramUniform3uivEXT_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform3uivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform3uivEXT");}
+FunctionTable::MEMBERPFNGLCLAMPCOLORPROC m_orig_glClampColor = nullptr;
+void m_glClampColor_validation(GLenum target,GLenum clamp)const{(this->*(this->m_orig_glClampColor))(target,clamp);this->m_checkErrors("glClampColor");}
+FunctionTable::MEMBERPFNGLCLEARSTENCILPROC m_orig_glClearStencil = nullptr;
+void m_glClearStencil_validation(GLint s)const{(this->*(this->m_orig_glClearStencil))(s);this->m_checkErrors("glClearStencil");}
+FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC m_orig_glTexCoordP1uiv = nullptr;
+void m_glTexCoordP1uiv_validation(GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glTexCoordP1uiv))(type,coords);this->m_checkErrors("glTexCoordP1uiv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC m_orig_glVertexAttribs3svNV = nullptr;
+void m_glVertexAttribs3svNV_validation(GLuint index,GLsizei count,const GLshort* v)const{(this->*(this->m_orig_glVertexAttribs3svNV))(index,count,v);this->m_checkErrors("glVertexAttribs3svNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC m_orig_glMultiTexCoord3fv = nullptr;
+void m_glMultiTexCoord3fv_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord3fv))(target,v);this->m_checkErrors("glMultiTexCoord3fv");}
+FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC m_orig_glVertexBlendEnvfATI = nullptr;
+void m_glVertexBlendEnvfATI_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glVertexBlendEnvfATI))(pname,param);this->m_checkErrors("glVertexBlendEnvfATI");}
+FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC m_orig_glIsFenceAPPLE = nullptr;
+GLboolean m_glIsFenceAPPLE_validation(GLuint fence)const{GLboolean const result = (this->*(this->m_orig_glIsFenceAPPLE))(fence);this->m_checkErrors("glIsFenceAPPLE");return result;}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC m_orig_glGetBufferParameterui64vNV = nullptr;
+void m_glGetBufferParameterui64vNV_validation(GLenum target,GLenum pname,GLuint64EXT* params)const{(this->*(this->m_orig_glGetBufferParameterui64vNV))(target,pname,params);this->m_checkErrors("glGetBufferParameterui64vNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC m_orig_glVertexAttribI4bvEXT = nullptr;
+void m_glVertexAttribI4bvEXT_validation(GLuint index,const GLbyte* v)const{(this->*(this->m_orig_glVertexAttribI4bvEXT))(index,v);this->m_checkErrors("glVertexAttribI4bvEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC m_orig_glUniform2fARB = nullptr;
+void m_glUniform2fARB_validation(GLint location,GLfloat v0,GLfloat v1)const{(this->*(this->m_orig_glUniform2fARB))(location,v0,v1);this->m_checkErrors("glUniform2fARB");}
+FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC m_orig_glStopInstrumentsSGIX = nullptr;
+void m_glStopInstrumentsSGIX_validation(GLint marker)const{(this->*(this->m_orig_glStopInstrumentsSGIX))(marker);this->m_checkErrors("glStopInstrumentsSGIX");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC m_orig_glVertexAttrib3fNV = nullptr;
+void m_glVertexAttrib3fNV_validation(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glVertexAttrib3fNV))(index,x,y,z);this->m_checkErrors("glVertexAttrib3fNV");}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC m_orig_glMapVertexAttrib2dAPPLE = nullptr;
+void m_glMapVertexAttrib2dAPPLE_validation(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{(this->*(this->m_orig_glMapVertexAttrib2dAPPLE))(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->m_checkErrors("glMapVertexAttrib2dAPPLE");}
+FunctionTable::MEMBERPFNGLVERTEX2FPROC m_orig_glVertex2f = nullptr;
+void m_glVertex2f_validation(GLfloat x,GLfloat y)const{(this->*(this->m_orig_glVertex2f))(x,y);this->m_checkErrors("glVertex2f");}
+FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC m_orig_glCopyTextureImage2DEXT = nullptr;
+void m_glCopyTextureImage2DEXT_validation(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{(this->*(this->m_orig_glCopyTextureImage2DEXT))(texture,target,level,internalformat,x,y,width,height,border);this->m_checkErrors("glCopyTextureImage2DEXT");}
+FunctionTable::MEMBERPFNGLVERTEX2DPROC m_orig_glVertex2d = nullptr;
+void m_glVertex2d_validation(GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertex2d))(x,y);this->m_checkErrors("glVertex2d");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC m_orig_glSecondaryColor3bvEXT = nullptr;
+void m_glSecondaryColor3bvEXT_validation(const GLbyte* v)const{(this->*(this->m_orig_glSecondaryColor3bvEXT))(v);this->m_checkErrors("glSecondaryColor3bvEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC m_orig_glMultiTexCoord4fARB = nullptr;
+void m_glMultiTexCoord4fARB_validation(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{(this->*(this->m_orig_glMultiTexCoord4fARB))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4fARB");}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC m_orig_glPolygonOffset = nullptr;
+void m_glPolygonOffset_validation(GLfloat factor,GLfloat units)const{(this->*(this->m_orig_glPolygonOffset))(factor,units);this->m_checkErrors("glPolygonOffset");}
+FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC m_orig_glTangent3bvEXT = nullptr;
+void m_glTangent3bvEXT_validation(const GLbyte* v)const{(this->*(this->m_orig_glTangent3bvEXT))(v);this->m_checkErrors("glTangent3bvEXT");}
+FunctionTable::MEMBERPFNGLHISTOGRAMPROC m_orig_glHistogram = nullptr;
+void m_glHistogram_validation(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{(this->*(this->m_orig_glHistogram))(target,width,internalformat,sink);this->m_checkErrors("glHistogram");}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC m_orig_glGetProgramiv = nullptr;
+void m_glGetProgramiv_validation(GLuint program,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetProgramiv))(program,pname,params);this->m_checkErrors("glGetProgramiv");}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC m_orig_glMatrixIndexubvARB = nullptr;
+void m_glMatrixIndexubvARB_validation(GLint size,const GLubyte* indices)const{(this->*(this->m_orig_glMatrixIndexubvARB))(size,indices);this->m_checkErrors("glMatrixIndexubvARB");}
+FunctionTable::MEMBERPFNGLVERTEX2SPROC m_orig_glVertex2s = nullptr;
+void m_glVertex2s_validation(GLshort x,GLshort y)const{(this->*(this->m_orig_glVertex2s))(x,y);this->m_checkErrors("glVertex2s");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC m_orig_glGetVertexAttribLui64vNV = nullptr;
+void m_glGetVertexAttribLui64vNV_validation(GLuint index,GLenum pname,GLuint64EXT* params)const{(this->*(this->m_orig_glGetVertexAttribLui64vNV))(index,pname,params);this->m_checkErrors("glGetVertexAttribLui64vNV");}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC m_orig_glGetProgramStringARB = nullptr;
+void m_glGetProgramStringARB_validation(GLenum target,GLenum pname,void* string)const{(this->*(this->m_orig_glGetProgramStringARB))(target,pname,string);this->m_checkErrors("glGetProgramStringARB");}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC m_orig_glFlushMappedBufferRange = nullptr;
+void m_glFlushMappedBufferRange_validation(GLenum target,GLintptr offset,GLsizeiptr length)const{(this->*(this->m_orig_glFlushMappedBufferRange))(target,offset,length);this->m_checkErrors("glFlushMappedBufferRange");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC m_orig_glVertexAttribI3uiEXT = nullptr;
+void m_glVertexAttribI3uiEXT_validation(GLuint index,GLuint x,GLuint y,GLuint z)const{(this->*(this->m_orig_glVertexAttribI3uiEXT))(index,x,y,z);this->m_checkErrors("glVertexAttribI3uiEXT");}
+FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC m_orig_glLineWidthxOES = nullptr;
+void m_glLineWidthxOES_validation(GLfixed width)const{(this->*(this->m_orig_glLineWidthxOES))(width);this->m_checkErrors("glLineWidthxOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC m_orig_glProgramUniformMatrix2fvEXT = nullptr;
+void m_glProgramUniformMatrix2fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix2fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2fvEXT");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC m_orig_glGetTextureParameterIuivEXT = nullptr;
+void m_glGetTextureParameterIuivEXT_validation(GLuint texture,GLenum target,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetTextureParameterIuivEXT))(texture,target,pname,params);this->m_checkErrors("glGetTextureParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC m_orig_glGetMultiTexEnvivEXT = nullptr;
+void m_glGetMultiTexEnvivEXT_validation(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMultiTexEnvivEXT))(texunit,target,pname,params);this->m_checkErrors("glGetMultiTexEnvivEXT");}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC m_orig_glPixelTexGenParameterivSGIS = nullptr;
+void m_glPixelTexGenParameterivSGIS_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glPixelTexGenParameterivSGIS))(pname,params);this->m_checkErrors("glPixelTexGenParameterivSGIS");}
+FunctionTable::MEMBERPFNGLGENQUERIESPROC m_orig_glGenQueries = nullptr;
+void m_glGenQueries_validation(GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glGenQueries))(n,ids);this->m_checkErrors("glGenQueries");}
+FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC m_orig_glGetPixelMapfv = nullptr;
+void m_glGetPixelMapfv_validation(GLenum map,GLfloat* values)const{(this->*(this->m_orig_glGetPixelMapfv))(map,values);this->m_checkErrors("glGetPixelMapfv");}
+FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC m_orig_glBlendColorEXT = nullptr;
+void m_glBlendColorEXT_validation(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{(this->*(this->m_orig_glBlendColorEXT))(red,green,blue,alpha);this->m_checkErrors("glBlendColorEXT");}
+FunctionTable::MEMBERPFNGLRESETMINMAXPROC m_orig_glResetMinmax = nullptr;
+void m_glResetMinmax_validation(GLenum target)const{(this->*(this->m_orig_glResetMinmax))(target);this->m_checkErrors("glResetMinmax");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC m_orig_glGetnUniformivARB = nullptr;
+void m_glGetnUniformivARB_validation(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{(this->*(this->m_orig_glGetnUniformivARB))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformivARB");}
+FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC m_orig_glVertexBlendARB = nullptr;
+void m_glVertexBlendARB_validation(GLint count)const{(this->*(this->m_orig_glVertexBlendARB))(count);this->m_checkErrors("glVertexBlendARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC m_orig_glVertexAttrib4d = nullptr;
+void m_glVertexAttrib4d_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertexAttrib4d))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4d");}
+FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC m_orig_glGetVaryingLocationNV = nullptr;
+GLint m_glGetVaryingLocationNV_validation(GLuint program,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetVaryingLocationNV))(program,name);this->m_checkErrors("glGetVaryingLocationNV");return result;}
+FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC m_orig_glGetMapAttribParameterivNV = nullptr;
+void m_glGetMapAttribParameterivNV_validation(GLenum target,GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMapAttribParameterivNV))(target,index,pname,params);this->m_checkErrors("glGetMapAttribParameterivNV");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC m_orig_glTexSubImage3D = nullptr;
+void m_glTexSubImage3D_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glTexSubImage3D))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->m_checkErrors("glTexSubImage3D");}
+FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC m_orig_glDeleteSamplers = nullptr;
+void m_glDeleteSamplers_validation(GLsizei count,const GLuint* samplers)const{(this->*(this->m_orig_glDeleteSamplers))(count,samplers);this->m_checkErrors("glDeleteSamplers");}
+FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC m_orig_glGetLightxOES = nullptr;
+void m_glGetLightxOES_validation(GLenum light,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetLightxOES))(light,pname,params);this->m_checkErrors("glGetLightxOES");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC m_orig_glGetVertexAttribArrayObjectfvATI = nullptr;
+void m_glGetVertexAttribArrayObjectfvATI_validation(GLuint index,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetVertexAttribArrayObjectfvATI))(index,pname,params);this->m_checkErrors("glGetVertexAttribArrayObjectfvATI");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC m_orig_glVertexArrayNormalOffsetEXT = nullptr;
+void m_glVertexArrayNormalOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayNormalOffsetEXT))(vaobj,buffer,type,stride,offset);this->m_checkErrors("glVertexArrayNormalOffsetEXT");}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC m_orig_glGetBufferParameterivARB = nullptr;
+void m_glGetBufferParameterivARB_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetBufferParameterivARB))(target,pname,params);this->m_checkErrors("glGetBufferParameterivARB");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC m_orig_glGetTextureParameterfv = nullptr;
+void m_glGetTextureParameterfv_validation(GLuint texture,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTextureParameterfv))(texture,pname,params);this->m_checkErrors("glGetTextureParameterfv");}
+FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC m_orig_glDrawMeshArraysSUN = nullptr;
+void m_glDrawMeshArraysSUN_validation(GLenum mode,GLint first,GLsizei count,GLsizei width)const{(this->*(this->m_orig_glDrawMeshArraysSUN))(mode,first,count,width);this->m_checkErrors("glDrawMeshArraysSUN");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC m_orig_glVertexAttrib4dNV = nullptr;
+void m_glVertexAttrib4dNV_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertexAttrib4dNV))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4dNV");}
+FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC m_orig_glGetMultisamplefvNV = nullptr;
+void m_glGetMultisamplefvNV_validation(GLenum pname,GLuint index,GLfloat* val)const{(this->*(this->m_orig_glGetMultisamplefvNV))(pname,index,val);this->m_checkErrors("glGetMultisamplefvNV");}
+FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC m_orig_glMapObjectBufferATI = nullptr;
+void* m_glMapObjectBufferATI_validation(GLuint buffer)const{void* const result = (this->*(this->m_orig_glMapObjectBufferATI))(buffer);this->m_checkErrors("glMapObjectBufferATI");return result;}
+FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC m_orig_glGetPathCommandsNV = nullptr;
+void m_glGetPathCommandsNV_validation(GLuint path,GLubyte* commands)const{(this->*(this->m_orig_glGetPathCommandsNV))(path,commands);this->m_checkErrors("glGetPathCommandsNV");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC m_orig_glVertexArrayTexCoordOffsetEXT = nullptr;
+void m_glVertexArrayTexCoordOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayTexCoordOffsetEXT))(vaobj,buffer,size,type,stride,offset);this->m_checkErrors("glVertexArrayTexCoordOffsetEXT");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC m_orig_glGetHistogram = nullptr;
+void m_glGetHistogram_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,GLvoid* values)const{(this->*(this->m_orig_glGetHistogram))(target,reset,format,type,values);this->m_checkErrors("glGetHistogram");}
+FunctionTable::MEMBERPFNGLMATRIXMODEPROC m_orig_glMatrixMode = nullptr;
+void m_glMatrixMode_validation(GLenum mode)const{(this->*(this->m_orig_glMatrixMode))(mode);this->m_checkErrors("glMatrixMode");}
+FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC m_orig_glColorFormatNV = nullptr;
+void m_glColorFormatNV_validation(GLint size,GLenum type,GLsizei stride)const{(this->*(this->m_orig_glColorFormatNV))(size,type,stride);this->m_checkErrors("glColorFormatNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC m_orig_glProgramUniformui64NV = nullptr;
+void m_glProgramUniformui64NV_validation(GLuint program,GLint location,GLuint64EXT value)const{(this->*(this->m_orig_glProgramUniformui64NV))(program,location,value);this->m_checkErrors("glProgramUniformui64NV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC m_orig_glProgramUniformMatrix4x2fvEXT = nullptr;
+void m_glProgramUniformMatrix4x2fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x2fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x2fvEXT");}
+FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC m_orig_glLoadMatrixxOES = nullptr;
+void m_glLoadMatrixxOES_validation(const GLfixed* m)const{(this->*(this->m_orig_glLoadMatrixxOES))(m);this->m_checkErrors("glLoadMatrixxOES");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC m_orig_glGetColorTableParameterfvEXT = nullptr;
+void m_glGetColorTableParameterfvEXT_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetColorTableParameterfvEXT))(target,pname,params);this->m_checkErrors("glGetColorTableParameterfvEXT");}
+FunctionTable::MEMBERPFNGLRASTERPOS4IPROC m_orig_glRasterPos4i = nullptr;
+void m_glRasterPos4i_validation(GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glRasterPos4i))(x,y,z,w);this->m_checkErrors("glRasterPos4i");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC m_orig_glVertexAttribL2i64NV = nullptr;
+void m_glVertexAttribL2i64NV_validation(GLuint index,GLint64EXT x,GLint64EXT y)const{(this->*(this->m_orig_glVertexAttribL2i64NV))(index,x,y);this->m_checkErrors("glVertexAttribL2i64NV");}
+FunctionTable::MEMBERPFNGLBINDTEXTURESPROC m_orig_glBindTextures = nullptr;
+void m_glBindTextures_validation(GLuint first,GLsizei count,const GLuint* textures)const{(this->*(this->m_orig_glBindTextures))(first,count,textures);this->m_checkErrors("glBindTextures");}
+FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC m_orig_glMatrixRotatefEXT = nullptr;
+void m_glMatrixRotatefEXT_validation(GLenum mode,GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glMatrixRotatefEXT))(mode,angle,x,y,z);this->m_checkErrors("glMatrixRotatefEXT");}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC m_orig_glGetClipPlanexOES = nullptr;
+void m_glGetClipPlanexOES_validation(GLenum plane,GLfixed* equation)const{(this->*(this->m_orig_glGetClipPlanexOES))(plane,equation);this->m_checkErrors("glGetClipPlanexOES");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC m_orig_glSecondaryColor3uivEXT = nullptr;
+void m_glSecondaryColor3uivEXT_validation(const GLuint* v)const{(this->*(this->m_orig_glSecondaryColor3uivEXT))(v);this->m_checkErrors("glSecondaryColor3uivEXT");}
+FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC m_orig_glGetPerfQueryInfoINTEL = nullptr;
+void m_glGetPerfQueryInfoINTEL_validation(GLuint queryId,GLuint queryNameLength,GLchar* queryName,GLuint* dataSize,GLuint* noCounters,GLuint* noInstances,GLuint* capsMask)const{(this->*(this->m_orig_glGetPerfQueryInfoINTEL))(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);this->m_checkErrors("glGetPerfQueryInfoINTEL");}
+FunctionTable::MEMBERPFNGLGETDOUBLEVPROC m_orig_glGetDoublev = nullptr;
+void m_glGetDoublev_validation(GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetDoublev))(pname,params);this->m_checkErrors("glGetDoublev");}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC m_orig_glBindBufferRangeEXT = nullptr;
+void m_glBindBufferRangeEXT_validation(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glBindBufferRangeEXT))(target,index,buffer,offset,size);this->m_checkErrors("glBindBufferRangeEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC m_orig_glCompressedTexImage2D = nullptr;
+void m_glCompressedTexImage2D_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const GLvoid* data)const{(this->*(this->m_orig_glCompressedTexImage2D))(target,level,internalformat,width,height,border,imageSize,data);this->m_checkErrors("glCompressedTexImage2D");}
+FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC m_orig_glMapBufferARB = nullptr;
+void* m_glMapBufferARB_validation(GLenum target,GLenum access)const{void* const result = (this->*(this->m_orig_glMapBufferARB))(target,access);this->m_checkErrors("glMapBufferARB");return result;}
+FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC m_orig_glGetPathSpacingNV = nullptr;
+void m_glGetPathSpacingNV_validation(GLenum pathListMode,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLfloat advanceScale,GLfloat kerningScale,GLenum transformType,GLfloat* returnedSpacing)const{(this->*(this->m_orig_glGetPathSpacingNV))(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);this->m_checkErrors("glGetPathSpacingNV");}
+FunctionTable::MEMBERPFNGLUNIFORM4DVPROC m_orig_glUniform4dv = nullptr;
+void m_glUniform4dv_validation(GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glUniform4dv))(location,count,value);this->m_checkErrors("glUniform4dv");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC m_orig_glGlobalAlphaFactordSUN = nullptr;
+void m_glGlobalAlphaFactordSUN_validation(GLdouble factor)const{(this->*(this->m_orig_glGlobalAlphaFactordSUN))(factor);this->m_checkErrors("glGlobalAlphaFactordSUN");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC m_orig_glProgramUniform3dv = nullptr;
+void m_glProgramUniform3dv_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform3dv))(program,location,count,value);this->m_checkErrors("glProgramUniform3dv");}
+FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC m_orig_glGetShaderSourceARB = nullptr;
+void m_glGetShaderSourceARB_validation(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* source)const{(this->*(this->m_orig_glGetShaderSourceARB))(obj,maxLength,length,source);this->m_checkErrors("glGetShaderSourceARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC m_orig_glVertexAttrib3dvARB = nullptr;
+void m_glVertexAttrib3dvARB_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib3dvARB))(index,v);this->m_checkErrors("glVertexAttrib3dvARB");}
+FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC m_orig_glInvalidateBufferData = nullptr;
+void m_glInvalidateBufferData_validation(GLuint buffer)const{(this->*(this->m_orig_glInvalidateBufferData))(buffer);this->m_checkErrors("glInvalidateBufferData");}
+FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC m_orig_glMatrixLoad3x2fNV = nullptr;
+void m_glMatrixLoad3x2fNV_validation(GLenum matrixMode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixLoad3x2fNV))(matrixMode,m);this->m_checkErrors("glMatrixLoad3x2fNV");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC m_orig_glCompressedTextureSubImage1D = nullptr;
+void m_glCompressedTextureSubImage1D_validation(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTextureSubImage1D))(texture,level,xoffset,width,format,imageSize,data);this->m_checkErrors("glCompressedTextureSubImage1D");}
+FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC m_orig_glTexCoord3xvOES = nullptr;
+void m_glTexCoord3xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glTexCoord3xvOES))(coords);this->m_checkErrors("glTexCoord3xvOES");}
+FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC m_orig_glGenTexturesEXT = nullptr;
+void m_glGenTexturesEXT_validation(GLsizei n,GLuint* textures)const{(this->*(this->m_orig_glGenTexturesEXT))(n,textures);this->m_checkErrors("glGenTexturesEXT");}
+FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC m_orig_glTangent3iEXT = nullptr;
+void m_glTangent3iEXT_validation(GLint tx,GLint ty,GLint tz)const{(this->*(this->m_orig_glTangent3iEXT))(tx,ty,tz);this->m_checkErrors("glTangent3iEXT");}
+FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC m_orig_glClearTexImage = nullptr;
+void m_glClearTexImage_validation(GLuint texture,GLint level,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearTexImage))(texture,level,format,type,data);this->m_checkErrors("glClearTexImage");}
+FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC m_orig_glBinormal3bvEXT = nullptr;
+void m_glBinormal3bvEXT_validation(const GLbyte* v)const{(this->*(this->m_orig_glBinormal3bvEXT))(v);this->m_checkErrors("glBinormal3bvEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM3FVPROC m_orig_glUniform3fv = nullptr;
+void m_glUniform3fv_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform3fv))(location,count,value);this->m_checkErrors("glUniform3fv");}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC m_orig_glGetnPixelMapusvARB = nullptr;
+void m_glGetnPixelMapusvARB_validation(GLenum map,GLsizei bufSize,GLushort* values)const{(this->*(this->m_orig_glGetnPixelMapusvARB))(map,bufSize,values);this->m_checkErrors("glGetnPixelMapusvARB");}
+FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC m_orig_glMemoryObjectParameterivEXT = nullptr;
+void m_glMemoryObjectParameterivEXT_validation(GLuint memoryObject,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMemoryObjectParameterivEXT))(memoryObject,pname,params);this->m_checkErrors("glMemoryObjectParameterivEXT");}
+FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC m_orig_glGenSemaphoresEXT = nullptr;
+void m_glGenSemaphoresEXT_validation(GLsizei n,GLuint* semaphores)const{(this->*(this->m_orig_glGenSemaphoresEXT))(n,semaphores);this->m_checkErrors("glGenSemaphoresEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC m_orig_glMultiTexCoordP1ui = nullptr;
+void m_glMultiTexCoordP1ui_validation(GLenum texture,GLenum type,GLuint coords)const{(this->*(this->m_orig_glMultiTexCoordP1ui))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP1ui");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC m_orig_glClearNamedBufferDataEXT = nullptr;
+void m_glClearNamedBufferDataEXT_validation(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearNamedBufferDataEXT))(buffer,internalformat,format,type,data);this->m_checkErrors("glClearNamedBufferDataEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC m_orig_glUniformMatrix4dv = nullptr;
+void m_glUniformMatrix4dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix4dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4dv");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC m_orig_glWindowPos3fMESA = nullptr;
+void m_glWindowPos3fMESA_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glWindowPos3fMESA))(x,y,z);this->m_checkErrors("glWindowPos3fMESA");}
+FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC m_orig_glDeleteRenderbuffers = nullptr;
+void m_glDeleteRenderbuffers_validation(GLsizei n,const GLuint* renderbuffers)const{(this->*(this->m_orig_glDeleteRenderbuffers))(n,renderbuffers);this->m_checkErrors("glDeleteRenderbuffers");}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC m_orig_glGetTextureLevelParameterfvEXT = nullptr;
+void m_glGetTextureLevelParameterfvEXT_validation(GLuint texture,GLenum target,GLint level,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTextureLevelParameterfvEXT))(texture,target,level,pname,params);this->m_checkErrors("glGetTextureLevelParameterfvEXT");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC m_orig_glGetHistogramParameterxvOES = nullptr;
+void m_glGetHistogramParameterxvOES_validation(GLenum target,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetHistogramParameterxvOES))(target,pname,params);this->m_checkErrors("glGetHistogramParameterxvOES");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC m_orig_glMultiDrawElements = nullptr;
+void m_glMultiDrawElements_validation(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount)const{(this->*(this->m_orig_glMultiDrawElements))(mode,count,type,indices,drawcount);this->m_checkErrors("glMultiDrawElements");}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC m_orig_glMakeImageHandleNonResidentNV = nullptr;
+void m_glMakeImageHandleNonResidentNV_validation(GLuint64 handle)const{(this->*(this->m_orig_glMakeImageHandleNonResidentNV))(handle);this->m_checkErrors("glMakeImageHandleNonResidentNV");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC m_orig_glTexSubImage1DEXT = nullptr;
+void m_glTexSubImage1DEXT_validation(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTexSubImage1DEXT))(target,level,xoffset,width,format,type,pixels);this->m_checkErrors("glTexSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC m_orig_glNormalStream3dATI = nullptr;
+void m_glNormalStream3dATI_validation(GLenum stream,GLdouble nx,GLdouble ny,GLdouble nz)const{(this->*(this->m_orig_glNormalStream3dATI))(stream,nx,ny,nz);this->m_checkErrors("glNormalStream3dATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC m_orig_glVertexAttribL4i64vNV = nullptr;
+void m_glVertexAttribL4i64vNV_validation(GLuint index,const GLint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL4i64vNV))(index,v);this->m_checkErrors("glVertexAttribL4i64vNV");}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC m_orig_glDrawBuffers = nullptr;
+void m_glDrawBuffers_validation(GLsizei n,const GLenum* bufs)const{(this->*(this->m_orig_glDrawBuffers))(n,bufs);this->m_checkErrors("glDrawBuffers");}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC m_orig_glCopyTextureSubImage1DEXT = nullptr;
+void m_glCopyTextureSubImage1DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyTextureSubImage1DEXT))(texture,target,level,xoffset,x,y,width);this->m_checkErrors("glCopyTextureSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC m_orig_glWindowRectanglesEXT = nullptr;
+void m_glWindowRectanglesEXT_validation(GLenum mode,GLsizei count,const GLint* box)const{(this->*(this->m_orig_glWindowRectanglesEXT))(mode,count,box);this->m_checkErrors("glWindowRectanglesEXT");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC m_orig_glNamedFramebufferReadBuffer = nullptr;
+void m_glNamedFramebufferReadBuffer_validation(GLuint framebuffer,GLenum src)const{(this->*(this->m_orig_glNamedFramebufferReadBuffer))(framebuffer,src);this->m_checkErrors("glNamedFramebufferReadBuffer");}
+FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC m_orig_glUniform2i64vARB = nullptr;
+void m_glUniform2i64vARB_validation(GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glUniform2i64vARB))(location,count,value);this->m_checkErrors("glUniform2i64vARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC m_orig_glVertexAttribI1uivEXT = nullptr;
+void m_glVertexAttribI1uivEXT_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI1uivEXT))(index,v);this->m_checkErrors("glVertexAttribI1uivEXT");}
+FunctionTable::MEMBERPFNGLGETTEXGENFVPROC m_orig_glGetTexGenfv = nullptr;
+void m_glGetTexGenfv_validation(GLenum coord,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTexGenfv))(coord,pname,params);this->m_checkErrors("glGetTexGenfv");}
+FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC m_orig_glBeginQueryARB = nullptr;
+void m_glBeginQueryARB_validation(GLenum target,GLuint id)const{(this->*(this->m_orig_glBeginQueryARB))(target,id);this->m_checkErrors("glBeginQueryARB");}
+FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC m_orig_glUniform1iARB = nullptr;
+void m_glUniform1iARB_validation(GLint location,GLint v0)const{(this->*(this->m_orig_glUniform1iARB))(location,v0);this->m_checkErrors("glUniform1iARB");}
+FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC m_orig_glVertex4bvOES = nullptr;
+void m_glVertex4bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glVertex4bvOES))(coords);this->m_checkErrors("glVertex4bvOES");}
+FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC m_orig_glInvalidateSubFramebuffer = nullptr;
+void m_glInvalidateSubFramebuffer_validation(GLenum target,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glInvalidateSubFramebuffer))(target,numAttachments,attachments,x,y,width,height);this->m_checkErrors("glInvalidateSubFramebuffer");}
+FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC m_orig_glUniform1fvARB = nullptr;
+void m_glUniform1fvARB_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform1fvARB))(location,count,value);this->m_checkErrors("glUniform1fvARB");}
+FunctionTable::MEMBERPFNGLTESTFENCENVPROC m_orig_glTestFenceNV = nullptr;
+GLboolean m_glTestFenceNV_validation(GLuint fence)const{GLboolean const result = (this->*(this->m_orig_glTestFenceNV))(fence);this->m_checkErrors("glTestFenceNV");return result;}
+FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC m_orig_glBindTransformFeedback = nullptr;
+void m_glBindTransformFeedback_validation(GLenum target,GLuint id)const{(this->*(this->m_orig_glBindTransformFeedback))(target,id);this->m_checkErrors("glBindTransformFeedback");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC m_orig_glMultiTexCoord2iv = nullptr;
+void m_glMultiTexCoord2iv_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord2iv))(target,v);this->m_checkErrors("glMultiTexCoord2iv");}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC m_orig_glCopyMultiTexSubImage1DEXT = nullptr;
+void m_glCopyMultiTexSubImage1DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyMultiTexSubImage1DEXT))(texunit,target,level,xoffset,x,y,width);this->m_checkErrors("glCopyMultiTexSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC m_orig_glVariantbvEXT = nullptr;
+void m_glVariantbvEXT_validation(GLuint id,const GLbyte* addr)const{(this->*(this->m_orig_glVariantbvEXT))(id,addr);this->m_checkErrors("glVariantbvEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC m_orig_glTexCoord1hNV = nullptr;
+void m_glTexCoord1hNV_validation(GLhalfNV s)const{(this->*(this->m_orig_glTexCoord1hNV))(s);this->m_checkErrors("glTexCoord1hNV");}
+FunctionTable::MEMBERPFNGLGENFENCESNVPROC m_orig_glGenFencesNV = nullptr;
+void m_glGenFencesNV_validation(GLsizei n,GLuint* fences)const{(this->*(this->m_orig_glGenFencesNV))(n,fences);this->m_checkErrors("glGenFencesNV");}
+FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC m_orig_glRasterPos3iv = nullptr;
+void m_glRasterPos3iv_validation(const GLint* v)const{(this->*(this->m_orig_glRasterPos3iv))(v);this->m_checkErrors("glRasterPos3iv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC m_orig_glVertexAttribL2ui64NV = nullptr;
+void m_glVertexAttribL2ui64NV_validation(GLuint index,GLuint64EXT x,GLuint64EXT y)const{(this->*(this->m_orig_glVertexAttribL2ui64NV))(index,x,y);this->m_checkErrors("glVertexAttribL2ui64NV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC m_orig_glMultiTexCoord1hvNV = nullptr;
+void m_glMultiTexCoord1hvNV_validation(GLenum target,const GLhalfNV* v)const{(this->*(this->m_orig_glMultiTexCoord1hvNV))(target,v);this->m_checkErrors("glMultiTexCoord1hvNV");}
+FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC m_orig_glGetnConvolutionFilter = nullptr;
+void m_glGetnConvolutionFilter_validation(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{(this->*(this->m_orig_glGetnConvolutionFilter))(target,format,type,bufSize,image);this->m_checkErrors("glGetnConvolutionFilter");}
+FunctionTable::MEMBERPFNGLNORMAL3BVPROC m_orig_glNormal3bv = nullptr;
+void m_glNormal3bv_validation(const GLbyte* v)const{(this->*(this->m_orig_glNormal3bv))(v);this->m_checkErrors("glNormal3bv");}
+FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC m_orig_glWeightbvARB = nullptr;
+void m_glWeightbvARB_validation(GLint size,const GLbyte* weights)const{(this->*(this->m_orig_glWeightbvARB))(size,weights);this->m_checkErrors("glWeightbvARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC m_orig_glTexCoord4sv = nullptr;
+void m_glTexCoord4sv_validation(const GLshort* v)const{(this->*(this->m_orig_glTexCoord4sv))(v);this->m_checkErrors("glTexCoord4sv");}
+FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC m_orig_glUniform2uiv = nullptr;
+void m_glUniform2uiv_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform2uiv))(location,count,value);this->m_checkErrors("glUniform2uiv");}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC m_orig_glBeginConditionalRenderNVX = nullptr;
+void m_glBeginConditionalRenderNVX_validation(GLuint id)const{(this->*(this->m_orig_glBeginConditionalRenderNVX))(id);this->m_checkErrors("glBeginConditionalRenderNVX");}
+FunctionTable::MEMBERPFNGLFINISHPROC m_orig_glFinish = nullptr;
+void m_glFinish_validation()const{(this->*(this->m_orig_glFinish))();this->m_checkErrors("glFinish");}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC m_orig_glColorTableParameterfv = nullptr;
+void m_glColorTableParameterfv_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glColorTableParameterfv))(target,pname,params);this->m_checkErrors("glColorTableParameterfv");}
+FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC m_orig_glFragmentCoverageColorNV = nullptr;
+void m_glFragmentCoverageColorNV_validation(GLuint color)const{(this->*(this->m_orig_glFragmentCoverageColorNV))(color);this->m_checkErrors("glFragmentCoverageColorNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC m_orig_glProgramUniform3ivEXT = nullptr;
+void m_glProgramUniform3ivEXT_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform3ivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform3ivEXT");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC m_orig_glVertexArrayVertexOffsetEXT = nullptr;
+void m_glVertexArrayVertexOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayVertexOffsetEXT))(vaobj,buffer,size,type,stride,offset);this->m_checkErrors("glVertexArrayVertexOffsetEXT");}
+FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC m_orig_glViewportPositionWScaleNV = nullptr;
+void m_glViewportPositionWScaleNV_validation(GLuint index,GLfloat xcoeff,GLfloat ycoeff)const{(this->*(this->m_orig_glViewportPositionWScaleNV))(index,xcoeff,ycoeff);this->m_checkErrors("glViewportPositionWScaleNV");}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC m_orig_glGetProgramLocalParameterIuivNV = nullptr;
+void m_glGetProgramLocalParameterIuivNV_validation(GLenum target,GLuint index,GLuint* params)const{(this->*(this->m_orig_glGetProgramLocalParameterIuivNV))(target,index,params);this->m_checkErrors("glGetProgramLocalParameterIuivNV");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_validation(const GLuint* rc,const GLfloat* tc,const GLfloat* v)const{(this->*(this->m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN))(rc,tc,v);this->m_checkErrors("glReplacementCodeuiTexCoord2fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC m_orig_glUniform1uiv = nullptr;
+void m_glUniform1uiv_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform1uiv))(location,count,value);this->m_checkErrors("glUniform1uiv");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC m_orig_glUniformMatrix2dv = nullptr;
+void m_glUniformMatrix2dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix2dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2dv");}
+FunctionTable::MEMBERPFNGLINDEXDVPROC m_orig_glIndexdv = nullptr;
+void m_glIndexdv_validation(const GLdouble* c)const{(this->*(this->m_orig_glIndexdv))(c);this->m_checkErrors("glIndexdv");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC m_orig_glSecondaryColor3ivEXT = nullptr;
+void m_glSecondaryColor3ivEXT_validation(const GLint* v)const{(this->*(this->m_orig_glSecondaryColor3ivEXT))(v);this->m_checkErrors("glSecondaryColor3ivEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC m_orig_glTexCoord3iv = nullptr;
+void m_glTexCoord3iv_validation(const GLint* v)const{(this->*(this->m_orig_glTexCoord3iv))(v);this->m_checkErrors("glTexCoord3iv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC m_orig_glVertexStream4fvATI = nullptr;
+void m_glVertexStream4fvATI_validation(GLenum stream,const GLfloat* coords)const{(this->*(this->m_orig_glVertexStream4fvATI))(stream,coords);this->m_checkErrors("glVertexStream4fvATI");}
+FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC m_orig_glDeformationMap3fSGIX = nullptr;
+void m_glDeformationMap3fSGIX_validation(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,GLfloat w1,GLfloat w2,GLint wstride,GLint worder,const GLfloat* points)const{(this->*(this->m_orig_glDeformationMap3fSGIX))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);this->m_checkErrors("glDeformationMap3fSGIX");}
+FunctionTable::MEMBERPFNGLCLEARDEPTHPROC m_orig_glClearDepth = nullptr;
+void m_glClearDepth_validation(GLclampd depth)const{(this->*(this->m_orig_glClearDepth))(depth);this->m_checkErrors("glClearDepth");}
+FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC m_orig_glGenAsyncMarkersSGIX = nullptr;
+GLuint m_glGenAsyncMarkersSGIX_validation(GLsizei range)const{GLuint const result = (this->*(this->m_orig_glGenAsyncMarkersSGIX))(range);this->m_checkErrors("glGenAsyncMarkersSGIX");return result;}
+FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC m_orig_glDisableIndexedEXT = nullptr;
+void m_glDisableIndexedEXT_validation(GLenum target,GLuint index)const{(this->*(this->m_orig_glDisableIndexedEXT))(target,index);this->m_checkErrors("glDisableIndexedEXT");}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC m_orig_glVertexWeightfvEXT = nullptr;
+void m_glVertexWeightfvEXT_validation(const GLfloat* weight)const{(this->*(this->m_orig_glVertexWeightfvEXT))(weight);this->m_checkErrors("glVertexWeightfvEXT");}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC m_orig_glGetProgramLocalParameterIivNV = nullptr;
+void m_glGetProgramLocalParameterIivNV_validation(GLenum target,GLuint index,GLint* params)const{(this->*(this->m_orig_glGetProgramLocalParameterIivNV))(target,index,params);this->m_checkErrors("glGetProgramLocalParameterIivNV");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC m_orig_glCompressedTexImage3DARB = nullptr;
+void m_glCompressedTexImage3DARB_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTexImage3DARB))(target,level,internalformat,width,height,depth,border,imageSize,data);this->m_checkErrors("glCompressedTexImage3DARB");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC m_orig_glProgramParameter4fNV = nullptr;
+void m_glProgramParameter4fNV_validation(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glProgramParameter4fNV))(target,index,x,y,z,w);this->m_checkErrors("glProgramParameter4fNV");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC m_orig_glConvolutionParameterxOES = nullptr;
+void m_glConvolutionParameterxOES_validation(GLenum target,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glConvolutionParameterxOES))(target,pname,param);this->m_checkErrors("glConvolutionParameterxOES");}
+FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC m_orig_glInsertComponentEXT = nullptr;
+void m_glInsertComponentEXT_validation(GLuint res,GLuint src,GLuint num)const{(this->*(this->m_orig_glInsertComponentEXT))(res,src,num);this->m_checkErrors("glInsertComponentEXT");}
+FunctionTable::MEMBERPFNGLCREATETEXTURESPROC m_orig_glCreateTextures = nullptr;
+void m_glCreateTextures_validation(GLenum target,GLsizei n,GLuint* textures)const{(this->*(this->m_orig_glCreateTextures))(target,n,textures);this->m_checkErrors("glCreateTextures");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC m_orig_glSecondaryColor3iv = nullptr;
+void m_glSecondaryColor3iv_validation(const GLint* v)const{(this->*(this->m_orig_glSecondaryColor3iv))(v);this->m_checkErrors("glSecondaryColor3iv");}
+FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC m_orig_glCreateBuffers = nullptr;
+void m_glCreateBuffers_validation(GLsizei n,GLuint* buffers)const{(this->*(this->m_orig_glCreateBuffers))(n,buffers);this->m_checkErrors("glCreateBuffers");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC m_orig_glMultiTexCoord2xvOES = nullptr;
+void m_glMultiTexCoord2xvOES_validation(GLenum texture,const GLfixed* coords)const{(this->*(this->m_orig_glMultiTexCoord2xvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord2xvOES");}
+FunctionTable::MEMBERPFNGLTEXGENXVOESPROC m_orig_glTexGenxvOES = nullptr;
+void m_glTexGenxvOES_validation(GLenum coord,GLenum pname,const GLfixed* params)const{(this->*(this->m_orig_glTexGenxvOES))(coord,pname,params);this->m_checkErrors("glTexGenxvOES");}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC m_orig_glMultTransposeMatrixf = nullptr;
+void m_glMultTransposeMatrixf_validation(const GLfloat* m)const{(this->*(this->m_orig_glMultTransposeMatrixf))(m);this->m_checkErrors("glMultTransposeMatrixf");}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC m_orig_glBeginTransformFeedbackEXT = nullptr;
+void m_glBeginTransformFeedbackEXT_validation(GLenum primitiveMode)const{(this->*(this->m_orig_glBeginTransformFeedbackEXT))(primitiveMode);this->m_checkErrors("glBeginTransformFeedbackEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC m_orig_glTexCoord2fColor3fVertex3fSUN = nullptr;
+void m_glTexCoord2fColor3fVertex3fSUN_validation(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glTexCoord2fColor3fVertex3fSUN))(s,t,r,g,b,x,y,z);this->m_checkErrors("glTexCoord2fColor3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLNORMAL3SVPROC m_orig_glNormal3sv = nullptr;
+void m_glNormal3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glNormal3sv))(v);this->m_checkErrors("glNormal3sv");}
+FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC m_orig_glFreeObjectBufferATI = nullptr;
+void m_glFreeObjectBufferATI_validation(GLuint buffer)const{(this->*(this->m_orig_glFreeObjectBufferATI))(buffer);this->m_checkErrors("glFreeObjectBufferATI");}
+FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC m_orig_glBlendBarrierNV = nullptr;
+void m_glBlendBarrierNV_validation()const{(this->*(this->m_orig_glBlendBarrierNV))();this->m_checkErrors("glBlendBarrierNV");}
+FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC m_orig_glUniform4i64vNV = nullptr;
+void m_glUniform4i64vNV_validation(GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glUniform4i64vNV))(location,count,value);this->m_checkErrors("glUniform4i64vNV");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC m_orig_glGetnUniformuivARB = nullptr;
+void m_glGetnUniformuivARB_validation(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{(this->*(this->m_orig_glGetnUniformuivARB))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformuivARB");}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC m_orig_glAlphaFragmentOp3ATI = nullptr;
+void m_glAlphaFragmentOp3ATI_validation(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{(this->*(this->m_orig_glAlphaFragmentOp3ATI))(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);this->m_checkErrors("glAlphaFragmentOp3ATI");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC m_orig_glProgramEnvParameters4fvEXT = nullptr;
+void m_glProgramEnvParameters4fvEXT_validation(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{(this->*(this->m_orig_glProgramEnvParameters4fvEXT))(target,index,count,params);this->m_checkErrors("glProgramEnvParameters4fvEXT");}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC m_orig_glBlendFuncSeparateEXT = nullptr;
+void m_glBlendFuncSeparateEXT_validation(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{(this->*(this->m_orig_glBlendFuncSeparateEXT))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);this->m_checkErrors("glBlendFuncSeparateEXT");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC m_orig_glConvolutionParameterivEXT = nullptr;
+void m_glConvolutionParameterivEXT_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glConvolutionParameterivEXT))(target,pname,params);this->m_checkErrors("glConvolutionParameterivEXT");}
+FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC m_orig_glPixelTexGenSGIX = nullptr;
+void m_glPixelTexGenSGIX_validation(GLenum mode)const{(this->*(this->m_orig_glPixelTexGenSGIX))(mode);this->m_checkErrors("glPixelTexGenSGIX");}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC m_orig_glDeleteProgram = nullptr;
+void m_glDeleteProgram_validation(GLuint program)const{(this->*(this->m_orig_glDeleteProgram))(program);this->m_checkErrors("glDeleteProgram");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC m_orig_glUniformMatrix4x3dv = nullptr;
+void m_glUniformMatrix4x3dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix4x3dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4x3dv");}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC m_orig_glGetVideoCaptureStreamivNV = nullptr;
+void m_glGetVideoCaptureStreamivNV_validation(GLuint video_capture_slot,GLuint stream,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVideoCaptureStreamivNV))(video_capture_slot,stream,pname,params);this->m_checkErrors("glGetVideoCaptureStreamivNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC m_orig_glProgramUniform4uiEXT = nullptr;
+void m_glProgramUniform4uiEXT_validation(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{(this->*(this->m_orig_glProgramUniform4uiEXT))(program,location,v0,v1,v2,v3);this->m_checkErrors("glProgramUniform4uiEXT");}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC m_orig_glMakeImageHandleNonResidentARB = nullptr;
+void m_glMakeImageHandleNonResidentARB_validation(GLuint64 handle)const{(this->*(this->m_orig_glMakeImageHandleNonResidentARB))(handle);this->m_checkErrors("glMakeImageHandleNonResidentARB");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC m_orig_glSecondaryColor3dEXT = nullptr;
+void m_glSecondaryColor3dEXT_validation(GLdouble red,GLdouble green,GLdouble blue)const{(this->*(this->m_orig_glSecondaryColor3dEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3dEXT");}
+FunctionTable::MEMBERPFNGLDELETEQUERIESPROC m_orig_glDeleteQueries = nullptr;
+void m_glDeleteQueries_validation(GLsizei n,const GLuint* ids)const{(this->*(this->m_orig_glDeleteQueries))(n,ids);this->m_checkErrors("glDeleteQueries");}
+FunctionTable::MEMBERPFNGLNORMALP3UIVPROC m_orig_glNormalP3uiv = nullptr;
+void m_glNormalP3uiv_validation(GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glNormalP3uiv))(type,coords);this->m_checkErrors("glNormalP3uiv");}
+FunctionTable::MEMBERPFNGLRASTERPOS2DPROC m_orig_glRasterPos2d = nullptr;
+void m_glRasterPos2d_validation(GLdouble x,GLdouble y)const{(this->*(this->m_orig_glRasterPos2d))(x,y);this->m_checkErrors("glRasterPos2d");}
+FunctionTable::MEMBERPFNGLINITNAMESPROC m_orig_glInitNames = nullptr;
+void m_glInitNames_validation()const{(this->*(this->m_orig_glInitNames))();this->m_checkErrors("glInitNames");}
+FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC m_orig_glBinormal3fvEXT = nullptr;
+void m_glBinormal3fvEXT_validation(const GLfloat* v)const{(this->*(this->m_orig_glBinormal3fvEXT))(v);this->m_checkErrors("glBinormal3fvEXT");}
+FunctionTable::MEMBERPFNGLCOLOR3DVPROC m_orig_glColor3dv = nullptr;
+void m_glColor3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glColor3dv))(v);this->m_checkErrors("glColor3dv");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC m_orig_glVertexArrayVertexAttribDivisorEXT = nullptr;
+void m_glVertexArrayVertexAttribDivisorEXT_validation(GLuint vaobj,GLuint index,GLuint divisor)const{(this->*(this->m_orig_glVertexArrayVertexAttribDivisorEXT))(vaobj,index,divisor);this->m_checkErrors("glVertexArrayVertexAttribDivisorEXT");}
+FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC m_orig_glArrayElementEXT = nullptr;
+void m_glArrayElementEXT_validation(GLint i)const{(this->*(this->m_orig_glArrayElementEXT))(i);this->m_checkErrors("glArrayElementEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC m_orig_glProgramParameter4dNV = nullptr;
+void m_glProgramParameter4dNV_validation(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glProgramParameter4dNV))(target,index,x,y,z,w);this->m_checkErrors("glProgramParameter4dNV");}
+FunctionTable::MEMBERPFNGLINDEXXOESPROC m_orig_glIndexxOES = nullptr;
+void m_glIndexxOES_validation(GLfixed component)const{(this->*(this->m_orig_glIndexxOES))(component);this->m_checkErrors("glIndexxOES");}
+FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC m_orig_glUniform3uivEXT = nullptr;
+void m_glUniform3uivEXT_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform3uivEXT))(location,count,value);this->m_checkErrors("glUniform3uivEXT");}
+FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC m_orig_glPopGroupMarkerEXT = nullptr;
+void m_glPopGroupMarkerEXT_validation()const{(this->*(this->m_orig_glPopGroupMarkerEXT))();this->m_checkErrors("glPopGroupMarkerEXT");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC m_orig_glClearNamedFramebufferuiv = nullptr;
+void m_glClearNamedFramebufferuiv_validation(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLuint* value)const{(this->*(this->m_orig_glClearNamedFramebufferuiv))(framebuffer,buffer,drawbuffer,value);this->m_checkErrors("glClearNamedFramebufferuiv");}
+FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC m_orig_glSetLocalConstantEXT = nullptr;
+void m_glSetLocalConstantEXT_validation(GLuint id,GLenum type,const void* addr)const{(this->*(this->m_orig_glSetLocalConstantEXT))(id,type,addr);this->m_checkErrors("glSetLocalConstantEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC m_orig_glProgramUniform1ui64NV = nullptr;
+void m_glProgramUniform1ui64NV_validation(GLuint program,GLint location,GLuint64EXT x)const{(this->*(this->m_orig_glProgramUniform1ui64NV))(program,location,x);this->m_checkErrors("glProgramUniform1ui64NV");}
+FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC m_orig_glColor4hvNV = nullptr;
+void m_glColor4hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glColor4hvNV))(v);this->m_checkErrors("glColor4hvNV");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC m_orig_glGetVertexAttribfv = nullptr;
+void m_glGetVertexAttribfv_validation(GLuint index,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetVertexAttribfv))(index,pname,params);this->m_checkErrors("glGetVertexAttribfv");}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC m_orig_glDispatchCompute = nullptr;
+void m_glDispatchCompute_validation(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z)const{(this->*(this->m_orig_glDispatchCompute))(num_groups_x,num_groups_y,num_groups_z);this->m_checkErrors("glDispatchCompute");}
+FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC m_orig_glGetActiveAttrib = nullptr;
+void m_glGetActiveAttrib_validation(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{(this->*(this->m_orig_glGetActiveAttrib))(program,index,bufSize,length,size,type,name);this->m_checkErrors("glGetActiveAttrib");}
+FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC m_orig_glFragmentColorMaterialSGIX = nullptr;
+void m_glFragmentColorMaterialSGIX_validation(GLenum face,GLenum mode)const{(this->*(this->m_orig_glFragmentColorMaterialSGIX))(face,mode);this->m_checkErrors("glFragmentColorMaterialSGIX");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC m_orig_glTexSubImage2D = nullptr;
+void m_glTexSubImage2D_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glTexSubImage2D))(target,level,xoffset,yoffset,width,height,format,type,pixels);this->m_checkErrors("glTexSubImage2D");}
+FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC m_orig_glGetnMinmaxARB = nullptr;
+void m_glGetnMinmaxARB_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{(this->*(this->m_orig_glGetnMinmaxARB))(target,reset,format,type,bufSize,values);this->m_checkErrors("glGetnMinmaxARB");}
+FunctionTable::MEMBERPFNGLLOGICOPPROC m_orig_glLogicOp = nullptr;
+void m_glLogicOp_validation(GLenum opcode)const{(this->*(this->m_orig_glLogicOp))(opcode);this->m_checkErrors("glLogicOp");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC m_orig_glProgramUniformMatrix3x4fv = nullptr;
+void m_glProgramUniformMatrix3x4fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x4fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x4fv");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC m_orig_glWindowPos4iMESA = nullptr;
+void m_glWindowPos4iMESA_validation(GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glWindowPos4iMESA))(x,y,z,w);this->m_checkErrors("glWindowPos4iMESA");}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC m_orig_glPixelTransferf = nullptr;
+void m_glPixelTransferf_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPixelTransferf))(pname,param);this->m_checkErrors("glPixelTransferf");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC m_orig_glGetTextureParameterIuiv = nullptr;
+void m_glGetTextureParameterIuiv_validation(GLuint texture,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetTextureParameterIuiv))(texture,pname,params);this->m_checkErrors("glGetTextureParameterIuiv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC m_orig_glMultiTexCoord1xOES = nullptr;
+void m_glMultiTexCoord1xOES_validation(GLenum texture,GLfixed s)const{(this->*(this->m_orig_glMultiTexCoord1xOES))(texture,s);this->m_checkErrors("glMultiTexCoord1xOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC m_orig_glProgramUniformMatrix4dv = nullptr;
+void m_glProgramUniformMatrix4dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix4dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4dv");}
+FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC m_orig_glGetnUniformiv = nullptr;
+void m_glGetnUniformiv_validation(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{(this->*(this->m_orig_glGetnUniformiv))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformiv");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC m_orig_glFramebufferTexture1DEXT = nullptr;
+void m_glFramebufferTexture1DEXT_validation(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTexture1DEXT))(target,attachment,textarget,texture,level);this->m_checkErrors("glFramebufferTexture1DEXT");}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC m_orig_glVertexPointervINTEL = nullptr;
+void m_glVertexPointervINTEL_validation(GLint size,GLenum type,const void** pointer)const{(this->*(this->m_orig_glVertexPointervINTEL))(size,type,pointer);this->m_checkErrors("glVertexPointervINTEL");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC m_orig_glTextureParameterIiv = nullptr;
+void m_glTextureParameterIiv_validation(GLuint texture,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTextureParameterIiv))(texture,pname,params);this->m_checkErrors("glTextureParameterIiv");}
+FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC m_orig_glGetSeparableFilterEXT = nullptr;
+void m_glGetSeparableFilterEXT_validation(GLenum target,GLenum format,GLenum type,void* row,void* column,void* span)const{(this->*(this->m_orig_glGetSeparableFilterEXT))(target,format,type,row,column,span);this->m_checkErrors("glGetSeparableFilterEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC m_orig_glMultiTexCoord3iARB = nullptr;
+void m_glMultiTexCoord3iARB_validation(GLenum target,GLint s,GLint t,GLint r)const{(this->*(this->m_orig_glMultiTexCoord3iARB))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3iARB");}
+FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC m_orig_glRasterPos4xvOES = nullptr;
+void m_glRasterPos4xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glRasterPos4xvOES))(coords);this->m_checkErrors("glRasterPos4xvOES");}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC m_orig_glDrawTransformFeedbackStream = nullptr;
+void m_glDrawTransformFeedbackStream_validation(GLenum mode,GLuint id,GLuint stream)const{(this->*(this->m_orig_glDrawTransformFeedbackStream))(mode,id,stream);this->m_checkErrors("glDrawTransformFeedbackStream");}
+FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC m_orig_glVertex3hvNV = nullptr;
+void m_glVertex3hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glVertex3hvNV))(v);this->m_checkErrors("glVertex3hvNV");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC m_orig_glVertexArrayMultiTexCoordOffsetEXT = nullptr;
+void m_glVertexArrayMultiTexCoordOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLenum texunit,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayMultiTexCoordOffsetEXT))(vaobj,buffer,texunit,size,type,stride,offset);this->m_checkErrors("glVertexArrayMultiTexCoordOffsetEXT");}
+FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC m_orig_glProvokingVertex = nullptr;
+void m_glProvokingVertex_validation(GLenum mode)const{(this->*(this->m_orig_glProvokingVertex))(mode);this->m_checkErrors("glProvokingVertex");}
+FunctionTable::MEMBERPFNGLACCUMXOESPROC m_orig_glAccumxOES = nullptr;
+void m_glAccumxOES_validation(GLenum op,GLfixed value)const{(this->*(this->m_orig_glAccumxOES))(op,value);this->m_checkErrors("glAccumxOES");}
+FunctionTable::MEMBERPFNGLSHADERBINARYPROC m_orig_glShaderBinary = nullptr;
+void m_glShaderBinary_validation(GLsizei count,const GLuint* shaders,GLenum binaryformat,const void* binary,GLsizei length)const{(this->*(this->m_orig_glShaderBinary))(count,shaders,binaryformat,binary,length);this->m_checkErrors("glShaderBinary");}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC m_orig_glGetMultiTexGenivEXT = nullptr;
+void m_glGetMultiTexGenivEXT_validation(GLenum texunit,GLenum coord,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMultiTexGenivEXT))(texunit,coord,pname,params);this->m_checkErrors("glGetMultiTexGenivEXT");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC m_orig_glPointParameterxvOES = nullptr;
+void m_glPointParameterxvOES_validation(GLenum pname,const GLfixed* params)const{(this->*(this->m_orig_glPointParameterxvOES))(pname,params);this->m_checkErrors("glPointParameterxvOES");}
+FunctionTable::MEMBERPFNGLCREATESTATESNVPROC m_orig_glCreateStatesNV = nullptr;
+void m_glCreateStatesNV_validation(GLsizei n,GLuint* states)const{(this->*(this->m_orig_glCreateStatesNV))(n,states);this->m_checkErrors("glCreateStatesNV");}
+FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC m_orig_glClearDepthdNV = nullptr;
+void m_glClearDepthdNV_validation(GLdouble depth)const{(this->*(this->m_orig_glClearDepthdNV))(depth);this->m_checkErrors("glClearDepthdNV");}
+FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC m_orig_glClearColorIuiEXT = nullptr;
+void m_glClearColorIuiEXT_validation(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{(this->*(this->m_orig_glClearColorIuiEXT))(red,green,blue,alpha);this->m_checkErrors("glClearColorIuiEXT");}
+FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC m_orig_glBindMultiTextureEXT = nullptr;
+void m_glBindMultiTextureEXT_validation(GLenum texunit,GLenum target,GLuint texture)const{(this->*(this->m_orig_glBindMultiTextureEXT))(texunit,target,texture);this->m_checkErrors("glBindMultiTextureEXT");}
+FunctionTable::MEMBERPFNGLTEXGENIVPROC m_orig_glTexGeniv = nullptr;
+void m_glTexGeniv_validation(GLenum coord,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTexGeniv))(coord,pname,params);this->m_checkErrors("glTexGeniv");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC m_orig_glDrawElements = nullptr;
+void m_glDrawElements_validation(GLenum mode,GLsizei count,GLenum type,const GLvoid* indices)const{(this->*(this->m_orig_glDrawElements))(mode,count,type,indices);this->m_checkErrors("glDrawElements");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC m_orig_glProgramUniform4iv = nullptr;
+void m_glProgramUniform4iv_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform4iv))(program,location,count,value);this->m_checkErrors("glProgramUniform4iv");}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC m_orig_glDisableVertexArrayEXT = nullptr;
+void m_glDisableVertexArrayEXT_validation(GLuint vaobj,GLenum array)const{(this->*(this->m_orig_glDisableVertexArrayEXT))(vaobj,array);this->m_checkErrors("glDisableVertexArrayEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC m_orig_glProgramUniform3ui64NV = nullptr;
+void m_glProgramUniform3ui64NV_validation(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{(this->*(this->m_orig_glProgramUniform3ui64NV))(program,location,x,y,z);this->m_checkErrors("glProgramUniform3ui64NV");}
+FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC m_orig_glClientActiveTexture = nullptr;
+void m_glClientActiveTexture_validation(GLenum texture)const{(this->*(this->m_orig_glClientActiveTexture))(texture);this->m_checkErrors("glClientActiveTexture");}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC m_orig_glMultiTexParameterIivEXT = nullptr;
+void m_glMultiTexParameterIivEXT_validation(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMultiTexParameterIivEXT))(texunit,target,pname,params);this->m_checkErrors("glMultiTexParameterIivEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC m_orig_glUniform1i64ARB = nullptr;
+void m_glUniform1i64ARB_validation(GLint location,GLint64 x)const{(this->*(this->m_orig_glUniform1i64ARB))(location,x);this->m_checkErrors("glUniform1i64ARB");}
+FunctionTable::MEMBERPFNGLUNIFORM1IVPROC m_orig_glUniform1iv = nullptr;
+void m_glUniform1iv_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform1iv))(location,count,value);this->m_checkErrors("glUniform1iv");}
+FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC m_orig_glMulticastBarrierNV = nullptr;
+void m_glMulticastBarrierNV_validation()const{(this->*(this->m_orig_glMulticastBarrierNV))();this->m_checkErrors("glMulticastBarrierNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC m_orig_glVertexAttribArrayObjectATI = nullptr;
+void m_glVertexAttribArrayObjectATI_validation(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLuint buffer,GLuint offset)const{(this->*(this->m_orig_glVertexAttribArrayObjectATI))(index,size,type,normalized,stride,buffer,offset);this->m_checkErrors("glVertexAttribArrayObjectATI");}
+FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC m_orig_glUniform2iARB = nullptr;
+void m_glUniform2iARB_validation(GLint location,GLint v0,GLint v1)const{(this->*(this->m_orig_glUniform2iARB))(location,v0,v1);this->m_checkErrors("glUniform2iARB");}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC m_orig_glDrawArraysInstanced = nullptr;
+void m_glDrawArraysInstanced_validation(GLenum mode,GLint first,GLsizei count,GLsizei instancecount)const{(this->*(this->m_orig_glDrawArraysInstanced))(mode,first,count,instancecount);this->m_checkErrors("glDrawArraysInstanced");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC m_orig_glVertexAttrib2sNV = nullptr;
+void m_glVertexAttrib2sNV_validation(GLuint index,GLshort x,GLshort y)const{(this->*(this->m_orig_glVertexAttrib2sNV))(index,x,y);this->m_checkErrors("glVertexAttrib2sNV");}
+FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC m_orig_glTexBufferEXT = nullptr;
+void m_glTexBufferEXT_validation(GLenum target,GLenum internalformat,GLuint buffer)const{(this->*(this->m_orig_glTexBufferEXT))(target,internalformat,buffer);this->m_checkErrors("glTexBufferEXT");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC m_orig_glVertexStream2fATI = nullptr;
+void m_glVertexStream2fATI_validation(GLenum stream,GLfloat x,GLfloat y)const{(this->*(this->m_orig_glVertexStream2fATI))(stream,x,y);this->m_checkErrors("glVertexStream2fATI");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC m_orig_glDebugMessageCallbackAMD = nullptr;
+void m_glDebugMessageCallbackAMD_validation(GLDEBUGPROCAMD callback,void* userParam)const{(this->*(this->m_orig_glDebugMessageCallbackAMD))(callback,userParam);this->m_checkErrors("glDebugMessageCallbackAMD");}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC m_orig_glSamplerParameteriv = nullptr;
+void m_glSamplerParameteriv_validation(GLuint sampler,GLenum pname,const GLint* param)const{(this->*(this->m_orig_glSamplerParameteriv))(sampler,pname,param);this->m_checkErrors("glSamplerParameteriv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC m_orig_glVertexAttrib4uiv = nullptr;
+void m_glVertexAttrib4uiv_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttrib4uiv))(index,v);this->m_checkErrors("glVertexAttrib4uiv");}
+FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC m_orig_glEndQueryIndexed = nullptr;
+void m_glEndQueryIndexed_validation(GLenum target,GLuint index)const{(this->*(this->m_orig_glEndQueryIndexed))(target,index);this->m_checkErrors("glEndQueryIndexed");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC m_orig_glNormalStream3sATI = nullptr;
+void m_glNormalStream3sATI_validation(GLenum stream,GLshort nx,GLshort ny,GLshort nz)const{(this->*(this->m_orig_glNormalStream3sATI))(stream,nx,ny,nz);this->m_checkErrors("glNormalStream3sATI");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC m_orig_glProgramParameteriARB = nullptr;
+void m_glProgramParameteriARB_validation(GLuint program,GLenum pname,GLint value)const{(this->*(this->m_orig_glProgramParameteriARB))(program,pname,value);this->m_checkErrors("glProgramParameteriARB");}
+FunctionTable::MEMBERPFNGLTEXENVXOESPROC m_orig_glTexEnvxOES = nullptr;
+void m_glTexEnvxOES_validation(GLenum target,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glTexEnvxOES))(target,pname,param);this->m_checkErrors("glTexEnvxOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC m_orig_glProgramUniform1iv = nullptr;
+void m_glProgramUniform1iv_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform1iv))(program,location,count,value);this->m_checkErrors("glProgramUniform1iv");}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC m_orig_glDisableVertexAttribAPPLE = nullptr;
+void m_glDisableVertexAttribAPPLE_validation(GLuint index,GLenum pname)const{(this->*(this->m_orig_glDisableVertexAttribAPPLE))(index,pname);this->m_checkErrors("glDisableVertexAttribAPPLE");}
+FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC m_orig_glBindRenderbuffer = nullptr;
+void m_glBindRenderbuffer_validation(GLenum target,GLuint renderbuffer)const{(this->*(this->m_orig_glBindRenderbuffer))(target,renderbuffer);this->m_checkErrors("glBindRenderbuffer");}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC m_orig_glMultiTexSubImage3DEXT = nullptr;
+void m_glMultiTexSubImage3DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glMultiTexSubImage3DEXT))(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->m_checkErrors("glMultiTexSubImage3DEXT");}
+FunctionTable::MEMBERPFNGLISPROGRAMPROC m_orig_glIsProgram = nullptr;
+GLboolean m_glIsProgram_validation(GLuint program)const{GLboolean const result = (this->*(this->m_orig_glIsProgram))(program);this->m_checkErrors("glIsProgram");return result;}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC m_orig_glMultiDrawElementsIndirectAMD = nullptr;
+void m_glMultiDrawElementsIndirectAMD_validation(GLenum mode,GLenum type,const void* indirect,GLsizei primcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawElementsIndirectAMD))(mode,type,indirect,primcount,stride);this->m_checkErrors("glMultiDrawElementsIndirectAMD");}
+FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC m_orig_glGetProgramInfoLog = nullptr;
+void m_glGetProgramInfoLog_validation(GLuint program,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{(this->*(this->m_orig_glGetProgramInfoLog))(program,bufSize,length,infoLog);this->m_checkErrors("glGetProgramInfoLog");}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC m_orig_glGetLocalConstantBooleanvEXT = nullptr;
+void m_glGetLocalConstantBooleanvEXT_validation(GLuint id,GLenum value,GLboolean* data)const{(this->*(this->m_orig_glGetLocalConstantBooleanvEXT))(id,value,data);this->m_checkErrors("glGetLocalConstantBooleanvEXT");}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC m_orig_glPixelTransformParameteriEXT = nullptr;
+void m_glPixelTransformParameteriEXT_validation(GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glPixelTransformParameteriEXT))(target,pname,param);this->m_checkErrors("glPixelTransformParameteriEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC m_orig_glTexCoord4bOES = nullptr;
+void m_glTexCoord4bOES_validation(GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{(this->*(this->m_orig_glTexCoord4bOES))(s,t,r,q);this->m_checkErrors("glTexCoord4bOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC m_orig_glVertexAttrib4fv = nullptr;
+void m_glVertexAttrib4fv_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib4fv))(index,v);this->m_checkErrors("glVertexAttrib4fv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC m_orig_glProgramUniformMatrix2x3dv = nullptr;
+void m_glProgramUniformMatrix2x3dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x3dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x3dv");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC m_orig_glProgramEnvParametersI4uivNV = nullptr;
+void m_glProgramEnvParametersI4uivNV_validation(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{(this->*(this->m_orig_glProgramEnvParametersI4uivNV))(target,index,count,params);this->m_checkErrors("glProgramEnvParametersI4uivNV");}
+FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC m_orig_glTexCoord3xOES = nullptr;
+void m_glTexCoord3xOES_validation(GLfixed s,GLfixed t,GLfixed r)const{(this->*(this->m_orig_glTexCoord3xOES))(s,t,r);this->m_checkErrors("glTexCoord3xOES");}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC m_orig_glLoadTransposeMatrixfARB = nullptr;
+void m_glLoadTransposeMatrixfARB_validation(const GLfloat* m)const{(this->*(this->m_orig_glLoadTransposeMatrixfARB))(m);this->m_checkErrors("glLoadTransposeMatrixfARB");}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC m_orig_glImageTransformParameteriHP = nullptr;
+void m_glImageTransformParameteriHP_validation(GLenum target,GLenum pname,GLint param)const{(this->*(this->m_orig_glImageTransformParameteriHP))(target,pname,param);this->m_checkErrors("glImageTransformParameteriHP");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC m_orig_glMultiTexCoord4xOES = nullptr;
+void m_glMultiTexCoord4xOES_validation(GLenum texture,GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{(this->*(this->m_orig_glMultiTexCoord4xOES))(texture,s,t,r,q);this->m_checkErrors("glMultiTexCoord4xOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC m_orig_glVertexAttribs3fvNV = nullptr;
+void m_glVertexAttribs3fvNV_validation(GLuint index,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttribs3fvNV))(index,count,v);this->m_checkErrors("glVertexAttribs3fvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC m_orig_glVertexAttrib2fv = nullptr;
+void m_glVertexAttrib2fv_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib2fv))(index,v);this->m_checkErrors("glVertexAttrib2fv");}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC m_orig_glUniform3ui64NV = nullptr;
+void m_glUniform3ui64NV_validation(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{(this->*(this->m_orig_glUniform3ui64NV))(location,x,y,z);this->m_checkErrors("glUniform3ui64NV");}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC m_orig_glCombinerParameterfvNV = nullptr;
+void m_glCombinerParameterfvNV_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glCombinerParameterfvNV))(pname,params);this->m_checkErrors("glCombinerParameterfvNV");}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC m_orig_glFragmentMaterialiSGIX = nullptr;
+void m_glFragmentMaterialiSGIX_validation(GLenum face,GLenum pname,GLint param)const{(this->*(this->m_orig_glFragmentMaterialiSGIX))(face,pname,param);this->m_checkErrors("glFragmentMaterialiSGIX");}
+FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC m_orig_glGetBooleani_v = nullptr;
+void m_glGetBooleani_v_validation(GLenum target,GLuint index,GLboolean* data)const{(this->*(this->m_orig_glGetBooleani_v))(target,index,data);this->m_checkErrors("glGetBooleani_v");}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC m_orig_glGetProgramResourceIndex = nullptr;
+GLuint m_glGetProgramResourceIndex_validation(GLuint program,GLenum programInterface,const GLchar* name)const{GLuint const result = (this->*(this->m_orig_glGetProgramResourceIndex))(program,programInterface,name);this->m_checkErrors("glGetProgramResourceIndex");return result;}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC m_orig_glBeginConditionalRenderNV = nullptr;
+void m_glBeginConditionalRenderNV_validation(GLuint id,GLenum mode)const{(this->*(this->m_orig_glBeginConditionalRenderNV))(id,mode);this->m_checkErrors("glBeginConditionalRenderNV");}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC m_orig_glDisableClientState = nullptr;
+void m_glDisableClientState_validation(GLenum cap)const{(this->*(this->m_orig_glDisableClientState))(cap);this->m_checkErrors("glDisableClientState");}
+FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC m_orig_glPathFogGenNV = nullptr;
+void m_glPathFogGenNV_validation(GLenum genMode)const{(this->*(this->m_orig_glPathFogGenNV))(genMode);this->m_checkErrors("glPathFogGenNV");}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC m_orig_glStencilThenCoverFillPathNV = nullptr;
+void m_glStencilThenCoverFillPathNV_validation(GLuint path,GLenum fillMode,GLuint mask,GLenum coverMode)const{(this->*(this->m_orig_glStencilThenCoverFillPathNV))(path,fillMode,mask,coverMode);this->m_checkErrors("glStencilThenCoverFillPathNV");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC m_orig_glVertexArrayIndexOffsetEXT = nullptr;
+void m_glVertexArrayIndexOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayIndexOffsetEXT))(vaobj,buffer,type,stride,offset);this->m_checkErrors("glVertexArrayIndexOffsetEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC m_orig_glProgramBufferParametersIuivNV = nullptr;
+void m_glProgramBufferParametersIuivNV_validation(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLuint* params)const{(this->*(this->m_orig_glProgramBufferParametersIuivNV))(target,bindingIndex,wordIndex,count,params);this->m_checkErrors("glProgramBufferParametersIuivNV");}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC m_orig_glPixelTransformParameterivEXT = nullptr;
+void m_glPixelTransformParameterivEXT_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glPixelTransformParameterivEXT))(target,pname,params);this->m_checkErrors("glPixelTransformParameterivEXT");}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC m_orig_glDisableClientStateiEXT = nullptr;
+void m_glDisableClientStateiEXT_validation(GLenum array,GLuint index)const{(this->*(this->m_orig_glDisableClientStateiEXT))(array,index);this->m_checkErrors("glDisableClientStateiEXT");}
+FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC m_orig_glTexBufferARB = nullptr;
+void m_glTexBufferARB_validation(GLenum target,GLenum internalformat,GLuint buffer)const{(this->*(this->m_orig_glTexBufferARB))(target,internalformat,buffer);this->m_checkErrors("glTexBufferARB");}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC m_orig_glGetLocalConstantIntegervEXT = nullptr;
+void m_glGetLocalConstantIntegervEXT_validation(GLuint id,GLenum value,GLint* data)const{(this->*(this->m_orig_glGetLocalConstantIntegervEXT))(id,value,data);this->m_checkErrors("glGetLocalConstantIntegervEXT");}
+FunctionTable::MEMBERPFNGLCOLOR4UIVPROC m_orig_glColor4uiv = nullptr;
+void m_glColor4uiv_validation(const GLuint* v)const{(this->*(this->m_orig_glColor4uiv))(v);this->m_checkErrors("glColor4uiv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC m_orig_glProgramUniform3i = nullptr;
+void m_glProgramUniform3i_validation(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{(this->*(this->m_orig_glProgramUniform3i))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3i");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC m_orig_glMultiDrawElementsIndirectBindlessCountNV = nullptr;
+void m_glMultiDrawElementsIndirectBindlessCountNV_validation(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{(this->*(this->m_orig_glMultiDrawElementsIndirectBindlessCountNV))(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);this->m_checkErrors("glMultiDrawElementsIndirectBindlessCountNV");}
+FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC m_orig_glGetBufferPointervARB = nullptr;
+void m_glGetBufferPointervARB_validation(GLenum target,GLenum pname,void** params)const{(this->*(this->m_orig_glGetBufferPointervARB))(target,pname,params);this->m_checkErrors("glGetBufferPointervARB");}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC m_orig_glMultiTexParameterIuivEXT = nullptr;
+void m_glMultiTexParameterIuivEXT_validation(GLenum texunit,GLenum target,GLenum pname,const GLuint* params)const{(this->*(this->m_orig_glMultiTexParameterIuivEXT))(texunit,target,pname,params);this->m_checkErrors("glMultiTexParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLEVALMESH2PROC m_orig_glEvalMesh2 = nullptr;
+void m_glEvalMesh2_validation(GLenum mode,GLint i1,GLint i2,GLint j1,GLint j2)const{(this->*(this->m_orig_glEvalMesh2))(mode,i1,i2,j1,j2);this->m_checkErrors("glEvalMesh2");}
+FunctionTable::MEMBERPFNGLEVALMESH1PROC m_orig_glEvalMesh1 = nullptr;
+void m_glEvalMesh1_validation(GLenum mode,GLint i1,GLint i2)const{(this->*(this->m_orig_glEvalMesh1))(mode,i1,i2);this->m_checkErrors("glEvalMesh1");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC m_orig_glProgramUniform3f = nullptr;
+void m_glProgramUniform3f_validation(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{(this->*(this->m_orig_glProgramUniform3f))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3f");}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC m_orig_glStencilThenCoverFillPathInstancedNV = nullptr;
+void m_glStencilThenCoverFillPathInstancedNV_validation(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glStencilThenCoverFillPathInstancedNV))(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);this->m_checkErrors("glStencilThenCoverFillPathInstancedNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC m_orig_glProgramUniform3d = nullptr;
+void m_glProgramUniform3d_validation(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2)const{(this->*(this->m_orig_glProgramUniform3d))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3d");}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC m_orig_glMapVertexAttrib1dAPPLE = nullptr;
+void m_glMapVertexAttrib1dAPPLE_validation(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{(this->*(this->m_orig_glMapVertexAttrib1dAPPLE))(index,size,u1,u2,stride,order,points);this->m_checkErrors("glMapVertexAttrib1dAPPLE");}
+FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC m_orig_glEvalCoord2fv = nullptr;
+void m_glEvalCoord2fv_validation(const GLfloat* u)const{(this->*(this->m_orig_glEvalCoord2fv))(u);this->m_checkErrors("glEvalCoord2fv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC m_orig_glGetUniformivARB = nullptr;
+void m_glGetUniformivARB_validation(GLhandleARB programObj,GLint location,GLint* params)const{(this->*(this->m_orig_glGetUniformivARB))(programObj,location,params);this->m_checkErrors("glGetUniformivARB");}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC m_orig_glLoadTransposeMatrixd = nullptr;
+void m_glLoadTransposeMatrixd_validation(const GLdouble* m)const{(this->*(this->m_orig_glLoadTransposeMatrixd))(m);this->m_checkErrors("glLoadTransposeMatrixd");}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC m_orig_glLoadTransposeMatrixf = nullptr;
+void m_glLoadTransposeMatrixf_validation(const GLfloat* m)const{(this->*(this->m_orig_glLoadTransposeMatrixf))(m);this->m_checkErrors("glLoadTransposeMatrixf");}
+FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC m_orig_glGetPointervEXT = nullptr;
+void m_glGetPointervEXT_validation(GLenum pname,void** params)const{(this->*(this->m_orig_glGetPointervEXT))(pname,params);this->m_checkErrors("glGetPointervEXT");}
+FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC m_orig_glSignalVkSemaphoreNV = nullptr;
+void m_glSignalVkSemaphoreNV_validation(GLuint64 vkSemaphore)const{(this->*(this->m_orig_glSignalVkSemaphoreNV))(vkSemaphore);this->m_checkErrors("glSignalVkSemaphoreNV");}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC m_orig_glEndConditionalRenderNV = nullptr;
+void m_glEndConditionalRenderNV_validation()const{(this->*(this->m_orig_glEndConditionalRenderNV))();this->m_checkErrors("glEndConditionalRenderNV");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC m_orig_glTexCoord2fNormal3fVertex3fSUN = nullptr;
+void m_glTexCoord2fNormal3fVertex3fSUN_validation(GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glTexCoord2fNormal3fVertex3fSUN))(s,t,nx,ny,nz,x,y,z);this->m_checkErrors("glTexCoord2fNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC m_orig_glUniform3i64vARB = nullptr;
+void m_glUniform3i64vARB_validation(GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glUniform3i64vARB))(location,count,value);this->m_checkErrors("glUniform3i64vARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC m_orig_glProgramUniform2uiEXT = nullptr;
+void m_glProgramUniform2uiEXT_validation(GLuint program,GLint location,GLuint v0,GLuint v1)const{(this->*(this->m_orig_glProgramUniform2uiEXT))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2uiEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC m_orig_glVertexAttribI1ui = nullptr;
+void m_glVertexAttribI1ui_validation(GLuint index,GLuint x)const{(this->*(this->m_orig_glVertexAttribI1ui))(index,x);this->m_checkErrors("glVertexAttribI1ui");}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC m_orig_glProgramNamedParameter4dvNV = nullptr;
+void m_glProgramNamedParameter4dvNV_validation(GLuint id,GLsizei len,const GLubyte* name,const GLdouble* v)const{(this->*(this->m_orig_glProgramNamedParameter4dvNV))(id,len,name,v);this->m_checkErrors("glProgramNamedParameter4dvNV");}
+FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC m_orig_glCompileCommandListNV = nullptr;
+void m_glCompileCommandListNV_validation(GLuint list)const{(this->*(this->m_orig_glCompileCommandListNV))(list);this->m_checkErrors("glCompileCommandListNV");}
+FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC m_orig_glGetRenderbufferParameterivEXT = nullptr;
+void m_glGetRenderbufferParameterivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetRenderbufferParameterivEXT))(target,pname,params);this->m_checkErrors("glGetRenderbufferParameterivEXT");}
+FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC m_orig_glGetnPolygonStipple = nullptr;
+void m_glGetnPolygonStipple_validation(GLsizei bufSize,GLubyte* pattern)const{(this->*(this->m_orig_glGetnPolygonStipple))(bufSize,pattern);this->m_checkErrors("glGetnPolygonStipple");}
+FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC m_orig_glIsBufferResidentNV = nullptr;
+GLboolean m_glIsBufferResidentNV_validation(GLenum target)const{GLboolean const result = (this->*(this->m_orig_glIsBufferResidentNV))(target);this->m_checkErrors("glIsBufferResidentNV");return result;}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC m_orig_glSecondaryColor3ubvEXT = nullptr;
+void m_glSecondaryColor3ubvEXT_validation(const GLubyte* v)const{(this->*(this->m_orig_glSecondaryColor3ubvEXT))(v);this->m_checkErrors("glSecondaryColor3ubvEXT");}
+FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC m_orig_glGetNamedRenderbufferParameterivEXT = nullptr;
+void m_glGetNamedRenderbufferParameterivEXT_validation(GLuint renderbuffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedRenderbufferParameterivEXT))(renderbuffer,pname,params);this->m_checkErrors("glGetNamedRenderbufferParameterivEXT");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC m_orig_glNamedFramebufferSampleLocationsfvARB = nullptr;
+void m_glNamedFramebufferSampleLocationsfvARB_validation(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glNamedFramebufferSampleLocationsfvARB))(framebuffer,start,count,v);this->m_checkErrors("glNamedFramebufferSampleLocationsfvARB");}
+FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC m_orig_glMultiTexGendvEXT = nullptr;
+void m_glMultiTexGendvEXT_validation(GLenum texunit,GLenum coord,GLenum pname,const GLdouble* params)const{(this->*(this->m_orig_glMultiTexGendvEXT))(texunit,coord,pname,params);this->m_checkErrors("glMultiTexGendvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC m_orig_glVertexArrayRangeNV = nullptr;
+void m_glVertexArrayRangeNV_validation(GLsizei length,const void* pointer)const{(this->*(this->m_orig_glVertexArrayRangeNV))(length,pointer);this->m_checkErrors("glVertexArrayRangeNV");}
+FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC m_orig_glIsTextureHandleResidentNV = nullptr;
+GLboolean m_glIsTextureHandleResidentNV_validation(GLuint64 handle)const{GLboolean const result = (this->*(this->m_orig_glIsTextureHandleResidentNV))(handle);this->m_checkErrors("glIsTextureHandleResidentNV");return result;}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC m_orig_glGetProgramEnvParameterdvARB = nullptr;
+void m_glGetProgramEnvParameterdvARB_validation(GLenum target,GLuint index,GLdouble* params)const{(this->*(this->m_orig_glGetProgramEnvParameterdvARB))(target,index,params);this->m_checkErrors("glGetProgramEnvParameterdvARB");}
+FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC m_orig_glIsNamedStringARB = nullptr;
+GLboolean m_glIsNamedStringARB_validation(GLint namelen,const GLchar* name)const{GLboolean const result = (this->*(this->m_orig_glIsNamedStringARB))(namelen,name);this->m_checkErrors("glIsNamedStringARB");return result;}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC m_orig_glSecondaryColorFormatNV = nullptr;
+void m_glSecondaryColorFormatNV_validation(GLint size,GLenum type,GLsizei stride)const{(this->*(this->m_orig_glSecondaryColorFormatNV))(size,type,stride);this->m_checkErrors("glSecondaryColorFormatNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC m_orig_glVertexAttrib4ubvNV = nullptr;
+void m_glVertexAttrib4ubvNV_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttrib4ubvNV))(index,v);this->m_checkErrors("glVertexAttrib4ubvNV");}
+FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC m_orig_glTagSampleBufferSGIX = nullptr;
+void m_glTagSampleBufferSGIX_validation()const{(this->*(this->m_orig_glTagSampleBufferSGIX))();this->m_checkErrors("glTagSampleBufferSGIX");}
+FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC m_orig_glVDPAUUnregisterSurfaceNV = nullptr;
+void m_glVDPAUUnregisterSurfaceNV_validation(GLvdpauSurfaceNV surface)const{(this->*(this->m_orig_glVDPAUUnregisterSurfaceNV))(surface);this->m_checkErrors("glVDPAUUnregisterSurfaceNV");}
+FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC m_orig_glGetPerfQueryIdByNameINTEL = nullptr;
+void m_glGetPerfQueryIdByNameINTEL_validation(GLchar* queryName,GLuint* queryId)const{(this->*(this->m_orig_glGetPerfQueryIdByNameINTEL))(queryName,queryId);this->m_checkErrors("glGetPerfQueryIdByNameINTEL");}
+FunctionTable::MEMBERPFNGLGETINTEGER64VPROC m_orig_glGetInteger64v = nullptr;
+void m_glGetInteger64v_validation(GLenum pname,GLint64* data)const{(this->*(this->m_orig_glGetInteger64v))(pname,data);this->m_checkErrors("glGetInteger64v");}
+FunctionTable::MEMBERPFNGLCLIPPLANEPROC m_orig_glClipPlane = nullptr;
+void m_glClipPlane_validation(GLenum plane,const GLdouble* equation)const{(this->*(this->m_orig_glClipPlane))(plane,equation);this->m_checkErrors("glClipPlane");}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC m_orig_glColor4ubVertex3fSUN = nullptr;
+void m_glColor4ubVertex3fSUN_validation(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glColor4ubVertex3fSUN))(r,g,b,a,x,y,z);this->m_checkErrors("glColor4ubVertex3fSUN");}
+FunctionTable::MEMBERPFNGLINDEXUBPROC m_orig_glIndexub = nullptr;
+void m_glIndexub_validation(GLubyte c)const{(this->*(this->m_orig_glIndexub))(c);this->m_checkErrors("glIndexub");}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC m_orig_glGetProgramEnvParameterfvARB = nullptr;
+void m_glGetProgramEnvParameterfvARB_validation(GLenum target,GLuint index,GLfloat* params)const{(this->*(this->m_orig_glGetProgramEnvParameterfvARB))(target,index,params);this->m_checkErrors("glGetProgramEnvParameterfvARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC m_orig_glVertexAttrib4usvARB = nullptr;
+void m_glVertexAttrib4usvARB_validation(GLuint index,const GLushort* v)const{(this->*(this->m_orig_glVertexAttrib4usvARB))(index,v);this->m_checkErrors("glVertexAttrib4usvARB");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC m_orig_glNamedFramebufferRenderbuffer = nullptr;
+void m_glNamedFramebufferRenderbuffer_validation(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{(this->*(this->m_orig_glNamedFramebufferRenderbuffer))(framebuffer,attachment,renderbuffertarget,renderbuffer);this->m_checkErrors("glNamedFramebufferRenderbuffer");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC m_orig_glProgramUniformMatrix3x4dv = nullptr;
+void m_glProgramUniformMatrix3x4dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x4dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x4dv");}
+FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC m_orig_glTestFenceAPPLE = nullptr;
+GLboolean m_glTestFenceAPPLE_validation(GLuint fence)const{GLboolean const result = (this->*(this->m_orig_glTestFenceAPPLE))(fence);this->m_checkErrors("glTestFenceAPPLE");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC m_orig_glVertexAttrib4Niv = nullptr;
+void m_glVertexAttrib4Niv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttrib4Niv))(index,v);this->m_checkErrors("glVertexAttrib4Niv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC m_orig_glVertexAttribL2i64vNV = nullptr;
+void m_glVertexAttribL2i64vNV_validation(GLuint index,const GLint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL2i64vNV))(index,v);this->m_checkErrors("glVertexAttribL2i64vNV");}
+FunctionTable::MEMBERPFNGLCOLORP4UIVPROC m_orig_glColorP4uiv = nullptr;
+void m_glColorP4uiv_validation(GLenum type,const GLuint* color)const{(this->*(this->m_orig_glColorP4uiv))(type,color);this->m_checkErrors("glColorP4uiv");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC m_orig_glUniformMatrix2x3fv = nullptr;
+void m_glUniformMatrix2x3fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix2x3fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2x3fv");}
+FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC m_orig_glCallCommandListNV = nullptr;
+void m_glCallCommandListNV_validation(GLuint list)const{(this->*(this->m_orig_glCallCommandListNV))(list);this->m_checkErrors("glCallCommandListNV");}
+FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC m_orig_glClearBufferiv = nullptr;
+void m_glClearBufferiv_validation(GLenum buffer,GLint drawbuffer,const GLint* value)const{(this->*(this->m_orig_glClearBufferiv))(buffer,drawbuffer,value);this->m_checkErrors("glClearBufferiv");}
+FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC m_orig_glNamedStringARB = nullptr;
+void m_glNamedStringARB_validation(GLenum type,GLint namelen,const GLchar* name,GLint stringlen,const GLchar* string)const{(this->*(this->m_orig_glNamedStringARB))(type,namelen,name,stringlen,string);this->m_checkErrors("glNamedStringARB");}
+FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC m_orig_glMatrixMult3x2fNV = nullptr;
+void m_glMatrixMult3x2fNV_validation(GLenum matrixMode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixMult3x2fNV))(matrixMode,m);this->m_checkErrors("glMatrixMult3x2fNV");}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC m_orig_glGetNamedProgramStringEXT = nullptr;
+void m_glGetNamedProgramStringEXT_validation(GLuint program,GLenum target,GLenum pname,void* string)const{(this->*(this->m_orig_glGetNamedProgramStringEXT))(program,target,pname,string);this->m_checkErrors("glGetNamedProgramStringEXT");}
+FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC m_orig_glGetnHistogramARB = nullptr;
+void m_glGetnHistogramARB_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{(this->*(this->m_orig_glGetnHistogramARB))(target,reset,format,type,bufSize,values);this->m_checkErrors("glGetnHistogramARB");}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC m_orig_glGetTextureLevelParameterfv = nullptr;
+void m_glGetTextureLevelParameterfv_validation(GLuint texture,GLint level,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTextureLevelParameterfv))(texture,level,pname,params);this->m_checkErrors("glGetTextureLevelParameterfv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC m_orig_glMultiTexCoord1fv = nullptr;
+void m_glMultiTexCoord1fv_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord1fv))(target,v);this->m_checkErrors("glMultiTexCoord1fv");}
+FunctionTable::MEMBERPFNGLBITMAPXOESPROC m_orig_glBitmapxOES = nullptr;
+void m_glBitmapxOES_validation(GLsizei width,GLsizei height,GLfixed xorig,GLfixed yorig,GLfixed xmove,GLfixed ymove,const GLubyte* bitmap)const{(this->*(this->m_orig_glBitmapxOES))(width,height,xorig,yorig,xmove,ymove,bitmap);this->m_checkErrors("glBitmapxOES");}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC m_orig_glGetSamplerParameterIuiv = nullptr;
+void m_glGetSamplerParameterIuiv_validation(GLuint sampler,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetSamplerParameterIuiv))(sampler,pname,params);this->m_checkErrors("glGetSamplerParameterIuiv");}
+FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC m_orig_glTexCoordP3ui = nullptr;
+void m_glTexCoordP3ui_validation(GLenum type,GLuint coords)const{(this->*(this->m_orig_glTexCoordP3ui))(type,coords);this->m_checkErrors("glTexCoordP3ui");}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC m_orig_glTextureSubImage1D = nullptr;
+void m_glTextureSubImage1D_validation(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureSubImage1D))(texture,level,xoffset,width,format,type,pixels);this->m_checkErrors("glTextureSubImage1D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC m_orig_glVertexAttribLPointerEXT = nullptr;
+void m_glVertexAttribLPointerEXT_validation(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribLPointerEXT))(index,size,type,stride,pointer);this->m_checkErrors("glVertexAttribLPointerEXT");}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC m_orig_glFogCoordPointerEXT = nullptr;
+void m_glFogCoordPointerEXT_validation(GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glFogCoordPointerEXT))(type,stride,pointer);this->m_checkErrors("glFogCoordPointerEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC m_orig_glWindowPos3s = nullptr;
+void m_glWindowPos3s_validation(GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glWindowPos3s))(x,y,z);this->m_checkErrors("glWindowPos3s");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC m_orig_glVertexAttribs2svNV = nullptr;
+void m_glVertexAttribs2svNV_validation(GLuint index,GLsizei count,const GLshort* v)const{(this->*(this->m_orig_glVertexAttribs2svNV))(index,count,v);this->m_checkErrors("glVertexAttribs2svNV");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC m_orig_glTextureImage3DEXT = nullptr;
+void m_glTextureImage3DEXT_validation(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureImage3DEXT))(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);this->m_checkErrors("glTextureImage3DEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC m_orig_glWindowPos3i = nullptr;
+void m_glWindowPos3i_validation(GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glWindowPos3i))(x,y,z);this->m_checkErrors("glWindowPos3i");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC m_orig_glWindowPos3d = nullptr;
+void m_glWindowPos3d_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glWindowPos3d))(x,y,z);this->m_checkErrors("glWindowPos3d");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC m_orig_glWindowPos3f = nullptr;
+void m_glWindowPos3f_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glWindowPos3f))(x,y,z);this->m_checkErrors("glWindowPos3f");}
+FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC m_orig_glIsEnabledIndexedEXT = nullptr;
+GLboolean m_glIsEnabledIndexedEXT_validation(GLenum target,GLuint index)const{GLboolean const result = (this->*(this->m_orig_glIsEnabledIndexedEXT))(target,index);this->m_checkErrors("glIsEnabledIndexedEXT");return result;}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC m_orig_glGetNamedProgramivEXT = nullptr;
+void m_glGetNamedProgramivEXT_validation(GLuint program,GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedProgramivEXT))(program,target,pname,params);this->m_checkErrors("glGetNamedProgramivEXT");}
+FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC m_orig_glVertex3xvOES = nullptr;
+void m_glVertex3xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glVertex3xvOES))(coords);this->m_checkErrors("glVertex3xvOES");}
+FunctionTable::MEMBERPFNGLCOLOR3USPROC m_orig_glColor3us = nullptr;
+void m_glColor3us_validation(GLushort red,GLushort green,GLushort blue)const{(this->*(this->m_orig_glColor3us))(red,green,blue);this->m_checkErrors("glColor3us");}
+FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC m_orig_glBeginPerfMonitorAMD = nullptr;
+void m_glBeginPerfMonitorAMD_validation(GLuint monitor)const{(this->*(this->m_orig_glBeginPerfMonitorAMD))(monitor);this->m_checkErrors("glBeginPerfMonitorAMD");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC m_orig_glProgramUniformMatrix4x3dv = nullptr;
+void m_glProgramUniformMatrix4x3dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x3dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x3dv");}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC m_orig_glGetNamedProgramLocalParameterIuivEXT = nullptr;
+void m_glGetNamedProgramLocalParameterIuivEXT_validation(GLuint program,GLenum target,GLuint index,GLuint* params)const{(this->*(this->m_orig_glGetNamedProgramLocalParameterIuivEXT))(program,target,index,params);this->m_checkErrors("glGetNamedProgramLocalParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLREADNPIXELSPROC m_orig_glReadnPixels = nullptr;
+void m_glReadnPixels_validation(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{(this->*(this->m_orig_glReadnPixels))(x,y,width,height,format,type,bufSize,data);this->m_checkErrors("glReadnPixels");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC m_orig_glMultiTexCoord4f = nullptr;
+void m_glMultiTexCoord4f_validation(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{(this->*(this->m_orig_glMultiTexCoord4f))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4f");}
+FunctionTable::MEMBERPFNGLCOLOR3UBPROC m_orig_glColor3ub = nullptr;
+void m_glColor3ub_validation(GLubyte red,GLubyte green,GLubyte blue)const{(this->*(this->m_orig_glColor3ub))(red,green,blue);this->m_checkErrors("glColor3ub");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC m_orig_glMultiTexCoord4d = nullptr;
+void m_glMultiTexCoord4d_validation(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{(this->*(this->m_orig_glMultiTexCoord4d))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4d");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC m_orig_glVertexAttribL3ui64NV = nullptr;
+void m_glVertexAttribL3ui64NV_validation(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{(this->*(this->m_orig_glVertexAttribL3ui64NV))(index,x,y,z);this->m_checkErrors("glVertexAttribL3ui64NV");}
+FunctionTable::MEMBERPFNGLCOLOR3UIPROC m_orig_glColor3ui = nullptr;
+void m_glColor3ui_validation(GLuint red,GLuint green,GLuint blue)const{(this->*(this->m_orig_glColor3ui))(red,green,blue);this->m_checkErrors("glColor3ui");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC m_orig_glProgramUniform4fvEXT = nullptr;
+void m_glProgramUniform4fvEXT_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform4fvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform4fvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC m_orig_glVertexAttrib2sARB = nullptr;
+void m_glVertexAttrib2sARB_validation(GLuint index,GLshort x,GLshort y)const{(this->*(this->m_orig_glVertexAttrib2sARB))(index,x,y);this->m_checkErrors("glVertexAttrib2sARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC m_orig_glMultiTexCoord4i = nullptr;
+void m_glMultiTexCoord4i_validation(GLenum target,GLint s,GLint t,GLint r,GLint q)const{(this->*(this->m_orig_glMultiTexCoord4i))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4i");}
+FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC m_orig_glCheckFramebufferStatusEXT = nullptr;
+GLenum m_glCheckFramebufferStatusEXT_validation(GLenum target)const{GLenum const result = (this->*(this->m_orig_glCheckFramebufferStatusEXT))(target);this->m_checkErrors("glCheckFramebufferStatusEXT");return result;}
+FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC m_orig_glGetnMapivARB = nullptr;
+void m_glGetnMapivARB_validation(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{(this->*(this->m_orig_glGetnMapivARB))(target,query,bufSize,v);this->m_checkErrors("glGetnMapivARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC m_orig_glMultiTexCoord1ivARB = nullptr;
+void m_glMultiTexCoord1ivARB_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord1ivARB))(target,v);this->m_checkErrors("glMultiTexCoord1ivARB");}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC m_orig_glDisableVertexAttribArrayARB = nullptr;
+void m_glDisableVertexAttribArrayARB_validation(GLuint index)const{(this->*(this->m_orig_glDisableVertexAttribArrayARB))(index);this->m_checkErrors("glDisableVertexAttribArrayARB");}
+FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC m_orig_glGetPolygonStipple = nullptr;
+void m_glGetPolygonStipple_validation(GLubyte* mask)const{(this->*(this->m_orig_glGetPolygonStipple))(mask);this->m_checkErrors("glGetPolygonStipple");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC m_orig_glVertexAttribI4ui = nullptr;
+void m_glVertexAttribI4ui_validation(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{(this->*(this->m_orig_glVertexAttribI4ui))(index,x,y,z,w);this->m_checkErrors("glVertexAttribI4ui");}
+FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC m_orig_glGetPathDashArrayNV = nullptr;
+void m_glGetPathDashArrayNV_validation(GLuint path,GLfloat* dashArray)const{(this->*(this->m_orig_glGetPathDashArrayNV))(path,dashArray);this->m_checkErrors("glGetPathDashArrayNV");}
+FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC m_orig_glMultiTexRenderbufferEXT = nullptr;
+void m_glMultiTexRenderbufferEXT_validation(GLenum texunit,GLenum target,GLuint renderbuffer)const{(this->*(this->m_orig_glMultiTexRenderbufferEXT))(texunit,target,renderbuffer);this->m_checkErrors("glMultiTexRenderbufferEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC m_orig_glCopyTextureSubImage1D = nullptr;
+void m_glCopyTextureSubImage1D_validation(GLuint texture,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyTextureSubImage1D))(texture,level,xoffset,x,y,width);this->m_checkErrors("glCopyTextureSubImage1D");}
+FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC m_orig_glDeleteOcclusionQueriesNV = nullptr;
+void m_glDeleteOcclusionQueriesNV_validation(GLsizei n,const GLuint* ids)const{(this->*(this->m_orig_glDeleteOcclusionQueriesNV))(n,ids);this->m_checkErrors("glDeleteOcclusionQueriesNV");}
+FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC m_orig_glVertex4hvNV = nullptr;
+void m_glVertex4hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glVertex4hvNV))(v);this->m_checkErrors("glVertex4hvNV");}
+FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC m_orig_glGetnTexImage = nullptr;
+void m_glGetnTexImage_validation(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{(this->*(this->m_orig_glGetnTexImage))(target,level,format,type,bufSize,pixels);this->m_checkErrors("glGetnTexImage");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC m_orig_glProgramLocalParameter4dARB = nullptr;
+void m_glProgramLocalParameter4dARB_validation(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glProgramLocalParameter4dARB))(target,index,x,y,z,w);this->m_checkErrors("glProgramLocalParameter4dARB");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC m_orig_glBlendEquation = nullptr;
+void m_glBlendEquation_validation(GLenum mode)const{(this->*(this->m_orig_glBlendEquation))(mode);this->m_checkErrors("glBlendEquation");}
+FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC m_orig_glUnlockArraysEXT = nullptr;
+void m_glUnlockArraysEXT_validation()const{(this->*(this->m_orig_glUnlockArraysEXT))();this->m_checkErrors("glUnlockArraysEXT");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC m_orig_glGetQueryObjectui64vEXT = nullptr;
+void m_glGetQueryObjectui64vEXT_validation(GLuint id,GLenum pname,GLuint64* params)const{(this->*(this->m_orig_glGetQueryObjectui64vEXT))(id,pname,params);this->m_checkErrors("glGetQueryObjectui64vEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC m_orig_glVertexAttribI4uivEXT = nullptr;
+void m_glVertexAttribI4uivEXT_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI4uivEXT))(index,v);this->m_checkErrors("glVertexAttribI4uivEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC m_orig_glUniform1i64vNV = nullptr;
+void m_glUniform1i64vNV_validation(GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glUniform1i64vNV))(location,count,value);this->m_checkErrors("glUniform1i64vNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC m_orig_glMultiTexCoord3dv = nullptr;
+void m_glMultiTexCoord3dv_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord3dv))(target,v);this->m_checkErrors("glMultiTexCoord3dv");}
+FunctionTable::MEMBERPFNGLCOLOR4SVPROC m_orig_glColor4sv = nullptr;
+void m_glColor4sv_validation(const GLshort* v)const{(this->*(this->m_orig_glColor4sv))(v);this->m_checkErrors("glColor4sv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC m_orig_glVertexStream4ivATI = nullptr;
+void m_glVertexStream4ivATI_validation(GLenum stream,const GLint* coords)const{(this->*(this->m_orig_glVertexStream4ivATI))(stream,coords);this->m_checkErrors("glVertexStream4ivATI");}
+FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC m_orig_glPopClientAttrib = nullptr;
+void m_glPopClientAttrib_validation()const{(this->*(this->m_orig_glPopClientAttrib))();this->m_checkErrors("glPopClientAttrib");}
+FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC m_orig_glClearBufferData = nullptr;
+void m_glClearBufferData_validation(GLenum target,GLenum internalformat,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearBufferData))(target,internalformat,format,type,data);this->m_checkErrors("glClearBufferData");}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC m_orig_glGetProgramivNV = nullptr;
+void m_glGetProgramivNV_validation(GLuint id,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetProgramivNV))(id,pname,params);this->m_checkErrors("glGetProgramivNV");}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC m_orig_glBeginTransformFeedback = nullptr;
+void m_glBeginTransformFeedback_validation(GLenum primitiveMode)const{(this->*(this->m_orig_glBeginTransformFeedback))(primitiveMode);this->m_checkErrors("glBeginTransformFeedback");}
+FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC m_orig_glFinishObjectAPPLE = nullptr;
+void m_glFinishObjectAPPLE_validation(GLenum object,GLint name)const{(this->*(this->m_orig_glFinishObjectAPPLE))(object,name);this->m_checkErrors("glFinishObjectAPPLE");}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC m_orig_glGetMinmaxParameterivEXT = nullptr;
+void m_glGetMinmaxParameterivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMinmaxParameterivEXT))(target,pname,params);this->m_checkErrors("glGetMinmaxParameterivEXT");}
+FunctionTable::MEMBERPFNGLCOLOR3IVPROC m_orig_glColor3iv = nullptr;
+void m_glColor3iv_validation(const GLint* v)const{(this->*(this->m_orig_glColor3iv))(v);this->m_checkErrors("glColor3iv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC m_orig_glVertexAttrib3sv = nullptr;
+void m_glVertexAttrib3sv_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib3sv))(index,v);this->m_checkErrors("glVertexAttrib3sv");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC m_orig_glCompressedTexImage1D = nullptr;
+void m_glCompressedTexImage1D_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const GLvoid* data)const{(this->*(this->m_orig_glCompressedTexImage1D))(target,level,internalformat,width,border,imageSize,data);this->m_checkErrors("glCompressedTexImage1D");}
+FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC m_orig_glDeleteTransformFeedbacks = nullptr;
+void m_glDeleteTransformFeedbacks_validation(GLsizei n,const GLuint* ids)const{(this->*(this->m_orig_glDeleteTransformFeedbacks))(n,ids);this->m_checkErrors("glDeleteTransformFeedbacks");}
+FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC m_orig_glGetVideoi64vNV = nullptr;
+void m_glGetVideoi64vNV_validation(GLuint video_slot,GLenum pname,GLint64EXT* params)const{(this->*(this->m_orig_glGetVideoi64vNV))(video_slot,pname,params);this->m_checkErrors("glGetVideoi64vNV");}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC m_orig_glDrawRangeElementsBaseVertex = nullptr;
+void m_glDrawRangeElementsBaseVertex_validation(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{(this->*(this->m_orig_glDrawRangeElementsBaseVertex))(mode,start,end,count,type,indices,basevertex);this->m_checkErrors("glDrawRangeElementsBaseVertex");}
+FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC m_orig_glUniform4i64vARB = nullptr;
+void m_glUniform4i64vARB_validation(GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glUniform4i64vARB))(location,count,value);this->m_checkErrors("glUniform4i64vARB");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC m_orig_glTextureStorage3DMultisampleEXT = nullptr;
+void m_glTextureStorage3DMultisampleEXT_validation(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTextureStorage3DMultisampleEXT))(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);this->m_checkErrors("glTextureStorage3DMultisampleEXT");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC m_orig_glGetTexParameterfv = nullptr;
+void m_glGetTexParameterfv_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetTexParameterfv))(target,pname,params);this->m_checkErrors("glGetTexParameterfv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC m_orig_glProgramUniformui64vNV = nullptr;
+void m_glProgramUniformui64vNV_validation(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glProgramUniformui64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniformui64vNV");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC m_orig_glCompressedMultiTexImage1DEXT = nullptr;
+void m_glCompressedMultiTexImage1DEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedMultiTexImage1DEXT))(texunit,target,level,internalformat,width,border,imageSize,bits);this->m_checkErrors("glCompressedMultiTexImage1DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC m_orig_glProgramUniform2ivEXT = nullptr;
+void m_glProgramUniform2ivEXT_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform2ivEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform2ivEXT");}
+FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC m_orig_glPushGroupMarkerEXT = nullptr;
+void m_glPushGroupMarkerEXT_validation(GLsizei length,const GLchar* marker)const{(this->*(this->m_orig_glPushGroupMarkerEXT))(length,marker);this->m_checkErrors("glPushGroupMarkerEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC m_orig_glVertexAttrib1dv = nullptr;
+void m_glVertexAttrib1dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib1dv))(index,v);this->m_checkErrors("glVertexAttrib1dv");}
+FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC m_orig_glMatrixLoadIdentityEXT = nullptr;
+void m_glMatrixLoadIdentityEXT_validation(GLenum mode)const{(this->*(this->m_orig_glMatrixLoadIdentityEXT))(mode);this->m_checkErrors("glMatrixLoadIdentityEXT");}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC m_orig_glMultTransposeMatrixxOES = nullptr;
+void m_glMultTransposeMatrixxOES_validation(const GLfixed* m)const{(this->*(this->m_orig_glMultTransposeMatrixxOES))(m);this->m_checkErrors("glMultTransposeMatrixxOES");}
+FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC m_orig_glGetPixelMapxv = nullptr;
+void m_glGetPixelMapxv_validation(GLenum map,GLint size,GLfixed* values)const{(this->*(this->m_orig_glGetPixelMapxv))(map,size,values);this->m_checkErrors("glGetPixelMapxv");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC m_orig_glFramebufferSampleLocationsfvARB = nullptr;
+void m_glFramebufferSampleLocationsfvARB_validation(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glFramebufferSampleLocationsfvARB))(target,start,count,v);this->m_checkErrors("glFramebufferSampleLocationsfvARB");}
+FunctionTable::MEMBERPFNGLGETLIGHTIVPROC m_orig_glGetLightiv = nullptr;
+void m_glGetLightiv_validation(GLenum light,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetLightiv))(light,pname,params);this->m_checkErrors("glGetLightiv");}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC m_orig_glBlendFuncSeparatei = nullptr;
+void m_glBlendFuncSeparatei_validation(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{(this->*(this->m_orig_glBlendFuncSeparatei))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);this->m_checkErrors("glBlendFuncSeparatei");}
+FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC m_orig_glAcquireKeyedMutexWin32EXT = nullptr;
+GLboolean m_glAcquireKeyedMutexWin32EXT_validation(GLuint memory,GLuint64 key,GLuint timeout)const{GLboolean const result = (this->*(this->m_orig_glAcquireKeyedMutexWin32EXT))(memory,key,timeout);this->m_checkErrors("glAcquireKeyedMutexWin32EXT");return result;}
+FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC m_orig_glGetBooleanIndexedvEXT = nullptr;
+void m_glGetBooleanIndexedvEXT_validation(GLenum target,GLuint index,GLboolean* data)const{(this->*(this->m_orig_glGetBooleanIndexedvEXT))(target,index,data);this->m_checkErrors("glGetBooleanIndexedvEXT");}
+FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC m_orig_glGetProgramSubroutineParameteruivNV = nullptr;
+void m_glGetProgramSubroutineParameteruivNV_validation(GLenum target,GLuint index,GLuint* param)const{(this->*(this->m_orig_glGetProgramSubroutineParameteruivNV))(target,index,param);this->m_checkErrors("glGetProgramSubroutineParameteruivNV");}
+FunctionTable::MEMBERPFNGLUNIFORM2UIPROC m_orig_glUniform2ui = nullptr;
+void m_glUniform2ui_validation(GLint location,GLuint v0,GLuint v1)const{(this->*(this->m_orig_glUniform2ui))(location,v0,v1);this->m_checkErrors("glUniform2ui");}
+FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC m_orig_glApplyFramebufferAttachmentCMAAINTEL = nullptr;
+void m_glApplyFramebufferAttachmentCMAAINTEL_validation()const{(this->*(this->m_orig_glApplyFramebufferAttachmentCMAAINTEL))();this->m_checkErrors("glApplyFramebufferAttachmentCMAAINTEL");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC m_orig_glWindowPos2fv = nullptr;
+void m_glWindowPos2fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos2fv))(v);this->m_checkErrors("glWindowPos2fv");}
+FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC m_orig_glWaitVkSemaphoreNV = nullptr;
+void m_glWaitVkSemaphoreNV_validation(GLuint64 vkSemaphore)const{(this->*(this->m_orig_glWaitVkSemaphoreNV))(vkSemaphore);this->m_checkErrors("glWaitVkSemaphoreNV");}
+FunctionTable::MEMBERPFNGLDISABLEIPROC m_orig_glDisablei = nullptr;
+void m_glDisablei_validation(GLenum target,GLuint index)const{(this->*(this->m_orig_glDisablei))(target,index);this->m_checkErrors("glDisablei");}
+FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC m_orig_glSelectPerfMonitorCountersAMD = nullptr;
+void m_glSelectPerfMonitorCountersAMD_validation(GLuint monitor,GLboolean enable,GLuint group,GLint numCounters,GLuint* counterList)const{(this->*(this->m_orig_glSelectPerfMonitorCountersAMD))(monitor,enable,group,numCounters,counterList);this->m_checkErrors("glSelectPerfMonitorCountersAMD");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC m_orig_glGetVertexAttribLi64vNV = nullptr;
+void m_glGetVertexAttribLi64vNV_validation(GLuint index,GLenum pname,GLint64EXT* params)const{(this->*(this->m_orig_glGetVertexAttribLi64vNV))(index,pname,params);this->m_checkErrors("glGetVertexAttribLi64vNV");}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC m_orig_glBlendFuncSeparateiARB = nullptr;
+void m_glBlendFuncSeparateiARB_validation(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{(this->*(this->m_orig_glBlendFuncSeparateiARB))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);this->m_checkErrors("glBlendFuncSeparateiARB");}
+FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC m_orig_glWeightuivARB = nullptr;
+void m_glWeightuivARB_validation(GLint size,const GLuint* weights)const{(this->*(this->m_orig_glWeightuivARB))(size,weights);this->m_checkErrors("glWeightuivARB");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC m_orig_glWindowPos2iARB = nullptr;
+void m_glWindowPos2iARB_validation(GLint x,GLint y)const{(this->*(this->m_orig_glWindowPos2iARB))(x,y);this->m_checkErrors("glWindowPos2iARB");}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC m_orig_glGetProgramLocalParameterdvARB = nullptr;
+void m_glGetProgramLocalParameterdvARB_validation(GLenum target,GLuint index,GLdouble* params)const{(this->*(this->m_orig_glGetProgramLocalParameterdvARB))(target,index,params);this->m_checkErrors("glGetProgramLocalParameterdvARB");}
+FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC m_orig_glGetUniformui64vARB = nullptr;
+void m_glGetUniformui64vARB_validation(GLuint program,GLint location,GLuint64* params)const{(this->*(this->m_orig_glGetUniformui64vARB))(program,location,params);this->m_checkErrors("glGetUniformui64vARB");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC m_orig_glSecondaryColor3us = nullptr;
+void m_glSecondaryColor3us_validation(GLushort red,GLushort green,GLushort blue)const{(this->*(this->m_orig_glSecondaryColor3us))(red,green,blue);this->m_checkErrors("glSecondaryColor3us");}
+FunctionTable::MEMBERPFNGLGETSYNCIVPROC m_orig_glGetSynciv = nullptr;
+void m_glGetSynciv_validation(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{(this->*(this->m_orig_glGetSynciv))(sync,pname,bufSize,length,values);this->m_checkErrors("glGetSynciv");}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC m_orig_glMakeImageHandleResidentARB = nullptr;
+void m_glMakeImageHandleResidentARB_validation(GLuint64 handle,GLenum access)const{(this->*(this->m_orig_glMakeImageHandleResidentARB))(handle,access);this->m_checkErrors("glMakeImageHandleResidentARB");}
+FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC m_orig_glGetProgramNamedParameterfvNV = nullptr;
+void m_glGetProgramNamedParameterfvNV_validation(GLuint id,GLsizei len,const GLubyte* name,GLfloat* params)const{(this->*(this->m_orig_glGetProgramNamedParameterfvNV))(id,len,name,params);this->m_checkErrors("glGetProgramNamedParameterfvNV");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC m_orig_glTextureStorage3D = nullptr;
+void m_glTextureStorage3D_validation(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{(this->*(this->m_orig_glTextureStorage3D))(texture,levels,internalformat,width,height,depth);this->m_checkErrors("glTextureStorage3D");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC m_orig_glVertexAttrib4svNV = nullptr;
+void m_glVertexAttrib4svNV_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib4svNV))(index,v);this->m_checkErrors("glVertexAttrib4svNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC m_orig_glProgramUniform2i = nullptr;
+void m_glProgramUniform2i_validation(GLuint program,GLint location,GLint v0,GLint v1)const{(this->*(this->m_orig_glProgramUniform2i))(program,location,v0,v1);this->m_checkErrors("glProgramUniform2i");}
+FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC m_orig_glListDrawCommandsStatesClientNV = nullptr;
+void m_glListDrawCommandsStatesClientNV_validation(GLuint list,GLuint segment,const void** indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{(this->*(this->m_orig_glListDrawCommandsStatesClientNV))(list,segment,indirects,sizes,states,fbos,count);this->m_checkErrors("glListDrawCommandsStatesClientNV");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC m_orig_glProgramLocalParametersI4uivNV = nullptr;
+void m_glProgramLocalParametersI4uivNV_validation(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{(this->*(this->m_orig_glProgramLocalParametersI4uivNV))(target,index,count,params);this->m_checkErrors("glProgramLocalParametersI4uivNV");}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC m_orig_glBeginTransformFeedbackNV = nullptr;
+void m_glBeginTransformFeedbackNV_validation(GLenum primitiveMode)const{(this->*(this->m_orig_glBeginTransformFeedbackNV))(primitiveMode);this->m_checkErrors("glBeginTransformFeedbackNV");}
+FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC m_orig_glGetProgramBinary = nullptr;
+void m_glGetProgramBinary_validation(GLuint program,GLsizei bufSize,GLsizei* length,GLenum* binaryFormat,void* binary)const{(this->*(this->m_orig_glGetProgramBinary))(program,bufSize,length,binaryFormat,binary);this->m_checkErrors("glGetProgramBinary");}
+FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC m_orig_glBinormal3iEXT = nullptr;
+void m_glBinormal3iEXT_validation(GLint bx,GLint by,GLint bz)const{(this->*(this->m_orig_glBinormal3iEXT))(bx,by,bz);this->m_checkErrors("glBinormal3iEXT");}
+FunctionTable::MEMBERPFNGLEVALPOINT1PROC m_orig_glEvalPoint1 = nullptr;
+void m_glEvalPoint1_validation(GLint i)const{(this->*(this->m_orig_glEvalPoint1))(i);this->m_checkErrors("glEvalPoint1");}
+FunctionTable::MEMBERPFNGLEVALPOINT2PROC m_orig_glEvalPoint2 = nullptr;
+void m_glEvalPoint2_validation(GLint i,GLint j)const{(this->*(this->m_orig_glEvalPoint2))(i,j);this->m_checkErrors("glEvalPoint2");}
+FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC m_orig_glPauseTransformFeedback = nullptr;
+void m_glPauseTransformFeedback_validation()const{(this->*(this->m_orig_glPauseTransformFeedback))();this->m_checkErrors("glPauseTransformFeedback");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC m_orig_glWindowPos2sMESA = nullptr;
+void m_glWindowPos2sMESA_validation(GLshort x,GLshort y)const{(this->*(this->m_orig_glWindowPos2sMESA))(x,y);this->m_checkErrors("glWindowPos2sMESA");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC m_orig_glGlobalAlphaFactorbSUN = nullptr;
+void m_glGlobalAlphaFactorbSUN_validation(GLbyte factor)const{(this->*(this->m_orig_glGlobalAlphaFactorbSUN))(factor);this->m_checkErrors("glGlobalAlphaFactorbSUN");}
+FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC m_orig_glCreateTransformFeedbacks = nullptr;
+void m_glCreateTransformFeedbacks_validation(GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glCreateTransformFeedbacks))(n,ids);this->m_checkErrors("glCreateTransformFeedbacks");}
+FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC m_orig_glTexturePageCommitmentEXT = nullptr;
+void m_glTexturePageCommitmentEXT_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{(this->*(this->m_orig_glTexturePageCommitmentEXT))(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);this->m_checkErrors("glTexturePageCommitmentEXT");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC m_orig_glTransformFeedbackVaryingsNV = nullptr;
+void m_glTransformFeedbackVaryingsNV_validation(GLuint program,GLsizei count,const GLint* locations,GLenum bufferMode)const{(this->*(this->m_orig_glTransformFeedbackVaryingsNV))(program,count,locations,bufferMode);this->m_checkErrors("glTransformFeedbackVaryingsNV");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC m_orig_glTexSubImage1D = nullptr;
+void m_glTexSubImage1D_validation(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const GLvoid* pixels)const{(this->*(this->m_orig_glTexSubImage1D))(target,level,xoffset,width,format,type,pixels);this->m_checkErrors("glTexSubImage1D");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC m_orig_glConvolutionParameterfvEXT = nullptr;
+void m_glConvolutionParameterfvEXT_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glConvolutionParameterfvEXT))(target,pname,params);this->m_checkErrors("glConvolutionParameterfvEXT");}
+FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC m_orig_glBlitFramebufferEXT = nullptr;
+void m_glBlitFramebufferEXT_validation(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{(this->*(this->m_orig_glBlitFramebufferEXT))(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);this->m_checkErrors("glBlitFramebufferEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC m_orig_glUniformMatrix4fvARB = nullptr;
+void m_glUniformMatrix4fvARB_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix4fvARB))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4fvARB");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC m_orig_glProgramEnvParameter4dvARB = nullptr;
+void m_glProgramEnvParameter4dvARB_validation(GLenum target,GLuint index,const GLdouble* params)const{(this->*(this->m_orig_glProgramEnvParameter4dvARB))(target,index,params);this->m_checkErrors("glProgramEnvParameter4dvARB");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC m_orig_glTextureStorageMem2DEXT = nullptr;
+void m_glTextureStorageMem2DEXT_validation(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTextureStorageMem2DEXT))(texture,levels,internalFormat,width,height,memory,offset);this->m_checkErrors("glTextureStorageMem2DEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC m_orig_glVertexAttribP3uiv = nullptr;
+void m_glVertexAttribP3uiv_validation(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{(this->*(this->m_orig_glVertexAttribP3uiv))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP3uiv");}
+FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC m_orig_glFogCoordFormatNV = nullptr;
+void m_glFogCoordFormatNV_validation(GLenum type,GLsizei stride)const{(this->*(this->m_orig_glFogCoordFormatNV))(type,stride);this->m_checkErrors("glFogCoordFormatNV");}
+FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC m_orig_glGetMultiTexLevelParameterivEXT = nullptr;
+void m_glGetMultiTexLevelParameterivEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMultiTexLevelParameterivEXT))(texunit,target,level,pname,params);this->m_checkErrors("glGetMultiTexLevelParameterivEXT");}
+FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC m_orig_glIsOcclusionQueryNV = nullptr;
+GLboolean m_glIsOcclusionQueryNV_validation(GLuint id)const{GLboolean const result = (this->*(this->m_orig_glIsOcclusionQueryNV))(id);this->m_checkErrors("glIsOcclusionQueryNV");return result;}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC m_orig_glCompressedTexImage2DARB = nullptr;
+void m_glCompressedTexImage2DARB_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTexImage2DARB))(target,level,internalformat,width,height,border,imageSize,data);this->m_checkErrors("glCompressedTexImage2DARB");}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC m_orig_glGetProgramEnvParameterIuivNV = nullptr;
+void m_glGetProgramEnvParameterIuivNV_validation(GLenum target,GLuint index,GLuint* params)const{(this->*(this->m_orig_glGetProgramEnvParameterIuivNV))(target,index,params);this->m_checkErrors("glGetProgramEnvParameterIuivNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC m_orig_glVertexAttrib4sv = nullptr;
+void m_glVertexAttrib4sv_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib4sv))(index,v);this->m_checkErrors("glVertexAttrib4sv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC m_orig_glVertexAttrib4fvARB = nullptr;
+void m_glVertexAttrib4fvARB_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib4fvARB))(index,v);this->m_checkErrors("glVertexAttrib4fvARB");}
+FunctionTable::MEMBERPFNGLLOADNAMEPROC m_orig_glLoadName = nullptr;
+void m_glLoadName_validation(GLuint name)const{(this->*(this->m_orig_glLoadName))(name);this->m_checkErrors("glLoadName");}
+FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC m_orig_glBindVertexShaderEXT = nullptr;
+void m_glBindVertexShaderEXT_validation(GLuint id)const{(this->*(this->m_orig_glBindVertexShaderEXT))(id);this->m_checkErrors("glBindVertexShaderEXT");}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC m_orig_glGetNamedProgramLocalParameterIivEXT = nullptr;
+void m_glGetNamedProgramLocalParameterIivEXT_validation(GLuint program,GLenum target,GLuint index,GLint* params)const{(this->*(this->m_orig_glGetNamedProgramLocalParameterIivEXT))(program,target,index,params);this->m_checkErrors("glGetNamedProgramLocalParameterIivEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC m_orig_glProgramUniform3uiEXT = nullptr;
+void m_glProgramUniform3uiEXT_validation(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{(this->*(this->m_orig_glProgramUniform3uiEXT))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3uiEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC m_orig_glProgramUniformMatrix4x2dvEXT = nullptr;
+void m_glProgramUniformMatrix4x2dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x2dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x2dvEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC m_orig_glTexCoord1hvNV = nullptr;
+void m_glTexCoord1hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glTexCoord1hvNV))(v);this->m_checkErrors("glTexCoord1hvNV");}
+FunctionTable::MEMBERPFNGLLOADMATRIXDPROC m_orig_glLoadMatrixd = nullptr;
+void m_glLoadMatrixd_validation(const GLdouble* m)const{(this->*(this->m_orig_glLoadMatrixd))(m);this->m_checkErrors("glLoadMatrixd");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC m_orig_glTexParameterfv = nullptr;
+void m_glTexParameterfv_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glTexParameterfv))(target,pname,params);this->m_checkErrors("glTexParameterfv");}
+FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC m_orig_glVariantdvEXT = nullptr;
+void m_glVariantdvEXT_validation(GLuint id,const GLdouble* addr)const{(this->*(this->m_orig_glVariantdvEXT))(id,addr);this->m_checkErrors("glVariantdvEXT");}
+FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC m_orig_glCullParameterfvEXT = nullptr;
+void m_glCullParameterfvEXT_validation(GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glCullParameterfvEXT))(pname,params);this->m_checkErrors("glCullParameterfvEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM3DVPROC m_orig_glUniform3dv = nullptr;
+void m_glUniform3dv_validation(GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glUniform3dv))(location,count,value);this->m_checkErrors("glUniform3dv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC m_orig_glProgramUniform3fv = nullptr;
+void m_glProgramUniform3fv_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform3fv))(program,location,count,value);this->m_checkErrors("glProgramUniform3fv");}
+FunctionTable::MEMBERPFNGLISBUFFERARBPROC m_orig_glIsBufferARB = nullptr;
+GLboolean m_glIsBufferARB_validation(GLuint buffer)const{GLboolean const result = (this->*(this->m_orig_glIsBufferARB))(buffer);this->m_checkErrors("glIsBufferARB");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC m_orig_glMultiTexCoord1bOES = nullptr;
+void m_glMultiTexCoord1bOES_validation(GLenum texture,GLbyte s)const{(this->*(this->m_orig_glMultiTexCoord1bOES))(texture,s);this->m_checkErrors("glMultiTexCoord1bOES");}
+FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC m_orig_glFogCoordhNV = nullptr;
+void m_glFogCoordhNV_validation(GLhalfNV fog)const{(this->*(this->m_orig_glFogCoordhNV))(fog);this->m_checkErrors("glFogCoordhNV");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_orig_glFramebufferSampleLocationsfvNV = nullptr;
+void m_glFramebufferSampleLocationsfvNV_validation(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glFramebufferSampleLocationsfvNV))(target,start,count,v);this->m_checkErrors("glFramebufferSampleLocationsfvNV");}
+FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC m_orig_glGenSymbolsEXT = nullptr;
+GLuint m_glGenSymbolsEXT_validation(GLenum datatype,GLenum storagetype,GLenum range,GLuint components)const{GLuint const result = (this->*(this->m_orig_glGenSymbolsEXT))(datatype,storagetype,range,components);this->m_checkErrors("glGenSymbolsEXT");return result;}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC m_orig_glGetConvolutionFilter = nullptr;
+void m_glGetConvolutionFilter_validation(GLenum target,GLenum format,GLenum type,GLvoid* image)const{(this->*(this->m_orig_glGetConvolutionFilter))(target,format,type,image);this->m_checkErrors("glGetConvolutionFilter");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC m_orig_glProgramUniform1fvEXT = nullptr;
+void m_glProgramUniform1fvEXT_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform1fvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform1fvEXT");}
+FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC m_orig_glGetNextPerfQueryIdINTEL = nullptr;
+void m_glGetNextPerfQueryIdINTEL_validation(GLuint queryId,GLuint* nextQueryId)const{(this->*(this->m_orig_glGetNextPerfQueryIdINTEL))(queryId,nextQueryId);this->m_checkErrors("glGetNextPerfQueryIdINTEL");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC m_orig_glCompressedTexImage1DARB = nullptr;
+void m_glCompressedTexImage1DARB_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTexImage1DARB))(target,level,internalformat,width,border,imageSize,data);this->m_checkErrors("glCompressedTexImage1DARB");}
+FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC m_orig_glBindSamplers = nullptr;
+void m_glBindSamplers_validation(GLuint first,GLsizei count,const GLuint* samplers)const{(this->*(this->m_orig_glBindSamplers))(first,count,samplers);this->m_checkErrors("glBindSamplers");}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC m_orig_glGetProgramEnvParameterIivNV = nullptr;
+void m_glGetProgramEnvParameterIivNV_validation(GLenum target,GLuint index,GLint* params)const{(this->*(this->m_orig_glGetProgramEnvParameterIivNV))(target,index,params);this->m_checkErrors("glGetProgramEnvParameterIivNV");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC m_orig_glGetQueryObjectui64v = nullptr;
+void m_glGetQueryObjectui64v_validation(GLuint id,GLenum pname,GLuint64* params)const{(this->*(this->m_orig_glGetQueryObjectui64v))(id,pname,params);this->m_checkErrors("glGetQueryObjectui64v");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC m_orig_glVertexAttribL4ui64vNV = nullptr;
+void m_glVertexAttribL4ui64vNV_validation(GLuint index,const GLuint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL4ui64vNV))(index,v);this->m_checkErrors("glVertexAttribL4ui64vNV");}
+FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC m_orig_glGetVideoivNV = nullptr;
+void m_glGetVideoivNV_validation(GLuint video_slot,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVideoivNV))(video_slot,pname,params);this->m_checkErrors("glGetVideoivNV");}
+FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC m_orig_glGetTextureImage = nullptr;
+void m_glGetTextureImage_validation(GLuint texture,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{(this->*(this->m_orig_glGetTextureImage))(texture,level,format,type,bufSize,pixels);this->m_checkErrors("glGetTextureImage");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC m_orig_glProgramUniform1fv = nullptr;
+void m_glProgramUniform1fv_validation(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniform1fv))(program,location,count,value);this->m_checkErrors("glProgramUniform1fv");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC m_orig_glUniformMatrix4fv = nullptr;
+void m_glUniformMatrix4fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix4fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4fv");}
+FunctionTable::MEMBERPFNGLCOLORMASKPROC m_orig_glColorMask = nullptr;
+void m_glColorMask_validation(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{(this->*(this->m_orig_glColorMask))(red,green,blue,alpha);this->m_checkErrors("glColorMask");}
+FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC m_orig_glBeginFragmentShaderATI = nullptr;
+void m_glBeginFragmentShaderATI_validation()const{(this->*(this->m_orig_glBeginFragmentShaderATI))();this->m_checkErrors("glBeginFragmentShaderATI");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC m_orig_glMultiDrawArraysEXT = nullptr;
+void m_glMultiDrawArraysEXT_validation(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{(this->*(this->m_orig_glMultiDrawArraysEXT))(mode,first,count,primcount);this->m_checkErrors("glMultiDrawArraysEXT");}
+FunctionTable::MEMBERPFNGLGENNAMESAMDPROC m_orig_glGenNamesAMD = nullptr;
+void m_glGenNamesAMD_validation(GLenum identifier,GLuint num,GLuint* names)const{(this->*(this->m_orig_glGenNamesAMD))(identifier,num,names);this->m_checkErrors("glGenNamesAMD");}
+FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC m_orig_glPathParameteriNV = nullptr;
+void m_glPathParameteriNV_validation(GLuint path,GLenum pname,GLint value)const{(this->*(this->m_orig_glPathParameteriNV))(path,pname,value);this->m_checkErrors("glPathParameteriNV");}
+FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC m_orig_glCreateCommandListsNV = nullptr;
+void m_glCreateCommandListsNV_validation(GLsizei n,GLuint* lists)const{(this->*(this->m_orig_glCreateCommandListsNV))(n,lists);this->m_checkErrors("glCreateCommandListsNV");}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC m_orig_glDeleteProgramPipelines = nullptr;
+void m_glDeleteProgramPipelines_validation(GLsizei n,const GLuint* pipelines)const{(this->*(this->m_orig_glDeleteProgramPipelines))(n,pipelines);this->m_checkErrors("glDeleteProgramPipelines");}
+FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC m_orig_glCopyColorSubTableEXT = nullptr;
+void m_glCopyColorSubTableEXT_validation(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyColorSubTableEXT))(target,start,x,y,width);this->m_checkErrors("glCopyColorSubTableEXT");}
+FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC m_orig_glVariantsvEXT = nullptr;
+void m_glVariantsvEXT_validation(GLuint id,const GLshort* addr)const{(this->*(this->m_orig_glVariantsvEXT))(id,addr);this->m_checkErrors("glVariantsvEXT");}
+FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC m_orig_glGenProgramPipelines = nullptr;
+void m_glGenProgramPipelines_validation(GLsizei n,GLuint* pipelines)const{(this->*(this->m_orig_glGenProgramPipelines))(n,pipelines);this->m_checkErrors("glGenProgramPipelines");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC m_orig_glVertexArrayEdgeFlagOffsetEXT = nullptr;
+void m_glVertexArrayEdgeFlagOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArrayEdgeFlagOffsetEXT))(vaobj,buffer,stride,offset);this->m_checkErrors("glVertexArrayEdgeFlagOffsetEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC m_orig_glWindowPos2s = nullptr;
+void m_glWindowPos2s_validation(GLshort x,GLshort y)const{(this->*(this->m_orig_glWindowPos2s))(x,y);this->m_checkErrors("glWindowPos2s");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC m_orig_glSecondaryColor3iEXT = nullptr;
+void m_glSecondaryColor3iEXT_validation(GLint red,GLint green,GLint blue)const{(this->*(this->m_orig_glSecondaryColor3iEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3iEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC m_orig_glWindowPos2i = nullptr;
+void m_glWindowPos2i_validation(GLint x,GLint y)const{(this->*(this->m_orig_glWindowPos2i))(x,y);this->m_checkErrors("glWindowPos2i");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC m_orig_glWindowPos2f = nullptr;
+void m_glWindowPos2f_validation(GLfloat x,GLfloat y)const{(this->*(this->m_orig_glWindowPos2f))(x,y);this->m_checkErrors("glWindowPos2f");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC m_orig_glWindowPos2d = nullptr;
+void m_glWindowPos2d_validation(GLdouble x,GLdouble y)const{(this->*(this->m_orig_glWindowPos2d))(x,y);this->m_checkErrors("glWindowPos2d");}
+FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC m_orig_glUniform4uivEXT = nullptr;
+void m_glUniform4uivEXT_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform4uivEXT))(location,count,value);this->m_checkErrors("glUniform4uivEXT");}
+FunctionTable::MEMBERPFNGLORTHOXOESPROC m_orig_glOrthoxOES = nullptr;
+void m_glOrthoxOES_validation(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{(this->*(this->m_orig_glOrthoxOES))(l,r,b,t,n,f);this->m_checkErrors("glOrthoxOES");}
+FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC m_orig_glUniformSubroutinesuiv = nullptr;
+void m_glUniformSubroutinesuiv_validation(GLenum shadertype,GLsizei count,const GLuint* indices)const{(this->*(this->m_orig_glUniformSubroutinesuiv))(shadertype,count,indices);this->m_checkErrors("glUniformSubroutinesuiv");}
+FunctionTable::MEMBERPFNGLRECTDVPROC m_orig_glRectdv = nullptr;
+void m_glRectdv_validation(const GLdouble* v1,const GLdouble* v2)const{(this->*(this->m_orig_glRectdv))(v1,v2);this->m_checkErrors("glRectdv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC m_orig_glProgramUniform1i64vNV = nullptr;
+void m_glProgramUniform1i64vNV_validation(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glProgramUniform1i64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform1i64vNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC m_orig_glVertexAttribI4uiEXT = nullptr;
+void m_glVertexAttribI4uiEXT_validation(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{(this->*(this->m_orig_glVertexAttribI4uiEXT))(index,x,y,z,w);this->m_checkErrors("glVertexAttribI4uiEXT");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC m_orig_glSecondaryColor3ubEXT = nullptr;
+void m_glSecondaryColor3ubEXT_validation(GLubyte red,GLubyte green,GLubyte blue)const{(this->*(this->m_orig_glSecondaryColor3ubEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3ubEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC m_orig_glCompressedMultiTexSubImage1DEXT = nullptr;
+void m_glCompressedMultiTexSubImage1DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedMultiTexSubImage1DEXT))(texunit,target,level,xoffset,width,format,imageSize,bits);this->m_checkErrors("glCompressedMultiTexSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC m_orig_glMultiTexGendEXT = nullptr;
+void m_glMultiTexGendEXT_validation(GLenum texunit,GLenum coord,GLenum pname,GLdouble param)const{(this->*(this->m_orig_glMultiTexGendEXT))(texunit,coord,pname,param);this->m_checkErrors("glMultiTexGendEXT");}
+FunctionTable::MEMBERPFNGLCOLORP3UIVPROC m_orig_glColorP3uiv = nullptr;
+void m_glColorP3uiv_validation(GLenum type,const GLuint* color)const{(this->*(this->m_orig_glColorP3uiv))(type,color);this->m_checkErrors("glColorP3uiv");}
+FunctionTable::MEMBERPFNGLFOGCOORDFVPROC m_orig_glFogCoordfv = nullptr;
+void m_glFogCoordfv_validation(const GLfloat* coord)const{(this->*(this->m_orig_glFogCoordfv))(coord);this->m_checkErrors("glFogCoordfv");}
+FunctionTable::MEMBERPFNGLCOMPILESHADERPROC m_orig_glCompileShader = nullptr;
+void m_glCompileShader_validation(GLuint shader)const{(this->*(this->m_orig_glCompileShader))(shader);this->m_checkErrors("glCompileShader");}
+FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC m_orig_glTexCoord2hNV = nullptr;
+void m_glTexCoord2hNV_validation(GLhalfNV s,GLhalfNV t)const{(this->*(this->m_orig_glTexCoord2hNV))(s,t);this->m_checkErrors("glTexCoord2hNV");}
+FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC m_orig_glUniform1uivEXT = nullptr;
+void m_glUniform1uivEXT_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform1uivEXT))(location,count,value);this->m_checkErrors("glUniform1uivEXT");}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC m_orig_glMatrixLoadTransposedEXT = nullptr;
+void m_glMatrixLoadTransposedEXT_validation(GLenum mode,const GLdouble* m)const{(this->*(this->m_orig_glMatrixLoadTransposedEXT))(mode,m);this->m_checkErrors("glMatrixLoadTransposedEXT");}
+FunctionTable::MEMBERPFNGLINDEXFVPROC m_orig_glIndexfv = nullptr;
+void m_glIndexfv_validation(const GLfloat* c)const{(this->*(this->m_orig_glIndexfv))(c);this->m_checkErrors("glIndexfv");}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC m_orig_glGetCompressedTextureImage = nullptr;
+void m_glGetCompressedTextureImage_validation(GLuint texture,GLint level,GLsizei bufSize,void* pixels)const{(this->*(this->m_orig_glGetCompressedTextureImage))(texture,level,bufSize,pixels);this->m_checkErrors("glGetCompressedTextureImage");}
+FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC m_orig_glGetUniformuivEXT = nullptr;
+void m_glGetUniformuivEXT_validation(GLuint program,GLint location,GLuint* params)const{(this->*(this->m_orig_glGetUniformuivEXT))(program,location,params);this->m_checkErrors("glGetUniformuivEXT");}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC m_orig_glGetnPixelMapfvARB = nullptr;
+void m_glGetnPixelMapfvARB_validation(GLenum map,GLsizei bufSize,GLfloat* values)const{(this->*(this->m_orig_glGetnPixelMapfvARB))(map,bufSize,values);this->m_checkErrors("glGetnPixelMapfvARB");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC m_orig_glFramebufferTextureEXT = nullptr;
+void m_glFramebufferTextureEXT_validation(GLenum target,GLenum attachment,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTextureEXT))(target,attachment,texture,level);this->m_checkErrors("glFramebufferTextureEXT");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC m_orig_glMultiDrawElementsIndirectCount = nullptr;
+void m_glMultiDrawElementsIndirectCount_validation(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawElementsIndirectCount))(mode,type,indirect,drawcount,maxdrawcount,stride);this->m_checkErrors("glMultiDrawElementsIndirectCount");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC m_orig_glVertexAttribIPointer = nullptr;
+void m_glVertexAttribIPointer_validation(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribIPointer))(index,size,type,stride,pointer);this->m_checkErrors("glVertexAttribIPointer");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC m_orig_glMultiTexCoordP3ui = nullptr;
+void m_glMultiTexCoordP3ui_validation(GLenum texture,GLenum type,GLuint coords)const{(this->*(this->m_orig_glMultiTexCoordP3ui))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP3ui");}
+FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC m_orig_glEvaluateDepthValuesARB = nullptr;
+void m_glEvaluateDepthValuesARB_validation()const{(this->*(this->m_orig_glEvaluateDepthValuesARB))();this->m_checkErrors("glEvaluateDepthValuesARB");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC m_orig_glGetNamedBufferParameteriv = nullptr;
+void m_glGetNamedBufferParameteriv_validation(GLuint buffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedBufferParameteriv))(buffer,pname,params);this->m_checkErrors("glGetNamedBufferParameteriv");}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC m_orig_glGetNamedProgramLocalParameterfvEXT = nullptr;
+void m_glGetNamedProgramLocalParameterfvEXT_validation(GLuint program,GLenum target,GLuint index,GLfloat* params)const{(this->*(this->m_orig_glGetNamedProgramLocalParameterfvEXT))(program,target,index,params);this->m_checkErrors("glGetNamedProgramLocalParameterfvEXT");}
+FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glColor4fNormal3fVertex3fvSUN_validation(const GLfloat* c,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glColor4fNormal3fVertex3fvSUN))(c,n,v);this->m_checkErrors("glColor4fNormal3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC m_orig_glSeparableFilter2DEXT = nullptr;
+void m_glSeparableFilter2DEXT_validation(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* row,const void* column)const{(this->*(this->m_orig_glSeparableFilter2DEXT))(target,internalformat,width,height,format,type,row,column);this->m_checkErrors("glSeparableFilter2DEXT");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC m_orig_glTexParameterxOES = nullptr;
+void m_glTexParameterxOES_validation(GLenum target,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glTexParameterxOES))(target,pname,param);this->m_checkErrors("glTexParameterxOES");}
+FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC m_orig_glClearAccumxOES = nullptr;
+void m_glClearAccumxOES_validation(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{(this->*(this->m_orig_glClearAccumxOES))(red,green,blue,alpha);this->m_checkErrors("glClearAccumxOES");}
+FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC m_orig_glInvalidateFramebuffer = nullptr;
+void m_glInvalidateFramebuffer_validation(GLenum target,GLsizei numAttachments,const GLenum* attachments)const{(this->*(this->m_orig_glInvalidateFramebuffer))(target,numAttachments,attachments);this->m_checkErrors("glInvalidateFramebuffer");}
+FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC m_orig_glWeightubvARB = nullptr;
+void m_glWeightubvARB_validation(GLint size,const GLubyte* weights)const{(this->*(this->m_orig_glWeightubvARB))(size,weights);this->m_checkErrors("glWeightubvARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC m_orig_glVertexAttrib1d = nullptr;
+void m_glVertexAttrib1d_validation(GLuint index,GLdouble x)const{(this->*(this->m_orig_glVertexAttrib1d))(index,x);this->m_checkErrors("glVertexAttrib1d");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC m_orig_glVertexAttrib1f = nullptr;
+void m_glVertexAttrib1f_validation(GLuint index,GLfloat x)const{(this->*(this->m_orig_glVertexAttrib1f))(index,x);this->m_checkErrors("glVertexAttrib1f");}
+FunctionTable::MEMBERPFNGLVERTEX4FVPROC m_orig_glVertex4fv = nullptr;
+void m_glVertex4fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glVertex4fv))(v);this->m_checkErrors("glVertex4fv");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC m_orig_glClearNamedFramebufferfi = nullptr;
+void m_glClearNamedFramebufferfi_validation(GLuint framebuffer,GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{(this->*(this->m_orig_glClearNamedFramebufferfi))(framebuffer,buffer,drawbuffer,depth,stencil);this->m_checkErrors("glClearNamedFramebufferfi");}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC m_orig_glGetQueryBufferObjectuiv = nullptr;
+void m_glGetQueryBufferObjectuiv_validation(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{(this->*(this->m_orig_glGetQueryBufferObjectuiv))(id,buffer,pname,offset);this->m_checkErrors("glGetQueryBufferObjectuiv");}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC m_orig_glClearNamedFramebufferfv = nullptr;
+void m_glClearNamedFramebufferfv_validation(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLfloat* value)const{(this->*(this->m_orig_glClearNamedFramebufferfv))(framebuffer,buffer,drawbuffer,value);this->m_checkErrors("glClearNamedFramebufferfv");}
+FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC m_orig_glEndVertexShaderEXT = nullptr;
+void m_glEndVertexShaderEXT_validation()const{(this->*(this->m_orig_glEndVertexShaderEXT))();this->m_checkErrors("glEndVertexShaderEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC m_orig_glVertexAttrib1s = nullptr;
+void m_glVertexAttrib1s_validation(GLuint index,GLshort x)const{(this->*(this->m_orig_glVertexAttrib1s))(index,x);this->m_checkErrors("glVertexAttrib1s");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC m_orig_glMultiTexCoord4dvARB = nullptr;
+void m_glMultiTexCoord4dvARB_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord4dvARB))(target,v);this->m_checkErrors("glMultiTexCoord4dvARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC m_orig_glMultiTexCoord1sv = nullptr;
+void m_glMultiTexCoord1sv_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord1sv))(target,v);this->m_checkErrors("glMultiTexCoord1sv");}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC m_orig_glUniform1ui64vNV = nullptr;
+void m_glUniform1ui64vNV_validation(GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glUniform1ui64vNV))(location,count,value);this->m_checkErrors("glUniform1ui64vNV");}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC m_orig_glGetClipPlanefOES = nullptr;
+void m_glGetClipPlanefOES_validation(GLenum plane,GLfloat* equation)const{(this->*(this->m_orig_glGetClipPlanefOES))(plane,equation);this->m_checkErrors("glGetClipPlanefOES");}
+FunctionTable::MEMBERPFNGLRASTERPOS2SPROC m_orig_glRasterPos2s = nullptr;
+void m_glRasterPos2s_validation(GLshort x,GLshort y)const{(this->*(this->m_orig_glRasterPos2s))(x,y);this->m_checkErrors("glRasterPos2s");}
+FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC m_orig_glWeightivARB = nullptr;
+void m_glWeightivARB_validation(GLint size,const GLint* weights)const{(this->*(this->m_orig_glWeightivARB))(size,weights);this->m_checkErrors("glWeightivARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC m_orig_glMultiTexCoord4hvNV = nullptr;
+void m_glMultiTexCoord4hvNV_validation(GLenum target,const GLhalfNV* v)const{(this->*(this->m_orig_glMultiTexCoord4hvNV))(target,v);this->m_checkErrors("glMultiTexCoord4hvNV");}
+FunctionTable::MEMBERPFNGLNORMAL3HNVPROC m_orig_glNormal3hNV = nullptr;
+void m_glNormal3hNV_validation(GLhalfNV nx,GLhalfNV ny,GLhalfNV nz)const{(this->*(this->m_orig_glNormal3hNV))(nx,ny,nz);this->m_checkErrors("glNormal3hNV");}
+FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC m_orig_glGetSeparableFilter = nullptr;
+void m_glGetSeparableFilter_validation(GLenum target,GLenum format,GLenum type,GLvoid* row,GLvoid* column,GLvoid* span)const{(this->*(this->m_orig_glGetSeparableFilter))(target,format,type,row,column,span);this->m_checkErrors("glGetSeparableFilter");}
+FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC m_orig_glGetPathTexGenivNV = nullptr;
+void m_glGetPathTexGenivNV_validation(GLenum texCoordSet,GLenum pname,GLint* value)const{(this->*(this->m_orig_glGetPathTexGenivNV))(texCoordSet,pname,value);this->m_checkErrors("glGetPathTexGenivNV");}
+FunctionTable::MEMBERPFNGLCOLOR4BVPROC m_orig_glColor4bv = nullptr;
+void m_glColor4bv_validation(const GLbyte* v)const{(this->*(this->m_orig_glColor4bv))(v);this->m_checkErrors("glColor4bv");}
+FunctionTable::MEMBERPFNGLRASTERPOS2FPROC m_orig_glRasterPos2f = nullptr;
+void m_glRasterPos2f_validation(GLfloat x,GLfloat y)const{(this->*(this->m_orig_glRasterPos2f))(x,y);this->m_checkErrors("glRasterPos2f");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC m_orig_glNamedBufferPageCommitmentARB = nullptr;
+void m_glNamedBufferPageCommitmentARB_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{(this->*(this->m_orig_glNamedBufferPageCommitmentARB))(buffer,offset,size,commit);this->m_checkErrors("glNamedBufferPageCommitmentARB");}
+FunctionTable::MEMBERPFNGLLOADIDENTITYPROC m_orig_glLoadIdentity = nullptr;
+void m_glLoadIdentity_validation()const{(this->*(this->m_orig_glLoadIdentity))();this->m_checkErrors("glLoadIdentity");}
+FunctionTable::MEMBERPFNGLRASTERPOS2IPROC m_orig_glRasterPos2i = nullptr;
+void m_glRasterPos2i_validation(GLint x,GLint y)const{(this->*(this->m_orig_glRasterPos2i))(x,y);this->m_checkErrors("glRasterPos2i");}
+FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC m_orig_glRasterPos4iv = nullptr;
+void m_glRasterPos4iv_validation(const GLint* v)const{(this->*(this->m_orig_glRasterPos4iv))(v);this->m_checkErrors("glRasterPos4iv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC m_orig_glMultiTexCoord2fvARB = nullptr;
+void m_glMultiTexCoord2fvARB_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord2fvARB))(target,v);this->m_checkErrors("glMultiTexCoord2fvARB");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC m_orig_glUniformMatrix4x3fv = nullptr;
+void m_glUniformMatrix4x3fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix4x3fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4x3fv");}
+FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC m_orig_glClearBufferfv = nullptr;
+void m_glClearBufferfv_validation(GLenum buffer,GLint drawbuffer,const GLfloat* value)const{(this->*(this->m_orig_glClearBufferfv))(buffer,drawbuffer,value);this->m_checkErrors("glClearBufferfv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC m_orig_glMultiTexCoord4hNV = nullptr;
+void m_glMultiTexCoord4hNV_validation(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{(this->*(this->m_orig_glMultiTexCoord4hNV))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4hNV");}
+FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC m_orig_glTextureBarrier = nullptr;
+void m_glTextureBarrier_validation()const{(this->*(this->m_orig_glTextureBarrier))();this->m_checkErrors("glTextureBarrier");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC m_orig_glReplacementCodeuivSUN = nullptr;
+void m_glReplacementCodeuivSUN_validation(const GLuint* code)const{(this->*(this->m_orig_glReplacementCodeuivSUN))(code);this->m_checkErrors("glReplacementCodeuivSUN");}
+FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC m_orig_glDeleteAsyncMarkersSGIX = nullptr;
+void m_glDeleteAsyncMarkersSGIX_validation(GLuint marker,GLsizei range)const{(this->*(this->m_orig_glDeleteAsyncMarkersSGIX))(marker,range);this->m_checkErrors("glDeleteAsyncMarkersSGIX");}
+FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC m_orig_glTexCoord2bvOES = nullptr;
+void m_glTexCoord2bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glTexCoord2bvOES))(coords);this->m_checkErrors("glTexCoord2bvOES");}
+FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC m_orig_glEvalCoord2xOES = nullptr;
+void m_glEvalCoord2xOES_validation(GLfixed u,GLfixed v)const{(this->*(this->m_orig_glEvalCoord2xOES))(u,v);this->m_checkErrors("glEvalCoord2xOES");}
+FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC m_orig_glGetSharpenTexFuncSGIS = nullptr;
+void m_glGetSharpenTexFuncSGIS_validation(GLenum target,GLfloat* points)const{(this->*(this->m_orig_glGetSharpenTexFuncSGIS))(target,points);this->m_checkErrors("glGetSharpenTexFuncSGIS");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC m_orig_glProgramUniformHandleui64vNV = nullptr;
+void m_glProgramUniformHandleui64vNV_validation(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{(this->*(this->m_orig_glProgramUniformHandleui64vNV))(program,location,count,values);this->m_checkErrors("glProgramUniformHandleui64vNV");}
+FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC m_orig_glIglooInterfaceSGIX = nullptr;
+void m_glIglooInterfaceSGIX_validation(GLenum pname,const void* params)const{(this->*(this->m_orig_glIglooInterfaceSGIX))(pname,params);this->m_checkErrors("glIglooInterfaceSGIX");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC m_orig_glWindowPos2dvARB = nullptr;
+void m_glWindowPos2dvARB_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos2dvARB))(v);this->m_checkErrors("glWindowPos2dvARB");}
+FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC m_orig_glClearBufferfi = nullptr;
+void m_glClearBufferfi_validation(GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{(this->*(this->m_orig_glClearBufferfi))(buffer,drawbuffer,depth,stencil);this->m_checkErrors("glClearBufferfi");}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC m_orig_glDrawArraysIndirect = nullptr;
+void m_glDrawArraysIndirect_validation(GLenum mode,const void* indirect)const{(this->*(this->m_orig_glDrawArraysIndirect))(mode,indirect);this->m_checkErrors("glDrawArraysIndirect");}
+FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC m_orig_glGenVertexArrays = nullptr;
+void m_glGenVertexArrays_validation(GLsizei n,GLuint* arrays)const{(this->*(this->m_orig_glGenVertexArrays))(n,arrays);this->m_checkErrors("glGenVertexArrays");}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC m_orig_glGetTransformFeedbacki64_v = nullptr;
+void m_glGetTransformFeedbacki64_v_validation(GLuint xfb,GLenum pname,GLuint index,GLint64* param)const{(this->*(this->m_orig_glGetTransformFeedbacki64_v))(xfb,pname,index,param);this->m_checkErrors("glGetTransformFeedbacki64_v");}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC m_orig_glEnableVertexArrayAttrib = nullptr;
+void m_glEnableVertexArrayAttrib_validation(GLuint vaobj,GLuint index)const{(this->*(this->m_orig_glEnableVertexArrayAttrib))(vaobj,index);this->m_checkErrors("glEnableVertexArrayAttrib");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC m_orig_glProgramUniformMatrix3x2dv = nullptr;
+void m_glProgramUniformMatrix3x2dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x2dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x2dv");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC m_orig_glVertexStream4fATI = nullptr;
+void m_glVertexStream4fATI_validation(GLenum stream,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glVertexStream4fATI))(stream,x,y,z,w);this->m_checkErrors("glVertexStream4fATI");}
+FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC m_orig_glVertexBindingDivisor = nullptr;
+void m_glVertexBindingDivisor_validation(GLuint bindingindex,GLuint divisor)const{(this->*(this->m_orig_glVertexBindingDivisor))(bindingindex,divisor);this->m_checkErrors("glVertexBindingDivisor");}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC m_orig_glGetSamplerParameterIiv = nullptr;
+void m_glGetSamplerParameterIiv_validation(GLuint sampler,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetSamplerParameterIiv))(sampler,pname,params);this->m_checkErrors("glGetSamplerParameterIiv");}
+FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC m_orig_glGetCoverageModulationTableNV = nullptr;
+void m_glGetCoverageModulationTableNV_validation(GLsizei bufsize,GLfloat* v)const{(this->*(this->m_orig_glGetCoverageModulationTableNV))(bufsize,v);this->m_checkErrors("glGetCoverageModulationTableNV");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC m_orig_glDepthRangedNV = nullptr;
+void m_glDepthRangedNV_validation(GLdouble zNear,GLdouble zFar)const{(this->*(this->m_orig_glDepthRangedNV))(zNear,zFar);this->m_checkErrors("glDepthRangedNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC m_orig_glVertexAttrib3f = nullptr;
+void m_glVertexAttrib3f_validation(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glVertexAttrib3f))(index,x,y,z);this->m_checkErrors("glVertexAttrib3f");}
+FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC m_orig_glMultiDrawRangeElementArrayAPPLE = nullptr;
+void m_glMultiDrawRangeElementArrayAPPLE_validation(GLenum mode,GLuint start,GLuint end,const GLint* first,const GLsizei* count,GLsizei primcount)const{(this->*(this->m_orig_glMultiDrawRangeElementArrayAPPLE))(mode,start,end,first,count,primcount);this->m_checkErrors("glMultiDrawRangeElementArrayAPPLE");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC m_orig_glVertexAttribFormatNV = nullptr;
+void m_glVertexAttribFormatNV_validation(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride)const{(this->*(this->m_orig_glVertexAttribFormatNV))(index,size,type,normalized,stride);this->m_checkErrors("glVertexAttribFormatNV");}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC m_orig_glGetQueryBufferObjecti64v = nullptr;
+void m_glGetQueryBufferObjecti64v_validation(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{(this->*(this->m_orig_glGetQueryBufferObjecti64v))(id,buffer,pname,offset);this->m_checkErrors("glGetQueryBufferObjecti64v");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC m_orig_glGetVertexAttribdv = nullptr;
+void m_glGetVertexAttribdv_validation(GLuint index,GLenum pname,GLdouble* params)const{(this->*(this->m_orig_glGetVertexAttribdv))(index,pname,params);this->m_checkErrors("glGetVertexAttribdv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC m_orig_glGetUniformi64vARB = nullptr;
+void m_glGetUniformi64vARB_validation(GLuint program,GLint location,GLint64* params)const{(this->*(this->m_orig_glGetUniformi64vARB))(program,location,params);this->m_checkErrors("glGetUniformi64vARB");}
+FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC m_orig_glAreTexturesResidentEXT = nullptr;
+GLboolean m_glAreTexturesResidentEXT_validation(GLsizei n,const GLuint* textures,GLboolean* residences)const{GLboolean const result = (this->*(this->m_orig_glAreTexturesResidentEXT))(n,textures,residences);this->m_checkErrors("glAreTexturesResidentEXT");return result;}
+FunctionTable::MEMBERPFNGLGETHANDLEARBPROC m_orig_glGetHandleARB = nullptr;
+GLhandleARB m_glGetHandleARB_validation(GLenum pname)const{GLhandleARB const result = (this->*(this->m_orig_glGetHandleARB))(pname);this->m_checkErrors("glGetHandleARB");return result;}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC m_orig_glVideoCaptureStreamParameterdvNV = nullptr;
+void m_glVideoCaptureStreamParameterdvNV_validation(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLdouble* params)const{(this->*(this->m_orig_glVideoCaptureStreamParameterdvNV))(video_capture_slot,stream,pname,params);this->m_checkErrors("glVideoCaptureStreamParameterdvNV");}
+FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC m_orig_glMapParameterivNV = nullptr;
+void m_glMapParameterivNV_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMapParameterivNV))(target,pname,params);this->m_checkErrors("glMapParameterivNV");}
+FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC m_orig_glIsVertexArray = nullptr;
+GLboolean m_glIsVertexArray_validation(GLuint array)const{GLboolean const result = (this->*(this->m_orig_glIsVertexArray))(array);this->m_checkErrors("glIsVertexArray");return result;}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC m_orig_glSecondaryColor3sEXT = nullptr;
+void m_glSecondaryColor3sEXT_validation(GLshort red,GLshort green,GLshort blue)const{(this->*(this->m_orig_glSecondaryColor3sEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3sEXT");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC m_orig_glGetTexParameterIivEXT = nullptr;
+void m_glGetTexParameterIivEXT_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTexParameterIivEXT))(target,pname,params);this->m_checkErrors("glGetTexParameterIivEXT");}
+FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC m_orig_glFrameTerminatorGREMEDY = nullptr;
+void m_glFrameTerminatorGREMEDY_validation()const{(this->*(this->m_orig_glFrameTerminatorGREMEDY))();this->m_checkErrors("glFrameTerminatorGREMEDY");}
+FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC m_orig_glBlendBarrierKHR = nullptr;
+void m_glBlendBarrierKHR_validation()const{(this->*(this->m_orig_glBlendBarrierKHR))();this->m_checkErrors("glBlendBarrierKHR");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC m_orig_glVertexAttrib4NubARB = nullptr;
+void m_glVertexAttrib4NubARB_validation(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{(this->*(this->m_orig_glVertexAttrib4NubARB))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4NubARB");}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC m_orig_glPrimitiveRestartNV = nullptr;
+void m_glPrimitiveRestartNV_validation()const{(this->*(this->m_orig_glPrimitiveRestartNV))();this->m_checkErrors("glPrimitiveRestartNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC m_orig_glVertexAttribL1ui64vARB = nullptr;
+void m_glVertexAttribL1ui64vARB_validation(GLuint index,const GLuint64EXT* v)const{(this->*(this->m_orig_glVertexAttribL1ui64vARB))(index,v);this->m_checkErrors("glVertexAttribL1ui64vARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC m_orig_glVertexAttribI4ivEXT = nullptr;
+void m_glVertexAttribI4ivEXT_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI4ivEXT))(index,v);this->m_checkErrors("glVertexAttribI4ivEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC m_orig_glVertexAttribs4svNV = nullptr;
+void m_glVertexAttribs4svNV_validation(GLuint index,GLsizei count,const GLshort* v)const{(this->*(this->m_orig_glVertexAttribs4svNV))(index,count,v);this->m_checkErrors("glVertexAttribs4svNV");}
+FunctionTable::MEMBERPFNGLUNIFORM1UIPROC m_orig_glUniform1ui = nullptr;
+void m_glUniform1ui_validation(GLint location,GLuint v0)const{(this->*(this->m_orig_glUniform1ui))(location,v0);this->m_checkErrors("glUniform1ui");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC m_orig_glVertexAttrib2fvARB = nullptr;
+void m_glVertexAttrib2fvARB_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib2fvARB))(index,v);this->m_checkErrors("glVertexAttrib2fvARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC m_orig_glVertexAttribI4svEXT = nullptr;
+void m_glVertexAttribI4svEXT_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttribI4svEXT))(index,v);this->m_checkErrors("glVertexAttribI4svEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC m_orig_glTextureImage3DMultisampleCoverageNV = nullptr;
+void m_glTextureImage3DMultisampleCoverageNV_validation(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{(this->*(this->m_orig_glTextureImage3DMultisampleCoverageNV))(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);this->m_checkErrors("glTextureImage3DMultisampleCoverageNV");}
+FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC m_orig_glMemoryBarrier = nullptr;
+void m_glMemoryBarrier_validation(GLbitfield barriers)const{(this->*(this->m_orig_glMemoryBarrier))(barriers);this->m_checkErrors("glMemoryBarrier");}
+FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC m_orig_glGetVariantArrayObjectfvATI = nullptr;
+void m_glGetVariantArrayObjectfvATI_validation(GLuint id,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetVariantArrayObjectfvATI))(id,pname,params);this->m_checkErrors("glGetVariantArrayObjectfvATI");}
+FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN = nullptr;
+void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_validation(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN))(tc,c,n,v);this->m_checkErrors("glTexCoord4fColor4fNormal3fVertex4fvSUN");}
+FunctionTable::MEMBERPFNGLISPROGRAMARBPROC m_orig_glIsProgramARB = nullptr;
+GLboolean m_glIsProgramARB_validation(GLuint program)const{GLboolean const result = (this->*(this->m_orig_glIsProgramARB))(program);this->m_checkErrors("glIsProgramARB");return result;}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC m_orig_glBindImageTextureEXT = nullptr;
+void m_glBindImageTextureEXT_validation(GLuint index,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLint format)const{(this->*(this->m_orig_glBindImageTextureEXT))(index,texture,level,layered,layer,access,format);this->m_checkErrors("glBindImageTextureEXT");}
+FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC m_orig_glGetFragDataLocation = nullptr;
+GLint m_glGetFragDataLocation_validation(GLuint program,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetFragDataLocation))(program,name);this->m_checkErrors("glGetFragDataLocation");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC m_orig_glMultiTexCoord1svARB = nullptr;
+void m_glMultiTexCoord1svARB_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord1svARB))(target,v);this->m_checkErrors("glMultiTexCoord1svARB");}
+FunctionTable::MEMBERPFNGLGETMAPXVOESPROC m_orig_glGetMapxvOES = nullptr;
+void m_glGetMapxvOES_validation(GLenum target,GLenum query,GLfixed* v)const{(this->*(this->m_orig_glGetMapxvOES))(target,query,v);this->m_checkErrors("glGetMapxvOES");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC m_orig_glTextureStorage2DMultisampleEXT = nullptr;
+void m_glTextureStorage2DMultisampleEXT_validation(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTextureStorage2DMultisampleEXT))(texture,target,samples,internalformat,width,height,fixedsamplelocations);this->m_checkErrors("glTextureStorage2DMultisampleEXT");}
+FunctionTable::MEMBERPFNGLGETMATERIALFVPROC m_orig_glGetMaterialfv = nullptr;
+void m_glGetMaterialfv_validation(GLenum face,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetMaterialfv))(face,pname,params);this->m_checkErrors("glGetMaterialfv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC m_orig_glVertexAttrib4NbvARB = nullptr;
+void m_glVertexAttrib4NbvARB_validation(GLuint index,const GLbyte* v)const{(this->*(this->m_orig_glVertexAttrib4NbvARB))(index,v);this->m_checkErrors("glVertexAttrib4NbvARB");}
+FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC m_orig_glPixelMapuiv = nullptr;
+void m_glPixelMapuiv_validation(GLenum map,GLsizei mapsize,const GLuint* values)const{(this->*(this->m_orig_glPixelMapuiv))(map,mapsize,values);this->m_checkErrors("glPixelMapuiv");}
+FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC m_orig_glColorPointerEXT = nullptr;
+void m_glColorPointerEXT_validation(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{(this->*(this->m_orig_glColorPointerEXT))(size,type,stride,count,pointer);this->m_checkErrors("glColorPointerEXT");}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC m_orig_glEnableClientStateiEXT = nullptr;
+void m_glEnableClientStateiEXT_validation(GLenum array,GLuint index)const{(this->*(this->m_orig_glEnableClientStateiEXT))(array,index);this->m_checkErrors("glEnableClientStateiEXT");}
+FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC m_orig_glClearTexSubImage = nullptr;
+void m_glClearTexSubImage_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* data)const{(this->*(this->m_orig_glClearTexSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);this->m_checkErrors("glClearTexSubImage");}
+FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC m_orig_glEvalCoord1xvOES = nullptr;
+void m_glEvalCoord1xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glEvalCoord1xvOES))(coords);this->m_checkErrors("glEvalCoord1xvOES");}
+FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC m_orig_glDetachObjectARB = nullptr;
+void m_glDetachObjectARB_validation(GLhandleARB containerObj,GLhandleARB attachedObj)const{(this->*(this->m_orig_glDetachObjectARB))(containerObj,attachedObj);this->m_checkErrors("glDetachObjectARB");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC m_orig_glGetTextureParameterIiv = nullptr;
+void m_glGetTextureParameterIiv_validation(GLuint texture,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTextureParameterIiv))(texture,pname,params);this->m_checkErrors("glGetTextureParameterIiv");}
+FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC m_orig_glVariantusvEXT = nullptr;
+void m_glVariantusvEXT_validation(GLuint id,const GLushort* addr)const{(this->*(this->m_orig_glVariantusvEXT))(id,addr);this->m_checkErrors("glVariantusvEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC m_orig_glCompressedTextureImage3DEXT = nullptr;
+void m_glCompressedTextureImage3DEXT_validation(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedTextureImage3DEXT))(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);this->m_checkErrors("glCompressedTextureImage3DEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC m_orig_glMultiTexCoord1dARB = nullptr;
+void m_glMultiTexCoord1dARB_validation(GLenum target,GLdouble s)const{(this->*(this->m_orig_glMultiTexCoord1dARB))(target,s);this->m_checkErrors("glMultiTexCoord1dARB");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC m_orig_glGetVertexArrayIntegeri_vEXT = nullptr;
+void m_glGetVertexArrayIntegeri_vEXT_validation(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{(this->*(this->m_orig_glGetVertexArrayIntegeri_vEXT))(vaobj,index,pname,param);this->m_checkErrors("glGetVertexArrayIntegeri_vEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC m_orig_glVertexAttribI4ubv = nullptr;
+void m_glVertexAttribI4ubv_validation(GLuint index,const GLubyte* v)const{(this->*(this->m_orig_glVertexAttribI4ubv))(index,v);this->m_checkErrors("glVertexAttribI4ubv");}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC m_orig_glPixelTexGenParameterfSGIS = nullptr;
+void m_glPixelTexGenParameterfSGIS_validation(GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPixelTexGenParameterfSGIS))(pname,param);this->m_checkErrors("glPixelTexGenParameterfSGIS");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC m_orig_glProgramUniformMatrix4x2dv = nullptr;
+void m_glProgramUniformMatrix4x2dv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x2dv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x2dv");}
+FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC m_orig_glUniform3fARB = nullptr;
+void m_glUniform3fARB_validation(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{(this->*(this->m_orig_glUniform3fARB))(location,v0,v1,v2);this->m_checkErrors("glUniform3fARB");}
+FunctionTable::MEMBERPFNGLISSHADERPROC m_orig_glIsShader = nullptr;
+GLboolean m_glIsShader_validation(GLuint shader)const{GLboolean const result = (this->*(this->m_orig_glIsShader))(shader);this->m_checkErrors("glIsShader");return result;}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC m_orig_glConvolutionParameteriv = nullptr;
+void m_glConvolutionParameteriv_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glConvolutionParameteriv))(target,pname,params);this->m_checkErrors("glConvolutionParameteriv");}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC m_orig_glCopyMultiTexSubImage2DEXT = nullptr;
+void m_glCopyMultiTexSubImage2DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyMultiTexSubImage2DEXT))(texunit,target,level,xoffset,yoffset,x,y,width,height);this->m_checkErrors("glCopyMultiTexSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC m_orig_glEnableVertexAttribArrayARB = nullptr;
+void m_glEnableVertexAttribArrayARB_validation(GLuint index)const{(this->*(this->m_orig_glEnableVertexAttribArrayARB))(index);this->m_checkErrors("glEnableVertexAttribArrayARB");}
+FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC m_orig_glMulticastCopyBufferSubDataNV = nullptr;
+void m_glMulticastCopyBufferSubDataNV_validation(GLuint readGpu,GLbitfield writeGpuMask,GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{(this->*(this->m_orig_glMulticastCopyBufferSubDataNV))(readGpu,writeGpuMask,readBuffer,writeBuffer,readOffset,writeOffset,size);this->m_checkErrors("glMulticastCopyBufferSubDataNV");}
+FunctionTable::MEMBERPFNGLENABLEPROC m_orig_glEnable = nullptr;
+void m_glEnable_validation(GLenum cap)const{(this->*(this->m_orig_glEnable))(cap);this->m_checkErrors("glEnable");}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC m_orig_glGetActiveUniformsiv = nullptr;
+void m_glGetActiveUniformsiv_validation(GLuint program,GLsizei uniformCount,const GLuint* uniformIndices,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetActiveUniformsiv))(program,uniformCount,uniformIndices,pname,params);this->m_checkErrors("glGetActiveUniformsiv");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC m_orig_glGetVertexAttribivARB = nullptr;
+void m_glGetVertexAttribivARB_validation(GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVertexAttribivARB))(index,pname,params);this->m_checkErrors("glGetVertexAttribivARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC m_orig_glTexCoord4hvNV = nullptr;
+void m_glTexCoord4hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glTexCoord4hvNV))(v);this->m_checkErrors("glTexCoord4hvNV");}
+FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC m_orig_glUseProgramObjectARB = nullptr;
+void m_glUseProgramObjectARB_validation(GLhandleARB programObj)const{(this->*(this->m_orig_glUseProgramObjectARB))(programObj);this->m_checkErrors("glUseProgramObjectARB");}
+FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC m_orig_glGetAttribLocation = nullptr;
+GLint m_glGetAttribLocation_validation(GLuint program,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetAttribLocation))(program,name);this->m_checkErrors("glGetAttribLocation");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC m_orig_glVertexAttrib4dv = nullptr;
+void m_glVertexAttrib4dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib4dv))(index,v);this->m_checkErrors("glVertexAttrib4dv");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC m_orig_glGetTextureParameteriv = nullptr;
+void m_glGetTextureParameteriv_validation(GLuint texture,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTextureParameteriv))(texture,pname,params);this->m_checkErrors("glGetTextureParameteriv");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC m_orig_glNamedBufferStorageMemEXT = nullptr;
+void m_glNamedBufferStorageMemEXT_validation(GLuint buffer,GLsizeiptr size,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glNamedBufferStorageMemEXT))(buffer,size,memory,offset);this->m_checkErrors("glNamedBufferStorageMemEXT");}
+FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC m_orig_glPathSubCoordsNV = nullptr;
+void m_glPathSubCoordsNV_validation(GLuint path,GLsizei coordStart,GLsizei numCoords,GLenum coordType,const void* coords)const{(this->*(this->m_orig_glPathSubCoordsNV))(path,coordStart,numCoords,coordType,coords);this->m_checkErrors("glPathSubCoordsNV");}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC m_orig_glMatrixIndexusvARB = nullptr;
+void m_glMatrixIndexusvARB_validation(GLint size,const GLushort* indices)const{(this->*(this->m_orig_glMatrixIndexusvARB))(size,indices);this->m_checkErrors("glMatrixIndexusvARB");}
+FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC m_orig_glGetVideouivNV = nullptr;
+void m_glGetVideouivNV_validation(GLuint video_slot,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetVideouivNV))(video_slot,pname,params);this->m_checkErrors("glGetVideouivNV");}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC m_orig_glGetVideoCaptureivNV = nullptr;
+void m_glGetVideoCaptureivNV_validation(GLuint video_capture_slot,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVideoCaptureivNV))(video_capture_slot,pname,params);this->m_checkErrors("glGetVideoCaptureivNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC m_orig_glProgramUniform3ui = nullptr;
+void m_glProgramUniform3ui_validation(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{(this->*(this->m_orig_glProgramUniform3ui))(program,location,v0,v1,v2);this->m_checkErrors("glProgramUniform3ui");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC m_orig_glVertexAttrib3svARB = nullptr;
+void m_glVertexAttrib3svARB_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib3svARB))(index,v);this->m_checkErrors("glVertexAttrib3svARB");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC m_orig_glGetNamedBufferParameterivEXT = nullptr;
+void m_glGetNamedBufferParameterivEXT_validation(GLuint buffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedBufferParameterivEXT))(buffer,pname,params);this->m_checkErrors("glGetNamedBufferParameterivEXT");}
+FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC m_orig_glMatrixScaledEXT = nullptr;
+void m_glMatrixScaledEXT_validation(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glMatrixScaledEXT))(mode,x,y,z);this->m_checkErrors("glMatrixScaledEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC m_orig_glProgramUniformMatrix2x3fv = nullptr;
+void m_glProgramUniformMatrix2x3fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x3fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x3fv");}
+FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC m_orig_glGetFragmentLightivSGIX = nullptr;
+void m_glGetFragmentLightivSGIX_validation(GLenum light,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetFragmentLightivSGIX))(light,pname,params);this->m_checkErrors("glGetFragmentLightivSGIX");}
+FunctionTable::MEMBERPFNGLGETSTRINGIPROC m_orig_glGetStringi = nullptr;
+const GLubyte* m_glGetStringi_validation(GLenum name,GLuint index)const{const GLubyte* const result = (this->*(this->m_orig_glGetStringi))(name,index);this->m_checkErrors("glGetStringi");return result;}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC m_orig_glWindowPos2svARB = nullptr;
+void m_glWindowPos2svARB_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos2svARB))(v);this->m_checkErrors("glWindowPos2svARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC m_orig_glVertexAttrib2svNV = nullptr;
+void m_glVertexAttrib2svNV_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib2svNV))(index,v);this->m_checkErrors("glVertexAttrib2svNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC m_orig_glWindowPos2ivARB = nullptr;
+void m_glWindowPos2ivARB_validation(const GLint* v)const{(this->*(this->m_orig_glWindowPos2ivARB))(v);this->m_checkErrors("glWindowPos2ivARB");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC m_orig_glGetVertexAttribPointervNV = nullptr;
+void m_glGetVertexAttribPointervNV_validation(GLuint index,GLenum pname,void** pointer)const{(this->*(this->m_orig_glGetVertexAttribPointervNV))(index,pname,pointer);this->m_checkErrors("glGetVertexAttribPointervNV");}
+FunctionTable::MEMBERPFNGLPUSHMATRIXPROC m_orig_glPushMatrix = nullptr;
+void m_glPushMatrix_validation()const{(this->*(this->m_orig_glPushMatrix))();this->m_checkErrors("glPushMatrix");}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC m_orig_glEdgeFlagPointerListIBM = nullptr;
+void m_glEdgeFlagPointerListIBM_validation(GLint stride,const GLboolean** pointer,GLint ptrstride)const{(this->*(this->m_orig_glEdgeFlagPointerListIBM))(stride,pointer,ptrstride);this->m_checkErrors("glEdgeFlagPointerListIBM");}
+FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC m_orig_glGenerateMipmapEXT = nullptr;
+void m_glGenerateMipmapEXT_validation(GLenum target)const{(this->*(this->m_orig_glGenerateMipmapEXT))(target);this->m_checkErrors("glGenerateMipmapEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC m_orig_glWindowPos3sv = nullptr;
+void m_glWindowPos3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos3sv))(v);this->m_checkErrors("glWindowPos3sv");}
+FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC m_orig_glPathCoordsNV = nullptr;
+void m_glPathCoordsNV_validation(GLuint path,GLsizei numCoords,GLenum coordType,const void* coords)const{(this->*(this->m_orig_glPathCoordsNV))(path,numCoords,coordType,coords);this->m_checkErrors("glPathCoordsNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC m_orig_glProgramUniform1i = nullptr;
+void m_glProgramUniform1i_validation(GLuint program,GLint location,GLint v0)const{(this->*(this->m_orig_glProgramUniform1i))(program,location,v0);this->m_checkErrors("glProgramUniform1i");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC m_orig_glProgramUniform1d = nullptr;
+void m_glProgramUniform1d_validation(GLuint program,GLint location,GLdouble v0)const{(this->*(this->m_orig_glProgramUniform1d))(program,location,v0);this->m_checkErrors("glProgramUniform1d");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC m_orig_glProgramUniform1f = nullptr;
+void m_glProgramUniform1f_validation(GLuint program,GLint location,GLfloat v0)const{(this->*(this->m_orig_glProgramUniform1f))(program,location,v0);this->m_checkErrors("glProgramUniform1f");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC m_orig_glProgramParameteriEXT = nullptr;
+void m_glProgramParameteriEXT_validation(GLuint program,GLenum pname,GLint value)const{(this->*(this->m_orig_glProgramParameteriEXT))(program,pname,value);this->m_checkErrors("glProgramParameteriEXT");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC m_orig_glCompressedMultiTexImage2DEXT = nullptr;
+void m_glCompressedMultiTexImage2DEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedMultiTexImage2DEXT))(texunit,target,level,internalformat,width,height,border,imageSize,bits);this->m_checkErrors("glCompressedMultiTexImage2DEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC m_orig_glProgramUniform3iv = nullptr;
+void m_glProgramUniform3iv_validation(GLuint program,GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glProgramUniform3iv))(program,location,count,value);this->m_checkErrors("glProgramUniform3iv");}
+FunctionTable::MEMBERPFNGLINDEXIVPROC m_orig_glIndexiv = nullptr;
+void m_glIndexiv_validation(const GLint* c)const{(this->*(this->m_orig_glIndexiv))(c);this->m_checkErrors("glIndexiv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC m_orig_glMultiTexCoord4xvOES = nullptr;
+void m_glMultiTexCoord4xvOES_validation(GLenum texture,const GLfixed* coords)const{(this->*(this->m_orig_glMultiTexCoord4xvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord4xvOES");}
+FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC m_orig_glEGLImageTargetTexture2DOES = nullptr;
+void m_glEGLImageTargetTexture2DOES_validation(GLenum target,GLeglImageOES image)const{(this->*(this->m_orig_glEGLImageTargetTexture2DOES))(target,image);this->m_checkErrors("glEGLImageTargetTexture2DOES");}
+FunctionTable::MEMBERPFNGLPIXELZOOMPROC m_orig_glPixelZoom = nullptr;
+void m_glPixelZoom_validation(GLfloat xfactor,GLfloat yfactor)const{(this->*(this->m_orig_glPixelZoom))(xfactor,yfactor);this->m_checkErrors("glPixelZoom");}
+FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC m_orig_glVertex3bvOES = nullptr;
+void m_glVertex3bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glVertex3bvOES))(coords);this->m_checkErrors("glVertex3bvOES");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC m_orig_glFramebufferReadBufferEXT = nullptr;
+void m_glFramebufferReadBufferEXT_validation(GLuint framebuffer,GLenum mode)const{(this->*(this->m_orig_glFramebufferReadBufferEXT))(framebuffer,mode);this->m_checkErrors("glFramebufferReadBufferEXT");}
+FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC m_orig_glExtractComponentEXT = nullptr;
+void m_glExtractComponentEXT_validation(GLuint res,GLuint src,GLuint num)const{(this->*(this->m_orig_glExtractComponentEXT))(res,src,num);this->m_checkErrors("glExtractComponentEXT");}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC m_orig_glCombinerParameterivNV = nullptr;
+void m_glCombinerParameterivNV_validation(GLenum pname,const GLint* params)const{(this->*(this->m_orig_glCombinerParameterivNV))(pname,params);this->m_checkErrors("glCombinerParameterivNV");}
+FunctionTable::MEMBERPFNGLMINMAXPROC m_orig_glMinmax = nullptr;
+void m_glMinmax_validation(GLenum target,GLenum internalformat,GLboolean sink)const{(this->*(this->m_orig_glMinmax))(target,internalformat,sink);this->m_checkErrors("glMinmax");}
+FunctionTable::MEMBERPFNGLCOLORP3UIPROC m_orig_glColorP3ui = nullptr;
+void m_glColorP3ui_validation(GLenum type,GLuint color)const{(this->*(this->m_orig_glColorP3ui))(type,color);this->m_checkErrors("glColorP3ui");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC m_orig_glPointParameterfvSGIS = nullptr;
+void m_glPointParameterfvSGIS_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glPointParameterfvSGIS))(pname,params);this->m_checkErrors("glPointParameterfvSGIS");}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC m_orig_glBlendEquationi = nullptr;
+void m_glBlendEquationi_validation(GLuint buf,GLenum mode)const{(this->*(this->m_orig_glBlendEquationi))(buf,mode);this->m_checkErrors("glBlendEquationi");}
+FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC m_orig_glGetFogFuncSGIS = nullptr;
+void m_glGetFogFuncSGIS_validation(GLfloat* points)const{(this->*(this->m_orig_glGetFogFuncSGIS))(points);this->m_checkErrors("glGetFogFuncSGIS");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC m_orig_glVertexAttrib4fvNV = nullptr;
+void m_glVertexAttrib4fvNV_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib4fvNV))(index,v);this->m_checkErrors("glVertexAttrib4fvNV");}
+FunctionTable::MEMBERPFNGLGETNMINMAXPROC m_orig_glGetnMinmax = nullptr;
+void m_glGetnMinmax_validation(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{(this->*(this->m_orig_glGetnMinmax))(target,reset,format,type,bufSize,values);this->m_checkErrors("glGetnMinmax");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC m_orig_glFragmentLightiSGIX = nullptr;
+void m_glFragmentLightiSGIX_validation(GLenum light,GLenum pname,GLint param)const{(this->*(this->m_orig_glFragmentLightiSGIX))(light,pname,param);this->m_checkErrors("glFragmentLightiSGIX");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC m_orig_glMultiTexCoord1bvOES = nullptr;
+void m_glMultiTexCoord1bvOES_validation(GLenum texture,const GLbyte* coords)const{(this->*(this->m_orig_glMultiTexCoord1bvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord1bvOES");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC m_orig_glSecondaryColorPointerEXT = nullptr;
+void m_glSecondaryColorPointerEXT_validation(GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glSecondaryColorPointerEXT))(size,type,stride,pointer);this->m_checkErrors("glSecondaryColorPointerEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC m_orig_glMultiTexCoordP4uiv = nullptr;
+void m_glMultiTexCoordP4uiv_validation(GLenum texture,GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glMultiTexCoordP4uiv))(texture,type,coords);this->m_checkErrors("glMultiTexCoordP4uiv");}
+FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC m_orig_glGetBufferSubDataARB = nullptr;
+void m_glGetBufferSubDataARB_validation(GLenum target,GLintptrARB offset,GLsizeiptrARB size,void* data)const{(this->*(this->m_orig_glGetBufferSubDataARB))(target,offset,size,data);this->m_checkErrors("glGetBufferSubDataARB");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC m_orig_glSecondaryColor3hNV = nullptr;
+void m_glSecondaryColor3hNV_validation(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{(this->*(this->m_orig_glSecondaryColor3hNV))(red,green,blue);this->m_checkErrors("glSecondaryColor3hNV");}
+FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC m_orig_glGetPathParameterivNV = nullptr;
+void m_glGetPathParameterivNV_validation(GLuint path,GLenum pname,GLint* value)const{(this->*(this->m_orig_glGetPathParameterivNV))(path,pname,value);this->m_checkErrors("glGetPathParameterivNV");}
+FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC m_orig_glFlushRasterSGIX = nullptr;
+void m_glFlushRasterSGIX_validation()const{(this->*(this->m_orig_glFlushRasterSGIX))();this->m_checkErrors("glFlushRasterSGIX");}
+FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC m_orig_glElementPointerATI = nullptr;
+void m_glElementPointerATI_validation(GLenum type,const void* pointer)const{(this->*(this->m_orig_glElementPointerATI))(type,pointer);this->m_checkErrors("glElementPointerATI");}
+FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC m_orig_glGetAttachedObjectsARB = nullptr;
+void m_glGetAttachedObjectsARB_validation(GLhandleARB containerObj,GLsizei maxCount,GLsizei* count,GLhandleARB* obj)const{(this->*(this->m_orig_glGetAttachedObjectsARB))(containerObj,maxCount,count,obj);this->m_checkErrors("glGetAttachedObjectsARB");}
+FunctionTable::MEMBERPFNGLUNIFORM4IVPROC m_orig_glUniform4iv = nullptr;
+void m_glUniform4iv_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform4iv))(location,count,value);this->m_checkErrors("glUniform4iv");}
+FunctionTable::MEMBERPFNGLFOGXOESPROC m_orig_glFogxOES = nullptr;
+void m_glFogxOES_validation(GLenum pname,GLfixed param)const{(this->*(this->m_orig_glFogxOES))(pname,param);this->m_checkErrors("glFogxOES");}
+FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC m_orig_glSharpenTexFuncSGIS = nullptr;
+void m_glSharpenTexFuncSGIS_validation(GLenum target,GLsizei n,const GLfloat* points)const{(this->*(this->m_orig_glSharpenTexFuncSGIS))(target,n,points);this->m_checkErrors("glSharpenTexFuncSGIS");}
+FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC m_orig_glClearDepthfOES = nullptr;
+void m_glClearDepthfOES_validation(GLclampf depth)const{(this->*(this->m_orig_glClearDepthfOES))(depth);this->m_checkErrors("glClearDepthfOES");}
+FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC m_orig_glDeleteCommandListsNV = nullptr;
+void m_glDeleteCommandListsNV_validation(GLsizei n,const GLuint* lists)const{(this->*(this->m_orig_glDeleteCommandListsNV))(n,lists);this->m_checkErrors("glDeleteCommandListsNV");}
+FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC m_orig_glSpecializeShader = nullptr;
+void m_glSpecializeShader_validation(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{(this->*(this->m_orig_glSpecializeShader))(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);this->m_checkErrors("glSpecializeShader");}
+FunctionTable::MEMBERPFNGLVERTEX4HNVPROC m_orig_glVertex4hNV = nullptr;
+void m_glVertex4hNV_validation(GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{(this->*(this->m_orig_glVertex4hNV))(x,y,z,w);this->m_checkErrors("glVertex4hNV");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC m_orig_glSecondaryColor3dvEXT = nullptr;
+void m_glSecondaryColor3dvEXT_validation(const GLdouble* v)const{(this->*(this->m_orig_glSecondaryColor3dvEXT))(v);this->m_checkErrors("glSecondaryColor3dvEXT");}
+FunctionTable::MEMBERPFNGLGENTEXTURESPROC m_orig_glGenTextures = nullptr;
+void m_glGenTextures_validation(GLsizei n,GLuint* textures)const{(this->*(this->m_orig_glGenTextures))(n,textures);this->m_checkErrors("glGenTextures");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC m_orig_glTextureStorage2DMultisample = nullptr;
+void m_glTextureStorage2DMultisample_validation(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTextureStorage2DMultisample))(texture,samples,internalformat,width,height,fixedsamplelocations);this->m_checkErrors("glTextureStorage2DMultisample");}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC m_orig_glUniform3ui64vNV = nullptr;
+void m_glUniform3ui64vNV_validation(GLint location,GLsizei count,const GLuint64EXT* value)const{(this->*(this->m_orig_glUniform3ui64vNV))(location,count,value);this->m_checkErrors("glUniform3ui64vNV");}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC m_orig_glBlendFuncSeparateIndexedAMD = nullptr;
+void m_glBlendFuncSeparateIndexedAMD_validation(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{(this->*(this->m_orig_glBlendFuncSeparateIndexedAMD))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);this->m_checkErrors("glBlendFuncSeparateIndexedAMD");}
+FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC m_orig_glMakeBufferResidentNV = nullptr;
+void m_glMakeBufferResidentNV_validation(GLenum target,GLenum access)const{(this->*(this->m_orig_glMakeBufferResidentNV))(target,access);this->m_checkErrors("glMakeBufferResidentNV");}
+FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC m_orig_glShaderOp2EXT = nullptr;
+void m_glShaderOp2EXT_validation(GLenum op,GLuint res,GLuint arg1,GLuint arg2)const{(this->*(this->m_orig_glShaderOp2EXT))(op,res,arg1,arg2);this->m_checkErrors("glShaderOp2EXT");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC m_orig_glGetVertexAttribivNV = nullptr;
+void m_glGetVertexAttribivNV_validation(GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVertexAttribivNV))(index,pname,params);this->m_checkErrors("glGetVertexAttribivNV");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC m_orig_glTexParameterIivEXT = nullptr;
+void m_glTexParameterIivEXT_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTexParameterIivEXT))(target,pname,params);this->m_checkErrors("glTexParameterIivEXT");}
+FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC m_orig_glGetPerfQueryDataINTEL = nullptr;
+void m_glGetPerfQueryDataINTEL_validation(GLuint queryHandle,GLuint flags,GLsizei dataSize,GLvoid* data,GLuint* bytesWritten)const{(this->*(this->m_orig_glGetPerfQueryDataINTEL))(queryHandle,flags,dataSize,data,bytesWritten);this->m_checkErrors("glGetPerfQueryDataINTEL");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC m_orig_glVertexAttrib4dvARB = nullptr;
+void m_glVertexAttrib4dvARB_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib4dvARB))(index,v);this->m_checkErrors("glVertexAttrib4dvARB");}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC m_orig_glTextureSubImage1DEXT = nullptr;
+void m_glTextureSubImage1DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureSubImage1DEXT))(texture,target,level,xoffset,width,format,type,pixels);this->m_checkErrors("glTextureSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC m_orig_glGetActiveUniformBlockName = nullptr;
+void m_glGetActiveUniformBlockName_validation(GLuint program,GLuint uniformBlockIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformBlockName)const{(this->*(this->m_orig_glGetActiveUniformBlockName))(program,uniformBlockIndex,bufSize,length,uniformBlockName);this->m_checkErrors("glGetActiveUniformBlockName");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC m_orig_glVertexAttrib2dvARB = nullptr;
+void m_glVertexAttrib2dvARB_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib2dvARB))(index,v);this->m_checkErrors("glVertexAttrib2dvARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC m_orig_glVertexAttribPointer = nullptr;
+void m_glVertexAttribPointer_validation(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribPointer))(index,size,type,normalized,stride,pointer);this->m_checkErrors("glVertexAttribPointer");}
+FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC m_orig_glDepthBoundsdNV = nullptr;
+void m_glDepthBoundsdNV_validation(GLdouble zmin,GLdouble zmax)const{(this->*(this->m_orig_glDepthBoundsdNV))(zmin,zmax);this->m_checkErrors("glDepthBoundsdNV");}
+FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC m_orig_glDeleteTexturesEXT = nullptr;
+void m_glDeleteTexturesEXT_validation(GLsizei n,const GLuint* textures)const{(this->*(this->m_orig_glDeleteTexturesEXT))(n,textures);this->m_checkErrors("glDeleteTexturesEXT");}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC m_orig_glDrawBuffersATI = nullptr;
+void m_glDrawBuffersATI_validation(GLsizei n,const GLenum* bufs)const{(this->*(this->m_orig_glDrawBuffersATI))(n,bufs);this->m_checkErrors("glDrawBuffersATI");}
+FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC m_orig_glLightModelxvOES = nullptr;
+void m_glLightModelxvOES_validation(GLenum pname,const GLfixed* param)const{(this->*(this->m_orig_glLightModelxvOES))(pname,param);this->m_checkErrors("glLightModelxvOES");}
+FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC m_orig_glApplyTextureEXT = nullptr;
+void m_glApplyTextureEXT_validation(GLenum mode)const{(this->*(this->m_orig_glApplyTextureEXT))(mode);this->m_checkErrors("glApplyTextureEXT");}
+FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC m_orig_glGetImageHandleNV = nullptr;
+GLuint64 m_glGetImageHandleNV_validation(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{GLuint64 const result = (this->*(this->m_orig_glGetImageHandleNV))(texture,level,layered,layer,format);this->m_checkErrors("glGetImageHandleNV");return result;}
+FunctionTable::MEMBERPFNGLGETMINMAXPROC m_orig_glGetMinmax = nullptr;
+void m_glGetMinmax_validation(GLenum target,GLboolean reset,GLenum format,GLenum types,GLvoid* values)const{(this->*(this->m_orig_glGetMinmax))(target,reset,format,types,values);this->m_checkErrors("glGetMinmax");}
+FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC m_orig_glGetFixedvOES = nullptr;
+void m_glGetFixedvOES_validation(GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetFixedvOES))(pname,params);this->m_checkErrors("glGetFixedvOES");}
+FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC m_orig_glSamplePatternEXT = nullptr;
+void m_glSamplePatternEXT_validation(GLenum pattern)const{(this->*(this->m_orig_glSamplePatternEXT))(pattern);this->m_checkErrors("glSamplePatternEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM1FPROC m_orig_glUniform1f = nullptr;
+void m_glUniform1f_validation(GLint location,GLfloat v0)const{(this->*(this->m_orig_glUniform1f))(location,v0);this->m_checkErrors("glUniform1f");}
+FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glColor4fNormal3fVertex3fSUN = nullptr;
+void m_glColor4fNormal3fVertex3fSUN_validation(GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glColor4fNormal3fVertex3fSUN))(r,g,b,a,nx,ny,nz,x,y,z);this->m_checkErrors("glColor4fNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC m_orig_glFogCoorddvEXT = nullptr;
+void m_glFogCoorddvEXT_validation(const GLdouble* coord)const{(this->*(this->m_orig_glFogCoorddvEXT))(coord);this->m_checkErrors("glFogCoorddvEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC m_orig_glCopyTextureImage1DEXT = nullptr;
+void m_glCopyTextureImage1DEXT_validation(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{(this->*(this->m_orig_glCopyTextureImage1DEXT))(texture,target,level,internalformat,x,y,width,border);this->m_checkErrors("glCopyTextureImage1DEXT");}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC m_orig_glFlushMappedBufferRangeAPPLE = nullptr;
+void m_glFlushMappedBufferRangeAPPLE_validation(GLenum target,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glFlushMappedBufferRangeAPPLE))(target,offset,size);this->m_checkErrors("glFlushMappedBufferRangeAPPLE");}
+FunctionTable::MEMBERPFNGLVERTEX3SVPROC m_orig_glVertex3sv = nullptr;
+void m_glVertex3sv_validation(const GLshort* v)const{(this->*(this->m_orig_glVertex3sv))(v);this->m_checkErrors("glVertex3sv");}
+FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC m_orig_glFlushStaticDataIBM = nullptr;
+void m_glFlushStaticDataIBM_validation(GLenum target)const{(this->*(this->m_orig_glFlushStaticDataIBM))(target);this->m_checkErrors("glFlushStaticDataIBM");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC m_orig_glProgramUniform4ui64NV = nullptr;
+void m_glProgramUniform4ui64NV_validation(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{(this->*(this->m_orig_glProgramUniform4ui64NV))(program,location,x,y,z,w);this->m_checkErrors("glProgramUniform4ui64NV");}
+FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC m_orig_glRasterPos4xOES = nullptr;
+void m_glRasterPos4xOES_validation(GLfixed x,GLfixed y,GLfixed z,GLfixed w)const{(this->*(this->m_orig_glRasterPos4xOES))(x,y,z,w);this->m_checkErrors("glRasterPos4xOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC m_orig_glVertexAttribP1ui = nullptr;
+void m_glVertexAttribP1ui_validation(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{(this->*(this->m_orig_glVertexAttribP1ui))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP1ui");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC m_orig_glProgramUniform4dvEXT = nullptr;
+void m_glProgramUniform4dvEXT_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform4dvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform4dvEXT");}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC m_orig_glEndTransformFeedbackEXT = nullptr;
+void m_glEndTransformFeedbackEXT_validation()const{(this->*(this->m_orig_glEndTransformFeedbackEXT))();this->m_checkErrors("glEndTransformFeedbackEXT");}
+FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC m_orig_glBinormal3dEXT = nullptr;
+void m_glBinormal3dEXT_validation(GLdouble bx,GLdouble by,GLdouble bz)const{(this->*(this->m_orig_glBinormal3dEXT))(bx,by,bz);this->m_checkErrors("glBinormal3dEXT");}
+FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC m_orig_glGetTextureSubImage = nullptr;
+void m_glGetTextureSubImage_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{(this->*(this->m_orig_glGetTextureSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);this->m_checkErrors("glGetTextureSubImage");}
+FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC m_orig_glGetNamedRenderbufferParameteriv = nullptr;
+void m_glGetNamedRenderbufferParameteriv_validation(GLuint renderbuffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedRenderbufferParameteriv))(renderbuffer,pname,params);this->m_checkErrors("glGetNamedRenderbufferParameteriv");}
+FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC m_orig_glBindBuffersRange = nullptr;
+void m_glBindBuffersRange_validation(GLenum target,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizeiptr* sizes)const{(this->*(this->m_orig_glBindBuffersRange))(target,first,count,buffers,offsets,sizes);this->m_checkErrors("glBindBuffersRange");}
+FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC m_orig_glFinishAsyncSGIX = nullptr;
+GLint m_glFinishAsyncSGIX_validation(GLuint* markerp)const{GLint const result = (this->*(this->m_orig_glFinishAsyncSGIX))(markerp);this->m_checkErrors("glFinishAsyncSGIX");return result;}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC m_orig_glBindFragDataLocationIndexed = nullptr;
+void m_glBindFragDataLocationIndexed_validation(GLuint program,GLuint colorNumber,GLuint index,const GLchar* name)const{(this->*(this->m_orig_glBindFragDataLocationIndexed))(program,colorNumber,index,name);this->m_checkErrors("glBindFragDataLocationIndexed");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC m_orig_glMultiTexCoord2dv = nullptr;
+void m_glMultiTexCoord2dv_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord2dv))(target,v);this->m_checkErrors("glMultiTexCoord2dv");}
+FunctionTable::MEMBERPFNGLUNIFORM2IVPROC m_orig_glUniform2iv = nullptr;
+void m_glUniform2iv_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform2iv))(location,count,value);this->m_checkErrors("glUniform2iv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC m_orig_glProgramUniform2i64vNV = nullptr;
+void m_glProgramUniform2i64vNV_validation(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glProgramUniform2i64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform2i64vNV");}
+FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC m_orig_glFlushVertexArrayRangeAPPLE = nullptr;
+void m_glFlushVertexArrayRangeAPPLE_validation(GLsizei length,void* pointer)const{(this->*(this->m_orig_glFlushVertexArrayRangeAPPLE))(length,pointer);this->m_checkErrors("glFlushVertexArrayRangeAPPLE");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC m_orig_glTextureParameterf = nullptr;
+void m_glTextureParameterf_validation(GLuint texture,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glTextureParameterf))(texture,pname,param);this->m_checkErrors("glTextureParameterf");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC m_orig_glMultiTexCoord3dvARB = nullptr;
+void m_glMultiTexCoord3dvARB_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord3dvARB))(target,v);this->m_checkErrors("glMultiTexCoord3dvARB");}
+FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC m_orig_glFeedbackBuffer = nullptr;
+void m_glFeedbackBuffer_validation(GLsizei size,GLenum type,GLfloat* buffer)const{(this->*(this->m_orig_glFeedbackBuffer))(size,type,buffer);this->m_checkErrors("glFeedbackBuffer");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC m_orig_glDebugMessageInsertARB = nullptr;
+void m_glDebugMessageInsertARB_validation(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{(this->*(this->m_orig_glDebugMessageInsertARB))(source,type,id,severity,length,buf);this->m_checkErrors("glDebugMessageInsertARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC m_orig_glMultiTexCoord2i = nullptr;
+void m_glMultiTexCoord2i_validation(GLenum target,GLint s,GLint t)const{(this->*(this->m_orig_glMultiTexCoord2i))(target,s,t);this->m_checkErrors("glMultiTexCoord2i");}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC m_orig_glTextureSubImage3D = nullptr;
+void m_glTextureSubImage3D_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureSubImage3D))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);this->m_checkErrors("glTextureSubImage3D");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC m_orig_glFramebufferTexture1D = nullptr;
+void m_glFramebufferTexture1D_validation(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTexture1D))(target,attachment,textarget,texture,level);this->m_checkErrors("glFramebufferTexture1D");}
+FunctionTable::MEMBERPFNGLGETSHADERIVPROC m_orig_glGetShaderiv = nullptr;
+void m_glGetShaderiv_validation(GLuint shader,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetShaderiv))(shader,pname,params);this->m_checkErrors("glGetShaderiv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC m_orig_glMultiTexCoord2d = nullptr;
+void m_glMultiTexCoord2d_validation(GLenum target,GLdouble s,GLdouble t)const{(this->*(this->m_orig_glMultiTexCoord2d))(target,s,t);this->m_checkErrors("glMultiTexCoord2d");}
+FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC m_orig_glArrayObjectATI = nullptr;
+void m_glArrayObjectATI_validation(GLenum array,GLint size,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{(this->*(this->m_orig_glArrayObjectATI))(array,size,type,stride,buffer,offset);this->m_checkErrors("glArrayObjectATI");}
+FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC m_orig_glGetPointeri_vEXT = nullptr;
+void m_glGetPointeri_vEXT_validation(GLenum pname,GLuint index,void** params)const{(this->*(this->m_orig_glGetPointeri_vEXT))(pname,index,params);this->m_checkErrors("glGetPointeri_vEXT");}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC m_orig_glGetPerfMonitorCountersAMD = nullptr;
+void m_glGetPerfMonitorCountersAMD_validation(GLuint group,GLint* numCounters,GLint* maxActiveCounters,GLsizei counterSize,GLuint* counters)const{(this->*(this->m_orig_glGetPerfMonitorCountersAMD))(group,numCounters,maxActiveCounters,counterSize,counters);this->m_checkErrors("glGetPerfMonitorCountersAMD");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC m_orig_glNamedBufferStorage = nullptr;
+void m_glNamedBufferStorage_validation(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{(this->*(this->m_orig_glNamedBufferStorage))(buffer,size,data,flags);this->m_checkErrors("glNamedBufferStorage");}
+FunctionTable::MEMBERPFNGLTEXENVXVOESPROC m_orig_glTexEnvxvOES = nullptr;
+void m_glTexEnvxvOES_validation(GLenum target,GLenum pname,const GLfixed* params)const{(this->*(this->m_orig_glTexEnvxvOES))(target,pname,params);this->m_checkErrors("glTexEnvxvOES");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC m_orig_glProgramUniform2ui64NV = nullptr;
+void m_glProgramUniform2ui64NV_validation(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y)const{(this->*(this->m_orig_glProgramUniform2ui64NV))(program,location,x,y);this->m_checkErrors("glProgramUniform2ui64NV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC m_orig_glMultiTexCoord3bOES = nullptr;
+void m_glMultiTexCoord3bOES_validation(GLenum texture,GLbyte s,GLbyte t,GLbyte r)const{(this->*(this->m_orig_glMultiTexCoord3bOES))(texture,s,t,r);this->m_checkErrors("glMultiTexCoord3bOES");}
+FunctionTable::MEMBERPFNGLUNIFORM1DVPROC m_orig_glUniform1dv = nullptr;
+void m_glUniform1dv_validation(GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glUniform1dv))(location,count,value);this->m_checkErrors("glUniform1dv");}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC m_orig_glPixelTransferi = nullptr;
+void m_glPixelTransferi_validation(GLenum pname,GLint param)const{(this->*(this->m_orig_glPixelTransferi))(pname,param);this->m_checkErrors("glPixelTransferi");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC m_orig_glSecondaryColor3usvEXT = nullptr;
+void m_glSecondaryColor3usvEXT_validation(const GLushort* v)const{(this->*(this->m_orig_glSecondaryColor3usvEXT))(v);this->m_checkErrors("glSecondaryColor3usvEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC m_orig_glProgramEnvParameterI4uivNV = nullptr;
+void m_glProgramEnvParameterI4uivNV_validation(GLenum target,GLuint index,const GLuint* params)const{(this->*(this->m_orig_glProgramEnvParameterI4uivNV))(target,index,params);this->m_checkErrors("glProgramEnvParameterI4uivNV");}
+FunctionTable::MEMBERPFNGLVERTEX2SVPROC m_orig_glVertex2sv = nullptr;
+void m_glVertex2sv_validation(const GLshort* v)const{(this->*(this->m_orig_glVertex2sv))(v);this->m_checkErrors("glVertex2sv");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC m_orig_glWindowPos4dMESA = nullptr;
+void m_glWindowPos4dMESA_validation(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glWindowPos4dMESA))(x,y,z,w);this->m_checkErrors("glWindowPos4dMESA");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC m_orig_glDebugMessageControlARB = nullptr;
+void m_glDebugMessageControlARB_validation(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{(this->*(this->m_orig_glDebugMessageControlARB))(source,type,severity,count,ids,enabled);this->m_checkErrors("glDebugMessageControlARB");}
+FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC m_orig_glIsTextureEXT = nullptr;
+GLboolean m_glIsTextureEXT_validation(GLuint texture)const{GLboolean const result = (this->*(this->m_orig_glIsTextureEXT))(texture);this->m_checkErrors("glIsTextureEXT");return result;}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC m_orig_glFragmentMaterialivSGIX = nullptr;
+void m_glFragmentMaterialivSGIX_validation(GLenum face,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glFragmentMaterialivSGIX))(face,pname,params);this->m_checkErrors("glFragmentMaterialivSGIX");}
+FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC m_orig_glLinkProgramARB = nullptr;
+void m_glLinkProgramARB_validation(GLhandleARB programObj)const{(this->*(this->m_orig_glLinkProgramARB))(programObj);this->m_checkErrors("glLinkProgramARB");}
+FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC m_orig_glFinishFenceAPPLE = nullptr;
+void m_glFinishFenceAPPLE_validation(GLuint fence)const{(this->*(this->m_orig_glFinishFenceAPPLE))(fence);this->m_checkErrors("glFinishFenceAPPLE");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC m_orig_glVertexArrayVertexAttribBindingEXT = nullptr;
+void m_glVertexArrayVertexAttribBindingEXT_validation(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{(this->*(this->m_orig_glVertexArrayVertexAttribBindingEXT))(vaobj,attribindex,bindingindex);this->m_checkErrors("glVertexArrayVertexAttribBindingEXT");}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC m_orig_glTexStorageMem3DMultisampleEXT = nullptr;
+void m_glTexStorageMem3DMultisampleEXT_validation(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTexStorageMem3DMultisampleEXT))(target,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);this->m_checkErrors("glTexStorageMem3DMultisampleEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC m_orig_glUniform1ui64vARB = nullptr;
+void m_glUniform1ui64vARB_validation(GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glUniform1ui64vARB))(location,count,value);this->m_checkErrors("glUniform1ui64vARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC m_orig_glMultiTexCoord4fv = nullptr;
+void m_glMultiTexCoord4fv_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord4fv))(target,v);this->m_checkErrors("glMultiTexCoord4fv");}
+FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_orig_glMulticastFramebufferSampleLocationsfvNV = nullptr;
+void m_glMulticastFramebufferSampleLocationsfvNV_validation(GLuint gpu,GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glMulticastFramebufferSampleLocationsfvNV))(gpu,framebuffer,start,count,v);this->m_checkErrors("glMulticastFramebufferSampleLocationsfvNV");}
+FunctionTable::MEMBERPFNGLRASTERPOS3DPROC m_orig_glRasterPos3d = nullptr;
+void m_glRasterPos3d_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glRasterPos3d))(x,y,z);this->m_checkErrors("glRasterPos3d");}
+FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC m_orig_glPollAsyncSGIX = nullptr;
+GLint m_glPollAsyncSGIX_validation(GLuint* markerp)const{GLint const result = (this->*(this->m_orig_glPollAsyncSGIX))(markerp);this->m_checkErrors("glPollAsyncSGIX");return result;}
+FunctionTable::MEMBERPFNGLRASTERPOS3FPROC m_orig_glRasterPos3f = nullptr;
+void m_glRasterPos3f_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glRasterPos3f))(x,y,z);this->m_checkErrors("glRasterPos3f");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC m_orig_glCompressedTexImage3D = nullptr;
+void m_glCompressedTexImage3D_validation(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const GLvoid* data)const{(this->*(this->m_orig_glCompressedTexImage3D))(target,level,internalformat,width,height,depth,border,imageSize,data);this->m_checkErrors("glCompressedTexImage3D");}
+FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC m_orig_glVariantivEXT = nullptr;
+void m_glVariantivEXT_validation(GLuint id,const GLint* addr)const{(this->*(this->m_orig_glVariantivEXT))(id,addr);this->m_checkErrors("glVariantivEXT");}
+FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC m_orig_glUnmapTexture2DINTEL = nullptr;
+void m_glUnmapTexture2DINTEL_validation(GLuint texture,GLint level)const{(this->*(this->m_orig_glUnmapTexture2DINTEL))(texture,level);this->m_checkErrors("glUnmapTexture2DINTEL");}
+FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC m_orig_glMulticastWaitSyncNV = nullptr;
+void m_glMulticastWaitSyncNV_validation(GLuint signalGpu,GLbitfield waitGpuMask)const{(this->*(this->m_orig_glMulticastWaitSyncNV))(signalGpu,waitGpuMask);this->m_checkErrors("glMulticastWaitSyncNV");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC m_orig_glGetVertexAttribiv = nullptr;
+void m_glGetVertexAttribiv_validation(GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVertexAttribiv))(index,pname,params);this->m_checkErrors("glGetVertexAttribiv");}
+FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC m_orig_glGetPathCoordsNV = nullptr;
+void m_glGetPathCoordsNV_validation(GLuint path,GLfloat* coords)const{(this->*(this->m_orig_glGetPathCoordsNV))(path,coords);this->m_checkErrors("glGetPathCoordsNV");}
+FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC m_orig_glColor4xvOES = nullptr;
+void m_glColor4xvOES_validation(const GLfixed* components)const{(this->*(this->m_orig_glColor4xvOES))(components);this->m_checkErrors("glColor4xvOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC m_orig_glVertexAttrib3fv = nullptr;
+void m_glVertexAttrib3fv_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib3fv))(index,v);this->m_checkErrors("glVertexAttrib3fv");}
+FunctionTable::MEMBERPFNGLRASTERPOS3SPROC m_orig_glRasterPos3s = nullptr;
+void m_glRasterPos3s_validation(GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glRasterPos3s))(x,y,z);this->m_checkErrors("glRasterPos3s");}
+FunctionTable::MEMBERPFNGLVERTEX4BOESPROC m_orig_glVertex4bOES = nullptr;
+void m_glVertex4bOES_validation(GLbyte x,GLbyte y,GLbyte z,GLbyte w)const{(this->*(this->m_orig_glVertex4bOES))(x,y,z,w);this->m_checkErrors("glVertex4bOES");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC m_orig_glTransformFeedbackVaryingsEXT = nullptr;
+void m_glTransformFeedbackVaryingsEXT_validation(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{(this->*(this->m_orig_glTransformFeedbackVaryingsEXT))(program,count,varyings,bufferMode);this->m_checkErrors("glTransformFeedbackVaryingsEXT");}
+FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC m_orig_glCombinerOutputNV = nullptr;
+void m_glCombinerOutputNV_validation(GLenum stage,GLenum portion,GLenum abOutput,GLenum cdOutput,GLenum sumOutput,GLenum scale,GLenum bias,GLboolean abDotProduct,GLboolean cdDotProduct,GLboolean muxSum)const{(this->*(this->m_orig_glCombinerOutputNV))(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);this->m_checkErrors("glCombinerOutputNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC m_orig_glWindowPos4sMESA = nullptr;
+void m_glWindowPos4sMESA_validation(GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glWindowPos4sMESA))(x,y,z,w);this->m_checkErrors("glWindowPos4sMESA");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC m_orig_glVertexAttrib4svARB = nullptr;
+void m_glVertexAttrib4svARB_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib4svARB))(index,v);this->m_checkErrors("glVertexAttrib4svARB");}
+FunctionTable::MEMBERPFNGLISLISTPROC m_orig_glIsList = nullptr;
+GLboolean m_glIsList_validation(GLuint list)const{GLboolean const result = (this->*(this->m_orig_glIsList))(list);this->m_checkErrors("glIsList");return result;}
+FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC m_orig_glGetInfoLogARB = nullptr;
+void m_glGetInfoLogARB_validation(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* infoLog)const{(this->*(this->m_orig_glGetInfoLogARB))(obj,maxLength,length,infoLog);this->m_checkErrors("glGetInfoLogARB");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC m_orig_glUniformMatrix2fv = nullptr;
+void m_glUniformMatrix2fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix2fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix2fv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC m_orig_glVertexAttribs3dvNV = nullptr;
+void m_glVertexAttribs3dvNV_validation(GLuint index,GLsizei count,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribs3dvNV))(index,count,v);this->m_checkErrors("glVertexAttribs3dvNV");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC m_orig_glGlobalAlphaFactorsSUN = nullptr;
+void m_glGlobalAlphaFactorsSUN_validation(GLshort factor)const{(this->*(this->m_orig_glGlobalAlphaFactorsSUN))(factor);this->m_checkErrors("glGlobalAlphaFactorsSUN");}
+FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC m_orig_glGetTrackMatrixivNV = nullptr;
+void m_glGetTrackMatrixivNV_validation(GLenum target,GLuint address,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTrackMatrixivNV))(target,address,pname,params);this->m_checkErrors("glGetTrackMatrixivNV");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC m_orig_glTextureParameterfvEXT = nullptr;
+void m_glTextureParameterfvEXT_validation(GLuint texture,GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glTextureParameterfvEXT))(texture,target,pname,params);this->m_checkErrors("glTextureParameterfvEXT");}
+FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC m_orig_glIsNamedBufferResidentNV = nullptr;
+GLboolean m_glIsNamedBufferResidentNV_validation(GLuint buffer)const{GLboolean const result = (this->*(this->m_orig_glIsNamedBufferResidentNV))(buffer);this->m_checkErrors("glIsNamedBufferResidentNV");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC m_orig_glProgramUniform4ui64vARB = nullptr;
+void m_glProgramUniform4ui64vARB_validation(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glProgramUniform4ui64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform4ui64vARB");}
+FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC m_orig_glTbufferMask3DFX = nullptr;
+void m_glTbufferMask3DFX_validation(GLuint mask)const{(this->*(this->m_orig_glTbufferMask3DFX))(mask);this->m_checkErrors("glTbufferMask3DFX");}
+FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC m_orig_glCoverFillPathNV = nullptr;
+void m_glCoverFillPathNV_validation(GLuint path,GLenum coverMode)const{(this->*(this->m_orig_glCoverFillPathNV))(path,coverMode);this->m_checkErrors("glCoverFillPathNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC m_orig_glVertexAttrib1fvARB = nullptr;
+void m_glVertexAttrib1fvARB_validation(GLuint index,const GLfloat* v)const{(this->*(this->m_orig_glVertexAttrib1fvARB))(index,v);this->m_checkErrors("glVertexAttrib1fvARB");}
+FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC m_orig_glGenerateTextureMipmap = nullptr;
+void m_glGenerateTextureMipmap_validation(GLuint texture)const{(this->*(this->m_orig_glGenerateTextureMipmap))(texture);this->m_checkErrors("glGenerateTextureMipmap");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC m_orig_glNamedProgramLocalParameterI4uivEXT = nullptr;
+void m_glNamedProgramLocalParameterI4uivEXT_validation(GLuint program,GLenum target,GLuint index,const GLuint* params)const{(this->*(this->m_orig_glNamedProgramLocalParameterI4uivEXT))(program,target,index,params);this->m_checkErrors("glNamedProgramLocalParameterI4uivEXT");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC m_orig_glMultiDrawElementsBaseVertex = nullptr;
+void m_glMultiDrawElementsBaseVertex_validation(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount,const GLint* basevertex)const{(this->*(this->m_orig_glMultiDrawElementsBaseVertex))(mode,count,type,indices,drawcount,basevertex);this->m_checkErrors("glMultiDrawElementsBaseVertex");}
+FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC m_orig_glProgramSubroutineParametersuivNV = nullptr;
+void m_glProgramSubroutineParametersuivNV_validation(GLenum target,GLsizei count,const GLuint* params)const{(this->*(this->m_orig_glProgramSubroutineParametersuivNV))(target,count,params);this->m_checkErrors("glProgramSubroutineParametersuivNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC m_orig_glProgramUniformMatrix2x4dvEXT = nullptr;
+void m_glProgramUniformMatrix2x4dvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniformMatrix2x4dvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2x4dvEXT");}
+FunctionTable::MEMBERPFNGLROTATEXOESPROC m_orig_glRotatexOES = nullptr;
+void m_glRotatexOES_validation(GLfixed angle,GLfixed x,GLfixed y,GLfixed z)const{(this->*(this->m_orig_glRotatexOES))(angle,x,y,z);this->m_checkErrors("glRotatexOES");}
+FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC m_orig_glMemoryBarrierEXT = nullptr;
+void m_glMemoryBarrierEXT_validation(GLbitfield barriers)const{(this->*(this->m_orig_glMemoryBarrierEXT))(barriers);this->m_checkErrors("glMemoryBarrierEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC m_orig_glVertexAttrib3svNV = nullptr;
+void m_glVertexAttrib3svNV_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib3svNV))(index,v);this->m_checkErrors("glVertexAttrib3svNV");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC m_orig_glVertexStream3iATI = nullptr;
+void m_glVertexStream3iATI_validation(GLenum stream,GLint x,GLint y,GLint z)const{(this->*(this->m_orig_glVertexStream3iATI))(stream,x,y,z);this->m_checkErrors("glVertexStream3iATI");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC m_orig_glCompressedTexSubImage1D = nullptr;
+void m_glCompressedTexSubImage1D_validation(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const GLvoid* data)const{(this->*(this->m_orig_glCompressedTexSubImage1D))(target,level,xoffset,width,format,imageSize,data);this->m_checkErrors("glCompressedTexSubImage1D");}
+FunctionTable::MEMBERPFNGLSETFENCENVPROC m_orig_glSetFenceNV = nullptr;
+void m_glSetFenceNV_validation(GLuint fence,GLenum condition)const{(this->*(this->m_orig_glSetFenceNV))(fence,condition);this->m_checkErrors("glSetFenceNV");}
+FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC m_orig_glAttachObjectARB = nullptr;
+void m_glAttachObjectARB_validation(GLhandleARB containerObj,GLhandleARB obj)const{(this->*(this->m_orig_glAttachObjectARB))(containerObj,obj);this->m_checkErrors("glAttachObjectARB");}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC m_orig_glCopyConvolutionFilter1D = nullptr;
+void m_glCopyConvolutionFilter1D_validation(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyConvolutionFilter1D))(target,internalformat,x,y,width);this->m_checkErrors("glCopyConvolutionFilter1D");}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC m_orig_glTexStorageMem2DMultisampleEXT = nullptr;
+void m_glTexStorageMem2DMultisampleEXT_validation(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTexStorageMem2DMultisampleEXT))(target,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);this->m_checkErrors("glTexStorageMem2DMultisampleEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC m_orig_glProgramParameters4fvNV = nullptr;
+void m_glProgramParameters4fvNV_validation(GLenum target,GLuint index,GLsizei count,const GLfloat* v)const{(this->*(this->m_orig_glProgramParameters4fvNV))(target,index,count,v);this->m_checkErrors("glProgramParameters4fvNV");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC m_orig_glNamedFramebufferParameteriEXT = nullptr;
+void m_glNamedFramebufferParameteriEXT_validation(GLuint framebuffer,GLenum pname,GLint param)const{(this->*(this->m_orig_glNamedFramebufferParameteriEXT))(framebuffer,pname,param);this->m_checkErrors("glNamedFramebufferParameteriEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC m_orig_glVertexAttrib4Nsv = nullptr;
+void m_glVertexAttrib4Nsv_validation(GLuint index,const GLshort* v)const{(this->*(this->m_orig_glVertexAttrib4Nsv))(index,v);this->m_checkErrors("glVertexAttrib4Nsv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC m_orig_glVertexAttribI4usvEXT = nullptr;
+void m_glVertexAttribI4usvEXT_validation(GLuint index,const GLushort* v)const{(this->*(this->m_orig_glVertexAttribI4usvEXT))(index,v);this->m_checkErrors("glVertexAttribI4usvEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC m_orig_glTextureBufferRangeEXT = nullptr;
+void m_glTextureBufferRangeEXT_validation(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glTextureBufferRangeEXT))(texture,target,internalformat,buffer,offset,size);this->m_checkErrors("glTextureBufferRangeEXT");}
+FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC m_orig_glVertexP3uiv = nullptr;
+void m_glVertexP3uiv_validation(GLenum type,const GLuint* value)const{(this->*(this->m_orig_glVertexP3uiv))(type,value);this->m_checkErrors("glVertexP3uiv");}
+FunctionTable::MEMBERPFNGLISPATHNVPROC m_orig_glIsPathNV = nullptr;
+GLboolean m_glIsPathNV_validation(GLuint path)const{GLboolean const result = (this->*(this->m_orig_glIsPathNV))(path);this->m_checkErrors("glIsPathNV");return result;}
+FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC m_orig_glGetnUniformi64vARB = nullptr;
+void m_glGetnUniformi64vARB_validation(GLuint program,GLint location,GLsizei bufSize,GLint64* params)const{(this->*(this->m_orig_glGetnUniformi64vARB))(program,location,bufSize,params);this->m_checkErrors("glGetnUniformi64vARB");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC m_orig_glFramebufferTextureMultiviewOVR = nullptr;
+void m_glFramebufferTextureMultiviewOVR_validation(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint baseViewIndex,GLsizei numViews)const{(this->*(this->m_orig_glFramebufferTextureMultiviewOVR))(target,attachment,texture,level,baseViewIndex,numViews);this->m_checkErrors("glFramebufferTextureMultiviewOVR");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC m_orig_glCompressedMultiTexSubImage2DEXT = nullptr;
+void m_glCompressedMultiTexSubImage2DEXT_validation(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedMultiTexSubImage2DEXT))(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);this->m_checkErrors("glCompressedMultiTexSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLGETNMAPDVPROC m_orig_glGetnMapdv = nullptr;
+void m_glGetnMapdv_validation(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{(this->*(this->m_orig_glGetnMapdv))(target,query,bufSize,v);this->m_checkErrors("glGetnMapdv");}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC m_orig_glDebugMessageCallback = nullptr;
+void m_glDebugMessageCallback_validation(GLDEBUGPROC callback,const void* userParam)const{(this->*(this->m_orig_glDebugMessageCallback))(callback,userParam);this->m_checkErrors("glDebugMessageCallback");}
+FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC m_orig_glTangent3svEXT = nullptr;
+void m_glTangent3svEXT_validation(const GLshort* v)const{(this->*(this->m_orig_glTangent3svEXT))(v);this->m_checkErrors("glTangent3svEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC m_orig_glVertexAttribParameteriAMD = nullptr;
+void m_glVertexAttribParameteriAMD_validation(GLuint index,GLenum pname,GLint param)const{(this->*(this->m_orig_glVertexAttribParameteriAMD))(index,pname,param);this->m_checkErrors("glVertexAttribParameteriAMD");}
+FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC m_orig_glBufferSubDataARB = nullptr;
+void m_glBufferSubDataARB_validation(GLenum target,GLintptrARB offset,GLsizeiptrARB size,const void* data)const{(this->*(this->m_orig_glBufferSubDataARB))(target,offset,size,data);this->m_checkErrors("glBufferSubDataARB");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC m_orig_glGetVertexAttribLui64vARB = nullptr;
+void m_glGetVertexAttribLui64vARB_validation(GLuint index,GLenum pname,GLuint64EXT* params)const{(this->*(this->m_orig_glGetVertexAttribLui64vARB))(index,pname,params);this->m_checkErrors("glGetVertexAttribLui64vARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC m_orig_glVertexAttribL4ui64NV = nullptr;
+void m_glVertexAttribL4ui64NV_validation(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{(this->*(this->m_orig_glVertexAttribL4ui64NV))(index,x,y,z,w);this->m_checkErrors("glVertexAttribL4ui64NV");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC m_orig_glReplacementCodeuiColor4ubVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor4ubVertex3fSUN_validation(GLuint rc,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiColor4ubVertex3fSUN))(rc,r,g,b,a,x,y,z);this->m_checkErrors("glReplacementCodeuiColor4ubVertex3fSUN");}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC m_orig_glImageTransformParameterfHP = nullptr;
+void m_glImageTransformParameterfHP_validation(GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glImageTransformParameterfHP))(target,pname,param);this->m_checkErrors("glImageTransformParameterfHP");}
+FunctionTable::MEMBERPFNGLMAP1FPROC m_orig_glMap1f = nullptr;
+void m_glMap1f_validation(GLenum target,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{(this->*(this->m_orig_glMap1f))(target,u1,u2,stride,order,points);this->m_checkErrors("glMap1f");}
+FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC m_orig_glRasterPos4fv = nullptr;
+void m_glRasterPos4fv_validation(const GLfloat* v)const{(this->*(this->m_orig_glRasterPos4fv))(v);this->m_checkErrors("glRasterPos4fv");}
+FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC m_orig_glVertex2bvOES = nullptr;
+void m_glVertex2bvOES_validation(const GLbyte* coords)const{(this->*(this->m_orig_glVertex2bvOES))(coords);this->m_checkErrors("glVertex2bvOES");}
+FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC m_orig_glGetMapControlPointsNV = nullptr;
+void m_glGetMapControlPointsNV_validation(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLboolean packed,void* points)const{(this->*(this->m_orig_glGetMapControlPointsNV))(target,index,type,ustride,vstride,packed,points);this->m_checkErrors("glGetMapControlPointsNV");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC m_orig_glNamedProgramLocalParametersI4ivEXT = nullptr;
+void m_glNamedProgramLocalParametersI4ivEXT_validation(GLuint program,GLenum target,GLuint index,GLsizei count,const GLint* params)const{(this->*(this->m_orig_glNamedProgramLocalParametersI4ivEXT))(program,target,index,count,params);this->m_checkErrors("glNamedProgramLocalParametersI4ivEXT");}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC m_orig_glBindBufferRangeNV = nullptr;
+void m_glBindBufferRangeNV_validation(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{(this->*(this->m_orig_glBindBufferRangeNV))(target,index,buffer,offset,size);this->m_checkErrors("glBindBufferRangeNV");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC m_orig_glVertexStream3dvATI = nullptr;
+void m_glVertexStream3dvATI_validation(GLenum stream,const GLdouble* coords)const{(this->*(this->m_orig_glVertexStream3dvATI))(stream,coords);this->m_checkErrors("glVertexStream3dvATI");}
+FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC m_orig_glNormalPointerListIBM = nullptr;
+void m_glNormalPointerListIBM_validation(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{(this->*(this->m_orig_glNormalPointerListIBM))(type,stride,pointer,ptrstride);this->m_checkErrors("glNormalPointerListIBM");}
+FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC m_orig_glFogFuncSGIS = nullptr;
+void m_glFogFuncSGIS_validation(GLsizei n,const GLfloat* points)const{(this->*(this->m_orig_glFogFuncSGIS))(n,points);this->m_checkErrors("glFogFuncSGIS");}
+FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC m_orig_glMultiModeDrawArraysIBM = nullptr;
+void m_glMultiModeDrawArraysIBM_validation(const GLenum* mode,const GLint* first,const GLsizei* count,GLsizei primcount,GLint modestride)const{(this->*(this->m_orig_glMultiModeDrawArraysIBM))(mode,first,count,primcount,modestride);this->m_checkErrors("glMultiModeDrawArraysIBM");}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC m_orig_glGetNamedFramebufferAttachmentParameterivEXT = nullptr;
+void m_glGetNamedFramebufferAttachmentParameterivEXT_validation(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedFramebufferAttachmentParameterivEXT))(framebuffer,attachment,pname,params);this->m_checkErrors("glGetNamedFramebufferAttachmentParameterivEXT");}
+FunctionTable::MEMBERPFNGLGETFLOATVPROC m_orig_glGetFloatv = nullptr;
+void m_glGetFloatv_validation(GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetFloatv))(pname,params);this->m_checkErrors("glGetFloatv");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC m_orig_glVertexArrayVertexAttribIFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribIFormatEXT_validation(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexArrayVertexAttribIFormatEXT))(vaobj,attribindex,size,type,relativeoffset);this->m_checkErrors("glVertexArrayVertexAttribIFormatEXT");}
+FunctionTable::MEMBERPFNGLHINTPROC m_orig_glHint = nullptr;
+void m_glHint_validation(GLenum target,GLenum mode)const{(this->*(this->m_orig_glHint))(target,mode);this->m_checkErrors("glHint");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC m_orig_glVertexStream2svATI = nullptr;
+void m_glVertexStream2svATI_validation(GLenum stream,const GLshort* coords)const{(this->*(this->m_orig_glVertexStream2svATI))(stream,coords);this->m_checkErrors("glVertexStream2svATI");}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC m_orig_glMultiDrawArraysIndirect = nullptr;
+void m_glMultiDrawArraysIndirect_validation(GLenum mode,const void* indirect,GLsizei drawcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawArraysIndirect))(mode,indirect,drawcount,stride);this->m_checkErrors("glMultiDrawArraysIndirect");}
+FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC m_orig_glMultiTexEnvfvEXT = nullptr;
+void m_glMultiTexEnvfvEXT_validation(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glMultiTexEnvfvEXT))(texunit,target,pname,params);this->m_checkErrors("glMultiTexEnvfvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC m_orig_glVertexAttribP2uiv = nullptr;
+void m_glVertexAttribP2uiv_validation(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{(this->*(this->m_orig_glVertexAttribP2uiv))(index,type,normalized,value);this->m_checkErrors("glVertexAttribP2uiv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC m_orig_glProgramUniform1i64vARB = nullptr;
+void m_glProgramUniform1i64vARB_validation(GLuint program,GLint location,GLsizei count,const GLint64* value)const{(this->*(this->m_orig_glProgramUniform1i64vARB))(program,location,count,value);this->m_checkErrors("glProgramUniform1i64vARB");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC m_orig_glFramebufferTextureARB = nullptr;
+void m_glFramebufferTextureARB_validation(GLenum target,GLenum attachment,GLuint texture,GLint level)const{(this->*(this->m_orig_glFramebufferTextureARB))(target,attachment,texture,level);this->m_checkErrors("glFramebufferTextureARB");}
+FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC m_orig_glPushClientAttribDefaultEXT = nullptr;
+void m_glPushClientAttribDefaultEXT_validation(GLbitfield mask)const{(this->*(this->m_orig_glPushClientAttribDefaultEXT))(mask);this->m_checkErrors("glPushClientAttribDefaultEXT");}
+FunctionTable::MEMBERPFNGLSCALEFPROC m_orig_glScalef = nullptr;
+void m_glScalef_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glScalef))(x,y,z);this->m_checkErrors("glScalef");}
+FunctionTable::MEMBERPFNGLSCALEDPROC m_orig_glScaled = nullptr;
+void m_glScaled_validation(GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glScaled))(x,y,z);this->m_checkErrors("glScaled");}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC m_orig_glGetConvolutionParameterxvOES = nullptr;
+void m_glGetConvolutionParameterxvOES_validation(GLenum target,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetConvolutionParameterxvOES))(target,pname,params);this->m_checkErrors("glGetConvolutionParameterxvOES");}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC m_orig_glGetProgramResourceName = nullptr;
+void m_glGetProgramResourceName_validation(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei* length,GLchar* name)const{(this->*(this->m_orig_glGetProgramResourceName))(program,programInterface,index,bufSize,length,name);this->m_checkErrors("glGetProgramResourceName");}
+FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC m_orig_glCopyColorTable = nullptr;
+void m_glCopyColorTable_validation(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyColorTable))(target,internalformat,x,y,width);this->m_checkErrors("glCopyColorTable");}
+FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC m_orig_glDepthRangeArrayv = nullptr;
+void m_glDepthRangeArrayv_validation(GLuint first,GLsizei count,const GLdouble* v)const{(this->*(this->m_orig_glDepthRangeArrayv))(first,count,v);this->m_checkErrors("glDepthRangeArrayv");}
+FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC m_orig_glCoverFillPathInstancedNV = nullptr;
+void m_glCoverFillPathInstancedNV_validation(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glCoverFillPathInstancedNV))(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);this->m_checkErrors("glCoverFillPathInstancedNV");}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC m_orig_glMultiTexParameterivEXT = nullptr;
+void m_glMultiTexParameterivEXT_validation(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMultiTexParameterivEXT))(texunit,target,pname,params);this->m_checkErrors("glMultiTexParameterivEXT");}
+FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC m_orig_glGetActiveAtomicCounterBufferiv = nullptr;
+void m_glGetActiveAtomicCounterBufferiv_validation(GLuint program,GLuint bufferIndex,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetActiveAtomicCounterBufferiv))(program,bufferIndex,pname,params);this->m_checkErrors("glGetActiveAtomicCounterBufferiv");}
+FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC m_orig_glStencilOpSeparate = nullptr;
+void m_glStencilOpSeparate_validation(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{(this->*(this->m_orig_glStencilOpSeparate))(face,sfail,dpfail,dppass);this->m_checkErrors("glStencilOpSeparate");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC m_orig_glVertexAttrib4fNV = nullptr;
+void m_glVertexAttrib4fNV_validation(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glVertexAttrib4fNV))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4fNV");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC m_orig_glGetColorTableParameterivSGI = nullptr;
+void m_glGetColorTableParameterivSGI_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetColorTableParameterivSGI))(target,pname,params);this->m_checkErrors("glGetColorTableParameterivSGI");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC m_orig_glVertexArrayAttribBinding = nullptr;
+void m_glVertexArrayAttribBinding_validation(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{(this->*(this->m_orig_glVertexArrayAttribBinding))(vaobj,attribindex,bindingindex);this->m_checkErrors("glVertexArrayAttribBinding");}
+FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC m_orig_glIsSemaphoreEXT = nullptr;
+GLboolean m_glIsSemaphoreEXT_validation(GLuint semaphore)const{GLboolean const result = (this->*(this->m_orig_glIsSemaphoreEXT))(semaphore);this->m_checkErrors("glIsSemaphoreEXT");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC m_orig_glProgramParameters4dvNV = nullptr;
+void m_glProgramParameters4dvNV_validation(GLenum target,GLuint index,GLsizei count,const GLdouble* v)const{(this->*(this->m_orig_glProgramParameters4dvNV))(target,index,count,v);this->m_checkErrors("glProgramParameters4dvNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC m_orig_glVertexAttribL4dv = nullptr;
+void m_glVertexAttribL4dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttribL4dv))(index,v);this->m_checkErrors("glVertexAttribL4dv");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC m_orig_glGetTexParameteriv = nullptr;
+void m_glGetTexParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTexParameteriv))(target,pname,params);this->m_checkErrors("glGetTexParameteriv");}
+FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC m_orig_glGetUniformOffsetEXT = nullptr;
+GLintptr m_glGetUniformOffsetEXT_validation(GLuint program,GLint location)const{GLintptr const result = (this->*(this->m_orig_glGetUniformOffsetEXT))(program,location);this->m_checkErrors("glGetUniformOffsetEXT");return result;}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC m_orig_glGetVertexAttribPointerv = nullptr;
+void m_glGetVertexAttribPointerv_validation(GLuint index,GLenum pname,void** pointer)const{(this->*(this->m_orig_glGetVertexAttribPointerv))(index,pname,pointer);this->m_checkErrors("glGetVertexAttribPointerv");}
+FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC m_orig_glResumeTransformFeedbackNV = nullptr;
+void m_glResumeTransformFeedbackNV_validation()const{(this->*(this->m_orig_glResumeTransformFeedbackNV))();this->m_checkErrors("glResumeTransformFeedbackNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC m_orig_glProgramUniform3i64vNV = nullptr;
+void m_glProgramUniform3i64vNV_validation(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{(this->*(this->m_orig_glProgramUniform3i64vNV))(program,location,count,value);this->m_checkErrors("glProgramUniform3i64vNV");}
+FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC m_orig_glTangent3fEXT = nullptr;
+void m_glTangent3fEXT_validation(GLfloat tx,GLfloat ty,GLfloat tz)const{(this->*(this->m_orig_glTangent3fEXT))(tx,ty,tz);this->m_checkErrors("glTangent3fEXT");}
+FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC m_orig_glGetPathMetricRangeNV = nullptr;
+void m_glGetPathMetricRangeNV_validation(GLbitfield metricQueryMask,GLuint firstPathName,GLsizei numPaths,GLsizei stride,GLfloat* metrics)const{(this->*(this->m_orig_glGetPathMetricRangeNV))(metricQueryMask,firstPathName,numPaths,stride,metrics);this->m_checkErrors("glGetPathMetricRangeNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC m_orig_glWindowPos2iMESA = nullptr;
+void m_glWindowPos2iMESA_validation(GLint x,GLint y)const{(this->*(this->m_orig_glWindowPos2iMESA))(x,y);this->m_checkErrors("glWindowPos2iMESA");}
+FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC m_orig_glVertex2xvOES = nullptr;
+void m_glVertex2xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glVertex2xvOES))(coords);this->m_checkErrors("glVertex2xvOES");}
+FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC m_orig_glGetnCompressedTexImage = nullptr;
+void m_glGetnCompressedTexImage_validation(GLenum target,GLint lod,GLsizei bufSize,void* pixels)const{(this->*(this->m_orig_glGetnCompressedTexImage))(target,lod,bufSize,pixels);this->m_checkErrors("glGetnCompressedTexImage");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC m_orig_glWindowPos2dv = nullptr;
+void m_glWindowPos2dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos2dv))(v);this->m_checkErrors("glWindowPos2dv");}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC m_orig_glReplacementCodeuiVertex3fSUN = nullptr;
+void m_glReplacementCodeuiVertex3fSUN_validation(GLuint rc,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glReplacementCodeuiVertex3fSUN))(rc,x,y,z);this->m_checkErrors("glReplacementCodeuiVertex3fSUN");}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC m_orig_glGetTransformFeedbackVaryingEXT = nullptr;
+void m_glGetTransformFeedbackVaryingEXT_validation(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{(this->*(this->m_orig_glGetTransformFeedbackVaryingEXT))(program,index,bufSize,length,size,type,name);this->m_checkErrors("glGetTransformFeedbackVaryingEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC m_orig_glWindowPos3fARB = nullptr;
+void m_glWindowPos3fARB_validation(GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glWindowPos3fARB))(x,y,z);this->m_checkErrors("glWindowPos3fARB");}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC m_orig_glMapNamedBufferEXT = nullptr;
+void* m_glMapNamedBufferEXT_validation(GLuint buffer,GLenum access)const{void* const result = (this->*(this->m_orig_glMapNamedBufferEXT))(buffer,access);this->m_checkErrors("glMapNamedBufferEXT");return result;}
+FunctionTable::MEMBERPFNGLDISABLEPROC m_orig_glDisable = nullptr;
+void m_glDisable_validation(GLenum cap)const{(this->*(this->m_orig_glDisable))(cap);this->m_checkErrors("glDisable");}
+FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC m_orig_glIsPointInFillPathNV = nullptr;
+GLboolean m_glIsPointInFillPathNV_validation(GLuint path,GLuint mask,GLfloat x,GLfloat y)const{GLboolean const result = (this->*(this->m_orig_glIsPointInFillPathNV))(path,mask,x,y);this->m_checkErrors("glIsPointInFillPathNV");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC m_orig_glVertexAttribI2uiEXT = nullptr;
+void m_glVertexAttribI2uiEXT_validation(GLuint index,GLuint x,GLuint y)const{(this->*(this->m_orig_glVertexAttribI2uiEXT))(index,x,y);this->m_checkErrors("glVertexAttribI2uiEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC m_orig_glProgramUniform4uiv = nullptr;
+void m_glProgramUniform4uiv_validation(GLuint program,GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glProgramUniform4uiv))(program,location,count,value);this->m_checkErrors("glProgramUniform4uiv");}
+FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC m_orig_glQueryCounter = nullptr;
+void m_glQueryCounter_validation(GLuint id,GLenum target)const{(this->*(this->m_orig_glQueryCounter))(id,target);this->m_checkErrors("glQueryCounter");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC m_orig_glFramebufferRenderbufferEXT = nullptr;
+void m_glFramebufferRenderbufferEXT_validation(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{(this->*(this->m_orig_glFramebufferRenderbufferEXT))(target,attachment,renderbuffertarget,renderbuffer);this->m_checkErrors("glFramebufferRenderbufferEXT");}
+FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC m_orig_glBinormal3svEXT = nullptr;
+void m_glBinormal3svEXT_validation(const GLshort* v)const{(this->*(this->m_orig_glBinormal3svEXT))(v);this->m_checkErrors("glBinormal3svEXT");}
+FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC m_orig_glBindBufferOffsetNV = nullptr;
+void m_glBindBufferOffsetNV_validation(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{(this->*(this->m_orig_glBindBufferOffsetNV))(target,index,buffer,offset);this->m_checkErrors("glBindBufferOffsetNV");}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC m_orig_glCopyTextureSubImage2D = nullptr;
+void m_glCopyTextureSubImage2D_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTextureSubImage2D))(texture,level,xoffset,yoffset,x,y,width,height);this->m_checkErrors("glCopyTextureSubImage2D");}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC m_orig_glGetProgramResourcefvNV = nullptr;
+void m_glGetProgramResourcefvNV_validation(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLfloat* params)const{(this->*(this->m_orig_glGetProgramResourcefvNV))(program,programInterface,index,propCount,props,bufSize,length,params);this->m_checkErrors("glGetProgramResourcefvNV");}
+FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC m_orig_glBinormalPointerEXT = nullptr;
+void m_glBinormalPointerEXT_validation(GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glBinormalPointerEXT))(type,stride,pointer);this->m_checkErrors("glBinormalPointerEXT");}
+FunctionTable::MEMBERPFNGLGETLIGHTFVPROC m_orig_glGetLightfv = nullptr;
+void m_glGetLightfv_validation(GLenum light,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetLightfv))(light,pname,params);this->m_checkErrors("glGetLightfv");}
+FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC m_orig_glMulticastCopyImageSubDataNV = nullptr;
+void m_glMulticastCopyImageSubDataNV_validation(GLuint srcGpu,GLbitfield dstGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{(this->*(this->m_orig_glMulticastCopyImageSubDataNV))(srcGpu,dstGpuMask,srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);this->m_checkErrors("glMulticastCopyImageSubDataNV");}
+FunctionTable::MEMBERPFNGLVERTEX2BOESPROC m_orig_glVertex2bOES = nullptr;
+void m_glVertex2bOES_validation(GLbyte x,GLbyte y)const{(this->*(this->m_orig_glVertex2bOES))(x,y);this->m_checkErrors("glVertex2bOES");}
+FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC m_orig_glUniform2ivARB = nullptr;
+void m_glUniform2ivARB_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform2ivARB))(location,count,value);this->m_checkErrors("glUniform2ivARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC m_orig_glMultiTexCoord3s = nullptr;
+void m_glMultiTexCoord3s_validation(GLenum target,GLshort s,GLshort t,GLshort r)const{(this->*(this->m_orig_glMultiTexCoord3s))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3s");}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC m_orig_glGetHistogramParameterfvEXT = nullptr;
+void m_glGetHistogramParameterfvEXT_validation(GLenum target,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetHistogramParameterfvEXT))(target,pname,params);this->m_checkErrors("glGetHistogramParameterfvEXT");}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC m_orig_glGetProgramStringNV = nullptr;
+void m_glGetProgramStringNV_validation(GLuint id,GLenum pname,GLubyte* program)const{(this->*(this->m_orig_glGetProgramStringNV))(id,pname,program);this->m_checkErrors("glGetProgramStringNV");}
+FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC m_orig_glGetTexGenxvOES = nullptr;
+void m_glGetTexGenxvOES_validation(GLenum coord,GLenum pname,GLfixed* params)const{(this->*(this->m_orig_glGetTexGenxvOES))(coord,pname,params);this->m_checkErrors("glGetTexGenxvOES");}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC m_orig_glTextureSubImage2D = nullptr;
+void m_glTextureSubImage2D_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureSubImage2D))(texture,level,xoffset,yoffset,width,height,format,type,pixels);this->m_checkErrors("glTextureSubImage2D");}
+FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC m_orig_glObjectPurgeableAPPLE = nullptr;
+GLenum m_glObjectPurgeableAPPLE_validation(GLenum objectType,GLuint name,GLenum option)const{GLenum const result = (this->*(this->m_orig_glObjectPurgeableAPPLE))(objectType,name,option);this->m_checkErrors("glObjectPurgeableAPPLE");return result;}
+FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC m_orig_glColorTableSGI = nullptr;
+void m_glColorTableSGI_validation(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* table)const{(this->*(this->m_orig_glColorTableSGI))(target,internalformat,width,format,type,table);this->m_checkErrors("glColorTableSGI");}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC m_orig_glCopyConvolutionFilter2DEXT = nullptr;
+void m_glCopyConvolutionFilter2DEXT_validation(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyConvolutionFilter2DEXT))(target,internalformat,x,y,width,height);this->m_checkErrors("glCopyConvolutionFilter2DEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC m_orig_glMultiTexCoord3f = nullptr;
+void m_glMultiTexCoord3f_validation(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{(this->*(this->m_orig_glMultiTexCoord3f))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3f");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC m_orig_glMultiTexCoord3d = nullptr;
+void m_glMultiTexCoord3d_validation(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{(this->*(this->m_orig_glMultiTexCoord3d))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3d");}
+FunctionTable::MEMBERPFNGLFOGCOORDDVPROC m_orig_glFogCoorddv = nullptr;
+void m_glFogCoorddv_validation(const GLdouble* coord)const{(this->*(this->m_orig_glFogCoorddv))(coord);this->m_checkErrors("glFogCoorddv");}
+FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC m_orig_glGetBufferPointerv = nullptr;
+void m_glGetBufferPointerv_validation(GLenum target,GLenum pname,void** params)const{(this->*(this->m_orig_glGetBufferPointerv))(target,pname,params);this->m_checkErrors("glGetBufferPointerv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC m_orig_glProgramUniform1fEXT = nullptr;
+void m_glProgramUniform1fEXT_validation(GLuint program,GLint location,GLfloat v0)const{(this->*(this->m_orig_glProgramUniform1fEXT))(program,location,v0);this->m_checkErrors("glProgramUniform1fEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC m_orig_glWindowPos2fvMESA = nullptr;
+void m_glWindowPos2fvMESA_validation(const GLfloat* v)const{(this->*(this->m_orig_glWindowPos2fvMESA))(v);this->m_checkErrors("glWindowPos2fvMESA");}
+FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC m_orig_glAlphaToCoverageDitherControlNV = nullptr;
+void m_glAlphaToCoverageDitherControlNV_validation(GLenum mode)const{(this->*(this->m_orig_glAlphaToCoverageDitherControlNV))(mode);this->m_checkErrors("glAlphaToCoverageDitherControlNV");}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC m_orig_glPolygonOffsetxOES = nullptr;
+void m_glPolygonOffsetxOES_validation(GLfixed factor,GLfixed units)const{(this->*(this->m_orig_glPolygonOffsetxOES))(factor,units);this->m_checkErrors("glPolygonOffsetxOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC m_orig_glVertexAttrib4dARB = nullptr;
+void m_glVertexAttrib4dARB_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertexAttrib4dARB))(index,x,y,z,w);this->m_checkErrors("glVertexAttrib4dARB");}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC m_orig_glUniformHandleui64vARB = nullptr;
+void m_glUniformHandleui64vARB_validation(GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glUniformHandleui64vARB))(location,count,value);this->m_checkErrors("glUniformHandleui64vARB");}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC m_orig_glFragmentLightModelfvSGIX = nullptr;
+void m_glFragmentLightModelfvSGIX_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glFragmentLightModelfvSGIX))(pname,params);this->m_checkErrors("glFragmentLightModelfvSGIX");}
+FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC m_orig_glSwizzleEXT = nullptr;
+void m_glSwizzleEXT_validation(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{(this->*(this->m_orig_glSwizzleEXT))(res,in,outX,outY,outZ,outW);this->m_checkErrors("glSwizzleEXT");}
+FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC m_orig_glBindFragmentShaderATI = nullptr;
+void m_glBindFragmentShaderATI_validation(GLuint id)const{(this->*(this->m_orig_glBindFragmentShaderATI))(id);this->m_checkErrors("glBindFragmentShaderATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC m_orig_glVertexAttribs3hvNV = nullptr;
+void m_glVertexAttribs3hvNV_validation(GLuint index,GLsizei n,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttribs3hvNV))(index,n,v);this->m_checkErrors("glVertexAttribs3hvNV");}
+FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC m_orig_glGenBuffersARB = nullptr;
+void m_glGenBuffersARB_validation(GLsizei n,GLuint* buffers)const{(this->*(this->m_orig_glGenBuffersARB))(n,buffers);this->m_checkErrors("glGenBuffersARB");}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC m_orig_glTextureStorageMem2DMultisampleEXT = nullptr;
+void m_glTextureStorageMem2DMultisampleEXT_validation(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTextureStorageMem2DMultisampleEXT))(texture,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);this->m_checkErrors("glTextureStorageMem2DMultisampleEXT");}
+FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC m_orig_glListParameterfvSGIX = nullptr;
+void m_glListParameterfvSGIX_validation(GLuint list,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glListParameterfvSGIX))(list,pname,params);this->m_checkErrors("glListParameterfvSGIX");}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC m_orig_glNamedRenderbufferStorageMultisample = nullptr;
+void m_glNamedRenderbufferStorageMultisample_validation(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glNamedRenderbufferStorageMultisample))(renderbuffer,samples,internalformat,width,height);this->m_checkErrors("glNamedRenderbufferStorageMultisample");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC m_orig_glVertexAttribI1iEXT = nullptr;
+void m_glVertexAttribI1iEXT_validation(GLuint index,GLint x)const{(this->*(this->m_orig_glVertexAttribI1iEXT))(index,x);this->m_checkErrors("glVertexAttribI1iEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC m_orig_glMultiTexCoord2ivARB = nullptr;
+void m_glMultiTexCoord2ivARB_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord2ivARB))(target,v);this->m_checkErrors("glMultiTexCoord2ivARB");}
+FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC m_orig_glLightModelxOES = nullptr;
+void m_glLightModelxOES_validation(GLenum pname,GLfixed param)const{(this->*(this->m_orig_glLightModelxOES))(pname,param);this->m_checkErrors("glLightModelxOES");}
+FunctionTable::MEMBERPFNGLCOLOR3XOESPROC m_orig_glColor3xOES = nullptr;
+void m_glColor3xOES_validation(GLfixed red,GLfixed green,GLfixed blue)const{(this->*(this->m_orig_glColor3xOES))(red,green,blue);this->m_checkErrors("glColor3xOES");}
+FunctionTable::MEMBERPFNGLREADBUFFERPROC m_orig_glReadBuffer = nullptr;
+void m_glReadBuffer_validation(GLenum mode)const{(this->*(this->m_orig_glReadBuffer))(mode);this->m_checkErrors("glReadBuffer");}
+FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC m_orig_glStencilFillPathInstancedNV = nullptr;
+void m_glStencilFillPathInstancedNV_validation(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{(this->*(this->m_orig_glStencilFillPathInstancedNV))(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);this->m_checkErrors("glStencilFillPathInstancedNV");}
+FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC m_orig_glVDPAUUnmapSurfacesNV = nullptr;
+void m_glVDPAUUnmapSurfacesNV_validation(GLsizei numSurface,const GLvdpauSurfaceNV* surfaces)const{(this->*(this->m_orig_glVDPAUUnmapSurfacesNV))(numSurface,surfaces);this->m_checkErrors("glVDPAUUnmapSurfacesNV");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC m_orig_glProgramUniform4i64NV = nullptr;
+void m_glProgramUniform4i64NV_validation(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{(this->*(this->m_orig_glProgramUniform4i64NV))(program,location,x,y,z,w);this->m_checkErrors("glProgramUniform4i64NV");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC m_orig_glVertexStream4dvATI = nullptr;
+void m_glVertexStream4dvATI_validation(GLenum stream,const GLdouble* coords)const{(this->*(this->m_orig_glVertexStream4dvATI))(stream,coords);this->m_checkErrors("glVertexStream4dvATI");}
+FunctionTable::MEMBERPFNGLISQUERYPROC m_orig_glIsQuery = nullptr;
+GLboolean m_glIsQuery_validation(GLuint id)const{GLboolean const result = (this->*(this->m_orig_glIsQuery))(id);this->m_checkErrors("glIsQuery");return result;}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC m_orig_glProgramUniformMatrix4fvEXT = nullptr;
+void m_glProgramUniformMatrix4fvEXT_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix4fvEXT))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4fvEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC m_orig_glVertexAttrib3hNV = nullptr;
+void m_glVertexAttrib3hNV_validation(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z)const{(this->*(this->m_orig_glVertexAttrib3hNV))(index,x,y,z);this->m_checkErrors("glVertexAttrib3hNV");}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC m_orig_glFlushMappedNamedBufferRange = nullptr;
+void m_glFlushMappedNamedBufferRange_validation(GLuint buffer,GLintptr offset,GLsizeiptr length)const{(this->*(this->m_orig_glFlushMappedNamedBufferRange))(buffer,offset,length);this->m_checkErrors("glFlushMappedNamedBufferRange");}
+FunctionTable::MEMBERPFNGLPUSHNAMEPROC m_orig_glPushName = nullptr;
+void m_glPushName_validation(GLuint name)const{(this->*(this->m_orig_glPushName))(name);this->m_checkErrors("glPushName");}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC m_orig_glGetClipPlane = nullptr;
+void m_glGetClipPlane_validation(GLenum plane,GLdouble* equation)const{(this->*(this->m_orig_glGetClipPlane))(plane,equation);this->m_checkErrors("glGetClipPlane");}
+FunctionTable::MEMBERPFNGLVERTEX4DVPROC m_orig_glVertex4dv = nullptr;
+void m_glVertex4dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glVertex4dv))(v);this->m_checkErrors("glVertex4dv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC m_orig_glVertexAttrib3d = nullptr;
+void m_glVertexAttrib3d_validation(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{(this->*(this->m_orig_glVertexAttrib3d))(index,x,y,z);this->m_checkErrors("glVertexAttrib3d");}
+FunctionTable::MEMBERPFNGLBLENDCOLORPROC m_orig_glBlendColor = nullptr;
+void m_glBlendColor_validation(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{(this->*(this->m_orig_glBlendColor))(red,green,blue,alpha);this->m_checkErrors("glBlendColor");}
+FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC m_orig_glBindTransformFeedbackNV = nullptr;
+void m_glBindTransformFeedbackNV_validation(GLenum target,GLuint id)const{(this->*(this->m_orig_glBindTransformFeedbackNV))(target,id);this->m_checkErrors("glBindTransformFeedbackNV");}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC m_orig_glSamplerParameterIuiv = nullptr;
+void m_glSamplerParameterIuiv_validation(GLuint sampler,GLenum pname,const GLuint* param)const{(this->*(this->m_orig_glSamplerParameterIuiv))(sampler,pname,param);this->m_checkErrors("glSamplerParameterIuiv");}
+FunctionTable::MEMBERPFNGLINDEXUBVPROC m_orig_glIndexubv = nullptr;
+void m_glIndexubv_validation(const GLubyte* c)const{(this->*(this->m_orig_glIndexubv))(c);this->m_checkErrors("glIndexubv");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC m_orig_glNamedBufferPageCommitmentEXT = nullptr;
+void m_glNamedBufferPageCommitmentEXT_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{(this->*(this->m_orig_glNamedBufferPageCommitmentEXT))(buffer,offset,size,commit);this->m_checkErrors("glNamedBufferPageCommitmentEXT");}
+FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC m_orig_glCheckNamedFramebufferStatus = nullptr;
+GLenum m_glCheckNamedFramebufferStatus_validation(GLuint framebuffer,GLenum target)const{GLenum const result = (this->*(this->m_orig_glCheckNamedFramebufferStatus))(framebuffer,target);this->m_checkErrors("glCheckNamedFramebufferStatus");return result;}
+FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC m_orig_glGetObjectBufferfvATI = nullptr;
+void m_glGetObjectBufferfvATI_validation(GLuint buffer,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetObjectBufferfvATI))(buffer,pname,params);this->m_checkErrors("glGetObjectBufferfvATI");}
+FunctionTable::MEMBERPFNGLRASTERPOS4DPROC m_orig_glRasterPos4d = nullptr;
+void m_glRasterPos4d_validation(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glRasterPos4d))(x,y,z,w);this->m_checkErrors("glRasterPos4d");}
+FunctionTable::MEMBERPFNGLRASTERPOS4FPROC m_orig_glRasterPos4f = nullptr;
+void m_glRasterPos4f_validation(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glRasterPos4f))(x,y,z,w);this->m_checkErrors("glRasterPos4f");}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC m_orig_glGetPerfMonitorCounterStringAMD = nullptr;
+void m_glGetPerfMonitorCounterStringAMD_validation(GLuint group,GLuint counter,GLsizei bufSize,GLsizei* length,GLchar* counterString)const{(this->*(this->m_orig_glGetPerfMonitorCounterStringAMD))(group,counter,bufSize,length,counterString);this->m_checkErrors("glGetPerfMonitorCounterStringAMD");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC m_orig_glVertexAttrib3s = nullptr;
+void m_glVertexAttrib3s_validation(GLuint index,GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glVertexAttrib3s))(index,x,y,z);this->m_checkErrors("glVertexAttrib3s");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC m_orig_glDrawElementsInstancedEXT = nullptr;
+void m_glDrawElementsInstancedEXT_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{(this->*(this->m_orig_glDrawElementsInstancedEXT))(mode,count,type,indices,primcount);this->m_checkErrors("glDrawElementsInstancedEXT");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC m_orig_glNamedProgramLocalParameterI4iEXT = nullptr;
+void m_glNamedProgramLocalParameterI4iEXT_validation(GLuint program,GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{(this->*(this->m_orig_glNamedProgramLocalParameterI4iEXT))(program,target,index,x,y,z,w);this->m_checkErrors("glNamedProgramLocalParameterI4iEXT");}
+FunctionTable::MEMBERPFNGLRASTERPOS4SPROC m_orig_glRasterPos4s = nullptr;
+void m_glRasterPos4s_validation(GLshort x,GLshort y,GLshort z,GLshort w)const{(this->*(this->m_orig_glRasterPos4s))(x,y,z,w);this->m_checkErrors("glRasterPos4s");}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC m_orig_glGetProgramStageiv = nullptr;
+void m_glGetProgramStageiv_validation(GLuint program,GLenum shadertype,GLenum pname,GLint* values)const{(this->*(this->m_orig_glGetProgramStageiv))(program,shadertype,pname,values);this->m_checkErrors("glGetProgramStageiv");}
+FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC m_orig_glGetMaterialxOES = nullptr;
+void m_glGetMaterialxOES_validation(GLenum face,GLenum pname,GLfixed param)const{(this->*(this->m_orig_glGetMaterialxOES))(face,pname,param);this->m_checkErrors("glGetMaterialxOES");}
+FunctionTable::MEMBERPFNGLPOPMATRIXPROC m_orig_glPopMatrix = nullptr;
+void m_glPopMatrix_validation()const{(this->*(this->m_orig_glPopMatrix))();this->m_checkErrors("glPopMatrix");}
+FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC m_orig_glGetVideoui64vNV = nullptr;
+void m_glGetVideoui64vNV_validation(GLuint video_slot,GLenum pname,GLuint64EXT* params)const{(this->*(this->m_orig_glGetVideoui64vNV))(video_slot,pname,params);this->m_checkErrors("glGetVideoui64vNV");}
+FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC m_orig_glTangent3bEXT = nullptr;
+void m_glTangent3bEXT_validation(GLbyte tx,GLbyte ty,GLbyte tz)const{(this->*(this->m_orig_glTangent3bEXT))(tx,ty,tz);this->m_checkErrors("glTangent3bEXT");}
+FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC m_orig_glGetGraphicsResetStatusARB = nullptr;
+GLenum m_glGetGraphicsResetStatusARB_validation()const{GLenum const result = (this->*(this->m_orig_glGetGraphicsResetStatusARB))();this->m_checkErrors("glGetGraphicsResetStatusARB");return result;}
+FunctionTable::MEMBERPFNGLUNIFORM4IPROC m_orig_glUniform4i = nullptr;
+void m_glUniform4i_validation(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{(this->*(this->m_orig_glUniform4i))(location,v0,v1,v2,v3);this->m_checkErrors("glUniform4i");}
+FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC m_orig_glActiveTexture = nullptr;
+void m_glActiveTexture_validation(GLenum texture)const{(this->*(this->m_orig_glActiveTexture))(texture);this->m_checkErrors("glActiveTexture");}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC m_orig_glEnableVertexAttribArray = nullptr;
+void m_glEnableVertexAttribArray_validation(GLuint index)const{(this->*(this->m_orig_glEnableVertexAttribArray))(index);this->m_checkErrors("glEnableVertexAttribArray");}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC m_orig_glTexCoord4fVertex4fvSUN = nullptr;
+void m_glTexCoord4fVertex4fvSUN_validation(const GLfloat* tc,const GLfloat* v)const{(this->*(this->m_orig_glTexCoord4fVertex4fvSUN))(tc,v);this->m_checkErrors("glTexCoord4fVertex4fvSUN");}
+FunctionTable::MEMBERPFNGLUNIFORM4DPROC m_orig_glUniform4d = nullptr;
+void m_glUniform4d_validation(GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glUniform4d))(location,x,y,z,w);this->m_checkErrors("glUniform4d");}
+FunctionTable::MEMBERPFNGLUNIFORM4FPROC m_orig_glUniform4f = nullptr;
+void m_glUniform4f_validation(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{(this->*(this->m_orig_glUniform4f))(location,v0,v1,v2,v3);this->m_checkErrors("glUniform4f");}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC m_orig_glRenderbufferStorageMultisample = nullptr;
+void m_glRenderbufferStorageMultisample_validation(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glRenderbufferStorageMultisample))(target,samples,internalformat,width,height);this->m_checkErrors("glRenderbufferStorageMultisample");}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC m_orig_glCreateProgramPipelines = nullptr;
+void m_glCreateProgramPipelines_validation(GLsizei n,GLuint* pipelines)const{(this->*(this->m_orig_glCreateProgramPipelines))(n,pipelines);this->m_checkErrors("glCreateProgramPipelines");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC m_orig_glVertexAttribLPointer = nullptr;
+void m_glVertexAttribLPointer_validation(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribLPointer))(index,size,type,stride,pointer);this->m_checkErrors("glVertexAttribLPointer");}
+FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC m_orig_glUniform2uiEXT = nullptr;
+void m_glUniform2uiEXT_validation(GLint location,GLuint v0,GLuint v1)const{(this->*(this->m_orig_glUniform2uiEXT))(location,v0,v1);this->m_checkErrors("glUniform2uiEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC m_orig_glMultiTexCoord3sv = nullptr;
+void m_glMultiTexCoord3sv_validation(GLenum target,const GLshort* v)const{(this->*(this->m_orig_glMultiTexCoord3sv))(target,v);this->m_checkErrors("glMultiTexCoord3sv");}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC m_orig_glDrawElementsInstancedBaseVertex = nullptr;
+void m_glDrawElementsInstancedBaseVertex_validation(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex)const{(this->*(this->m_orig_glDrawElementsInstancedBaseVertex))(mode,count,type,indices,instancecount,basevertex);this->m_checkErrors("glDrawElementsInstancedBaseVertex");}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC m_orig_glPixelTransformParameterfvEXT = nullptr;
+void m_glPixelTransformParameterfvEXT_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glPixelTransformParameterfvEXT))(target,pname,params);this->m_checkErrors("glPixelTransformParameterfvEXT");}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC m_orig_glDrawTransformFeedbackNV = nullptr;
+void m_glDrawTransformFeedbackNV_validation(GLenum mode,GLuint id)const{(this->*(this->m_orig_glDrawTransformFeedbackNV))(mode,id);this->m_checkErrors("glDrawTransformFeedbackNV");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC m_orig_glTextureImage2DMultisampleCoverageNV = nullptr;
+void m_glTextureImage2DMultisampleCoverageNV_validation(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{(this->*(this->m_orig_glTextureImage2DMultisampleCoverageNV))(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);this->m_checkErrors("glTextureImage2DMultisampleCoverageNV");}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT = nullptr;
+void m_glNamedRenderbufferStorageMultisampleCoverageEXT_validation(GLuint renderbuffer,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT))(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);this->m_checkErrors("glNamedRenderbufferStorageMultisampleCoverageEXT");}
+FunctionTable::MEMBERPFNGLISTEXTUREPROC m_orig_glIsTexture = nullptr;
+GLboolean m_glIsTexture_validation(GLuint texture)const{GLboolean const result = (this->*(this->m_orig_glIsTexture))(texture);this->m_checkErrors("glIsTexture");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC m_orig_glMultiTexCoord4iv = nullptr;
+void m_glMultiTexCoord4iv_validation(GLenum target,const GLint* v)const{(this->*(this->m_orig_glMultiTexCoord4iv))(target,v);this->m_checkErrors("glMultiTexCoord4iv");}
+FunctionTable::MEMBERPFNGLTEXENVFVPROC m_orig_glTexEnvfv = nullptr;
+void m_glTexEnvfv_validation(GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glTexEnvfv))(target,pname,params);this->m_checkErrors("glTexEnvfv");}
+FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC m_orig_glPopDebugGroup = nullptr;
+void m_glPopDebugGroup_validation()const{(this->*(this->m_orig_glPopDebugGroup))();this->m_checkErrors("glPopDebugGroup");}
+FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC m_orig_glUniformBlockBinding = nullptr;
+void m_glUniformBlockBinding_validation(GLuint program,GLuint uniformBlockIndex,GLuint uniformBlockBinding)const{(this->*(this->m_orig_glUniformBlockBinding))(program,uniformBlockIndex,uniformBlockBinding);this->m_checkErrors("glUniformBlockBinding");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC m_orig_glWindowPos2svMESA = nullptr;
+void m_glWindowPos2svMESA_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos2svMESA))(v);this->m_checkErrors("glWindowPos2svMESA");}
+FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC m_orig_glGenerateTextureMipmapEXT = nullptr;
+void m_glGenerateTextureMipmapEXT_validation(GLuint texture,GLenum target)const{(this->*(this->m_orig_glGenerateTextureMipmapEXT))(texture,target);this->m_checkErrors("glGenerateTextureMipmapEXT");}
+FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC m_orig_glBindLightParameterEXT = nullptr;
+GLuint m_glBindLightParameterEXT_validation(GLenum light,GLenum value)const{GLuint const result = (this->*(this->m_orig_glBindLightParameterEXT))(light,value);this->m_checkErrors("glBindLightParameterEXT");return result;}
+FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC m_orig_glTexCoord3bOES = nullptr;
+void m_glTexCoord3bOES_validation(GLbyte s,GLbyte t,GLbyte r)const{(this->*(this->m_orig_glTexCoord3bOES))(s,t,r);this->m_checkErrors("glTexCoord3bOES");}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC m_orig_glTexCoordPointer = nullptr;
+void m_glTexCoordPointer_validation(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{(this->*(this->m_orig_glTexCoordPointer))(size,type,stride,ptr);this->m_checkErrors("glTexCoordPointer");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC m_orig_glProgramUniformMatrix3x2fv = nullptr;
+void m_glProgramUniformMatrix3x2fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix3x2fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix3x2fv");}
+FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC m_orig_glUniform2fvARB = nullptr;
+void m_glUniform2fvARB_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform2fvARB))(location,count,value);this->m_checkErrors("glUniform2fvARB");}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC m_orig_glProgramLocalParameterI4uivNV = nullptr;
+void m_glProgramLocalParameterI4uivNV_validation(GLenum target,GLuint index,const GLuint* params)const{(this->*(this->m_orig_glProgramLocalParameterI4uivNV))(target,index,params);this->m_checkErrors("glProgramLocalParameterI4uivNV");}
+FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC m_orig_glFlushVertexArrayRangeNV = nullptr;
+void m_glFlushVertexArrayRangeNV_validation()const{(this->*(this->m_orig_glFlushVertexArrayRangeNV))();this->m_checkErrors("glFlushVertexArrayRangeNV");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC m_orig_glSecondaryColor3svEXT = nullptr;
+void m_glSecondaryColor3svEXT_validation(const GLshort* v)const{(this->*(this->m_orig_glSecondaryColor3svEXT))(v);this->m_checkErrors("glSecondaryColor3svEXT");}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC m_orig_glGetBufferParameteriv = nullptr;
+void m_glGetBufferParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetBufferParameteriv))(target,pname,params);this->m_checkErrors("glGetBufferParameteriv");}
+FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC m_orig_glGetQueryIndexediv = nullptr;
+void m_glGetQueryIndexediv_validation(GLenum target,GLuint index,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetQueryIndexediv))(target,index,pname,params);this->m_checkErrors("glGetQueryIndexediv");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC m_orig_glFramebufferTexture3DEXT = nullptr;
+void m_glFramebufferTexture3DEXT_validation(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{(this->*(this->m_orig_glFramebufferTexture3DEXT))(target,attachment,textarget,texture,level,zoffset);this->m_checkErrors("glFramebufferTexture3DEXT");}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC m_orig_glLoadTransposeMatrixxOES = nullptr;
+void m_glLoadTransposeMatrixxOES_validation(const GLfixed* m)const{(this->*(this->m_orig_glLoadTransposeMatrixxOES))(m);this->m_checkErrors("glLoadTransposeMatrixxOES");}
+FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC m_orig_glDeleteTransformFeedbacksNV = nullptr;
+void m_glDeleteTransformFeedbacksNV_validation(GLsizei n,const GLuint* ids)const{(this->*(this->m_orig_glDeleteTransformFeedbacksNV))(n,ids);this->m_checkErrors("glDeleteTransformFeedbacksNV");}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC m_orig_glGetCompressedTextureImageEXT = nullptr;
+void m_glGetCompressedTextureImageEXT_validation(GLuint texture,GLenum target,GLint lod,void* img)const{(this->*(this->m_orig_glGetCompressedTextureImageEXT))(texture,target,lod,img);this->m_checkErrors("glGetCompressedTextureImageEXT");}
+FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC m_orig_glIndexMaterialEXT = nullptr;
+void m_glIndexMaterialEXT_validation(GLenum face,GLenum mode)const{(this->*(this->m_orig_glIndexMaterialEXT))(face,mode);this->m_checkErrors("glIndexMaterialEXT");}
+FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC m_orig_glFogCoorddEXT = nullptr;
+void m_glFogCoorddEXT_validation(GLdouble coord)const{(this->*(this->m_orig_glFogCoorddEXT))(coord);this->m_checkErrors("glFogCoorddEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC m_orig_glTexCoord2hvNV = nullptr;
+void m_glTexCoord2hvNV_validation(const GLhalfNV* v)const{(this->*(this->m_orig_glTexCoord2hvNV))(v);this->m_checkErrors("glTexCoord2hvNV");}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC m_orig_glGetFramebufferParameterfvAMD = nullptr;
+void m_glGetFramebufferParameterfvAMD_validation(GLenum target,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{(this->*(this->m_orig_glGetFramebufferParameterfvAMD))(target,pname,numsamples,pixelindex,size,values);this->m_checkErrors("glGetFramebufferParameterfvAMD");}
+FunctionTable::MEMBERPFNGLTEXENVIVPROC m_orig_glTexEnviv = nullptr;
+void m_glTexEnviv_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTexEnviv))(target,pname,params);this->m_checkErrors("glTexEnviv");}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC m_orig_glEndTransformFeedbackNV = nullptr;
+void m_glEndTransformFeedbackNV_validation()const{(this->*(this->m_orig_glEndTransformFeedbackNV))();this->m_checkErrors("glEndTransformFeedbackNV");}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC m_orig_glGlobalAlphaFactoruiSUN = nullptr;
+void m_glGlobalAlphaFactoruiSUN_validation(GLuint factor)const{(this->*(this->m_orig_glGlobalAlphaFactoruiSUN))(factor);this->m_checkErrors("glGlobalAlphaFactoruiSUN");}
+FunctionTable::MEMBERPFNGLSELECTBUFFERPROC m_orig_glSelectBuffer = nullptr;
+void m_glSelectBuffer_validation(GLsizei size,GLuint* buffer)const{(this->*(this->m_orig_glSelectBuffer))(size,buffer);this->m_checkErrors("glSelectBuffer");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC m_orig_glNamedBufferSubDataEXT = nullptr;
+void m_glNamedBufferSubDataEXT_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{(this->*(this->m_orig_glNamedBufferSubDataEXT))(buffer,offset,size,data);this->m_checkErrors("glNamedBufferSubDataEXT");}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC m_orig_glDisableVertexArrayAttrib = nullptr;
+void m_glDisableVertexArrayAttrib_validation(GLuint vaobj,GLuint index)const{(this->*(this->m_orig_glDisableVertexArrayAttrib))(vaobj,index);this->m_checkErrors("glDisableVertexArrayAttrib");}
+FunctionTable::MEMBERPFNGLBLENDFUNCPROC m_orig_glBlendFunc = nullptr;
+void m_glBlendFunc_validation(GLenum sfactor,GLenum dfactor)const{(this->*(this->m_orig_glBlendFunc))(sfactor,dfactor);this->m_checkErrors("glBlendFunc");}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC m_orig_glCreateProgram = nullptr;
+GLuint m_glCreateProgram_validation()const{GLuint const result = (this->*(this->m_orig_glCreateProgram))();this->m_checkErrors("glCreateProgram");return result;}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC m_orig_glVertexStream2dATI = nullptr;
+void m_glVertexStream2dATI_validation(GLenum stream,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertexStream2dATI))(stream,x,y);this->m_checkErrors("glVertexStream2dATI");}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC m_orig_glUniform4ui64vARB = nullptr;
+void m_glUniform4ui64vARB_validation(GLint location,GLsizei count,const GLuint64* value)const{(this->*(this->m_orig_glUniform4ui64vARB))(location,count,value);this->m_checkErrors("glUniform4ui64vARB");}
+FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC m_orig_glGetSemaphoreParameterui64vEXT = nullptr;
+void m_glGetSemaphoreParameterui64vEXT_validation(GLuint semaphore,GLenum pname,GLuint64* params)const{(this->*(this->m_orig_glGetSemaphoreParameterui64vEXT))(semaphore,pname,params);this->m_checkErrors("glGetSemaphoreParameterui64vEXT");}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC m_orig_glPrimitiveRestartIndex = nullptr;
+void m_glPrimitiveRestartIndex_validation(GLuint index)const{(this->*(this->m_orig_glPrimitiveRestartIndex))(index);this->m_checkErrors("glPrimitiveRestartIndex");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC m_orig_glNormalStream3fATI = nullptr;
+void m_glNormalStream3fATI_validation(GLenum stream,GLfloat nx,GLfloat ny,GLfloat nz)const{(this->*(this->m_orig_glNormalStream3fATI))(stream,nx,ny,nz);this->m_checkErrors("glNormalStream3fATI");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC m_orig_glProgramUniformMatrix2fv = nullptr;
+void m_glProgramUniformMatrix2fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix2fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix2fv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC m_orig_glVertexAttribs1hvNV = nullptr;
+void m_glVertexAttribs1hvNV_validation(GLuint index,GLsizei n,const GLhalfNV* v)const{(this->*(this->m_orig_glVertexAttribs1hvNV))(index,n,v);this->m_checkErrors("glVertexAttribs1hvNV");}
+FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC m_orig_glWindowPos4svMESA = nullptr;
+void m_glWindowPos4svMESA_validation(const GLshort* v)const{(this->*(this->m_orig_glWindowPos4svMESA))(v);this->m_checkErrors("glWindowPos4svMESA");}
+FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC m_orig_glDeleteFragmentShaderATI = nullptr;
+void m_glDeleteFragmentShaderATI_validation(GLuint id)const{(this->*(this->m_orig_glDeleteFragmentShaderATI))(id);this->m_checkErrors("glDeleteFragmentShaderATI");}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC m_orig_glBindImageTextures = nullptr;
+void m_glBindImageTextures_validation(GLuint first,GLsizei count,const GLuint* textures)const{(this->*(this->m_orig_glBindImageTextures))(first,count,textures);this->m_checkErrors("glBindImageTextures");}
+FunctionTable::MEMBERPFNGLMAP2XOESPROC m_orig_glMap2xOES = nullptr;
+void m_glMap2xOES_validation(GLenum target,GLfixed u1,GLfixed u2,GLint ustride,GLint uorder,GLfixed v1,GLfixed v2,GLint vstride,GLint vorder,GLfixed points)const{(this->*(this->m_orig_glMap2xOES))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);this->m_checkErrors("glMap2xOES");}
+FunctionTable::MEMBERPFNGLENDPROC m_orig_glEnd = nullptr;
+void m_glEnd_validation()const{(this->*(this->m_orig_glEnd))();this->m_checkErrors("glEnd");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC m_orig_glMultiTexCoord2dARB = nullptr;
+void m_glMultiTexCoord2dARB_validation(GLenum target,GLdouble s,GLdouble t)const{(this->*(this->m_orig_glMultiTexCoord2dARB))(target,s,t);this->m_checkErrors("glMultiTexCoord2dARB");}
+FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC m_orig_glUniform1i64NV = nullptr;
+void m_glUniform1i64NV_validation(GLint location,GLint64EXT x)const{(this->*(this->m_orig_glUniform1i64NV))(location,x);this->m_checkErrors("glUniform1i64NV");}
+FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC m_orig_glPathStringNV = nullptr;
+void m_glPathStringNV_validation(GLuint path,GLenum format,GLsizei length,const void* pathString)const{(this->*(this->m_orig_glPathStringNV))(path,format,length,pathString);this->m_checkErrors("glPathStringNV");}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC m_orig_glGetNamedFramebufferParameterivEXT = nullptr;
+void m_glGetNamedFramebufferParameterivEXT_validation(GLuint framebuffer,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetNamedFramebufferParameterivEXT))(framebuffer,pname,params);this->m_checkErrors("glGetNamedFramebufferParameterivEXT");}
+FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC m_orig_glGetProgramNamedParameterdvNV = nullptr;
+void m_glGetProgramNamedParameterdvNV_validation(GLuint id,GLsizei len,const GLubyte* name,GLdouble* params)const{(this->*(this->m_orig_glGetProgramNamedParameterdvNV))(id,len,name,params);this->m_checkErrors("glGetProgramNamedParameterdvNV");}
+FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC m_orig_glPathDashArrayNV = nullptr;
+void m_glPathDashArrayNV_validation(GLuint path,GLsizei dashCount,const GLfloat* dashArray)const{(this->*(this->m_orig_glPathDashArrayNV))(path,dashCount,dashArray);this->m_checkErrors("glPathDashArrayNV");}
+FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC m_orig_glUniform3uiv = nullptr;
+void m_glUniform3uiv_validation(GLint location,GLsizei count,const GLuint* value)const{(this->*(this->m_orig_glUniform3uiv))(location,count,value);this->m_checkErrors("glUniform3uiv");}
+FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC m_orig_glColor3fVertex3fvSUN = nullptr;
+void m_glColor3fVertex3fvSUN_validation(const GLfloat* c,const GLfloat* v)const{(this->*(this->m_orig_glColor3fVertex3fvSUN))(c,v);this->m_checkErrors("glColor3fVertex3fvSUN");}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC m_orig_glMultTransposeMatrixd = nullptr;
+void m_glMultTransposeMatrixd_validation(const GLdouble* m)const{(this->*(this->m_orig_glMultTransposeMatrixd))(m);this->m_checkErrors("glMultTransposeMatrixd");}
+FunctionTable::MEMBERPFNGLCLEARCOLORPROC m_orig_glClearColor = nullptr;
+void m_glClearColor_validation(GLclampf red,GLclampf green,GLclampf blue,GLclampf alpha)const{(this->*(this->m_orig_glClearColor))(red,green,blue,alpha);this->m_checkErrors("glClearColor");}
+FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC m_orig_glGetImageHandleARB = nullptr;
+GLuint64 m_glGetImageHandleARB_validation(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{GLuint64 const result = (this->*(this->m_orig_glGetImageHandleARB))(texture,level,layered,layer,format);this->m_checkErrors("glGetImageHandleARB");return result;}
+FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC m_orig_glTangent3dEXT = nullptr;
+void m_glTangent3dEXT_validation(GLdouble tx,GLdouble ty,GLdouble tz)const{(this->*(this->m_orig_glTangent3dEXT))(tx,ty,tz);this->m_checkErrors("glTangent3dEXT");}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC m_orig_glGetQueryObjectivARB = nullptr;
+void m_glGetQueryObjectivARB_validation(GLuint id,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetQueryObjectivARB))(id,pname,params);this->m_checkErrors("glGetQueryObjectivARB");}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC m_orig_glGetLocalConstantFloatvEXT = nullptr;
+void m_glGetLocalConstantFloatvEXT_validation(GLuint id,GLenum value,GLfloat* data)const{(this->*(this->m_orig_glGetLocalConstantFloatvEXT))(id,value,data);this->m_checkErrors("glGetLocalConstantFloatvEXT");}
+FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC m_orig_glUseShaderProgramEXT = nullptr;
+void m_glUseShaderProgramEXT_validation(GLenum type,GLuint program)const{(this->*(this->m_orig_glUseShaderProgramEXT))(type,program);this->m_checkErrors("glUseShaderProgramEXT");}
+FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC m_orig_glBindRenderbufferEXT = nullptr;
+void m_glBindRenderbufferEXT_validation(GLenum target,GLuint renderbuffer)const{(this->*(this->m_orig_glBindRenderbufferEXT))(target,renderbuffer);this->m_checkErrors("glBindRenderbufferEXT");}
+FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC m_orig_glInterleavedArrays = nullptr;
+void m_glInterleavedArrays_validation(GLenum format,GLsizei stride,const GLvoid* pointer)const{(this->*(this->m_orig_glInterleavedArrays))(format,stride,pointer);this->m_checkErrors("glInterleavedArrays");}
+FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC m_orig_glGetPerfMonitorGroupStringAMD = nullptr;
+void m_glGetPerfMonitorGroupStringAMD_validation(GLuint group,GLsizei bufSize,GLsizei* length,GLchar* groupString)const{(this->*(this->m_orig_glGetPerfMonitorGroupStringAMD))(group,bufSize,length,groupString);this->m_checkErrors("glGetPerfMonitorGroupStringAMD");}
+FunctionTable::MEMBERPFNGLUNIFORM3UIPROC m_orig_glUniform3ui = nullptr;
+void m_glUniform3ui_validation(GLint location,GLuint v0,GLuint v1,GLuint v2)const{(this->*(this->m_orig_glUniform3ui))(location,v0,v1,v2);this->m_checkErrors("glUniform3ui");}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC m_orig_glGetNamedProgramLocalParameterdvEXT = nullptr;
+void m_glGetNamedProgramLocalParameterdvEXT_validation(GLuint program,GLenum target,GLuint index,GLdouble* params)const{(this->*(this->m_orig_glGetNamedProgramLocalParameterdvEXT))(program,target,index,params);this->m_checkErrors("glGetNamedProgramLocalParameterdvEXT");}
+FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC m_orig_glDeleteQueryResourceTagNV = nullptr;
+void m_glDeleteQueryResourceTagNV_validation(GLsizei n,const GLint* tagIds)const{(this->*(this->m_orig_glDeleteQueryResourceTagNV))(n,tagIds);this->m_checkErrors("glDeleteQueryResourceTagNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC m_orig_glVertexAttribI4uiv = nullptr;
+void m_glVertexAttribI4uiv_validation(GLuint index,const GLuint* v)const{(this->*(this->m_orig_glVertexAttribI4uiv))(index,v);this->m_checkErrors("glVertexAttribI4uiv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC m_orig_glVertexAttrib4bv = nullptr;
+void m_glVertexAttrib4bv_validation(GLuint index,const GLbyte* v)const{(this->*(this->m_orig_glVertexAttrib4bv))(index,v);this->m_checkErrors("glVertexAttrib4bv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC m_orig_glMultiTexCoord3xOES = nullptr;
+void m_glMultiTexCoord3xOES_validation(GLenum texture,GLfixed s,GLfixed t,GLfixed r)const{(this->*(this->m_orig_glMultiTexCoord3xOES))(texture,s,t,r);this->m_checkErrors("glMultiTexCoord3xOES");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC m_orig_glSecondaryColor3ub = nullptr;
+void m_glSecondaryColor3ub_validation(GLubyte red,GLubyte green,GLubyte blue)const{(this->*(this->m_orig_glSecondaryColor3ub))(red,green,blue);this->m_checkErrors("glSecondaryColor3ub");}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC m_orig_glFragmentMaterialfSGIX = nullptr;
+void m_glFragmentMaterialfSGIX_validation(GLenum face,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glFragmentMaterialfSGIX))(face,pname,param);this->m_checkErrors("glFragmentMaterialfSGIX");}
+FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC m_orig_glGetVariantArrayObjectivATI = nullptr;
+void m_glGetVariantArrayObjectivATI_validation(GLuint id,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetVariantArrayObjectivATI))(id,pname,params);this->m_checkErrors("glGetVariantArrayObjectivATI");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC m_orig_glSecondaryColor3ui = nullptr;
+void m_glSecondaryColor3ui_validation(GLuint red,GLuint green,GLuint blue)const{(this->*(this->m_orig_glSecondaryColor3ui))(red,green,blue);this->m_checkErrors("glSecondaryColor3ui");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC m_orig_glVertexAttrib1dARB = nullptr;
+void m_glVertexAttrib1dARB_validation(GLuint index,GLdouble x)const{(this->*(this->m_orig_glVertexAttrib1dARB))(index,x);this->m_checkErrors("glVertexAttrib1dARB");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC m_orig_glGetNamedBufferPointerv = nullptr;
+void m_glGetNamedBufferPointerv_validation(GLuint buffer,GLenum pname,void** params)const{(this->*(this->m_orig_glGetNamedBufferPointerv))(buffer,pname,params);this->m_checkErrors("glGetNamedBufferPointerv");}
+FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC m_orig_glLockArraysEXT = nullptr;
+void m_glLockArraysEXT_validation(GLint first,GLsizei count)const{(this->*(this->m_orig_glLockArraysEXT))(first,count);this->m_checkErrors("glLockArraysEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC m_orig_glVertexAttribPointerNV = nullptr;
+void m_glVertexAttribPointerNV_validation(GLuint index,GLint fsize,GLenum type,GLsizei stride,const void* pointer)const{(this->*(this->m_orig_glVertexAttribPointerNV))(index,fsize,type,stride,pointer);this->m_checkErrors("glVertexAttribPointerNV");}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC m_orig_glConvolutionParameterf = nullptr;
+void m_glConvolutionParameterf_validation(GLenum target,GLenum pname,GLfloat params)const{(this->*(this->m_orig_glConvolutionParameterf))(target,pname,params);this->m_checkErrors("glConvolutionParameterf");}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC m_orig_glBindBufferBaseEXT = nullptr;
+void m_glBindBufferBaseEXT_validation(GLenum target,GLuint index,GLuint buffer)const{(this->*(this->m_orig_glBindBufferBaseEXT))(target,index,buffer);this->m_checkErrors("glBindBufferBaseEXT");}
+FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC m_orig_glTexCoord2xvOES = nullptr;
+void m_glTexCoord2xvOES_validation(const GLfixed* coords)const{(this->*(this->m_orig_glTexCoord2xvOES))(coords);this->m_checkErrors("glTexCoord2xvOES");}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC m_orig_glGetQueryBufferObjectui64v = nullptr;
+void m_glGetQueryBufferObjectui64v_validation(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{(this->*(this->m_orig_glGetQueryBufferObjectui64v))(id,buffer,pname,offset);this->m_checkErrors("glGetQueryBufferObjectui64v");}
+FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC m_orig_glSetMultisamplefvAMD = nullptr;
+void m_glSetMultisamplefvAMD_validation(GLenum pname,GLuint index,const GLfloat* val)const{(this->*(this->m_orig_glSetMultisamplefvAMD))(pname,index,val);this->m_checkErrors("glSetMultisamplefvAMD");}
+FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC m_orig_glPathColorGenNV = nullptr;
+void m_glPathColorGenNV_validation(GLenum color,GLenum genMode,GLenum colorFormat,const GLfloat* coeffs)const{(this->*(this->m_orig_glPathColorGenNV))(color,genMode,colorFormat,coeffs);this->m_checkErrors("glPathColorGenNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC m_orig_glVertexAttrib3sARB = nullptr;
+void m_glVertexAttrib3sARB_validation(GLuint index,GLshort x,GLshort y,GLshort z)const{(this->*(this->m_orig_glVertexAttrib3sARB))(index,x,y,z);this->m_checkErrors("glVertexAttrib3sARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC m_orig_glVertexAttrib4ivARB = nullptr;
+void m_glVertexAttrib4ivARB_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttrib4ivARB))(index,v);this->m_checkErrors("glVertexAttrib4ivARB");}
+FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC m_orig_glGenTransformFeedbacks = nullptr;
+void m_glGenTransformFeedbacks_validation(GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glGenTransformFeedbacks))(n,ids);this->m_checkErrors("glGenTransformFeedbacks");}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC m_orig_glGetVertexAttribIuiv = nullptr;
+void m_glGetVertexAttribIuiv_validation(GLuint index,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetVertexAttribIuiv))(index,pname,params);this->m_checkErrors("glGetVertexAttribIuiv");}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC m_orig_glPixelTransformParameterfEXT = nullptr;
+void m_glPixelTransformParameterfEXT_validation(GLenum target,GLenum pname,GLfloat param)const{(this->*(this->m_orig_glPixelTransformParameterfEXT))(target,pname,param);this->m_checkErrors("glPixelTransformParameterfEXT");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC m_orig_glGetTexParameterIuivEXT = nullptr;
+void m_glGetTexParameterIuivEXT_validation(GLenum target,GLenum pname,GLuint* params)const{(this->*(this->m_orig_glGetTexParameterIuivEXT))(target,pname,params);this->m_checkErrors("glGetTexParameterIuivEXT");}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC m_orig_glGetObjectParameterivARB = nullptr;
+void m_glGetObjectParameterivARB_validation(GLhandleARB obj,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetObjectParameterivARB))(obj,pname,params);this->m_checkErrors("glGetObjectParameterivARB");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC m_orig_glVertexArraySecondaryColorOffsetEXT = nullptr;
+void m_glVertexArraySecondaryColorOffsetEXT_validation(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{(this->*(this->m_orig_glVertexArraySecondaryColorOffsetEXT))(vaobj,buffer,size,type,stride,offset);this->m_checkErrors("glVertexArraySecondaryColorOffsetEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC m_orig_glWindowPos2fARB = nullptr;
+void m_glWindowPos2fARB_validation(GLfloat x,GLfloat y)const{(this->*(this->m_orig_glWindowPos2fARB))(x,y);this->m_checkErrors("glWindowPos2fARB");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC m_orig_glCompressedTexSubImage2D = nullptr;
+void m_glCompressedTexSubImage2D_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const GLvoid* data)const{(this->*(this->m_orig_glCompressedTexSubImage2D))(target,level,xoffset,yoffset,width,height,format,imageSize,data);this->m_checkErrors("glCompressedTexSubImage2D");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC m_orig_glCompressedTexSubImage3DARB = nullptr;
+void m_glCompressedTexSubImage3DARB_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{(this->*(this->m_orig_glCompressedTexSubImage3DARB))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);this->m_checkErrors("glCompressedTexSubImage3DARB");}
+FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC m_orig_glProgramBinary = nullptr;
+void m_glProgramBinary_validation(GLuint program,GLenum binaryFormat,const void* binary,GLsizei length)const{(this->*(this->m_orig_glProgramBinary))(program,binaryFormat,binary,length);this->m_checkErrors("glProgramBinary");}
+FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC m_orig_glPresentFrameKeyedNV = nullptr;
+void m_glPresentFrameKeyedNV_validation(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLuint key0,GLenum target1,GLuint fill1,GLuint key1)const{(this->*(this->m_orig_glPresentFrameKeyedNV))(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);this->m_checkErrors("glPresentFrameKeyedNV");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC m_orig_glVertexAttribI4bv = nullptr;
+void m_glVertexAttribI4bv_validation(GLuint index,const GLbyte* v)const{(this->*(this->m_orig_glVertexAttribI4bv))(index,v);this->m_checkErrors("glVertexAttribI4bv");}
+FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC m_orig_glPathCoverDepthFuncNV = nullptr;
+void m_glPathCoverDepthFuncNV_validation(GLenum func)const{(this->*(this->m_orig_glPathCoverDepthFuncNV))(func);this->m_checkErrors("glPathCoverDepthFuncNV");}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC m_orig_glTransformFeedbackStreamAttribsNV = nullptr;
+void m_glTransformFeedbackStreamAttribsNV_validation(GLsizei count,const GLint* attribs,GLsizei nbuffers,const GLint* bufstreams,GLenum bufferMode)const{(this->*(this->m_orig_glTransformFeedbackStreamAttribsNV))(count,attribs,nbuffers,bufstreams,bufferMode);this->m_checkErrors("glTransformFeedbackStreamAttribsNV");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC m_orig_glSecondaryColor3usEXT = nullptr;
+void m_glSecondaryColor3usEXT_validation(GLushort red,GLushort green,GLushort blue)const{(this->*(this->m_orig_glSecondaryColor3usEXT))(red,green,blue);this->m_checkErrors("glSecondaryColor3usEXT");}
+FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC m_orig_glCopyColorTableSGI = nullptr;
+void m_glCopyColorTableSGI_validation(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyColorTableSGI))(target,internalformat,x,y,width);this->m_checkErrors("glCopyColorTableSGI");}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC m_orig_glProgramEnvParameter4fvARB = nullptr;
+void m_glProgramEnvParameter4fvARB_validation(GLenum target,GLuint index,const GLfloat* params)const{(this->*(this->m_orig_glProgramEnvParameter4fvARB))(target,index,params);this->m_checkErrors("glProgramEnvParameter4fvARB");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC m_orig_glMultiTexCoord4sARB = nullptr;
+void m_glMultiTexCoord4sARB_validation(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{(this->*(this->m_orig_glMultiTexCoord4sARB))(target,s,t,r,q);this->m_checkErrors("glMultiTexCoord4sARB");}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC m_orig_glGetVertexArrayIndexed64iv = nullptr;
+void m_glGetVertexArrayIndexed64iv_validation(GLuint vaobj,GLuint index,GLenum pname,GLint64* param)const{(this->*(this->m_orig_glGetVertexArrayIndexed64iv))(vaobj,index,pname,param);this->m_checkErrors("glGetVertexArrayIndexed64iv");}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC m_orig_glMatrixMultTranspose3x3fNV = nullptr;
+void m_glMatrixMultTranspose3x3fNV_validation(GLenum matrixMode,const GLfloat* m)const{(this->*(this->m_orig_glMatrixMultTranspose3x3fNV))(matrixMode,m);this->m_checkErrors("glMatrixMultTranspose3x3fNV");}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC m_orig_glTexParameterIiv = nullptr;
+void m_glTexParameterIiv_validation(GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTexParameterIiv))(target,pname,params);this->m_checkErrors("glTexParameterIiv");}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC m_orig_glVertexArrayAttribFormat = nullptr;
+void m_glVertexArrayAttribFormat_validation(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{(this->*(this->m_orig_glVertexArrayAttribFormat))(vaobj,attribindex,size,type,normalized,relativeoffset);this->m_checkErrors("glVertexArrayAttribFormat");}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC m_orig_glEndTransformFeedback = nullptr;
+void m_glEndTransformFeedback_validation()const{(this->*(this->m_orig_glEndTransformFeedback))();this->m_checkErrors("glEndTransformFeedback");}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC m_orig_glDrawCommandsStatesAddressNV = nullptr;
+void m_glDrawCommandsStatesAddressNV_validation(const GLuint64* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{(this->*(this->m_orig_glDrawCommandsStatesAddressNV))(indirects,sizes,states,fbos,count);this->m_checkErrors("glDrawCommandsStatesAddressNV");}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC m_orig_glUniform4ui64NV = nullptr;
+void m_glUniform4ui64NV_validation(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{(this->*(this->m_orig_glUniform4ui64NV))(location,x,y,z,w);this->m_checkErrors("glUniform4ui64NV");}
+FunctionTable::MEMBERPFNGLMATERIALIVPROC m_orig_glMaterialiv = nullptr;
+void m_glMaterialiv_validation(GLenum face,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glMaterialiv))(face,pname,params);this->m_checkErrors("glMaterialiv");}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC m_orig_glTexImage2DMultisample = nullptr;
+void m_glTexImage2DMultisample_validation(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTexImage2DMultisample))(target,samples,internalformat,width,height,fixedsamplelocations);this->m_checkErrors("glTexImage2DMultisample");}
+FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC m_orig_glBindTextureEXT = nullptr;
+void m_glBindTextureEXT_validation(GLenum target,GLuint texture)const{(this->*(this->m_orig_glBindTextureEXT))(target,texture);this->m_checkErrors("glBindTextureEXT");}
+FunctionTable::MEMBERPFNGLISBUFFERPROC m_orig_glIsBuffer = nullptr;
+GLboolean m_glIsBuffer_validation(GLuint buffer)const{GLboolean const result = (this->*(this->m_orig_glIsBuffer))(buffer);this->m_checkErrors("glIsBuffer");return result;}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC m_orig_glVertexAttribI1iv = nullptr;
+void m_glVertexAttribI1iv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI1iv))(index,v);this->m_checkErrors("glVertexAttribI1iv");}
+FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC m_orig_glGetFinalCombinerInputParameterfvNV = nullptr;
+void m_glGetFinalCombinerInputParameterfvNV_validation(GLenum variable,GLenum pname,GLfloat* params)const{(this->*(this->m_orig_glGetFinalCombinerInputParameterfvNV))(variable,pname,params);this->m_checkErrors("glGetFinalCombinerInputParameterfvNV");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC m_orig_glMultiTexCoord3bvOES = nullptr;
+void m_glMultiTexCoord3bvOES_validation(GLenum texture,const GLbyte* coords)const{(this->*(this->m_orig_glMultiTexCoord3bvOES))(texture,coords);this->m_checkErrors("glMultiTexCoord3bvOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC m_orig_glVertexAttribDivisor = nullptr;
+void m_glVertexAttribDivisor_validation(GLuint index,GLuint divisor)const{(this->*(this->m_orig_glVertexAttribDivisor))(index,divisor);this->m_checkErrors("glVertexAttribDivisor");}
+FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC m_orig_glCopyBufferSubData = nullptr;
+void m_glCopyBufferSubData_validation(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{(this->*(this->m_orig_glCopyBufferSubData))(readTarget,writeTarget,readOffset,writeOffset,size);this->m_checkErrors("glCopyBufferSubData");}
+FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC m_orig_glBindTexGenParameterEXT = nullptr;
+GLuint m_glBindTexGenParameterEXT_validation(GLenum unit,GLenum coord,GLenum value)const{GLuint const result = (this->*(this->m_orig_glBindTexGenParameterEXT))(unit,coord,value);this->m_checkErrors("glBindTexGenParameterEXT");return result;}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC m_orig_glNormalStream3bATI = nullptr;
+void m_glNormalStream3bATI_validation(GLenum stream,GLbyte nx,GLbyte ny,GLbyte nz)const{(this->*(this->m_orig_glNormalStream3bATI))(stream,nx,ny,nz);this->m_checkErrors("glNormalStream3bATI");}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC m_orig_glTexStorageMem2DEXT = nullptr;
+void m_glTexStorageMem2DEXT_validation(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{(this->*(this->m_orig_glTexStorageMem2DEXT))(target,levels,internalFormat,width,height,memory,offset);this->m_checkErrors("glTexStorageMem2DEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC m_orig_glTextureImage2DEXT = nullptr;
+void m_glTextureImage2DEXT_validation(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureImage2DEXT))(texture,target,level,internalformat,width,height,border,format,type,pixels);this->m_checkErrors("glTextureImage2DEXT");}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC m_orig_glGetColorTableParameteriv = nullptr;
+void m_glGetColorTableParameteriv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetColorTableParameteriv))(target,pname,params);this->m_checkErrors("glGetColorTableParameteriv");}
+FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC m_orig_glActiveTextureARB = nullptr;
+void m_glActiveTextureARB_validation(GLenum texture)const{(this->*(this->m_orig_glActiveTextureARB))(texture);this->m_checkErrors("glActiveTextureARB");}
+FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC m_orig_glTexCoord4xOES = nullptr;
+void m_glTexCoord4xOES_validation(GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{(this->*(this->m_orig_glTexCoord4xOES))(s,t,r,q);this->m_checkErrors("glTexCoord4xOES");}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC m_orig_glNamedBufferStorageExternalEXT = nullptr;
+void m_glNamedBufferStorageExternalEXT_validation(GLuint buffer,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{(this->*(this->m_orig_glNamedBufferStorageExternalEXT))(buffer,offset,size,clientBuffer,flags);this->m_checkErrors("glNamedBufferStorageExternalEXT");}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC m_orig_glSecondaryColor3fvEXT = nullptr;
+void m_glSecondaryColor3fvEXT_validation(const GLfloat* v)const{(this->*(this->m_orig_glSecondaryColor3fvEXT))(v);this->m_checkErrors("glSecondaryColor3fvEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC m_orig_glUniformMatrix4x2fv = nullptr;
+void m_glUniformMatrix4x2fv_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix4x2fv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix4x2fv");}
+FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC m_orig_glStartInstrumentsSGIX = nullptr;
+void m_glStartInstrumentsSGIX_validation()const{(this->*(this->m_orig_glStartInstrumentsSGIX))();this->m_checkErrors("glStartInstrumentsSGIX");}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC m_orig_glProgramNamedParameter4fvNV = nullptr;
+void m_glProgramNamedParameter4fvNV_validation(GLuint id,GLsizei len,const GLubyte* name,const GLfloat* v)const{(this->*(this->m_orig_glProgramNamedParameter4fvNV))(id,len,name,v);this->m_checkErrors("glProgramNamedParameter4fvNV");}
+FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC m_orig_glEndVideoCaptureNV = nullptr;
+void m_glEndVideoCaptureNV_validation(GLuint video_capture_slot)const{(this->*(this->m_orig_glEndVideoCaptureNV))(video_capture_slot);this->m_checkErrors("glEndVideoCaptureNV");}
+FunctionTable::MEMBERPFNGLGENLISTSPROC m_orig_glGenLists = nullptr;
+GLuint m_glGenLists_validation(GLsizei range)const{GLuint const result = (this->*(this->m_orig_glGenLists))(range);this->m_checkErrors("glGenLists");return result;}
+FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC m_orig_glUniform1fARB = nullptr;
+void m_glUniform1fARB_validation(GLint location,GLfloat v0)const{(this->*(this->m_orig_glUniform1fARB))(location,v0);this->m_checkErrors("glUniform1fARB");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC m_orig_glNamedFramebufferTexture1DEXT = nullptr;
+void m_glNamedFramebufferTexture1DEXT_validation(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{(this->*(this->m_orig_glNamedFramebufferTexture1DEXT))(framebuffer,attachment,textarget,texture,level);this->m_checkErrors("glNamedFramebufferTexture1DEXT");}
+FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC m_orig_glMapBufferRange = nullptr;
+void* m_glMapBufferRange_validation(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access)const{void* const result = (this->*(this->m_orig_glMapBufferRange))(target,offset,length,access);this->m_checkErrors("glMapBufferRange");return result;}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC m_orig_glMultiDrawElementsIndirectCountARB = nullptr;
+void m_glMultiDrawElementsIndirectCountARB_validation(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{(this->*(this->m_orig_glMultiDrawElementsIndirectCountARB))(mode,type,indirect,drawcount,maxdrawcount,stride);this->m_checkErrors("glMultiDrawElementsIndirectCountARB");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC m_orig_glProgramUniformMatrix4x2fv = nullptr;
+void m_glProgramUniformMatrix4x2fv_validation(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glProgramUniformMatrix4x2fv))(program,location,count,transpose,value);this->m_checkErrors("glProgramUniformMatrix4x2fv");}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC m_orig_glGetTextureParameterIivEXT = nullptr;
+void m_glGetTextureParameterIivEXT_validation(GLuint texture,GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTextureParameterIivEXT))(texture,target,pname,params);this->m_checkErrors("glGetTextureParameterIivEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC m_orig_glMultiTexCoord3hNV = nullptr;
+void m_glMultiTexCoord3hNV_validation(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r)const{(this->*(this->m_orig_glMultiTexCoord3hNV))(target,s,t,r);this->m_checkErrors("glMultiTexCoord3hNV");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC m_orig_glNamedProgramLocalParametersI4uivEXT = nullptr;
+void m_glNamedProgramLocalParametersI4uivEXT_validation(GLuint program,GLenum target,GLuint index,GLsizei count,const GLuint* params)const{(this->*(this->m_orig_glNamedProgramLocalParametersI4uivEXT))(program,target,index,count,params);this->m_checkErrors("glNamedProgramLocalParametersI4uivEXT");}
+FunctionTable::MEMBERPFNGLENDLISTPROC m_orig_glEndList = nullptr;
+void m_glEndList_validation()const{(this->*(this->m_orig_glEndList))();this->m_checkErrors("glEndList");}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN = nullptr;
+void m_glTexCoord2fColor4fNormal3fVertex3fSUN_validation(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{(this->*(this->m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN))(s,t,r,g,b,a,nx,ny,nz,x,y,z);this->m_checkErrors("glTexCoord2fColor4fNormal3fVertex3fSUN");}
+FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC m_orig_glGenTransformFeedbacksNV = nullptr;
+void m_glGenTransformFeedbacksNV_validation(GLsizei n,GLuint* ids)const{(this->*(this->m_orig_glGenTransformFeedbacksNV))(n,ids);this->m_checkErrors("glGenTransformFeedbacksNV");}
+FunctionTable::MEMBERPFNGLEDGEFLAGVPROC m_orig_glEdgeFlagv = nullptr;
+void m_glEdgeFlagv_validation(const GLboolean* flag)const{(this->*(this->m_orig_glEdgeFlagv))(flag);this->m_checkErrors("glEdgeFlagv");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC m_orig_glVertexAttribI2iv = nullptr;
+void m_glVertexAttribI2iv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glVertexAttribI2iv))(index,v);this->m_checkErrors("glVertexAttribI2iv");}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC m_orig_glCopyMultiTexImage2DEXT = nullptr;
+void m_glCopyMultiTexImage2DEXT_validation(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{(this->*(this->m_orig_glCopyMultiTexImage2DEXT))(texunit,target,level,internalformat,x,y,width,height,border);this->m_checkErrors("glCopyMultiTexImage2DEXT");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC m_orig_glUniformMatrix3x2dv = nullptr;
+void m_glUniformMatrix3x2dv_validation(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{(this->*(this->m_orig_glUniformMatrix3x2dv))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3x2dv");}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC m_orig_glTexImage3DMultisampleCoverageNV = nullptr;
+void m_glTexImage3DMultisampleCoverageNV_validation(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{(this->*(this->m_orig_glTexImage3DMultisampleCoverageNV))(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);this->m_checkErrors("glTexImage3DMultisampleCoverageNV");}
+FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC m_orig_glGetShaderPrecisionFormat = nullptr;
+void m_glGetShaderPrecisionFormat_validation(GLenum shadertype,GLenum precisiontype,GLint* range,GLint* precision)const{(this->*(this->m_orig_glGetShaderPrecisionFormat))(shadertype,precisiontype,range,precision);this->m_checkErrors("glGetShaderPrecisionFormat");}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC m_orig_glTexSubImage4DSGIS = nullptr;
+void m_glTexSubImage4DSGIS_validation(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint woffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTexSubImage4DSGIS))(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);this->m_checkErrors("glTexSubImage4DSGIS");}
+FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC m_orig_glRasterSamplesEXT = nullptr;
+void m_glRasterSamplesEXT_validation(GLuint samples,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glRasterSamplesEXT))(samples,fixedsamplelocations);this->m_checkErrors("glRasterSamplesEXT");}
+FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC m_orig_glTextureView = nullptr;
+void m_glTextureView_validation(GLuint texture,GLenum target,GLuint origtexture,GLenum internalformat,GLuint minlevel,GLuint numlevels,GLuint minlayer,GLuint numlayers)const{(this->*(this->m_orig_glTextureView))(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);this->m_checkErrors("glTextureView");}
+FunctionTable::MEMBERPFNGLEVALMAPSNVPROC m_orig_glEvalMapsNV = nullptr;
+void m_glEvalMapsNV_validation(GLenum target,GLenum mode)const{(this->*(this->m_orig_glEvalMapsNV))(target,mode);this->m_checkErrors("glEvalMapsNV");}
+FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC m_orig_glGetFragDataLocationEXT = nullptr;
+GLint m_glGetFragDataLocationEXT_validation(GLuint program,const GLchar* name)const{GLint const result = (this->*(this->m_orig_glGetFragDataLocationEXT))(program,name);this->m_checkErrors("glGetFragDataLocationEXT");return result;}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC m_orig_glGetCompressedMultiTexImageEXT = nullptr;
+void m_glGetCompressedMultiTexImageEXT_validation(GLenum texunit,GLenum target,GLint lod,void* img)const{(this->*(this->m_orig_glGetCompressedMultiTexImageEXT))(texunit,target,lod,img);this->m_checkErrors("glGetCompressedMultiTexImageEXT");}
+FunctionTable::MEMBERPFNGLINDEXMASKPROC m_orig_glIndexMask = nullptr;
+void m_glIndexMask_validation(GLuint mask)const{(this->*(this->m_orig_glIndexMask))(mask);this->m_checkErrors("glIndexMask");}
+FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC m_orig_glPushClientAttrib = nullptr;
+void m_glPushClientAttrib_validation(GLbitfield mask)const{(this->*(this->m_orig_glPushClientAttrib))(mask);this->m_checkErrors("glPushClientAttrib");}
+FunctionTable::MEMBERPFNGLSHADERSOURCEPROC m_orig_glShaderSource = nullptr;
+void m_glShaderSource_validation(GLuint shader,GLsizei count,const GLchar*const* string,const GLint* length)const{(this->*(this->m_orig_glShaderSource))(shader,count,string,length);this->m_checkErrors("glShaderSource");}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC m_orig_glDispatchComputeGroupSizeARB = nullptr;
+void m_glDispatchComputeGroupSizeARB_validation(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z,GLuint group_size_x,GLuint group_size_y,GLuint group_size_z)const{(this->*(this->m_orig_glDispatchComputeGroupSizeARB))(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);this->m_checkErrors("glDispatchComputeGroupSizeARB");}
+FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC m_orig_glLGPUNamedBufferSubDataNVX = nullptr;
+void m_glLGPUNamedBufferSubDataNVX_validation(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{(this->*(this->m_orig_glLGPUNamedBufferSubDataNVX))(gpuMask,buffer,offset,size,data);this->m_checkErrors("glLGPUNamedBufferSubDataNVX");}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC m_orig_glGetnPixelMapfv = nullptr;
+void m_glGetnPixelMapfv_validation(GLenum map,GLsizei bufSize,GLfloat* values)const{(this->*(this->m_orig_glGetnPixelMapfv))(map,bufSize,values);this->m_checkErrors("glGetnPixelMapfv");}
+FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC m_orig_glTexCoordP2uiv = nullptr;
+void m_glTexCoordP2uiv_validation(GLenum type,const GLuint* coords)const{(this->*(this->m_orig_glTexCoordP2uiv))(type,coords);this->m_checkErrors("glTexCoordP2uiv");}
+FunctionTable::MEMBERPFNGLUNIFORM2FPROC m_orig_glUniform2f = nullptr;
+void m_glUniform2f_validation(GLint location,GLfloat v0,GLfloat v1)const{(this->*(this->m_orig_glUniform2f))(location,v0,v1);this->m_checkErrors("glUniform2f");}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC m_orig_glGetNamedBufferParameteri64v = nullptr;
+void m_glGetNamedBufferParameteri64v_validation(GLuint buffer,GLenum pname,GLint64* params)const{(this->*(this->m_orig_glGetNamedBufferParameteri64v))(buffer,pname,params);this->m_checkErrors("glGetNamedBufferParameteri64v");}
+FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC m_orig_glCommandListSegmentsNV = nullptr;
+void m_glCommandListSegmentsNV_validation(GLuint list,GLuint segments)const{(this->*(this->m_orig_glCommandListSegmentsNV))(list,segments);this->m_checkErrors("glCommandListSegmentsNV");}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC m_orig_glTextureParameterIivEXT = nullptr;
+void m_glTextureParameterIivEXT_validation(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{(this->*(this->m_orig_glTextureParameterIivEXT))(texture,target,pname,params);this->m_checkErrors("glTextureParameterIivEXT");}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC m_orig_glMultiTexParameterfvEXT = nullptr;
+void m_glMultiTexParameterfvEXT_validation(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glMultiTexParameterfvEXT))(texunit,target,pname,params);this->m_checkErrors("glMultiTexParameterfvEXT");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC m_orig_glProgramUniform2ui64ARB = nullptr;
+void m_glProgramUniform2ui64ARB_validation(GLuint program,GLint location,GLuint64 x,GLuint64 y)const{(this->*(this->m_orig_glProgramUniform2ui64ARB))(program,location,x,y);this->m_checkErrors("glProgramUniform2ui64ARB");}
+FunctionTable::MEMBERPFNGLVERTEX4DPROC m_orig_glVertex4d = nullptr;
+void m_glVertex4d_validation(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{(this->*(this->m_orig_glVertex4d))(x,y,z,w);this->m_checkErrors("glVertex4d");}
+FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC m_orig_glNewObjectBufferATI = nullptr;
+GLuint m_glNewObjectBufferATI_validation(GLsizei size,const void* pointer,GLenum usage)const{GLuint const result = (this->*(this->m_orig_glNewObjectBufferATI))(size,pointer,usage);this->m_checkErrors("glNewObjectBufferATI");return result;}
+FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC m_orig_glViewportSwizzleNV = nullptr;
+void m_glViewportSwizzleNV_validation(GLuint index,GLenum swizzlex,GLenum swizzley,GLenum swizzlez,GLenum swizzlew)const{(this->*(this->m_orig_glViewportSwizzleNV))(index,swizzlex,swizzley,swizzlez,swizzlew);this->m_checkErrors("glViewportSwizzleNV");}
+FunctionTable::MEMBERPFNGLBUFFERDATAPROC m_orig_glBufferData = nullptr;
+void m_glBufferData_validation(GLenum target,GLsizeiptr size,const void* data,GLenum usage)const{(this->*(this->m_orig_glBufferData))(target,size,data,usage);this->m_checkErrors("glBufferData");}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC m_orig_glTextureImage1DEXT = nullptr;
+void m_glTextureImage1DEXT_validation(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{(this->*(this->m_orig_glTextureImage1DEXT))(texture,target,level,internalformat,width,border,format,type,pixels);this->m_checkErrors("glTextureImage1DEXT");}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC m_orig_glGetTexParameterIiv = nullptr;
+void m_glGetTexParameterIiv_validation(GLenum target,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetTexParameterIiv))(target,pname,params);this->m_checkErrors("glGetTexParameterIiv");}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC m_orig_glCopyTexSubImage1DEXT = nullptr;
+void m_glCopyTexSubImage1DEXT_validation(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{(this->*(this->m_orig_glCopyTexSubImage1DEXT))(target,level,xoffset,x,y,width);this->m_checkErrors("glCopyTexSubImage1DEXT");}
+FunctionTable::MEMBERPFNGLVERTEX4FPROC m_orig_glVertex4f = nullptr;
+void m_glVertex4f_validation(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{(this->*(this->m_orig_glVertex4f))(x,y,z,w);this->m_checkErrors("glVertex4f");}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC m_orig_glUniformMatrix3fvARB = nullptr;
+void m_glUniformMatrix3fvARB_validation(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{(this->*(this->m_orig_glUniformMatrix3fvARB))(location,count,transpose,value);this->m_checkErrors("glUniformMatrix3fvARB");}
+FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC m_orig_glTexCoordP1ui = nullptr;
+void m_glTexCoordP1ui_validation(GLenum type,GLuint coords)const{(this->*(this->m_orig_glTexCoordP1ui))(type,coords);this->m_checkErrors("glTexCoordP1ui");}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC m_orig_glPointParameterfvEXT = nullptr;
+void m_glPointParameterfvEXT_validation(GLenum pname,const GLfloat* params)const{(this->*(this->m_orig_glPointParameterfvEXT))(pname,params);this->m_checkErrors("glPointParameterfvEXT");}
+FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC m_orig_glUniform4fARB = nullptr;
+void m_glUniform4fARB_validation(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{(this->*(this->m_orig_glUniform4fARB))(location,v0,v1,v2,v3);this->m_checkErrors("glUniform4fARB");}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC m_orig_glImportMemoryFdEXT = nullptr;
+void m_glImportMemoryFdEXT_validation(GLuint memory,GLuint64 size,GLenum handleType,GLint fd)const{(this->*(this->m_orig_glImportMemoryFdEXT))(memory,size,handleType,fd);this->m_checkErrors("glImportMemoryFdEXT");}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC m_orig_glCopyTextureSubImage3D = nullptr;
+void m_glCopyTextureSubImage3D_validation(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyTextureSubImage3D))(texture,level,xoffset,yoffset,zoffset,x,y,width,height);this->m_checkErrors("glCopyTextureSubImage3D");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC m_orig_glMultiTexCoord2fv = nullptr;
+void m_glMultiTexCoord2fv_validation(GLenum target,const GLfloat* v)const{(this->*(this->m_orig_glMultiTexCoord2fv))(target,v);this->m_checkErrors("glMultiTexCoord2fv");}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC m_orig_glNamedFramebufferSamplePositionsfvAMD = nullptr;
+void m_glNamedFramebufferSamplePositionsfvAMD_validation(GLuint framebuffer,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{(this->*(this->m_orig_glNamedFramebufferSamplePositionsfvAMD))(framebuffer,numsamples,pixelindex,values);this->m_checkErrors("glNamedFramebufferSamplePositionsfvAMD");}
+FunctionTable::MEMBERPFNGLNORMALP3UIPROC m_orig_glNormalP3ui = nullptr;
+void m_glNormalP3ui_validation(GLenum type,GLuint coords)const{(this->*(this->m_orig_glNormalP3ui))(type,coords);this->m_checkErrors("glNormalP3ui");}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC m_orig_glDrawRangeElementArrayATI = nullptr;
+void m_glDrawRangeElementArrayATI_validation(GLenum mode,GLuint start,GLuint end,GLsizei count)const{(this->*(this->m_orig_glDrawRangeElementArrayATI))(mode,start,end,count);this->m_checkErrors("glDrawRangeElementArrayATI");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC m_orig_glVertexAttribI1i = nullptr;
+void m_glVertexAttribI1i_validation(GLuint index,GLint x)const{(this->*(this->m_orig_glVertexAttribI1i))(index,x);this->m_checkErrors("glVertexAttribI1i");}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC m_orig_glDrawArraysInstancedARB = nullptr;
+void m_glDrawArraysInstancedARB_validation(GLenum mode,GLint first,GLsizei count,GLsizei primcount)const{(this->*(this->m_orig_glDrawArraysInstancedARB))(mode,first,count,primcount);this->m_checkErrors("glDrawArraysInstancedARB");}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC m_orig_glEnableVertexAttribAPPLE = nullptr;
+void m_glEnableVertexAttribAPPLE_validation(GLuint index,GLenum pname)const{(this->*(this->m_orig_glEnableVertexAttribAPPLE))(index,pname);this->m_checkErrors("glEnableVertexAttribAPPLE");}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC m_orig_glGetDebugMessageLogARB = nullptr;
+GLuint m_glGetDebugMessageLogARB_validation(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{GLuint const result = (this->*(this->m_orig_glGetDebugMessageLogARB))(count,bufSize,sources,types,ids,severities,lengths,messageLog);this->m_checkErrors("glGetDebugMessageLogARB");return result;}
+FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC m_orig_glGetPathTexGenfvNV = nullptr;
+void m_glGetPathTexGenfvNV_validation(GLenum texCoordSet,GLenum pname,GLfloat* value)const{(this->*(this->m_orig_glGetPathTexGenfvNV))(texCoordSet,pname,value);this->m_checkErrors("glGetPathTexGenfvNV");}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC m_orig_glNamedProgramLocalParameters4fvEXT = nullptr;
+void m_glNamedProgramLocalParameters4fvEXT_validation(GLuint program,GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{(this->*(this->m_orig_glNamedProgramLocalParameters4fvEXT))(program,target,index,count,params);this->m_checkErrors("glNamedProgramLocalParameters4fvEXT");}
+FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC m_orig_glQueryResourceTagNV = nullptr;
+void m_glQueryResourceTagNV_validation(GLint tagId,const GLchar* tagString)const{(this->*(this->m_orig_glQueryResourceTagNV))(tagId,tagString);this->m_checkErrors("glQueryResourceTagNV");}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC m_orig_glVertexStream3fvATI = nullptr;
+void m_glVertexStream3fvATI_validation(GLenum stream,const GLfloat* coords)const{(this->*(this->m_orig_glVertexStream3fvATI))(stream,coords);this->m_checkErrors("glVertexStream3fvATI");}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC m_orig_glFramebufferTexture3D = nullptr;
+void m_glFramebufferTexture3D_validation(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{(this->*(this->m_orig_glFramebufferTexture3D))(target,attachment,textarget,texture,level,zoffset);this->m_checkErrors("glFramebufferTexture3D");}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC m_orig_glCompressedTextureSubImage2DEXT = nullptr;
+void m_glCompressedTextureSubImage2DEXT_validation(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{(this->*(this->m_orig_glCompressedTextureSubImage2DEXT))(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);this->m_checkErrors("glCompressedTextureSubImage2DEXT");}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC m_orig_glWindowPos3dv = nullptr;
+void m_glWindowPos3dv_validation(const GLdouble* v)const{(this->*(this->m_orig_glWindowPos3dv))(v);this->m_checkErrors("glWindowPos3dv");}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC m_orig_glCopyConvolutionFilter2D = nullptr;
+void m_glCopyConvolutionFilter2D_validation(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{(this->*(this->m_orig_glCopyConvolutionFilter2D))(target,internalformat,x,y,width,height);this->m_checkErrors("glCopyConvolutionFilter2D");}
+FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC m_orig_glReadInstrumentsSGIX = nullptr;
+void m_glReadInstrumentsSGIX_validation(GLint marker)const{(this->*(this->m_orig_glReadInstrumentsSGIX))(marker);this->m_checkErrors("glReadInstrumentsSGIX");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC m_orig_glProgramUniform2dvEXT = nullptr;
+void m_glProgramUniform2dvEXT_validation(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{(this->*(this->m_orig_glProgramUniform2dvEXT))(program,location,count,value);this->m_checkErrors("glProgramUniform2dvEXT");}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC m_orig_glSamplerParameterfv = nullptr;
+void m_glSamplerParameterfv_validation(GLuint sampler,GLenum pname,const GLfloat* param)const{(this->*(this->m_orig_glSamplerParameterfv))(sampler,pname,param);this->m_checkErrors("glSamplerParameterfv");}
+FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC m_orig_glBindBufferARB = nullptr;
+void m_glBindBufferARB_validation(GLenum target,GLuint buffer)const{(this->*(this->m_orig_glBindBufferARB))(target,buffer);this->m_checkErrors("glBindBufferARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC m_orig_glVertexAttrib1sNV = nullptr;
+void m_glVertexAttrib1sNV_validation(GLuint index,GLshort x)const{(this->*(this->m_orig_glVertexAttrib1sNV))(index,x);this->m_checkErrors("glVertexAttrib1sNV");}
+FunctionTable::MEMBERPFNGLGETMATERIALIVPROC m_orig_glGetMaterialiv = nullptr;
+void m_glGetMaterialiv_validation(GLenum face,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetMaterialiv))(face,pname,params);this->m_checkErrors("glGetMaterialiv");}
+FunctionTable::MEMBERPFNGLUNIFORM1FVPROC m_orig_glUniform1fv = nullptr;
+void m_glUniform1fv_validation(GLint location,GLsizei count,const GLfloat* value)const{(this->*(this->m_orig_glUniform1fv))(location,count,value);this->m_checkErrors("glUniform1fv");}
+FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC m_orig_glBeginOcclusionQueryNV = nullptr;
+void m_glBeginOcclusionQueryNV_validation(GLuint id)const{(this->*(this->m_orig_glBeginOcclusionQueryNV))(id);this->m_checkErrors("glBeginOcclusionQueryNV");}
+FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC m_orig_glGenFencesAPPLE = nullptr;
+void m_glGenFencesAPPLE_validation(GLsizei n,GLuint* fences)const{(this->*(this->m_orig_glGenFencesAPPLE))(n,fences);this->m_checkErrors("glGenFencesAPPLE");}
+FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC m_orig_glScissorIndexedv = nullptr;
+void m_glScissorIndexedv_validation(GLuint index,const GLint* v)const{(this->*(this->m_orig_glScissorIndexedv))(index,v);this->m_checkErrors("glScissorIndexedv");}
+FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC m_orig_glDisableVariantClientStateEXT = nullptr;
+void m_glDisableVariantClientStateEXT_validation(GLuint id)const{(this->*(this->m_orig_glDisableVariantClientStateEXT))(id);this->m_checkErrors("glDisableVariantClientStateEXT");}
+FunctionTable::MEMBERPFNGLMINMAXEXTPROC m_orig_glMinmaxEXT = nullptr;
+void m_glMinmaxEXT_validation(GLenum target,GLenum internalformat,GLboolean sink)const{(this->*(this->m_orig_glMinmaxEXT))(target,internalformat,sink);this->m_checkErrors("glMinmaxEXT");}
+FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC m_orig_glNormalPointervINTEL = nullptr;
+void m_glNormalPointervINTEL_validation(GLenum type,const void** pointer)const{(this->*(this->m_orig_glNormalPointervINTEL))(type,pointer);this->m_checkErrors("glNormalPointervINTEL");}
+FunctionTable::MEMBERPFNGLNORMAL3SPROC m_orig_glNormal3s = nullptr;
+void m_glNormal3s_validation(GLshort nx,GLshort ny,GLshort nz)const{(this->*(this->m_orig_glNormal3s))(nx,ny,nz);this->m_checkErrors("glNormal3s");}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC m_orig_glGetnPixelMapuiv = nullptr;
+void m_glGetnPixelMapuiv_validation(GLenum map,GLsizei bufSize,GLuint* values)const{(this->*(this->m_orig_glGetnPixelMapuiv))(map,bufSize,values);this->m_checkErrors("glGetnPixelMapuiv");}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC m_orig_glNormalStream3bvATI = nullptr;
+void m_glNormalStream3bvATI_validation(GLenum stream,const GLbyte* coords)const{(this->*(this->m_orig_glNormalStream3bvATI))(stream,coords);this->m_checkErrors("glNormalStream3bvATI");}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC m_orig_glGetObjectParameterivAPPLE = nullptr;
+void m_glGetObjectParameterivAPPLE_validation(GLenum objectType,GLuint name,GLenum pname,GLint* params)const{(this->*(this->m_orig_glGetObjectParameterivAPPLE))(objectType,name,pname,params);this->m_checkErrors("glGetObjectParameterivAPPLE");}
+FunctionTable::MEMBERPFNGLNORMAL3IPROC m_orig_glNormal3i = nullptr;
+void m_glNormal3i_validation(GLint nx,GLint ny,GLint nz)const{(this->*(this->m_orig_glNormal3i))(nx,ny,nz);this->m_checkErrors("glNormal3i");}
+FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC m_orig_glUniform1ivARB = nullptr;
+void m_glUniform1ivARB_validation(GLint location,GLsizei count,const GLint* value)const{(this->*(this->m_orig_glUniform1ivARB))(location,count,value);this->m_checkErrors("glUniform1ivARB");}
+FunctionTable::MEMBERPFNGLNORMAL3DPROC m_orig_glNormal3d = nullptr;
+void m_glNormal3d_validation(GLdouble nx,GLdouble ny,GLdouble nz)const{(this->*(this->m_orig_glNormal3d))(nx,ny,nz);this->m_checkErrors("glNormal3d");}
+FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC m_orig_glUpdateObjectBufferATI = nullptr;
+void m_glUpdateObjectBufferATI_validation(GLuint buffer,GLuint offset,GLsizei size,const void* pointer,GLenum preserve)const{(this->*(this->m_orig_glUpdateObjectBufferATI))(buffer,offset,size,pointer,preserve);this->m_checkErrors("glUpdateObjectBufferATI");}
+FunctionTable::MEMBERPFNGLNORMAL3BPROC m_orig_glNormal3b = nullptr;
+void m_glNormal3b_validation(GLbyte nx,GLbyte ny,GLbyte nz)const{(this->*(this->m_orig_glNormal3b))(nx,ny,nz);this->m_checkErrors("glNormal3b");}
+FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC m_orig_glGetUniformBufferSizeEXT = nullptr;
+GLint m_glGetUniformBufferSizeEXT_validation(GLuint program,GLint location)const{GLint const result = (this->*(this->m_orig_glGetUniformBufferSizeEXT))(program,location);this->m_checkErrors("glGetUniformBufferSizeEXT");return result;}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC m_orig_glMultiTexCoord4dv = nullptr;
+void m_glMultiTexCoord4dv_validation(GLenum target,const GLdouble* v)const{(this->*(this->m_orig_glMultiTexCoord4dv))(target,v);this->m_checkErrors("glMultiTexCoord4dv");}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC m_orig_glProgramUniform3i64ARB = nullptr;
+void m_glProgramUniform3i64ARB_validation(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z)const{(this->*(this->m_orig_glProgramUniform3i64ARB))(program,location,x,y,z);this->m_checkErrors("glProgramUniform3i64ARB");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC m_orig_glVertexAttrib2d = nullptr;
+void m_glVertexAttrib2d_validation(GLuint index,GLdouble x,GLdouble y)const{(this->*(this->m_orig_glVertexAttrib2d))(index,x,y);this->m_checkErrors("glVertexAttrib2d");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC m_orig_glVertexAttrib2f = nullptr;
+void m_glVertexAttrib2f_validation(GLuint index,GLfloat x,GLfloat y)const{(this->*(this->m_orig_glVertexAttrib2f))(index,x,y);this->m_checkErrors("glVertexAttrib2f");}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC m_orig_glMultiDrawElementsEXT = nullptr;
+void m_glMultiDrawElementsEXT_validation(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount)const{(this->*(this->m_orig_glMultiDrawElementsEXT))(mode,count,type,indices,primcount);this->m_checkErrors("glMultiDrawElementsEXT");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC m_orig_glVertexAttrib3dv = nullptr;
+void m_glVertexAttrib3dv_validation(GLuint index,const GLdouble* v)const{(this->*(this->m_orig_glVertexAttrib3dv))(index,v);this->m_checkErrors("glVertexAttrib3dv");}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC m_orig_glMultiTexCoord2bOES = nullptr;
+void m_glMultiTexCoord2bOES_validation(GLenum texture,GLbyte s,GLbyte t)const{(this->*(this->m_orig_glMultiTexCoord2bOES))(texture,s,t);this->m_checkErrors("glMultiTexCoord2bOES");}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC m_orig_glVertexAttrib2s = nullptr;
+void m_glVertexAttrib2s_validation(GLuint index,GLshort x,GLshort y)const{(this->*(this->m_orig_glVertexAttrib2s))(index,x,y);this->m_checkErrors("glVertexAttrib2s");}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC m_orig_glTexImage3DMultisample = nullptr;
+void m_glTexImage3DMultisample_validation(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{(this->*(this->m_orig_glTexImage3DMultisample))(target,samples,internalformat,width,height,depth,fixedsamplelocations);this->m_checkErrors("glTexImage3DMultisample");}
+FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC m_orig_glGetUniformBlockIndex = nullptr;
+GLuint m_glGetUniformBlockIndex_validation(GLuint program,const GLchar* uniformBlockName)const{GLuint const result = (this->*(this->m_orig_glGetUniformBlockIndex))(program,uniformBlockName);this->m_checkErrors("glGetUniformBlockIndex");return result;}
+FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC m_orig_glReleaseKeyedMutexWin32EXT = nullptr;
+GLboolean m_glReleaseKeyedMutexWin32EXT_validation(GLuint memory,GLuint64 key)const{GLboolean const result = (this->*(this->m_orig_glReleaseKeyedMutexWin32EXT))(memory,key);this->m_checkErrors("glReleaseKeyedMutexWin32EXT");return result;}
+FunctionTable::MEMBERPFNGLFRONTFACEPROC m_orig_glFrontFace = nullptr;
+void m_glFrontFace_validation(GLenum mode)const{(this->*(this->m_orig_glFrontFace))(mode);this->m_checkErrors("glFrontFace");}
+FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC m_orig_glEvalCoord1xOES = nullptr;
+void m_glEvalCoord1xOES_validation(GLfixed u)const{(this->*(this->m_orig_glEvalCoord1xOES))(u);this->m_checkErrors("glEvalCoord1xOES");}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC m_orig_glDrawArraysInstancedBaseInstance = nullptr;
+void m_glDrawArraysInstancedBaseInstance_validation(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance)const{(this->*(this->m_orig_glDrawArraysInstancedBaseInstance))(mode,first,count,instancecount,baseinstance);this->m_checkErrors("glDrawArraysInstancedBaseInstance");}
+FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC m_orig_glIsPointInStrokePathNV = nullptr;
+GLboolean m_glIsPointInStrokePathNV_validation(GLuint path,GLfloat x,GLfloat y)const{GLboolean const result = (this->*(this->m_orig_glIsPointInStrokePathNV))(path,x,y);this->m_checkErrors("glIsPointInStrokePathNV");return result;}
@@ -10,6 +10,7 @@
 
 thread_local ge::gl::FunctionTablePointer _defaultOpenGLFunctionTable = nullptr;
 thread_local ge::gl::ContextPointer       _defaultOpenGLContext       = nullptr;
+thread_local ge::gl::CallSite             _currentCallSite;
 
 using namespace ge::gl;
 
@@ -51,6 +52,26 @@ void ge::gl::setDefaultContext(ContextPointer const&provider){
   _defaultOpenGLContext = provider;
 }
 
+/**
+ * @brief Function stores source location of the OpenGL call that follows
+ *
+ * @param file source file
+ * @param line line in the source file
+ */
+void ge::gl::setCallSite(char const*file,int line){
+  _currentCallSite.file = file;
+  _currentCallSite.line = line;
+}
+
+/**
+ * @brief Function returns source location of the last OpenGL call that was annotated
+ *
+ * @return call site, file is nullptr if no call was annotated
+ */
+ge::gl::CallSite const& ge::gl::getCallSite(){
+  return _currentCallSite;
+}
+
 /**
  * @brief Function creates OpenGL function table
  * Function table is decorated using LoaderTableDecorator, DSATableDecorator, CapabilitiesTableDecorator and TrapTableDecorator
@@ -20,6 +20,17 @@ namespace ge{
     GEGL_EXPORT void setDefaultContext      (ContextPointer       const&provider);
     GEGL_EXPORT FunctionTablePointer createTable(FunctionLoaderInterfacePointer const&loader);
     GEGL_EXPORT ContextPointer createContext(FunctionTablePointer const&table = nullptr);
+
+    /**
+     * @brief Source location of the last OpenGL call made through the call site macros
+     * (see Generated/ValidationCallSites.h), used by ValidationTableDecorator for reports.
+     */
+    struct CallSite{
+      char const*file = nullptr;
+      int         line = 0;
+    };
+    GEGL_EXPORT void            setCallSite(char const*file,int line);
+    GEGL_EXPORT CallSite const& getCallSite();
   }
 }
 
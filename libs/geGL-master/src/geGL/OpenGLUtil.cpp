@@ -13,6 +13,19 @@ std::string ge::gl::translateDebugSource(GLenum source){
     default                             :return"unknown"                        ;
   }
 }
+std::string ge::gl::translateError(GLenum error){
+  switch(error){//switch over errors returned by glGetError
+    case GL_NO_ERROR                     :return"GL_NO_ERROR"                     ;
+    case GL_INVALID_ENUM                 :return"GL_INVALID_ENUM"                 ;
+    case GL_INVALID_VALUE                :return"GL_INVALID_VALUE"                ;
+    case GL_INVALID_OPERATION            :return"GL_INVALID_OPERATION"            ;
+    case GL_INVALID_FRAMEBUFFER_OPERATION:return"GL_INVALID_FRAMEBUFFER_OPERATION";
+    case GL_OUT_OF_MEMORY                :return"GL_OUT_OF_MEMORY"                ;
+    case GL_STACK_UNDERFLOW              :return"GL_STACK_UNDERFLOW"              ;
+    case GL_STACK_OVERFLOW               :return"GL_STACK_OVERFLOW"               ;
+    default                              :return"unknown"                         ;
+  }
+}
 std::string ge::gl::translateDebugType(GLenum type){
   switch(type){//switch over debug types
     case GL_DEBUG_TYPE_ERROR              :return"GL_DEBUG_TYPE_ERROR"              ;
@@ -9,6 +9,7 @@ namespace ge{
     GEGL_EXPORT std::string translateDebugSource  (GLenum source  );
     GEGL_EXPORT std::string translateDebugType    (GLenum type    );
     GEGL_EXPORT std::string translateDebugSeverity(GLenum severity);
+    GEGL_EXPORT std::string translateError        (GLenum error   );
 
     GEGL_EXPORT std::string translateBufferTarget (GLenum     target );
     GEGL_EXPORT std::string translateBufferBinding(GLenum     binding);
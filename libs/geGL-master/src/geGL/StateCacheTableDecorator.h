@@ -0,0 +1,489 @@
+#pragma once
+
+#include<map>
+#include<tuple>
+#include<geGL/OpenGLFunctionTable.h>
+
+#define STATE_CACHE_HOOK(name)\
+  this->m_orig_##name = this->m_ptr_##name;\
+  if(this->m_ptr_##name)this->m_ptr_##name =\
+    (decltype(FunctionTable::m_ptr_##name))\
+      &StateCacheTableDecorator::m_##name##_cache
+
+#define STATE_CACHE_ORIG(name)\
+  decltype(FunctionTable::m_ptr_##name) m_orig_##name = nullptr
+
+#define STATE_CACHE_CALL(name)\
+  (this->*(this->m_orig_##name))
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Value of shadowed OpenGL state.
+     * Invalid value means that the state is unknown and the next call has to be forwarded.
+     */
+    template<typename V>
+      class StateCacheValue{
+        public:
+          /**
+           * @brief This function stores new value
+           *
+           * @param v new value
+           *
+           * @return true if the value differs from the cached one (the call has to be forwarded)
+           */
+          bool set(V const&v){
+            if(this->m_valid && this->m_value == v)return false;
+            this->m_valid = true;
+            this->m_value = v;
+            return true;
+          }
+          void invalidate(){this->m_valid = false;}
+          bool isValid()const{return this->m_valid;}
+          V const&get()const{return this->m_value;}
+        protected:
+          bool m_valid = false;
+          V    m_value = V();
+      };
+
+    /**
+     * @brief This decorator shadows frequently changed OpenGL state
+     * (bound program, VAO, textures, samplers, buffers, framebuffers,
+     * blend/depth/cull state, viewport and capabilities) and drops calls
+     * that would set the state to its current value.
+     *
+     * State changed behind the back of the table (other libraries, raw function pointers)
+     * is not tracked, call invalidateStateCache() after such code.
+     * Indexed viewport calls that touch viewport 0 forget the cached viewport.
+     * Per draw buffer blend and color mask calls forget the cached global values,
+     * multi-bind calls update or forget the bindings of the units they cover.
+     * Scissor rectangles are not shadowed, glScissor* calls are always forwarded.
+     * Deleting an object resets the bindings that referenced it.
+     */
+    template<typename T>
+      class StateCacheTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            StateCacheTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~StateCacheTableDecorator(){}
+          /**
+           * @brief This function forgets all shadowed state.
+           */
+          void invalidateStateCache(){
+            this->m_program          .invalidate();
+            this->m_vertexArray      .invalidate();
+            this->m_activeTexture    .invalidate();
+            this->m_drawFramebuffer  .invalidate();
+            this->m_readFramebuffer  .invalidate();
+            this->m_blendFunc        .invalidate();
+            this->m_blendEquation    .invalidate();
+            this->m_depthMask        .invalidate();
+            this->m_depthFunc        .invalidate();
+            this->m_cullFace         .invalidate();
+            this->m_frontFace        .invalidate();
+            this->m_colorMask        .invalidate();
+            this->m_viewport         .invalidate();
+            this->m_textures         .clear();
+            this->m_textureUnits     .clear();
+            this->m_samplers         .clear();
+            this->m_buffers          .clear();
+            this->m_indexedBuffers   .clear();
+            this->m_capabilities     .clear();
+          }
+          /**
+           * @brief This function returns number of calls that were dropped because they were redundant
+           *
+           * @return number of removed calls
+           */
+          size_t getNumberOfRemovedCalls()const{return this->m_removedCalls;}
+          /**
+           * @brief This function returns number of state calls that were forwarded to OpenGL
+           *
+           * @return number of forwarded calls
+           */
+          size_t getNumberOfForwardedCalls()const{return this->m_forwardedCalls;}
+          void resetCallCounters(){
+            this->m_removedCalls   = 0;
+            this->m_forwardedCalls = 0;
+          }
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            STATE_CACHE_HOOK(glUseProgram         );
+            STATE_CACHE_HOOK(glDeleteProgram      );
+            STATE_CACHE_HOOK(glBindVertexArray    );
+            STATE_CACHE_HOOK(glDeleteVertexArrays );
+            STATE_CACHE_HOOK(glVertexArrayElementBuffer);
+            STATE_CACHE_HOOK(glActiveTexture      );
+            STATE_CACHE_HOOK(glBindTexture        );
+            STATE_CACHE_HOOK(glBindTextureUnit    );
+            STATE_CACHE_HOOK(glBindTextures       );
+            STATE_CACHE_HOOK(glDeleteTextures     );
+            STATE_CACHE_HOOK(glBindSampler        );
+            STATE_CACHE_HOOK(glBindSamplers       );
+            STATE_CACHE_HOOK(glDeleteSamplers     );
+            STATE_CACHE_HOOK(glBindBuffer         );
+            STATE_CACHE_HOOK(glBindBufferBase     );
+            STATE_CACHE_HOOK(glBindBufferRange    );
+            STATE_CACHE_HOOK(glBindBuffersBase    );
+            STATE_CACHE_HOOK(glBindBuffersRange   );
+            STATE_CACHE_HOOK(glDeleteBuffers      );
+            STATE_CACHE_HOOK(glBindFramebuffer    );
+            STATE_CACHE_HOOK(glDeleteFramebuffers );
+            STATE_CACHE_HOOK(glEnable             );
+            STATE_CACHE_HOOK(glDisable            );
+            STATE_CACHE_HOOK(glEnablei            );
+            STATE_CACHE_HOOK(glDisablei           );
+            STATE_CACHE_HOOK(glBlendFunc          );
+            STATE_CACHE_HOOK(glBlendFuncSeparate  );
+            STATE_CACHE_HOOK(glBlendEquation      );
+            STATE_CACHE_HOOK(glBlendEquationSeparate);
+            STATE_CACHE_HOOK(glBlendFunci         );
+            STATE_CACHE_HOOK(glBlendFuncSeparatei );
+            STATE_CACHE_HOOK(glBlendEquationi     );
+            STATE_CACHE_HOOK(glBlendEquationSeparatei);
+            STATE_CACHE_HOOK(glDepthMask          );
+            STATE_CACHE_HOOK(glDepthFunc          );
+            STATE_CACHE_HOOK(glCullFace           );
+            STATE_CACHE_HOOK(glFrontFace          );
+            STATE_CACHE_HOOK(glColorMask          );
+            STATE_CACHE_HOOK(glColorMaski         );
+            STATE_CACHE_HOOK(glViewport           );
+            STATE_CACHE_HOOK(glViewportIndexedf   );
+            STATE_CACHE_HOOK(glViewportIndexedfv  );
+            STATE_CACHE_HOOK(glViewportArrayv     );
+            return true;
+          }
+
+          using BlendFunc = std::tuple<GLenum,GLenum,GLenum,GLenum>;
+          using Mask4     = std::tuple<GLboolean,GLboolean,GLboolean,GLboolean>;
+          using Rect      = std::tuple<GLint,GLint,GLsizei,GLsizei>;
+
+          StateCacheValue<GLuint   >m_program        ;
+          StateCacheValue<GLuint   >m_vertexArray    ;
+          StateCacheValue<GLenum   >m_activeTexture  ;
+          StateCacheValue<GLuint   >m_drawFramebuffer;
+          StateCacheValue<GLuint   >m_readFramebuffer;
+          StateCacheValue<BlendFunc>m_blendFunc      ;
+          StateCacheValue<std::pair<GLenum,GLenum>>m_blendEquation;
+          StateCacheValue<GLboolean>m_depthMask      ;
+          StateCacheValue<GLenum   >m_depthFunc      ;
+          StateCacheValue<GLenum   >m_cullFace       ;
+          StateCacheValue<GLenum   >m_frontFace      ;
+          StateCacheValue<Mask4    >m_colorMask      ;
+          StateCacheValue<Rect     >m_viewport       ;
+          std::map<std::pair<GLuint,GLenum>,GLuint>m_textures      ;///<(unit,target) -> texture, glBindTexture
+          std::map<GLuint,GLuint>                  m_textureUnits  ;///<unit -> texture, glBindTextureUnit
+          std::map<GLuint,GLuint>                  m_samplers      ;///<unit -> sampler
+          std::map<GLenum,GLuint>                  m_buffers       ;///<target -> buffer
+          std::map<std::pair<GLenum,GLuint>,GLuint>m_indexedBuffers;///<(target,index) -> buffer, glBindBufferBase
+          std::map<GLenum,bool>                    m_capabilities  ;
+          size_t m_removedCalls   = 0;
+          size_t m_forwardedCalls = 0;
+
+          STATE_CACHE_ORIG(glUseProgram         );
+          STATE_CACHE_ORIG(glDeleteProgram      );
+          STATE_CACHE_ORIG(glBindVertexArray    );
+          STATE_CACHE_ORIG(glDeleteVertexArrays );
+          STATE_CACHE_ORIG(glVertexArrayElementBuffer);
+          STATE_CACHE_ORIG(glActiveTexture      );
+          STATE_CACHE_ORIG(glBindTexture        );
+          STATE_CACHE_ORIG(glBindTextureUnit    );
+          STATE_CACHE_ORIG(glBindTextures       );
+          STATE_CACHE_ORIG(glDeleteTextures     );
+          STATE_CACHE_ORIG(glBindSampler        );
+          STATE_CACHE_ORIG(glBindSamplers       );
+          STATE_CACHE_ORIG(glDeleteSamplers     );
+          STATE_CACHE_ORIG(glBindBuffer         );
+          STATE_CACHE_ORIG(glBindBufferBase     );
+          STATE_CACHE_ORIG(glBindBufferRange    );
+          STATE_CACHE_ORIG(glBindBuffersBase    );
+          STATE_CACHE_ORIG(glBindBuffersRange   );
+          STATE_CACHE_ORIG(glDeleteBuffers      );
+          STATE_CACHE_ORIG(glBindFramebuffer    );
+          STATE_CACHE_ORIG(glDeleteFramebuffers );
+          STATE_CACHE_ORIG(glEnable             );
+          STATE_CACHE_ORIG(glDisable            );
+          STATE_CACHE_ORIG(glEnablei            );
+          STATE_CACHE_ORIG(glDisablei           );
+          STATE_CACHE_ORIG(glBlendFunc          );
+          STATE_CACHE_ORIG(glBlendFuncSeparate  );
+          STATE_CACHE_ORIG(glBlendEquation      );
+          STATE_CACHE_ORIG(glBlendEquationSeparate);
+          STATE_CACHE_ORIG(glBlendFunci         );
+          STATE_CACHE_ORIG(glBlendFuncSeparatei );
+          STATE_CACHE_ORIG(glBlendEquationi     );
+          STATE_CACHE_ORIG(glBlendEquationSeparatei);
+          STATE_CACHE_ORIG(glDepthMask          );
+          STATE_CACHE_ORIG(glDepthFunc          );
+          STATE_CACHE_ORIG(glCullFace           );
+          STATE_CACHE_ORIG(glFrontFace          );
+          STATE_CACHE_ORIG(glColorMask          );
+          STATE_CACHE_ORIG(glColorMaski         );
+          STATE_CACHE_ORIG(glViewport           );
+          STATE_CACHE_ORIG(glViewportIndexedf   );
+          STATE_CACHE_ORIG(glViewportIndexedfv  );
+          STATE_CACHE_ORIG(glViewportArrayv     );
+
+          /**
+           * @brief This function counts the call and decides if it has to be forwarded
+           *
+           * @param changed true if the state has changed
+           *
+           * @return changed
+           */
+          bool m_forward(bool changed){
+            if(changed)this->m_forwardedCalls++;
+            else       this->m_removedCalls  ++;
+            return changed;
+          }
+          template<typename K,typename V>
+            bool m_set(std::map<K,V>&m,K const&key,V const&value){
+              auto it = m.find(key);
+              if(it != m.end() && it->second == value)return false;
+              m[key] = value;
+              return true;
+            }
+          template<typename K,typename V>
+            void m_eraseValue(std::map<K,V>&m,V const&value){
+              for(auto it = m.begin();it != m.end();){
+                if(it->second == value)it = m.erase(it);
+                else ++it;
+              }
+            }
+          void m_forgetTextureTargets(GLuint unit){
+            for(auto it = this->m_textures.begin();it != this->m_textures.end();){
+              if(it->first.first == unit)it = this->m_textures.erase(it);
+              else ++it;
+            }
+          }
+
+          void m_glUseProgram_cache(GLuint program){
+            if(this->m_forward(this->m_program.set(program)))
+              STATE_CACHE_CALL(glUseProgram)(program);
+          }
+          void m_glDeleteProgram_cache(GLuint program){
+            if(this->m_program.isValid() && this->m_program.get() == program)
+              this->m_program.invalidate();
+            STATE_CACHE_CALL(glDeleteProgram)(program);
+          }
+          void m_glBindVertexArray_cache(GLuint array){
+            if(!this->m_forward(this->m_vertexArray.set(array)))return;
+            //element array buffer binding is part of VAO state
+            this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+            STATE_CACHE_CALL(glBindVertexArray)(array);
+          }
+          void m_glDeleteVertexArrays_cache(GLsizei n,const GLuint*arrays){
+            for(GLsizei i=0;i<n;++i)
+              if(this->m_vertexArray.isValid() && this->m_vertexArray.get() == arrays[i]){
+                this->m_vertexArray.set(0);
+                this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+              }
+            STATE_CACHE_CALL(glDeleteVertexArrays)(n,arrays);
+          }
+          void m_glVertexArrayElementBuffer_cache(GLuint vaobj,GLuint buffer){
+            //the VAO may be the bound one, its element array binding is no longer known
+            this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+            STATE_CACHE_CALL(glVertexArrayElementBuffer)(vaobj,buffer);
+          }
+          void m_glActiveTexture_cache(GLenum texture){
+            if(this->m_forward(this->m_activeTexture.set(texture)))
+              STATE_CACHE_CALL(glActiveTexture)(texture);
+          }
+          void m_glBindTexture_cache(GLenum target,GLuint texture){
+            if(!this->m_activeTexture.isValid()){
+              this->m_forward(true);
+              STATE_CACHE_CALL(glBindTexture)(target,texture);
+              return;
+            }
+            GLuint const unit = this->m_activeTexture.get() - GL_TEXTURE0;
+            if(!this->m_forward(this->m_set(this->m_textures,std::make_pair(unit,target),texture)))return;
+            this->m_textureUnits.erase(unit);
+            STATE_CACHE_CALL(glBindTexture)(target,texture);
+          }
+          void m_glBindTextureUnit_cache(GLuint unit,GLuint texture){
+            if(!this->m_forward(this->m_set(this->m_textureUnits,unit,texture)))return;
+            //the target of the texture is not known, forget all targets of the unit
+            this->m_forgetTextureTargets(unit);
+            STATE_CACHE_CALL(glBindTextureUnit)(unit,texture);
+          }
+          void m_glBindTextures_cache(GLuint first,GLsizei count,const GLuint*textures){
+            for(GLsizei i=0;i<count;++i){
+              this->m_textureUnits.erase(first+i);
+              this->m_forgetTextureTargets(first+i);
+            }
+            STATE_CACHE_CALL(glBindTextures)(first,count,textures);
+          }
+          void m_glDeleteTextures_cache(GLsizei n,const GLuint*textures){
+            for(GLsizei i=0;i<n;++i){
+              this->m_eraseValue(this->m_textures    ,textures[i]);
+              this->m_eraseValue(this->m_textureUnits,textures[i]);
+            }
+            STATE_CACHE_CALL(glDeleteTextures)(n,textures);
+          }
+          void m_glBindSampler_cache(GLuint unit,GLuint sampler){
+            if(this->m_forward(this->m_set(this->m_samplers,unit,sampler)))
+              STATE_CACHE_CALL(glBindSampler)(unit,sampler);
+          }
+          void m_glBindSamplers_cache(GLuint first,GLsizei count,const GLuint*samplers){
+            //NULL unbinds all units of the range
+            for(GLsizei i=0;i<count;++i)
+              this->m_samplers[first+i] = samplers ? samplers[i] : 0;
+            STATE_CACHE_CALL(glBindSamplers)(first,count,samplers);
+          }
+          void m_glDeleteSamplers_cache(GLsizei count,const GLuint*samplers){
+            for(GLsizei i=0;i<count;++i)
+              this->m_eraseValue(this->m_samplers,samplers[i]);
+            STATE_CACHE_CALL(glDeleteSamplers)(count,samplers);
+          }
+          void m_glBindBuffer_cache(GLenum target,GLuint buffer){
+            if(this->m_forward(this->m_set(this->m_buffers,target,buffer)))
+              STATE_CACHE_CALL(glBindBuffer)(target,buffer);
+          }
+          void m_glBindBufferBase_cache(GLenum target,GLuint index,GLuint buffer){
+            if(!this->m_forward(this->m_set(this->m_indexedBuffers,std::make_pair(target,index),buffer)))return;
+            //glBindBufferBase also binds the generic binding point
+            this->m_buffers[target] = buffer;
+            STATE_CACHE_CALL(glBindBufferBase)(target,index,buffer);
+          }
+          void m_glBindBufferRange_cache(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){
+            this->m_indexedBuffers.erase(std::make_pair(target,index));
+            this->m_buffers[target] = buffer;
+            STATE_CACHE_CALL(glBindBufferRange)(target,index,buffer,offset,size);
+          }
+          void m_glBindBuffersBase_cache(GLenum target,GLuint first,GLsizei count,const GLuint*buffers){
+            for(GLsizei i=0;i<count;++i)
+              this->m_indexedBuffers.erase(std::make_pair(target,first+i));
+            //generic binding point is left unchanged by glBindBuffersBase
+            STATE_CACHE_CALL(glBindBuffersBase)(target,first,count,buffers);
+          }
+          void m_glBindBuffersRange_cache(GLenum target,GLuint first,GLsizei count,const GLuint*buffers,const GLintptr*offsets,const GLsizeiptr*sizes){
+            //ranges are not shadowed, forget the bindings; generic binding point is left unchanged
+            for(GLsizei i=0;i<count;++i)
+              this->m_indexedBuffers.erase(std::make_pair(target,first+i));
+            STATE_CACHE_CALL(glBindBuffersRange)(target,first,count,buffers,offsets,sizes);
+          }
+          void m_glDeleteBuffers_cache(GLsizei n,const GLuint*buffers){
+            for(GLsizei i=0;i<n;++i){
+              this->m_eraseValue(this->m_buffers       ,buffers[i]);
+              this->m_eraseValue(this->m_indexedBuffers,buffers[i]);
+            }
+            STATE_CACHE_CALL(glDeleteBuffers)(n,buffers);
+          }
+          void m_glBindFramebuffer_cache(GLenum target,GLuint framebuffer){
+            bool changed = false;
+            if(target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+              changed |= this->m_drawFramebuffer.set(framebuffer);
+            if(target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+              changed |= this->m_readFramebuffer.set(framebuffer);
+            if(this->m_forward(changed))
+              STATE_CACHE_CALL(glBindFramebuffer)(target,framebuffer);
+          }
+          void m_glDeleteFramebuffers_cache(GLsizei n,const GLuint*framebuffers){
+            for(GLsizei i=0;i<n;++i){
+              if(this->m_drawFramebuffer.isValid() && this->m_drawFramebuffer.get() == framebuffers[i])
+                this->m_drawFramebuffer.set(0);
+              if(this->m_readFramebuffer.isValid() && this->m_readFramebuffer.get() == framebuffers[i])
+                this->m_readFramebuffer.set(0);
+            }
+            STATE_CACHE_CALL(glDeleteFramebuffers)(n,framebuffers);
+          }
+          void m_glEnable_cache(GLenum cap){
+            if(this->m_forward(this->m_set(this->m_capabilities,cap,true)))
+              STATE_CACHE_CALL(glEnable)(cap);
+          }
+          void m_glDisable_cache(GLenum cap){
+            if(this->m_forward(this->m_set(this->m_capabilities,cap,false)))
+              STATE_CACHE_CALL(glDisable)(cap);
+          }
+          void m_glEnablei_cache(GLenum target,GLuint index){
+            this->m_capabilities.erase(target);
+            STATE_CACHE_CALL(glEnablei)(target,index);
+          }
+          void m_glDisablei_cache(GLenum target,GLuint index){
+            this->m_capabilities.erase(target);
+            STATE_CACHE_CALL(glDisablei)(target,index);
+          }
+          void m_glBlendFunc_cache(GLenum sfactor,GLenum dfactor){
+            if(this->m_forward(this->m_blendFunc.set(BlendFunc(sfactor,dfactor,sfactor,dfactor))))
+              STATE_CACHE_CALL(glBlendFunc)(sfactor,dfactor);
+          }
+          void m_glBlendFuncSeparate_cache(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha){
+            if(this->m_forward(this->m_blendFunc.set(BlendFunc(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha))))
+              STATE_CACHE_CALL(glBlendFuncSeparate)(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);
+          }
+          void m_glBlendEquation_cache(GLenum mode){
+            if(this->m_forward(this->m_blendEquation.set(std::make_pair(mode,mode))))
+              STATE_CACHE_CALL(glBlendEquation)(mode);
+          }
+          void m_glBlendEquationSeparate_cache(GLenum modeRGB,GLenum modeAlpha){
+            if(this->m_forward(this->m_blendEquation.set(std::make_pair(modeRGB,modeAlpha))))
+              STATE_CACHE_CALL(glBlendEquationSeparate)(modeRGB,modeAlpha);
+          }
+          //the cached blend state is the one of all draw buffers, a per buffer call makes it unknown
+          void m_glBlendFunci_cache(GLuint buf,GLenum src,GLenum dst){
+            this->m_blendFunc.invalidate();
+            STATE_CACHE_CALL(glBlendFunci)(buf,src,dst);
+          }
+          void m_glBlendFuncSeparatei_cache(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha){
+            this->m_blendFunc.invalidate();
+            STATE_CACHE_CALL(glBlendFuncSeparatei)(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);
+          }
+          void m_glBlendEquationi_cache(GLuint buf,GLenum mode){
+            this->m_blendEquation.invalidate();
+            STATE_CACHE_CALL(glBlendEquationi)(buf,mode);
+          }
+          void m_glBlendEquationSeparatei_cache(GLuint buf,GLenum modeRGB,GLenum modeAlpha){
+            this->m_blendEquation.invalidate();
+            STATE_CACHE_CALL(glBlendEquationSeparatei)(buf,modeRGB,modeAlpha);
+          }
+          void m_glDepthMask_cache(GLboolean flag){
+            if(this->m_forward(this->m_depthMask.set(flag)))
+              STATE_CACHE_CALL(glDepthMask)(flag);
+          }
+          void m_glDepthFunc_cache(GLenum func){
+            if(this->m_forward(this->m_depthFunc.set(func)))
+              STATE_CACHE_CALL(glDepthFunc)(func);
+          }
+          void m_glCullFace_cache(GLenum mode){
+            if(this->m_forward(this->m_cullFace.set(mode)))
+              STATE_CACHE_CALL(glCullFace)(mode);
+          }
+          void m_glFrontFace_cache(GLenum mode){
+            if(this->m_forward(this->m_frontFace.set(mode)))
+              STATE_CACHE_CALL(glFrontFace)(mode);
+          }
+          void m_glColorMask_cache(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha){
+            if(this->m_forward(this->m_colorMask.set(Mask4(red,green,blue,alpha))))
+              STATE_CACHE_CALL(glColorMask)(red,green,blue,alpha);
+          }
+          void m_glColorMaski_cache(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a){
+            this->m_colorMask.invalidate();
+            STATE_CACHE_CALL(glColorMaski)(index,r,g,b,a);
+          }
+          void m_glViewport_cache(GLint x,GLint y,GLsizei width,GLsizei height){
+            if(this->m_forward(this->m_viewport.set(Rect(x,y,width,height))))
+              STATE_CACHE_CALL(glViewport)(x,y,width,height);
+          }
+          //glViewport sets viewport 0, the indexed calls may change it too
+          void m_glViewportIndexedf_cache(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h){
+            if(index == 0)this->m_viewport.invalidate();
+            STATE_CACHE_CALL(glViewportIndexedf)(index,x,y,w,h);
+          }
+          void m_glViewportIndexedfv_cache(GLuint index,const GLfloat*v){
+            if(index == 0)this->m_viewport.invalidate();
+            STATE_CACHE_CALL(glViewportIndexedfv)(index,v);
+          }
+          void m_glViewportArrayv_cache(GLuint first,GLsizei count,const GLfloat*v){
+            if(first == 0 && count > 0)this->m_viewport.invalidate();
+            STATE_CACHE_CALL(glViewportArrayv)(first,count,v);
+          }
+      };
+
+  }
+}
+
+#undef STATE_CACHE_HOOK
+#undef STATE_CACHE_ORIG
+#undef STATE_CACHE_CALL
@@ -0,0 +1,58 @@
+#pragma once
+
+#include<cstdint>
+#include<cstddef>
+#include<geGL/OpenGL.h>
+
+/*
+ * Binary trace written by TraceTableDecorator and read by TracePlayer.
+ *
+ * file   : magic "GEGLTRC1"
+ *          uint32 number of names, {uint32 id, uint32 length, chars} for every function used in the trace
+ *          uint64 size, setup calls (everything recorded before the first frame, then the calls
+ *                       of later frames that created, filled or deleted objects)
+ *          uint64 size, frame calls
+ * call   : uint32 id, arguments, outputs written by the call, return value
+ * scalar : raw bytes of the argument
+ * GLsync : uint64 handle
+ * pointer: uint8 TracePointerKind, uint64 raw value, data that depends on the kind:
+ *          PAYLOAD/STRING: uint64 size, bytes
+ *          STRING_ARRAY  : uint32 count, {uint64 size, bytes (zero terminated)}
+ *          OUTPUT        : uint64 size, the bytes follow the arguments (written after the call)
+ * return : raw bytes for scalars, uint64 for pointers and GLsync
+ */
+
+namespace ge{
+  namespace gl{
+    enum TraceFunctionId{
+#include<geGL/Generated/TraceFunctionIds.h>
+    };
+
+    /**
+     * @brief Function returns name of OpenGL function traced with id
+     *
+     * @param id TraceFunctionId
+     *
+     * @return name of function ("glUseProgram", ...)
+     */
+    inline char const*getTraceFunctionName(size_t id){
+      static char const*const names[] = {
+#include<geGL/Generated/TraceFunctionNames.h>
+      };
+      return names[id];
+    }
+
+    enum class TracePointerKind: uint8_t{
+      NONE         = 0,///< pointer is not recorded, replayed as nullptr
+      OFFSET       = 1,///< pointer is an offset into a bound buffer, replayed as recorded value
+      PAYLOAD      = 2,///< data pointed to are recorded
+      STRING       = 3,///< zero terminated string
+      STRING_ARRAY = 4,///< array of strings (glShaderSource)
+      OUTPUT       = 5,///< data are written by the call, recorded after it (names from glGen*)
+      SCRATCH      = 6,///< data are written by the call and not recorded (glGet*)
+      DEFAULT      = 255,///< kind is deduced from type
+    };
+
+    char const traceMagic[8] = {'G','E','G','L','T','R','C','1'};
+  }
+}
@@ -0,0 +1,86 @@
+#include<geGL/TracePlayer.h>
+#include<fstream>
+#include<iterator>
+
+using namespace ge::gl;
+
+namespace{
+  uint32_t const unknownFunction = 0xffffffff;
+  size_t   const scratchSize     = 1<<16;
+}
+
+bool TracePlayer::load(std::string const&file){
+  std::ifstream f(file,std::ios::binary);
+  if(!f.is_open())return false;
+  std::vector<uint8_t>data((std::istreambuf_iterator<char>(f)),std::istreambuf_iterator<char>());
+  if(data.size() < sizeof(traceMagic)+sizeof(uint32_t))return false;
+  if(std::memcmp(data.data(),traceMagic,sizeof(traceMagic)))return false;
+  this->m_ptr = data.data() + sizeof(traceMagic);
+  uint8_t const*const end = data.data() + data.size();
+
+  std::map<std::string,uint32_t>functions;
+  for(uint32_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)functions[getTraceFunctionName(i)] = i;
+
+  auto const nofNames = this->m_read<uint32_t>();
+  this->m_ids.clear();
+  for(uint32_t i=0;i<nofNames;++i){
+    if(this->m_ptr + 2*sizeof(uint32_t) > end)return false;
+    auto const id     = this->m_read<uint32_t>();
+    auto const length = this->m_read<uint32_t>();
+    if(this->m_ptr + length > end)return false;
+    std::string const name((char const*)this->m_ptr,length);
+    this->m_ptr += length;
+    if(id >= this->m_ids.size())this->m_ids.resize(id+1,unknownFunction);
+    auto const it = functions.find(name);
+    if(it != functions.end())this->m_ids[id] = it->second;
+  }
+
+  for(auto segment:{&this->m_setup,&this->m_frame}){
+    if(this->m_ptr + sizeof(uint64_t) > end)return false;
+    auto const size = this->m_read<uint64_t>();
+    if(size > (uint64_t)(end - this->m_ptr))return false;
+    segment->assign(this->m_ptr,this->m_ptr+size);
+    this->m_ptr += size;
+  }
+  this->m_ptr = nullptr;
+  this->m_scratch.resize(scratchSize);
+  this->m_syncs.clear();
+  this->m_mismatches = 0;
+  return true;
+}
+
+bool TracePlayer::playSetup(FunctionTable const&table){
+  size_t calls = 0;
+  return this->m_play(this->m_setup,table,calls);
+}
+
+bool TracePlayer::playFrame(FunctionTable const&table){
+  this->m_frameCalls = 0;
+  return this->m_play(this->m_frame,table,this->m_frameCalls);
+}
+
+void TracePlayer::finishCall(){
+  //names written by glGen* / glCreate* are compared with recorded ones
+  for(auto const&output:this->m_outputs){
+    if(std::memcmp(output.data(),this->m_ptr,output.size()))this->m_mismatches++;
+    this->m_ptr += output.size();
+  }
+  this->m_outputs.clear();
+  this->m_strings.clear();
+}
+
+bool TracePlayer::m_play(std::vector<uint8_t>const&segment,FunctionTable const&table,size_t&calls){
+  auto&r = *this;
+  this->m_ptr = segment.data();
+  uint8_t const*const end = segment.data() + segment.size();
+  while(this->m_ptr < end){
+    auto const fileId = this->m_read<uint32_t>();
+    if(fileId >= this->m_ids.size() || this->m_ids[fileId] == unknownFunction)return false;
+    switch(this->m_ids[fileId]){
+#include<geGL/Generated/TraceReplayCalls.h>
+      default:return false;
+    }
+    calls++;
+  }
+  return true;
+}
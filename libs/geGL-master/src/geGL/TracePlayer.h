@@ -0,0 +1,145 @@
+#pragma once
+
+#include<map>
+#include<string>
+#include<vector>
+#include<cstring>
+#include<type_traits>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/TraceFormat.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This class replays binary trace written by TraceTableDecorator::dumpLastFrame.
+     * Object names are expected to be the same as during recording (fresh context),
+     * results of calls (names, uniform locations, ...) that differ from recorded ones are counted as mismatches.
+     */
+    class TracePlayer{
+      public:
+        /**
+         * @brief This function loads trace
+         *
+         * @param file name of file
+         *
+         * @return false if the file is not a trace
+         */
+        GEGL_EXPORT bool load(std::string const&file);
+        /**
+         * @brief This function replays calls recorded before the first frame (resource creation)
+         *
+         * @param table function table used for replay
+         *
+         * @return false if the trace contains function that is not known by this build
+         */
+        GEGL_EXPORT bool playSetup(FunctionTable const&table);
+        /**
+         * @brief This function replays recorded frame, it can be called repeatedly
+         *
+         * @param table function table used for replay
+         *
+         * @return false if the trace contains function that is not known by this build
+         */
+        GEGL_EXPORT bool playFrame(FunctionTable const&table);
+        size_t getNumberOfFrameCalls()const{return this->m_frameCalls;}
+        size_t getNumberOfMismatches()const{return this->m_mismatches;}
+
+        template<typename T>T arg();
+        template<typename R>void result(R const&r);
+        GEGL_EXPORT void finishCall();
+      protected:
+        std::vector<uint8_t>      m_setup            ;
+        std::vector<uint8_t>      m_frame            ;
+        std::vector<uint32_t>     m_ids              ;///< id in file -> TraceFunctionId
+        uint8_t const*            m_ptr      = nullptr;
+        std::map<uint64_t,GLsync> m_syncs            ;
+        std::vector<uint8_t>      m_scratch          ;
+        std::vector<std::vector<uint8_t    >>m_outputs;
+        std::vector<std::vector<char const*>>m_strings;
+        size_t                    m_frameCalls = 0;
+        size_t                    m_mismatches = 0;
+        GEGL_EXPORT bool m_play(std::vector<uint8_t>const&segment,FunctionTable const&table,size_t&calls);
+        template<typename V>V m_read(){
+          V v;
+          std::memcpy(&v,this->m_ptr,sizeof(V));
+          this->m_ptr += sizeof(V);
+          return v;
+        }
+        template<typename T>T m_arg(std::false_type);
+        template<typename T>T m_arg(std::true_type );
+        template<typename R>void m_result(R const&r,std::false_type);
+        template<typename R>void m_result(R const&r,std::true_type );
+    };
+
+    template<typename T>
+      inline T TracePlayer::arg(){
+        return this->m_arg<T>(std::integral_constant<bool,std::is_pointer<T>::value && !std::is_same<T,GLsync>::value>{});
+      }
+    template<typename T>
+      inline T TracePlayer::m_arg(std::false_type){
+        return this->m_read<T>();
+      }
+    template<>
+      inline GLsync TracePlayer::m_arg<GLsync>(std::false_type){
+        auto const it = this->m_syncs.find(this->m_read<uint64_t>());
+        if(it == this->m_syncs.end())return nullptr;
+        return it->second;
+      }
+    template<typename T>
+      inline T TracePlayer::m_arg(std::true_type){
+        auto const kind = static_cast<TracePointerKind>(this->m_read<uint8_t>());
+        auto const raw  = this->m_read<uint64_t>();
+        switch(kind){
+          case TracePointerKind::OFFSET:
+            return (T)(uintptr_t)raw;
+          case TracePointerKind::PAYLOAD:
+          case TracePointerKind::STRING :{
+            auto const size = this->m_read<uint64_t>();
+            auto const data = this->m_ptr;
+            this->m_ptr += size;
+            return size ? (T)(uintptr_t)data : nullptr;
+          }
+          case TracePointerKind::STRING_ARRAY:{
+            auto const count = this->m_read<uint32_t>();
+            this->m_strings.emplace_back();
+            for(uint32_t i=0;i<count;++i){
+              auto const size = this->m_read<uint64_t>();
+              this->m_strings.back().push_back((char const*)this->m_ptr);
+              this->m_ptr += size;
+            }
+            return (T)(uintptr_t)this->m_strings.back().data();
+          }
+          case TracePointerKind::OUTPUT:{
+            auto const size = this->m_read<uint64_t>();
+            if(!size)return nullptr;
+            this->m_outputs.emplace_back(size);
+            return (T)(uintptr_t)this->m_outputs.back().data();
+          }
+          case TracePointerKind::SCRATCH:
+            return raw ? (T)(uintptr_t)this->m_scratch.data() : nullptr;
+          default:
+            return nullptr;
+        }
+      }
+
+    template<typename R>
+      inline void TracePlayer::result(R const&r){
+        this->m_result(r,std::integral_constant<bool,std::is_pointer<R>::value>{});
+      }
+    template<typename R>
+      inline void TracePlayer::m_result(R const&r,std::false_type){
+        auto const recorded = this->m_read<R>();
+        if(std::memcmp(&recorded,&r,sizeof(R)))this->m_mismatches++;
+      }
+    template<typename R>
+      inline void TracePlayer::m_result(R const&r,std::true_type){
+        auto const recorded = this->m_read<uint64_t>();
+        (void)r;
+        (void)recorded;
+      }
+    template<>
+      inline void TracePlayer::m_result<GLsync>(GLsync const&r,std::true_type){
+        this->m_syncs[this->m_read<uint64_t>()] = r;
+      }
+  }
+}
@@ -0,0 +1,702 @@
+#pragma once
+
+#include<map>
+#include<tuple>
+#include<deque>
+#include<vector>
+#include<string>
+#include<cstdint>
+#include<cstring>
+#include<fstream>
+#include<algorithm>
+#include<type_traits>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/TraceFormat.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Amount of work done by TraceTableDecorator
+     */
+    enum class TraceLevel{
+      OFF       ,///< nothing is installed
+      STATISTICS,///< calls are counted per entry point and frame
+      RECORD    ,///< calls are counted and recorded (setup + ring buffer of frames)
+    };
+
+    /**
+     * @brief State needed to compute sizes of recorded data
+     */
+    struct TraceState{
+      GLint unpackAlignment = 4;
+    };
+
+    /**
+     * @brief Size of data behind pointer argument I of function F.
+     * Arguments that are not specialized are deduced from type:
+     * strings are recorded, other const pointers are replayed as nullptr,
+     * non-const pointers get scratch memory.
+     */
+    template<size_t F,size_t I>
+      struct TracePointerRule{
+        static constexpr TracePointerKind kind = TracePointerKind::DEFAULT;
+      };
+
+    /**
+     * @brief How a call made during a frame is kept for the replay of a later frame.
+     * Objects created, filled or deleted in earlier frames (streaming, hot reload,
+     * lazily created queries) have to exist when the dumped frame is replayed.
+     */
+    enum class TracePersistence{
+      NONE  ,///< frame only
+      KEEP  ,///< appended to the calls replayed before the dumped frame
+      LATEST,///< kept, a later call with the same key replaces it (per frame uploads)
+      DELETE,///< kept, forgets the keys of the deleted objects
+    };
+
+    /**
+     * @brief Key of TracePersistence::LATEST calls: group, object, two values (offset and size, location, ...)
+     */
+    using TracePersistentKey = std::tuple<int,GLuint,int64_t,int64_t>;
+    enum TracePersistentGroup{
+      TRACE_KEY_BUFFER  = 0,
+      TRACE_KEY_PROGRAM = 1,
+      TRACE_KEY_TEXTURE = 2,
+    };
+
+    /**
+     * @brief Persistence of function F, calls that are not specialized are frame only.
+     * Only DSA entry points are kept: calls that use bindings depend on frame state.
+     */
+    template<size_t F>
+      struct TracePersistentRule{
+        static constexpr TracePersistence kind = TracePersistence::NONE;
+      };
+
+    /**
+     * @brief Function computes size of pixel data read by glTexImage* / glTexSubImage*
+     */
+    inline size_t traceImageSize(TraceState const&state,GLsizei w,GLsizei h,GLsizei d,GLenum format,GLenum type){
+      size_t components = 4;
+      switch(format){
+        case GL_RED  :case GL_GREEN:case GL_BLUE:case GL_ALPHA:
+        case GL_RED_INTEGER:case GL_DEPTH_COMPONENT:case GL_STENCIL_INDEX:components = 1;break;
+        case GL_RG   :case GL_RG_INTEGER:case GL_DEPTH_STENCIL  :components = 2;break;
+        case GL_RGB  :case GL_BGR:case GL_RGB_INTEGER:case GL_BGR_INTEGER:components = 3;break;
+        default:break;
+      }
+      size_t pixel = 0;
+      switch(type){
+        case GL_UNSIGNED_BYTE :case GL_BYTE :pixel = components  ;break;
+        case GL_UNSIGNED_SHORT:case GL_SHORT:case GL_HALF_FLOAT:pixel = components*2;break;
+        case GL_UNSIGNED_INT  :case GL_INT  :case GL_FLOAT     :pixel = components*4;break;
+        case GL_UNSIGNED_BYTE_3_3_2:case GL_UNSIGNED_BYTE_2_3_3_REV:pixel = 1;break;
+        case GL_UNSIGNED_SHORT_5_6_5:case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4:case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1:case GL_UNSIGNED_SHORT_1_5_5_5_REV:pixel = 2;break;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:pixel = 8;break;
+        default:pixel = 4;break;//packed 32 bit formats
+      }
+      size_t const alignment = state.unpackAlignment > 0 ? (size_t)state.unpackAlignment : 1;
+      size_t const row       = ((size_t)w*pixel + alignment - 1) / alignment * alignment;
+      return row*(size_t)h*(size_t)d;
+    }
+  }
+}
+
+#define GE_GL_TRACE_ARG(i) std::get<i>(a)
+
+#define GE_GL_TRACE_RULE(fce,arg,ruleKind,bytes)\
+  namespace ge{namespace gl{\
+    template<>struct TracePointerRule<TRACE_##fce,arg>{\
+      static constexpr TracePointerKind kind = TracePointerKind::ruleKind;\
+      template<typename A>static size_t size(TraceState const&state,A const&a){(void)state;(void)a;return (size_t)(bytes);}\
+    };\
+  }}
+
+#define GE_GL_TRACE_PAYLOAD(fce,arg,bytes) GE_GL_TRACE_RULE(fce,arg,PAYLOAD,bytes)
+#define GE_GL_TRACE_OUTPUT(fce,arg,bytes)  GE_GL_TRACE_RULE(fce,arg,OUTPUT ,bytes)
+#define GE_GL_TRACE_OFFSET(fce,arg)        GE_GL_TRACE_RULE(fce,arg,OFFSET ,0    )
+
+#define GE_GL_TRACE_STRINGS(fce,arg,countArg,lengthsArg)\
+  namespace ge{namespace gl{\
+    template<>struct TracePointerRule<TRACE_##fce,arg>{\
+      static constexpr TracePointerKind kind = TracePointerKind::STRING_ARRAY;\
+      template<typename A>static size_t count(A const&a){return (size_t)std::get<countArg>(a);}\
+      template<typename A>static GLint length(A const&a,size_t i){\
+        return std::get<lengthsArg>(a) ? std::get<lengthsArg>(a)[i] : -1;\
+      }\
+    };\
+  }}
+
+#define GE_GL_TRACE_UNIFORM(fce,components)\
+  GE_GL_TRACE_PAYLOAD(fce,2,GE_GL_TRACE_ARG(1)*(components)*4)
+#define GE_GL_TRACE_UNIFORM_MATRIX(fce,components)\
+  GE_GL_TRACE_PAYLOAD(fce,3,GE_GL_TRACE_ARG(1)*(components)*4)
+#define GE_GL_TRACE_PROGRAM_UNIFORM(fce,components)\
+  GE_GL_TRACE_PAYLOAD(fce,3,GE_GL_TRACE_ARG(2)*(components)*4)
+#define GE_GL_TRACE_PROGRAM_UNIFORM_MATRIX(fce,components)\
+  GE_GL_TRACE_PAYLOAD(fce,4,GE_GL_TRACE_ARG(2)*(components)*4)
+#define GE_GL_TRACE_NAMES(fce,countArg,arg,ruleKind)\
+  GE_GL_TRACE_RULE(fce,arg,ruleKind,GE_GL_TRACE_ARG(countArg)*sizeof(GLuint))
+
+//buffers
+GE_GL_TRACE_PAYLOAD(glBufferData        ,2,GE_GL_TRACE_ARG(1))
+GE_GL_TRACE_PAYLOAD(glBufferSubData     ,3,GE_GL_TRACE_ARG(2))
+GE_GL_TRACE_PAYLOAD(glBufferStorage     ,2,GE_GL_TRACE_ARG(1))
+GE_GL_TRACE_PAYLOAD(glNamedBufferData   ,2,GE_GL_TRACE_ARG(1))
+GE_GL_TRACE_PAYLOAD(glNamedBufferSubData,3,GE_GL_TRACE_ARG(2))
+GE_GL_TRACE_PAYLOAD(glNamedBufferStorage,2,GE_GL_TRACE_ARG(1))
+
+//uniforms
+GE_GL_TRACE_UNIFORM(glUniform1fv ,1)
+GE_GL_TRACE_UNIFORM(glUniform2fv ,2)
+GE_GL_TRACE_UNIFORM(glUniform3fv ,3)
+GE_GL_TRACE_UNIFORM(glUniform4fv ,4)
+GE_GL_TRACE_UNIFORM(glUniform1iv ,1)
+GE_GL_TRACE_UNIFORM(glUniform2iv ,2)
+GE_GL_TRACE_UNIFORM(glUniform3iv ,3)
+GE_GL_TRACE_UNIFORM(glUniform4iv ,4)
+GE_GL_TRACE_UNIFORM(glUniform1uiv,1)
+GE_GL_TRACE_UNIFORM(glUniform2uiv,2)
+GE_GL_TRACE_UNIFORM(glUniform3uiv,3)
+GE_GL_TRACE_UNIFORM(glUniform4uiv,4)
+GE_GL_TRACE_UNIFORM_MATRIX(glUniformMatrix2fv,4 )
+GE_GL_TRACE_UNIFORM_MATRIX(glUniformMatrix3fv,9 )
+GE_GL_TRACE_UNIFORM_MATRIX(glUniformMatrix4fv,16)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform1fv,1)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform2fv,2)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform3fv,3)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform4fv,4)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform1iv,1)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform2iv,2)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform3iv,3)
+GE_GL_TRACE_PROGRAM_UNIFORM(glProgramUniform4iv,4)
+GE_GL_TRACE_PROGRAM_UNIFORM_MATRIX(glProgramUniformMatrix3fv,9 )
+GE_GL_TRACE_PROGRAM_UNIFORM_MATRIX(glProgramUniformMatrix4fv,16)
+
+//object names
+GE_GL_TRACE_NAMES(glGenBuffers          ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glGenVertexArrays     ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glGenTextures         ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glGenFramebuffers     ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glGenRenderbuffers    ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glGenQueries          ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glGenSamplers         ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateBuffers       ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateVertexArrays  ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateFramebuffers  ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateRenderbuffers ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateSamplers      ,0,1,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateTextures      ,1,2,OUTPUT )
+GE_GL_TRACE_NAMES(glCreateQueries       ,1,2,OUTPUT )
+GE_GL_TRACE_NAMES(glDeleteBuffers       ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDeleteVertexArrays  ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDeleteTextures      ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDeleteFramebuffers  ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDeleteRenderbuffers ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDeleteQueries       ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDeleteSamplers      ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glDrawBuffers         ,0,1,PAYLOAD)
+GE_GL_TRACE_NAMES(glNamedFramebufferDrawBuffers,1,2,PAYLOAD)
+
+//shaders
+GE_GL_TRACE_STRINGS(glShaderSource   ,2,1,3)
+GE_GL_TRACE_STRINGS(glShaderSourceARB,2,1,3)
+
+//pixels
+GE_GL_TRACE_PAYLOAD(glTexImage2D       ,8 ,traceImageSize(state,GE_GL_TRACE_ARG(3),GE_GL_TRACE_ARG(4),1                 ,GE_GL_TRACE_ARG(6),GE_GL_TRACE_ARG(7)))
+GE_GL_TRACE_PAYLOAD(glTexImage3D       ,9 ,traceImageSize(state,GE_GL_TRACE_ARG(3),GE_GL_TRACE_ARG(4),GE_GL_TRACE_ARG(5),GE_GL_TRACE_ARG(7),GE_GL_TRACE_ARG(8)))
+GE_GL_TRACE_PAYLOAD(glTexSubImage2D    ,8 ,traceImageSize(state,GE_GL_TRACE_ARG(4),GE_GL_TRACE_ARG(5),1                 ,GE_GL_TRACE_ARG(6),GE_GL_TRACE_ARG(7)))
+GE_GL_TRACE_PAYLOAD(glTexSubImage3D    ,10,traceImageSize(state,GE_GL_TRACE_ARG(5),GE_GL_TRACE_ARG(6),GE_GL_TRACE_ARG(7),GE_GL_TRACE_ARG(8),GE_GL_TRACE_ARG(9)))
+GE_GL_TRACE_PAYLOAD(glTextureSubImage2D,8 ,traceImageSize(state,GE_GL_TRACE_ARG(4),GE_GL_TRACE_ARG(5),1                 ,GE_GL_TRACE_ARG(6),GE_GL_TRACE_ARG(7)))
+GE_GL_TRACE_PAYLOAD(glTextureSubImage3D,10,traceImageSize(state,GE_GL_TRACE_ARG(5),GE_GL_TRACE_ARG(6),GE_GL_TRACE_ARG(7),GE_GL_TRACE_ARG(8),GE_GL_TRACE_ARG(9)))
+GE_GL_TRACE_PAYLOAD(glClearBufferfv          ,2,4*sizeof(GLfloat))
+GE_GL_TRACE_PAYLOAD(glClearBufferiv          ,2,4*sizeof(GLint  ))
+GE_GL_TRACE_PAYLOAD(glClearNamedFramebufferfv,3,4*sizeof(GLfloat))
+GE_GL_TRACE_PAYLOAD(glClearNamedFramebufferiv,3,4*sizeof(GLint  ))
+
+//offsets into bound buffers
+GE_GL_TRACE_OFFSET(glDrawElements                               ,3)
+GE_GL_TRACE_OFFSET(glDrawElementsBaseVertex                     ,3)
+GE_GL_TRACE_OFFSET(glDrawElementsInstanced                      ,3)
+GE_GL_TRACE_OFFSET(glDrawElementsInstancedBaseVertex            ,3)
+GE_GL_TRACE_OFFSET(glDrawElementsInstancedBaseInstance          ,3)
+GE_GL_TRACE_OFFSET(glDrawElementsInstancedBaseVertexBaseInstance,3)
+GE_GL_TRACE_OFFSET(glDrawRangeElements                          ,5)
+GE_GL_TRACE_OFFSET(glDrawArraysIndirect                         ,1)
+GE_GL_TRACE_OFFSET(glDrawElementsIndirect                       ,2)
+GE_GL_TRACE_OFFSET(glMultiDrawArraysIndirect                    ,1)
+GE_GL_TRACE_OFFSET(glMultiDrawElementsIndirect                  ,2)
+GE_GL_TRACE_OFFSET(glMultiDrawArraysIndirectCount               ,1)
+GE_GL_TRACE_OFFSET(glMultiDrawElementsIndirectCount             ,2)
+GE_GL_TRACE_OFFSET(glVertexAttribPointer                        ,5)
+GE_GL_TRACE_OFFSET(glVertexAttribIPointer                       ,4)
+
+#define GE_GL_TRACE_KEEP(fce)\
+  namespace ge{namespace gl{\
+    template<>struct TracePersistentRule<TRACE_##fce>{\
+      static constexpr TracePersistence kind = TracePersistence::KEEP;\
+    };\
+  }}
+
+#define GE_GL_TRACE_KEEP_LATEST(fce,group,object,first,second)\
+  namespace ge{namespace gl{\
+    template<>struct TracePersistentRule<TRACE_##fce>{\
+      static constexpr TracePersistence kind = TracePersistence::LATEST;\
+      template<typename A>static TracePersistentKey key(A const&a){\
+        return TracePersistentKey(group,(GLuint)(object),(int64_t)(first),(int64_t)(second));\
+      }\
+    };\
+  }}
+
+#define GE_GL_TRACE_KEEP_DELETE(fce,group,count,names)\
+  namespace ge{namespace gl{\
+    template<>struct TracePersistentRule<TRACE_##fce>{\
+      static constexpr TracePersistence kind = TracePersistence::DELETE;\
+      static constexpr int forgetGroup = group;\
+      template<typename A>static std::vector<GLuint>forget(A const&a){\
+        GLuint const*n = (names);\
+        return n ? std::vector<GLuint>(n,n+(count)) : std::vector<GLuint>();\
+      }\
+    };\
+  }}
+
+#define GE_GL_TRACE_KEEP_UNIFORM(fce)\
+  GE_GL_TRACE_KEEP_LATEST(fce,TRACE_KEY_PROGRAM,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1),0)
+
+//objects
+GE_GL_TRACE_KEEP(glGenBuffers         )
+GE_GL_TRACE_KEEP(glGenVertexArrays    )
+GE_GL_TRACE_KEEP(glGenTextures        )
+GE_GL_TRACE_KEEP(glGenFramebuffers    )
+GE_GL_TRACE_KEEP(glGenRenderbuffers   )
+GE_GL_TRACE_KEEP(glGenQueries         )
+GE_GL_TRACE_KEEP(glGenSamplers        )
+GE_GL_TRACE_KEEP(glCreateBuffers      )
+GE_GL_TRACE_KEEP(glCreateVertexArrays )
+GE_GL_TRACE_KEEP(glCreateFramebuffers )
+GE_GL_TRACE_KEEP(glCreateRenderbuffers)
+GE_GL_TRACE_KEEP(glCreateSamplers     )
+GE_GL_TRACE_KEEP(glCreateTextures     )
+GE_GL_TRACE_KEEP(glCreateQueries      )
+GE_GL_TRACE_KEEP(glTextureView        )
+GE_GL_TRACE_KEEP_DELETE(glDeleteBuffers      ,TRACE_KEY_BUFFER ,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1))
+GE_GL_TRACE_KEEP_DELETE(glDeleteTextures     ,TRACE_KEY_TEXTURE,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1))
+GE_GL_TRACE_KEEP(glDeleteVertexArrays )
+GE_GL_TRACE_KEEP(glDeleteFramebuffers )
+GE_GL_TRACE_KEEP(glDeleteRenderbuffers)
+GE_GL_TRACE_KEEP(glDeleteQueries      )
+GE_GL_TRACE_KEEP(glDeleteSamplers     )
+
+//storage and uploads
+GE_GL_TRACE_KEEP(glNamedBufferData   )
+GE_GL_TRACE_KEEP(glNamedBufferStorage)
+GE_GL_TRACE_KEEP_LATEST(glNamedBufferSubData,TRACE_KEY_BUFFER,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1),GE_GL_TRACE_ARG(2))
+GE_GL_TRACE_KEEP(glTextureStorage2D  )
+GE_GL_TRACE_KEEP(glTextureStorage3D  )
+GE_GL_TRACE_KEEP(glTextureSubImage2D )
+GE_GL_TRACE_KEEP(glTextureSubImage3D )
+GE_GL_TRACE_KEEP(glGenerateTextureMipmap)
+GE_GL_TRACE_KEEP_LATEST(glTextureParameteri ,TRACE_KEY_TEXTURE,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1),0)
+GE_GL_TRACE_KEEP_LATEST(glTextureParameterf ,TRACE_KEY_TEXTURE,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1),0)
+GE_GL_TRACE_KEEP_LATEST(glTextureParameterfv,TRACE_KEY_TEXTURE,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1),0)
+GE_GL_TRACE_KEEP_LATEST(glTextureParameteriv,TRACE_KEY_TEXTURE,GE_GL_TRACE_ARG(0),GE_GL_TRACE_ARG(1),0)
+GE_GL_TRACE_KEEP(glSamplerParameteri)
+GE_GL_TRACE_KEEP(glSamplerParameterf)
+
+//framebuffers and vertex arrays
+GE_GL_TRACE_KEEP(glNamedFramebufferTexture     )
+GE_GL_TRACE_KEEP(glNamedFramebufferTextureLayer)
+GE_GL_TRACE_KEEP(glNamedFramebufferRenderbuffer)
+GE_GL_TRACE_KEEP(glNamedFramebufferDrawBuffer  )
+GE_GL_TRACE_KEEP(glNamedFramebufferDrawBuffers )
+GE_GL_TRACE_KEEP(glNamedFramebufferReadBuffer  )
+GE_GL_TRACE_KEEP(glNamedRenderbufferStorage    )
+GE_GL_TRACE_KEEP(glVertexArrayVertexBuffer     )
+GE_GL_TRACE_KEEP(glVertexArrayElementBuffer    )
+GE_GL_TRACE_KEEP(glVertexArrayAttribFormat     )
+GE_GL_TRACE_KEEP(glVertexArrayAttribIFormat    )
+GE_GL_TRACE_KEEP(glVertexArrayAttribBinding    )
+GE_GL_TRACE_KEEP(glEnableVertexArrayAttrib     )
+
+//shaders and programs
+GE_GL_TRACE_KEEP(glCreateShader    )
+GE_GL_TRACE_KEEP(glShaderSource    )
+GE_GL_TRACE_KEEP(glCompileShader   )
+GE_GL_TRACE_KEEP(glDeleteShader    )
+GE_GL_TRACE_KEEP(glCreateProgram   )
+GE_GL_TRACE_KEEP(glAttachShader    )
+GE_GL_TRACE_KEEP(glDetachShader    )
+GE_GL_TRACE_KEEP(glProgramParameteri)
+GE_GL_TRACE_KEEP(glLinkProgram     )
+GE_GL_TRACE_KEEP_DELETE(glDeleteProgram,TRACE_KEY_PROGRAM,1,&GE_GL_TRACE_ARG(0))
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform1i )
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform1ui)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform1f )
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform2f )
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform3f )
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform4f )
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform2i )
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform1fv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform2fv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform3fv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform4fv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform1iv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform2iv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform3iv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniform4iv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniformMatrix3fv)
+GE_GL_TRACE_KEEP_UNIFORM(glProgramUniformMatrix4fv)
+
+namespace ge{
+  namespace gl{
+    template<size_t F,size_t I,typename V>
+      struct TraceResolvedKind{
+        using Pointee = typename std::remove_pointer<V>::type;
+        static constexpr TracePointerKind rule = TracePointerRule<F,I>::kind;
+        static constexpr TracePointerKind value =
+          rule != TracePointerKind::DEFAULT                                  ? rule                      :
+          std::is_function<Pointee>::value                                   ? TracePointerKind::NONE    :
+          std::is_same<typename std::remove_cv<Pointee>::type,GLchar>::value ?
+            (std::is_const<Pointee>::value ? TracePointerKind::STRING : TracePointerKind::SCRATCH)      :
+          !std::is_const<Pointee>::value                                     ? TracePointerKind::SCRATCH :
+                                                                               TracePointerKind::NONE    ;
+      };
+
+    /**
+     * @brief This decorator counts OpenGL calls per entry point and frame
+     * and records them (arguments and data behind pointers) into binary trace
+     * that can be replayed by TracePlayer.
+     * Level and recordSetup have to be set before construct() is called,
+     * frameBoundary() has to be called once per frame (before swap).
+     *
+     * Data behind pointers are recorded only for functions with TracePointerRule
+     * (buffers, uniforms, textures, shader sources, names), other const pointers are replayed as nullptr.
+     * Mapped buffers and pixel unpack buffers are not supported.
+     *
+     * Calls of the frames before the dumped one that create, fill or delete objects
+     * (TracePersistentRule: DSA uploads, textures, shaders, programs, ...) are kept
+     * and replayed after the setup calls, so that objects created after the first
+     * frame exist during replay. Per frame uploads keep only the latest call with the
+     * same key. Contents rendered by the GPU in earlier frames are not kept.
+     */
+    template<typename T>
+      class TraceTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            TraceTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~TraceTableDecorator(){}
+          TraceLevel traceLevel         = TraceLevel::OFF;
+          bool       recordSetup        = true;///< record calls before the first frame (resource creation needed for replay)
+          size_t     maxRecordedFrames  = 4   ;///< size of ring buffer of frames
+          /**
+           * @brief This function ends frame: statistics of the frame are stored
+           * and the recorded frame is moved into ring buffer.
+           */
+          void frameBoundary(){
+            std::swap(this->m_lastFrameCounts,this->m_callCounts);
+            std::fill(this->m_callCounts.begin(),this->m_callCounts.end(),0);
+            if(!this->m_recording)return;
+            if(this->m_out == &this->m_setup){
+              this->m_out = &this->m_current;
+              return;
+            }
+            this->m_flushPersistent();
+            //calls of the previous frame are replayed before the new last frame
+            this->m_keep(this->m_lastFramePersistent);
+            if(this->m_partialFrame){
+              //the partial frame is never dumped, frames before it miss the calls made while not recording
+              this->m_keep(this->m_framePersistent);
+              this->m_frames.clear();
+            }else{
+              this->m_lastFramePersistent = std::move(this->m_framePersistent);
+              this->m_frames.push_back(std::move(this->m_current));
+            }
+            this->m_framePersistent.clear();
+            this->m_partialFrame = false;
+            this->m_current.clear();
+            while(this->m_frames.size() > this->maxRecordedFrames)this->m_frames.pop_front();
+          }
+          /**
+           * @brief This function starts recording of frames into ring buffer
+           * (recording starts automatically at RECORD level)
+           */
+          void startRecording(){
+            if(this->traceLevel == TraceLevel::OFF)return;
+            //the first frame starts at the next frameBoundary, calls before it are dropped
+            this->m_recording    = true;
+            this->m_partialFrame = true;
+          }
+          void stopRecording(){
+            this->m_recording = false;
+          }
+          bool isRecording()const{return this->m_recording;}
+          /**
+           * @brief This function returns number of calls per entry point in the last frame
+           *
+           * @return pairs of function name and number of calls, sorted by number of calls
+           */
+          std::vector<std::pair<char const*,uint32_t>>getLastFrameStatistics()const{
+            std::vector<std::pair<char const*,uint32_t>>result;
+            for(size_t i=0;i<this->m_lastFrameCounts.size();++i)
+              if(this->m_lastFrameCounts[i])result.emplace_back(getTraceFunctionName(i),this->m_lastFrameCounts[i]);
+            std::sort(result.begin(),result.end(),[](std::pair<char const*,uint32_t>const&a,std::pair<char const*,uint32_t>const&b){return a.second>b.second;});
+            return result;
+          }
+          /**
+           * @brief This function returns number of calls in the last frame
+           *
+           * @return number of calls
+           */
+          size_t getLastFrameNumberOfCalls()const{
+            size_t result = 0;
+            for(auto const&c:this->m_lastFrameCounts)result += c;
+            return result;
+          }
+          /**
+           * @brief This function writes setup calls, calls that created or filled objects
+           * in the frames before the last one and the last complete recorded frame into file
+           *
+           * @param file name of file
+           *
+           * @return false if there is no recorded frame or the file cannot be written
+           */
+          bool dumpLastFrame(std::string const&file)const{
+            if(this->m_frames.empty())return false;
+            std::ofstream f(file,std::ios::binary);
+            if(!f.is_open())return false;
+            auto write = [&](void const*d,size_t n){f.write((char const*)d,(std::streamsize)n);};
+            write(traceMagic,sizeof(traceMagic));
+            uint32_t nofNames = 0;
+            for(auto const&u:this->m_used)nofNames += u;
+            write(&nofNames,sizeof(nofNames));
+            for(uint32_t i=0;i<(uint32_t)this->m_used.size();++i){
+              if(!this->m_used[i])continue;
+              char const*name = getTraceFunctionName(i);
+              uint32_t const length = (uint32_t)std::strlen(name);
+              write(&i     ,sizeof(i     ));
+              write(&length,sizeof(length));
+              write(name,length);
+            }
+            uint64_t setupSize = this->m_setup.size();
+            for(auto const&c:this->m_persistent)setupSize += c.size();
+            write(&setupSize,sizeof(setupSize));
+            write(this->m_setup.data(),this->m_setup.size());
+            for(auto const&c:this->m_persistent)write(c.data(),c.size());
+            uint64_t const frameSize = this->m_frames.back().size();
+            write(&frameSize,sizeof(frameSize));
+            write(this->m_frames.back().data(),this->m_frames.back().size());
+            return f.good();
+          }
+        protected:
+          /**
+           * @brief Call of a frame kept for the replay of later frames
+           */
+          struct PersistentCall{
+            std::vector<uint8_t>data        ;
+            bool                latest = false;
+            TracePersistentKey  key         ;
+            int                 forgetGroup = -1;
+            std::vector<GLuint> forget      ;///<deleted objects, their keys are forgotten
+          };
+          mutable std::vector<uint32_t>    m_callCounts      = std::vector<uint32_t>(GE_GL_NOF_OPENGL_FUNCTIONS,0    );
+          std::vector<uint32_t>            m_lastFrameCounts = std::vector<uint32_t>(GE_GL_NOF_OPENGL_FUNCTIONS,0    );
+          mutable std::vector<bool>        m_used            = std::vector<bool    >(GE_GL_NOF_OPENGL_FUNCTIONS,false);
+          bool                             m_recording       = false     ;
+          bool                             m_partialFrame    = false     ;
+          mutable TraceState               m_state                       ;
+          std::vector<uint8_t>             m_setup                       ;
+          std::vector<uint8_t>             m_current                     ;
+          std::deque<std::vector<uint8_t>> m_frames                      ;
+          std::vector<uint8_t>*            m_out             = &m_current;
+          std::vector<std::vector<uint8_t>>           m_persistent         ;///<kept calls of frames before the last one
+          std::map<TracePersistentKey,size_t>         m_persistentKeys     ;///<key -> index into m_persistent
+          mutable std::vector<PersistentCall>         m_framePersistent    ;///<kept calls of the frame being recorded
+          std::vector<PersistentCall>                 m_lastFramePersistent;///<kept calls of the last frame
+          mutable PersistentCall                      m_pending            ;///<kept call being recorded (outputs and result follow)
+          mutable size_t                              m_pendingStart = SIZE_MAX;
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            if(this->traceLevel == TraceLevel::OFF)return true;
+            if(this->traceLevel == TraceLevel::RECORD){
+              this->m_recording = true;
+              if(this->recordSetup)this->m_out = &this->m_setup;
+            }
+#include<geGL/Generated/TraceCalls.h>
+            return true;
+          }
+
+          template<typename V>
+            void m_write(V const&v)const{
+              this->m_writeBytes(&v,sizeof(V));
+            }
+          void m_writeBytes(void const*data,size_t size)const{
+            if(!size)return;
+            auto const d = static_cast<uint8_t const*>(data);
+            this->m_out->insert(this->m_out->end(),d,d+size);
+          }
+
+          void m_flushPersistent()const{
+            if(this->m_pendingStart == SIZE_MAX)return;
+            this->m_pending.data.assign(this->m_current.begin()+(std::ptrdiff_t)this->m_pendingStart,this->m_current.end());
+            this->m_framePersistent.push_back(std::move(this->m_pending));
+            this->m_pending      = PersistentCall();
+            this->m_pendingStart = SIZE_MAX;
+          }
+          void m_keep(std::vector<PersistentCall>&calls){
+            for(auto&c:calls){
+              if(c.forgetGroup >= 0)
+                for(auto it = this->m_persistentKeys.begin();it != this->m_persistentKeys.end();){
+                  if(std::get<0>(it->first) == c.forgetGroup &&
+                     std::find(c.forget.begin(),c.forget.end(),std::get<1>(it->first)) != c.forget.end())
+                    it = this->m_persistentKeys.erase(it);
+                  else ++it;
+                }
+              if(c.latest){
+                auto const it = this->m_persistentKeys.find(c.key);
+                if(it != this->m_persistentKeys.end()){
+                  this->m_persistent[it->second] = std::move(c.data);
+                  continue;
+                }
+                this->m_persistentKeys[c.key] = this->m_persistent.size();
+              }
+              this->m_persistent.push_back(std::move(c.data));
+            }
+            calls.clear();
+          }
+          template<size_t F,typename A>
+            void m_markPersistent(A const&,std::integral_constant<TracePersistence,TracePersistence::NONE>)const{}
+          template<size_t F,typename A>
+            void m_markPersistent(A const&,std::integral_constant<TracePersistence,TracePersistence::KEEP>)const{
+              this->m_pendingStart = this->m_current.size();
+            }
+          template<size_t F,typename A>
+            void m_markPersistent(A const&a,std::integral_constant<TracePersistence,TracePersistence::LATEST>)const{
+              this->m_pendingStart   = this->m_current.size();
+              this->m_pending.latest = true;
+              this->m_pending.key    = TracePersistentRule<F>::key(a);
+            }
+          template<size_t F,typename A>
+            void m_markPersistent(A const&a,std::integral_constant<TracePersistence,TracePersistence::DELETE>)const{
+              this->m_pendingStart        = this->m_current.size();
+              this->m_pending.forgetGroup = TracePersistentRule<F>::forgetGroup;
+              this->m_pending.forget      = TracePersistentRule<F>::forget(a);
+            }
+
+          template<size_t F,typename A>
+            void m_beginRecord(A const&a)const{
+              this->m_flushPersistent();
+              if(this->m_out == &this->m_current)
+                this->template m_markPersistent<F>(a,std::integral_constant<TracePersistence,TracePersistentRule<F>::kind>{});
+              this->m_used[F] = true;
+              this->m_write(uint32_t(F));
+              this->template m_writeArgs<F>(a,std::make_index_sequence<std::tuple_size<A>::value>{});
+              this->m_observe(std::integral_constant<size_t,F>{},a);
+            }
+          template<size_t F,typename A>
+            void m_endRecord(A const&a)const{
+              this->template m_writeOutputs<F>(a,std::make_index_sequence<std::tuple_size<A>::value>{});
+            }
+          template<size_t F,typename A,size_t...I>
+            void m_writeArgs(A const&a,std::index_sequence<I...>)const{
+              int dummy[] = {0,(this->template m_writeArg<F,I>(std::get<I>(a),a),0)...};
+              (void)dummy;
+            }
+          template<size_t F,typename A,size_t...I>
+            void m_writeOutputs(A const&a,std::index_sequence<I...>)const{
+              int dummy[] = {0,(this->template m_writeOutput<F,I>(std::get<I>(a),a),0)...};
+              (void)dummy;
+            }
+
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeArg(V const&v,A const&a)const{
+              this->template m_writeArg<F,I>(v,a,std::integral_constant<bool,std::is_pointer<V>::value && !std::is_same<V,GLsync>::value>{});
+            }
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeArg(V const&v,A const&,std::false_type)const{
+              this->m_writeScalar(v);
+            }
+          template<typename V>
+            void m_writeScalar(V const&v)const{this->m_write(v);}
+          void m_writeScalar(GLsync const&v)const{this->m_write(uint64_t(reinterpret_cast<uintptr_t>(v)));}
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeArg(V const&v,A const&a,std::true_type)const{
+              constexpr TracePointerKind kind = TraceResolvedKind<F,I,V>::value;
+              this->m_write(uint8_t(kind));
+              this->m_write(uint64_t(reinterpret_cast<uintptr_t>(v)));
+              this->template m_writePointer<F,I>(v,a,std::integral_constant<TracePointerKind,kind>{});
+            }
+          template<size_t F,size_t I,typename V,typename A,TracePointerKind K>
+            void m_writePointer(V const&,A const&,std::integral_constant<TracePointerKind,K>)const{}
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writePointer(V const&v,A const&a,std::integral_constant<TracePointerKind,TracePointerKind::PAYLOAD>)const{
+              uint64_t const size = v ? TracePointerRule<F,I>::size(this->m_state,a) : 0;
+              this->m_write(size);
+              this->m_writeBytes((void const*)v,size);
+            }
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writePointer(V const&v,A const&a,std::integral_constant<TracePointerKind,TracePointerKind::OUTPUT>)const{
+              uint64_t const size = v ? TracePointerRule<F,I>::size(this->m_state,a) : 0;
+              this->m_write(size);
+            }
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writePointer(V const&v,A const&,std::integral_constant<TracePointerKind,TracePointerKind::STRING>)const{
+              uint64_t const size = v ? std::strlen((char const*)v)+1 : 0;
+              this->m_write(size);
+              this->m_writeBytes((void const*)v,size);
+            }
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writePointer(V const&v,A const&a,std::integral_constant<TracePointerKind,TracePointerKind::STRING_ARRAY>)const{
+              uint32_t const count = v ? (uint32_t)TracePointerRule<F,I>::count(a) : 0;
+              this->m_write(count);
+              for(uint32_t i=0;i<count;++i){
+                char const*s      = v[i];
+                GLint const length = TracePointerRule<F,I>::length(a,i);
+                uint64_t const size = length < 0 ? std::strlen(s) : (size_t)length;
+                this->m_write(uint64_t(size+1));
+                this->m_writeBytes(s,size);
+                this->m_write(char(0));
+              }
+            }
+
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeOutput(V const&v,A const&a)const{
+              this->template m_writeOutput<F,I>(v,a,std::integral_constant<bool,std::is_pointer<V>::value && !std::is_same<V,GLsync>::value>{});
+            }
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeOutput(V const&,A const&,std::false_type)const{}
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeOutput(V const&v,A const&a,std::true_type)const{
+              this->template m_writeOutputData<F,I>(v,a,std::integral_constant<bool,TraceResolvedKind<F,I,V>::value == TracePointerKind::OUTPUT>{});
+            }
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeOutputData(V const&,A const&,std::false_type)const{}
+          template<size_t F,size_t I,typename V,typename A>
+            void m_writeOutputData(V const&v,A const&a,std::true_type)const{
+              if(!v)return;
+              this->m_writeBytes((void const*)v,TracePointerRule<F,I>::size(this->m_state,a));
+            }
+
+          template<typename R>
+            void m_writeResult(R const&r)const{
+              this->m_writeResult(r,std::integral_constant<bool,std::is_pointer<R>::value>{});
+            }
+          template<typename R>
+            void m_writeResult(R const&r,std::false_type)const{this->m_write(r);}
+          template<typename R>
+            void m_writeResult(R const&r,std::true_type)const{this->m_write(uint64_t(reinterpret_cast<uintptr_t>(r)));}
+
+          template<size_t F,typename A>
+            void m_observe(std::integral_constant<size_t,F>,A const&)const{}
+          template<typename A>
+            void m_observe(std::integral_constant<size_t,TRACE_glPixelStorei>,A const&a)const{
+              if(std::get<0>(a) == GL_UNPACK_ALIGNMENT)this->m_state.unpackAlignment = std::get<1>(a);
+            }
+
+#include<geGL/Generated/TraceImplementation.h>
+      };
+
+  }
+}
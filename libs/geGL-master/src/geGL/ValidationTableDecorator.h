@@ -0,0 +1,109 @@
+#pragma once
+
+#include<functional>
+#include<iostream>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/OpenGLUtil.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Amount of validation done by ValidationTableDecorator
+     */
+    enum class ValidationLevel{
+      OFF           ,///< nothing is installed, the table calls OpenGL directly
+      DEBUG_CALLBACK,///< asynchronous GL_DEBUG_OUTPUT callback, no queries on the hot path
+      PER_CALL      ,///< synchronous debug output + glGetError after every call
+    };
+
+    /**
+     * @brief This decorator validates OpenGL calls.
+     * The level has to be selected before construct() is called.
+     * At PER_CALL level every function is wrapped and glGetError is checked after it,
+     * errors are reported with the call site set by ge::gl::setCallSite
+     * (include geGL/Generated/ValidationCallSites.h after all geGL headers to annotate calls automatically).
+     */
+    template<typename T>
+      class ValidationTableDecorator: public T{
+        public:
+          using ErrorCallback = std::function<void(char const*fceName,GLenum error,CallSite const&site)>;
+          template<typename...ARGS>
+            ValidationTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~ValidationTableDecorator(){}
+          ValidationLevel validationLevel = ValidationLevel::OFF;
+          /**
+           * @brief This function replaces default error report (std::cerr)
+           *
+           * @param callback function that is called for every error
+           */
+          void setErrorCallback(ErrorCallback const&callback){this->m_errorCallback = callback;}
+          /**
+           * @brief This function returns number of reported errors and debug messages
+           *
+           * @return number of errors
+           */
+          size_t getNumberOfErrors()const{return this->m_numberOfErrors;}
+        protected:
+          ErrorCallback  m_errorCallback  = nullptr;
+          mutable size_t m_numberOfErrors = 0;
+          FunctionTable::MEMBERPFNGLGETERRORPROC m_orig_glGetError = nullptr;
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            if(this->validationLevel == ValidationLevel::OFF)return true;
+            this->m_setDebugOutput();
+            if(this->validationLevel != ValidationLevel::PER_CALL)return true;
+            this->m_orig_glGetError = this->m_ptr_glGetError;
+#include<geGL/Generated/ValidationCalls.h>
+            return true;
+          }
+          void m_setDebugOutput(){
+            if(!this->m_ptr_glDebugMessageCallback)return;
+            this->glEnable(GL_DEBUG_OUTPUT);
+            //synchronous output reports the message inside the offending call (and its call site)
+            if(this->validationLevel == ValidationLevel::PER_CALL)this->glEnable (GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            else                                                  this->glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            this->glDebugMessageCallback((GLDEBUGPROC)&ValidationTableDecorator::m_debugMessage,this);
+          }
+          static void m_debugMessage(
+              GLenum        source   ,
+              GLenum        type     ,
+              GLuint        /*id*/   ,
+              GLenum        severity ,
+              GLsizei       /*length*/,
+              const GLchar *message  ,
+              const void   *userParam){
+            if(severity==GL_DEBUG_SEVERITY_NOTIFICATION)return;
+            auto const self = static_cast<ValidationTableDecorator const*>(userParam);
+            //errors are reported by m_checkErrors together with function name
+            if(self->validationLevel == ValidationLevel::PER_CALL && type == GL_DEBUG_TYPE_ERROR)return;
+            self->m_numberOfErrors++;
+            std::cerr<<
+              "source: "   <<translateDebugSource  (source  )<<
+              " type: "    <<translateDebugType    (type    )<<
+              " severity: "<<translateDebugSeverity(severity)<<
+              " : "        <<message;
+            if(self->validationLevel == ValidationLevel::PER_CALL && getCallSite().file)
+              std::cerr<<" ("<<getCallSite().file<<":"<<getCallSite().line<<")";
+            std::cerr<<std::endl;
+          }
+          void m_checkErrors(char const*fceName)const{
+            //glGetError returns one error flag per call, a lost context can return errors forever
+            for(int i=0;i<8;++i){
+              GLenum const error = (this->*(this->m_orig_glGetError))();
+              if(error == GL_NO_ERROR)return;
+              this->m_numberOfErrors++;
+              if(this->m_errorCallback){
+                this->m_errorCallback(fceName,error,getCallSite());
+                continue;
+              }
+              std::cerr<<"ERROR: "<<fceName<<": "<<translateError(error);
+              if(getCallSite().file)std::cerr<<" ("<<getCallSite().file<<":"<<getCallSite().line<<")";
+              std::cerr<<std::endl;
+            }
+          }
+#include<geGL/Generated/ValidationImplementation.h>
+      };
+
+  }
+}
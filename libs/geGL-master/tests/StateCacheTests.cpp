@@ -0,0 +1,196 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/StateCacheTableDecorator.h>
+
+using namespace ge::gl;
+using namespace std;
+
+//function table that only counts calls that reach "OpenGL"
+class CountingTable: public FunctionTable{
+  public:
+    mutable size_t useProgram        = 0;
+    mutable size_t bindVertexArray   = 0;
+    mutable size_t bindBuffer        = 0;
+    mutable size_t enable            = 0;
+    mutable size_t depthMask         = 0;
+    mutable size_t bindTextureUnit   = 0;
+    mutable size_t viewport          = 0;
+    mutable size_t bindSampler       = 0;
+    mutable size_t bindBufferBase    = 0;
+    mutable size_t blendFunc         = 0;
+    mutable size_t blendEquation     = 0;
+    mutable size_t colorMask         = 0;
+  protected:
+    virtual bool m_init()override{
+      this->m_ptr_glUseProgram      = (decltype(this->m_ptr_glUseProgram     ))&CountingTable::m_useProgram     ;
+      this->m_ptr_glBindVertexArray = (decltype(this->m_ptr_glBindVertexArray))&CountingTable::m_bindVertexArray;
+      this->m_ptr_glBindBuffer      = (decltype(this->m_ptr_glBindBuffer     ))&CountingTable::m_bindBuffer     ;
+      this->m_ptr_glEnable          = (decltype(this->m_ptr_glEnable         ))&CountingTable::m_enable         ;
+      this->m_ptr_glDisable         = (decltype(this->m_ptr_glDisable        ))&CountingTable::m_enable         ;
+      this->m_ptr_glDepthMask       = (decltype(this->m_ptr_glDepthMask      ))&CountingTable::m_depthMask      ;
+      this->m_ptr_glBindTextureUnit = (decltype(this->m_ptr_glBindTextureUnit))&CountingTable::m_bindTextureUnit;
+      this->m_ptr_glDeleteProgram   = (decltype(this->m_ptr_glDeleteProgram  ))&CountingTable::m_deleteProgram  ;
+      this->m_ptr_glViewport        = (decltype(this->m_ptr_glViewport       ))&CountingTable::m_viewport       ;
+      this->m_ptr_glViewportIndexedf= (decltype(this->m_ptr_glViewportIndexedf))&CountingTable::m_viewportIndexedf;
+      this->m_ptr_glVertexArrayElementBuffer = (decltype(this->m_ptr_glVertexArrayElementBuffer))&CountingTable::m_vertexArrayElementBuffer;
+      this->m_ptr_glBindSampler     = (decltype(this->m_ptr_glBindSampler    ))&CountingTable::m_bindSampler    ;
+      this->m_ptr_glBindSamplers    = (decltype(this->m_ptr_glBindSamplers   ))&CountingTable::m_bindSamplers   ;
+      this->m_ptr_glBindBufferBase  = (decltype(this->m_ptr_glBindBufferBase ))&CountingTable::m_bindBufferBase ;
+      this->m_ptr_glBindBuffersRange= (decltype(this->m_ptr_glBindBuffersRange))&CountingTable::m_bindBuffersRange;
+      this->m_ptr_glBlendFunc       = (decltype(this->m_ptr_glBlendFunc      ))&CountingTable::m_blendFunc      ;
+      this->m_ptr_glBlendFunci      = (decltype(this->m_ptr_glBlendFunci     ))&CountingTable::m_blendFunci     ;
+      this->m_ptr_glBlendFuncSeparatei = (decltype(this->m_ptr_glBlendFuncSeparatei))&CountingTable::m_blendFuncSeparatei;
+      this->m_ptr_glBlendEquation   = (decltype(this->m_ptr_glBlendEquation  ))&CountingTable::m_blendEquation  ;
+      this->m_ptr_glBlendEquationi  = (decltype(this->m_ptr_glBlendEquationi ))&CountingTable::m_blendEquationi ;
+      this->m_ptr_glBlendEquationSeparatei = (decltype(this->m_ptr_glBlendEquationSeparatei))&CountingTable::m_blendEquationSeparatei;
+      this->m_ptr_glColorMask       = (decltype(this->m_ptr_glColorMask      ))&CountingTable::m_colorMask      ;
+      this->m_ptr_glColorMaski      = (decltype(this->m_ptr_glColorMaski     ))&CountingTable::m_colorMaski     ;
+      return true;
+    }
+    void m_useProgram     (GLuint              )const{useProgram     ++;}
+    void m_bindVertexArray(GLuint              )const{bindVertexArray++;}
+    void m_bindBuffer     (GLenum,GLuint       )const{bindBuffer     ++;}
+    void m_enable         (GLenum              )const{enable         ++;}
+    void m_depthMask      (GLboolean           )const{depthMask      ++;}
+    void m_bindTextureUnit(GLuint,GLuint       )const{bindTextureUnit++;}
+    void m_deleteProgram  (GLuint              )const{}
+    void m_viewport       (GLint,GLint,GLsizei,GLsizei)const{viewport++;}
+    void m_viewportIndexedf(GLuint,GLfloat,GLfloat,GLfloat,GLfloat)const{}
+    void m_vertexArrayElementBuffer(GLuint,GLuint)const{}
+    void m_bindSampler    (GLuint,GLuint       )const{bindSampler    ++;}
+    void m_bindSamplers   (GLuint,GLsizei,const GLuint*)const{}
+    void m_bindBufferBase (GLenum,GLuint,GLuint)const{bindBufferBase ++;}
+    void m_bindBuffersRange(GLenum,GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizeiptr*)const{}
+    void m_blendFunc      (GLenum,GLenum       )const{blendFunc      ++;}
+    void m_blendFunci     (GLuint,GLenum,GLenum)const{}
+    void m_blendFuncSeparatei(GLuint,GLenum,GLenum,GLenum,GLenum)const{}
+    void m_blendEquation  (GLenum              )const{blendEquation  ++;}
+    void m_blendEquationi (GLuint,GLenum       )const{}
+    void m_blendEquationSeparatei(GLuint,GLenum,GLenum)const{}
+    void m_colorMask      (GLboolean,GLboolean,GLboolean,GLboolean)const{colorMask++;}
+    void m_colorMaski     (GLuint,GLboolean,GLboolean,GLboolean,GLboolean)const{}
+};
+
+TEST_CASE("State cache drops redundant calls"){
+  auto table = make_shared<StateCacheTableDecorator<CountingTable>>();
+  table->construct();
+
+  table->glUseProgram(1);
+  table->glUseProgram(1);
+  table->glUseProgram(2);
+  REQUIRE(table->useProgram == 2);
+
+  table->glEnable (GL_DEPTH_TEST);
+  table->glEnable (GL_DEPTH_TEST);
+  table->glDisable(GL_DEPTH_TEST);
+  table->glDisable(GL_DEPTH_TEST);
+  REQUIRE(table->enable == 2);
+
+  table->glDepthMask(GL_TRUE);
+  table->glDepthMask(GL_TRUE);
+  REQUIRE(table->depthMask == 1);
+
+  table->glBindTextureUnit(0,5);
+  table->glBindTextureUnit(0,5);
+  table->glBindTextureUnit(1,5);
+  REQUIRE(table->bindTextureUnit == 2);
+
+  REQUIRE(table->getNumberOfRemovedCalls  () == 5);
+  REQUIRE(table->getNumberOfForwardedCalls() == 7);
+}
+
+TEST_CASE("State cache follows VAO owned and deleted state"){
+  auto table = make_shared<StateCacheTableDecorator<CountingTable>>();
+  table->construct();
+
+  table->glBindVertexArray(1);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+  REQUIRE(table->bindBuffer == 1);
+
+  //element buffer binding belongs to the VAO
+  table->glBindVertexArray(2);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+  REQUIRE(table->bindBuffer == 2);
+
+  //ids of deleted objects can be reused
+  table->glUseProgram(4);
+  table->glDeleteProgram(4);
+  table->glUseProgram(4);
+  REQUIRE(table->useProgram == 2);
+
+  table->invalidateStateCache();
+  table->glBindVertexArray(2);
+  REQUIRE(table->bindVertexArray == 3);
+}
+
+TEST_CASE("State cache forgets state changed by indexed and DSA calls"){
+  auto table = make_shared<StateCacheTableDecorator<CountingTable>>();
+  table->construct();
+
+  table->glViewport(0,0,800,600);
+  table->glViewport(0,0,800,600);
+  REQUIRE(table->viewport == 1);
+
+  //viewport 0 changed by the indexed call, the same glViewport has to get through
+  table->glViewportIndexedf(0,0.f,0.f,1024.f,1024.f);
+  table->glViewport(0,0,800,600);
+  REQUIRE(table->viewport == 2);
+
+  //other viewports do not touch the cached one
+  table->glViewportIndexedf(1,0.f,0.f,1024.f,1024.f);
+  table->glViewport(0,0,800,600);
+  REQUIRE(table->viewport == 2);
+
+  //element buffer of the bound VAO replaced through DSA
+  table->glBindVertexArray(1);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+  table->glVertexArrayElementBuffer(1,4);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,3);
+  REQUIRE(table->bindBuffer == 2);
+}
+
+TEST_CASE("State cache follows multi-bind and per draw buffer calls"){
+  auto table = make_shared<StateCacheTableDecorator<CountingTable>>();
+  table->construct();
+
+  //glBindSamplers sets the units it covers
+  table->glBindSampler(2,7);
+  GLuint const samplers[] = {8,9};
+  table->glBindSamplers(2,2,samplers);
+  table->glBindSampler(2,7);
+  table->glBindSampler(3,9);
+  REQUIRE(table->bindSampler == 2);
+  table->glBindSamplers(2,2,nullptr);
+  table->glBindSampler(2,0);
+  REQUIRE(table->bindSampler == 2);
+
+  //ranges replace the indexed bindings
+  table->glBindBufferBase(GL_SHADER_STORAGE_BUFFER,1,5);
+  GLuint     const buffers[] = {6};
+  GLintptr   const offsets[] = {0};
+  GLsizeiptr const sizes  [] = {256};
+  table->glBindBuffersRange(GL_SHADER_STORAGE_BUFFER,1,1,buffers,offsets,sizes);
+  table->glBindBufferBase(GL_SHADER_STORAGE_BUFFER,1,5);
+  REQUIRE(table->bindBufferBase == 2);
+
+  //per draw buffer state makes the global state unknown
+  table->glBlendFunc(GL_ONE,GL_ONE);
+  table->glBlendFunci(1,GL_ZERO,GL_ONE);
+  table->glBlendFunc(GL_ONE,GL_ONE);
+  table->glBlendFuncSeparatei(0,GL_ZERO,GL_ONE,GL_ZERO,GL_ONE);
+  table->glBlendFunc(GL_ONE,GL_ONE);
+  REQUIRE(table->blendFunc == 3);
+
+  table->glBlendEquation(GL_FUNC_ADD);
+  table->glBlendEquationi(1,GL_MAX);
+  table->glBlendEquation(GL_FUNC_ADD);
+  table->glBlendEquationSeparatei(1,GL_MAX,GL_MIN);
+  table->glBlendEquation(GL_FUNC_ADD);
+  REQUIRE(table->blendEquation == 3);
+
+  table->glColorMask(GL_TRUE,GL_TRUE,GL_TRUE,GL_TRUE);
+  table->glColorMaski(1,GL_FALSE,GL_FALSE,GL_FALSE,GL_FALSE);
+  table->glColorMask(GL_TRUE,GL_TRUE,GL_TRUE,GL_TRUE);
+  REQUIRE(table->colorMask == 2);
+}
@@ -0,0 +1,169 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/TraceTableDecorator.h>
+#include<geGL/TracePlayer.h>
+#include<cstdio>
+#include<sstream>
+
+using namespace ge::gl;
+using namespace std;
+
+//function table without OpenGL: calls are written into log
+class LoggingTable: public FunctionTable{
+  public:
+    mutable stringstream log;
+    mutable GLuint       nextName = 1;
+  protected:
+    virtual bool m_init()override{
+      this->m_ptr_glCreateShader  = (decltype(this->m_ptr_glCreateShader ))&LoggingTable::m_createShader ;
+      this->m_ptr_glShaderSource  = (decltype(this->m_ptr_glShaderSource ))&LoggingTable::m_shaderSource ;
+      this->m_ptr_glGenBuffers    = (decltype(this->m_ptr_glGenBuffers   ))&LoggingTable::m_genBuffers   ;
+      this->m_ptr_glBufferData    = (decltype(this->m_ptr_glBufferData   ))&LoggingTable::m_bufferData   ;
+      this->m_ptr_glUseProgram    = (decltype(this->m_ptr_glUseProgram   ))&LoggingTable::m_useProgram   ;
+      this->m_ptr_glDrawElements  = (decltype(this->m_ptr_glDrawElements ))&LoggingTable::m_drawElements ;
+      this->m_ptr_glCreateBuffers = (decltype(this->m_ptr_glCreateBuffers))&LoggingTable::m_createBuffers;
+      this->m_ptr_glDeleteBuffers = (decltype(this->m_ptr_glDeleteBuffers))&LoggingTable::m_deleteBuffers;
+      this->m_ptr_glNamedBufferSubData = (decltype(this->m_ptr_glNamedBufferSubData))&LoggingTable::m_namedBufferSubData;
+      return true;
+    }
+    GLuint m_createShader(GLenum type)const{
+      log<<"createShader "<<type<<";";
+      return nextName++;
+    }
+    void m_shaderSource(GLuint shader,GLsizei count,const GLchar*const*string,const GLint*length)const{
+      log<<"shaderSource "<<shader;
+      for(GLsizei i=0;i<count;++i)log<<" "<<(length?std::string(string[i],length[i]):std::string(string[i]));
+      log<<";";
+    }
+    void m_genBuffers(GLsizei n,GLuint*buffers)const{
+      for(GLsizei i=0;i<n;++i)buffers[i] = nextName++;
+      log<<"genBuffers "<<n<<";";
+    }
+    void m_bufferData(GLenum target,GLsizeiptr size,const void*data,GLenum usage)const{
+      log<<"bufferData "<<target<<" "<<size;
+      for(GLsizeiptr i=0;i<size;++i)log<<" "<<(int)((uint8_t const*)data)[i];
+      log<<" "<<usage<<";";
+    }
+    void m_useProgram(GLuint program)const{
+      log<<"useProgram "<<program<<";";
+    }
+    void m_drawElements(GLenum mode,GLsizei count,GLenum type,const void*indices)const{
+      log<<"drawElements "<<mode<<" "<<count<<" "<<type<<" "<<(uintptr_t)indices<<";";
+    }
+    void m_createBuffers(GLsizei n,GLuint*buffers)const{
+      for(GLsizei i=0;i<n;++i)buffers[i] = nextName++;
+      log<<"createBuffers "<<n<<";";
+    }
+    void m_deleteBuffers(GLsizei n,const GLuint*buffers)const{
+      log<<"deleteBuffers";
+      for(GLsizei i=0;i<n;++i)log<<" "<<buffers[i];
+      log<<";";
+    }
+    void m_namedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,const void*data)const{
+      log<<"namedBufferSubData "<<buffer<<" "<<offset;
+      for(GLsizeiptr i=0;i<size;++i)log<<" "<<(int)((uint8_t const*)data)[i];
+      log<<";";
+    }
+};
+
+TEST_CASE("Trace statistics count calls per frame"){
+  auto table = make_shared<TraceTableDecorator<LoggingTable>>();
+  table->traceLevel = TraceLevel::STATISTICS;
+  table->construct();
+  for(int i=0;i<3;++i)table->glUseProgram(1);
+  table->glDrawElements(GL_TRIANGLES,3,GL_UNSIGNED_INT,nullptr);
+  table->frameBoundary();
+  auto const stats = table->getLastFrameStatistics();
+  REQUIRE(stats.size() == 2);
+  REQUIRE(string(stats[0].first) == "glUseProgram");
+  REQUIRE(stats[0].second == 3);
+  REQUIRE(table->getLastFrameNumberOfCalls() == 4);
+  REQUIRE(table->dumpLastFrame("statistics.gltrace") == false);
+}
+
+TEST_CASE("Recorded frame replays the same calls"){
+  auto const file = string("frame.gltrace");
+  auto recorder = make_shared<TraceTableDecorator<LoggingTable>>();
+  recorder->traceLevel = TraceLevel::RECORD;
+  recorder->construct();
+
+  //setup
+  auto const shader = recorder->glCreateShader(GL_VERTEX_SHADER);
+  GLchar const*sources[] = {"void main(){}trailing"};
+  GLint  const lengths[] = {13};
+  recorder->glShaderSource(shader,1,sources,lengths);
+  GLuint buffer = 0;
+  recorder->glGenBuffers(1,&buffer);
+  uint8_t const data[] = {1,2,3,4};
+  recorder->glBufferData(GL_ARRAY_BUFFER,sizeof(data),data,GL_STATIC_DRAW);
+  recorder->frameBoundary();
+  //frame
+  for(int i=0;i<2;++i){
+    recorder->glUseProgram(7);
+    recorder->glDrawElements(GL_TRIANGLES,6,GL_UNSIGNED_INT,(void*)12);
+    recorder->frameBoundary();
+  }
+  REQUIRE(recorder->dumpLastFrame(file));
+
+  auto replayed = make_shared<LoggingTable>();
+  replayed->construct();
+  TracePlayer player;
+  REQUIRE(player.load(file));
+  REQUIRE(player.playSetup(*replayed));
+  REQUIRE(player.playFrame(*replayed));
+  REQUIRE(player.getNumberOfFrameCalls() == 2);
+  REQUIRE(player.getNumberOfMismatches() == 0);
+  REQUIRE(replayed->log.str() ==
+      "createShader 35633;"
+      "shaderSource 1 void main(){};"
+      "genBuffers 1;"
+      "bufferData 34962 4 1 2 3 4 35044;"
+      "useProgram 7;"
+      "drawElements 4 6 5125 12;");
+  std::remove(file.c_str());
+}
+
+TEST_CASE("Objects created in earlier frames are replayed before the last frame"){
+  auto const file = string("frames.gltrace");
+  auto recorder = make_shared<TraceTableDecorator<LoggingTable>>();
+  recorder->traceLevel = TraceLevel::RECORD;
+  recorder->construct();
+  recorder->frameBoundary();
+
+  uint8_t const first[] = {1}, second[] = {2}, third[] = {3};
+  GLuint buffer = 0,scratch = 0;
+  //frame 1 creates and fills a buffer
+  recorder->glCreateBuffers(1,&buffer);
+  recorder->glNamedBufferSubData(buffer,0,1,first);
+  recorder->glDrawElements(GL_TRIANGLES,3,GL_UNSIGNED_INT,nullptr);
+  recorder->frameBoundary();
+  //frame 2 updates it (only the latest upload is kept) and uses a temporary buffer
+  recorder->glNamedBufferSubData(buffer,0,1,second);
+  recorder->glCreateBuffers(1,&scratch);
+  recorder->glNamedBufferSubData(scratch,0,1,first);
+  recorder->glDeleteBuffers(1,&scratch);
+  recorder->glDrawElements(GL_TRIANGLES,3,GL_UNSIGNED_INT,nullptr);
+  recorder->frameBoundary();
+  //frame 3 is dumped
+  recorder->glUseProgram(7);
+  recorder->glNamedBufferSubData(buffer,0,1,third);
+  recorder->glDrawElements(GL_TRIANGLES,3,GL_UNSIGNED_INT,nullptr);
+  recorder->frameBoundary();
+  REQUIRE(recorder->dumpLastFrame(file));
+
+  auto replayed = make_shared<LoggingTable>();
+  replayed->construct();
+  TracePlayer player;
+  REQUIRE(player.load(file));
+  REQUIRE(player.playSetup(*replayed));
+  REQUIRE(replayed->log.str() ==
+      "createBuffers 1;"
+      "namedBufferSubData 1 0 2;"
+      "createBuffers 1;"
+      "namedBufferSubData 2 0 1;"
+      "deleteBuffers 2;");
+  REQUIRE(player.playFrame(*replayed));
+  REQUIRE(player.getNumberOfFrameCalls() == 3);
+  REQUIRE(player.getNumberOfMismatches() == 0);
+  std::remove(file.c_str());
+}
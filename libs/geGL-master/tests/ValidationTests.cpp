@@ -0,0 +1,64 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/ValidationTableDecorator.h>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+//function table without OpenGL: glEnable with GL_INVALID_ENUM argument raises GL_INVALID_ENUM
+class ErrorRaisingTable: public FunctionTable{
+  public:
+    mutable vector<GLenum>errors;
+    mutable size_t getErrorCalls = 0;
+  protected:
+    virtual bool m_init()override{
+      this->m_ptr_glEnable   = (decltype(this->m_ptr_glEnable  ))&ErrorRaisingTable::m_enable  ;
+      this->m_ptr_glGetError = (decltype(this->m_ptr_glGetError))&ErrorRaisingTable::m_getError;
+      return true;
+    }
+    void m_enable(GLenum cap)const{
+      if(cap == GL_INVALID_ENUM)errors.push_back(GL_INVALID_ENUM);
+    }
+    GLenum m_getError()const{
+      getErrorCalls++;
+      if(errors.empty())return GL_NO_ERROR;
+      auto const error = errors.back();
+      errors.pop_back();
+      return error;
+    }
+};
+
+TEST_CASE("Validation off installs no checks"){
+  auto table = make_shared<ValidationTableDecorator<ErrorRaisingTable>>();
+  table->validationLevel = ValidationLevel::OFF;
+  table->construct();
+  table->glEnable(GL_INVALID_ENUM);
+  REQUIRE(table->getErrorCalls       == 0);
+  REQUIRE(table->getNumberOfErrors() == 0);
+}
+
+TEST_CASE("Per call validation reports function and call site"){
+  auto table = make_shared<ValidationTableDecorator<ErrorRaisingTable>>();
+  table->validationLevel = ValidationLevel::PER_CALL;
+  table->construct();
+
+  string fceName;
+  GLenum error = GL_NO_ERROR;
+  int    line  = 0;
+  table->setErrorCallback([&](char const*f,GLenum e,CallSite const&site){
+    fceName = f;
+    error   = e;
+    line    = site.line;
+  });
+
+  table->glEnable(GL_DEPTH_TEST);
+  REQUIRE(table->getNumberOfErrors() == 0);
+
+  setCallSite(__FILE__,42);
+  table->glEnable(GL_INVALID_ENUM);
+  REQUIRE(table->getNumberOfErrors() == 1);
+  REQUIRE(fceName == "glEnable");
+  REQUIRE(error   == GL_INVALID_ENUM);
+  REQUIRE(line    == 42);
+}
@@ -0,0 +1,2 @@
+#version 460
+void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
@@ -0,0 +1,15 @@
+#version 460
+layout(location=0) in vec3 position;
+// Identité pour les cascades (programme "shadow") : gl_Position reste en
+// espace monde, shadow.geom le projette dans chaque cascade
+uniform mat4 lightSpaceMatrix = mat4(1);
+struct DrawTransform {
+    mat4 model;
+    mat3 normalMatrix;
+};
+layout(std430, binding = 0) readonly buffer DrawTransforms {
+    DrawTransform drawTransforms[];
+};
+void main() {
+    gl_Position = lightSpaceMatrix * drawTransforms[gl_BaseInstance + gl_InstanceID].model * vec4(position, 1.0);
+}
@@ -0,0 +1,23 @@
+#version 460
+
+in vec2 TexCoord;
+out vec4 fragColor;
+
+uniform sampler2D flameTexture;
+uniform float time;
+
+void main() {
+    vec4 texColor = texture(flameTexture, TexCoord);
+
+    // Animation de scintillement subtile
+    // float flicker = 0.95 + 0.01 * sin(time * 12.0 + TexCoord.y * 3.14159);
+    float flicker = 0.95 + 0.01 * sin(time * 12.0 + TexCoord.y * 5);
+
+    // Couleur légèrement plus chaude
+    vec3 warmColor = texColor.rgb * vec3(1.05, 1.0, 0.9) * flicker;
+
+    fragColor = vec4(warmColor, texColor.a);
+
+    // Rejeter pixels quasi-transparents
+    if (fragColor.a < 0.05) discard;
+}
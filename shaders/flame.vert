@@ -0,0 +1,30 @@
+#version 460
+
+layout(location=0) in vec3 position;
+layout(location=1) in vec2 texCoord;
+
+out vec2 TexCoord;
+
+uniform mat4 viewMatrix;
+uniform mat4 projMatrix;
+uniform vec3 flamePosition;
+uniform float flameSize;
+uniform float time;
+
+void main() {
+        // Extraire uniquement les axes Right et Up (ignorer translation)
+        vec3 cameraRight = normalize(vec3(viewMatrix[0][0], viewMatrix[1][0], viewMatrix[2][0]));
+        vec3 cameraUp = normalize(vec3(viewMatrix[0][1], viewMatrix[1][1], viewMatrix[2][1]));
+
+        // Construire position du vertex en espace monde
+        // float flameWobble = sin(time * 6.0 + position.y * 10.0) * 0.015 * position.y;
+
+        float wobbleFactor = texCoord.y;
+        float baseWobble = sin(time * 6.0 + position.y * 8.0) * 0.015;
+        float flameWobble = baseWobble * wobbleFactor * 2;
+
+        vec3 billboardLocalPos = vec3(position.x + flameWobble, position.y, position.z);
+        vec3 worldPos = flamePosition + cameraRight * billboardLocalPos.x * flameSize + cameraUp * billboardLocalPos.y * flameSize;
+        gl_Position = projMatrix * viewMatrix * vec4(worldPos, 1.0);
+        TexCoord = texCoord;
+    }
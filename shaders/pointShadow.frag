@@ -0,0 +1,9 @@
+#version 460
+// Distance à la lumière ramenée à [0, 1] par la portée : scene.frag compare
+// dans les mêmes unités, quelle que soit la face
+in vec3 gWorldPosition;
+uniform vec3 lightPosition;
+uniform float farPlane;
+void main() {
+    gl_FragDepth = length(gWorldPosition - lightPosition) / farPlane;
+}
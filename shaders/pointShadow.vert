@@ -0,0 +1,19 @@
+#version 460
+// Cube map de la bougie (src/pointShadow.h) : position monde, pointShadow.geom
+// la projette dans les faces que le draw touche
+layout(location=0) in vec3 position;
+struct DrawTransform {
+    mat4 model;
+    mat3 normalMatrix;
+};
+layout(std430, binding = 0) readonly buffer DrawTransforms {
+    DrawTransform drawTransforms[];
+};
+layout(std430, binding = 13) readonly buffer CasterFaces {
+    uint casterFaces[]; // bit f : la boîte du draw touche la face f
+};
+flat out uint vFaces;
+void main() {
+    gl_Position = drawTransforms[gl_BaseInstance + gl_InstanceID].model * vec4(position, 1.0);
+    vFaces = casterFaces[gl_DrawID];
+}
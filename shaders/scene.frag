@@ -0,0 +1,258 @@
+#version 460
+in vec3 vNormal;
+in vec2 vUV;
+in vec3 vPosition;
+in float vMatID;
+flat in vec3 vTint; // surcharge de matériau de l'instance
+out vec4 fColor;
+
+uniform vec3 sunDirection = normalize(vec3(1.0, -0.5, 0.0));
+uniform vec3 cameraPosition;
+uniform sampler2D materialTex[32];
+uniform bool debugMode = false;
+uniform bool showNormals = false;
+uniform bool showUVs = false;
+
+uniform vec3 materialKd[32];       // Couleurs Kd
+uniform bool materialHasTex[32];   // Flag texture
+
+uniform int renderPass = 0;     // renderPass: 0=Opaque, 1=Transparent
+uniform vec3 sunPositionWorld;  // Position d'origine du rayon (centre fenêtre)
+uniform float beamWidthZ = 1.0;
+
+// La flamme
+in vec2 TexCoord;
+uniform sampler2D flameTexture;
+// out vec4 fragColor; // GRRRRrrr....
+
+// POINT LIGHT éclairage à la bougie
+struct PointLight {
+      vec3 position;
+      vec3 color;
+      // x = Constant, y = Linear, z = Quadratic
+      vec3 attenuation;
+};
+uniform PointLight pointLight;
+uniform vec3 viewPos; // Position de la caméra (pour les reflets spéculaires)
+
+uniform float globalBrightness = 1.0;
+uniform float localBrightness = 1.0;
+uniform vec3 sunColor = vec3(1.0, 0.95, 0.8); // Lumière chaude
+uniform vec3 ambientColor = vec3(0.2, 0.2, 0.3); // Ambiance bleutée froide
+
+// Shadow mapping : cascades du soleil (src/shadowMapping.h), une couche par cascade
+const int SHADOW_CASCADES = 4;
+uniform sampler2DArray shadowMap;
+uniform mat4 cascadeMatrices[SHADOW_CASCADES];
+uniform float cascadeSplits[SHADOW_CASCADES]; // distance de vue où chaque cascade s'arrête
+uniform float cascadeBias[SHADOW_CASCADES];   // biais de profondeur (quelques texels de la cascade)
+in float vViewDepth;
+// Filtrage : 0 PCF (16 lectures de shadowMap), 1 EVSM (une lecture filtrée de shadowMoments)
+uniform int shadowFilter = 1;
+uniform sampler2DArray shadowMoments;         // moments EVSM floutés et mipmappés (shadowFilter.comp)
+uniform vec2 evsmExponents = vec2(40.0, 5.0);
+uniform float lightBleedReduction = 0.25;     // part basse de la borne de Chebyshev ramenée à l'ombre
+
+// Ombres de la bougie : cube map des distances à la lumière / portée (src/pointShadow.h)
+uniform samplerCubeShadow pointShadowMap;
+uniform float pointShadowFar = 0.0; // portée de la cube map, 0 : pas d'ombres
+
+// 16 points répartis selon un disque de Poisson
+const vec2 poissonDisk[16] = vec2[](
+  vec2( -0.94201624, -0.39906216 ), vec2( 0.94558609, -0.76890725 ),
+  vec2( -0.094184101, -0.92938870 ), vec2( 0.34495938, 0.29387760 ),
+  vec2( -0.91588581, 0.45771432 ), vec2( -0.81544232, -0.87912464 ),
+  vec2( -0.38277543, 0.27676845 ), vec2( 0.97484398, 0.75648379 ),
+  vec2( 0.44323325, -0.97511554 ), vec2( 0.53742981, -0.47373420 ),
+  vec2( -0.26496911, -0.41893023 ), vec2( 0.79197514, 0.19090188 ),
+  vec2( -0.24188840, 0.99706507 ), vec2( -0.81409955, 0.91437590 ),
+  vec2( 0.19984126, 0.78641367 ), vec2( 0.14383161, -0.14100790 )
+);
+
+// Fonction de bruit rapide pour la rotation
+float random(vec4 seed4) {
+  float dot_product = dot(seed4, vec4(12.9898, 78.233, 45.164, 94.673));
+  return fract(sin(dot_product) * 43758.5453);
+}
+
+// Borne de Chebyshev : probabilité que la profondeur mean soit éclairée,
+// le bas de l'intervalle [0, lightBleedReduction] ramené à l'ombre
+float chebyshevUpperBound(vec2 moments, float mean, float minVariance) {
+  if (mean <= moments.x) return 1.0;
+  float variance = max(moments.y - moments.x * moments.x, minVariance);
+  float d = mean - moments.x;
+  float pMax = variance / (variance + d * d);
+  return clamp((pMax - lightBleedReduction) / (1.0 - lightBleedReduction), 0.0, 1.0);
+}
+
+// EVSM : une lecture trilinéaire (anisotrope) des moments, deux bornes
+// (exposant positif et négatif), la plus sombre l'emporte. Projection
+// orthographique : les dérivées des uv sont celles de la position monde
+// passées par la matrice de la cascade (prises avant le choix de la cascade).
+float evsmShadow(vec3 projCoords, int cascade, float bias, vec3 dPdx, vec3 dPdy) {
+  vec2 uvDx = 0.5 * (cascadeMatrices[cascade] * vec4(dPdx, 0.0)).xy;
+  vec2 uvDy = 0.5 * (cascadeMatrices[cascade] * vec4(dPdy, 0.0)).xy;
+  vec4 moments = textureGrad(shadowMoments, vec3(projCoords.xy, cascade), uvDx, uvDy);
+  float depth = 2.0 * (projCoords.z - bias) - 1.0;
+  float pos = exp(evsmExponents.x * depth);
+  float neg = -exp(-evsmExponents.y * depth);
+  // Variance minimale : le biais de la cascade passé par la dérivée de l'exponentielle
+  vec2 depthScale = 2.0 * bias * evsmExponents * vec2(pos, -neg);
+  vec2 minVariance = depthScale * depthScale;
+  float lit = min(chebyshevUpperBound(moments.xy, pos, minVariance.x),
+                  chebyshevUpperBound(moments.zw, neg, minVariance.y));
+  return 1.0 - lit;
+}
+
+float calculateShadow() {
+  vec3 dPdx = dFdx(vPosition), dPdy = dFdy(vPosition);
+  // Première cascade qui couvre le fragment ; au-delà de la dernière, pas d'ombre
+  int cascade = 0;
+  while (cascade < SHADOW_CASCADES && vViewDepth > cascadeSplits[cascade]) ++cascade;
+  if (cascade == SHADOW_CASCADES) return 0.0;
+
+  vec4 lightSpace = cascadeMatrices[cascade] * vec4(vPosition, 1.0);
+  vec3 projCoords = lightSpace.xyz / lightSpace.w;
+  projCoords = projCoords * 0.5 + 0.5;
+  if(projCoords.z > 1.0) return 0.0;
+
+  float bias = max(cascadeBias[cascade] * (1.0 - dot(normalize(vNormal), normalize(-sunDirection))), 0.1 * cascadeBias[cascade]);
+  if (shadowFilter == 1) return evsmShadow(projCoords, cascade, bias, dPdx, dPdy);
+  float shadow = 0.0;
+
+  // Rayon de flou en texels de la cascade : Plus le chiffre est grand, plus l'ombre est "douce"
+  float spread = 1.5 / textureSize(shadowMap, 0).x;
+
+  // Utiliser la position du fragment pour créer un angle de rotation aléatoire
+  float angle = random(vec4(vPosition, 0.0)) * 6.283185; // 0 à 2PI
+  float s = sin(angle);
+  float c = cos(angle);
+  mat2 rotation = mat2(c, s, -s, c);
+
+  for (int i=0; i<16; i++) {
+      // Faire pivoter le point du disque de Poisson
+      vec2 offset = rotation * poissonDisk[i] * spread;
+      float pcfDepth = texture(shadowMap, vec3(projCoords.xy + offset, cascade)).r;
+      if (projCoords.z - bias > pcfDepth) shadow += 1.0;
+  }
+  return shadow / 16.0;
+}
+
+// Part de la lumière ponctuelle qui arrive au fragment (1 : éclairé)
+float calculatePointVisibility(vec3 lightToFrag, float distance, float ndotl) {
+  if (pointShadowFar <= 0.0 || distance >= pointShadowFar) return 1.0;
+  // Biais : environ un texel de la face à cette distance, plus sur les surfaces rasantes
+  float texel = 2.0 * distance / float(textureSize(pointShadowMap, 0).x);
+  float bias = texel * (1.5 + 3.0 * (1.0 - ndotl));
+  return texture(pointShadowMap, vec4(lightToFrag, (distance - bias) / pointShadowFar));
+}
+
+void main() {
+    int mid = int(vMatID + 0.5);
+
+    // ------------------------------------------------------------------
+    // CONTRÔLE DU PASSAGE DE RENDU (OPAQUE vs TRANSPARENT)
+    // ------------------------------------------------------------------
+    // MatID 6 = Vitre, MatID 7 = Rayons
+    bool isTransparent = (mid == 6 || mid == 7);
+
+    if (renderPass == 0) { // PASSAGE OPAQUE (Phase 1)
+        // Jeter la vitre (6) et les rayons (7). Garde les murs (0-5) et les OBJs (8+)
+        if (isTransparent) { discard; }
+    } else { // PASSAGE TRANSPARENT (Phase 2)
+        // Garder uniquement la vitre (6) et les rayons (7). Jeter les murs et les OBJs
+        if (!isTransparent) { discard; }
+    }
+    // ------------------------------------------------------------------
+
+    // UV DEBUG MODE
+    if (showUVs) { fColor = vec4(fract(vUV), 0.0, 1.0); return; }
+
+    // NORMAL DEBUG MODE
+    if (showNormals) { fColor = vec4(vNormal * 0.5 + 0.5, 1.0); return; }
+
+    // MATERIAL ID DEBUG MODE
+    if (debugMode) {
+        if (vMatID < -0.5) {
+          fColor = vec4(1.0, 0.0, 1.0, 1.0);
+        } else if (vMatID < 0.5) {
+          fColor = vec4(1.0, 0.0, 0.0, 1.0);
+        } else if (vMatID < 3.5) {
+          fColor = vec4(0.0, vMatID / 3.0, 0.0, 1.0);
+        } else if (vMatID < 6.5) {
+          fColor = vec4(0.0, 0.0, (vMatID - 3.0) / 3.0, 1.0);
+        } else if (vMatID < 7.5) { // MatID 7 (Rayons) : Jaune
+          fColor = vec4(1.0, 1.0, 0.0, 1.0); return;
+        } else {
+          fColor = vec4(1.0, 1.0, 0.0, 1.0); // YELLOW for table (OBJ)
+        }
+        return;
+    }
+
+    // ===== RÉCUPÉRATION COULEUR MATÉRIAU =====
+    vec3 texColor;
+    if (mid >= 0 && mid < 32) {
+        if (materialHasTex[mid]) { // Utiliser la texture
+            texColor = texture(materialTex[mid], vUV).rgb;
+        } else { // Utiliser la couleur Kd
+            texColor = materialKd[mid];
+        }
+    } else {
+        texColor = vec3(1.0, 0.0, 1.0); // Magenta debug
+    }
+    texColor *= vTint;
+
+    // --- LIGHTING pour les objets opaques (Murs, Sol, OBJs) ---
+    float shadow = calculateShadow();
+    vec3 lightDir = normalize(-sunDirection);
+    vec3 ambient = ambientColor * 0.3 * globalBrightness;
+    vec3 diffuse = sunColor * max(dot(normalize(vNormal), lightDir), 0.0) * 0.8;
+    vec3 lighting = vec3(ambient + (1.0 - shadow) * diffuse);  // L'ombre ne coupe que la diffuse
+
+    vec3 finalColor = texColor * lighting;
+
+    // ==========================================================
+    // Calcul de l'éclairage de la Bougie (Point Light) - AJOUTER ICI
+    // ==========================================================
+    // On s'assure que le calcul n'affecte pas les rayons de soleil (MatID 7)
+    if (mid != 7) {
+      // 1. Initialisation des composantes
+      vec3 norm = normalize(vNormal);
+      vec3 lightContribution = vec3(0.0);
+
+      // 2. Calcul du vecteur Lumière et de la distance
+      vec3 lightVec = pointLight.position - vPosition;
+      float distance = length(lightVec);
+      vec3 lightDirNorm = normalize(lightVec);
+
+      // 3. Atténuation (Falloff)
+      float attenuation = 1.0 / (
+          pointLight.attenuation.x +
+          pointLight.attenuation.y * distance +
+          pointLight.attenuation.z * distance * distance
+      );
+
+      // 4. Composante Diffuse
+      float diff = max(dot(norm, lightDirNorm), 0.0);
+      vec3 diffuseLight = pointLight.color * diff * texColor;
+      if (diff > 0.0) diffuseLight *= calculatePointVisibility(-lightVec, distance, diff);
+
+      // 5. Composante Spéculaire (Optionnelle, pour les surfaces brillantes comme le bougeoir)
+      // Pour simplifier, nous n'incluons que le diffuse pour la lumière de la bougie.
+
+      // 6. Application de l'atténuation
+      lightContribution = diffuseLight * attenuation * localBrightness;
+
+      // 7. AJOUTER LA CONTRIBUTION DE LA BOUGIE à la couleur finale
+      finalColor += lightContribution;
+    }
+    // ==========================================================
+
+    // ==========================================================
+    // PROJECTION DE LUMIÈRE DES RAYONS (Uniquement sur le Sol)
+    // ==========================================================
+    // Supprimé: La lumière doit éclairer le sol
+    // ==========================================================
+
+    fColor = vec4(finalColor, 1.0);
+  }
@@ -0,0 +1,51 @@
+#version 460
+layout(location=0) in vec3 position;
+layout(location=1) in vec3 normal;
+layout(location=2) in vec2 uv;
+layout(location=3) in float materialID;
+
+out vec3 vNormal;
+out vec2 vUV;
+out vec3 vPosition;
+out float vMatID;
+flat out vec3 vTint;
+
+uniform mat4 viewMatrix = mat4(1);
+uniform mat4 projMatrix = mat4(1);
+
+// Transformations par draw, calculées sur le CPU (drawTransforms.h)
+// L'identifiant du draw est passé comme baseInstance (+ numéro d'instance
+// pour les draws instanciés : nœuds consécutifs)
+struct DrawTransform {
+    mat4 model;
+    mat3 normalMatrix;
+};
+layout(std430, binding = 0) readonly buffer DrawTransforms {
+    DrawTransform drawTransforms[];
+};
+// Surcharge de matériau par instance (sceneFile.h, SCENE_TINT_BINDING)
+layout(std430, binding = 11) readonly buffer DrawTints {
+    vec4 drawTints[];
+};
+
+// Shadow mapping : distance de vue, pour choisir la cascade
+out float vViewDepth;
+
+void main() {
+    int drawIndex = gl_BaseInstance + gl_InstanceID;
+    DrawTransform draw = drawTransforms[drawIndex];
+    vec4 worldPos = draw.model * vec4(position, 1);
+    vec4 viewPos = viewMatrix * worldPos;
+    gl_Position = projMatrix * viewPos;
+
+    vec3 transformedNormal = normalize(draw.normalMatrix * normal);
+    vNormal = transformedNormal;
+
+    vUV = uv;
+    vPosition = worldPos.xyz;
+    vMatID = materialID;
+    vTint = drawTints[drawIndex].rgb;
+
+    // Shadow mapping
+    vViewDepth = -viewPos.z;
+}
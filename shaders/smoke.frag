@@ -0,0 +1,32 @@
+#version 460
+
+in vec2 vUV;
+in float vAlpha;
+out vec4 fColor;
+
+uniform sampler2D smokeTexture;
+
+void main() {
+        // Texture de fumée (utilise canal alpha de la texture)
+        vec4 texColor = texture(smokeTexture, vUV);
+
+        // Fumée GRIS-BLEU vaporeuse (couleur froide)
+        // vec3 smokeColor = vec3(0.55, 0.6, 0.7); // Gris-bleu doux
+        vec3 smokeColor = vec3(0.7, 0.75, 0.8);
+
+        // Variation subtile de couleur selon la vie
+        float t = vAlpha / 0.25; // Normaliser
+        smokeColor = mix(
+            vec3(0.7, 0.72, 0.75),  // Début: gris-blanc léger
+            vec3(0.45, 0.5, 0.6),   // Fin: gris-bleu plus foncé
+            1.0 - t
+        );
+
+        // Alpha combiné : texture alpha * particle life alpha
+        float finalAlpha = texColor.a * vAlpha;
+
+        // Discard pour optimisation (seuil très bas)
+        if (finalAlpha < 0.005) discard;
+
+        fColor = vec4(smokeColor, finalAlpha);
+    }
@@ -0,0 +1,45 @@
+#version 460
+
+layout(location = 0) in vec3 position; // Position du quad
+layout(location = 1) in vec2 uv;
+
+out vec2 vUV;
+out float vAlpha;
+
+uniform mat4 viewMatrix;
+uniform mat4 projMatrix;
+uniform vec3 cameraPosition;
+uniform vec3 particlePos;     // Position de la particule
+uniform float particleSize;   // Taille
+uniform float particleLife;   // Vie (1.0 = naissance, 0.0 = mort)
+uniform float particleRotation; // Rotation Z
+
+void main() {
+    vUV = uv;
+
+    // Alpha fade : progressif et fluide
+    // Fade-in rapide au début, fade-out lent à la fin
+    float fadeIn = smoothstep(0.0, 0.1, particleLife);
+    float fadeOut = smoothstep(0.0, 0.3, particleLife);
+    // vAlpha = fadeIn * fadeOut * 0.25; // Max alpha = 0.25 (fumée visible mais subtile)
+    float lifeFade = particleLife * particleLife ;
+    vAlpha = lifeFade * 0.16;
+
+    // Billboard : toujours face à la caméra
+    vec3 forward = normalize(cameraPosition - particlePos);
+    vec3 right = normalize(cross(vec3(0, 1, 0), forward));
+    vec3 up = cross(forward, right);
+
+    // Rotation autour de l'axe forward (billboard rotation)
+    float c = cos(particleRotation);
+    float s = sin(particleRotation);
+    vec3 rotatedRight = right * c - up * s;
+    vec3 rotatedUp = right * s + up * c;
+
+    // Position finale du vertex
+    vec3 worldPos = particlePos
+                  + rotatedRight * position.x * particleSize
+                  + rotatedUp * position.y * particleSize;
+
+    gl_Position = projMatrix * viewMatrix * vec4(worldPos, 1.0);
+}
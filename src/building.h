@@ -0,0 +1,478 @@
+#pragma once
+// ============================================================================
+// Bâtiment : pièces reliées par des portes, des arches et des fenêtres
+// ============================================================================
+// Les pièces et les ouvertures viennent de la scène ("room", "opening", voir
+// sceneFile.h). Chaque pièce a sa propre géométrie (murs découpés autour des
+// ouvertures, sol, plafond, plinthes, corniches, panneaux des portes fermées)
+// et devient un draw à part. Les ouvertures ouvertes entre deux pièces forment
+// le graphe des portails.
+//
+// Visibilité par portails : depuis la pièce de la caméra, chaque portail est
+// découpé par le frustum courant (Sutherland-Hodgman) ; s'il en reste quelque
+// chose, la pièce voisine est visible et on y continue avec le frustum réduit
+// aux bords du portail découpé. Les pièces (et les objets qu'elles contiennent)
+// que l'on ne voit par aucune porte ouverte ne sont pas dessinés.
+//
+// Les murs n'ont pas d'épaisseur : deux pièces voisines ont chacune leur face
+// sur le même plan.
+
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+#include "sceneFile.h"
+#include "gpuCulling.h" // extractFrustumPlanes
+
+// Pièce unique d'origine pour les scènes sans "room" : 6 x 3,5 x 8 m centrée
+// sur l'origine, fenêtre de 2 x 2 m sur le mur +x, porte fermée sur le mur -x
+inline void addDefaultRoom(SceneData& scene) {
+    if (!scene.rooms.empty()) return;
+    SceneRoom room = { scene.addString("room"), { -3.0f, 0.0f, -4.0f }, { 3.0f, 3.5f, 4.0f } };
+    scene.rooms.push_back(room);
+    scene.openings.push_back({ SCENE_OPENING_WINDOW, { 0, SCENE_OUTSIDE }, SCENE_WALL_POS_X, 0, 0.0f, 0.75f, 2.0f, 2.0f });
+    scene.openings.push_back({ SCENE_OPENING_DOOR, { 0, SCENE_OUTSIDE }, SCENE_WALL_NEG_X, SCENE_OPENING_CLOSED, 0.0f, 0.0f, 0.9f, 2.8f });
+}
+
+// Repère d'un mur vu de l'intérieur : u vers la droite depuis origin, v vers le haut
+struct WallFrame {
+    glm::vec3 origin;
+    glm::vec3 right;
+    glm::vec3 normal; // vers l'intérieur de la pièce
+    float length;
+    float height;
+};
+
+inline WallFrame wallFrame(const SceneRoom& r, uint32_t wall) {
+    float height = r.max[1] - r.min[1];
+    switch (wall) {
+    case SCENE_WALL_NEG_X: return { { r.min[0], r.min[1], r.max[2] }, { 0, 0, -1 }, { 1, 0, 0 }, r.max[2] - r.min[2], height };
+    case SCENE_WALL_POS_X: return { { r.max[0], r.min[1], r.min[2] }, { 0, 0, 1 }, { -1, 0, 0 }, r.max[2] - r.min[2], height };
+    case SCENE_WALL_NEG_Z: return { { r.min[0], r.min[1], r.min[2] }, { 1, 0, 0 }, { 0, 0, 1 }, r.max[0] - r.min[0], height };
+    default:               return { { r.max[0], r.min[1], r.max[2] }, { -1, 0, 0 }, { 0, 0, -1 }, r.max[0] - r.min[0], height };
+    }
+}
+
+inline glm::vec3 wallPoint(const WallFrame& f, float u, float v, float inset = 0.0f) {
+    return f.origin + f.right * u + glm::vec3(0, v, 0) + f.normal * inset;
+}
+
+// Mur de la pièce room percé par l'ouverture o (pour rooms[1], c'est le mur opposé)
+inline bool openingOnWall(const SceneOpening& o, uint32_t room, uint32_t wall) {
+    return (o.rooms[0] == room && o.wall == wall) || (o.rooms[1] == room && (o.wall ^ 1u) == wall);
+}
+
+// Rectangle de l'ouverture dans le repère du mur : u0, u1, v0, v1
+inline glm::vec4 openingRect(const WallFrame& f, const SceneRoom& room, uint32_t wall, const SceneOpening& o) {
+    bool xWall = wall < SCENE_WALL_NEG_Z;
+    glm::vec3 a = xWall ? glm::vec3(f.origin.x, 0, o.center - 0.5f * o.width) : glm::vec3(o.center - 0.5f * o.width, 0, f.origin.z);
+    glm::vec3 b = xWall ? glm::vec3(f.origin.x, 0, o.center + 0.5f * o.width) : glm::vec3(o.center + 0.5f * o.width, 0, f.origin.z);
+    float ua = glm::dot(a - f.origin, f.right), ub = glm::dot(b - f.origin, f.right);
+    return glm::vec4(std::min(ua, ub), std::max(ua, ub), o.bottom - room.min[1], o.bottom + o.height - room.min[1]);
+}
+
+// Découpe la bande [0, length] x [v0, v1] autour des trous (u0, u1, v0, v1) :
+// colonnes entre les bords des trous, fusionnées quand elles sont coupées de la même façon
+template <typename Emit>
+inline void forEachWallPiece(float length, float v0, float v1, const std::vector<glm::vec4>& holes, Emit emit) {
+    std::vector<float> cuts = { 0.0f, length };
+    for (auto const& h : holes) {
+        cuts.push_back(std::min(std::max(h.x, 0.0f), length));
+        cuts.push_back(std::min(std::max(h.y, 0.0f), length));
+    }
+    std::sort(cuts.begin(), cuts.end());
+    cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+
+    // Segments verticaux pleins d'une colonne
+    using Segment = std::pair<float, float>;
+    auto segments = [&](float u) {
+        std::vector<Segment> covered;
+        for (auto const& h : holes)
+            if (h.x < u && u < h.y && h.z < v1 && h.w > v0) covered.push_back({ std::max(h.z, v0), std::min(h.w, v1) });
+        std::sort(covered.begin(), covered.end());
+        std::vector<Segment> solid;
+        float v = v0;
+        for (auto const& c : covered) {
+            if (c.first > v) solid.push_back({ v, c.first });
+            v = std::max(v, c.second);
+        }
+        if (v < v1) solid.push_back({ v, v1 });
+        return solid;
+    };
+
+    if (cuts.size() < 2) return;
+    size_t columns = cuts.size() - 1;
+    size_t start = 0;
+    std::vector<Segment> current = segments(0.5f * (cuts[0] + cuts[1]));
+    for (size_t k = 1; k <= columns; ++k) {
+        std::vector<Segment> next;
+        if (k < columns) {
+            next = segments(0.5f * (cuts[k] + cuts[k + 1]));
+            if (next == current) continue;
+        }
+        for (auto const& s : current) emit(cuts[start], cuts[k], s.first, s.second);
+        start = k;
+        current = next;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Géométrie des pièces : composants paramétriques
+// ----------------------------------------------------------------------------
+// Une pièce est faite de composants (panneaux de chaque mur, plinthes,
+// corniches, portes fermées, sol, plafond), chacun régénéré seul à partir des
+// paramètres de la pièce et de ses ouvertures. Chaque composant a une place
+// fixe dans les tampons de la pièce (capacité en quads, même disposition pour
+// toutes les pièces) : une édition ne réécrit que les sous-plages des
+// composants touchés (roomEditor.h). Les quads inutilisés sont des triangles
+// dégénérés sur le sommet d'ancrage de la pièce (coin bas, dans la boîte).
+
+enum RoomComponentKind : uint32_t {
+    ROOM_WALL = 0,  // panneaux du mur découpés autour des ouvertures
+    ROOM_PLINTH,
+    ROOM_CORNICE,
+    ROOM_DOOR,      // panneaux des portes fermées
+    ROOM_FLOOR,
+    ROOM_CEILING,
+    ROOM_COMPONENT_KINDS
+};
+const uint32_t ROOM_COMPONENT_QUADS[ROOM_COMPONENT_KINDS] = { 24, 16, 16, 4, 1, 1 };
+
+struct RoomComponent {
+    uint32_t kind;  // RoomComponentKind
+    uint32_t wall;  // SceneWall (murs, plinthes, corniches, portes)
+    uint32_t firstVertex, vertexCount; // relatifs au premier sommet de la pièce
+    uint32_t firstIndex, indexCount;   // relatifs au premier indice de la pièce
+};
+
+// Disposition commune à toutes les pièces : par mur murs, plinthes, corniches,
+// portes, puis le sol et le plafond
+inline const std::vector<RoomComponent>& roomComponents() {
+    static const std::vector<RoomComponent> components = [] {
+        std::vector<RoomComponent> list;
+        uint32_t vertices = 0, indices = 0;
+        auto add = [&](uint32_t kind, uint32_t wall) {
+            uint32_t quads = ROOM_COMPONENT_QUADS[kind];
+            list.push_back({ kind, wall, vertices, 4 * quads, indices, 6 * quads });
+            vertices += 4 * quads;
+            indices += 6 * quads;
+        };
+        for (uint32_t wall = 0; wall < 4; ++wall)
+            for (uint32_t kind = ROOM_WALL; kind <= ROOM_DOOR; ++kind) add(kind, wall);
+        add(ROOM_FLOOR, 0);
+        add(ROOM_CEILING, 0);
+        return list;
+    }();
+    return components;
+}
+
+inline size_t roomComponentIndex(uint32_t kind, uint32_t wall) {
+    return kind < ROOM_FLOOR ? wall * 4 + kind : 16 + (kind - ROOM_FLOOR);
+}
+
+// Quads d'un composant, non complétés (indices relatifs au premier sommet du composant)
+inline void generateRoomComponent(const SceneData& scene, uint32_t roomIndex, uint32_t kind, uint32_t wall,
+                                  std::vector<float>& vertices, std::vector<uint32_t>& indices) {
+    vertices.clear();
+    indices.clear();
+    const SceneRoom& room = scene.rooms[roomIndex];
+
+    auto addQuad = [&](const glm::vec3 p[4], const glm::vec3& n, const glm::vec2 uv[4], float materialID) {
+        uint32_t base = (uint32_t)(vertices.size() / MESH_VERTEX_FLOATS);
+        for (int k = 0; k < 4; ++k) {
+            float v[MESH_VERTEX_FLOATS] = { p[k].x, p[k].y, p[k].z, n.x, n.y, n.z, uv[k].x, uv[k].y, materialID };
+            vertices.insert(vertices.end(), v, v + MESH_VERTEX_FLOATS);
+        }
+        uint32_t q[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+        indices.insert(indices.end(), q, q + 6);
+    };
+    // Rectangle du mur, sommets dans l'ordre trigonométrique vu de l'intérieur
+    auto addWallQuad = [&](const WallFrame& f, float u0, float u1, float v0, float v1, float inset,
+                           const glm::vec2 uv[4], float materialID) {
+        glm::vec3 p[4] = { wallPoint(f, u0, v0, inset), wallPoint(f, u1, v0, inset),
+                           wallPoint(f, u1, v1, inset), wallPoint(f, u0, v1, inset) };
+        addQuad(p, f.normal, uv, materialID);
+    };
+
+    const float wallpaperScale = 0.5f; // répétitions du papier peint par mètre
+    const float plinthHeight = 0.15f;
+    const float corniceHeight = 0.20f;
+
+    if (kind == ROOM_FLOOR || kind == ROOM_CEILING) {
+        float width = room.max[0] - room.min[0], depth = room.max[2] - room.min[2];
+        glm::vec2 floorUv[4] = { { 0, 0 }, { width, 0 }, { width, depth }, { 0, depth } };
+        if (kind == ROOM_FLOOR) {
+            glm::vec3 floorQuad[4] = { { room.min[0], room.min[1], room.max[2] }, { room.max[0], room.min[1], room.max[2] },
+                                       { room.max[0], room.min[1], room.min[2] }, { room.min[0], room.min[1], room.min[2] } };
+            addQuad(floorQuad, glm::vec3(0, 1, 0), floorUv, 2.0f);
+        } else {
+            glm::vec3 ceilingQuad[4] = { { room.min[0], room.max[1], room.min[2] }, { room.max[0], room.max[1], room.min[2] },
+                                         { room.max[0], room.max[1], room.max[2] }, { room.min[0], room.max[1], room.max[2] } };
+            addQuad(ceilingQuad, glm::vec3(0, -1, 0), floorUv, 0.0f);
+        }
+        return;
+    }
+
+    WallFrame f = wallFrame(room, wall);
+    std::vector<glm::vec4> holes;
+    for (auto const& o : scene.openings) {
+        if (!openingOnWall(o, roomIndex, wall)) continue;
+        glm::vec4 rect = openingRect(f, room, wall, o);
+        if (o.type == SCENE_OPENING_DOOR && (o.flags & SCENE_OPENING_CLOSED)) {
+            // Porte fermée : pas de trou, un panneau devant le mur
+            if (kind != ROOM_DOOR) continue;
+            glm::vec2 uv[4] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+            addWallQuad(f, rect.x, rect.y, rect.z, rect.w, 0.015f, uv, 5.0f);
+        }
+        else holes.push_back(rect);
+    }
+    if (kind == ROOM_WALL) {
+        forEachWallPiece(f.length, 0.0f, f.height, holes, [&](float u0, float u1, float v0, float v1) {
+            glm::vec2 uv[4] = { { u0 * wallpaperScale, v0 * wallpaperScale }, { u1 * wallpaperScale, v0 * wallpaperScale },
+                                { u1 * wallpaperScale, v1 * wallpaperScale }, { u0 * wallpaperScale, v1 * wallpaperScale } };
+            addWallQuad(f, u0, u1, v0, v1, 0.0f, uv, 0.0f);
+        });
+    }
+    else if (kind == ROOM_PLINTH || kind == ROOM_CORNICE) {
+        // Plinthes et corniches : bandes le long du mur, interrompues par les ouvertures
+        struct Band { float v0, v1, vScale, material; };
+        const Band band = kind == ROOM_PLINTH ? Band{ 0.0f, plinthHeight, 0.2f, 3.0f }
+                                              : Band{ f.height - corniceHeight, f.height, 0.3f, 4.0f };
+        forEachWallPiece(f.length, band.v0, band.v1, holes, [&](float u0, float u1, float v0, float v1) {
+            float t0 = (v0 - band.v0) / (band.v1 - band.v0) * band.vScale;
+            float t1 = (v1 - band.v0) / (band.v1 - band.v0) * band.vScale;
+            glm::vec2 uv[4] = { { u0 / f.length, t0 }, { u1 / f.length, t0 }, { u1 / f.length, t1 }, { u0 / f.length, t1 } };
+            addWallQuad(f, u0, u1, v0, v1, 0.01f, uv, band.material);
+        });
+    }
+}
+
+// Composant complété à sa capacité : quads en trop ignorés (avec un message),
+// sommets manquants = ancrage de la pièce, indices manquants = triangles
+// dégénérés ; indices rendus relatifs à la pièce
+inline void padRoomComponent(const SceneData& scene, uint32_t roomIndex, const RoomComponent& c,
+                             std::vector<float>& vertices, std::vector<uint32_t>& indices) {
+    if (indices.size() > c.indexCount) {
+        std::cerr << "Room " << scene.str(scene.rooms[roomIndex].name) << ": component " << c.kind << " of wall " << c.wall
+                  << " needs " << indices.size() / 6 << " quads, only " << c.indexCount / 6 << " kept" << std::endl;
+        indices.resize(c.indexCount);
+        vertices.resize((size_t)c.vertexCount * MESH_VERTEX_FLOATS);
+    }
+    const float* m = scene.rooms[roomIndex].min;
+    const float anchor[MESH_VERTEX_FLOATS] = { m[0], m[1], m[2], 0, 1, 0, 0, 0, 0 };
+    while (vertices.size() < (size_t)c.vertexCount * MESH_VERTEX_FLOATS)
+        vertices.insert(vertices.end(), anchor, anchor + MESH_VERTEX_FLOATS);
+    for (auto& index : indices) index += c.firstVertex;
+    indices.resize(c.indexCount, c.firstVertex + c.vertexCount - 1);
+}
+
+// Géométrie d'une pièce (9 floats par sommet, comme le reste de la scène),
+// composants à leur place (roomComponents)
+inline void generateRoomGeometry(const SceneData& scene, uint32_t roomIndex,
+                                 std::vector<float>& vertices, std::vector<uint32_t>& indices) {
+    vertices.clear();
+    indices.clear();
+    std::vector<float> componentVertices;
+    std::vector<uint32_t> componentIndices;
+    for (auto const& c : roomComponents()) {
+        generateRoomComponent(scene, roomIndex, c.kind, c.wall, componentVertices, componentIndices);
+        padRoomComponent(scene, roomIndex, c, componentVertices, componentIndices);
+        vertices.insert(vertices.end(), componentVertices.begin(), componentVertices.end());
+        indices.insert(indices.end(), componentIndices.begin(), componentIndices.end());
+    }
+}
+
+// Vitre d'une fenêtre (4 sommets, 6 indices ajoutés) : face avant vers
+// l'extérieur, légèrement en retrait dans la pièce rooms[0]
+inline void appendWindowQuad(const SceneData& scene, const SceneOpening& o,
+                             std::vector<float>& vertices, std::vector<uint32_t>& indices) {
+    const SceneRoom& room = scene.rooms[o.rooms[0]];
+    WallFrame f = wallFrame(room, o.wall);
+    glm::vec4 rect = openingRect(f, room, o.wall, o);
+    const float offset = 0.005f;
+    glm::vec3 p[4] = { wallPoint(f, rect.y, rect.z, offset), wallPoint(f, rect.x, rect.z, offset),
+                       wallPoint(f, rect.x, rect.w, offset), wallPoint(f, rect.y, rect.w, offset) };
+    glm::vec2 uv[4] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+    glm::vec3 n = -f.normal;
+    uint32_t base = (uint32_t)(vertices.size() / MESH_VERTEX_FLOATS);
+    for (int k = 0; k < 4; ++k) {
+        float v[MESH_VERTEX_FLOATS] = { p[k].x, p[k].y, p[k].z, n.x, n.y, n.z, uv[k].x, uv[k].y, 6.0f };
+        vertices.insert(vertices.end(), v, v + MESH_VERTEX_FLOATS);
+    }
+    uint32_t q[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+    indices.insert(indices.end(), q, q + 6);
+}
+
+// Vitres de toutes les fenêtres (MATERIAL ID 6), dessinées à part en passe
+// transparente, une par ouverture "window" dans l'ordre de la scène
+inline void generateWindowGeometry(const SceneData& scene, std::vector<float>& vertices, std::vector<uint32_t>& indices) {
+    vertices.clear();
+    indices.clear();
+    for (auto const& o : scene.openings)
+        if (o.type == SCENE_OPENING_WINDOW) appendWindowQuad(scene, o, vertices, indices);
+}
+
+// ----------------------------------------------------------------------------
+// Portails
+// ----------------------------------------------------------------------------
+
+struct BuildingPortal {
+    uint32_t rooms[2];
+    glm::vec3 corners[4];
+    glm::vec3 normal; // de rooms[0] vers rooms[1]
+};
+
+// Découpe du polygone par le demi-espace dot(plane.xyz, p) + plane.w >= 0
+inline void clipPolygon(std::vector<glm::vec3>& polygon, const glm::vec4& plane) {
+    std::vector<glm::vec3> out;
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        const glm::vec3& a = polygon[i];
+        const glm::vec3& b = polygon[(i + 1) % polygon.size()];
+        float da = glm::dot(glm::vec3(plane), a) + plane.w;
+        float db = glm::dot(glm::vec3(plane), b) + plane.w;
+        if (da >= 0.0f) out.push_back(a);
+        if ((da >= 0.0f) != (db >= 0.0f)) out.push_back(a + (b - a) * (da / (da - db)));
+    }
+    polygon.swap(out);
+}
+
+struct PortalVisibility {
+    std::vector<SceneRoom> rooms;
+    std::vector<BuildingPortal> portals;
+    std::vector<std::vector<uint32_t>> roomPortals;
+    std::vector<uint8_t> visible;      // par pièce, rempli par update
+    std::vector<int> commandRoom;      // pièce de chaque commande de la scène (-1 : toujours dessinée)
+    std::vector<uint8_t> appliedMask;  // visibilité des commandes envoyée au tampon indirect
+    int cameraRoom = -1;
+    size_t portalsTraversed = 0;
+    static const int MAX_DEPTH = 16;
+
+    void init(const SceneData& scene) {
+        rooms = scene.rooms;
+        portals.clear();
+        roomPortals.assign(rooms.size(), {});
+        for (auto const& o : scene.openings) {
+            bool closed = o.type == SCENE_OPENING_DOOR && (o.flags & SCENE_OPENING_CLOSED);
+            if (closed || o.rooms[1] == SCENE_OUTSIDE) continue;
+            const SceneRoom& room = rooms[o.rooms[0]];
+            WallFrame f = wallFrame(room, o.wall);
+            glm::vec4 rect = openingRect(f, room, o.wall, o);
+            BuildingPortal p = { { o.rooms[0], o.rooms[1] },
+                                 { wallPoint(f, rect.x, rect.z), wallPoint(f, rect.y, rect.z),
+                                   wallPoint(f, rect.y, rect.w), wallPoint(f, rect.x, rect.w) },
+                                 -f.normal };
+            roomPortals[o.rooms[0]].push_back((uint32_t)portals.size());
+            roomPortals[o.rooms[1]].push_back((uint32_t)portals.size());
+            portals.push_back(p);
+        }
+        visible.assign(rooms.size(), 1);
+    }
+
+    int roomAt(const glm::vec3& p) const { return roomContaining(rooms, p); }
+
+    // Pièce de chaque commande : les roomCount premières sont les pièces, les
+    // objets sont rangés dans la pièce qui contient le centre de leur boîte monde
+    void assignCommands(const SceneGpu& gpu) {
+        commandRoom.assign(gpu.sceneCommandCount, -1);
+        for (GLsizei i = 0; i < gpu.sceneCommandCount; ++i) {
+            if (i < gpu.roomCommandCount) { commandRoom[i] = (int)i; continue; }
+            const MeshBounds& b = gpu.commandRanges[i].bounds;
+            const float* m = gpu.transforms.world[gpu.commands[i].baseInstance].m;
+            glm::vec3 c(0.0f);
+            for (int r = 0; r < 3; ++r)
+                c[r] = m[r] * b.center[0] + m[4 + r] * b.center[1] + m[8 + r] * b.center[2] + m[12 + r];
+            commandRoom[i] = roomAt(c);
+        }
+        if (appliedMask.size() != commandRoom.size()) appliedMask.assign(commandRoom.size(), 1);
+    }
+
+    // Pièces visibles depuis eye à travers les portails ouverts. Caméra hors
+    // de toute pièce : tout est visible.
+    void update(const glm::vec3& eye, const glm::mat4& viewProj) {
+        portalsTraversed = 0;
+        cameraRoom = roomAt(eye);
+        if (cameraRoom < 0) { visible.assign(rooms.size(), 1); return; }
+        visible.assign(rooms.size(), 0);
+        std::vector<glm::vec4> planes(6);
+        extractFrustumPlanes(viewProj, planes.data());
+        visit((uint32_t)cameraRoom, planes, eye, 0xffffffffu, 0);
+    }
+
+    void visit(uint32_t room, const std::vector<glm::vec4>& planes, const glm::vec3& eye, uint32_t from, int depth) {
+        visible[room] = 1;
+        if (depth >= MAX_DEPTH) return;
+        for (uint32_t p : roomPortals[room]) {
+            if (p == from) continue;
+            const BuildingPortal& portal = portals[p];
+            uint32_t next = portal.rooms[0] == room ? portal.rooms[1] : portal.rooms[0];
+            glm::vec3 n = portal.rooms[0] == room ? portal.normal : -portal.normal; // vers la pièce suivante
+            float eyeDistance = glm::dot(n, eye - portal.corners[0]);
+            if (eyeDistance > 0.0f) continue; // portail vu de l'autre côté
+
+            std::vector<glm::vec3> polygon(portal.corners, portal.corners + 4);
+            // Caméra dans l'embrasure : le portail n'a plus de forme utile, la pièce
+            // suivante est vue avec le frustum courant
+            if (eyeDistance > -0.05f) {
+                glm::vec3 q = eye - n * eyeDistance; // projeté sur le plan du portail
+                bool inFrame = true;
+                for (int k = 0; k < 3; ++k) {
+                    float lo = std::min(portal.corners[0][k], portal.corners[2][k]);
+                    float hi = std::max(portal.corners[0][k], portal.corners[2][k]);
+                    inFrame = inFrame && q[k] >= lo - 0.05f && q[k] <= hi + 0.05f;
+                }
+                if (inFrame) {
+                    ++portalsTraversed;
+                    visit(next, planes, eye, p, depth + 1);
+                    continue;
+                }
+            }
+            for (auto const& plane : planes) {
+                clipPolygon(polygon, plane);
+                if (polygon.size() < 3) break;
+            }
+            if (polygon.size() < 3) continue;
+
+            // Nouveau frustum : un plan par bord du portail découpé, plus le plan du portail
+            glm::vec3 centroid(0.0f);
+            for (auto const& v : polygon) centroid += v;
+            centroid /= (float)polygon.size();
+            std::vector<glm::vec4> narrowed;
+            for (size_t i = 0; i < polygon.size(); ++i) {
+                glm::vec3 edgeNormal = glm::cross(polygon[i] - eye, polygon[(i + 1) % polygon.size()] - eye);
+                if (glm::dot(edgeNormal, edgeNormal) < 1e-12f) continue;
+                glm::vec4 plane(edgeNormal, -glm::dot(edgeNormal, eye));
+                if (glm::dot(edgeNormal, centroid) + plane.w < 0.0f) plane = -plane;
+                narrowed.push_back(plane);
+            }
+            narrowed.push_back(glm::vec4(n, -glm::dot(n, portal.corners[0])));
+            ++portalsTraversed;
+            visit(next, narrowed, eye, p, depth + 1);
+        }
+    }
+
+    size_t visibleRoomCount() const {
+        return (size_t)std::count(visible.begin(), visible.end(), (uint8_t)1);
+    }
+
+    // instanceCount 0 dans les commandes source = caché par les portails : le
+    // culling (cull.comp, CpuCulling) l'écarte de la liste de la caméra mais le
+    // garde pour l'ombre. enabled = false remet tout à 1 (mode sans culling).
+    void apply(SceneGpu& gpu, bool enabled) {
+        if (commandRoom.size() != (size_t)gpu.sceneCommandCount) return; // assignCommands pas encore appelé
+        bool changed = false;
+        for (GLsizei i = 0; i < gpu.sceneCommandCount; ++i) {
+            uint8_t show = !enabled || commandRoom[i] < 0 || visible[commandRoom[i]];
+            if (show == appliedMask[i]) continue;
+            appliedMask[i] = show;
+            gpu.commands[i].instanceCount = show;
+            changed = true;
+        }
+        if (changed)
+            glNamedBufferSubData(gpu.indirectBuffer, 0, gpu.sceneCommandCount * sizeof(DrawElementsIndirectCommand),
+                                 gpu.commands.data());
+    }
+};
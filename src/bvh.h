@@ -0,0 +1,717 @@
+#pragma once
+// ============================================================================
+// BVH à 4 branches sur les triangles statiques (SAH, construction parallèle)
+// ============================================================================
+// Les triangles sont d'abord rangés dans un arbre binaire construit par SAH
+// sur 16 intervalles de centroïdes par axe ; les gros sous-arbres sont
+// construits sur des threads séparés (plages disjointes du tableau de
+// références, nœuds réservés par un compteur atomique). L'arbre binaire est
+// ensuite aplati en nœuds à 4 enfants de 128 octets (deux lignes de cache) :
+// les boîtes des enfants sont en SoA, un rayon les teste toutes les 4 d'un coup
+// (SSE) et un paquet de 8 rayons teste chaque boîte pour les 8 rayons à la fois
+// (AVX, ou deux fois 4 en SSE). Les triangles sont stockés dans l'ordre des
+// feuilles, sous la forme de Möller-Trumbore (sommet + deux arêtes).
+
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+#include "transformHierarchy.h"  // TransformHierarchy, DRAW_TRANSFORMS_SSE
+#include "building.h"            // generateRoomGeometry, generateWindowGeometry
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+const uint32_t BVH_BINS = 16;
+const uint32_t BVH_MAX_LEAF = 8;            // triangles max par feuille
+const uint32_t BVH_MAX_DEPTH = 48;          // au-delà, coupe à la médiane (profondeur bornée)
+const uint32_t BVH_PARALLEL_MIN = 16384;    // triangles min d'un sous-arbre confié à un thread
+const uint32_t BVH_STACK_SIZE = 256;
+const float BVH_TRAVERSAL_COST = 1.0f;      // coût d'un nœud, relatif à un test de triangle
+const uint32_t BVH_LEAF = 0x80000000u;      // Bvh4Node::child : feuille, bits faibles = premier triangle
+const uint32_t BVH_EMPTY = 0xffffffffu;     // Bvh4Node::child : emplacement inutilisé
+const uint32_t BVH_NO_HIT = 0xffffffffu;
+
+struct alignas(64) Bvh4Node {
+    float minX[4], minY[4], minZ[4];
+    float maxX[4], maxY[4], maxZ[4];
+    uint32_t child[4];  // indice de nœud, BVH_LEAF | premier triangle, ou BVH_EMPTY
+    uint32_t count[4];  // triangles de la feuille
+};
+static_assert(sizeof(Bvh4Node) == 128, "a BVH4 node must fill two cache lines");
+
+struct BvhTriangle {
+    float v0[3], e1[3], e2[3];
+    uint32_t id;  // indice du triangle dans les indices passés à build()
+};
+
+struct BvhRay {
+    glm::vec3 origin;
+    glm::vec3 direction;  // pas forcément normalisée : t est en unités de direction
+    float tMax;
+};
+
+struct BvhHit {
+    float t;
+    uint32_t triangle;  // BvhTriangle::id, ou BVH_NO_HIT
+    float u, v;         // coordonnées barycentriques
+};
+
+// Paquet de 8 rayons en SoA
+struct BvhRayPacket8 {
+    alignas(32) float originX[8];
+    alignas(32) float originY[8];
+    alignas(32) float originZ[8];
+    alignas(32) float dirX[8];
+    alignas(32) float dirY[8];
+    alignas(32) float dirZ[8];
+    alignas(32) float tMax[8];
+};
+
+struct BvhHitPacket8 {
+    alignas(32) float t[8];
+    uint32_t triangle[8];
+    float u[8], v[8];
+};
+
+// ----------------------------------------------------------------------------
+// Groupe de rayons traité d'un coup dans un paquet (8 en AVX, 4 en SSE, 1 sinon)
+// ----------------------------------------------------------------------------
+#if defined(__AVX__)
+struct BvhLanes {
+    static const int WIDTH = 8;
+    __m256 v;
+    static BvhLanes load(const float* p) { return {_mm256_load_ps(p)}; }
+    static BvhLanes set(float s) { return {_mm256_set1_ps(s)}; }
+    void store(float* p) const { _mm256_store_ps(p, v); }
+    friend BvhLanes operator+(BvhLanes a, BvhLanes b) { return {_mm256_add_ps(a.v, b.v)}; }
+    friend BvhLanes operator-(BvhLanes a, BvhLanes b) { return {_mm256_sub_ps(a.v, b.v)}; }
+    friend BvhLanes operator*(BvhLanes a, BvhLanes b) { return {_mm256_mul_ps(a.v, b.v)}; }
+    friend BvhLanes operator/(BvhLanes a, BvhLanes b) { return {_mm256_div_ps(a.v, b.v)}; }
+    friend BvhLanes min(BvhLanes a, BvhLanes b) { return {_mm256_min_ps(a.v, b.v)}; }
+    friend BvhLanes max(BvhLanes a, BvhLanes b) { return {_mm256_max_ps(a.v, b.v)}; }
+    friend uint32_t lessEqual(BvhLanes a, BvhLanes b) { return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)); }
+    friend uint32_t less(BvhLanes a, BvhLanes b) { return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)); }
+};
+#elif defined(DRAW_TRANSFORMS_SSE)
+struct BvhLanes {
+    static const int WIDTH = 4;
+    __m128 v;
+    static BvhLanes load(const float* p) { return {_mm_load_ps(p)}; }
+    static BvhLanes set(float s) { return {_mm_set1_ps(s)}; }
+    void store(float* p) const { _mm_store_ps(p, v); }
+    friend BvhLanes operator+(BvhLanes a, BvhLanes b) { return {_mm_add_ps(a.v, b.v)}; }
+    friend BvhLanes operator-(BvhLanes a, BvhLanes b) { return {_mm_sub_ps(a.v, b.v)}; }
+    friend BvhLanes operator*(BvhLanes a, BvhLanes b) { return {_mm_mul_ps(a.v, b.v)}; }
+    friend BvhLanes operator/(BvhLanes a, BvhLanes b) { return {_mm_div_ps(a.v, b.v)}; }
+    friend BvhLanes min(BvhLanes a, BvhLanes b) { return {_mm_min_ps(a.v, b.v)}; }
+    friend BvhLanes max(BvhLanes a, BvhLanes b) { return {_mm_max_ps(a.v, b.v)}; }
+    friend uint32_t lessEqual(BvhLanes a, BvhLanes b) { return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(a.v, b.v)); }
+    friend uint32_t less(BvhLanes a, BvhLanes b) { return (uint32_t)_mm_movemask_ps(_mm_cmplt_ps(a.v, b.v)); }
+};
+#else
+struct BvhLanes {
+    static const int WIDTH = 1;
+    float v;
+    static BvhLanes load(const float* p) { return {*p}; }
+    static BvhLanes set(float s) { return {s}; }
+    void store(float* p) const { *p = v; }
+    friend BvhLanes operator+(BvhLanes a, BvhLanes b) { return {a.v + b.v}; }
+    friend BvhLanes operator-(BvhLanes a, BvhLanes b) { return {a.v - b.v}; }
+    friend BvhLanes operator*(BvhLanes a, BvhLanes b) { return {a.v * b.v}; }
+    friend BvhLanes operator/(BvhLanes a, BvhLanes b) { return {a.v / b.v}; }
+    friend BvhLanes min(BvhLanes a, BvhLanes b) { return {std::min(a.v, b.v)}; }
+    friend BvhLanes max(BvhLanes a, BvhLanes b) { return {std::max(a.v, b.v)}; }
+    friend uint32_t lessEqual(BvhLanes a, BvhLanes b) { return a.v <= b.v ? 1u : 0u; }
+    friend uint32_t less(BvhLanes a, BvhLanes b) { return a.v < b.v ? 1u : 0u; }
+};
+#endif
+
+// ----------------------------------------------------------------------------
+// Construction (arbre binaire SAH)
+// ----------------------------------------------------------------------------
+struct BvhBounds {
+    glm::vec3 min = glm::vec3(FLT_MAX);
+    glm::vec3 max = glm::vec3(-FLT_MAX);
+
+    void grow(const glm::vec3& p) { min = glm::min(min, p); max = glm::max(max, p); }
+    void grow(const BvhBounds& b) { min = glm::min(min, b.min); max = glm::max(max, b.max); }
+    float area() const {
+        glm::vec3 e = max - min;
+        return e.x < 0.0f ? 0.0f : e.x * e.y + e.y * e.z + e.z * e.x;
+    }
+};
+
+struct BvhBuildRef {
+    BvhBounds bounds;
+    glm::vec3 centroid;
+    uint32_t triangle;
+};
+
+struct BvhBuildNode {
+    BvhBounds bounds;
+    uint32_t first, count;  // plage de références (feuille)
+    uint32_t left;          // enfants left et left + 1, ou BVH_EMPTY pour une feuille
+};
+
+struct BvhBuilder {
+    std::vector<BvhBuildRef>& refs;
+    std::vector<BvhBuildNode>& nodes;
+    std::atomic<uint32_t> nodeCount{1};
+    uint32_t parallelDepth = 0;  // profondeur jusqu'à laquelle un sous-arbre part sur un thread
+
+    BvhBuilder(std::vector<BvhBuildRef>& r, std::vector<BvhBuildNode>& n) : refs(r), nodes(n) {}
+
+    static uint32_t binOf(float c, float lo, float scale) {
+        return std::min((uint32_t)((c - lo) * scale), BVH_BINS - 1);
+    }
+
+    void build(uint32_t nodeIndex, uint32_t first, uint32_t count, uint32_t depth) {
+        BvhBounds bounds, centroids;
+        for (uint32_t i = first; i < first + count; ++i) {
+            bounds.grow(refs[i].bounds);
+            centroids.grow(refs[i].centroid);
+        }
+        BvhBuildNode& node = nodes[nodeIndex];
+        node.bounds = bounds;
+        node.first = first;
+        node.count = count;
+        node.left = BVH_EMPTY;
+        if (count <= 1) return;
+
+        // Meilleure coupe entre intervalles, sur les 3 axes
+        int bestAxis = -1;
+        uint32_t bestBin = 0;
+        float bestCost = FLT_MAX;
+        for (int axis = 0; axis < 3 && depth < BVH_MAX_DEPTH; ++axis) {
+            float lo = centroids.min[axis];
+            float extent = centroids.max[axis] - lo;
+            if (extent <= 1e-12f) continue;
+            float scale = (float)BVH_BINS / extent;
+            BvhBounds bins[BVH_BINS];
+            uint32_t binCounts[BVH_BINS] = {};
+            for (uint32_t i = first; i < first + count; ++i) {
+                uint32_t b = binOf(refs[i].centroid[axis], lo, scale);
+                bins[b].grow(refs[i].bounds);
+                ++binCounts[b];
+            }
+            float rightArea[BVH_BINS];
+            uint32_t rightCount[BVH_BINS];
+            BvhBounds side;
+            uint32_t n = 0;
+            for (uint32_t b = BVH_BINS - 1; b > 0; --b) {
+                side.grow(bins[b]);
+                n += binCounts[b];
+                rightArea[b] = side.area();
+                rightCount[b] = n;
+            }
+            side = BvhBounds();
+            n = 0;
+            for (uint32_t b = 0; b + 1 < BVH_BINS; ++b) {
+                side.grow(bins[b]);
+                n += binCounts[b];
+                if (n == 0 || rightCount[b + 1] == 0) continue;
+                float cost = side.area() * (float)n + rightArea[b + 1] * (float)rightCount[b + 1];
+                if (cost < bestCost) { bestCost = cost; bestAxis = axis; bestBin = b + 1; }
+            }
+        }
+
+        // SAH : coupe si elle coûte moins que de tester tous les triangles de la feuille
+        bool worthSplitting = bestAxis >= 0 && BVH_TRAVERSAL_COST * bounds.area() + bestCost < (float)count * bounds.area();
+        if (!worthSplitting && count <= BVH_MAX_LEAF) return;
+
+        BvhBuildRef* begin = refs.data() + first;
+        BvhBuildRef* end = begin + count;
+        uint32_t middle;
+        if (bestAxis >= 0) {
+            float lo = centroids.min[bestAxis];
+            float scale = (float)BVH_BINS / (centroids.max[bestAxis] - lo);
+            middle = first + (uint32_t)(std::partition(begin, end, [&](const BvhBuildRef& r) {
+                return binOf(r.centroid[bestAxis], lo, scale) < bestBin;
+            }) - begin);
+        } else {
+            // Centroïdes confondus ou arbre trop profond : médiane sur l'axe le plus long
+            glm::vec3 e = centroids.max - centroids.min;
+            int axis = e.x > e.y && e.x > e.z ? 0 : (e.y > e.z ? 1 : 2);
+            middle = first + count / 2;
+            std::nth_element(begin, refs.data() + middle, end, [axis](const BvhBuildRef& a, const BvhBuildRef& b) {
+                return a.centroid[axis] < b.centroid[axis];
+            });
+        }
+
+        uint32_t left = nodeCount.fetch_add(2);
+        node.left = left;
+        if (count >= BVH_PARALLEL_MIN && depth < parallelDepth) {
+            std::thread worker([=] { build(left, first, middle - first, depth + 1); });
+            build(left + 1, middle, first + count - middle, depth + 1);
+            worker.join();
+        } else {
+            build(left, first, middle - first, depth + 1);
+            build(left + 1, middle, first + count - middle, depth + 1);
+        }
+    }
+};
+
+// ----------------------------------------------------------------------------
+// BVH à 4 branches
+// ----------------------------------------------------------------------------
+struct Bvh {
+    std::vector<Bvh4Node> nodes;        // nodes[0] : racine
+    std::vector<BvhTriangle> triangles; // ordre des feuilles
+
+    // positions : sommets monde ; indices : 3 par triangle. threadCount = 1 : construction séquentielle
+    void build(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices,
+               uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency())) {
+        nodes.clear();
+        triangles.clear();
+        uint32_t triangleCount = (uint32_t)(indices.size() / 3);
+        if (triangleCount == 0) return;
+
+        std::vector<BvhBuildRef> refs(triangleCount);
+        for (uint32_t t = 0; t < triangleCount; ++t) {
+            BvhBuildRef& r = refs[t];
+            for (int k = 0; k < 3; ++k) r.bounds.grow(positions[indices[3 * t + k]]);
+            r.centroid = (r.bounds.min + r.bounds.max) * 0.5f;
+            r.triangle = t;
+        }
+
+        std::vector<BvhBuildNode> buildNodes(2 * (size_t)triangleCount);
+        BvhBuilder builder(refs, buildNodes);
+        while ((1u << builder.parallelDepth) < threadCount) ++builder.parallelDepth;
+        if (threadCount > 1) ++builder.parallelDepth; // coupes SAH déséquilibrées : deux tâches par cœur
+        builder.build(0, 0, triangleCount, 0);
+
+        triangles.resize(triangleCount);
+        for (uint32_t i = 0; i < triangleCount; ++i) {
+            uint32_t t = refs[i].triangle;
+            const glm::vec3& a = positions[indices[3 * t]];
+            glm::vec3 e1 = positions[indices[3 * t + 1]] - a;
+            glm::vec3 e2 = positions[indices[3 * t + 2]] - a;
+            BvhTriangle& tri = triangles[i];
+            for (int k = 0; k < 3; ++k) { tri.v0[k] = a[k]; tri.e1[k] = e1[k]; tri.e2[k] = e2[k]; }
+            tri.id = t;
+        }
+        nodes.reserve(buildNodes.size() / 3 + 1);
+        collapse(buildNodes, 0);
+    }
+
+    size_t memoryBytes() const { return nodes.size() * sizeof(Bvh4Node) + triangles.size() * sizeof(BvhTriangle); }
+
+    // Premier triangle touché dans ]0, ray.tMax[
+    bool intersect(const BvhRay& ray, BvhHit& hit) const {
+        hit.t = ray.tMax;
+        hit.triangle = BVH_NO_HIT;
+        if (nodes.empty()) return false;
+        const float o[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+        const float d[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+        const float inv[3] = { 1.0f / d[0], 1.0f / d[1], 1.0f / d[2] };
+
+        struct Entry { uint32_t child, count; float tNear; };
+        Entry stack[BVH_STACK_SIZE];
+        int top = 0;
+        stack[top++] = { 0, 0, 0.0f };
+        while (top > 0) {
+            Entry e = stack[--top];
+            if (e.tNear > hit.t) continue;
+            if (e.child & BVH_LEAF) {
+                for (uint32_t i = e.child & ~BVH_LEAF, last = i + e.count; i < last; ++i)
+                    intersectTriangle(triangles[i], o, d, hit);
+                continue;
+            }
+            const Bvh4Node& n = nodes[e.child];
+            float tNear[4];
+            uint32_t mask = intersectChildren(n, o, inv, hit.t, tNear);
+            // Du plus loin au plus proche sur la pile : le plus proche sort en premier
+            Entry hits[4];
+            int hitCount = 0;
+            for (int k = 0; k < 4; ++k) {
+                if (!(mask & (1u << k)) || n.child[k] == BVH_EMPTY) continue;
+                Entry h = { n.child[k], n.count[k], tNear[k] };
+                int j = hitCount++;
+                for (; j > 0 && hits[j - 1].tNear < h.tNear; --j) hits[j] = hits[j - 1];
+                hits[j] = h;
+            }
+            for (int k = 0; k < hitCount; ++k) stack[top++] = hits[k];
+        }
+        return hit.triangle != BVH_NO_HIT;
+    }
+
+    // 8 rayons à la fois : chaque nœud n'est lu qu'une fois pour tout le paquet
+    void intersect8(const BvhRayPacket8& packet, BvhHitPacket8& hit) const {
+        alignas(32) float inv[3][8];
+        for (int i = 0; i < 8; ++i) {
+            hit.t[i] = packet.tMax[i];
+            hit.triangle[i] = BVH_NO_HIT;
+            inv[0][i] = 1.0f / packet.dirX[i];
+            inv[1][i] = 1.0f / packet.dirY[i];
+            inv[2][i] = 1.0f / packet.dirZ[i];
+        }
+        if (nodes.empty()) return;
+
+        struct Entry { uint32_t child, count, lanes; };
+        Entry stack[BVH_STACK_SIZE];
+        int top = 0;
+        stack[top++] = { 0, 0, 0xffu };
+        while (top > 0) {
+            Entry e = stack[--top];
+            if (e.child & BVH_LEAF) {
+                for (uint32_t i = e.child & ~BVH_LEAF, last = i + e.count; i < last; ++i)
+                    intersectTrianglePacket(triangles[i], packet, e.lanes, hit);
+                continue;
+            }
+            const Bvh4Node& n = nodes[e.child];
+            struct Hit { Entry entry; float tNear; };
+            Hit hits[4];
+            int hitCount = 0;
+            for (int k = 0; k < 4; ++k) {
+                if (n.child[k] == BVH_EMPTY) continue;
+                float tNear;
+                uint32_t lanes = boxPacket(n, k, packet, inv, e.lanes, hit, tNear);
+                if (!lanes) continue;
+                Hit h = { { n.child[k], n.count[k], lanes }, tNear };
+                int j = hitCount++;
+                for (; j > 0 && hits[j - 1].tNear < h.tNear; --j) hits[j] = hits[j - 1];
+                hits[j] = h;
+            }
+            for (int k = 0; k < hitCount; ++k) stack[top++] = hits[k].entry;
+        }
+    }
+
+private:
+    // Aplatit l'arbre binaire : chaque nœud à 4 branches ouvre ses enfants
+    // internes de plus grande surface jusqu'à avoir 4 enfants
+    uint32_t collapse(const std::vector<BvhBuildNode>& build, uint32_t index) {
+        uint32_t children[4];
+        int childCount = 0;
+        if (build[index].left == BVH_EMPTY) children[childCount++] = index;
+        else { children[childCount++] = build[index].left; children[childCount++] = build[index].left + 1; }
+        while (childCount < 4) {
+            int best = -1;
+            float bestArea = -1.0f;
+            for (int c = 0; c < childCount; ++c)
+                if (build[children[c]].left != BVH_EMPTY && build[children[c]].bounds.area() > bestArea) {
+                    bestArea = build[children[c]].bounds.area();
+                    best = c;
+                }
+            if (best < 0) break;
+            uint32_t opened = build[children[best]].left;
+            children[best] = opened;
+            children[childCount++] = opened + 1;
+        }
+
+        uint32_t nodeIndex = (uint32_t)nodes.size();
+        nodes.emplace_back();
+        for (int k = 0; k < 4; ++k) {
+            uint32_t child = BVH_EMPTY, count = 0;
+            BvhBounds b;  // vide : min > max, jamais touchée
+            if (k < childCount) {
+                const BvhBuildNode& c = build[children[k]];
+                b = c.bounds;
+                if (c.left == BVH_EMPTY) { child = BVH_LEAF | c.first; count = c.count; }
+                else child = collapse(build, children[k]);
+            }
+            Bvh4Node& n = nodes[nodeIndex];
+            n.minX[k] = b.min.x; n.minY[k] = b.min.y; n.minZ[k] = b.min.z;
+            n.maxX[k] = b.max.x; n.maxY[k] = b.max.y; n.maxZ[k] = b.max.z;
+            n.child[k] = child;
+            n.count[k] = count;
+        }
+        return nodeIndex;
+    }
+
+    // Masque des 4 boîtes d'un nœud touchées avant tMax (méthode des dalles)
+    static uint32_t intersectChildren(const Bvh4Node& n, const float o[3], const float inv[3], float tMax, float tNear[4]) {
+#ifdef DRAW_TRANSFORMS_SSE
+        __m128 ox = _mm_set1_ps(o[0]), oy = _mm_set1_ps(o[1]), oz = _mm_set1_ps(o[2]);
+        __m128 ix = _mm_set1_ps(inv[0]), iy = _mm_set1_ps(inv[1]), iz = _mm_set1_ps(inv[2]);
+        __m128 t0x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.minX), ox), ix);
+        __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.maxX), ox), ix);
+        __m128 t0y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.minY), oy), iy);
+        __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.maxY), oy), iy);
+        __m128 t0z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.minZ), oz), iz);
+        __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.maxZ), oz), iz);
+        __m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(t0x, t1x), _mm_min_ps(t0y, t1y)),
+                                  _mm_max_ps(_mm_min_ps(t0z, t1z), _mm_setzero_ps()));
+        __m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(t0x, t1x), _mm_max_ps(t0y, t1y)),
+                                 _mm_min_ps(_mm_max_ps(t0z, t1z), _mm_set1_ps(tMax)));
+        _mm_storeu_ps(tNear, enter);
+        return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(enter, exit));
+#else
+        uint32_t mask = 0;
+        for (int k = 0; k < 4; ++k) {
+            float t0x = (n.minX[k] - o[0]) * inv[0], t1x = (n.maxX[k] - o[0]) * inv[0];
+            float t0y = (n.minY[k] - o[1]) * inv[1], t1y = (n.maxY[k] - o[1]) * inv[1];
+            float t0z = (n.minZ[k] - o[2]) * inv[2], t1z = (n.maxZ[k] - o[2]) * inv[2];
+            float enter = std::max(std::max(std::min(t0x, t1x), std::min(t0y, t1y)), std::max(std::min(t0z, t1z), 0.0f));
+            float exit = std::min(std::min(std::max(t0x, t1x), std::max(t0y, t1y)), std::min(std::max(t0z, t1z), tMax));
+            tNear[k] = enter;
+            if (enter <= exit) mask |= 1u << k;
+        }
+        return mask;
+#endif
+    }
+
+    static void intersectTriangle(const BvhTriangle& tri, const float o[3], const float d[3], BvhHit& hit) {
+        float p[3] = { d[1] * tri.e2[2] - d[2] * tri.e2[1], d[2] * tri.e2[0] - d[0] * tri.e2[2], d[0] * tri.e2[1] - d[1] * tri.e2[0] };
+        float det = tri.e1[0] * p[0] + tri.e1[1] * p[1] + tri.e1[2] * p[2];
+        if (std::fabs(det) < 1e-12f) return;
+        float invDet = 1.0f / det;
+        float s[3] = { o[0] - tri.v0[0], o[1] - tri.v0[1], o[2] - tri.v0[2] };
+        float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+        if (u < 0.0f || u > 1.0f) return;
+        float q[3] = { s[1] * tri.e1[2] - s[2] * tri.e1[1], s[2] * tri.e1[0] - s[0] * tri.e1[2], s[0] * tri.e1[1] - s[1] * tri.e1[0] };
+        float v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * invDet;
+        if (v < 0.0f || u + v > 1.0f) return;
+        float t = (tri.e2[0] * q[0] + tri.e2[1] * q[1] + tri.e2[2] * q[2]) * invDet;
+        if (t <= 0.0f || t >= hit.t) return;
+        hit.t = t;
+        hit.triangle = tri.id;
+        hit.u = u;
+        hit.v = v;
+    }
+
+    // Rayons actifs (lanes) du paquet qui entrent dans la boîte k avant leur t courant ;
+    // tNear : plus petite distance d'entrée parmi eux (ordre de parcours)
+    static uint32_t boxPacket(const Bvh4Node& n, int k, const BvhRayPacket8& p, const float inv[3][8],
+                              uint32_t lanes, const BvhHitPacket8& hit, float& tNear) {
+        BvhLanes minX = BvhLanes::set(n.minX[k]), minY = BvhLanes::set(n.minY[k]), minZ = BvhLanes::set(n.minZ[k]);
+        BvhLanes maxX = BvhLanes::set(n.maxX[k]), maxY = BvhLanes::set(n.maxY[k]), maxZ = BvhLanes::set(n.maxZ[k]);
+        alignas(32) float enterTimes[8];
+        uint32_t mask = 0;
+        for (int base = 0; base < 8; base += BvhLanes::WIDTH) {
+            BvhLanes ox = BvhLanes::load(p.originX + base), ix = BvhLanes::load(inv[0] + base);
+            BvhLanes oy = BvhLanes::load(p.originY + base), iy = BvhLanes::load(inv[1] + base);
+            BvhLanes oz = BvhLanes::load(p.originZ + base), iz = BvhLanes::load(inv[2] + base);
+            BvhLanes t0x = (minX - ox) * ix, t1x = (maxX - ox) * ix;
+            BvhLanes t0y = (minY - oy) * iy, t1y = (maxY - oy) * iy;
+            BvhLanes t0z = (minZ - oz) * iz, t1z = (maxZ - oz) * iz;
+            BvhLanes enter = max(max(min(t0x, t1x), min(t0y, t1y)), max(min(t0z, t1z), BvhLanes::set(0.0f)));
+            BvhLanes exit = min(min(max(t0x, t1x), max(t0y, t1y)), min(max(t0z, t1z), BvhLanes::load(hit.t + base)));
+            enter.store(enterTimes + base);
+            mask |= lessEqual(enter, exit) << base;
+        }
+        mask &= lanes;
+        tNear = FLT_MAX;
+        for (uint32_t m = mask; m; m &= m - 1) tNear = std::min(tNear, enterTimes[__builtin_ctz(m)]);
+        return mask;
+    }
+
+    static void intersectTrianglePacket(const BvhTriangle& tri, const BvhRayPacket8& p, uint32_t lanes, BvhHitPacket8& hit) {
+        BvhLanes v0x = BvhLanes::set(tri.v0[0]), v0y = BvhLanes::set(tri.v0[1]), v0z = BvhLanes::set(tri.v0[2]);
+        BvhLanes e1x = BvhLanes::set(tri.e1[0]), e1y = BvhLanes::set(tri.e1[1]), e1z = BvhLanes::set(tri.e1[2]);
+        BvhLanes e2x = BvhLanes::set(tri.e2[0]), e2y = BvhLanes::set(tri.e2[1]), e2z = BvhLanes::set(tri.e2[2]);
+        BvhLanes zero = BvhLanes::set(0.0f), one = BvhLanes::set(1.0f);
+        for (int base = 0; base < 8; base += BvhLanes::WIDTH) {
+            uint32_t active = (lanes >> base) & ((1u << BvhLanes::WIDTH) - 1);
+            if (!active) continue;
+            BvhLanes dx = BvhLanes::load(p.dirX + base), dy = BvhLanes::load(p.dirY + base), dz = BvhLanes::load(p.dirZ + base);
+            BvhLanes px = dy * e2z - dz * e2y, py = dz * e2x - dx * e2z, pz = dx * e2y - dy * e2x;
+            BvhLanes det = e1x * px + e1y * py + e1z * pz;
+            BvhLanes invDet = one / det;
+            BvhLanes sx = BvhLanes::load(p.originX + base) - v0x;
+            BvhLanes sy = BvhLanes::load(p.originY + base) - v0y;
+            BvhLanes sz = BvhLanes::load(p.originZ + base) - v0z;
+            BvhLanes u = (sx * px + sy * py + sz * pz) * invDet;
+            BvhLanes qx = sy * e1z - sz * e1y, qy = sz * e1x - sx * e1z, qz = sx * e1y - sy * e1x;
+            BvhLanes v = (dx * qx + dy * qy + dz * qz) * invDet;
+            BvhLanes t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+            // det nul : invDet infini, u et v NaN, les comparaisons échouent
+            uint32_t mask = active & less(BvhLanes::set(1e-24f), det * det) & lessEqual(zero, u) & lessEqual(zero, v)
+                          & lessEqual(u + v, one) & less(zero, t) & less(t, BvhLanes::load(hit.t + base));
+            if (!mask) continue;
+            alignas(32) float ts[BvhLanes::WIDTH], us[BvhLanes::WIDTH], vs[BvhLanes::WIDTH];
+            t.store(ts);
+            u.store(us);
+            v.store(vs);
+            for (uint32_t m = mask; m; m &= m - 1) {
+                int lane = __builtin_ctz(m);
+                hit.t[base + lane] = ts[lane];
+                hit.triangle[base + lane] = tri.id;
+                hit.u[base + lane] = us[lane];
+                hit.v[base + lane] = vs[lane];
+            }
+        }
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Triangles statiques de la scène
+// ----------------------------------------------------------------------------
+
+// Positions monde des pièces, des vitres et du niveau 0 de chaque objet (même
+// hiérarchie que createSceneGpu : nœud 0 identité, objet i -> nœud 1 + i)
+inline void collectSceneTriangles(const SceneData& scene, std::vector<glm::vec3>& positions, std::vector<uint32_t>& indices) {
+    positions.clear();
+    indices.clear();
+    auto addGeometry = [&](const float* vertices, size_t vertexCount, const uint32_t* meshIndices, size_t indexCount,
+                           const float* m) {
+        uint32_t base = (uint32_t)positions.size();
+        for (size_t v = 0; v < vertexCount; ++v) {
+            const float* p = vertices + v * MESH_VERTEX_FLOATS;
+            positions.push_back(m ? glm::vec3(m[0] * p[0] + m[4] * p[1] + m[8] * p[2] + m[12],
+                                              m[1] * p[0] + m[5] * p[1] + m[9] * p[2] + m[13],
+                                              m[2] * p[0] + m[6] * p[1] + m[10] * p[2] + m[14])
+                                  : glm::vec3(p[0], p[1], p[2]));
+        }
+        // Les triangles dégénérés (places libres des composants des pièces) sont ignorés
+        for (size_t t = 0; t + 2 < indexCount; t += 3) {
+            const uint32_t* tri = meshIndices + t;
+            if (tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2]) continue;
+            for (int k = 0; k < 3; ++k) indices.push_back(base + tri[k]);
+        }
+    };
+
+    std::vector<float> v;
+    std::vector<uint32_t> i;
+    for (size_t r = 0; r < scene.rooms.size(); ++r) {
+        v.clear();
+        i.clear();
+        generateRoomGeometry(scene, (uint32_t)r, v, i);
+        addGeometry(v.data(), v.size() / MESH_VERTEX_FLOATS, i.data(), i.size(), nullptr);
+    }
+    v.clear();
+    i.clear();
+    generateWindowGeometry(scene, v, i);
+    addGeometry(v.data(), v.size() / MESH_VERTEX_FLOATS, i.data(), i.size(), nullptr);
+
+    TransformHierarchy transforms;
+    const float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    transforms.add(TransformHierarchy::NO_PARENT, identity);
+    for (auto const& o : scene.objects)
+        transforms.add(o.parent == SCENE_NO_PARENT ? TransformHierarchy::NO_PARENT : 1 + o.parent, o.local);
+    transforms.update();
+    for (size_t n = 0; n < scene.objects.size(); ++n) {
+        const SceneObject& o = scene.objects[n];
+        if (o.mesh == SCENE_NO_MESH) continue;
+        const SceneMesh& mesh = scene.meshes[o.mesh];
+        addGeometry(scene.vertices.data() + (size_t)mesh.firstVertex * MESH_VERTEX_FLOATS, mesh.vertexCount,
+                    scene.indices.data() + mesh.firstIndex + mesh.lods[0].firstIndex, mesh.lods[0].indexCount,
+                    transforms.world[1 + n].m);
+    }
+}
+
+// Temps de construction (séquentielle / parallèle) et débit de rayons (seuls / paquets de 8)
+inline void benchmarkBvh(const SceneData& scene) {
+    using Clock = std::chrono::high_resolution_clock;
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+    collectSceneTriangles(scene, positions, indices);
+    if (indices.empty() || scene.rooms.empty()) { std::cout << "BVH: empty scene" << std::endl; return; }
+
+    uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+    Bvh bvh;
+    auto timeBuild = [&](uint32_t threadCount) {
+        double best = 1e30;
+        for (int run = 0; run < 5; ++run) {
+            auto start = Clock::now();
+            bvh.build(positions, indices, threadCount);
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    };
+    double serialMs = timeBuild(1);
+    double parallelMs = timeBuild(threads);
+
+    // Rayons cohérents : une caméra 90° au centre de chaque pièce, 4 directions
+    // horizontales, tuiles de 4x2 pixels par paquet. Incohérents : origines et
+    // directions aléatoires dans les pièces.
+    const int RES = 256;
+    std::vector<BvhRayPacket8> coherent, incoherent;
+    for (auto const& room : scene.rooms) {
+        glm::vec3 eye((room.min[0] + room.max[0]) * 0.5f, room.min[1] + 1.6f, (room.min[2] + room.max[2]) * 0.5f);
+        const glm::vec3 forwards[4] = { {0, 0, -1}, {1, 0, 0}, {0, 0, 1}, {-1, 0, 0} };
+        for (auto const& f : forwards) {
+            glm::vec3 right = glm::cross(f, glm::vec3(0, 1, 0)), up(0, 1, 0);
+            for (int ty = 0; ty < RES; ty += 2)
+                for (int tx = 0; tx < RES; tx += 4) {
+                    BvhRayPacket8 p;
+                    for (int lane = 0; lane < 8; ++lane) {
+                        float sx = ((float)(tx + lane % 4) + 0.5f) / RES * 2.0f - 1.0f;
+                        float sy = ((float)(ty + lane / 4) + 0.5f) / RES * 2.0f - 1.0f;
+                        glm::vec3 d = f + right * sx + up * sy;
+                        p.originX[lane] = eye.x; p.originY[lane] = eye.y; p.originZ[lane] = eye.z;
+                        p.dirX[lane] = d.x; p.dirY[lane] = d.y; p.dirZ[lane] = d.z;
+                        p.tMax[lane] = FLT_MAX;
+                    }
+                    coherent.push_back(p);
+                }
+        }
+    }
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::normal_distribution<float> gauss;
+    incoherent.resize(coherent.size());
+    for (auto& p : incoherent)
+        for (int lane = 0; lane < 8; ++lane) {
+            const SceneRoom& room = scene.rooms[rng() % scene.rooms.size()];
+            p.originX[lane] = room.min[0] + (room.max[0] - room.min[0]) * unit(rng);
+            p.originY[lane] = room.min[1] + (room.max[1] - room.min[1]) * unit(rng);
+            p.originZ[lane] = room.min[2] + (room.max[2] - room.min[2]) * unit(rng);
+            p.dirX[lane] = gauss(rng); p.dirY[lane] = gauss(rng); p.dirZ[lane] = gauss(rng);
+            p.tMax[lane] = FLT_MAX;
+        }
+
+    std::vector<float> singleT(coherent.size() * 8), packetT(coherent.size() * 8);
+    auto timeRays = [&](const std::vector<BvhRayPacket8>& rays, bool packets, std::vector<float>& t) {
+        double best = 1e30;
+        for (int run = 0; run < 3; ++run) {
+            auto start = Clock::now();
+            for (size_t r = 0; r < rays.size(); ++r) {
+                const BvhRayPacket8& p = rays[r];
+                if (packets) {
+                    BvhHitPacket8 hit;
+                    bvh.intersect8(p, hit);
+                    for (int lane = 0; lane < 8; ++lane) t[8 * r + lane] = hit.t[lane];
+                } else {
+                    for (int lane = 0; lane < 8; ++lane) {
+                        BvhRay ray = { glm::vec3(p.originX[lane], p.originY[lane], p.originZ[lane]),
+                                       glm::vec3(p.dirX[lane], p.dirY[lane], p.dirZ[lane]), p.tMax[lane] };
+                        BvhHit hit;
+                        bvh.intersect(ray, hit);
+                        t[8 * r + lane] = hit.t;
+                    }
+                }
+            }
+            best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+        }
+        return (double)rays.size() * 8.0 / best * 1e-6;
+    };
+    size_t mismatches = 0;
+    auto compare = [&] {
+        for (size_t i = 0; i < singleT.size(); ++i)
+            if (std::fabs(singleT[i] - packetT[i]) > 1e-4f * std::max(1.0f, singleT[i])) ++mismatches;
+    };
+    double coherentSingle = timeRays(coherent, false, singleT);
+    double coherentPacket = timeRays(coherent, true, packetT);
+    compare();
+    double incoherentSingle = timeRays(incoherent, false, singleT);
+    double incoherentPacket = timeRays(incoherent, true, packetT);
+    compare();
+
+#if defined(__AVX__)
+    const char* simdName = "AVX, 8 rays";
+#elif defined(DRAW_TRANSFORMS_SSE)
+    const char* simdName = "SSE, 4 rays";
+#else
+    const char* simdName = "no SIMD";
+#endif
+    std::cout << "BVH: " << indices.size() / 3 << " triangles, " << bvh.nodes.size() << " nodes ("
+              << bvh.memoryBytes() / 1024 << " KB)" << std::endl;
+    std::cout << "  build serial   : " << serialMs << " ms" << std::endl;
+    std::cout << "  build parallel : " << parallelMs << " ms (" << threads << " threads)" << std::endl;
+    std::cout << "  coherent rays   (" << coherent.size() * 8 << "): single " << coherentSingle
+              << " Mrays/s, packets " << coherentPacket << " Mrays/s (" << simdName << " per test)" << std::endl;
+    std::cout << "  incoherent rays (" << incoherent.size() * 8 << "): single " << incoherentSingle
+              << " Mrays/s, packets " << incoherentPacket << " Mrays/s" << std::endl;
+    if (mismatches)
+        std::cout << "  WARNING: " << mismatches << " packet hits differ from single-ray hits" << std::endl;
+}
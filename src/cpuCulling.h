@@ -0,0 +1,279 @@
+#pragma once
+// ============================================================================
+// Frustum culling sur le CPU (SSE / AVX)
+// ============================================================================
+// Alternative à gpuCulling.h, aussi utilisable pour le LOD et le streaming.
+// Les boîtes monde (centre, demi-taille) sont rangées en SoA : chaque test de
+// plan traite 4 (SSE) ou 8 (AVX) objets à la fois. Même test que cull.comp :
+// une boîte est rejetée si elle est entièrement derrière un des 6 plans.
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <iostream>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "gpuCulling.h"          // extractFrustumPlanes, CullList
+#include "transformHierarchy.h"  // Matrix4, DRAW_TRANSFORMS_SSE
+#include "drawList.h"
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+// Boîtes alignées sur les axes en SoA
+struct CullingBoundsSoA {
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;
+
+    size_t size() const { return centerX.size(); }
+
+    void resize(size_t n) {
+        for (auto* v : { &centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ }) v->resize(n);
+    }
+
+    // Boîte locale transformée par la matrice monde (colonne par colonne)
+    void setTransformed(size_t i, const MeshBounds& local, const Matrix4& world) {
+        const float* m = world.m;
+        float c[3], e[3];
+        for (int k = 0; k < 3; ++k) {
+            c[k] = 0.5f * (local.min[k] + local.max[k]);
+            e[k] = 0.5f * (local.max[k] - local.min[k]);
+        }
+        float wc[3], we[3];
+        for (int r = 0; r < 3; ++r) {
+            wc[r] = m[r] * c[0] + m[4 + r] * c[1] + m[8 + r] * c[2] + m[12 + r];
+            we[r] = std::fabs(m[r]) * e[0] + std::fabs(m[4 + r]) * e[1] + std::fabs(m[8 + r]) * e[2];
+        }
+        centerX[i] = wc[0]; centerY[i] = wc[1]; centerZ[i] = wc[2];
+        extentX[i] = we[0]; extentY[i] = we[1]; extentZ[i] = we[2];
+    }
+};
+
+// Version de référence, un objet à la fois
+inline size_t cullBoundsScalar(const CullingBoundsSoA& b, const glm::vec4 planes[6], uint8_t* visible) {
+    size_t count = 0;
+    for (size_t i = 0; i < b.size(); ++i) {
+        bool inside = true;
+        for (int p = 0; p < 6 && inside; ++p) {
+            float d = planes[p].x * b.centerX[i] + planes[p].y * b.centerY[i] + planes[p].z * b.centerZ[i] + planes[p].w;
+            float r = std::fabs(planes[p].x) * b.extentX[i] + std::fabs(planes[p].y) * b.extentY[i]
+                    + std::fabs(planes[p].z) * b.extentZ[i];
+            inside = d + r >= 0.0f;
+        }
+        visible[i] = inside ? 1 : 0;
+        count += visible[i];
+    }
+    return count;
+}
+
+// visible[i] = 1 si la boîte i touche le frustum ; renvoie le nombre de boîtes visibles
+inline size_t cullBounds(const CullingBoundsSoA& b, const glm::vec4 planes[6], uint8_t* visible) {
+    size_t n = b.size();
+    size_t i = 0;
+    size_t count = 0;
+#ifdef __AVX__
+    for (; i + 8 <= n; i += 8) {
+        __m256 cx = _mm256_loadu_ps(&b.centerX[i]), cy = _mm256_loadu_ps(&b.centerY[i]), cz = _mm256_loadu_ps(&b.centerZ[i]);
+        __m256 ex = _mm256_loadu_ps(&b.extentX[i]), ey = _mm256_loadu_ps(&b.extentY[i]), ez = _mm256_loadu_ps(&b.extentZ[i]);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; ++p) {
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes[p].x), cx),
+                                                   _mm256_mul_ps(_mm256_set1_ps(planes[p].y), cy)),
+                                     _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes[p].z), cz),
+                                                   _mm256_set1_ps(planes[p].w)));
+            __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(std::fabs(planes[p].x)), ex),
+                                                   _mm256_mul_ps(_mm256_set1_ps(std::fabs(planes[p].y)), ey)),
+                                     _mm256_mul_ps(_mm256_set1_ps(std::fabs(planes[p].z)), ez));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(d, r), _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+        int mask = _mm256_movemask_ps(inside);
+        for (int k = 0; k < 8; ++k) {
+            visible[i + k] = (uint8_t)((mask >> k) & 1);
+            count += visible[i + k];
+        }
+    }
+#elif defined(DRAW_TRANSFORMS_SSE)
+    for (; i + 4 <= n; i += 4) {
+        __m128 cx = _mm_loadu_ps(&b.centerX[i]), cy = _mm_loadu_ps(&b.centerY[i]), cz = _mm_loadu_ps(&b.centerZ[i]);
+        __m128 ex = _mm_loadu_ps(&b.extentX[i]), ey = _mm_loadu_ps(&b.extentY[i]), ez = _mm_loadu_ps(&b.extentZ[i]);
+        __m128 inside = _mm_cmpeq_ps(cx, cx); // tout à 1 (les centres ne sont jamais NaN)
+        for (int p = 0; p < 6; ++p) {
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].x), cx),
+                                             _mm_mul_ps(_mm_set1_ps(planes[p].y), cy)),
+                                  _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].z), cz),
+                                             _mm_set1_ps(planes[p].w)));
+            __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::fabs(planes[p].x)), ex),
+                                             _mm_mul_ps(_mm_set1_ps(std::fabs(planes[p].y)), ey)),
+                                  _mm_mul_ps(_mm_set1_ps(std::fabs(planes[p].z)), ez));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(d, r), _mm_setzero_ps()));
+        }
+        int mask = _mm_movemask_ps(inside);
+        for (int k = 0; k < 4; ++k) {
+            visible[i + k] = (uint8_t)((mask >> k) & 1);
+            count += visible[i + k];
+        }
+    }
+#endif
+    // Reste (ou pas de SIMD) : même test, objet par objet
+    for (; i < n; ++i) {
+        bool inside = true;
+        for (int p = 0; p < 6 && inside; ++p) {
+            float d = planes[p].x * b.centerX[i] + planes[p].y * b.centerY[i] + planes[p].z * b.centerZ[i] + planes[p].w;
+            float r = std::fabs(planes[p].x) * b.extentX[i] + std::fabs(planes[p].y) * b.extentY[i]
+                    + std::fabs(planes[p].z) * b.extentZ[i];
+            inside = d + r >= 0.0f;
+        }
+        visible[i] = inside ? 1 : 0;
+        count += visible[i];
+    }
+    return count;
+}
+
+// Mêmes listes que GpuCulling (caméra, lumière) mais construites sur le CPU,
+// puis triées par clé d'état (fillDrawList) avant d'être dessinées.
+// Même choix de niveau de détail que cull.comp (selectMeshLod).
+struct CpuCulling {
+    CullingBoundsSoA bounds;
+    std::vector<float> worldScale; // plus grand facteur d'échelle de la matrice monde
+    std::vector<uint8_t> visible;
+    std::vector<DrawElementsIndirectCommand> visibleCommands; // [0, n) caméra, [n, 2n) lumière
+    std::vector<uint32_t> visibleIndices; // commande d'origine de chaque entrée de visibleCommands
+    std::vector<float> visibleDepths;     // profondeur NDC ramenée dans [0, 1], même rangement
+    GLsizei visibleCount[2] = { 0, 0 };
+    size_t triangleCount[2] = { 0, 0 };
+    GLsizei commandCount = 0;
+
+    void init(GLsizei count) {
+        commandCount = count;
+        bounds.resize(count);
+        worldScale.resize(count);
+        visible.resize(count);
+        visibleCommands.resize(2 * (size_t)count);
+        visibleIndices.resize(2 * (size_t)count);
+        visibleDepths.resize(2 * (size_t)count);
+    }
+
+    // Boîtes monde, à refaire quand la hiérarchie a changé
+    void updateBounds(const std::vector<DrawElementsIndirectCommand>& commands,
+                      const std::vector<MeshRange>& ranges, const TransformHierarchy& transforms) {
+        for (GLsizei i = 0; i < commandCount; ++i) {
+            const Matrix4& world = transforms.world[commands[i].baseInstance];
+            bounds.setTransformed(i, ranges[i].bounds, world);
+            float scale2 = 0.0f;
+            for (int c = 0; c < 3; ++c)
+                scale2 = std::max(scale2, world.m[4 * c] * world.m[4 * c] + world.m[4 * c + 1] * world.m[4 * c + 1]
+                                          + world.m[4 * c + 2] * world.m[4 * c + 2]);
+            worldScale[i] = std::sqrt(scale2);
+        }
+    }
+
+    void cull(const std::vector<DrawElementsIndirectCommand>& commands, const std::vector<MeshRange>& ranges,
+              const glm::mat4& cameraViewProj, const glm::mat4& lightViewProj, const LodSelection& lod) {
+        const glm::mat4* viewProjs[2] = { &cameraViewProj, &lightViewProj };
+        const float thresholds[2] = { lod.thresholdPixels, lod.thresholdPixels * lod.shadowBias };
+        for (int list = 0; list < 2; ++list) {
+            glm::vec4 planes[6];
+            extractFrustumPlanes(*viewProjs[list], planes);
+            cullBounds(bounds, planes, visible.data());
+            DrawElementsIndirectCommand* out = visibleCommands.data() + list * commandCount;
+            uint32_t* outIndices = visibleIndices.data() + list * commandCount;
+            float* outDepths = visibleDepths.data() + list * commandCount;
+            GLsizei n = 0;
+            triangleCount[list] = 0;
+            for (GLsizei i = 0; i < commandCount; ++i) {
+                if (!visible[i]) continue;
+                // instanceCount 0 : pièce cachée par les portails (building.h), ombre seulement
+                if (list == CULL_CAMERA && commands[i].instanceCount == 0) continue;
+                glm::vec3 center(bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i]);
+                glm::vec3 extent(bounds.extentX[i], bounds.extentY[i], bounds.extentZ[i]);
+                // Lumière : distance 1, erreur en texels d'ombre (indépendante de la caméra)
+                uint32_t level = list == CULL_CAMERA
+                    ? selectMeshLod(ranges[i], worldScale[i], lodDistance(lod.cameraPosition, center, extent),
+                                    lod.pixelsPerUnit, thresholds[list])
+                    : selectMeshLod(ranges[i], worldScale[i], 1.0f, lod.shadowTexelsPerUnit, thresholds[list]);
+                DrawElementsIndirectCommand cmd = commands[i];
+                cmd.instanceCount = 1;
+                cmd.firstIndex = ranges[i].lods[level].firstIndex;
+                cmd.count = ranges[i].lods[level].indexCount;
+                triangleCount[list] += cmd.count / 3;
+                // Profondeur du centre : monotone avec la distance, suffisant pour trier
+                glm::vec4 clip = *viewProjs[list] * glm::vec4(center, 1.0f);
+                outDepths[n] = clip.w > 0.0f ? 0.5f * clip.z / clip.w + 0.5f : 0.0f;
+                outIndices[n] = (uint32_t)i;
+                out[n++] = cmd;
+            }
+            visibleCount[list] = n;
+        }
+    }
+
+    // Liste de draws de l'image : passe ombre (liste lumière, programme et flux
+    // de profondeur) et passe opaque (liste caméra, programme de scène), toutes
+    // deux d'avant en arrière. materials : matériau de chaque commande.
+    void fillDrawList(DrawList& drawList, const std::vector<uint32_t>& materials) const {
+        drawList.clear();
+        const DrawPass passes[2] = { DRAW_PASS_OPAQUE, DRAW_PASS_SHADOW };
+        const DrawProgram programs[2] = { DRAW_PROGRAM_SCENE, DRAW_PROGRAM_DEPTH };
+        const uint32_t vaos[2] = { DRAW_VAO_POOL, DRAW_VAO_DEPTH };
+        for (int list : { CULL_LIGHT, CULL_CAMERA }) {
+            size_t offset = (size_t)list * commandCount;
+            for (GLsizei k = 0; k < visibleCount[list]; ++k) {
+                uint32_t command = visibleIndices[offset + k];
+                drawList.add(makeDrawKey(passes[list], programs[list], materials[command], vaos[list],
+                                         visibleDepths[offset + k]),
+                             visibleCommands[offset + k]);
+            }
+        }
+        drawList.sort();
+    }
+};
+
+// --bench-culling : boîtes aléatoires contre le frustum d'une caméra
+inline void benchmarkCulling(size_t objectCount) {
+    using Clock = std::chrono::high_resolution_clock;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.1f, 2.0f);
+
+    CullingBoundsSoA b;
+    b.resize(objectCount);
+    for (size_t i = 0; i < objectCount; ++i) {
+        b.centerX[i] = position(rng); b.centerY[i] = position(rng); b.centerZ[i] = position(rng);
+        b.extentX[i] = size(rng); b.extentY[i] = size(rng); b.extentZ[i] = size(rng);
+    }
+    glm::mat4 viewProj = glm::perspective(glm::radians(90.0f), 16.0f / 9.0f, 0.1f, 100.0f)
+                       * glm::lookAt(glm::vec3(0, 0, 0), glm::vec3(0, 0, -1), glm::vec3(0, 1, 0));
+    glm::vec4 planes[6];
+    extractFrustumPlanes(viewProj, planes);
+    std::vector<uint8_t> visibleScalar(objectCount), visibleSimd(objectCount);
+
+    auto time = [&](auto&& cullFunction, std::vector<uint8_t>& visible, size_t& count) {
+        double best = 1e30;
+        for (int run = 0; run < 5; ++run) {
+            auto start = Clock::now();
+            count = cullFunction(b, planes, visible.data());
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    };
+    size_t scalarCount = 0, simdCount = 0;
+    double scalarMs = time(cullBoundsScalar, visibleScalar, scalarCount);
+    double simdMs = time(cullBounds, visibleSimd, simdCount);
+
+#if defined(__AVX__)
+    const char* simdName = "AVX, 8 objects";
+#elif defined(DRAW_TRANSFORMS_SSE)
+    const char* simdName = "SSE, 4 objects";
+#else
+    const char* simdName = "no SIMD";
+#endif
+    std::cout << "Frustum culling: " << objectCount << " boxes, " << simdCount << " visible" << std::endl;
+    std::cout << "  scalar : " << scalarMs << " ms" << std::endl;
+    std::cout << "  SIMD   : " << simdMs << " ms (" << simdName << " per test)" << std::endl;
+    if (scalarCount != simdCount || visibleScalar != visibleSimd)
+        std::cout << "  WARNING: SIMD and scalar results differ" << std::endl;
+}
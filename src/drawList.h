@@ -0,0 +1,176 @@
+#pragma once
+// ============================================================================
+// Liste de draws triée par clé 64 bits (tri par base, radix sort)
+// ============================================================================
+// Chaque draw reçoit une clé : passe | programme | matériau | VAO | profondeur.
+// Trier les clés regroupe les draws qui partagent le même état : à la
+// soumission, le programme et le VAO ne sont changés que quand le champ change
+// dans la clé, et chaque suite de même état part en un glMultiDrawElementsIndirect.
+// La profondeur est croissante pour les passes opaques (avant -> arrière, le
+// test de profondeur rejette tôt) et inversée pour la passe transparente
+// (arrière -> avant, mélange correct).
+// Les matériaux sont indexés dans le shader (materialTex[32]) : un changement
+// de matériau ne coûte pas d'appel GL ici, il est compté comme le bind de
+// texture qu'il serait dans un renderer classique.
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "meshPool.h" // DrawElementsIndirectCommand
+
+enum DrawPass : uint32_t { DRAW_PASS_SHADOW = 0, DRAW_PASS_OPAQUE = 1, DRAW_PASS_TRANSPARENT = 2 };
+
+// Indices des tables passées à DrawList::submit
+enum DrawProgram : uint32_t { DRAW_PROGRAM_DEPTH = 0, DRAW_PROGRAM_SCENE = 1, DRAW_PROGRAM_COUNT };
+const uint32_t DRAW_VAO_POOL = 0;
+const uint32_t DRAW_VAO_DEPTH = 1; // positions seules (MeshPool::depthVao)
+const uint32_t DRAW_VAO_COUNT = 2;
+
+// Largeur des champs de la clé, du poids fort au poids faible
+const int DRAW_KEY_PASS_BITS = 2;
+const int DRAW_KEY_PROGRAM_BITS = 6;
+const int DRAW_KEY_MATERIAL_BITS = 8;
+const int DRAW_KEY_VAO_BITS = 8;
+const int DRAW_KEY_DEPTH_BITS = 24;
+const int DRAW_KEY_DEPTH_SHIFT = 16; // les 16 bits faibles restent libres
+const int DRAW_KEY_VAO_SHIFT = DRAW_KEY_DEPTH_SHIFT + DRAW_KEY_DEPTH_BITS;
+const int DRAW_KEY_MATERIAL_SHIFT = DRAW_KEY_VAO_SHIFT + DRAW_KEY_VAO_BITS;
+const int DRAW_KEY_PROGRAM_SHIFT = DRAW_KEY_MATERIAL_SHIFT + DRAW_KEY_MATERIAL_BITS;
+const int DRAW_KEY_PASS_SHIFT = DRAW_KEY_PROGRAM_SHIFT + DRAW_KEY_PROGRAM_BITS;
+static_assert(DRAW_KEY_PASS_SHIFT + DRAW_KEY_PASS_BITS == 64, "draw key fields must fill 64 bits");
+
+inline uint64_t drawKeyField(uint64_t key, int shift, int bits) {
+    return (key >> shift) & ((1ull << bits) - 1);
+}
+
+// depth01 : profondeur normalisée dans [0, 1] ; program, material, vao : indices dans
+// les tables de l'appelant (tronqués à la largeur de leur champ)
+inline uint64_t makeDrawKey(DrawPass pass, uint32_t program, uint32_t material, uint32_t vao, float depth01) {
+    float d = std::min(std::max(depth01, 0.0f), 1.0f);
+    uint64_t depth = (uint64_t)(d * (float)((1u << DRAW_KEY_DEPTH_BITS) - 1));
+    if (pass == DRAW_PASS_TRANSPARENT) depth = ((1ull << DRAW_KEY_DEPTH_BITS) - 1) - depth;
+    auto field = [](uint64_t value, int bits, int shift) { return (value & ((1ull << bits) - 1)) << shift; };
+    return field(pass, DRAW_KEY_PASS_BITS, DRAW_KEY_PASS_SHIFT)
+         | field(program, DRAW_KEY_PROGRAM_BITS, DRAW_KEY_PROGRAM_SHIFT)
+         | field(material, DRAW_KEY_MATERIAL_BITS, DRAW_KEY_MATERIAL_SHIFT)
+         | field(vao, DRAW_KEY_VAO_BITS, DRAW_KEY_VAO_SHIFT)
+         | field(depth, DRAW_KEY_DEPTH_BITS, DRAW_KEY_DEPTH_SHIFT);
+}
+
+// Tri par base (LSD, 8 bits par passe, stable). Les octets identiques pour
+// toutes les clés (champs constants, bits libres) sont sautés.
+inline void radixSortDrawKeys(std::vector<uint64_t>& keys, std::vector<uint32_t>& values,
+                              std::vector<uint64_t>& scratchKeys, std::vector<uint32_t>& scratchValues) {
+    size_t n = keys.size();
+    if (n < 2) return;
+    scratchKeys.resize(n);
+    scratchValues.resize(n);
+    uint32_t counts[8][256] = {};
+    for (uint64_t k : keys)
+        for (int b = 0; b < 8; ++b) ++counts[b][(k >> (8 * b)) & 0xff];
+    for (int b = 0; b < 8; ++b) {
+        if (counts[b][(keys[0] >> (8 * b)) & 0xff] == n) continue;
+        uint32_t offsets[256];
+        uint32_t sum = 0;
+        for (int i = 0; i < 256; ++i) { offsets[i] = sum; sum += counts[b][i]; }
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t slot = offsets[(keys[i] >> (8 * b)) & 0xff]++;
+            scratchKeys[slot] = keys[i];
+            scratchValues[slot] = values[i];
+        }
+        keys.swap(scratchKeys);
+        values.swap(scratchValues);
+    }
+}
+
+// Changements d'état d'une liste parcourue dans l'ordre
+struct DrawListStats {
+    size_t programChanges = 0;
+    size_t vaoChanges = 0;
+    size_t materialChanges = 0;
+    size_t multiDraws = 0;   // suites soumises (une par état programme + VAO)
+
+    size_t total() const { return programChanges + vaoChanges + materialChanges; }
+};
+
+inline DrawListStats countDrawStateChanges(const std::vector<uint64_t>& keys) {
+    DrawListStats stats;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto changed = [&](int shift, int bits) {
+            return i == 0 || drawKeyField(keys[i], shift, bits) != drawKeyField(keys[i - 1], shift, bits);
+        };
+        bool pass = changed(DRAW_KEY_PASS_SHIFT, DRAW_KEY_PASS_BITS);
+        bool program = pass || changed(DRAW_KEY_PROGRAM_SHIFT, DRAW_KEY_PROGRAM_BITS);
+        bool vao = pass || changed(DRAW_KEY_VAO_SHIFT, DRAW_KEY_VAO_BITS);
+        stats.programChanges += program;
+        stats.vaoChanges += vao;
+        stats.materialChanges += pass || changed(DRAW_KEY_MATERIAL_SHIFT, DRAW_KEY_MATERIAL_BITS);
+        stats.multiDraws += program || vao;
+    }
+    return stats;
+}
+
+struct DrawList {
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> items;  // indices dans commands
+    std::vector<DrawElementsIndirectCommand> commands;
+    std::vector<DrawElementsIndirectCommand> sortedCommands;
+    std::vector<uint64_t> scratchKeys;
+    std::vector<uint32_t> scratchItems;
+    DrawListStats unsortedStats;  // ordre d'insertion, pour comparaison
+    DrawListStats sortedStats;
+    GLuint buffer = 0;
+    size_t capacity = 0;
+
+    void clear() {
+        keys.clear();
+        items.clear();
+        commands.clear();
+    }
+
+    void add(uint64_t key, const DrawElementsIndirectCommand& command) {
+        keys.push_back(key);
+        items.push_back((uint32_t)commands.size());
+        commands.push_back(command);
+    }
+
+    // Tri, puis envoi des commandes dans l'ordre trié (un seul tampon pour toutes les passes)
+    void sort() {
+        unsortedStats = countDrawStateChanges(keys);
+        radixSortDrawKeys(keys, items, scratchKeys, scratchItems);
+        sortedStats = countDrawStateChanges(keys);
+        sortedCommands.resize(items.size());
+        for (size_t i = 0; i < items.size(); ++i) sortedCommands[i] = commands[items[i]];
+
+        if (sortedCommands.size() > capacity) {
+            if (buffer) glDeleteBuffers(1, &buffer);
+            capacity = std::max<size_t>(sortedCommands.size(), 2 * capacity);
+            glCreateBuffers(1, &buffer);
+            glNamedBufferStorage(buffer, capacity * sizeof(DrawElementsIndirectCommand), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        }
+        if (!sortedCommands.empty())
+            glNamedBufferSubData(buffer, 0, sortedCommands.size() * sizeof(DrawElementsIndirectCommand), sortedCommands.data());
+    }
+
+    // Soumet les draws d'une passe : programs et vaos sont les tables indexées par les clés
+    void submit(DrawPass pass, const GLuint* programs, const GLuint* vaos) const {
+        auto first = std::lower_bound(keys.begin(), keys.end(), (uint64_t)pass << DRAW_KEY_PASS_SHIFT);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer);
+        for (size_t i = (size_t)(first - keys.begin()); i < keys.size();) {
+            if (drawKeyField(keys[i], DRAW_KEY_PASS_SHIFT, DRAW_KEY_PASS_BITS) != pass) break;
+            uint64_t program = drawKeyField(keys[i], DRAW_KEY_PROGRAM_SHIFT, DRAW_KEY_PROGRAM_BITS);
+            uint64_t vao = drawKeyField(keys[i], DRAW_KEY_VAO_SHIFT, DRAW_KEY_VAO_BITS);
+            size_t end = i + 1;
+            while (end < keys.size() && drawKeyField(keys[end], DRAW_KEY_PASS_SHIFT, DRAW_KEY_PASS_BITS) == pass
+                   && drawKeyField(keys[end], DRAW_KEY_PROGRAM_SHIFT, DRAW_KEY_PROGRAM_BITS) == program
+                   && drawKeyField(keys[end], DRAW_KEY_VAO_SHIFT, DRAW_KEY_VAO_BITS) == vao) ++end;
+            glUseProgram(programs[program]);
+            glBindVertexArray(vaos[vao]);
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                        (const void*)(uintptr_t)(i * sizeof(DrawElementsIndirectCommand)),
+                                        (GLsizei)(end - i), 0);
+            i = end;
+        }
+    }
+};
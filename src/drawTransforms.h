@@ -0,0 +1,111 @@
+#pragma once
+// ============================================================================
+// Transformations par draw (matrice modèle + matrice des normales)
+// ============================================================================
+// Les matrices sont constantes pendant un draw : on les calcule une seule fois
+// côté CPU (SSE) au lieu de faire mat3(transpose(inverse(model))) pour chaque
+// sommet. Elles sont rangées dans un SSBO (binding 0) que le vertex shader
+// indexe avec l'identifiant du draw, passé comme baseInstance.
+
+#include <vector>
+#include <cstring>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define DRAW_TRANSFORMS_SSE 1
+#endif
+
+const GLuint DRAW_TRANSFORM_BINDING = 0; // layout(std430, binding = 0) dans les shaders
+
+// Même disposition que le struct GLSL en std430 :
+// mat4 model (64 octets) + mat3 normalMatrix (3 colonnes vec4 = 48 octets)
+struct DrawTransform {
+    float model[16];
+    float normal[12];
+};
+static_assert(sizeof(DrawTransform) == 112, "DrawTransform must match the std430 layout");
+
+#ifdef DRAW_TRANSFORMS_SSE
+inline __m128 cross3(__m128 a, __m128 b) {
+    __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+    return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+// Produit scalaire sur x,y,z (la composante w de b doit être nulle), diffusé sur les 4 voies
+inline __m128 dot3(__m128 a, __m128 b) {
+    __m128 p = _mm_mul_ps(a, b);
+    __m128 s = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+#endif
+
+// Matrice des normales = transpose(inverse(mat3(model))).
+// Pour des colonnes a, b, c elle vaut [b×c, c×a, a×b] / det.
+// models : count matrices de 16 floats consécutives (glm::mat4 ou Matrix4)
+inline void computeDrawTransforms(const float* models, DrawTransform* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const float* m = models + 16 * i;
+        std::memcpy(out[i].model, m, sizeof(out[i].model));
+#ifdef DRAW_TRANSFORMS_SSE
+        __m128 a = _mm_loadu_ps(m + 0);
+        __m128 b = _mm_loadu_ps(m + 4);
+        __m128 c = _mm_loadu_ps(m + 8);
+        __m128 bc = cross3(b, c);
+        __m128 ca = cross3(c, a);
+        __m128 ab = cross3(a, b);
+        __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), dot3(a, bc));
+        _mm_storeu_ps(out[i].normal + 0, _mm_mul_ps(bc, invDet));
+        _mm_storeu_ps(out[i].normal + 4, _mm_mul_ps(ca, invDet));
+        _mm_storeu_ps(out[i].normal + 8, _mm_mul_ps(ab, invDet));
+#else
+        glm::vec3 a(m[0], m[1], m[2]), b(m[4], m[5], m[6]), c(m[8], m[9], m[10]);
+        glm::vec3 cols[3] = { glm::cross(b, c), glm::cross(c, a), glm::cross(a, b) };
+        float invDet = 1.0f / glm::dot(a, cols[0]);
+        for (int k = 0; k < 3; ++k) {
+            out[i].normal[k * 4 + 0] = cols[k].x * invDet;
+            out[i].normal[k * 4 + 1] = cols[k].y * invDet;
+            out[i].normal[k * 4 + 2] = cols[k].z * invDet;
+            out[i].normal[k * 4 + 3] = 0.0f;
+        }
+#endif
+    }
+}
+
+// SSBO des transformations, réécrit uniquement quand les matrices changent
+struct DrawTransformBuffer {
+    GLuint buffer = 0;
+    size_t capacity = 0;
+    std::vector<DrawTransform> records;
+
+    void upload(std::vector<glm::mat4> const& models) {
+        if (!models.empty()) uploadRange(glm::value_ptr(models[0]), models.size(), 0, models.size());
+    }
+
+    // Seules les matrices [begin, end) ont changé : on ne recalcule et n'envoie
+    // qu'elles (tout est envoyé quand le buffer doit grandir)
+    void uploadRange(const float* models, size_t count, size_t begin, size_t end) {
+        records.resize(count);
+        bool grow = count > capacity;
+        if (grow) { begin = 0; end = count; }
+        if (begin >= end) return;
+        computeDrawTransforms(models + 16 * begin, records.data() + begin, end - begin);
+
+        if (grow) {
+            if (buffer) glDeleteBuffers(1, &buffer);
+            glCreateBuffers(1, &buffer);
+            glNamedBufferStorage(buffer, count * sizeof(DrawTransform), records.data(), GL_DYNAMIC_STORAGE_BIT);
+            capacity = count;
+        } else {
+            glNamedBufferSubData(buffer, begin * sizeof(DrawTransform), (end - begin) * sizeof(DrawTransform),
+                                 records.data() + begin);
+        }
+    }
+
+    void bind() const {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_TRANSFORM_BINDING, buffer);
+    }
+};
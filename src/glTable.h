@@ -0,0 +1,92 @@
+#pragma once
+// ============================================================================
+// Table de fonctions OpenGL de l'application
+// ============================================================================
+// Même chaîne de décorateurs que ge::gl::init() (voir geGL/OpenGL.cpp), plus
+// un cache d'état en tête : les glUseProgram / glBindVertexArray / glEnable...
+// qui ne changent rien ne sont plus envoyés au driver.
+//
+// Validation (--gl-validation=off|debug|call) :
+//   off   : aucune requête GL (défaut en Release) ; la boucle de rendu n'en fait
+//           pas non plus (locations lues au chargement des programmes, chronos
+//           GPU et compteurs du culling seulement avec --gpu-stats, fences de la
+//           réduction de profondeur seulement avec --shadow-depth-reduction / F)
+//   debug : callback GL_DEBUG_OUTPUT asynchrone
+//   call  : glGetError après chaque appel, avec fichier:ligne (défaut en Debug)
+//
+// Trace (--gl-trace=off|stats|record), placée sous le cache d'état : elle ne
+// voit que les appels réellement envoyés au driver.
+//   stats  : nombre d'appels par fonction et par frame (défaut)
+//   record : enregistre aussi les appels depuis la création des ressources,
+//            la dernière frame peut être écrite dans un fichier (touche T) et
+//            rejouée par l'outil traceReplay ; les objets créés ou remplis dans
+//            les frames précédentes (streaming, rechargement des shaders) sont
+//            recréés avant elle
+
+#include <memory>
+#include <cstring>
+#include <iostream>
+#include <geGL/geGL.h>
+#include <geGL/DefaultLoader.h>
+#include <geGL/LoaderTableDecorator.h>
+#include <geGL/DSATableDecorator.h>
+#include <geGL/CapabilitiesTableDecorator.h>
+#include <geGL/TrapTableDecorator.h>
+#include <geGL/ValidationTableDecorator.h>
+#include <geGL/StateCacheTableDecorator.h>
+#include <geGL/TraceTableDecorator.h>
+#include <geGL/OpenGLContext.h>
+
+using RenderFunctionTable =
+    ge::gl::StateCacheTableDecorator<
+    ge::gl::TraceTableDecorator<
+    ge::gl::ValidationTableDecorator<
+    ge::gl::TrapTableDecorator<
+    ge::gl::CapabilitiesTableDecorator<
+    ge::gl::DSATableDecorator<
+    ge::gl::LoaderTableDecorator<
+    ge::gl::FunctionTable>>>>>>>;
+
+inline ge::gl::ValidationLevel parseValidationLevel(int argc, char* argv[]) {
+#ifdef NDEBUG
+    ge::gl::ValidationLevel level = ge::gl::ValidationLevel::OFF;
+#else
+    ge::gl::ValidationLevel level = ge::gl::ValidationLevel::PER_CALL;
+#endif
+    const char* prefix = "--gl-validation=";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], prefix, std::strlen(prefix)) != 0) continue;
+        const char* value = argv[i] + std::strlen(prefix);
+        if (std::strcmp(value, "off") == 0) level = ge::gl::ValidationLevel::OFF;
+        else if (std::strcmp(value, "debug") == 0) level = ge::gl::ValidationLevel::DEBUG_CALLBACK;
+        else if (std::strcmp(value, "call") == 0) level = ge::gl::ValidationLevel::PER_CALL;
+        else std::cerr << "Unknown GL validation level: " << value << std::endl;
+    }
+    return level;
+}
+
+inline ge::gl::TraceLevel parseTraceLevel(int argc, char* argv[]) {
+    ge::gl::TraceLevel level = ge::gl::TraceLevel::STATISTICS;
+    const char* prefix = "--gl-trace=";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], prefix, std::strlen(prefix)) != 0) continue;
+        const char* value = argv[i] + std::strlen(prefix);
+        if (std::strcmp(value, "off") == 0) level = ge::gl::TraceLevel::OFF;
+        else if (std::strcmp(value, "stats") == 0) level = ge::gl::TraceLevel::STATISTICS;
+        else if (std::strcmp(value, "record") == 0) level = ge::gl::TraceLevel::RECORD;
+        else std::cerr << "Unknown GL trace level: " << value << std::endl;
+    }
+    return level;
+}
+
+// Remplace ge::gl::init() pour le thread courant (le contexte GL doit être actif)
+inline std::shared_ptr<RenderFunctionTable> initRenderFunctionTable(ge::gl::ValidationLevel validation, ge::gl::TraceLevel trace) {
+    auto loader = std::make_shared<ge::gl::DefaultLoader>(ge::gl::getProcAddress);
+    auto table = std::make_shared<RenderFunctionTable>(loader);
+    table->validationLevel = validation; // doit être choisi avant construct()
+    table->traceLevel = trace;
+    table->construct();
+    ge::gl::setDefaultFunctionTable(table);
+    ge::gl::setDefaultContext(ge::gl::createContext(table));
+    return table;
+}
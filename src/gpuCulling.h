@@ -0,0 +1,213 @@
+#pragma once
+// ============================================================================
+// Frustum culling sur le GPU (shaders/cull.comp)
+// ============================================================================
+// Un thread par commande de la scène : la boîte du maillage est transformée
+// par la matrice modèle (lue dans le SSBO des transformations) puis testée
+// contre le frustum de la caméra et, séparément, contre celui de la lumière.
+// Les commandes visibles sont compactées avec un compteur atomique dans deux
+// listes ; les passes les dessinent avec glMultiDrawElementsIndirectCount,
+// sans aller-retour vers le CPU. La liste de la caméra peut en plus être
+// filtrée par la pyramide Hi-Z (hiZ.h, liée sur HIZ_TEXTURE_UNIT).
+// Chaque commande retenue reçoit la plage d'indices de son niveau de détail :
+// le plus grossier dont l'erreur projetée reste sous le seuil (LodSelection),
+// avec un seuil plus large pour la liste de la lumière. Un objet dense dessiné
+// au niveau complet pour la caméra peut être laissé à la passe meshlet
+// (meshlets.h) : il est alors seulement marqué dans le tampon des drapeaux.
+
+#include <vector>
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "meshPool.h"
+#include "hiZ.h"
+
+// Bindings des SSBO de cull.comp (0 = transformations, voir drawTransforms.h)
+const GLuint CULL_BOUNDS_BINDING = 1;
+const GLuint CULL_SOURCE_BINDING = 2;
+const GLuint CULL_VISIBLE_BINDING = 3;
+const GLuint CULL_COUNTER_BINDING = 4;
+const GLuint CULL_LOD_BINDING = 5;
+const GLuint CULL_EXPAND_BINDING = 6;  // un uint par commande, lu par meshletCull.comp
+const GLuint CULL_GROUP_SIZE = 64;     // local_size_x de cull.comp
+
+enum CullList { CULL_CAMERA = 0, CULL_LIGHT = 1 };
+
+// Compteurs : visibles caméra, visibles lumière, cachés par le Hi-Z, triangles caméra, triangles lumière
+const int CULL_COUNTER_COUNT = 5;
+
+// Choix du niveau de détail (selectMeshLod sur le CPU, même calcul dans cull.comp)
+struct LodSelection {
+    glm::vec3 cameraPosition = glm::vec3(0.0f);
+    float pixelsPerUnit = 0.0f;   // hauteur du viewport * projection[1][1] / 2
+    float thresholdPixels = 1.0f; // erreur tolérée à l'écran (0 : niveau complet)
+    float shadowBias = 4.0f;      // multiplie le seuil pour la liste de la lumière
+    // Liste de la lumière : erreur mesurée en texels d'ombre, pas en pixels à la
+    // distance de la caméra. Le niveau d'un occulteur ne change pas quand la
+    // caméra bouge, les zones gardées par le cache des cascades (shadowCache.h)
+    // restent raccord avec celles redessinées.
+    float shadowTexelsPerUnit = 100.0f; // ~1 cm : texels de la cascade la plus fine
+};
+
+// Distance caméra - boîte monde (centre, demi-taille), bornée pour la division
+inline float lodDistance(const glm::vec3& cameraPosition, const glm::vec3& center, const glm::vec3& extent) {
+    return std::max(glm::length(center - cameraPosition) - glm::length(extent), 1e-3f);
+}
+
+// Niveaux de détail d'une commande, disposition std430 de cull.comp
+struct CullLodRecord {
+    GLuint firstIndex[MESH_MAX_LODS];
+    GLuint indexCount[MESH_MAX_LODS];
+    float error[MESH_MAX_LODS];
+    GLuint lodCount;
+    GLuint meshletCount;  // 0 : pas de meshlets, toujours dessiné en entier
+    GLuint padding[2];
+};
+static_assert(sizeof(CullLodRecord) == 64, "CullLodRecord must match CommandLods in cull.comp");
+
+// Plans du frustum (Gribb-Hartmann) : un point p est dedans si dot(plan.xyz, p) + plan.w >= 0
+inline void extractFrustumPlanes(const glm::mat4& viewProj, glm::vec4 planes[6]) {
+    glm::vec4 row0(viewProj[0][0], viewProj[1][0], viewProj[2][0], viewProj[3][0]);
+    glm::vec4 row1(viewProj[0][1], viewProj[1][1], viewProj[2][1], viewProj[3][1]);
+    glm::vec4 row2(viewProj[0][2], viewProj[1][2], viewProj[2][2], viewProj[3][2]);
+    glm::vec4 row3(viewProj[0][3], viewProj[1][3], viewProj[2][3], viewProj[3][3]);
+    planes[0] = row3 + row0; planes[1] = row3 - row0;
+    planes[2] = row3 + row1; planes[3] = row3 - row1;
+    planes[4] = row3 + row2; planes[5] = row3 - row2;
+}
+
+struct GpuCulling {
+    GLuint boundsBuffer = 0;   // vec4 min, vec4 max par commande
+    GLuint lodBuffer = 0;      // CullLodRecord par commande
+    GLuint visibleBuffer = 0;  // [0, n) : caméra, [n, 2n) : lumière
+    GLuint counterBuffer = 0;  // CULL_COUNTER_COUNT compteurs
+    GLuint expandBuffer = 0;   // 1 : commande laissée à la passe meshlet
+    GLuint sourceBuffer = 0;   // commandes de la scène (non possédé)
+    GLsizei commandCount = 0;
+    // Locations de cull.comp, relues quand le programme change (rechargement :
+    // le nouveau programme est créé avant que l'ancien soit détruit, son id diffère)
+    GLuint locatedProgram = 0;
+    GLint locCommandCount, locCameraPlanes, locLightPlanes, locOcclusion, locCameraViewProj, locHiZ,
+          locCameraPosition, locPixelsPerUnit, locLodThreshold, locShadowTexelsPerUnit, locMeshletCulling;
+
+    static std::vector<CullLodRecord> lodRecords(const std::vector<MeshRange>& ranges, GLsizei count) {
+        std::vector<CullLodRecord> lods(count);
+        for (GLsizei i = 0; i < count; ++i) {
+            CullLodRecord& lod = lods[i];
+            lod = {};
+            lod.lodCount = ranges[i].lodCount;
+            lod.meshletCount = ranges[i].meshletCount;
+            for (uint32_t l = 0; l < ranges[i].lodCount; ++l) {
+                lod.firstIndex[l] = ranges[i].lods[l].firstIndex;
+                lod.indexCount[l] = ranges[i].lods[l].indexCount;
+                lod.error[l] = ranges[i].lods[l].error;
+            }
+        }
+        return lods;
+    }
+
+    static std::vector<float> boundsRecords(const std::vector<MeshRange>& ranges, GLsizei count) {
+        std::vector<float> packed;
+        for (GLsizei i = 0; i < count; ++i) {
+            auto const& b = ranges[i].bounds;
+            float record[8] = { b.min[0], b.min[1], b.min[2], 0.0f, b.max[0], b.max[1], b.max[2], 0.0f };
+            packed.insert(packed.end(), record, record + 8);
+        }
+        return packed;
+    }
+
+    void init(GLuint sourceCommands, const std::vector<MeshRange>& ranges, GLsizei count) {
+        sourceBuffer = sourceCommands;
+        commandCount = count;
+        std::vector<float> packed = boundsRecords(ranges, count);
+        std::vector<CullLodRecord> lods = lodRecords(ranges, count);
+        glCreateBuffers(1, &boundsBuffer);
+        glNamedBufferStorage(boundsBuffer, packed.size() * sizeof(float), packed.data(), GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &lodBuffer);
+        glNamedBufferStorage(lodBuffer, lods.size() * sizeof(CullLodRecord), lods.data(), GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &visibleBuffer);
+        glNamedBufferStorage(visibleBuffer, 2 * count * sizeof(DrawElementsIndirectCommand), nullptr, 0);
+        glCreateBuffers(1, &counterBuffer);
+        glNamedBufferStorage(counterBuffer, CULL_COUNTER_COUNT * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &expandBuffer);
+        glNamedBufferStorage(expandBuffer, count * sizeof(GLuint), nullptr, 0);
+    }
+
+    // Plages d'indices changées (maillages chargés ou évincés par le streaming)
+    void updateLods(const std::vector<MeshRange>& ranges) {
+        std::vector<CullLodRecord> lods = lodRecords(ranges, commandCount);
+        glNamedBufferSubData(lodBuffer, 0, lods.size() * sizeof(CullLodRecord), lods.data());
+    }
+
+    // Boîtes changées (lots statiques recuits après une édition)
+    void updateBounds(const std::vector<MeshRange>& ranges) {
+        std::vector<float> packed = boundsRecords(ranges, commandCount);
+        glNamedBufferSubData(boundsBuffer, 0, packed.size() * sizeof(float), packed.data());
+    }
+
+    // Le SSBO des transformations doit être lié (binding 0) et à jour ; avec
+    // occlusion, la pyramide Hi-Z de la frame doit être construite. Avec
+    // meshlets, MeshletCulling::cull doit suivre pour les objets marqués.
+    void cull(GLuint program, const glm::mat4& cameraViewProj, const glm::mat4& lightViewProj, bool occlusion,
+              const LodSelection& lod, bool meshlets) {
+        glm::vec4 cameraPlanes[6], lightPlanes[6];
+        extractFrustumPlanes(cameraViewProj, cameraPlanes);
+        extractFrustumPlanes(lightViewProj, lightPlanes);
+
+        const GLuint zero[CULL_COUNTER_COUNT] = {};
+        glNamedBufferSubData(counterBuffer, 0, sizeof(zero), zero);
+
+        if (program != locatedProgram) {
+            locatedProgram = program;
+            locCommandCount = glGetUniformLocation(program, "commandCount");
+            locCameraPlanes = glGetUniformLocation(program, "cameraPlanes");
+            locLightPlanes = glGetUniformLocation(program, "lightPlanes");
+            locOcclusion = glGetUniformLocation(program, "occlusionCulling");
+            locCameraViewProj = glGetUniformLocation(program, "cameraViewProj");
+            locHiZ = glGetUniformLocation(program, "hiZ");
+            locCameraPosition = glGetUniformLocation(program, "cameraPosition");
+            locPixelsPerUnit = glGetUniformLocation(program, "pixelsPerUnit");
+            locLodThreshold = glGetUniformLocation(program, "lodThreshold");
+            locShadowTexelsPerUnit = glGetUniformLocation(program, "shadowTexelsPerUnit");
+            locMeshletCulling = glGetUniformLocation(program, "meshletCulling");
+        }
+        glUseProgram(program);
+        glUniform1ui(locCommandCount, (GLuint)commandCount);
+        glUniform4fv(locCameraPlanes, 6, glm::value_ptr(cameraPlanes[0]));
+        glUniform4fv(locLightPlanes, 6, glm::value_ptr(lightPlanes[0]));
+        glUniform1i(locOcclusion, occlusion ? 1 : 0);
+        glUniformMatrix4fv(locCameraViewProj, 1, GL_FALSE, glm::value_ptr(cameraViewProj));
+        glUniform1i(locHiZ, (GLint)HIZ_TEXTURE_UNIT);
+        glUniform3fv(locCameraPosition, 1, glm::value_ptr(lod.cameraPosition));
+        glUniform1f(locPixelsPerUnit, lod.pixelsPerUnit);
+        glUniform2f(locLodThreshold, lod.thresholdPixels, lod.thresholdPixels * lod.shadowBias);
+        glUniform1f(locShadowTexelsPerUnit, lod.shadowTexelsPerUnit);
+        glUniform1i(locMeshletCulling, meshlets ? 1 : 0);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_BOUNDS_BINDING, boundsBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_LOD_BINDING, lodBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_EXPAND_BINDING, expandBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_SOURCE_BINDING, sourceBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_VISIBLE_BINDING, visibleBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_COUNTER_BINDING, counterBuffer);
+        glDispatchCompute((commandCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, 1, 1);
+        // Les commandes et les compteurs sont ensuite lus comme paramètres de draw
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+    }
+
+    // Équivalent de drawScene limité aux commandes qui ont survécu au culling
+    void draw(GLuint shaderId, GLuint poolVao, CullList list) const {
+        glUseProgram(shaderId);
+        glBindVertexArray(poolVao);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, visibleBuffer);
+        glBindBuffer(GL_PARAMETER_BUFFER, counterBuffer);
+        glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                         (const void*)(uintptr_t)(list * commandCount * sizeof(DrawElementsIndirectCommand)),
+                                         (GLintptr)(list * sizeof(GLuint)), commandCount, 0);
+    }
+
+    // Lecture synchrone des compteurs (statistiques seulement, bloque le pipeline)
+    void readCounters(GLuint counters[CULL_COUNTER_COUNT]) const {
+        glGetNamedBufferSubData(counterBuffer, 0, CULL_COUNTER_COUNT * sizeof(GLuint), counters);
+    }
+};
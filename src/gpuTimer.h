@@ -0,0 +1,59 @@
+#pragma once
+// ============================================================================
+// Chronométrage GPU
+// ============================================================================
+// Paires de glQueryCounter(GL_TIMESTAMP) : contrairement à GL_TIME_ELAPSED,
+// elles peuvent s'imbriquer et entourer un seul draw. Les résultats sont lus
+// avec LATENCY frames de retard et seulement s'ils sont disponibles, donc sans
+// jamais bloquer le pipeline.
+// Désactivés par défaut (--gpu-stats) : sans eux, la boucle de rendu ne fait
+// aucune requête GL.
+
+#include <cstring>
+
+struct GpuTimer {
+    static const int LATENCY = 4;
+
+    bool enabled = false;
+    GLuint queries[LATENCY][2] = {};
+    bool issued[LATENCY] = {};
+    int frame = 0;
+    double lastMs = 0.0;
+    double averageMs = 0.0; // moyenne glissante
+
+    void begin() {
+        if (!enabled) return;
+        if (!queries[0][0]) glGenQueries(LATENCY * 2, &queries[0][0]);
+        glQueryCounter(queries[frame][0], GL_TIMESTAMP);
+    }
+
+    void end() {
+        if (!enabled) return;
+        glQueryCounter(queries[frame][1], GL_TIMESTAMP);
+        issued[frame] = true;
+        frame = (frame + 1) % LATENCY;
+        collect();
+    }
+
+    // Le slot le plus ancien est celui qui sera réutilisé au prochain begin()
+    void collect() {
+        if (!issued[frame]) return;
+        GLint available = 0;
+        glGetQueryObjectiv(queries[frame][1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) return;
+        GLuint64 t0 = 0, t1 = 0;
+        glGetQueryObjectui64v(queries[frame][0], GL_QUERY_RESULT, &t0);
+        glGetQueryObjectui64v(queries[frame][1], GL_QUERY_RESULT, &t1);
+        issued[frame] = false;
+        lastMs = double(t1 - t0) / 1.0e6;
+        averageMs = averageMs == 0.0 ? lastMs : averageMs * 0.95 + lastMs * 0.05;
+    }
+};
+
+// --gpu-stats : chronométrage GPU et lecture des compteurs du culling GPU
+// (statistiques affichées toutes les 2 secondes)
+inline bool parseGpuStats(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--gpu-stats") == 0) return true;
+    return false;
+}
@@ -0,0 +1,91 @@
+#pragma once
+// ============================================================================
+// Hi-Z : pyramide de profondeur pour l'occlusion culling (shaders/hiz.comp)
+// ============================================================================
+// Les gros objets ("occluder" dans la scène, plus la pièce) sont dessinés en
+// profondeur seule depuis la caméra, au début de la frame. Chaque niveau de la
+// pyramide garde la profondeur la plus lointaine de 2x2 texels du niveau
+// précédent : un objet dont la boîte est plus proche que cette valeur sur toute
+// son empreinte écran peut être visible, sinon il est caché (cull.comp).
+// La pyramide vient de la frame courante : pas de reprojection, donc pas
+// d'objet nouvellement visible rejeté à tort.
+
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "scene.h" // drawScene
+
+const GLuint HIZ_TEXTURE_UNIT = 40;  // au-delà des materialTex[32] de scene.frag
+const GLuint HIZ_GROUP_SIZE = 8;     // local_size_x/y de hiz.comp
+
+struct HiZBuffer {
+    GLuint depthTexture = 0;  // pré-passe des occulteurs
+    GLuint fbo = 0;
+    GLuint pyramid = 0;       // R32F, niveau 0 = copie de depthTexture
+    int width = 0;
+    int height = 0;
+    int levels = 0;
+    // Locations relues quand un programme change (rechargement : nouvel id)
+    GLuint locatedDepthProgram = 0, locatedHizProgram = 0;
+    GLint locLightSpaceMatrix, locSource, locSourceLevel;
+
+    void init(int w, int h) {
+        width = w;
+        height = h;
+        levels = 1;
+        while ((std::max(width, height) >> levels) > 0) ++levels;
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &depthTexture);
+        glTextureStorage2D(depthTexture, 1, GL_DEPTH_COMPONENT32F, width, height);
+        glCreateFramebuffers(1, &fbo);
+        glNamedFramebufferTexture(fbo, GL_DEPTH_ATTACHMENT, depthTexture, 0);
+        glNamedFramebufferDrawBuffer(fbo, GL_NONE);
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &pyramid);
+        glTextureStorage2D(pyramid, levels, GL_R32F, width, height);
+        glTextureParameteri(pyramid, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTextureParameteri(pyramid, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(pyramid, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(pyramid, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+
+    // Pré-passe : depth.vert avec la matrice de la caméra à la place de celle de la lumière
+    void renderOccluders(GLuint depthProgram, GLuint poolVao, GLuint occluderCommands, GLsizei count,
+                         const glm::mat4& cameraViewProj) {
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glViewport(0, 0, width, height);
+        glEnable(GL_DEPTH_TEST);
+        glDepthMask(GL_TRUE);
+        glDisable(GL_CULL_FACE);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        if (depthProgram != locatedDepthProgram) {
+            locatedDepthProgram = depthProgram;
+            locLightSpaceMatrix = glGetUniformLocation(depthProgram, "lightSpaceMatrix");
+        }
+        glUseProgram(depthProgram);
+        glUniformMatrix4fv(locLightSpaceMatrix, 1, GL_FALSE, glm::value_ptr(cameraViewProj));
+        drawScene(depthProgram, poolVao, occluderCommands, count);
+    }
+
+    // Niveau 0 lu dans la texture de profondeur, puis chaque niveau dans le précédent
+    void build(GLuint hizProgram) {
+        if (hizProgram != locatedHizProgram) {
+            locatedHizProgram = hizProgram;
+            locSource = glGetUniformLocation(hizProgram, "source");
+            locSourceLevel = glGetUniformLocation(hizProgram, "sourceLevel");
+        }
+        glUseProgram(hizProgram);
+        glUniform1i(locSource, (GLint)HIZ_TEXTURE_UNIT);
+        for (int level = 0; level < levels; ++level) {
+            glBindTextureUnit(HIZ_TEXTURE_UNIT, level == 0 ? depthTexture : pyramid);
+            glUniform1i(locSourceLevel, level == 0 ? 0 : level - 1);
+            glBindImageTexture(0, pyramid, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+            int w = std::max(1, width >> level), h = std::max(1, height >> level);
+            glDispatchCompute((w + HIZ_GROUP_SIZE - 1) / HIZ_GROUP_SIZE, (h + HIZ_GROUP_SIZE - 1) / HIZ_GROUP_SIZE, 1);
+            glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+        }
+        // Pour cull.comp
+        glBindTextureUnit(HIZ_TEXTURE_UNIT, pyramid);
+    }
+};
@@ -1,6 +1,11 @@
 #include <SDL3/SDL.h>
 #include <geGL/geGL.h>
 #include <geGL/StaticCalls.h>
+#include "glTable.h"
+#ifndef NDEBUG
+// Chaque appel GL mémorise fichier:ligne pour les rapports de validation
+#include <geGL/Generated/ValidationCallSites.h>
+#endif
 #include <cmath>
 #include <map>
 #include <vector>
@@ -36,15 +41,6 @@ if (result == cgltf_result_success)
 	cgltf_free(data);
 } */
 
-//////////////////////////////////////////////////////////////////////////////////////////////////////
-//                                           La Pièce 
-//////////////////////////////////////////////////////////////////////////////////////////////////////
-
-// Dimensions de la pièce victorienne
-const float ROOM_WIDTH = 6.0f;
-const float ROOM_HEIGHT = 3.5f;
-const float ROOM_DEPTH = 8.0f;
-
 struct Vertex {
     float position[3]; // loc 0
     float normal[3];   // loc 1
@@ -55,193 +51,6 @@ struct Vertex {
 GLuint flameProgram; // Programme de shader pour la flamme
 GLuint flameQuadVao; // VAO pour le quad du billboard
 
-GLuint createShader(GLenum type, std::string const& src) {
-    auto shader = glCreateShader(type);
-    char const* srcs[] = { src.c_str() };
-    glShaderSource(shader, 1, srcs, 0);
-    glCompileShader(shader);
-
-    GLint status;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
-    if (status != GL_TRUE) {
-        char buf[10000];
-        glGetShaderInfoLog(shader, 10000, 0, buf);
-        std::cerr << "ERROR: " << buf << std::endl;
-    }
-    return shader;
-}
-
-GLuint createProgram(std::vector<GLuint> const& shaders) {
-    auto prg = glCreateProgram();
-    for (auto const& x : shaders)
-        glAttachShader(prg, x);
-    glLinkProgram(prg);
-
-    GLint status;
-    glGetProgramiv(prg, GL_LINK_STATUS, &status);
-    if (status != GL_TRUE) {
-        char buf[10000];
-        glGetProgramInfoLog(prg, 10000, 0, buf);
-        std::cerr << "ERROR: " << buf << std::endl;
-    }
-    return prg;
-}
-
-void generateRoomGeometry(std::vector<float>& vertices, std::vector<uint32_t>* indices, bool isRoom) {
-    float hw = ROOM_WIDTH / 2.0f;
-    float hh = ROOM_HEIGHT;
-    float hd = ROOM_DEPTH / 2.0f;
-
-    uint32_t idx = 0;
-    vertices.clear(); // On vide les vecteurs au cas où
-    if (indices) indices->clear();
-
-    // Tool function
-    auto addQuad = [&](float x1, float y1, float z1, float x2, float y2, float z2,
-                       float x3, float y3, float z3, float x4, float y4, float z4,
-                       float nx, float ny, float nz, float uMax, float vMax, float materialID) {
-        // Données des sommets
-        float q[] = {
-            x1, y1, z1, nx, ny, nz, 0.0f, 0.0f, materialID,
-            x2, y2, z2, nx, ny, nz, uMax, 0.0f, materialID,
-            x3, y3, z3, nx, ny, nz, uMax, vMax, materialID,
-            x4, y4, z4, nx, ny, nz, 0.0f, vMax, materialID
-        };
-        for(int i=0; i<36; ++i) vertices.push_back(q[i]);
-        if (indices) {
-            indices->push_back(idx); indices->push_back(idx + 1); indices->push_back(idx + 2);
-            indices->push_back(idx); indices->push_back(idx + 2); indices->push_back(idx + 3);
-            idx += 4;
-        }
-    };
-
-    // Facteur d'échelle du papier peint 
-    float scale = 0.5f; 
-    
-    // =======================================================
-    // --- Définition des dimensions de la fenêtre (2.0m x 2.0m, centrée) ---
-    // =======================================================
-    float winWidth  = 2.0f;
-    float winHeight = 2.0f;  
-    float winYCenter = 1.75f;                   
-    float winYMin   = winYCenter - winHeight * 0.5f; // 0.75m
-    float winYMax   = winYCenter + winHeight * 0.5f; // 2.75m
-    
-    float winZMin   = 0.0f - winWidth * 0.5f;   // -1.0m
-    float winZMax   = 0.0f + winWidth * 0.5f;   // 1.0m
-    float windowX = hw;                         // Mur droit (X=hw)
-    float offset = 0.005f;                      
-
-    if (isRoom) {
-        // =======================================================
-        // --- Murs et Fenêtre ---
-        // =======================================================
-        // Mur du fond (Mur z=-hd)
-        addQuad(-hw, 0, -hd, hw, 0, -hd, hw, hh, -hd, -hw, hh, -hd, 0, 0, 1, ROOM_WIDTH * scale, ROOM_HEIGHT * scale, 0);
-
-        // Mur gauche (Mur x=-hw)
-        addQuad(-hw, 0, hd, -hw, 0, -hd, -hw, hh, -hd, -hw, hh, hd, 1, 0, 0, ROOM_DEPTH * scale, ROOM_HEIGHT * scale, 0);
-
-        // Mur avant (Mur z=hd)
-        addQuad(hw, 0, hd, -hw, 0, hd, -hw, hh, hd, hw, hh, hd,  0, 0, -1, ROOM_WIDTH * scale, ROOM_HEIGHT * scale, 0); 
-        
-        // ----------------------------------------------------------------------------------
-        // MUR DROIT (X = hw) AVEC OUVERTURE DE FENÊTRE
-        // ----------------------------------------------------------------------------------
-        float NX = -1.0f; // Normale pointant vers l'intérieur
-        
-        // 1. Partie Basse (Sous la fenêtre)
-        addQuad(windowX, 0, -hd, windowX, 0, hd, windowX, winYMin, hd, windowX, winYMin, -hd, NX, 0, 0, ROOM_DEPTH * scale, winYMin * scale, 0);
-        
-        // 2. Partie Haute (Au-dessus de la fenêtre)
-        addQuad(windowX, winYMax, -hd, windowX, winYMax, hd, windowX, hh, hd, windowX, hh, -hd, NX, 0, 0, ROOM_DEPTH * scale, (hh - winYMax) * scale, 0);
-
-        // 3. Partie Arrière (Entre z=-hd et z=winZMin, de y=winYMin à y=winYMax)
-        addQuad(windowX, winYMin, -hd, windowX, winYMin, winZMin, windowX, winYMax, winZMin, windowX, winYMax, -hd, NX, 0, 0, (winZMin - (-hd)) * scale, winHeight * scale, 0);
-
-        // 4. Partie Avant (Entre z=winZMax et z=hd, de y=winYMin à y=winYMax)
-        addQuad(windowX, winYMin, winZMax, windowX, winYMin, hd, windowX, winYMax, hd, windowX, winYMax, winZMax, NX, 0, 0, (hd - winZMax) * scale, winHeight * scale, 0);
-
-        // ----------------------------------------------------------------------------------
-        // VITRE DE LA FENÊTRE (MATERIAL ID 6)
-        // ----------------------------------------------------------------------------------
-        // float x_vitre = windowX - offset; // Légèrement à l'intérieur du mur
-        // float NV = 1.0f; // Normale (1, 0, 0)
-        // addQuad( x_vitre, winYMin, winZMax, x_vitre, winYMin, winZMin, x_vitre, winYMax, winZMin, x_vitre, winYMax, winZMax, NV, 0, 0, 1.0f, 1.0f, 6.0f); 
-
-        // ----------------------------------------------------------------------------------
-        // RAYONS DE SOLEIL (GOD RAYS) - GEOMETRIE (MATERIAL ID 7)
-        // ----------------------------------------------------------------------------------
-        // REMOVED
-        
-        // =======================================================
-        // --- Sol, Plafond, Plinthes, Corniches et Porte ---
-        // =======================================================
-
-        // Sol
-        addQuad(-hw, 0,  hd,  hw, 0,  hd, hw, 0, -hd,  -hw, 0, -hd,  0, 1, 0, ROOM_WIDTH, ROOM_DEPTH, 2 );            
-
-        // plafond
-        addQuad(-hw, hh, -hd,  hw, hh, -hd,  hw, hh,  hd,  -hw, hh,  hd, 0, -1, 0,  ROOM_WIDTH, ROOM_DEPTH, 0 );
-
-        float ph = 0.15f; 
-
-        // Plinthe Mur du fond
-        addQuad(-hw, 0, -hd+0.01f, hw, 0, -hd+0.01f, hw, ph, -hd+0.01f, -hw, ph, -hd+0.01f, 0,0,1, 1,0.2, 3);
-
-        // Plinthe Mur gauche
-        addQuad(-hw+0.01f, 0, hd, -hw+0.01f, 0, -hd, -hw+0.01f, ph, -hd, -hw+0.01f, ph, hd, 1,0,0, 1,0.2, 3);
-
-        // Plinthe Mur droit (Plinthe coupée)
-        if (ph < winYMin) {
-            addQuad(hw-0.01f, 0, -hd, hw-0.01f, 0, hd, hw-0.01f, ph, hd, hw-0.01f, ph, -hd, -1,0,0, 1,0.2, 3);
-        }
-        
-        // Plinthe Mur avant
-        addQuad(hw, 0, hd-0.01f, -hw, 0, hd-0.01f, -hw, ph, hd-0.01f, hw, ph, hd-0.01f, 0,0,-1, 1,0.2, 3);
-
-        float ch = 0.20f;
-        float cy = hh - ch;
-
-        // Corniche Fond
-        addQuad(-hw, cy, -hd+0.01f, hw, cy, -hd+0.01f, hw, hh, -hd+0.01f, -hw, hh, -hd+0.01f, 0,0,1, 1,0.3, 4);
-
-        // Corniche Gauche
-        addQuad(-hw+0.01f, cy, hd, -hw+0.01f, cy, -hd, -hw+0.01f, hh, -hd, -hw+0.01f, hh, hd, 1,0,0, 1,0.3, 4);
-
-        // Corniche Droite (coupée)
-        if (cy > winYMax) {
-            addQuad(hw-0.01f, cy, -hd, hw-0.01f, cy, hd, hw-0.01f, hh, hd, hw-0.01f, hh, -hd, -1,0,0, 1,0.3, 4);
-        }
-
-        // Corniche Avant
-        addQuad(hw, cy, hd-0.01f, -hw, cy, hd-0.01f, -hw, hh, hd-0.01f, hw, hh, hd-0.01f, 0,0,-1, 1,0.3, 4);
-
-        // Porte (sur le Mur gauche: x = -hw)
-        float doorWidth  = 0.9f;
-        float doorHeight = 2.8f;  
-        float doorBottom = 0.0f;                    
-        float doorCenterZ = 0.0f;                   
-        float x = -hw;                              
-        float z1 = doorCenterZ - doorWidth * 0.5f;
-        float z2 = doorCenterZ + doorWidth * 0.5f;
-        float y1 = doorBottom;
-        float y2 = doorBottom + doorHeight;
-        float offset_door = 0.015f; 
-        float xd = x + offset_door;
-        addQuad( xd, y1, z2,   xd, y1, z1,   xd, y2, z1,  xd, y2, z2,  1, 0, 0,  1.0f, 1.0f, 5 );
-    }
-    else {
-        // ----------------------------------------------------------------------------------
-        // VITRE DE LA FENÊTRE (MATERIAL ID 6)
-        // ----------------------------------------------------------------------------------
-        float x_vitre = windowX - offset; // Légèrement à l'intérieur du mur
-        float NV = 1.0f; // Normale (1, 0, 0)
-        addQuad( x_vitre, winYMin, winZMax, x_vitre, winYMin, winZMin, x_vitre, winYMax, winZMin, x_vitre, winYMax, winZMax, NV, 0, 0, 1.0f, 1.0f, 6.0f); 
-        // Les rayons doivent traverser la fenêtre
-    }
-}
-
 // ============================================================================
 // La fumée de la pipe - VERSION AMÉLIORÉE AVEC VOLUTES
 // ============================================================================
@@ -256,15 +65,59 @@ void generateRoomGeometry(std::vector<float>& vertices, std::vector<uint32_t>* i
 // Shadow Mapping
 // ============================================================================
 #include "shadowMapping.h"
+#include "shadowCache.h"
+#include "pointShadow.h"
 
 
 // ============================================================================
 // Draw the room & the objects
 // ============================================================================
+#include "gpuTimer.h"
 #include "scene.h"
+#include "sceneFile.h"
+#include "gpuCulling.h"
+#include "cpuCulling.h"
+#include "meshlets.h"
+
+// ============================================================================
+// Les pièces de la maison, la visibilité par portails et l'édition en direct
+// ============================================================================
+#include "building.h"
+#include "roomEditor.h"
+
+// ============================================================================
+// BVH des triangles statiques (requêtes de rayons)
+// ============================================================================
+#include "bvh.h"
 
+// ============================================================================
+// Streaming des maillages et textures par pièce (--streaming)
+// ============================================================================
+#include "streaming.h"
+
+// ============================================================================
+// Shaders (fichiers de shaders/ rechargés à chaud)
+// ============================================================================
+#include "shaderReload.h"
 
 int main(int argc, char* argv[]) {
+    // --bench-transforms : mesure la hiérarchie de transformations (100k nœuds) sans ouvrir de fenêtre
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--bench-transforms") == 0) { benchmarkTransformHierarchy(100000); return 0; }
+    // --bench-culling : frustum culling CPU de 1M boîtes (scalaire / SIMD)
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--bench-culling") == 0) { benchmarkCulling(1000000); return 0; }
+    // --bench-bvh : construction du BVH de la scène et débit de rayons (seuls / paquets de 8)
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--bench-bvh") == 0) {
+            SceneData benchScene;
+            if (!loadScene(parseScenePath(argc, argv), benchScene)) return 1;
+            addDefaultRoom(benchScene);
+            addStressInstances(benchScene, parseStressInstances(argc, argv));
+            benchmarkBvh(benchScene);
+            return 0;
+        }
+
     int winWidth  = 1920;  
     int winHeight = 1080;  
     auto window = SDL_CreateWindow("Sherlock Holmes' Room", winWidth, winHeight, SDL_WINDOW_OPENGL);
@@ -272,346 +125,105 @@ int main(int argc, char* argv[]) {
     float globalBrightness = 3.0f; // 1.0 = normal, 0.0 = noir
     float localBrightness = 1.0f; // 1.0 = normal, 0.0 = noir
 
-    ge::gl::init();
+    // Table geGL avec cache d'état (appels redondants supprimés) et validation
+    // (le callback GL_DEBUG_OUTPUT est installé par la table selon le niveau)
+    auto glTable = initRenderFunctionTable(parseValidationLevel(argc, argv), parseTraceLevel(argc, argv));
 
-    glEnable(GL_DEBUG_OUTPUT);
-    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-    glDebugMessageCallback([](GLenum src, GLenum type, GLuint id, GLenum sev, GLsizei len, const GLchar* msg, const void*) { 
-        std::cerr << "GL DEBUG: " << msg << " (id=" << id << ")\n";  
-    }, nullptr);
+    // Scène (scenes/*.scene, --scene=...) : pièces, meshes, objets, matériaux, lumières, émetteurs
+    SceneData sceneData;
+    if (!loadScene(parseScenePath(argc, argv), sceneData)) {
+        std::cerr << "Failed to load scene" << std::endl;
+        return 1;
+    }
+    addDefaultRoom(sceneData);
+    // --stress-instances[=N] : N bougies instanciées en plus de la scène (défaut 10000)
+    addStressInstances(sceneData, parseStressInstances(argc, argv));
 
-    // Génération de la géométrie de la pièce
-    std::vector<float> vertices;
-    std::vector<uint32_t> indices;
-    generateRoomGeometry(vertices, &indices, true);
+    // Génération de la géométrie des pièces (une par draw)
+    std::vector<std::vector<float>> roomVertices(sceneData.rooms.size());
+    std::vector<std::vector<uint32_t>> roomIndices(sceneData.rooms.size());
+    for (size_t r = 0; r < sceneData.rooms.size(); ++r)
+        generateRoomGeometry(sceneData, (uint32_t)r, roomVertices[r], roomIndices[r]);
 
-    // La fenêtre doit être traitée séparément: elle ne doit pas être affichée en Passe 1 pour laisser passer la lumière
+    // Les vitres doivent être traitées séparément: elles ne doivent pas être affichées en Passe 1 pour laisser passer la lumière
     std::vector<float> windowVertices; 
     std::vector<uint32_t> windowIndices;
-    generateRoomGeometry(windowVertices, &windowIndices, false);
-
-    // Création des buffers
-    GLuint vbo;
-    glCreateBuffers(1, &vbo);
-    glNamedBufferData(vbo, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-    GLuint ebo;
-    glCreateBuffers(1, &ebo);
-    glNamedBufferData(ebo, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
-
-    // Configuration du VAO de la pièce
-    GLuint vao;
-    glCreateVertexArrays(1, &vao);
-    
-    glEnableVertexArrayAttrib(vao, 0);
-    glVertexArrayAttribFormat(vao, 0, 3, GL_FLOAT, GL_FALSE, 0);
-    glVertexArrayAttribBinding(vao, 0, 0);
-
-    glEnableVertexArrayAttrib(vao, 1);
-    glVertexArrayAttribFormat(vao, 1, 3, GL_FLOAT, GL_FALSE, sizeof(float)*3);
-    glVertexArrayAttribBinding(vao, 1, 0);
-
-    glEnableVertexArrayAttrib(vao, 2);
-    glVertexArrayAttribFormat(vao, 2, 2, GL_FLOAT, GL_FALSE, sizeof(float)*6);
-    glVertexArrayAttribBinding(vao, 2, 0);
-
-    glEnableVertexArrayAttrib(vao, 3);
-    glVertexArrayAttribFormat(vao, 3, 1, GL_FLOAT, GL_FALSE, sizeof(float)*8);
-    glVertexArrayAttribBinding(vao, 3, 0);
-
-    glVertexArrayElementBuffer(vao, ebo);
-    glVertexArrayVertexBuffer(vao, 0, vbo, 0, sizeof(float)*9);
-
-    // --- CRÉATION DU WINDOW VAO ---
-    // Buffers spécifiques à la fenêtre
-    GLuint windowVao, windowVbo, windowEbo;
-    glCreateBuffers(1, &windowVbo);
-    glNamedBufferData(windowVbo, windowVertices.size() * sizeof(float), windowVertices.data(), GL_STATIC_DRAW);
-    glCreateBuffers(1, &windowEbo);
-    glNamedBufferData(windowEbo, windowIndices.size() * sizeof(uint32_t), windowIndices.data(), GL_STATIC_DRAW);
-    // CONFIGURATION DU WINDOW VAO
-    glCreateVertexArrays(1, &windowVao);
-    // On lie bien le VBO de la fenêtre
-    glVertexArrayVertexBuffer(windowVao, 0, windowVbo, 0, sizeof(float) * 9);
-    glVertexArrayElementBuffer(windowVao, windowEbo);
-    // Les attributs doivent être configurés explicitement pour ce VAO
-    for(int i = 0; i <= 3; ++i) glEnableVertexArrayAttrib(windowVao, i);
-    glVertexArrayAttribFormat(windowVao, 0, 3, GL_FLOAT, GL_FALSE, 0); // Pos
-    glVertexArrayAttribFormat(windowVao, 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float)); // Norm
-    glVertexArrayAttribFormat(windowVao, 2, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float)); // UV
-    glVertexArrayAttribFormat(windowVao, 3, 1, GL_FLOAT, GL_FALSE, 8 * sizeof(float)); // MatID
-    for(int i = 0; i <= 3; ++i) glVertexArrayAttribBinding(windowVao, i, 0);
-    
-    // Shaders
-    auto vsSrc = R".(
-      #version 460
-      layout(location=0) in vec3 position;
-      layout(location=1) in vec3 normal;
-      layout(location=2) in vec2 uv; 
-      layout(location=3) in float materialID;
-
-      out vec3 vNormal;
-      out vec2 vUV;
-      out vec3 vPosition;
-      out float vMatID;
-
-      uniform mat4 viewMatrix = mat4(1);
-      uniform mat4 projMatrix = mat4(1);
-      uniform mat4 model = mat4(1);
-
-      // Shadow mapping
-      out vec4 vFragPosLightSpace;
-      uniform mat4 lightSpaceMatrix;      
-
-      void main() {
-          gl_Position = projMatrix * viewMatrix * model * vec4(position, 1);
-          
-          mat3 normalMatrix = mat3(transpose(inverse(model)));
-          vec3 transformedNormal = normalize(normalMatrix * normal);
-          vNormal = transformedNormal;
-          
-          vUV = uv;
-          vPosition = vec3(model * vec4(position, 1));
-          vMatID = materialID; 
-
-          // Shadow mapping
-          vFragPosLightSpace = lightSpaceMatrix * model * vec4(position, 1.0);          
-      }
-     ).";
-
-    auto fsSrc = R".(
-      #version 460
-      in vec3 vNormal;
-      in vec2 vUV;
-      in vec3 vPosition;
-      in float vMatID;
-      out vec4 fColor;
-      
-      uniform vec3 sunDirection = normalize(vec3(1.0, -0.5, 0.0)); 
-      uniform vec3 cameraPosition; 
-      uniform sampler2D materialTex[32];
-      uniform bool debugMode = false;
-      uniform bool showNormals = false;
-      uniform bool showUVs = false;
-      
-      uniform vec3 materialKd[32];       // Couleurs Kd
-      uniform bool materialHasTex[32];   // Flag texture
-
-      uniform int renderPass = 0;     // renderPass: 0=Opaque, 1=Transparent
-      uniform vec3 sunPositionWorld;  // Position d'origine du rayon (centre fenêtre)
-      uniform float beamWidthZ = 1.0;
-
-      // La flamme
-      in vec2 TexCoord;
-      uniform sampler2D flameTexture;
-      // out vec4 fragColor; // GRRRRrrr....
-
-      // POINT LIGHT éclairage à la bougie
-      struct PointLight {
-            vec3 position;
-            vec3 color;
-            // x = Constant, y = Linear, z = Quadratic
-            vec3 attenuation; 
-      };
-      uniform PointLight pointLight;
-      uniform vec3 viewPos; // Position de la caméra (pour les reflets spéculaires)
-      
-      uniform float globalBrightness = 1.0;
-      uniform float localBrightness = 1.0;
-      uniform vec3 sunColor = vec3(1.0, 0.95, 0.8); // Lumière chaude
-      uniform vec3 ambientColor = vec3(0.2, 0.2, 0.3); // Ambiance bleutée froide
-
-      // Shadow mapping
-      uniform sampler2D shadowMap;
-      in vec4 vFragPosLightSpace;
-
-      // 16 points répartis selon un disque de Poisson
-      const vec2 poissonDisk[16] = vec2[]( 
-        vec2( -0.94201624, -0.39906216 ), vec2( 0.94558609, -0.76890725 ), 
-        vec2( -0.094184101, -0.92938870 ), vec2( 0.34495938, 0.29387760 ), 
-        vec2( -0.91588581, 0.45771432 ), vec2( -0.81544232, -0.87912464 ), 
-        vec2( -0.38277543, 0.27676845 ), vec2( 0.97484398, 0.75648379 ), 
-        vec2( 0.44323325, -0.97511554 ), vec2( 0.53742981, -0.47373420 ), 
-        vec2( -0.26496911, -0.41893023 ), vec2( 0.79197514, 0.19090188 ), 
-        vec2( -0.24188840, 0.99706507 ), vec2( -0.81409955, 0.91437590 ), 
-        vec2( 0.19984126, 0.78641367 ), vec2( 0.14383161, -0.14100790 ) 
-      );
-
-      // Fonction de bruit rapide pour la rotation
-      float random(vec4 seed4) {
-        float dot_product = dot(seed4, vec4(12.9898, 78.233, 45.164, 94.673));
-        return fract(sin(dot_product) * 43758.5453);
-      }
-
-      float calculateShadow() {
-        vec3 projCoords = vFragPosLightSpace.xyz / vFragPosLightSpace.w;
-        projCoords = projCoords * 0.5 + 0.5;
-        if(projCoords.z > 1.0) return 0.0;
-
-        float bias = max(0.005 * (1.0 - dot(normalize(vNormal), normalize(-sunDirection))), 0.0005);
-        float shadow = 0.0;
-        
-        // Rayon de flou (à ajuster selon vos goûts) : Plus le chiffre est grand, plus l'ombre est "douce"
-        float spread = 1.5 / textureSize(shadowMap, 0).x;
-
-        // Utiliser la position du fragment pour créer un angle de rotation aléatoire
-        float angle = random(vec4(vPosition, 0.0)) * 6.283185; // 0 à 2PI
-        float s = sin(angle);
-        float c = cos(angle);
-        mat2 rotation = mat2(c, s, -s, c);
-
-        for (int i=0; i<16; i++) {
-            // Faire pivoter le point du disque de Poisson
-            vec2 offset = rotation * poissonDisk[i] * spread;
-            float pcfDepth = texture(shadowMap, projCoords.xy + offset).r;
-            if (projCoords.z - bias > pcfDepth) shadow += 1.0;
+    generateWindowGeometry(sceneData, windowVertices, windowIndices);
+
+    // --streaming[=meshMB,textureMB,ramMB] : maillages des objets envoyés au GPU et
+    // textures décodées en arrière-plan à l'approche des pièces, sous budget
+    // mémoire (streaming.h ; ramMB : images décodées)
+    StreamingBudget streamingBudget;
+    bool streamingEnabled = parseStreamingBudget(argc, argv, streamingBudget);
+
+    SceneGpu sceneGpu;
+    // Pièces, vitres et objets partagent un même VBO/EBO/VAO (meshPool.h) ; les
+    // objets "static" y sont fusionnés en un draw par pièce (--no-static-batching)
+    createSceneGpu(sceneData, roomVertices, roomIndices, windowVertices, windowIndices, sceneGpu,
+                   streamingEnabled ? streamingBudget.meshBytes : 0, parseStaticBatching(argc, argv));
+    // Passes de profondeur sur le flux des positions seules (--no-depth-stream : VAO complet)
+    GLuint depthVao = parseDepthStream(argc, argv) ? sceneGpu.pool.depthVao : sceneGpu.pool.vao;
+    StreamingManager streaming;
+    if (streamingEnabled) streaming.init(sceneData, roomVertices, windowVertices, streamingBudget);
+
+    // Shaders (shaders/*.vert|frag, recompilés en arrière-plan quand ils changent)
+    ShaderLibrary shaderLibrary;
+    shaderLibrary.init(window, context);
+    HotProgram* sceneHot = shaderLibrary.load("scene", {{GL_VERTEX_SHADER, "scene.vert"}, {GL_FRAGMENT_SHADER, "scene.frag"}});
+    HotProgram* smokeHot = shaderLibrary.load("smoke", {{GL_VERTEX_SHADER, "smoke.vert"}, {GL_FRAGMENT_SHADER, "smoke.frag"}});
+    HotProgram* flameHot = shaderLibrary.load("flame", {{GL_VERTEX_SHADER, "flame.vert"}, {GL_FRAGMENT_SHADER, "flame.frag"}});
+    HotProgram* depthHot = shaderLibrary.load("depth", {{GL_VERTEX_SHADER, "depth.vert"}, {GL_FRAGMENT_SHADER, "depth.frag"}});
+    HotProgram* shadowHot = shaderLibrary.load("shadow", {{GL_VERTEX_SHADER, "depth.vert"}, {GL_GEOMETRY_SHADER, "shadow.geom"},
+                                                         {GL_FRAGMENT_SHADER, "depth.frag"}});
+    HotProgram* pointShadowHot = shaderLibrary.load("pointShadow", {{GL_VERTEX_SHADER, "pointShadow.vert"},
+                                                                   {GL_GEOMETRY_SHADER, "pointShadow.geom"},
+                                                                   {GL_FRAGMENT_SHADER, "pointShadow.frag"}});
+    HotProgram* shadowFilterHot = shaderLibrary.load("shadowFilter", {{GL_COMPUTE_SHADER, "shadowFilter.comp"}});
+    HotProgram* shadowMipsHot = shaderLibrary.load("shadowMips", {{GL_COMPUTE_SHADER, "shadowMips.comp"}});
+    HotProgram* depthReduceHot = shaderLibrary.load("depthReduce", {{GL_COMPUTE_SHADER, "depthReduce.comp"}});
+    HotProgram* cullHot = shaderLibrary.load("cull", {{GL_COMPUTE_SHADER, "cull.comp"}});
+    HotProgram* hizHot = shaderLibrary.load("hiz", {{GL_COMPUTE_SHADER, "hiz.comp"}});
+    HotProgram* meshletCullHot = shaderLibrary.load("meshletCull", {{GL_COMPUTE_SHADER, "meshletCull.comp"}});
+    GLuint prg = sceneHot->id;
+    GLuint smokeProgram = smokeHot->id;
+    flameProgram = flameHot->id;
+
+    GLint viewMatrixL, projMatrixL, locSunDir, locCameraPos, locRenderPass, locSunPosWorld;
+    GLint gBrightness, lBrightness, locLightPos, locLightColor, locLightAttenuation, locViewPos;
+    GLint locDebug, locShowNormals, locShowUVs;
+    int sceneGeneration = -1;
+    // (Re)lecture des locations et des uniforms constants après chaque (re)chargement
+    auto setupSceneProgram = [&]() {
+        viewMatrixL = glGetUniformLocation(prg, "viewMatrix");
+        projMatrixL = glGetUniformLocation(prg, "projMatrix");
+        locSunDir = glGetUniformLocation(prg, "sunDirection"); 
+        locCameraPos = glGetUniformLocation(prg, "cameraPosition"); 
+        locRenderPass = glGetUniformLocation(prg, "renderPass");
+        locSunPosWorld = glGetUniformLocation(prg, "sunPositionWorld");
+        gBrightness = glGetUniformLocation(prg, "globalBrightness");
+        lBrightness = glGetUniformLocation(prg, "localBrightness");
+        locLightPos = glGetUniformLocation(prg, "pointLight.position");
+        locLightColor = glGetUniformLocation(prg, "pointLight.color");
+        locLightAttenuation = glGetUniformLocation(prg, "pointLight.attenuation");
+        locViewPos = glGetUniformLocation(prg, "viewPos");
+        locDebug = glGetUniformLocation(prg, "debugMode");
+        locShowNormals = glGetUniformLocation(prg, "showNormals");
+        locShowUVs = glGetUniformLocation(prg, "showUVs");
+
+        GLint materialTextures[32];
+        for(int i = 0; i < 32; i++) materialTextures[i] = i;
+        GLint locMaterialTex = glGetUniformLocation(prg, "materialTex");
+        if(locMaterialTex >= 0) {
+            glProgramUniform1iv(prg, locMaterialTex, 32, materialTextures);
+            std::cout << "Initialized materialTex uniform array" << std::endl;
         }
-        return shadow / 16.0;
-      }
-
-      void main() {
-          int mid = int(vMatID + 0.5);
-
-          // ------------------------------------------------------------------
-          // CONTRÔLE DU PASSAGE DE RENDU (OPAQUE vs TRANSPARENT)
-          // ------------------------------------------------------------------
-          // MatID 6 = Vitre, MatID 7 = Rayons
-          bool isTransparent = (mid == 6 || mid == 7);
-          
-          if (renderPass == 0) { // PASSAGE OPAQUE (Phase 1)
-              // Jeter la vitre (6) et les rayons (7). Garde les murs (0-5) et les OBJs (8+)
-              if (isTransparent) { discard; } 
-          } else { // PASSAGE TRANSPARENT (Phase 2)
-              // Garder uniquement la vitre (6) et les rayons (7). Jeter les murs et les OBJs
-              if (!isTransparent) { discard; } 
-          }
-          // ------------------------------------------------------------------
-
-          // UV DEBUG MODE
-          if (showUVs) { fColor = vec4(fract(vUV), 0.0, 1.0); return; }
-          
-          // NORMAL DEBUG MODE
-          if (showNormals) { fColor = vec4(vNormal * 0.5 + 0.5, 1.0); return; }
-          
-          // MATERIAL ID DEBUG MODE
-          if (debugMode) {
-              if (vMatID < -0.5) { 
-                fColor = vec4(1.0, 0.0, 1.0, 1.0);
-              } else if (vMatID < 0.5) {
-                fColor = vec4(1.0, 0.0, 0.0, 1.0);
-              } else if (vMatID < 3.5) {
-                fColor = vec4(0.0, vMatID / 3.0, 0.0, 1.0);
-              } else if (vMatID < 6.5) {
-                fColor = vec4(0.0, 0.0, (vMatID - 3.0) / 3.0, 1.0);
-              } else if (vMatID < 7.5) { // MatID 7 (Rayons) : Jaune
-                fColor = vec4(1.0, 1.0, 0.0, 1.0); return; 
-              } else {
-                fColor = vec4(1.0, 1.0, 0.0, 1.0); // YELLOW for table (OBJ)
-              }
-              return;
-          }
-          
-          // ===== RÉCUPÉRATION COULEUR MATÉRIAU =====
-          vec3 texColor;
-          if (mid >= 0 && mid < 32) {
-              if (materialHasTex[mid]) { // Utiliser la texture
-                  texColor = texture(materialTex[mid], vUV).rgb;
-              } else { // Utiliser la couleur Kd
-                  texColor = materialKd[mid];
-              }
-          } else {
-              texColor = vec3(1.0, 0.0, 1.0); // Magenta debug
-          }
-
-          // --- LIGHTING pour les objets opaques (Murs, Sol, OBJs) ---
-          float shadow = calculateShadow();
-          vec3 lightDir = normalize(-sunDirection);
-          vec3 ambient = ambientColor * 0.3 * globalBrightness;
-          vec3 diffuse = sunColor * max(dot(normalize(vNormal), lightDir), 0.0) * 0.8;
-          vec3 lighting = vec3(ambient + (1.0 - shadow) * diffuse);  // L'ombre ne coupe que la diffuse
-
-          vec3 finalColor = texColor * lighting; 
-
-          // ==========================================================
-          // Calcul de l'éclairage de la Bougie (Point Light) - AJOUTER ICI
-          // ==========================================================
-          // On s'assure que le calcul n'affecte pas les rayons de soleil (MatID 7)
-          if (mid != 7) { 
-            // 1. Initialisation des composantes
-            vec3 norm = normalize(vNormal);
-            vec3 lightContribution = vec3(0.0);
-            
-            // 2. Calcul du vecteur Lumière et de la distance
-            vec3 lightVec = pointLight.position - vPosition;
-            float distance = length(lightVec);
-            vec3 lightDirNorm = normalize(lightVec);
-
-            // 3. Atténuation (Falloff)
-            float attenuation = 1.0 / (
-                pointLight.attenuation.x + 
-                pointLight.attenuation.y * distance + 
-                pointLight.attenuation.z * distance * distance
-            );
-            
-            // 4. Composante Diffuse
-            float diff = max(dot(norm, lightDirNorm), 0.0);
-            vec3 diffuseLight = pointLight.color * diff * texColor;
-            
-            // 5. Composante Spéculaire (Optionnelle, pour les surfaces brillantes comme le bougeoir)
-            // Pour simplifier, nous n'incluons que le diffuse pour la lumière de la bougie.
-            
-            // 6. Application de l'atténuation
-            lightContribution = diffuseLight * attenuation * localBrightness;
-
-            // 7. AJOUTER LA CONTRIBUTION DE LA BOUGIE à la couleur finale
-            finalColor += lightContribution;
-          }
-          // ==========================================================          
-
-          // ==========================================================
-          // PROJECTION DE LUMIÈRE DES RAYONS (Uniquement sur le Sol)
-          // ==========================================================
-          // Supprimé: La lumière doit éclairer le sol
-          // ==========================================================
-
-          fColor = vec4(finalColor, 1.0);
-        }
-    ).";
-
-const char* vsDepth = R"(
-#version 460
-layout(location=0) in vec3 position;
-uniform mat4 lightSpaceMatrix;
-uniform mat4 model;
-void main() {
-    gl_Position = lightSpaceMatrix * model * vec4(position, 1.0);
-}
-)";
-
-const char* fsDepth = R"(
-#version 460
-void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
-)";    
-
-    auto vs = createShader(GL_VERTEX_SHADER, vsSrc);
-    auto fs = createShader(GL_FRAGMENT_SHADER, fsSrc);
-    auto prg = createProgram({ vs, fs });
-
-    auto viewMatrixL = glGetUniformLocation(prg, "viewMatrix");
-    auto projMatrixL = glGetUniformLocation(prg, "projMatrix");
-    GLint locSunDir = glGetUniformLocation(prg, "sunDirection"); 
-    GLint locCameraPos = glGetUniformLocation(prg, "cameraPosition"); 
-    GLint locRenderPass = glGetUniformLocation(prg, "renderPass"); // Déclaration ajoutée
-
-    //  Compiler les shaders de fumée
-    auto smokeVS = createShader(GL_VERTEX_SHADER, smokeVertexShader);
-    auto smokeFS = createShader(GL_FRAGMENT_SHADER, smokeFragmentShader);
-    auto smokeProgram = createProgram({smokeVS, smokeFS});
-
-    // Créer les shaders de flamme
-    auto flameVS = createShader(GL_VERTEX_SHADER, flameVertexShader);
-    auto flameFS = createShader(GL_FRAGMENT_SHADER, flameFragmentShader);
-    flameProgram = createProgram({flameVS, flameFS});
+        applySceneMaterials(prg, sceneData, sceneGpu);
+        const SceneLight* sun = sceneData.findLight(SCENE_LIGHT_SUN);
+        GLint locSunColor = glGetUniformLocation(prg, "sunColor");
+        if (sun && locSunColor >= 0) glProgramUniform3fv(prg, locSunColor, 1, sun->color);
+        sceneGeneration = sceneHot->generation;
+    };
+    setupSceneProgram();
 
     // Initialiser le quad de flamme
     GLuint flameVBO;
@@ -643,165 +255,138 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
         return loadTexture(paths, 3);
     };
 
-    GLuint wallTex   = loadTex("../img/papierpeint.jpg",   "./img/papierpeint.jpg",   "../../img/papierpeint.jpg");
-    GLuint floorTex  = loadTex("../img/parquetbois.jpg",   "./img/parquetbois.jpg",   "../../img/parquetbois.jpg");
-    // GLuint ceilTex   = loadTex("../img/plafondpeint.jpg",  "./img/plafondpeint.jpg",  "../../img/plafondpeint.jpg");
-    // GLuint ceilTex   = loadTex("../img/blanc.jpg",  "./img/blanc.jpg",  "../../img/blanc.jpg");
-    GLuint plinthTex = loadTex("../img/plinthe.jpg",       "./img/plinthe.jpg",       "../../img/plinthe.jpg");
-    GLuint stucTex   = loadTex("../img/stuc.jpg",          "./img/stuc.jpg",          "../../img/stuc.jpg");
-    GLuint doorTex   = loadTex("../img/portev.png",        "./img/portev.png",        "../../img/portev.png");
-    // GLuint glassTex  = loadTex("../img/glass.png",         "./img/glass.png",         "../../img/glass.png");
-    GLuint windowTex  = loadTex("../img/window1024.png",   "./img/window1024.png",    "../../img/window1024.png");
+    // Les textures des matériaux viennent de la scène (createSceneGpu)
     GLuint flameTex  = loadTex("../img/flame.png",   "./img/flame.png",    "../../img/flame.png");
 
     glUseProgram(prg);
 
-    GLint materialTextures[32];
-    for(int i = 0; i < 32; i++) materialTextures[i] = i;
-    
-    GLint locMaterialTex = glGetUniformLocation(prg, "materialTex");
-    if(locMaterialTex >= 0) {
-        glProgramUniform1iv(prg, locMaterialTex, 32, materialTextures);
-        std::cout << "Initialized materialTex uniform array" << std::endl;
-    }
-
-    // Load table
-    const int baseUnit = 9;
-    int matCount = 0;
-    OBJMesh table;
-    char *objPath = "../obj/old_table.obj";
-    if (!loadOBJ(objPath, table, baseUnit)) {
-        std::cerr << "Failed to load "<< objPath << std::endl;
-    } else {
-        std::cout << "Table loaded: " << table.count << " vertices, " 
-                  << table.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)table.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << table.materialNames[i] << "): texID=" << table.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += table.materialTextures.size();
-
-    // Chargement du Cadre
-    OBJMesh frame;
-    char *objPathFrame = "../obj/SM_frame_01.obj";
-    if (!loadOBJ(objPathFrame, frame, baseUnit+matCount)) {
-        std::cerr << "Failed to load "<< objPathFrame << std::endl;
-    } else {
-        std::cout << "Frame loaded: " << frame.count << " vertices, " << frame.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)frame.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << frame.materialNames[i] << "): texID=" << frame.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += frame.materialTextures.size();
-
-    // Chargement du Cendrier
-    OBJMesh ashtray;
-    char *objPathAshtray = "../obj/objCigarrete.obj";
-    // char *objPathAshtray = "../obj/Ashtray.obj";
-    if (!loadOBJ(objPathAshtray, ashtray, baseUnit+matCount)) {
-        std::cerr << "Failed to load "<< objPathAshtray << std::endl;
-    } else {
-        std::cout << "Ashtray loaded: " << ashtray.count << " vertices, " << ashtray.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)ashtray.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << ashtray.materialNames[i] << "): texID=" << ashtray.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += ashtray.materialTextures.size();
-
-    // Chargement de la pipe
-    OBJMesh pipe;
-    char *objPathPipe = "../obj/Pipe.obj";
-    if (!loadOBJ(objPathPipe, pipe, baseUnit+matCount)) {
-        std::cerr << "Failed to load "<< objPathPipe << std::endl;
-    } else {
-        std::cout << "Pipe loaded: " << pipe.count << " vertices, " << pipe.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)pipe.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << pipe.materialNames[i] << "): texID=" << pipe.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += pipe.materialTextures.size();
-    
-    // Chargement du canapé
-    OBJMesh couch;
-    char *opjPathCouch = "../obj/couch1.obj";
-    if (!loadOBJ(opjPathCouch, couch, baseUnit+matCount)) {
-        std::cerr << "Failed to load "<< opjPathCouch << std::endl;
-    } else {
-        std::cout << "Couch loaded: " << couch.count << " vertices, " << couch.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)couch.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << couch.materialNames[i] << "): texID=" << couch.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += couch.materialTextures.size();
-
-    // Chargement de la cheminée
-    OBJMesh fireplace;
-    char *objPathFireplace = "../obj/fireplace.obj";
-    if (!loadOBJ(objPathFireplace, fireplace, baseUnit+matCount)) {
-        std::cerr << "Failed to load "<< objPathFireplace << std::endl;
-    } else {
-        std::cout << "Fireplace loaded: " << fireplace.count << " vertices, " << fireplace.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)fireplace.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << fireplace.materialNames[i] << "): texID=" << fireplace.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += fireplace.materialTextures.size();
-
-    // Chargement de la bougie
-    OBJMesh candle;
-    char *objPathCandle = "../obj/candle.obj";
-    if (!loadOBJ(objPathCandle, candle, baseUnit+matCount)) {
-        std::cerr << "Failed to load "<< objPathCandle << std::endl;
-    } else {
-        std::cout << "Candle loaded: " << candle.count << " vertices, " << candle.materialTextures.size() << " materials" << std::endl;
-        for(int i = 0; i < (int)candle.materialTextures.size(); i++) {
-            std::cout << "  Material " << i << " (" << candle.materialNames[i] << "): texID=" << candle.materialTextures[i] << std::endl;
-        }
-    }
-    matCount += candle.materialTextures.size();
 
     GLuint smokeTex = createSmokeTexture();
-    // ====> DEBUG
-    std::cout << "Smoke texture created with ID: " << smokeTex << std::endl;
     glBindTextureUnit(0, smokeTex);
-    GLint locSmokeTex = glGetUniformLocation(smokeProgram, "smokeTexture");
-    if (locSmokeTex >= 0) {
-        glUniform1i(locSmokeTex, 0);
-        std::cout << "Smoke texture bound to unit 0" << std::endl;
-    } else {
-        std::cerr << "ERROR: smokeTexture uniform not found!" << std::endl;
+    // Location d'un uniform ; son absence passe par l'erreur habituelle
+    auto requireUniform = [](GLuint program, const char* name) {
+        GLint location = glGetUniformLocation(program, name);
+        if (location < 0) std::cerr << "ERROR: " << name << " uniform not found!" << std::endl;
+        return location;
+    };
+    int smokeGeneration = -1;
+    // Unité de la texture, renvoyée après chaque (re)chargement du programme
+    auto setupSmokeProgram = [&]() {
+        GLint locSmokeTex = requireUniform(smokeProgram, "smokeTexture");
+        if (locSmokeTex >= 0) glProgramUniform1i(smokeProgram, locSmokeTex, 0);
+        smokeGeneration = smokeHot->generation;
+    };
+    setupSmokeProgram();
+
+    GLint locFlameView, locFlameProj, locFlamePos, locFlameSize, locFlameTime;
+    int flameGeneration = -1;
+    // Locations de la flamme et unité de sa texture, après chaque (re)chargement
+    auto setupFlameProgram = [&]() {
+        locFlameView = requireUniform(flameProgram, "viewMatrix");
+        locFlameProj = requireUniform(flameProgram, "projMatrix");
+        locFlamePos = requireUniform(flameProgram, "flamePosition");
+        locFlameSize = requireUniform(flameProgram, "flameSize");
+        locFlameTime = requireUniform(flameProgram, "time");
+        GLint locFlameTex = requireUniform(flameProgram, "flameTexture");
+        if (locFlameTex >= 0) glProgramUniform1i(flameProgram, locFlameTex, 0);
+        flameGeneration = flameHot->generation;
+    };
+    setupFlameProgram();
+
+    // Transformations par draw (modèle + normales) calculées sur le CPU, renvoyées
+    // seulement pour les nœuds de la hiérarchie modifiés (voir la boucle de rendu)
+    DrawTransformBuffer drawTransforms;
+
+    // Chronométrage des passes (un seul multi-draw chacune : passe d'ombre = vertex seul)
+    // (--gpu-stats : sans lui, ni requête de timestamp ni lecture des compteurs GPU)
+    GpuTimer shadowPassTimer, shadowFilterTimer, mainPassTimer;
+    bool gpuStats = parseGpuStats(argc, argv);
+    shadowPassTimer.enabled = shadowFilterTimer.enabled = mainPassTimer.enabled = gpuStats;
+
+    // Frustum culling (caméra et lumière) : G passe de GPU à CPU puis à aucun
+    enum class CullingMode { GPU, CPU, OFF };
+    const char* cullingModeNames[] = { "GPU", "CPU (SIMD)", "OFF" };
+    CullingMode cullingMode = CullingMode::GPU;
+    GpuCulling culling;
+    culling.init(sceneGpu.indirectBuffer, sceneGpu.commandRanges, sceneGpu.sceneCommandCount);
+    CpuCulling cpuCulling;
+    cpuCulling.init(sceneGpu.sceneCommandCount);
+    DrawList drawList; // listes du culling CPU triées par clé d'état
+    // Visibilité par portails entre les pièces (modes GPU / CPU), V pour l'activer / la désactiver
+    PortalVisibility portalVisibility;
+    portalVisibility.init(sceneData);
+    bool portalCulling = true;
+    // Édition des pièces (Y, [ ], 9 0) : seuls les composants touchés sont renvoyés
+    RoomEditor roomEditor;
+    roomEditor.init(sceneData, roomVertices, roomIndices);
+    // Occlusion culling (mode GPU) : Hi-Z des gros objets de la frame, H pour l'activer / le désactiver
+    HiZBuffer hiZ;
+    hiZ.init(winWidth, winHeight);
+    bool occlusionCulling = true;
+    // Niveaux de détail choisis par le culling (erreur projetée < 1 pixel, 4 pour l'ombre), J pour les désactiver
+    LodSelection lodSelection;
+    bool meshLods = true;
+    // Meshlets des maillages denses au niveau complet (mode GPU), B pour les activer / désactiver
+    MeshletCulling meshletCulling;
+    meshletCulling.init(sceneGpu.meshlets, sceneGpu.meshletInstances);
+    bool useMeshlets = true;
+    Uint64 lastTimingPrint = SDL_GetTicks();
+
+    // Émetteurs de la scène : fumée (bout du cigare) et flammes (bougie)
+    std::vector<SmokeEmitter> smokeEmitters;
+    std::vector<const SceneEmitter*> flameEmitters;
+    for (auto const& e : sceneData.emitters) {
+        if (e.type == SCENE_EMITTER_SMOKE) smokeEmitters.emplace_back(glm::make_vec3(e.position));
+        else flameEmitters.push_back(&e);
     }
-    // <==== DEBUG
-
-    // Les objets
-    SimpleObj sTable = {table.vao, (int)table.count};
-    SimpleObj sFrame = {frame.vao, (int)frame.count};
-    SimpleObj sAshtray = {ashtray.vao, (int)ashtray.count};
-    SimpleObj sPipe = {pipe.vao, (int)pipe.count};
-    SimpleObj sCouch = {couch.vao, (int)couch.count};
-    SimpleObj sFireplace = {fireplace.vao, (int)fireplace.count};
-    SimpleObj sCandle = {candle.vao, (int)candle.count};
-
-    // Créer l'émetteur (positionné au bout du cigare)
-    glm::vec3 cigarTipPosition = glm::vec3(0.025f, 1.06f, -2.0f); 
-    SmokeEmitter smokeEmitter(cigarTipPosition);
+    const SceneLight* sunLight = sceneData.findLight(SCENE_LIGHT_SUN);
+    const SceneLight* pointLight = sceneData.findLight(SCENE_LIGHT_POINT); // scene.frag : une seule lumière ponctuelle
 
     bool running = true;
     bool printedOnce = false;
-    GLint locSunPosWorld = glGetUniformLocation(prg, "sunPositionWorld");
 
     // ====================================================================
     // Initialisation du Shadow mapping
     // ====================================================================
     ShadowMapping shadow;
     shadow.init();
-    // Compilation des shaders de profondeur
-    auto vsD = std::make_shared<Shader>(GL_VERTEX_SHADER, vsDepth);
-    auto fsD = std::make_shared<Shader>(GL_FRAGMENT_SHADER, fsDepth);
-    auto depthProgram = std::make_shared<Program>(vsD, fsD);
-    // Récupérer les locations pour pouvoir les utiliser plus tard
-    GLint locDepthLightSpace = glGetUniformLocation(depthProgram->getId(), "lightSpaceMatrix");
-    GLint locDepthModel = glGetUniformLocation(depthProgram->getId(), "model");
+    // Boîte de la scène (pièces) : profondeur couverte par les cascades
+    glm::vec3 sceneMin(1e30f), sceneMax(-1e30f);
+    for (auto const& room : sceneData.rooms) {
+        sceneMin = glm::min(sceneMin, glm::make_vec3(room.min));
+        sceneMax = glm::max(sceneMax, glm::make_vec3(room.max));
+    }
+    // Cascades gardées d'une frame à l'autre, redessinées seulement là où un
+    // objet a changé (--no-shadow-cache : toutes les cascades à chaque frame)
+    ShadowCache shadowCache;
+    shadowCache.enabled = parseShadowCache(argc, argv);
+    shadowCache.init(shadow.resolution, SHADOW_CASCADES, sceneGpu.commands, sceneGpu.commandRanges, sceneGpu.transforms,
+                     sceneGpu.sceneCommandCount);
+    // Cube map de la bougie, gardée tant que la lumière et les objets autour
+    // ne bougent pas (--no-point-shadows : bougie sans ombres)
+    PointShadow pointShadow;
+    pointShadow.enabled = parsePointShadows(argc, argv) && pointLight;
+    pointShadow.init(512, sceneGpu.sceneCommandCount, sceneGpu.roomCommandCount + sceneGpu.staticCommandCount);
+    // Réduction de profondeur (F ou --shadow-depth-reduction) : cascades resserrées
+    // sur la pré-passe Hi-Z ; elle lit un buffer du GPU à chaque frame
+    ShadowDepthReduction shadowReduction;
+    shadowReduction.init();
+    bool depthReduction = parseShadowDepthReduction(argc, argv);
+    // Le programme de profondeur (depth.vert/frag) est chargé avec les autres shaders ;
+    // "shadow" y ajoute shadow.geom pour remplir toutes les cascades en une passe
+    GLuint depthProgram = depthHot->id;
+    GLuint shadowProgram = shadowHot->id;
+    GLuint depthReduceProgram = depthReduceHot->id;
+    GLuint shadowFilterProgram = shadowFilterHot->id;
+    int shadowFilterGeneration = shadowFilterHot->generation; // rechargé : moments à refaire
+    GLuint shadowMipsProgram = shadowMipsHot->id;
+    int shadowMipsGeneration = shadowMipsHot->generation;
+    int shadowGeneration = shadowHot->generation; // rechargé : cascades à refaire
+    GLuint pointShadowProgram = pointShadowHot->id;
+    int pointShadowGeneration = pointShadowHot->generation;
+    GLuint cullProgram = cullHot->id;
+    GLuint hizProgram = hizHot->id;
+    GLuint meshletCullProgram = meshletCullHot->id;
 
     // ====================================================================
     // Boucle d'affichage / redering
@@ -812,10 +397,89 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
             if (event.type == SDL_EVENT_QUIT) running = false;
             if (event.type == SDL_EVENT_KEY_UP) keys[event.key.key] = false;
             if (event.type == SDL_EVENT_KEY_DOWN) keys[event.key.key] = true;
+            // T : écrit la dernière frame enregistrée (--gl-trace=record)
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_T && !event.key.repeat) {
+                if (glTable->dumpLastFrame("frame.gltrace")) std::cout << "GL trace written to frame.gltrace" << std::endl;
+                else std::cerr << "No recorded frame (run with --gl-trace=record)" << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_G && !event.key.repeat) {
+                cullingMode = (CullingMode)(((int)cullingMode + 1) % 3);
+                std::cout << "Frustum culling: " << cullingModeNames[(int)cullingMode] << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_H && !event.key.repeat) {
+                occlusionCulling = !occlusionCulling;
+                std::cout << "Hi-Z occlusion culling " << (occlusionCulling ? "ON" : "OFF") << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_B && !event.key.repeat) {
+                useMeshlets = !useMeshlets;
+                std::cout << "Meshlet culling " << (useMeshlets ? "ON" : "OFF") << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_J && !event.key.repeat) {
+                meshLods = !meshLods;
+                shadowCache.invalidate(); // niveaux de détail de la liste de la lumière
+                std::cout << "Mesh LOD " << (meshLods ? "ON" : "OFF") << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_V && !event.key.repeat) {
+                portalCulling = !portalCulling;
+                std::cout << "Portal culling " << (portalCulling ? "ON" : "OFF") << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_F && !event.key.repeat) {
+                depthReduction = !depthReduction;
+                std::cout << "Shadow depth reduction " << (depthReduction ? "ON" : "OFF") << std::endl;
+            }
+            // I : ombres du soleil filtrées EVSM ou PCF ; les moments ne sont tenus à
+            // jour qu'en EVSM, les cascades sont redessinées au changement
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_I && !event.key.repeat) {
+                shadow.filter = shadow.filter == SHADOW_FILTER_EVSM ? SHADOW_FILTER_PCF : SHADOW_FILTER_EVSM;
+                shadowCache.invalidate();
+                std::cout << "Shadow filter: " << (shadow.filter == SHADOW_FILTER_EVSM ? "EVSM" : "PCF 16 taps") << std::endl;
+            }
+            // 1 / 2 : réduction des fuites de lumière EVSM
+            if (event.type == SDL_EVENT_KEY_DOWN && (event.key.key == SDLK_1 || event.key.key == SDLK_2)) {
+                float step = event.key.key == SDLK_1 ? -0.05f : 0.05f;
+                shadow.lightBleedReduction = std::min(std::max(shadow.lightBleedReduction + step, 0.0f), 0.9f);
+                std::cout << "EVSM light bleeding reduction " << shadow.lightBleedReduction << std::endl;
+            }
+            if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_Y && !event.key.repeat)
+                roomEditor.selectNext(sceneData, sceneData.roomAt(glm::vec3(cameraPosition[0], cameraPosition[1], cameraPosition[2])));
         }//while
 
         if (keys[SDLK_ESCAPE]) running = false;
 
+        // Shaders modifiés sur disque : échange une fois le nouveau programme lié
+        shaderLibrary.update();
+        prg = sceneHot->id;
+        smokeProgram = smokeHot->id;
+        flameProgram = flameHot->id;
+        depthProgram = depthHot->id;
+        shadowProgram = shadowHot->id;
+        depthReduceProgram = depthReduceHot->id;
+        shadowFilterProgram = shadowFilterHot->id;
+        shadowMipsProgram = shadowMipsHot->id;
+        pointShadowProgram = pointShadowHot->id;
+        cullProgram = cullHot->id;
+        hizProgram = hizHot->id;
+        meshletCullProgram = meshletCullHot->id;
+        if (sceneHot->generation != sceneGeneration) setupSceneProgram();
+        if (smokeHot->generation != smokeGeneration) setupSmokeProgram();
+        if (flameHot->generation != flameGeneration) setupFlameProgram();
+        if (shadowHot->generation != shadowGeneration) {
+            shadowGeneration = shadowHot->generation;
+            shadowCache.invalidate();
+        }
+        if (shadowFilterHot->generation != shadowFilterGeneration) {
+            shadowFilterGeneration = shadowFilterHot->generation;
+            shadowCache.invalidate();
+        }
+        if (shadowMipsHot->generation != shadowMipsGeneration) {
+            shadowMipsGeneration = shadowMipsHot->generation;
+            shadowCache.invalidate();
+        }
+        if (pointShadowHot->generation != pointShadowGeneration) {
+            pointShadowGeneration = pointShadowHot->generation;
+            pointShadow.invalidate();
+        }
+
         // Camera controls
         if (keys[SDLK_LEFT]) angleY += rotationSpeed;
         if (keys[SDLK_RIGHT]) angleY -= rotationSpeed;
@@ -876,43 +540,73 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
         glClearColor(0.05f, 0.05f, 0.08f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Bind textures
-        glBindTextureUnit(0, wallTex);
-        // glBindTextureUnit(1, floorTex);
-        glBindTextureUnit(2, floorTex);
-        glBindTextureUnit(3, plinthTex);
-        glBindTextureUnit(4, stucTex);
-        glBindTextureUnit(5, doorTex);
-        glBindTextureUnit(6, windowTex);
-        
-        int currentOffset = 0; // Utiliser un offset cumulé
-        for(int i = 0; i < (int)table.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, table.materialTextures[i]);
-        currentOffset += (int) table.materialTextures.size(); // currentOffset = Taille Table
-        
-        for(int i = 0; i < (int)frame.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, frame.materialTextures[i]);
-        currentOffset += (int) frame.materialTextures.size(); // currentOffset = Taille Table + Taille Frame
-        
-        for(int i = 0; i < (int)ashtray.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, ashtray.materialTextures[i]); 
-        currentOffset += (int) ashtray.materialTextures.size(); // currentOffset = Taille Table + Taille Frame + Taille Ashtray
-        
-        for(int i = 0; i < (int)pipe.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, pipe.materialTextures[i]);
-        currentOffset += (int) pipe.materialTextures.size();
+        // Textures des matériaux (unités = slots de la scène)
+        bindSceneTextures(sceneGpu);
+
+        // Matrices monde : une fois par frame, pour toutes les passes (SSBO)
+        bool castersChanged = false; // commandes à comparer avec la shadow map en cache
+        if (sceneGpu.transforms.update()) {
+            // Objets statiques déplacés (édition) : leurs lots sont recuits
+            if (updateStaticBatches(sceneData, sceneGpu)) {
+                culling.updateBounds(sceneGpu.commandRanges);
+                for (GLsizei b = 0; b < sceneGpu.staticCommandCount; ++b) {
+                    shadowCache.invalidateCommand(sceneGpu.roomCommandCount + b);
+                    pointShadow.invalidateCommand(sceneGpu.roomCommandCount + b);
+                }
+            }
+            drawTransforms.uploadRange(sceneGpu.transforms.worldData(), sceneGpu.transforms.size(),
+                                       sceneGpu.transforms.changedBegin, sceneGpu.transforms.changedEnd);
+            cpuCulling.updateBounds(sceneGpu.commands, sceneGpu.commandRanges, sceneGpu.transforms);
+            portalVisibility.assignCommands(sceneGpu);
+            if (streamingEnabled) streaming.assignCells(sceneGpu);
+            castersChanged = true;
+        }
 
-        for(int i = 0; i < (int)couch.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, couch.materialTextures[i]);
-        currentOffset += (int) couch.materialTextures.size();
+        // Édition des pièces : ouverture choisie glissée le long de son mur, plafond
+        // de la pièce de la caméra ; seules les sous-plages modifiées sont renvoyées
+        const float editSpeed = 0.01f;
+        if (roomEditor.selectedOpening >= 0) {
+            if (keys[SDLK_LEFTBRACKET]) roomEditor.moveOpening(sceneData, (uint32_t)roomEditor.selectedOpening, -editSpeed);
+            if (keys[SDLK_RIGHTBRACKET]) roomEditor.moveOpening(sceneData, (uint32_t)roomEditor.selectedOpening, editSpeed);
+        }
+        int editedRoom = sceneData.roomAt(glm::vec3(cameraPosition[0], cameraPosition[1], cameraPosition[2]));
+        if (editedRoom >= 0) {
+            if (keys[SDLK_9]) roomEditor.changeRoomHeight(sceneData, (uint32_t)editedRoom, -editSpeed);
+            if (keys[SDLK_0]) roomEditor.changeRoomHeight(sceneData, (uint32_t)editedRoom, editSpeed);
+        }
+        uint32_t roomEdits = roomEditor.flush(sceneData, sceneGpu);
+        for (uint32_t room : roomEditor.editedRooms) {
+            shadowCache.invalidateCommand(room);
+            pointShadow.invalidateCommand(room);
+        }
+        if (roomEdits & ROOM_EDIT_BOUNDS) {
+            culling.updateBounds(sceneGpu.commandRanges);
+            cpuCulling.updateBounds(sceneGpu.commands, sceneGpu.commandRanges, sceneGpu.transforms);
+            castersChanged = true;
+        }
+        if (roomEdits & ROOM_EDIT_PORTALS) {
+            portalVisibility.init(sceneData);
+            portalVisibility.assignCommands(sceneGpu);
+        }
 
-        for(int i = 0; i < (int)fireplace.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, fireplace.materialTextures[i]);
-        currentOffset += (int) fireplace.materialTextures.size();
-        
-        for(int i = 0; i < (int)candle.materialTextures.size(); i++) 
-            glBindTextureUnit(baseUnit + currentOffset + i, candle.materialTextures[i]);
-        currentOffset += (int) candle.materialTextures.size();
+        // Streaming : ressources des pièces proches envoyées au GPU, puis les tampons qui en dépendent
+        if (streamingEnabled) {
+            uint32_t changes = streaming.update(glm::vec3(cameraPosition[0], cameraPosition[1], cameraPosition[2]), sceneGpu);
+            if (changes & STREAMING_MESHES_CHANGED) {
+                uploadSceneCommands(sceneData, sceneGpu);
+                culling.updateLods(sceneGpu.commandRanges);
+                meshletCulling.update(sceneGpu.meshlets, sceneGpu.meshletInstances);
+                castersChanged = true;
+            }
+            if (changes & STREAMING_TEXTURES_CHANGED) {
+                applySceneMaterials(prg, sceneData, sceneGpu);
+                bindSceneTextures(sceneGpu);
+            }
+        }
+        if (castersChanged) shadowCache.updateCasters(sceneGpu.commands, sceneGpu.commandRanges, sceneGpu.transforms);
+        if (pointLight) pointShadow.setLight(glm::make_vec3(pointLight->position), glm::make_vec3(pointLight->attenuation));
+        if (castersChanged || pointShadow.lightChanged)
+            pointShadow.updateCasters(sceneGpu.commands, sceneGpu.commandRanges, sceneGpu.transforms);
 
         if(!printedOnce) {
             std::cout << "\nESC = Quit" << std::endl;
@@ -921,6 +615,15 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
             std::cout << "M = Normal debug" << std::endl;
             std::cout << "U = UV debug" << std::endl;
             std::cout << "Normal = Actual render" << std::endl;
+            std::cout << "G = Frustum culling: GPU / CPU / off" << std::endl;
+            std::cout << "H = Toggle Hi-Z occlusion culling (GPU mode)" << std::endl;
+            std::cout << "J = Toggle mesh LOD (GPU / CPU culling)" << std::endl;
+            std::cout << "B = Toggle meshlet frustum / cone culling (GPU mode)" << std::endl;
+            std::cout << "V = Toggle portal culling between rooms (GPU / CPU culling)" << std::endl;
+            std::cout << "Y = Select next opening of the room, [ ] = slide it along its wall" << std::endl;
+            std::cout << "9 / 0 = Lower / raise the ceiling of the room" << std::endl;
+            std::cout << "F = Toggle shadow cascade depth reduction (GPU mode, Hi-Z on)" << std::endl;
+            std::cout << "I = Sun shadow filter: EVSM / PCF, 1 / 2 = less / more EVSM light bleeding reduction" << std::endl;
             printedOnce = true;
         }
 
@@ -929,34 +632,24 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
         glProgramUniformMatrix4fv(prg, projMatrixL, 1, GL_FALSE, projMatrix);
 
         // Ajuster l'éclairage
-        GLint gBrightness = glGetUniformLocation(prg, "globalBrightness");
         if (gBrightness >= 0) glUniform1f(gBrightness, globalBrightness);   
-        GLint lBrightness = glGetUniformLocation(prg, "localBrightness");
         if (lBrightness >= 0) glUniform1f(lBrightness, localBrightness);   
 
         // ====================================================================
         // DÉBUT DE LA LOGIQUE D'ÉCLAIRAGE ET D'ANIMATION DE LA FLAMME (AJOUTÉ)
         // ====================================================================
-        // Position de la flamme/lumière au-dessus de la bougie (constante)
-        glm::vec3 flamePos = glm::vec3(-0.44f, 1.515f, -1.9f);
         float currentTime = SDL_GetTicks() / 1000.0f;
-        const float BASE_SIZE = 0.12f;
-        // La flamme varie en taille
+        // La flamme varie en taille (taille de base : émetteur de la scène)
         float sizeWobble = ( sin(currentTime * 1.5) * 0.5 + sin(currentTime * 3.7) * 0.2  ) * 0.10f;
-        float currentFlameSize = BASE_SIZE * (1.0f + sizeWobble);
 
         // Calcul du Scintillement de l'Intensité Lumineuse 
         float intensityFlicker = 1.0f + 0.15f * sin(currentTime * 5.0f); // Variation entre 0.85 et 1.15
         float finalIntensity = intensityFlicker; // Intensité finale de la lumière ponctuelle
-        glm::vec3 lightColor = glm::vec3(1.0f, 0.6f, 0.1f); // Orange-Jaune très chaud
-        glm::vec3 finalLightColor = lightColor * finalIntensity * 0.6f; // Couleur finale incluant l'intensité du scintillement 
-
-        // Paramètres d'atténuation (constants pour cette source)
-        const float CONSTANT = 1.0f;
-        // const float LINEAR = 7.0f;  
-        // const float QUADRATIC = 18.0f;  // Trop agressif
-        const float LINEAR = 2.0f;  
-        const float QUADRATIC = 2.0f;
+        // Position, couleur et atténuation de la lumière ponctuelle : voir la scène
+        glm::vec3 pointLightPos = pointLight ? glm::make_vec3(pointLight->position) : glm::vec3(0.0f);
+        glm::vec3 pointLightColor = pointLight ? glm::make_vec3(pointLight->color) : glm::vec3(0.0f);
+        glm::vec3 pointLightAttenuation = pointLight ? glm::make_vec3(pointLight->attenuation) : glm::vec3(1.0f, 0.0f, 0.0f);
+        glm::vec3 finalLightColor = pointLightColor * finalIntensity; // Couleur finale incluant l'intensité du scintillement 
         // ====================================================================
         // FIN DE LA LOGIQUE D'ÉCLAIRAGE ET D'ANIMATION
         // ====================================================================
@@ -966,7 +659,7 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         // Définition de l'origine de la lumière (Centre de la fenêtre)
-        glm::vec3 sunPosOrigin = glm::vec3(10.0f, 2.0f, 3.5f); 
+        glm::vec3 sunPosOrigin = sunLight ? glm::make_vec3(sunLight->position) : glm::vec3(10.0f, 2.0f, 3.5f);
         // La direction doit pointer DEPUIS le soleil VERS le centre de la pièce
         glm::vec3 sunDir = glm::normalize(glm::vec3(0.0f, 0.0f, 0.0f) - sunPosOrigin);
         // glm::vec3 sunDir = glm::normalize(glm::vec3(-1.0f, 1.5f, -0.2f)); // Direction ajustée pour la projection au sol
@@ -975,30 +668,74 @@ void main() {} // Rien à faire, OpenGL écrit la profondeur tout seul
 
         if(locSunPosWorld >= 0) glProgramUniform3fv(prg, locSunPosWorld, 1, glm::value_ptr(sunPosOrigin)); 
 
-        // 1. Calcul de la matrice de lumière
-        glm::mat4 lightSpaceMatrix = shadow.getLightSpaceMatrix(sunPosOrigin, sunDir);
-        static int frameCount = 0;
-        // if (frameCount++ % 500 == 0) std::cout << "LightSpaceMatrix: " << glm::to_string(lightSpaceMatrix) << std::endl; // Affiche toutes les 500 frames pour ne pas flood la console
-
-        // --- PASSE 1 : REMPLIR LA SHADOW MAP ---
-        glEnable(GL_DEPTH_TEST);
-        glDepthMask(GL_TRUE);
-        glViewport(0, 0, shadow.resolution, shadow.resolution);
-        glBindFramebuffer(GL_FRAMEBUFFER, shadow.fbo);
-        glClear(GL_DEPTH_BUFFER_BIT);
-glDisable(GL_CULL_FACE);
-        glUseProgram(depthProgram->getId());
-        GLint locDepthModel = glGetUniformLocation(depthProgram->getId(), "model");
-        glUniformMatrix4fv(glGetUniformLocation(depthProgram->getId(), "lightSpaceMatrix"), 1, GL_FALSE, glm::value_ptr(lightSpaceMatrix)); 
-        glm::mat4 modelRoom = drawScene(depthProgram->getId(), locDepthModel, vao, indices.size(), sTable, sFrame, sAshtray, sPipe, sCouch, sFireplace, sCandle);
-        if(glGetError() != GL_NO_ERROR) {std::cout << "Erreur après drawScene!" << std::endl; break;}
-
-        /* glm::mat4 modelWindow = glm::mat4(1.0f);
-        glUniformMatrix4fv(glGetUniformLocation(depthProgram->getId(), "lightSpaceMatrix"), 1, GL_FALSE, glm::value_ptr(lightSpaceMatrix));
-        glBindVertexArray(windowVao);
-        glDrawElements(GL_TRIANGLES, windowIndices.size(), GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);        
-        */
+        // 1. Cascades de la lumière, calées sur la tranche de vue de la caméra
+        //    (resserrée par la réduction de profondeur des frames précédentes)
+        bool useHiZ = cullingMode == CullingMode::GPU && occlusionCulling;
+        bool reduceDepth = depthReduction && useHiZ;
+        if (!reduceDepth) shadowReduction.valid = false;
+        glm::mat4 cameraView = glm::make_mat4(viewMatrix), cameraProj = glm::make_mat4(projMatrix);
+        float shadowNear = 0.1f, shadowFar = shadow.maxDistance;
+        if (shadowReduction.valid) shadowReduction.viewRange(cameraProj, shadow.maxDistance, shadowNear, shadowFar);
+        shadow.setLight(sunDir, sceneMin, sceneMax);
+        shadow.fitCascades(cameraView, cameraProj, shadowNear, shadowFar);
+        // Cascades en cache : zones à redessiner cette frame (aucune le plus souvent),
+        // la liste de la lumière est cullée contre leur union seule
+        // Une cascade qui glisse avec la caméra garde ses texels : seules les bandes
+        // découvertes sont à redessiner
+        for (int c = 0; c < SHADOW_CASCADES; ++c) {
+            const ShadowCascade& cascade = shadow.cascades[c];
+            shadowCache.setLight(c, cascade.viewProj, cascade.translated ? &cascade.shift : nullptr);
+        }
+        std::vector<ShadowRect> shadowRegions;
+        bool renderShadow = shadowCache.begin(shadowRegions);
+        glm::mat4 lightCullMatrix = shadow.cullMatrix(shadowRegions);
+
+        // Culling : listes de commandes visibles par la caméra et par la lumière
+        drawTransforms.bind();
+        glm::mat4 cameraViewProj = cameraProj * cameraView;
+        if (useHiZ) {
+            hiZ.renderOccluders(depthProgram, depthVao, sceneGpu.occluderIndirectBuffer,
+                                sceneGpu.occluderCommandCount, cameraViewProj);
+            hiZ.build(hizProgram);
+            if (reduceDepth) shadowReduction.reduce(depthReduceProgram, hiZ.depthTexture, hiZ.width, hiZ.height);
+        }
+        lodSelection.cameraPosition = glm::vec3(cameraPosition[0], cameraPosition[1], cameraPosition[2]);
+        lodSelection.pixelsPerUnit = projMatrix[5] * winHeight * 0.5f;
+        lodSelection.thresholdPixels = meshLods ? 1.0f : 0.0f;
+        bool drawMeshlets = cullingMode == CullingMode::GPU && useMeshlets;
+        // Pièces vues à travers les portes ouvertes : les autres (et leurs objets)
+        // sont écartées de la liste de la caméra par le culling
+        bool usePortals = cullingMode != CullingMode::OFF && portalCulling;
+        if (usePortals) portalVisibility.update(lodSelection.cameraPosition, cameraViewProj);
+        portalVisibility.apply(sceneGpu, usePortals);
+        if (cullingMode == CullingMode::GPU) culling.cull(cullProgram, cameraViewProj, lightCullMatrix, useHiZ, lodSelection, drawMeshlets);
+        if (drawMeshlets) meshletCulling.cull(meshletCullProgram, culling.expandBuffer, cameraViewProj, lodSelection.cameraPosition);
+        else if (cullingMode == CullingMode::CPU) {
+            cpuCulling.cull(sceneGpu.commands, sceneGpu.commandRanges, cameraViewProj, lightCullMatrix, lodSelection);
+            cpuCulling.fillDrawList(drawList, sceneGpu.commandMaterials);
+        }
+        const GLuint drawPrograms[DRAW_PROGRAM_COUNT] = { shadowProgram, prg };
+        const GLuint drawVaos[DRAW_VAO_COUNT] = { sceneGpu.pool.vao, depthVao };
+
+        // --- PASSE 1 : REMPLIR LES CASCADES ---
+        // Une passe pour toutes les cascades (shadow.geom), seulement leurs zones
+        // sales (glScissorIndexed limite l'effacement et les draws)
+        shadowPassTimer.begin();
+        shadow.shiftLayers(shadowCache.shifts);
+        if (renderShadow) {
+            shadow.beginPass(shadowProgram, shadowRegions);
+            if (cullingMode == CullingMode::GPU) culling.draw(shadowProgram, depthVao, CULL_LIGHT);
+            else if (cullingMode == CullingMode::CPU) drawList.submit(DRAW_PASS_SHADOW, drawPrograms, drawVaos);
+            else drawScene(shadowProgram, depthVao, sceneGpu.batchIndirectBuffer, sceneGpu.batchCommandCount);
+            shadow.endPass();
+        }
+        // Cube map de la bougie : faces sales seulement, aucune la plupart du temps
+        pointShadow.render(pointShadowProgram, depthVao);
+        shadowPassTimer.end();
+        // Moments EVSM des zones redessinées (rien si les cascades sont à jour)
+        shadowFilterTimer.begin();
+        if (renderShadow) shadow.filterMoments(shadowFilterProgram, shadowMipsProgram, shadowRegions);
+        shadowFilterTimer.end();
 
         glUseProgram(prg);
         glDepthMask(GL_TRUE); 
@@ -1008,17 +745,12 @@ glDisable(GL_CULL_FACE);
         // ====================================================================
         // ENVOI DES UNIFORMS DE LA POINT LIGHT 
         // ====================================================================
-        GLint locLightPos = glGetUniformLocation(prg, "pointLight.position");
-        GLint locLightColor = glGetUniformLocation(prg, "pointLight.color");
-        GLint locLightAttenuation = glGetUniformLocation(prg, "pointLight.attenuation"); 
-        GLint locViewPos = glGetUniformLocation(prg, "viewPos");
-
         // 1. Position de la lumière (calculée plus haut)
-        if (locLightPos >= 0) glUniform3fv(locLightPos, 1, glm::value_ptr(flamePos));
+        if (locLightPos >= 0) glUniform3fv(locLightPos, 1, glm::value_ptr(pointLightPos));
         // 2. Couleur scintillante (calculée plus haut)
         if (locLightColor >= 0) glUniform3fv(locLightColor, 1, glm::value_ptr(finalLightColor));        
         // 3. Paramètres d'atténuation (calculés plus haut)
-        if (locLightAttenuation >= 0) glUniform3f(locLightAttenuation, CONSTANT, LINEAR, QUADRATIC);
+        if (locLightAttenuation >= 0) glUniform3fv(locLightAttenuation, 1, glm::value_ptr(pointLightAttenuation));
         // 4. Position de la caméra (pour les spéculaires dans le shader)
         if(locViewPos >= 0) glUniform3f(locViewPos, cameraPosition[0], cameraPosition[1], cameraPosition[2]);
         // ====================================================================
@@ -1026,127 +758,12 @@ glDisable(GL_CULL_FACE);
         // ====================================================================
 
         // Debug uniforms
-        GLint locDebug = glGetUniformLocation(prg, "debugMode");
         if(locDebug >= 0) glUniform1i(locDebug, keys[SDLK_N] ? 1 : 0);
-        
-        GLint locShowNormals = glGetUniformLocation(prg, "showNormals");
         if(locShowNormals >= 0) glUniform1i(locShowNormals, keys[SDLK_M] ? 1 : 0);
-        
-        GLint locShowUVs = glGetUniformLocation(prg, "showUVs");
         if(locShowUVs >= 0) glUniform1i(locShowUVs, keys[SDLK_U] ? 1 : 0);
 
-        // 1. Initialiser les matériaux de la room (0-7)
-        for(int i = 0; i < 8; i++) {
-            std::string kdName = "materialKd[" + std::to_string(i) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(i) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3f(prg, locKd, 0.8f, 0.8f, 0.8f); // Gris par défaut
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, 1); // Tous ont des textures
-        }//for
-        currentOffset = 0;        
-
-        // 2. Matériaux de la table
-        for(int i = 0; i < (int)table.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, table.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, table.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)table.materialProps.size();
-
-        // 3. Matériaux du frame
-        int frameOffset = baseUnit + table.materialProps.size();
-        for(int i = 0; i < (int)frame.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, frame.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, frame.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)frame.materialProps.size();
-
-        // 4. Matériaux du cendrier (ashtray)
-        int ashtrayOffset = frameOffset + frame.materialProps.size();
-        for (int i = 0; i < (int)ashtray.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, ashtray.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, ashtray.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)ashtray.materialProps.size();
-
-        // 5. Matériaux de la pipe (pipe)
-        for (int i = 0; i < (int)pipe.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, pipe.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, pipe.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)pipe.materialProps.size();
-
-        // 5. Matériaux du canapé (couch)
-        for (int i = 0; i < (int)couch.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, couch.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, couch.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)couch.materialProps.size();
-
-        // 6. Matériaux de la cheminée (fireplace)
-        for (int i = 0; i < (int)fireplace.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, fireplace.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, fireplace.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)fireplace.materialProps.size();
-
-        // 7. Matériaux de la bougie (candle)
-        for (int i = 0; i < (int)candle.materialProps.size(); i++) {
-            int idx = baseUnit + currentOffset + i;
-            std::string kdName = "materialKd[" + std::to_string(idx) + "]";
-            std::string hasTexName = "materialHasTex[" + std::to_string(idx) + "]";
-            
-            GLint locKd = glGetUniformLocation(prg, kdName.c_str());
-            GLint locHasTex = glGetUniformLocation(prg, hasTexName.c_str());
-            
-            if(locKd >= 0) glProgramUniform3fv(prg, locKd, 1, candle.materialProps[i].Kd);
-            if(locHasTex >= 0) glProgramUniform1i(prg, locHasTex, candle.materialProps[i].hasTexture ? 1 : 0);
-        }//for
-        currentOffset += (int)candle.materialProps.size();
+        // Les matériaux (materialKd / materialHasTex) sont envoyés une fois par
+        // chargement du programme : applySceneMaterials dans setupSceneProgram
 
         // ====================================================================
         // PHASE 1 : OBJETS OPAQUES (Murs, Sol, OBJs)
@@ -1165,38 +782,31 @@ glDisable(GL_CULL_FACE);
         glBindFramebuffer(GL_FRAMEBUFFER, 0); // Retour à l'écran
         glViewport(0, 0, winWidth, winHeight);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        // Envoyer la matrice de lumière (utiliser l'ID du programme)
-        GLint locLSM = glGetUniformLocation(prg, "lightSpaceMatrix");
-        if(locLSM >= 0) glUniformMatrix4fv(locLSM, 1, GL_FALSE, glm::value_ptr(lightSpaceMatrix));
-        GLint lView  = glGetUniformLocation(prg, "viewMatrix");
-        if(lView  >= 0) glUniformMatrix4fv(lView,  1, GL_FALSE, viewMatrix);
-        GLint lProj  = glGetUniformLocation(prg, "projMatrix");
-        if(lProj  >= 0) glUniformMatrix4fv(lProj,  1, GL_FALSE, projMatrix);
+        // Envoyer les cascades de la lumière et lier leur texture (PASSE 1)
+        shadow.applyUniforms(prg);
+        pointShadow.applyUniforms(prg);
+        if(viewMatrixL >= 0) glUniformMatrix4fv(viewMatrixL, 1, GL_FALSE, viewMatrix);
+        if(projMatrixL >= 0) glUniformMatrix4fv(projMatrixL, 1, GL_FALSE, projMatrix);
         // ??? GLint lModel = glGetUniformLocation(prg, "model");
         // ??? if(lModel >= 0) glUniformMatrix4fv(lModel, 1, GL_FALSE, glm::value_ptr(modelRoom)); 
-        // On lie la texture de la Shadow Map qu'on vient de remplir en PASSE 1
-        glActiveTexture(GL_TEXTURE1); 
-        glBindTexture(GL_TEXTURE_2D, shadow.depthTexture);
-        GLint locSM2 = glGetUniformLocation(prg, "shadowMap");
-        glUniform1i(locSM2, 1);
-        GLint locModel = glGetUniformLocation(prg, "model");
-        drawScene(prg, locModel, vao, indices.size(), sTable, sFrame, sAshtray, sPipe, sCouch, sFireplace, sCandle);
-        if(glGetError() != GL_NO_ERROR) {std::cout << "Erreur après drawScene (2)!" << std::endl; break;}
+        mainPassTimer.begin();
+        if (drawMeshlets) meshletCulling.draw(prg, sceneGpu.pool.vao);
+        if (cullingMode == CullingMode::GPU) culling.draw(prg, sceneGpu.pool.vao, CULL_CAMERA);
+        else if (cullingMode == CullingMode::CPU) drawList.submit(DRAW_PASS_OPAQUE, drawPrograms, drawVaos);
+        else drawScene(prg, sceneGpu.pool.vao, sceneGpu.batchIndirectBuffer, sceneGpu.batchCommandCount);
+        mainPassTimer.end();
 
         
         // Ajouter la fenêtre au rendu final
-        glm::mat4 modelWindow = glm::mat4(1.0f);
         glDisable(GL_CULL_FACE); // On désactive pour être sûr de voir la vitre
         glUniform1i(locRenderPass, 1);
-        glUniformMatrix4fv(locModel, 1, GL_FALSE, glm::value_ptr(glm::mat4(1.0f)));
-        glBindVertexArray(windowVao);
-        glDrawElements(GL_TRIANGLES, windowIndices.size(), GL_UNSIGNED_INT, 0);
-        if(glGetError() != GL_NO_ERROR) {std::cout << "Erreur après Window!" << std::endl; break;}
+        // Commande de la vitre : baseInstance = DRAW_ROOM => transformation identité
+        drawSceneCommand(sceneGpu.pool.vao, sceneGpu.indirectBuffer, sceneGpu.windowCommand);
         glEnable(GL_CULL_FACE);
         // glBindVertexArray(0);        
 
         // Update smoke (deltaTime = 0.016f pour 60 FPS, ou utilisez un timer réel)
-        smokeEmitter.update(0.010f);
+        for (auto& smokeEmitter : smokeEmitters) smokeEmitter.update(0.010f);
 
         // ====================================================================
         // PHASE 2 : OBJETS TRANSPARENTS (Vitre et God Rays)
@@ -1211,12 +821,9 @@ glDisable(GL_CULL_FACE);
         // On utilise glCullFace(GL_FRONT) pour les rayons volumétriques
         glCullFace(GL_FRONT); 
         
-        // Redessiner la pièce (seuls MatID 6 et 7 seront dessinés)
-        modelRoom = glm::mat4(1.0f);
-        glUniformMatrix4fv(locModel, 1, GL_FALSE, glm::value_ptr(modelRoom));
-        glBindVertexArray(vao);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
-        if(glGetError() != GL_NO_ERROR) {std::cout << "Erreur après MatID 6 & 7!" << std::endl; break;}
+        // Redessiner les pièces (seuls MatID 6 et 7 seront dessinés) : premières commandes,
+        // celles des pièces cachées par les portails ont instanceCount = 0
+        drawScene(prg, sceneGpu.pool.vao, sceneGpu.indirectBuffer, sceneGpu.roomCommandCount);
 
 
         // Configuration pour fumée 
@@ -1224,15 +831,13 @@ glDisable(GL_CULL_FACE);
         glDisable(GL_CULL_FACE); // Particules visibles des 2 côtés
 
         glBindTextureUnit(0, smokeTex);
-        GLint locSmokeTex = glGetUniformLocation(smokeProgram, "smokeTexture");
-        if (locSmokeTex >= 0) glUniform1i(locSmokeTex, 0);
 
         // Convertir viewMatrix et projMatrix en glm::mat4
         glm::mat4 viewMat = glm::make_mat4(viewMatrix);
         glm::mat4 projMat = glm::make_mat4(projMatrix);
         glm::vec3 camPos(cameraPosition[0], cameraPosition[1], cameraPosition[2]);
 
-        smokeEmitter.render(smokeProgram, viewMat, projMat, camPos);
+        for (auto& smokeEmitter : smokeEmitters) smokeEmitter.render(smokeProgram, viewMat, projMat, camPos);
 
         // Restaurer l'état
         glDepthMask(GL_TRUE);
@@ -1251,68 +856,28 @@ glDisable(GL_CULL_FACE);
 
         glUseProgram(flameProgram);
 
-        // Vérifier que le programme est valide
-        GLint isLinked = 0;
-        glGetProgramiv(flameProgram, GL_LINK_STATUS, &isLinked);
-        if (isLinked == GL_FALSE) {
-            std::cerr << "ERROR: Flame program not linked!" << std::endl;
-        }
-
-        // Position de la flamme au-dessus de la bougie
-        // glm::vec3 flamePos = glm::vec3(-0.44f, 1.515f, -1.9f);
-
-        // Récupérer les locations des uniforms
-        GLint locFlameView = glGetUniformLocation(flameProgram, "viewMatrix");
-        GLint locFlameProj = glGetUniformLocation(flameProgram, "projMatrix");
-        GLint locFlamePos = glGetUniformLocation(flameProgram, "flamePosition");
-        GLint locFlameSize = glGetUniformLocation(flameProgram, "flameSize");
-        GLint locFlameTime = glGetUniformLocation(flameProgram, "time");
-        GLint locFlameTex = glGetUniformLocation(flameProgram, "flameTexture");
-
-        // Debug: afficher les locations (une seule fois)
-        static bool debugPrinted = false;
-        if (!debugPrinted) {
-            std::cout << "Flame uniform locations:" << std::endl;
-            std::cout << "  viewMatrix: " << locFlameView << std::endl;
-            std::cout << "  projMatrix: " << locFlameProj << std::endl;
-            std::cout << "  flamePosition: " << locFlamePos << std::endl;
-            std::cout << "  flameSize: " << locFlameSize << std::endl;
-            std::cout << "  time: " << locFlameTime << std::endl;
-            std::cout << "  flameTexture: " << locFlameTex << std::endl;
-            debugPrinted = true;
-        }
+        // L'édition de liens est vérifiée au chargement (ShaderLibrary), les erreurs GL
+        // par la validation de la table (--gl-validation), les locations lues par
+        // setupFlameProgram : pas de requête ici.
 
         // Définir les uniforms
         if (locFlameView >= 0) glUniformMatrix4fv(locFlameView, 1, GL_FALSE, viewMatrix);
         if (locFlameProj >= 0) glUniformMatrix4fv(locFlameProj, 1, GL_FALSE, projMatrix);
-        if (locFlamePos >= 0) glUniform3fv(locFlamePos, 1, glm::value_ptr(flamePos));
-        if (locFlameSize >= 0) glUniform1f(locFlameSize, currentFlameSize); 
         if (locFlameTime >= 0) glUniform1f(locFlameTime, currentTime);
 
-        // Lier la texture AVANT de définir l'uniform
+        // Texture sur l'unité 0 (flameTexture, voir setupFlameProgram)
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, flameTex);
-        if (locFlameTex >= 0) {
-            glUniform1i(locFlameTex, 0);
-        }
-
-        // Vérifier erreurs OpenGL avant le rendu
-        GLenum err = glGetError();
-        if (err != GL_NO_ERROR) {
-            std::cerr << "OpenGL error before flame render: " << err << std::endl;
-        }
 
-        // Dessiner le billboard
+        // Un billboard par flamme de la scène
         glBindVertexArray(flameQuadVao);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-        if(glGetError() != GL_NO_ERROR) {std::cout << "Erreur après Draw Flame!" << std::endl; break;}
-
-
-        // Vérifier erreurs après rendu
-        err = glGetError();
-        if (err != GL_NO_ERROR) {
-            std::cerr << "OpenGL error after flame render: " << err << std::endl;
+        for (const SceneEmitter* flame : flameEmitters) {
+            float currentFlameSize = flame->size * (1.0f + sizeWobble);
+            if (locFlamePos >= 0) glUniform3fv(locFlamePos, 1, flame->position);
+            if (locFlameSize >= 0) glUniform1f(locFlameSize, currentFlameSize); 
+            glDrawArrays(GL_TRIANGLES, 0, 6);
         }
+
         // Restaurer l'état OpenGL
         glDepthMask(GL_TRUE);
         glEnable(GL_CULL_FACE);
@@ -1320,6 +885,99 @@ glDisable(GL_CULL_FACE);
 
         // Done
         SDL_GL_SwapWindow(window);
+        glTable->frameBoundary();
+
+        // Temps GPU des draws chronométrés, toutes les 2 secondes
+        if (SDL_GetTicks() - lastTimingPrint > 2000) {
+            lastTimingPrint = SDL_GetTicks();
+            if (gpuStats)
+                std::cout << "GPU scene: shadow pass " << shadowPassTimer.averageMs << " ms, "
+                          << (shadow.filter == SHADOW_FILTER_EVSM ? "EVSM filter " : "PCF (no filter pass) ")
+                          << shadowFilterTimer.averageMs << " ms, main pass "
+                          << mainPassTimer.averageMs << " ms (" << sceneGpu.sceneCommandCount << " objects, "
+                          << (cullingMode == CullingMode::OFF ? sceneGpu.batchCommandCount : sceneGpu.sceneCommandCount)
+                          << " draws each)" << std::endl;
+            // Compteurs du culling GPU : lecture synchrone, seulement avec --gpu-stats
+            bool cullCounters = cullingMode == CullingMode::CPU || (cullingMode == CullingMode::GPU && gpuStats);
+            if (cullingMode != CullingMode::OFF) {
+                GLuint counters[CULL_COUNTER_COUNT] = { (GLuint)cpuCulling.visibleCount[0], (GLuint)cpuCulling.visibleCount[1], 0,
+                                                        (GLuint)cpuCulling.triangleCount[0], (GLuint)cpuCulling.triangleCount[1] };
+                GLuint meshletCounters[MESHLET_COUNTER_COUNT] = {};
+                if (cullCounters) {
+                    if (cullingMode == CullingMode::GPU) culling.readCounters(counters);
+                    std::cout << cullingModeNames[(int)cullingMode] << " culling: " << counters[CULL_CAMERA] << "/" << sceneGpu.sceneCommandCount << " camera, "
+                              << counters[CULL_LIGHT] << "/" << sceneGpu.sceneCommandCount << " light";
+                    if (cullingMode == CullingMode::GPU && occlusionCulling)
+                        std::cout << ", " << counters[2] << " draws hidden by Hi-Z this frame";
+                    std::cout << std::endl;
+                    if (drawMeshlets) meshletCulling.readCounters(meshletCounters);
+                    std::cout << "Triangles" << (meshLods ? " (LOD)" : "") << ": " << counters[3] + meshletCounters[3] << " camera, "
+                              << counters[4] << " shadow" << std::endl;
+                }
+                if (usePortals)
+                    std::cout << "Portals: " << portalVisibility.visibleRoomCount() << "/" << sceneData.rooms.size()
+                              << " rooms visible from "
+                              << (portalVisibility.cameraRoom >= 0 ? sceneData.str(sceneData.rooms[portalVisibility.cameraRoom].name) : "outside")
+                              << ", " << portalVisibility.portalsTraversed << " portals traversed" << std::endl;
+                if (cullingMode == CullingMode::CPU) {
+                    auto printChanges = [](const DrawListStats& st) {
+                        std::cout << st.programChanges << " program, " << st.vaoChanges << " VAO, "
+                                  << st.materialChanges << " material";
+                    };
+                    std::cout << "Draw list: " << drawList.keys.size() << " draws in " << drawList.sortedStats.multiDraws
+                              << " multi-draws, state changes ";
+                    printChanges(drawList.sortedStats);
+                    std::cout << " (unsorted: ";
+                    printChanges(drawList.unsortedStats);
+                    std::cout << ")" << std::endl;
+                }
+                if (drawMeshlets && cullCounters)
+                    std::cout << "Meshlets: " << meshletCounters[0] << " drawn, " << meshletCounters[1] << " outside frustum, "
+                              << meshletCounters[2] << " back-facing (" << meshletCounters[3] << " triangles)" << std::endl;
+            }
+            if (roomEditor.stats.componentsRewritten || roomEditor.stats.componentsUnchanged) {
+                std::cout << "Room editing: " << roomEditor.stats.componentsRewritten << " components rewritten ("
+                          << roomEditor.stats.componentsUnchanged << " unchanged), "
+                          << roomEditor.stats.bytesUploaded / 1024 << " KB uploaded" << std::endl;
+                roomEditor.stats = RoomEditStats();
+            }
+            std::cout << "Shadow cascades (" << SHADOW_CASCADES << " x " << shadow.resolution << "²" << (shadowReduction.valid ? ", depth reduced" : "")
+                      << "): splits";
+            for (int c = 0; c < SHADOW_CASCADES; ++c) std::cout << " " << shadow.cascades[c].splitFar;
+            std::cout << " m, texels";
+            for (int c = 0; c < SHADOW_CASCADES; ++c) std::cout << " " << shadow.cascades[c].texelSize * 100.0f;
+            std::cout << " cm (single 20 m 2048² map: " << 2000.0f / 2048.0f << " cm)" << std::endl;
+            const ShadowCacheStats& sc = shadowCache.stats;
+            std::cout << "Shadow cache: " << sc.full << " full, " << sc.partial << " partial (" << sc.shifted
+                      << " shifted), " << sc.skipped << " skipped cascade updates, " << sc.texels / 1024
+                      << " K texels redrawn" << std::endl;
+            shadowCache.stats = ShadowCacheStats();
+            if (pointShadow.enabled) {
+                const PointShadowStats& ps = pointShadow.stats;
+                std::cout << "Point shadow: " << pointShadow.drawCommands.size() << " casters within "
+                          << pointShadow.farPlane << " m, " << ps.faceUpdates << " face updates (" << ps.faceDraws
+                          << " draw x face), " << ps.skipped << " frames cached" << std::endl;
+                pointShadow.stats = PointShadowStats();
+            }
+            if (streamingEnabled) {
+                const StreamingStats& st = streaming.stats;
+                std::cout << "Streaming: " << st.residentMeshes << "/" << streaming.meshResourceCount() << " meshes ("
+                          << st.meshBytes / 1024 << "/" << streamingBudget.meshBytes / 1024 << " KB), "
+                          << st.residentTextures << "/" << streaming.textureResourceCount() << " textures ("
+                          << st.textureBytes / 1024 << "/" << streamingBudget.textureBytes / 1024 << " KB), RAM "
+                          << st.ramBytes / 1024 << "/" << streamingBudget.ramBytes / 1024 << " KB, " << st.pending
+                          << " pending; hits " << st.hits << ", RAM hits " << st.ramHits << ", misses " << st.misses
+                          << ", evictions " << st.evictions << " VRAM / " << st.ramEvictions << " RAM" << std::endl;
+            }
+            std::cout << "State cache: " << glTable->getNumberOfRemovedCalls() << " redundant calls removed, "
+                      << glTable->getNumberOfForwardedCalls() << " forwarded" << std::endl;
+            glTable->resetCallCounters();
+            auto callStats = glTable->getLastFrameStatistics();
+            std::cout << "GL calls: " << glTable->getLastFrameNumberOfCalls() << " per frame, top:";
+            for (size_t i = 0; i < callStats.size() && i < 5; ++i)
+                std::cout << " " << callStats[i].first << " x" << callStats[i].second;
+            std::cout << std::endl;
+        }
     }//while
 
     SDL_GL_DestroyContext(context);
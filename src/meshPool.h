@@ -0,0 +1,392 @@
+#pragma once
+// ============================================================================
+// Pool de maillages statiques + commandes de draw indirect
+// ============================================================================
+// Sommets (format OBJMesh : 9 floats) et indices de tous les maillages
+// statiques dans un VBO, un EBO et un VAO communs. Chaque maillage n'est qu'une
+// plage (firstIndex, indexCount, baseVertex) : une passe entière se soumet avec
+// un seul glMultiDrawElementsIndirect, quel que soit le nombre d'objets.
+// Les niveaux de détail d'un maillage (meshSimplify.h) partagent ses sommets :
+// ce sont d'autres plages d'indices, choisies par commande au moment du culling.
+// Les passes de profondeur (ombres, pré-passe du Hi-Z) ne lisent que la
+// position : elles utilisent depthVao, un flux de positions seules (12 octets
+// par sommet au lieu de 36, mêmes numéros de sommets) et un EBO parallèle où
+// chaque indice désigne le premier sommet du maillage à la même position
+// (indexPositions). Les commandes, plages et niveaux de détail servent tels
+// quels aux deux VAO.
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+#include <map>
+
+const int MESH_VERTEX_FLOATS = 9; // position, normale, uv, materialID
+const int MESH_POSITION_FLOATS = 3; // flux de profondeur
+const int MESH_MAX_LODS = 4;      // niveau 0 = maillage complet
+
+// Disposition imposée par GL_DRAW_INDIRECT_BUFFER
+struct DrawElementsIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance; // index dans le SSBO des transformations (gl_BaseInstance)
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "DrawElementsIndirectCommand must match the GL layout");
+
+// Bornes dans l'espace du maillage (avant la matrice modèle) : boîte alignée
+// sur les axes et sphère centrée sur la boîte (rayon = sommet le plus éloigné)
+struct MeshBounds {
+    float min[3];
+    float max[3];
+    float center[3];
+    float radius;
+};
+
+inline MeshBounds computeMeshBounds(const float* vertices, size_t vertexCount) {
+    MeshBounds b = {};
+    for (size_t v = 0; v < vertexCount; ++v) {
+        const float* p = vertices + v * MESH_VERTEX_FLOATS;
+        for (int k = 0; k < 3; ++k) {
+            if (v == 0 || p[k] < b.min[k]) b.min[k] = p[k];
+            if (v == 0 || p[k] > b.max[k]) b.max[k] = p[k];
+        }
+    }
+    for (int k = 0; k < 3; ++k) b.center[k] = 0.5f * (b.min[k] + b.max[k]);
+    float radius2 = 0.0f;
+    for (size_t v = 0; v < vertexCount; ++v) {
+        const float* p = vertices + v * MESH_VERTEX_FLOATS;
+        float dx = p[0] - b.center[0], dy = p[1] - b.center[1], dz = p[2] - b.center[2];
+        radius2 = std::max(radius2, dx * dx + dy * dy + dz * dz);
+    }
+    b.radius = std::sqrt(radius2);
+    return b;
+}
+
+// Plage d'indices d'un niveau de détail et son erreur géométrique (unités du
+// maillage) : écart maximal estimé avec le maillage complet
+struct MeshLod {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    float error;
+};
+
+struct MeshRange {
+    uint32_t firstIndex;  // = lods[0]
+    uint32_t indexCount;
+    int32_t baseVertex;
+    MeshBounds bounds;
+    uint32_t lodCount;
+    MeshLod lods[MESH_MAX_LODS];
+    uint32_t firstMeshlet;  // meshlets du niveau 0 (meshlets.h), 0 si aucun
+    uint32_t meshletCount;
+};
+
+// Niveau le plus grossier dont l'erreur projetée reste sous thresholdPixels.
+// pixelsPerUnit : taille en pixels d'une unité monde à distance 1 (projection).
+inline uint32_t selectMeshLod(const MeshRange& range, float worldScale, float distance,
+                              float pixelsPerUnit, float thresholdPixels) {
+    float perError = worldScale * pixelsPerUnit / std::max(distance, 1e-3f);
+    uint32_t level = 0;
+    while (level + 1 < range.lodCount && range.lods[level + 1].error * perError <= thresholdPixels) ++level;
+    return level;
+}
+
+// Soupe de triangles (OBJ triangulé) -> sommets uniques + indices.
+// Les sommets identiques au bit près sont fusionnés.
+inline void indexVertexSoup(const float* soup, size_t vertexCount,
+                            std::vector<float>& vertices, std::vector<uint32_t>& indices) {
+    struct Key {
+        uint32_t bits[MESH_VERTEX_FLOATS];
+        bool operator==(const Key& o) const { return std::memcmp(bits, o.bits, sizeof(bits)) == 0; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            size_t h = 1469598103934665603ull;
+            for (uint32_t b : k.bits) h = (h ^ b) * 1099511628211ull;
+            return h;
+        }
+    };
+    std::unordered_map<Key, uint32_t, KeyHash> unique;
+    unique.reserve(vertexCount);
+    uint32_t base = (uint32_t)(vertices.size() / MESH_VERTEX_FLOATS);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        Key key;
+        std::memcpy(key.bits, soup + v * MESH_VERTEX_FLOATS, sizeof(key.bits));
+        auto inserted = unique.emplace(key, (uint32_t)unique.size());
+        if (inserted.second)
+            vertices.insert(vertices.end(), soup + v * MESH_VERTEX_FLOATS, soup + (v + 1) * MESH_VERTEX_FLOATS);
+        indices.push_back(base + inserted.first->second);
+    }
+}
+
+// Indices du flux de profondeur : chaque indice est remplacé par le premier
+// sommet du maillage qui a la même position (au bit près). Les sommets séparés
+// seulement par la normale ou les uv (arêtes vives, coutures) ne sont alors lus
+// et transformés qu'une fois par les passes de profondeur.
+inline void indexPositions(const float* vertices, size_t vertexCount, const uint32_t* indices, size_t indexCount,
+                           std::vector<uint32_t>& depthIndices) {
+    struct Key {
+        uint32_t bits[MESH_POSITION_FLOATS];
+        bool operator==(const Key& o) const { return std::memcmp(bits, o.bits, sizeof(bits)) == 0; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            size_t h = 1469598103934665603ull;
+            for (uint32_t b : k.bits) h = (h ^ b) * 1099511628211ull;
+            return h;
+        }
+    };
+    std::unordered_map<Key, uint32_t, KeyHash> first;
+    first.reserve(vertexCount);
+    std::vector<uint32_t> canonical(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        Key key;
+        std::memcpy(key.bits, vertices + v * MESH_VERTEX_FLOATS, sizeof(key.bits));
+        canonical[v] = first.emplace(key, (uint32_t)v).first->second;
+    }
+    for (size_t i = 0; i < indexCount; ++i) depthIndices.push_back(canonical[indices[i]]);
+}
+
+// Positions seules de sommets au format du pool
+inline void extractPositions(const float* vertices, size_t vertexCount, std::vector<float>& positions) {
+    positions.resize(vertexCount * MESH_POSITION_FLOATS);
+    for (size_t v = 0; v < vertexCount; ++v)
+        std::memcpy(positions.data() + v * MESH_POSITION_FLOATS, vertices + v * MESH_VERTEX_FLOATS,
+                    MESH_POSITION_FLOATS * sizeof(float));
+}
+
+// Allocation (premier bloc assez grand) de plages [offset, offset + size)
+// dans une région fixe ; les blocs libres voisins sont fusionnés
+struct RangeAllocator {
+    std::map<size_t, size_t> freeBlocks; // offset -> taille
+
+    void reset(size_t offset, size_t size) {
+        freeBlocks.clear();
+        if (size) freeBlocks[offset] = size;
+    }
+
+    bool allocate(size_t size, size_t& offset) {
+        for (auto it = freeBlocks.begin(); it != freeBlocks.end(); ++it) {
+            if (it->second < size) continue;
+            offset = it->first;
+            size_t remaining = it->second - size;
+            freeBlocks.erase(it);
+            if (remaining) freeBlocks[offset + size] = remaining;
+            return true;
+        }
+        return false;
+    }
+
+    void release(size_t offset, size_t size) {
+        if (!size) return;
+        auto next = freeBlocks.lower_bound(offset);
+        if (next != freeBlocks.end() && offset + size == next->first) {
+            size += next->second;
+            next = freeBlocks.erase(next);
+        }
+        if (next != freeBlocks.begin()) {
+            auto previous = std::prev(next);
+            if (previous->first + previous->second == offset) { previous->second += size; return; }
+        }
+        freeBlocks[offset] = size;
+    }
+};
+
+// Sommets et indices d'un maillage envoyé dans la région de streaming du pool
+struct MeshAllocation {
+    uint32_t firstVertex, vertexCount;
+    uint32_t firstIndex, indexCount;
+};
+
+// range : plages relatives au maillage (baseVertex 0, lods[0].firstIndex 0) ;
+// renvoie les plages absolues dans le pool
+inline MeshRange offsetMeshRange(MeshRange range, const MeshAllocation& allocation) {
+    for (uint32_t l = 0; l < range.lodCount; ++l) range.lods[l].firstIndex += allocation.firstIndex;
+    range.firstIndex = range.lods[0].firstIndex;
+    range.baseVertex = (int32_t)allocation.firstVertex;
+    return range;
+}
+
+// Plage dessinée pour un maillage absent du pool : aucun indice, pas de meshlets
+inline MeshRange emptyMeshRange(MeshRange range) {
+    for (uint32_t l = 0; l < range.lodCount; ++l) range.lods[l] = { 0, 0, range.lods[l].error };
+    range.firstIndex = range.indexCount = 0;
+    range.baseVertex = 0;
+    range.meshletCount = 0;
+    return range;
+}
+
+struct MeshPool {
+    std::vector<float> vertices;    // copie CPU, libérée par createGpu()
+    std::vector<uint32_t> indices;
+    std::vector<uint32_t> depthIndices; // même disposition que indices (indexPositions)
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    GLuint ebo = 0;
+    GLuint depthVao = 0;            // positions seules : passes de profondeur
+    GLuint positionVbo = 0;
+    GLuint depthEbo = 0;
+    // Région après les maillages statiques (createGpu avec streamVertices > 0),
+    // remplie par upload() et rendue par release()
+    RangeAllocator streamVertices;
+    RangeAllocator streamIndices;
+    size_t streamVertexCapacity = 0;
+    size_t streamIndexCapacity = 0;
+    // Sous-plages réécrites après createGpu (updateVertices / updateIndices : édition)
+    bool dynamicStorage = false;
+
+    // Octets GPU d'un sommet et d'un indice, flux de profondeur compris
+    static size_t vertexBytes(size_t vertexCount) {
+        return vertexCount * (MESH_VERTEX_FLOATS + MESH_POSITION_FLOATS) * sizeof(float);
+    }
+    static size_t indexBytes(size_t indexCount) { return indexCount * 2 * sizeof(uint32_t); }
+
+    // Indices relatifs au premier sommet du maillage (baseVertex). Les bornes
+    // sont recalculées si elles ne sont pas fournies (déjà connues pour un OBJ).
+    // Sans lods, tous les indices forment l'unique niveau ; sinon meshIndices
+    // contient tous les niveaux et lods[i].firstIndex y est relatif.
+    // meshDepthIndices : indices du flux de profondeur (indexPositions), les
+    // mêmes que meshIndices s'ils ne sont pas fournis (géométrie réécrite par
+    // sous-plages : un indice ne doit pas désigner un sommet d'une autre sous-plage).
+    MeshRange add(const float* meshVertices, size_t vertexCount, const uint32_t* meshIndices, size_t indexCount,
+                  const MeshBounds* bounds = nullptr, const MeshLod* lods = nullptr, uint32_t lodCount = 0,
+                  const uint32_t* meshDepthIndices = nullptr) {
+        MeshRange range;
+        uint32_t base = (uint32_t)indices.size();
+        if (!lods) {
+            range.lodCount = 1;
+            range.lods[0] = { 0, (uint32_t)indexCount, 0.0f };
+        } else {
+            range.lodCount = std::min(lodCount, (uint32_t)MESH_MAX_LODS);
+            std::copy(lods, lods + range.lodCount, range.lods);
+        }
+        for (uint32_t l = 0; l < range.lodCount; ++l) range.lods[l].firstIndex += base;
+        range.firstIndex = range.lods[0].firstIndex;
+        range.indexCount = range.lods[0].indexCount;
+        range.baseVertex = (int32_t)(vertices.size() / MESH_VERTEX_FLOATS);
+        range.bounds = bounds ? *bounds : computeMeshBounds(meshVertices, vertexCount);
+        range.firstMeshlet = range.meshletCount = 0;
+        vertices.insert(vertices.end(), meshVertices, meshVertices + vertexCount * MESH_VERTEX_FLOATS);
+        indices.insert(indices.end(), meshIndices, meshIndices + indexCount);
+        if (!meshDepthIndices) meshDepthIndices = meshIndices;
+        depthIndices.insert(depthIndices.end(), meshDepthIndices, meshDepthIndices + indexCount);
+        return range;
+    }
+
+    // streamVertices / streamIndices : place réservée après les maillages
+    // statiques pour les maillages chargés plus tard (upload)
+    void createGpu(size_t streamVertexCount = 0, size_t streamIndexCount = 0) {
+        size_t staticVertexCount = vertices.size() / MESH_VERTEX_FLOATS;
+        size_t staticIndexCount = indices.size();
+        GLbitfield flags = streamVertexCount || dynamicStorage ? GL_DYNAMIC_STORAGE_BIT : 0;
+        std::vector<float> positions;
+        extractPositions(vertices.data(), staticVertexCount, positions);
+        glCreateBuffers(1, &vbo);
+        glCreateBuffers(1, &ebo);
+        glCreateBuffers(1, &positionVbo);
+        glCreateBuffers(1, &depthEbo);
+        if (streamVertexCount) {
+            glNamedBufferStorage(vbo, (staticVertexCount + streamVertexCount) * MESH_VERTEX_FLOATS * sizeof(float), nullptr, flags);
+            glNamedBufferStorage(ebo, (staticIndexCount + streamIndexCount) * sizeof(uint32_t), nullptr, flags);
+            glNamedBufferStorage(positionVbo, (staticVertexCount + streamVertexCount) * MESH_POSITION_FLOATS * sizeof(float),
+                                 nullptr, flags);
+            glNamedBufferStorage(depthEbo, (staticIndexCount + streamIndexCount) * sizeof(uint32_t), nullptr, flags);
+            if (!vertices.empty()) glNamedBufferSubData(vbo, 0, vertices.size() * sizeof(float), vertices.data());
+            if (!indices.empty()) glNamedBufferSubData(ebo, 0, indices.size() * sizeof(uint32_t), indices.data());
+            if (!positions.empty()) glNamedBufferSubData(positionVbo, 0, positions.size() * sizeof(float), positions.data());
+            if (!depthIndices.empty()) glNamedBufferSubData(depthEbo, 0, depthIndices.size() * sizeof(uint32_t), depthIndices.data());
+        } else {
+            glNamedBufferStorage(vbo, vertices.size() * sizeof(float), vertices.data(), flags);
+            glNamedBufferStorage(ebo, indices.size() * sizeof(uint32_t), indices.data(), flags);
+            glNamedBufferStorage(positionVbo, positions.size() * sizeof(float), positions.data(), flags);
+            glNamedBufferStorage(depthEbo, depthIndices.size() * sizeof(uint32_t), depthIndices.data(), flags);
+        }
+        streamVertices.reset(staticVertexCount, streamVertexCount);
+        streamIndices.reset(staticIndexCount, streamIndexCount);
+        streamVertexCapacity = streamVertexCount;
+        streamIndexCapacity = streamIndexCount;
+        glCreateVertexArrays(1, &vao);
+        glVertexArrayVertexBuffer(vao, 0, vbo, 0, MESH_VERTEX_FLOATS * sizeof(float));
+        glVertexArrayElementBuffer(vao, ebo);
+        const GLint sizes[] = { 3, 3, 2, 1 };
+        const GLuint offsets[] = { 0, 3, 6, 8 };
+        for (GLuint a = 0; a < 4; ++a) {
+            glEnableVertexArrayAttrib(vao, a);
+            glVertexArrayAttribFormat(vao, a, sizes[a], GL_FLOAT, GL_FALSE, offsets[a] * sizeof(float));
+            glVertexArrayAttribBinding(vao, a, 0);
+        }
+        glCreateVertexArrays(1, &depthVao);
+        glVertexArrayVertexBuffer(depthVao, 0, positionVbo, 0, MESH_POSITION_FLOATS * sizeof(float));
+        glVertexArrayElementBuffer(depthVao, depthEbo);
+        glEnableVertexArrayAttrib(depthVao, 0);
+        glVertexArrayAttribFormat(depthVao, 0, MESH_POSITION_FLOATS, GL_FLOAT, GL_FALSE, 0);
+        glVertexArrayAttribBinding(depthVao, 0, 0);
+        std::vector<float>().swap(vertices);
+        std::vector<uint32_t>().swap(indices);
+        std::vector<uint32_t>().swap(depthIndices);
+    }
+
+    // Copie un maillage dans la région de streaming ; false si la place manque
+    bool upload(const float* meshVertices, size_t vertexCount, const uint32_t* meshIndices, size_t indexCount,
+                const uint32_t* meshDepthIndices, MeshAllocation& allocation) {
+        size_t firstVertex, firstIndex;
+        if (!streamVertices.allocate(vertexCount, firstVertex)) return false;
+        if (!streamIndices.allocate(indexCount, firstIndex)) {
+            streamVertices.release(firstVertex, vertexCount);
+            return false;
+        }
+        glNamedBufferSubData(vbo, firstVertex * MESH_VERTEX_FLOATS * sizeof(float),
+                             vertexCount * MESH_VERTEX_FLOATS * sizeof(float), meshVertices);
+        glNamedBufferSubData(ebo, firstIndex * sizeof(uint32_t), indexCount * sizeof(uint32_t), meshIndices);
+        uploadDepth(firstVertex, vertexCount, meshVertices, firstIndex, indexCount, meshDepthIndices);
+        allocation = { (uint32_t)firstVertex, (uint32_t)vertexCount, (uint32_t)firstIndex, (uint32_t)indexCount };
+        return true;
+    }
+
+    // Sous-plage de sommets déjà dans le VBO (dynamicStorage), positions comprises
+    void updateVertices(size_t firstVertex, size_t vertexCount, const float* meshVertices) const {
+        glNamedBufferSubData(vbo, firstVertex * MESH_VERTEX_FLOATS * sizeof(float),
+                             vertexCount * MESH_VERTEX_FLOATS * sizeof(float), meshVertices);
+        uploadDepth(firstVertex, vertexCount, meshVertices, 0, 0, nullptr);
+    }
+
+    // Sous-plage d'indices (relatifs au baseVertex de leur maillage) déjà dans
+    // l'EBO ; les mêmes dans le flux de profondeur (maillage ajouté sans meshDepthIndices)
+    void updateIndices(size_t firstIndex, size_t indexCount, const uint32_t* meshIndices) const {
+        glNamedBufferSubData(ebo, firstIndex * sizeof(uint32_t), indexCount * sizeof(uint32_t), meshIndices);
+        glNamedBufferSubData(depthEbo, firstIndex * sizeof(uint32_t), indexCount * sizeof(uint32_t), meshIndices);
+    }
+
+    void release(const MeshAllocation& allocation) {
+        streamVertices.release(allocation.firstVertex, allocation.vertexCount);
+        streamIndices.release(allocation.firstIndex, allocation.indexCount);
+    }
+
+private:
+    void uploadDepth(size_t firstVertex, size_t vertexCount, const float* meshVertices,
+                     size_t firstIndex, size_t indexCount, const uint32_t* meshDepthIndices) const {
+        std::vector<float> positions;
+        extractPositions(meshVertices, vertexCount, positions);
+        if (vertexCount)
+            glNamedBufferSubData(positionVbo, firstVertex * MESH_POSITION_FLOATS * sizeof(float),
+                                 positions.size() * sizeof(float), positions.data());
+        if (indexCount)
+            glNamedBufferSubData(depthEbo, firstIndex * sizeof(uint32_t), indexCount * sizeof(uint32_t), meshDepthIndices);
+    }
+};
+
+// --no-depth-stream : passes de profondeur sur le VAO complet (comparaison)
+inline bool parseDepthStream(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--no-depth-stream") == 0) return false;
+    return true;
+}
+
+inline DrawElementsIndirectCommand makeDrawCommand(const MeshRange& range, GLuint baseInstance) {
+    DrawElementsIndirectCommand cmd = { range.indexCount, 1, range.firstIndex, range.baseVertex, baseInstance };
+    return cmd;
+}
@@ -0,0 +1,227 @@
+#pragma once
+// ============================================================================
+// Simplification de maillage (quadriques d'erreur, Garland-Heckbert)
+// ============================================================================
+// Fusion d'arêtes "demi-arête" : un sommet est déplacé sur un voisin existant,
+// donc aucun nouveau sommet n'est créé et les niveaux de détail réutilisent le
+// même tableau de sommets que le maillage complet (seuls les indices changent).
+// Les coutures (sommets de même position mais d'UV, normale ou matériau
+// différents) et les bords ouverts sont verrouillés : ils ne bougent jamais,
+// ce qui préserve les coutures d'UV et de matériaux.
+
+#include <cmath>
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+#include "meshPool.h" // MESH_VERTEX_FLOATS
+
+// Quadrique symétrique 4x4 (10 coefficients)
+struct Quadric {
+    double q[10] = {};
+
+    void addPlane(double a, double b, double c, double d) {
+        q[0] += a * a; q[1] += a * b; q[2] += a * c; q[3] += a * d;
+        q[4] += b * b; q[5] += b * c; q[6] += b * d;
+        q[7] += c * c; q[8] += c * d;
+        q[9] += d * d;
+    }
+
+    void add(const Quadric& o) {
+        for (int i = 0; i < 10; ++i) q[i] += o.q[i];
+    }
+
+    // Somme des carrés des distances aux plans accumulés
+    double evaluate(const float* p) const {
+        double x = p[0], y = p[1], z = p[2];
+        return q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x
+             + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y
+             + q[7] * z * z + 2 * q[8] * z
+             + q[9];
+    }
+};
+
+// Réduit indices (triangles) vers targetIndexCount sans dépasser maxError.
+// Renvoie les nouveaux indices ; outError reçoit l'erreur géométrique maximale
+// des fusions faites (unités du maillage).
+inline std::vector<uint32_t> simplifyMesh(const float* vertices, size_t vertexCount,
+                                          const std::vector<uint32_t>& indices, size_t targetIndexCount,
+                                          float maxError, float& outError) {
+    auto position = [&](uint32_t v) { return vertices + (size_t)v * MESH_VERTEX_FLOATS; };
+    outError = 0.0f;
+
+    // Sommets de même position : coutures (verrouillées)
+    std::vector<uint32_t> positionId(vertexCount);
+    std::vector<uint32_t> positionUsers;
+    {
+        struct Key {
+            uint32_t bits[3];
+            bool operator==(const Key& o) const { return std::memcmp(bits, o.bits, sizeof(bits)) == 0; }
+        };
+        struct KeyHash {
+            size_t operator()(const Key& k) const { return k.bits[0] * 73856093u ^ k.bits[1] * 19349663u ^ k.bits[2] * 83492791u; }
+        };
+        std::unordered_map<Key, uint32_t, KeyHash> ids;
+        for (size_t v = 0; v < vertexCount; ++v) {
+            Key key;
+            std::memcpy(key.bits, position((uint32_t)v), sizeof(key.bits));
+            auto it = ids.emplace(key, (uint32_t)ids.size()).first;
+            positionId[v] = it->second;
+            if (positionUsers.size() <= it->second) positionUsers.resize(it->second + 1, 0);
+            ++positionUsers[it->second];
+        }
+    }
+    std::vector<uint8_t> locked(vertexCount, 0);
+    for (size_t v = 0; v < vertexCount; ++v)
+        if (positionUsers[positionId[v]] > 1) locked[v] = 1;
+
+    // Arêtes de bord (un seul triangle, en positions) : verrouillées aussi
+    size_t triangleCount = indices.size() / 3;
+    {
+        std::unordered_map<uint64_t, uint32_t> edgeUses;
+        auto edgeKey = [&](uint32_t a, uint32_t b) {
+            uint64_t pa = positionId[a], pb = positionId[b];
+            return pa < pb ? (pa << 32 | pb) : (pb << 32 | pa);
+        };
+        for (size_t t = 0; t < triangleCount; ++t)
+            for (int e = 0; e < 3; ++e) ++edgeUses[edgeKey(indices[3 * t + e], indices[3 * t + (e + 1) % 3])];
+        for (size_t t = 0; t < triangleCount; ++t)
+            for (int e = 0; e < 3; ++e) {
+                uint32_t a = indices[3 * t + e], b = indices[3 * t + (e + 1) % 3];
+                if (edgeUses[edgeKey(a, b)] == 1) locked[a] = locked[b] = 1;
+            }
+    }
+
+    // Quadriques (plans des triangles adjacents) et adjacence sommet -> triangles
+    std::vector<Quadric> quadrics(vertexCount);
+    std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+    std::vector<uint32_t> tris(indices);
+    std::vector<uint8_t> alive(triangleCount, 1);
+    auto triangleNormal = [&](uint32_t a, uint32_t b, uint32_t c, double n[3]) {
+        const float *pa = position(a), *pb = position(b), *pc = position(c);
+        double e1[3] = { pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2] };
+        double e2[3] = { pc[0] - pa[0], pc[1] - pa[1], pc[2] - pa[2] };
+        n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+        return std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    };
+    for (size_t t = 0; t < triangleCount; ++t) {
+        uint32_t a = tris[3 * t], b = tris[3 * t + 1], c = tris[3 * t + 2];
+        double n[3];
+        double length = triangleNormal(a, b, c, n);
+        if (length > 0.0) {
+            for (double& x : n) x /= length;
+            const float* pa = position(a);
+            double d = -(n[0] * pa[0] + n[1] * pa[1] + n[2] * pa[2]);
+            for (uint32_t v : { a, b, c }) quadrics[v].addPlane(n[0], n[1], n[2], d);
+        }
+        for (uint32_t v : { a, b, c }) vertexTriangles[v].push_back((uint32_t)t);
+    }
+
+    // File de priorité des fusions from -> to (coût recalculé à la sortie)
+    struct Collapse {
+        double cost;
+        uint32_t from, to;
+        bool operator<(const Collapse& o) const { return cost > o.cost; }
+    };
+    std::priority_queue<Collapse> heap;
+    std::vector<uint8_t> removed(vertexCount, 0);
+    auto pushEdgesAround = [&](uint32_t v) {
+        for (uint32_t t : vertexTriangles[v]) {
+            if (!alive[t]) continue;
+            for (int k = 0; k < 3; ++k) {
+                uint32_t w = tris[3 * t + k];
+                if (w == v) continue;
+                if (!locked[w]) heap.push({ quadrics[w].evaluate(position(v)), w, v });
+                if (!locked[v]) heap.push({ quadrics[v].evaluate(position(w)), v, w });
+            }
+        }
+    };
+    for (size_t t = 0; t < triangleCount; ++t)
+        for (int e = 0; e < 3; ++e) {
+            uint32_t a = tris[3 * t + e], b = tris[3 * t + (e + 1) % 3];
+            if (!locked[a]) heap.push({ quadrics[a].evaluate(position(b)), a, b });
+            if (!locked[b]) heap.push({ quadrics[b].evaluate(position(a)), b, a });
+        }
+
+    size_t liveIndexCount = indices.size();
+    double maxCost = 0.0, costLimit = (double)maxError * maxError;
+    while (liveIndexCount > targetIndexCount && !heap.empty()) {
+        Collapse c = heap.top();
+        heap.pop();
+        if (removed[c.from] || removed[c.to]) continue;
+        double cost = quadrics[c.from].evaluate(position(c.to));
+        if (cost > c.cost * 1.0001 + 1e-12) { heap.push({ cost, c.from, c.to }); continue; } // entrée périmée
+        if (cost > costLimit) break; // plus aucune fusion assez bon marché
+
+        // Refus si un triangle restant se retourne ou dégénère
+        bool valid = false, flips = false;
+        for (uint32_t t : vertexTriangles[c.from]) {
+            if (!alive[t]) continue;
+            uint32_t* tri = &tris[3 * t];
+            if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) { valid = true; continue; }
+            uint32_t moved[3] = { tri[0], tri[1], tri[2] };
+            for (uint32_t& v : moved) if (v == c.from) v = c.to;
+            double before[3], after[3];
+            double lb = triangleNormal(tri[0], tri[1], tri[2], before);
+            double la = triangleNormal(moved[0], moved[1], moved[2], after);
+            if (la <= 1e-12 || (before[0] * after[0] + before[1] * after[1] + before[2] * after[2]) < 0.2 * lb * la) {
+                flips = true;
+                break;
+            }
+        }
+        if (!valid || flips) continue; // from et to ne partagent plus de triangle, ou géométrie invalide
+
+        for (uint32_t t : vertexTriangles[c.from]) {
+            if (!alive[t]) continue;
+            uint32_t* tri = &tris[3 * t];
+            if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) {
+                alive[t] = 0;
+                liveIndexCount -= 3;
+            } else {
+                for (int k = 0; k < 3; ++k) if (tri[k] == c.from) tri[k] = c.to;
+                vertexTriangles[c.to].push_back(t);
+            }
+        }
+        removed[c.from] = 1;
+        quadrics[c.to].add(quadrics[c.from]);
+        maxCost = std::max(maxCost, cost);
+        pushEdgesAround(c.to);
+    }
+
+    std::vector<uint32_t> out;
+    out.reserve(liveIndexCount);
+    for (size_t t = 0; t < triangleCount; ++t)
+        if (alive[t]) out.insert(out.end(), &tris[3 * t], &tris[3 * t] + 3);
+    outError = (float)std::sqrt(maxCost);
+    return out;
+}
+
+// Chaîne de niveaux de détail : chaque niveau vise la moitié des triangles du
+// précédent, avec une erreur plafonnée à une fraction du rayon du maillage.
+// Les indices des niveaux 1+ sont ajoutés à la fin de indices (niveau 0 = les
+// indices reçus) ; lods[].firstIndex est relatif au début de indices.
+// Un niveau qui ne gagne pas au moins 20 % de triangles arrête la chaîne.
+inline uint32_t buildMeshLods(const float* vertices, size_t vertexCount, std::vector<uint32_t>& indices,
+                              float radius, MeshLod lods[MESH_MAX_LODS]) {
+    const float maxErrorOfRadius = 0.1f;
+    lods[0] = { 0, (uint32_t)indices.size(), 0.0f };
+    uint32_t lodCount = 1;
+    std::vector<uint32_t> previous(indices);
+    while (lodCount < (uint32_t)MESH_MAX_LODS) {
+        float error = 0.0f;
+        std::vector<uint32_t> next = simplifyMesh(vertices, vertexCount, previous, previous.size() / 2,
+                                                  radius * maxErrorOfRadius, error);
+        if (next.empty() || next.size() > previous.size() * 4 / 5) break;
+        // Simplifié depuis le niveau précédent : les erreurs s'additionnent (borne prudente)
+        lods[lodCount] = { (uint32_t)indices.size(), (uint32_t)next.size(), lods[lodCount - 1].error + error };
+        indices.insert(indices.end(), next.begin(), next.end());
+        previous.swap(next);
+        ++lodCount;
+    }
+    return lodCount;
+}
@@ -0,0 +1,266 @@
+#pragma once
+// ============================================================================
+// Meshlets : petits groupes de triangles cullés sur le GPU (shaders/meshletCull.comp)
+// ============================================================================
+// À la cuisson, les indices du niveau de détail complet d'un maillage dense sont
+// réordonnés en meshlets d'au plus 64 sommets et 124 triangles : un meshlet est
+// une plage contiguë de ces indices, donc le maillage entier se dessine toujours
+// d'un seul draw. Chaque meshlet garde une sphère englobante et un cône de
+// normales (axe, apex, cutoff) : vu depuis l'intérieur du cône inversé, tous ses
+// triangles sont de dos.
+// Au rendu, cull.comp marque les objets de la liste caméra dessinés au niveau
+// complet ; la passe meshlet teste leurs meshlets (frustum, cône) et émet une
+// commande indirecte par meshlet restant.
+
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "meshPool.h"
+#include "gpuCulling.h" // extractFrustumPlanes, CULL_GROUP_SIZE, LodSelection
+
+const uint32_t MESHLET_MAX_VERTICES = 64;
+const uint32_t MESHLET_MAX_TRIANGLES = 124;
+const uint32_t MESHLET_MIN_MESH_TRIANGLES = 1024; // en dessous, le culling par objet suffit
+
+// Disposition std430 de meshletCull.comp
+struct Meshlet {
+    float center[3];
+    float radius;
+    float coneApex[3];
+    float coneCutoff;        // >= 1 : cône trop ouvert, jamais rejeté
+    float coneAxis[3];
+    uint32_t triangleCount;
+    uint32_t firstIndex;     // relatif au maillage à la cuisson, absolu dans le pool sur le GPU
+    uint32_t padding[3];
+};
+static_assert(sizeof(Meshlet) == 64, "Meshlet must match meshletCull.comp");
+
+// Sphère et cône d'un meshlet (cône à la meshoptimizer : l'apex recule le long
+// de l'axe jusqu'à ce que tous les plans des triangles soient devant lui)
+inline void computeMeshletBounds(const float* vertices, const uint32_t* indices, Meshlet& m) {
+    auto position = [&](uint32_t v) { return glm::make_vec3(vertices + (size_t)v * MESH_VERTEX_FLOATS); };
+    glm::vec3 lo(position(indices[0])), hi(lo);
+    for (uint32_t k = 0; k < 3 * m.triangleCount; ++k) {
+        lo = glm::min(lo, position(indices[k]));
+        hi = glm::max(hi, position(indices[k]));
+    }
+    glm::vec3 center = 0.5f * (lo + hi);
+    float radius = 0.0f;
+    for (uint32_t k = 0; k < 3 * m.triangleCount; ++k) radius = std::max(radius, glm::length(position(indices[k]) - center));
+
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec3> corners;
+    glm::vec3 axis(0.0f);
+    for (uint32_t t = 0; t < m.triangleCount; ++t) {
+        glm::vec3 a = position(indices[3 * t]), b = position(indices[3 * t + 1]), c = position(indices[3 * t + 2]);
+        glm::vec3 n = glm::cross(b - a, c - a);
+        float length = glm::length(n);
+        if (length <= 0.0f) continue;
+        normals.push_back(n / length);
+        corners.push_back(a);
+        axis += n / length;
+    }
+    m.coneCutoff = 1.0f;
+    m.coneAxis[0] = m.coneAxis[1] = m.coneAxis[2] = 0.0f;
+    m.coneApex[0] = center.x; m.coneApex[1] = center.y; m.coneApex[2] = center.z;
+    float axisLength = glm::length(axis);
+    if (axisLength > 0.0f) {
+        axis /= axisLength;
+        float minDot = 1.0f;
+        for (auto const& n : normals) minDot = std::min(minDot, glm::dot(axis, n));
+        // Au-delà d'environ 84° d'ouverture, le cône ne rejette presque rien
+        if (minDot > 0.1f) {
+            float maxT = 0.0f;
+            for (size_t i = 0; i < normals.size(); ++i)
+                maxT = std::max(maxT, glm::dot(center - corners[i], normals[i]) / glm::dot(axis, normals[i]));
+            glm::vec3 apex = center - axis * maxT;
+            m.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+            m.coneAxis[0] = axis.x; m.coneAxis[1] = axis.y; m.coneAxis[2] = axis.z;
+            m.coneApex[0] = apex.x; m.coneApex[1] = apex.y; m.coneApex[2] = apex.z;
+        }
+    }
+    m.center[0] = center.x; m.center[1] = center.y; m.center[2] = center.z;
+    m.radius = radius;
+}
+
+// Découpe gloutonne : on part du premier triangle libre, puis on ajoute le
+// triangle voisin qui apporte le moins de nouveaux sommets et dont la normale
+// s'écarte le moins de celle du meshlet (cônes plus serrés), jusqu'aux limites.
+// indices (triangles) est réordonné meshlet par meshlet ; les meshlets sont
+// ajoutés à out avec firstIndex relatif à indices.
+inline void buildMeshlets(const float* vertices, size_t vertexCount, std::vector<uint32_t>& indices,
+                          std::vector<Meshlet>& out) {
+    size_t triangleCount = indices.size() / 3;
+    // Adjacence sommet -> triangles (CSR)
+    std::vector<uint32_t> offsets(vertexCount + 1, 0), triangles(indices.size());
+    for (uint32_t v : indices) ++offsets[v + 1];
+    for (size_t v = 0; v < vertexCount; ++v) offsets[v + 1] += offsets[v];
+    {
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t k = 0; k < indices.size(); ++k) triangles[fill[indices[k]]++] = (uint32_t)(k / 3);
+    }
+
+    std::vector<glm::vec3> triangleNormals(triangleCount, glm::vec3(0.0f));
+    for (size_t t = 0; t < triangleCount; ++t) {
+        auto position = [&](int k) { return glm::make_vec3(vertices + (size_t)indices[3 * t + k] * MESH_VERTEX_FLOATS); };
+        glm::vec3 n = glm::cross(position(1) - position(0), position(2) - position(0));
+        float length = glm::length(n);
+        if (length > 0.0f) triangleNormals[t] = n / length;
+    }
+    const float coneWeight = 2.0f; // un sommet nouveau pèse autant qu'un écart de normale de 60°
+
+    std::vector<uint8_t> used(triangleCount, 0);
+    std::vector<uint32_t> vertexMeshlet(vertexCount, 0xffffffffu); // meshlet courant contenant le sommet
+    std::vector<uint32_t> reordered;
+    reordered.reserve(indices.size());
+    std::vector<uint32_t> candidates;
+    size_t seed = 0;
+    uint32_t meshletId = 0;
+
+    while (true) {
+        while (seed < triangleCount && used[seed]) ++seed;
+        if (seed == triangleCount) break;
+        Meshlet m = {};
+        m.firstIndex = (uint32_t)reordered.size();
+        uint32_t meshletVertices = 0;
+        glm::vec3 normalSum(0.0f);
+        candidates.assign(1, (uint32_t)seed);
+
+        auto newVertices = [&](uint32_t t) {
+            uint32_t n = 0;
+            for (int k = 0; k < 3; ++k) n += vertexMeshlet[indices[3 * t + k]] != meshletId;
+            return n;
+        };
+        while (m.triangleCount < MESHLET_MAX_TRIANGLES) {
+            // Meilleur candidat : score le plus bas, puis le plus ancien
+            glm::vec3 axis = glm::length(normalSum) > 0.0f ? glm::normalize(normalSum) : glm::vec3(0.0f);
+            int best = -1;
+            float bestScore = 1e30f;
+            for (size_t c = 0; c < candidates.size(); ++c) {
+                uint32_t t = candidates[c];
+                if (used[t]) continue;
+                uint32_t n = newVertices(t);
+                if (meshletVertices + n > MESHLET_MAX_VERTICES) continue;
+                float score = (float)n + coneWeight * (1.0f - glm::dot(axis, triangleNormals[t]));
+                if (score < bestScore) { bestScore = score; best = (int)c; }
+            }
+            if (best < 0) break;
+            uint32_t t = candidates[best];
+            used[t] = 1;
+            normalSum += triangleNormals[t];
+            for (int k = 0; k < 3; ++k) {
+                uint32_t v = indices[3 * t + k];
+                reordered.push_back(v);
+                if (vertexMeshlet[v] == meshletId) continue;
+                vertexMeshlet[v] = meshletId;
+                ++meshletVertices;
+                for (uint32_t j = offsets[v]; j < offsets[v + 1]; ++j)
+                    if (!used[triangles[j]]) candidates.push_back(triangles[j]);
+            }
+            ++m.triangleCount;
+            // Candidats déjà pris retirés de temps en temps pour garder la liste courte
+            if (candidates.size() > 512)
+                candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [&](uint32_t c) { return used[c] != 0; }),
+                                 candidates.end());
+        }
+        out.push_back(m);
+        ++meshletId;
+    }
+    indices.swap(reordered);
+    for (size_t i = out.size() - meshletId; i < out.size(); ++i)
+        computeMeshletBounds(vertices, indices.data() + out[i].firstIndex, out[i]);
+}
+
+// Un meshlet d'un objet de la scène (entrée de la passe meshlet)
+struct MeshletInstance {
+    uint32_t meshlet;       // dans le SSBO des meshlets
+    uint32_t command;       // commande de la scène (drapeau posé par cull.comp)
+    int32_t baseVertex;
+    uint32_t baseInstance;  // transformation
+};
+
+// Bindings de meshletCull.comp (0 = transformations, 6 = drapeaux de cull.comp)
+const GLuint MESHLET_BINDING = 7;
+const GLuint MESHLET_INSTANCE_BINDING = 8;
+const GLuint MESHLET_VISIBLE_BINDING = 9;
+const GLuint MESHLET_COUNTER_BINDING = 10;
+
+// Compteurs : commandes émises, rejetés par le frustum, rejetés par le cône, triangles émis
+const int MESHLET_COUNTER_COUNT = 4;
+
+struct MeshletCulling {
+    GLuint meshletBuffer = 0;
+    GLuint instanceBuffer = 0;
+    GLuint visibleBuffer = 0;
+    GLuint counterBuffer = 0;
+    GLsizei instanceCount = 0;
+    GLuint locatedProgram = 0; // locations de meshletCull.comp, relues quand le programme change
+    GLint locInstanceCount, locCameraPlanes, locCameraPosition;
+
+    // meshlets : firstIndex absolu dans le pool
+    void init(const std::vector<Meshlet>& meshlets, const std::vector<MeshletInstance>& instances) {
+        instanceCount = (GLsizei)instances.size();
+        glCreateBuffers(1, &meshletBuffer);
+        glNamedBufferStorage(meshletBuffer, std::max<size_t>(1, meshlets.size()) * sizeof(Meshlet),
+                             meshlets.empty() ? nullptr : meshlets.data(), GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &instanceBuffer);
+        glNamedBufferStorage(instanceBuffer, std::max<size_t>(1, instances.size()) * sizeof(MeshletInstance),
+                             instances.empty() ? nullptr : instances.data(), GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &visibleBuffer);
+        glNamedBufferStorage(visibleBuffer, std::max<size_t>(1, instances.size()) * sizeof(DrawElementsIndirectCommand), nullptr, 0);
+        glCreateBuffers(1, &counterBuffer);
+        glNamedBufferStorage(counterBuffer, MESHLET_COUNTER_COUNT * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    }
+
+    // Mêmes tailles qu'à init : maillages déplacés dans le pool (streaming)
+    void update(const std::vector<Meshlet>& meshlets, const std::vector<MeshletInstance>& instances) {
+        if (!meshlets.empty()) glNamedBufferSubData(meshletBuffer, 0, meshlets.size() * sizeof(Meshlet), meshlets.data());
+        if (!instances.empty()) glNamedBufferSubData(instanceBuffer, 0, instances.size() * sizeof(MeshletInstance), instances.data());
+    }
+
+    // Après GpuCulling::cull (drapeaux des objets à détailler) ; SSBO des transformations lié
+    void cull(GLuint program, GLuint expandBuffer, const glm::mat4& cameraViewProj, const glm::vec3& cameraPosition) {
+        glm::vec4 planes[6];
+        extractFrustumPlanes(cameraViewProj, planes);
+        const GLuint zero[MESHLET_COUNTER_COUNT] = {};
+        glNamedBufferSubData(counterBuffer, 0, sizeof(zero), zero);
+        if (!instanceCount) return;
+
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+        if (program != locatedProgram) {
+            locatedProgram = program;
+            locInstanceCount = glGetUniformLocation(program, "instanceCount");
+            locCameraPlanes = glGetUniformLocation(program, "cameraPlanes");
+            locCameraPosition = glGetUniformLocation(program, "cameraPosition");
+        }
+        glUseProgram(program);
+        glUniform1ui(locInstanceCount, (GLuint)instanceCount);
+        glUniform4fv(locCameraPlanes, 6, glm::value_ptr(planes[0]));
+        glUniform3fv(locCameraPosition, 1, glm::value_ptr(cameraPosition));
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_EXPAND_BINDING, expandBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, MESHLET_BINDING, meshletBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, MESHLET_INSTANCE_BINDING, instanceBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, MESHLET_VISIBLE_BINDING, visibleBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, MESHLET_COUNTER_BINDING, counterBuffer);
+        glDispatchCompute((instanceCount + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE, 1, 1);
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+    }
+
+    void draw(GLuint shaderId, GLuint poolVao) const {
+        if (!instanceCount) return;
+        glUseProgram(shaderId);
+        glBindVertexArray(poolVao);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, visibleBuffer);
+        glBindBuffer(GL_PARAMETER_BUFFER, counterBuffer);
+        glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, 0, instanceCount, 0);
+    }
+
+    // Lecture synchrone (statistiques seulement)
+    void readCounters(GLuint counters[MESHLET_COUNTER_COUNT]) const {
+        glGetNamedBufferSubData(counterBuffer, 0, MESHLET_COUNTER_COUNT * sizeof(GLuint), counters);
+    }
+};
@@ -6,10 +6,13 @@
 #include <iostream>
 #include <unordered_map>
 
+#include "meshPool.h" // MeshBounds
+
 struct MaterialProperties {
     GLuint textureID = 0;
     float Kd[3] = {0.8f, 0.8f, 0.8f}; // Couleur diffuse par défaut (gris clair)
     bool hasTexture = false;
+    std::string texturePath; // map_Kd (chemin complet), gardé pour la cuisson des scènes
 };
 
 struct OBJMesh {
@@ -17,28 +20,20 @@ struct OBJMesh {
     unsigned int vao = 0;
     unsigned int vbo = 0;
     size_t count = 0;
+    MeshBounds bounds = {}; // calculées au chargement (culling, LOD, streaming)
 
     // materials loaded from MTL
     std::vector<std::string> materialNames;
     std::vector<GLuint>      materialTextures;
     std::vector<MaterialProperties> materialProps; // Stocke les couleurs
+    std::vector<std::string> materialLibraries;    // mtllib lus, relatifs au dossier de l'OBJ
 };
 
-GLuint loadTexture(const char* path) {
-    int width, height, nrChannels;
-    unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 0); // Don't force 3 channels
-
-    if (!data) {
-        std::cerr << "Texture failed to load at path: " << path << std::endl;
-        return 0;
-    }
-
-    std::cout << "Loading texture: " << path << " (" << width << "x" << height << ", " << nrChannels << " channels)" << std::endl;
-
-    // Création de la texture OpenGL
-    GLuint textureID;
-    glCreateTextures(GL_TEXTURE_2D, 1, &textureID);
+const GLsizei TEXTURE_LEVELS = 4;
 
+// Texture 2D (4 niveaux de mipmaps) à partir de pixels décodés par stb_image ;
+// 0 si le nombre de canaux n'est pas géré
+GLuint createTexture2D(const unsigned char* data, int width, int height, int nrChannels) {
     // Choose format based on channels
     GLenum internalFormat, format;
     if (nrChannels == 4) {
@@ -52,11 +47,13 @@ GLuint loadTexture(const char* path) {
         format = GL_RED;
     } else {
         std::cerr << "Unsupported channel count: " << nrChannels << std::endl;
-        stbi_image_free(data);
         return 0;
     }
 
-    glTextureStorage2D(textureID, 4, internalFormat, width, height);
+    // Création de la texture OpenGL
+    GLuint textureID;
+    glCreateTextures(GL_TEXTURE_2D, 1, &textureID);
+    glTextureStorage2D(textureID, TEXTURE_LEVELS, internalFormat, width, height);
     glTextureSubImage2D(textureID, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, data);
     glGenerateTextureMipmap(textureID);
 
@@ -64,7 +61,27 @@ GLuint loadTexture(const char* path) {
     glTextureParameteri(textureID, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTextureParameteri(textureID, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTextureParameteri(textureID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
+    return textureID;
+}
+
+GLuint loadTexture(const char* path) {
+    int width, height, nrChannels;
+    unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 0); // Don't force 3 channels
+
+    if (!data) {
+        std::cerr << "Texture failed to load at path: " << path << std::endl;
+        return 0;
+    }
+
+    std::cout << "Loading texture: " << path << " (" << width << "x" << height << ", " << nrChannels << " channels)" << std::endl;
+
+    GLuint textureID = createTexture2D(data, width, height, nrChannels);
+    if (!textureID) {
+        stbi_image_free(data);
+        return 0;
+    }
+    GLenum format = nrChannels == 4 ? GL_RGBA : (nrChannels == 3 ? GL_RGB : GL_RED);
+
     // Debug: check first few pixels
     if (width > 10 && height > 10) {
         int sampleX = width / 2;
@@ -99,7 +116,8 @@ inline GLuint loadTextureFromFile(const std::string &p){
     return loadTexture(&s, 1); 
 }
 
-inline std::unordered_map<std::string, MaterialProperties> loadMTL_file(const std::string &mtlPath) {
+// loadTextures = false : lecture seule du MTL (cuisson de scène, pas de contexte GL)
+inline std::unordered_map<std::string, MaterialProperties> loadMTL_file(const std::string &mtlPath, bool loadTextures = true) {
     std::unordered_map<std::string, MaterialProperties> mapMatProps;
     std::ifstream f(mtlPath);
     if(!f.is_open()) {
@@ -140,6 +158,8 @@ inline std::unordered_map<std::string, MaterialProperties> loadMTL_file(const st
             std::string tex; 
             ss >> tex;
             std::string full = dir + tex;
+            currentProps.texturePath = full;
+            if (!loadTextures) continue;
             GLuint tid = loadTextureFromFile(full);
             currentProps.textureID = tid;
             currentProps.hasTexture = (tid != 0);
@@ -231,7 +251,8 @@ inline void emitTriangle(std::vector<float>& vertices,
                p_idx_face[i2], t_idx_face[i2], n_idx_face[i2]);
 }
 
-inline bool loadOBJ(const char* path, OBJMesh& mesh, int materialIDOffset = 0) {
+// createGpuResources = false : triangulation seule (mesh.vertices), sans textures ni VAO
+inline bool loadOBJ(const char* path, OBJMesh& mesh, int materialIDOffset = 0, bool createGpuResources = true) {
     std::ifstream file(path);
     if(!file.is_open()) { std::cerr<<"Cannot open OBJ: "<<path<<"\n"; return false; }
 
@@ -260,7 +281,8 @@ inline bool loadOBJ(const char* path, OBJMesh& mesh, int materialIDOffset = 0) {
         
         if(token == "mtllib") {
             std::string mname; ss >> mname;
-            auto matMap = loadMTL_file(directory + mname);
+            mesh.materialLibraries.push_back(mname);
+            auto matMap = loadMTL_file(directory + mname, createGpuResources);
             
             // Peupler les structures
             for(auto &kv : matMap) {
@@ -373,6 +395,8 @@ inline bool loadOBJ(const char* path, OBJMesh& mesh, int materialIDOffset = 0) {
     }
 
     mesh.count = mesh.vertices.size() / 9;
+    mesh.bounds = computeMeshBounds(mesh.vertices.data(), mesh.count);
+    if (!createGpuResources) return true;
 
     // Création VAO/VBO (identique...)
     glCreateVertexArrays(1, &mesh.vao);
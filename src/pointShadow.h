@@ -0,0 +1,238 @@
+#pragma once
+// ============================================================================
+// Ombres de la lumière ponctuelle (bougie) : cube map de profondeur
+// ============================================================================
+// Les six faces sont les couches d'une cube map de profondeur, remplies en une
+// passe : pointShadow.geom envoie chaque triangle vers les faces (gl_Layer) où
+// son objet est visible. La valeur écrite est la distance à la lumière divisée
+// par la portée ; scene.frag la compare avec un samplerCubeShadow (filtrage 2x2
+// du matériel).
+// Les commandes à portée de la lumière sont classées par face sur le CPU (boîte
+// monde contre la pyramide à 90° de chaque face) : une liste de draws à part,
+// avec les faces de chaque draw dans un SSBO lu par gl_DrawID. Le cube est
+// gardé d'une frame à l'autre : une face n'est redessinée que si un objet qui
+// la touche change (avant ou après), toutes si la lumière bouge. Le
+// scintillement de la bougie ne change que sa couleur : rien à redessiner.
+
+#include <cmath>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <geGL/geGL.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "scene.h"
+#include "shadowCache.h"
+
+const int POINT_SHADOW_FACES = 6;               // invocations de pointShadow.geom, ordre +X -X +Y -Y +Z -Z
+const GLuint POINT_SHADOW_TEXTURE_UNIT = 43;    // samplerCubeShadow pointShadowMap de scene.frag
+const GLuint POINT_SHADOW_FACES_BINDING = 13;   // SSBO des faces de chaque draw (pointShadow.vert)
+const uint32_t POINT_SHADOW_ALL_FACES = (1u << POINT_SHADOW_FACES) - 1u;
+
+// Compteurs par frame
+struct PointShadowStats {
+    size_t faceUpdates = 0;  // faces redessinées
+    size_t skipped = 0;      // frames sans passe (cube à jour)
+    size_t faceDraws = 0;    // draws x faces envoyés par les passes
+};
+
+struct PointShadow {
+    bool enabled = true;
+    GLuint depthTexture = 0; // GL_TEXTURE_CUBE_MAP, GL_DEPTH_COMPONENT32F
+    GLuint fbo = 0;
+    GLuint indirectBuffer = 0;
+    GLuint facesBuffer = 0;
+    int resolution = 512;
+    float nearPlane = 0.05f;
+    float farPlane = 0.0f;       // portée : au-delà, l'atténuation éteint la lumière
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::mat4 faceMatrices[POINT_SHADOW_FACES];
+    bool lightChanged = true;    // faces de toutes les commandes à recalculer
+    uint32_t dirtyFaces = POINT_SHADOW_ALL_FACES;
+    GLsizei firstObjectCommand = 0; // commandes d'objets (après les pièces et les lots statiques)
+    std::vector<ShadowCasterState> casters;
+    std::vector<uint32_t> faces;  // faces touchées par chaque commande, 0 : hors de portée
+    std::vector<DrawElementsIndirectCommand> drawCommands;
+    std::vector<uint32_t> drawFaces;
+    PointShadowStats stats;
+    // Locations relues quand un programme change (rechargement : nouvel id)
+    GLuint locatedProgram = 0, locatedSceneProgram = 0;
+    GLint locFaceMatrices, locFaceMask, locLightPosition, locFarPlane;
+    GLint locPointShadowMap, locPointShadowFar;
+
+    void init(int faceResolution, GLsizei commandCount, GLsizei objectCommand) {
+        resolution = faceResolution;
+        firstObjectCommand = objectCommand;
+        glCreateTextures(GL_TEXTURE_CUBE_MAP, 1, &depthTexture);
+        glTextureStorage2D(depthTexture, 1, GL_DEPTH_COMPONENT32F, resolution, resolution);
+        // Comparaison dans le sampler : texture(samplerCubeShadow) filtre 2x2 texels
+        glTextureParameteri(depthTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(depthTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(depthTexture, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTextureParameteri(depthTexture, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glCreateFramebuffers(1, &fbo);
+        glNamedFramebufferTexture(fbo, GL_DEPTH_ATTACHMENT, depthTexture, 0); // attachement en couches : gl_Layer
+        glNamedFramebufferDrawBuffer(fbo, GL_NONE);
+        glNamedFramebufferReadBuffer(fbo, GL_NONE);
+        glCreateBuffers(1, &indirectBuffer);
+        glNamedBufferStorage(indirectBuffer, std::max<GLsizei>(commandCount, 1) * sizeof(DrawElementsIndirectCommand),
+                             nullptr, GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &facesBuffer);
+        glNamedBufferStorage(facesBuffer, std::max<GLsizei>(commandCount, 1) * sizeof(uint32_t), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        casters.assign(commandCount, ShadowCasterState());
+        faces.assign(commandCount, 0);
+    }
+
+    // Tout le cube est à refaire (programme rechargé)
+    void invalidate() { dirtyFaces = POINT_SHADOW_ALL_FACES; }
+
+    // Géométrie de la commande réécrite sans que son état change (édition en place)
+    void invalidateCommand(size_t i) { dirtyFaces |= faces[i]; }
+
+    // Position et atténuation de la lumière ; la portée est la distance où
+    // l'atténuation tombe sous 1/256 (un niveau de couleur)
+    void setLight(const glm::vec3& lightPosition, const glm::vec3& attenuation) {
+        float c = attenuation.x - 256.0f, l = attenuation.y, q = attenuation.z;
+        float range = q > 0.0f ? (-l + std::sqrt(l * l - 4.0f * q * c)) / (2.0f * q) : l > 0.0f ? -c / l : 15.0f;
+        range = std::min(std::max(range, 1.0f), 15.0f);
+        if (lightPosition == position && range == farPlane) return;
+        position = lightPosition;
+        farPlane = range;
+        // Directions et "up" des faces de cube map (GL_TEXTURE_CUBE_MAP_POSITIVE_X + f)
+        const glm::vec3 dirs[POINT_SHADOW_FACES] = { {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1} };
+        const glm::vec3 ups[POINT_SHADOW_FACES] = { {0, -1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}, {0, -1, 0}, {0, -1, 0} };
+        glm::mat4 proj = glm::perspective(glm::radians(90.0f), 1.0f, nearPlane, farPlane);
+        for (int f = 0; f < POINT_SHADOW_FACES; ++f)
+            faceMatrices[f] = proj * glm::lookAt(position, position + dirs[f], ups[f]);
+        lightChanged = true;
+        dirtyFaces = POINT_SHADOW_ALL_FACES;
+    }
+
+    // À appeler quand la hiérarchie, les boîtes ou les commandes ont changé, ou
+    // après setLight : les faces des commandes changées sont salies et la liste
+    // de draws reconstruite
+    void updateCasters(const std::vector<DrawElementsIndirectCommand>& commands,
+                       const std::vector<MeshRange>& ranges, const TransformHierarchy& transforms) {
+        bool listChanged = lightChanged;
+        for (size_t i = 0; i < casters.size(); ++i) {
+            ShadowCasterState state = shadowCasterState(commands[i], ranges[i], transforms);
+            if (!lightChanged && sameShadowCasterState(state, casters[i])) continue;
+            casters[i] = state;
+            uint32_t touched = casterFaces(state, (GLsizei)i >= firstObjectCommand);
+            dirtyFaces |= faces[i] | touched;
+            if (faces[i] != touched || touched) listChanged = true;
+            faces[i] = touched;
+        }
+        lightChanged = false;
+        if (!listChanged) return;
+        drawCommands.clear();
+        drawFaces.clear();
+        for (size_t i = 0; i < casters.size(); ++i) {
+            if (!faces[i]) continue;
+            DrawElementsIndirectCommand command = commands[i];
+            command.instanceCount = 1; // la visibilité des portails ne concerne que la caméra
+            drawCommands.push_back(command);
+            drawFaces.push_back(faces[i]);
+        }
+        if (drawCommands.empty()) return;
+        glNamedBufferSubData(indirectBuffer, 0, drawCommands.size() * sizeof(DrawElementsIndirectCommand), drawCommands.data());
+        glNamedBufferSubData(facesBuffer, 0, drawFaces.size() * sizeof(uint32_t), drawFaces.data());
+    }
+
+    // Redessine les faces sales (efface puis dessine les draws qui les touchent) ;
+    // rien si le cube est à jour
+    void render(GLuint program, GLuint poolVao) {
+        if (!enabled || farPlane <= 0.0f) return;
+        if (!dirtyFaces) {
+            ++stats.skipped;
+            return;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glViewport(0, 0, resolution, resolution);
+        glEnable(GL_DEPTH_TEST);
+        glDepthMask(GL_TRUE);
+        glDepthFunc(GL_LESS);
+        glDisable(GL_CULL_FACE);
+        const float one = 1.0f;
+        for (int f = 0; f < POINT_SHADOW_FACES; ++f) {
+            if (!(dirtyFaces & (1u << f))) continue;
+            glClearTexSubImage(depthTexture, 0, 0, 0, f, resolution, resolution, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &one);
+            ++stats.faceUpdates;
+        }
+        if (program != locatedProgram) {
+            locatedProgram = program;
+            locFaceMatrices = glGetUniformLocation(program, "faceMatrices");
+            locFaceMask = glGetUniformLocation(program, "faceMask");
+            locLightPosition = glGetUniformLocation(program, "lightPosition");
+            locFarPlane = glGetUniformLocation(program, "farPlane");
+        }
+        glUseProgram(program);
+        glUniformMatrix4fv(locFaceMatrices, POINT_SHADOW_FACES, GL_FALSE, glm::value_ptr(faceMatrices[0]));
+        glUniform1ui(locFaceMask, dirtyFaces);
+        glUniform3fv(locLightPosition, 1, glm::value_ptr(position));
+        glUniform1f(locFarPlane, farPlane);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, POINT_SHADOW_FACES_BINDING, facesBuffer);
+        if (!drawCommands.empty()) drawScene(program, poolVao, indirectBuffer, (GLsizei)drawCommands.size());
+        for (uint32_t f : drawFaces) {
+            uint32_t drawn = f & dirtyFaces;
+            for (; drawn; drawn &= drawn - 1) ++stats.faceDraws;
+        }
+        dirtyFaces = 0;
+    }
+
+    // Uniforms de scene.frag ; pointShadowFar = 0 coupe les ombres de la bougie
+    void applyUniforms(GLuint program) {
+        if (program != locatedSceneProgram) {
+            locatedSceneProgram = program;
+            locPointShadowMap = glGetUniformLocation(program, "pointShadowMap");
+            locPointShadowFar = glGetUniformLocation(program, "pointShadowFar");
+        }
+        glBindTextureUnit(POINT_SHADOW_TEXTURE_UNIT, depthTexture);
+        glProgramUniform1i(program, locPointShadowMap, (GLint)POINT_SHADOW_TEXTURE_UNIT);
+        glProgramUniform1f(program, locPointShadowFar, enabled ? farPlane : 0.0f);
+    }
+
+private:
+    // Faces dont la pyramide (90°, sommet sur la lumière) touche la boîte monde
+    // de la commande ; test conservateur sur la boîte alignée aux axes
+    uint32_t casterFaces(const ShadowCasterState& c, bool object) const {
+        if (c.count == 0) return 0;
+        const float* m = c.world.m;
+        glm::vec3 lo(1e30f), hi(-1e30f);
+        for (int corner = 0; corner < 8; ++corner) {
+            float p[3];
+            for (int k = 0; k < 3; ++k) p[k] = (corner >> k) & 1 ? c.bounds.max[k] : c.bounds.min[k];
+            glm::vec3 world(m[0] * p[0] + m[4] * p[1] + m[8] * p[2] + m[12],
+                            m[1] * p[0] + m[5] * p[1] + m[9] * p[2] + m[13],
+                            m[2] * p[0] + m[6] * p[1] + m[10] * p[2] + m[14]);
+            lo = glm::min(lo, world - position);
+            hi = glm::max(hi, world - position);
+        }
+        // Hors de portée : point de la boîte le plus proche de la lumière
+        glm::vec3 closest = glm::max(glm::max(lo, -hi), glm::vec3(0.0f));
+        if (closest.x * closest.x + closest.y * closest.y + closest.z * closest.z > farPlane * farPlane) return 0;
+        // Objet qui contient la lumière : son support (la bougie), il la masquerait
+        // entièrement. Les pièces et les lots statiques la contiennent aussi, eux restent.
+        if (object && lo.x <= 0.0f && lo.y <= 0.0f && lo.z <= 0.0f && hi.x >= 0.0f && hi.y >= 0.0f && hi.z >= 0.0f) return 0;
+        uint32_t mask = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            int b = (axis + 1) % 3, d = (axis + 2) % 3;
+            for (int side = 0; side < 2; ++side) {
+                float reach = side == 0 ? hi[axis] : -lo[axis]; // profondeur maximale le long de la face
+                if (reach <= 0.0f) continue;
+                if (lo[b] > reach || hi[b] < -reach || lo[d] > reach || hi[d] < -reach) continue;
+                mask |= 1u << (2 * axis + side);
+            }
+        }
+        return mask;
+    }
+};
+
+// --no-point-shadows : bougie sans ombres (comparaison)
+inline bool parsePointShadows(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--no-point-shadows") == 0) return false;
+    return true;
+}
@@ -0,0 +1,181 @@
+#pragma once
+// ============================================================================
+// Édition des pièces en direct : ouvertures et hauteur sous plafond
+// ============================================================================
+// Les pièces sont faites de composants à place fixe dans le pool (building.h).
+// Une édition marque seulement les composants touchés : les murs percés par une
+// ouverture déplacée (des deux côtés) ou toute la pièce dont une dimension
+// change. flush() les régénère et n'envoie que ceux dont le contenu a changé,
+// sommets et indices séparément, par glNamedBufferSubData sur leur sous-plage.
+// Chaque vitre a ses 4 sommets dans la plage des vitres. Les commandes ne
+// changent pas (nombre d'indices fixe) : il reste à renvoyer les boîtes des
+// pièces au culling et à reconstruire les portails.
+// Touches (main.cpp) : Y ouverture suivante de la pièce de la caméra, [ et ] la
+// font glisser le long de son mur, 9 et 0 baissent / montent le plafond.
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+#include "building.h"
+
+// Résultat de RoomEditor::flush
+const uint32_t ROOM_EDIT_GEOMETRY = 1u; // sous-plages du pool réécrites
+const uint32_t ROOM_EDIT_BOUNDS = 2u;   // boîtes de commandRanges changées (culling)
+const uint32_t ROOM_EDIT_PORTALS = 4u;  // ouvertures ou pièces changées (PortalVisibility::init)
+
+struct RoomEditStats {
+    size_t componentsRewritten = 0;
+    size_t componentsUnchanged = 0; // régénérés mais identiques, rien d'envoyé
+    size_t bytesUploaded = 0;
+};
+
+struct RoomEditor {
+    // Copie de la géométrie des pièces telle qu'elle est dans le pool
+    std::vector<std::vector<float>> roomVertices;
+    std::vector<std::vector<uint32_t>> roomIndices;
+    std::vector<int> windowOfOpening;     // quad de vitre de chaque ouverture, -1 si ce n'est pas une fenêtre
+    std::vector<uint8_t> dirtyComponents; // pièce * roomComponents().size() + composant
+    std::vector<uint8_t> dirtyWindows;
+    std::vector<uint8_t> dirtyBounds;     // par pièce
+    bool portalsChanged = false;
+    int selectedOpening = -1;
+    std::vector<uint32_t> editedRooms;    // pièces dont la géométrie a été renvoyée par le dernier flush
+    RoomEditStats stats;
+
+    static size_t componentCount() { return roomComponents().size(); }
+
+    void init(const SceneData& scene, const std::vector<std::vector<float>>& vertices,
+              const std::vector<std::vector<uint32_t>>& indices) {
+        roomVertices = vertices;
+        roomIndices = indices;
+        windowOfOpening.assign(scene.openings.size(), -1);
+        int windows = 0;
+        for (size_t i = 0; i < scene.openings.size(); ++i)
+            if (scene.openings[i].type == SCENE_OPENING_WINDOW) windowOfOpening[i] = windows++;
+        dirtyComponents.assign(scene.rooms.size() * componentCount(), 0);
+        dirtyWindows.assign((size_t)windows, 0);
+        dirtyBounds.assign(scene.rooms.size(), 0);
+    }
+
+    // Ouverture suivante de la pièce room (toutes si room < 0)
+    void selectNext(const SceneData& scene, int room) {
+        size_t n = scene.openings.size();
+        for (size_t k = 1; k <= n; ++k) {
+            size_t i = (size_t)(selectedOpening + (int)k) % n;
+            const SceneOpening& o = scene.openings[i];
+            if (room >= 0 && o.rooms[0] != (uint32_t)room && o.rooms[1] != (uint32_t)room) continue;
+            selectedOpening = (int)i;
+            const char* types[] = { "door", "window", "arch" };
+            const char* walls[] = { "-x", "+x", "-z", "+z" };
+            std::cout << "Editing opening " << i << ": " << types[o.type] << " of "
+                      << scene.str(scene.rooms[o.rooms[0]].name) << " " << walls[o.wall] << " ([ ] to slide it)" << std::endl;
+            return;
+        }
+    }
+
+    // Fait glisser l'ouverture le long de son mur, sans sortir des murs des deux pièces
+    void moveOpening(SceneData& scene, uint32_t opening, float delta) {
+        SceneOpening& o = scene.openings[opening];
+        int axis = o.wall < SCENE_WALL_NEG_Z ? 2 : 0; // murs x : le long de z
+        const float margin = 0.05f;
+        float lo = scene.rooms[o.rooms[0]].min[axis], hi = scene.rooms[o.rooms[0]].max[axis];
+        if (o.rooms[1] != SCENE_OUTSIDE) {
+            lo = std::max(lo, scene.rooms[o.rooms[1]].min[axis]);
+            hi = std::min(hi, scene.rooms[o.rooms[1]].max[axis]);
+        }
+        float center = std::min(std::max(o.center + delta, lo + 0.5f * o.width + margin), hi - 0.5f * o.width - margin);
+        if (center == o.center) return;
+        o.center = center;
+        markWall(o.rooms[0], o.wall);
+        if (o.rooms[1] != SCENE_OUTSIDE) markWall(o.rooms[1], o.wall ^ 1u);
+        if (windowOfOpening[opening] >= 0) dirtyWindows[windowOfOpening[opening]] = 1;
+        portalsChanged = true;
+    }
+
+    // Hauteur sous plafond (le sol ne bouge pas), au moins 20 cm au-dessus des ouvertures
+    void changeRoomHeight(SceneData& scene, uint32_t room, float delta) {
+        SceneRoom& r = scene.rooms[room];
+        float minimum = r.min[1] + 2.2f;
+        for (auto const& o : scene.openings)
+            if (o.rooms[0] == room || o.rooms[1] == room) minimum = std::max(minimum, o.bottom + o.height + 0.2f);
+        float top = std::max(r.max[1] + delta, minimum);
+        if (top == r.max[1]) return;
+        r.max[1] = top;
+        std::fill(dirtyComponents.begin() + room * componentCount(), dirtyComponents.begin() + (room + 1) * componentCount(), 1);
+        dirtyBounds[room] = 1;
+        portalsChanged = true;
+    }
+
+    // Régénère les composants marqués et envoie ce qui a changé ; ROOM_EDIT_*
+    uint32_t flush(const SceneData& scene, SceneGpu& gpu) {
+        uint32_t result = 0;
+        editedRooms.clear();
+        std::vector<float> vertices;
+        std::vector<uint32_t> indices;
+        const std::vector<RoomComponent>& components = roomComponents();
+        for (uint32_t room = 0; room < (uint32_t)scene.rooms.size(); ++room) {
+            const MeshRange& range = gpu.commandRanges[room];
+            for (size_t c = 0; c < components.size(); ++c) {
+                uint8_t& dirty = dirtyComponents[room * components.size() + c];
+                if (!dirty) continue;
+                dirty = 0;
+                const RoomComponent& component = components[c];
+                generateRoomComponent(scene, room, component.kind, component.wall, vertices, indices);
+                padRoomComponent(scene, room, component, vertices, indices);
+                float* cachedVertices = roomVertices[room].data() + (size_t)component.firstVertex * MESH_VERTEX_FLOATS;
+                uint32_t* cachedIndices = roomIndices[room].data() + component.firstIndex;
+                bool changed = false;
+                if (std::memcmp(cachedVertices, vertices.data(), vertices.size() * sizeof(float)) != 0) {
+                    std::memcpy(cachedVertices, vertices.data(), vertices.size() * sizeof(float));
+                    gpu.pool.updateVertices(range.baseVertex + component.firstVertex, component.vertexCount, vertices.data());
+                    stats.bytesUploaded += vertices.size() * sizeof(float);
+                    changed = true;
+                }
+                if (std::memcmp(cachedIndices, indices.data(), indices.size() * sizeof(uint32_t)) != 0) {
+                    std::memcpy(cachedIndices, indices.data(), indices.size() * sizeof(uint32_t));
+                    gpu.pool.updateIndices(range.firstIndex + component.firstIndex, component.indexCount, indices.data());
+                    stats.bytesUploaded += indices.size() * sizeof(uint32_t);
+                    changed = true;
+                }
+                ++(changed ? stats.componentsRewritten : stats.componentsUnchanged);
+                if (!changed) continue;
+                result |= ROOM_EDIT_GEOMETRY;
+                if (editedRooms.empty() || editedRooms.back() != room) editedRooms.push_back(room);
+            }
+            if (dirtyBounds[room]) {
+                dirtyBounds[room] = 0;
+                gpu.commandRanges[room].bounds = computeMeshBounds(roomVertices[room].data(),
+                                                                   roomVertices[room].size() / MESH_VERTEX_FLOATS);
+                result |= ROOM_EDIT_BOUNDS;
+            }
+        }
+        const MeshRange& windows = gpu.commandRanges[gpu.windowCommand];
+        for (size_t i = 0; i < scene.openings.size(); ++i) {
+            int w = windowOfOpening[i];
+            if (w < 0 || !dirtyWindows[w]) continue;
+            dirtyWindows[w] = 0;
+            vertices.clear();
+            indices.clear();
+            appendWindowQuad(scene, scene.openings[i], vertices, indices);
+            gpu.pool.updateVertices(windows.baseVertex + 4 * w, 4, vertices.data());
+            stats.bytesUploaded += vertices.size() * sizeof(float);
+            ++stats.componentsRewritten;
+            result |= ROOM_EDIT_GEOMETRY;
+        }
+        if (portalsChanged) {
+            portalsChanged = false;
+            result |= ROOM_EDIT_PORTALS;
+        }
+        return result;
+    }
+
+private:
+    void markWall(uint32_t room, uint32_t wall) {
+        for (uint32_t kind = ROOM_WALL; kind <= ROOM_DOOR; ++kind)
+            dirtyComponents[room * componentCount() + roomComponentIndex(kind, wall)] = 1;
+    }
+};
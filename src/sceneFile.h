@@ -0,0 +1,1039 @@
+#pragma once
+// ============================================================================
+// Description de scène : maillages, objets, matériaux, lumières, émetteurs
+// ============================================================================
+// Forme texte (scenes/*.scene) pour l'édition, forme binaire cuite (<scène>.bin)
+// chargée en une seule lecture. Le binaire est régénéré quand le texte est plus
+// récent : les OBJ/MTL sont lus, triangulés, indexés, découpés en meshlets
+// (meshlets.h), simplifiés (niveaux de détail, meshSimplify.h) et leurs indices
+// du flux de profondeur calculés (indexPositions, meshPool.h) à la cuisson, au démarrage
+// il ne reste que la lecture du .bin, l'envoi des sommets et le chargement des images.
+//
+// Syntaxe (une entrée par ligne, # = commentaire, chemins relatifs à la racine) :
+//   material <slot> <image>                 matériau de la pièce (slots < 9)
+//   mesh     <nom> <fichier.obj>            matériaux lus dans le MTL (slots 9+)
+//   object   <nom> <mesh> [parent <nom>] [occluder] [static] pos x y z [rot rx ry rz] [scale s | scale sx sy sz] [tint r g b]
+//   node     <nom> [parent <nom>] pos x y z [rot ...] [scale ...]   groupe sans maillage
+//   instances <nom> <mesh> [parent <nom>] [occluder] [static] grid nx ny nz step dx dy dz pos x y z [rot ...] [scale ...] [tint r g b]
+//   light    <nom> point pos x y z color r g b atten constant linear quadratic
+//   light    <nom> sun   pos x y z color r g b
+//   emitter  <nom> smoke pos x y z
+//   emitter  <nom> flame pos x y z size s
+//   room     <nom> min x y z max x y z      pièce (boîte intérieure, monde), voir building.h
+//   opening  <door|window|arch> <pièce> <-x|+x|-z|+z> center c bottom y size w h [to <pièce>] [closed]
+// Un même mesh peut être utilisé par plusieurs objets : il n'est chargé qu'une fois.
+// Les transformations d'un objet avec parent sont relatives à celui-ci ; le parent
+// doit être déclaré avant (ordre topologique attendu par transformHierarchy.h).
+// "occluder" : gros objet dessiné dans la pré-passe de profondeur du Hi-Z (hiZ.h).
+// "static" : objet immobile, cuit dans l'espace monde et fusionné avec les autres
+// objets statiques de sa pièce en un seul draw (staticBatch.h).
+// "tint" : surcharge de matériau par instance (multiplie la couleur des matériaux).
+// "instances" : un nœud de groupe <nom> (pos, rot) et nx*ny*nz objets du même
+// mesh espacés de step mètres dans le groupe (scale, tint : par instance). Des
+// objets consécutifs du même mesh sont dessinés en un seul draw instancié.
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <filesystem>
+#include <unordered_map>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "scene.h" // DRAW_ROOM, meshPool.h ; loadOBJ vient de objLoader.h (inclus par main.cpp)
+#include "transformHierarchy.h"
+#include "meshSimplify.h"
+#include "meshlets.h"
+#include "staticBatch.h"
+
+const uint32_t SCENE_NO_STRING = 0xffffffffu;
+const uint32_t SCENE_NO_MESH = 0xffffffffu;
+const int32_t SCENE_NO_PARENT = -1;
+const uint32_t SCENE_OBJECT_OCCLUDER = 1u; // SceneObject::flags
+const uint32_t SCENE_OBJECT_STATIC = 2u;
+const int SCENE_MATERIAL_SLOTS = 32;     // uniform sampler2D materialTex[32] (scene.frag)
+const int SCENE_MESH_MATERIAL_BASE = 9;  // slots 0-8 : pièce (+ shadow map sur l'unité 1)
+const GLuint SCENE_TINT_BINDING = 11;    // vec4 par nœud (scene.vert), à côté des transformations
+
+enum SceneLightType : uint32_t { SCENE_LIGHT_POINT = 0, SCENE_LIGHT_SUN = 1 };
+enum SceneEmitterType : uint32_t { SCENE_EMITTER_SMOKE = 0, SCENE_EMITTER_FLAME = 1 };
+enum SceneOpeningType : uint32_t { SCENE_OPENING_DOOR = 0, SCENE_OPENING_WINDOW = 1, SCENE_OPENING_ARCH = 2 };
+enum SceneWall : uint32_t { SCENE_WALL_NEG_X = 0, SCENE_WALL_POS_X = 1, SCENE_WALL_NEG_Z = 2, SCENE_WALL_POS_Z = 3 };
+const uint32_t SCENE_OUTSIDE = 0xffffffffu;      // SceneOpening::rooms[1] d'une ouverture sur l'extérieur
+const uint32_t SCENE_OPENING_CLOSED = 1u;        // SceneOpening::flags
+
+// Enregistrements écrits tels quels dans le binaire (noms = offsets dans strings)
+struct SceneMaterial {
+    uint32_t slot;
+    uint32_t texturePath;
+    float kd[3];
+    uint32_t hasTexture;
+};
+
+struct SceneMesh {
+    uint32_t name;
+    uint32_t firstVertex; // dans SceneData::vertices (9 floats par sommet, comme OBJMesh)
+    uint32_t vertexCount;
+    uint32_t firstIndex;  // dans SceneData::indices, relatifs à firstVertex
+    uint32_t indexCount;  // tous les niveaux de détail
+    uint32_t lodCount;
+    MeshBounds bounds;    // calculées par loadOBJ
+    MeshLod lods[MESH_MAX_LODS]; // firstIndex relatif à SceneMesh::firstIndex
+    uint32_t firstMeshlet;       // dans SceneData::meshlets (niveau 0 des maillages denses)
+    uint32_t meshletCount;
+};
+
+struct SceneObject {
+    uint32_t name;
+    uint32_t mesh;    // SCENE_NO_MESH pour un nœud de groupe
+    int32_t parent;   // indice d'objet (< indice courant) ou SCENE_NO_PARENT
+    uint32_t flags;   // SCENE_OBJECT_OCCLUDER
+    float local[16];  // relative au parent
+    float tint[4];    // surcharge de matériau : rgb multiplie la couleur (1 par défaut)
+};
+
+struct SceneLight {
+    uint32_t name;
+    uint32_t type;
+    float position[3];
+    float color[3];
+    float attenuation[3]; // constant, linear, quadratic (lumière ponctuelle)
+};
+
+struct SceneEmitter {
+    uint32_t name;
+    uint32_t type;
+    float position[3];
+    float size;
+};
+
+struct SceneRoom {
+    uint32_t name;
+    float min[3], max[3]; // boîte intérieure (monde)
+};
+
+// Pièce qui contient p (bornes élargies d'un millimètre), -1 sinon
+inline int roomContaining(const std::vector<SceneRoom>& rooms, const glm::vec3& p) {
+    const float margin = 1e-3f;
+    for (size_t r = 0; r < rooms.size(); ++r) {
+        const SceneRoom& room = rooms[r];
+        if (p.x >= room.min[0] - margin && p.x <= room.max[0] + margin && p.y >= room.min[1] - margin
+            && p.y <= room.max[1] + margin && p.z >= room.min[2] - margin && p.z <= room.max[2] + margin)
+            return (int)r;
+    }
+    return -1;
+}
+
+struct SceneOpening {
+    uint32_t type;      // SceneOpeningType
+    uint32_t rooms[2];  // rooms[1] : pièce voisine ou SCENE_OUTSIDE
+    uint32_t wall;      // mur de rooms[0] (SceneWall)
+    uint32_t flags;     // SCENE_OPENING_CLOSED
+    float center;       // coordonnée monde le long du mur (z pour les murs x, x pour les murs z)
+    float bottom;       // hauteur monde du bas de l'ouverture
+    float width, height;
+};
+
+// Fichier lu pour construire la scène (texte, OBJ, MTL) : le .bin n'est frais
+// que si tous sont inchangés (taille et date de modification)
+struct SceneSource {
+    uint32_t path;     // chaîne, relative à la racine du projet (resolveScenePath)
+    uint32_t padding;
+    uint64_t size;
+    int64_t modified;  // file_time_type::time_since_epoch().count()
+};
+
+struct SceneData {
+    std::vector<SceneMaterial> materials;
+    std::vector<SceneMesh> meshes;
+    std::vector<SceneObject> objects;
+    std::vector<SceneLight> lights;
+    std::vector<SceneEmitter> emitters;
+    std::vector<SceneRoom> rooms;
+    std::vector<SceneOpening> openings;
+    std::vector<char> strings;
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<uint32_t> depthIndices; // parallèle à indices : sommets partagés par position (passes de profondeur)
+    std::vector<Meshlet> meshlets; // firstIndex relatif au maillage
+    std::vector<SceneSource> sources;
+
+    const char* str(uint32_t offset) const {
+        return offset == SCENE_NO_STRING ? "" : strings.data() + offset;
+    }
+
+    uint32_t addString(const std::string& s) {
+        uint32_t offset = (uint32_t)strings.size();
+        strings.insert(strings.end(), s.begin(), s.end());
+        strings.push_back('\0');
+        return offset;
+    }
+
+    int findObject(const char* name) const {
+        for (size_t i = 0; i < objects.size(); ++i)
+            if (std::strcmp(str(objects[i].name), name) == 0) return (int)i;
+        return -1;
+    }
+
+    // Pièce qui contient p, -1 sinon
+    int roomAt(const glm::vec3& p) const { return roomContaining(rooms, p); }
+
+    int findRoom(const char* name) const {
+        for (size_t i = 0; i < rooms.size(); ++i)
+            if (std::strcmp(str(rooms[i].name), name) == 0) return (int)i;
+        return -1;
+    }
+
+    const SceneLight* findLight(uint32_t type) const {
+        for (auto const& l : lights)
+            if (l.type == type) return &l;
+        return nullptr;
+    }
+};
+
+// Les chemins de la scène sont relatifs à la racine du projet ; l'exécutable
+// est lancé depuis build/ ou depuis la racine (même règle que les textures)
+inline std::string resolveScenePath(const std::string& path) {
+    const char* prefixes[] = { "", "../", "./", "../../" };
+    for (const char* prefix : prefixes) {
+        std::string candidate = prefix + path;
+        if (std::ifstream(candidate).good()) return candidate;
+    }
+    return path;
+}
+
+// Taille et date de <path> (relatif à la racine) ; false s'il n'existe pas
+inline bool statSceneSource(const std::string& path, uint64_t& size, int64_t& modified) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    std::string resolved = resolveScenePath(path);
+    size = (uint64_t)fs::file_size(resolved, ec);
+    if (ec) return false;
+    modified = (int64_t)fs::last_write_time(resolved, ec).time_since_epoch().count();
+    return !ec;
+}
+
+inline void addSceneSource(SceneData& scene, const std::string& path) {
+    SceneSource s = {};
+    s.path = scene.addString(path);
+    statSceneSource(path, s.size, s.modified);
+    scene.sources.push_back(s);
+}
+
+// --scene=<fichier> (défaut : scenes/study.scene)
+inline std::string parseScenePath(int argc, char* argv[]) {
+    const char* prefix = "--scene=";
+    for (int i = 1; i < argc; ++i)
+        if (std::strncmp(argv[i], prefix, std::strlen(prefix)) == 0) return argv[i] + std::strlen(prefix);
+    return "scenes/study.scene";
+}
+
+// ----------------------------------------------------------------------------
+// Instances
+// ----------------------------------------------------------------------------
+
+// Ajoute un nœud de groupe et une instance de mesh par transformation (relative
+// au groupe). Les instances sont consécutives : createSceneGpu en fait un seul
+// draw instancié, et leurs nœuds sont contigus dans le SSBO des transformations.
+// Renvoie l'indice d'objet du groupe.
+inline int addSceneInstances(SceneData& scene, const std::string& name, uint32_t mesh, int32_t parent, uint32_t flags,
+                             const glm::mat4& groupLocal, const std::vector<glm::mat4>& instanceLocals,
+                             const std::vector<glm::vec3>& tints) {
+    SceneObject group = {};
+    group.name = scene.addString(name);
+    group.mesh = SCENE_NO_MESH;
+    group.parent = parent;
+    std::memcpy(group.local, glm::value_ptr(groupLocal), sizeof(group.local));
+    group.tint[0] = group.tint[1] = group.tint[2] = group.tint[3] = 1.0f;
+    int groupIndex = (int)scene.objects.size();
+    scene.objects.push_back(group);
+    for (size_t i = 0; i < instanceLocals.size(); ++i) {
+        SceneObject o = {};
+        o.name = SCENE_NO_STRING;
+        o.mesh = mesh;
+        o.parent = groupIndex;
+        o.flags = flags;
+        std::memcpy(o.local, glm::value_ptr(instanceLocals[i]), sizeof(o.local));
+        glm::vec3 tint = i < tints.size() ? tints[i] : glm::vec3(1.0f);
+        o.tint[0] = tint.x; o.tint[1] = tint.y; o.tint[2] = tint.z; o.tint[3] = 1.0f;
+        scene.objects.push_back(o);
+    }
+    return groupIndex;
+}
+
+// --stress-instances[=N] (défaut 10000, 0 sans l'option)
+inline size_t parseStressInstances(int argc, char* argv[]) {
+    const char* flag = "--stress-instances";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], flag) == 0) return 10000;
+        if (std::strncmp(argv[i], flag, std::strlen(flag)) == 0 && argv[i][std::strlen(flag)] == '=')
+            return (size_t)std::strtoul(argv[i] + std::strlen(flag) + 1, nullptr, 10);
+    }
+    return 0;
+}
+
+// Test de charge : count bougies teintées au hasard, en couches dans la pièce.
+// Ajoutées après le chargement, elles ne vont pas dans le binaire cuit.
+inline void addStressInstances(SceneData& scene, size_t count) {
+    if (scene.meshes.empty() || count == 0) return;
+    uint32_t mesh = 0;
+    for (size_t m = 0; m < scene.meshes.size(); ++m)
+        if (std::strcmp(scene.str(scene.meshes[m].name), "candle") == 0) mesh = (uint32_t)m;
+    const int layers = 8;
+    int side = (int)std::ceil(std::sqrt((double)count / layers));
+    float step = 7.0f / side;
+    float scale = 0.4f * step / std::max(scene.meshes[mesh].bounds.radius, 1e-6f);
+    std::vector<glm::mat4> locals;
+    std::vector<glm::vec3> tints;
+    uint32_t seed = 12345u;
+    auto random = [&]() { seed = seed * 1664525u + 1013904223u; return (seed >> 8) / 16777216.0f; };
+    for (size_t i = 0; i < count; ++i) {
+        int x = (int)(i % side), z = (int)((i / side) % side), y = (int)(i / ((size_t)side * side));
+        glm::mat4 local = glm::translate(glm::mat4(1.0f), glm::vec3(-3.5f + (x + 0.5f) * step, 0.3f + 0.3f * y, -3.5f + (z + 0.5f) * step));
+        local = glm::rotate(local, random() * 6.2831853f, glm::vec3(0, 1, 0));
+        locals.push_back(glm::scale(local, glm::vec3(scale)));
+        tints.push_back(glm::vec3(0.4f + 0.6f * random(), 0.4f + 0.6f * random(), 0.4f + 0.6f * random()));
+    }
+    addSceneInstances(scene, "stress", mesh, SCENE_NO_PARENT, 0, glm::mat4(1.0f), locals, tints);
+    std::cout << "Stress test: " << count << " instances of " << scene.str(scene.meshes[mesh].name) << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+// Forme texte
+// ----------------------------------------------------------------------------
+
+inline bool readFloats(std::istringstream& ss, float* out, int count) {
+    for (int i = 0; i < count; ++i)
+        if (!(ss >> out[i])) return false;
+    return true;
+}
+
+// Lit le fichier texte et triangule les OBJ (sans contexte GL)
+inline bool parseSceneText(const std::string& path, SceneData& scene) {
+    std::ifstream file(path);
+    if (!file.is_open()) { std::cerr << "Cannot open scene: " << path << std::endl; return false; }
+
+    scene = SceneData();
+    std::unordered_map<std::string, uint32_t> meshByName;
+    int nextSlot = SCENE_MESH_MATERIAL_BASE;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.resize(comment);
+        std::istringstream ss(line);
+        std::string kind, name;
+        if (!(ss >> kind)) continue;
+        auto fail = [&](const char* what) {
+            std::cerr << path << ":" << lineNumber << ": " << what << std::endl;
+            return false;
+        };
+
+        if (kind == "material") {
+            SceneMaterial m = {};
+            std::string image;
+            if (!(ss >> m.slot >> image) || m.slot >= SCENE_MESH_MATERIAL_BASE) return fail("expected: material <slot 0-8> <image>");
+            m.texturePath = scene.addString(image);
+            m.kd[0] = m.kd[1] = m.kd[2] = 0.8f;
+            m.hasTexture = 1;
+            scene.materials.push_back(m);
+        }
+        else if (kind == "mesh") {
+            std::string objPath;
+            if (!(ss >> name >> objPath)) return fail("expected: mesh <name> <file.obj>");
+            OBJMesh obj;
+            std::string resolved = resolveScenePath(objPath);
+            if (!loadOBJ(resolved.c_str(), obj, nextSlot, false)) return fail("cannot load mesh");
+            addSceneSource(scene, objPath);
+            size_t slash = objPath.find_last_of("/\\");
+            for (auto const& library : obj.materialLibraries)
+                addSceneSource(scene, (slash == std::string::npos ? "" : objPath.substr(0, slash + 1)) + library);
+            for (auto const& props : obj.materialProps) {
+                SceneMaterial m = {};
+                m.slot = (uint32_t)nextSlot++;
+                m.texturePath = props.texturePath.empty() ? SCENE_NO_STRING : scene.addString(props.texturePath);
+                std::memcpy(m.kd, props.Kd, sizeof(m.kd));
+                m.hasTexture = props.texturePath.empty() ? 0 : 1;
+                scene.materials.push_back(m);
+            }
+            if (nextSlot > SCENE_MATERIAL_SLOTS)
+                std::cerr << path << ":" << lineNumber << ": more than " << SCENE_MATERIAL_SLOTS
+                          << " material slots, extra materials will render magenta" << std::endl;
+            std::vector<float> meshVertices;
+            std::vector<uint32_t> meshIndices;
+            indexVertexSoup(obj.vertices.data(), (size_t)obj.count, meshVertices, meshIndices);
+            SceneMesh mesh = {};
+            mesh.name = scene.addString(name);
+            mesh.firstVertex = (uint32_t)(scene.vertices.size() / MESH_VERTEX_FLOATS);
+            mesh.vertexCount = (uint32_t)(meshVertices.size() / MESH_VERTEX_FLOATS);
+            mesh.firstIndex = (uint32_t)scene.indices.size();
+            mesh.bounds = obj.bounds;
+            mesh.firstMeshlet = (uint32_t)scene.meshlets.size();
+            if (meshIndices.size() / 3 >= MESHLET_MIN_MESH_TRIANGLES)
+                buildMeshlets(meshVertices.data(), mesh.vertexCount, meshIndices, scene.meshlets);
+            mesh.meshletCount = (uint32_t)scene.meshlets.size() - mesh.firstMeshlet;
+            mesh.lodCount = buildMeshLods(meshVertices.data(), mesh.vertexCount, meshIndices, obj.bounds.radius, mesh.lods);
+            mesh.indexCount = (uint32_t)meshIndices.size();
+            scene.vertices.insert(scene.vertices.end(), meshVertices.begin(), meshVertices.end());
+            scene.indices.insert(scene.indices.end(), meshIndices.begin(), meshIndices.end());
+            indexPositions(meshVertices.data(), mesh.vertexCount, meshIndices.data(), meshIndices.size(), scene.depthIndices);
+            meshByName[name] = (uint32_t)scene.meshes.size();
+            scene.meshes.push_back(mesh);
+        }
+        else if (kind == "object" || kind == "node" || kind == "instances") {
+            std::string meshName, key;
+            uint32_t mesh = SCENE_NO_MESH;
+            if (kind != "node") {
+                if (!(ss >> name >> meshName)) return fail("expected: object|instances <name> <mesh> ...");
+                auto it = meshByName.find(meshName);
+                if (it == meshByName.end()) return fail("unknown mesh (declare it before the objects using it)");
+                mesh = it->second;
+            }
+            else if (!(ss >> name)) return fail("expected: node <name> pos x y z");
+            int32_t parent = SCENE_NO_PARENT;
+            uint32_t flags = 0;
+            float pos[3] = {0, 0, 0}, rot[3] = {0, 0, 0}, scale[3] = {1, 1, 1}, tint[3] = {1, 1, 1};
+            float grid[3] = {1, 1, 1}, step[3] = {0, 0, 0};
+            while (ss >> key) {
+                if (key == "parent") {
+                    std::string parentName;
+                    if (!(ss >> parentName) || (parent = scene.findObject(parentName.c_str())) < 0)
+                        return fail("unknown parent (declare it before its children)");
+                }
+                else if (key == "occluder") flags |= SCENE_OBJECT_OCCLUDER;
+                else if (key == "static") flags |= SCENE_OBJECT_STATIC;
+                else if (key == "pos") { if (!readFloats(ss, pos, 3)) return fail("pos expects 3 values"); }
+                else if (key == "rot") { if (!readFloats(ss, rot, 3)) return fail("rot expects 3 values"); }
+                else if (key == "tint") { if (!readFloats(ss, tint, 3)) return fail("tint expects 3 values"); }
+                else if (key == "grid" && kind == "instances") {
+                    if (!readFloats(ss, grid, 3) || grid[0] < 1 || grid[1] < 1 || grid[2] < 1) return fail("grid expects 3 counts >= 1");
+                }
+                else if (key == "step" && kind == "instances") { if (!readFloats(ss, step, 3)) return fail("step expects 3 values"); }
+                else if (key == "scale") {
+                    if (!readFloats(ss, scale, 1)) return fail("scale expects 1 or 3 values");
+                    scale[1] = scale[2] = scale[0];
+                    float yz[2];
+                    std::streampos before = ss.tellg();
+                    if (readFloats(ss, yz, 2)) { scale[1] = yz[0]; scale[2] = yz[1]; }
+                    else { ss.clear(); ss.seekg(before); }
+                }
+                else return fail("unknown object attribute");
+            }
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(pos[0], pos[1], pos[2]));
+            model = glm::rotate(model, glm::radians(rot[1]), glm::vec3(0, 1, 0));
+            model = glm::rotate(model, glm::radians(rot[0]), glm::vec3(1, 0, 0));
+            model = glm::rotate(model, glm::radians(rot[2]), glm::vec3(0, 0, 1));
+            if (kind == "instances") {
+                std::vector<glm::mat4> locals;
+                for (int z = 0; z < (int)grid[2]; ++z)
+                    for (int y = 0; y < (int)grid[1]; ++y)
+                        for (int x = 0; x < (int)grid[0]; ++x) {
+                            glm::mat4 local = glm::translate(glm::mat4(1.0f), glm::vec3(x * step[0], y * step[1], z * step[2]));
+                            locals.push_back(glm::scale(local, glm::vec3(scale[0], scale[1], scale[2])));
+                        }
+                addSceneInstances(scene, name, mesh, parent, flags, model, locals,
+                                  std::vector<glm::vec3>(locals.size(), glm::vec3(tint[0], tint[1], tint[2])));
+                continue;
+            }
+            model = glm::scale(model, glm::vec3(scale[0], scale[1], scale[2]));
+            SceneObject o = {};
+            o.name = scene.addString(name);
+            o.mesh = mesh;
+            o.parent = parent;
+            o.flags = flags;
+            std::memcpy(o.local, glm::value_ptr(model), sizeof(o.local));
+            o.tint[0] = tint[0]; o.tint[1] = tint[1]; o.tint[2] = tint[2]; o.tint[3] = 1.0f;
+            scene.objects.push_back(o);
+        }
+        else if (kind == "light") {
+            std::string type, key;
+            if (!(ss >> name >> type)) return fail("expected: light <name> point|sun ...");
+            SceneLight l = {};
+            l.name = scene.addString(name);
+            if (type == "point") l.type = SCENE_LIGHT_POINT;
+            else if (type == "sun") l.type = SCENE_LIGHT_SUN;
+            else return fail("unknown light type");
+            l.color[0] = l.color[1] = l.color[2] = 1.0f;
+            l.attenuation[0] = 1.0f;
+            while (ss >> key) {
+                float* dst = key == "pos" ? l.position : key == "color" ? l.color : key == "atten" ? l.attenuation : nullptr;
+                if (!dst || !readFloats(ss, dst, 3)) return fail("light attributes: pos|color|atten x y z");
+            }
+            scene.lights.push_back(l);
+        }
+        else if (kind == "emitter") {
+            std::string type, key;
+            if (!(ss >> name >> type)) return fail("expected: emitter <name> smoke|flame ...");
+            SceneEmitter e = {};
+            e.name = scene.addString(name);
+            if (type == "smoke") e.type = SCENE_EMITTER_SMOKE;
+            else if (type == "flame") e.type = SCENE_EMITTER_FLAME;
+            else return fail("unknown emitter type");
+            e.size = 1.0f;
+            while (ss >> key) {
+                if (key == "pos") { if (!readFloats(ss, e.position, 3)) return fail("pos expects 3 values"); }
+                else if (key == "size") { if (!readFloats(ss, &e.size, 1)) return fail("size expects 1 value"); }
+                else return fail("unknown emitter attribute");
+            }
+            scene.emitters.push_back(e);
+        }
+        else if (kind == "room") {
+            std::string key;
+            SceneRoom r = {};
+            if (!(ss >> name)) return fail("expected: room <name> min x y z max x y z");
+            if (scene.findRoom(name.c_str()) >= 0) return fail("duplicate room");
+            r.name = scene.addString(name);
+            bool hasMin = false, hasMax = false;
+            while (ss >> key) {
+                if (key == "min") { if (!(hasMin = readFloats(ss, r.min, 3))) return fail("min expects 3 values"); }
+                else if (key == "max") { if (!(hasMax = readFloats(ss, r.max, 3))) return fail("max expects 3 values"); }
+                else return fail("unknown room attribute");
+            }
+            if (!hasMin || !hasMax || r.min[0] >= r.max[0] || r.min[1] >= r.max[1] || r.min[2] >= r.max[2])
+                return fail("room needs min < max");
+            scene.rooms.push_back(r);
+        }
+        else if (kind == "opening") {
+            std::string type, roomName, wall, key;
+            if (!(ss >> type >> roomName >> wall)) return fail("expected: opening <door|window|arch> <room> <-x|+x|-z|+z> ...");
+            SceneOpening o = {};
+            if (type == "door") o.type = SCENE_OPENING_DOOR;
+            else if (type == "window") o.type = SCENE_OPENING_WINDOW;
+            else if (type == "arch") o.type = SCENE_OPENING_ARCH;
+            else return fail("unknown opening type");
+            int room = scene.findRoom(roomName.c_str());
+            if (room < 0) return fail("unknown room (declare it before its openings)");
+            const char* walls[] = { "-x", "+x", "-z", "+z" };
+            o.wall = (uint32_t)(std::find_if(walls, walls + 4, [&](const char* w) { return wall == w; }) - walls);
+            if (o.wall > SCENE_WALL_POS_Z) return fail("wall must be -x, +x, -z or +z");
+            o.rooms[0] = (uint32_t)room;
+            o.rooms[1] = SCENE_OUTSIDE;
+            float size[2] = { 0, 0 };
+            while (ss >> key) {
+                if (key == "center") { if (!readFloats(ss, &o.center, 1)) return fail("center expects 1 value"); }
+                else if (key == "bottom") { if (!readFloats(ss, &o.bottom, 1)) return fail("bottom expects 1 value"); }
+                else if (key == "size") { if (!readFloats(ss, size, 2)) return fail("size expects width height"); }
+                else if (key == "closed") o.flags |= SCENE_OPENING_CLOSED;
+                else if (key == "to") {
+                    std::string other;
+                    int to = (ss >> other) ? scene.findRoom(other.c_str()) : -1;
+                    if (to < 0 || to == room) return fail("unknown room after 'to'");
+                    o.rooms[1] = (uint32_t)to;
+                }
+                else return fail("unknown opening attribute");
+            }
+            o.width = size[0];
+            o.height = size[1];
+            if (o.width <= 0 || o.height <= 0) return fail("opening needs a size");
+            if (o.rooms[1] != SCENE_OUTSIDE) {
+                // Le mur opposé de la pièce voisine doit coïncider
+                const SceneRoom& a = scene.rooms[o.rooms[0]];
+                const SceneRoom& b = scene.rooms[o.rooms[1]];
+                int axis = o.wall < SCENE_WALL_NEG_Z ? 0 : 2;
+                bool positive = o.wall & 1u;
+                float wallA = positive ? a.max[axis] : a.min[axis];
+                float wallB = positive ? b.min[axis] : b.max[axis];
+                if (std::fabs(wallA - wallB) > 1e-3f) return fail("rooms do not share this wall");
+            }
+            scene.openings.push_back(o);
+        }
+        else return fail("unknown entry");
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Forme binaire : en-tête + tableaux bruts, dans l'ordre de SceneBakedHeader
+// ----------------------------------------------------------------------------
+
+const uint32_t SCENE_BAKED_VERSION = 11;
+
+struct SceneBakedHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t materialCount, meshCount, objectCount, lightCount, emitterCount;
+    uint32_t stringBytes;
+    uint32_t indexCount;
+    uint32_t meshletCount;
+    uint32_t roomCount, openingCount;
+    uint32_t sourceCount;
+    uint64_t vertexFloats;
+};
+
+inline bool writeBakedScene(const std::string& path, const SceneData& scene) {
+    SceneBakedHeader h = {};
+    std::memcpy(h.magic, "SCNB", 4);
+    h.version = SCENE_BAKED_VERSION;
+    h.materialCount = (uint32_t)scene.materials.size();
+    h.meshCount = (uint32_t)scene.meshes.size();
+    h.objectCount = (uint32_t)scene.objects.size();
+    h.lightCount = (uint32_t)scene.lights.size();
+    h.emitterCount = (uint32_t)scene.emitters.size();
+    h.stringBytes = (uint32_t)scene.strings.size();
+    h.indexCount = (uint32_t)scene.indices.size();
+    h.meshletCount = (uint32_t)scene.meshlets.size();
+    h.roomCount = (uint32_t)scene.rooms.size();
+    h.openingCount = (uint32_t)scene.openings.size();
+    h.sourceCount = (uint32_t)scene.sources.size();
+    h.vertexFloats = scene.vertices.size();
+
+    std::ofstream f(path, std::ios::binary);
+    if (!f.is_open()) return false;
+    auto write = [&](const void* data, size_t bytes) { f.write((const char*)data, (std::streamsize)bytes); };
+    write(&h, sizeof(h));
+    write(scene.materials.data(), scene.materials.size() * sizeof(SceneMaterial));
+    write(scene.meshes.data(), scene.meshes.size() * sizeof(SceneMesh));
+    write(scene.objects.data(), scene.objects.size() * sizeof(SceneObject));
+    write(scene.lights.data(), scene.lights.size() * sizeof(SceneLight));
+    write(scene.emitters.data(), scene.emitters.size() * sizeof(SceneEmitter));
+    write(scene.rooms.data(), scene.rooms.size() * sizeof(SceneRoom));
+    write(scene.openings.data(), scene.openings.size() * sizeof(SceneOpening));
+    write(scene.sources.data(), scene.sources.size() * sizeof(SceneSource));
+    write(scene.strings.data(), scene.strings.size());
+    write(scene.vertices.data(), scene.vertices.size() * sizeof(float));
+    write(scene.indices.data(), scene.indices.size() * sizeof(uint32_t));
+    write(scene.depthIndices.data(), scene.depthIndices.size() * sizeof(uint32_t));
+    write(scene.meshlets.data(), scene.meshlets.size() * sizeof(Meshlet));
+    return f.good();
+}
+
+// Indices et chaînes d'un .bin lu : un fichier tronqué ou corrompu est recuit
+// au lieu de faire lire hors des tableaux
+inline bool validBakedScene(const SceneData& scene) {
+    uint64_t stringBytes = scene.strings.size();
+    if (stringBytes > 0 && scene.strings.back() != '\0') return false;
+    auto validString = [&](uint32_t offset) { return offset == SCENE_NO_STRING || offset < stringBytes; };
+    for (auto const& m : scene.materials) if (!validString(m.texturePath)) return false;
+    for (auto const& l : scene.lights) if (!validString(l.name)) return false;
+    for (auto const& e : scene.emitters) if (!validString(e.name)) return false;
+    for (auto const& r : scene.rooms) if (!validString(r.name)) return false;
+    for (auto const& s : scene.sources) if (!validString(s.path)) return false;
+
+    uint64_t vertexCount = scene.vertices.size() / MESH_VERTEX_FLOATS;
+    for (auto const& m : scene.meshes) {
+        if (!validString(m.name) || (uint64_t)m.firstVertex + m.vertexCount > vertexCount
+            || (uint64_t)m.firstIndex + m.indexCount > scene.indices.size()
+            || (uint64_t)m.firstMeshlet + m.meshletCount > scene.meshlets.size()
+            || m.lodCount > (uint32_t)MESH_MAX_LODS) return false;
+        for (uint32_t i = m.firstIndex; i < m.firstIndex + m.indexCount; ++i)
+            if (scene.indices[i] >= m.vertexCount || scene.depthIndices[i] >= m.vertexCount) return false;
+        for (uint32_t l = 0; l < m.lodCount; ++l)
+            if ((uint64_t)m.lods[l].firstIndex + m.lods[l].indexCount > m.indexCount) return false;
+        for (uint32_t k = m.firstMeshlet; k < m.firstMeshlet + m.meshletCount; ++k)
+            if ((uint64_t)scene.meshlets[k].firstIndex + 3ull * scene.meshlets[k].triangleCount > m.indexCount) return false;
+    }
+    for (size_t i = 0; i < scene.objects.size(); ++i) {
+        const SceneObject& o = scene.objects[i];
+        if (!validString(o.name) || (o.mesh != SCENE_NO_MESH && o.mesh >= scene.meshes.size())
+            || (o.parent != SCENE_NO_PARENT && (o.parent < 0 || (size_t)o.parent >= i))) return false;
+    }
+    for (auto const& o : scene.openings)
+        if (o.rooms[0] >= scene.rooms.size() || (o.rooms[1] != SCENE_OUTSIDE && o.rooms[1] >= scene.rooms.size()))
+            return false;
+    return true;
+}
+
+// Une seule lecture du fichier, puis découpage du bloc en tableaux
+inline bool readBakedScene(const std::string& path, SceneData& scene) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+    std::fseek(f, 0, SEEK_END);
+    long size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    std::vector<char> blob(size > 0 ? (size_t)size : 0);
+    size_t read = std::fread(blob.data(), 1, blob.size(), f);
+    std::fclose(f);
+    if (read != blob.size() || blob.size() < sizeof(SceneBakedHeader)) return false;
+
+    SceneBakedHeader h;
+    std::memcpy(&h, blob.data(), sizeof(h));
+    if (std::memcmp(h.magic, "SCNB", 4) != 0 || h.version != SCENE_BAKED_VERSION) return false;
+
+    const char* p = blob.data() + sizeof(h);
+    const char* end = blob.data() + blob.size();
+    auto take = [&](auto& out, size_t count) {
+        using T = typename std::decay_t<decltype(out)>::value_type;
+        size_t bytes = count * sizeof(T);
+        if ((size_t)(end - p) < bytes) return false;
+        out.resize(count);
+        if (bytes) std::memcpy(out.data(), p, bytes);
+        p += bytes;
+        return true;
+    };
+    return take(scene.materials, h.materialCount) && take(scene.meshes, h.meshCount)
+        && take(scene.objects, h.objectCount) && take(scene.lights, h.lightCount)
+        && take(scene.emitters, h.emitterCount) && take(scene.rooms, h.roomCount)
+        && take(scene.openings, h.openingCount) && take(scene.sources, h.sourceCount)
+        && take(scene.strings, h.stringBytes)
+        && take(scene.vertices, (size_t)h.vertexFloats) && take(scene.indices, h.indexCount)
+        && take(scene.depthIndices, h.indexCount)
+        && take(scene.meshlets, h.meshletCount)
+        && p == end && validBakedScene(scene);
+}
+
+// Vrai si aucun fichier source du .bin n'a changé ; une source disparue (scène
+// distribuée sans ses OBJ) garde le .bin
+inline bool bakedSourcesFresh(const SceneData& scene) {
+    for (auto const& s : scene.sources) {
+        uint64_t size;
+        int64_t modified;
+        if (statSceneSource(scene.str(s.path), size, modified) && (size != s.size || modified != s.modified))
+            return false;
+    }
+    return true;
+}
+
+// Charge <path>.bin si ses fichiers sources (texte, OBJ, MTL) sont inchangés,
+// sinon (re)cuit la scène
+inline bool loadScene(const std::string& path, SceneData& scene) {
+    std::string textPath = resolveScenePath(path);
+    std::string bakedPath = textPath + ".bin";
+
+    if (readBakedScene(bakedPath, scene) && bakedSourcesFresh(scene)) {
+        std::cout << "Scene loaded from " << bakedPath << std::endl;
+        return true;
+    }
+    if (!parseSceneText(textPath, scene)) return false;
+    addSceneSource(scene, path);
+    if (writeBakedScene(bakedPath, scene)) std::cout << "Scene baked to " << bakedPath << std::endl;
+    else std::cerr << "Cannot write baked scene: " << bakedPath << std::endl;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Ressources GL de la scène
+// ----------------------------------------------------------------------------
+
+// Pièces, vitres et meshes dans un même pool (meshPool.h). Commandes indirectes :
+// une par pièce (building.h), puis une par lot d'objets statiques (staticBatch.h),
+// puis une par autre objet avec maillage (dessinées ensemble par drawScene),
+// puis les vitres (dessinées à part). Nœuds de la
+// hiérarchie = index dans le SSBO des transformations : 0 = pièces (identité),
+// 1 + i = objet i (les nœuds de groupe y ont aussi leur entrée). Meshlets : firstIndex absolu dans le pool, une instance
+// par (objet, meshlet) pour la passe meshlet.
+// Les commandes sont par objet (une instance chacune) pour le culling ; sans
+// culling, les suites d'objets consécutifs du même mesh (instances) sont
+// regroupées en une commande instanciée (batchIndirectBuffer) : le shader lit
+// la transformation gl_BaseInstance + gl_InstanceID.
+// En streaming (streaming.h), les maillages des objets et les textures sont
+// chargés plus tard : tant qu'un maillage n'est pas dans le pool, ses commandes
+// dessinent 0 indice (emptyMeshRange) et sa texture manque (couleur kd seule).
+struct SceneGpu {
+    MeshPool pool;
+    GLuint slotTextures[SCENE_MATERIAL_SLOTS] = {};
+    bool streamed = false;
+    std::vector<MeshRange> meshRanges;  // par maillage ; relatives au maillage en streaming
+    std::vector<uint8_t> meshResident;  // maillage présent dans le pool
+    std::vector<std::vector<uint32_t>> meshCommands; // commandes qui dessinent chaque maillage
+    std::vector<DrawElementsIndirectCommand> commands;
+    std::vector<MeshRange> commandRanges; // plage, boîte et niveaux de détail par commande (culling, LOD)
+    std::vector<uint32_t> commandMaterials; // matériau du premier sommet, clé de tri de la liste de draws
+    GLuint indirectBuffer = 0;
+    GLsizei sceneCommandCount = 0; // pièces + objets
+    GLsizei roomCommandCount = 0;  // commandes [0, roomCommandCount) : une par pièce
+    GLsizei staticCommandCount = 0; // puis une par lot statique (identité, DRAW_ROOM)
+    StaticBatcher staticBatches;
+    GLuint windowCommand = 0;
+    GLuint occluderIndirectBuffer = 0; // pièces + objets "occluder" (pré-passe du Hi-Z)
+    GLsizei occluderCommandCount = 0;
+    std::vector<int> commandOfObject; // -1 pour un nœud de groupe
+    std::vector<Meshlet> meshlets;
+    std::vector<MeshletInstance> meshletInstances;
+    GLuint batchIndirectBuffer = 0; // pièces + une commande instanciée par suite d'objets du même mesh
+    GLsizei batchCommandCount = 0;
+    GLuint tintBuffer = 0;          // SCENE_TINT_BINDING
+    TransformHierarchy transforms;
+};
+
+// Pièces, lots statiques + une commande instanciée par suite d'objets du même
+// mesh, sous le même parent et aux mêmes drapeaux (nœuds consécutifs)
+inline std::vector<DrawElementsIndirectCommand> buildBatchCommands(const SceneData& scene, const SceneGpu& gpu) {
+    std::vector<DrawElementsIndirectCommand> batches(gpu.commands.begin(),
+                                                     gpu.commands.begin() + gpu.roomCommandCount + gpu.staticCommandCount);
+    for (auto& b : batches) b.instanceCount = 1;
+    for (size_t i = 0; i < scene.objects.size(); ++i) {
+        int command = gpu.commandOfObject[i];
+        if (command < 0) continue;
+        auto const& o = scene.objects[i];
+        auto const& previous = scene.objects[i - (i > 0 ? 1 : 0)];
+        bool continues = i > 0 && gpu.commandOfObject[i - 1] >= 0 && previous.mesh == o.mesh
+                      && previous.parent == o.parent && previous.flags == o.flags;
+        if (continues) ++batches.back().instanceCount;
+        else {
+            batches.push_back(gpu.commands[command]);
+            batches.back().instanceCount = 1;
+        }
+    }
+    return batches;
+}
+
+// Pièces, lots statiques qui contiennent un "occluder" + objets "occluder" (pré-passe du Hi-Z)
+inline std::vector<DrawElementsIndirectCommand> buildOccluderCommands(const SceneData& scene, const SceneGpu& gpu) {
+    std::vector<DrawElementsIndirectCommand> occluders(gpu.commands.begin(), gpu.commands.begin() + gpu.roomCommandCount);
+    for (GLsizei b = 0; b < gpu.staticCommandCount; ++b)
+        if (gpu.staticBatches.batches[b].occluder) occluders.push_back(gpu.commands[gpu.roomCommandCount + b]);
+    for (size_t i = 0; i < scene.objects.size(); ++i)
+        if ((scene.objects[i].flags & SCENE_OBJECT_OCCLUDER) && gpu.commandOfObject[i] >= 0)
+            occluders.push_back(gpu.commands[gpu.commandOfObject[i]]);
+    for (auto& o : occluders) o.instanceCount = 1;
+    return occluders;
+}
+
+// streamMeshBytes > 0 : les maillages des objets et les textures ne sont pas
+// chargés ici mais par le streaming (streaming.h) ; le pool réserve cette place
+// pour eux après les pièces et les vitres.
+// staticBatching : les objets "static" sont regroupés en lots (pas en streaming,
+// leurs maillages doivent être dans le pool dès le départ)
+inline void createSceneGpu(const SceneData& scene,
+                           const std::vector<std::vector<float>>& roomVertices,
+                           const std::vector<std::vector<uint32_t>>& roomIndices,
+                           const std::vector<float>& windowVertices, const std::vector<uint32_t>& windowIndices,
+                           SceneGpu& gpu, size_t streamMeshBytes = 0, bool staticBatching = false) {
+    gpu.streamed = streamMeshBytes > 0;
+    // Images partagées entre matériaux chargées une seule fois
+    std::unordered_map<std::string, GLuint> textureByPath;
+    for (auto const& m : scene.materials) {
+        if (gpu.streamed) break;
+        if (m.slot >= (uint32_t)SCENE_MATERIAL_SLOTS || !m.hasTexture) continue;
+        std::string path = scene.str(m.texturePath);
+        auto it = textureByPath.find(path);
+        if (it == textureByPath.end())
+            it = textureByPath.emplace(path, loadTextureFromFile(resolveScenePath(path))).first;
+        gpu.slotTextures[m.slot] = it->second;
+    }
+
+    gpu.pool = MeshPool();
+    std::vector<MeshRange> rooms;
+    for (size_t r = 0; r < roomVertices.size(); ++r)
+        rooms.push_back(gpu.pool.add(roomVertices[r].data(), roomVertices[r].size() / MESH_VERTEX_FLOATS,
+                                     roomIndices[r].data(), roomIndices[r].size()));
+    MeshRange window = gpu.pool.add(windowVertices.data(), windowVertices.size() / MESH_VERTEX_FLOATS,
+                                    windowIndices.data(), windowIndices.size());
+    std::vector<MeshRange>& meshRanges = gpu.meshRanges;
+    meshRanges.clear();
+    gpu.meshlets.clear();
+    size_t streamVertexBytes = 0, streamIndexBytes = 0;
+    for (auto const& mesh : scene.meshes) {
+        MeshRange range = {};
+        if (!gpu.streamed) {
+            range = gpu.pool.add(scene.vertices.data() + (size_t)mesh.firstVertex * MESH_VERTEX_FLOATS,
+                                 mesh.vertexCount, scene.indices.data() + mesh.firstIndex, mesh.indexCount,
+                                 &mesh.bounds, mesh.lods, mesh.lodCount, scene.depthIndices.data() + mesh.firstIndex);
+        } else {
+            // Plages relatives au maillage, placées par offsetMeshRange au chargement
+            range.lodCount = mesh.lodCount;
+            std::copy(mesh.lods, mesh.lods + mesh.lodCount, range.lods);
+            range.firstIndex = range.lods[0].firstIndex;
+            range.indexCount = range.lods[0].indexCount;
+            range.bounds = mesh.bounds;
+            streamVertexBytes += MeshPool::vertexBytes(mesh.vertexCount);
+            streamIndexBytes += MeshPool::indexBytes(mesh.indexCount);
+        }
+        range.firstMeshlet = (uint32_t)gpu.meshlets.size();
+        range.meshletCount = mesh.meshletCount;
+        for (uint32_t m = 0; m < mesh.meshletCount; ++m) {
+            Meshlet meshlet = scene.meshlets[mesh.firstMeshlet + m];
+            meshlet.firstIndex += range.firstIndex;
+            gpu.meshlets.push_back(meshlet);
+        }
+        meshRanges.push_back(range);
+    }
+    gpu.meshResident.assign(scene.meshes.size(), gpu.streamed ? 0 : 1);
+
+    gpu.transforms = TransformHierarchy();
+    gpu.transforms.add(TransformHierarchy::NO_PARENT, glm::value_ptr(glm::mat4(1.0f)));
+    for (auto const& o : scene.objects)
+        gpu.transforms.add(o.parent == SCENE_NO_PARENT ? TransformHierarchy::NO_PARENT : 1 + o.parent, o.local);
+
+    // Objets statiques cuits dans l'espace monde, un lot par pièce.
+    // Un objet teinté garde son draw : la teinte est lue par nœud (SCENE_TINT_BINDING).
+    gpu.staticBatches = StaticBatcher();
+    std::vector<uint8_t> batched(scene.objects.size(), 0);
+    if (staticBatching && !gpu.streamed) {
+        TransformHierarchy baked = gpu.transforms; // sans consommer les drapeaux de la première frame
+        baked.update();
+        for (size_t i = 0; i < scene.objects.size(); ++i) {
+            auto const& o = scene.objects[i];
+            if (o.mesh == SCENE_NO_MESH || !(o.flags & SCENE_OBJECT_STATIC)) continue;
+            if (o.tint[0] != 1.0f || o.tint[1] != 1.0f || o.tint[2] != 1.0f) continue;
+            auto const& mesh = scene.meshes[o.mesh];
+            const Matrix4& world = baked.world[1 + i];
+            const float* m = world.m;
+            const float* c = mesh.bounds.center;
+            glm::vec3 center(m[0] * c[0] + m[4] * c[1] + m[8] * c[2] + m[12],
+                             m[1] * c[0] + m[5] * c[1] + m[9] * c[2] + m[13],
+                             m[2] * c[0] + m[6] * c[1] + m[10] * c[2] + m[14]);
+            int room = scene.roomAt(center);
+            gpu.staticBatches.addObject(room < 0 ? (uint32_t)scene.rooms.size() : (uint32_t)room,
+                                        (o.flags & SCENE_OBJECT_OCCLUDER) != 0, (uint32_t)(1 + i), world,
+                                        scene.vertices.data(), mesh.firstVertex, mesh.vertexCount,
+                                        scene.indices.data() + mesh.firstIndex + mesh.lods[0].firstIndex,
+                                        scene.depthIndices.data() + mesh.firstIndex + mesh.lods[0].firstIndex, mesh.lods[0].indexCount);
+            batched[i] = 1;
+        }
+        gpu.staticBatches.addToPool(gpu.pool);
+    }
+    gpu.pool.dynamicStorage = true; // pièces éditées (roomEditor.h), lots statiques recuits
+
+    if (gpu.streamed) {
+        // Place partagée entre sommets et indices comme dans l'ensemble des maillages
+        double vertexShare = (double)streamVertexBytes / (double)std::max<size_t>(1, streamVertexBytes + streamIndexBytes);
+        size_t vertexBytes = (size_t)((double)streamMeshBytes * vertexShare);
+        gpu.pool.createGpu(std::max<size_t>(1, vertexBytes / MeshPool::vertexBytes(1)),
+                           std::max<size_t>(1, (streamMeshBytes - vertexBytes) / MeshPool::indexBytes(1)));
+    } else {
+        gpu.pool.createGpu();
+    }
+
+    auto firstMaterial = [](const float* vertices) { return (uint32_t)vertices[MESH_VERTEX_FLOATS - 1]; };
+    gpu.commands.clear();
+    gpu.commandRanges.clear();
+    gpu.commandMaterials.clear();
+    for (size_t r = 0; r < rooms.size(); ++r) {
+        gpu.commands.push_back(makeDrawCommand(rooms[r], DRAW_ROOM));
+        gpu.commandRanges.push_back(rooms[r]);
+        gpu.commandMaterials.push_back(roomVertices[r].empty() ? 0 : firstMaterial(roomVertices[r].data()));
+    }
+    gpu.roomCommandCount = (GLsizei)rooms.size();
+    for (auto const& batch : gpu.staticBatches.batches) {
+        gpu.commands.push_back(makeDrawCommand(batch.range, DRAW_ROOM));
+        gpu.commandRanges.push_back(batch.range);
+        gpu.commandMaterials.push_back(batch.material);
+    }
+    gpu.staticCommandCount = (GLsizei)gpu.staticBatches.batches.size();
+    gpu.commandOfObject.assign(scene.objects.size(), -1);
+    gpu.meshCommands.assign(scene.meshes.size(), {});
+    gpu.meshletInstances.clear();
+    for (size_t i = 0; i < scene.objects.size(); ++i) {
+        auto const& o = scene.objects[i];
+        if (o.mesh == SCENE_NO_MESH || batched[i]) continue;
+        gpu.commandOfObject[i] = (int)gpu.commands.size();
+        gpu.meshCommands[o.mesh].push_back((uint32_t)gpu.commands.size());
+        auto const& range = meshRanges[o.mesh];
+        for (uint32_t m = 0; m < range.meshletCount; ++m)
+            gpu.meshletInstances.push_back({ range.firstMeshlet + m, (uint32_t)gpu.commands.size(), range.baseVertex, (uint32_t)(1 + i) });
+        MeshRange drawn = gpu.meshResident[o.mesh] ? range : emptyMeshRange(range);
+        gpu.commands.push_back(makeDrawCommand(drawn, (GLuint)(1 + i)));
+        gpu.commandRanges.push_back(drawn);
+        auto const& mesh = scene.meshes[o.mesh];
+        gpu.commandMaterials.push_back(mesh.vertexCount ? firstMaterial(&scene.vertices[(size_t)mesh.firstVertex * MESH_VERTEX_FLOATS]) : 0);
+    }
+    gpu.sceneCommandCount = (GLsizei)gpu.commands.size();
+    gpu.windowCommand = (GLuint)gpu.commands.size();
+    gpu.commands.push_back(makeDrawCommand(window, DRAW_ROOM));
+    gpu.commandRanges.push_back(window);
+    gpu.commandMaterials.push_back(windowVertices.empty() ? 0 : firstMaterial(windowVertices.data()));
+
+    glCreateBuffers(1, &gpu.indirectBuffer);
+    glNamedBufferStorage(gpu.indirectBuffer, gpu.commands.size() * sizeof(DrawElementsIndirectCommand),
+                         gpu.commands.data(), GL_DYNAMIC_STORAGE_BIT);
+
+    std::vector<DrawElementsIndirectCommand> batches = buildBatchCommands(scene, gpu);
+    gpu.batchCommandCount = (GLsizei)batches.size();
+    glCreateBuffers(1, &gpu.batchIndirectBuffer);
+    glNamedBufferStorage(gpu.batchIndirectBuffer, batches.size() * sizeof(DrawElementsIndirectCommand), batches.data(),
+                         gpu.streamed ? GL_DYNAMIC_STORAGE_BIT : 0);
+
+    std::vector<float> tints(4 * (1 + scene.objects.size()), 1.0f);
+    for (size_t i = 0; i < scene.objects.size(); ++i) std::memcpy(&tints[4 * (1 + i)], scene.objects[i].tint, 4 * sizeof(float));
+    glCreateBuffers(1, &gpu.tintBuffer);
+    glNamedBufferStorage(gpu.tintBuffer, tints.size() * sizeof(float), tints.data(), 0);
+
+    std::vector<DrawElementsIndirectCommand> occluders = buildOccluderCommands(scene, gpu);
+    gpu.occluderCommandCount = (GLsizei)occluders.size();
+    glCreateBuffers(1, &gpu.occluderIndirectBuffer);
+    glNamedBufferStorage(gpu.occluderIndirectBuffer, occluders.size() * sizeof(DrawElementsIndirectCommand),
+                         occluders.data(), GL_DYNAMIC_STORAGE_BIT);
+
+    size_t triangles = 0;
+    for (auto const& mesh : scene.meshes) triangles += mesh.lods[0].indexCount / 3;
+    std::cout << "Scene: " << scene.rooms.size() << " rooms, " << scene.meshes.size() << " meshes, " << scene.objects.size() << " objects, "
+              << scene.materials.size() << " materials, " << scene.vertices.size() / MESH_VERTEX_FLOATS
+              << " vertices, " << triangles << " triangles, " << gpu.sceneCommandCount << " draws ("
+              << gpu.batchCommandCount << " instanced)";
+    if (gpu.staticCommandCount)
+        std::cout << ", " << gpu.staticBatches.objectCount << " static objects in " << gpu.staticCommandCount << " batches";
+    std::cout << std::endl;
+    for (auto const& mesh : scene.meshes) {
+        std::cout << "  " << scene.str(mesh.name) << ": LOD triangles";
+        for (uint32_t l = 0; l < mesh.lodCount; ++l) std::cout << " " << mesh.lods[l].indexCount / 3;
+        if (mesh.meshletCount) std::cout << ", " << mesh.meshletCount << " meshlets";
+        std::vector<uint8_t> shared(mesh.vertexCount, 0);
+        for (uint32_t i = 0; i < mesh.indexCount; ++i) shared[scene.depthIndices[mesh.firstIndex + i]] = 1;
+        std::cout << ", " << std::count(shared.begin(), shared.end(), 1) << "/" << mesh.vertexCount << " depth-pass vertices";
+        std::cout << std::endl;
+    }
+}
+
+// Lots statiques dont un objet a bougé depuis la cuisson (après
+// TransformHierarchy::update) : sommets renvoyés, boîtes des commandes des lots
+// mises à jour. true si une boîte a changé (bornes du culling à renvoyer).
+inline bool updateStaticBatches(const SceneData& scene, SceneGpu& gpu) {
+    std::vector<uint8_t> changed = gpu.staticBatches.update(gpu.pool, gpu.transforms, scene.vertices.data());
+    if (changed.empty()) return false;
+    for (size_t b = 0; b < changed.size(); ++b)
+        if (changed[b]) gpu.commandRanges[gpu.roomCommandCount + b].bounds = gpu.staticBatches.batches[b].range.bounds;
+    return true;
+}
+
+// Streaming : le maillage mesh vient d'entrer dans le pool (allocation) ou d'en
+// sortir (nullptr). Met à jour ses commandes, leurs plages et ses meshlets côté
+// CPU ; uploadSceneCommands renvoie ensuite les tampons de commandes.
+inline void setMeshResidency(const SceneData& scene, SceneGpu& gpu, uint32_t mesh, const MeshAllocation* allocation) {
+    const MeshRange& relative = gpu.meshRanges[mesh];
+    MeshRange range = allocation ? offsetMeshRange(relative, *allocation) : emptyMeshRange(relative);
+    gpu.meshResident[mesh] = allocation != nullptr;
+    for (uint32_t c : gpu.meshCommands[mesh]) {
+        gpu.commands[c].count = range.indexCount;
+        gpu.commands[c].firstIndex = range.firstIndex;
+        gpu.commands[c].baseVertex = range.baseVertex;
+        gpu.commandRanges[c] = range;
+    }
+    if (!allocation) return; // meshletCount 0 : meshlets ignorés par le culling
+    const SceneMesh& sceneMesh = scene.meshes[mesh];
+    for (uint32_t m = 0; m < relative.meshletCount; ++m)
+        gpu.meshlets[relative.firstMeshlet + m].firstIndex = scene.meshlets[sceneMesh.firstMeshlet + m].firstIndex + range.firstIndex;
+    for (auto& instance : gpu.meshletInstances)
+        if (instance.meshlet - relative.firstMeshlet < relative.meshletCount) instance.baseVertex = range.baseVertex;
+}
+
+// Renvoie les commandes de la scène et les tampons qui en dérivent (regroupement
+// instancié, occluders) après des setMeshResidency
+inline void uploadSceneCommands(const SceneData& scene, const SceneGpu& gpu) {
+    glNamedBufferSubData(gpu.indirectBuffer, 0, gpu.commands.size() * sizeof(DrawElementsIndirectCommand), gpu.commands.data());
+    std::vector<DrawElementsIndirectCommand> batches = buildBatchCommands(scene, gpu);
+    glNamedBufferSubData(gpu.batchIndirectBuffer, 0, batches.size() * sizeof(DrawElementsIndirectCommand), batches.data());
+    std::vector<DrawElementsIndirectCommand> occluders = buildOccluderCommands(scene, gpu);
+    glNamedBufferSubData(gpu.occluderIndirectBuffer, 0, occluders.size() * sizeof(DrawElementsIndirectCommand), occluders.data());
+}
+
+// Couleurs des matériaux : état du programme, à renvoyer seulement après un (re)chargement
+inline void applySceneMaterials(GLuint program, const SceneData& scene, const SceneGpu& gpu) {
+    for (auto const& m : scene.materials) {
+        if (m.slot >= (uint32_t)SCENE_MATERIAL_SLOTS) continue;
+        std::string kdName = "materialKd[" + std::to_string(m.slot) + "]";
+        std::string hasTexName = "materialHasTex[" + std::to_string(m.slot) + "]";
+        GLint locKd = glGetUniformLocation(program, kdName.c_str());
+        GLint locHasTex = glGetUniformLocation(program, hasTexName.c_str());
+        if (locKd >= 0) glProgramUniform3fv(program, locKd, 1, m.kd);
+        if (locHasTex >= 0) glProgramUniform1i(program, locHasTex, gpu.slotTextures[m.slot] ? 1 : 0);
+    }
+}
+
+// Les unités déjà liées à la bonne texture sont filtrées par le cache d'état
+inline void bindSceneTextures(const SceneGpu& gpu) {
+    for (int slot = 0; slot < SCENE_MATERIAL_SLOTS; ++slot)
+        if (gpu.slotTextures[slot]) glBindTextureUnit((GLuint)slot, gpu.slotTextures[slot]);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SCENE_TINT_BINDING, gpu.tintBuffer);
+}
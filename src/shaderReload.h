@@ -0,0 +1,411 @@
+#pragma once
+// ============================================================================
+// Rechargement à chaud des shaders
+// ============================================================================
+// Les sources GLSL vivent dans shaders/. Un thread surveille le dossier
+// (inotify sous Linux, scrutation des dates de modification ailleurs) et relit
+// les fichiers modifiés. La compilation ne bloque pas le thread de rendu :
+//   - GL_KHR_parallel_shader_compile : le driver compile en tâche de fond,
+//     on interroge GL_COMPLETION_STATUS_KHR à chaque frame ;
+//   - sinon, un contexte partagé sur un thread de travail compile et lie ;
+//   - en dernier recours, compilation bloquante (ne sert qu'au développement).
+// Le programme actif reste utilisé tant que le nouveau n'est pas lié, puis
+// l'échange se fait entre deux frames (HotProgram::id).
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+inline bool hasGLExtension(const char* name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const char* ext = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (ext && std::strcmp(ext, name) == 0) return true;
+    }
+    return false;
+}
+
+inline bool readTextFile(const std::string& path, std::string& out) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) return false;
+    std::stringstream ss;
+    ss << f.rdbuf();
+    out = ss.str();
+    return true;
+}
+
+// Même logique de chemins que pour les textures (lancement depuis build/ ou la racine)
+inline std::string findShaderDirectory() {
+    const char* candidates[] = { "../shaders/", "./shaders/", "../../shaders/" };
+    for (const char* dir : candidates) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(dir, ec)) return dir;
+    }
+    std::cerr << "ERROR: shaders/ directory not found" << std::endl;
+    return candidates[0];
+}
+
+// ----------------------------------------------------------------------------
+// Surveillance du dossier shaders/ (thread dédié)
+// ----------------------------------------------------------------------------
+class ShaderFileWatcher {
+public:
+    explicit ShaderFileWatcher(const std::string& dir) : directory(dir) {
+        running = true;
+        worker = std::thread([this] { run(); });
+    }
+
+    ~ShaderFileWatcher() {
+        running = false;
+        if (worker.joinable()) worker.join();
+    }
+
+    // Fichiers relus depuis le dernier appel (nom -> contenu)
+    std::unordered_map<std::string, std::string> takeChanged() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unordered_map<std::string, std::string> out;
+        out.swap(changed);
+        return out;
+    }
+
+private:
+    void fileChanged(const std::string& name) {
+        std::string src;
+        if (!readTextFile(directory + name, src)) return;
+        std::lock_guard<std::mutex> lock(mutex);
+        changed[name] = std::move(src);
+    }
+
+#ifdef __linux__
+    void run() {
+        int fd = inotify_init1(IN_NONBLOCK);
+        if (fd < 0 || inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+            std::cerr << "ShaderFileWatcher: inotify unavailable, hot-reload disabled" << std::endl;
+            if (fd >= 0) close(fd);
+            return;
+        }
+        alignas(inotify_event) char buf[4096];
+        while (running) {
+            pollfd pfd = { fd, POLLIN, 0 };
+            if (poll(&pfd, 1, 200) <= 0) continue;
+            ssize_t len;
+            while ((len = read(fd, buf, sizeof(buf))) > 0) {
+                for (char* p = buf; p < buf + len; ) {
+                    auto* ev = (inotify_event*)p;
+                    if (ev->len > 0) fileChanged(ev->name);
+                    p += sizeof(inotify_event) + ev->len;
+                }
+            }
+        }
+        close(fd);
+    }
+#else
+    void run() {
+        namespace fs = std::filesystem;
+        std::unordered_map<std::string, fs::file_time_type> stamps;
+        auto scan = [&](bool notify) {
+            std::error_code ec;
+            for (auto& entry : fs::directory_iterator(directory, ec)) {
+                auto name = entry.path().filename().string();
+                auto t = fs::last_write_time(entry.path(), ec);
+                if (ec) continue;
+                auto it = stamps.find(name);
+                if (it == stamps.end() || it->second != t) {
+                    stamps[name] = t;
+                    if (notify) fileChanged(name);
+                }
+            }
+        };
+        scan(false);
+        while (running) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            scan(true);
+        }
+    }
+#endif
+
+    std::string directory;
+    std::atomic<bool> running{false};
+    std::thread worker;
+    std::mutex mutex;
+    std::unordered_map<std::string, std::string> changed;
+};
+
+// ----------------------------------------------------------------------------
+// Programme rechargeable
+// ----------------------------------------------------------------------------
+struct HotProgram {
+    std::string name;
+    std::vector<std::pair<GLenum, std::string>> stages; // (type, fichier dans shaders/)
+    GLuint id = 0;          // programme utilisé pour le rendu
+    int generation = 0;     // incrémenté à chaque remplacement (recharger les locations)
+
+    // Build en cours (mode parallèle)
+    GLuint pending = 0;
+    std::vector<GLuint> pendingShaders;
+    bool rebuildQueued = false;
+};
+
+enum class ShaderCompileMode { Parallel, SharedContext, Blocking };
+
+class ShaderLibrary {
+public:
+    ~ShaderLibrary() {
+        if (compileThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(jobMutex);
+                stopWorker = true;
+            }
+            jobCv.notify_one();
+            compileThread.join();
+        }
+        if (sharedContext) SDL_GL_DestroyContext(sharedContext);
+    }
+
+    // À appeler avec le contexte principal courant
+    void init(SDL_Window* window, SDL_GLContext mainContext) {
+        directory = findShaderDirectory();
+
+        if (hasGLExtension("GL_KHR_parallel_shader_compile")) {
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu); // laisser le driver choisir
+            mode = ShaderCompileMode::Parallel;
+        } else {
+            SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+            sharedContext = SDL_GL_CreateContext(window);
+            SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+            SDL_GL_MakeCurrent(window, mainContext);
+            if (sharedContext) {
+                mode = ShaderCompileMode::SharedContext;
+                compileThread = std::thread([this, window] { workerLoop(window); });
+            } else {
+                mode = ShaderCompileMode::Blocking;
+            }
+        }
+        const char* modeNames[] = { "KHR_parallel_shader_compile", "shared context worker", "blocking" };
+        std::cout << "Shader hot-reload: " << directory << " (" << modeNames[(int)mode] << ")" << std::endl;
+
+        watcher = std::make_unique<ShaderFileWatcher>(directory);
+    }
+
+    // Chargement initial : synchrone, le programme est prêt au retour
+    HotProgram* load(const std::string& name, std::vector<std::pair<GLenum, std::string>> const& stages) {
+        auto p = std::make_unique<HotProgram>();
+        p->name = name;
+        p->stages = stages;
+        for (auto const& s : stages) readSource(s.second);
+
+        std::string log;
+        GLuint id = buildBlocking(*p, log);
+        if (!log.empty()) std::cerr << "ERROR (" << name << "): " << log << std::endl;
+        p->id = id;
+        programs.push_back(std::move(p));
+        return programs.back().get();
+    }
+
+    // Une fois par frame, avant le rendu
+    void update() {
+        if (!watcher) return;
+
+        auto changed = watcher->takeChanged();
+        if (!changed.empty()) {
+            for (auto& kv : changed) sources[kv.first] = std::move(kv.second);
+            for (auto& p : programs) {
+                for (auto const& s : p->stages) {
+                    if (changed.count(s.second)) { requestRebuild(*p); break; }
+                }
+            }
+        }
+
+        if (mode == ShaderCompileMode::Parallel) {
+            for (auto& p : programs) pollParallel(*p);
+        } else if (mode == ShaderCompileMode::SharedContext) {
+            std::deque<WorkerResult> done;
+            {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                done.swap(results);
+            }
+            for (auto& r : done) finishBuild(*r.program, r.id, r.log);
+        }
+    }
+
+private:
+    struct WorkerJob {
+        HotProgram* program;
+        std::vector<std::pair<GLenum, std::string>> sources; // (type, source)
+    };
+    struct WorkerResult {
+        HotProgram* program;
+        GLuint id;
+        std::string log;
+    };
+
+    const std::string& readSource(const std::string& file) {
+        auto it = sources.find(file);
+        if (it != sources.end()) return it->second;
+        std::string src;
+        if (!readTextFile(directory + file, src))
+            std::cerr << "ERROR: cannot read shader " << directory + file << std::endl;
+        return sources[file] = src;
+    }
+
+    void requestRebuild(HotProgram& p) {
+        std::cout << "Shader hot-reload: rebuilding '" << p.name << "'" << std::endl;
+        if (mode == ShaderCompileMode::Parallel) {
+            if (p.pending) { p.rebuildQueued = true; return; } // relancé à la fin du build courant
+            startParallel(p);
+        } else if (mode == ShaderCompileMode::SharedContext) {
+            WorkerJob job{ &p, {} };
+            for (auto const& s : p.stages) job.sources.push_back({ s.first, sources[s.second] });
+            {
+                std::lock_guard<std::mutex> lock(jobMutex);
+                jobs.push_back(std::move(job));
+            }
+            jobCv.notify_one();
+        } else {
+            std::string log;
+            GLuint id = buildBlocking(p, log);
+            finishBuild(p, id, log);
+        }
+    }
+
+    // Compile et lie; renvoie 0 (et le log) en cas d'échec
+    static GLuint compileAndLink(std::vector<std::pair<GLenum, std::string>> const& stageSources, std::string& log) {
+        GLuint prog = glCreateProgram();
+        std::vector<GLuint> shaders;
+        for (auto const& s : stageSources) {
+            GLuint sh = glCreateShader(s.first);
+            const char* src = s.second.c_str();
+            glShaderSource(sh, 1, &src, nullptr);
+            glCompileShader(sh);
+            glAttachShader(prog, sh);
+            shaders.push_back(sh);
+        }
+        glLinkProgram(prog);
+        GLuint result = checkLinked(prog, shaders, log);
+        return result;
+    }
+
+    // Vérifie le résultat d'un link terminé et libère les shaders
+    static GLuint checkLinked(GLuint prog, std::vector<GLuint> const& shaders, std::string& log) {
+        char buf[10000];
+        for (GLuint sh : shaders) {
+            GLint status;
+            glGetShaderiv(sh, GL_COMPILE_STATUS, &status);
+            if (status != GL_TRUE) {
+                glGetShaderInfoLog(sh, sizeof(buf), 0, buf);
+                log += buf;
+            }
+            glDetachShader(prog, sh);
+            glDeleteShader(sh);
+        }
+        GLint status;
+        glGetProgramiv(prog, GL_LINK_STATUS, &status);
+        if (status != GL_TRUE) {
+            glGetProgramInfoLog(prog, sizeof(buf), 0, buf);
+            log += buf;
+            glDeleteProgram(prog);
+            return 0;
+        }
+        return prog;
+    }
+
+    GLuint buildBlocking(HotProgram& p, std::string& log) {
+        std::vector<std::pair<GLenum, std::string>> stageSources;
+        for (auto const& s : p.stages) stageSources.push_back({ s.first, readSource(s.second) });
+        return compileAndLink(stageSources, log);
+    }
+
+    void startParallel(HotProgram& p) {
+        p.pending = glCreateProgram();
+        p.pendingShaders.clear();
+        for (auto const& s : p.stages) {
+            GLuint sh = glCreateShader(s.first);
+            const char* src = sources[s.second].c_str();
+            glShaderSource(sh, 1, &src, nullptr);
+            glCompileShader(sh);   // rend la main immédiatement
+            glAttachShader(p.pending, sh);
+            p.pendingShaders.push_back(sh);
+        }
+        glLinkProgram(p.pending);  // idem, le link attend les compilations côté driver
+    }
+
+    void pollParallel(HotProgram& p) {
+        if (!p.pending) return;
+        GLint done = GL_FALSE;
+        glGetProgramiv(p.pending, GL_COMPLETION_STATUS_KHR, &done);
+        if (done != GL_TRUE) return;
+
+        std::string log;
+        GLuint id = checkLinked(p.pending, p.pendingShaders, log);
+        p.pending = 0;
+        p.pendingShaders.clear();
+        finishBuild(p, id, log);
+
+        if (p.rebuildQueued) {
+            p.rebuildQueued = false;
+            startParallel(p);
+        }
+    }
+
+    // Échange atomique (entre deux frames) : l'ancien programme reste actif en cas d'erreur
+    void finishBuild(HotProgram& p, GLuint id, std::string const& log) {
+        if (!id) {
+            std::cerr << "ERROR (" << p.name << "), keeping previous program:\n" << log << std::endl;
+            return;
+        }
+        if (p.id) glDeleteProgram(p.id);
+        p.id = id;
+        p.generation++;
+        std::cout << "Shader hot-reload: '" << p.name << "' swapped in" << std::endl;
+    }
+
+    void workerLoop(SDL_Window* window) {
+        SDL_GL_MakeCurrent(window, sharedContext);
+        ge::gl::init(); // table de fonctions propre à ce thread (thread_local dans geGL)
+        for (;;) {
+            WorkerJob job;
+            {
+                std::unique_lock<std::mutex> lock(jobMutex);
+                jobCv.wait(lock, [this] { return stopWorker || !jobs.empty(); });
+                if (stopWorker) break;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            WorkerResult r{ job.program, 0, {} };
+            r.id = compileAndLink(job.sources, r.log);
+            glFinish(); // l'objet doit être complet avant d'être vu par le contexte principal
+            std::lock_guard<std::mutex> lock(resultMutex);
+            results.push_back(std::move(r));
+        }
+        SDL_GL_MakeCurrent(window, nullptr);
+    }
+
+    std::string directory;
+    ShaderCompileMode mode = ShaderCompileMode::Blocking;
+    std::vector<std::unique_ptr<HotProgram>> programs;
+    std::unordered_map<std::string, std::string> sources;
+    std::unique_ptr<ShaderFileWatcher> watcher;
+
+    // Mode contexte partagé
+    SDL_GLContext sharedContext = nullptr;
+    std::thread compileThread;
+    std::mutex jobMutex;
+    std::condition_variable jobCv;
+    std::deque<WorkerJob> jobs;
+    bool stopWorker = false;
+    std::mutex resultMutex;
+    std::deque<WorkerResult> results;
+};
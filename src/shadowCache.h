@@ -0,0 +1,269 @@
+#pragma once
+// ============================================================================
+// Cache des shadow maps du soleil (une couche par cascade)
+// ============================================================================
+// Le soleil est fixe et presque tout est immobile : une couche n'est
+// redessinée que si sa matrice change (toute la couche : lumière ou cascade
+// recalée sur la caméra) ou si un objet qui projette une ombre change
+// (seulement sa zone). Chaque commande de la scène garde l'état avec lequel
+// elle est dans les couches (matrice monde, boîte, plage d'indices) et, par
+// couche, le rectangle de texels que couvre sa boîte vue de la lumière. Une
+// commande changée salit l'union de son ancien et de son nouveau rectangle ;
+// la passe d'ombre efface et redessine ces zones seules, sous glScissorIndexed
+// (ShadowMapping::beginPass), avec un culling de la lumière limité à leur union.
+// Sans zone sale, pas de passe d'ombre du tout.
+// Une cascade recalée sur la caméra ne fait que glisser d'un nombre entier de
+// texels : ses texels encore couverts sont déplacés (ShadowMapping::shiftLayers)
+// et seules les bandes découvertes sont à redessiner. Un déplacement en
+// diagonale découvre une zone en L : chaque couche a SHADOW_CACHE_PARTS
+// rectangles sales, une fenêtre et un scissor chacun.
+// Le niveau de détail des occulteurs dans la liste de la lumière ne dépend pas
+// de la caméra (LodSelection::shadowTexelsPerUnit) : la plage d'indices gardée
+// ici reste celle des texels en cache, sans couture au bord d'une zone redessinée.
+
+#include <cmath>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+#include "meshPool.h"
+#include "transformHierarchy.h"
+
+// Texels [x0, x1) x [y0, y1) d'une couche, vide si x0 >= x1 ou y0 >= y1
+struct ShadowRect {
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    bool empty() const { return x0 >= x1 || y0 >= y1; }
+    size_t area() const { return empty() ? 0 : (size_t)(x1 - x0) * (size_t)(y1 - y0); }
+    void extend(const ShadowRect& r) {
+        if (r.empty()) return;
+        if (empty()) { *this = r; return; }
+        x0 = std::min(x0, r.x0); y0 = std::min(y0, r.y0);
+        x1 = std::max(x1, r.x1); y1 = std::max(y1, r.y1);
+    }
+};
+
+const size_t SHADOW_CACHE_PARTS = 2; // rectangles sales par couche (parts * couches : invocations de shadow.geom)
+
+// Glissement d'une couche d'une frame à l'autre : elle voit maintenant en (x, y)
+// ce que la précédente avait en (x + dx, y + dy)
+struct ShadowShift {
+    int dx = 0, dy = 0;
+
+    bool any() const { return dx != 0 || dy != 0; }
+};
+
+// Ce qui a été dessiné dans une shadow map pour une commande
+struct ShadowCasterState {
+    Matrix4 world;
+    MeshBounds bounds;
+    GLuint firstIndex;
+    GLuint count;
+};
+
+inline ShadowCasterState shadowCasterState(const DrawElementsIndirectCommand& command, const MeshRange& range,
+                                           const TransformHierarchy& transforms) {
+    ShadowCasterState state;
+    state.world = transforms.world[command.baseInstance];
+    state.bounds = range.bounds;
+    state.firstIndex = command.firstIndex;
+    state.count = command.count;
+    return state;
+}
+
+inline bool sameShadowCasterState(const ShadowCasterState& a, const ShadowCasterState& b) {
+    return std::memcmp(a.world.m, b.world.m, sizeof(a.world.m)) == 0
+        && std::memcmp(&a.bounds, &b.bounds, sizeof(MeshBounds)) == 0
+        && a.firstIndex == b.firstIndex && a.count == b.count;
+}
+
+// Compteurs par couche et par frame
+struct ShadowCacheStats {
+    size_t full = 0;     // couche entière redessinée
+    size_t partial = 0;  // zone sale seule
+    size_t skipped = 0;  // couche à jour
+    size_t shifted = 0;  // couche glissée avec la caméra (bandes découvertes seules)
+    size_t texels = 0;   // texels redessinés
+};
+
+struct ShadowCache {
+    bool enabled = true; // false : toutes les couches redessinées à chaque frame
+    int resolution = 0;
+    size_t layerCount = 0;
+    std::vector<glm::mat4> layerViewProj;
+    std::vector<uint8_t> layerValid;  // couche remplie avec layerViewProj
+    std::vector<ShadowRect> dirty;    // part * layerCount + couche
+    std::vector<ShadowShift> shifts;  // glissements de la frame, à appliquer aux textures
+    std::vector<ShadowCasterState> casters;
+    std::vector<ShadowRect> rects;    // commande * layerCount + couche
+    ShadowCacheStats stats;
+
+    void init(int layerResolution, size_t layers, const std::vector<DrawElementsIndirectCommand>& commands,
+              const std::vector<MeshRange>& ranges, const TransformHierarchy& transforms, GLsizei count) {
+        resolution = layerResolution;
+        layerCount = layers;
+        layerViewProj.assign(layers, glm::mat4(1.0f));
+        layerValid.assign(layers, 0);
+        dirty.assign(layers * SHADOW_CACHE_PARTS, ShadowRect());
+        shifts.assign(layers, ShadowShift());
+        casters.resize(count);
+        for (GLsizei i = 0; i < count; ++i) casters[i] = shadowCasterState(commands[i], ranges[i], transforms);
+        rects.assign((size_t)count * layers, ShadowRect());
+    }
+
+    // Toutes les couches sont à refaire (programme rechargé, niveaux de détail...)
+    void invalidate() { std::fill(layerValid.begin(), layerValid.end(), 0); }
+
+    // Géométrie de la commande réécrite sans que son état change (édition en place)
+    void invalidateCommand(size_t i) {
+        for (size_t l = 0; l < layerCount; ++l) markDirty(l, rects[i * layerCount + l]);
+    }
+
+    // Matrice de la couche pour la frame ; ses rectangles en dépendent. shift :
+    // la couche n'a fait que glisser (même lumière, même taille de texel), elle
+    // reste valide si le glissement est plus petit qu'elle
+    void setLight(size_t layer, const glm::mat4& viewProj, const ShadowShift* shift = nullptr) {
+        shifts[layer] = ShadowShift();
+        if (layerValid[layer] && std::memcmp(&viewProj, &layerViewProj[layer], sizeof(glm::mat4)) == 0) return;
+        layerViewProj[layer] = viewProj;
+        if (!layerValid[layer] || !enabled || !shift || std::abs(shift->dx) >= resolution
+            || std::abs(shift->dy) >= resolution) {
+            layerValid[layer] = 0;
+            return;
+        }
+        int dx = shift->dx, dy = shift->dy;
+        shifts[layer] = *shift;
+        // Zones sales en attente : mêmes texels, nouvelles coordonnées
+        for (size_t p = 0; p < SHADOW_CACHE_PARTS; ++p) {
+            ShadowRect& d = dirty[p * layerCount + layer];
+            if (d.empty()) continue;
+            d.x0 = std::max(d.x0 - dx, 0); d.x1 = std::min(d.x1 - dx, resolution);
+            d.y0 = std::max(d.y0 - dy, 0); d.y1 = std::min(d.y1 - dy, resolution);
+        }
+        // Bandes découvertes
+        ShadowRect strip;
+        if (dx) {
+            strip.x0 = dx > 0 ? resolution - dx : 0; strip.x1 = dx > 0 ? resolution : -dx;
+            strip.y0 = 0; strip.y1 = resolution;
+            markDirty(layer, strip);
+        }
+        if (dy) {
+            strip.x0 = 0; strip.x1 = resolution;
+            strip.y0 = dy > 0 ? resolution - dy : 0; strip.y1 = dy > 0 ? resolution : -dy;
+            markDirty(layer, strip);
+        }
+        for (size_t i = 0; i < casters.size(); ++i) rects[i * layerCount + layer] = casterRect(casters[i], viewProj);
+        ++stats.shifted;
+    }
+
+    // À appeler quand la hiérarchie, les boîtes ou les commandes ont changé :
+    // seules les commandes dont l'état diffère salissent les couches
+    void updateCasters(const std::vector<DrawElementsIndirectCommand>& commands,
+                       const std::vector<MeshRange>& ranges, const TransformHierarchy& transforms) {
+        for (size_t i = 0; i < casters.size(); ++i) {
+            ShadowCasterState state = shadowCasterState(commands[i], ranges[i], transforms);
+            ShadowCasterState& cached = casters[i];
+            if (sameShadowCasterState(state, cached)) continue;
+            cached = state;
+            for (size_t l = 0; l < layerCount; ++l) {
+                ShadowRect& rect = rects[i * layerCount + l];
+                markDirty(l, rect);
+                rect = casterRect(cached, layerViewProj[l]);
+                markDirty(l, rect);
+            }
+        }
+    }
+
+    // Zones à redessiner de chaque couche cette frame (part * layerCount +
+    // couche, vides si elle est à jour) ; false si aucune couche n'est à redessiner
+    bool begin(std::vector<ShadowRect>& regions) {
+        regions.assign(layerCount * SHADOW_CACHE_PARTS, ShadowRect());
+        bool any = false;
+        for (size_t l = 0; l < layerCount; ++l) {
+            if (!layerValid[l] || !enabled) {
+                for (size_t i = 0; i < casters.size(); ++i) rects[i * layerCount + l] = casterRect(casters[i], layerViewProj[l]);
+                regions[l].x1 = regions[l].y1 = resolution;
+                layerValid[l] = 1;
+                ++stats.full;
+            } else {
+                bool dirtyLayer = false;
+                for (size_t p = 0; p < SHADOW_CACHE_PARTS; ++p) {
+                    const ShadowRect& d = dirty[p * layerCount + l];
+                    if (d.empty()) continue;
+                    // Un texel de marge autour des rectangles (arrondis des coins projetés)
+                    ShadowRect& region = regions[p * layerCount + l];
+                    region.x0 = std::max(d.x0 - 1, 0);
+                    region.y0 = std::max(d.y0 - 1, 0);
+                    region.x1 = std::min(d.x1 + 1, resolution);
+                    region.y1 = std::min(d.y1 + 1, resolution);
+                    dirtyLayer = true;
+                }
+                if (!dirtyLayer) {
+                    ++stats.skipped;
+                    continue;
+                }
+                ++stats.partial;
+            }
+            for (size_t p = 0; p < SHADOW_CACHE_PARTS; ++p) {
+                dirty[p * layerCount + l] = ShadowRect();
+                stats.texels += regions[p * layerCount + l].area();
+            }
+            any = true;
+        }
+        return any;
+    }
+
+private:
+    // Ajoute r à la zone sale de la couche, dans le rectangle que r agrandit le
+    // moins (un rectangle vide coûte l'aire de r)
+    void markDirty(size_t layer, const ShadowRect& r) {
+        if (r.empty()) return;
+        size_t best = 0, bestGrowth = 0;
+        for (size_t p = 0; p < SHADOW_CACHE_PARTS; ++p) {
+            const ShadowRect& d = dirty[p * layerCount + layer];
+            ShadowRect merged = d;
+            merged.extend(r);
+            size_t growth = merged.area() - d.area();
+            if (p == 0 || growth < bestGrowth) {
+                best = p;
+                bestGrowth = growth;
+            }
+        }
+        dirty[best * layerCount + layer].extend(r);
+    }
+
+    // Coins de la boîte monde projetés dans la couche, arrondis vers l'extérieur
+    ShadowRect casterRect(const ShadowCasterState& c, const glm::mat4& viewProj) const {
+        if (c.count == 0) return ShadowRect();
+        const float* m = c.world.m;
+        float lo[2] = { 1e30f, 1e30f }, hi[2] = { -1e30f, -1e30f };
+        for (int corner = 0; corner < 8; ++corner) {
+            float p[3];
+            for (int k = 0; k < 3; ++k) p[k] = (corner >> k) & 1 ? c.bounds.max[k] : c.bounds.min[k];
+            glm::vec4 world(m[0] * p[0] + m[4] * p[1] + m[8] * p[2] + m[12],
+                            m[1] * p[0] + m[5] * p[1] + m[9] * p[2] + m[13],
+                            m[2] * p[0] + m[6] * p[1] + m[10] * p[2] + m[14], 1.0f);
+            glm::vec4 clip = viewProj * world;
+            float ndc[2] = { clip.x / clip.w, clip.y / clip.w };
+            for (int k = 0; k < 2; ++k) {
+                lo[k] = std::min(lo[k], ndc[k]);
+                hi[k] = std::max(hi[k], ndc[k]);
+            }
+        }
+        auto toTexel = [&](float ndc) { return std::min(std::max((ndc * 0.5f + 0.5f) * resolution, 0.0f), (float)resolution); };
+        ShadowRect r;
+        r.x0 = (int)std::floor(toTexel(lo[0]));
+        r.y0 = (int)std::floor(toTexel(lo[1]));
+        r.x1 = (int)std::ceil(toTexel(hi[0]));
+        r.y1 = (int)std::ceil(toTexel(hi[1]));
+        return r;
+    }
+};
+
+// --no-shadow-cache : shadow maps redessinées en entier à chaque frame (comparaison)
+inline bool parseShadowCache(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--no-shadow-cache") == 0) return false;
+    return true;
+}
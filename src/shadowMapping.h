@@ -1,48 +1,485 @@
 #ifndef SHADOW_MAP_H
 #define SHADOW_MAP_H
 
+// Shadow maps en cascades (CSM) pour le soleil : la tranche [near, far] de la
+// caméra est coupée en SHADOW_CASCADES morceaux (répartition entre logarithmique
+// et uniforme), chacun couvert par sa propre projection orthographique. Chaque
+// cascade englobe sa tranche par une sphère (même taille quelle que soit
+// l'orientation de la caméra) dont le centre est calé sur la grille des texels :
+// les ombres ne scintillent pas quand la caméra tourne ou avance.
+// Les cascades sont les couches d'une texture tableau, remplies en une passe :
+// shadow.geom duplique chaque triangle vers les couches (gl_Layer) qu'il touche.
+// Avec la réduction de profondeur, la tranche est resserrée sur les profondeurs
+// réellement visibles (pré-passe Hi-Z, lue quelques frames plus tard).
+// Filtrage EVSM (par défaut) : les zones redessinées sont converties en moments
+// exponentiels (exp(c+ z), exp(c+ z)², -exp(-c- z), exp(-c- z)²) et floutées par
+// shadowFilter.comp en deux passes séparables, puis les mipmaps sont refaites.
+// scene.frag lit une seule fois la texture de moments (filtrage trilinéaire et
+// anisotrope) au lieu des 16 lectures PCF tournées par un bruit sin() ;
+// lightBleedReduction coupe le bas de la borne de Chebyshev (fuites de lumière
+// derrière deux occulteurs superposés). Touche I : EVSM / PCF pour comparer.
+
+#include <cmath>
+#include <vector>
+#include <cstring>
+#include <algorithm>
 #include <geGL/geGL.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "shadowCache.h"
+
+const int SHADOW_CASCADES = 4;                  // invocations de shadow.geom
+const GLuint SHADOW_TEXTURE_UNIT = 42;          // sampler2DArray shadowMap de scene.frag, au-delà des materialTex[32]
+const GLuint SHADOW_DEPTH_RANGE_BINDING = 12;   // SSBO de depthReduce.comp
+const GLuint SHADOW_REDUCE_TEXTURE_UNIT = 41;   // profondeur lue par depthReduce.comp
+const GLuint SHADOW_REDUCE_GROUP_TEXELS = 64;   // 16x16 threads de 4x4 texels
+const GLuint SHADOW_FILTER_SOURCE_UNIT = 44;    // texelFetch de shadowFilter.comp
+const GLuint SHADOW_MOMENTS_TEXTURE_UNIT = 45;  // sampler2DArray shadowMoments de scene.frag
+const GLuint SHADOW_FILTER_IMAGE_UNIT = 0;      // image2DArray écrite par shadowFilter.comp
+const int SHADOW_FILTER_RADIUS = 3;             // RADIUS de shadowFilter.comp (7 taps binomiaux)
+const int SHADOW_FILTER_GROUP = 8;              // 8x8 threads (shadowFilter.comp, shadowMips.comp)
+// Les cascades glissent par pas de 2^SHADOW_SCROLL_LEVELS texels : les niveaux
+// 1 à SHADOW_SCROLL_LEVELS des moments glissent avec la couche sans être refaits
+const int SHADOW_SCROLL_LEVELS = 4;
+
+enum ShadowFilter : int { SHADOW_FILTER_PCF = 0, SHADOW_FILTER_EVSM = 1 }; // shadowFilter de scene.frag
+
+struct ShadowCascade {
+    glm::mat4 viewProj = glm::mat4(1.0f);
+    float splitFar = 0.0f;        // distance de vue où la cascade passe la main
+    float texelSize = 0.0f;       // côté d'un texel en mètres
+    float boxMin[2] = {}, boxMax[2] = {}; // rectangle couvert dans l'espace de la lumière
+    float radius = 0.0f;          // demi-côté du carré (0 : pas encore calée)
+    bool translated = false;      // même lumière et même rayon qu'à la frame précédente : shift en texels
+    ShadowShift shift;
+};
 
 struct ShadowMapping {
     GLuint fbo;
-    GLuint depthTexture;
-    const unsigned int resolution = 2048; // Haute résolution pour des ombres nettes
+    GLuint depthTexture; // GL_TEXTURE_2D_ARRAY, une couche par cascade
+    // Par cascade : 4 x 1024² = autant de texels que l'ancienne carte unique 2048²
+    const unsigned int resolution = 1024;
+    float maxDistance = 25.0f;    // distance de vue couverte sans réduction de profondeur
+    float splitLambda = 0.8f;     // 1 : coupes logarithmiques, 0 : uniformes
+    glm::mat4 lightView = glm::mat4(1.0f);
+    float lightNear = 0.1f, lightFar = 20.0f;
+    // Lumière des cascades de la frame précédente : si elle change, pas de glissement
+    glm::mat4 fittedLightView = glm::mat4(0.0f);
+    float fittedNear = 0.0f, fittedFar = 0.0f;
+    ShadowCascade cascades[SHADOW_CASCADES];
+    // EVSM : moments RGBA32F mipmappés ; exposants positif et négatif (40 : limite
+    // du 32 bits), seuil de la borne de Chebyshev contre les fuites de lumière
+    ShadowFilter filter = SHADOW_FILTER_EVSM;
+    GLuint momentsTexture = 0;
+    GLuint blurTexture = 0;   // passe horizontale, une couche (cascades filtrées l'une après l'autre) ; niveaux : shiftLayers
+    GLsizei momentLevels = 1;
+    GLuint shiftTexture = 0;  // une couche de profondeur, intermédiaire de shiftLayers
+    float evsmExponents[2] = { 40.0f, 5.0f };
+    float lightBleedReduction = 0.25f;
+    // Locations relues quand un programme change (rechargement : nouvel id)
+    GLuint locatedPassProgram = 0, locatedFilterProgram = 0, locatedSceneProgram = 0;
+    GLint locPassMatrices, locPassMask;
+    GLint locFilterSource, locFilterExponents, locFromDepth, locDirection, locOrigin, locSize, locSourceLayer,
+          locTargetLayer;
+    GLuint locatedMipsProgram = 0;
+    GLint locMipsSource, locMipsLevel, locMipsLayer, locMipsOrigin, locMipsSize;
+    GLint locCascadeMatrices, locCascadeSplits, locCascadeBias, locShadowMap, locShadowMoments, locShadowFilter,
+          locEvsmExponents, locLightBleedReduction;
 
     void init() {
-        // 1. Créer le Framebuffer
-        glGenFramebuffers(1, &fbo);
-
-        // 2. Créer la texture de profondeur
-        glGenTextures(1, &depthTexture);
-        glBindTexture(GL_TEXTURE_2D, depthTexture);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, resolution, resolution, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-        
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &depthTexture);
+        glTextureStorage3D(depthTexture, 1, GL_DEPTH_COMPONENT32F, resolution, resolution, SHADOW_CASCADES);
         // Paramètres de texture critiques pour le Shadow Mapping
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER); 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+        glTextureParameteri(depthTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(depthTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(depthTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+        glTextureParameteri(depthTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
         float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-        glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
+        glTextureParameterfv(depthTexture, GL_TEXTURE_BORDER_COLOR, borderColor);
+
+        // Toutes les couches attachées : gl_Layer choisit la cascade
+        glCreateFramebuffers(1, &fbo);
+        glNamedFramebufferTexture(fbo, GL_DEPTH_ATTACHMENT, depthTexture, 0);
+        glNamedFramebufferDrawBuffer(fbo, GL_NONE); // On ne dessine pas de couleurs
+        glNamedFramebufferReadBuffer(fbo, GL_NONE);
+
+        GLsizei levels = 1;
+        while ((resolution >> levels) > 0) ++levels;
+        momentLevels = levels;
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &momentsTexture);
+        glTextureStorage3D(momentsTexture, levels, GL_RGBA32F, resolution, resolution, SHADOW_CASCADES);
+        glTextureParameteri(momentsTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(momentsTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(momentsTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(momentsTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureParameterf(momentsTexture, GL_TEXTURE_MAX_ANISOTROPY, 8.0f);
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &blurTexture);
+        glTextureStorage3D(blurTexture, SHADOW_SCROLL_LEVELS + 1, GL_RGBA32F, resolution, resolution, 1);
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &shiftTexture);
+        glTextureStorage3D(shiftTexture, 1, GL_DEPTH_COMPONENT32F, resolution, resolution, 1);
+    }
+
+    // Direction du soleil et boîte de la scène : la profondeur des cascades couvre
+    // toute la scène pour que les murs entre le soleil et la caméra portent ombre
+    void setLight(glm::vec3 sunDir, glm::vec3 sceneMin, glm::vec3 sceneMax) {
+        glm::vec3 up = std::abs(sunDir.y) > 0.99f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        lightView = glm::lookAt(-sunDir, glm::vec3(0.0f), up);
+        float zMin = 1e30f, zMax = -1e30f;
+        for (int corner = 0; corner < 8; ++corner) {
+            glm::vec3 p((corner & 1) ? sceneMax.x : sceneMin.x, (corner & 2) ? sceneMax.y : sceneMin.y,
+                        (corner & 4) ? sceneMax.z : sceneMin.z);
+            float z = (lightView * glm::vec4(p, 1.0f)).z;
+            zMin = std::min(zMin, z);
+            zMax = std::max(zMax, z);
+        }
+        // La lumière regarde vers -z
+        lightNear = -zMax - 0.5f;
+        lightFar = -zMin + 0.5f;
+    }
+
+    // Cascades de la frame pour la tranche [nearDistance, farDistance] de la caméra
+    void fitCascades(const glm::mat4& cameraView, const glm::mat4& cameraProj, float nearDistance, float farDistance) {
+        bool sameLight = std::memcmp(&lightView, &fittedLightView, sizeof(glm::mat4)) == 0
+                      && lightNear == fittedNear && lightFar == fittedFar;
+        fittedLightView = lightView;
+        fittedNear = lightNear;
+        fittedFar = lightFar;
+        float tanX = 1.0f / cameraProj[0][0], tanY = 1.0f / cameraProj[1][1];
+        glm::mat4 cameraToLight = lightView * glm::inverse(cameraView);
+        float splitNear = nearDistance;
+        for (int c = 0; c < SHADOW_CASCADES; ++c) {
+            float t = float(c + 1) / SHADOW_CASCADES;
+            float logSplit = nearDistance * std::pow(farDistance / nearDistance, t);
+            float uniformSplit = nearDistance + (farDistance - nearDistance) * t;
+            float splitFar = splitLambda * logSplit + (1.0f - splitLambda) * uniformSplit;
+
+            // Coins de la tranche dans l'espace de la lumière, sphère englobante
+            glm::vec3 corners[8];
+            glm::vec3 center(0.0f);
+            for (int k = 0; k < 8; ++k) {
+                float d = k < 4 ? splitNear : splitFar;
+                glm::vec4 p(((k & 1) ? d : -d) * tanX, ((k & 2) ? d : -d) * tanY, -d, 1.0f);
+                corners[k] = glm::vec3(cameraToLight * p);
+                center += corners[k] / 8.0f;
+            }
+            float radius = 0.0f;
+            for (int k = 0; k < 8; ++k) radius = std::max(radius, glm::length(corners[k] - center));
+            radius = std::ceil(radius * 16.0f) / 16.0f; // pas d'oscillation due aux arrondis
+            // Rayon gardé tant que la tranche y tient sans trop de perte (la
+            // réduction de profondeur la fait varier) : taille des texels inchangée,
+            // la cascade ne fait que glisser avec la caméra
+            ShadowCascade& cascade = cascades[c];
+            float previousRadius = cascade.radius;
+            if (radius <= previousRadius && radius >= 0.75f * previousRadius) radius = previousRadius;
+
+            // Centre arrondi à la grille des pas de glissement (2^SHADOW_SCROLL_LEVELS
+            // texels) : d'une frame à l'autre la cascade glisse d'un nombre entier
+            // de pas. Le carré a un demi-pas de marge autour de la sphère.
+            const int step = 1 << SHADOW_SCROLL_LEVELS;
+            float previousMin[2] = { cascade.boxMin[0], cascade.boxMin[1] };
+            cascade.radius = radius;
+            cascade.texelSize = 2.0f * radius / float(resolution - step);
+            float half = 0.5f * resolution * cascade.texelSize;
+            float grid = step * cascade.texelSize;
+            float cx = std::round(center.x / grid) * grid;
+            float cy = std::round(center.y / grid) * grid;
+            cascade.boxMin[0] = cx - half; cascade.boxMax[0] = cx + half;
+            cascade.boxMin[1] = cy - half; cascade.boxMax[1] = cy + half;
+            cascade.translated = sameLight && radius == previousRadius;
+            cascade.shift.dx = (int)std::lround((cascade.boxMin[0] - previousMin[0]) / cascade.texelSize);
+            cascade.shift.dy = (int)std::lround((cascade.boxMin[1] - previousMin[1]) / cascade.texelSize);
+            cascade.viewProj = glm::ortho(cascade.boxMin[0], cascade.boxMax[0], cascade.boxMin[1], cascade.boxMax[1],
+                                          lightNear, lightFar) * lightView;
+            cascade.splitFar = splitFar;
+            splitNear = splitFar;
+        }
+    }
+
+    // Texels gardés des cascades glissées (ShadowCache::shifts), avant beginPass :
+    // la couche voit en (x, y) ce qu'elle avait en (x + dx, y + dy). Copie par une
+    // texture intermédiaire, source et destination se recouvrant ; les moments
+    // EVSM et leurs niveaux 1 à SHADOW_SCROLL_LEVELS (glissement multiple de
+    // 2^SHADOW_SCROLL_LEVELS) passent par blurTexture, filterMoments refait le reste.
+    void shiftLayers(const std::vector<ShadowShift>& shifts) {
+        for (int c = 0; c < SHADOW_CASCADES; ++c) {
+            const ShadowShift& s = shifts[c];
+            if (!s.any()) continue;
+            int x0 = std::max(-s.dx, 0), y0 = std::max(-s.dy, 0);
+            int width = (int)resolution - std::abs(s.dx), height = (int)resolution - std::abs(s.dy);
+            glCopyImageSubData(depthTexture, GL_TEXTURE_2D_ARRAY, 0, x0 + s.dx, y0 + s.dy, c,
+                               shiftTexture, GL_TEXTURE_2D_ARRAY, 0, x0, y0, 0, width, height, 1);
+            glCopyImageSubData(shiftTexture, GL_TEXTURE_2D_ARRAY, 0, x0, y0, 0,
+                               depthTexture, GL_TEXTURE_2D_ARRAY, 0, x0, y0, c, width, height, 1);
+            if (filter != SHADOW_FILTER_EVSM) continue;
+            for (int level = 0; level <= SHADOW_SCROLL_LEVELS && level < momentLevels; ++level) {
+                int lx = x0 >> level, ly = y0 >> level, dx = s.dx >> level, dy = s.dy >> level;
+                int w = width >> level, h = height >> level;
+                glCopyImageSubData(momentsTexture, GL_TEXTURE_2D_ARRAY, level, lx + dx, ly + dy, c,
+                                   blurTexture, GL_TEXTURE_2D_ARRAY, level, lx, ly, 0, w, h, 1);
+                glCopyImageSubData(blurTexture, GL_TEXTURE_2D_ARRAY, level, lx, ly, 0,
+                                   momentsTexture, GL_TEXTURE_2D_ARRAY, level, lx, ly, c, w, h, 1);
+            }
+        }
+    }
+
+    // Matrice pour le culling de la lumière : union des zones à redessiner
+    // (part * SHADOW_CASCADES + cascade, ShadowCache::begin)
+    glm::mat4 cullMatrix(const std::vector<ShadowRect>& regions) const {
+        float lo[2] = { 1e30f, 1e30f }, hi[2] = { -1e30f, -1e30f };
+        for (size_t k = 0; k < regions.size(); ++k) {
+            const ShadowRect& r = regions[k];
+            if (r.empty()) continue;
+            const ShadowCascade& cascade = cascades[k % SHADOW_CASCADES];
+            float size = cascade.boxMax[0] - cascade.boxMin[0];
+            lo[0] = std::min(lo[0], cascade.boxMin[0] + size * r.x0 / resolution);
+            lo[1] = std::min(lo[1], cascade.boxMin[1] + size * r.y0 / resolution);
+            hi[0] = std::max(hi[0], cascade.boxMin[0] + size * r.x1 / resolution);
+            hi[1] = std::max(hi[1], cascade.boxMin[1] + size * r.y1 / resolution);
+        }
+        if (lo[0] > hi[0]) return cascades[SHADOW_CASCADES - 1].viewProj;
+        return glm::ortho(lo[0], hi[0], lo[1], hi[1], lightNear, lightFar) * lightView;
+    }
 
-        // 3. Attacher la texture au Framebuffer
+    // Passe d'ombre : zones à redessiner effacées, une fenêtre et un scissor par
+    // zone (gl_ViewportIndex = invocation de shadow.geom, gl_Layer = cascade),
+    // zones vides sautées
+    void beginPass(GLuint program, const std::vector<ShadowRect>& regions) {
         glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthTexture, 0);
-        glDrawBuffer(GL_NONE); // On ne dessine pas de couleurs
-        glReadBuffer(GL_NONE);
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glEnable(GL_DEPTH_TEST);
+        glDepthMask(GL_TRUE);
+        glEnable(GL_DEPTH_CLAMP); // objets devant le plan proche : écrasés sur lui, ils portent toujours ombre
+        glDisable(GL_CULL_FACE);
+        GLint mask = 0;
+        const float one = 1.0f;
+        for (GLuint k = 0; k < (GLuint)regions.size(); ++k) {
+            const ShadowRect& r = regions[k];
+            glViewportIndexedf(k, 0.0f, 0.0f, (float)resolution, (float)resolution);
+            glScissorIndexed(k, r.x0, r.y0, r.x1 - r.x0, r.y1 - r.y0);
+            if (r.empty()) continue;
+            mask |= 1 << k;
+            glClearTexSubImage(depthTexture, 0, r.x0, r.y0, k % SHADOW_CASCADES, r.x1 - r.x0, r.y1 - r.y0, 1,
+                               GL_DEPTH_COMPONENT, GL_FLOAT, &one);
+        }
+        glEnable(GL_SCISSOR_TEST);
+        if (program != locatedPassProgram) {
+            locatedPassProgram = program;
+            locPassMatrices = glGetUniformLocation(program, "cascadeMatrices");
+            locPassMask = glGetUniformLocation(program, "cascadeMask");
+        }
+        glUseProgram(program);
+        glm::mat4 matrices[SHADOW_CASCADES];
+        for (int c = 0; c < SHADOW_CASCADES; ++c) matrices[c] = cascades[c].viewProj;
+        glUniformMatrix4fv(locPassMatrices, SHADOW_CASCADES, GL_FALSE, glm::value_ptr(matrices[0]));
+        glUniform1i(locPassMask, mask);
     }
 
-    glm::mat4 getLightSpaceMatrix(glm::vec3 sunPos, glm::vec3 sunDir) {
-        // On définit une zone de 10x10 mètres autour du centre de la pièce
-        float size = 10.0f;
-        glm::mat4 lightProjection = glm::ortho(-size, size, -size, size, 0.1f, 20.0f);
-        // Le soleil regarde vers la pièce
-        glm::mat4 lightView = glm::lookAt(sunPos, sunPos + sunDir, glm::vec3(0.0f, 1.0f, 0.0f));
-        return lightProjection * lightView;
+    void endPass() {
+        glDisable(GL_SCISSOR_TEST);
+        glDisable(GL_DEPTH_CLAMP);
+    }
+
+    // Moments EVSM des zones redessinées (après endPass) : flou horizontal depuis
+    // la profondeur, puis vertical vers momentsTexture, puis mipmaps. Une zone est
+    // élargie du rayon du flou (moments touchés) ; la passe horizontale couvre en
+    // plus les lignes que lit la verticale. Les mipmaps (mipsProgram) ne sont
+    // refaits que sur les zones touchées jusqu'au niveau SHADOW_SCROLL_LEVELS,
+    // puis sur toute la couche (32² texels et moins).
+    void filterMoments(GLuint program, GLuint mipsProgram, const std::vector<ShadowRect>& regions) {
+        if (filter != SHADOW_FILTER_EVSM) return;
+        if (program != locatedFilterProgram) {
+            locatedFilterProgram = program;
+            locFilterSource = glGetUniformLocation(program, "source");
+            locFilterExponents = glGetUniformLocation(program, "exponents");
+            locFromDepth = glGetUniformLocation(program, "fromDepth");
+            locDirection = glGetUniformLocation(program, "direction");
+            locOrigin = glGetUniformLocation(program, "origin");
+            locSize = glGetUniformLocation(program, "size");
+            locSourceLayer = glGetUniformLocation(program, "sourceLayer");
+            locTargetLayer = glGetUniformLocation(program, "targetLayer");
+        }
+        glUseProgram(program);
+        glUniform1i(locFilterSource, (GLint)SHADOW_FILTER_SOURCE_UNIT);
+        glUniform2fv(locFilterExponents, 1, evsmExponents);
+        const int r = SHADOW_FILTER_RADIUS;
+        for (size_t k = 0; k < regions.size(); ++k) {
+            const ShadowRect& region = regions[k];
+            if (region.empty()) continue;
+            int c = int(k % SHADOW_CASCADES);
+            for (int pass = 0; pass < 2; ++pass) {
+                bool horizontal = pass == 0;
+                glBindTextureUnit(SHADOW_FILTER_SOURCE_UNIT, horizontal ? depthTexture : blurTexture);
+                glBindImageTexture(SHADOW_FILTER_IMAGE_UNIT, horizontal ? blurTexture : momentsTexture, 0, GL_TRUE, 0,
+                                   GL_WRITE_ONLY, GL_RGBA32F);
+                glUniform1i(locFromDepth, horizontal ? 1 : 0);
+                glUniform2i(locDirection, horizontal ? 1 : 0, horizontal ? 0 : 1);
+                glUniform1i(locSourceLayer, horizontal ? c : 0);
+                glUniform1i(locTargetLayer, horizontal ? 0 : c);
+                int grow = horizontal ? 2 * r : r;
+                int x0 = std::max(region.x0 - r, 0), x1 = std::min(region.x1 + r, (int)resolution);
+                int y0 = std::max(region.y0 - grow, 0), y1 = std::min(region.y1 + grow, (int)resolution);
+                glUniform2i(locOrigin, x0, y0);
+                glUniform2i(locSize, x1 - x0, y1 - y0);
+                glDispatchCompute((x1 - x0 + SHADOW_FILTER_GROUP - 1) / SHADOW_FILTER_GROUP,
+                                  (y1 - y0 + SHADOW_FILTER_GROUP - 1) / SHADOW_FILTER_GROUP, 1);
+                glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+            }
+        }
+
+        // Moments touchés par zone, puis leur empreinte niveau par niveau
+        std::vector<ShadowRect> touched(regions.size());
+        for (size_t k = 0; k < regions.size(); ++k) {
+            if (regions[k].empty()) continue;
+            touched[k].x0 = std::max(regions[k].x0 - r, 0); touched[k].x1 = std::min(regions[k].x1 + r, (int)resolution);
+            touched[k].y0 = std::max(regions[k].y0 - r, 0); touched[k].y1 = std::min(regions[k].y1 + r, (int)resolution);
+        }
+        if (mipsProgram != locatedMipsProgram) {
+            locatedMipsProgram = mipsProgram;
+            locMipsSource = glGetUniformLocation(mipsProgram, "source");
+            locMipsLevel = glGetUniformLocation(mipsProgram, "level");
+            locMipsLayer = glGetUniformLocation(mipsProgram, "layer");
+            locMipsOrigin = glGetUniformLocation(mipsProgram, "origin");
+            locMipsSize = glGetUniformLocation(mipsProgram, "size");
+        }
+        glUseProgram(mipsProgram);
+        glUniform1i(locMipsSource, (GLint)SHADOW_FILTER_SOURCE_UNIT);
+        glBindTextureUnit(SHADOW_FILTER_SOURCE_UNIT, momentsTexture);
+        for (int level = 1; level < momentLevels; ++level) {
+            glBindImageTexture(SHADOW_FILTER_IMAGE_UNIT, momentsTexture, level, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA32F);
+            glUniform1i(locMipsLevel, level);
+            int size = std::max((int)resolution >> level, 1);
+            for (size_t k = 0; k < touched.size(); ++k) {
+                ShadowRect& t = touched[k];
+                if (t.empty()) continue;
+                if (level > SHADOW_SCROLL_LEVELS) {
+                    // Une seule fois par couche, sur tout le niveau
+                    if (k >= (size_t)SHADOW_CASCADES && !touched[k % SHADOW_CASCADES].empty()) continue;
+                    t.x0 = t.y0 = 0;
+                    t.x1 = t.y1 = size;
+                } else {
+                    t.x0 >>= 1; t.y0 >>= 1;
+                    t.x1 = std::min((t.x1 + 1) >> 1, size); t.y1 = std::min((t.y1 + 1) >> 1, size);
+                }
+                glUniform1i(locMipsLayer, int(k % SHADOW_CASCADES));
+                glUniform2i(locMipsOrigin, t.x0, t.y0);
+                glUniform2i(locMipsSize, t.x1 - t.x0, t.y1 - t.y0);
+                glDispatchCompute((t.x1 - t.x0 + SHADOW_FILTER_GROUP - 1) / SHADOW_FILTER_GROUP,
+                                  (t.y1 - t.y0 + SHADOW_FILTER_GROUP - 1) / SHADOW_FILTER_GROUP, 1);
+            }
+            glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+        }
+    }
+
+    // Uniforms de scene.frag : matrices, fins des cascades et biais en profondeur
+    // (quelques texels de la cascade, ramenés à l'intervalle [lightNear, lightFar])
+    void applyUniforms(GLuint program) {
+        if (program != locatedSceneProgram) {
+            locatedSceneProgram = program;
+            locCascadeMatrices = glGetUniformLocation(program, "cascadeMatrices");
+            locCascadeSplits = glGetUniformLocation(program, "cascadeSplits");
+            locCascadeBias = glGetUniformLocation(program, "cascadeBias");
+            locShadowMap = glGetUniformLocation(program, "shadowMap");
+            locShadowMoments = glGetUniformLocation(program, "shadowMoments");
+            locShadowFilter = glGetUniformLocation(program, "shadowFilter");
+            locEvsmExponents = glGetUniformLocation(program, "evsmExponents");
+            locLightBleedReduction = glGetUniformLocation(program, "lightBleedReduction");
+        }
+        glm::mat4 matrices[SHADOW_CASCADES];
+        float splits[SHADOW_CASCADES], bias[SHADOW_CASCADES];
+        for (int c = 0; c < SHADOW_CASCADES; ++c) {
+            matrices[c] = cascades[c].viewProj;
+            splits[c] = cascades[c].splitFar;
+            bias[c] = 8.0f * cascades[c].texelSize / (lightFar - lightNear);
+        }
+        glProgramUniformMatrix4fv(program, locCascadeMatrices, SHADOW_CASCADES, GL_FALSE, glm::value_ptr(matrices[0]));
+        glProgramUniform1fv(program, locCascadeSplits, SHADOW_CASCADES, splits);
+        glProgramUniform1fv(program, locCascadeBias, SHADOW_CASCADES, bias);
+        glBindTextureUnit(SHADOW_TEXTURE_UNIT, depthTexture);
+        glProgramUniform1i(program, locShadowMap, (GLint)SHADOW_TEXTURE_UNIT);
+        glBindTextureUnit(SHADOW_MOMENTS_TEXTURE_UNIT, momentsTexture);
+        glProgramUniform1i(program, locShadowMoments, (GLint)SHADOW_MOMENTS_TEXTURE_UNIT);
+        glProgramUniform1i(program, locShadowFilter, (GLint)filter);
+        glProgramUniform2fv(program, locEvsmExponents, 1, evsmExponents);
+        glProgramUniform1f(program, locLightBleedReduction, lightBleedReduction);
+    }
+};
+
+// Réduction de profondeur (shaders/depthReduce.comp) : profondeurs minimale et
+// maximale de la pré-passe des occulteurs (hiZ.h), lues sans bloquer LATENCY
+// frames plus tard (fences). Les pièces sont des occulteurs : le maximum est le
+// mur visible le plus lointain, la tranche des cascades s'arrête là.
+struct ShadowDepthReduction {
+    static const int LATENCY = 3;
+
+    GLuint buffers[LATENCY] = {};
+    GLsync fences[LATENCY] = {};
+    int frame = 0;
+    bool valid = false;
+    float minDepth = 0.0f, maxDepth = 1.0f; // dernière réduction lue (profondeurs fenêtre)
+    GLuint locatedProgram = 0; // location de depthReduce.comp, relue quand le programme change
+    GLint locDepth;
+
+    void init() {
+        glCreateBuffers(LATENCY, buffers);
+        for (GLuint b : buffers) glNamedBufferStorage(b, 2 * sizeof(GLuint), nullptr, GL_DYNAMIC_STORAGE_BIT);
+    }
+
+    void reduce(GLuint program, GLuint depthTexture, int width, int height) {
+        collect();
+        if (fences[frame]) return; // résultat pas encore lu : frame sautée
+        const GLuint reset[2] = { 0xFFFFFFFFu, 0u };
+        glNamedBufferSubData(buffers[frame], 0, sizeof(reset), reset);
+        if (program != locatedProgram) {
+            locatedProgram = program;
+            locDepth = glGetUniformLocation(program, "depth");
+        }
+        glUseProgram(program);
+        glBindTextureUnit(SHADOW_REDUCE_TEXTURE_UNIT, depthTexture);
+        glUniform1i(locDepth, (GLint)SHADOW_REDUCE_TEXTURE_UNIT);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SHADOW_DEPTH_RANGE_BINDING, buffers[frame]);
+        glDispatchCompute((width + SHADOW_REDUCE_GROUP_TEXELS - 1) / SHADOW_REDUCE_GROUP_TEXELS,
+                          (height + SHADOW_REDUCE_GROUP_TEXELS - 1) / SHADOW_REDUCE_GROUP_TEXELS, 1);
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+        fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        frame = (frame + 1) % LATENCY;
+    }
+
+    // Résultats terminés, du plus ancien au plus récent
+    void collect() {
+        for (int k = 0; k < LATENCY; ++k) {
+            int slot = (frame + k) % LATENCY;
+            if (!fences[slot]) continue;
+            GLenum status = glClientWaitSync(fences[slot], 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) continue;
+            glDeleteSync(fences[slot]);
+            fences[slot] = 0;
+            GLuint range[2];
+            glGetNamedBufferSubData(buffers[slot], 0, sizeof(range), range);
+            if (range[0] > range[1]) continue; // rien de dessiné
+            std::memcpy(&minDepth, &range[0], sizeof(float));
+            std::memcpy(&maxDepth, &range[1], sizeof(float));
+            valid = true;
+        }
+    }
+
+    // Tranche de vue resserrée, arrondie (cascades stables d'une frame à l'autre).
+    // Le proche reste borné : les petits objets ne sont pas dans la pré-passe.
+    void viewRange(const glm::mat4& cameraProj, float maxDistance, float& nearDistance, float& farDistance) const {
+        float n = cameraProj[3][2] / (cameraProj[2][2] - 1.0f);
+        float f = cameraProj[3][2] / (cameraProj[2][2] + 1.0f);
+        auto distance = [&](float depth) { return 2.0f * n * f / ((f + n) - (2.0f * depth - 1.0f) * (f - n)); };
+        nearDistance = std::min(std::max(std::floor(distance(minDepth) * 10.0f) / 10.0f, n), 1.0f);
+        farDistance = std::min(std::max(std::ceil(distance(maxDepth) + 0.5f), 2.0f), maxDistance);
     }
 };
 
-#endif
\ No newline at end of file
+// --shadow-depth-reduction : tranche des cascades resserrée dès le démarrage
+// (sinon touche F) ; sans elle, aucune fence interrogée ni buffer relu
+inline bool parseShadowDepthReduction(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--shadow-depth-reduction") == 0) return true;
+    return false;
+}
+
+#endif
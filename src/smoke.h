@@ -25,6 +25,9 @@ public:
     
     GLuint vao = 0;
     GLuint vbo = 0;
+    // Locations de smoke.vert, relues quand le programme change (rechargement)
+    GLuint locatedProgram = 0;
+    GLint locView, locProj, locCamPos, locPos, locSize, locLife, locRot;
     
     std::mt19937 rng;
     std::uniform_real_distribution<float> dist{0.8f, 1.2f};
@@ -156,13 +159,19 @@ public:
                 const glm::vec3& cameraPos) {
         if (particles.empty()) return;
         
+        if (smokeProgram != locatedProgram) {
+            locatedProgram = smokeProgram;
+            locView = glGetUniformLocation(smokeProgram, "viewMatrix");
+            locProj = glGetUniformLocation(smokeProgram, "projMatrix");
+            locCamPos = glGetUniformLocation(smokeProgram, "cameraPosition");
+            locPos = glGetUniformLocation(smokeProgram, "particlePos");
+            locSize = glGetUniformLocation(smokeProgram, "particleSize");
+            locLife = glGetUniformLocation(smokeProgram, "particleLife");
+            locRot = glGetUniformLocation(smokeProgram, "particleRotation");
+        }
         glUseProgram(smokeProgram);
         
         // Matrices
-        GLint locView = glGetUniformLocation(smokeProgram, "viewMatrix");
-        GLint locProj = glGetUniformLocation(smokeProgram, "projMatrix");
-        GLint locCamPos = glGetUniformLocation(smokeProgram, "cameraPosition");
-        
         if (locView >= 0) glUniformMatrix4fv(locView, 1, GL_FALSE, glm::value_ptr(view));
         if (locProj >= 0) glUniformMatrix4fv(locProj, 1, GL_FALSE, glm::value_ptr(proj));
         if (locCamPos >= 0) glUniform3fv(locCamPos, 1, glm::value_ptr(cameraPos));
@@ -171,11 +180,6 @@ public:
         
         // Rendu de chaque particule
         for (const auto& p : particles) {
-            GLint locPos = glGetUniformLocation(smokeProgram, "particlePos");
-            GLint locSize = glGetUniformLocation(smokeProgram, "particleSize");
-            GLint locLife = glGetUniformLocation(smokeProgram, "particleLife");
-            GLint locRot = glGetUniformLocation(smokeProgram, "particleRotation");
-            
             if (locPos >= 0) glUniform3fv(locPos, 1, glm::value_ptr(p.position));
             if (locSize >= 0) glUniform1f(locSize, p.size);
             if (locLife >= 0) glUniform1f(locLife, p.life);
@@ -186,92 +190,7 @@ public:
     }
 };
 
-// ============================================================================
-// SHADERS POUR LA FUMÉE
-// ============================================================================
-
-const char* smokeVertexShader = R"(
-#version 460
-
-layout(location = 0) in vec3 position; // Position du quad
-layout(location = 1) in vec2 uv;
-
-out vec2 vUV;
-out float vAlpha;
-
-uniform mat4 viewMatrix;
-uniform mat4 projMatrix;
-uniform vec3 cameraPosition;
-uniform vec3 particlePos;     // Position de la particule
-uniform float particleSize;   // Taille
-uniform float particleLife;   // Vie (1.0 = naissance, 0.0 = mort)
-uniform float particleRotation; // Rotation Z
-
-void main() {
-    vUV = uv;
-    
-    // Alpha fade : progressif et fluide
-    // Fade-in rapide au début, fade-out lent à la fin
-    float fadeIn = smoothstep(0.0, 0.1, particleLife);
-    float fadeOut = smoothstep(0.0, 0.3, particleLife);
-    // vAlpha = fadeIn * fadeOut * 0.25; // Max alpha = 0.25 (fumée visible mais subtile)
-    float lifeFade = particleLife * particleLife ;
-    vAlpha = lifeFade * 0.16;
-    
-    // Billboard : toujours face à la caméra
-    vec3 forward = normalize(cameraPosition - particlePos);
-    vec3 right = normalize(cross(vec3(0, 1, 0), forward));
-    vec3 up = cross(forward, right);
-    
-    // Rotation autour de l'axe forward (billboard rotation)
-    float c = cos(particleRotation);
-    float s = sin(particleRotation);
-    vec3 rotatedRight = right * c - up * s;
-    vec3 rotatedUp = right * s + up * c;
-    
-    // Position finale du vertex
-    vec3 worldPos = particlePos 
-                  + rotatedRight * position.x * particleSize
-                  + rotatedUp * position.y * particleSize;
-    
-    gl_Position = projMatrix * viewMatrix * vec4(worldPos, 1.0);
-}
-)";
-
-const char* smokeFragmentShader = R"(
-#version 460
-
-in vec2 vUV;
-in float vAlpha;
-out vec4 fColor;
-
-uniform sampler2D smokeTexture;
-
-void main() {
-        // Texture de fumée (utilise canal alpha de la texture)
-        vec4 texColor = texture(smokeTexture, vUV);
-        
-        // Fumée GRIS-BLEU vaporeuse (couleur froide)
-        // vec3 smokeColor = vec3(0.55, 0.6, 0.7); // Gris-bleu doux
-        vec3 smokeColor = vec3(0.7, 0.75, 0.8);
-        
-        // Variation subtile de couleur selon la vie
-        float t = vAlpha / 0.25; // Normaliser
-        smokeColor = mix(
-            vec3(0.7, 0.72, 0.75),  // Début: gris-blanc léger
-            vec3(0.45, 0.5, 0.6),   // Fin: gris-bleu plus foncé
-            1.0 - t
-        );
-        
-        // Alpha combiné : texture alpha * particle life alpha
-        float finalAlpha = texColor.a * vAlpha;
-        
-        // Discard pour optimisation (seuil très bas)
-        if (finalAlpha < 0.005) discard;
-        
-        fColor = vec4(smokeColor, finalAlpha);
-    }
-)";
+// Les shaders de la fumée sont dans shaders/smoke.vert et shaders/smoke.frag
 
 float clamp(float num, float low, float high) {
   if (num > high) return high;
@@ -0,0 +1,212 @@
+#pragma once
+// ============================================================================
+// Regroupement statique : objets immobiles cuits dans l'espace monde
+// ============================================================================
+// Les objets "static" de la scène (table, cheminée, cadre...) sont transformés
+// une fois dans l'espace monde puis fusionnés en un lot par pièce, une plage du
+// pool dessinée comme les pièces avec la transformation identité (DRAW_ROOM) :
+// une commande par pièce au lieu d'une par objet, dans toutes les passes. Les
+// textures sont choisies par sommet dans le tableau materialTex[] (scene.frag) :
+// un lot peut mêler les matériaux, ses triangles sont seulement triés par
+// matériau pour garder les accès texture groupés.
+// Le lot garde, pour chacun de ses objets, la liste des sommets du maillage
+// utilisés : quand la matrice monde d'un objet change (édition), ses sommets
+// sont recalculés et renvoyés sur leur seule sous-plage du VBO ; les indices ne
+// changent pas. Les indices du flux de profondeur ne partagent un sommet qu'à
+// l'intérieur d'une partie, recuite en entier. Niveau de détail complet seulement, sans meshlets : le culling
+// traite un lot comme un tout (boîte monde du lot).
+
+#include <map>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <glm/glm.hpp>
+
+#include "meshPool.h"
+#include "transformHierarchy.h" // Matrix4, computeDrawTransforms (drawTransforms.h)
+
+// Sommets d'un objet dans un lot
+struct StaticBatchPart {
+    uint32_t node;         // nœud de transformation de l'objet
+    uint32_t firstVertex;  // dans SceneData::vertices (début du maillage)
+    uint32_t batchVertex;  // premier sommet de la partie dans le lot
+    std::vector<uint32_t> sourceVertices; // sommets du maillage, dans l'ordre du lot
+    Matrix4 world;         // matrice avec laquelle les sommets ont été cuits
+};
+
+struct StaticBatch {
+    uint32_t group;        // pièce (ou nombre de pièces : hors de toute pièce)
+    uint32_t material = 0; // materialID du premier triangle (clé de tri de la liste de draws)
+    bool occluder = false;
+    uint32_t vertexCount = 0;
+    std::vector<StaticBatchPart> parts;
+    MeshRange range = {}; // plage dans le pool (baseVertex = premier sommet du lot)
+};
+
+// Sommet du maillage transformé : position par la matrice monde, normale par la
+// matrice des normales (calculée comme pour le SSBO des transformations)
+inline void transformStaticVertex(const float* in, const Matrix4& world, const DrawTransform& normal, float* out) {
+    const float* m = world.m;
+    const float* n = normal.normal;
+    std::memcpy(out, in, MESH_VERTEX_FLOATS * sizeof(float));
+    float normalLength2 = 0.0f;
+    for (int r = 0; r < 3; ++r) {
+        out[r] = m[r] * in[0] + m[4 + r] * in[1] + m[8 + r] * in[2] + m[12 + r];
+        out[3 + r] = n[r] * in[3] + n[4 + r] * in[4] + n[8 + r] * in[5];
+        normalLength2 += out[3 + r] * out[3 + r];
+    }
+    if (normalLength2 > 0.0f) {
+        float invLength = 1.0f / std::sqrt(normalLength2);
+        for (int r = 0; r < 3; ++r) out[3 + r] *= invLength;
+    }
+}
+
+struct StaticBatcher {
+    std::vector<StaticBatch> batches;
+    // Géométrie des lots avant l'envoi dans le pool (libérée par addToPool)
+    std::vector<std::vector<float>> batchVertices;
+    std::vector<std::vector<uint32_t>> batchIndices;
+    std::vector<std::vector<uint32_t>> batchDepthIndices; // flux de profondeur (MeshPool::depthIndices)
+    size_t objectCount = 0;
+
+    // Triangles du niveau 0 d'un objet (indices relatifs au premier sommet du
+    // maillage, et ceux du flux de profondeur), ajoutés au lot de group
+    void addObject(uint32_t group, bool occluder, uint32_t node, const Matrix4& world,
+                   const float* sceneVertices, uint32_t firstVertex, uint32_t vertexCount,
+                   const uint32_t* indices, const uint32_t* depthIndices, uint32_t indexCount) {
+        const float* meshVertices = sceneVertices + (size_t)firstVertex * MESH_VERTEX_FLOATS;
+        DrawTransform normal;
+        computeDrawTransforms(world.m, &normal, 1);
+        uint32_t b = findBatch(group);
+        StaticBatch& batch = batches[b];
+        batch.occluder |= occluder;
+        StaticBatchPart part;
+        part.node = node;
+        part.firstVertex = firstVertex;
+        part.batchVertex = batch.vertexCount;
+        part.world = world;
+        // Seuls les sommets utilisés par le niveau 0 (les niveaux grossiers n'en gardent qu'une partie)
+        std::vector<uint32_t> remap(vertexCount, UINT32_MAX); // sommet du maillage -> sommet de la partie
+        std::vector<float>& out = batchVertices[b];
+        for (uint32_t i = 0; i < indexCount; ++i) {
+            uint32_t v = indices[i];
+            if (remap[v] == UINT32_MAX) {
+                remap[v] = (uint32_t)part.sourceVertices.size();
+                part.sourceVertices.push_back(v);
+                out.resize(out.size() + MESH_VERTEX_FLOATS);
+                transformStaticVertex(meshVertices + (size_t)v * MESH_VERTEX_FLOATS, world, normal,
+                                      out.data() + out.size() - MESH_VERTEX_FLOATS);
+            }
+            batchIndices[b].push_back(part.batchVertex + remap[v]);
+        }
+        // Sommet partagé par position : toujours utilisé par le niveau 0 (indexVertexSoup)
+        for (uint32_t i = 0; i < indexCount; ++i) {
+            uint32_t shared = remap[depthIndices[i]] != UINT32_MAX ? remap[depthIndices[i]] : remap[indices[i]];
+            batchDepthIndices[b].push_back(part.batchVertex + shared);
+        }
+        batch.vertexCount += (uint32_t)part.sourceVertices.size();
+        batch.parts.push_back(std::move(part));
+        ++objectCount;
+    }
+
+    // Une plage du pool par lot (avant MeshPool::createGpu). Les triangles sont
+    // triés par matériau : les sommets d'un objet restent contigus (sous-plage
+    // recuite), seuls les indices changent d'ordre.
+    void addToPool(MeshPool& pool) {
+        for (size_t b = 0; b < batches.size(); ++b) {
+            const std::vector<float>& vertices = batchVertices[b];
+            std::vector<uint32_t>& indices = batchIndices[b];
+            auto material = [&](uint32_t triangle) {
+                return vertices[(size_t)indices[3 * triangle] * MESH_VERTEX_FLOATS + MESH_VERTEX_FLOATS - 1];
+            };
+            std::vector<uint32_t> order(indices.size() / 3);
+            for (uint32_t t = 0; t < (uint32_t)order.size(); ++t) order[t] = t;
+            std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t c) { return material(a) < material(c); });
+            const std::vector<uint32_t>& depthIndices = batchDepthIndices[b];
+            std::vector<uint32_t> sorted, sortedDepth;
+            sorted.reserve(indices.size());
+            sortedDepth.reserve(indices.size());
+            for (uint32_t t : order) {
+                sorted.insert(sorted.end(), indices.begin() + 3 * t, indices.begin() + 3 * t + 3);
+                sortedDepth.insert(sortedDepth.end(), depthIndices.begin() + 3 * t, depthIndices.begin() + 3 * t + 3);
+            }
+            batches[b].material = order.empty() ? 0 : (uint32_t)material(order[0]);
+            batches[b].range = pool.add(vertices.data(), batches[b].vertexCount, sorted.data(), sorted.size(),
+                                        nullptr, nullptr, 0, sortedDepth.data());
+        }
+        std::vector<std::vector<float>>().swap(batchVertices);
+        std::vector<std::vector<uint32_t>>().swap(batchIndices);
+        std::vector<std::vector<uint32_t>>().swap(batchDepthIndices);
+    }
+
+    // Recuit les lots dont un objet a bougé depuis la dernière cuisson : sommets
+    // renvoyés sur la sous-plage de la partie, boîte du lot recalculée.
+    // Renvoie le masque des lots modifiés (vide si aucun).
+    std::vector<uint8_t> update(const MeshPool& pool, const TransformHierarchy& transforms, const float* sceneVertices) {
+        std::vector<uint8_t> changed;
+        std::vector<float> vertices;
+        for (size_t b = 0; b < batches.size(); ++b) {
+            StaticBatch& batch = batches[b];
+            bool moved = false;
+            for (StaticBatchPart& p : batch.parts) {
+                const Matrix4& world = transforms.world[p.node];
+                if (std::memcmp(world.m, p.world.m, sizeof(world.m)) == 0) continue;
+                p.world = world;
+                DrawTransform normal;
+                computeDrawTransforms(world.m, &normal, 1);
+                vertices.resize(p.sourceVertices.size() * MESH_VERTEX_FLOATS);
+                const float* meshVertices = sceneVertices + (size_t)p.firstVertex * MESH_VERTEX_FLOATS;
+                for (size_t v = 0; v < p.sourceVertices.size(); ++v)
+                    transformStaticVertex(meshVertices + (size_t)p.sourceVertices[v] * MESH_VERTEX_FLOATS, world, normal,
+                                          vertices.data() + v * MESH_VERTEX_FLOATS);
+                pool.updateVertices(batch.range.baseVertex + p.batchVertex, p.sourceVertices.size(), vertices.data());
+                moved = true;
+            }
+            if (!moved) continue;
+            if (changed.empty()) changed.assign(batches.size(), 0);
+            changed[b] = 1;
+            updateBounds(batch, sceneVertices);
+        }
+        return changed;
+    }
+
+private:
+    uint32_t findBatch(uint32_t group) {
+        auto it = batchOfGroup.find(group);
+        if (it != batchOfGroup.end()) return it->second;
+        StaticBatch batch;
+        batch.group = group;
+        batches.push_back(std::move(batch));
+        batchVertices.emplace_back();
+        batchIndices.emplace_back();
+        batchDepthIndices.emplace_back();
+        return batchOfGroup[group] = (uint32_t)batches.size() - 1;
+    }
+
+    // Boîte monde du lot : sommets sources transformés par la matrice de leur objet
+    static void updateBounds(StaticBatch& batch, const float* sceneVertices) {
+        std::vector<float> corners;
+        for (const StaticBatchPart& p : batch.parts) {
+            const float* meshVertices = sceneVertices + (size_t)p.firstVertex * MESH_VERTEX_FLOATS;
+            const float* m = p.world.m;
+            for (uint32_t v : p.sourceVertices) {
+                const float* in = meshVertices + (size_t)v * MESH_VERTEX_FLOATS;
+                float out[MESH_VERTEX_FLOATS] = {};
+                for (int r = 0; r < 3; ++r) out[r] = m[r] * in[0] + m[4 + r] * in[1] + m[8 + r] * in[2] + m[12 + r];
+                corners.insert(corners.end(), out, out + MESH_VERTEX_FLOATS);
+            }
+        }
+        batch.range.bounds = computeMeshBounds(corners.data(), corners.size() / MESH_VERTEX_FLOATS);
+    }
+
+    std::map<uint32_t, uint32_t> batchOfGroup;
+};
+
+// --no-static-batching : objets "static" dessinés un par un comme les autres
+inline bool parseStaticBatching(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], "--no-static-batching") == 0) return false;
+    return true;
+}
@@ -0,0 +1,460 @@
+#pragma once
+// ============================================================================
+// Streaming des maillages et des textures par pièce, sous budget mémoire
+// ============================================================================
+// Les cellules du monde sont les pièces (SceneRoom). Chaque objet est rattaché
+// à la pièce la plus proche du centre de sa boîte ; une cellule demande les
+// maillages de ses objets et les textures de leurs matériaux (et de ses murs).
+// Quand la caméra s'approche d'une pièce (distance à sa boîte < loadRadius),
+// ses textures manquantes partent dans une file triée par distance : des
+// threads les décodent (stb_image) en mémoire centrale, la boucle de rendu ne
+// fait que les envoyer au GPU. Les maillages sont déjà en mémoire centrale
+// (SceneData::vertices / indices) : ils sont envoyés de là sans copie. Au plus
+// uploadBytesPerFrame par frame. Deux niveaux de cache : mémoire centrale
+// (ramBytes, images décodées seulement) et mémoire vidéo (arène du pool de
+// maillages, textures). Quand un budget est dépassé, les ressources les moins
+// prioritaires (non demandées, puis les plus éloignées) sont évincées.
+// Un maillage absent du pool est dessiné avec 0 indice (setMeshResidency), une
+// texture absente laisse la couleur kd du matériau (applySceneMaterials).
+
+#include <cfloat>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+#include <condition_variable>
+#include <glm/glm.hpp>
+
+#include "sceneFile.h" // SceneGpu, setMeshResidency ; stbi_load et createTexture2D viennent de objLoader.h (inclus par main.cpp)
+
+enum StreamResourceType : uint8_t { STREAM_MESH = 0, STREAM_TEXTURE = 1 };
+
+// StreamingManager::update : ce qui a changé pendant la frame
+const uint32_t STREAMING_MESHES_CHANGED = 1u;   // uploadSceneCommands, lods du culling, meshlets
+const uint32_t STREAMING_TEXTURES_CHANGED = 2u; // applySceneMaterials, bindSceneTextures
+
+struct StreamingBudget {
+    size_t meshBytes = 32u << 20;          // arène de maillages du pool (mémoire vidéo)
+    size_t textureBytes = 128u << 20;      // textures (mémoire vidéo, mipmaps comprises)
+    size_t ramBytes = 256u << 20;          // images décodées gardées en mémoire centrale
+    size_t uploadBytesPerFrame = 8u << 20; // envoi au GPU par frame
+    float loadRadius = 3.0f;               // distance caméra -> boîte d'une pièce (m)
+    uint32_t threads = 2;
+};
+
+// --streaming[=meshMB,textureMB,ramMB] ; sans l'option tout est chargé au démarrage
+inline bool parseStreamingBudget(int argc, char* argv[], StreamingBudget& budget) {
+    const char* flag = "--streaming";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], flag, std::strlen(flag)) != 0) continue;
+        const char* rest = argv[i] + std::strlen(flag);
+        if (*rest != '\0' && *rest != '=') continue;
+        size_t* sizes[] = { &budget.meshBytes, &budget.textureBytes, &budget.ramBytes };
+        for (size_t* size : sizes) {
+            if (*rest != '=' && *rest != ',') break;
+            char* end = nullptr;
+            unsigned long megabytes = std::strtoul(rest + 1, &end, 10);
+            if (end == rest + 1) break;
+            *size = (size_t)megabytes << 20;
+            rest = end;
+        }
+        return true;
+    }
+    return false;
+}
+
+struct StreamingStats {
+    uint64_t hits = 0;         // demandée alors qu'elle était déjà en mémoire vidéo
+    uint64_t ramHits = 0;      // demandée, envoyée depuis la mémoire centrale (maillages toujours)
+    uint64_t misses = 0;       // demandée, à charger
+    uint64_t uploads = 0;
+    uint64_t evictions = 0;    // mémoire vidéo
+    uint64_t ramEvictions = 0; // mémoire centrale
+    size_t pending = 0;        // en file ou en cours de chargement
+    size_t meshBytes = 0, textureBytes = 0, ramBytes = 0;
+    size_t residentMeshes = 0, residentTextures = 0;
+};
+
+struct StreamResource {
+    StreamResourceType type;
+    uint32_t mesh = 0;            // STREAM_MESH : indice dans SceneData::meshes
+    std::string path;             // STREAM_TEXTURE : image
+    std::vector<uint32_t> slots;  // STREAM_TEXTURE : slots de matériaux qui l'affichent
+    bool wanted = false;
+    bool pending = false;         // en file ou en cours de chargement
+    bool resident = false;        // en mémoire vidéo
+    bool failed = false;          // image illisible ou trop grande pour le budget : plus demandée
+    float distance = FLT_MAX;     // plus petite distance caméra -> cellule qui la demande
+    uint64_t lastWanted = 0;      // frame
+    std::vector<uint8_t> data;    // STREAM_TEXTURE, mémoire centrale : pixels décodés
+    int width = 0, height = 0, channels = 0;
+    size_t vramBytes = 0;
+    MeshAllocation allocation = {};
+    GLuint texture = 0;
+};
+
+struct StreamingManager {
+    StreamingBudget budget;
+    StreamingStats stats;
+    std::vector<StreamResource> resources;
+    std::vector<std::vector<uint32_t>> cellResources; // par pièce
+    std::vector<std::vector<uint32_t>> roomSlots;      // matériaux des murs de chaque pièce
+    std::vector<uint32_t> windowSlots;
+    std::vector<std::vector<uint32_t>> meshSlots;
+    int textureOfSlot[SCENE_MATERIAL_SLOTS];
+    uint64_t frame = 0;
+
+    ~StreamingManager() { stop(); }
+
+    // roomVertices / windowVertices : géométrie générée des pièces et des vitres
+    // (matériaux de leurs murs). Démarre les threads de chargement.
+    void init(const SceneData& scene, const std::vector<std::vector<float>>& roomVertices,
+              const std::vector<float>& windowVertices, const StreamingBudget& streamingBudget) {
+        budget = streamingBudget;
+        this->scene = &scene;
+        resources.clear();
+        for (uint32_t m = 0; m < (uint32_t)scene.meshes.size(); ++m) {
+            StreamResource r;
+            r.type = STREAM_MESH;
+            r.mesh = m;
+            r.failed = scene.meshes[m].vertexCount == 0;
+            resources.push_back(r);
+        }
+        std::fill(textureOfSlot, textureOfSlot + SCENE_MATERIAL_SLOTS, -1);
+        for (auto const& m : scene.materials) {
+            if (m.slot >= (uint32_t)SCENE_MATERIAL_SLOTS || !m.hasTexture) continue;
+            std::string path = resolveScenePath(scene.str(m.texturePath));
+            auto same = std::find_if(resources.begin(), resources.end(),
+                                     [&](const StreamResource& r) { return r.type == STREAM_TEXTURE && r.path == path; });
+            if (same == resources.end()) {
+                StreamResource r;
+                r.type = STREAM_TEXTURE;
+                r.path = path;
+                same = resources.insert(resources.end(), r);
+            }
+            same->slots.push_back(m.slot);
+            textureOfSlot[m.slot] = (int)(same - resources.begin());
+        }
+
+        // Matériaux utilisés (materialID des sommets = slot)
+        auto slotsOf = [](const float* vertices, size_t vertexCount) {
+            std::vector<uint32_t> slots;
+            for (size_t v = 0; v < vertexCount; ++v) {
+                uint32_t slot = (uint32_t)vertices[v * MESH_VERTEX_FLOATS + MESH_VERTEX_FLOATS - 1];
+                if (std::find(slots.begin(), slots.end(), slot) == slots.end()) slots.push_back(slot);
+            }
+            return slots;
+        };
+        meshSlots.clear();
+        for (auto const& mesh : scene.meshes)
+            meshSlots.push_back(slotsOf(scene.vertices.data() + (size_t)mesh.firstVertex * MESH_VERTEX_FLOATS, mesh.vertexCount));
+        roomSlots.clear();
+        for (auto const& v : roomVertices) roomSlots.push_back(slotsOf(v.data(), v.size() / MESH_VERTEX_FLOATS));
+        windowSlots = slotsOf(windowVertices.data(), windowVertices.size() / MESH_VERTEX_FLOATS);
+        cellResources.assign(scene.rooms.size(), {});
+
+        stopping = false;
+        for (uint32_t t = 0; t < std::max(1u, budget.threads); ++t) workers.emplace_back([this] { workerLoop(); });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& w : workers) w.join();
+        workers.clear();
+    }
+
+    // Rattache les objets aux pièces (matrices monde à jour) : à rappeler quand la hiérarchie change
+    void assignCells(const SceneGpu& gpu) {
+        cellResources.assign(scene->rooms.size(), {});
+        if (cellResources.empty()) return;
+        std::vector<std::vector<uint8_t>> listed(cellResources.size(), std::vector<uint8_t>(resources.size(), 0));
+        auto add = [&](uint32_t cell, uint32_t resource) {
+            if (listed[cell][resource]) return;
+            listed[cell][resource] = 1;
+            cellResources[cell].push_back(resource);
+        };
+        auto addTextures = [&](uint32_t cell, const std::vector<uint32_t>& slots) {
+            for (uint32_t slot : slots)
+                if (slot < (uint32_t)SCENE_MATERIAL_SLOTS && textureOfSlot[slot] >= 0) add(cell, (uint32_t)textureOfSlot[slot]);
+        };
+        for (uint32_t cell = 0; cell < (uint32_t)cellResources.size(); ++cell) {
+            if (cell < roomSlots.size()) addTextures(cell, roomSlots[cell]);
+            addTextures(cell, windowSlots);
+        }
+        for (size_t i = 0; i < scene->objects.size(); ++i) {
+            uint32_t mesh = scene->objects[i].mesh;
+            if (mesh == SCENE_NO_MESH) continue;
+            const MeshBounds& b = scene->meshes[mesh].bounds;
+            const float* m = gpu.transforms.world[1 + i].m;
+            glm::vec3 c(0.0f);
+            for (int k = 0; k < 3; ++k)
+                c[k] = m[k] * b.center[0] + m[4 + k] * b.center[1] + m[8 + k] * b.center[2] + m[12 + k];
+            uint32_t cell = 0;
+            float nearest = FLT_MAX;
+            for (uint32_t room = 0; room < (uint32_t)scene->rooms.size(); ++room) {
+                float d = roomDistance(scene->rooms[room], c);
+                if (d < nearest) { nearest = d; cell = room; }
+            }
+            add(cell, mesh);
+            addTextures(cell, meshSlots[mesh]);
+        }
+    }
+
+    // Une fois par frame, avant le culling. Ne bloque jamais : récupère ce que les
+    // threads ont chargé, met à jour la file et envoie au GPU ce qui est prêt.
+    uint32_t update(const glm::vec3& eye, SceneGpu& gpu) {
+        ++frame;
+        uint32_t changes = 0;
+
+        // Résultats des threads -> mémoire centrale
+        std::vector<Loaded> results;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            results.swap(loaded);
+        }
+        for (auto& l : results) {
+            StreamResource& r = resources[l.resource];
+            r.pending = false;
+            if (l.data.empty()) {
+                r.failed = true;
+                std::cerr << "Streaming: cannot load " << r.path << std::endl;
+                continue;
+            }
+            r.data = std::move(l.data);
+            r.width = l.width; r.height = l.height; r.channels = l.channels;
+            stats.ramBytes += r.data.size();
+        }
+
+        // Demandes : ressources des pièces proches de la caméra
+        for (auto& r : resources) r.distance = FLT_MAX;
+        for (uint32_t cell = 0; cell < (uint32_t)cellResources.size(); ++cell) {
+            float d = roomDistance(scene->rooms[cell], eye);
+            if (d > budget.loadRadius) continue;
+            for (uint32_t id : cellResources[cell]) resources[id].distance = std::min(resources[id].distance, d);
+        }
+        for (auto& r : resources) {
+            bool wanted = r.distance <= budget.loadRadius && !r.failed;
+            if (wanted && !r.wanted) {
+                if (r.resident) ++stats.hits;
+                else if (r.type == STREAM_MESH || !r.data.empty()) ++stats.ramHits;
+                else ++stats.misses;
+            }
+            r.wanted = wanted;
+            if (wanted) r.lastWanted = frame;
+        }
+
+        // File des threads : retire ce qui n'est plus demandé, ajoute ce qui manque
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t j = 0; j < queue.size();) {
+                StreamResource& r = resources[queue[j].resource];
+                if (!r.wanted) {
+                    r.pending = false;
+                    queue[j] = queue.back();
+                    queue.pop_back();
+                    continue;
+                }
+                queue[j].distance = r.distance;
+                ++j;
+            }
+            for (uint32_t id = 0; id < (uint32_t)resources.size(); ++id) {
+                StreamResource& r = resources[id];
+                if (r.type != STREAM_TEXTURE || !r.wanted || r.resident || r.pending || !r.data.empty()) continue;
+                queue.push_back({ id, r.distance, r.path });
+                r.pending = true;
+            }
+        }
+        wake.notify_all();
+
+        // Envoi au GPU : les plus proches d'abord, dans la limite par frame
+        std::vector<uint32_t> ready;
+        for (uint32_t id = 0; id < (uint32_t)resources.size(); ++id) {
+            const StreamResource& r = resources[id];
+            if (r.wanted && !r.resident && (r.type == STREAM_MESH || !r.data.empty())) ready.push_back(id);
+        }
+        std::sort(ready.begin(), ready.end(), [&](uint32_t a, uint32_t b) { return resources[a].distance < resources[b].distance; });
+        size_t uploaded = 0;
+        for (uint32_t id : ready) {
+            if (uploaded >= budget.uploadBytesPerFrame) break;
+            StreamResource& r = resources[id];
+            if (!makeResident(r, gpu, changes)) continue;
+            uploaded += r.vramBytes;
+            ++stats.uploads;
+        }
+
+        // Budget de la mémoire centrale : les ressources déjà envoyées ou non demandées partent
+        while (stats.ramBytes > budget.ramBytes) {
+            StreamResource* victim = nullptr;
+            for (auto& r : resources) {
+                if (r.data.empty() || (r.wanted && !r.resident)) continue;
+                if (!victim || evictsBefore(r, *victim)) victim = &r;
+            }
+            if (!victim) break;
+            stats.ramBytes -= victim->data.size();
+            std::vector<uint8_t>().swap(victim->data);
+            ++stats.ramEvictions;
+        }
+
+        stats.pending = 0;
+        stats.residentMeshes = stats.residentTextures = 0;
+        for (auto const& r : resources) {
+            stats.pending += r.pending;
+            if (r.resident) ++(r.type == STREAM_MESH ? stats.residentMeshes : stats.residentTextures);
+        }
+        return changes;
+    }
+
+    size_t meshResourceCount() const {
+        return (size_t)std::count_if(resources.begin(), resources.end(), [](const StreamResource& r) { return r.type == STREAM_MESH && !r.failed; });
+    }
+    size_t textureResourceCount() const {
+        return (size_t)std::count_if(resources.begin(), resources.end(), [](const StreamResource& r) { return r.type == STREAM_TEXTURE; });
+    }
+
+private:
+    struct Job {
+        uint32_t resource;
+        float distance;
+        std::string path;
+    };
+    struct Loaded {
+        uint32_t resource;
+        std::vector<uint8_t> data; // vide : échec
+        int width, height, channels;
+    };
+
+    const SceneData* scene = nullptr;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<Job> queue;      // protégés par mutex
+    std::vector<Loaded> loaded;
+    bool stopping = false;
+
+    static float roomDistance(const SceneRoom& room, const glm::vec3& p) {
+        glm::vec3 d(0.0f);
+        for (int k = 0; k < 3; ++k) d[k] = std::max(std::max(room.min[k] - p[k], p[k] - room.max[k]), 0.0f);
+        return glm::length(d);
+    }
+
+    // Ordre d'éviction : non demandées d'abord (la plus anciennement demandée), puis les plus éloignées
+    static bool evictsBefore(const StreamResource& a, const StreamResource& b) {
+        if (a.wanted != b.wanted) return !a.wanted;
+        if (!a.wanted) return a.lastWanted < b.lastWanted;
+        return a.distance > b.distance;
+    }
+
+    // Ressource résidente du même type et moins prioritaire que requester
+    static bool evictableFor(const StreamResource& r, const StreamResource& requester) {
+        if (!r.resident || r.type != requester.type || &r == &requester) return false;
+        return !r.wanted || r.distance > requester.distance;
+    }
+
+    size_t evictableBytes(const StreamResource& requester) const {
+        size_t bytes = 0;
+        for (auto const& r : resources)
+            if (evictableFor(r, requester)) bytes += r.vramBytes;
+        return bytes;
+    }
+
+    // Évince de la mémoire vidéo une ressource du type donné moins prioritaire que
+    // requester ; false s'il n'y en a pas
+    bool evictFor(const StreamResource& requester, SceneGpu& gpu, uint32_t& changes) {
+        StreamResource* victim = nullptr;
+        for (auto& r : resources) {
+            if (!evictableFor(r, requester)) continue;
+            if (!victim || evictsBefore(r, *victim)) victim = &r;
+        }
+        if (!victim) return false;
+        if (victim->type == STREAM_MESH) {
+            gpu.pool.release(victim->allocation);
+            setMeshResidency(*scene, gpu, victim->mesh, nullptr);
+            stats.meshBytes -= victim->vramBytes;
+            changes |= STREAMING_MESHES_CHANGED;
+        } else {
+            glDeleteTextures(1, &victim->texture);
+            victim->texture = 0;
+            for (uint32_t slot : victim->slots) gpu.slotTextures[slot] = 0;
+            stats.textureBytes -= victim->vramBytes;
+            changes |= STREAMING_TEXTURES_CHANGED;
+        }
+        victim->resident = false;
+        ++stats.evictions;
+        return true;
+    }
+
+    bool makeResident(StreamResource& r, SceneGpu& gpu, uint32_t& changes) {
+        if (r.type == STREAM_MESH) {
+            const SceneMesh& mesh = scene->meshes[r.mesh];
+            if (mesh.vertexCount > gpu.pool.streamVertexCapacity || mesh.indexCount > gpu.pool.streamIndexCapacity) {
+                std::cerr << "Streaming: mesh " << scene->str(mesh.name) << " does not fit the mesh budget" << std::endl;
+                r.failed = true;
+                return false;
+            }
+            const float* vertices = scene->vertices.data() + (size_t)mesh.firstVertex * MESH_VERTEX_FLOATS;
+            const uint32_t* indices = scene->indices.data() + mesh.firstIndex;
+            const uint32_t* depthIndices = scene->depthIndices.data() + mesh.firstIndex;
+            size_t bytes = MeshPool::vertexBytes(mesh.vertexCount) + MeshPool::indexBytes(mesh.indexCount); // flux de profondeur compris
+            // Pas d'éviction partielle si la place ne peut pas être libérée (évite le va-et-vient)
+            if (stats.meshBytes - evictableBytes(r) + bytes > budget.meshBytes) return false;
+            while (!gpu.pool.upload(vertices, mesh.vertexCount, indices, mesh.indexCount, depthIndices, r.allocation))
+                if (!evictFor(r, gpu, changes)) return false;
+            r.vramBytes = bytes;
+            setMeshResidency(*scene, gpu, r.mesh, &r.allocation);
+            stats.meshBytes += r.vramBytes;
+            changes |= STREAMING_MESHES_CHANGED;
+        } else {
+            size_t bytes = (size_t)r.width * r.height * r.channels * 4 / 3; // + mipmaps
+            if (bytes > budget.textureBytes) {
+                std::cerr << "Streaming: texture " << r.path << " does not fit the texture budget" << std::endl;
+                r.failed = true;
+                return false;
+            }
+            if (stats.textureBytes - evictableBytes(r) + bytes > budget.textureBytes) return false;
+            while (stats.textureBytes + bytes > budget.textureBytes)
+                if (!evictFor(r, gpu, changes)) return false;
+            r.texture = createTexture2D(r.data.data(), r.width, r.height, r.channels);
+            if (!r.texture) { r.failed = true; return false; }
+            r.vramBytes = bytes;
+            for (uint32_t slot : r.slots) gpu.slotTextures[slot] = r.texture;
+            stats.textureBytes += bytes;
+            changes |= STREAMING_TEXTURES_CHANGED;
+        }
+        r.resident = true;
+        return true;
+    }
+
+    void workerLoop() {
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (stopping) return;
+                auto nearest = std::min_element(queue.begin(), queue.end(),
+                                                [](const Job& a, const Job& b) { return a.distance < b.distance; });
+                job = *nearest;
+                *nearest = queue.back();
+                queue.pop_back();
+            }
+            Loaded result = { job.resource, {}, 0, 0, 0 };
+            int width, height, channels;
+            unsigned char* pixels = stbi_load(job.path.c_str(), &width, &height, &channels, 0);
+            if (pixels) {
+                result.data.assign(pixels, pixels + (size_t)width * height * channels);
+                result.width = width; result.height = height; result.channels = channels;
+                stbi_image_free(pixels);
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            loaded.push_back(std::move(result));
+        }
+    }
+};
@@ -0,0 +1,143 @@
+#pragma once
+// ============================================================================
+// Hiérarchie de transformations à plat (SoA, ordre topologique)
+// ============================================================================
+// Chaque nœud a un parent d'indice inférieur au sien : un seul parcours
+// linéaire suffit pour propager les drapeaux "dirty" et recalculer les
+// matrices monde, sans pointeurs ni récursion. Seuls les nœuds modifiés et
+// leurs descendants sont recalculés ; la plage modifiée est renvoyée pour
+// n'envoyer que ces matrices dans le SSBO (drawTransforms.h). Les matrices
+// monde sont calculées une fois par frame et servent à toutes les passes.
+
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#include "drawTransforms.h" // DRAW_TRANSFORMS_SSE
+
+// Matrice 4x4 colonne par colonne (même disposition que glm::mat4), alignée pour SSE
+struct alignas(16) Matrix4 {
+    float m[16];
+};
+
+// out = a * b (out ne doit pas être a ou b)
+inline void multiplyMatrices(const Matrix4& a, const Matrix4& b, Matrix4& out) {
+#ifdef DRAW_TRANSFORMS_SSE
+    __m128 a0 = _mm_load_ps(a.m + 0);
+    __m128 a1 = _mm_load_ps(a.m + 4);
+    __m128 a2 = _mm_load_ps(a.m + 8);
+    __m128 a3 = _mm_load_ps(a.m + 12);
+    for (int j = 0; j < 4; ++j) {
+        const float* bj = b.m + 4 * j;
+        __m128 r = _mm_mul_ps(a0, _mm_set1_ps(bj[0]));
+        r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(bj[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(bj[2])));
+        r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(bj[3])));
+        _mm_store_ps(out.m + 4 * j, r);
+    }
+#else
+    for (int j = 0; j < 4; ++j)
+        for (int i = 0; i < 4; ++i)
+            out.m[4 * j + i] = a.m[i] * b.m[4 * j] + a.m[4 + i] * b.m[4 * j + 1]
+                             + a.m[8 + i] * b.m[4 * j + 2] + a.m[12 + i] * b.m[4 * j + 3];
+#endif
+}
+
+struct TransformHierarchy {
+    static const int32_t NO_PARENT = -1;
+
+    std::vector<int32_t> parent;  // parent[i] < i, ou NO_PARENT
+    std::vector<Matrix4> local;   // relative au parent
+    std::vector<Matrix4> world;   // calculée par update()
+    std::vector<uint8_t> dirty;
+
+    // Plage [changedBegin, changedEnd) des matrices monde recalculées au dernier update()
+    size_t changedBegin = 0;
+    size_t changedEnd = 0;
+
+    size_t size() const { return parent.size(); }
+    const float* worldData() const { return world.empty() ? nullptr : world[0].m; }
+
+    uint32_t add(int32_t parentNode, const float* localMatrix) {
+        uint32_t node = (uint32_t)parent.size();
+        if (parentNode >= (int32_t)node) parentNode = NO_PARENT; // l'ordre topologique est obligatoire
+        parent.push_back(parentNode);
+        Matrix4 m;
+        std::memcpy(m.m, localMatrix, sizeof(m.m));
+        local.push_back(m);
+        world.push_back(m);
+        dirty.push_back(1);
+        m_firstDirty = std::min(m_firstDirty, (size_t)node);
+        return node;
+    }
+
+    void setLocal(uint32_t node, const float* localMatrix) {
+        std::memcpy(local[node].m, localMatrix, sizeof(local[node].m));
+        dirty[node] = 1;
+        m_firstDirty = std::min(m_firstDirty, (size_t)node);
+    }
+
+    // Recalcule les nœuds modifiés et leurs descendants, renvoie leur nombre
+    size_t update() {
+        changedBegin = changedEnd = 0;
+        size_t n = parent.size();
+        if (m_firstDirty >= n) return 0;
+
+        size_t recomputed = 0;
+        size_t last = m_firstDirty;
+        for (size_t i = m_firstDirty; i < n; ++i) {
+            int32_t p = parent[i];
+            uint8_t d = dirty[i] | (p != NO_PARENT ? dirty[p] : 0);
+            if (!d) continue;
+            dirty[i] = 1; // propagé aux enfants, qui suivent dans le tableau
+            if (p == NO_PARENT) world[i] = local[i];
+            else multiplyMatrices(world[p], local[i], world[i]);
+            last = i;
+            ++recomputed;
+        }
+        changedBegin = m_firstDirty;
+        changedEnd = last + 1;
+        std::fill(dirty.begin() + changedBegin, dirty.begin() + changedEnd, 0);
+        m_firstDirty = n;
+        return recomputed;
+    }
+
+private:
+    size_t m_firstDirty = 0;
+};
+
+// --bench-transforms : arbre aléatoire, mise à jour complète puis partielle
+inline void benchmarkTransformHierarchy(size_t nodeCount) {
+    using Clock = std::chrono::high_resolution_clock;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+
+    TransformHierarchy h;
+    for (size_t i = 0; i < nodeCount; ++i) {
+        float m[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, offset(rng),offset(rng),offset(rng),1 };
+        // Arbre de degré 8 rangé en largeur (profondeur ~6 pour 100k nœuds)
+        h.add(i == 0 ? TransformHierarchy::NO_PARENT : (int32_t)((i - 1) / 8), m);
+    }
+
+    auto timeUpdate = [&](const char* label) {
+        auto start = Clock::now();
+        size_t recomputed = h.update();
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << label << ": " << recomputed << " nodes recomputed in " << ms << " ms" << std::endl;
+    };
+
+    std::cout << "Transform hierarchy: " << nodeCount << " nodes" << std::endl;
+    timeUpdate("  first update  ");
+    h.setLocal(0, h.local[0].m);
+    timeUpdate("  full update   ");
+    timeUpdate("  nothing dirty ");
+    for (size_t k = 0; k < nodeCount / 100; ++k) {
+        uint32_t node = (uint32_t)(rng() % nodeCount);
+        h.setLocal(node, h.local[node].m);
+    }
+    timeUpdate("  1% dirty      ");
+}
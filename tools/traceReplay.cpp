@@ -0,0 +1,84 @@
+// ============================================================================
+// traceReplay : rejoue une frame enregistrée par --gl-trace=record (touche T)
+// ============================================================================
+// Usage : traceReplay frame.gltrace [--frames=N]
+// Fenêtre cachée + contexte GL 4.6 neuf : la partie "setup" (création des
+// ressources) est rejouée une fois, puis la frame N fois. Affiche le temps CPU
+// de soumission et le temps total jusqu'à glFinish.
+
+#include <SDL3/SDL.h>
+#include <geGL/geGL.h>
+#include <geGL/StaticCalls.h>
+#include <geGL/TracePlayer.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace ge::gl;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <trace.gltrace> [--frames=N]" << std::endl;
+        return 1;
+    }
+    int frames = 100;
+    const char* framesPrefix = "--frames=";
+    for (int i = 2; i < argc; ++i)
+        if (std::strncmp(argv[i], framesPrefix, std::strlen(framesPrefix)) == 0)
+            frames = std::atoi(argv[i] + std::strlen(framesPrefix));
+
+    ge::gl::TracePlayer player;
+    if (!player.load(argv[1])) {
+        std::cerr << "Cannot load trace: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 6);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+    auto window = SDL_CreateWindow("traceReplay", 1920, 1080, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    auto context = window ? SDL_GL_CreateContext(window) : nullptr;
+    if (!context) {
+        std::cerr << "Cannot create OpenGL context: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+    ge::gl::init();
+    auto const& table = *ge::gl::getDefaultFunctionTable();
+
+    if (!player.playSetup(table)) {
+        std::cerr << "Setup uses a function unknown to this build" << std::endl;
+        return 1;
+    }
+    glFinish();
+
+    using Clock = std::chrono::high_resolution_clock;
+    double submitMs = 0.0;
+    auto const start = Clock::now();
+    for (int i = 0; i < frames; ++i) {
+        auto const frameStart = Clock::now();
+        if (!player.playFrame(table)) {
+            std::cerr << "Frame uses a function unknown to this build" << std::endl;
+            return 1;
+        }
+        submitMs += std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+    }
+    glFinish();
+    double const totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << frames << " frames, " << player.getNumberOfFrameCalls() << " calls per frame" << std::endl;
+    std::cout << "CPU submission: " << submitMs / frames << " ms/frame, total (glFinish): "
+              << totalMs / frames << " ms/frame" << std::endl;
+    if (player.getNumberOfMismatches())
+        std::cout << "Warning: " << player.getNumberOfMismatches()
+                  << " results differ from the recording (object names / locations)" << std::endl;
+
+    SDL_GL_DestroyContext(context);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return 0;
+}